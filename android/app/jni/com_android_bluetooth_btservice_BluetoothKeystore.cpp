@@ -22,6 +22,8 @@
 
 #include <string.h>
 #include <shared_mutex>
+#include <utility>
+#include <vector>
 
 using bluetooth::bluetooth_keystore::BluetoothKeystoreCallbacks;
 using bluetooth::bluetooth_keystore::BluetoothKeystoreInterface;
@@ -82,6 +84,60 @@ class BluetoothKeystoreCallbacksImpl
 
     return ret;
   }
+
+  // Batched variants attach the callback environment once for all the keys
+  void set_encrypt_keys_or_remove_keys(
+      std::vector<std::pair<std::string, std::string>> keys) override {
+    log::info("{} keys", keys.size());
+
+    std::shared_lock<std::shared_timed_mutex> lock(callbacks_mutex);
+    CallbackEnv sCallbackEnv(__func__);
+    if (!sCallbackEnv.valid() || mCallbacksObj == nullptr) return;
+
+    for (const auto& [prefixString, decryptedString] : keys) {
+      jstring j_prefixString = sCallbackEnv->NewStringUTF(prefixString.c_str());
+      jstring j_decryptedString =
+          sCallbackEnv->NewStringUTF(decryptedString.c_str());
+
+      sCallbackEnv->CallVoidMethod(mCallbacksObj,
+                                   method_setEncryptKeyOrRemoveKeyCallback,
+                                   j_prefixString, j_decryptedString);
+
+      sCallbackEnv->DeleteLocalRef(j_prefixString);
+      sCallbackEnv->DeleteLocalRef(j_decryptedString);
+    }
+  }
+
+  std::vector<std::string> get_keys(
+      std::vector<std::string> prefixStrings) override {
+    log::info("{} keys", prefixStrings.size());
+
+    std::vector<std::string> keys(prefixStrings.size());
+    std::shared_lock<std::shared_timed_mutex> lock(callbacks_mutex);
+    CallbackEnv sCallbackEnv(__func__);
+    if (!sCallbackEnv.valid() || mCallbacksObj == nullptr) return keys;
+
+    for (size_t i = 0; i < prefixStrings.size(); i++) {
+      jstring j_prefixString =
+          sCallbackEnv->NewStringUTF(prefixStrings[i].c_str());
+      jstring j_decrypt_str = (jstring)sCallbackEnv->CallObjectMethod(
+          mCallbacksObj, method_getKeyCallback, j_prefixString);
+      sCallbackEnv->DeleteLocalRef(j_prefixString);
+
+      if (j_decrypt_str == nullptr) {
+        log::error("Got a null decrypt_str");
+        continue;
+      }
+
+      const char* value =
+          sCallbackEnv->GetStringUTFChars(j_decrypt_str, nullptr);
+      keys[i] = value;
+      sCallbackEnv->ReleaseStringUTFChars(j_decrypt_str, value);
+      sCallbackEnv->DeleteLocalRef(j_decrypt_str);
+    }
+
+    return keys;
+  }
 };
 
 static BluetoothKeystoreCallbacksImpl sBluetoothKeystoreCallbacks;
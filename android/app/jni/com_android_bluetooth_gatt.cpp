@@ -108,6 +108,7 @@ namespace android {
 static jmethodID method_onClientRegistered;
 static jmethodID method_onScannerRegistered;
 static jmethodID method_onScanResult;
+static jmethodID method_onScanResults;
 static jmethodID method_onConnected;
 static jmethodID method_onDisconnected;
 static jmethodID method_onReadCharacteristic;
@@ -1030,6 +1031,25 @@ class JniScanningCallbacks : ScanningCallbacks {
         rssi, periodic_adv_int, jb.get(), fake_address.get());
   }
 
+  void OnScanResults(std::vector<uint8_t> records, int num_records) {
+    std::shared_lock<std::shared_mutex> lock(callbacks_mutex);
+    CallbackEnv sCallbackEnv(__func__);
+    if (!sCallbackEnv.valid() || !mCallbacksObj) return;
+
+    // The buffer wraps |records| without copying it, so it is only valid
+    // until the Java callback returns.
+    ScopedLocalRef<jobject> buffer(
+        sCallbackEnv.get(), sCallbackEnv->NewDirectByteBuffer(records.data(),
+                                                              records.size()));
+    if (buffer.get() == nullptr) {
+      log::error("Unable to wrap {} scan results", num_records);
+      return;
+    }
+
+    sCallbackEnv->CallVoidMethod(mCallbacksObj, method_onScanResults,
+                                 buffer.get(), num_records);
+  }
+
   void OnTrackAdvFoundLost(AdvertisingTrackInfo track_info) {
     std::shared_lock<std::shared_mutex> lock(callbacks_mutex);
     CallbackEnv sCallbackEnv(__func__);
@@ -2799,6 +2819,7 @@ static int register_com_android_bluetooth_gatt_(JNIEnv* env) {
       {"onScannerRegistered", "(IIJJ)V", &method_onScannerRegistered},
       {"onScanResult", "(IILjava/lang/String;IIIIII[BLjava/lang/String;)V",
        &method_onScanResult},
+      {"onScanResults", "(Ljava/nio/ByteBuffer;I)V", &method_onScanResults},
       {"onConnected", "(IIILjava/lang/String;)V", &method_onConnected},
       {"onDisconnected", "(IIILjava/lang/String;)V", &method_onDisconnected},
       {"onReadCharacteristic", "(III[B)V", &method_onReadCharacteristic},
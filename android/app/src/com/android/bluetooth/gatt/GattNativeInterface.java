@@ -18,9 +18,12 @@ package com.android.bluetooth.gatt;
 
 import android.os.RemoteException;
 
+import com.android.bluetooth.Utils;
 import com.android.internal.annotations.GuardedBy;
 import com.android.internal.annotations.VisibleForTesting;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.ArrayList;
 import java.util.List;
 
@@ -74,6 +77,36 @@ public class GattNativeInterface {
                 advertisingSid, txPower, rssi, periodicAdvInt, advData, originalAddress);
     }
 
+    /**
+     * Scan results delivered together, see {@code ScanningCallbacks::OnScanResults}. The buffer
+     * is only valid during this call.
+     */
+    void onScanResults(ByteBuffer records, int numRecords) {
+        records.order(ByteOrder.LITTLE_ENDIAN);
+        byte[] address = new byte[6];
+        for (int i = 0; i < numRecords && records.remaining() >= 18; i++) {
+            int eventType = records.getShort() & 0xFFFF;
+            int addressType = records.get() & 0xFF;
+            records.get(address);
+            int primaryPhy = records.get() & 0xFF;
+            int secondaryPhy = records.get() & 0xFF;
+            int advertisingSid = records.get() & 0xFF;
+            int txPower = records.get();
+            int rssi = records.get();
+            int periodicAdvInt = records.getShort() & 0xFFFF;
+            int advDataLen = records.getShort() & 0xFFFF;
+            if (records.remaining() < advDataLen) {
+                break;
+            }
+            byte[] advData = new byte[advDataLen];
+            records.get(advData);
+
+            getGattService().onScanResult(eventType, addressType,
+                    Utils.getAddressStringFromByte(address), primaryPhy, secondaryPhy,
+                    advertisingSid, txPower, rssi, periodicAdvInt, advData, "00:00:00:00:00:00");
+        }
+    }
+
     void onScannerRegistered(int status, int scannerId, long uuidLsb, long uuidMsb)
             throws RemoteException {
         getGattService().onScannerRegistered(status, scannerId, uuidLsb, uuidMsb);
@@ -269,8 +269,7 @@ class SourceAudioHalAsrc::Resampler {
   static const int KERNEL_Q = asrc::ResamplerTables::KERNEL_Q;
   static const int KERNEL_A = asrc::ResamplerTables::KERNEL_A;
 
-  const int32_t (*h_)[2 * KERNEL_A];
-  const int16_t (*d_)[2 * KERNEL_A];
+  const asrc::ResamplerTables::Phase* phases_;
 
   static const unsigned WSIZE = 64;
 
@@ -302,7 +301,7 @@ class SourceAudioHalAsrc::Resampler {
       unsigned wbuf = idx < WSIZE / 2 || idx >= WSIZE + WSIZE / 2;
       auto w = win_[wbuf] + ((idx + wbuf * WSIZE / 2) % WSIZE) - WSIZE / 2;
 
-      *out = Filter(w, h_[phy], mu, d_[phy]);
+      *out = Filter(w, phases_[phy].h, mu, phases_[phy].d);
       out += out_stride;
       nout--;
       in_pos_ += ratio;
@@ -339,7 +338,7 @@ class SourceAudioHalAsrc::Resampler {
         unsigned wbuf = idx < WSIZE / 2 || idx >= WSIZE + WSIZE / 2;
         auto w = win_[wbuf] + ((idx + wbuf * WSIZE / 2) % WSIZE) - WSIZE / 2;
 
-        *out = Filter(w, h_[phy], mu, d_[phy]);
+        *out = Filter(w, phases_[phy].h, mu, phases_[phy].d);
         out += out_stride;
         nout--;
         in_pos_ += ratio;
@@ -358,8 +357,7 @@ class SourceAudioHalAsrc::Resampler {
 
  public:
   Resampler(int bit_depth)
-      : h_(asrc::resampler_tables.h),
-        d_(asrc::resampler_tables.d),
+      : phases_(asrc::resampler_tables.phases),
         win_{{0}, {0}},
         out_pos_(0),
         in_pos_(0),
@@ -386,13 +384,32 @@ class SourceAudioHalAsrc::Resampler {
 };
 
 //
-// ARM AArch 64 Neon Resampler Filtering
+// ARM Neon Resampler Filtering
 //
 
-#if __ARM_NEON && __ARM_ARCH_ISA_A64
+#if __ARM_NEON
 
 #include <arm_neon.h>
 
+// The AArch 32 instruction set lacks the operations on the high halves
+// of the vectors, and the across vector additions.
+
+#if !__ARM_ARCH_ISA_A64
+
+static inline int32x4_t vmull_high_s16(int16x8_t a, int16x8_t b) {
+  return vmull_s16(vget_high_s16(a), vget_high_s16(b));
+}
+
+static inline int64x2_t vmlal_high_s32(int64x2_t r, int32x4_t a, int32x4_t b) {
+  return vmlal_s32(r, vget_high_s32(a), vget_high_s32(b));
+}
+
+static inline int64_t vaddvq_s64(int64x2_t a) {
+  return vgetq_lane_s64(a, 0) + vgetq_lane_s64(a, 1);
+}
+
+#endif
+
 static inline int32x4_t vmull_low_s16(int16x8_t a, int16x8_t b) {
   return vmull_s16(vget_low_s16(a), vget_low_s16(b));
 }
@@ -443,19 +460,113 @@ inline int32_t SourceAudioHalAsrc::Resampler::Filter(const int32_t* x,
   return std::clamp(s, int64_t(pcm_min_), int64_t(pcm_max_));
 }
 
+#else
+
 //
 // Generic Resampler Filtering
 //
 
-#else
+static inline int64_t FilterGeneric(const int32_t* in, const int32_t* h,
+                                    int16_t mu, const int16_t* d) {
+  int64_t s = 0;
+  for (int i = 0; i < 2 * asrc::ResamplerTables::KERNEL_A - 1; i++)
+    s += int64_t(in[i]) * (h[i] + ((mu * d[i] + (1 << 6)) >> 7));
+
+  return s;
+}
+
+//
+// x86 SSE4.1 and AVX2 Resampler Filtering, selected at runtime
+//
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+__attribute__((target("sse4.1"))) static int64_t FilterSse4(
+    const int32_t* x, const int32_t* h, int16_t _mu, const int16_t* d) {
+  __m128i sx = _mm_setzero_si128();
+
+  const __m128i mu = _mm_set1_epi32(_mu);
+  const __m128i rnd = _mm_set1_epi32(1 << 6);
+
+  for (int i = 0; i < 32; i += 4) {
+    __m128i d0 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(d + i)));
+    __m128i h0 = _mm_loadu_si128((const __m128i*)(h + i));
+    __m128i x0 = _mm_loadu_si128((const __m128i*)(x + i));
+
+    h0 = _mm_add_epi32(
+        h0, _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(d0, mu), rnd), 7));
+
+    // Multiply-accumulate the even, then the odd 32 bits lanes,
+    // in the two 64 bits lanes of the sum.
+
+    sx = _mm_add_epi64(sx, _mm_mul_epi32(x0, h0));
+    sx = _mm_add_epi64(
+        sx, _mm_mul_epi32(_mm_srli_epi64(x0, 32), _mm_srli_epi64(h0, 32)));
+  }
+
+  int64_t sv[2];
+  _mm_storeu_si128((__m128i*)sv, sx);
+  return sv[0] + sv[1];
+}
+
+__attribute__((target("avx2"))) static int64_t FilterAvx2(const int32_t* x,
+                                                           const int32_t* h,
+                                                           int16_t _mu,
+                                                           const int16_t* d) {
+  __m256i sx = _mm256_setzero_si256();
+
+  const __m256i mu = _mm256_set1_epi32(_mu);
+  const __m256i rnd = _mm256_set1_epi32(1 << 6);
+
+  for (int i = 0; i < 32; i += 8) {
+    __m256i d0 =
+        _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(d + i)));
+    __m256i h0 = _mm256_loadu_si256((const __m256i*)(h + i));
+    __m256i x0 = _mm256_loadu_si256((const __m256i*)(x + i));
+
+    h0 = _mm256_add_epi32(
+        h0, _mm256_srai_epi32(
+                _mm256_add_epi32(_mm256_mullo_epi32(d0, mu), rnd), 7));
+
+    sx = _mm256_add_epi64(sx, _mm256_mul_epi32(x0, h0));
+    sx = _mm256_add_epi64(sx, _mm256_mul_epi32(_mm256_srli_epi64(x0, 32),
+                                               _mm256_srli_epi64(h0, 32)));
+  }
+
+  __m128i s2 = _mm_add_epi64(_mm256_castsi256_si128(sx),
+                             _mm256_extracti128_si256(sx, 1));
+
+  int64_t sv[2];
+  _mm_storeu_si128((__m128i*)sv, s2);
+  return sv[0] + sv[1];
+}
+
+static const enum class FilterKernel {
+  GENERIC,
+  SSE4,
+  AVX2
+} filter_kernel = [] {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return FilterKernel::AVX2;
+  if (__builtin_cpu_supports("sse4.1")) return FilterKernel::SSE4;
+  return FilterKernel::GENERIC;
+}();
+
+#endif
 
 inline int32_t SourceAudioHalAsrc::Resampler::Filter(const int32_t* in,
                                                      const int32_t* h,
                                                      int16_t mu,
                                                      const int16_t* d) {
-  int64_t s = 0;
-  for (int i = 0; i < 2 * KERNEL_A - 1; i++)
-    s += int64_t(in[i]) * (h[i] + ((mu * d[i] + (1 << 6)) >> 7));
+#if defined(__x86_64__) || defined(__i386__)
+  int64_t s = filter_kernel == FilterKernel::AVX2   ? FilterAvx2(in, h, mu, d)
+              : filter_kernel == FilterKernel::SSE4 ? FilterSse4(in, h, mu, d)
+                                                    : FilterGeneric(in, h, mu, d);
+#else
+  int64_t s = FilterGeneric(in, h, mu, d);
+#endif
 
   s = (s + (1 << 30)) >> 31;
   return std::clamp(s, int64_t(pcm_min_), int64_t(pcm_max_));
@@ -516,7 +627,7 @@ SourceAudioHalAsrc::SourceAudioHalAsrc(
   auto& buffers = buffers_;
 
   int num_interval_samples =
-      channels * (interval_us_ * sample_rate_) / (1000 * 1000);
+      channels * ((int64_t(interval_us_) * sample_rate_) / (1000 * 1000));
   buffers_size_ = num_interval_samples *
                   (bit_depth_ <= 16 ? sizeof(int16_t) : sizeof(int32_t));
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "asrc_resampler.h"
+
+using ::benchmark::State;
+using namespace bluetooth::audio::asrc;
+
+namespace {
+
+class IdleClockSource : public ClockSource {
+  void Bind(ClockHandler*) override {}
+};
+
+// Resamples one second of stereo pseudo random noise at 48 kHz, by the
+// intervals of 10 ms of the LE Audio streams.
+template <typename T>
+void BM_Resample(State& state, int bit_depth) {
+  constexpr int kChannels = 2, kSampleRate = 48000, kIntervalUs = 10000;
+  constexpr int kIntervalSamples = kSampleRate / 100;
+
+  SourceAudioHalAsrc asrc(std::make_shared<IdleClockSource>(), kChannels,
+                          kSampleRate, bit_depth, kIntervalUs,
+                          /*num_burst_buffers*/ 0, /*burst_delay_ms*/ 0);
+
+  std::vector<T> pcm(kChannels * kIntervalSamples);
+  uint32_t seed = 1;
+  for (auto& sample : pcm) {
+    seed = seed * 1103515245u + 12345u;
+    sample = T(int32_t(seed) >> (32 - bit_depth));
+  }
+
+  std::vector<uint8_t> in(pcm.size() * sizeof(T));
+  memcpy(in.data(), pcm.data(), in.size());
+
+  for (auto _ : state) {
+    for (int i = 0; i < 100; i++) {
+      auto out = asrc.Run(in);
+      benchmark::DoNotOptimize(out);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kChannels * kSampleRate);
+}
+
+}  // namespace
+
+static void BM_Resample16(State& state) { BM_Resample<int16_t>(state, 16); }
+BENCHMARK(BM_Resample16);
+
+static void BM_Resample24(State& state) { BM_Resample<int32_t>(state, 24); }
+BENCHMARK(BM_Resample24);
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asrc_stage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace bluetooth::audio::asrc {
+
+// The link rate is estimated from the audio completed over windows of 10 s.
+// A larger deviation than 500 ppm is not a drift of the clocks, but the link
+// not keeping up or the stream pausing, the window is ignored.
+static constexpr double kLinkRateWindowUs = 10 * 1000 * 1000;
+static constexpr double kMaxLinkRateDeviation = 500e-6;
+
+static class : public ClockHandler {
+  void OnEvent(uint32_t, int, int) override {}
+} g_idle_handler;
+
+PacketClock::PacketClock(std::shared_ptr<ClockSource> link_clock_source,
+                         int interval_us)
+    : interval_us_(interval_us),
+      link_clock_source_(std::move(link_clock_source)),
+      handler_(&g_idle_handler),
+      packet_duration_us_(0),
+      pending_us_{0, 0},
+      rate_started_(false),
+      rate_last_us_(0),
+      rate_elapsed_us_(0),
+      rate_completed_us_(0),
+      link_rate_(1) {}
+
+PacketClock::~PacketClock() {
+  // The link clock source can outlive this adapter, make sure that it no
+  // longer reports events to it.
+  link_clock_source_->Bind(&g_idle_handler);
+}
+
+void PacketClock::Bind(ClockHandler* handler) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    handler_ = handler;
+    pending_us_[0] = pending_us_[1] = 0;
+    rate_started_ = false;
+  }
+  link_clock_source_->Bind(this);
+}
+
+void PacketClock::OnPacketQueued(unsigned duration_us) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+
+  // The duration of the packets only changes with the configuration of the
+  // encoders, a slow average smooths out the short packets.
+
+  if (packet_duration_us_ <= 0)
+    packet_duration_us_ = duration_us;
+  else
+    packet_duration_us_ += (duration_us - packet_duration_us_) / 16;
+}
+
+double PacketClock::GetLinkRate() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return link_rate_;
+}
+
+void PacketClock::OnEvent(uint32_t timestamp_us, int link_id,
+                          int num_of_completed_packets) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (packet_duration_us_ <= 0) return;
+
+  // The timestamps wrap around every ~71 minutes, much longer than the
+  // windows. The packets completed by the very first event were sent before
+  // the estimation started, and are not accounted.
+
+  if (link_id == 0 && rate_started_) {
+    rate_elapsed_us_ += uint32_t(timestamp_us - rate_last_us_);
+    rate_completed_us_ += num_of_completed_packets * packet_duration_us_;
+    rate_last_us_ = timestamp_us;
+
+    if (rate_elapsed_us_ >= kLinkRateWindowUs) {
+      double rate = rate_completed_us_ / rate_elapsed_us_;
+      if (std::abs(rate - 1) <= kMaxLinkRateDeviation)
+        link_rate_ += (rate - link_rate_) / 4;
+      rate_elapsed_us_ = rate_completed_us_ = 0;
+    }
+  } else if (link_id == 0) {
+    rate_started_ = true;
+    rate_last_us_ = timestamp_us;
+    rate_elapsed_us_ = rate_completed_us_ = 0;
+  }
+
+  // Report the completed intervals, the remaining part of an interval
+  // is reported with the next events.
+
+  auto& pending_us = pending_us_[link_id];
+  pending_us += num_of_completed_packets * packet_duration_us_;
+
+  int num_intervals = int(pending_us / interval_us_);
+  if (num_intervals <= 0) return;
+
+  pending_us -= num_intervals * interval_us_;
+  handler_->OnEvent(timestamp_us, link_id, num_intervals);
+}
+
+AsrcStage::AsrcStage(std::shared_ptr<ClockSource> clock_source, int channels,
+                     int sample_rate, int bit_depth, int interval_us)
+    : asrc_(std::move(clock_source), channels, sample_rate, bit_depth,
+            interval_us, /*num_burst_buffers*/ 0, /*burst_delay_ms*/ 0),
+      in_length_(0),
+      out_offset_(0) {
+  // The buffers of the resampler hold one interval of the PCM stream.
+
+  size_t num_interval_samples =
+      channels * ((int64_t(interval_us) * sample_rate) / (1000 * 1000));
+  in_.resize(num_interval_samples *
+             (bit_depth <= 16 ? sizeof(int16_t) : sizeof(int32_t)));
+}
+
+AsrcStage::~AsrcStage() {}
+
+size_t AsrcStage::InputRemaining() const { return in_.size() - in_length_; }
+
+void AsrcStage::Write(const uint8_t* data, size_t len) {
+  if (in_.empty()) return;
+
+  while (len > 0) {
+    size_t n = std::min(len, in_.size() - in_length_);
+    std::copy(data, data + n, in_.begin() + in_length_);
+    in_length_ += n;
+    data += n;
+    len -= n;
+
+    if (in_length_ < in_.size()) break;
+    in_length_ = 0;
+
+    // Drop the data already read before appending the resampled buffers
+
+    if (out_offset_ > 0) {
+      out_.erase(out_.begin(), out_.begin() + out_offset_);
+      out_offset_ = 0;
+    }
+
+    for (auto buffer : asrc_.Run(in_))
+      out_.insert(out_.end(), buffer->begin(), buffer->end());
+  }
+}
+
+size_t AsrcStage::Available() const { return out_.size() - out_offset_; }
+
+size_t AsrcStage::Read(uint8_t* data, size_t len) {
+  size_t n = std::min(len, Available());
+  std::copy(out_.begin() + out_offset_, out_.begin() + out_offset_ + n, data);
+  out_offset_ += n;
+
+  if (out_offset_ >= out_.size()) {
+    out_.clear();
+    out_offset_ = 0;
+  }
+
+  return n;
+}
+
+void AsrcStage::Flush() {
+  in_length_ = 0;
+  out_.clear();
+  out_offset_ = 0;
+}
+
+}  // namespace bluetooth::audio::asrc
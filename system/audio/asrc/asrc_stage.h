@@ -0,0 +1,109 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "asrc_resampler.h"
+
+namespace bluetooth::audio::asrc {
+
+// Clock source adapter for the transports whose packets do not carry a fixed
+// duration of audio (A2DP packets carry as many codec frames as the MTU
+// allows). The completed packets reported by the link clock source are
+// converted to a number of intervals of the ASRC, from the mean duration of
+// the audio carried by the packets.
+
+class PacketClock : public ClockSource, private ClockHandler {
+ public:
+  PacketClock(std::shared_ptr<ClockSource> link_clock_source, int interval_us);
+  ~PacketClock() override;
+
+  void Bind(ClockHandler* handler) override;
+
+  // Reports the duration of the audio carried by a packet given to the link.
+  void OnPacketQueued(unsigned duration_us);
+
+  // Returns the rate at which the first link completes the audio, relative to
+  // the local clock: the duration of the audio completed by the link for one
+  // second of the local clock. It is 1 until estimated.
+  double GetLinkRate();
+
+ private:
+  void OnEvent(uint32_t timestamp_us, int link_id,
+               int num_of_completed_packets) override;
+
+  const int interval_us_;
+  std::shared_ptr<ClockSource> link_clock_source_;
+
+  std::mutex mutex_;
+  ClockHandler* handler_;
+  double packet_duration_us_;
+  double pending_us_[2];
+
+  // Link rate estimation, over windows of the local clock
+  bool rate_started_;
+  uint32_t rate_last_us_;
+  double rate_elapsed_us_;
+  double rate_completed_us_;
+  double link_rate_;
+};
+
+// Pipeline stage, inserted between a PCM source paced by its own clock (the
+// audio HAL) and a consumer paced by the link. The PCM stream is written and
+// read by chunks of any size; it is resampled by intervals of `interval_us`
+// so that the stream follows the clock recovered from `clock_source`.
+
+class AsrcStage {
+ public:
+  AsrcStage(std::shared_ptr<ClockSource> clock_source, int channels,
+            int sample_rate, int bit_depth, int interval_us);
+  ~AsrcStage();
+
+  // Returns the number of bytes left to write to complete the current
+  // interval. The writes should not exceed it, not to read the PCM source
+  // ahead of time.
+  size_t InputRemaining() const;
+
+  // Writes `len` bytes of the PCM stream, and resamples each completed
+  // interval.
+  void Write(const uint8_t* data, size_t len);
+
+  // Returns the number of resampled bytes that can be read.
+  size_t Available() const;
+
+  // Reads up to `len` resampled bytes, returns the number of bytes read.
+  size_t Read(uint8_t* data, size_t len);
+
+  // Discards the buffered input and resampled data.
+  void Flush();
+
+ private:
+  SourceAudioHalAsrc asrc_;
+
+  std::vector<uint8_t> in_;
+  size_t in_length_;
+
+  std::vector<uint8_t> out_;
+  size_t out_offset_;
+};
+
+}  // namespace bluetooth::audio::asrc
@@ -23,3597 +23,3592 @@ namespace bluetooth::audio::asrc {
 // clang-format off
 const ResamplerTables resampler_tables = {
 
-  .h = {
+  .phases = {
 
-  {          0,          0,          0,          0,          0,          0,          0,          0,
-             0,          0,          0,          0,          0,          0,          0, 2147483647,
-             0,          0,          0,          0,          0,          0,          0,          0,
-             0,          0,          0,          0,          0,          0,          0 },
-  {       -140,        688,      -2315,       6266,     -14637,      30640,     -58875,     105625,
-       -179317,     291594,    -460083,     716145,   -1129337,    1906742,   -4088753, 2147469981,
-       4105509,   -1911174,    1131440,    -717386,     460885,    -292128,     179671,    -105854,
-         59017,     -30723,      14682,      -6289,       2325,       -692,        141 },
-  {       -278,       1373,      -4620,      12510,     -29227,      61195,    -117607,     211017,
-       -358273,     582643,    -919347,    1431024,   -2256533,    3808993,   -8160693, 2147428980,
-       8227714,   -3826721,    2264944,   -1435988,     922556,    -584781,     359691,    -211933,
-        118175,     -61527,      29408,     -12599,       4659,      -1387,        282 },
-  {       -415,       2054,      -6915,      18731,     -43772,      91666,    -176193,     316172,
-       -536862,     873137,   -1377777,    2144612,   -3381548,    5706692,  -12215763, 2147360646,
-      12366558,   -5746580,    3400474,   -2155779,    1384996,    -877947,     540052,    -318234,
-        177470,     -92413,      44179,     -18932,       7003,      -2087,        425 },
-  {       -552,       2731,      -9200,      24928,     -58270,     122050,    -234630,     421087,
-       -715077,    1163066,   -1835356,    2856883,   -4504345,    7599782,  -16253904, 2147264981,
-      16521980,   -7670691,    4537989,   -2876736,    1848189,   -1171616,     720749,    -424753,
-        236900,    -123378,      58993,     -25287,       9357,      -2789,        568 },
-  {       -687,       3404,     -11474,      31103,     -72722,     152348,    -292918,     525759,
-       -892913,    1452419,   -2292067,    3567813,   -5624884,    9488202,  -20275062, 2147141986,
-      20693920,   -9598992,    5677450,   -3598831,    2312118,   -1465777,     901775,    -531486,
-        296465,    -154422,      73850,     -31663,      11721,      -3496,        713 },
-  {       -821,       4074,     -13739,      37255,     -87126,     182557,    -351055,     630184,
-      -1070363,    1741187,   -2747896,    4277377,   -6743128,   11371896,  -24279180, 2146991666,
-      24882319,  -11531423,    6818819,   -4322040,    2776767,   -1760421,    1083123,    -638430,
-        356161,    -185544,      88751,     -38061,      14094,      -4206,        859 },
-  {       -955,       4740,     -15994,      43382,    -101482,     212677,    -409037,     734357,
-      -1247421,    2029359,   -3202825,    4985550,   -7859040,   13250804,  -28266203, 2146814023,
-      29087114,  -13467923,    7962054,   -5046336,    3242118,   -2055537,    1264788,    -745580,
-        415987,    -216743,     103693,     -44480,      16477,      -4919,       1006 },
-  {      -1087,       5402,     -18238,      49487,    -115789,     242708,    -466864,     838276,
-      -1424081,    2316925,   -3656839,    5692308,   -8972580,   15124869,  -32236076, 2146609061,
-      33308246,  -15408430,    9107118,   -5771694,    3708156,   -2351113,    1446762,    -852934,
-        475941,    -248018,     118678,     -50920,      18869,      -5637,       1154 },
-  {      -1218,       6060,     -20472,      55567,    -130048,     272648,    -524533,     941938,
-      -1600337,    2603875,   -4109922,    6397625,  -10083711,   16994033,  -36188744, 2146376785,
-      37545650,  -17352882,   10253969,   -6498088,    4174863,   -2647140,    1629040,    -960486,
-        536020,    -279367,     133704,     -57381,      21270,      -6357,       1302 },
-  {      -1348,       6715,     -22695,      61623,    -144258,     302495,    -582042,    1045337,
-      -1776183,    2890199,   -4562058,    7101477,  -11192397,   18858239,  -40124154, 2146117201,
-      41799266,  -19301218,   11402568,   -7225491,    4642223,   -2943606,    1811614,   -1068235,
-        596223,    -310790,     148770,     -63863,      23680,      -7081,       1452 },
-  {      -1477,       7366,     -24908,      67656,    -158418,     332250,    -639390,    1148472,
-      -1951612,    3175887,   -5013231,    7803841,  -12298598,   20717430,  -44042253, 2145830315,
-      46069030,  -21253374,   12552874,   -7953879,    5110218,   -3240501,    1994478,   -1176174,
-        656546,    -342285,     163877,     -70365,      26100,      -7809,       1603 },
-  {      -1605,       8013,     -27111,      73663,    -172528,     361911,    -696575,    1251338,
-      -2126618,    3460929,   -5463425,    8504691,  -13402279,   22571549,  -47942988, 2145516133,
-      50354879,  -23209287,   13704847,   -8683223,    5578832,   -3537815,    2177625,   -1284301,
-        716989,    -373852,     179024,     -76887,      28529,      -8540,       1755 },
-  {      -1732,       8656,     -29303,      79647,    -186587,     391477,    -753595,    1353933,
-      -2301196,    3745316,   -5912626,    9204003,  -14503403,   24420541,  -51826306, 2145174663,
-      54656748,  -25168896,   14858447,   -9413499,    6048048,   -3835536,    2361049,   -1392612,
-        777549,    -405490,     194210,     -83429,      30967,      -9275,       1908 },
-  {      -1858,       9295,     -31484,      85605,    -200596,     420948,    -810447,    1456252,
-      -2475340,    4029037,   -6360817,    9901754,  -15601931,   26264348,  -55692156, 2144805912,
-      58974573,  -27132137,   16013633,  -10144680,    6517848,   -4133653,    2544744,   -1501103,
-        838224,    -437196,     209435,     -89992,      33414,     -10013,       2062 },
-  {      -1982,       9931,     -33655,      91539,    -214553,     450322,    -867130,    1558292,
-      -2649044,    4312082,   -6807983,   10597920,  -16697829,   28102916,  -59540487, 2144409890,
-      63308290,  -29098946,   17170364,  -10876739,    6988216,   -4432156,    2728702,   -1609770,
-        899012,    -468971,     224698,     -96573,      35870,     -10755,       2217 },
-  {      -2106,      10562,     -35815,      97448,    -228458,     479598,    -923643,    1660049,
-      -2822301,    4594443,   -7254108,   11292475,  -17791058,   29936188,  -63371247, 2143986605,
-      67657832,  -31069260,   18328599,  -11609650,    7459134,   -4731034,    2912917,   -1718609,
-        959910,    -500813,     239999,    -103175,      38335,     -11500,       2373 },
-  {      -2229,      11190,     -37964,     103331,    -242311,     508776,    -979983,    1761522,
-      -2995106,    4876108,   -7699177,   11985398,  -18881583,   31764111,  -67184388, 2143536068,
-      72023133,  -33043014,   19488299,  -12343387,    7930585,   -5030275,    3097382,   -1827617,
-       1020916,    -532720,     255338,    -109795,      40808,     -12248,       2530 },
-  {      -2351,      11814,     -40102,     109189,    -256112,     537855,   -1036148,    1862705,
-      -3167453,    5157070,   -8143174,   12676663,  -19969368,   33586628,  -70979859, 2143058289,
-      76404128,  -35020145,   20649420,  -13077922,    8402552,   -5329870,    3282090,   -1936788,
-       1082029,    -564693,     270713,    -116435,      43291,     -13000,       2689 },
-  {      -2471,      12434,     -42230,     115022,    -269860,     566833,   -1092138,    1963595,
-      -3339336,    5437317,   -8586085,   13366248,  -21054376,   35403685,  -74757612, 2142553278,
-      80800749,  -37000587,   21811922,  -13813229,    8875018,   -5629806,    3467036,   -2046120,
-       1143246,    -596729,     286124,    -123093,      45782,     -13756,       2848 },
-  {      -2591,      13050,     -44347,     120829,    -283554,     595710,   -1147949,    2064190,
-      -3510749,    5716840,   -9027895,   14054129,  -22136572,   37215229,  -78517597, 2142021049,
-      85212929,  -38984277,   22975765,  -14549281,    9347964,   -5930074,    3652211,   -2155609,
-       1204565,    -628828,     301571,    -129770,      48281,     -14514,       3008 },
-  {      -2709,      13662,     -46452,     126610,    -297194,     624485,   -1203580,    2164486,
-      -3681687,    5995631,   -9468587,   14740283,  -23215919,   39021205,  -82259766, 2141461613,
-      89640600,  -40971148,   24140905,  -15286052,    9821375,   -6230661,    3837609,   -2265249,
-       1265984,    -660989,     317053,    -136465,      50789,     -15276,       3169 },
-  {      -2827,      14271,     -48547,     132365,    -310780,     653157,   -1259029,    2264479,
-      -3852144,    6273678,   -9908147,   15424686,  -24292383,   40821559,  -85984073, 2140874983,
-      94083693,  -42961136,   25307302,  -16023513,   10295232,   -6531557,    4023224,   -2375038,
-       1327500,    -693210,     332570,    -143178,      53306,     -16041,       3331 },
-  {      -2943,      14875,     -50631,     138094,    -324312,     681726,   -1314295,    2364167,
-      -4022114,    6550974,  -10346561,   16107315,  -25365928,   42616239,  -89690470, 2140261173,
-      98542140,  -44954175,   26474914,  -16761639,   10769517,   -6832750,    4209048,   -2484972,
-       1389111,    -725490,     348121,    -149910,      55830,     -16810,       3494 },
-  {      -3059,      15476,     -52703,     143797,    -337789,     710189,   -1369376,    2463546,
-      -4191591,    6827508,  -10783812,   16788147,  -26436519,   44405192,  -93378911, 2139620197,
-     103015870,  -46950199,   27643699,  -17500402,   11244214,   -7134230,    4395074,   -2595046,
-       1450816,    -757828,     363706,    -156659,      58363,     -17582,       3659 },
-  {      -3173,      16072,     -54765,     149473,    -351210,     738547,   -1424270,    2562612,
-      -4360570,    7103271,  -11219887,   17467159,  -27504121,   46188364,  -97049350, 2138952071,
-     107504815,  -48949143,   28813615,  -18239775,   11719304,   -7435986,    4581297,   -2705256,
-       1512611,    -790223,     379324,    -163425,      60905,     -18357,       3824 },
-  {      -3286,      16665,     -56815,     155123,    -364576,     766798,   -1478975,    2661363,
-      -4529046,    7378255,  -11654771,   18144329,  -28568698,   47965704, -100701741, 2138256809,
-     112008904,  -50950939,   29984619,  -18979731,   12194771,   -7738005,    4767708,   -2815598,
-       1574494,    -822674,     394974,    -170209,      63454,     -19135,       3990 },
-  {      -3399,      17253,     -58854,     160746,    -377885,     794942,   -1533489,    2759796,
-      -4697011,    7652448,  -12088448,   18819633,  -29630217,   49737160, -104336040, 2137534429,
-     116528065,  -52955522,   31156670,  -19720242,   12670595,   -8040277,    4954301,   -2926068,
-       1636464,    -855179,     410656,    -177009,      66011,     -19916,       4157 },
-  {      -3510,      17838,     -60882,     166343,    -391138,     822979,   -1587812,    2857907,
-      -4864462,    7925844,  -12520905,   19493049,  -30688643,   51502679, -107952202, 2136784946,
-     121062229,  -54962824,   32329726,  -20461281,   13146760,   -8342790,    5141069,   -3036663,
-       1698518,    -887738,     426370,    -183827,      68576,     -20701,       4325 },
-  {      -3620,      18419,     -62899,     171912,    -404334,     850906,   -1641941,    2955692,
-      -5031393,    8198432,  -12952127,   20164555,  -31743941,   53262211, -111550184, 2136008379,
-     125611322,  -56972778,   33503743,  -21202820,   13623248,   -8645534,    5328005,   -3147377,
-       1760654,    -920349,     442114,    -190661,      71150,     -21489,       4495 },
-  {      -3729,      18995,     -64904,     177454,    -417473,     878723,   -1695874,    3053150,
-      -5197797,    8470202,  -13382098,   20834128,  -32796078,   55015705, -115129943, 2135204746,
-     130175273,  -58985318,   34678680,  -21944833,   14100041,   -8948497,    5515102,   -3258207,
-       1822869,    -953011,     457889,    -197511,      73731,     -22280,       4665 },
-  {      -3837,      19568,     -66897,     182969,    -430554,     906429,   -1749610,    3150276,
-      -5363670,    8741148,  -13810806,   21501746,  -33845019,   56763109, -118691435, 2134374064,
-     134754009,  -61000375,   35854493,  -22687291,   14577121,   -9251667,    5702353,   -3369150,
-       1885162,    -985723,     473693,    -204377,      76319,     -23074,       4836 },
-  {      -3944,      20137,     -68880,     188456,    -443577,     934024,   -1803147,    3247068,
-      -5529006,    9011258,  -14238235,   22167386,  -34890731,   58504374, -122234619, 2133516355,
-     139347456,  -63017882,   37031139,  -23430166,   15054471,   -9555033,    5889751,   -3480199,
-       1947529,   -1018483,     489527,    -211260,      78915,     -23871,       5008 },
-  {      -4050,      20702,     -70851,     193916,    -456542,     961507,   -1856483,    3343523,
-      -5693799,    9280524,  -14664371,   22831027,  -35933179,   60239449, -125759453, 2132631636,
-     143955541,  -65037771,   38208577,  -24173432,   15532071,   -9858583,    6077289,   -3591352,
-       2009969,   -1051292,     505389,    -218158,      81519,     -24672,       5181 },
-  {      -4155,      21262,     -72810,     199348,    -469448,     988877,   -1909617,    3439637,
-      -5858045,    9548938,  -15089201,   23492647,  -36972332,   61968284, -129265895, 2131719931,
-     148578190,  -67059973,   39386762,  -24917060,   16009905,  -10162307,    6264960,   -3702605,
-       2072479,   -1084146,     521280,    -225071,      84130,     -25475,       5355 },
-  {      -4259,      21819,     -74758,     204753,    -482295,    1016133,   -1962548,    3535407,
-      -6021738,    9816490,  -15512709,   24152223,  -38008155,   63690831, -132753906, 2130781258,
-     153215328,  -69084421,   40565652,  -25661023,   16487953,  -10466193,    6452756,   -3813952,
-       2135057,   -1117046,     537198,    -231999,      86749,     -26282,       5531 },
-  {      -4362,      22372,     -76694,     210129,    -495083,    1043274,   -2015273,    3630831,
-      -6184873,   10083172,  -15934883,   24809735,  -39040615,   65407040, -136223446, 2129815641,
-     157866881,  -71111044,   41745204,  -26405292,   16966199,  -10770229,    6640672,   -3925391,
-       2197701,   -1149989,     553143,    -238943,      89375,     -27091,       5707 },
-  {      -4464,      22921,     -78619,     215478,    -507811,    1070299,   -2067791,    3725905,
-      -6347443,   10348975,  -16355707,   25465160,  -40069680,   67116863, -139674474, 2128823102,
-     162532772,  -73139775,   42925374,  -27149840,   17444625,  -11074403,    6828699,   -4036916,
-       2260407,   -1182975,     569114,    -245901,      92008,     -27903,       5884 },
-  {      -4565,      23465,     -80531,     220798,    -520479,    1097209,   -2120100,    3820627,
-      -6509446,   10613890,  -16775169,   26118477,  -41095316,   68820250, -143106953, 2127803664,
-     167212925,  -75170544,   44106118,  -27894638,   17923210,  -11378705,    7016830,   -4148524,
-       2323175,   -1216003,     585111,    -252873,      94648,     -28719,       6062 },
-  {      -4664,      24006,     -82433,     226090,    -533087,    1124001,   -2172199,    3914992,
-      -6670874,   10877908,  -17193253,   26769665,  -42117492,   70517154, -146520843, 2126757350,
-     171907264,  -77203282,   45287394,  -28639659,   18401939,  -11683122,    7205059,   -4260210,
-       2386002,   -1249071,     601133,    -259860,      97295,     -29537,       6241 },
-  {      -4763,      24543,     -84322,     231353,    -545634,    1150676,   -2224087,    4009000,
-      -6831722,   11141021,  -17609948,   27418702,  -43136176,   72207528, -149916107, 2125684186,
-     176615712,  -79237919,   46469156,  -29384875,   18880792,  -11987643,    7393378,   -4371970,
-       2448884,   -1282178,     617179,    -266860,      99950,     -30358,       6421 },
-  {      -4861,      25075,     -86200,     236588,    -558120,    1177232,   -2275761,    4102646,
-      -6991987,   11403221,  -18025238,   28065568,  -44151334,   73891323, -153292707, 2124584196,
-     181338192,  -81274386,   47651363,  -30130256,   19359752,  -12292256,    7581779,   -4483800,
-       2511820,   -1315322,     633250,    -273875,     102611,     -31183,       6601 },
-  {      -4958,      25604,     -88066,     241794,    -570544,    1203669,   -2327220,    4195927,
-      -7151662,   11664499,  -18439111,   28710241,  -45162935,   75568493, -156650607, 2123457406,
-     186074626,  -83312611,   48833970,  -30875776,   19838799,  -12596950,    7770257,   -4595696,
-       2574808,   -1348503,     649344,    -280902,     105278,     -32010,       6783 },
-  {      -5053,      26128,     -89920,     246971,    -582907,    1229986,   -2378463,    4288842,
-      -7310742,   11924846,  -18851553,   29352700,  -46170948,   77238990, -159989771, 2122303842,
-     190824935,  -85352525,   50016933,  -31621405,   20317916,  -12901713,    7958803,   -4707652,
-       2637845,   -1381720,     665461,    -287943,     107953,     -32840,       6966 },
-  {      -5148,      26649,     -91762,     252120,    -595207,    1256181,   -2429488,    4381386,
-      -7469223,   12184254,  -19262550,   29992925,  -47175341,   78902770, -163310163, 2121123531,
-     195589041,  -87394058,   51200207,  -32367116,   20797084,  -13206533,    8147410,   -4819666,
-       2700928,   -1414970,     681601,    -294997,     110634,     -33672,       7150 },
-  {      -5242,      27165,     -93592,     257239,    -607446,    1282256,   -2480293,    4473557,
-      -7627099,   12442714,  -19672089,   30630895,  -48176082,   80559784, -166611747, 2119916500,
-     200366864,  -89437138,   52383750,  -33112880,   21276285,  -13511399,    8336071,   -4931733,
-       2764056,   -1448254,     697761,    -302063,     113321,     -34508,       7335 },
-  {      -5334,      27677,     -95411,     262329,    -619621,    1308208,   -2530878,    4565352,
-      -7784366,   12700219,  -20080158,   31266590,  -49173140,   82209988, -169894489, 2118682778,
-     205158325,  -91481695,   53567516,  -33858668,   21755501,  -13816298,    8524779,   -5043847,
-       2827226,   -1481569,     713943,    -309142,     116015,     -35346,       7520 },
-  {      -5426,      28185,     -97217,     267390,    -631734,    1334037,   -2581240,    4656769,
-      -7941018,   12956761,  -20486742,   31899988,  -50166485,   83853337, -173158356, 2117422394,
-     209963344,  -93527657,   54751461,  -34604452,   22234712,  -14121219,    8713526,   -5156006,
-       2890435,   -1514914,     730146,    -316233,     118716,     -36187,       7707 },
-  {      -5516,      28690,     -99012,     272422,    -643783,    1359743,   -2631378,    4747805,
-      -8097051,   13212330,  -20891829,   32531071,  -51156085,   85489784, -176403313, 2116135376,
-     214781840,  -95574954,   55935542,  -35350204,   22713901,  -14426151,    8902306,   -5268205,
-       2953681,   -1548288,     746368,    -323336,     121422,     -37031,       7894 },
-  {      -5606,      29190,    -100794,     277424,    -655769,    1385324,   -2681291,    4838456,
-      -8252459,   13466919,  -21295405,   33159817,  -52141911,   87119286, -179629328, 2114821754,
-     219613732,  -97623513,   57119713,  -36095894,   23193049,  -14731080,    9091110,   -5380439,
-       3016961,   -1581690,     762609,    -330451,     124134,     -37877,       8083 },
-  {      -5694,      29686,    -102564,     282396,    -667691,    1410780,   -2730977,    4928720,
-      -8407239,   13720519,  -21697458,   33786206,  -53123931,   88741798, -182836369, 2113481560,
-     224458939,  -99673263,   58303930,  -36841495,   23672137,  -15035996,    9279932,   -5492704,
-       3080274,   -1615118,     778869,    -337577,     126853,     -38727,       8272 },
-  {      -5782,      30178,    -104323,     287339,    -679549,    1436111,   -2780435,    5018595,
-      -8561384,   13973124,  -22097975,   34410219,  -54102116,   90357277, -186024402, 2112114824,
-     229317379, -101724131,   59488148,  -37586978,   24151148,  -15340887,    9468764,   -5604996,
-       3143616,   -1648572,     795148,    -344714,     129578,     -39578,       8462 },
-  {      -5869,      30666,    -106069,     292252,    -691342,    1461315,   -2829663,    5108078,
-      -8714890,   14224724,  -22496943,   35031837,  -55076436,   91965677, -189193398, 2110721579,
-     234188969, -103776046,   60672322,  -38332313,   24630061,  -15645741,    9657598,   -5717310,
-       3206986,   -1682049,     811443,    -351862,     132308,     -40433,       8653 },
-  {      -5954,      31149,    -107803,     297135,    -703071,    1486392,   -2878660,    5197165,
-      -8867754,   14475312,  -22894349,   35651038,  -56046860,   93566957, -192343325, 2109301856,
-     239073627, -105828936,   61856409,  -39077472,   25108859,  -15950545,    9846429,   -5829642,
-       3270380,   -1715549,     827755,    -359021,     135044,     -41290,       8845 },
-  {      -6039,      31629,    -109525,     301989,    -714734,    1511341,   -2927425,    5285855,
-      -9019969,   14724879,  -23290181,   36267804,  -57013359,   95161072, -195474154, 2107855690,
-     243971269, -107882726,   63040362,  -39822427,   25587523,  -16255288,   10035247,   -5941988,
-       3333797,   -1749070,     844084,    -366190,     137786,     -42149,       9038 },
-  {      -6122,      32105,    -111235,     306812,    -726332,    1536161,   -2975956,    5374145,
-      -9171531,   14973419,  -23684427,   36882115,  -57975905,   96747981, -198585854, 2106383112,
-     248881812, -109937346,   64224137,  -40567148,   26066034,  -16559958,   10224045,   -6054343,
-       3397233,   -1782612,     860428,    -373369,     140533,     -43011,       9232 },
-  {      -6205,      32576,    -112932,     311604,    -737865,    1560853,   -3024251,    5462032,
-      -9322436,   15220923,  -24077073,   37493953,  -58934467,   98327641, -201678396, 2104884159,
-     253805172, -111992721,   65407689,  -41311606,   26544374,  -16864544,   10412817,   -6166702,
-       3460687,   -1816172,     876786,    -380558,     143285,     -43876,       9427 },
-  {      -6286,      33044,    -114618,     316367,    -749332,    1585415,   -3072310,    5549513,
-      -9472678,   15467384,  -24468108,   38103297,  -59889016,   99900010, -204751752, 2103358864,
-     258741265, -114048779,   66590973,  -42055773,   27022523,  -17169032,   10601555,   -6279062,
-       3524155,   -1849749,     893160,    -387756,     146043,     -44743,       9622 },
-  {      -6367,      33507,    -116291,     321099,    -760732,    1609846,   -3120132,    5636587,
-      -9622254,   15712794,  -24857519,   38710129,  -60839525,  101465046, -207805893, 2101807263,
-     263690004, -116105447,   67773944,  -42799620,   27500464,  -17473411,   10790250,   -6391418,
-       3587636,   -1883343,     909546,    -394964,     148807,     -45612,       9819 },
-  {      -6446,      33966,    -117952,     325801,    -772067,    1634146,   -3167714,    5723250,
-      -9771159,   15957145,  -25245294,   39314430,  -61785964,  103022708, -210840793, 2100229392,
-     268651306, -118162649,   68956555,  -43543117,   27978177,  -17777669,   10978897,   -6503765,
-       3651127,   -1916952,     925946,    -402180,     151575,     -46484,      10016 },
-  {      -6525,      34421,    -119600,     330472,    -783334,    1658315,   -3215055,    5809500,
-      -9919389,   16200430,  -25631421,   39916181,  -62728305,  104572956, -213856425, 2098625289,
-     273625084, -120220314,   70138763,  -44286236,   28455643,  -18081794,   11167487,   -6616100,
-       3714626,   -1950573,     942358,    -409406,     154349,     -47358,      10215 },
-  {      -6602,      34872,    -121236,     335112,    -794535,    1682352,   -3262155,    5895334,
-     -10066938,   16442641,  -26015887,   40515364,  -63666520,  106115748, -216852761, 2096994989,
-     278611252, -122278367,   71320521,  -45028947,   28932843,  -18385774,   11356013,   -6728416,
-       3778129,   -1984207,     958782,    -416639,     157127,     -48235,      10414 },
-  {      -6679,      35319,    -122860,     339722,    -805668,    1706255,   -3309011,    5980750,
-     -10213803,   16683772,  -26398682,   41111959,  -64600581,  107651045, -219829776, 2095338532,
-     283609724, -124336734,   72501784,  -45771221,   29409760,  -18689597,   11544467,   -6840711,
-       3841634,   -2017852,     975217,    -423881,     159910,     -49114,      10614 },
-  {      -6754,      35762,    -124472,     344301,    -816735,    1730025,   -3355623,    6065745,
-     -10359978,   16923814,  -26779793,   41705949,  -65530460,  109178806, -222787445, 2093655956,
-     288620412, -126395340,   73682507,  -46513030,   29886373,  -18993251,   11732842,   -6952980,
-       3905139,   -2051507,     991663,    -431131,     162698,     -49995,      10815 },
-  {      -6829,      36201,    -126071,     348849,    -827733,    1753661,   -3401990,    6150318,
-     -10505461,   17162760,  -27159208,   42297316,  -66456129,  110698992, -225725743, 2091947299,
-     293643229, -128454111,   74862644,  -47254344,   30362664,  -19296723,   11921131,   -7065217,
-       3968642,   -2085169,    1008118,    -438389,     165491,     -50879,      11016 },
-  {      -6903,      36636,    -127658,     353366,    -838663,    1777163,   -3448109,    6234465,
-     -10650246,   17400603,  -27536916,   42886041,  -67377562,  112211564, -228644645, 2090212602,
-     298678087, -130512973,   76042149,  -47995133,   30838614,  -19600002,   12109325,   -7177420,
-       4032139,   -2118839,    1024583,    -445654,     168288,     -51765,      11219 },
-  {      -6975,      37066,    -129232,     357852,    -849526,    1800529,   -3493981,    6318185,
-     -10794329,   17637335,  -27912905,   43472106,  -68294731,  113716483, -231544129, 2088451906,
-     303724899, -132571850,   77220976,  -48735369,   31314204,  -19903076,   12297418,   -7289582,
-       4095628,   -2152514,    1041056,    -452926,     171089,     -52653,      11422 },
-  {      -7047,      37493,    -130794,     362306,    -860320,    1823759,   -3539603,    6401474,
-     -10937706,   17872951,  -28287164,   44055494,  -69207609,  115213710, -234424171, 2086665250,
-     308783574, -134630668,   78399081,  -49475022,   31789415,  -20205931,   12485401,   -7401700,
-       4159107,   -2186193,    1057537,    -460204,     173895,     -53543,      11626 },
-  {      -7118,      37915,    -132343,     366730,    -871045,    1846853,   -3584974,    6484331,
-     -11080373,   18107442,  -28659681,   44636186,  -70116170,  116703208, -237284748, 2084852676,
-     313854024, -136689351,   79576416,  -50214063,   32264229,  -20508557,   12673267,   -7513769,
-       4222574,   -2219874,    1074025,    -467489,     176705,     -54435,      11831 },
-  {      -7187,      38334,    -133880,     371122,    -881702,    1869810,   -3630093,    6566753,
-     -11222326,   18340801,  -29030444,   45214165,  -71020386,  118184939, -240125839, 2083014227,
-     318936160, -138747824,   80752936,  -50952463,   32738625,  -20810941,   12861009,   -7625785,
-       4286024,   -2253558,    1090519,    -474781,     179520,     -55329,      12037 },
-  {      -7256,      38748,    -135405,     375483,    -892289,    1892629,   -3674960,    6648738,
-     -11363560,   18573022,  -29399443,   45789414,  -71920233,  119658865, -242947422, 2081149946,
-     324029892, -140806012,   81928596,  -51690192,   33212585,  -21113071,   13048619,   -7737743,
-       4349457,   -2287241,    1107020,    -482078,     182338,     -56226,      12244 },
-  {      -7324,      39158,    -136917,     379812,    -902807,    1915311,   -3719572,    6730284,
-     -11504071,   18804097,  -29766667,   46361915,  -72815683,  121124949, -245749476, 2079259875,
-     329135129, -142863839,   83103348,  -52427221,   33686091,  -21414934,   13236090,   -7849638,
-       4412869,   -2320923,    1123526,    -489381,     185160,     -57124,      12451 },
-  {      -7391,      39564,    -138417,     384110,    -913256,    1937854,   -3763929,    6811387,
-     -11643856,   19034020,  -30132104,   46931652,  -73706710,  122583155, -248531980, 2077344058,
-     334251781, -144921228,   84277148,  -53163520,   34159122,  -21716518,   13423413,   -7961467,
-       4476258,   -2354603,    1140036,    -496689,     187986,     -58025,      12660 },
-  {      -7457,      39966,    -139904,     388376,    -923634,    1960257,   -3808029,    6892048,
-     -11782909,   19262784,  -30495743,   47498606,  -74593290,  124033446, -251294915, 2075402541,
-     339379757, -146978105,   85449948,  -53899061,   34631661,  -22017812,   13610581,   -8073224,
-       4539621,   -2388278,    1156550,    -504002,     190815,     -58927,      12869 },
-  {      -7522,      40364,    -141378,     392611,    -933943,    1982521,   -3851872,    6972261,
-     -11921228,   19490382,  -30857574,   48062762,  -75475396,  125475786, -254038262, 2073435368,
-     344518965, -149034393,   86621703,  -54633813,   35103687,  -22318803,   13797587,   -8184904,
-       4602956,   -2421948,    1173068,    -511320,     193648,     -59832,      13079 },
-  {      -7586,      40758,    -142840,     396813,    -944182,    2004645,   -3895456,    7052027,
-     -12058809,   19716808,  -31217585,   48624102,  -76353004,  126910140, -256762002, 2071442585,
-     349669313, -151090015,   87792367,  -55367747,   35575182,  -22619479,   13984423,   -8296504,
-       4666260,   -2455611,    1189588,    -518643,     196485,     -60738,      13289 },
-  {      -7649,      41148,    -144290,     400984,    -954350,    2026628,   -3938780,    7131342,
-     -12195647,   19942055,  -31575767,   49182610,  -77226089,  128336472, -259466116, 2069424238,
-     354830709, -153144895,   88961893,  -56100833,   36046127,  -22919827,   14171082,   -8408019,
-       4729531,   -2489267,    1206110,    -525969,     199325,     -61647,      13501 },
-  {      -7711,      41534,    -145726,     405123,    -964448,    2048470,   -3981843,    7210205,
-     -12331738,   20166115,  -31932108,   49738269,  -78094624,  129754747, -262150588, 2067380374,
-     360003060, -155198957,   90130235,  -56833043,   36516503,  -23219835,   14357555,   -8519444,
-       4792765,   -2522912,    1222634,    -533300,     202168,     -62557,      13713 },
-  {      -7772,      41915,    -147151,     409231,    -974475,    2070170,   -4024645,    7288613,
-     -12467079,   20388984,  -32286597,   50291062,  -78958587,  131164932, -264815399, 2065311041,
-     365186274, -157252124,   91297347,  -57564347,   36986290,  -23519492,   14543835,   -8630775,
-       4855961,   -2556547,    1239157,    -540634,     205014,     -63469,      13926 },
-  {      -7832,      42293,    -148562,     413306,    -984431,    2091728,   -4067183,    7366564,
-     -12601666,   20610653,  -32639226,   50840975,  -79817953,  132566991, -267460534, 2063216286,
-     370380256, -159304318,   92463182,  -58294714,   37455469,  -23818784,   14729914,   -8742006,
-       4919115,   -2590170,    1255681,    -547971,     207864,     -64383,      14140 },
-  {      -7892,      42666,    -149961,     417349,    -994316,    2113143,   -4109457,    7444056,
-     -12735495,   20831118,  -32989982,   51387990,  -80672696,  133960892, -270085976, 2061096159,
-     375584914, -161355463,   93627694,  -59024117,   37924022,  -24117700,   14915785,   -8853134,
-       4982226,   -2623779,    1272204,    -555312,     210716,     -65298,      14354 },
-  {      -7950,      43036,    -151348,     421360,   -1004130,    2134415,   -4151465,    7521087,
-     -12868562,   21050371,  -33338855,   51932092,  -81522795,  135346599, -272691710, 2058950708,
-     380800152, -163405482,   94790836,  -59752524,   38391928,  -24416226,   15101440,   -8964154,
-       5045289,   -2657373,    1288726,    -562655,     213571,     -66215,      14569 },
-  {      -8007,      43401,    -152722,     425339,   -1013872,    2155544,   -4193208,    7597656,
-     -13000864,   21268406,  -33685837,   52473264,  -82368224,  136724081, -275277721, 2056779983,
-     386025876, -165454297,   95952563,  -60479906,   38859170,  -24714352,   15286872,   -9075061,
-       5108304,   -2690950,    1305245,    -570000,     216428,     -67134,      14785 },
-  {      -8064,      43762,    -154083,     429286,   -1023543,    2176528,   -4234683,    7673759,
-     -13132398,   21485217,  -34030916,   53011491,  -83208960,  138093305, -277843995, 2054584035,
-     391261992, -167501830,   97112827,  -61206234,   39325727,  -25012064,   15472072,   -9185851,
-       5171267,   -2724510,    1321761,    -577348,     219288,     -68055,      15002 },
-  {      -8120,      44120,    -155432,     433201,   -1033141,    2197368,   -4275890,    7749395,
-     -13263158,   21700798,  -34374082,   53546758,  -84044981,  139454238, -280390518, 2052362915,
-     396508404, -169548005,   98271581,  -61931478,   39791581,  -25309351,   15657033,   -9296518,
-       5234176,   -2758050,    1338274,    -584697,     222151,     -68977,      15219 },
-  {      -8174,      44473,    -156768,     437083,   -1042668,    2218063,   -4316827,    7824563,
-     -13393143,   21915143,  -34715326,   54079049,  -84876262,  140806849, -282917276, 2050116673,
-     401765016, -171592743,   99428780,  -62655609,   40256712,  -25606200,   15841748,   -9407059,
-       5297027,   -2791570,    1354783,    -592048,     225016,     -69901,      15437 },
-  {      -8228,      44822,    -158091,     440933,   -1052122,    2238612,   -4357495,    7899259,
-     -13522348,   22128246,  -35054638,   54608349,  -85702782,  142151105, -285424257, 2047845363,
-     407031733, -173635966,  100584377,  -63378597,   40721101,  -25902598,   16026208,   -9517469,
-       5359819,   -2825068,    1371287,    -599400,     227883,     -70826,      15656 },
-  {      -8281,      45167,    -159402,     444750,   -1061504,    2259016,   -4397891,    7973483,
-     -13650769,   22340100,  -35392008,   55134643,  -86524516,  143486975, -287911449, 2045549037,
-     412308457, -175677597,  101738325,  -64100412,   41184730,  -26198533,   16210406,   -9627743,
-       5422548,   -2858542,    1387785,    -606753,     230752,     -71753,      15876 },
-  {      -8333,      45509,    -160700,     448535,   -1070813,    2279273,   -4438015,    8047232,
-     -13778404,   22550700,  -35727426,   55657915,  -87341444,  144814429, -290378839, 2043227747,
-     417595092, -177717557,  102890577,  -64821025,   41647578,  -26493994,   16394334,   -9737876,
-       5485213,   -2891991,    1404277,    -614106,     233624,     -72681,      16096 },
-  {      -8384,      45846,    -161986,     452288,   -1080050,    2299384,   -4477866,    8120504,
-     -13905250,   22760040,  -36060884,   56178151,  -88153543,  146133435, -292826418, 2040881549,
-     422891541, -179755768,  104041086,  -65540406,   42109627,  -26788967,   16577985,   -9847864,
-       5547810,   -2925415,    1420762,    -621460,     236497,     -73610,      16317 },
-  {      -8434,      46179,    -163258,     456008,   -1089214,    2319347,   -4517443,    8193298,
-     -14031301,   22968114,  -36392370,   56695337,  -88960790,  147443965, -295254174, 2038510496,
-     428197707, -181792152,  105189807,  -66258525,   42570857,  -27083441,   16761351,   -9957702,
-       5610337,   -2958810,    1437239,    -628813,     239372,     -74542,      16539 },
-  {      -8483,      46508,    -164519,     459695,   -1098305,    2339163,   -4556745,    8265612,
-     -14156556,   23174917,  -36721877,   57209457,  -89763165,  148745987, -297662098, 2036114644,
-     433513491, -183826630,  106336692,  -66975353,   43031250,  -27377403,   16944423,  -10067386,
-       5672790,   -2992176,    1453708,    -636167,     242248,     -75474,      16761 },
-  {      -8531,      46833,    -165766,     463350,   -1107322,    2358831,   -4595771,    8337444,
-     -14281011,   23380442,  -37049395,   57720498,  -90560645,  150039472, -300050179, 2033694047,
-     438838795, -185859123,  107481694,  -67690859,   43490785,  -27670840,   17127195,  -10176911,
-       5735169,   -3025512,    1470168,    -643519,     245126,     -76408,      16984 },
-  {      -8579,      47154,    -167001,     466972,   -1116267,    2378351,   -4634520,    8408792,
-     -14404662,   23584684,  -37374915,   58228444,  -91353209,  151324392, -302418410, 2031248762,
-     444173521, -187889553,  108624767,  -68405016,   43949445,  -27963741,   17309658,  -10286272,
-       5797468,   -3058816,    1486618,    -650871,     248005,     -77343,      17207 },
-  {      -8626,      47471,    -168223,     470561,   -1125138,    2397722,   -4672992,    8479654,
-     -14527507,   23787638,  -37698427,   58733282,  -92140836,  152600718, -304766781, 2028778846,
-     449517569, -189917841,  109765864,  -69117792,   44407209,  -28256093,   17491806,  -10395464,
-       5859688,   -3092086,    1503057,    -658221,     250886,     -78279,      17432 },
-  {      -8671,      47784,    -169433,     474118,   -1133935,    2416944,   -4711185,    8550030,
-     -14649542,   23989297,  -38019923,   59234998,  -92923506,  153868420, -307095284, 2026284356,
-     454870841, -191943908,  110904938,  -69829158,   44864059,  -28547884,   17673629,  -10504484,
-       5921823,   -3125322,    1519485,    -665570,     253768,     -79216,      17656 },
-  {      -8716,      48093,    -170630,     477642,   -1142659,    2436016,   -4749100,    8619916,
-     -14770764,   24189657,  -38339393,   59733579,  -93701197,  155127472, -309403914, 2023765349,
-     460233237, -193967675,  112041943,  -70539085,   45319975,  -28839101,   17855121,  -10613326,
-       5983872,   -3158521,    1535902,    -672917,     256650,     -80155,      17882 },
-  {      -8760,      48398,    -171814,     481133,   -1151308,    2454939,   -4786734,    8689311,
-     -14891170,   24388713,  -38656830,   60229009,  -94473890,  156377846, -311692662, 2021221885,
-     465604657, -195989062,  113176830,  -71247542,   45774938,  -29129732,   18036274,  -10721985,
-       6045833,   -3191683,    1552305,    -680261,     259534,     -81095,      18108 },
-  {      -8803,      48700,    -172985,     484592,   -1159884,    2473711,   -4824087,    8758214,
-     -15010756,   24586458,  -38972224,   60721276,  -95241563,  157619514, -313961522, 2018654021,
-     470985001, -198007990,  114309555,  -71954501,   46228929,  -29419765,   18217079,  -10830458,
-       6107702,   -3224805,    1568696,    -687603,     262418,     -82036,      18335 },
-  {      -8845,      48997,    -174144,     488017,   -1168386,    2492333,   -4861158,    8826623,
-     -15129521,   24782887,  -39285566,   61210367,  -96004198,  158852449, -316210490, 2016061817,
-     476374167, -200024381,  115440069,  -72659931,   46681929,  -29709187,   18397530,  -10938738,
-       6169476,   -3257887,    1585072,    -694942,     265303,     -82978,      18562 },
-  {      -8887,      49290,    -175291,     491410,   -1176814,    2510805,   -4897947,    8894537,
-     -15247460,   24977996,  -39596849,   61696267,  -96761773,  160076625, -318439559, 2013445334,
-     481772056, -202038153,  116568326,  -73363803,   47133919,  -29997986,   18577618,  -11046822,
-       6231154,   -3290927,    1601434,    -702278,     268189,     -83921,      18790 },
-  {      -8927,      49579,    -176424,     494770,   -1185167,    2529124,   -4934452,    8961953,
-     -15364571,   25171779,  -39906064,   62178965,  -97514271,  161292016, -320648725, 2010804631,
-     487178565, -204049229,  117694280,  -74066087,   47584879,  -30286150,   18757336,  -11154706,
-       6292732,   -3323924,    1617780,    -709610,     271075,     -84865,      19019 },
-  {      -8967,      49865,    -177545,     498097,   -1193446,    2547293,   -4970674,    9028871,
-     -15480851,   25364232,  -40213202,   62658446,  -98261671,  162498596, -322837984, 2008139771,
-     492593593, -206057527,  118817882,  -74766755,   48034790,  -30573666,   18936676,  -11262383,
-       6354207,   -3356876,    1634110,    -716939,     273961,     -85809,      19248 },
-  {      -9005,      50146,    -178654,     501391,   -1201650,    2565309,   -5006610,    9095288,
-     -15596297,   25555348,  -40518255,   63134699,  -99003954,  163696339, -325007333, 2005450814,
-     498017039, -208062969,  119939087,  -75465775,   48483633,  -30860522,   19115630,  -11369850,
-       6415578,   -3389781,    1650423,    -724263,     276848,     -86755,      19477 },
-  {      -9043,      50423,    -179749,     504652,   -1209780,    2583174,   -5042261,    9161203,
-     -15710906,   25745124,  -40821216,   63607710,  -99741102,  164885221, -327156768, 2002737822,
-     503448799, -210065474,  121057848,  -76163119,   48931389,  -31146706,   19294191,  -11477102,
-       6476841,   -3422639,    1666718,    -731583,     279734,     -87702,      19708 },
-  {      -9080,      50697,    -180833,     507880,   -1217834,    2600886,   -5077626,    9226615,
-     -15824676,   25933554,  -41122075,   64077467, -100473096,  166065217, -329286288, 2000000860,
-     508888771, -212064963,  122174117,  -76858756,   49378039,  -31432206,   19472350,  -11584134,
-       6537994,   -3455447,    1682995,    -738898,     282620,     -88649,      19938 },
-  {      -9117,      50966,    -181903,     511075,   -1225814,    2618445,   -5112704,    9291522,
-     -15937603,   26120633,  -41420826,   64543957, -101199917,  167236302, -331395889, 1997239989,
-     514336853, -214061355,  123287848,  -77552658,   49823564,  -31717008,   19650100,  -11690942,
-       6599034,   -3488205,    1699253,    -746208,     285506,     -89597,      20170 },
-  {      -9152,      51232,    -182961,     514237,   -1233719,    2635851,   -5147494,    9355923,
-     -16049685,   26306357,  -41717460,   65007169, -101921548,  168398453, -333485572, 1994455274,
-     519792940, -216054571,  124398993,  -78244795,   50267944,  -32001102,   19827434,  -11797520,
-       6659958,   -3520910,    1715492,    -753512,     288392,     -90546,      20402 },
-  {      -9187,      51494,    -184006,     517365,   -1241549,    2653104,   -5181995,    9419817,
-     -16160919,   26490721,  -42011969,   65467090, -102637970,  169551645, -335555334, 1991646778,
-     525256930, -218044529,  125507508,  -78935138,   50711161,  -32284474,   20004343,  -11903865,
-       6720763,   -3553562,    1731709,    -760811,     291277,     -91496,      20634 },
-  {      -9220,      51752,    -185039,     520461,   -1249304,    2670203,   -5216208,    9483201,
-     -16271302,   26673720,  -42304347,   65923708, -103349165,  170695856, -337605176, 1988814568,
-     530728719, -220031150,  126613343,  -79623656,   51153195,  -32567112,   20180821,  -12009971,
-       6781448,   -3586159,    1747906,    -768103,     294162,     -92446,      20867 },
-  {      -9253,      52006,    -186059,     523524,   -1256984,    2687149,   -5250131,    9546074,
-     -16380833,   26855350,  -42594584,   66377011, -104055117,  171831064, -339635098, 1985958708,
-     536208202, -222014353,  127716453,  -80310320,   51594027,  -32849004,   20356858,  -12115834,
-       6842008,   -3618699,    1764080,    -775390,     297046,     -93397,      21100 },
-  {      -9285,      52256,    -187066,     526554,   -1264588,    2703940,   -5283763,    9608436,
-     -16489507,   27035606,  -42882675,   66826988, -104755808,  172957244, -341645100, 1983079265,
-     541695274, -223994059,  128816790,  -80995101,   52033639,  -33130137,   20532447,  -12221449,
-       6902442,   -3651182,    1780232,    -782669,     299929,     -94348,      21334 },
-  {      -9317,      52502,    -188061,     529551,   -1272117,    2720577,   -5317104,    9670285,
-     -16597324,   27214483,  -43168611,   67273627, -105451221,  174074376, -343635185, 1980176304,
-     547189832, -225970185,  129914309,  -81677970,   52472011,  -33410500,   20707581,  -12326812,
-       6962747,   -3683605,    1796360,    -789941,     302811,     -95300,      21569 },
-  {      -9347,      52745,    -189044,     532514,   -1279571,    2737059,   -5350154,    9731619,
-     -16704279,   27391979,  -43452386,   67716917, -106141339,  175182437, -345605353, 1977249893,
-     552691770, -227942653,  131008962,  -82358897,   52909124,  -33690081,   20882253,  -12431917,
-       7022920,   -3715967,    1812464,    -797206,     305692,     -96253,      21803 },
-  {      -9377,      52983,    -190013,     535445,   -1286949,    2753386,   -5382912,    9792437,
-     -16810372,   27568087,  -43733991,   68156847, -106826145,  176281407, -347555607, 1974300099,
-     558200982, -229911380,  132100702,  -83037852,   53344959,  -33968866,   21056453,  -12536761,
-       7082958,   -3748267,    1828544,    -804463,     308571,     -97206,      22039 },
-  {      -9406,      53218,    -190971,     538342,   -1294252,    2769559,   -5415377,    9852738,
-     -16915599,   27742803,  -44013421,   68593405, -107505624,  177371263, -349485950, 1971326992,
-     563717363, -231876287,  133189482,  -83714806,   53779498,  -34246843,   21230175,  -12641337,
-       7142859,   -3780502,    1844597,    -811712,     311450,     -98159,      22275 },
-  {      -9434,      53449,    -191915,     541207,   -1301478,    2785576,   -5447548,    9912521,
-     -17019957,   27916125,  -44290668,   69026581, -108179758,  178451987, -351396386, 1968330638,
-     569240807, -233837292,  134275257,  -84389731,   54212720,  -34524001,   21403410,  -12745643,
-       7202620,   -3812673,    1860625,    -818953,     314326,     -99113,      22511 },
-  {      -9461,      53676,    -192848,     544038,   -1308629,    2801437,   -5479426,    9971785,
-     -17123446,   28088046,  -44565724,   69456363, -108848533,  179523556, -353286917, 1965311107,
-     574771207, -235794316,  135357979,  -85062595,   54644608,  -34800327,   21576152,  -12849673,
-       7262238,   -3844777,    1876625,    -826185,     317201,    -100067,      22748 },
-  {      -9488,      53899,    -193767,     546836,   -1315705,    2817142,   -5511008,   10030528,
-     -17226061,   28258564,  -44838584,   69882742, -109511933,  180585952, -355157550, 1962268470,
-     580308458, -237747275,  136437602,  -85733371,   55075142,  -35075809,   21748392,  -12953421,
-       7321711,   -3876813,    1892597,    -833407,     320075,    -101021,      22985 },
-  {      -9513,      54119,    -194675,     549601,   -1322704,    2832692,   -5542296,   10088748,
-     -17327802,   28427674,  -45109241,   70305706, -110169941,  181639155, -357008289, 1959202795,
-     585852451, -239696091,  137514078,  -86402029,   55504304,  -35350435,   21920123,  -13056885,
-       7381035,   -3908779,    1908541,    -840621,     322946,    -101975,      23222 },
-  {      -9538,      54335,    -195569,     552333,   -1329628,    2848085,   -5573289,   10146446,
-     -17428665,   28595372,  -45377688,   70725246, -110822543,  182683145, -358839138, 1956114154,
-     591403080, -241640682,  138587362,  -87068540,   55932073,  -35624192,   22091336,  -13160059,
-       7440209,   -3940674,    1924456,    -847824,     325815,    -102930,      23460 },
-  {      -9562,      54546,    -196452,     555032,   -1336475,    2863322,   -5603985,   10203620,
-     -17528649,   28761655,  -45643919,   71141351, -111469724,  183717904, -360650105, 1953002619,
-     596960238, -243580966,  139657407,  -87732874,   56358433,  -35897069,   22262025,  -13262938,
-       7499229,   -3972496,    1940340,    -855018,     328682,    -103885,      23699 },
-  {      -9586,      54755,    -197321,     557698,   -1343247,    2878403,   -5634384,   10260268,
-     -17627752,   28926518,  -45907926,   71554011, -112111470,  184743414, -362441196, 1949868260,
-     602523817, -245516863,  140724166,  -88395002,   56783363,  -36169052,   22432182,  -13365517,
-       7558093,   -4004244,    1956194,    -862201,     331547,    -104840,      23937 },
-  {      -9608,      54959,    -198179,     560330,   -1349943,    2893326,   -5664487,   10316390,
-     -17725971,   29089958,  -46169705,   71963216, -112747765,  185759656, -364212419, 1946711150,
-     608093708, -247448291,  141787593,  -89054896,   57206844,  -36440131,   22601798,  -13467793,
-       7616798,   -4035917,    1972016,    -869373,     334409,    -105795,      24177 },
-  {      -9630,      55160,    -199024,     562930,   -1356563,    2908093,   -5694292,   10371985,
-     -17823304,   29251971,  -46429248,   72368957, -113378595,  186766613, -365963779, 1943531362,
-     613669804, -249375170,  142847641,  -89712525,   57628859,  -36710293,   22770867,  -13569760,
-       7675341,   -4067512,    1987806,    -876534,     337269,    -106750,      24416 },
-  {      -9651,      55356,    -199856,     565496,   -1363106,    2922702,   -5723799,   10427051,
-     -17919750,   29412553,  -46686550,   72771223, -114003947,  187764267, -367695287, 1940328969,
-     619251996, -251297417,  143904264,  -90367862,   58049388,  -36979525,   22939381,  -13671413,
-       7733720,   -4099030,    2003563,    -883684,     340126,    -107705,      24656 },
-  {      -9672,      55550,    -200676,     568030,   -1369574,    2937155,   -5753007,   10481588,
-     -18015305,   29571701,  -46941605,   73170006, -114623806,  188752602, -369406949, 1937104044,
-     624840175, -253214952,  144957415,  -91020876,   58468413,  -37247816,   23107331,  -13772749,
-       7791932,   -4130467,    2019286,    -890822,     342980,    -108660,      24896 },
-  {      -9691,      55739,    -201484,     570530,   -1375965,    2951450,   -5781917,   10535595,
-     -18109970,   29729411,  -47194406,   73565296, -115238159,  189731601, -371098777, 1933856663,
-     630434233, -255127694,  146007049,  -91671540,   58885914,  -37515153,   23274711,  -13873762,
-       7849974,   -4161822,    2034974,    -897947,     345831,    -109614,      25137 },
-  {      -9710,      55925,    -202280,     572998,   -1382280,    2965587,   -5810527,   10589070,
-     -18203740,   29885680,  -47444948,   73957084, -115846993,  190701247, -372770778, 1930586899,
-     636034059, -257035560,  147053118,  -92319823,   59301873,  -37781525,   23441512,  -13974447,
-       7907843,   -4193095,    2050628,    -905061,     348679,    -110569,      25378 },
-  {      -9728,      56107,    -203063,     575432,   -1388519,    2979567,   -5838838,   10642012,
-     -18296615,   30040504,  -47693225,   74345361, -116450294,  191661525, -374422964, 1927294828,
-     641639544, -258938471,  148095577,  -92965698,   59716272,  -38046919,   23607727,  -14074801,
-       7965537,   -4224283,    2066245,    -912161,     351524,    -111523,      25619 },
-  {      -9745,      56285,    -203834,     577834,   -1394682,    2993389,   -5866848,   10694422,
-     -18388592,   30193881,  -47939232,   74730119, -117048050,  192612420, -376055346, 1923980526,
-     647250579, -260836343,  149134379,  -93609134,   60129091,  -38311324,   23773349,  -14174818,
-       8023054,   -4255386,    2081826,    -919249,     354365,    -112477,      25860 },
-  {      -9762,      56460,    -204592,     580202,   -1400768,    3007053,   -5894558,   10746297,
-     -18479671,   30345806,  -48182962,   75111347, -117640248,  193553915, -377667934, 1920644069,
-     652867053, -262729096,  150169478,  -94250104,   60540312,  -38574727,   23938370,  -14274493,
-       8080390,   -4286401,    2097369,    -926323,     357203,    -113431,      26102 },
-  {      -9778,      56631,    -205338,     582538,   -1406778,    3020559,   -5921967,   10797637,
-     -18569849,   30496277,  -48424412,   75489039, -118226875,  194485998, -379260740, 1917285534,
-     658488855, -264616649,  151200828,  -94888579,   60949917,  -38837116,   24102782,  -14373823,
-       8137542,   -4317327,    2112874,    -933383,     360037,    -114384,      26344 },
-  {      -9793,      56798,    -206072,     584840,   -1412712,    3033907,   -5949075,   10848442,
-     -18659124,   30645290,  -48663574,   75863185, -118807919,  195408652, -380833776, 1913904997,
-     664115876, -266498919,  152228383,  -95524530,   61357887,  -39098479,   24266577,  -14472802,
-       8194509,   -4348163,    2128340,    -940429,     362868,    -115337,      26586 },
-  {      -9807,      56962,    -206794,     587110,   -1418570,    3047096,   -5975882,   10898709,
-     -18747494,   30792842,  -48900445,   76233778, -119383368,  196321865, -382387056, 1910502538,
-     669748005, -268375826,  153252097,  -96157927,   61764202,  -39358805,   24429748,  -14571426,
-       8251287,   -4378907,    2143766,    -947460,     365694,    -116290,      26829 },
-  {      -9821,      57122,    -207504,     589347,   -1424352,    3060128,   -6002386,   10948440,
-     -18834959,   30938931,  -49135018,   76600809, -119953212,  197225622, -383920593, 1907078233,
-     675385130, -270247287,  154271923,  -96788743,   62168846,  -39618081,   24592288,  -14669690,
-       8307873,   -4409557,    2159152,    -954476,     368516,    -117242,      27072 },
-  {      -9834,      57278,    -208201,     591551,   -1430057,    3073000,   -6028588,   10997632,
-     -18921516,   31083553,  -49367290,   76964270, -120517437,  198119910, -385434400, 1903632161,
-     681027140, -272113222,  155287817,  -97416949,   62571799,  -39876295,   24754189,  -14767590,
-       8364265,   -4440114,    2174496,    -961478,     371334,    -118194,      27315 },
-  {      -9846,      57431,    -208886,     593722,   -1435686,    3085714,   -6054488,   11046285,
-     -19007164,   31226705,  -49597254,   77324153, -121076032,  199004717, -386928491, 1900164403,
-     686673924, -273973548,  156299732,  -98042517,   62973043,  -40133436,   24915443,  -14865121,
-       8420461,   -4470573,    2189799,    -968463,     374148,    -119145,      27558 },
-  {      -9858,      57581,    -209559,     595860,   -1441239,    3098270,   -6080085,   11094398,
-     -19091902,   31368385,  -49824906,   77680451, -121628988,  199880029, -388402882, 1896675037,
-     692325369, -275828184,  157307622,  -98665417,   63372559,  -40389491,   25076043,  -14962278,
-       8476457,   -4500935,    2205059,    -975433,     376957,    -120095,      27802 },
-  {      -9869,      57726,    -210220,     597966,   -1446715,    3110667,   -6105379,   11141971,
-     -19175727,   31508590,  -50050242,   78033157, -122176292,  200745836, -389857588, 1893164143,
-     697981364, -277677049,  158311442,  -99285621,   63770330,  -40644449,   25235981,  -15059057,
-       8532251,   -4531198,    2220275,    -982387,     379761,    -121045,      28046 },
-  {      -9879,      57868,    -210869,     600039,   -1452116,    3122905,   -6130369,   11189003,
-     -19258639,   31647317,  -50273256,   78382262, -122717935,  201602123, -391292625, 1889631802,
-     703641796, -279520061,  159311145,  -99903102,   64166336,  -40898298,   25395250,  -15155452,
-       8587840,   -4561361,    2235447,    -989324,     382561,    -121993,      28289 },
-  {      -9889,      58007,    -211505,     602079,   -1457440,    3134984,   -6155056,   11235492,
-     -19340636,   31784563,  -50493945,   78727760, -123253905,  202448882, -392708009, 1886078096,
-     709306553, -281357138,  160306688, -100517830,   64560560,  -41151026,   25553842,  -15251461,
-       8643221,   -4591421,    2250574,    -996244,     385355,    -122942,      28534 },
-  {      -9898,      58142,    -212130,     604086,   -1462688,    3146905,   -6179439,   11281440,
-     -19421716,   31920326,  -50712303,   79069644, -123784194,  203286099, -394103757, 1882503105,
-     714975522, -283188199,  161298022, -101129777,   64952983,  -41402621,   25711750,  -15347077,
-       8698393,   -4621377,    2265655,   -1003147,     388145,    -123889,      28778 },
-  {      -9906,      58273,    -212743,     606061,   -1467859,    3158666,   -6203518,   11326844,
-     -19501879,   32054604,  -50928327,   79407907, -124308790,  204113765, -395479886, 1878906912,
-     720648590, -285013163,  162285105, -101738916,   65343587,  -41653071,   25868967,  -15442296,
-       8753351,   -4651229,    2280690,   -1010032,     390929,    -124835,      29022 },
-  {      -9913,      58401,    -213343,     608003,   -1472955,    3170269,   -6227292,   11371705,
-     -19581122,   32187393,  -51142012,   79742542, -124827684,  204931870, -396836415, 1875289599,
-     726325645, -286831947,  163267889, -102345218,   65732354,  -41902365,   26025483,  -15537115,
-       8808094,   -4680974,    2295678,   -1016899,     393708,    -125781,      29267 },
-  {      -9920,      58526,    -213932,     609912,   -1477975,    3181713,   -6250763,   11416022,
-     -19659446,   32318692,  -51353354,   80073543, -125340868,  205740402, -398173360, 1871651249,
-     732006572, -288644470,  164246330, -102948654,   66119265,  -42150491,   26181294,  -15631527,
-       8862619,   -4710611,    2310618,   -1023748,     396482,    -126725,      29511 },
-  {      -9926,      58647,    -214509,     611789,   -1482918,    3192998,   -6273928,   11459794,
-     -19736848,   32448498,  -51562349,   80400902, -125848331,  206539354, -399490743, 1867991946,
-     737691259, -290450651,  165220382, -103549197,   66504303,  -42397437,   26336390,  -15725529,
-       8916922,   -4740138,    2325509,   -1030578,     399249,    -127669,      29756 },
-  {      -9932,      58764,    -215073,     613634,   -1487786,    3204123,   -6296789,   11503020,
-     -19813328,   32576809,  -51768993,   80724614, -126350064,  207328714, -400788581, 1864311772,
-     743379590, -292250408,  166190000, -104146819,   66887450,  -42643191,   26490765,  -15819117,
-       8971002,   -4769554,    2340350,   -1037389,     402011,    -128611,      30001 },
-  {      -9937,      58878,    -215626,     615446,   -1492577,    3215090,   -6319344,   11545701,
-     -19888883,   32703622,  -51973282,   81044673, -126846060,  208108475, -402066894, 1860610814,
-     749071454, -294043660,  167155140, -104741492,   67268687,  -42887743,   26644410,  -15912284,
-       9024856,   -4798858,    2355141,   -1044181,     404767,    -129553,      30246 },
-  {      -9941,      58989,    -216167,     617225,   -1497293,    3225898,   -6341595,   11587836,
-     -19963514,   32828936,  -52175212,   81361072, -127336309,  208878628, -403325704, 1856889155,
-     754766734, -295830325,  168115755, -105333188,   67647996,  -43131079,   26797320,  -16005028,
-       9078481,   -4828048,    2369882,   -1050953,     407517,    -130493,      30491 },
-  {      -9944,      59096,    -216696,     618973,   -1501932,    3236546,   -6363540,   11629424,
-     -20037219,   32952749,  -52374780,   81673807, -127820803,  209639165, -404565031, 1853146881,
-     760465317, -297610321,  169071802, -105921879,   68025361,  -43373189,   26949485,  -16097343,
-       9131874,   -4857123,    2384570,   -1057704,     410261,    -131432,      30736 },
-  {      -9947,      59200,    -217214,     620687,   -1506496,    3247036,   -6385180,   11670464,
-     -20109997,   33075058,  -52571982,   81982870, -128299534,  210390078, -405784895, 1849384077,
-     766167088, -299383568,  170023235, -106507538,   68400761,  -43614061,   27100900,  -16189225,
-       9185033,   -4886081,    2399206,   -1064436,     412999,    -132370,      30981 },
-  {      -9950,      59300,    -217719,     622370,   -1510984,    3257367,   -6406514,   11710958,
-     -20181847,   33195861,  -52766815,   82288257, -128772495,  211131359, -406985320, 1845600829,
-     771871933, -301149983,  170970009, -107090137,   68774181,  -43853683,   27251556,  -16280669,
-       9237955,   -4914920,    2413789,   -1071147,     415729,    -133306,      31227 },
-  {      -9951,      59397,    -218213,     624020,   -1515396,    3267538,   -6427543,   11750903,
-     -20252768,   33315157,  -52959275,   82589962, -129239677,  211863002, -408166327, 1841797224,
-     777579736, -302909486,  171912081, -107669647,   69145602,  -44092044,   27401446,  -16371671,
-       9290638,   -4943640,    2428317,   -1077836,     418454,    -134241,      31472 },
-  {      -9952,      59491,    -218695,     625639,   -1519733,    3277551,   -6448266,   11790300,
-     -20322760,   33432943,  -53149359,   82887980, -129701074,  212584999, -409327939, 1837973349,
-     783290382, -304661994,  172849404, -108246043,   69515006,  -44329133,   27550563,  -16462226,
-       9343078,   -4972238,    2442791,   -1084504,     421171,    -135175,      31717 },
-  {      -9953,      59581,    -219165,     627225,   -1523994,    3287405,   -6468683,   11829148,
-     -20391820,   33549219,  -53337064,   83182306, -130156678,  213297345, -410470179, 1834129292,
-     789003756, -306407428,  173781936, -108819295,   69882376,  -44564937,   27698900,  -16552330,
-       9395274,   -5000714,    2457209,   -1091150,     423882,    -136107,      31963 },
-  {      -9952,      59668,    -219624,     628779,   -1528179,    3297100,   -6488795,   11867447,
-     -20459950,   33663981,  -53522387,   83472934, -130606482,  214000033, -411593072, 1830265140,
-     794719743, -308145704,  174709631, -109389378,   70247693,  -44799446,   27846449,  -16641979,
-       9447222,   -5029065,    2471572,   -1097774,     426585,    -137037,      32208 },
-  {      -9952,      59751,    -220071,     630301,   -1532289,    3306636,   -6508600,   11905198,
-     -20527147,   33777229,  -53705325,   83759861, -131050480,  214693057, -412696641, 1826380981,
-     800438226, -309876743,  175632445, -109956263,   70610941,  -45032648,   27993203,  -16731167,
-       9498920,   -5057291,    2485877,   -1104376,     429281,    -137966,      32453 },
-  {      -9950,      59831,    -220506,     631790,   -1536324,    3316014,   -6528100,   11942398,
-     -20593411,   33888962,  -53885875,   84043081, -131488665,  215376414, -413780912, 1822476905,
-     806159090, -311600463,  176550333, -110519924,   70972102,  -45264532,   28139154,  -16819891,
-       9550365,   -5085390,    2500124,   -1110954,     431970,    -138894,      32698 },
-  {      -9948,      59908,    -220930,     633248,   -1540283,    3325233,   -6547293,   11979049,
-     -20658741,   33999176,  -54064033,   84322590, -131921032,  216050096, -414845909, 1818553000,
-     811882219, -313316783,  177463253, -111080332,   71331158,  -45495085,   28284297,  -16908146,
-       9601554,   -5113360,    2514313,   -1117509,     434651,    -139820,      32943 },
-  {      -9945,      59982,    -221343,     634675,   -1544166,    3334293,   -6566181,   12015150,
-     -20723137,   34107872,  -54239799,   84598384, -132347573,  216714101, -415891658, 1814609356,
-     817607496, -315025621,  178371159, -111637462,   71688092,  -45724298,   28428622,  -16995927,
-       9652486,   -5141200,    2528442,   -1124041,     437324,    -140744,      33189 },
-  {      -9942,      60052,    -221743,     636069,   -1547975,    3343194,   -6584762,   12050700,
-     -20786598,   34215047,  -54413168,   84870458, -132768284,  217368423, -416918185, 1810646063,
-     823334805, -316726897,  179274007, -112191286,   72042886,  -45952158,   28572124,  -17083230,
-       9703157,   -5168909,    2542511,   -1130549,     439990,    -141666,      33434 },
-  {      -9938,      60119,    -222133,     637431,   -1551708,    3351937,   -6603038,   12085701,
-     -20849123,   34320701,  -54584139,   85138809, -133183158,  218013059, -417925518, 1806663212,
-     829064029, -318420530,  180171755, -112741776,   72395523,  -46178655,   28714794,  -17170051,
-       9753565,   -5196484,    2556520,   -1137032,     442648,    -142587,      33679 },
-  {      -9934,      60183,    -222510,     638762,   -1555367,    3360522,   -6621008,   12120150,
-     -20910712,   34424831,  -54752708,   85403432, -133592191,  218648005, -418913683, 1802660893,
-     834795053, -320106438,  181064358, -113288908,   72745986,  -46403777,   28856627,  -17256385,
-       9803707,   -5223925,    2570467,   -1143491,     445297,    -143505,      33923 },
-  {      -9929,      60243,    -222877,     640061,   -1558950,    3368948,   -6638672,   12154049,
-     -20971364,   34527438,  -54918874,   85664324, -133995378,  219273259, -419882709, 1798639198,
-     840527758, -321784541,  181951773, -113832652,   73094258,  -46627513,   28997614,  -17342227,
-       9853580,   -5251231,    2584352,   -1149925,     447939,    -144422,      34168 },
-  {      -9923,      60300,    -223232,     641329,   -1562459,    3377217,   -6656030,   12187397,
-     -21031080,   34628518,  -55082635,   85921481, -134392713,  219888817, -420832622, 1794598218,
-     846262028, -323454758,  182833955, -114372984,   73440320,  -46849852,   29137748,  -17427574,
-       9903182,   -5278399,    2598174,   -1156333,     450571,    -145337,      34413 },
-  {      -9917,      60354,    -223576,     642565,   -1565893,    3385327,   -6673082,   12220195,
-     -21089857,   34728073,  -55243989,   86174899, -134784193,  220494677, -421763451, 1790538046,
-     851997746, -325117008,  183710863, -114909876,   73784157,  -47070783,   29277023,  -17512421,
-       9952511,   -5305428,    2611932,   -1162715,     453196,    -146249,      34657 },
-  {      -9911,      60405,    -223908,     643770,   -1569252,    3393279,   -6689829,   12252441,
-     -21147696,   34826100,  -55402932,   86424576, -135169812,  221090836, -422675227, 1786458774,
-     857734794, -326771210,  184582451, -115443301,   74125752,  -47290294,   29415431,  -17596764,
-      10001563,   -5332318,    2625625,   -1169072,     455811,    -147160,      34901 },
-  {      -9903,      60453,    -224229,     644943,   -1572536,    3401073,   -6706270,   12284136,
-     -21204597,   34922598,  -55559464,   86670509, -135549567,  221677294, -423567978, 1782360494,
-     863473054, -328417284,  185448679, -115973234,   74465086,  -47508375,   29552965,  -17680598,
-      10050337,   -5359065,    2639253,   -1175402,     458418,    -148068,      35146 },
-  {      -9896,      60498,    -224539,     646085,   -1575746,    3408710,   -6722405,   12315280,
-     -21260560,   35017568,  -55713583,   86912693, -135923453,  222254049, -424441734, 1778243301,
-     869212410, -330055149,  186309501, -116499648,   74802143,  -47725014,   29689619,  -17763918,
-      10098829,   -5385669,    2652815,   -1181705,     461016,    -148975,      35390 },
-  {      -9887,      60539,    -224838,     647195,   -1578882,    3416189,   -6738235,   12345874,
-     -21315583,   35111006,  -55865287,   87151127, -136291467,  222821099, -425296525, 1774107287,
-     874952744, -331684725,  187164875, -117022516,   75136907,  -47940201,   29825384,  -17846721,
-      10147037,   -5412129,    2666311,   -1187981,     463604,    -149879,      35633 },
-  {      -9878,      60577,    -225125,     648275,   -1581943,    3423510,   -6753760,   12375916,
-     -21369666,   35202914,  -56014574,   87385808, -136653606,  223378444, -426132383, 1769952548,
-     880693936, -333305932,  188014759, -117541813,   75469360,  -48153925,   29960255,  -17929002,
-      10194959,   -5438443,    2679739,   -1194230,     466184,    -150781,      35877 },
-  {      -9869,      60612,    -225402,     649323,   -1584931,    3430674,   -6768980,   12405407,
-     -21422811,   35293291,  -56161443,   87616733, -137009866,  223926085, -426949340, 1765779177,
-     886435871, -334918688,  188859110, -118057513,   75799485,  -48366174,   30094224,  -18010757,
-      10242591,   -5464610,    2693098,   -1200451,     468753,    -151680,      36120 },
-  {      -9859,      60644,    -225667,     650341,   -1587844,    3437681,   -6783894,   12434347,
-     -21475015,   35382135,  -56305893,   87843900, -137360245,  224464019, -427747426, 1761587270,
-     892178428, -336522913,  189697885, -118569589,   76127267,  -48576939,   30227285,  -18091982,
-      10289932,   -5490628,    2706389,   -1206643,     471314,    -152577,      36363 },
-  {      -9849,      60673,    -225921,     651327,   -1590683,    3444531,   -6798504,   12462736,
-     -21526280,   35469445,  -56447921,   88067306, -137704739,  224992249, -428526674, 1757376921,
-     897921490, -338118528,  190531042, -119078015,   76452687,  -48786207,   30359429,  -18172671,
-      10336978,   -5516495,    2719609,   -1212807,     473864,    -153472,      36606 },
-  {      -9837,      60699,    -226164,     652282,   -1593448,    3451224,   -6812809,   12490575,
-     -21576605,   35555223,  -56587528,   88286949, -138043345,  225510775, -429287118, 1753148227,
-     903664939, -339705453,  191358538, -119582767,   76775731,  -48993969,   30490651,  -18252822,
-      10383728,   -5542211,    2732759,   -1218942,     476405,    -154364,      36848 },
-  {      -9826,      60722,    -226397,     653207,   -1596140,    3457761,   -6826810,   12517863,
-     -21625989,   35639466,  -56724711,   88502828, -138376063,  226019598, -430028789, 1748901284,
-     909408656, -341283606,  192180331, -120083817,   77096380,  -49200213,   30620944,  -18332429,
-      10430178,   -5567774,    2745838,   -1225048,     478935,    -155253,      37091 },
-  {      -9814,      60742,    -226618,     654101,   -1598758,    3464141,   -6840507,   12544600,
-     -21674434,   35722175,  -56859470,   88714941, -138702889,  226518719, -430751723, 1744636188,
-     915152522, -342852909,  192996379, -120581141,   77414619,  -49404929,   30750300,  -18411488,
-      10476326,   -5593182,    2758845,   -1231124,     481455,    -156140,      37333 },
-  {      -9801,      60759,    -226828,     654964,   -1601303,    3470364,   -6853899,   12570787,
-     -21721938,   35803349,  -56991803,   88923286, -139023822,  227008140, -431455953, 1740353035,
-     920896419, -344413282,  193806641, -121074713,   77730431,  -49608106,   30878713,  -18489996,
-      10522170,   -5618434,    2771780,   -1237171,     483965,    -157025,      37574 },
-  {      -9788,      60772,    -227028,     655796,   -1603774,    3476431,   -6866987,   12596424,
-     -21768503,   35882989,  -57121711,   89127861, -139338859,  227487864, -432141513, 1736051923,
-     926640227, -345964644,  194611074, -121564507,   78043800,  -49809734,   31006175,  -18567948,
-      10567707,   -5643529,    2784640,   -1243187,     486465,    -157906,      37816 },
-  {      -9775,      60783,    -227216,     656598,   -1606173,    3482343,   -6879772,   12621511,
-     -21814127,   35961093,  -57249191,   89328665, -139648000,  227957892, -432808439, 1731732951,
-     932383828, -347506917,  195409636, -122050498,   78354710,  -50009801,   31132682,  -18645339,
-      10612935,   -5668465,    2797427,   -1249172,     488954,    -158785,      38057 },
-  {      -9761,      60791,    -227394,     657370,   -1608498,    3488098,   -6892254,   12646049,
-     -21858812,   36037661,  -57374244,   89525696, -139951244,  228418228, -433456766, 1727396214,
-     938127103, -349040020,  196202287, -122532662,   78663144,  -50208298,   31258224,  -18722165,
-      10657850,   -5693241,    2810138,   -1255126,     491432,    -159661,      38297 },
-  {      -9746,      60796,    -227561,     658111,   -1610750,    3493698,   -6904432,   12670037,
-     -21902557,   36112694,  -57496869,   89718955, -140248589,  228868874, -434086531, 1723041813,
-     943869931, -350563875,  196988985, -123010972,   78969086,  -50405214,   31382796,  -18798423,
-      10702451,   -5717855,    2822774,   -1261049,     493899,    -160534,      38537 },
-  {      -9731,      60798,    -227718,     658822,   -1612930,    3499143,   -6916308,   12693475,
-     -21945362,   36186191,  -57617066,   89908439, -140540035,  229309834, -434697769, 1718669846,
-     949612195, -352078401,  197769688, -123485405,   79272521,  -50600538,   31506392,  -18874108,
-      10746735,   -5742307,    2835334,   -1266940,     496355,    -161404,      38777 },
-  {      -9715,      60797,    -227864,     659502,   -1615036,    3504432,   -6927881,   12716365,
-     -21987228,   36258153,  -57734833,   90094149, -140825581,  229741112, -435290518, 1714280411,
-     955353774, -353583520,  198544355, -123955934,   79573432,  -50794261,   31629003,  -18949216,
-      10790700,   -5766593,    2847816,   -1272799,     498799,    -162271,      39017 },
-  {      -9699,      60793,    -227999,     660153,   -1617071,    3509567,   -6939151,   12738707,
-     -22028155,   36328579,  -57850172,   90276083, -141105226,  230162713, -435864814, 1709873608,
-     961094550, -355079152,  199312946, -124422536,   79871803,  -50986371,   31750624,  -19023742,
-      10834343,   -5790714,    2860220,   -1278625,     501233,    -163136,      39256 },
-  {      -9683,      60786,    -228123,     660773,   -1619033,    3514547,   -6950120,   12760500,
-     -22068144,   36397470,  -57963081,   90454241, -141378971,  230574640, -436420696, 1705449538,
-     966834401, -356565219,  200075420, -124885185,   80167618,  -51176858,   31871248,  -19097683,
-      10877661,   -5814668,    2872546,   -1284419,     503654,    -163997,      39494 },
-  {      -9666,      60776,    -228237,     661364,   -1620923,    3519372,   -6960787,   12781745,
-     -22107194,   36464825,  -58073560,   90628622, -141646817,  230976898, -436958201, 1701008299,
-     972573210, -358041642,  200831735, -125343857,   80460862,  -51365712,   31990869,  -19171034,
-      10920653,   -5838454,    2884792,   -1290179,     506064,    -164855,      39732 },
-  {      -9649,      60764,    -228341,     661925,   -1622740,    3524043,   -6971152,   12802443,
-     -22145306,   36530646,  -58181610,   90799227, -141908762,  231369493, -437477369, 1696549993,
-     978310855, -359508342,  201581852, -125798527,   80751519,  -51552924,   32109479,  -19243792,
-      10963315,   -5862069,    2896958,   -1295906,     508463,    -165709,      39970 },
-  {      -9631,      60748,    -228434,     662455,   -1624486,    3528560,   -6981217,   12822594,
-     -22182480,   36594932,  -58287231,   90966055, -142164808,  231752431, -437978238, 1692074721,
-     984047218, -360965240,  202325730, -126249172,   81039573,  -51738481,   32227072,  -19315952,
-      11005645,   -5885513,    2909044,   -1301600,     510849,    -166561,      40207 },
-  {      -9612,      60730,    -228516,     662957,   -1626161,    3532923,   -6990981,   12842199,
-     -22218718,   36657683,  -58390422,   91129106, -142414956,  232125716, -438460847, 1687582583,
-     989782177, -362412257,  203063328, -126695766,   81325008,  -51922376,   32343642,  -19387511,
-      11047641,   -5908784,    2921047,   -1307258,     513223,    -167409,      40444 },
-  {      -9594,      60709,    -228589,     663428,   -1627763,    3537133,   -7000444,   12861257,
-     -22254018,   36718901,  -58491185,   91288381, -142659207,  232489356, -438925238, 1683073682,
-     995515614, -363849317,  203794607, -127138286,   81607810,  -52104596,   32459183,  -19458463,
-      11089301,   -5931881,    2932969,   -1312883,     515585,    -168254,      40680 },
-  {      -9574,      60685,    -228651,     663870,   -1629294,    3541190,   -7009608,   12879769,
-     -22288383,   36778585,  -58589519,   91443880, -142897561,  232843356, -439371449, 1678548118,
-    1001247409, -365276339,  204519527, -127576707,   81887963,  -52285133,   32573687,  -19528805,
-      11130621,   -5954802,    2944807,   -1318472,     517934,    -169095,      40916 },
-  {      -9555,      60659,    -228702,     664283,   -1630754,    3545093,   -7018472,   12897736,
-     -22321811,   36836736,  -58685425,   91595603, -143130020,  233187724, -439799522, 1674005995,
-    1006977440, -366693246,  205238047, -128011007,   82165451,  -52463977,   32687148,  -19598533,
-      11171600,   -5977547,    2956562,   -1324027,     520270,    -169933,      41151 },
-  {      -9535,      60629,    -228744,     664666,   -1632143,    3548844,   -7027036,   12915159,
-     -22354305,   36893356,  -58778904,   91743552, -143356587,  233522467, -440209499, 1669447414,
-    1012705588, -368099960,  205950129, -128441160,   82440259,  -52641116,   32799560,  -19667644,
-      11212235,   -6000113,    2968232,   -1329545,     522594,    -170768,      41385 },
-  {      -9514,      60597,    -228775,     665020,   -1633461,    3552443,   -7035302,   12932037,
-     -22385865,   36948443,  -58869955,   91887726, -143577263,  233847593, -440601420, 1664872479,
-    1018431732, -369496404,  206655733, -128867143,   82712372,  -52816543,   32910917,  -19736132,
-      11252524,   -6022500,    2979818,   -1335028,     524905,    -171598,      41619 },
-  {      -9493,      60562,    -228796,     665345,   -1634708,    3555889,   -7043270,   12948372,
-     -22416490,   37002000,  -58958581,   92028128, -143792049,  234163108, -440975327, 1660281294,
-    1024155752, -370882499,  207354820, -129288933,   82981775,  -52990245,   33021212,  -19803994,
-      11292464,   -6044706,    2991317,   -1340474,     527203,    -172425,      41853 },
-  {      -9472,      60525,    -228807,     665641,   -1635885,    3559183,   -7050940,   12964163,
-     -22446183,   37054027,  -59044782,   92164757, -144000949,  234469022, -441331264, 1655673960,
-    1029877529, -372258167,  208047350, -129706506,   83248452,  -53162215,   33130438,  -19871227,
-      11332052,   -6066729,    3002729,   -1345884,     529488,    -173249,      42085 },
-  {      -9450,      60485,    -228807,     665908,   -1636992,    3562326,   -7058312,   12979412,
-     -22474943,   37104524,  -59128558,   92297616, -144203965,  234765344, -441669273, 1651050583,
-    1035596941, -373623333,  208733284, -130119839,   83512390,  -53332441,   33238591,  -19937825,
-      11371288,   -6088569,    3014055,   -1351257,     531760,    -174069,      42318 },
-  {      -9428,      60442,    -228798,     666146,   -1638028,    3565318,   -7065387,   12994120,
-     -22502772,   37153493,  -59209911,   92426705, -144401100,  235052081, -441989397, 1646411267,
-    1041313867, -374977917,  209412584, -130528909,   83773572,  -53500915,   33345662,  -20003786,
-      11410167,   -6110223,    3025292,   -1356592,     534017,    -174885,      42549 },
-  {      -9405,      60396,    -228779,     666355,   -1638994,    3568158,   -7072166,   13008286,
-     -22529670,   37200935,  -59288842,   92552027, -144592356,  235329243, -442291680, 1641756115,
-    1047028188, -376321843,  210085212, -130933692,   84031985,  -53667627,   33451646,  -20069105,
-      11448689,   -6131692,    3036440,   -1361890,     536262,    -175697,      42780 },
-  {      -9382,      60348,    -228750,     666536,   -1639890,    3570848,   -7078648,   13021911,
-     -22555638,   37246850,  -59365352,   92673582, -144777737,  235596840, -442576167, 1637085234,
-    1052739783, -377655035,  210751127, -131334166,   84287612,  -53832567,   33556537,  -20133778,
-      11486849,   -6152972,    3047499,   -1367149,     538492,    -176505,      43010 },
-  {      -9359,      60297,    -228711,     666688,   -1640717,    3573388,   -7084835,   13034997,
-     -22580677,   37291240,  -59439442,   92791373, -144957247,  235854881, -442842901, 1632398727,
-    1058448531, -378977415,  211410294, -131730307,   84540441,  -53995725,   33660329,  -20197801,
-      11524647,   -6174064,    3058468,   -1372370,     540709,    -177309,      43240 },
-  {      -9335,      60244,    -228662,     666812,   -1641474,    3575777,   -7090726,   13047543,
-     -22604788,   37334106,  -59511115,   92905402, -145130888,  236103377, -443091928, 1627696701,
-    1064154311, -380288906,  212062672, -132122094,   84790456,  -54157092,   33763015,  -20261171,
-      11562080,   -6194965,    3069345,   -1377553,     542911,    -178109,      43469 },
-  {      -9311,      60188,    -228603,     666907,   -1642162,    3578017,   -7096323,   13059551,
-     -22627972,   37375448,  -59580370,   93015670, -145298665,  236342337, -443323294, 1622979262,
-    1069857003, -381589432,  212708225, -132509503,   85037643,  -54316659,   33864589,  -20323884,
-      11599145,   -6215674,    3080131,   -1382696,     545099,    -178905,      43697 },
-  {      -9286,      60129,    -228535,     666974,   -1642781,    3580108,   -7101626,   13071020,
-     -22650229,   37415269,  -59647211,   93122180, -145460582,  236571774, -443537043, 1618246514,
-    1075556486, -382878918,  213346914, -132892511,   85281987,  -54474416,   33965046,  -20385936,
-      11635840,   -6236191,    3090825,   -1387800,     547273,    -179697,      43924 },
-  {      -9261,      60068,    -228457,     667013,   -1643331,    3582049,   -7106635,   13081953,
-     -22671561,   37453570,  -59711638,   93224934, -145616643,  236791698, -443733222, 1613498565,
-    1081252640, -384157285,  213978702, -133271098,   85523474,  -54630354,   34064379,  -20447323,
-      11672163,   -6256513,    3101426,   -1392864,     549432,    -180485,      44151 },
-  {      -9236,      60005,    -228369,     667023,   -1643812,    3583842,   -7111351,   13092350,
-     -22691969,   37490351,  -59773653,   93323935, -145766853,  237002120, -443911878, 1608735522,
-    1086945343, -385424460,  214603551, -133645239,   85762090,  -54784464,   34162582,  -20508041,
-      11708111,   -6276639,    3111933,   -1397889,     551576,    -181268,      44377 },
-  {      -9210,      59938,    -228272,     667006,   -1644225,    3585486,   -7115774,   13102211,
-     -22711454,   37525615,  -59833259,   93419185, -145911216,  237203053, -444073058, 1603957490,
-    1092634475, -386680365,  215221425, -134014914,   85997821,  -54936736,   34259649,  -20568086,
-      11743683,   -6296568,    3122346,   -1402872,     553706,    -182047,      44602 },
-  {      -9184,      59870,    -228165,     666961,   -1644569,    3586983,   -7119906,   13111538,
-     -22730017,   37559362,  -59890456,   93510688, -146049738,  237394508, -444216809, 1599164579,
-    1098319914, -387924925,  215832287, -134380101,   86230653,  -55087161,   34355574,  -20627456,
-      11778876,   -6316299,    3132663,   -1407815,     555820,    -182822,      44826 },
-  {      -9158,      59799,    -228049,     666888,   -1644846,    3588331,   -7123746,   13120330,
-     -22747660,   37591595,  -59945248,   93598445, -146182423,  237576498, -444343179, 1594356894,
-    1104001541, -389158065,  216436098, -134740776,   86460571,  -55235730,   34450352,  -20686145,
-      11813687,   -6335831,    3142885,   -1412717,     557920,    -183593,      45049 },
-  {      -9131,      59725,    -227923,     666788,   -1645054,    3589533,   -7127295,   13128590,
-     -22764382,   37622315,  -59997636,   93682461, -146309276,  237749036, -444452217, 1589534544,
-    1109679235, -390379709,  217032824, -135096920,   86687562,  -55382434,   34543977,  -20744151,
-      11848115,   -6355161,    3153010,   -1417577,     560004,    -184358,      45272 },
-  {      -9104,      59649,    -227787,     666660,   -1645195,    3590587,   -7130553,   13136318,
-     -22780186,   37651523,  -60047622,   93762738, -146430304,  237912134, -444543969, 1584697637,
-    1115352874, -391589782,  217622426, -135448510,   86911613,  -55527264,   34636442,  -20801469,
-      11882157,   -6374290,    3163038,   -1422395,     562072,    -185120,      45494 },
-  {      -9077,      59571,    -227643,     666505,   -1645269,    3591495,   -7133522,   13143514,
-     -22795073,   37679222,  -60095210,   93839280, -146545511,  238065806, -444618487, 1579846282,
-    1121022337, -392788209,  218204870, -135795525,   87132708,  -55670211,   34727741,  -20858096,
-      11915811,   -6393215,    3172968,   -1427171,     564125,    -185877,      45715 },
-  {      -9049,      59490,    -227489,     666322,   -1645275,    3592257,   -7136202,   13150180,
-     -22809044,   37705412,  -60140400,   93912090, -146654905,  238210066, -444675818, 1574980586,
-    1126687504, -393974916,  218780119, -136137943,   87350836,  -55811266,   34817870,  -20914029,
-      11949075,   -6411935,    3182800,   -1431905,     566163,    -186629,      45935 },
-  {      -9021,      59406,    -227325,     666112,   -1645214,    3592873,   -7138594,   13156317,
-     -22822101,   37730096,  -60183196,   93981172, -146758491,  238344927, -444716014, 1570100660,
-    1132348255, -395149827,  219348137, -136475744,   87565982,  -55950421,   34906822,  -20969263,
-      11981946,   -6430449,    3192532,   -1436596,     568184,    -187376,      46154 },
-  {      -8992,      59321,    -227153,     665875,   -1645087,    3593344,   -7140698,   13161925,
-     -22834244,   37753276,  -60223601,   94046529, -146856275,  238470405, -444739123, 1565206612,
-    1138004467, -396312870,  219908888, -136808906,   87778133,  -56087666,   34994592,  -21023795,
-      12014422,   -6448756,    3202164,   -1441243,     570189,    -188119,      46372 },
-  {      -8964,      59233,    -226971,     665611,   -1644893,    3593669,   -7142514,   13167005,
-     -22845475,   37774954,  -60261616,   94108166, -146948265,  238586513, -444745197, 1560298551,
-    1143656021, -397463968,  220462336, -137137408,   87987275,  -56222992,   35081174,  -21077622,
-      12046502,   -6466854,    3211696,   -1445848,     572178,    -188857,      46590 },
-  {      -8935,      59142,    -226780,     665320,   -1644632,    3593850,   -7144044,   13171559,
-     -22855796,   37795131,  -60297245,   94166086, -147034466,  238693266, -444734286, 1555376588,
-    1149302795, -398603049,  221008448, -137461231,   88193396,  -56356392,   35166562,  -21130739,
-      12078183,   -6484743,    3221126,   -1450408,     574151,    -189590,      46806 },
-  {      -8905,      59050,    -226580,     665003,   -1644306,    3593887,   -7145288,   13175588,
-     -22865208,   37813809,  -60330490,   94220294, -147114886,  238790681, -444706442, 1550440833,
-    1154944668, -399730038,  221547186, -137780352,   88396482,  -56487857,   35250750,  -21183144,
-      12109462,   -6502421,    3230454,   -1454924,     576107,    -190318,      47021 },
-  {      -8875,      58955,    -226372,     664659,   -1643913,    3593780,   -7146247,   13179092,
-     -22873713,   37830991,  -60361355,   94270794, -147189533,  238878772, -444661716, 1545491395,
-    1160581521, -400844862,  222078518, -138094753,   88596521,  -56617378,   35333734,  -21234833,
-      12140339,   -6519886,    3239680,   -1459396,     578047,    -191041,      47236 },
-  {      -8845,      58857,    -226154,     664288,   -1643455,    3593529,   -7146921,   13182073,
-     -22881311,   37846679,  -60389842,   94317590, -147258413,  238957555, -444600161, 1540528385,
-    1166213232, -401947447,  222602407, -138404411,   88793498,  -56744946,   35415507,  -21285801,
-      12170809,   -6537137,    3248802,   -1463822,     579970,    -191759,      47449 },
-  {      -8815,      58758,    -225927,     663891,   -1642932,    3593136,   -7147311,   13184531,
-     -22888006,   37860875,  -60415955,   94360687, -147321534,  239027046, -444521828, 1535551915,
-    1171839680, -403037721,  223118819, -138709309,   88987402,  -56870553,   35496064,  -21336047,
-      12200872,   -6554174,    3257820,   -1468204,     581876,    -192472,      47662 },
-  {      -8784,      58656,    -225691,     663468,   -1642343,    3592600,   -7147418,   13186468,
-     -22893797,   37873582,  -60439696,   94400090, -147378904,  239087262, -444426771, 1530562094,
-    1177460745, -404115611,  223627720, -139009424,   89178220,  -56994191,   35575400,  -21385565,
-      12230525,   -6570995,    3266734,   -1472540,     583764,    -193180,      47873 },
-  {      -8753,      58552,    -225447,     663018,   -1641689,    3591922,   -7147243,   13187885,
-     -22898687,   37884800,  -60461069,   94435803, -147430531,  239138220, -444315043, 1525559035,
-    1183076306, -405181043,  224129077, -139304738,   89365939,  -57115851,   35653509,  -21434354,
-      12259767,   -6587598,    3275542,   -1476830,     585636,    -193882,      48083 },
-  {      -8722,      58446,    -225193,     662542,   -1640971,    3591102,   -7146786,   13188782,
-     -22902677,   37894534,  -60480077,   94467831, -147476424,  239179937, -444186697, 1520542849,
-    1188686242, -406233945,  224622854, -139595231,   89550546,  -57235526,   35730386,  -21482409,
-      12288594,   -6603984,    3284244,   -1481074,     587490,    -194580,      48293 },
-  {      -8691,      58338,    -224931,     662041,   -1640188,    3590141,   -7146048,   13189162,
-     -22905770,   37902785,  -60496724,   94496180, -147516590,  239212429, -444041787, 1515513647,
-    1194290433, -407274244,  225109019, -139880882,   89732029,  -57353207,   35806026,  -21529727,
-      12317005,   -6620149,    3292840,   -1485271,     589327,    -195272,      48501 },
-  {      -8659,      58227,    -224661,     661514,   -1639340,    3589038,   -7145029,   13189025,
-     -22907966,   37909556,  -60511014,   94520854, -147551038,  239235716, -443880367, 1510471543,
-    1199888758, -408301870,  225587537, -140161674,   89910376,  -57468886,   35880423,  -21576304,
-      12344998,   -6636093,    3301328,   -1489422,     591145,    -195958,      48708 },
-  {      -8627,      58114,    -224382,     660961,   -1638429,    3587796,   -7143731,   13188372,
-     -22909268,   37914849,  -60522949,   94541860, -147579778,  239249814, -443702493, 1505416646,
-    1205481096, -409316749,  226058377, -140437586,   90085574,  -57582554,   35953572,  -21622138,
-      12372571,   -6651816,    3309708,   -1493525,     592946,    -196639,      48914 },
-  {      -8595,      57999,    -224094,     660382,   -1637454,    3586414,   -7142154,   13187205,
-     -22909677,   37918666,  -60532534,   94559202, -147602817,  239254742, -443508218, 1500349072,
-    1211067328, -410318810,  226521504, -140708599,   90257611,  -57694205,   36025467,  -21667225,
-      12399722,   -6667315,    3317980,   -1497581,     594730,    -197315,      49118 },
-  {      -8562,      57882,    -223797,     659778,   -1636416,    3584892,   -7140299,   13185524,
-     -22909195,   37921012,  -60539772,   94572887, -147620166,  239250518, -443297599, 1495268931,
-    1216647333, -411307981,  226976886, -140974695,   90426476,  -57803830,   36096104,  -21711561,
-      12426448,   -6682590,    3326142,   -1501589,     596495,    -197985,      49322 },
-  {      -8529,      57763,    -223493,     659148,   -1635314,    3583231,   -7138167,   13183331,
-     -22907824,   37921887,  -60544667,   94582919, -147631834,  239237162, -443070691, 1490176337,
-    1222220990, -412284192,  227424490, -141235854,   90592156,  -57911420,   36165478,  -21755144,
-      12452748,   -6697638,    3334194,   -1505549,     598241,    -198650,      49525 },
-  {      -8496,      57642,    -223179,     658494,   -1634149,    3581431,   -7135758,   13180628,
-     -22905567,   37921296,  -60547223,   94589305, -147637831,  239214692, -442827550, 1485071404,
-    1227788179, -413247372,  227864284, -141492058,   90754639,  -58016970,   36233582,  -21797970,
-      12478620,   -6712461,    3342136,   -1509461,     599969,    -199309,      49726 },
-  {      -8463,      57519,    -222858,     657814,   -1632922,    3579493,   -7133074,   13177415,
-     -22902423,   37919240,  -60547445,   94592051, -147638165,  239183129, -442568232, 1479954244,
-    1233348780, -414197449,  228296236, -141743288,   90913914,  -58120470,   36300413,  -21840035,
-      12504061,   -6727055,    3349966,   -1513323,     601679,    -199962,      49926 },
-  {      -8429,      57394,    -222528,     657109,   -1631631,    3577418,   -7130114,   13173694,
-     -22898397,   37915722,  -60545336,   94591163, -147632848,  239142491, -442292794, 1474824971,
-    1238902672, -415134353,  228720314, -141989527,   91069968,  -58221913,   36365966,  -21881337,
-      12529070,   -6741419,    3357685,   -1517137,     603370,    -200609,      50125 },
-  {      -8395,      57266,    -222190,     656380,   -1630279,    3575206,   -7126881,   13169465,
-     -22893489,   37910746,  -60540900,   94586648, -147621889,  239092799, -442001294, 1469683699,
-    1244449736, -416058014,  229136486, -142230755,   91222791,  -58321291,   36430234,  -21921872,
-      12553645,   -6755554,    3365291,   -1520901,     605042,    -201251,      50323 },
-  {      -8361,      57137,    -221843,     655626,   -1628865,    3572856,   -7123374,   13164731,
-     -22887701,   37904314,  -60534142,   94578511, -147605300,  239034073, -441693788, 1464530542,
-    1249989852, -416968361,  229544721, -142466955,   91372371,  -58418598,   36493214,  -21961638,
-      12577783,   -6769457,    3372784,   -1524615,     606695,    -201886,      50519 },
-  {      -8327,      57005,    -221489,     654847,   -1627389,    3570371,   -7119595,   13159493,
-     -22881037,   37896429,  -60525066,   94566759, -147583089,  238966334, -441370334, 1459365614,
-    1255522899, -417865326,  229944988, -142698109,   91518697,  -58513824,   36554900,  -22000631,
-      12601483,   -6783127,    3380164,   -1528279,     608329,    -202516,      50714 },
-  {      -8292,      56872,    -221126,     654044,   -1625851,    3567750,   -7115544,   13153752,
-     -22873497,   37887095,  -60513677,   94551399, -147555270,  238889602, -441030991, 1454189029,
-    1261048757, -418748839,  230337255, -142924199,   91661757,  -58606964,   36615288,  -22038847,
-      12624743,   -6796564,    3387428,   -1531893,     609944,    -203140,      50908 },
-  {      -8257,      56737,    -220756,     653216,   -1624252,    3564993,   -7111222,   13147509,
-     -22865084,   37876314,  -60499979,   94532438, -147521851,  238803899, -440675817, 1449000903,
-    1266567307, -419618829,  230721491, -143145208,   91801541,  -58698010,   36674372,  -22076285,
-      12647561,   -6809766,    3394578,   -1535456,     611539,    -203758,      51100 },
-  {      -8222,      56600,    -220377,     652364,   -1622593,    3562102,   -7106631,   13140766,
-     -22855799,   37864090,  -60483976,   94509882, -147482845,  238709246, -440304871, 1443801350,
-    1272078429, -420475228,  231097667, -143361118,   91938036,  -58786954,   36732149,  -22112940,
-      12669935,   -6822731,    3401613,   -1538969,     613115,    -204369,      51291 },
-  {      -8187,      56460,    -219991,     651488,   -1620872,    3559077,   -7101770,   13133523,
-     -22845646,   37850426,  -60465674,   94483739, -147438263,  238605665, -439918212, 1438590484,
-    1277582004, -421317968,  231465752, -143571913,   92071233,  -58873790,   36788612,  -22148809,
-      12691863,   -6835460,    3408531,   -1542429,     614671,    -204975,      51481 },
-  {      -8151,      56319,    -219596,     650588,   -1619091,    3555918,   -7096642,   13125784,
-     -22834626,   37835324,  -60445077,   94454015, -147388116,  238493179, -439515898, 1433368422,
-    1283077911, -422146980,  231825716, -143777574,   92201121,  -58958510,   36843758,  -22183891,
-      12713343,   -6847950,    3415332,   -1545839,     616207,    -205574,      51670 },
-  {      -8116,      56176,    -219194,     649665,   -1617250,    3552625,   -7091245,   13117548,
-     -22822741,   37818789,  -60422190,   94420719, -147332416,  238371808, -439097991, 1428135278,
-    1288566031, -422962195,  232177529, -143978085,   92327688,  -59041107,   36897582,  -22218181,
-      12734373,   -6860201,    3422015,   -1549196,     617723,    -206167,      51857 },
-  {      -8080,      56032,    -218784,     648717,   -1615350,    3549200,   -7085583,   13108818,
-     -22809994,   37800823,  -60397018,   94383857, -147271176,  238241577, -438664550, 1422891169,
-    1294046246, -423763546,  232521161, -144173430,   92450925,  -59121574,   36950080,  -22251677,
-      12754952,   -6872211,    3428581,   -1552501,     619219,    -206753,      52042 },
-  {      -8044,      55885,    -218366,     647746,   -1613389,    3545643,   -7079655,   13099595,
-     -22796387,   37781431,  -60369566,   94343437, -147204406,  238102507, -438215636, 1417636210,
-    1299518435, -424550964,  232856583, -144363591,   92570820,  -59199905,   37001246,  -22284375,
-      12775078,   -6883980,    3435028,   -1555753,     620695,    -207333,      52227 },
-  {      -8007,      55736,    -217941,     646752,   -1611369,    3541954,   -7073462,   13089880,
-     -22781922,   37760614,  -60339839,   94299467, -147132121,  237954622, -437751309, 1412370516,
-    1304982479, -425324382,  233183766, -144548553,   92687364,  -59276092,   37051076,  -22316273,
-      12794748,   -6895506,    3441355,   -1558952,     622150,    -207907,      52409 },
-  {      -7971,      55586,    -217508,     645734,   -1609290,    3538134,   -7067006,   13079674,
-     -22766602,   37738378,  -60307842,   94251955, -147054331,  237797945, -437271630, 1407094204,
-    1310438260, -426083734,  233502682, -144728299,   92800546,  -59350129,   37099566,  -22347369,
-      12813961,   -6906788,    3447563,   -1562098,     623585,    -208474,      52591 },
-  {      -7934,      55434,    -217067,     644693,   -1607153,    3534183,   -7060287,   13068981,
-     -22750428,   37714726,  -60273581,   94200907, -146971050,  237632500, -436776661, 1401807391,
-    1315885658, -426828951,  233813300, -144902813,   92910357,  -59422010,   37146712,  -22377658,
-      12832716,   -6917826,    3453650,   -1565191,     624999,    -209035,      52771 },
-  {      -7897,      55280,    -216619,     643630,   -1604957,    3530102,   -7053306,   13057800,
-     -22733404,   37689660,  -60237060,   94146333, -146882291,  237458312, -436266463, 1396510193,
-    1321324555, -427559968,  234115594, -145072079,   93016785,  -59491726,   37192508,  -22407138,
-      12851010,   -6928617,    3459616,   -1568230,     626392,    -209589,      52949 },
-  {      -7860,      55124,    -216163,     642543,   -1602702,    3525892,   -7046064,   13046133,
-     -22715531,   37663185,  -60198286,   94088241, -146788067,  237275403, -435741099, 1391202725,
-    1326754831, -428276718,  234409535, -145236081,   93119821,  -59559273,   37236951,  -22435807,
-      12868842,   -6939162,    3465460,   -1571215,     627764,    -210136,      53126 },
-  {      -7823,      54967,    -215701,     641433,   -1600390,    3521552,   -7038562,   13033982,
-     -22696813,   37635305,  -60157264,   94026638, -146688390,  237083799, -435200630, 1385885106,
-    1332176369, -428979135,  234695096, -145394805,   93219456,  -59624643,   37280036,  -22463661,
-      12886209,   -6949459,    3471182,   -1574145,     629115,    -210677,      53301 },
-  {      -7786,      54808,    -215230,     640301,   -1598020,    3517084,   -7030801,   13021349,
-     -22677251,   37606022,  -60113998,   93961533, -146583275,  236883525, -434645120, 1380557452,
-    1337589049, -429667152,  234972247, -145548234,   93315679,  -59687830,   37321760,  -22490698,
-      12903111,   -6959507,    3476782,   -1577021,     630445,    -211211,      53475 },
-  {      -7748,      54647,    -214753,     639146,   -1595593,    3512488,   -7022782,   13008235,
-     -22656848,   37575342,  -60068496,   93892936, -146472735,  236674605, -434074631, 1375219881,
-    1342992754, -430340705,  235240963, -145696353,   93408482,  -59748827,   37362117,  -22516915,
-      12919545,   -6969304,    3482258,   -1579841,     631754,    -211738,      53647 },
-  {      -7710,      54485,    -214268,     637969,   -1593109,    3507765,   -7014506,   12994642,
-     -22635607,   37543267,  -60020762,   93820853, -146356783,  236457064, -433489226, 1369872509,
-    1348387365, -430999729,  235501216, -145839147,   93497854,  -59807630,   37401104,  -22542310,
-      12935510,   -6978851,    3487609,   -1582607,     633040,    -212258,      53818 },
-  {      -7672,      54320,    -213776,     636770,   -1590568,    3502915,   -7005974,   12980572,
-     -22613530,   37509802,  -59970803,   93745295, -146235434,  236230929, -432888970, 1364515453,
-    1353772764, -431644157,  235752979, -145976602,   93583786,  -59864230,   37438716,  -22566879,
-      12951004,   -6988145,    3492837,   -1585316,     634306,    -212771,      53987 },
-  {      -7634,      54155,    -213277,     635549,   -1587970,    3497939,   -6997187,   12966025,
-     -22590620,   37474950,  -59918623,   93666270, -146108703,  235996225, -432273925, 1359148832,
-    1359148832, -432273925,  235996225, -146108703,   93666270,  -59918623,   37474950,  -22590620,
-      12966025,   -6997187,    3497939,   -1587970,     635549,    -213277,      54155 },
-  {      -7596,      53987,    -212771,     634306,   -1585316,    3492837,   -6988145,   12951004,
-     -22566879,   37438716,  -59864230,   93583786, -145976602,  235752979, -431644157, 1353772764,
-    1364515453, -432888970,  236230929, -146235434,   93745295,  -59970803,   37509802,  -22613530,
-      12980572,   -7005974,    3502915,   -1590568,     636770,    -213776,      54320 },
-  {      -7558,      53818,    -212258,     633040,   -1582607,    3487609,   -6978851,   12935510,
-     -22542310,   37401104,  -59807630,   93497854, -145839147,  235501216, -430999729, 1348387365,
-    1369872509, -433489226,  236457064, -146356783,   93820853,  -60020762,   37543267,  -22635607,
-      12994642,   -7014506,    3507765,   -1593109,     637969,    -214268,      54485 },
-  {      -7519,      53647,    -211738,     631754,   -1579841,    3482258,   -6969304,   12919545,
-     -22516915,   37362117,  -59748827,   93408482, -145696353,  235240963, -430340705, 1342992754,
-    1375219881, -434074631,  236674605, -146472735,   93892936,  -60068496,   37575342,  -22656848,
-      13008235,   -7022782,    3512488,   -1595593,     639146,    -214753,      54647 },
-  {      -7481,      53475,    -211211,     630445,   -1577021,    3476782,   -6959507,   12903111,
-     -22490698,   37321760,  -59687830,   93315679, -145548234,  234972247, -429667152, 1337589049,
-    1380557452, -434645120,  236883525, -146583275,   93961533,  -60113998,   37606022,  -22677251,
-      13021349,   -7030801,    3517084,   -1598020,     640301,    -215230,      54808 },
-  {      -7442,      53301,    -210677,     629115,   -1574145,    3471182,   -6949459,   12886209,
-     -22463661,   37280036,  -59624643,   93219456, -145394805,  234695096, -428979135, 1332176369,
-    1385885106, -435200630,  237083799, -146688390,   94026638,  -60157264,   37635305,  -22696813,
-      13033982,   -7038562,    3521552,   -1600390,     641433,    -215701,      54967 },
-  {      -7403,      53126,    -210136,     627764,   -1571215,    3465460,   -6939162,   12868842,
-     -22435807,   37236951,  -59559273,   93119821, -145236081,  234409535, -428276718, 1326754831,
-    1391202725, -435741099,  237275403, -146788067,   94088241,  -60198286,   37663185,  -22715531,
-      13046133,   -7046064,    3525892,   -1602702,     642543,    -216163,      55124 },
-  {      -7364,      52949,    -209589,     626392,   -1568230,    3459616,   -6928617,   12851010,
-     -22407138,   37192508,  -59491726,   93016785, -145072079,  234115594, -427559968, 1321324555,
-    1396510193, -436266463,  237458312, -146882291,   94146333,  -60237060,   37689660,  -22733404,
-      13057800,   -7053306,    3530102,   -1604957,     643630,    -216619,      55280 },
-  {      -7325,      52771,    -209035,     624999,   -1565191,    3453650,   -6917826,   12832716,
-     -22377658,   37146712,  -59422010,   92910357, -144902813,  233813300, -426828951, 1315885658,
-    1401807391, -436776661,  237632500, -146971050,   94200907,  -60273581,   37714726,  -22750428,
-      13068981,   -7060287,    3534183,   -1607153,     644693,    -217067,      55434 },
-  {      -7285,      52591,    -208474,     623585,   -1562098,    3447563,   -6906788,   12813961,
-     -22347369,   37099566,  -59350129,   92800546, -144728299,  233502682, -426083734, 1310438260,
-    1407094204, -437271630,  237797945, -147054331,   94251955,  -60307842,   37738378,  -22766602,
-      13079674,   -7067006,    3538134,   -1609290,     645734,    -217508,      55586 },
-  {      -7246,      52409,    -207907,     622150,   -1558952,    3441355,   -6895506,   12794748,
-     -22316273,   37051076,  -59276092,   92687364, -144548553,  233183766, -425324382, 1304982479,
-    1412370516, -437751309,  237954622, -147132121,   94299467,  -60339839,   37760614,  -22781922,
-      13089880,   -7073462,    3541954,   -1611369,     646752,    -217941,      55736 },
-  {      -7206,      52227,    -207333,     620695,   -1555753,    3435028,   -6883980,   12775078,
-     -22284375,   37001246,  -59199905,   92570820, -144363591,  232856583, -424550964, 1299518435,
-    1417636210, -438215636,  238102507, -147204406,   94343437,  -60369566,   37781431,  -22796387,
-      13099595,   -7079655,    3545643,   -1613389,     647746,    -218366,      55885 },
-  {      -7167,      52042,    -206753,     619219,   -1552501,    3428581,   -6872211,   12754952,
-     -22251677,   36950080,  -59121574,   92450925, -144173430,  232521161, -423763546, 1294046246,
-    1422891169, -438664550,  238241577, -147271176,   94383857,  -60397018,   37800823,  -22809994,
-      13108818,   -7085583,    3549200,   -1615350,     648717,    -218784,      56032 },
-  {      -7127,      51857,    -206167,     617723,   -1549196,    3422015,   -6860201,   12734373,
-     -22218181,   36897582,  -59041107,   92327688, -143978085,  232177529, -422962195, 1288566031,
-    1428135278, -439097991,  238371808, -147332416,   94420719,  -60422190,   37818789,  -22822741,
-      13117548,   -7091245,    3552625,   -1617250,     649665,    -219194,      56176 },
-  {      -7087,      51670,    -205574,     616207,   -1545839,    3415332,   -6847950,   12713343,
-     -22183891,   36843758,  -58958510,   92201121, -143777574,  231825716, -422146980, 1283077911,
-    1433368422, -439515898,  238493179, -147388116,   94454015,  -60445077,   37835324,  -22834626,
-      13125784,   -7096642,    3555918,   -1619091,     650588,    -219596,      56319 },
-  {      -7047,      51481,    -204975,     614671,   -1542429,    3408531,   -6835460,   12691863,
-     -22148809,   36788612,  -58873790,   92071233, -143571913,  231465752, -421317968, 1277582004,
-    1438590484, -439918212,  238605665, -147438263,   94483739,  -60465674,   37850426,  -22845646,
-      13133523,   -7101770,    3559077,   -1620872,     651488,    -219991,      56460 },
-  {      -7007,      51291,    -204369,     613115,   -1538969,    3401613,   -6822731,   12669935,
-     -22112940,   36732149,  -58786954,   91938036, -143361118,  231097667, -420475228, 1272078429,
-    1443801350, -440304871,  238709246, -147482845,   94509882,  -60483976,   37864090,  -22855799,
-      13140766,   -7106631,    3562102,   -1622593,     652364,    -220377,      56600 },
-  {      -6967,      51100,    -203758,     611539,   -1535456,    3394578,   -6809766,   12647561,
-     -22076285,   36674372,  -58698010,   91801541, -143145208,  230721491, -419618829, 1266567307,
-    1449000903, -440675817,  238803899, -147521851,   94532438,  -60499979,   37876314,  -22865084,
-      13147509,   -7111222,    3564993,   -1624252,     653216,    -220756,      56737 },
-  {      -6927,      50908,    -203140,     609944,   -1531893,    3387428,   -6796564,   12624743,
-     -22038847,   36615288,  -58606964,   91661757, -142924199,  230337255, -418748839, 1261048757,
-    1454189029, -441030991,  238889602, -147555270,   94551399,  -60513677,   37887095,  -22873497,
-      13153752,   -7115544,    3567750,   -1625851,     654044,    -221126,      56872 },
-  {      -6886,      50714,    -202516,     608329,   -1528279,    3380164,   -6783127,   12601483,
-     -22000631,   36554900,  -58513824,   91518697, -142698109,  229944988, -417865326, 1255522899,
-    1459365614, -441370334,  238966334, -147583089,   94566759,  -60525066,   37896429,  -22881037,
-      13159493,   -7119595,    3570371,   -1627389,     654847,    -221489,      57005 },
-  {      -6846,      50519,    -201886,     606695,   -1524615,    3372784,   -6769457,   12577783,
-     -21961638,   36493214,  -58418598,   91372371, -142466955,  229544721, -416968361, 1249989852,
-    1464530542, -441693788,  239034073, -147605300,   94578511,  -60534142,   37904314,  -22887701,
-      13164731,   -7123374,    3572856,   -1628865,     655626,    -221843,      57137 },
-  {      -6805,      50323,    -201251,     605042,   -1520901,    3365291,   -6755554,   12553645,
-     -21921872,   36430234,  -58321291,   91222791, -142230755,  229136486, -416058014, 1244449736,
-    1469683699, -442001294,  239092799, -147621889,   94586648,  -60540900,   37910746,  -22893489,
-      13169465,   -7126881,    3575206,   -1630279,     656380,    -222190,      57266 },
-  {      -6765,      50125,    -200609,     603370,   -1517137,    3357685,   -6741419,   12529070,
-     -21881337,   36365966,  -58221913,   91069968, -141989527,  228720314, -415134353, 1238902672,
-    1474824971, -442292794,  239142491, -147632848,   94591163,  -60545336,   37915722,  -22898397,
-      13173694,   -7130114,    3577418,   -1631631,     657109,    -222528,      57394 },
-  {      -6724,      49926,    -199962,     601679,   -1513323,    3349966,   -6727055,   12504061,
-     -21840035,   36300413,  -58120470,   90913914, -141743288,  228296236, -414197449, 1233348780,
-    1479954244, -442568232,  239183129, -147638165,   94592051,  -60547445,   37919240,  -22902423,
-      13177415,   -7133074,    3579493,   -1632922,     657814,    -222858,      57519 },
-  {      -6684,      49726,    -199309,     599969,   -1509461,    3342136,   -6712461,   12478620,
-     -21797970,   36233582,  -58016970,   90754639, -141492058,  227864284, -413247372, 1227788179,
-    1485071404, -442827550,  239214692, -147637831,   94589305,  -60547223,   37921296,  -22905567,
-      13180628,   -7135758,    3581431,   -1634149,     658494,    -223179,      57642 },
-  {      -6643,      49525,    -198650,     598241,   -1505549,    3334194,   -6697638,   12452748,
-     -21755144,   36165478,  -57911420,   90592156, -141235854,  227424490, -412284192, 1222220990,
-    1490176337, -443070691,  239237162, -147631834,   94582919,  -60544667,   37921887,  -22907824,
-      13183331,   -7138167,    3583231,   -1635314,     659148,    -223493,      57763 },
-  {      -6602,      49322,    -197985,     596495,   -1501589,    3326142,   -6682590,   12426448,
-     -21711561,   36096104,  -57803830,   90426476, -140974695,  226976886, -411307981, 1216647333,
-    1495268931, -443297599,  239250518, -147620166,   94572887,  -60539772,   37921012,  -22909195,
-      13185524,   -7140299,    3584892,   -1636416,     659778,    -223797,      57882 },
-  {      -6561,      49118,    -197315,     594730,   -1497581,    3317980,   -6667315,   12399722,
-     -21667225,   36025467,  -57694205,   90257611, -140708599,  226521504, -410318810, 1211067328,
-    1500349072, -443508218,  239254742, -147602817,   94559202,  -60532534,   37918666,  -22909677,
-      13187205,   -7142154,    3586414,   -1637454,     660382,    -224094,      57999 },
-  {      -6520,      48914,    -196639,     592946,   -1493525,    3309708,   -6651816,   12372571,
-     -21622138,   35953572,  -57582554,   90085574, -140437586,  226058377, -409316749, 1205481096,
-    1505416646, -443702493,  239249814, -147579778,   94541860,  -60522949,   37914849,  -22909268,
-      13188372,   -7143731,    3587796,   -1638429,     660961,    -224382,      58114 },
-  {      -6479,      48708,    -195958,     591145,   -1489422,    3301328,   -6636093,   12344998,
-     -21576304,   35880423,  -57468886,   89910376, -140161674,  225587537, -408301870, 1199888758,
-    1510471543, -443880367,  239235716, -147551038,   94520854,  -60511014,   37909556,  -22907966,
-      13189025,   -7145029,    3589038,   -1639340,     661514,    -224661,      58227 },
-  {      -6438,      48501,    -195272,     589327,   -1485271,    3292840,   -6620149,   12317005,
-     -21529727,   35806026,  -57353207,   89732029, -139880882,  225109019, -407274244, 1194290433,
-    1515513647, -444041787,  239212429, -147516590,   94496180,  -60496724,   37902785,  -22905770,
-      13189162,   -7146048,    3590141,   -1640188,     662041,    -224931,      58338 },
-  {      -6397,      48293,    -194580,     587490,   -1481074,    3284244,   -6603984,   12288594,
-     -21482409,   35730386,  -57235526,   89550546, -139595231,  224622854, -406233945, 1188686242,
-    1520542849, -444186697,  239179937, -147476424,   94467831,  -60480077,   37894534,  -22902677,
-      13188782,   -7146786,    3591102,   -1640971,     662542,    -225193,      58446 },
-  {      -6356,      48083,    -193882,     585636,   -1476830,    3275542,   -6587598,   12259767,
-     -21434354,   35653509,  -57115851,   89365939, -139304738,  224129077, -405181043, 1183076306,
-    1525559035, -444315043,  239138220, -147430531,   94435803,  -60461069,   37884800,  -22898687,
-      13187885,   -7147243,    3591922,   -1641689,     663018,    -225447,      58552 },
-  {      -6315,      47873,    -193180,     583764,   -1472540,    3266734,   -6570995,   12230525,
-     -21385565,   35575400,  -56994191,   89178220, -139009424,  223627720, -404115611, 1177460745,
-    1530562094, -444426771,  239087262, -147378904,   94400090,  -60439696,   37873582,  -22893797,
-      13186468,   -7147418,    3592600,   -1642343,     663468,    -225691,      58656 },
-  {      -6273,      47662,    -192472,     581876,   -1468204,    3257820,   -6554174,   12200872,
-     -21336047,   35496064,  -56870553,   88987402, -138709309,  223118819, -403037721, 1171839680,
-    1535551915, -444521828,  239027046, -147321534,   94360687,  -60415955,   37860875,  -22888006,
-      13184531,   -7147311,    3593136,   -1642932,     663891,    -225927,      58758 },
-  {      -6232,      47449,    -191759,     579970,   -1463822,    3248802,   -6537137,   12170809,
-     -21285801,   35415507,  -56744946,   88793498, -138404411,  222602407, -401947447, 1166213232,
-    1540528385, -444600161,  238957555, -147258413,   94317590,  -60389842,   37846679,  -22881311,
-      13182073,   -7146921,    3593529,   -1643455,     664288,    -226154,      58857 },
-  {      -6191,      47236,    -191041,     578047,   -1459396,    3239680,   -6519886,   12140339,
-     -21234833,   35333734,  -56617378,   88596521, -138094753,  222078518, -400844862, 1160581521,
-    1545491395, -444661716,  238878772, -147189533,   94270794,  -60361355,   37830991,  -22873713,
-      13179092,   -7146247,    3593780,   -1643913,     664659,    -226372,      58955 },
-  {      -6150,      47021,    -190318,     576107,   -1454924,    3230454,   -6502421,   12109462,
-     -21183144,   35250750,  -56487857,   88396482, -137780352,  221547186, -399730038, 1154944668,
-    1550440833, -444706442,  238790681, -147114886,   94220294,  -60330490,   37813809,  -22865208,
-      13175588,   -7145288,    3593887,   -1644306,     665003,    -226580,      59050 },
-  {      -6108,      46806,    -189590,     574151,   -1450408,    3221126,   -6484743,   12078183,
-     -21130739,   35166562,  -56356392,   88193396, -137461231,  221008448, -398603049, 1149302795,
-    1555376588, -444734286,  238693266, -147034466,   94166086,  -60297245,   37795131,  -22855796,
-      13171559,   -7144044,    3593850,   -1644632,     665320,    -226780,      59142 },
-  {      -6067,      46590,    -188857,     572178,   -1445848,    3211696,   -6466854,   12046502,
-     -21077622,   35081174,  -56222992,   87987275, -137137408,  220462336, -397463968, 1143656021,
-    1560298551, -444745197,  238586513, -146948265,   94108166,  -60261616,   37774954,  -22845475,
-      13167005,   -7142514,    3593669,   -1644893,     665611,    -226971,      59233 },
-  {      -6026,      46372,    -188119,     570189,   -1441243,    3202164,   -6448756,   12014422,
-     -21023795,   34994592,  -56087666,   87778133, -136808906,  219908888, -396312870, 1138004467,
-    1565206612, -444739123,  238470405, -146856275,   94046529,  -60223601,   37753276,  -22834244,
-      13161925,   -7140698,    3593344,   -1645087,     665875,    -227153,      59321 },
-  {      -5984,      46154,    -187376,     568184,   -1436596,    3192532,   -6430449,   11981946,
-     -20969263,   34906822,  -55950421,   87565982, -136475744,  219348137, -395149827, 1132348255,
-    1570100660, -444716014,  238344927, -146758491,   93981172,  -60183196,   37730096,  -22822101,
-      13156317,   -7138594,    3592873,   -1645214,     666112,    -227325,      59406 },
-  {      -5943,      45935,    -186629,     566163,   -1431905,    3182800,   -6411935,   11949075,
-     -20914029,   34817870,  -55811266,   87350836, -136137943,  218780119, -393974916, 1126687504,
-    1574980586, -444675818,  238210066, -146654905,   93912090,  -60140400,   37705412,  -22809044,
-      13150180,   -7136202,    3592257,   -1645275,     666322,    -227489,      59490 },
-  {      -5902,      45715,    -185877,     564125,   -1427171,    3172968,   -6393215,   11915811,
-     -20858096,   34727741,  -55670211,   87132708, -135795525,  218204870, -392788209, 1121022337,
-    1579846282, -444618487,  238065806, -146545511,   93839280,  -60095210,   37679222,  -22795073,
-      13143514,   -7133522,    3591495,   -1645269,     666505,    -227643,      59571 },
-  {      -5860,      45494,    -185120,     562072,   -1422395,    3163038,   -6374290,   11882157,
-     -20801469,   34636442,  -55527264,   86911613, -135448510,  217622426, -391589782, 1115352874,
-    1584697637, -444543969,  237912134, -146430304,   93762738,  -60047622,   37651523,  -22780186,
-      13136318,   -7130553,    3590587,   -1645195,     666660,    -227787,      59649 },
-  {      -5819,      45272,    -184358,     560004,   -1417577,    3153010,   -6355161,   11848115,
-     -20744151,   34543977,  -55382434,   86687562, -135096920,  217032824, -390379709, 1109679235,
-    1589534544, -444452217,  237749036, -146309276,   93682461,  -59997636,   37622315,  -22764382,
-      13128590,   -7127295,    3589533,   -1645054,     666788,    -227923,      59725 },
-  {      -5777,      45049,    -183593,     557920,   -1412717,    3142885,   -6335831,   11813687,
-     -20686145,   34450352,  -55235730,   86460571, -134740776,  216436098, -389158065, 1104001541,
-    1594356894, -444343179,  237576498, -146182423,   93598445,  -59945248,   37591595,  -22747660,
-      13120330,   -7123746,    3588331,   -1644846,     666888,    -228049,      59799 },
-  {      -5736,      44826,    -182822,     555820,   -1407815,    3132663,   -6316299,   11778876,
-     -20627456,   34355574,  -55087161,   86230653, -134380101,  215832287, -387924925, 1098319914,
-    1599164579, -444216809,  237394508, -146049738,   93510688,  -59890456,   37559362,  -22730017,
-      13111538,   -7119906,    3586983,   -1644569,     666961,    -228165,      59870 },
-  {      -5695,      44602,    -182047,     553706,   -1402872,    3122346,   -6296568,   11743683,
-     -20568086,   34259649,  -54936736,   85997821, -134014914,  215221425, -386680365, 1092634475,
-    1603957490, -444073058,  237203053, -145911216,   93419185,  -59833259,   37525615,  -22711454,
-      13102211,   -7115774,    3585486,   -1644225,     667006,    -228272,      59938 },
-  {      -5653,      44377,    -181268,     551576,   -1397889,    3111933,   -6276639,   11708111,
-     -20508041,   34162582,  -54784464,   85762090, -133645239,  214603551, -385424460, 1086945343,
-    1608735522, -443911878,  237002120, -145766853,   93323935,  -59773653,   37490351,  -22691969,
-      13092350,   -7111351,    3583842,   -1643812,     667023,    -228369,      60005 },
-  {      -5612,      44151,    -180485,     549432,   -1392864,    3101426,   -6256513,   11672163,
-     -20447323,   34064379,  -54630354,   85523474, -133271098,  213978702, -384157285, 1081252640,
-    1613498565, -443733222,  236791698, -145616643,   93224934,  -59711638,   37453570,  -22671561,
-      13081953,   -7106635,    3582049,   -1643331,     667013,    -228457,      60068 },
-  {      -5571,      43924,    -179697,     547273,   -1387800,    3090825,   -6236191,   11635840,
-     -20385936,   33965046,  -54474416,   85281987, -132892511,  213346914, -382878918, 1075556486,
-    1618246514, -443537043,  236571774, -145460582,   93122180,  -59647211,   37415269,  -22650229,
-      13071020,   -7101626,    3580108,   -1642781,     666974,    -228535,      60129 },
-  {      -5530,      43697,    -178905,     545099,   -1382696,    3080131,   -6215674,   11599145,
-     -20323884,   33864589,  -54316659,   85037643, -132509503,  212708225, -381589432, 1069857003,
-    1622979262, -443323294,  236342337, -145298665,   93015670,  -59580370,   37375448,  -22627972,
-      13059551,   -7096323,    3578017,   -1642162,     666907,    -228603,      60188 },
-  {      -5488,      43469,    -178109,     542911,   -1377553,    3069345,   -6194965,   11562080,
-     -20261171,   33763015,  -54157092,   84790456, -132122094,  212062672, -380288906, 1064154311,
-    1627696701, -443091928,  236103377, -145130888,   92905402,  -59511115,   37334106,  -22604788,
-      13047543,   -7090726,    3575777,   -1641474,     666812,    -228662,      60244 },
-  {      -5447,      43240,    -177309,     540709,   -1372370,    3058468,   -6174064,   11524647,
-     -20197801,   33660329,  -53995725,   84540441, -131730307,  211410294, -378977415, 1058448531,
-    1632398727, -442842901,  235854881, -144957247,   92791373,  -59439442,   37291240,  -22580677,
-      13034997,   -7084835,    3573388,   -1640717,     666688,    -228711,      60297 },
-  {      -5406,      43010,    -176505,     538492,   -1367149,    3047499,   -6152972,   11486849,
-     -20133778,   33556537,  -53832567,   84287612, -131334166,  210751127, -377655035, 1052739783,
-    1637085234, -442576167,  235596840, -144777737,   92673582,  -59365352,   37246850,  -22555638,
-      13021911,   -7078648,    3570848,   -1639890,     666536,    -228750,      60348 },
-  {      -5365,      42780,    -175697,     536262,   -1361890,    3036440,   -6131692,   11448689,
-     -20069105,   33451646,  -53667627,   84031985, -130933692,  210085212, -376321843, 1047028188,
-    1641756115, -442291680,  235329243, -144592356,   92552027,  -59288842,   37200935,  -22529670,
-      13008286,   -7072166,    3568158,   -1638994,     666355,    -228779,      60396 },
-  {      -5324,      42549,    -174885,     534017,   -1356592,    3025292,   -6110223,   11410167,
-     -20003786,   33345662,  -53500915,   83773572, -130528909,  209412584, -374977917, 1041313867,
-    1646411267, -441989397,  235052081, -144401100,   92426705,  -59209911,   37153493,  -22502772,
-      12994120,   -7065387,    3565318,   -1638028,     666146,    -228798,      60442 },
-  {      -5282,      42318,    -174069,     531760,   -1351257,    3014055,   -6088569,   11371288,
-     -19937825,   33238591,  -53332441,   83512390, -130119839,  208733284, -373623333, 1035596941,
-    1651050583, -441669273,  234765344, -144203965,   92297616,  -59128558,   37104524,  -22474943,
-      12979412,   -7058312,    3562326,   -1636992,     665908,    -228807,      60485 },
-  {      -5241,      42085,    -173249,     529488,   -1345884,    3002729,   -6066729,   11332052,
-     -19871227,   33130438,  -53162215,   83248452, -129706506,  208047350, -372258167, 1029877529,
-    1655673960, -441331264,  234469022, -144000949,   92164757,  -59044782,   37054027,  -22446183,
-      12964163,   -7050940,    3559183,   -1635885,     665641,    -228807,      60525 },
-  {      -5200,      41853,    -172425,     527203,   -1340474,    2991317,   -6044706,   11292464,
-     -19803994,   33021212,  -52990245,   82981775, -129288933,  207354820, -370882499, 1024155752,
-    1660281294, -440975327,  234163108, -143792049,   92028128,  -58958581,   37002000,  -22416490,
-      12948372,   -7043270,    3555889,   -1634708,     665345,    -228796,      60562 },
-  {      -5159,      41619,    -171598,     524905,   -1335028,    2979818,   -6022500,   11252524,
-     -19736132,   32910917,  -52816543,   82712372, -128867143,  206655733, -369496404, 1018431732,
-    1664872479, -440601420,  233847593, -143577263,   91887726,  -58869955,   36948443,  -22385865,
-      12932037,   -7035302,    3552443,   -1633461,     665020,    -228775,      60597 },
-  {      -5119,      41385,    -170768,     522594,   -1329545,    2968232,   -6000113,   11212235,
-     -19667644,   32799560,  -52641116,   82440259, -128441160,  205950129, -368099960, 1012705588,
-    1669447414, -440209499,  233522467, -143356587,   91743552,  -58778904,   36893356,  -22354305,
-      12915159,   -7027036,    3548844,   -1632143,     664666,    -228744,      60629 },
-  {      -5078,      41151,    -169933,     520270,   -1324027,    2956562,   -5977547,   11171600,
-     -19598533,   32687148,  -52463977,   82165451, -128011007,  205238047, -366693246, 1006977440,
-    1674005995, -439799522,  233187724, -143130020,   91595603,  -58685425,   36836736,  -22321811,
-      12897736,   -7018472,    3545093,   -1630754,     664283,    -228702,      60659 },
-  {      -5037,      40916,    -169095,     517934,   -1318472,    2944807,   -5954802,   11130621,
-     -19528805,   32573687,  -52285133,   81887963, -127576707,  204519527, -365276339, 1001247409,
-    1678548118, -439371449,  232843356, -142897561,   91443880,  -58589519,   36778585,  -22288383,
-      12879769,   -7009608,    3541190,   -1629294,     663870,    -228651,      60685 },
-  {      -4996,      40680,    -168254,     515585,   -1312883,    2932969,   -5931881,   11089301,
-     -19458463,   32459183,  -52104596,   81607810, -127138286,  203794607, -363849317,  995515614,
-    1683073682, -438925238,  232489356, -142659207,   91288381,  -58491185,   36718901,  -22254018,
-      12861257,   -7000444,    3537133,   -1627763,     663428,    -228589,      60709 },
-  {      -4955,      40444,    -167409,     513223,   -1307258,    2921047,   -5908784,   11047641,
-     -19387511,   32343642,  -51922376,   81325008, -126695766,  203063328, -362412257,  989782177,
-    1687582583, -438460847,  232125716, -142414956,   91129106,  -58390422,   36657683,  -22218718,
-      12842199,   -6990981,    3532923,   -1626161,     662957,    -228516,      60730 },
-  {      -4915,      40207,    -166561,     510849,   -1301600,    2909044,   -5885513,   11005645,
-     -19315952,   32227072,  -51738481,   81039573, -126249172,  202325730, -360965240,  984047218,
-    1692074721, -437978238,  231752431, -142164808,   90966055,  -58287231,   36594932,  -22182480,
-      12822594,   -6981217,    3528560,   -1624486,     662455,    -228434,      60748 },
-  {      -4874,      39970,    -165709,     508463,   -1295906,    2896958,   -5862069,   10963315,
-     -19243792,   32109479,  -51552924,   80751519, -125798527,  201581852, -359508342,  978310855,
-    1696549993, -437477369,  231369493, -141908762,   90799227,  -58181610,   36530646,  -22145306,
-      12802443,   -6971152,    3524043,   -1622740,     661925,    -228341,      60764 },
-  {      -4834,      39732,    -164855,     506064,   -1290179,    2884792,   -5838454,   10920653,
-     -19171034,   31990869,  -51365712,   80460862, -125343857,  200831735, -358041642,  972573210,
-    1701008299, -436958201,  230976898, -141646817,   90628622,  -58073560,   36464825,  -22107194,
-      12781745,   -6960787,    3519372,   -1620923,     661364,    -228237,      60776 },
-  {      -4793,      39494,    -163997,     503654,   -1284419,    2872546,   -5814668,   10877661,
-     -19097683,   31871248,  -51176858,   80167618, -124885185,  200075420, -356565219,  966834401,
-    1705449538, -436420696,  230574640, -141378971,   90454241,  -57963081,   36397470,  -22068144,
-      12760500,   -6950120,    3514547,   -1619033,     660773,    -228123,      60786 },
-  {      -4753,      39256,    -163136,     501233,   -1278625,    2860220,   -5790714,   10834343,
-     -19023742,   31750624,  -50986371,   79871803, -124422536,  199312946, -355079152,  961094550,
-    1709873608, -435864814,  230162713, -141105226,   90276083,  -57850172,   36328579,  -22028155,
-      12738707,   -6939151,    3509567,   -1617071,     660153,    -227999,      60793 },
-  {      -4713,      39017,    -162271,     498799,   -1272799,    2847816,   -5766593,   10790700,
-     -18949216,   31629003,  -50794261,   79573432, -123955934,  198544355, -353583520,  955353774,
-    1714280411, -435290518,  229741112, -140825581,   90094149,  -57734833,   36258153,  -21987228,
-      12716365,   -6927881,    3504432,   -1615036,     659502,    -227864,      60797 },
-  {      -4672,      38777,    -161404,     496355,   -1266940,    2835334,   -5742307,   10746735,
-     -18874108,   31506392,  -50600538,   79272521, -123485405,  197769688, -352078401,  949612195,
-    1718669846, -434697769,  229309834, -140540035,   89908439,  -57617066,   36186191,  -21945362,
-      12693475,   -6916308,    3499143,   -1612930,     658822,    -227718,      60798 },
-  {      -4632,      38537,    -160534,     493899,   -1261049,    2822774,   -5717855,   10702451,
-     -18798423,   31382796,  -50405214,   78969086, -123010972,  196988985, -350563875,  943869931,
-    1723041813, -434086531,  228868874, -140248589,   89718955,  -57496869,   36112694,  -21902557,
-      12670037,   -6904432,    3493698,   -1610750,     658111,    -227561,      60796 },
-  {      -4592,      38297,    -159661,     491432,   -1255126,    2810138,   -5693241,   10657850,
-     -18722165,   31258224,  -50208298,   78663144, -122532662,  196202287, -349040020,  938127103,
-    1727396214, -433456766,  228418228, -139951244,   89525696,  -57374244,   36037661,  -21858812,
-      12646049,   -6892254,    3488098,   -1608498,     657370,    -227394,      60791 },
-  {      -4552,      38057,    -158785,     488954,   -1249172,    2797427,   -5668465,   10612935,
-     -18645339,   31132682,  -50009801,   78354710, -122050498,  195409636, -347506917,  932383828,
-    1731732951, -432808439,  227957892, -139648000,   89328665,  -57249191,   35961093,  -21814127,
-      12621511,   -6879772,    3482343,   -1606173,     656598,    -227216,      60783 },
-  {      -4512,      37816,    -157906,     486465,   -1243187,    2784640,   -5643529,   10567707,
-     -18567948,   31006175,  -49809734,   78043800, -121564507,  194611074, -345964644,  926640227,
-    1736051923, -432141513,  227487864, -139338859,   89127861,  -57121711,   35882989,  -21768503,
-      12596424,   -6866987,    3476431,   -1603774,     655796,    -227028,      60772 },
-  {      -4473,      37574,    -157025,     483965,   -1237171,    2771780,   -5618434,   10522170,
-     -18489996,   30878713,  -49608106,   77730431, -121074713,  193806641, -344413282,  920896419,
-    1740353035, -431455953,  227008140, -139023822,   88923286,  -56991803,   35803349,  -21721938,
-      12570787,   -6853899,    3470364,   -1601303,     654964,    -226828,      60759 },
-  {      -4433,      37333,    -156140,     481455,   -1231124,    2758845,   -5593182,   10476326,
-     -18411488,   30750300,  -49404929,   77414619, -120581141,  192996379, -342852909,  915152522,
-    1744636188, -430751723,  226518719, -138702889,   88714941,  -56859470,   35722175,  -21674434,
-      12544600,   -6840507,    3464141,   -1598758,     654101,    -226618,      60742 },
-  {      -4393,      37091,    -155253,     478935,   -1225048,    2745838,   -5567774,   10430178,
-     -18332429,   30620944,  -49200213,   77096380, -120083817,  192180331, -341283606,  909408656,
-    1748901284, -430028789,  226019598, -138376063,   88502828,  -56724711,   35639466,  -21625989,
-      12517863,   -6826810,    3457761,   -1596140,     653207,    -226397,      60722 },
-  {      -4354,      36848,    -154364,     476405,   -1218942,    2732759,   -5542211,   10383728,
-     -18252822,   30490651,  -48993969,   76775731, -119582767,  191358538, -339705453,  903664939,
-    1753148227, -429287118,  225510775, -138043345,   88286949,  -56587528,   35555223,  -21576605,
-      12490575,   -6812809,    3451224,   -1593448,     652282,    -226164,      60699 },
-  {      -4314,      36606,    -153472,     473864,   -1212807,    2719609,   -5516495,   10336978,
-     -18172671,   30359429,  -48786207,   76452687, -119078015,  190531042, -338118528,  897921490,
-    1757376921, -428526674,  224992249, -137704739,   88067306,  -56447921,   35469445,  -21526280,
-      12462736,   -6798504,    3444531,   -1590683,     651327,    -225921,      60673 },
-  {      -4275,      36363,    -152577,     471314,   -1206643,    2706389,   -5490628,   10289932,
-     -18091982,   30227285,  -48576939,   76127267, -118569589,  189697885, -336522913,  892178428,
-    1761587270, -427747426,  224464019, -137360245,   87843900,  -56305893,   35382135,  -21475015,
-      12434347,   -6783894,    3437681,   -1587844,     650341,    -225667,      60644 },
-  {      -4236,      36120,    -151680,     468753,   -1200451,    2693098,   -5464610,   10242591,
-     -18010757,   30094224,  -48366174,   75799485, -118057513,  188859110, -334918688,  886435871,
-    1765779177, -426949340,  223926085, -137009866,   87616733,  -56161443,   35293291,  -21422811,
-      12405407,   -6768980,    3430674,   -1584931,     649323,    -225402,      60612 },
-  {      -4197,      35877,    -150781,     466184,   -1194230,    2679739,   -5438443,   10194959,
-     -17929002,   29960255,  -48153925,   75469360, -117541813,  188014759, -333305932,  880693936,
-    1769952548, -426132383,  223378444, -136653606,   87385808,  -56014574,   35202914,  -21369666,
-      12375916,   -6753760,    3423510,   -1581943,     648275,    -225125,      60577 },
-  {      -4158,      35633,    -149879,     463604,   -1187981,    2666311,   -5412129,   10147037,
-     -17846721,   29825384,  -47940201,   75136907, -117022516,  187164875, -331684725,  874952744,
-    1774107287, -425296525,  222821099, -136291467,   87151127,  -55865287,   35111006,  -21315583,
-      12345874,   -6738235,    3416189,   -1578882,     647195,    -224838,      60539 },
-  {      -4119,      35390,    -148975,     461016,   -1181705,    2652815,   -5385669,   10098829,
-     -17763918,   29689619,  -47725014,   74802143, -116499648,  186309501, -330055149,  869212410,
-    1778243301, -424441734,  222254049, -135923453,   86912693,  -55713583,   35017568,  -21260560,
-      12315280,   -6722405,    3408710,   -1575746,     646085,    -224539,      60498 },
-  {      -4080,      35146,    -148068,     458418,   -1175402,    2639253,   -5359065,   10050337,
-     -17680598,   29552965,  -47508375,   74465086, -115973234,  185448679, -328417284,  863473054,
-    1782360494, -423567978,  221677294, -135549567,   86670509,  -55559464,   34922598,  -21204597,
-      12284136,   -6706270,    3401073,   -1572536,     644943,    -224229,      60453 },
-  {      -4041,      34901,    -147160,     455811,   -1169072,    2625625,   -5332318,   10001563,
-     -17596764,   29415431,  -47290294,   74125752, -115443301,  184582451, -326771210,  857734794,
-    1786458774, -422675227,  221090836, -135169812,   86424576,  -55402932,   34826100,  -21147696,
-      12252441,   -6689829,    3393279,   -1569252,     643770,    -223908,      60405 },
-  {      -4003,      34657,    -146249,     453196,   -1162715,    2611932,   -5305428,    9952511,
-     -17512421,   29277023,  -47070783,   73784157, -114909876,  183710863, -325117008,  851997746,
-    1790538046, -421763451,  220494677, -134784193,   86174899,  -55243989,   34728073,  -21089857,
-      12220195,   -6673082,    3385327,   -1565893,     642565,    -223576,      60354 },
-  {      -3964,      34413,    -145337,     450571,   -1156333,    2598174,   -5278399,    9903182,
-     -17427574,   29137748,  -46849852,   73440320, -114372984,  182833955, -323454758,  846262028,
-    1794598218, -420832622,  219888817, -134392713,   85921481,  -55082635,   34628518,  -21031080,
-      12187397,   -6656030,    3377217,   -1562459,     641329,    -223232,      60300 },
-  {      -3926,      34168,    -144422,     447939,   -1149925,    2584352,   -5251231,    9853580,
-     -17342227,   28997614,  -46627513,   73094258, -113832652,  181951773, -321784541,  840527758,
-    1798639198, -419882709,  219273259, -133995378,   85664324,  -54918874,   34527438,  -20971364,
-      12154049,   -6638672,    3368948,   -1558950,     640061,    -222877,      60243 },
-  {      -3888,      33923,    -143505,     445297,   -1143491,    2570467,   -5223925,    9803707,
-     -17256385,   28856627,  -46403777,   72745986, -113288908,  181064358, -320106438,  834795053,
-    1802660893, -418913683,  218648005, -133592191,   85403432,  -54752708,   34424831,  -20910712,
-      12120150,   -6621008,    3360522,   -1555367,     638762,    -222510,      60183 },
-  {      -3850,      33679,    -142587,     442648,   -1137032,    2556520,   -5196484,    9753565,
-     -17170051,   28714794,  -46178655,   72395523, -112741776,  180171755, -318420530,  829064029,
-    1806663212, -417925518,  218013059, -133183158,   85138809,  -54584139,   34320701,  -20849123,
-      12085701,   -6603038,    3351937,   -1551708,     637431,    -222133,      60119 },
-  {      -3812,      33434,    -141666,     439990,   -1130549,    2542511,   -5168909,    9703157,
-     -17083230,   28572124,  -45952158,   72042886, -112191286,  179274007, -316726897,  823334805,
-    1810646063, -416918185,  217368423, -132768284,   84870458,  -54413168,   34215047,  -20786598,
-      12050700,   -6584762,    3343194,   -1547975,     636069,    -221743,      60052 },
-  {      -3774,      33189,    -140744,     437324,   -1124041,    2528442,   -5141200,    9652486,
-     -16995927,   28428622,  -45724298,   71688092, -111637462,  178371159, -315025621,  817607496,
-    1814609356, -415891658,  216714101, -132347573,   84598384,  -54239799,   34107872,  -20723137,
-      12015150,   -6566181,    3334293,   -1544166,     634675,    -221343,      59982 },
-  {      -3736,      32943,    -139820,     434651,   -1117509,    2514313,   -5113360,    9601554,
-     -16908146,   28284297,  -45495085,   71331158, -111080332,  177463253, -313316783,  811882219,
-    1818553000, -414845909,  216050096, -131921032,   84322590,  -54064033,   33999176,  -20658741,
-      11979049,   -6547293,    3325233,   -1540283,     633248,    -220930,      59908 },
-  {      -3699,      32698,    -138894,     431970,   -1110954,    2500124,   -5085390,    9550365,
-     -16819891,   28139154,  -45264532,   70972102, -110519924,  176550333, -311600463,  806159090,
-    1822476905, -413780912,  215376414, -131488665,   84043081,  -53885875,   33888962,  -20593411,
-      11942398,   -6528100,    3316014,   -1536324,     631790,    -220506,      59831 },
-  {      -3661,      32453,    -137966,     429281,   -1104376,    2485877,   -5057291,    9498920,
-     -16731167,   27993203,  -45032648,   70610941, -109956263,  175632445, -309876743,  800438226,
-    1826380981, -412696641,  214693057, -131050480,   83759861,  -53705325,   33777229,  -20527147,
-      11905198,   -6508600,    3306636,   -1532289,     630301,    -220071,      59751 },
-  {      -3624,      32208,    -137037,     426585,   -1097774,    2471572,   -5029065,    9447222,
-     -16641979,   27846449,  -44799446,   70247693, -109389378,  174709631, -308145704,  794719743,
-    1830265140, -411593072,  214000033, -130606482,   83472934,  -53522387,   33663981,  -20459950,
-      11867447,   -6488795,    3297100,   -1528179,     628779,    -219624,      59668 },
-  {      -3587,      31963,    -136107,     423882,   -1091150,    2457209,   -5000714,    9395274,
-     -16552330,   27698900,  -44564937,   69882376, -108819295,  173781936, -306407428,  789003756,
-    1834129292, -410470179,  213297345, -130156678,   83182306,  -53337064,   33549219,  -20391820,
-      11829148,   -6468683,    3287405,   -1523994,     627225,    -219165,      59581 },
-  {      -3550,      31717,    -135175,     421171,   -1084504,    2442791,   -4972238,    9343078,
-     -16462226,   27550563,  -44329133,   69515006, -108246043,  172849404, -304661994,  783290382,
-    1837973349, -409327939,  212584999, -129701074,   82887980,  -53149359,   33432943,  -20322760,
-      11790300,   -6448266,    3277551,   -1519733,     625639,    -218695,      59491 },
-  {      -3513,      31472,    -134241,     418454,   -1077836,    2428317,   -4943640,    9290638,
-     -16371671,   27401446,  -44092044,   69145602, -107669647,  171912081, -302909486,  777579736,
-    1841797224, -408166327,  211863002, -129239677,   82589962,  -52959275,   33315157,  -20252768,
-      11750903,   -6427543,    3267538,   -1515396,     624020,    -218213,      59397 },
-  {      -3476,      31227,    -133306,     415729,   -1071147,    2413789,   -4914920,    9237955,
-     -16280669,   27251556,  -43853683,   68774181, -107090137,  170970009, -301149983,  771871933,
-    1845600829, -406985320,  211131359, -128772495,   82288257,  -52766815,   33195861,  -20181847,
-      11710958,   -6406514,    3257367,   -1510984,     622370,    -217719,      59300 },
-  {      -3439,      30981,    -132370,     412999,   -1064436,    2399206,   -4886081,    9185033,
-     -16189225,   27100900,  -43614061,   68400761, -106507538,  170023235, -299383568,  766167088,
-    1849384077, -405784895,  210390078, -128299534,   81982870,  -52571982,   33075058,  -20109997,
-      11670464,   -6385180,    3247036,   -1506496,     620687,    -217214,      59200 },
-  {      -3403,      30736,    -131432,     410261,   -1057704,    2384570,   -4857123,    9131874,
-     -16097343,   26949485,  -43373189,   68025361, -105921879,  169071802, -297610321,  760465317,
-    1853146881, -404565031,  209639165, -127820803,   81673807,  -52374780,   32952749,  -20037219,
-      11629424,   -6363540,    3236546,   -1501932,     618973,    -216696,      59096 },
-  {      -3367,      30491,    -130493,     407517,   -1050953,    2369882,   -4828048,    9078481,
-     -16005028,   26797320,  -43131079,   67647996, -105333188,  168115755, -295830325,  754766734,
-    1856889155, -403325704,  208878628, -127336309,   81361072,  -52175212,   32828936,  -19963514,
-      11587836,   -6341595,    3225898,   -1497293,     617225,    -216167,      58989 },
-  {      -3330,      30246,    -129553,     404767,   -1044181,    2355141,   -4798858,    9024856,
-     -15912284,   26644410,  -42887743,   67268687, -104741492,  167155140, -294043660,  749071454,
-    1860610814, -402066894,  208108475, -126846060,   81044673,  -51973282,   32703622,  -19888883,
-      11545701,   -6319344,    3215090,   -1492577,     615446,    -215626,      58878 },
-  {      -3294,      30001,    -128611,     402011,   -1037389,    2340350,   -4769554,    8971002,
-     -15819117,   26490765,  -42643191,   66887450, -104146819,  166190000, -292250408,  743379590,
-    1864311772, -400788581,  207328714, -126350064,   80724614,  -51768993,   32576809,  -19813328,
-      11503020,   -6296789,    3204123,   -1487786,     613634,    -215073,      58764 },
-  {      -3258,      29756,    -127669,     399249,   -1030578,    2325509,   -4740138,    8916922,
-     -15725529,   26336390,  -42397437,   66504303, -103549197,  165220382, -290450651,  737691259,
-    1867991946, -399490743,  206539354, -125848331,   80400902,  -51562349,   32448498,  -19736848,
-      11459794,   -6273928,    3192998,   -1482918,     611789,    -214509,      58647 },
-  {      -3223,      29511,    -126725,     396482,   -1023748,    2310618,   -4710611,    8862619,
-     -15631527,   26181294,  -42150491,   66119265, -102948654,  164246330, -288644470,  732006572,
-    1871651249, -398173360,  205740402, -125340868,   80073543,  -51353354,   32318692,  -19659446,
-      11416022,   -6250763,    3181713,   -1477975,     609912,    -213932,      58526 },
-  {      -3187,      29267,    -125781,     393708,   -1016899,    2295678,   -4680974,    8808094,
-     -15537115,   26025483,  -41902365,   65732354, -102345218,  163267889, -286831947,  726325645,
-    1875289599, -396836415,  204931870, -124827684,   79742542,  -51142012,   32187393,  -19581122,
-      11371705,   -6227292,    3170269,   -1472955,     608003,    -213343,      58401 },
-  {      -3152,      29022,    -124835,     390929,   -1010032,    2280690,   -4651229,    8753351,
-     -15442296,   25868967,  -41653071,   65343587, -101738916,  162285105, -285013163,  720648590,
-    1878906912, -395479886,  204113765, -124308790,   79407907,  -50928327,   32054604,  -19501879,
-      11326844,   -6203518,    3158666,   -1467859,     606061,    -212743,      58273 },
-  {      -3116,      28778,    -123889,     388145,   -1003147,    2265655,   -4621377,    8698393,
-     -15347077,   25711750,  -41402621,   64952983, -101129777,  161298022, -283188199,  714975522,
-    1882503105, -394103757,  203286099, -123784194,   79069644,  -50712303,   31920326,  -19421716,
-      11281440,   -6179439,    3146905,   -1462688,     604086,    -212130,      58142 },
-  {      -3081,      28534,    -122942,     385355,    -996244,    2250574,   -4591421,    8643221,
-     -15251461,   25553842,  -41151026,   64560560, -100517830,  160306688, -281357138,  709306553,
-    1886078096, -392708009,  202448882, -123253905,   78727760,  -50493945,   31784563,  -19340636,
-      11235492,   -6155056,    3134984,   -1457440,     602079,    -211505,      58007 },
-  {      -3046,      28289,    -121993,     382561,    -989324,    2235447,   -4561361,    8587840,
-     -15155452,   25395250,  -40898298,   64166336,  -99903102,  159311145, -279520061,  703641796,
-    1889631802, -391292625,  201602123, -122717935,   78382262,  -50273256,   31647317,  -19258639,
-      11189003,   -6130369,    3122905,   -1452116,     600039,    -210869,      57868 },
-  {      -3011,      28046,    -121045,     379761,    -982387,    2220275,   -4531198,    8532251,
-     -15059057,   25235981,  -40644449,   63770330,  -99285621,  158311442, -277677049,  697981364,
-    1893164143, -389857588,  200745836, -122176292,   78033157,  -50050242,   31508590,  -19175727,
-      11141971,   -6105379,    3110667,   -1446715,     597966,    -210220,      57726 },
-  {      -2977,      27802,    -120095,     376957,    -975433,    2205059,   -4500935,    8476457,
-     -14962278,   25076043,  -40389491,   63372559,  -98665417,  157307622, -275828184,  692325369,
-    1896675037, -388402882,  199880029, -121628988,   77680451,  -49824906,   31368385,  -19091902,
-      11094398,   -6080085,    3098270,   -1441239,     595860,    -209559,      57581 },
-  {      -2942,      27558,    -119145,     374148,    -968463,    2189799,   -4470573,    8420461,
-     -14865121,   24915443,  -40133436,   62973043,  -98042517,  156299732, -273973548,  686673924,
-    1900164403, -386928491,  199004717, -121076032,   77324153,  -49597254,   31226705,  -19007164,
-      11046285,   -6054488,    3085714,   -1435686,     593722,    -208886,      57431 },
-  {      -2908,      27315,    -118194,     371334,    -961478,    2174496,   -4440114,    8364265,
-     -14767590,   24754189,  -39876295,   62571799,  -97416949,  155287817, -272113222,  681027140,
-    1903632161, -385434400,  198119910, -120517437,   76964270,  -49367290,   31083553,  -18921516,
-      10997632,   -6028588,    3073000,   -1430057,     591551,    -208201,      57278 },
-  {      -2874,      27072,    -117242,     368516,    -954476,    2159152,   -4409557,    8307873,
-     -14669690,   24592288,  -39618081,   62168846,  -96788743,  154271923, -270247287,  675385130,
-    1907078233, -383920593,  197225622, -119953212,   76600809,  -49135018,   30938931,  -18834959,
-      10948440,   -6002386,    3060128,   -1424352,     589347,    -207504,      57122 },
-  {      -2840,      26829,    -116290,     365694,    -947460,    2143766,   -4378907,    8251287,
-     -14571426,   24429748,  -39358805,   61764202,  -96157927,  153252097, -268375826,  669748005,
-    1910502538, -382387056,  196321865, -119383368,   76233778,  -48900445,   30792842,  -18747494,
-      10898709,   -5975882,    3047096,   -1418570,     587110,    -206794,      56962 },
-  {      -2806,      26586,    -115337,     362868,    -940429,    2128340,   -4348163,    8194509,
-     -14472802,   24266577,  -39098479,   61357887,  -95524530,  152228383, -266498919,  664115876,
-    1913904997, -380833776,  195408652, -118807919,   75863185,  -48663574,   30645290,  -18659124,
-      10848442,   -5949075,    3033907,   -1412712,     584840,    -206072,      56798 },
-  {      -2772,      26344,    -114384,     360037,    -933383,    2112874,   -4317327,    8137542,
-     -14373823,   24102782,  -38837116,   60949917,  -94888579,  151200828, -264616649,  658488855,
-    1917285534, -379260740,  194485998, -118226875,   75489039,  -48424412,   30496277,  -18569849,
-      10797637,   -5921967,    3020559,   -1406778,     582538,    -205338,      56631 },
-  {      -2739,      26102,    -113431,     357203,    -926323,    2097369,   -4286401,    8080390,
-     -14274493,   23938370,  -38574727,   60540312,  -94250104,  150169478, -262729096,  652867053,
-    1920644069, -377667934,  193553915, -117640248,   75111347,  -48182962,   30345806,  -18479671,
-      10746297,   -5894558,    3007053,   -1400768,     580202,    -204592,      56460 },
-  {      -2705,      25860,    -112477,     354365,    -919249,    2081826,   -4255386,    8023054,
-     -14174818,   23773349,  -38311324,   60129091,  -93609134,  149134379, -260836343,  647250579,
-    1923980526, -376055346,  192612420, -117048050,   74730119,  -47939232,   30193881,  -18388592,
-      10694422,   -5866848,    2993389,   -1394682,     577834,    -203834,      56285 },
-  {      -2672,      25619,    -111523,     351524,    -912161,    2066245,   -4224283,    7965537,
-     -14074801,   23607727,  -38046919,   59716272,  -92965698,  148095577, -258938471,  641639544,
-    1927294828, -374422964,  191661525, -116450294,   74345361,  -47693225,   30040504,  -18296615,
-      10642012,   -5838838,    2979567,   -1388519,     575432,    -203063,      56107 },
-  {      -2639,      25378,    -110569,     348679,    -905061,    2050628,   -4193095,    7907843,
-     -13974447,   23441512,  -37781525,   59301873,  -92319823,  147053118, -257035560,  636034059,
-    1930586899, -372770778,  190701247, -115846993,   73957084,  -47444948,   29885680,  -18203740,
-      10589070,   -5810527,    2965587,   -1382280,     572998,    -202280,      55925 },
-  {      -2606,      25137,    -109614,     345831,    -897947,    2034974,   -4161822,    7849974,
-     -13873762,   23274711,  -37515153,   58885914,  -91671540,  146007049, -255127694,  630434233,
-    1933856663, -371098777,  189731601, -115238159,   73565296,  -47194406,   29729411,  -18109970,
-      10535595,   -5781917,    2951450,   -1375965,     570530,    -201484,      55739 },
-  {      -2574,      24896,    -108660,     342980,    -890822,    2019286,   -4130467,    7791932,
-     -13772749,   23107331,  -37247816,   58468413,  -91020876,  144957415, -253214952,  624840175,
-    1937104044, -369406949,  188752602, -114623806,   73170006,  -46941605,   29571701,  -18015305,
-      10481588,   -5753007,    2937155,   -1369574,     568030,    -200676,      55550 },
-  {      -2541,      24656,    -107705,     340126,    -883684,    2003563,   -4099030,    7733720,
-     -13671413,   22939381,  -36979525,   58049388,  -90367862,  143904264, -251297417,  619251996,
-    1940328969, -367695287,  187764267, -114003947,   72771223,  -46686550,   29412553,  -17919750,
-      10427051,   -5723799,    2922702,   -1363106,     565496,    -199856,      55356 },
-  {      -2509,      24416,    -106750,     337269,    -876534,    1987806,   -4067512,    7675341,
-     -13569760,   22770867,  -36710293,   57628859,  -89712525,  142847641, -249375170,  613669804,
-    1943531362, -365963779,  186766613, -113378595,   72368957,  -46429248,   29251971,  -17823304,
-      10371985,   -5694292,    2908093,   -1356563,     562930,    -199024,      55160 },
-  {      -2477,      24177,    -105795,     334409,    -869373,    1972016,   -4035917,    7616798,
-     -13467793,   22601798,  -36440131,   57206844,  -89054896,  141787593, -247448291,  608093708,
-    1946711150, -364212419,  185759656, -112747765,   71963216,  -46169705,   29089958,  -17725971,
-      10316390,   -5664487,    2893326,   -1349943,     560330,    -198179,      54959 },
-  {      -2445,      23937,    -104840,     331547,    -862201,    1956194,   -4004244,    7558093,
-     -13365517,   22432182,  -36169052,   56783363,  -88395002,  140724166, -245516863,  602523817,
-    1949868260, -362441196,  184743414, -112111470,   71554011,  -45907926,   28926518,  -17627752,
-      10260268,   -5634384,    2878403,   -1343247,     557698,    -197321,      54755 },
-  {      -2413,      23699,    -103885,     328682,    -855018,    1940340,   -3972496,    7499229,
-     -13262938,   22262025,  -35897069,   56358433,  -87732874,  139657407, -243580966,  596960238,
-    1953002619, -360650105,  183717904, -111469724,   71141351,  -45643919,   28761655,  -17528649,
-      10203620,   -5603985,    2863322,   -1336475,     555032,    -196452,      54546 },
-  {      -2381,      23460,    -102930,     325815,    -847824,    1924456,   -3940674,    7440209,
-     -13160059,   22091336,  -35624192,   55932073,  -87068540,  138587362, -241640682,  591403080,
-    1956114154, -358839138,  182683145, -110822543,   70725246,  -45377688,   28595372,  -17428665,
-      10146446,   -5573289,    2848085,   -1329628,     552333,    -195569,      54335 },
-  {      -2350,      23222,    -101975,     322946,    -840621,    1908541,   -3908779,    7381035,
-     -13056885,   21920123,  -35350435,   55504304,  -86402029,  137514078, -239696091,  585852451,
-    1959202795, -357008289,  181639155, -110169941,   70305706,  -45109241,   28427674,  -17327802,
-      10088748,   -5542296,    2832692,   -1322704,     549601,    -194675,      54119 },
-  {      -2319,      22985,    -101021,     320075,    -833407,    1892597,   -3876813,    7321711,
-     -12953421,   21748392,  -35075809,   55075142,  -85733371,  136437602, -237747275,  580308458,
-    1962268470, -355157550,  180585952, -109511933,   69882742,  -44838584,   28258564,  -17226061,
-      10030528,   -5511008,    2817142,   -1315705,     546836,    -193767,      53899 },
-  {      -2288,      22748,    -100067,     317201,    -826185,    1876625,   -3844777,    7262238,
-     -12849673,   21576152,  -34800327,   54644608,  -85062595,  135357979, -235794316,  574771207,
-    1965311107, -353286917,  179523556, -108848533,   69456363,  -44565724,   28088046,  -17123446,
-       9971785,   -5479426,    2801437,   -1308629,     544038,    -192848,      53676 },
-  {      -2257,      22511,     -99113,     314326,    -818953,    1860625,   -3812673,    7202620,
-     -12745643,   21403410,  -34524001,   54212720,  -84389731,  134275257, -233837292,  569240807,
-    1968330638, -351396386,  178451987, -108179758,   69026581,  -44290668,   27916125,  -17019957,
-       9912521,   -5447548,    2785576,   -1301478,     541207,    -191915,      53449 },
-  {      -2226,      22275,     -98159,     311450,    -811712,    1844597,   -3780502,    7142859,
-     -12641337,   21230175,  -34246843,   53779498,  -83714806,  133189482, -231876287,  563717363,
-    1971326992, -349485950,  177371263, -107505624,   68593405,  -44013421,   27742803,  -16915599,
-       9852738,   -5415377,    2769559,   -1294252,     538342,    -190971,      53218 },
-  {      -2196,      22039,     -97206,     308571,    -804463,    1828544,   -3748267,    7082958,
-     -12536761,   21056453,  -33968866,   53344959,  -83037852,  132100702, -229911380,  558200982,
-    1974300099, -347555607,  176281407, -106826145,   68156847,  -43733991,   27568087,  -16810372,
-       9792437,   -5382912,    2753386,   -1286949,     535445,    -190013,      52983 },
-  {      -2165,      21803,     -96253,     305692,    -797206,    1812464,   -3715967,    7022920,
-     -12431917,   20882253,  -33690081,   52909124,  -82358897,  131008962, -227942653,  552691770,
-    1977249893, -345605353,  175182437, -106141339,   67716917,  -43452386,   27391979,  -16704279,
-       9731619,   -5350154,    2737059,   -1279571,     532514,    -189044,      52745 },
-  {      -2135,      21569,     -95300,     302811,    -789941,    1796360,   -3683605,    6962747,
-     -12326812,   20707581,  -33410500,   52472011,  -81677970,  129914309, -225970185,  547189832,
-    1980176304, -343635185,  174074376, -105451221,   67273627,  -43168611,   27214483,  -16597324,
-       9670285,   -5317104,    2720577,   -1272117,     529551,    -188061,      52502 },
-  {      -2105,      21334,     -94348,     299929,    -782669,    1780232,   -3651182,    6902442,
-     -12221449,   20532447,  -33130137,   52033639,  -80995101,  128816790, -223994059,  541695274,
-    1983079265, -341645100,  172957244, -104755808,   66826988,  -42882675,   27035606,  -16489507,
-       9608436,   -5283763,    2703940,   -1264588,     526554,    -187066,      52256 },
-  {      -2076,      21100,     -93397,     297046,    -775390,    1764080,   -3618699,    6842008,
-     -12115834,   20356858,  -32849004,   51594027,  -80310320,  127716453, -222014353,  536208202,
-    1985958708, -339635098,  171831064, -104055117,   66377011,  -42594584,   26855350,  -16380833,
-       9546074,   -5250131,    2687149,   -1256984,     523524,    -186059,      52006 },
-  {      -2046,      20867,     -92446,     294162,    -768103,    1747906,   -3586159,    6781448,
-     -12009971,   20180821,  -32567112,   51153195,  -79623656,  126613343, -220031150,  530728719,
-    1988814568, -337605176,  170695856, -103349165,   65923708,  -42304347,   26673720,  -16271302,
-       9483201,   -5216208,    2670203,   -1249304,     520461,    -185039,      51752 },
-  {      -2017,      20634,     -91496,     291277,    -760811,    1731709,   -3553562,    6720763,
-     -11903865,   20004343,  -32284474,   50711161,  -78935138,  125507508, -218044529,  525256930,
-    1991646778, -335555334,  169551645, -102637970,   65467090,  -42011969,   26490721,  -16160919,
-       9419817,   -5181995,    2653104,   -1241549,     517365,    -184006,      51494 },
-  {      -1988,      20402,     -90546,     288392,    -753512,    1715492,   -3520910,    6659958,
-     -11797520,   19827434,  -32001102,   50267944,  -78244795,  124398993, -216054571,  519792940,
-    1994455274, -333485572,  168398453, -101921548,   65007169,  -41717460,   26306357,  -16049685,
-       9355923,   -5147494,    2635851,   -1233719,     514237,    -182961,      51232 },
-  {      -1959,      20170,     -89597,     285506,    -746208,    1699253,   -3488205,    6599034,
-     -11690942,   19650100,  -31717008,   49823564,  -77552658,  123287848, -214061355,  514336853,
-    1997239989, -331395889,  167236302, -101199917,   64543957,  -41420826,   26120633,  -15937603,
-       9291522,   -5112704,    2618445,   -1225814,     511075,    -181903,      50966 },
-  {      -1930,      19938,     -88649,     282620,    -738898,    1682995,   -3455447,    6537994,
-     -11584134,   19472350,  -31432206,   49378039,  -76858756,  122174117, -212064963,  508888771,
-    2000000860, -329286288,  166065217, -100473096,   64077467,  -41122075,   25933554,  -15824676,
-       9226615,   -5077626,    2600886,   -1217834,     507880,    -180833,      50697 },
-  {      -1901,      19708,     -87702,     279734,    -731583,    1666718,   -3422639,    6476841,
-     -11477102,   19294191,  -31146706,   48931389,  -76163119,  121057848, -210065474,  503448799,
-    2002737822, -327156768,  164885221,  -99741102,   63607710,  -40821216,   25745124,  -15710906,
-       9161203,   -5042261,    2583174,   -1209780,     504652,    -179749,      50423 },
-  {      -1873,      19477,     -86755,     276848,    -724263,    1650423,   -3389781,    6415578,
-     -11369850,   19115630,  -30860522,   48483633,  -75465775,  119939087, -208062969,  498017039,
-    2005450814, -325007333,  163696339,  -99003954,   63134699,  -40518255,   25555348,  -15596297,
-       9095288,   -5006610,    2565309,   -1201650,     501391,    -178654,      50146 },
-  {      -1845,      19248,     -85809,     273961,    -716939,    1634110,   -3356876,    6354207,
-     -11262383,   18936676,  -30573666,   48034790,  -74766755,  118817882, -206057527,  492593593,
-    2008139771, -322837984,  162498596,  -98261671,   62658446,  -40213202,   25364232,  -15480851,
-       9028871,   -4970674,    2547293,   -1193446,     498097,    -177545,      49865 },
-  {      -1817,      19019,     -84865,     271075,    -709610,    1617780,   -3323924,    6292732,
-     -11154706,   18757336,  -30286150,   47584879,  -74066087,  117694280, -204049229,  487178565,
-    2010804631, -320648725,  161292016,  -97514271,   62178965,  -39906064,   25171779,  -15364571,
-       8961953,   -4934452,    2529124,   -1185167,     494770,    -176424,      49579 },
-  {      -1789,      18790,     -83921,     268189,    -702278,    1601434,   -3290927,    6231154,
-     -11046822,   18577618,  -29997986,   47133919,  -73363803,  116568326, -202038153,  481772056,
-    2013445334, -318439559,  160076625,  -96761773,   61696267,  -39596849,   24977996,  -15247460,
-       8894537,   -4897947,    2510805,   -1176814,     491410,    -175291,      49290 },
-  {      -1761,      18562,     -82978,     265303,    -694942,    1585072,   -3257887,    6169476,
-     -10938738,   18397530,  -29709187,   46681929,  -72659931,  115440069, -200024381,  476374167,
-    2016061817, -316210490,  158852449,  -96004198,   61210367,  -39285566,   24782887,  -15129521,
-       8826623,   -4861158,    2492333,   -1168386,     488017,    -174144,      48997 },
-  {      -1734,      18335,     -82036,     262418,    -687603,    1568696,   -3224805,    6107702,
-     -10830458,   18217079,  -29419765,   46228929,  -71954501,  114309555, -198007990,  470985001,
-    2018654021, -313961522,  157619514,  -95241563,   60721276,  -38972224,   24586458,  -15010756,
-       8758214,   -4824087,    2473711,   -1159884,     484592,    -172985,      48700 },
-  {      -1706,      18108,     -81095,     259534,    -680261,    1552305,   -3191683,    6045833,
-     -10721985,   18036274,  -29129732,   45774938,  -71247542,  113176830, -195989062,  465604657,
-    2021221885, -311692662,  156377846,  -94473890,   60229009,  -38656830,   24388713,  -14891170,
-       8689311,   -4786734,    2454939,   -1151308,     481133,    -171814,      48398 },
-  {      -1679,      17882,     -80155,     256650,    -672917,    1535902,   -3158521,    5983872,
-     -10613326,   17855121,  -28839101,   45319975,  -70539085,  112041943, -193967675,  460233237,
-    2023765349, -309403914,  155127472,  -93701197,   59733579,  -38339393,   24189657,  -14770764,
-       8619916,   -4749100,    2436016,   -1142659,     477642,    -170630,      48093 },
-  {      -1653,      17656,     -79216,     253768,    -665570,    1519485,   -3125322,    5921823,
-     -10504484,   17673629,  -28547884,   44864059,  -69829158,  110904938, -191943908,  454870841,
-    2026284356, -307095284,  153868420,  -92923506,   59234998,  -38019923,   23989297,  -14649542,
-       8550030,   -4711185,    2416944,   -1133935,     474118,    -169433,      47784 },
-  {      -1626,      17432,     -78279,     250886,    -658221,    1503057,   -3092086,    5859688,
-     -10395464,   17491806,  -28256093,   44407209,  -69117792,  109765864, -189917841,  449517569,
-    2028778846, -304766781,  152600718,  -92140836,   58733282,  -37698427,   23787638,  -14527507,
-       8479654,   -4672992,    2397722,   -1125138,     470561,    -168223,      47471 },
-  {      -1599,      17207,     -77343,     248005,    -650871,    1486618,   -3058816,    5797468,
-     -10286272,   17309658,  -27963741,   43949445,  -68405016,  108624767, -187889553,  444173521,
-    2031248762, -302418410,  151324392,  -91353209,   58228444,  -37374915,   23584684,  -14404662,
-       8408792,   -4634520,    2378351,   -1116267,     466972,    -167001,      47154 },
-  {      -1573,      16984,     -76408,     245126,    -643519,    1470168,   -3025512,    5735169,
-     -10176911,   17127195,  -27670840,   43490785,  -67690859,  107481694, -185859123,  438838795,
-    2033694047, -300050179,  150039472,  -90560645,   57720498,  -37049395,   23380442,  -14281011,
-       8337444,   -4595771,    2358831,   -1107322,     463350,    -165766,      46833 },
-  {      -1547,      16761,     -75474,     242248,    -636167,    1453708,   -2992176,    5672790,
-     -10067386,   16944423,  -27377403,   43031250,  -66975353,  106336692, -183826630,  433513491,
-    2036114644, -297662098,  148745987,  -89763165,   57209457,  -36721877,   23174917,  -14156556,
-       8265612,   -4556745,    2339163,   -1098305,     459695,    -164519,      46508 },
-  {      -1521,      16539,     -74542,     239372,    -628813,    1437239,   -2958810,    5610337,
-      -9957702,   16761351,  -27083441,   42570857,  -66258525,  105189807, -181792152,  428197707,
-    2038510496, -295254174,  147443965,  -88960790,   56695337,  -36392370,   22968114,  -14031301,
-       8193298,   -4517443,    2319347,   -1089214,     456008,    -163258,      46179 },
-  {      -1496,      16317,     -73610,     236497,    -621460,    1420762,   -2925415,    5547810,
-      -9847864,   16577985,  -26788967,   42109627,  -65540406,  104041086, -179755768,  422891541,
-    2040881549, -292826418,  146133435,  -88153543,   56178151,  -36060884,   22760040,  -13905250,
-       8120504,   -4477866,    2299384,   -1080050,     452288,    -161986,      45846 },
-  {      -1470,      16096,     -72681,     233624,    -614106,    1404277,   -2891991,    5485213,
-      -9737876,   16394334,  -26493994,   41647578,  -64821025,  102890577, -177717557,  417595092,
-    2043227747, -290378839,  144814429,  -87341444,   55657915,  -35727426,   22550700,  -13778404,
-       8047232,   -4438015,    2279273,   -1070813,     448535,    -160700,      45509 },
-  {      -1445,      15876,     -71753,     230752,    -606753,    1387785,   -2858542,    5422548,
-      -9627743,   16210406,  -26198533,   41184730,  -64100412,  101738325, -175677597,  412308457,
-    2045549037, -287911449,  143486975,  -86524516,   55134643,  -35392008,   22340100,  -13650769,
-       7973483,   -4397891,    2259016,   -1061504,     444750,    -159402,      45167 },
-  {      -1420,      15656,     -70826,     227883,    -599400,    1371287,   -2825068,    5359819,
-      -9517469,   16026208,  -25902598,   40721101,  -63378597,  100584377, -173635966,  407031733,
-    2047845363, -285424257,  142151105,  -85702782,   54608349,  -35054638,   22128246,  -13522348,
-       7899259,   -4357495,    2238612,   -1052122,     440933,    -158091,      44822 },
-  {      -1395,      15437,     -69901,     225016,    -592048,    1354783,   -2791570,    5297027,
-      -9407059,   15841748,  -25606200,   40256712,  -62655609,   99428780, -171592743,  401765016,
-    2050116673, -282917276,  140806849,  -84876262,   54079049,  -34715326,   21915143,  -13393143,
-       7824563,   -4316827,    2218063,   -1042668,     437083,    -156768,      44473 },
-  {      -1370,      15219,     -68977,     222151,    -584697,    1338274,   -2758050,    5234176,
-      -9296518,   15657033,  -25309351,   39791581,  -61931478,   98271581, -169548005,  396508404,
-    2052362915, -280390518,  139454238,  -84044981,   53546758,  -34374082,   21700798,  -13263158,
-       7749395,   -4275890,    2197368,   -1033141,     433201,    -155432,      44120 },
-  {      -1346,      15002,     -68055,     219288,    -577348,    1321761,   -2724510,    5171267,
-      -9185851,   15472072,  -25012064,   39325727,  -61206234,   97112827, -167501830,  391261992,
-    2054584035, -277843995,  138093305,  -83208960,   53011491,  -34030916,   21485217,  -13132398,
-       7673759,   -4234683,    2176528,   -1023543,     429286,    -154083,      43762 },
-  {      -1322,      14785,     -67134,     216428,    -570000,    1305245,   -2690950,    5108304,
-      -9075061,   15286872,  -24714352,   38859170,  -60479906,   95952563, -165454297,  386025876,
-    2056779983, -275277721,  136724081,  -82368224,   52473264,  -33685837,   21268406,  -13000864,
-       7597656,   -4193208,    2155544,   -1013872,     425339,    -152722,      43401 },
-  {      -1298,      14569,     -66215,     213571,    -562655,    1288726,   -2657373,    5045289,
-      -8964154,   15101440,  -24416226,   38391928,  -59752524,   94790836, -163405482,  380800152,
-    2058950708, -272691710,  135346599,  -81522795,   51932092,  -33338855,   21050371,  -12868562,
-       7521087,   -4151465,    2134415,   -1004130,     421360,    -151348,      43036 },
-  {      -1274,      14354,     -65298,     210716,    -555312,    1272204,   -2623779,    4982226,
-      -8853134,   14915785,  -24117700,   37924022,  -59024117,   93627694, -161355463,  375584914,
-    2061096159, -270085976,  133960892,  -80672696,   51387990,  -32989982,   20831118,  -12735495,
-       7444056,   -4109457,    2113143,    -994316,     417349,    -149961,      42666 },
-  {      -1250,      14140,     -64383,     207864,    -547971,    1255681,   -2590170,    4919115,
-      -8742006,   14729914,  -23818784,   37455469,  -58294714,   92463182, -159304318,  370380256,
-    2063216286, -267460534,  132566991,  -79817953,   50840975,  -32639226,   20610653,  -12601666,
-       7366564,   -4067183,    2091728,    -984431,     413306,    -148562,      42293 },
-  {      -1227,      13926,     -63469,     205014,    -540634,    1239157,   -2556547,    4855961,
-      -8630775,   14543835,  -23519492,   36986290,  -57564347,   91297347, -157252124,  365186274,
-    2065311041, -264815399,  131164932,  -78958587,   50291062,  -32286597,   20388984,  -12467079,
-       7288613,   -4024645,    2070170,    -974475,     409231,    -147151,      41915 },
-  {      -1203,      13713,     -62557,     202168,    -533300,    1222634,   -2522912,    4792765,
-      -8519444,   14357555,  -23219835,   36516503,  -56833043,   90130235, -155198957,  360003060,
-    2067380374, -262150588,  129754747,  -78094624,   49738269,  -31932108,   20166115,  -12331738,
-       7210205,   -3981843,    2048470,    -964448,     405123,    -145726,      41534 },
-  {      -1180,      13501,     -61647,     199325,    -525969,    1206110,   -2489267,    4729531,
-      -8408019,   14171082,  -22919827,   36046127,  -56100833,   88961893, -153144895,  354830709,
-    2069424238, -259466116,  128336472,  -77226089,   49182610,  -31575767,   19942055,  -12195647,
-       7131342,   -3938780,    2026628,    -954350,     400984,    -144290,      41148 },
-  {      -1157,      13289,     -60738,     196485,    -518643,    1189588,   -2455611,    4666260,
-      -8296504,   13984423,  -22619479,   35575182,  -55367747,   87792367, -151090015,  349669313,
-    2071442585, -256762002,  126910140,  -76353004,   48624102,  -31217585,   19716808,  -12058809,
-       7052027,   -3895456,    2004645,    -944182,     396813,    -142840,      40758 },
-  {      -1135,      13079,     -59832,     193648,    -511320,    1173068,   -2421948,    4602956,
-      -8184904,   13797587,  -22318803,   35103687,  -54633813,   86621703, -149034393,  344518965,
-    2073435368, -254038262,  125475786,  -75475396,   48062762,  -30857574,   19490382,  -11921228,
-       6972261,   -3851872,    1982521,    -933943,     392611,    -141378,      40364 },
-  {      -1112,      12869,     -58927,     190815,    -504002,    1156550,   -2388278,    4539621,
-      -8073224,   13610581,  -22017812,   34631661,  -53899061,   85449948, -146978105,  339379757,
-    2075402541, -251294915,  124033446,  -74593290,   47498606,  -30495743,   19262784,  -11782909,
-       6892048,   -3808029,    1960257,    -923634,     388376,    -139904,      39966 },
-  {      -1090,      12660,     -58025,     187986,    -496689,    1140036,   -2354603,    4476258,
-      -7961467,   13423413,  -21716518,   34159122,  -53163520,   84277148, -144921228,  334251781,
-    2077344058, -248531980,  122583155,  -73706710,   46931652,  -30132104,   19034020,  -11643856,
-       6811387,   -3763929,    1937854,    -913256,     384110,    -138417,      39564 },
-  {      -1068,      12451,     -57124,     185160,    -489381,    1123526,   -2320923,    4412869,
-      -7849638,   13236090,  -21414934,   33686091,  -52427221,   83103348, -142863839,  329135129,
-    2079259875, -245749476,  121124949,  -72815683,   46361915,  -29766667,   18804097,  -11504071,
-       6730284,   -3719572,    1915311,    -902807,     379812,    -136917,      39158 },
-  {      -1046,      12244,     -56226,     182338,    -482078,    1107020,   -2287241,    4349457,
-      -7737743,   13048619,  -21113071,   33212585,  -51690192,   81928596, -140806012,  324029892,
-    2081149946, -242947422,  119658865,  -71920233,   45789414,  -29399443,   18573022,  -11363560,
-       6648738,   -3674960,    1892629,    -892289,     375483,    -135405,      38748 },
-  {      -1024,      12037,     -55329,     179520,    -474781,    1090519,   -2253558,    4286024,
-      -7625785,   12861009,  -20810941,   32738625,  -50952463,   80752936, -138747824,  318936160,
-    2083014227, -240125839,  118184939,  -71020386,   45214165,  -29030444,   18340801,  -11222326,
-       6566753,   -3630093,    1869810,    -881702,     371122,    -133880,      38334 },
-  {      -1003,      11831,     -54435,     176705,    -467489,    1074025,   -2219874,    4222574,
-      -7513769,   12673267,  -20508557,   32264229,  -50214063,   79576416, -136689351,  313854024,
-    2084852676, -237284748,  116703208,  -70116170,   44636186,  -28659681,   18107442,  -11080373,
-       6484331,   -3584974,    1846853,    -871045,     366730,    -132343,      37915 },
-  {       -982,      11626,     -53543,     173895,    -460204,    1057537,   -2186193,    4159107,
-      -7401700,   12485401,  -20205931,   31789415,  -49475022,   78399081, -134630668,  308783574,
-    2086665250, -234424171,  115213710,  -69207609,   44055494,  -28287164,   17872951,  -10937706,
-       6401474,   -3539603,    1823759,    -860320,     362306,    -130794,      37493 },
-  {       -961,      11422,     -52653,     171089,    -452926,    1041056,   -2152514,    4095628,
-      -7289582,   12297418,  -19903076,   31314204,  -48735369,   77220976, -132571850,  303724899,
-    2088451906, -231544129,  113716483,  -68294731,   43472106,  -27912905,   17637335,  -10794329,
-       6318185,   -3493981,    1800529,    -849526,     357852,    -129232,      37066 },
-  {       -940,      11219,     -51765,     168288,    -445654,    1024583,   -2118839,    4032139,
-      -7177420,   12109325,  -19600002,   30838614,  -47995133,   76042149, -130512973,  298678087,
-    2090212602, -228644645,  112211564,  -67377562,   42886041,  -27536916,   17400603,  -10650246,
-       6234465,   -3448109,    1777163,    -838663,     353366,    -127658,      36636 },
-  {       -919,      11016,     -50879,     165491,    -438389,    1008118,   -2085169,    3968642,
-      -7065217,   11921131,  -19296723,   30362664,  -47254344,   74862644, -128454111,  293643229,
-    2091947299, -225725743,  110698992,  -66456129,   42297316,  -27159208,   17162760,  -10505461,
-       6150318,   -3401990,    1753661,    -827733,     348849,    -126071,      36201 },
-  {       -899,      10815,     -49995,     162698,    -431131,     991663,   -2051507,    3905139,
-      -6952980,   11732842,  -18993251,   29886373,  -46513030,   73682507, -126395340,  288620412,
-    2093655956, -222787445,  109178806,  -65530460,   41705949,  -26779793,   16923814,  -10359978,
-       6065745,   -3355623,    1730025,    -816735,     344301,    -124472,      35762 },
-  {       -879,      10614,     -49114,     159910,    -423881,     975217,   -2017852,    3841634,
-      -6840711,   11544467,  -18689597,   29409760,  -45771221,   72501784, -124336734,  283609724,
-    2095338532, -219829776,  107651045,  -64600581,   41111959,  -26398682,   16683772,  -10213803,
-       5980750,   -3309011,    1706255,    -805668,     339722,    -122860,      35319 },
-  {       -859,      10414,     -48235,     157127,    -416639,     958782,   -1984207,    3778129,
-      -6728416,   11356013,  -18385774,   28932843,  -45028947,   71320521, -122278367,  278611252,
-    2096994989, -216852761,  106115748,  -63666520,   40515364,  -26015887,   16442641,  -10066938,
-       5895334,   -3262155,    1682352,    -794535,     335112,    -121236,      34872 },
-  {       -839,      10215,     -47358,     154349,    -409406,     942358,   -1950573,    3714626,
-      -6616100,   11167487,  -18081794,   28455643,  -44286236,   70138763, -120220314,  273625084,
-    2098625289, -213856425,  104572956,  -62728305,   39916181,  -25631421,   16200430,   -9919389,
-       5809500,   -3215055,    1658315,    -783334,     330472,    -119600,      34421 },
-  {       -819,      10016,     -46484,     151575,    -402180,     925946,   -1916952,    3651127,
-      -6503765,   10978897,  -17777669,   27978177,  -43543117,   68956555, -118162649,  268651306,
-    2100229392, -210840793,  103022708,  -61785964,   39314430,  -25245294,   15957145,   -9771159,
-       5723250,   -3167714,    1634146,    -772067,     325801,    -117952,      33966 },
-  {       -800,       9819,     -45612,     148807,    -394964,     909546,   -1883343,    3587636,
-      -6391418,   10790250,  -17473411,   27500464,  -42799620,   67773944, -116105447,  263690004,
-    2101807263, -207805893,  101465046,  -60839525,   38710129,  -24857519,   15712794,   -9622254,
-       5636587,   -3120132,    1609846,    -760732,     321099,    -116291,      33507 },
-  {       -780,       9622,     -44743,     146043,    -387756,     893160,   -1849749,    3524155,
-      -6279062,   10601555,  -17169032,   27022523,  -42055773,   66590973, -114048779,  258741265,
-    2103358864, -204751752,   99900010,  -59889016,   38103297,  -24468108,   15467384,   -9472678,
-       5549513,   -3072310,    1585415,    -749332,     316367,    -114618,      33044 },
-  {       -761,       9427,     -43876,     143285,    -380558,     876786,   -1816172,    3460687,
-      -6166702,   10412817,  -16864544,   26544374,  -41311606,   65407689, -111992721,  253805172,
-    2104884159, -201678396,   98327641,  -58934467,   37493953,  -24077073,   15220923,   -9322436,
-       5462032,   -3024251,    1560853,    -737865,     311604,    -112932,      32576 },
-  {       -742,       9232,     -43011,     140533,    -373369,     860428,   -1782612,    3397233,
-      -6054343,   10224045,  -16559958,   26066034,  -40567148,   64224137, -109937346,  248881812,
-    2106383112, -198585854,   96747981,  -57975905,   36882115,  -23684427,   14973419,   -9171531,
-       5374145,   -2975956,    1536161,    -726332,     306812,    -111235,      32105 },
-  {       -724,       9038,     -42149,     137786,    -366190,     844084,   -1749070,    3333797,
-      -5941988,   10035247,  -16255288,   25587523,  -39822427,   63040362, -107882726,  243971269,
-    2107855690, -195474154,   95161072,  -57013359,   36267804,  -23290181,   14724879,   -9019969,
-       5285855,   -2927425,    1511341,    -714734,     301989,    -109525,      31629 },
-  {       -705,       8845,     -41290,     135044,    -359021,     827755,   -1715549,    3270380,
-      -5829642,    9846429,  -15950545,   25108859,  -39077472,   61856409, -105828936,  239073627,
-    2109301856, -192343325,   93566957,  -56046860,   35651038,  -22894349,   14475312,   -8867754,
-       5197165,   -2878660,    1486392,    -703071,     297135,    -107803,      31149 },
-  {       -687,       8653,     -40433,     132308,    -351862,     811443,   -1682049,    3206986,
-      -5717310,    9657598,  -15645741,   24630061,  -38332313,   60672322, -103776046,  234188969,
-    2110721579, -189193398,   91965677,  -55076436,   35031837,  -22496943,   14224724,   -8714890,
-       5108078,   -2829663,    1461315,    -691342,     292252,    -106069,      30666 },
-  {       -669,       8462,     -39578,     129578,    -344714,     795148,   -1648572,    3143616,
-      -5604996,    9468764,  -15340887,   24151148,  -37586978,   59488148, -101724131,  229317379,
-    2112114824, -186024402,   90357277,  -54102116,   34410219,  -22097975,   13973124,   -8561384,
-       5018595,   -2780435,    1436111,    -679549,     287339,    -104323,      30178 },
-  {       -651,       8272,     -38727,     126853,    -337577,     778869,   -1615118,    3080274,
-      -5492704,    9279932,  -15035996,   23672137,  -36841495,   58303930,  -99673263,  224458939,
-    2113481560, -182836369,   88741798,  -53123931,   33786206,  -21697458,   13720519,   -8407239,
-       4928720,   -2730977,    1410780,    -667691,     282396,    -102564,      29686 },
-  {       -634,       8083,     -37877,     124134,    -330451,     762609,   -1581690,    3016961,
-      -5380439,    9091110,  -14731080,   23193049,  -36095894,   57119713,  -97623513,  219613732,
-    2114821754, -179629328,   87119286,  -52141911,   33159817,  -21295405,   13466919,   -8252459,
-       4838456,   -2681291,    1385324,    -655769,     277424,    -100794,      29190 },
-  {       -616,       7894,     -37031,     121422,    -323336,     746368,   -1548288,    2953681,
-      -5268205,    8902306,  -14426151,   22713901,  -35350204,   55935542,  -95574954,  214781840,
-    2116135376, -176403313,   85489784,  -51156085,   32531071,  -20891829,   13212330,   -8097051,
-       4747805,   -2631378,    1359743,    -643783,     272422,     -99012,      28690 },
-  {       -599,       7707,     -36187,     118716,    -316233,     730146,   -1514914,    2890435,
-      -5156006,    8713526,  -14121219,   22234712,  -34604452,   54751461,  -93527657,  209963344,
-    2117422394, -173158356,   83853337,  -50166485,   31899988,  -20486742,   12956761,   -7941018,
-       4656769,   -2581240,    1334037,    -631734,     267390,     -97217,      28185 },
-  {       -582,       7520,     -35346,     116015,    -309142,     713943,   -1481569,    2827226,
-      -5043847,    8524779,  -13816298,   21755501,  -33858668,   53567516,  -91481695,  205158325,
-    2118682778, -169894489,   82209988,  -49173140,   31266590,  -20080158,   12700219,   -7784366,
-       4565352,   -2530878,    1308208,    -619621,     262329,     -95411,      27677 },
-  {       -565,       7335,     -34508,     113321,    -302063,     697761,   -1448254,    2764056,
-      -4931733,    8336071,  -13511399,   21276285,  -33112880,   52383750,  -89437138,  200366864,
-    2119916500, -166611747,   80559784,  -48176082,   30630895,  -19672089,   12442714,   -7627099,
-       4473557,   -2480293,    1282256,    -607446,     257239,     -93592,      27165 },
-  {       -548,       7150,     -33672,     110634,    -294997,     681601,   -1414970,    2700928,
-      -4819666,    8147410,  -13206533,   20797084,  -32367116,   51200207,  -87394058,  195589041,
-    2121123531, -163310163,   78902770,  -47175341,   29992925,  -19262550,   12184254,   -7469223,
-       4381386,   -2429488,    1256181,    -595207,     252120,     -91762,      26649 },
-  {       -532,       6966,     -32840,     107953,    -287943,     665461,   -1381720,    2637845,
-      -4707652,    7958803,  -12901713,   20317916,  -31621405,   50016933,  -85352525,  190824935,
-    2122303842, -159989771,   77238990,  -46170948,   29352700,  -18851553,   11924846,   -7310742,
-       4288842,   -2378463,    1229986,    -582907,     246971,     -89920,      26128 },
-  {       -516,       6783,     -32010,     105278,    -280902,     649344,   -1348503,    2574808,
-      -4595696,    7770257,  -12596950,   19838799,  -30875776,   48833970,  -83312611,  186074626,
-    2123457406, -156650607,   75568493,  -45162935,   28710241,  -18439111,   11664499,   -7151662,
-       4195927,   -2327220,    1203669,    -570544,     241794,     -88066,      25604 },
-  {       -499,       6601,     -31183,     102611,    -273875,     633250,   -1315322,    2511820,
-      -4483800,    7581779,  -12292256,   19359752,  -30130256,   47651363,  -81274386,  181338192,
-    2124584196, -153292707,   73891323,  -44151334,   28065568,  -18025238,   11403221,   -6991987,
-       4102646,   -2275761,    1177232,    -558120,     236588,     -86200,      25075 },
-  {       -484,       6421,     -30358,      99950,    -266860,     617179,   -1282178,    2448884,
-      -4371970,    7393378,  -11987643,   18880792,  -29384875,   46469156,  -79237919,  176615712,
-    2125684186, -149916107,   72207528,  -43136176,   27418702,  -17609948,   11141021,   -6831722,
-       4009000,   -2224087,    1150676,    -545634,     231353,     -84322,      24543 },
-  {       -468,       6241,     -29537,      97295,    -259860,     601133,   -1249071,    2386002,
-      -4260210,    7205059,  -11683122,   18401939,  -28639659,   45287394,  -77203282,  171907264,
-    2126757350, -146520843,   70517154,  -42117492,   26769665,  -17193253,   10877908,   -6670874,
-       3914992,   -2172199,    1124001,    -533087,     226090,     -82433,      24006 },
-  {       -452,       6062,     -28719,      94648,    -252873,     585111,   -1216003,    2323175,
-      -4148524,    7016830,  -11378705,   17923210,  -27894638,   44106118,  -75170544,  167212925,
-    2127803664, -143106953,   68820250,  -41095316,   26118477,  -16775169,   10613890,   -6509446,
-       3820627,   -2120100,    1097209,    -520479,     220798,     -80531,      23465 },
-  {       -437,       5884,     -27903,      92008,    -245901,     569114,   -1182975,    2260407,
-      -4036916,    6828699,  -11074403,   17444625,  -27149840,   42925374,  -73139775,  162532772,
-    2128823102, -139674474,   67116863,  -40069680,   25465160,  -16355707,   10348975,   -6347443,
-       3725905,   -2067791,    1070299,    -507811,     215478,     -78619,      22921 },
-  {       -422,       5707,     -27091,      89375,    -238943,     553143,   -1149989,    2197701,
-      -3925391,    6640672,  -10770229,   16966199,  -26405292,   41745204,  -71111044,  157866881,
-    2129815641, -136223446,   65407040,  -39040615,   24809735,  -15934883,   10083172,   -6184873,
-       3630831,   -2015273,    1043274,    -495083,     210129,     -76694,      22372 },
-  {       -407,       5531,     -26282,      86749,    -231999,     537198,   -1117046,    2135057,
-      -3813952,    6452756,  -10466193,   16487953,  -25661023,   40565652,  -69084421,  153215328,
-    2130781258, -132753906,   63690831,  -38008155,   24152223,  -15512709,    9816490,   -6021738,
-       3535407,   -1962548,    1016133,    -482295,     204753,     -74758,      21819 },
-  {       -392,       5355,     -25475,      84130,    -225071,     521280,   -1084146,    2072479,
-      -3702605,    6264960,  -10162307,   16009905,  -24917060,   39386762,  -67059973,  148578190,
-    2131719931, -129265895,   61968284,  -36972332,   23492647,  -15089201,    9548938,   -5858045,
-       3439637,   -1909617,     988877,    -469448,     199348,     -72810,      21262 },
-  {       -378,       5181,     -24672,      81519,    -218158,     505389,   -1051292,    2009969,
-      -3591352,    6077289,   -9858583,   15532071,  -24173432,   38208577,  -65037771,  143955541,
-    2132631636, -125759453,   60239449,  -35933179,   22831027,  -14664371,    9280524,   -5693799,
-       3343523,   -1856483,     961507,    -456542,     193916,     -70851,      20702 },
-  {       -363,       5008,     -23871,      78915,    -211260,     489527,   -1018483,    1947529,
-      -3480199,    5889751,   -9555033,   15054471,  -23430166,   37031139,  -63017882,  139347456,
-    2133516355, -122234619,   58504374,  -34890731,   22167386,  -14238235,    9011258,   -5529006,
-       3247068,   -1803147,     934024,    -443577,     188456,     -68880,      20137 },
-  {       -349,       4836,     -23074,      76319,    -204377,     473693,    -985723,    1885162,
-      -3369150,    5702353,   -9251667,   14577121,  -22687291,   35854493,  -61000375,  134754009,
-    2134374064, -118691435,   56763109,  -33845019,   21501746,  -13810806,    8741148,   -5363670,
-       3150276,   -1749610,     906429,    -430554,     182969,     -66897,      19568 },
-  {       -335,       4665,     -22280,      73731,    -197511,     457889,    -953011,    1822869,
-      -3258207,    5515102,   -8948497,   14100041,  -21944833,   34678680,  -58985318,  130175273,
-    2135204746, -115129943,   55015705,  -32796078,   20834128,  -13382098,    8470202,   -5197797,
-       3053150,   -1695874,     878723,    -417473,     177454,     -64904,      18995 },
-  {       -321,       4495,     -21489,      71150,    -190661,     442114,    -920349,    1760654,
-      -3147377,    5328005,   -8645534,   13623248,  -21202820,   33503743,  -56972778,  125611322,
-    2136008379, -111550184,   53262211,  -31743941,   20164555,  -12952127,    8198432,   -5031393,
-       2955692,   -1641941,     850906,    -404334,     171912,     -62899,      18419 },
-  {       -308,       4325,     -20701,      68576,    -183827,     426370,    -887738,    1698518,
-      -3036663,    5141069,   -8342790,   13146760,  -20461281,   32329726,  -54962824,  121062229,
-    2136784946, -107952202,   51502679,  -30688643,   19493049,  -12520905,    7925844,   -4864462,
-       2857907,   -1587812,     822979,    -391138,     166343,     -60882,      17838 },
-  {       -294,       4157,     -19916,      66011,    -177009,     410656,    -855179,    1636464,
-      -2926068,    4954301,   -8040277,   12670595,  -19720242,   31156670,  -52955522,  116528065,
-    2137534429, -104336040,   49737160,  -29630217,   18819633,  -12088448,    7652448,   -4697011,
-       2759796,   -1533489,     794942,    -377885,     160746,     -58854,      17253 },
-  {       -281,       3990,     -19135,      63454,    -170209,     394974,    -822674,    1574494,
-      -2815598,    4767708,   -7738005,   12194771,  -18979731,   29984619,  -50950939,  112008904,
-    2138256809, -100701741,   47965704,  -28568698,   18144329,  -11654771,    7378255,   -4529046,
-       2661363,   -1478975,     766798,    -364576,     155123,     -56815,      16665 },
-  {       -268,       3824,     -18357,      60905,    -163425,     379324,    -790223,    1512611,
-      -2705256,    4581297,   -7435986,   11719304,  -18239775,   28813615,  -48949143,  107504815,
-    2138952071,  -97049350,   46188364,  -27504121,   17467159,  -11219887,    7103271,   -4360570,
-       2562612,   -1424270,     738547,    -351210,     149473,     -54765,      16072 },
-  {       -255,       3659,     -17582,      58363,    -156659,     363706,    -757828,    1450816,
-      -2595046,    4395074,   -7134230,   11244214,  -17500402,   27643699,  -46950199,  103015870,
-    2139620197,  -93378911,   44405192,  -26436519,   16788147,  -10783812,    6827508,   -4191591,
-       2463546,   -1369376,     710189,    -337789,     143797,     -52703,      15476 },
-  {       -243,       3494,     -16810,      55830,    -149910,     348121,    -725490,    1389111,
-      -2484972,    4209048,   -6832750,   10769517,  -16761639,   26474914,  -44954175,   98542140,
-    2140261173,  -89690470,   42616239,  -25365928,   16107315,  -10346561,    6550974,   -4022114,
-       2364167,   -1314295,     681726,    -324312,     138094,     -50631,      14875 },
-  {       -230,       3331,     -16041,      53306,    -143178,     332570,    -693210,    1327500,
-      -2375038,    4023224,   -6531557,   10295232,  -16023513,   25307302,  -42961136,   94083693,
-    2140874983,  -85984073,   40821559,  -24292383,   15424686,   -9908147,    6273678,   -3852144,
-       2264479,   -1259029,     653157,    -310780,     132365,     -48547,      14271 },
-  {       -218,       3169,     -15276,      50789,    -136465,     317053,    -660989,    1265984,
-      -2265249,    3837609,   -6230661,    9821375,  -15286052,   24140905,  -40971148,   89640600,
-    2141461613,  -82259766,   39021205,  -23215919,   14740283,   -9468587,    5995631,   -3681687,
-       2164486,   -1203580,     624485,    -297194,     126610,     -46452,      13662 },
-  {       -206,       3008,     -14514,      48281,    -129770,     301571,    -628828,    1204565,
-      -2155609,    3652211,   -5930074,    9347964,  -14549281,   22975765,  -38984277,   85212929,
-    2142021049,  -78517597,   37215229,  -22136572,   14054129,   -9027895,    5716840,   -3510749,
-       2064190,   -1147949,     595710,    -283554,     120829,     -44347,      13050 },
-  {       -194,       2848,     -13756,      45782,    -123093,     286124,    -596729,    1143246,
-      -2046120,    3467036,   -5629806,    8875018,  -13813229,   21811922,  -37000587,   80800749,
-    2142553278,  -74757612,   35403685,  -21054376,   13366248,   -8586085,    5437317,   -3339336,
-       1963595,   -1092138,     566833,    -269860,     115022,     -42230,      12434 },
-  {       -182,       2689,     -13000,      43291,    -116435,     270713,    -564693,    1082029,
-      -1936788,    3282090,   -5329870,    8402552,  -13077922,   20649420,  -35020145,   76404128,
-    2143058289,  -70979859,   33586628,  -19969368,   12676663,   -8143174,    5157070,   -3167453,
-       1862705,   -1036148,     537855,    -256112,     109189,     -40102,      11814 },
-  {       -170,       2530,     -12248,      40808,    -109795,     255338,    -532720,    1020916,
-      -1827617,    3097382,   -5030275,    7930585,  -12343387,   19488299,  -33043014,   72023133,
-    2143536068,  -67184388,   31764111,  -18881583,   11985398,   -7699177,    4876108,   -2995106,
-       1761522,    -979983,     508776,    -242311,     103331,     -37964,      11190 },
-  {       -159,       2373,     -11500,      38335,    -103175,     239999,    -500813,     959910,
-      -1718609,    2912917,   -4731034,    7459134,  -11609650,   18328599,  -31069260,   67657832,
-    2143986605,  -63371247,   29936188,  -17791058,   11292475,   -7254108,    4594443,   -2822301,
-       1660049,    -923643,     479598,    -228458,      97448,     -35815,      10562 },
-  {       -148,       2217,     -10755,      35870,     -96573,     224698,    -468971,     899012,
-      -1609770,    2728702,   -4432156,    6988216,  -10876739,   17170364,  -29098946,   63308290,
-    2144409890,  -59540487,   28102916,  -16697829,   10597920,   -6807983,    4312082,   -2649044,
-       1558292,    -867130,     450322,    -214553,      91539,     -33655,       9931 },
-  {       -137,       2062,     -10013,      33414,     -89992,     209435,    -437196,     838224,
-      -1501103,    2544744,   -4133653,    6517848,  -10144680,   16013633,  -27132137,   58974573,
-    2144805912,  -55692156,   26264348,  -15601931,    9901754,   -6360817,    4029037,   -2475340,
-       1456252,    -810447,     420948,    -200596,      85605,     -31484,       9295 },
-  {       -126,       1908,      -9275,      30967,     -83429,     194210,    -405490,     777549,
-      -1392612,    2361049,   -3835536,    6048048,   -9413499,   14858447,  -25168896,   54656748,
-    2145174663,  -51826306,   24420541,  -14503403,    9204003,   -5912626,    3745316,   -2301196,
-       1353933,    -753595,     391477,    -186587,      79647,     -29303,       8656 },
-  {       -115,       1755,      -8540,      28529,     -76887,     179024,    -373852,     716989,
-      -1284301,    2177625,   -3537815,    5578832,   -8683223,   13704847,  -23209287,   50354879,
-    2145516133,  -47942988,   22571549,  -13402279,    8504691,   -5463425,    3460929,   -2126618,
-       1251338,    -696575,     361911,    -172528,      73663,     -27111,       8013 },
-  {       -104,       1603,      -7809,      26100,     -70365,     163877,    -342285,     656546,
-      -1176174,    1994478,   -3240501,    5110218,   -7953879,   12552874,  -21253374,   46069030,
-    2145830315,  -44042253,   20717430,  -12298598,    7803841,   -5013231,    3175887,   -1951612,
-       1148472,    -639390,     332250,    -158418,      67656,     -24908,       7366 },
-  {        -94,       1452,      -7081,      23680,     -63863,     148770,    -310790,     596223,
-      -1068235,    1811614,   -2943606,    4642223,   -7225491,   11402568,  -19301218,   41799266,
-    2146117201,  -40124154,   18858239,  -11192397,    7101477,   -4562058,    2890199,   -1776183,
-       1045337,    -582042,     302495,    -144258,      61623,     -22695,       6715 },
-  {        -84,       1302,      -6357,      21270,     -57381,     133704,    -279367,     536020,
-       -960486,    1629040,   -2647140,    4174863,   -6498088,   10253969,  -17352882,   37545650,
-    2146376785,  -36188744,   16994033,  -10083711,    6397625,   -4109922,    2603875,   -1600337,
-        941938,    -524533,     272648,    -130048,      55567,     -20472,       6060 },
-  {        -74,       1154,      -5637,      18869,     -50920,     118678,    -248018,     475941,
-       -852934,    1446762,   -2351113,    3708156,   -5771694,    9107118,  -15408430,   33308246,
-    2146609061,  -32236076,   15124869,   -8972580,    5692308,   -3656839,    2316925,   -1424081,
-        838276,    -466864,     242708,    -115789,      49487,     -18238,       5402 },
-  {        -64,       1006,      -4919,      16477,     -44480,     103693,    -216743,     415987,
-       -745580,    1264788,   -2055537,    3242118,   -5046336,    7962054,  -13467923,   29087114,
-    2146814023,  -28266203,   13250804,   -7859040,    4985550,   -3202825,    2029359,   -1247421,
-        734357,    -409037,     212677,    -101482,      43382,     -15994,       4740 },
-  {        -54,        859,      -4206,      14094,     -38061,      88751,    -185544,     356161,
-       -638430,    1083123,   -1760421,    2776767,   -4322040,    6818819,  -11531423,   24882319,
-    2146991666,  -24279180,   11371896,   -6743128,    4277377,   -2747896,    1741187,   -1070363,
-        630184,    -351055,     182557,     -87126,      37255,     -13739,       4074 },
-  {        -45,        713,      -3496,      11721,     -31663,      73850,    -154422,     296465,
-       -531486,     901775,   -1465777,    2312118,   -3598831,    5677450,   -9598992,   20693920,
-    2147141986,  -20275062,    9488202,   -5624884,    3567813,   -2292067,    1452419,    -892913,
-        525759,    -292918,     152348,     -72722,      31103,     -11474,       3404 },
-  {        -36,        568,      -2789,       9357,     -25287,      58993,    -123378,     236900,
-       -424753,     720749,   -1171616,    1848189,   -2876736,    4537989,   -7670691,   16521980,
-    2147264981,  -16253904,    7599782,   -4504345,    2856883,   -1835356,    1163066,    -715077,
-        421087,    -234630,     122050,     -58270,      24928,      -9200,       2731 },
-  {        -26,        425,      -2087,       7003,     -18932,      44179,     -92413,     177470,
-       -318234,     540052,    -877947,    1384996,   -2155779,    3400474,   -5746580,   12366558,
-    2147360646,  -12215763,    5706692,   -3381548,    2144612,   -1377777,     873137,    -536862,
-        316172,    -176193,      91666,     -43772,      18731,      -6915,       2054 },
-  {        -17,        282,      -1387,       4659,     -12599,      29408,     -61527,     118175,
-       -211933,     359691,    -584781,     922556,   -1435988,    2264944,   -3826721,    8227714,
-    2147428980,   -8160693,    3808993,   -2256533,    1431024,    -919347,     582643,    -358273,
-        211017,    -117607,      61195,     -29227,      12510,      -4620,       1373 },
-  {         -9,        141,       -692,       2325,      -6289,      14682,     -30723,      59017,
-       -105854,     179671,    -292128,     460885,    -717386,    1131440,   -1911174,    4105509,
-    2147469981,   -4088753,    1906742,   -1129337,     716145,    -460083,     291594,    -179317,
-        105625,     -58875,      30640,     -14637,       6266,      -2315,        688 },
-
-  },
-
-  .d = {
-
-  {     -1,      3,     -9,     24,    -57,    120,   -230,    413,   -700,   1139,
-     -1797,   2797,  -4411,   7448, -15972,    -53,  16037,  -7466,   4420,  -2802,
-      1800,  -1141,    702,   -413,    231,   -120,     57,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -57,    119,   -229,    412,   -699,   1137,
-     -1794,   2792,  -4403,   7431, -15906,   -160,  16102,  -7483,   4428,  -2807,
-      1803,  -1143,    703,   -414,    231,   -120,     58,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -57,    119,   -229,    411,   -698,   1135,
-     -1791,   2787,  -4395,   7413, -15840,   -267,  16167,  -7499,   4436,  -2812,
-      1806,  -1145,    705,   -415,    232,   -121,     58,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -57,    119,   -228,    410,   -696,   1133,
-     -1787,   2782,  -4386,   7395, -15774,   -374,  16232,  -7516,   4443,  -2816,
-      1809,  -1147,    706,   -416,    232,   -121,     58,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -56,    118,   -228,    409,   -695,   1130,
-     -1784,   2777,  -4377,   7377, -15708,   -480,  16297,  -7532,   4451,  -2821,
-      1812,  -1149,    707,   -417,    233,   -121,     58,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -56,    118,   -227,    408,   -693,   1128,
-     -1781,   2772,  -4368,   7358, -15641,   -587,  16361,  -7549,   4458,  -2825,
-      1815,  -1151,    708,   -418,    233,   -122,     58,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -56,    118,   -226,    407,   -692,   1126,
-     -1777,   2766,  -4359,   7339, -15574,   -694,  16425,  -7564,   4466,  -2829,
-      1818,  -1153,    710,   -419,    234,   -122,     58,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -56,    117,   -226,    406,   -690,   1123,
-     -1773,   2761,  -4350,   7321, -15507,   -801,  16489,  -7580,   4473,  -2833,
-      1820,  -1155,    711,   -419,    234,   -122,     59,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -56,    117,   -225,    405,   -688,   1121,
-     -1770,   2755,  -4340,   7301, -15440,   -907,  16552,  -7596,   4480,  -2837,
-      1823,  -1156,    712,   -420,    235,   -122,     59,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -56,    117,   -225,    404,   -687,   1118,
-     -1766,   2749,  -4331,   7282, -15373,  -1014,  16616,  -7611,   4487,  -2841,
-      1826,  -1158,    713,   -421,    235,   -123,     59,    -25,      9,     -3,  1 },
-  {     -1,      3,     -9,     24,    -55,    116,   -224,    403,   -685,   1116,
-     -1762,   2744,  -4321,   7262, -15305,  -1121,  16679,  -7626,   4493,  -2845,
-      1828,  -1160,    714,   -422,    236,   -123,     59,    -25,      9,     -3,  1 },
-  {      0,      3,     -9,     23,    -55,    116,   -223,    402,   -684,   1113,
-     -1759,   2738,  -4311,   7243, -15237,  -1227,  16742,  -7640,   4500,  -2849,
-      1831,  -1161,    715,   -422,    236,   -123,     59,    -25,      9,     -3,  1 },
-  {      0,      3,     -9,     23,    -55,    115,   -223,    401,   -682,   1111,
-     -1755,   2732,  -4301,   7223, -15169,  -1334,  16804,  -7655,   4506,  -2853,
-      1833,  -1163,    717,   -423,    237,   -124,     59,    -26,     10,     -3,  1 },
-  {      0,      2,     -9,     23,    -55,    115,   -222,    400,   -680,   1108,
-     -1751,   2726,  -4291,   7202, -15101,  -1440,  16867,  -7669,   4512,  -2856,
-      1835,  -1165,    718,   -424,    237,   -124,     59,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     23,    -55,    115,   -221,    399,   -679,   1106,
-     -1747,   2719,  -4281,   7182, -15033,  -1547,  16929,  -7683,   4518,  -2860,
-      1837,  -1166,    719,   -424,    237,   -124,     60,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     23,    -54,    114,   -221,    397,   -677,   1103,
-     -1743,   2713,  -4270,   7161, -14964,  -1653,  16990,  -7697,   4524,  -2863,
-      1840,  -1167,    720,   -425,    238,   -124,     60,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     23,    -54,    114,   -220,    396,   -675,   1100,
-     -1739,   2707,  -4260,   7140, -14895,  -1760,  17052,  -7710,   4530,  -2866,
-      1842,  -1169,    721,   -426,    238,   -125,     60,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     23,    -54,    114,   -219,    395,   -673,   1098,
-     -1734,   2700,  -4249,   7119, -14826,  -1866,  17113,  -7723,   4536,  -2869,
-      1844,  -1170,    722,   -426,    239,   -125,     60,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     23,    -54,    113,   -219,    394,   -671,   1095,
-     -1730,   2694,  -4238,   7098, -14757,  -1973,  17174,  -7736,   4541,  -2872,
-      1846,  -1172,    722,   -427,    239,   -125,     60,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     23,    -53,    113,   -218,    393,   -670,   1092,
-     -1726,   2687,  -4227,   7076, -14687,  -2079,  17235,  -7749,   4546,  -2875,
-      1847,  -1173,    723,   -428,    240,   -125,     60,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     23,    -53,    112,   -217,    392,   -668,   1089,
-     -1721,   2680,  -4216,   7055, -14618,  -2185,  17296,  -7761,   4551,  -2878,
-      1849,  -1174,    724,   -428,    240,   -126,     60,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -53,    112,   -217,    391,   -666,   1086,
-     -1717,   2673,  -4205,   7033, -14548,  -2292,  17356,  -7773,   4556,  -2881,
-      1851,  -1175,    725,   -429,    240,   -126,     61,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -53,    112,   -216,    389,   -664,   1083,
-     -1713,   2667,  -4194,   7010, -14478,  -2398,  17416,  -7785,   4561,  -2883,
-      1853,  -1177,    726,   -429,    241,   -126,     61,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -53,    111,   -215,    388,   -662,   1080,
-     -1708,   2660,  -4182,   6988, -14408,  -2504,  17476,  -7797,   4566,  -2886,
-      1854,  -1178,    727,   -430,    241,   -126,     61,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -52,    111,   -214,    387,   -660,   1077,
-     -1703,   2652,  -4170,   6966, -14338,  -2610,  17535,  -7808,   4570,  -2888,
-      1856,  -1179,    727,   -431,    241,   -127,     61,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -52,    110,   -214,    386,   -658,   1074,
-     -1699,   2645,  -4159,   6943, -14267,  -2716,  17594,  -7820,   4574,  -2890,
-      1857,  -1180,    728,   -431,    242,   -127,     61,    -26,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -52,    110,   -213,    385,   -656,   1071,
-     -1694,   2638,  -4147,   6920, -14196,  -2822,  17653,  -7830,   4578,  -2893,
-      1859,  -1181,    729,   -432,    242,   -127,     61,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -52,    110,   -212,    383,   -654,   1068,
-     -1689,   2631,  -4134,   6897, -14126,  -2928,  17712,  -7841,   4582,  -2895,
-      1860,  -1182,    730,   -432,    242,   -127,     61,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -52,    109,   -211,    382,   -652,   1065,
-     -1684,   2623,  -4122,   6873, -14055,  -3033,  17770,  -7851,   4586,  -2897,
-      1861,  -1183,    730,   -432,    243,   -127,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -51,    109,   -211,    381,   -650,   1062,
-     -1680,   2616,  -4110,   6850, -13983,  -3139,  17828,  -7861,   4590,  -2898,
-      1862,  -1183,    731,   -433,    243,   -128,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     22,    -51,    108,   -210,    379,   -648,   1058,
-     -1675,   2608,  -4097,   6826, -13912,  -3245,  17886,  -7871,   4593,  -2900,
-      1864,  -1184,    731,   -433,    243,   -128,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     21,    -51,    108,   -209,    378,   -646,   1055,
-     -1670,   2600,  -4085,   6802, -13841,  -3350,  17943,  -7881,   4596,  -2902,
-      1865,  -1185,    732,   -434,    244,   -128,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     21,    -51,    107,   -208,    377,   -644,   1052,
-     -1665,   2592,  -4072,   6778, -13769,  -3456,  18000,  -7890,   4599,  -2903,
-      1866,  -1186,    733,   -434,    244,   -128,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     21,    -50,    107,   -208,    375,   -642,   1048,
-     -1659,   2584,  -4059,   6753, -13697,  -3561,  18057,  -7899,   4602,  -2905,
-      1867,  -1186,    733,   -435,    244,   -128,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     21,    -50,    106,   -207,    374,   -639,   1045,
-     -1654,   2576,  -4046,   6729, -13625,  -3667,  18114,  -7908,   4605,  -2906,
-      1867,  -1187,    734,   -435,    244,   -129,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     21,    -50,    106,   -206,    373,   -637,   1042,
-     -1649,   2568,  -4033,   6704, -13553,  -3772,  18170,  -7916,   4608,  -2907,
-      1868,  -1188,    734,   -435,    245,   -129,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -8,     21,    -50,    106,   -205,    371,   -635,   1038,
-     -1644,   2560,  -4020,   6679, -13481,  -3877,  18226,  -7925,   4610,  -2908,
-      1869,  -1188,    734,   -436,    245,   -129,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -7,     21,    -49,    105,   -204,    370,   -633,   1035,
-     -1639,   2552,  -4006,   6654, -13408,  -3982,  18282,  -7933,   4612,  -2909,
-      1869,  -1189,    735,   -436,    245,   -129,     62,    -27,     10,     -3,  1 },
-  {      0,      2,     -7,     21,    -49,    105,   -204,    369,   -631,   1031,
-     -1633,   2544,  -3993,   6629, -13336,  -4087,  18337,  -7940,   4614,  -2910,
-      1870,  -1189,    735,   -436,    245,   -129,     63,    -27,     10,     -3,  1 },
-  {      0,      2,     -7,     21,    -49,    104,   -203,    367,   -628,   1028,
-     -1628,   2535,  -3979,   6603, -13263,  -4192,  18392,  -7948,   4616,  -2911,
-      1871,  -1190,    736,   -437,    246,   -129,     63,    -27,     10,     -3,  1 },
-  {      0,      2,     -7,     20,    -49,    104,   -202,    366,   -626,   1024,
-     -1622,   2527,  -3965,   6577, -13190,  -4297,  18447,  -7955,   4618,  -2912,
-      1871,  -1190,    736,   -437,    246,   -129,     63,    -27,     10,     -3,  1 },
-  {      0,      2,     -7,     20,    -49,    103,   -201,    364,   -624,   1021,
-     -1617,   2518,  -3952,   6551, -13117,  -4402,  18502,  -7962,   4620,  -2912,
-      1871,  -1190,    736,   -437,    246,   -130,     63,    -27,     10,     -3,  1 },
-  {      0,      2,     -7,     20,    -48,    103,   -200,    363,   -621,   1017,
-     -1611,   2510,  -3938,   6525, -13044,  -4506,  18556,  -7968,   4621,  -2913,
-      1872,  -1190,    737,   -437,    246,   -130,     63,    -28,     10,     -3,  1 },
-  {      0,      2,     -7,     20,    -48,    102,   -199,    362,   -619,   1013,
-     -1605,   2501,  -3923,   6499, -12970,  -4611,  18610,  -7975,   4622,  -2913,
-      1872,  -1191,    737,   -438,    246,   -130,     63,    -28,     10,     -3,  1 },
-  {      0,      2,     -7,     20,    -48,    102,   -198,    360,   -617,   1010,
-     -1600,   2492,  -3909,   6473, -12897,  -4715,  18663,  -7981,   4623,  -2913,
-      1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     10,     -3,  1 },
-  {      0,      2,     -7,     20,    -48,    101,   -198,    359,   -614,   1006,
-     -1594,   2483,  -3895,   6446, -12823,  -4819,  18717,  -7987,   4624,  -2913,
-      1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     20,    -47,    101,   -197,    357,   -612,   1002,
-     -1588,   2474,  -3880,   6419, -12749,  -4923,  18770,  -7992,   4625,  -2913,
-      1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     20,    -47,    100,   -196,    356,   -610,    998,
-     -1582,   2465,  -3866,   6392, -12676,  -5027,  18822,  -7997,   4625,  -2913,
-      1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     20,    -47,    100,   -195,    354,   -607,    994,
-     -1576,   2456,  -3851,   6365, -12602,  -5131,  18875,  -8002,   4626,  -2913,
-      1872,  -1191,    738,   -438,    247,   -130,     63,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -47,     99,   -194,    353,   -605,    991,
-     -1571,   2447,  -3836,   6338, -12528,  -5235,  18927,  -8007,   4626,  -2913,
-      1871,  -1191,    738,   -439,    247,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -46,     99,   -193,    351,   -602,    987,
-     -1565,   2438,  -3821,   6310, -12453,  -5339,  18978,  -8011,   4626,  -2912,
-      1871,  -1191,    738,   -439,    247,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -46,     98,   -192,    350,   -600,    983,
-     -1558,   2428,  -3806,   6283, -12379,  -5442,  19030,  -8015,   4626,  -2911,
-      1871,  -1191,    738,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -46,     98,   -191,    348,   -597,    979,
-     -1552,   2419,  -3791,   6255, -12304,  -5546,  19081,  -8019,   4625,  -2911,
-      1870,  -1191,    738,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -46,     97,   -190,    346,   -595,    975,
-     -1546,   2409,  -3775,   6227, -12230,  -5649,  19131,  -8023,   4625,  -2910,
-      1870,  -1190,    738,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -45,     97,   -190,    345,   -592,    971,
-     -1540,   2400,  -3760,   6199, -12155,  -5752,  19182,  -8026,   4624,  -2909,
-      1869,  -1190,    737,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -45,     96,   -189,    343,   -589,    967,
-     -1534,   2390,  -3744,   6171, -12080,  -5855,  19232,  -8029,   4623,  -2908,
-      1869,  -1190,    737,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     19,    -45,     96,   -188,    342,   -587,    963,
-     -1527,   2380,  -3729,   6142, -12005,  -5958,  19282,  -8031,   4622,  -2907,
-      1868,  -1189,    737,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -7,     18,    -45,     95,   -187,    340,   -584,    959,
-     -1521,   2370,  -3713,   6113, -11930,  -6061,  19331,  -8034,   4621,  -2906,
-      1867,  -1189,    737,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -44,     95,   -186,    339,   -582,    954,
-     -1515,   2361,  -3697,   6085, -11855,  -6164,  19380,  -8036,   4620,  -2904,
-      1866,  -1189,    737,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -44,     94,   -185,    337,   -579,    950,
-     -1508,   2351,  -3681,   6056, -11780,  -6266,  19429,  -8038,   4618,  -2903,
-      1865,  -1188,    737,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -44,     94,   -184,    335,   -576,    946,
-     -1502,   2341,  -3665,   6027, -11704,  -6368,  19477,  -8039,   4616,  -2901,
-      1864,  -1187,    736,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -43,     93,   -183,    334,   -574,    942,
-     -1495,   2330,  -3649,   5997, -11629,  -6471,  19525,  -8040,   4614,  -2900,
-      1863,  -1187,    736,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -43,     93,   -182,    332,   -571,    938,
-     -1489,   2320,  -3632,   5968, -11553,  -6573,  19573,  -8041,   4612,  -2898,
-      1862,  -1186,    736,   -439,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -43,     92,   -181,    330,   -568,    933,
-     -1482,   2310,  -3616,   5938, -11478,  -6674,  19620,  -8042,   4610,  -2896,
-      1861,  -1185,    736,   -438,    248,   -131,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -43,     92,   -180,    329,   -566,    929,
-     -1475,   2300,  -3599,   5908, -11402,  -6776,  19667,  -8042,   4607,  -2894,
-      1859,  -1185,    735,   -438,    248,   -132,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     18,    -42,     91,   -179,    327,   -563,    925,
-     -1469,   2289,  -3583,   5879, -11326,  -6878,  19714,  -8042,   4605,  -2892,
-      1858,  -1184,    735,   -438,    248,   -132,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     17,    -42,     91,   -178,    325,   -560,    920,
-     -1462,   2279,  -3566,   5849, -11250,  -6979,  19760,  -8042,   4602,  -2889,
-      1856,  -1183,    734,   -438,    248,   -132,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     17,    -42,     90,   -177,    324,   -557,    916,
-     -1455,   2268,  -3549,   5818, -11174,  -7080,  19806,  -8042,   4599,  -2887,
-      1855,  -1182,    734,   -438,    248,   -132,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     17,    -42,     90,   -176,    322,   -555,    912,
-     -1448,   2258,  -3532,   5788, -11098,  -7181,  19852,  -8041,   4596,  -2884,
-      1853,  -1181,    733,   -438,    248,   -132,     64,    -28,     11,     -3,  1 },
-  {      0,      2,     -6,     17,    -41,     89,   -175,    320,   -552,    907,
-     -1441,   2247,  -3515,   5758, -11022,  -7282,  19897,  -8040,   4592,  -2882,
-      1851,  -1180,    733,   -437,    248,   -132,     64,    -29,     11,     -4,  1 },
-  {      0,      2,     -6,     17,    -41,     89,   -174,    319,   -549,    903,
-     -1434,   2236,  -3498,   5727, -10946,  -7383,  19942,  -8038,   4589,  -2879,
-      1850,  -1179,    732,   -437,    248,   -132,     64,    -29,     11,     -4,  1 },
-  {      0,      2,     -6,     17,    -41,     88,   -173,    317,   -546,    898,
-     -1427,   2226,  -3481,   5696, -10869,  -7484,  19987,  -8037,   4585,  -2876,
-      1848,  -1178,    732,   -437,    248,   -132,     64,    -29,     11,     -4,  1 },
-  {      0,      2,     -6,     17,    -41,     88,   -172,    315,   -543,    894,
-     -1420,   2215,  -3463,   5665, -10793,  -7584,  20031,  -8035,   4581,  -2873,
-      1846,  -1177,    731,   -437,    248,   -132,     65,    -29,     11,     -4,  1 },
-  {      0,      2,     -6,     17,    -40,     87,   -171,    313,   -540,    889,
-     -1413,   2204,  -3446,   5634, -10716,  -7684,  20075,  -8032,   4577,  -2870,
-      1844,  -1176,    730,   -436,    247,   -132,     65,    -29,     11,     -4,  1 },
-  {      0,      2,     -6,     16,    -40,     86,   -170,    312,   -537,    884,
-     -1406,   2193,  -3428,   5603, -10640,  -7784,  20119,  -8030,   4573,  -2867,
-      1842,  -1175,    730,   -436,    247,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      2,     -6,     16,    -40,     86,   -169,    310,   -535,    880,
-     -1399,   2182,  -3410,   5572, -10563,  -7884,  20162,  -8027,   4568,  -2864,
-      1840,  -1173,    729,   -436,    247,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      2,     -6,     16,    -39,     85,   -168,    308,   -532,    875,
-     -1392,   2171,  -3393,   5540, -10486,  -7984,  20204,  -8024,   4564,  -2860,
-      1837,  -1172,    728,   -435,    247,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -6,     16,    -39,     85,   -167,    306,   -529,    871,
-     -1385,   2159,  -3375,   5509, -10409,  -8083,  20247,  -8020,   4559,  -2857,
-      1835,  -1171,    728,   -435,    247,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -6,     16,    -39,     84,   -166,    304,   -526,    866,
-     -1377,   2148,  -3357,   5477, -10333,  -8183,  20289,  -8016,   4554,  -2853,
-      1833,  -1169,    727,   -434,    247,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     16,    -39,     84,   -165,    303,   -523,    861,
-     -1370,   2137,  -3339,   5445, -10256,  -8282,  20331,  -8012,   4549,  -2849,
-      1830,  -1168,    726,   -434,    247,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     16,    -38,     83,   -164,    301,   -520,    856,
-     -1363,   2125,  -3321,   5413, -10179,  -8381,  20372,  -8008,   4544,  -2845,
-      1828,  -1166,    725,   -434,    246,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     16,    -38,     83,   -163,    299,   -517,    852,
-     -1355,   2114,  -3302,   5381, -10102,  -8479,  20413,  -8003,   4538,  -2841,
-      1825,  -1165,    724,   -433,    246,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -38,     82,   -162,    297,   -514,    847,
-     -1348,   2102,  -3284,   5349, -10025,  -8578,  20454,  -7998,   4532,  -2837,
-      1822,  -1163,    723,   -433,    246,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -37,     81,   -161,    295,   -511,    842,
-     -1340,   2091,  -3266,   5316,  -9947,  -8676,  20494,  -7993,   4526,  -2833,
-      1820,  -1161,    723,   -432,    246,   -131,     65,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -37,     81,   -160,    294,   -508,    837,
-     -1333,   2079,  -3247,   5284,  -9870,  -8774,  20534,  -7987,   4520,  -2829,
-      1817,  -1160,    722,   -432,    246,   -131,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -37,     80,   -159,    292,   -505,    832,
-     -1325,   2068,  -3229,   5251,  -9793,  -8872,  20573,  -7981,   4514,  -2824,
-      1814,  -1158,    721,   -431,    245,   -131,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -37,     80,   -158,    290,   -502,    828,
-     -1318,   2056,  -3210,   5218,  -9716,  -8970,  20612,  -7975,   4508,  -2820,
-      1811,  -1156,    720,   -431,    245,   -131,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -36,     79,   -157,    288,   -499,    823,
-     -1310,   2044,  -3191,   5185,  -9638,  -9068,  20651,  -7969,   4501,  -2815,
-      1808,  -1154,    718,   -430,    245,   -131,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -36,     79,   -156,    286,   -495,    818,
-     -1303,   2032,  -3172,   5152,  -9561,  -9165,  20689,  -7962,   4494,  -2810,
-      1805,  -1152,    717,   -430,    245,   -131,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     15,    -36,     78,   -155,    284,   -492,    813,
-     -1295,   2020,  -3153,   5119,  -9483,  -9262,  20727,  -7955,   4487,  -2805,
-      1802,  -1150,    716,   -429,    244,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -36,     77,   -154,    282,   -489,    808,
-     -1287,   2008,  -3134,   5086,  -9406,  -9359,  20765,  -7947,   4480,  -2800,
-      1798,  -1148,    715,   -428,    244,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -35,     77,   -152,    281,   -486,    803,
-     -1279,   1996,  -3115,   5053,  -9328,  -9455,  20802,  -7939,   4473,  -2795,
-      1795,  -1146,    714,   -428,    244,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -35,     76,   -151,    279,   -483,    798,
-     -1272,   1984,  -3096,   5019,  -9251,  -9552,  20839,  -7931,   4465,  -2790,
-      1792,  -1144,    713,   -427,    243,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -35,     76,   -150,    277,   -480,    793,
-     -1264,   1972,  -3077,   4986,  -9173,  -9648,  20875,  -7923,   4457,  -2784,
-      1788,  -1142,    712,   -427,    243,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -34,     75,   -149,    275,   -477,    788,
-     -1256,   1960,  -3057,   4952,  -9096,  -9744,  20911,  -7914,   4450,  -2779,
-      1785,  -1140,    710,   -426,    243,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -34,     75,   -148,    273,   -474,    783,
-     -1248,   1948,  -3038,   4918,  -9018,  -9840,  20947,  -7905,   4441,  -2773,
-      1781,  -1138,    709,   -425,    242,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -34,     74,   -147,    271,   -470,    778,
-     -1240,   1935,  -3018,   4884,  -8940,  -9935,  20982,  -7896,   4433,  -2767,
-      1777,  -1135,    708,   -424,    242,   -130,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     14,    -33,     73,   -146,    269,   -467,    772,
-     -1232,   1923,  -2999,   4850,  -8863, -10031,  21017,  -7886,   4425,  -2762,
-      1773,  -1133,    706,   -424,    242,   -129,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -5,     13,    -33,     73,   -145,    267,   -464,    767,
-     -1224,   1911,  -2979,   4816,  -8785, -10126,  21051,  -7877,   4416,  -2756,
-      1770,  -1131,    705,   -423,    241,   -129,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     13,    -33,     72,   -144,    265,   -461,    762,
-     -1216,   1898,  -2959,   4782,  -8707, -10221,  21086,  -7866,   4407,  -2750,
-      1766,  -1128,    703,   -422,    241,   -129,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     13,    -33,     72,   -143,    263,   -457,    757,
-     -1208,   1886,  -2939,   4748,  -8630, -10315,  21119,  -7856,   4398,  -2743,
-      1762,  -1126,    702,   -421,    241,   -129,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     13,    -32,     71,   -141,    261,   -454,    752,
-     -1200,   1873,  -2920,   4713,  -8552, -10410,  21152,  -7845,   4389,  -2737,
-      1757,  -1123,    701,   -421,    240,   -129,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     13,    -32,     70,   -140,    259,   -451,    747,
-     -1192,   1860,  -2900,   4679,  -8474, -10504,  21185,  -7834,   4380,  -2731,
-      1753,  -1121,    699,   -420,    240,   -129,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     13,    -32,     70,   -139,    257,   -448,    741,
-     -1183,   1848,  -2879,   4644,  -8396, -10598,  21218,  -7822,   4370,  -2724,
-      1749,  -1118,    698,   -419,    239,   -128,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     13,    -31,     69,   -138,    256,   -444,    736,
-     -1175,   1835,  -2859,   4609,  -8318, -10691,  21250,  -7811,   4360,  -2717,
-      1745,  -1115,    696,   -418,    239,   -128,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -31,     69,   -137,    254,   -441,    731,
-     -1167,   1822,  -2839,   4575,  -8241, -10785,  21282,  -7798,   4351,  -2711,
-      1740,  -1113,    694,   -417,    238,   -128,     64,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -31,     68,   -136,    252,   -438,    725,
-     -1159,   1809,  -2819,   4540,  -8163, -10878,  21313,  -7786,   4340,  -2704,
-      1736,  -1110,    693,   -416,    238,   -128,     63,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -31,     67,   -135,    250,   -435,    720,
-     -1150,   1797,  -2799,   4505,  -8085, -10971,  21344,  -7773,   4330,  -2697,
-      1731,  -1107,    691,   -415,    238,   -128,     63,    -29,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -30,     67,   -134,    248,   -431,    715,
-     -1142,   1784,  -2778,   4470,  -8007, -11063,  21374,  -7760,   4320,  -2690,
-      1727,  -1104,    689,   -414,    237,   -127,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -30,     66,   -133,    246,   -428,    709,
-     -1134,   1771,  -2758,   4434,  -7929, -11156,  21404,  -7747,   4309,  -2682,
-      1722,  -1101,    688,   -414,    237,   -127,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -30,     66,   -131,    244,   -425,    704,
-     -1125,   1758,  -2737,   4399,  -7852, -11248,  21434,  -7733,   4298,  -2675,
-      1717,  -1098,    686,   -413,    236,   -127,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -29,     65,   -130,    242,   -421,    699,
-     -1117,   1745,  -2716,   4364,  -7774, -11340,  21463,  -7719,   4287,  -2667,
-      1712,  -1095,    684,   -412,    236,   -127,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     12,    -29,     64,   -129,    240,   -418,    693,
-     -1108,   1732,  -2696,   4328,  -7696, -11431,  21492,  -7705,   4276,  -2660,
-      1707,  -1092,    682,   -411,    235,   -126,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     11,    -29,     64,   -128,    238,   -414,    688,
-     -1100,   1718,  -2675,   4293,  -7618, -11523,  21520,  -7690,   4265,  -2652,
-      1702,  -1089,    680,   -410,    235,   -126,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     11,    -29,     63,   -127,    236,   -411,    682,
-     -1092,   1705,  -2654,   4257,  -7540, -11614,  21548,  -7675,   4253,  -2644,
-      1697,  -1086,    679,   -409,    234,   -126,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     11,    -28,     63,   -126,    234,   -408,    677,
-     -1083,   1692,  -2633,   4222,  -7463, -11705,  21576,  -7660,   4241,  -2636,
-      1692,  -1083,    677,   -407,    233,   -126,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     11,    -28,     62,   -125,    231,   -404,    672,
-     -1074,   1679,  -2612,   4186,  -7385, -11795,  21603,  -7645,   4229,  -2628,
-      1687,  -1079,    675,   -406,    233,   -125,     63,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     11,    -28,     61,   -123,    229,   -401,    666,
-     -1066,   1666,  -2591,   4150,  -7307, -11885,  21630,  -7629,   4217,  -2620,
-      1682,  -1076,    673,   -405,    232,   -125,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -4,     11,    -27,     61,   -122,    227,   -397,    661,
-     -1057,   1652,  -2570,   4114,  -7229, -11975,  21656,  -7613,   4205,  -2612,
-      1676,  -1073,    671,   -404,    232,   -125,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     11,    -27,     60,   -121,    225,   -394,    655,
-     -1049,   1639,  -2549,   4078,  -7152, -12065,  21682,  -7596,   4193,  -2604,
-      1671,  -1069,    669,   -403,    231,   -125,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     11,    -27,     60,   -120,    223,   -391,    650,
-     -1040,   1625,  -2528,   4042,  -7074, -12154,  21708,  -7579,   4180,  -2595,
-      1665,  -1066,    667,   -402,    231,   -124,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -26,     59,   -119,    221,   -387,    644,
-     -1031,   1612,  -2507,   4006,  -6996, -12244,  21733,  -7562,   4167,  -2586,
-      1660,  -1062,    665,   -401,    230,   -124,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -26,     58,   -118,    219,   -384,    638,
-     -1023,   1598,  -2486,   3970,  -6919, -12332,  21757,  -7545,   4154,  -2578,
-      1654,  -1059,    663,   -400,    229,   -124,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -26,     58,   -116,    217,   -380,    633,
-     -1014,   1585,  -2464,   3933,  -6841, -12421,  21782,  -7527,   4141,  -2569,
-      1648,  -1055,    660,   -398,    229,   -123,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -26,     57,   -115,    215,   -377,    627,
-     -1005,   1571,  -2443,   3897,  -6764, -12509,  21805,  -7509,   4127,  -2560,
-      1643,  -1052,    658,   -397,    228,   -123,     62,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -25,     56,   -114,    213,   -373,    622,
-      -996,   1558,  -2421,   3861,  -6686, -12597,  21829,  -7490,   4114,  -2551,
-      1637,  -1048,    656,   -396,    227,   -123,     61,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -25,     56,   -113,    211,   -370,    616,
-      -988,   1544,  -2400,   3824,  -6609, -12685,  21852,  -7472,   4100,  -2542,
-      1631,  -1044,    654,   -395,    227,   -122,     61,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -25,     55,   -112,    209,   -366,    610,
-      -979,   1530,  -2378,   3788,  -6531, -12773,  21874,  -7453,   4086,  -2532,
-      1625,  -1041,    652,   -393,    226,   -122,     61,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,     10,    -24,     55,   -111,    207,   -363,    605,
-      -970,   1517,  -2357,   3751,  -6454, -12860,  21896,  -7433,   4072,  -2523,
-      1619,  -1037,    649,   -392,    225,   -122,     61,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,      9,    -24,     54,   -109,    205,   -359,    599,
-      -961,   1503,  -2335,   3714,  -6376, -12946,  21918,  -7414,   4058,  -2513,
-      1613,  -1033,    647,   -391,    225,   -121,     61,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,      9,    -24,     53,   -108,    203,   -356,    593,
-      -952,   1489,  -2313,   3678,  -6299, -13033,  21939,  -7394,   4043,  -2504,
-      1606,  -1029,    645,   -389,    224,   -121,     61,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,      9,    -23,     53,   -107,    201,   -352,    588,
-      -943,   1475,  -2292,   3641,  -6222, -13119,  21960,  -7373,   4029,  -2494,
-      1600,  -1025,    642,   -388,    223,   -121,     61,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,      9,    -23,     52,   -106,    198,   -349,    582,
-      -934,   1462,  -2270,   3604,  -6145, -13205,  21981,  -7353,   4014,  -2484,
-      1594,  -1021,    640,   -387,    223,   -120,     60,    -28,     11,     -4,  1 },
-  {      0,      1,     -3,      9,    -23,     52,   -105,    196,   -345,    576,
-      -925,   1448,  -2248,   3567,  -6067, -13291,  22001,  -7332,   3999,  -2474,
-      1587,  -1017,    637,   -385,    222,   -120,     60,    -27,     11,     -4,  1 },
-  {      0,      1,     -3,      9,    -23,     51,   -104,    194,   -342,    571,
-      -916,   1434,  -2226,   3530,  -5990, -13376,  22020,  -7310,   3984,  -2464,
-      1581,  -1013,    635,   -384,    221,   -120,     60,    -27,     11,     -4,  1 },
-  {      0,      1,     -3,      9,    -22,     50,   -102,    192,   -338,    565,
-      -907,   1420,  -2204,   3493,  -5913, -13461,  22039,  -7289,   3968,  -2454,
-      1574,  -1009,    632,   -382,    220,   -119,     60,    -27,     11,     -4,  1 },
-  {      0,      1,     -3,      8,    -22,     50,   -101,    190,   -335,    559,
-      -898,   1406,  -2182,   3456,  -5836, -13546,  22058,  -7267,   3953,  -2444,
-      1567,  -1004,    630,   -381,    220,   -119,     60,    -27,     11,     -4,  1 },
-  {      0,      1,     -3,      8,    -22,     49,   -100,    188,   -331,    553,
-      -889,   1392,  -2160,   3419,  -5759, -13630,  22076,  -7245,   3937,  -2433,
-      1561,  -1000,    627,   -380,    219,   -119,     60,    -27,     11,     -4,  1 },
-  {      0,      1,     -3,      8,    -21,     48,    -99,    186,   -327,    548,
-      -880,   1378,  -2138,   3382,  -5682, -13714,  22094,  -7222,   3921,  -2423,
-      1554,   -996,    625,   -378,    218,   -118,     59,    -27,     11,     -4,  1 },
-  {      0,      1,     -3,      8,    -21,     48,    -98,    184,   -324,    542,
-      -871,   1364,  -2116,   3345,  -5606, -13798,  22111,  -7199,   3905,  -2412,
-      1547,   -992,    622,   -377,    217,   -118,     59,    -27,     11,     -4,  1 },
-  {      0,      1,     -2,      8,    -21,     47,    -96,    182,   -320,    536,
-      -862,   1350,  -2094,   3308,  -5529, -13882,  22128,  -7176,   3889,  -2401,
-      1540,   -987,    620,   -375,    216,   -117,     59,    -27,     11,     -4,  1 },
-  {      0,      1,     -2,      8,    -20,     47,    -95,    179,   -317,    530,
-      -853,   1335,  -2071,   3270,  -5452, -13965,  22144,  -7153,   3872,  -2390,
-      1533,   -983,    617,   -374,    216,   -117,     59,    -27,     11,     -4,  1 },
-  {      0,      1,     -2,      8,    -20,     46,    -94,    177,   -313,    525,
-      -844,   1321,  -2049,   3233,  -5376, -14048,  22160,  -7129,   3856,  -2379,
-      1526,   -978,    614,   -372,    215,   -117,     59,    -27,     11,     -4,  1 },
-  {      0,      0,     -2,      8,    -20,     45,    -93,    175,   -310,    519,
-      -835,   1307,  -2027,   3196,  -5299, -14130,  22176,  -7105,   3839,  -2368,
-      1519,   -974,    611,   -370,    214,   -116,     59,    -27,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -20,     45,    -92,    173,   -306,    513,
-      -826,   1293,  -2005,   3158,  -5222, -14212,  22191,  -7080,   3822,  -2357,
-      1511,   -969,    609,   -369,    213,   -116,     58,    -27,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -19,     44,    -90,    171,   -302,    507,
-      -816,   1279,  -1982,   3121,  -5146, -14294,  22206,  -7055,   3805,  -2346,
-      1504,   -965,    606,   -367,    212,   -115,     58,    -27,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -19,     43,    -89,    169,   -299,    501,
-      -807,   1265,  -1960,   3083,  -5070, -14376,  22220,  -7030,   3788,  -2334,
-      1497,   -960,    603,   -366,    211,   -115,     58,    -27,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -19,     43,    -88,    167,   -295,    495,
-      -798,   1250,  -1937,   3046,  -4993, -14457,  22234,  -7005,   3770,  -2323,
-      1489,   -955,    600,   -364,    210,   -114,     58,    -27,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -18,     42,    -87,    165,   -292,    490,
-      -789,   1236,  -1915,   3008,  -4917, -14538,  22247,  -6979,   3752,  -2311,
-      1482,   -951,    597,   -362,    209,   -114,     58,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -18,     42,    -86,    162,   -288,    484,
-      -780,   1222,  -1893,   2971,  -4841, -14618,  22260,  -6953,   3735,  -2300,
-      1474,   -946,    594,   -361,    209,   -114,     57,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -18,     41,    -85,    160,   -284,    478,
-      -770,   1207,  -1870,   2933,  -4765, -14698,  22273,  -6927,   3717,  -2288,
-      1466,   -941,    591,   -359,    208,   -113,     57,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      7,    -18,     40,    -83,    158,   -281,    472,
-      -761,   1193,  -1848,   2896,  -4689, -14778,  22285,  -6900,   3698,  -2276,
-      1459,   -936,    589,   -357,    207,   -113,     57,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      6,    -17,     40,    -82,    156,   -277,    466,
-      -752,   1179,  -1825,   2858,  -4613, -14858,  22296,  -6873,   3680,  -2264,
-      1451,   -931,    586,   -355,    206,   -112,     57,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      6,    -17,     39,    -81,    154,   -273,    460,
-      -743,   1164,  -1802,   2820,  -4538, -14937,  22307,  -6846,   3661,  -2252,
-      1443,   -926,    582,   -354,    205,   -112,     57,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      6,    -17,     38,    -80,    152,   -270,    454,
-      -733,   1150,  -1780,   2783,  -4462, -15016,  22318,  -6818,   3643,  -2239,
-      1435,   -921,    579,   -352,    204,   -111,     56,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      6,    -16,     38,    -79,    150,   -266,    448,
-      -724,   1135,  -1757,   2745,  -4386, -15094,  22328,  -6790,   3624,  -2227,
-      1427,   -916,    576,   -350,    203,   -111,     56,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      6,    -16,     37,    -77,    147,   -262,    442,
-      -715,   1121,  -1734,   2707,  -4311, -15172,  22338,  -6762,   3605,  -2214,
-      1419,   -911,    573,   -348,    202,   -110,     56,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      6,    -16,     37,    -76,    145,   -259,    436,
-      -705,   1106,  -1712,   2669,  -4235, -15250,  22347,  -6733,   3586,  -2202,
-      1411,   -906,    570,   -347,    201,   -110,     56,    -26,     11,     -4,  1 },
-  {      0,      0,     -2,      6,    -15,     36,    -75,    143,   -255,    431,
-      -696,   1092,  -1689,   2632,  -4160, -15328,  22356,  -6704,   3566,  -2189,
-      1403,   -901,    567,   -345,    200,   -109,     55,    -26,     10,     -4,  1 },
-  {      0,      0,     -2,      6,    -15,     35,    -74,    141,   -252,    425,
-      -687,   1077,  -1666,   2594,  -4085, -15405,  22364,  -6675,   3547,  -2176,
-      1394,   -895,    564,   -343,    199,   -109,     55,    -26,     10,     -4,  1 },
-  {      0,      0,     -2,      5,    -15,     35,    -73,    139,   -248,    419,
-      -677,   1063,  -1643,   2556,  -4010, -15482,  22372,  -6646,   3527,  -2163,
-      1386,   -890,    561,   -341,    198,   -108,     55,    -25,     10,     -4,  1 },
-  {      0,      0,     -2,      5,    -15,     34,    -71,    137,   -244,    413,
-      -668,   1048,  -1621,   2518,  -3935, -15558,  22380,  -6616,   3507,  -2150,
-      1377,   -885,    557,   -339,    197,   -108,     55,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      5,    -14,     34,    -70,    135,   -241,    407,
-      -658,   1034,  -1598,   2480,  -3860, -15634,  22387,  -6586,   3487,  -2137,
-      1369,   -879,    554,   -337,    196,   -107,     54,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      5,    -14,     33,    -69,    132,   -237,    401,
-      -649,   1019,  -1575,   2442,  -3785, -15710,  22393,  -6555,   3466,  -2124,
-      1360,   -874,    551,   -335,    195,   -107,     54,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      5,    -14,     32,    -68,    130,   -233,    395,
-      -640,   1005,  -1552,   2405,  -3711, -15785,  22399,  -6524,   3446,  -2111,
-      1352,   -869,    547,   -333,    194,   -106,     54,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      5,    -13,     32,    -67,    128,   -230,    389,
-      -630,    990,  -1529,   2367,  -3636, -15860,  22405,  -6493,   3425,  -2097,
-      1343,   -863,    544,   -331,    193,   -106,     54,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      5,    -13,     31,    -65,    126,   -226,    383,
-      -621,    975,  -1506,   2329,  -3562, -15935,  22410,  -6462,   3405,  -2084,
-      1334,   -857,    541,   -329,    192,   -105,     53,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      5,    -13,     30,    -64,    124,   -222,    377,
-      -611,    961,  -1483,   2291,  -3487, -16009,  22415,  -6430,   3384,  -2070,
-      1326,   -852,    537,   -327,    191,   -104,     53,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      4,    -13,     30,    -63,    122,   -219,    371,
-      -602,    946,  -1460,   2253,  -3413, -16083,  22419,  -6398,   3363,  -2056,
-      1317,   -846,    534,   -325,    189,   -104,     53,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      4,    -12,     29,    -62,    120,   -215,    365,
-      -593,    931,  -1438,   2215,  -3339, -16156,  22423,  -6366,   3341,  -2042,
-      1308,   -841,    530,   -323,    188,   -103,     53,    -25,     10,     -4,  1 },
-  {      0,      0,     -1,      4,    -12,     29,    -61,    117,   -211,    359,
-      -583,    917,  -1415,   2177,  -3265, -16229,  22427,  -6333,   3320,  -2029,
-      1299,   -835,    527,   -321,    187,   -103,     52,    -24,     10,     -4,  1 },
-  {      0,      0,     -1,      4,    -12,     28,    -59,    115,   -208,    353,
-      -574,    902,  -1392,   2139,  -3191, -16302,  22429,  -6300,   3298,  -2014,
-      1290,   -829,    523,   -319,    186,   -102,     52,    -24,     10,     -4,  1 },
-  {      0,      0,     -1,      4,    -11,     27,    -58,    113,   -204,    347,
-      -564,    887,  -1369,   2101,  -3118, -16375,  22432,  -6267,   3276,  -2000,
-      1280,   -823,    520,   -317,    185,   -102,     52,    -24,     10,     -4,  1 },
-  {      0,      0,     -1,      4,    -11,     27,    -57,    111,   -200,    341,
-      -555,    873,  -1346,   2063,  -3044, -16447,  22434,  -6233,   3255,  -1986,
-      1271,   -817,    516,   -315,    184,   -101,     52,    -24,     10,     -3,  1 },
-  {      0,      0,     -1,      4,    -11,     26,    -56,    109,   -197,    335,
-      -545,    858,  -1323,   2025,  -2970, -16518,  22435,  -6199,   3232,  -1972,
-      1262,   -812,    513,   -313,    183,   -100,     51,    -24,     10,     -3,  1 },
-  {      0,      0,     -1,      4,    -11,     26,    -55,    107,   -193,    329,
-      -536,    843,  -1300,   1988,  -2897, -16590,  22436,  -6165,   3210,  -1957,
-      1253,   -806,    509,   -311,    181,   -100,     51,    -24,     10,     -3,  1 },
-  {      0,      0,     -1,      3,    -10,     25,    -54,    104,   -189,    323,
-      -526,    829,  -1277,   1950,  -2824, -16661,  22437,  -6130,   3188,  -1943,
-      1243,   -800,    505,   -309,    180,    -99,     51,    -24,     10,     -3,  1 },
-  {      0,      0,     -1,      3,    -10,     24,    -52,    102,   -186,    317,
-      -517,    814,  -1254,   1912,  -2751, -16731,  22437,  -6095,   3165,  -1928,
-      1234,   -794,    502,   -307,    179,    -99,     51,    -24,     10,     -3,  1 },
-  {      0,      0,     -1,      3,    -10,     24,    -51,    100,   -182,    311,
-      -507,    799,  -1231,   1874,  -2678, -16801,  22437,  -6060,   3142,  -1913,
-      1224,   -788,    498,   -304,    178,    -98,     50,    -23,     10,     -3,  1 },
-  {      0,      0,     -1,      3,     -9,     23,    -50,     98,   -178,    305,
-      -498,    784,  -1208,   1836,  -2605, -16871,  22436,  -6025,   3119,  -1898,
-      1214,   -782,    494,   -302,    177,    -97,     50,    -23,     10,     -3,  1 },
-  {      0,      0,     -1,      3,     -9,     22,    -49,     96,   -175,    299,
-      -488,    770,  -1185,   1798,  -2533, -16940,  22435,  -5989,   3096,  -1883,
-      1205,   -775,    490,   -300,    175,    -97,     50,    -23,     10,     -3,  1 },
-  {      0,      0,     -1,      3,     -9,     22,    -48,     94,   -171,    293,
-      -479,    755,  -1162,   1760,  -2460, -17009,  22433,  -5953,   3073,  -1868,
-      1195,   -769,    487,   -298,    174,    -96,     49,    -23,     10,     -3,  1 },
-  {      0,      0,     -1,      3,     -9,     21,    -46,     92,   -167,    287,
-      -470,    740,  -1138,   1723,  -2388, -17078,  22431,  -5916,   3050,  -1853,
-      1185,   -763,    483,   -296,    173,    -96,     49,    -23,     10,     -3,  1 },
-  {      0,      0,     -1,      3,     -8,     21,    -45,     89,   -164,    281,
-      -460,    725,  -1115,   1685,  -2315, -17146,  22428,  -5879,   3026,  -1838,
-      1175,   -757,    479,   -293,    172,    -95,     49,    -23,     10,     -3,  1 },
-  {      0,      0,     -1,      3,     -8,     20,    -44,     87,   -160,    275,
-      -451,    711,  -1092,   1647,  -2243, -17214,  22425,  -5842,   3002,  -1823,
-      1166,   -750,    475,   -291,    170,    -94,     48,    -23,     10,     -3,  1 },
-  {      0,      0,      0,      2,     -8,     19,    -43,     85,   -156,    269,
-      -441,    696,  -1069,   1609,  -2171, -17282,  22421,  -5805,   2978,  -1807,
-      1156,   -744,    471,   -289,    169,    -94,     48,    -23,      9,     -3,  1 },
-  {      0,      0,      0,      2,     -7,     19,    -42,     83,   -153,    263,
-      -432,    681,  -1046,   1571,  -2100, -17349,  22417,  -5767,   2954,  -1792,
-      1145,   -738,    467,   -287,    168,    -93,     48,    -23,      9,     -3,  1 },
-  {      0,      0,      0,      2,     -7,     18,    -40,     81,   -149,    257,
-      -422,    666,  -1023,   1534,  -2028, -17415,  22413,  -5729,   2930,  -1776,
-      1135,   -731,    463,   -284,    167,    -92,     48,    -22,      9,     -3,  1 },
-  {      0,      0,      0,      2,     -7,     18,    -39,     79,   -145,    251,
-      -413,    652,  -1000,   1496,  -1957, -17482,  22408,  -5691,   2906,  -1760,
-      1125,   -725,    459,   -282,    165,    -92,     47,    -22,      9,     -3,  1 },
-  {      0,      0,      0,      2,     -7,     17,    -38,     77,   -142,    245,
-      -403,    637,   -977,   1458,  -1885, -17547,  22402,  -5652,   2881,  -1745,
-      1115,   -718,    455,   -280,    164,    -91,     47,    -22,      9,     -3,  1 },
-  {      0,      0,      0,      2,     -6,     16,    -37,     74,   -138,    239,
-      -394,    622,   -954,   1420,  -1814, -17613,  22396,  -5614,   2857,  -1729,
-      1105,   -712,    451,   -277,    163,    -90,     47,    -22,      9,     -3,  1 },
-  {      0,      0,      0,      2,     -6,     16,    -36,     72,   -134,    233,
-      -384,    607,   -931,   1383,  -1743, -17678,  22390,  -5574,   2832,  -1713,
-      1094,   -705,    447,   -275,    161,    -90,     46,    -22,      9,     -3,  1 },
-  {      0,      0,      0,      2,     -6,     15,    -35,     70,   -131,    227,
-      -375,    593,   -908,   1345,  -1672, -17743,  22383,  -5535,   2807,  -1696,
-      1084,   -699,    443,   -272,    160,    -89,     46,    -22,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -5,     15,    -33,     68,   -127,    221,
-      -365,    578,   -885,   1308,  -1601, -17807,  22376,  -5495,   2782,  -1680,
-      1073,   -692,    439,   -270,    159,    -88,     46,    -22,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -5,     14,    -32,     66,   -123,    215,
-      -356,    563,   -862,   1270,  -1531, -17871,  22368,  -5455,   2756,  -1664,
-      1063,   -685,    435,   -268,    157,    -87,     45,    -21,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -5,     13,    -31,     64,   -120,    209,
-      -346,    548,   -839,   1232,  -1461, -17934,  22359,  -5414,   2731,  -1648,
-      1052,   -679,    431,   -265,    156,    -87,     45,    -21,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -5,     13,    -30,     62,   -116,    203,
-      -337,    534,   -816,   1195,  -1390, -17997,  22351,  -5374,   2705,  -1631,
-      1042,   -672,    427,   -263,    155,    -86,     45,    -21,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -4,     12,    -29,     60,   -112,    197,
-      -327,    519,   -793,   1158,  -1320, -18060,  22341,  -5333,   2679,  -1615,
-      1031,   -665,    422,   -260,    153,    -85,     44,    -21,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -4,     12,    -28,     57,   -109,    191,
-      -318,    504,   -770,   1120,  -1250, -18122,  22332,  -5291,   2654,  -1598,
-      1020,   -658,    418,   -258,    152,    -85,     44,    -21,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -4,     11,    -26,     55,   -105,    185,
-      -308,    490,   -747,   1083,  -1181, -18184,  22322,  -5250,   2627,  -1581,
-      1009,   -651,    414,   -255,    150,    -84,     44,    -21,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -4,     11,    -25,     53,   -101,    179,
-      -299,    475,   -724,   1045,  -1111, -18246,  22311,  -5208,   2601,  -1564,
-       999,   -644,    410,   -253,    149,    -83,     43,    -21,      9,     -3,  1 },
-  {      0,      0,      0,      1,     -3,     10,    -24,     51,    -98,    173,
-      -289,    460,   -701,   1008,  -1042, -18307,  22300,  -5166,   2575,  -1547,
-       988,   -637,    405,   -250,    148,    -82,     43,    -20,      9,     -3,  1 },
-  {      0,      0,      0,      0,     -3,      9,    -23,     49,    -94,    167,
-      -280,    445,   -678,    971,   -973, -18367,  22288,  -5123,   2548,  -1530,
-       977,   -630,    401,   -248,    146,    -82,     42,    -20,      9,     -3,  1 },
-  {      0,      0,      0,      0,     -3,      9,    -22,     47,    -91,    161,
-      -271,    431,   -655,    933,   -904, -18427,  22276,  -5080,   2522,  -1513,
-       966,   -623,    397,   -245,    145,    -81,     42,    -20,      9,     -3,  1 },
-  {      0,      0,      0,      0,     -2,      8,    -21,     45,    -87,    156,
-      -261,    416,   -632,    896,   -835, -18487,  22264,  -5037,   2495,  -1496,
-       954,   -616,    392,   -242,    143,    -80,     42,    -20,      8,     -3,  1 },
-  {      0,      0,      0,      0,     -2,      8,    -20,     43,    -83,    150,
-      -252,    401,   -610,    859,   -766, -18547,  22251,  -4994,   2468,  -1479,
-       943,   -609,    388,   -240,    142,    -79,     41,    -20,      8,     -3,  1 },
-  {      0,      0,      0,      0,     -2,      7,    -18,     41,    -80,    144,
-      -242,    387,   -587,    822,   -698, -18606,  22237,  -4950,   2441,  -1461,
-       932,   -602,    384,   -237,    140,    -79,     41,    -20,      8,     -3,  1 },
-  {      0,      0,      0,      0,     -2,      6,    -17,     39,    -76,    138,
-      -233,    372,   -564,    785,   -630, -18664,  22223,  -4906,   2414,  -1444,
-       921,   -595,    379,   -235,    139,    -78,     41,    -19,      8,     -3,  1 },
-  {      0,      0,      0,      0,     -1,      6,    -16,     36,    -73,    132,
-      -223,    357,   -541,    748,   -562, -18722,  22209,  -4862,   2386,  -1427,
-       909,   -588,    375,   -232,    137,    -77,     40,    -19,      8,     -3,  1 },
-  {      0,      0,      0,      0,     -1,      5,    -15,     34,    -69,    126,
-      -214,    343,   -518,    711,   -494, -18780,  22194,  -4817,   2359,  -1409,
-       898,   -580,    370,   -229,    136,    -76,     40,    -19,      8,     -3,  1 },
-  {      0,      0,      0,      0,     -1,      5,    -14,     32,    -65,    120,
-      -205,    328,   -496,    674,   -426, -18837,  22178,  -4772,   2331,  -1391,
-       887,   -573,    366,   -227,    134,    -76,     40,    -19,      8,     -3,  1 },
-  {      0,      0,      1,      0,     -1,      4,    -13,     30,    -62,    114,
-      -195,    314,   -473,    637,   -358, -18894,  22163,  -4727,   2303,  -1373,
-       875,   -566,    361,   -224,    133,    -75,     39,    -19,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      0,      4,    -12,     28,    -58,    108,
-      -186,    299,   -450,    600,   -291, -18951,  22146,  -4681,   2275,  -1356,
-       864,   -558,    357,   -221,    131,    -74,     39,    -19,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      0,      3,    -10,     26,    -55,    102,
-      -177,    284,   -427,    564,   -224, -19007,  22130,  -4636,   2247,  -1338,
-       852,   -551,    352,   -218,    130,    -73,     38,    -18,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      0,      2,     -9,     24,    -51,     96,
-      -167,    270,   -405,    527,   -157, -19062,  22112,  -4589,   2219,  -1320,
-       840,   -544,    347,   -216,    128,    -72,     38,    -18,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      0,      2,     -8,     22,    -47,     91,
-      -158,    255,   -382,    490,    -90, -19117,  22095,  -4543,   2190,  -1301,
-       829,   -536,    343,   -213,    127,    -72,     38,    -18,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      1,      1,     -7,     20,    -44,     85,
-      -148,    241,   -359,    454,    -24, -19172,  22076,  -4496,   2162,  -1283,
-       817,   -529,    338,   -210,    125,    -71,     37,    -18,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      1,      1,     -6,     18,    -40,     79,
-      -139,    226,   -337,    417,     43, -19226,  22058,  -4450,   2133,  -1265,
-       805,   -521,    334,   -207,    124,    -70,     37,    -18,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      1,      0,     -5,     16,    -37,     73,
-      -130,    212,   -314,    381,    109, -19280,  22039,  -4402,   2104,  -1247,
-       793,   -514,    329,   -205,    122,    -69,     36,    -18,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      2,      0,     -4,     14,    -33,     67,
-      -121,    197,   -292,    344,    175, -19334,  22019,  -4355,   2076,  -1228,
-       781,   -506,    324,   -202,    121,    -68,     36,    -17,      8,     -3,  1 },
-  {      0,      0,      1,     -1,      2,     -1,     -3,     12,    -30,     61,
-      -111,    183,   -269,    308,    240, -19387,  21999,  -4307,   2046,  -1210,
-       769,   -498,    319,   -199,    119,    -67,     36,    -17,      8,     -3,  1 },
-  {      0,      0,      1,     -2,      2,     -2,     -2,     10,    -26,     55,
-      -102,    168,   -247,    271,    306, -19439,  21978,  -4259,   2017,  -1191,
-       757,   -491,    315,   -196,    117,    -67,     35,    -17,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      2,     -2,      0,      8,    -23,     50,
-       -93,    154,   -224,    235,    371, -19491,  21957,  -4211,   1988,  -1172,
-       745,   -483,    310,   -193,    116,    -66,     35,    -17,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      3,     -3,      1,      6,    -19,     44,
-       -83,    140,   -202,    199,    436, -19543,  21936,  -4162,   1958,  -1154,
-       733,   -475,    305,   -191,    114,    -65,     34,    -17,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      3,     -3,      2,      4,    -16,     38,
-       -74,    125,   -179,    163,    501, -19594,  21914,  -4113,   1929,  -1135,
-       721,   -467,    300,   -188,    113,    -64,     34,    -17,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      3,     -4,      3,      1,    -12,     32,
-       -65,    111,   -157,    127,    566, -19645,  21891,  -4064,   1899,  -1116,
-       709,   -460,    295,   -185,    111,    -63,     34,    -16,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      3,     -4,      4,     -1,     -9,     26,
-       -56,     96,   -135,     91,    631, -19696,  21868,  -4014,   1869,  -1097,
-       697,   -452,    291,   -182,    109,    -62,     33,    -16,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      4,     -5,      5,     -3,     -5,     21,
-       -47,     82,   -112,     55,    695, -19746,  21845,  -3964,   1839,  -1078,
-       684,   -444,    286,   -179,    108,    -61,     33,    -16,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      4,     -5,      6,     -5,     -2,     15,
-       -37,     68,    -90,     19,    759, -19795,  21821,  -3914,   1809,  -1059,
-       672,   -436,    281,   -176,    106,    -61,     32,    -16,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      4,     -6,      7,     -7,      2,      9,
-       -28,     53,    -68,    -16,    823, -19844,  21797,  -3864,   1779,  -1039,
-       660,   -428,    276,   -173,    104,    -60,     32,    -16,      7,     -3,  1 },
-  {      0,      0,      1,     -2,      4,     -6,      8,     -9,      5,      3,
-       -19,     39,    -46,    -52,    886, -19893,  21772,  -3813,   1748,  -1020,
-       647,   -420,    271,   -170,    103,    -59,     31,    -15,      7,     -3,  1 },
-  {      0,      0,      1,     -3,      5,     -7,      9,    -11,      9,     -2,
-       -10,     25,    -23,    -88,    950, -19941,  21747,  -3762,   1718,  -1001,
-       635,   -412,    266,   -167,    101,    -58,     31,    -15,      7,     -3,  1 },
-  {      0,      0,      1,     -3,      5,     -8,     10,    -13,     12,     -8,
-        -1,     11,     -1,   -123,   1013, -19989,  21721,  -3711,   1687,   -981,
-       622,   -404,    261,   -164,     99,    -57,     31,    -15,      7,     -3,  1 },
-  {      0,      0,      1,     -3,      5,     -8,     12,    -15,     16,    -14,
-         8,     -3,     21,   -159,   1076, -20036,  21695,  -3660,   1657,   -962,
-       610,   -396,    256,   -161,     98,    -56,     30,    -15,      7,     -3,  1 },
-  {      0,      0,      1,     -3,      5,     -9,     13,    -17,     19,    -19,
-        17,    -18,     43,   -194,   1139, -20083,  21668,  -3608,   1626,   -942,
-       597,   -388,    251,   -158,     96,    -55,     30,    -15,      7,     -3,  1 },
-  {      0,     -1,      1,     -3,      6,     -9,     14,    -18,     23,    -25,
-        26,    -32,     65,   -229,   1201, -20130,  21641,  -3556,   1595,   -923,
-       584,   -380,    246,   -155,     94,    -54,     29,    -15,      6,     -2,  1 },
-  {      0,     -1,      1,     -3,      6,    -10,     15,    -20,     26,    -31,
-        35,    -46,     87,   -265,   1263, -20176,  21613,  -3504,   1564,   -903,
-       572,   -372,    241,   -152,     93,    -53,     29,    -14,      6,     -2,  1 },
-  {      0,     -1,      1,     -3,      6,    -10,     16,    -22,     29,    -36,
-        44,    -60,    109,   -300,   1326, -20221,  21585,  -3451,   1532,   -883,
-       559,   -364,    236,   -149,     91,    -52,     28,    -14,      6,     -2,  1 },
-  {      0,     -1,      1,     -3,      6,    -11,     17,    -24,     33,    -42,
-        54,    -74,    131,   -335,   1387, -20266,  21557,  -3398,   1501,   -863,
-       546,   -356,    231,   -146,     89,    -52,     28,    -14,      6,     -2,  1 },
-  {      0,     -1,      1,     -3,      6,    -11,     18,    -26,     36,    -48,
-        63,    -88,    152,   -370,   1449, -20311,  21528,  -3345,   1469,   -843,
-       533,   -347,    226,   -143,     87,    -51,     27,    -14,      6,     -2,  1 },
-  {      0,     -1,      2,     -3,      7,    -12,     19,    -28,     40,    -53,
-        71,   -102,    174,   -405,   1510, -20355,  21498,  -3292,   1438,   -823,
-       520,   -339,    221,   -140,     86,    -50,     27,    -14,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      7,    -12,     20,    -30,     43,    -59,
-        80,   -116,    196,   -439,   1572, -20399,  21468,  -3238,   1406,   -803,
-       507,   -331,    215,   -137,     84,    -49,     27,    -13,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      7,    -13,     21,    -32,     46,    -65,
-        89,   -130,    218,   -474,   1632, -20442,  21438,  -3184,   1374,   -783,
-       494,   -323,    210,   -134,     82,    -48,     26,    -13,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      7,    -13,     22,    -34,     50,    -70,
-        98,   -144,    239,   -509,   1693, -20485,  21407,  -3130,   1342,   -763,
-       481,   -314,    205,   -131,     80,    -47,     26,    -13,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      8,    -14,     23,    -36,     53,    -76,
-       107,   -158,    261,   -543,   1754, -20527,  21376,  -3076,   1310,   -743,
-       468,   -306,    200,   -128,     79,    -46,     25,    -13,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      8,    -14,     24,    -38,     57,    -81,
-       116,   -172,    282,   -578,   1814, -20569,  21344,  -3021,   1278,   -723,
-       455,   -298,    195,   -125,     77,    -45,     25,    -12,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      8,    -15,     25,    -40,     60,    -87,
-       125,   -186,    304,   -612,   1874, -20611,  21312,  -2966,   1246,   -702,
-       442,   -289,    189,   -121,     75,    -44,     24,    -12,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      8,    -15,     26,    -42,     63,    -92,
-       134,   -199,    325,   -646,   1933, -20652,  21279,  -2911,   1213,   -682,
-       429,   -281,    184,   -118,     73,    -43,     24,    -12,      6,     -2,  1 },
-  {      0,     -1,      2,     -4,      9,    -16,     27,    -44,     67,    -98,
-       143,   -213,    347,   -680,   1993, -20692,  21246,  -2856,   1181,   -661,
-       416,   -272,    179,   -115,     71,    -42,     23,    -12,      5,     -2,  1 },
-  {      0,     -1,      2,     -4,      9,    -16,     28,    -46,     70,   -103,
-       151,   -227,    368,   -714,   2052, -20732,  21212,  -2800,   1148,   -641,
-       402,   -264,    174,   -112,     70,    -41,     23,    -12,      5,     -2,  1 },
-  {      0,     -1,      2,     -4,      9,    -17,     29,    -47,     73,   -109,
-       160,   -241,    389,   -748,   2111, -20772,  21178,  -2744,   1115,   -620,
-       389,   -255,    168,   -109,     68,    -40,     22,    -11,      5,     -2,  1 },
-  {      0,     -1,      2,     -4,      9,    -17,     30,    -49,     76,   -114,
-       169,   -254,    411,   -782,   2170, -20811,  21143,  -2688,   1083,   -599,
-       376,   -247,    163,   -106,     66,    -39,     22,    -11,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,      9,    -18,     31,    -51,     80,   -120,
-       178,   -268,    432,   -816,   2228, -20850,  21108,  -2631,   1050,   -579,
-       363,   -238,    158,   -102,     64,    -38,     21,    -11,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     10,    -18,     32,    -53,     83,   -125,
-       186,   -282,    453,   -850,   2287, -20888,  21073,  -2574,   1017,   -558,
-       349,   -230,    152,    -99,     62,    -37,     21,    -11,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     10,    -19,     33,    -55,     86,   -131,
-       195,   -295,    474,   -883,   2345, -20926,  21037,  -2517,    983,   -537,
-       336,   -221,    147,    -96,     61,    -36,     20,    -11,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     10,    -19,     34,    -57,     89,   -136,
-       204,   -309,    495,   -917,   2403, -20963,  21000,  -2460,    950,   -516,
-       322,   -212,    142,    -93,     59,    -35,     20,    -10,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     10,    -20,     35,    -59,     93,   -142,
-       212,   -322,    516,   -950,   2460, -21000,  20963,  -2403,    917,   -495,
-       309,   -204,    136,    -89,     57,    -34,     19,    -10,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     11,    -20,     36,    -61,     96,   -147,
-       221,   -336,    537,   -983,   2517, -21037,  20926,  -2345,    883,   -474,
-       295,   -195,    131,    -86,     55,    -33,     19,    -10,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     11,    -21,     37,    -62,     99,   -152,
-       230,   -349,    558,  -1017,   2574, -21073,  20888,  -2287,    850,   -453,
-       282,   -186,    125,    -83,     53,    -32,     18,    -10,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     11,    -21,     38,    -64,    102,   -158,
-       238,   -363,    579,  -1050,   2631, -21108,  20850,  -2228,    816,   -432,
-       268,   -178,    120,    -80,     51,    -31,     18,     -9,      5,     -2,  1 },
-  {      0,     -1,      2,     -5,     11,    -22,     39,    -66,    106,   -163,
-       247,   -376,    599,  -1083,   2688, -21143,  20811,  -2170,    782,   -411,
-       254,   -169,    114,    -76,     49,    -30,     17,     -9,      4,     -2,  1 },
-  {      0,     -1,      2,     -5,     11,    -22,     40,    -68,    109,   -168,
-       255,   -389,    620,  -1115,   2744, -21178,  20772,  -2111,    748,   -389,
-       241,   -160,    109,    -73,     47,    -29,     17,     -9,      4,     -2,  1 },
-  {      0,     -1,      2,     -5,     12,    -23,     41,    -70,    112,   -174,
-       264,   -402,    641,  -1148,   2800, -21212,  20732,  -2052,    714,   -368,
-       227,   -151,    103,    -70,     46,    -28,     16,     -9,      4,     -2,  1 },
-  {      0,     -1,      2,     -5,     12,    -23,     42,    -71,    115,   -179,
-       272,   -416,    661,  -1181,   2856, -21246,  20692,  -1993,    680,   -347,
-       213,   -143,     98,    -67,     44,    -27,     16,     -9,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     12,    -24,     43,    -73,    118,   -184,
-       281,   -429,    682,  -1213,   2911, -21279,  20652,  -1933,    646,   -325,
-       199,   -134,     92,    -63,     42,    -26,     15,     -8,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     12,    -24,     44,    -75,    121,   -189,
-       289,   -442,    702,  -1246,   2966, -21312,  20611,  -1874,    612,   -304,
-       186,   -125,     87,    -60,     40,    -25,     15,     -8,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     12,    -25,     45,    -77,    125,   -195,
-       298,   -455,    723,  -1278,   3021, -21344,  20569,  -1814,    578,   -282,
-       172,   -116,     81,    -57,     38,    -24,     14,     -8,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     13,    -25,     46,    -79,    128,   -200,
-       306,   -468,    743,  -1310,   3076, -21376,  20527,  -1754,    543,   -261,
-       158,   -107,     76,    -53,     36,    -23,     14,     -8,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     13,    -26,     47,    -80,    131,   -205,
-       314,   -481,    763,  -1342,   3130, -21407,  20485,  -1693,    509,   -239,
-       144,    -98,     70,    -50,     34,    -22,     13,     -7,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     13,    -26,     48,    -82,    134,   -210,
-       323,   -494,    783,  -1374,   3184, -21438,  20442,  -1632,    474,   -218,
-       130,    -89,     65,    -46,     32,    -21,     13,     -7,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     13,    -27,     49,    -84,    137,   -215,
-       331,   -507,    803,  -1406,   3238, -21468,  20399,  -1572,    439,   -196,
-       116,    -80,     59,    -43,     30,    -20,     12,     -7,      4,     -2,  1 },
-  {      0,     -1,      2,     -6,     14,    -27,     50,    -86,    140,   -221,
-       339,   -520,    823,  -1438,   3292, -21498,  20355,  -1510,    405,   -174,
-       102,    -71,     53,    -40,     28,    -19,     12,     -7,      3,     -2,  1 },
-  {      0,     -1,      2,     -6,     14,    -27,     51,    -87,    143,   -226,
-       347,   -533,    843,  -1469,   3345, -21528,  20311,  -1449,    370,   -152,
-        88,    -63,     48,    -36,     26,    -18,     11,     -6,      3,     -1,  1 },
-  {      0,     -1,      2,     -6,     14,    -28,     52,    -89,    146,   -231,
-       356,   -546,    863,  -1501,   3398, -21557,  20266,  -1387,    335,   -131,
-        74,    -54,     42,    -33,     24,    -17,     11,     -6,      3,     -1,  1 },
-  {      0,     -1,      2,     -6,     14,    -28,     52,    -91,    149,   -236,
-       364,   -559,    883,  -1532,   3451, -21585,  20221,  -1326,    300,   -109,
-        60,    -44,     36,    -29,     22,    -16,     10,     -6,      3,     -1,  1 },
-  {      0,     -1,      2,     -6,     14,    -29,     53,    -93,    152,   -241,
-       372,   -572,    903,  -1564,   3504, -21613,  20176,  -1263,    265,    -87,
-        46,    -35,     31,    -26,     20,    -15,     10,     -6,      3,     -1,  1 },
-  {      0,     -1,      2,     -6,     15,    -29,     54,    -94,    155,   -246,
-       380,   -584,    923,  -1595,   3556, -21641,  20130,  -1201,    229,    -65,
-        32,    -26,     25,    -23,     18,    -14,      9,     -6,      3,     -1,  1 },
-  {      0,     -1,      3,     -7,     15,    -30,     55,    -96,    158,   -251,
-       388,   -597,    942,  -1626,   3608, -21668,  20083,  -1139,    194,    -43,
-        18,    -17,     19,    -19,     17,    -13,      9,     -5,      3,     -1,  0 },
-  {      0,     -1,      3,     -7,     15,    -30,     56,    -98,    161,   -256,
-       396,   -610,    962,  -1657,   3660, -21695,  20036,  -1076,    159,    -21,
-         3,     -8,     14,    -16,     15,    -12,      8,     -5,      3,     -1,  0 },
-  {      0,     -1,      3,     -7,     15,    -31,     57,    -99,    164,   -261,
-       404,   -622,    981,  -1687,   3711, -21721,  19989,  -1013,    123,      1,
-       -11,      1,      8,    -12,     13,    -10,      8,     -5,      3,     -1,  0 },
-  {      0,     -1,      3,     -7,     15,    -31,     58,   -101,    167,   -266,
-       412,   -635,   1001,  -1718,   3762, -21747,  19941,   -950,     88,     23,
-       -25,     10,      2,     -9,     11,     -9,      7,     -5,      3,     -1,  0 },
-  {      0,     -1,      3,     -7,     15,    -31,     59,   -103,    170,   -271,
-       420,   -647,   1020,  -1748,   3813, -21772,  19893,   -886,     52,     46,
-       -39,     19,     -3,     -5,      9,     -8,      6,     -4,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     16,    -32,     60,   -104,    173,   -276,
-       428,   -660,   1039,  -1779,   3864, -21797,  19844,   -823,     16,     68,
-       -53,     28,     -9,     -2,      7,     -7,      6,     -4,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     16,    -32,     61,   -106,    176,   -281,
-       436,   -672,   1059,  -1809,   3914, -21821,  19795,   -759,    -19,     90,
-       -68,     37,    -15,      2,      5,     -6,      5,     -4,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     16,    -33,     61,   -108,    179,   -286,
-       444,   -684,   1078,  -1839,   3964, -21845,  19746,   -695,    -55,    112,
-       -82,     47,    -21,      5,      3,     -5,      5,     -4,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     16,    -33,     62,   -109,    182,   -291,
-       452,   -697,   1097,  -1869,   4014, -21868,  19696,   -631,    -91,    135,
-       -96,     56,    -26,      9,      1,     -4,      4,     -3,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     16,    -34,     63,   -111,    185,   -295,
-       460,   -709,   1116,  -1899,   4064, -21891,  19645,   -566,   -127,    157,
-      -111,     65,    -32,     12,     -1,     -3,      4,     -3,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     17,    -34,     64,   -113,    188,   -300,
-       467,   -721,   1135,  -1929,   4113, -21914,  19594,   -501,   -163,    179,
-      -125,     74,    -38,     16,     -4,     -2,      3,     -3,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     17,    -34,     65,   -114,    191,   -305,
-       475,   -733,   1154,  -1958,   4162, -21936,  19543,   -436,   -199,    202,
-      -140,     83,    -44,     19,     -6,     -1,      3,     -3,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     17,    -35,     66,   -116,    193,   -310,
-       483,   -745,   1172,  -1988,   4211, -21957,  19491,   -371,   -235,    224,
-      -154,     93,    -50,     23,     -8,      0,      2,     -2,      2,     -1,  0 },
-  {      0,     -1,      3,     -7,     17,    -35,     67,   -117,    196,   -315,
-       491,   -757,   1191,  -2017,   4259, -21978,  19439,   -306,   -271,    247,
-      -168,    102,    -55,     26,    -10,      2,      2,     -2,      2,     -1,  0 },
-  {      0,     -1,      3,     -8,     17,    -36,     67,   -119,    199,   -319,
-       498,   -769,   1210,  -2046,   4307, -21999,  19387,   -240,   -308,    269,
-      -183,    111,    -61,     30,    -12,      3,      1,     -2,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     17,    -36,     68,   -121,    202,   -324,
-       506,   -781,   1228,  -2076,   4355, -22019,  19334,   -175,   -344,    292,
-      -197,    121,    -67,     33,    -14,      4,      0,     -2,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     18,    -36,     69,   -122,    205,   -329,
-       514,   -793,   1247,  -2104,   4402, -22039,  19280,   -109,   -381,    314,
-      -212,    130,    -73,     37,    -16,      5,      0,     -1,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     18,    -37,     70,   -124,    207,   -334,
-       521,   -805,   1265,  -2133,   4450, -22058,  19226,    -43,   -417,    337,
-      -226,    139,    -79,     40,    -18,      6,     -1,     -1,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     18,    -37,     71,   -125,    210,   -338,
-       529,   -817,   1283,  -2162,   4496, -22076,  19172,     24,   -454,    359,
-      -241,    148,    -85,     44,    -20,      7,     -1,     -1,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     18,    -38,     72,   -127,    213,   -343,
-       536,   -829,   1301,  -2190,   4543, -22095,  19117,     90,   -490,    382,
-      -255,    158,    -91,     47,    -22,      8,     -2,      0,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     18,    -38,     72,   -128,    216,   -347,
-       544,   -840,   1320,  -2219,   4589, -22112,  19062,    157,   -527,    405,
-      -270,    167,    -96,     51,    -24,      9,     -2,      0,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     18,    -38,     73,   -130,    218,   -352,
-       551,   -852,   1338,  -2247,   4636, -22130,  19007,    224,   -564,    427,
-      -284,    177,   -102,     55,    -26,     10,     -3,      0,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     19,    -39,     74,   -131,    221,   -357,
-       558,   -864,   1356,  -2275,   4681, -22146,  18951,    291,   -600,    450,
-      -299,    186,   -108,     58,    -28,     12,     -4,      0,      1,     -1,  0 },
-  {      0,     -1,      3,     -8,     19,    -39,     75,   -133,    224,   -361,
-       566,   -875,   1373,  -2303,   4727, -22163,  18894,    358,   -637,    473,
-      -314,    195,   -114,     62,    -30,     13,     -4,      1,      0,     -1,  0 },
-  {      0,     -1,      3,     -8,     19,    -40,     76,   -134,    227,   -366,
-       573,   -887,   1391,  -2331,   4772, -22178,  18837,    426,   -674,    496,
-      -328,    205,   -120,     65,    -32,     14,     -5,      1,      0,      0,  0 },
-  {      0,     -1,      3,     -8,     19,    -40,     76,   -136,    229,   -370,
-       580,   -898,   1409,  -2359,   4817, -22194,  18780,    494,   -711,    518,
-      -343,    214,   -126,     69,    -34,     15,     -5,      1,      0,      0,  0 },
-  {      0,     -1,      3,     -8,     19,    -40,     77,   -137,    232,   -375,
-       588,   -909,   1427,  -2386,   4862, -22209,  18722,    562,   -748,    541,
-      -357,    223,   -132,     73,    -36,     16,     -6,      1,      0,      0,  0 },
-  {      0,     -1,      3,     -8,     19,    -41,     78,   -139,    235,   -379,
-       595,   -921,   1444,  -2414,   4906, -22223,  18664,    630,   -785,    564,
-      -372,    233,   -138,     76,    -39,     17,     -6,      2,      0,      0,  0 },
-  {      0,     -1,      3,     -8,     20,    -41,     79,   -140,    237,   -384,
-       602,   -932,   1461,  -2441,   4950, -22237,  18606,    698,   -822,    587,
-      -387,    242,   -144,     80,    -41,     18,     -7,      2,      0,      0,  0 },
-  {      0,     -1,      3,     -8,     20,    -41,     79,   -142,    240,   -388,
-       609,   -943,   1479,  -2468,   4994, -22251,  18547,    766,   -859,    610,
-      -401,    252,   -150,     83,    -43,     20,     -8,      2,      0,      0,  0 },
-  {      0,     -1,      3,     -8,     20,    -42,     80,   -143,    242,   -392,
-       616,   -954,   1496,  -2495,   5037, -22264,  18487,    835,   -896,    632,
-      -416,    261,   -156,     87,    -45,     21,     -8,      2,      0,      0,  0 },
-  {      0,     -1,      3,     -9,     20,    -42,     81,   -145,    245,   -397,
-       623,   -966,   1513,  -2522,   5080, -22276,  18427,    904,   -933,    655,
-      -431,    271,   -161,     91,    -47,     22,     -9,      3,      0,      0,  0 },
-  {      0,     -1,      3,     -9,     20,    -42,     82,   -146,    248,   -401,
-       630,   -977,   1530,  -2548,   5123, -22288,  18367,    973,   -971,    678,
-      -445,    280,   -167,     94,    -49,     23,     -9,      3,      0,      0,  0 },
-  {      0,     -1,      3,     -9,     20,    -43,     82,   -148,    250,   -405,
-       637,   -988,   1547,  -2575,   5166, -22300,  18307,   1042,  -1008,    701,
-      -460,    289,   -173,     98,    -51,     24,    -10,      3,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     21,    -43,     83,   -149,    253,   -410,
-       644,   -999,   1564,  -2601,   5208, -22311,  18246,   1111,  -1045,    724,
-      -475,    299,   -179,    101,    -53,     25,    -11,      4,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     21,    -44,     84,   -150,    255,   -414,
-       651,  -1009,   1581,  -2627,   5250, -22322,  18184,   1181,  -1083,    747,
-      -490,    308,   -185,    105,    -55,     26,    -11,      4,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     21,    -44,     85,   -152,    258,   -418,
-       658,  -1020,   1598,  -2654,   5291, -22332,  18122,   1250,  -1120,    770,
-      -504,    318,   -191,    109,    -57,     28,    -12,      4,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     21,    -44,     85,   -153,    260,   -422,
-       665,  -1031,   1615,  -2679,   5333, -22341,  18060,   1320,  -1158,    793,
-      -519,    327,   -197,    112,    -60,     29,    -12,      4,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     21,    -45,     86,   -155,    263,   -427,
-       672,  -1042,   1631,  -2705,   5374, -22351,  17997,   1390,  -1195,    816,
-      -534,    337,   -203,    116,    -62,     30,    -13,      5,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     21,    -45,     87,   -156,    265,   -431,
-       679,  -1052,   1648,  -2731,   5414, -22359,  17934,   1461,  -1232,    839,
-      -548,    346,   -209,    120,    -64,     31,    -13,      5,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     21,    -45,     87,   -157,    268,   -435,
-       685,  -1063,   1664,  -2756,   5455, -22368,  17871,   1531,  -1270,    862,
-      -563,    356,   -215,    123,    -66,     32,    -14,      5,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     22,    -46,     88,   -159,    270,   -439,
-       692,  -1073,   1680,  -2782,   5495, -22376,  17807,   1601,  -1308,    885,
-      -578,    365,   -221,    127,    -68,     33,    -15,      5,     -1,      0,  0 },
-  {      0,     -1,      3,     -9,     22,    -46,     89,   -160,    272,   -443,
-       699,  -1084,   1696,  -2807,   5535, -22383,  17743,   1672,  -1345,    908,
-      -593,    375,   -227,    131,    -70,     35,    -15,      6,     -2,      0,  0 },
-  {      0,     -1,      3,     -9,     22,    -46,     90,   -161,    275,   -447,
-       705,  -1094,   1713,  -2832,   5574, -22390,  17678,   1743,  -1383,    931,
-      -607,    384,   -233,    134,    -72,     36,    -16,      6,     -2,      0,  0 },
-  {      0,     -1,      3,     -9,     22,    -47,     90,   -163,    277,   -451,
-       712,  -1105,   1729,  -2857,   5614, -22396,  17613,   1814,  -1420,    954,
-      -622,    394,   -239,    138,    -74,     37,    -16,      6,     -2,      0,  0 },
-  {      0,     -1,      3,     -9,     22,    -47,     91,   -164,    280,   -455,
-       718,  -1115,   1745,  -2881,   5652, -22402,  17547,   1885,  -1458,    977,
-      -637,    403,   -245,    142,    -77,     38,    -17,      7,     -2,      0,  0 },
-  {      0,     -1,      3,     -9,     22,    -47,     92,   -165,    282,   -459,
-       725,  -1125,   1760,  -2906,   5691, -22408,  17482,   1957,  -1496,   1000,
-      -652,    413,   -251,    145,    -79,     39,    -18,      7,     -2,      0,  0 },
-  {      0,     -1,      3,     -9,     22,    -48,     92,   -167,    284,   -463,
-       731,  -1135,   1776,  -2930,   5729, -22413,  17415,   2028,  -1534,   1023,
-      -666,    422,   -257,    149,    -81,     40,    -18,      7,     -2,      0,  0 },
-  {      0,     -1,      3,     -9,     23,    -48,     93,   -168,    287,   -467,
-       738,  -1145,   1792,  -2954,   5767, -22417,  17349,   2100,  -1571,   1046,
-      -681,    432,   -263,    153,    -83,     42,    -19,      7,     -2,      0,  0 },
-  {      0,     -1,      3,     -9,     23,    -48,     94,   -169,    289,   -471,
-       744,  -1156,   1807,  -2978,   5805, -22421,  17282,   2171,  -1609,   1069,
-      -696,    441,   -269,    156,    -85,     43,    -19,      8,     -2,      0,  0 },
-  {      0,     -1,      3,    -10,     23,    -48,     94,   -170,    291,   -475,
-       750,  -1166,   1823,  -3002,   5842, -22425,  17214,   2243,  -1647,   1092,
-      -711,    451,   -275,    160,    -87,     44,    -20,      8,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     23,    -49,     95,   -172,    293,   -479,
-       757,  -1175,   1838,  -3026,   5879, -22428,  17146,   2315,  -1685,   1115,
-      -725,    460,   -281,    164,    -89,     45,    -21,      8,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     23,    -49,     96,   -173,    296,   -483,
-       763,  -1185,   1853,  -3050,   5916, -22431,  17078,   2388,  -1723,   1138,
-      -740,    470,   -287,    167,    -92,     46,    -21,      9,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     23,    -49,     96,   -174,    298,   -487,
-       769,  -1195,   1868,  -3073,   5953, -22433,  17009,   2460,  -1760,   1162,
-      -755,    479,   -293,    171,    -94,     48,    -22,      9,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     23,    -50,     97,   -175,    300,   -490,
-       775,  -1205,   1883,  -3096,   5989, -22435,  16940,   2533,  -1798,   1185,
-      -770,    488,   -299,    175,    -96,     49,    -22,      9,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     23,    -50,     97,   -177,    302,   -494,
-       782,  -1214,   1898,  -3119,   6025, -22436,  16871,   2605,  -1836,   1208,
-      -784,    498,   -305,    178,    -98,     50,    -23,      9,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     23,    -50,     98,   -178,    304,   -498,
-       788,  -1224,   1913,  -3142,   6060, -22437,  16801,   2678,  -1874,   1231,
-      -799,    507,   -311,    182,   -100,     51,    -24,     10,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     24,    -51,     99,   -179,    307,   -502,
-       794,  -1234,   1928,  -3165,   6095, -22437,  16731,   2751,  -1912,   1254,
-      -814,    517,   -317,    186,   -102,     52,    -24,     10,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     24,    -51,     99,   -180,    309,   -505,
-       800,  -1243,   1943,  -3188,   6130, -22437,  16661,   2824,  -1950,   1277,
-      -829,    526,   -323,    189,   -104,     54,    -25,     10,     -3,      1,  0 },
-  {      0,     -1,      3,    -10,     24,    -51,    100,   -181,    311,   -509,
-       806,  -1253,   1957,  -3210,   6165, -22436,  16590,   2897,  -1988,   1300,
-      -843,    536,   -329,    193,   -107,     55,    -26,     11,     -4,      1,  0 },
-  {      0,     -1,      3,    -10,     24,    -51,    100,   -183,    313,   -513,
-       812,  -1262,   1972,  -3232,   6199, -22435,  16518,   2970,  -2025,   1323,
-      -858,    545,   -335,    197,   -109,     56,    -26,     11,     -4,      1,  0 },
-  {      0,     -1,      3,    -10,     24,    -52,    101,   -184,    315,   -516,
-       817,  -1271,   1986,  -3255,   6233, -22434,  16447,   3044,  -2063,   1346,
-      -873,    555,   -341,    200,   -111,     57,    -27,     11,     -4,      1,  0 },
-  {      0,     -1,      4,    -10,     24,    -52,    102,   -185,    317,   -520,
-       823,  -1280,   2000,  -3276,   6267, -22432,  16375,   3118,  -2101,   1369,
-      -887,    564,   -347,    204,   -113,     58,    -27,     11,     -4,      1,  0 },
-  {      0,     -1,      4,    -10,     24,    -52,    102,   -186,    319,   -523,
-       829,  -1290,   2014,  -3298,   6300, -22429,  16302,   3191,  -2139,   1392,
-      -902,    574,   -353,    208,   -115,     59,    -28,     12,     -4,      1,  0 },
-  {      0,     -1,      4,    -10,     24,    -52,    103,   -187,    321,   -527,
-       835,  -1299,   2029,  -3320,   6333, -22427,  16229,   3265,  -2177,   1415,
-      -917,    583,   -359,    211,   -117,     61,    -29,     12,     -4,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -53,    103,   -188,    323,   -530,
-       841,  -1308,   2042,  -3341,   6366, -22423,  16156,   3339,  -2215,   1438,
-      -931,    593,   -365,    215,   -120,     62,    -29,     12,     -4,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -53,    104,   -189,    325,   -534,
-       846,  -1317,   2056,  -3363,   6398, -22419,  16083,   3413,  -2253,   1460,
-      -946,    602,   -371,    219,   -122,     63,    -30,     13,     -4,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -53,    104,   -191,    327,   -537,
-       852,  -1326,   2070,  -3384,   6430, -22415,  16009,   3487,  -2291,   1483,
-      -961,    611,   -377,    222,   -124,     64,    -30,     13,     -5,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -53,    105,   -192,    329,   -541,
-       857,  -1334,   2084,  -3405,   6462, -22410,  15935,   3562,  -2329,   1506,
-      -975,    621,   -383,    226,   -126,     65,    -31,     13,     -5,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -54,    106,   -193,    331,   -544,
-       863,  -1343,   2097,  -3425,   6493, -22405,  15860,   3636,  -2367,   1529,
-      -990,    630,   -389,    230,   -128,     67,    -32,     13,     -5,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -54,    106,   -194,    333,   -547,
-       869,  -1352,   2111,  -3446,   6524, -22399,  15785,   3711,  -2405,   1552,
-     -1005,    640,   -395,    233,   -130,     68,    -32,     14,     -5,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -54,    107,   -195,    335,   -551,
-       874,  -1360,   2124,  -3466,   6555, -22393,  15710,   3785,  -2442,   1575,
-     -1019,    649,   -401,    237,   -132,     69,    -33,     14,     -5,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -54,    107,   -196,    337,   -554,
-       879,  -1369,   2137,  -3487,   6586, -22387,  15634,   3860,  -2480,   1598,
-     -1034,    658,   -407,    241,   -135,     70,    -34,     14,     -5,      1,  0 },
-  {      0,     -1,      4,    -10,     25,    -55,    108,   -197,    339,   -557,
-       885,  -1377,   2150,  -3507,   6616, -22380,  15558,   3935,  -2518,   1621,
-     -1048,    668,   -413,    244,   -137,     71,    -34,     15,     -5,      2,  0 },
-  {      0,     -1,      4,    -10,     25,    -55,    108,   -198,    341,   -561,
-       890,  -1386,   2163,  -3527,   6646, -22372,  15482,   4010,  -2556,   1643,
-     -1063,    677,   -419,    248,   -139,     73,    -35,     15,     -5,      2,  0 },
-  {      0,     -1,      4,    -10,     26,    -55,    109,   -199,    343,   -564,
-       895,  -1394,   2176,  -3547,   6675, -22364,  15405,   4085,  -2594,   1666,
-     -1077,    687,   -425,    252,   -141,     74,    -35,     15,     -6,      2,  0 },
-  {      0,     -1,      4,    -10,     26,    -55,    109,   -200,    345,   -567,
-       901,  -1403,   2189,  -3566,   6704, -22356,  15328,   4160,  -2632,   1689,
-     -1092,    696,   -431,    255,   -143,     75,    -36,     15,     -6,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -56,    110,   -201,    347,   -570,
-       906,  -1411,   2202,  -3586,   6733, -22347,  15250,   4235,  -2669,   1712,
-     -1106,    705,   -436,    259,   -145,     76,    -37,     16,     -6,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -56,    110,   -202,    348,   -573,
-       911,  -1419,   2214,  -3605,   6762, -22338,  15172,   4311,  -2707,   1734,
-     -1121,    715,   -442,    262,   -147,     77,    -37,     16,     -6,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -56,    111,   -203,    350,   -576,
-       916,  -1427,   2227,  -3624,   6790, -22328,  15094,   4386,  -2745,   1757,
-     -1135,    724,   -448,    266,   -150,     79,    -38,     16,     -6,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -56,    111,   -204,    352,   -579,
-       921,  -1435,   2239,  -3643,   6818, -22318,  15016,   4462,  -2783,   1780,
-     -1150,    733,   -454,    270,   -152,     80,    -38,     17,     -6,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -57,    112,   -205,    354,   -582,
-       926,  -1443,   2252,  -3661,   6846, -22307,  14937,   4538,  -2820,   1802,
-     -1164,    743,   -460,    273,   -154,     81,    -39,     17,     -6,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -57,    112,   -206,    355,   -586,
-       931,  -1451,   2264,  -3680,   6873, -22296,  14858,   4613,  -2858,   1825,
-     -1179,    752,   -466,    277,   -156,     82,    -40,     17,     -6,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -57,    113,   -207,    357,   -589,
-       936,  -1459,   2276,  -3698,   6900, -22285,  14778,   4689,  -2896,   1848,
-     -1193,    761,   -472,    281,   -158,     83,    -40,     18,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -57,    113,   -208,    359,   -591,
-       941,  -1466,   2288,  -3717,   6927, -22273,  14698,   4765,  -2933,   1870,
-     -1207,    770,   -478,    284,   -160,     85,    -41,     18,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -57,    114,   -209,    361,   -594,
-       946,  -1474,   2300,  -3735,   6953, -22260,  14618,   4841,  -2971,   1893,
-     -1222,    780,   -484,    288,   -162,     86,    -42,     18,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     26,    -58,    114,   -209,    362,   -597,
-       951,  -1482,   2311,  -3752,   6979, -22247,  14538,   4917,  -3008,   1915,
-     -1236,    789,   -490,    292,   -165,     87,    -42,     18,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     27,    -58,    114,   -210,    364,   -600,
-       955,  -1489,   2323,  -3770,   7005, -22234,  14457,   4993,  -3046,   1937,
-     -1250,    798,   -495,    295,   -167,     88,    -43,     19,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     27,    -58,    115,   -211,    366,   -603,
-       960,  -1497,   2334,  -3788,   7030, -22220,  14376,   5070,  -3083,   1960,
-     -1265,    807,   -501,    299,   -169,     89,    -43,     19,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     27,    -58,    115,   -212,    367,   -606,
-       965,  -1504,   2346,  -3805,   7055, -22206,  14294,   5146,  -3121,   1982,
-     -1279,    816,   -507,    302,   -171,     90,    -44,     19,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     27,    -58,    116,   -213,    369,   -609,
-       969,  -1511,   2357,  -3822,   7080, -22191,  14212,   5222,  -3158,   2005,
-     -1293,    826,   -513,    306,   -173,     92,    -45,     20,     -7,      2,  0 },
-  {      0,     -1,      4,    -11,     27,    -59,    116,   -214,    370,   -611,
-       974,  -1519,   2368,  -3839,   7105, -22176,  14130,   5299,  -3196,   2027,
-     -1307,    835,   -519,    310,   -175,     93,    -45,     20,     -8,      2,  0 },
-  {      0,     -1,      4,    -11,     27,    -59,    117,   -215,    372,   -614,
-       978,  -1526,   2379,  -3856,   7129, -22160,  14048,   5376,  -3233,   2049,
-     -1321,    844,   -525,    313,   -177,     94,    -46,     20,     -8,      2, -1 },
-  {      0,     -1,      4,    -11,     27,    -59,    117,   -216,    374,   -617,
-       983,  -1533,   2390,  -3872,   7153, -22144,  13965,   5452,  -3270,   2071,
-     -1335,    853,   -530,    317,   -179,     95,    -47,     20,     -8,      2, -1 },
-  {      0,     -1,      4,    -11,     27,    -59,    117,   -216,    375,   -620,
-       987,  -1540,   2401,  -3889,   7176, -22128,  13882,   5529,  -3308,   2094,
-     -1350,    862,   -536,    320,   -182,     96,    -47,     21,     -8,      2, -1 },
-  {      0,     -1,      4,    -11,     27,    -59,    118,   -217,    377,   -622,
-       992,  -1547,   2412,  -3905,   7199, -22111,  13798,   5606,  -3345,   2116,
-     -1364,    871,   -542,    324,   -184,     98,    -48,     21,     -8,      3, -1 },
-  {      0,     -1,      4,    -11,     27,    -59,    118,   -218,    378,   -625,
-       996,  -1554,   2423,  -3921,   7222, -22094,  13714,   5682,  -3382,   2138,
-     -1378,    880,   -548,    327,   -186,     99,    -48,     21,     -8,      3, -1 },
-  {      0,     -1,      4,    -11,     27,    -60,    119,   -219,    380,   -627,
-      1000,  -1561,   2433,  -3937,   7245, -22076,  13630,   5759,  -3419,   2160,
-     -1392,    889,   -553,    331,   -188,    100,    -49,     22,     -8,      3, -1 },
-  {      0,     -1,      4,    -11,     27,    -60,    119,   -220,    381,   -630,
-      1004,  -1567,   2444,  -3953,   7267, -22058,  13546,   5836,  -3456,   2182,
-     -1406,    898,   -559,    335,   -190,    101,    -50,     22,     -8,      3, -1 },
-  {      0,     -1,      4,    -11,     27,    -60,    119,   -220,    382,   -632,
-      1009,  -1574,   2454,  -3968,   7289, -22039,  13461,   5913,  -3493,   2204,
-     -1420,    907,   -565,    338,   -192,    102,    -50,     22,     -9,      3, -1 },
-  {      0,     -1,      4,    -11,     27,    -60,    120,   -221,    384,   -635,
-      1013,  -1581,   2464,  -3984,   7310, -22020,  13376,   5990,  -3530,   2226,
-     -1434,    916,   -571,    342,   -194,    104,    -51,     23,     -9,      3, -1 },
-  {      0,     -1,      4,    -11,     27,    -60,    120,   -222,    385,   -637,
-      1017,  -1587,   2474,  -3999,   7332, -22001,  13291,   6067,  -3567,   2248,
-     -1448,    925,   -576,    345,   -196,    105,    -52,     23,     -9,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -60,    120,   -223,    387,   -640,
-      1021,  -1594,   2484,  -4014,   7353, -21981,  13205,   6145,  -3604,   2270,
-     -1462,    934,   -582,    349,   -198,    106,    -52,     23,     -9,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -61,    121,   -223,    388,   -642,
-      1025,  -1600,   2494,  -4029,   7373, -21960,  13119,   6222,  -3641,   2292,
-     -1475,    943,   -588,    352,   -201,    107,    -53,     23,     -9,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -61,    121,   -224,    389,   -645,
-      1029,  -1606,   2504,  -4043,   7394, -21939,  13033,   6299,  -3678,   2313,
-     -1489,    952,   -593,    356,   -203,    108,    -53,     24,     -9,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -61,    121,   -225,    391,   -647,
-      1033,  -1613,   2513,  -4058,   7414, -21918,  12946,   6376,  -3714,   2335,
-     -1503,    961,   -599,    359,   -205,    109,    -54,     24,     -9,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -61,    122,   -225,    392,   -649,
-      1037,  -1619,   2523,  -4072,   7433, -21896,  12860,   6454,  -3751,   2357,
-     -1517,    970,   -605,    363,   -207,    111,    -55,     24,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -61,    122,   -226,    393,   -652,
-      1041,  -1625,   2532,  -4086,   7453, -21874,  12773,   6531,  -3788,   2378,
-     -1530,    979,   -610,    366,   -209,    112,    -55,     25,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -61,    122,   -227,    395,   -654,
-      1044,  -1631,   2542,  -4100,   7472, -21852,  12685,   6609,  -3824,   2400,
-     -1544,    988,   -616,    370,   -211,    113,    -56,     25,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -61,    123,   -227,    396,   -656,
-      1048,  -1637,   2551,  -4114,   7490, -21829,  12597,   6686,  -3861,   2421,
-     -1558,    996,   -622,    373,   -213,    114,    -56,     25,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    123,   -228,    397,   -658,
-      1052,  -1643,   2560,  -4127,   7509, -21805,  12509,   6764,  -3897,   2443,
-     -1571,   1005,   -627,    377,   -215,    115,    -57,     26,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    123,   -229,    398,   -660,
-      1055,  -1648,   2569,  -4141,   7527, -21782,  12421,   6841,  -3933,   2464,
-     -1585,   1014,   -633,    380,   -217,    116,    -58,     26,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    124,   -229,    400,   -663,
-      1059,  -1654,   2578,  -4154,   7545, -21757,  12332,   6919,  -3970,   2486,
-     -1598,   1023,   -638,    384,   -219,    118,    -58,     26,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    124,   -230,    401,   -665,
-      1062,  -1660,   2586,  -4167,   7562, -21733,  12244,   6996,  -4006,   2507,
-     -1612,   1031,   -644,    387,   -221,    119,    -59,     26,    -10,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    124,   -231,    402,   -667,
-      1066,  -1665,   2595,  -4180,   7579, -21708,  12154,   7074,  -4042,   2528,
-     -1625,   1040,   -650,    391,   -223,    120,    -60,     27,    -11,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    125,   -231,    403,   -669,
-      1069,  -1671,   2604,  -4193,   7596, -21682,  12065,   7152,  -4078,   2549,
-     -1639,   1049,   -655,    394,   -225,    121,    -60,     27,    -11,      3, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    125,   -232,    404,   -671,
-      1073,  -1676,   2612,  -4205,   7613, -21656,  11975,   7229,  -4114,   2570,
-     -1652,   1057,   -661,    397,   -227,    122,    -61,     27,    -11,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -62,    125,   -232,    405,   -673,
-      1076,  -1682,   2620,  -4217,   7629, -21630,  11885,   7307,  -4150,   2591,
-     -1666,   1066,   -666,    401,   -229,    123,    -61,     28,    -11,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    125,   -233,    406,   -675,
-      1079,  -1687,   2628,  -4229,   7645, -21603,  11795,   7385,  -4186,   2612,
-     -1679,   1074,   -672,    404,   -231,    125,    -62,     28,    -11,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    126,   -233,    407,   -677,
-      1083,  -1692,   2636,  -4241,   7660, -21576,  11705,   7463,  -4222,   2633,
-     -1692,   1083,   -677,    408,   -234,    126,    -63,     28,    -11,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    126,   -234,    409,   -679,
-      1086,  -1697,   2644,  -4253,   7675, -21548,  11614,   7540,  -4257,   2654,
-     -1705,   1092,   -682,    411,   -236,    127,    -63,     29,    -11,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    126,   -235,    410,   -680,
-      1089,  -1702,   2652,  -4265,   7690, -21520,  11523,   7618,  -4293,   2675,
-     -1718,   1100,   -688,    414,   -238,    128,    -64,     29,    -11,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    126,   -235,    411,   -682,
-      1092,  -1707,   2660,  -4276,   7705, -21492,  11431,   7696,  -4328,   2696,
-     -1732,   1108,   -693,    418,   -240,    129,    -64,     29,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    127,   -236,    412,   -684,
-      1095,  -1712,   2667,  -4287,   7719, -21463,  11340,   7774,  -4364,   2716,
-     -1745,   1117,   -699,    421,   -242,    130,    -65,     29,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    127,   -236,    413,   -686,
-      1098,  -1717,   2675,  -4298,   7733, -21434,  11248,   7852,  -4399,   2737,
-     -1758,   1125,   -704,    425,   -244,    131,    -66,     30,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    127,   -237,    414,   -688,
-      1101,  -1722,   2682,  -4309,   7747, -21404,  11156,   7929,  -4434,   2758,
-     -1771,   1134,   -709,    428,   -246,    133,    -66,     30,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     28,    -63,    127,   -237,    414,   -689,
-      1104,  -1727,   2690,  -4320,   7760, -21374,  11063,   8007,  -4470,   2778,
-     -1784,   1142,   -715,    431,   -248,    134,    -67,     30,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -63,    128,   -238,    415,   -691,
-      1107,  -1731,   2697,  -4330,   7773, -21344,  10971,   8085,  -4505,   2799,
-     -1797,   1150,   -720,    435,   -250,    135,    -67,     31,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -63,    128,   -238,    416,   -693,
-      1110,  -1736,   2704,  -4340,   7786, -21313,  10878,   8163,  -4540,   2819,
-     -1809,   1159,   -725,    438,   -252,    136,    -68,     31,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    128,   -238,    417,   -694,
-      1113,  -1740,   2711,  -4351,   7798, -21282,  10785,   8241,  -4575,   2839,
-     -1822,   1167,   -731,    441,   -254,    137,    -69,     31,    -12,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    128,   -239,    418,   -696,
-      1115,  -1745,   2717,  -4360,   7811, -21250,  10691,   8318,  -4609,   2859,
-     -1835,   1175,   -736,    444,   -256,    138,    -69,     31,    -13,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    128,   -239,    419,   -698,
-      1118,  -1749,   2724,  -4370,   7822, -21218,  10598,   8396,  -4644,   2879,
-     -1848,   1183,   -741,    448,   -257,    139,    -70,     32,    -13,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    129,   -240,    420,   -699,
-      1121,  -1753,   2731,  -4380,   7834, -21185,  10504,   8474,  -4679,   2900,
-     -1860,   1192,   -747,    451,   -259,    140,    -70,     32,    -13,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    129,   -240,    421,   -701,
-      1123,  -1757,   2737,  -4389,   7845, -21152,  10410,   8552,  -4713,   2920,
-     -1873,   1200,   -752,    454,   -261,    141,    -71,     32,    -13,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    129,   -241,    421,   -702,
-      1126,  -1762,   2743,  -4398,   7856, -21119,  10315,   8630,  -4748,   2939,
-     -1886,   1208,   -757,    457,   -263,    143,    -72,     33,    -13,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    129,   -241,    422,   -703,
-      1128,  -1766,   2750,  -4407,   7866, -21086,  10221,   8707,  -4782,   2959,
-     -1898,   1216,   -762,    461,   -265,    144,    -72,     33,    -13,      4, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    129,   -241,    423,   -705,
-      1131,  -1770,   2756,  -4416,   7877, -21051,  10126,   8785,  -4816,   2979,
-     -1911,   1224,   -767,    464,   -267,    145,    -73,     33,    -13,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    129,   -242,    424,   -706,
-      1133,  -1773,   2762,  -4425,   7886, -21017,  10031,   8863,  -4850,   2999,
-     -1923,   1232,   -772,    467,   -269,    146,    -73,     33,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -242,    424,   -708,
-      1135,  -1777,   2767,  -4433,   7896, -20982,   9935,   8940,  -4884,   3018,
-     -1935,   1240,   -778,    470,   -271,    147,    -74,     34,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -242,    425,   -709,
-      1138,  -1781,   2773,  -4441,   7905, -20947,   9840,   9018,  -4918,   3038,
-     -1948,   1248,   -783,    474,   -273,    148,    -75,     34,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -243,    426,   -710,
-      1140,  -1785,   2779,  -4450,   7914, -20911,   9744,   9096,  -4952,   3057,
-     -1960,   1256,   -788,    477,   -275,    149,    -75,     34,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -243,    427,   -712,
-      1142,  -1788,   2784,  -4457,   7923, -20875,   9648,   9173,  -4986,   3077,
-     -1972,   1264,   -793,    480,   -277,    150,    -76,     35,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -243,    427,   -713,
-      1144,  -1792,   2790,  -4465,   7931, -20839,   9552,   9251,  -5019,   3096,
-     -1984,   1272,   -798,    483,   -279,    151,    -76,     35,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -244,    428,   -714,
-      1146,  -1795,   2795,  -4473,   7939, -20802,   9455,   9328,  -5053,   3115,
-     -1996,   1279,   -803,    486,   -281,    152,    -77,     35,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -244,    428,   -715,
-      1148,  -1798,   2800,  -4480,   7947, -20765,   9359,   9406,  -5086,   3134,
-     -2008,   1287,   -808,    489,   -282,    154,    -77,     36,    -14,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    130,   -244,    429,   -716,
-      1150,  -1802,   2805,  -4487,   7955, -20727,   9262,   9483,  -5119,   3153,
-     -2020,   1295,   -813,    492,   -284,    155,    -78,     36,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    430,   -717,
-      1152,  -1805,   2810,  -4494,   7962, -20689,   9165,   9561,  -5152,   3172,
-     -2032,   1303,   -818,    495,   -286,    156,    -79,     36,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    430,   -718,
-      1154,  -1808,   2815,  -4501,   7969, -20651,   9068,   9638,  -5185,   3191,
-     -2044,   1310,   -823,    499,   -288,    157,    -79,     36,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    431,   -720,
-      1156,  -1811,   2820,  -4508,   7975, -20612,   8970,   9716,  -5218,   3210,
-     -2056,   1318,   -828,    502,   -290,    158,    -80,     37,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    431,   -721,
-      1158,  -1814,   2824,  -4514,   7981, -20573,   8872,   9793,  -5251,   3229,
-     -2068,   1325,   -832,    505,   -292,    159,    -80,     37,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -64,    131,   -246,    432,   -722,
-      1160,  -1817,   2829,  -4520,   7987, -20534,   8774,   9870,  -5284,   3247,
-     -2079,   1333,   -837,    508,   -294,    160,    -81,     37,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    432,   -723,
-      1161,  -1820,   2833,  -4526,   7993, -20494,   8676,   9947,  -5316,   3266,
-     -2091,   1340,   -842,    511,   -295,    161,    -81,     37,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    433,   -723,
-      1163,  -1822,   2837,  -4532,   7998, -20454,   8578,  10025,  -5349,   3284,
-     -2102,   1348,   -847,    514,   -297,    162,    -82,     38,    -15,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    433,   -724,
-      1165,  -1825,   2841,  -4538,   8003, -20413,   8479,  10102,  -5381,   3302,
-     -2114,   1355,   -852,    517,   -299,    163,    -83,     38,    -16,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    434,   -725,
-      1166,  -1828,   2845,  -4544,   8008, -20372,   8381,  10179,  -5413,   3321,
-     -2125,   1363,   -856,    520,   -301,    164,    -83,     38,    -16,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    434,   -726,
-      1168,  -1830,   2849,  -4549,   8012, -20331,   8282,  10256,  -5445,   3339,
-     -2137,   1370,   -861,    523,   -303,    165,    -84,     39,    -16,      5, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    434,   -727,
-      1169,  -1833,   2853,  -4554,   8016, -20289,   8183,  10333,  -5477,   3357,
-     -2148,   1377,   -866,    526,   -304,    166,    -84,     39,    -16,      6, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    435,   -728,
-      1171,  -1835,   2857,  -4559,   8020, -20247,   8083,  10409,  -5509,   3375,
-     -2159,   1385,   -871,    529,   -306,    167,    -85,     39,    -16,      6, -1 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    435,   -728,
-      1172,  -1837,   2860,  -4564,   8024, -20204,   7984,  10486,  -5540,   3393,
-     -2171,   1392,   -875,    532,   -308,    168,    -85,     39,    -16,      6, -2 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    436,   -729,
-      1173,  -1840,   2864,  -4568,   8027, -20162,   7884,  10563,  -5572,   3410,
-     -2182,   1399,   -880,    535,   -310,    169,    -86,     40,    -16,      6, -2 },
-  {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    436,   -730,
-      1175,  -1842,   2867,  -4573,   8030, -20119,   7784,  10640,  -5603,   3428,
-     -2193,   1406,   -884,    537,   -312,    170,    -86,     40,    -16,      6, -2 },
-  {      0,     -1,      4,    -11,     29,    -65,    132,   -247,    436,   -730,
-      1176,  -1844,   2870,  -4577,   8032, -20075,   7684,  10716,  -5634,   3446,
-     -2204,   1413,   -889,    540,   -313,    171,    -87,     40,    -17,      6, -2 },
-  {      0,     -1,      4,    -11,     29,    -65,    132,   -248,    437,   -731,
-      1177,  -1846,   2873,  -4581,   8035, -20031,   7584,  10793,  -5665,   3463,
-     -2215,   1420,   -894,    543,   -315,    172,    -88,     41,    -17,      6, -2 },
-  {      0,     -1,      4,    -11,     29,    -64,    132,   -248,    437,   -732,
-      1178,  -1848,   2876,  -4585,   8037, -19987,   7484,  10869,  -5696,   3481,
-     -2226,   1427,   -898,    546,   -317,    173,    -88,     41,    -17,      6, -2 },
-  {      0,     -1,      4,    -11,     29,    -64,    132,   -248,    437,   -732,
-      1179,  -1850,   2879,  -4589,   8038, -19942,   7383,  10946,  -5727,   3498,
-     -2236,   1434,   -903,    549,   -319,    174,    -89,     41,    -17,      6, -2 },
-  {      0,     -1,      4,    -11,     29,    -64,    132,   -248,    437,   -733,
-      1180,  -1851,   2882,  -4592,   8040, -19897,   7282,  11022,  -5758,   3515,
-     -2247,   1441,   -907,    552,   -320,    175,    -89,     41,    -17,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -733,
-      1181,  -1853,   2884,  -4596,   8041, -19852,   7181,  11098,  -5788,   3532,
-     -2258,   1448,   -912,    555,   -322,    176,    -90,     42,    -17,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -734,
-      1182,  -1855,   2887,  -4599,   8042, -19806,   7080,  11174,  -5818,   3549,
-     -2268,   1455,   -916,    557,   -324,    177,    -90,     42,    -17,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -734,
-      1183,  -1856,   2889,  -4602,   8042, -19760,   6979,  11250,  -5849,   3566,
-     -2279,   1462,   -920,    560,   -325,    178,    -91,     42,    -17,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -735,
-      1184,  -1858,   2892,  -4605,   8042, -19714,   6878,  11326,  -5879,   3583,
-     -2289,   1469,   -925,    563,   -327,    179,    -91,     42,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -735,
-      1185,  -1859,   2894,  -4607,   8042, -19667,   6776,  11402,  -5908,   3599,
-     -2300,   1475,   -929,    566,   -329,    180,    -92,     43,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    438,   -736,
-      1185,  -1861,   2896,  -4610,   8042, -19620,   6674,  11478,  -5938,   3616,
-     -2310,   1482,   -933,    568,   -330,    181,    -92,     43,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -736,
-      1186,  -1862,   2898,  -4612,   8041, -19573,   6573,  11553,  -5968,   3632,
-     -2320,   1489,   -938,    571,   -332,    182,    -93,     43,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -736,
-      1187,  -1863,   2900,  -4614,   8040, -19525,   6471,  11629,  -5997,   3649,
-     -2330,   1495,   -942,    574,   -334,    183,    -93,     43,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -736,
-      1187,  -1864,   2901,  -4616,   8039, -19477,   6368,  11704,  -6027,   3665,
-     -2341,   1502,   -946,    576,   -335,    184,    -94,     44,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
-      1188,  -1865,   2903,  -4618,   8038, -19429,   6266,  11780,  -6056,   3681,
-     -2351,   1508,   -950,    579,   -337,    185,    -94,     44,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
-      1189,  -1866,   2904,  -4620,   8036, -19380,   6164,  11855,  -6085,   3697,
-     -2361,   1515,   -954,    582,   -339,    186,    -95,     44,    -18,      6, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
-      1189,  -1867,   2906,  -4621,   8034, -19331,   6061,  11930,  -6113,   3713,
-     -2370,   1521,   -959,    584,   -340,    187,    -95,     45,    -18,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
-      1189,  -1868,   2907,  -4622,   8031, -19282,   5958,  12005,  -6142,   3729,
-     -2380,   1527,   -963,    587,   -342,    188,    -96,     45,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
-      1190,  -1869,   2908,  -4623,   8029, -19232,   5855,  12080,  -6171,   3744,
-     -2390,   1534,   -967,    589,   -343,    189,    -96,     45,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
-      1190,  -1869,   2909,  -4624,   8026, -19182,   5752,  12155,  -6199,   3760,
-     -2400,   1540,   -971,    592,   -345,    190,    -97,     45,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -738,
-      1190,  -1870,   2910,  -4625,   8023, -19131,   5649,  12230,  -6227,   3775,
-     -2409,   1546,   -975,    595,   -346,    190,    -97,     46,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -738,
-      1191,  -1870,   2911,  -4625,   8019, -19081,   5546,  12304,  -6255,   3791,
-     -2419,   1552,   -979,    597,   -348,    191,    -98,     46,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -738,
-      1191,  -1871,   2911,  -4626,   8015, -19030,   5442,  12379,  -6283,   3806,
-     -2428,   1558,   -983,    600,   -350,    192,    -98,     46,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -247,    439,   -738,
-      1191,  -1871,   2912,  -4626,   8011, -18978,   5339,  12453,  -6310,   3821,
-     -2438,   1565,   -987,    602,   -351,    193,    -99,     46,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -64,    131,   -247,    439,   -738,
-      1191,  -1871,   2913,  -4626,   8007, -18927,   5235,  12528,  -6338,   3836,
-     -2447,   1571,   -991,    605,   -353,    194,    -99,     47,    -19,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -738,
-      1191,  -1872,   2913,  -4626,   8002, -18875,   5131,  12602,  -6365,   3851,
-     -2456,   1576,   -994,    607,   -354,    195,   -100,     47,    -20,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -737,
-      1191,  -1872,   2913,  -4625,   7997, -18822,   5027,  12676,  -6392,   3866,
-     -2465,   1582,   -998,    610,   -356,    196,   -100,     47,    -20,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -737,
-      1191,  -1872,   2913,  -4625,   7992, -18770,   4923,  12749,  -6419,   3880,
-     -2474,   1588,  -1002,    612,   -357,    197,   -101,     47,    -20,      7, -2 },
-  {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -737,
-      1191,  -1872,   2913,  -4624,   7987, -18717,   4819,  12823,  -6446,   3895,
-     -2483,   1594,  -1006,    614,   -359,    198,   -101,     48,    -20,      7, -2 },
-  {      0,     -1,      3,    -10,     28,    -63,    130,   -247,    438,   -737,
-      1191,  -1872,   2913,  -4623,   7981, -18663,   4715,  12897,  -6473,   3909,
-     -2492,   1600,  -1010,    617,   -360,    198,   -102,     48,    -20,      7, -2 },
-  {      0,     -1,      3,    -10,     28,    -63,    130,   -246,    438,   -737,
-      1191,  -1872,   2913,  -4622,   7975, -18610,   4611,  12970,  -6499,   3923,
-     -2501,   1605,  -1013,    619,   -362,    199,   -102,     48,    -20,      7, -2 },
-  {      0,     -1,      3,    -10,     28,    -63,    130,   -246,    437,   -737,
-      1190,  -1872,   2913,  -4621,   7968, -18556,   4506,  13044,  -6525,   3938,
-     -2510,   1611,  -1017,    621,   -363,    200,   -103,     48,    -20,      7, -2 },
-  {      0,     -1,      3,    -10,     27,    -63,    130,   -246,    437,   -736,
-      1190,  -1871,   2912,  -4620,   7962, -18502,   4402,  13117,  -6551,   3952,
-     -2518,   1617,  -1021,    624,   -364,    201,   -103,     49,    -20,      7, -2 },
-  {      0,     -1,      3,    -10,     27,    -63,    129,   -246,    437,   -736,
-      1190,  -1871,   2912,  -4618,   7955, -18447,   4297,  13190,  -6577,   3965,
-     -2527,   1622,  -1024,    626,   -366,    202,   -104,     49,    -20,      7, -2 },
-  {      0,     -1,      3,    -10,     27,    -63,    129,   -246,    437,   -736,
-      1190,  -1871,   2911,  -4616,   7948, -18392,   4192,  13263,  -6603,   3979,
-     -2535,   1628,  -1028,    628,   -367,    203,   -104,     49,    -21,      7, -2 },
-  {      0,     -1,      3,    -10,     27,    -63,    129,   -245,    436,   -735,
-      1189,  -1870,   2910,  -4614,   7940, -18337,   4087,  13336,  -6629,   3993,
-     -2544,   1633,  -1031,    631,   -369,    204,   -105,     49,    -21,      7, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    129,   -245,    436,   -735,
-      1189,  -1869,   2909,  -4612,   7933, -18282,   3982,  13408,  -6654,   4006,
-     -2552,   1639,  -1035,    633,   -370,    204,   -105,     49,    -21,      7, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    129,   -245,    436,   -734,
-      1188,  -1869,   2908,  -4610,   7925, -18226,   3877,  13481,  -6679,   4020,
-     -2560,   1644,  -1038,    635,   -371,    205,   -106,     50,    -21,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    129,   -245,    435,   -734,
-      1188,  -1868,   2907,  -4608,   7916, -18170,   3772,  13553,  -6704,   4033,
-     -2568,   1649,  -1042,    637,   -373,    206,   -106,     50,    -21,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    129,   -244,    435,   -734,
-      1187,  -1867,   2906,  -4605,   7908, -18114,   3667,  13625,  -6729,   4046,
-     -2576,   1654,  -1045,    639,   -374,    207,   -106,     50,    -21,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    128,   -244,    435,   -733,
-      1186,  -1867,   2905,  -4602,   7899, -18057,   3561,  13697,  -6753,   4059,
-     -2584,   1659,  -1048,    642,   -375,    208,   -107,     50,    -21,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    128,   -244,    434,   -733,
-      1186,  -1866,   2903,  -4599,   7890, -18000,   3456,  13769,  -6778,   4072,
-     -2592,   1665,  -1052,    644,   -377,    208,   -107,     51,    -21,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    128,   -244,    434,   -732,
-      1185,  -1865,   2902,  -4596,   7881, -17943,   3350,  13841,  -6802,   4085,
-     -2600,   1670,  -1055,    646,   -378,    209,   -108,     51,    -21,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    128,   -243,    433,   -731,
-      1184,  -1864,   2900,  -4593,   7871, -17886,   3245,  13912,  -6826,   4097,
-     -2608,   1675,  -1058,    648,   -379,    210,   -108,     51,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    128,   -243,    433,   -731,
-      1183,  -1862,   2898,  -4590,   7861, -17828,   3139,  13983,  -6850,   4110,
-     -2616,   1680,  -1062,    650,   -381,    211,   -109,     51,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -62,    127,   -243,    432,   -730,
-      1183,  -1861,   2897,  -4586,   7851, -17770,   3033,  14055,  -6873,   4122,
-     -2623,   1684,  -1065,    652,   -382,    211,   -109,     52,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -61,    127,   -242,    432,   -730,
-      1182,  -1860,   2895,  -4582,   7841, -17712,   2928,  14126,  -6897,   4134,
-     -2631,   1689,  -1068,    654,   -383,    212,   -110,     52,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     27,    -61,    127,   -242,    432,   -729,
-      1181,  -1859,   2893,  -4578,   7830, -17653,   2822,  14196,  -6920,   4147,
-     -2638,   1694,  -1071,    656,   -385,    213,   -110,     52,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -61,    127,   -242,    431,   -728,
-      1180,  -1857,   2890,  -4574,   7820, -17594,   2716,  14267,  -6943,   4159,
-     -2645,   1699,  -1074,    658,   -386,    214,   -110,     52,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -61,    127,   -241,    431,   -727,
-      1179,  -1856,   2888,  -4570,   7808, -17535,   2610,  14338,  -6966,   4170,
-     -2652,   1703,  -1077,    660,   -387,    214,   -111,     52,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -61,    126,   -241,    430,   -727,
-      1178,  -1854,   2886,  -4566,   7797, -17476,   2504,  14408,  -6988,   4182,
-     -2660,   1708,  -1080,    662,   -388,    215,   -111,     53,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -61,    126,   -241,    429,   -726,
-      1177,  -1853,   2883,  -4561,   7785, -17416,   2398,  14478,  -7010,   4194,
-     -2667,   1713,  -1083,    664,   -389,    216,   -112,     53,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -61,    126,   -240,    429,   -725,
-      1175,  -1851,   2881,  -4556,   7773, -17356,   2292,  14548,  -7033,   4205,
-     -2673,   1717,  -1086,    666,   -391,    217,   -112,     53,    -22,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -60,    126,   -240,    428,   -724,
-      1174,  -1849,   2878,  -4551,   7761, -17296,   2185,  14618,  -7055,   4216,
-     -2680,   1721,  -1089,    668,   -392,    217,   -112,     53,    -23,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -60,    125,   -240,    428,   -723,
-      1173,  -1847,   2875,  -4546,   7749, -17235,   2079,  14687,  -7076,   4227,
-     -2687,   1726,  -1092,    670,   -393,    218,   -113,     53,    -23,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -60,    125,   -239,    427,   -722,
-      1172,  -1846,   2872,  -4541,   7736, -17174,   1973,  14757,  -7098,   4238,
-     -2694,   1730,  -1095,    671,   -394,    219,   -113,     54,    -23,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -60,    125,   -239,    426,   -722,
-      1170,  -1844,   2869,  -4536,   7723, -17113,   1866,  14826,  -7119,   4249,
-     -2700,   1734,  -1098,    673,   -395,    219,   -114,     54,    -23,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -60,    125,   -238,    426,   -721,
-      1169,  -1842,   2866,  -4530,   7710, -17052,   1760,  14895,  -7140,   4260,
-     -2707,   1739,  -1100,    675,   -396,    220,   -114,     54,    -23,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -60,    124,   -238,    425,   -720,
-      1167,  -1840,   2863,  -4524,   7697, -16990,   1653,  14964,  -7161,   4270,
-     -2713,   1743,  -1103,    677,   -397,    221,   -114,     54,    -23,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -60,    124,   -237,    424,   -719,
-      1166,  -1837,   2860,  -4518,   7683, -16929,   1547,  15033,  -7182,   4281,
-     -2719,   1747,  -1106,    679,   -399,    221,   -115,     55,    -23,      8, -2 },
-  {      0,     -1,      3,    -10,     26,    -59,    124,   -237,    424,   -718,
-      1165,  -1835,   2856,  -4512,   7669, -16867,   1440,  15101,  -7202,   4291,
-     -2726,   1751,  -1108,    680,   -400,    222,   -115,     55,    -23,      9, -2 },
-  {      0,     -1,      3,    -10,     26,    -59,    124,   -237,    423,   -717,
-      1163,  -1833,   2853,  -4506,   7655, -16804,   1334,  15169,  -7223,   4301,
-     -2732,   1755,  -1111,    682,   -401,    223,   -115,     55,    -23,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -59,    123,   -236,    422,   -715,
-      1161,  -1831,   2849,  -4500,   7640, -16742,   1227,  15237,  -7243,   4311,
-     -2738,   1759,  -1113,    684,   -402,    223,   -116,     55,    -23,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -59,    123,   -236,    422,   -714,
-      1160,  -1828,   2845,  -4493,   7626, -16679,   1121,  15305,  -7262,   4321,
-     -2744,   1762,  -1116,    685,   -403,    224,   -116,     55,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -59,    123,   -235,    421,   -713,
-      1158,  -1826,   2841,  -4487,   7611, -16616,   1014,  15373,  -7282,   4331,
-     -2749,   1766,  -1118,    687,   -404,    225,   -117,     56,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -59,    122,   -235,    420,   -712,
-      1156,  -1823,   2837,  -4480,   7596, -16552,    907,  15440,  -7301,   4340,
-     -2755,   1770,  -1121,    688,   -405,    225,   -117,     56,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -59,    122,   -234,    419,   -711,
-      1155,  -1820,   2833,  -4473,   7580, -16489,    801,  15507,  -7321,   4350,
-     -2761,   1773,  -1123,    690,   -406,    226,   -117,     56,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -58,    122,   -234,    419,   -710,
-      1153,  -1818,   2829,  -4466,   7564, -16425,    694,  15574,  -7339,   4359,
-     -2766,   1777,  -1126,    692,   -407,    226,   -118,     56,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -58,    122,   -233,    418,   -708,
-      1151,  -1815,   2825,  -4458,   7549, -16361,    587,  15641,  -7358,   4368,
-     -2772,   1781,  -1128,    693,   -408,    227,   -118,     56,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -58,    121,   -233,    417,   -707,
-      1149,  -1812,   2821,  -4451,   7532, -16297,    480,  15708,  -7377,   4377,
-     -2777,   1784,  -1130,    695,   -409,    228,   -118,     56,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -58,    121,   -232,    416,   -706,
-      1147,  -1809,   2816,  -4443,   7516, -16232,    374,  15774,  -7395,   4386,
-     -2782,   1787,  -1133,    696,   -410,    228,   -119,     57,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -58,    121,   -232,    415,   -705,
-      1145,  -1806,   2812,  -4436,   7499, -16167,    267,  15840,  -7413,   4395,
-     -2787,   1791,  -1135,    698,   -411,    229,   -119,     57,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -58,    120,   -231,    414,   -703,
-      1143,  -1803,   2807,  -4428,   7483, -16102,    160,  15906,  -7431,   4403,
-     -2792,   1794,  -1137,    699,   -412,    229,   -119,     57,    -24,      9, -3 },
-  {      0,     -1,      3,     -9,     25,    -57,    120,   -231,    413,   -702,
-      1141,  -1800,   2802,  -4420,   7466, -16037,     53,  15972,  -7448,   4411,
-     -2797,   1797,  -1139,    700,   -413,    230,   -120,     57,    -24,      9, -3 },
+  { .h = {          0,          0,          0,          0,          0,          0,          0,          0,
+                    0,          0,          0,          0,          0,          0,          0, 2147483647,
+                    0,          0,          0,          0,          0,          0,          0,          0,
+                    0,          0,          0,          0,          0,          0,          0 },
+    .d = {     -1,      3,     -9,     24,    -57,    120,   -230,    413,   -700,   1139,
+            -1797,   2797,  -4411,   7448, -15972,    -53,  16037,  -7466,   4420,  -2802,
+             1800,  -1141,    702,   -413,    231,   -120,     57,    -25,      9,     -3,      1 } },
+  { .h = {       -140,        688,      -2315,       6266,     -14637,      30640,     -58875,     105625,
+              -179317,     291594,    -460083,     716145,   -1129337,    1906742,   -4088753, 2147469981,
+              4105509,   -1911174,    1131440,    -717386,     460885,    -292128,     179671,    -105854,
+                59017,     -30723,      14682,      -6289,       2325,       -692,        141 },
+    .d = {     -1,      3,     -9,     24,    -57,    119,   -229,    412,   -699,   1137,
+            -1794,   2792,  -4403,   7431, -15906,   -160,  16102,  -7483,   4428,  -2807,
+             1803,  -1143,    703,   -414,    231,   -120,     58,    -25,      9,     -3,      1 } },
+  { .h = {       -278,       1373,      -4620,      12510,     -29227,      61195,    -117607,     211017,
+              -358273,     582643,    -919347,    1431024,   -2256533,    3808993,   -8160693, 2147428980,
+              8227714,   -3826721,    2264944,   -1435988,     922556,    -584781,     359691,    -211933,
+               118175,     -61527,      29408,     -12599,       4659,      -1387,        282 },
+    .d = {     -1,      3,     -9,     24,    -57,    119,   -229,    411,   -698,   1135,
+            -1791,   2787,  -4395,   7413, -15840,   -267,  16167,  -7499,   4436,  -2812,
+             1806,  -1145,    705,   -415,    232,   -121,     58,    -25,      9,     -3,      1 } },
+  { .h = {       -415,       2054,      -6915,      18731,     -43772,      91666,    -176193,     316172,
+              -536862,     873137,   -1377777,    2144612,   -3381548,    5706692,  -12215763, 2147360646,
+             12366558,   -5746580,    3400474,   -2155779,    1384996,    -877947,     540052,    -318234,
+               177470,     -92413,      44179,     -18932,       7003,      -2087,        425 },
+    .d = {     -1,      3,     -9,     24,    -57,    119,   -228,    410,   -696,   1133,
+            -1787,   2782,  -4386,   7395, -15774,   -374,  16232,  -7516,   4443,  -2816,
+             1809,  -1147,    706,   -416,    232,   -121,     58,    -25,      9,     -3,      1 } },
+  { .h = {       -552,       2731,      -9200,      24928,     -58270,     122050,    -234630,     421087,
+              -715077,    1163066,   -1835356,    2856883,   -4504345,    7599782,  -16253904, 2147264981,
+             16521980,   -7670691,    4537989,   -2876736,    1848189,   -1171616,     720749,    -424753,
+               236900,    -123378,      58993,     -25287,       9357,      -2789,        568 },
+    .d = {     -1,      3,     -9,     24,    -56,    118,   -228,    409,   -695,   1130,
+            -1784,   2777,  -4377,   7377, -15708,   -480,  16297,  -7532,   4451,  -2821,
+             1812,  -1149,    707,   -417,    233,   -121,     58,    -25,      9,     -3,      1 } },
+  { .h = {       -687,       3404,     -11474,      31103,     -72722,     152348,    -292918,     525759,
+              -892913,    1452419,   -2292067,    3567813,   -5624884,    9488202,  -20275062, 2147141986,
+             20693920,   -9598992,    5677450,   -3598831,    2312118,   -1465777,     901775,    -531486,
+               296465,    -154422,      73850,     -31663,      11721,      -3496,        713 },
+    .d = {     -1,      3,     -9,     24,    -56,    118,   -227,    408,   -693,   1128,
+            -1781,   2772,  -4368,   7358, -15641,   -587,  16361,  -7549,   4458,  -2825,
+             1815,  -1151,    708,   -418,    233,   -122,     58,    -25,      9,     -3,      1 } },
+  { .h = {       -821,       4074,     -13739,      37255,     -87126,     182557,    -351055,     630184,
+             -1070363,    1741187,   -2747896,    4277377,   -6743128,   11371896,  -24279180, 2146991666,
+             24882319,  -11531423,    6818819,   -4322040,    2776767,   -1760421,    1083123,    -638430,
+               356161,    -185544,      88751,     -38061,      14094,      -4206,        859 },
+    .d = {     -1,      3,     -9,     24,    -56,    118,   -226,    407,   -692,   1126,
+            -1777,   2766,  -4359,   7339, -15574,   -694,  16425,  -7564,   4466,  -2829,
+             1818,  -1153,    710,   -419,    234,   -122,     58,    -25,      9,     -3,      1 } },
+  { .h = {       -955,       4740,     -15994,      43382,    -101482,     212677,    -409037,     734357,
+             -1247421,    2029359,   -3202825,    4985550,   -7859040,   13250804,  -28266203, 2146814023,
+             29087114,  -13467923,    7962054,   -5046336,    3242118,   -2055537,    1264788,    -745580,
+               415987,    -216743,     103693,     -44480,      16477,      -4919,       1006 },
+    .d = {     -1,      3,     -9,     24,    -56,    117,   -226,    406,   -690,   1123,
+            -1773,   2761,  -4350,   7321, -15507,   -801,  16489,  -7580,   4473,  -2833,
+             1820,  -1155,    711,   -419,    234,   -122,     59,    -25,      9,     -3,      1 } },
+  { .h = {      -1087,       5402,     -18238,      49487,    -115789,     242708,    -466864,     838276,
+             -1424081,    2316925,   -3656839,    5692308,   -8972580,   15124869,  -32236076, 2146609061,
+             33308246,  -15408430,    9107118,   -5771694,    3708156,   -2351113,    1446762,    -852934,
+               475941,    -248018,     118678,     -50920,      18869,      -5637,       1154 },
+    .d = {     -1,      3,     -9,     24,    -56,    117,   -225,    405,   -688,   1121,
+            -1770,   2755,  -4340,   7301, -15440,   -907,  16552,  -7596,   4480,  -2837,
+             1823,  -1156,    712,   -420,    235,   -122,     59,    -25,      9,     -3,      1 } },
+  { .h = {      -1218,       6060,     -20472,      55567,    -130048,     272648,    -524533,     941938,
+             -1600337,    2603875,   -4109922,    6397625,  -10083711,   16994033,  -36188744, 2146376785,
+             37545650,  -17352882,   10253969,   -6498088,    4174863,   -2647140,    1629040,    -960486,
+               536020,    -279367,     133704,     -57381,      21270,      -6357,       1302 },
+    .d = {     -1,      3,     -9,     24,    -56,    117,   -225,    404,   -687,   1118,
+            -1766,   2749,  -4331,   7282, -15373,  -1014,  16616,  -7611,   4487,  -2841,
+             1826,  -1158,    713,   -421,    235,   -123,     59,    -25,      9,     -3,      1 } },
+  { .h = {      -1348,       6715,     -22695,      61623,    -144258,     302495,    -582042,    1045337,
+             -1776183,    2890199,   -4562058,    7101477,  -11192397,   18858239,  -40124154, 2146117201,
+             41799266,  -19301218,   11402568,   -7225491,    4642223,   -2943606,    1811614,   -1068235,
+               596223,    -310790,     148770,     -63863,      23680,      -7081,       1452 },
+    .d = {     -1,      3,     -9,     24,    -55,    116,   -224,    403,   -685,   1116,
+            -1762,   2744,  -4321,   7262, -15305,  -1121,  16679,  -7626,   4493,  -2845,
+             1828,  -1160,    714,   -422,    236,   -123,     59,    -25,      9,     -3,      1 } },
+  { .h = {      -1477,       7366,     -24908,      67656,    -158418,     332250,    -639390,    1148472,
+             -1951612,    3175887,   -5013231,    7803841,  -12298598,   20717430,  -44042253, 2145830315,
+             46069030,  -21253374,   12552874,   -7953879,    5110218,   -3240501,    1994478,   -1176174,
+               656546,    -342285,     163877,     -70365,      26100,      -7809,       1603 },
+    .d = {      0,      3,     -9,     23,    -55,    116,   -223,    402,   -684,   1113,
+            -1759,   2738,  -4311,   7243, -15237,  -1227,  16742,  -7640,   4500,  -2849,
+             1831,  -1161,    715,   -422,    236,   -123,     59,    -25,      9,     -3,      1 } },
+  { .h = {      -1605,       8013,     -27111,      73663,    -172528,     361911,    -696575,    1251338,
+             -2126618,    3460929,   -5463425,    8504691,  -13402279,   22571549,  -47942988, 2145516133,
+             50354879,  -23209287,   13704847,   -8683223,    5578832,   -3537815,    2177625,   -1284301,
+               716989,    -373852,     179024,     -76887,      28529,      -8540,       1755 },
+    .d = {      0,      3,     -9,     23,    -55,    115,   -223,    401,   -682,   1111,
+            -1755,   2732,  -4301,   7223, -15169,  -1334,  16804,  -7655,   4506,  -2853,
+             1833,  -1163,    717,   -423,    237,   -124,     59,    -26,     10,     -3,      1 } },
+  { .h = {      -1732,       8656,     -29303,      79647,    -186587,     391477,    -753595,    1353933,
+             -2301196,    3745316,   -5912626,    9204003,  -14503403,   24420541,  -51826306, 2145174663,
+             54656748,  -25168896,   14858447,   -9413499,    6048048,   -3835536,    2361049,   -1392612,
+               777549,    -405490,     194210,     -83429,      30967,      -9275,       1908 },
+    .d = {      0,      2,     -9,     23,    -55,    115,   -222,    400,   -680,   1108,
+            -1751,   2726,  -4291,   7202, -15101,  -1440,  16867,  -7669,   4512,  -2856,
+             1835,  -1165,    718,   -424,    237,   -124,     59,    -26,     10,     -3,      1 } },
+  { .h = {      -1858,       9295,     -31484,      85605,    -200596,     420948,    -810447,    1456252,
+             -2475340,    4029037,   -6360817,    9901754,  -15601931,   26264348,  -55692156, 2144805912,
+             58974573,  -27132137,   16013633,  -10144680,    6517848,   -4133653,    2544744,   -1501103,
+               838224,    -437196,     209435,     -89992,      33414,     -10013,       2062 },
+    .d = {      0,      2,     -8,     23,    -55,    115,   -221,    399,   -679,   1106,
+            -1747,   2719,  -4281,   7182, -15033,  -1547,  16929,  -7683,   4518,  -2860,
+             1837,  -1166,    719,   -424,    237,   -124,     60,    -26,     10,     -3,      1 } },
+  { .h = {      -1982,       9931,     -33655,      91539,    -214553,     450322,    -867130,    1558292,
+             -2649044,    4312082,   -6807983,   10597920,  -16697829,   28102916,  -59540487, 2144409890,
+             63308290,  -29098946,   17170364,  -10876739,    6988216,   -4432156,    2728702,   -1609770,
+               899012,    -468971,     224698,     -96573,      35870,     -10755,       2217 },
+    .d = {      0,      2,     -8,     23,    -54,    114,   -221,    397,   -677,   1103,
+            -1743,   2713,  -4270,   7161, -14964,  -1653,  16990,  -7697,   4524,  -2863,
+             1840,  -1167,    720,   -425,    238,   -124,     60,    -26,     10,     -3,      1 } },
+  { .h = {      -2106,      10562,     -35815,      97448,    -228458,     479598,    -923643,    1660049,
+             -2822301,    4594443,   -7254108,   11292475,  -17791058,   29936188,  -63371247, 2143986605,
+             67657832,  -31069260,   18328599,  -11609650,    7459134,   -4731034,    2912917,   -1718609,
+               959910,    -500813,     239999,    -103175,      38335,     -11500,       2373 },
+    .d = {      0,      2,     -8,     23,    -54,    114,   -220,    396,   -675,   1100,
+            -1739,   2707,  -4260,   7140, -14895,  -1760,  17052,  -7710,   4530,  -2866,
+             1842,  -1169,    721,   -426,    238,   -125,     60,    -26,     10,     -3,      1 } },
+  { .h = {      -2229,      11190,     -37964,     103331,    -242311,     508776,    -979983,    1761522,
+             -2995106,    4876108,   -7699177,   11985398,  -18881583,   31764111,  -67184388, 2143536068,
+             72023133,  -33043014,   19488299,  -12343387,    7930585,   -5030275,    3097382,   -1827617,
+              1020916,    -532720,     255338,    -109795,      40808,     -12248,       2530 },
+    .d = {      0,      2,     -8,     23,    -54,    114,   -219,    395,   -673,   1098,
+            -1734,   2700,  -4249,   7119, -14826,  -1866,  17113,  -7723,   4536,  -2869,
+             1844,  -1170,    722,   -426,    239,   -125,     60,    -26,     10,     -3,      1 } },
+  { .h = {      -2351,      11814,     -40102,     109189,    -256112,     537855,   -1036148,    1862705,
+             -3167453,    5157070,   -8143174,   12676663,  -19969368,   33586628,  -70979859, 2143058289,
+             76404128,  -35020145,   20649420,  -13077922,    8402552,   -5329870,    3282090,   -1936788,
+              1082029,    -564693,     270713,    -116435,      43291,     -13000,       2689 },
+    .d = {      0,      2,     -8,     23,    -54,    113,   -219,    394,   -671,   1095,
+            -1730,   2694,  -4238,   7098, -14757,  -1973,  17174,  -7736,   4541,  -2872,
+             1846,  -1172,    722,   -427,    239,   -125,     60,    -26,     10,     -3,      1 } },
+  { .h = {      -2471,      12434,     -42230,     115022,    -269860,     566833,   -1092138,    1963595,
+             -3339336,    5437317,   -8586085,   13366248,  -21054376,   35403685,  -74757612, 2142553278,
+             80800749,  -37000587,   21811922,  -13813229,    8875018,   -5629806,    3467036,   -2046120,
+              1143246,    -596729,     286124,    -123093,      45782,     -13756,       2848 },
+    .d = {      0,      2,     -8,     23,    -53,    113,   -218,    393,   -670,   1092,
+            -1726,   2687,  -4227,   7076, -14687,  -2079,  17235,  -7749,   4546,  -2875,
+             1847,  -1173,    723,   -428,    240,   -125,     60,    -26,     10,     -3,      1 } },
+  { .h = {      -2591,      13050,     -44347,     120829,    -283554,     595710,   -1147949,    2064190,
+             -3510749,    5716840,   -9027895,   14054129,  -22136572,   37215229,  -78517597, 2142021049,
+             85212929,  -38984277,   22975765,  -14549281,    9347964,   -5930074,    3652211,   -2155609,
+              1204565,    -628828,     301571,    -129770,      48281,     -14514,       3008 },
+    .d = {      0,      2,     -8,     23,    -53,    112,   -217,    392,   -668,   1089,
+            -1721,   2680,  -4216,   7055, -14618,  -2185,  17296,  -7761,   4551,  -2878,
+             1849,  -1174,    724,   -428,    240,   -126,     60,    -26,     10,     -3,      1 } },
+  { .h = {      -2709,      13662,     -46452,     126610,    -297194,     624485,   -1203580,    2164486,
+             -3681687,    5995631,   -9468587,   14740283,  -23215919,   39021205,  -82259766, 2141461613,
+             89640600,  -40971148,   24140905,  -15286052,    9821375,   -6230661,    3837609,   -2265249,
+              1265984,    -660989,     317053,    -136465,      50789,     -15276,       3169 },
+    .d = {      0,      2,     -8,     22,    -53,    112,   -217,    391,   -666,   1086,
+            -1717,   2673,  -4205,   7033, -14548,  -2292,  17356,  -7773,   4556,  -2881,
+             1851,  -1175,    725,   -429,    240,   -126,     61,    -26,     10,     -3,      1 } },
+  { .h = {      -2827,      14271,     -48547,     132365,    -310780,     653157,   -1259029,    2264479,
+             -3852144,    6273678,   -9908147,   15424686,  -24292383,   40821559,  -85984073, 2140874983,
+             94083693,  -42961136,   25307302,  -16023513,   10295232,   -6531557,    4023224,   -2375038,
+              1327500,    -693210,     332570,    -143178,      53306,     -16041,       3331 },
+    .d = {      0,      2,     -8,     22,    -53,    112,   -216,    389,   -664,   1083,
+            -1713,   2667,  -4194,   7010, -14478,  -2398,  17416,  -7785,   4561,  -2883,
+             1853,  -1177,    726,   -429,    241,   -126,     61,    -26,     10,     -3,      1 } },
+  { .h = {      -2943,      14875,     -50631,     138094,    -324312,     681726,   -1314295,    2364167,
+             -4022114,    6550974,  -10346561,   16107315,  -25365928,   42616239,  -89690470, 2140261173,
+             98542140,  -44954175,   26474914,  -16761639,   10769517,   -6832750,    4209048,   -2484972,
+              1389111,    -725490,     348121,    -149910,      55830,     -16810,       3494 },
+    .d = {      0,      2,     -8,     22,    -53,    111,   -215,    388,   -662,   1080,
+            -1708,   2660,  -4182,   6988, -14408,  -2504,  17476,  -7797,   4566,  -2886,
+             1854,  -1178,    727,   -430,    241,   -126,     61,    -26,     10,     -3,      1 } },
+  { .h = {      -3059,      15476,     -52703,     143797,    -337789,     710189,   -1369376,    2463546,
+             -4191591,    6827508,  -10783812,   16788147,  -26436519,   44405192,  -93378911, 2139620197,
+            103015870,  -46950199,   27643699,  -17500402,   11244214,   -7134230,    4395074,   -2595046,
+              1450816,    -757828,     363706,    -156659,      58363,     -17582,       3659 },
+    .d = {      0,      2,     -8,     22,    -52,    111,   -214,    387,   -660,   1077,
+            -1703,   2652,  -4170,   6966, -14338,  -2610,  17535,  -7808,   4570,  -2888,
+             1856,  -1179,    727,   -431,    241,   -127,     61,    -26,     10,     -3,      1 } },
+  { .h = {      -3173,      16072,     -54765,     149473,    -351210,     738547,   -1424270,    2562612,
+             -4360570,    7103271,  -11219887,   17467159,  -27504121,   46188364,  -97049350, 2138952071,
+            107504815,  -48949143,   28813615,  -18239775,   11719304,   -7435986,    4581297,   -2705256,
+              1512611,    -790223,     379324,    -163425,      60905,     -18357,       3824 },
+    .d = {      0,      2,     -8,     22,    -52,    110,   -214,    386,   -658,   1074,
+            -1699,   2645,  -4159,   6943, -14267,  -2716,  17594,  -7820,   4574,  -2890,
+             1857,  -1180,    728,   -431,    242,   -127,     61,    -26,     10,     -3,      1 } },
+  { .h = {      -3286,      16665,     -56815,     155123,    -364576,     766798,   -1478975,    2661363,
+             -4529046,    7378255,  -11654771,   18144329,  -28568698,   47965704, -100701741, 2138256809,
+            112008904,  -50950939,   29984619,  -18979731,   12194771,   -7738005,    4767708,   -2815598,
+              1574494,    -822674,     394974,    -170209,      63454,     -19135,       3990 },
+    .d = {      0,      2,     -8,     22,    -52,    110,   -213,    385,   -656,   1071,
+            -1694,   2638,  -4147,   6920, -14196,  -2822,  17653,  -7830,   4578,  -2893,
+             1859,  -1181,    729,   -432,    242,   -127,     61,    -27,     10,     -3,      1 } },
+  { .h = {      -3399,      17253,     -58854,     160746,    -377885,     794942,   -1533489,    2759796,
+             -4697011,    7652448,  -12088448,   18819633,  -29630217,   49737160, -104336040, 2137534429,
+            116528065,  -52955522,   31156670,  -19720242,   12670595,   -8040277,    4954301,   -2926068,
+              1636464,    -855179,     410656,    -177009,      66011,     -19916,       4157 },
+    .d = {      0,      2,     -8,     22,    -52,    110,   -212,    383,   -654,   1068,
+            -1689,   2631,  -4134,   6897, -14126,  -2928,  17712,  -7841,   4582,  -2895,
+             1860,  -1182,    730,   -432,    242,   -127,     61,    -27,     10,     -3,      1 } },
+  { .h = {      -3510,      17838,     -60882,     166343,    -391138,     822979,   -1587812,    2857907,
+             -4864462,    7925844,  -12520905,   19493049,  -30688643,   51502679, -107952202, 2136784946,
+            121062229,  -54962824,   32329726,  -20461281,   13146760,   -8342790,    5141069,   -3036663,
+              1698518,    -887738,     426370,    -183827,      68576,     -20701,       4325 },
+    .d = {      0,      2,     -8,     22,    -52,    109,   -211,    382,   -652,   1065,
+            -1684,   2623,  -4122,   6873, -14055,  -3033,  17770,  -7851,   4586,  -2897,
+             1861,  -1183,    730,   -432,    243,   -127,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -3620,      18419,     -62899,     171912,    -404334,     850906,   -1641941,    2955692,
+             -5031393,    8198432,  -12952127,   20164555,  -31743941,   53262211, -111550184, 2136008379,
+            125611322,  -56972778,   33503743,  -21202820,   13623248,   -8645534,    5328005,   -3147377,
+              1760654,    -920349,     442114,    -190661,      71150,     -21489,       4495 },
+    .d = {      0,      2,     -8,     22,    -51,    109,   -211,    381,   -650,   1062,
+            -1680,   2616,  -4110,   6850, -13983,  -3139,  17828,  -7861,   4590,  -2898,
+             1862,  -1183,    731,   -433,    243,   -128,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -3729,      18995,     -64904,     177454,    -417473,     878723,   -1695874,    3053150,
+             -5197797,    8470202,  -13382098,   20834128,  -32796078,   55015705, -115129943, 2135204746,
+            130175273,  -58985318,   34678680,  -21944833,   14100041,   -8948497,    5515102,   -3258207,
+              1822869,    -953011,     457889,    -197511,      73731,     -22280,       4665 },
+    .d = {      0,      2,     -8,     22,    -51,    108,   -210,    379,   -648,   1058,
+            -1675,   2608,  -4097,   6826, -13912,  -3245,  17886,  -7871,   4593,  -2900,
+             1864,  -1184,    731,   -433,    243,   -128,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -3837,      19568,     -66897,     182969,    -430554,     906429,   -1749610,    3150276,
+             -5363670,    8741148,  -13810806,   21501746,  -33845019,   56763109, -118691435, 2134374064,
+            134754009,  -61000375,   35854493,  -22687291,   14577121,   -9251667,    5702353,   -3369150,
+              1885162,    -985723,     473693,    -204377,      76319,     -23074,       4836 },
+    .d = {      0,      2,     -8,     21,    -51,    108,   -209,    378,   -646,   1055,
+            -1670,   2600,  -4085,   6802, -13841,  -3350,  17943,  -7881,   4596,  -2902,
+             1865,  -1185,    732,   -434,    244,   -128,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -3944,      20137,     -68880,     188456,    -443577,     934024,   -1803147,    3247068,
+             -5529006,    9011258,  -14238235,   22167386,  -34890731,   58504374, -122234619, 2133516355,
+            139347456,  -63017882,   37031139,  -23430166,   15054471,   -9555033,    5889751,   -3480199,
+              1947529,   -1018483,     489527,    -211260,      78915,     -23871,       5008 },
+    .d = {      0,      2,     -8,     21,    -51,    107,   -208,    377,   -644,   1052,
+            -1665,   2592,  -4072,   6778, -13769,  -3456,  18000,  -7890,   4599,  -2903,
+             1866,  -1186,    733,   -434,    244,   -128,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -4050,      20702,     -70851,     193916,    -456542,     961507,   -1856483,    3343523,
+             -5693799,    9280524,  -14664371,   22831027,  -35933179,   60239449, -125759453, 2132631636,
+            143955541,  -65037771,   38208577,  -24173432,   15532071,   -9858583,    6077289,   -3591352,
+              2009969,   -1051292,     505389,    -218158,      81519,     -24672,       5181 },
+    .d = {      0,      2,     -8,     21,    -50,    107,   -208,    375,   -642,   1048,
+            -1659,   2584,  -4059,   6753, -13697,  -3561,  18057,  -7899,   4602,  -2905,
+             1867,  -1186,    733,   -435,    244,   -128,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -4155,      21262,     -72810,     199348,    -469448,     988877,   -1909617,    3439637,
+             -5858045,    9548938,  -15089201,   23492647,  -36972332,   61968284, -129265895, 2131719931,
+            148578190,  -67059973,   39386762,  -24917060,   16009905,  -10162307,    6264960,   -3702605,
+              2072479,   -1084146,     521280,    -225071,      84130,     -25475,       5355 },
+    .d = {      0,      2,     -8,     21,    -50,    106,   -207,    374,   -639,   1045,
+            -1654,   2576,  -4046,   6729, -13625,  -3667,  18114,  -7908,   4605,  -2906,
+             1867,  -1187,    734,   -435,    244,   -129,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -4259,      21819,     -74758,     204753,    -482295,    1016133,   -1962548,    3535407,
+             -6021738,    9816490,  -15512709,   24152223,  -38008155,   63690831, -132753906, 2130781258,
+            153215328,  -69084421,   40565652,  -25661023,   16487953,  -10466193,    6452756,   -3813952,
+              2135057,   -1117046,     537198,    -231999,      86749,     -26282,       5531 },
+    .d = {      0,      2,     -8,     21,    -50,    106,   -206,    373,   -637,   1042,
+            -1649,   2568,  -4033,   6704, -13553,  -3772,  18170,  -7916,   4608,  -2907,
+             1868,  -1188,    734,   -435,    245,   -129,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -4362,      22372,     -76694,     210129,    -495083,    1043274,   -2015273,    3630831,
+             -6184873,   10083172,  -15934883,   24809735,  -39040615,   65407040, -136223446, 2129815641,
+            157866881,  -71111044,   41745204,  -26405292,   16966199,  -10770229,    6640672,   -3925391,
+              2197701,   -1149989,     553143,    -238943,      89375,     -27091,       5707 },
+    .d = {      0,      2,     -8,     21,    -50,    106,   -205,    371,   -635,   1038,
+            -1644,   2560,  -4020,   6679, -13481,  -3877,  18226,  -7925,   4610,  -2908,
+             1869,  -1188,    734,   -436,    245,   -129,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -4464,      22921,     -78619,     215478,    -507811,    1070299,   -2067791,    3725905,
+             -6347443,   10348975,  -16355707,   25465160,  -40069680,   67116863, -139674474, 2128823102,
+            162532772,  -73139775,   42925374,  -27149840,   17444625,  -11074403,    6828699,   -4036916,
+              2260407,   -1182975,     569114,    -245901,      92008,     -27903,       5884 },
+    .d = {      0,      2,     -7,     21,    -49,    105,   -204,    370,   -633,   1035,
+            -1639,   2552,  -4006,   6654, -13408,  -3982,  18282,  -7933,   4612,  -2909,
+             1869,  -1189,    735,   -436,    245,   -129,     62,    -27,     10,     -3,      1 } },
+  { .h = {      -4565,      23465,     -80531,     220798,    -520479,    1097209,   -2120100,    3820627,
+             -6509446,   10613890,  -16775169,   26118477,  -41095316,   68820250, -143106953, 2127803664,
+            167212925,  -75170544,   44106118,  -27894638,   17923210,  -11378705,    7016830,   -4148524,
+              2323175,   -1216003,     585111,    -252873,      94648,     -28719,       6062 },
+    .d = {      0,      2,     -7,     21,    -49,    105,   -204,    369,   -631,   1031,
+            -1633,   2544,  -3993,   6629, -13336,  -4087,  18337,  -7940,   4614,  -2910,
+             1870,  -1189,    735,   -436,    245,   -129,     63,    -27,     10,     -3,      1 } },
+  { .h = {      -4664,      24006,     -82433,     226090,    -533087,    1124001,   -2172199,    3914992,
+             -6670874,   10877908,  -17193253,   26769665,  -42117492,   70517154, -146520843, 2126757350,
+            171907264,  -77203282,   45287394,  -28639659,   18401939,  -11683122,    7205059,   -4260210,
+              2386002,   -1249071,     601133,    -259860,      97295,     -29537,       6241 },
+    .d = {      0,      2,     -7,     21,    -49,    104,   -203,    367,   -628,   1028,
+            -1628,   2535,  -3979,   6603, -13263,  -4192,  18392,  -7948,   4616,  -2911,
+             1871,  -1190,    736,   -437,    246,   -129,     63,    -27,     10,     -3,      1 } },
+  { .h = {      -4763,      24543,     -84322,     231353,    -545634,    1150676,   -2224087,    4009000,
+             -6831722,   11141021,  -17609948,   27418702,  -43136176,   72207528, -149916107, 2125684186,
+            176615712,  -79237919,   46469156,  -29384875,   18880792,  -11987643,    7393378,   -4371970,
+              2448884,   -1282178,     617179,    -266860,      99950,     -30358,       6421 },
+    .d = {      0,      2,     -7,     20,    -49,    104,   -202,    366,   -626,   1024,
+            -1622,   2527,  -3965,   6577, -13190,  -4297,  18447,  -7955,   4618,  -2912,
+             1871,  -1190,    736,   -437,    246,   -129,     63,    -27,     10,     -3,      1 } },
+  { .h = {      -4861,      25075,     -86200,     236588,    -558120,    1177232,   -2275761,    4102646,
+             -6991987,   11403221,  -18025238,   28065568,  -44151334,   73891323, -153292707, 2124584196,
+            181338192,  -81274386,   47651363,  -30130256,   19359752,  -12292256,    7581779,   -4483800,
+              2511820,   -1315322,     633250,    -273875,     102611,     -31183,       6601 },
+    .d = {      0,      2,     -7,     20,    -49,    103,   -201,    364,   -624,   1021,
+            -1617,   2518,  -3952,   6551, -13117,  -4402,  18502,  -7962,   4620,  -2912,
+             1871,  -1190,    736,   -437,    246,   -130,     63,    -27,     10,     -3,      1 } },
+  { .h = {      -4958,      25604,     -88066,     241794,    -570544,    1203669,   -2327220,    4195927,
+             -7151662,   11664499,  -18439111,   28710241,  -45162935,   75568493, -156650607, 2123457406,
+            186074626,  -83312611,   48833970,  -30875776,   19838799,  -12596950,    7770257,   -4595696,
+              2574808,   -1348503,     649344,    -280902,     105278,     -32010,       6783 },
+    .d = {      0,      2,     -7,     20,    -48,    103,   -200,    363,   -621,   1017,
+            -1611,   2510,  -3938,   6525, -13044,  -4506,  18556,  -7968,   4621,  -2913,
+             1872,  -1190,    737,   -437,    246,   -130,     63,    -28,     10,     -3,      1 } },
+  { .h = {      -5053,      26128,     -89920,     246971,    -582907,    1229986,   -2378463,    4288842,
+             -7310742,   11924846,  -18851553,   29352700,  -46170948,   77238990, -159989771, 2122303842,
+            190824935,  -85352525,   50016933,  -31621405,   20317916,  -12901713,    7958803,   -4707652,
+              2637845,   -1381720,     665461,    -287943,     107953,     -32840,       6966 },
+    .d = {      0,      2,     -7,     20,    -48,    102,   -199,    362,   -619,   1013,
+            -1605,   2501,  -3923,   6499, -12970,  -4611,  18610,  -7975,   4622,  -2913,
+             1872,  -1191,    737,   -438,    246,   -130,     63,    -28,     10,     -3,      1 } },
+  { .h = {      -5148,      26649,     -91762,     252120,    -595207,    1256181,   -2429488,    4381386,
+             -7469223,   12184254,  -19262550,   29992925,  -47175341,   78902770, -163310163, 2121123531,
+            195589041,  -87394058,   51200207,  -32367116,   20797084,  -13206533,    8147410,   -4819666,
+              2700928,   -1414970,     681601,    -294997,     110634,     -33672,       7150 },
+    .d = {      0,      2,     -7,     20,    -48,    102,   -198,    360,   -617,   1010,
+            -1600,   2492,  -3909,   6473, -12897,  -4715,  18663,  -7981,   4623,  -2913,
+             1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     10,     -3,      1 } },
+  { .h = {      -5242,      27165,     -93592,     257239,    -607446,    1282256,   -2480293,    4473557,
+             -7627099,   12442714,  -19672089,   30630895,  -48176082,   80559784, -166611747, 2119916500,
+            200366864,  -89437138,   52383750,  -33112880,   21276285,  -13511399,    8336071,   -4931733,
+              2764056,   -1448254,     697761,    -302063,     113321,     -34508,       7335 },
+    .d = {      0,      2,     -7,     20,    -48,    101,   -198,    359,   -614,   1006,
+            -1594,   2483,  -3895,   6446, -12823,  -4819,  18717,  -7987,   4624,  -2913,
+             1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     11,     -3,      1 } },
+  { .h = {      -5334,      27677,     -95411,     262329,    -619621,    1308208,   -2530878,    4565352,
+             -7784366,   12700219,  -20080158,   31266590,  -49173140,   82209988, -169894489, 2118682778,
+            205158325,  -91481695,   53567516,  -33858668,   21755501,  -13816298,    8524779,   -5043847,
+              2827226,   -1481569,     713943,    -309142,     116015,     -35346,       7520 },
+    .d = {      0,      2,     -7,     20,    -47,    101,   -197,    357,   -612,   1002,
+            -1588,   2474,  -3880,   6419, -12749,  -4923,  18770,  -7992,   4625,  -2913,
+             1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     11,     -3,      1 } },
+  { .h = {      -5426,      28185,     -97217,     267390,    -631734,    1334037,   -2581240,    4656769,
+             -7941018,   12956761,  -20486742,   31899988,  -50166485,   83853337, -173158356, 2117422394,
+            209963344,  -93527657,   54751461,  -34604452,   22234712,  -14121219,    8713526,   -5156006,
+              2890435,   -1514914,     730146,    -316233,     118716,     -36187,       7707 },
+    .d = {      0,      2,     -7,     20,    -47,    100,   -196,    356,   -610,    998,
+            -1582,   2465,  -3866,   6392, -12676,  -5027,  18822,  -7997,   4625,  -2913,
+             1872,  -1191,    737,   -438,    247,   -130,     63,    -28,     11,     -3,      1 } },
+  { .h = {      -5516,      28690,     -99012,     272422,    -643783,    1359743,   -2631378,    4747805,
+             -8097051,   13212330,  -20891829,   32531071,  -51156085,   85489784, -176403313, 2116135376,
+            214781840,  -95574954,   55935542,  -35350204,   22713901,  -14426151,    8902306,   -5268205,
+              2953681,   -1548288,     746368,    -323336,     121422,     -37031,       7894 },
+    .d = {      0,      2,     -7,     20,    -47,    100,   -195,    354,   -607,    994,
+            -1576,   2456,  -3851,   6365, -12602,  -5131,  18875,  -8002,   4626,  -2913,
+             1872,  -1191,    738,   -438,    247,   -130,     63,    -28,     11,     -3,      1 } },
+  { .h = {      -5606,      29190,    -100794,     277424,    -655769,    1385324,   -2681291,    4838456,
+             -8252459,   13466919,  -21295405,   33159817,  -52141911,   87119286, -179629328, 2114821754,
+            219613732,  -97623513,   57119713,  -36095894,   23193049,  -14731080,    9091110,   -5380439,
+              3016961,   -1581690,     762609,    -330451,     124134,     -37877,       8083 },
+    .d = {      0,      2,     -7,     19,    -47,     99,   -194,    353,   -605,    991,
+            -1571,   2447,  -3836,   6338, -12528,  -5235,  18927,  -8007,   4626,  -2913,
+             1871,  -1191,    738,   -439,    247,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -5694,      29686,    -102564,     282396,    -667691,    1410780,   -2730977,    4928720,
+             -8407239,   13720519,  -21697458,   33786206,  -53123931,   88741798, -182836369, 2113481560,
+            224458939,  -99673263,   58303930,  -36841495,   23672137,  -15035996,    9279932,   -5492704,
+              3080274,   -1615118,     778869,    -337577,     126853,     -38727,       8272 },
+    .d = {      0,      2,     -7,     19,    -46,     99,   -193,    351,   -602,    987,
+            -1565,   2438,  -3821,   6310, -12453,  -5339,  18978,  -8011,   4626,  -2912,
+             1871,  -1191,    738,   -439,    247,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -5782,      30178,    -104323,     287339,    -679549,    1436111,   -2780435,    5018595,
+             -8561384,   13973124,  -22097975,   34410219,  -54102116,   90357277, -186024402, 2112114824,
+            229317379, -101724131,   59488148,  -37586978,   24151148,  -15340887,    9468764,   -5604996,
+              3143616,   -1648572,     795148,    -344714,     129578,     -39578,       8462 },
+    .d = {      0,      2,     -7,     19,    -46,     98,   -192,    350,   -600,    983,
+            -1558,   2428,  -3806,   6283, -12379,  -5442,  19030,  -8015,   4626,  -2911,
+             1871,  -1191,    738,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -5869,      30666,    -106069,     292252,    -691342,    1461315,   -2829663,    5108078,
+             -8714890,   14224724,  -22496943,   35031837,  -55076436,   91965677, -189193398, 2110721579,
+            234188969, -103776046,   60672322,  -38332313,   24630061,  -15645741,    9657598,   -5717310,
+              3206986,   -1682049,     811443,    -351862,     132308,     -40433,       8653 },
+    .d = {      0,      2,     -7,     19,    -46,     98,   -191,    348,   -597,    979,
+            -1552,   2419,  -3791,   6255, -12304,  -5546,  19081,  -8019,   4625,  -2911,
+             1870,  -1191,    738,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -5954,      31149,    -107803,     297135,    -703071,    1486392,   -2878660,    5197165,
+             -8867754,   14475312,  -22894349,   35651038,  -56046860,   93566957, -192343325, 2109301856,
+            239073627, -105828936,   61856409,  -39077472,   25108859,  -15950545,    9846429,   -5829642,
+              3270380,   -1715549,     827755,    -359021,     135044,     -41290,       8845 },
+    .d = {      0,      2,     -7,     19,    -46,     97,   -190,    346,   -595,    975,
+            -1546,   2409,  -3775,   6227, -12230,  -5649,  19131,  -8023,   4625,  -2910,
+             1870,  -1190,    738,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6039,      31629,    -109525,     301989,    -714734,    1511341,   -2927425,    5285855,
+             -9019969,   14724879,  -23290181,   36267804,  -57013359,   95161072, -195474154, 2107855690,
+            243971269, -107882726,   63040362,  -39822427,   25587523,  -16255288,   10035247,   -5941988,
+              3333797,   -1749070,     844084,    -366190,     137786,     -42149,       9038 },
+    .d = {      0,      2,     -7,     19,    -45,     97,   -190,    345,   -592,    971,
+            -1540,   2400,  -3760,   6199, -12155,  -5752,  19182,  -8026,   4624,  -2909,
+             1869,  -1190,    737,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6122,      32105,    -111235,     306812,    -726332,    1536161,   -2975956,    5374145,
+             -9171531,   14973419,  -23684427,   36882115,  -57975905,   96747981, -198585854, 2106383112,
+            248881812, -109937346,   64224137,  -40567148,   26066034,  -16559958,   10224045,   -6054343,
+              3397233,   -1782612,     860428,    -373369,     140533,     -43011,       9232 },
+    .d = {      0,      2,     -7,     19,    -45,     96,   -189,    343,   -589,    967,
+            -1534,   2390,  -3744,   6171, -12080,  -5855,  19232,  -8029,   4623,  -2908,
+             1869,  -1190,    737,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6205,      32576,    -112932,     311604,    -737865,    1560853,   -3024251,    5462032,
+             -9322436,   15220923,  -24077073,   37493953,  -58934467,   98327641, -201678396, 2104884159,
+            253805172, -111992721,   65407689,  -41311606,   26544374,  -16864544,   10412817,   -6166702,
+              3460687,   -1816172,     876786,    -380558,     143285,     -43876,       9427 },
+    .d = {      0,      2,     -7,     19,    -45,     96,   -188,    342,   -587,    963,
+            -1527,   2380,  -3729,   6142, -12005,  -5958,  19282,  -8031,   4622,  -2907,
+             1868,  -1189,    737,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6286,      33044,    -114618,     316367,    -749332,    1585415,   -3072310,    5549513,
+             -9472678,   15467384,  -24468108,   38103297,  -59889016,   99900010, -204751752, 2103358864,
+            258741265, -114048779,   66590973,  -42055773,   27022523,  -17169032,   10601555,   -6279062,
+              3524155,   -1849749,     893160,    -387756,     146043,     -44743,       9622 },
+    .d = {      0,      2,     -7,     18,    -45,     95,   -187,    340,   -584,    959,
+            -1521,   2370,  -3713,   6113, -11930,  -6061,  19331,  -8034,   4621,  -2906,
+             1867,  -1189,    737,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6367,      33507,    -116291,     321099,    -760732,    1609846,   -3120132,    5636587,
+             -9622254,   15712794,  -24857519,   38710129,  -60839525,  101465046, -207805893, 2101807263,
+            263690004, -116105447,   67773944,  -42799620,   27500464,  -17473411,   10790250,   -6391418,
+              3587636,   -1883343,     909546,    -394964,     148807,     -45612,       9819 },
+    .d = {      0,      2,     -6,     18,    -44,     95,   -186,    339,   -582,    954,
+            -1515,   2361,  -3697,   6085, -11855,  -6164,  19380,  -8036,   4620,  -2904,
+             1866,  -1189,    737,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6446,      33966,    -117952,     325801,    -772067,    1634146,   -3167714,    5723250,
+             -9771159,   15957145,  -25245294,   39314430,  -61785964,  103022708, -210840793, 2100229392,
+            268651306, -118162649,   68956555,  -43543117,   27978177,  -17777669,   10978897,   -6503765,
+              3651127,   -1916952,     925946,    -402180,     151575,     -46484,      10016 },
+    .d = {      0,      2,     -6,     18,    -44,     94,   -185,    337,   -579,    950,
+            -1508,   2351,  -3681,   6056, -11780,  -6266,  19429,  -8038,   4618,  -2903,
+             1865,  -1188,    737,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6525,      34421,    -119600,     330472,    -783334,    1658315,   -3215055,    5809500,
+             -9919389,   16200430,  -25631421,   39916181,  -62728305,  104572956, -213856425, 2098625289,
+            273625084, -120220314,   70138763,  -44286236,   28455643,  -18081794,   11167487,   -6616100,
+              3714626,   -1950573,     942358,    -409406,     154349,     -47358,      10215 },
+    .d = {      0,      2,     -6,     18,    -44,     94,   -184,    335,   -576,    946,
+            -1502,   2341,  -3665,   6027, -11704,  -6368,  19477,  -8039,   4616,  -2901,
+             1864,  -1187,    736,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6602,      34872,    -121236,     335112,    -794535,    1682352,   -3262155,    5895334,
+            -10066938,   16442641,  -26015887,   40515364,  -63666520,  106115748, -216852761, 2096994989,
+            278611252, -122278367,   71320521,  -45028947,   28932843,  -18385774,   11356013,   -6728416,
+              3778129,   -1984207,     958782,    -416639,     157127,     -48235,      10414 },
+    .d = {      0,      2,     -6,     18,    -43,     93,   -183,    334,   -574,    942,
+            -1495,   2330,  -3649,   5997, -11629,  -6471,  19525,  -8040,   4614,  -2900,
+             1863,  -1187,    736,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6679,      35319,    -122860,     339722,    -805668,    1706255,   -3309011,    5980750,
+            -10213803,   16683772,  -26398682,   41111959,  -64600581,  107651045, -219829776, 2095338532,
+            283609724, -124336734,   72501784,  -45771221,   29409760,  -18689597,   11544467,   -6840711,
+              3841634,   -2017852,     975217,    -423881,     159910,     -49114,      10614 },
+    .d = {      0,      2,     -6,     18,    -43,     93,   -182,    332,   -571,    938,
+            -1489,   2320,  -3632,   5968, -11553,  -6573,  19573,  -8041,   4612,  -2898,
+             1862,  -1186,    736,   -439,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6754,      35762,    -124472,     344301,    -816735,    1730025,   -3355623,    6065745,
+            -10359978,   16923814,  -26779793,   41705949,  -65530460,  109178806, -222787445, 2093655956,
+            288620412, -126395340,   73682507,  -46513030,   29886373,  -18993251,   11732842,   -6952980,
+              3905139,   -2051507,     991663,    -431131,     162698,     -49995,      10815 },
+    .d = {      0,      2,     -6,     18,    -43,     92,   -181,    330,   -568,    933,
+            -1482,   2310,  -3616,   5938, -11478,  -6674,  19620,  -8042,   4610,  -2896,
+             1861,  -1185,    736,   -438,    248,   -131,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6829,      36201,    -126071,     348849,    -827733,    1753661,   -3401990,    6150318,
+            -10505461,   17162760,  -27159208,   42297316,  -66456129,  110698992, -225725743, 2091947299,
+            293643229, -128454111,   74862644,  -47254344,   30362664,  -19296723,   11921131,   -7065217,
+              3968642,   -2085169,    1008118,    -438389,     165491,     -50879,      11016 },
+    .d = {      0,      2,     -6,     18,    -43,     92,   -180,    329,   -566,    929,
+            -1475,   2300,  -3599,   5908, -11402,  -6776,  19667,  -8042,   4607,  -2894,
+             1859,  -1185,    735,   -438,    248,   -132,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6903,      36636,    -127658,     353366,    -838663,    1777163,   -3448109,    6234465,
+            -10650246,   17400603,  -27536916,   42886041,  -67377562,  112211564, -228644645, 2090212602,
+            298678087, -130512973,   76042149,  -47995133,   30838614,  -19600002,   12109325,   -7177420,
+              4032139,   -2118839,    1024583,    -445654,     168288,     -51765,      11219 },
+    .d = {      0,      2,     -6,     18,    -42,     91,   -179,    327,   -563,    925,
+            -1469,   2289,  -3583,   5879, -11326,  -6878,  19714,  -8042,   4605,  -2892,
+             1858,  -1184,    735,   -438,    248,   -132,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -6975,      37066,    -129232,     357852,    -849526,    1800529,   -3493981,    6318185,
+            -10794329,   17637335,  -27912905,   43472106,  -68294731,  113716483, -231544129, 2088451906,
+            303724899, -132571850,   77220976,  -48735369,   31314204,  -19903076,   12297418,   -7289582,
+              4095628,   -2152514,    1041056,    -452926,     171089,     -52653,      11422 },
+    .d = {      0,      2,     -6,     17,    -42,     91,   -178,    325,   -560,    920,
+            -1462,   2279,  -3566,   5849, -11250,  -6979,  19760,  -8042,   4602,  -2889,
+             1856,  -1183,    734,   -438,    248,   -132,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -7047,      37493,    -130794,     362306,    -860320,    1823759,   -3539603,    6401474,
+            -10937706,   17872951,  -28287164,   44055494,  -69207609,  115213710, -234424171, 2086665250,
+            308783574, -134630668,   78399081,  -49475022,   31789415,  -20205931,   12485401,   -7401700,
+              4159107,   -2186193,    1057537,    -460204,     173895,     -53543,      11626 },
+    .d = {      0,      2,     -6,     17,    -42,     90,   -177,    324,   -557,    916,
+            -1455,   2268,  -3549,   5818, -11174,  -7080,  19806,  -8042,   4599,  -2887,
+             1855,  -1182,    734,   -438,    248,   -132,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -7118,      37915,    -132343,     366730,    -871045,    1846853,   -3584974,    6484331,
+            -11080373,   18107442,  -28659681,   44636186,  -70116170,  116703208, -237284748, 2084852676,
+            313854024, -136689351,   79576416,  -50214063,   32264229,  -20508557,   12673267,   -7513769,
+              4222574,   -2219874,    1074025,    -467489,     176705,     -54435,      11831 },
+    .d = {      0,      2,     -6,     17,    -42,     90,   -176,    322,   -555,    912,
+            -1448,   2258,  -3532,   5788, -11098,  -7181,  19852,  -8041,   4596,  -2884,
+             1853,  -1181,    733,   -438,    248,   -132,     64,    -28,     11,     -3,      1 } },
+  { .h = {      -7187,      38334,    -133880,     371122,    -881702,    1869810,   -3630093,    6566753,
+            -11222326,   18340801,  -29030444,   45214165,  -71020386,  118184939, -240125839, 2083014227,
+            318936160, -138747824,   80752936,  -50952463,   32738625,  -20810941,   12861009,   -7625785,
+              4286024,   -2253558,    1090519,    -474781,     179520,     -55329,      12037 },
+    .d = {      0,      2,     -6,     17,    -41,     89,   -175,    320,   -552,    907,
+            -1441,   2247,  -3515,   5758, -11022,  -7282,  19897,  -8040,   4592,  -2882,
+             1851,  -1180,    733,   -437,    248,   -132,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -7256,      38748,    -135405,     375483,    -892289,    1892629,   -3674960,    6648738,
+            -11363560,   18573022,  -29399443,   45789414,  -71920233,  119658865, -242947422, 2081149946,
+            324029892, -140806012,   81928596,  -51690192,   33212585,  -21113071,   13048619,   -7737743,
+              4349457,   -2287241,    1107020,    -482078,     182338,     -56226,      12244 },
+    .d = {      0,      2,     -6,     17,    -41,     89,   -174,    319,   -549,    903,
+            -1434,   2236,  -3498,   5727, -10946,  -7383,  19942,  -8038,   4589,  -2879,
+             1850,  -1179,    732,   -437,    248,   -132,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -7324,      39158,    -136917,     379812,    -902807,    1915311,   -3719572,    6730284,
+            -11504071,   18804097,  -29766667,   46361915,  -72815683,  121124949, -245749476, 2079259875,
+            329135129, -142863839,   83103348,  -52427221,   33686091,  -21414934,   13236090,   -7849638,
+              4412869,   -2320923,    1123526,    -489381,     185160,     -57124,      12451 },
+    .d = {      0,      2,     -6,     17,    -41,     88,   -173,    317,   -546,    898,
+            -1427,   2226,  -3481,   5696, -10869,  -7484,  19987,  -8037,   4585,  -2876,
+             1848,  -1178,    732,   -437,    248,   -132,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -7391,      39564,    -138417,     384110,    -913256,    1937854,   -3763929,    6811387,
+            -11643856,   19034020,  -30132104,   46931652,  -73706710,  122583155, -248531980, 2077344058,
+            334251781, -144921228,   84277148,  -53163520,   34159122,  -21716518,   13423413,   -7961467,
+              4476258,   -2354603,    1140036,    -496689,     187986,     -58025,      12660 },
+    .d = {      0,      2,     -6,     17,    -41,     88,   -172,    315,   -543,    894,
+            -1420,   2215,  -3463,   5665, -10793,  -7584,  20031,  -8035,   4581,  -2873,
+             1846,  -1177,    731,   -437,    248,   -132,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7457,      39966,    -139904,     388376,    -923634,    1960257,   -3808029,    6892048,
+            -11782909,   19262784,  -30495743,   47498606,  -74593290,  124033446, -251294915, 2075402541,
+            339379757, -146978105,   85449948,  -53899061,   34631661,  -22017812,   13610581,   -8073224,
+              4539621,   -2388278,    1156550,    -504002,     190815,     -58927,      12869 },
+    .d = {      0,      2,     -6,     17,    -40,     87,   -171,    313,   -540,    889,
+            -1413,   2204,  -3446,   5634, -10716,  -7684,  20075,  -8032,   4577,  -2870,
+             1844,  -1176,    730,   -436,    247,   -132,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7522,      40364,    -141378,     392611,    -933943,    1982521,   -3851872,    6972261,
+            -11921228,   19490382,  -30857574,   48062762,  -75475396,  125475786, -254038262, 2073435368,
+            344518965, -149034393,   86621703,  -54633813,   35103687,  -22318803,   13797587,   -8184904,
+              4602956,   -2421948,    1173068,    -511320,     193648,     -59832,      13079 },
+    .d = {      0,      2,     -6,     16,    -40,     86,   -170,    312,   -537,    884,
+            -1406,   2193,  -3428,   5603, -10640,  -7784,  20119,  -8030,   4573,  -2867,
+             1842,  -1175,    730,   -436,    247,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7586,      40758,    -142840,     396813,    -944182,    2004645,   -3895456,    7052027,
+            -12058809,   19716808,  -31217585,   48624102,  -76353004,  126910140, -256762002, 2071442585,
+            349669313, -151090015,   87792367,  -55367747,   35575182,  -22619479,   13984423,   -8296504,
+              4666260,   -2455611,    1189588,    -518643,     196485,     -60738,      13289 },
+    .d = {      0,      2,     -6,     16,    -40,     86,   -169,    310,   -535,    880,
+            -1399,   2182,  -3410,   5572, -10563,  -7884,  20162,  -8027,   4568,  -2864,
+             1840,  -1173,    729,   -436,    247,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7649,      41148,    -144290,     400984,    -954350,    2026628,   -3938780,    7131342,
+            -12195647,   19942055,  -31575767,   49182610,  -77226089,  128336472, -259466116, 2069424238,
+            354830709, -153144895,   88961893,  -56100833,   36046127,  -22919827,   14171082,   -8408019,
+              4729531,   -2489267,    1206110,    -525969,     199325,     -61647,      13501 },
+    .d = {      0,      2,     -6,     16,    -39,     85,   -168,    308,   -532,    875,
+            -1392,   2171,  -3393,   5540, -10486,  -7984,  20204,  -8024,   4564,  -2860,
+             1837,  -1172,    728,   -435,    247,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7711,      41534,    -145726,     405123,    -964448,    2048470,   -3981843,    7210205,
+            -12331738,   20166115,  -31932108,   49738269,  -78094624,  129754747, -262150588, 2067380374,
+            360003060, -155198957,   90130235,  -56833043,   36516503,  -23219835,   14357555,   -8519444,
+              4792765,   -2522912,    1222634,    -533300,     202168,     -62557,      13713 },
+    .d = {      0,      1,     -6,     16,    -39,     85,   -167,    306,   -529,    871,
+            -1385,   2159,  -3375,   5509, -10409,  -8083,  20247,  -8020,   4559,  -2857,
+             1835,  -1171,    728,   -435,    247,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7772,      41915,    -147151,     409231,    -974475,    2070170,   -4024645,    7288613,
+            -12467079,   20388984,  -32286597,   50291062,  -78958587,  131164932, -264815399, 2065311041,
+            365186274, -157252124,   91297347,  -57564347,   36986290,  -23519492,   14543835,   -8630775,
+              4855961,   -2556547,    1239157,    -540634,     205014,     -63469,      13926 },
+    .d = {      0,      1,     -6,     16,    -39,     84,   -166,    304,   -526,    866,
+            -1377,   2148,  -3357,   5477, -10333,  -8183,  20289,  -8016,   4554,  -2853,
+             1833,  -1169,    727,   -434,    247,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7832,      42293,    -148562,     413306,    -984431,    2091728,   -4067183,    7366564,
+            -12601666,   20610653,  -32639226,   50840975,  -79817953,  132566991, -267460534, 2063216286,
+            370380256, -159304318,   92463182,  -58294714,   37455469,  -23818784,   14729914,   -8742006,
+              4919115,   -2590170,    1255681,    -547971,     207864,     -64383,      14140 },
+    .d = {      0,      1,     -5,     16,    -39,     84,   -165,    303,   -523,    861,
+            -1370,   2137,  -3339,   5445, -10256,  -8282,  20331,  -8012,   4549,  -2849,
+             1830,  -1168,    726,   -434,    247,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7892,      42666,    -149961,     417349,    -994316,    2113143,   -4109457,    7444056,
+            -12735495,   20831118,  -32989982,   51387990,  -80672696,  133960892, -270085976, 2061096159,
+            375584914, -161355463,   93627694,  -59024117,   37924022,  -24117700,   14915785,   -8853134,
+              4982226,   -2623779,    1272204,    -555312,     210716,     -65298,      14354 },
+    .d = {      0,      1,     -5,     16,    -38,     83,   -164,    301,   -520,    856,
+            -1363,   2125,  -3321,   5413, -10179,  -8381,  20372,  -8008,   4544,  -2845,
+             1828,  -1166,    725,   -434,    246,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -7950,      43036,    -151348,     421360,   -1004130,    2134415,   -4151465,    7521087,
+            -12868562,   21050371,  -33338855,   51932092,  -81522795,  135346599, -272691710, 2058950708,
+            380800152, -163405482,   94790836,  -59752524,   38391928,  -24416226,   15101440,   -8964154,
+              5045289,   -2657373,    1288726,    -562655,     213571,     -66215,      14569 },
+    .d = {      0,      1,     -5,     16,    -38,     83,   -163,    299,   -517,    852,
+            -1355,   2114,  -3302,   5381, -10102,  -8479,  20413,  -8003,   4538,  -2841,
+             1825,  -1165,    724,   -433,    246,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -8007,      43401,    -152722,     425339,   -1013872,    2155544,   -4193208,    7597656,
+            -13000864,   21268406,  -33685837,   52473264,  -82368224,  136724081, -275277721, 2056779983,
+            386025876, -165454297,   95952563,  -60479906,   38859170,  -24714352,   15286872,   -9075061,
+              5108304,   -2690950,    1305245,    -570000,     216428,     -67134,      14785 },
+    .d = {      0,      1,     -5,     15,    -38,     82,   -162,    297,   -514,    847,
+            -1348,   2102,  -3284,   5349, -10025,  -8578,  20454,  -7998,   4532,  -2837,
+             1822,  -1163,    723,   -433,    246,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -8064,      43762,    -154083,     429286,   -1023543,    2176528,   -4234683,    7673759,
+            -13132398,   21485217,  -34030916,   53011491,  -83208960,  138093305, -277843995, 2054584035,
+            391261992, -167501830,   97112827,  -61206234,   39325727,  -25012064,   15472072,   -9185851,
+              5171267,   -2724510,    1321761,    -577348,     219288,     -68055,      15002 },
+    .d = {      0,      1,     -5,     15,    -37,     81,   -161,    295,   -511,    842,
+            -1340,   2091,  -3266,   5316,  -9947,  -8676,  20494,  -7993,   4526,  -2833,
+             1820,  -1161,    723,   -432,    246,   -131,     65,    -29,     11,     -4,      1 } },
+  { .h = {      -8120,      44120,    -155432,     433201,   -1033141,    2197368,   -4275890,    7749395,
+            -13263158,   21700798,  -34374082,   53546758,  -84044981,  139454238, -280390518, 2052362915,
+            396508404, -169548005,   98271581,  -61931478,   39791581,  -25309351,   15657033,   -9296518,
+              5234176,   -2758050,    1338274,    -584697,     222151,     -68977,      15219 },
+    .d = {      0,      1,     -5,     15,    -37,     81,   -160,    294,   -508,    837,
+            -1333,   2079,  -3247,   5284,  -9870,  -8774,  20534,  -7987,   4520,  -2829,
+             1817,  -1160,    722,   -432,    246,   -131,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8174,      44473,    -156768,     437083,   -1042668,    2218063,   -4316827,    7824563,
+            -13393143,   21915143,  -34715326,   54079049,  -84876262,  140806849, -282917276, 2050116673,
+            401765016, -171592743,   99428780,  -62655609,   40256712,  -25606200,   15841748,   -9407059,
+              5297027,   -2791570,    1354783,    -592048,     225016,     -69901,      15437 },
+    .d = {      0,      1,     -5,     15,    -37,     80,   -159,    292,   -505,    832,
+            -1325,   2068,  -3229,   5251,  -9793,  -8872,  20573,  -7981,   4514,  -2824,
+             1814,  -1158,    721,   -431,    245,   -131,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8228,      44822,    -158091,     440933,   -1052122,    2238612,   -4357495,    7899259,
+            -13522348,   22128246,  -35054638,   54608349,  -85702782,  142151105, -285424257, 2047845363,
+            407031733, -173635966,  100584377,  -63378597,   40721101,  -25902598,   16026208,   -9517469,
+              5359819,   -2825068,    1371287,    -599400,     227883,     -70826,      15656 },
+    .d = {      0,      1,     -5,     15,    -37,     80,   -158,    290,   -502,    828,
+            -1318,   2056,  -3210,   5218,  -9716,  -8970,  20612,  -7975,   4508,  -2820,
+             1811,  -1156,    720,   -431,    245,   -131,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8281,      45167,    -159402,     444750,   -1061504,    2259016,   -4397891,    7973483,
+            -13650769,   22340100,  -35392008,   55134643,  -86524516,  143486975, -287911449, 2045549037,
+            412308457, -175677597,  101738325,  -64100412,   41184730,  -26198533,   16210406,   -9627743,
+              5422548,   -2858542,    1387785,    -606753,     230752,     -71753,      15876 },
+    .d = {      0,      1,     -5,     15,    -36,     79,   -157,    288,   -499,    823,
+            -1310,   2044,  -3191,   5185,  -9638,  -9068,  20651,  -7969,   4501,  -2815,
+             1808,  -1154,    718,   -430,    245,   -131,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8333,      45509,    -160700,     448535,   -1070813,    2279273,   -4438015,    8047232,
+            -13778404,   22550700,  -35727426,   55657915,  -87341444,  144814429, -290378839, 2043227747,
+            417595092, -177717557,  102890577,  -64821025,   41647578,  -26493994,   16394334,   -9737876,
+              5485213,   -2891991,    1404277,    -614106,     233624,     -72681,      16096 },
+    .d = {      0,      1,     -5,     15,    -36,     79,   -156,    286,   -495,    818,
+            -1303,   2032,  -3172,   5152,  -9561,  -9165,  20689,  -7962,   4494,  -2810,
+             1805,  -1152,    717,   -430,    245,   -131,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8384,      45846,    -161986,     452288,   -1080050,    2299384,   -4477866,    8120504,
+            -13905250,   22760040,  -36060884,   56178151,  -88153543,  146133435, -292826418, 2040881549,
+            422891541, -179755768,  104041086,  -65540406,   42109627,  -26788967,   16577985,   -9847864,
+              5547810,   -2925415,    1420762,    -621460,     236497,     -73610,      16317 },
+    .d = {      0,      1,     -5,     15,    -36,     78,   -155,    284,   -492,    813,
+            -1295,   2020,  -3153,   5119,  -9483,  -9262,  20727,  -7955,   4487,  -2805,
+             1802,  -1150,    716,   -429,    244,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8434,      46179,    -163258,     456008,   -1089214,    2319347,   -4517443,    8193298,
+            -14031301,   22968114,  -36392370,   56695337,  -88960790,  147443965, -295254174, 2038510496,
+            428197707, -181792152,  105189807,  -66258525,   42570857,  -27083441,   16761351,   -9957702,
+              5610337,   -2958810,    1437239,    -628813,     239372,     -74542,      16539 },
+    .d = {      0,      1,     -5,     14,    -36,     77,   -154,    282,   -489,    808,
+            -1287,   2008,  -3134,   5086,  -9406,  -9359,  20765,  -7947,   4480,  -2800,
+             1798,  -1148,    715,   -428,    244,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8483,      46508,    -164519,     459695,   -1098305,    2339163,   -4556745,    8265612,
+            -14156556,   23174917,  -36721877,   57209457,  -89763165,  148745987, -297662098, 2036114644,
+            433513491, -183826630,  106336692,  -66975353,   43031250,  -27377403,   16944423,  -10067386,
+              5672790,   -2992176,    1453708,    -636167,     242248,     -75474,      16761 },
+    .d = {      0,      1,     -5,     14,    -35,     77,   -152,    281,   -486,    803,
+            -1279,   1996,  -3115,   5053,  -9328,  -9455,  20802,  -7939,   4473,  -2795,
+             1795,  -1146,    714,   -428,    244,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8531,      46833,    -165766,     463350,   -1107322,    2358831,   -4595771,    8337444,
+            -14281011,   23380442,  -37049395,   57720498,  -90560645,  150039472, -300050179, 2033694047,
+            438838795, -185859123,  107481694,  -67690859,   43490785,  -27670840,   17127195,  -10176911,
+              5735169,   -3025512,    1470168,    -643519,     245126,     -76408,      16984 },
+    .d = {      0,      1,     -5,     14,    -35,     76,   -151,    279,   -483,    798,
+            -1272,   1984,  -3096,   5019,  -9251,  -9552,  20839,  -7931,   4465,  -2790,
+             1792,  -1144,    713,   -427,    243,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8579,      47154,    -167001,     466972,   -1116267,    2378351,   -4634520,    8408792,
+            -14404662,   23584684,  -37374915,   58228444,  -91353209,  151324392, -302418410, 2031248762,
+            444173521, -187889553,  108624767,  -68405016,   43949445,  -27963741,   17309658,  -10286272,
+              5797468,   -3058816,    1486618,    -650871,     248005,     -77343,      17207 },
+    .d = {      0,      1,     -5,     14,    -35,     76,   -150,    277,   -480,    793,
+            -1264,   1972,  -3077,   4986,  -9173,  -9648,  20875,  -7923,   4457,  -2784,
+             1788,  -1142,    712,   -427,    243,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8626,      47471,    -168223,     470561,   -1125138,    2397722,   -4672992,    8479654,
+            -14527507,   23787638,  -37698427,   58733282,  -92140836,  152600718, -304766781, 2028778846,
+            449517569, -189917841,  109765864,  -69117792,   44407209,  -28256093,   17491806,  -10395464,
+              5859688,   -3092086,    1503057,    -658221,     250886,     -78279,      17432 },
+    .d = {      0,      1,     -5,     14,    -34,     75,   -149,    275,   -477,    788,
+            -1256,   1960,  -3057,   4952,  -9096,  -9744,  20911,  -7914,   4450,  -2779,
+             1785,  -1140,    710,   -426,    243,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8671,      47784,    -169433,     474118,   -1133935,    2416944,   -4711185,    8550030,
+            -14649542,   23989297,  -38019923,   59234998,  -92923506,  153868420, -307095284, 2026284356,
+            454870841, -191943908,  110904938,  -69829158,   44864059,  -28547884,   17673629,  -10504484,
+              5921823,   -3125322,    1519485,    -665570,     253768,     -79216,      17656 },
+    .d = {      0,      1,     -5,     14,    -34,     75,   -148,    273,   -474,    783,
+            -1248,   1948,  -3038,   4918,  -9018,  -9840,  20947,  -7905,   4441,  -2773,
+             1781,  -1138,    709,   -425,    242,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8716,      48093,    -170630,     477642,   -1142659,    2436016,   -4749100,    8619916,
+            -14770764,   24189657,  -38339393,   59733579,  -93701197,  155127472, -309403914, 2023765349,
+            460233237, -193967675,  112041943,  -70539085,   45319975,  -28839101,   17855121,  -10613326,
+              5983872,   -3158521,    1535902,    -672917,     256650,     -80155,      17882 },
+    .d = {      0,      1,     -5,     14,    -34,     74,   -147,    271,   -470,    778,
+            -1240,   1935,  -3018,   4884,  -8940,  -9935,  20982,  -7896,   4433,  -2767,
+             1777,  -1135,    708,   -424,    242,   -130,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8760,      48398,    -171814,     481133,   -1151308,    2454939,   -4786734,    8689311,
+            -14891170,   24388713,  -38656830,   60229009,  -94473890,  156377846, -311692662, 2021221885,
+            465604657, -195989062,  113176830,  -71247542,   45774938,  -29129732,   18036274,  -10721985,
+              6045833,   -3191683,    1552305,    -680261,     259534,     -81095,      18108 },
+    .d = {      0,      1,     -5,     14,    -33,     73,   -146,    269,   -467,    772,
+            -1232,   1923,  -2999,   4850,  -8863, -10031,  21017,  -7886,   4425,  -2762,
+             1773,  -1133,    706,   -424,    242,   -129,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8803,      48700,    -172985,     484592,   -1159884,    2473711,   -4824087,    8758214,
+            -15010756,   24586458,  -38972224,   60721276,  -95241563,  157619514, -313961522, 2018654021,
+            470985001, -198007990,  114309555,  -71954501,   46228929,  -29419765,   18217079,  -10830458,
+              6107702,   -3224805,    1568696,    -687603,     262418,     -82036,      18335 },
+    .d = {      0,      1,     -5,     13,    -33,     73,   -145,    267,   -464,    767,
+            -1224,   1911,  -2979,   4816,  -8785, -10126,  21051,  -7877,   4416,  -2756,
+             1770,  -1131,    705,   -423,    241,   -129,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8845,      48997,    -174144,     488017,   -1168386,    2492333,   -4861158,    8826623,
+            -15129521,   24782887,  -39285566,   61210367,  -96004198,  158852449, -316210490, 2016061817,
+            476374167, -200024381,  115440069,  -72659931,   46681929,  -29709187,   18397530,  -10938738,
+              6169476,   -3257887,    1585072,    -694942,     265303,     -82978,      18562 },
+    .d = {      0,      1,     -4,     13,    -33,     72,   -144,    265,   -461,    762,
+            -1216,   1898,  -2959,   4782,  -8707, -10221,  21086,  -7866,   4407,  -2750,
+             1766,  -1128,    703,   -422,    241,   -129,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8887,      49290,    -175291,     491410,   -1176814,    2510805,   -4897947,    8894537,
+            -15247460,   24977996,  -39596849,   61696267,  -96761773,  160076625, -318439559, 2013445334,
+            481772056, -202038153,  116568326,  -73363803,   47133919,  -29997986,   18577618,  -11046822,
+              6231154,   -3290927,    1601434,    -702278,     268189,     -83921,      18790 },
+    .d = {      0,      1,     -4,     13,    -33,     72,   -143,    263,   -457,    757,
+            -1208,   1886,  -2939,   4748,  -8630, -10315,  21119,  -7856,   4398,  -2743,
+             1762,  -1126,    702,   -421,    241,   -129,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8927,      49579,    -176424,     494770,   -1185167,    2529124,   -4934452,    8961953,
+            -15364571,   25171779,  -39906064,   62178965,  -97514271,  161292016, -320648725, 2010804631,
+            487178565, -204049229,  117694280,  -74066087,   47584879,  -30286150,   18757336,  -11154706,
+              6292732,   -3323924,    1617780,    -709610,     271075,     -84865,      19019 },
+    .d = {      0,      1,     -4,     13,    -32,     71,   -141,    261,   -454,    752,
+            -1200,   1873,  -2920,   4713,  -8552, -10410,  21152,  -7845,   4389,  -2737,
+             1757,  -1123,    701,   -421,    240,   -129,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -8967,      49865,    -177545,     498097,   -1193446,    2547293,   -4970674,    9028871,
+            -15480851,   25364232,  -40213202,   62658446,  -98261671,  162498596, -322837984, 2008139771,
+            492593593, -206057527,  118817882,  -74766755,   48034790,  -30573666,   18936676,  -11262383,
+              6354207,   -3356876,    1634110,    -716939,     273961,     -85809,      19248 },
+    .d = {      0,      1,     -4,     13,    -32,     70,   -140,    259,   -451,    747,
+            -1192,   1860,  -2900,   4679,  -8474, -10504,  21185,  -7834,   4380,  -2731,
+             1753,  -1121,    699,   -420,    240,   -129,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -9005,      50146,    -178654,     501391,   -1201650,    2565309,   -5006610,    9095288,
+            -15596297,   25555348,  -40518255,   63134699,  -99003954,  163696339, -325007333, 2005450814,
+            498017039, -208062969,  119939087,  -75465775,   48483633,  -30860522,   19115630,  -11369850,
+              6415578,   -3389781,    1650423,    -724263,     276848,     -86755,      19477 },
+    .d = {      0,      1,     -4,     13,    -32,     70,   -139,    257,   -448,    741,
+            -1183,   1848,  -2879,   4644,  -8396, -10598,  21218,  -7822,   4370,  -2724,
+             1749,  -1118,    698,   -419,    239,   -128,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -9043,      50423,    -179749,     504652,   -1209780,    2583174,   -5042261,    9161203,
+            -15710906,   25745124,  -40821216,   63607710,  -99741102,  164885221, -327156768, 2002737822,
+            503448799, -210065474,  121057848,  -76163119,   48931389,  -31146706,   19294191,  -11477102,
+              6476841,   -3422639,    1666718,    -731583,     279734,     -87702,      19708 },
+    .d = {      0,      1,     -4,     13,    -31,     69,   -138,    256,   -444,    736,
+            -1175,   1835,  -2859,   4609,  -8318, -10691,  21250,  -7811,   4360,  -2717,
+             1745,  -1115,    696,   -418,    239,   -128,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -9080,      50697,    -180833,     507880,   -1217834,    2600886,   -5077626,    9226615,
+            -15824676,   25933554,  -41122075,   64077467, -100473096,  166065217, -329286288, 2000000860,
+            508888771, -212064963,  122174117,  -76858756,   49378039,  -31432206,   19472350,  -11584134,
+              6537994,   -3455447,    1682995,    -738898,     282620,     -88649,      19938 },
+    .d = {      0,      1,     -4,     12,    -31,     69,   -137,    254,   -441,    731,
+            -1167,   1822,  -2839,   4575,  -8241, -10785,  21282,  -7798,   4351,  -2711,
+             1740,  -1113,    694,   -417,    238,   -128,     64,    -29,     11,     -4,      1 } },
+  { .h = {      -9117,      50966,    -181903,     511075,   -1225814,    2618445,   -5112704,    9291522,
+            -15937603,   26120633,  -41420826,   64543957, -101199917,  167236302, -331395889, 1997239989,
+            514336853, -214061355,  123287848,  -77552658,   49823564,  -31717008,   19650100,  -11690942,
+              6599034,   -3488205,    1699253,    -746208,     285506,     -89597,      20170 },
+    .d = {      0,      1,     -4,     12,    -31,     68,   -136,    252,   -438,    725,
+            -1159,   1809,  -2819,   4540,  -8163, -10878,  21313,  -7786,   4340,  -2704,
+             1736,  -1110,    693,   -416,    238,   -128,     63,    -29,     11,     -4,      1 } },
+  { .h = {      -9152,      51232,    -182961,     514237,   -1233719,    2635851,   -5147494,    9355923,
+            -16049685,   26306357,  -41717460,   65007169, -101921548,  168398453, -333485572, 1994455274,
+            519792940, -216054571,  124398993,  -78244795,   50267944,  -32001102,   19827434,  -11797520,
+              6659958,   -3520910,    1715492,    -753512,     288392,     -90546,      20402 },
+    .d = {      0,      1,     -4,     12,    -31,     67,   -135,    250,   -435,    720,
+            -1150,   1797,  -2799,   4505,  -8085, -10971,  21344,  -7773,   4330,  -2697,
+             1731,  -1107,    691,   -415,    238,   -128,     63,    -29,     11,     -4,      1 } },
+  { .h = {      -9187,      51494,    -184006,     517365,   -1241549,    2653104,   -5181995,    9419817,
+            -16160919,   26490721,  -42011969,   65467090, -102637970,  169551645, -335555334, 1991646778,
+            525256930, -218044529,  125507508,  -78935138,   50711161,  -32284474,   20004343,  -11903865,
+              6720763,   -3553562,    1731709,    -760811,     291277,     -91496,      20634 },
+    .d = {      0,      1,     -4,     12,    -30,     67,   -134,    248,   -431,    715,
+            -1142,   1784,  -2778,   4470,  -8007, -11063,  21374,  -7760,   4320,  -2690,
+             1727,  -1104,    689,   -414,    237,   -127,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9220,      51752,    -185039,     520461,   -1249304,    2670203,   -5216208,    9483201,
+            -16271302,   26673720,  -42304347,   65923708, -103349165,  170695856, -337605176, 1988814568,
+            530728719, -220031150,  126613343,  -79623656,   51153195,  -32567112,   20180821,  -12009971,
+              6781448,   -3586159,    1747906,    -768103,     294162,     -92446,      20867 },
+    .d = {      0,      1,     -4,     12,    -30,     66,   -133,    246,   -428,    709,
+            -1134,   1771,  -2758,   4434,  -7929, -11156,  21404,  -7747,   4309,  -2682,
+             1722,  -1101,    688,   -414,    237,   -127,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9253,      52006,    -186059,     523524,   -1256984,    2687149,   -5250131,    9546074,
+            -16380833,   26855350,  -42594584,   66377011, -104055117,  171831064, -339635098, 1985958708,
+            536208202, -222014353,  127716453,  -80310320,   51594027,  -32849004,   20356858,  -12115834,
+              6842008,   -3618699,    1764080,    -775390,     297046,     -93397,      21100 },
+    .d = {      0,      1,     -4,     12,    -30,     66,   -131,    244,   -425,    704,
+            -1125,   1758,  -2737,   4399,  -7852, -11248,  21434,  -7733,   4298,  -2675,
+             1717,  -1098,    686,   -413,    236,   -127,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9285,      52256,    -187066,     526554,   -1264588,    2703940,   -5283763,    9608436,
+            -16489507,   27035606,  -42882675,   66826988, -104755808,  172957244, -341645100, 1983079265,
+            541695274, -223994059,  128816790,  -80995101,   52033639,  -33130137,   20532447,  -12221449,
+              6902442,   -3651182,    1780232,    -782669,     299929,     -94348,      21334 },
+    .d = {      0,      1,     -4,     12,    -29,     65,   -130,    242,   -421,    699,
+            -1117,   1745,  -2716,   4364,  -7774, -11340,  21463,  -7719,   4287,  -2667,
+             1712,  -1095,    684,   -412,    236,   -127,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9317,      52502,    -188061,     529551,   -1272117,    2720577,   -5317104,    9670285,
+            -16597324,   27214483,  -43168611,   67273627, -105451221,  174074376, -343635185, 1980176304,
+            547189832, -225970185,  129914309,  -81677970,   52472011,  -33410500,   20707581,  -12326812,
+              6962747,   -3683605,    1796360,    -789941,     302811,     -95300,      21569 },
+    .d = {      0,      1,     -4,     12,    -29,     64,   -129,    240,   -418,    693,
+            -1108,   1732,  -2696,   4328,  -7696, -11431,  21492,  -7705,   4276,  -2660,
+             1707,  -1092,    682,   -411,    235,   -126,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9347,      52745,    -189044,     532514,   -1279571,    2737059,   -5350154,    9731619,
+            -16704279,   27391979,  -43452386,   67716917, -106141339,  175182437, -345605353, 1977249893,
+            552691770, -227942653,  131008962,  -82358897,   52909124,  -33690081,   20882253,  -12431917,
+              7022920,   -3715967,    1812464,    -797206,     305692,     -96253,      21803 },
+    .d = {      0,      1,     -4,     11,    -29,     64,   -128,    238,   -414,    688,
+            -1100,   1718,  -2675,   4293,  -7618, -11523,  21520,  -7690,   4265,  -2652,
+             1702,  -1089,    680,   -410,    235,   -126,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9377,      52983,    -190013,     535445,   -1286949,    2753386,   -5382912,    9792437,
+            -16810372,   27568087,  -43733991,   68156847, -106826145,  176281407, -347555607, 1974300099,
+            558200982, -229911380,  132100702,  -83037852,   53344959,  -33968866,   21056453,  -12536761,
+              7082958,   -3748267,    1828544,    -804463,     308571,     -97206,      22039 },
+    .d = {      0,      1,     -4,     11,    -29,     63,   -127,    236,   -411,    682,
+            -1092,   1705,  -2654,   4257,  -7540, -11614,  21548,  -7675,   4253,  -2644,
+             1697,  -1086,    679,   -409,    234,   -126,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9406,      53218,    -190971,     538342,   -1294252,    2769559,   -5415377,    9852738,
+            -16915599,   27742803,  -44013421,   68593405, -107505624,  177371263, -349485950, 1971326992,
+            563717363, -231876287,  133189482,  -83714806,   53779498,  -34246843,   21230175,  -12641337,
+              7142859,   -3780502,    1844597,    -811712,     311450,     -98159,      22275 },
+    .d = {      0,      1,     -4,     11,    -28,     63,   -126,    234,   -408,    677,
+            -1083,   1692,  -2633,   4222,  -7463, -11705,  21576,  -7660,   4241,  -2636,
+             1692,  -1083,    677,   -407,    233,   -126,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9434,      53449,    -191915,     541207,   -1301478,    2785576,   -5447548,    9912521,
+            -17019957,   27916125,  -44290668,   69026581, -108179758,  178451987, -351396386, 1968330638,
+            569240807, -233837292,  134275257,  -84389731,   54212720,  -34524001,   21403410,  -12745643,
+              7202620,   -3812673,    1860625,    -818953,     314326,     -99113,      22511 },
+    .d = {      0,      1,     -4,     11,    -28,     62,   -125,    231,   -404,    672,
+            -1074,   1679,  -2612,   4186,  -7385, -11795,  21603,  -7645,   4229,  -2628,
+             1687,  -1079,    675,   -406,    233,   -125,     63,    -28,     11,     -4,      1 } },
+  { .h = {      -9461,      53676,    -192848,     544038,   -1308629,    2801437,   -5479426,    9971785,
+            -17123446,   28088046,  -44565724,   69456363, -108848533,  179523556, -353286917, 1965311107,
+            574771207, -235794316,  135357979,  -85062595,   54644608,  -34800327,   21576152,  -12849673,
+              7262238,   -3844777,    1876625,    -826185,     317201,    -100067,      22748 },
+    .d = {      0,      1,     -4,     11,    -28,     61,   -123,    229,   -401,    666,
+            -1066,   1666,  -2591,   4150,  -7307, -11885,  21630,  -7629,   4217,  -2620,
+             1682,  -1076,    673,   -405,    232,   -125,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9488,      53899,    -193767,     546836,   -1315705,    2817142,   -5511008,   10030528,
+            -17226061,   28258564,  -44838584,   69882742, -109511933,  180585952, -355157550, 1962268470,
+            580308458, -237747275,  136437602,  -85733371,   55075142,  -35075809,   21748392,  -12953421,
+              7321711,   -3876813,    1892597,    -833407,     320075,    -101021,      22985 },
+    .d = {      0,      1,     -4,     11,    -27,     61,   -122,    227,   -397,    661,
+            -1057,   1652,  -2570,   4114,  -7229, -11975,  21656,  -7613,   4205,  -2612,
+             1676,  -1073,    671,   -404,    232,   -125,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9513,      54119,    -194675,     549601,   -1322704,    2832692,   -5542296,   10088748,
+            -17327802,   28427674,  -45109241,   70305706, -110169941,  181639155, -357008289, 1959202795,
+            585852451, -239696091,  137514078,  -86402029,   55504304,  -35350435,   21920123,  -13056885,
+              7381035,   -3908779,    1908541,    -840621,     322946,    -101975,      23222 },
+    .d = {      0,      1,     -3,     11,    -27,     60,   -121,    225,   -394,    655,
+            -1049,   1639,  -2549,   4078,  -7152, -12065,  21682,  -7596,   4193,  -2604,
+             1671,  -1069,    669,   -403,    231,   -125,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9538,      54335,    -195569,     552333,   -1329628,    2848085,   -5573289,   10146446,
+            -17428665,   28595372,  -45377688,   70725246, -110822543,  182683145, -358839138, 1956114154,
+            591403080, -241640682,  138587362,  -87068540,   55932073,  -35624192,   22091336,  -13160059,
+              7440209,   -3940674,    1924456,    -847824,     325815,    -102930,      23460 },
+    .d = {      0,      1,     -3,     11,    -27,     60,   -120,    223,   -391,    650,
+            -1040,   1625,  -2528,   4042,  -7074, -12154,  21708,  -7579,   4180,  -2595,
+             1665,  -1066,    667,   -402,    231,   -124,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9562,      54546,    -196452,     555032,   -1336475,    2863322,   -5603985,   10203620,
+            -17528649,   28761655,  -45643919,   71141351, -111469724,  183717904, -360650105, 1953002619,
+            596960238, -243580966,  139657407,  -87732874,   56358433,  -35897069,   22262025,  -13262938,
+              7499229,   -3972496,    1940340,    -855018,     328682,    -103885,      23699 },
+    .d = {      0,      1,     -3,     10,    -26,     59,   -119,    221,   -387,    644,
+            -1031,   1612,  -2507,   4006,  -6996, -12244,  21733,  -7562,   4167,  -2586,
+             1660,  -1062,    665,   -401,    230,   -124,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9586,      54755,    -197321,     557698,   -1343247,    2878403,   -5634384,   10260268,
+            -17627752,   28926518,  -45907926,   71554011, -112111470,  184743414, -362441196, 1949868260,
+            602523817, -245516863,  140724166,  -88395002,   56783363,  -36169052,   22432182,  -13365517,
+              7558093,   -4004244,    1956194,    -862201,     331547,    -104840,      23937 },
+    .d = {      0,      1,     -3,     10,    -26,     58,   -118,    219,   -384,    638,
+            -1023,   1598,  -2486,   3970,  -6919, -12332,  21757,  -7545,   4154,  -2578,
+             1654,  -1059,    663,   -400,    229,   -124,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9608,      54959,    -198179,     560330,   -1349943,    2893326,   -5664487,   10316390,
+            -17725971,   29089958,  -46169705,   71963216, -112747765,  185759656, -364212419, 1946711150,
+            608093708, -247448291,  141787593,  -89054896,   57206844,  -36440131,   22601798,  -13467793,
+              7616798,   -4035917,    1972016,    -869373,     334409,    -105795,      24177 },
+    .d = {      0,      1,     -3,     10,    -26,     58,   -116,    217,   -380,    633,
+            -1014,   1585,  -2464,   3933,  -6841, -12421,  21782,  -7527,   4141,  -2569,
+             1648,  -1055,    660,   -398,    229,   -123,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9630,      55160,    -199024,     562930,   -1356563,    2908093,   -5694292,   10371985,
+            -17823304,   29251971,  -46429248,   72368957, -113378595,  186766613, -365963779, 1943531362,
+            613669804, -249375170,  142847641,  -89712525,   57628859,  -36710293,   22770867,  -13569760,
+              7675341,   -4067512,    1987806,    -876534,     337269,    -106750,      24416 },
+    .d = {      0,      1,     -3,     10,    -26,     57,   -115,    215,   -377,    627,
+            -1005,   1571,  -2443,   3897,  -6764, -12509,  21805,  -7509,   4127,  -2560,
+             1643,  -1052,    658,   -397,    228,   -123,     62,    -28,     11,     -4,      1 } },
+  { .h = {      -9651,      55356,    -199856,     565496,   -1363106,    2922702,   -5723799,   10427051,
+            -17919750,   29412553,  -46686550,   72771223, -114003947,  187764267, -367695287, 1940328969,
+            619251996, -251297417,  143904264,  -90367862,   58049388,  -36979525,   22939381,  -13671413,
+              7733720,   -4099030,    2003563,    -883684,     340126,    -107705,      24656 },
+    .d = {      0,      1,     -3,     10,    -25,     56,   -114,    213,   -373,    622,
+             -996,   1558,  -2421,   3861,  -6686, -12597,  21829,  -7490,   4114,  -2551,
+             1637,  -1048,    656,   -396,    227,   -123,     61,    -28,     11,     -4,      1 } },
+  { .h = {      -9672,      55550,    -200676,     568030,   -1369574,    2937155,   -5753007,   10481588,
+            -18015305,   29571701,  -46941605,   73170006, -114623806,  188752602, -369406949, 1937104044,
+            624840175, -253214952,  144957415,  -91020876,   58468413,  -37247816,   23107331,  -13772749,
+              7791932,   -4130467,    2019286,    -890822,     342980,    -108660,      24896 },
+    .d = {      0,      1,     -3,     10,    -25,     56,   -113,    211,   -370,    616,
+             -988,   1544,  -2400,   3824,  -6609, -12685,  21852,  -7472,   4100,  -2542,
+             1631,  -1044,    654,   -395,    227,   -122,     61,    -28,     11,     -4,      1 } },
+  { .h = {      -9691,      55739,    -201484,     570530,   -1375965,    2951450,   -5781917,   10535595,
+            -18109970,   29729411,  -47194406,   73565296, -115238159,  189731601, -371098777, 1933856663,
+            630434233, -255127694,  146007049,  -91671540,   58885914,  -37515153,   23274711,  -13873762,
+              7849974,   -4161822,    2034974,    -897947,     345831,    -109614,      25137 },
+    .d = {      0,      1,     -3,     10,    -25,     55,   -112,    209,   -366,    610,
+             -979,   1530,  -2378,   3788,  -6531, -12773,  21874,  -7453,   4086,  -2532,
+             1625,  -1041,    652,   -393,    226,   -122,     61,    -28,     11,     -4,      1 } },
+  { .h = {      -9710,      55925,    -202280,     572998,   -1382280,    2965587,   -5810527,   10589070,
+            -18203740,   29885680,  -47444948,   73957084, -115846993,  190701247, -372770778, 1930586899,
+            636034059, -257035560,  147053118,  -92319823,   59301873,  -37781525,   23441512,  -13974447,
+              7907843,   -4193095,    2050628,    -905061,     348679,    -110569,      25378 },
+    .d = {      0,      1,     -3,     10,    -24,     55,   -111,    207,   -363,    605,
+             -970,   1517,  -2357,   3751,  -6454, -12860,  21896,  -7433,   4072,  -2523,
+             1619,  -1037,    649,   -392,    225,   -122,     61,    -28,     11,     -4,      1 } },
+  { .h = {      -9728,      56107,    -203063,     575432,   -1388519,    2979567,   -5838838,   10642012,
+            -18296615,   30040504,  -47693225,   74345361, -116450294,  191661525, -374422964, 1927294828,
+            641639544, -258938471,  148095577,  -92965698,   59716272,  -38046919,   23607727,  -14074801,
+              7965537,   -4224283,    2066245,    -912161,     351524,    -111523,      25619 },
+    .d = {      0,      1,     -3,      9,    -24,     54,   -109,    205,   -359,    599,
+             -961,   1503,  -2335,   3714,  -6376, -12946,  21918,  -7414,   4058,  -2513,
+             1613,  -1033,    647,   -391,    225,   -121,     61,    -28,     11,     -4,      1 } },
+  { .h = {      -9745,      56285,    -203834,     577834,   -1394682,    2993389,   -5866848,   10694422,
+            -18388592,   30193881,  -47939232,   74730119, -117048050,  192612420, -376055346, 1923980526,
+            647250579, -260836343,  149134379,  -93609134,   60129091,  -38311324,   23773349,  -14174818,
+              8023054,   -4255386,    2081826,    -919249,     354365,    -112477,      25860 },
+    .d = {      0,      1,     -3,      9,    -24,     53,   -108,    203,   -356,    593,
+             -952,   1489,  -2313,   3678,  -6299, -13033,  21939,  -7394,   4043,  -2504,
+             1606,  -1029,    645,   -389,    224,   -121,     61,    -28,     11,     -4,      1 } },
+  { .h = {      -9762,      56460,    -204592,     580202,   -1400768,    3007053,   -5894558,   10746297,
+            -18479671,   30345806,  -48182962,   75111347, -117640248,  193553915, -377667934, 1920644069,
+            652867053, -262729096,  150169478,  -94250104,   60540312,  -38574727,   23938370,  -14274493,
+              8080390,   -4286401,    2097369,    -926323,     357203,    -113431,      26102 },
+    .d = {      0,      1,     -3,      9,    -23,     53,   -107,    201,   -352,    588,
+             -943,   1475,  -2292,   3641,  -6222, -13119,  21960,  -7373,   4029,  -2494,
+             1600,  -1025,    642,   -388,    223,   -121,     61,    -28,     11,     -4,      1 } },
+  { .h = {      -9778,      56631,    -205338,     582538,   -1406778,    3020559,   -5921967,   10797637,
+            -18569849,   30496277,  -48424412,   75489039, -118226875,  194485998, -379260740, 1917285534,
+            658488855, -264616649,  151200828,  -94888579,   60949917,  -38837116,   24102782,  -14373823,
+              8137542,   -4317327,    2112874,    -933383,     360037,    -114384,      26344 },
+    .d = {      0,      1,     -3,      9,    -23,     52,   -106,    198,   -349,    582,
+             -934,   1462,  -2270,   3604,  -6145, -13205,  21981,  -7353,   4014,  -2484,
+             1594,  -1021,    640,   -387,    223,   -120,     60,    -28,     11,     -4,      1 } },
+  { .h = {      -9793,      56798,    -206072,     584840,   -1412712,    3033907,   -5949075,   10848442,
+            -18659124,   30645290,  -48663574,   75863185, -118807919,  195408652, -380833776, 1913904997,
+            664115876, -266498919,  152228383,  -95524530,   61357887,  -39098479,   24266577,  -14472802,
+              8194509,   -4348163,    2128340,    -940429,     362868,    -115337,      26586 },
+    .d = {      0,      1,     -3,      9,    -23,     52,   -105,    196,   -345,    576,
+             -925,   1448,  -2248,   3567,  -6067, -13291,  22001,  -7332,   3999,  -2474,
+             1587,  -1017,    637,   -385,    222,   -120,     60,    -27,     11,     -4,      1 } },
+  { .h = {      -9807,      56962,    -206794,     587110,   -1418570,    3047096,   -5975882,   10898709,
+            -18747494,   30792842,  -48900445,   76233778, -119383368,  196321865, -382387056, 1910502538,
+            669748005, -268375826,  153252097,  -96157927,   61764202,  -39358805,   24429748,  -14571426,
+              8251287,   -4378907,    2143766,    -947460,     365694,    -116290,      26829 },
+    .d = {      0,      1,     -3,      9,    -23,     51,   -104,    194,   -342,    571,
+             -916,   1434,  -2226,   3530,  -5990, -13376,  22020,  -7310,   3984,  -2464,
+             1581,  -1013,    635,   -384,    221,   -120,     60,    -27,     11,     -4,      1 } },
+  { .h = {      -9821,      57122,    -207504,     589347,   -1424352,    3060128,   -6002386,   10948440,
+            -18834959,   30938931,  -49135018,   76600809, -119953212,  197225622, -383920593, 1907078233,
+            675385130, -270247287,  154271923,  -96788743,   62168846,  -39618081,   24592288,  -14669690,
+              8307873,   -4409557,    2159152,    -954476,     368516,    -117242,      27072 },
+    .d = {      0,      1,     -3,      9,    -22,     50,   -102,    192,   -338,    565,
+             -907,   1420,  -2204,   3493,  -5913, -13461,  22039,  -7289,   3968,  -2454,
+             1574,  -1009,    632,   -382,    220,   -119,     60,    -27,     11,     -4,      1 } },
+  { .h = {      -9834,      57278,    -208201,     591551,   -1430057,    3073000,   -6028588,   10997632,
+            -18921516,   31083553,  -49367290,   76964270, -120517437,  198119910, -385434400, 1903632161,
+            681027140, -272113222,  155287817,  -97416949,   62571799,  -39876295,   24754189,  -14767590,
+              8364265,   -4440114,    2174496,    -961478,     371334,    -118194,      27315 },
+    .d = {      0,      1,     -3,      8,    -22,     50,   -101,    190,   -335,    559,
+             -898,   1406,  -2182,   3456,  -5836, -13546,  22058,  -7267,   3953,  -2444,
+             1567,  -1004,    630,   -381,    220,   -119,     60,    -27,     11,     -4,      1 } },
+  { .h = {      -9846,      57431,    -208886,     593722,   -1435686,    3085714,   -6054488,   11046285,
+            -19007164,   31226705,  -49597254,   77324153, -121076032,  199004717, -386928491, 1900164403,
+            686673924, -273973548,  156299732,  -98042517,   62973043,  -40133436,   24915443,  -14865121,
+              8420461,   -4470573,    2189799,    -968463,     374148,    -119145,      27558 },
+    .d = {      0,      1,     -3,      8,    -22,     49,   -100,    188,   -331,    553,
+             -889,   1392,  -2160,   3419,  -5759, -13630,  22076,  -7245,   3937,  -2433,
+             1561,  -1000,    627,   -380,    219,   -119,     60,    -27,     11,     -4,      1 } },
+  { .h = {      -9858,      57581,    -209559,     595860,   -1441239,    3098270,   -6080085,   11094398,
+            -19091902,   31368385,  -49824906,   77680451, -121628988,  199880029, -388402882, 1896675037,
+            692325369, -275828184,  157307622,  -98665417,   63372559,  -40389491,   25076043,  -14962278,
+              8476457,   -4500935,    2205059,    -975433,     376957,    -120095,      27802 },
+    .d = {      0,      1,     -3,      8,    -21,     48,    -99,    186,   -327,    548,
+             -880,   1378,  -2138,   3382,  -5682, -13714,  22094,  -7222,   3921,  -2423,
+             1554,   -996,    625,   -378,    218,   -118,     59,    -27,     11,     -4,      1 } },
+  { .h = {      -9869,      57726,    -210220,     597966,   -1446715,    3110667,   -6105379,   11141971,
+            -19175727,   31508590,  -50050242,   78033157, -122176292,  200745836, -389857588, 1893164143,
+            697981364, -277677049,  158311442,  -99285621,   63770330,  -40644449,   25235981,  -15059057,
+              8532251,   -4531198,    2220275,    -982387,     379761,    -121045,      28046 },
+    .d = {      0,      1,     -3,      8,    -21,     48,    -98,    184,   -324,    542,
+             -871,   1364,  -2116,   3345,  -5606, -13798,  22111,  -7199,   3905,  -2412,
+             1547,   -992,    622,   -377,    217,   -118,     59,    -27,     11,     -4,      1 } },
+  { .h = {      -9879,      57868,    -210869,     600039,   -1452116,    3122905,   -6130369,   11189003,
+            -19258639,   31647317,  -50273256,   78382262, -122717935,  201602123, -391292625, 1889631802,
+            703641796, -279520061,  159311145,  -99903102,   64166336,  -40898298,   25395250,  -15155452,
+              8587840,   -4561361,    2235447,    -989324,     382561,    -121993,      28289 },
+    .d = {      0,      1,     -2,      8,    -21,     47,    -96,    182,   -320,    536,
+             -862,   1350,  -2094,   3308,  -5529, -13882,  22128,  -7176,   3889,  -2401,
+             1540,   -987,    620,   -375,    216,   -117,     59,    -27,     11,     -4,      1 } },
+  { .h = {      -9889,      58007,    -211505,     602079,   -1457440,    3134984,   -6155056,   11235492,
+            -19340636,   31784563,  -50493945,   78727760, -123253905,  202448882, -392708009, 1886078096,
+            709306553, -281357138,  160306688, -100517830,   64560560,  -41151026,   25553842,  -15251461,
+              8643221,   -4591421,    2250574,    -996244,     385355,    -122942,      28534 },
+    .d = {      0,      1,     -2,      8,    -20,     47,    -95,    179,   -317,    530,
+             -853,   1335,  -2071,   3270,  -5452, -13965,  22144,  -7153,   3872,  -2390,
+             1533,   -983,    617,   -374,    216,   -117,     59,    -27,     11,     -4,      1 } },
+  { .h = {      -9898,      58142,    -212130,     604086,   -1462688,    3146905,   -6179439,   11281440,
+            -19421716,   31920326,  -50712303,   79069644, -123784194,  203286099, -394103757, 1882503105,
+            714975522, -283188199,  161298022, -101129777,   64952983,  -41402621,   25711750,  -15347077,
+              8698393,   -4621377,    2265655,   -1003147,     388145,    -123889,      28778 },
+    .d = {      0,      1,     -2,      8,    -20,     46,    -94,    177,   -313,    525,
+             -844,   1321,  -2049,   3233,  -5376, -14048,  22160,  -7129,   3856,  -2379,
+             1526,   -978,    614,   -372,    215,   -117,     59,    -27,     11,     -4,      1 } },
+  { .h = {      -9906,      58273,    -212743,     606061,   -1467859,    3158666,   -6203518,   11326844,
+            -19501879,   32054604,  -50928327,   79407907, -124308790,  204113765, -395479886, 1878906912,
+            720648590, -285013163,  162285105, -101738916,   65343587,  -41653071,   25868967,  -15442296,
+              8753351,   -4651229,    2280690,   -1010032,     390929,    -124835,      29022 },
+    .d = {      0,      0,     -2,      8,    -20,     45,    -93,    175,   -310,    519,
+             -835,   1307,  -2027,   3196,  -5299, -14130,  22176,  -7105,   3839,  -2368,
+             1519,   -974,    611,   -370,    214,   -116,     59,    -27,     11,     -4,      1 } },
+  { .h = {      -9913,      58401,    -213343,     608003,   -1472955,    3170269,   -6227292,   11371705,
+            -19581122,   32187393,  -51142012,   79742542, -124827684,  204931870, -396836415, 1875289599,
+            726325645, -286831947,  163267889, -102345218,   65732354,  -41902365,   26025483,  -15537115,
+              8808094,   -4680974,    2295678,   -1016899,     393708,    -125781,      29267 },
+    .d = {      0,      0,     -2,      7,    -20,     45,    -92,    173,   -306,    513,
+             -826,   1293,  -2005,   3158,  -5222, -14212,  22191,  -7080,   3822,  -2357,
+             1511,   -969,    609,   -369,    213,   -116,     58,    -27,     11,     -4,      1 } },
+  { .h = {      -9920,      58526,    -213932,     609912,   -1477975,    3181713,   -6250763,   11416022,
+            -19659446,   32318692,  -51353354,   80073543, -125340868,  205740402, -398173360, 1871651249,
+            732006572, -288644470,  164246330, -102948654,   66119265,  -42150491,   26181294,  -15631527,
+              8862619,   -4710611,    2310618,   -1023748,     396482,    -126725,      29511 },
+    .d = {      0,      0,     -2,      7,    -19,     44,    -90,    171,   -302,    507,
+             -816,   1279,  -1982,   3121,  -5146, -14294,  22206,  -7055,   3805,  -2346,
+             1504,   -965,    606,   -367,    212,   -115,     58,    -27,     11,     -4,      1 } },
+  { .h = {      -9926,      58647,    -214509,     611789,   -1482918,    3192998,   -6273928,   11459794,
+            -19736848,   32448498,  -51562349,   80400902, -125848331,  206539354, -399490743, 1867991946,
+            737691259, -290450651,  165220382, -103549197,   66504303,  -42397437,   26336390,  -15725529,
+              8916922,   -4740138,    2325509,   -1030578,     399249,    -127669,      29756 },
+    .d = {      0,      0,     -2,      7,    -19,     43,    -89,    169,   -299,    501,
+             -807,   1265,  -1960,   3083,  -5070, -14376,  22220,  -7030,   3788,  -2334,
+             1497,   -960,    603,   -366,    211,   -115,     58,    -27,     11,     -4,      1 } },
+  { .h = {      -9932,      58764,    -215073,     613634,   -1487786,    3204123,   -6296789,   11503020,
+            -19813328,   32576809,  -51768993,   80724614, -126350064,  207328714, -400788581, 1864311772,
+            743379590, -292250408,  166190000, -104146819,   66887450,  -42643191,   26490765,  -15819117,
+              8971002,   -4769554,    2340350,   -1037389,     402011,    -128611,      30001 },
+    .d = {      0,      0,     -2,      7,    -19,     43,    -88,    167,   -295,    495,
+             -798,   1250,  -1937,   3046,  -4993, -14457,  22234,  -7005,   3770,  -2323,
+             1489,   -955,    600,   -364,    210,   -114,     58,    -27,     11,     -4,      1 } },
+  { .h = {      -9937,      58878,    -215626,     615446,   -1492577,    3215090,   -6319344,   11545701,
+            -19888883,   32703622,  -51973282,   81044673, -126846060,  208108475, -402066894, 1860610814,
+            749071454, -294043660,  167155140, -104741492,   67268687,  -42887743,   26644410,  -15912284,
+              9024856,   -4798858,    2355141,   -1044181,     404767,    -129553,      30246 },
+    .d = {      0,      0,     -2,      7,    -18,     42,    -87,    165,   -292,    490,
+             -789,   1236,  -1915,   3008,  -4917, -14538,  22247,  -6979,   3752,  -2311,
+             1482,   -951,    597,   -362,    209,   -114,     58,    -26,     11,     -4,      1 } },
+  { .h = {      -9941,      58989,    -216167,     617225,   -1497293,    3225898,   -6341595,   11587836,
+            -19963514,   32828936,  -52175212,   81361072, -127336309,  208878628, -403325704, 1856889155,
+            754766734, -295830325,  168115755, -105333188,   67647996,  -43131079,   26797320,  -16005028,
+              9078481,   -4828048,    2369882,   -1050953,     407517,    -130493,      30491 },
+    .d = {      0,      0,     -2,      7,    -18,     42,    -86,    162,   -288,    484,
+             -780,   1222,  -1893,   2971,  -4841, -14618,  22260,  -6953,   3735,  -2300,
+             1474,   -946,    594,   -361,    209,   -114,     57,    -26,     11,     -4,      1 } },
+  { .h = {      -9944,      59096,    -216696,     618973,   -1501932,    3236546,   -6363540,   11629424,
+            -20037219,   32952749,  -52374780,   81673807, -127820803,  209639165, -404565031, 1853146881,
+            760465317, -297610321,  169071802, -105921879,   68025361,  -43373189,   26949485,  -16097343,
+              9131874,   -4857123,    2384570,   -1057704,     410261,    -131432,      30736 },
+    .d = {      0,      0,     -2,      7,    -18,     41,    -85,    160,   -284,    478,
+             -770,   1207,  -1870,   2933,  -4765, -14698,  22273,  -6927,   3717,  -2288,
+             1466,   -941,    591,   -359,    208,   -113,     57,    -26,     11,     -4,      1 } },
+  { .h = {      -9947,      59200,    -217214,     620687,   -1506496,    3247036,   -6385180,   11670464,
+            -20109997,   33075058,  -52571982,   81982870, -128299534,  210390078, -405784895, 1849384077,
+            766167088, -299383568,  170023235, -106507538,   68400761,  -43614061,   27100900,  -16189225,
+              9185033,   -4886081,    2399206,   -1064436,     412999,    -132370,      30981 },
+    .d = {      0,      0,     -2,      7,    -18,     40,    -83,    158,   -281,    472,
+             -761,   1193,  -1848,   2896,  -4689, -14778,  22285,  -6900,   3698,  -2276,
+             1459,   -936,    589,   -357,    207,   -113,     57,    -26,     11,     -4,      1 } },
+  { .h = {      -9950,      59300,    -217719,     622370,   -1510984,    3257367,   -6406514,   11710958,
+            -20181847,   33195861,  -52766815,   82288257, -128772495,  211131359, -406985320, 1845600829,
+            771871933, -301149983,  170970009, -107090137,   68774181,  -43853683,   27251556,  -16280669,
+              9237955,   -4914920,    2413789,   -1071147,     415729,    -133306,      31227 },
+    .d = {      0,      0,     -2,      6,    -17,     40,    -82,    156,   -277,    466,
+             -752,   1179,  -1825,   2858,  -4613, -14858,  22296,  -6873,   3680,  -2264,
+             1451,   -931,    586,   -355,    206,   -112,     57,    -26,     11,     -4,      1 } },
+  { .h = {      -9951,      59397,    -218213,     624020,   -1515396,    3267538,   -6427543,   11750903,
+            -20252768,   33315157,  -52959275,   82589962, -129239677,  211863002, -408166327, 1841797224,
+            777579736, -302909486,  171912081, -107669647,   69145602,  -44092044,   27401446,  -16371671,
+              9290638,   -4943640,    2428317,   -1077836,     418454,    -134241,      31472 },
+    .d = {      0,      0,     -2,      6,    -17,     39,    -81,    154,   -273,    460,
+             -743,   1164,  -1802,   2820,  -4538, -14937,  22307,  -6846,   3661,  -2252,
+             1443,   -926,    582,   -354,    205,   -112,     57,    -26,     11,     -4,      1 } },
+  { .h = {      -9952,      59491,    -218695,     625639,   -1519733,    3277551,   -6448266,   11790300,
+            -20322760,   33432943,  -53149359,   82887980, -129701074,  212584999, -409327939, 1837973349,
+            783290382, -304661994,  172849404, -108246043,   69515006,  -44329133,   27550563,  -16462226,
+              9343078,   -4972238,    2442791,   -1084504,     421171,    -135175,      31717 },
+    .d = {      0,      0,     -2,      6,    -17,     38,    -80,    152,   -270,    454,
+             -733,   1150,  -1780,   2783,  -4462, -15016,  22318,  -6818,   3643,  -2239,
+             1435,   -921,    579,   -352,    204,   -111,     56,    -26,     11,     -4,      1 } },
+  { .h = {      -9953,      59581,    -219165,     627225,   -1523994,    3287405,   -6468683,   11829148,
+            -20391820,   33549219,  -53337064,   83182306, -130156678,  213297345, -410470179, 1834129292,
+            789003756, -306407428,  173781936, -108819295,   69882376,  -44564937,   27698900,  -16552330,
+              9395274,   -5000714,    2457209,   -1091150,     423882,    -136107,      31963 },
+    .d = {      0,      0,     -2,      6,    -16,     38,    -79,    150,   -266,    448,
+             -724,   1135,  -1757,   2745,  -4386, -15094,  22328,  -6790,   3624,  -2227,
+             1427,   -916,    576,   -350,    203,   -111,     56,    -26,     11,     -4,      1 } },
+  { .h = {      -9952,      59668,    -219624,     628779,   -1528179,    3297100,   -6488795,   11867447,
+            -20459950,   33663981,  -53522387,   83472934, -130606482,  214000033, -411593072, 1830265140,
+            794719743, -308145704,  174709631, -109389378,   70247693,  -44799446,   27846449,  -16641979,
+              9447222,   -5029065,    2471572,   -1097774,     426585,    -137037,      32208 },
+    .d = {      0,      0,     -2,      6,    -16,     37,    -77,    147,   -262,    442,
+             -715,   1121,  -1734,   2707,  -4311, -15172,  22338,  -6762,   3605,  -2214,
+             1419,   -911,    573,   -348,    202,   -110,     56,    -26,     11,     -4,      1 } },
+  { .h = {      -9952,      59751,    -220071,     630301,   -1532289,    3306636,   -6508600,   11905198,
+            -20527147,   33777229,  -53705325,   83759861, -131050480,  214693057, -412696641, 1826380981,
+            800438226, -309876743,  175632445, -109956263,   70610941,  -45032648,   27993203,  -16731167,
+              9498920,   -5057291,    2485877,   -1104376,     429281,    -137966,      32453 },
+    .d = {      0,      0,     -2,      6,    -16,     37,    -76,    145,   -259,    436,
+             -705,   1106,  -1712,   2669,  -4235, -15250,  22347,  -6733,   3586,  -2202,
+             1411,   -906,    570,   -347,    201,   -110,     56,    -26,     11,     -4,      1 } },
+  { .h = {      -9950,      59831,    -220506,     631790,   -1536324,    3316014,   -6528100,   11942398,
+            -20593411,   33888962,  -53885875,   84043081, -131488665,  215376414, -413780912, 1822476905,
+            806159090, -311600463,  176550333, -110519924,   70972102,  -45264532,   28139154,  -16819891,
+              9550365,   -5085390,    2500124,   -1110954,     431970,    -138894,      32698 },
+    .d = {      0,      0,     -2,      6,    -15,     36,    -75,    143,   -255,    431,
+             -696,   1092,  -1689,   2632,  -4160, -15328,  22356,  -6704,   3566,  -2189,
+             1403,   -901,    567,   -345,    200,   -109,     55,    -26,     10,     -4,      1 } },
+  { .h = {      -9948,      59908,    -220930,     633248,   -1540283,    3325233,   -6547293,   11979049,
+            -20658741,   33999176,  -54064033,   84322590, -131921032,  216050096, -414845909, 1818553000,
+            811882219, -313316783,  177463253, -111080332,   71331158,  -45495085,   28284297,  -16908146,
+              9601554,   -5113360,    2514313,   -1117509,     434651,    -139820,      32943 },
+    .d = {      0,      0,     -2,      6,    -15,     35,    -74,    141,   -252,    425,
+             -687,   1077,  -1666,   2594,  -4085, -15405,  22364,  -6675,   3547,  -2176,
+             1394,   -895,    564,   -343,    199,   -109,     55,    -26,     10,     -4,      1 } },
+  { .h = {      -9945,      59982,    -221343,     634675,   -1544166,    3334293,   -6566181,   12015150,
+            -20723137,   34107872,  -54239799,   84598384, -132347573,  216714101, -415891658, 1814609356,
+            817607496, -315025621,  178371159, -111637462,   71688092,  -45724298,   28428622,  -16995927,
+              9652486,   -5141200,    2528442,   -1124041,     437324,    -140744,      33189 },
+    .d = {      0,      0,     -2,      5,    -15,     35,    -73,    139,   -248,    419,
+             -677,   1063,  -1643,   2556,  -4010, -15482,  22372,  -6646,   3527,  -2163,
+             1386,   -890,    561,   -341,    198,   -108,     55,    -25,     10,     -4,      1 } },
+  { .h = {      -9942,      60052,    -221743,     636069,   -1547975,    3343194,   -6584762,   12050700,
+            -20786598,   34215047,  -54413168,   84870458, -132768284,  217368423, -416918185, 1810646063,
+            823334805, -316726897,  179274007, -112191286,   72042886,  -45952158,   28572124,  -17083230,
+              9703157,   -5168909,    2542511,   -1130549,     439990,    -141666,      33434 },
+    .d = {      0,      0,     -2,      5,    -15,     34,    -71,    137,   -244,    413,
+             -668,   1048,  -1621,   2518,  -3935, -15558,  22380,  -6616,   3507,  -2150,
+             1377,   -885,    557,   -339,    197,   -108,     55,    -25,     10,     -4,      1 } },
+  { .h = {      -9938,      60119,    -222133,     637431,   -1551708,    3351937,   -6603038,   12085701,
+            -20849123,   34320701,  -54584139,   85138809, -133183158,  218013059, -417925518, 1806663212,
+            829064029, -318420530,  180171755, -112741776,   72395523,  -46178655,   28714794,  -17170051,
+              9753565,   -5196484,    2556520,   -1137032,     442648,    -142587,      33679 },
+    .d = {      0,      0,     -1,      5,    -14,     34,    -70,    135,   -241,    407,
+             -658,   1034,  -1598,   2480,  -3860, -15634,  22387,  -6586,   3487,  -2137,
+             1369,   -879,    554,   -337,    196,   -107,     54,    -25,     10,     -4,      1 } },
+  { .h = {      -9934,      60183,    -222510,     638762,   -1555367,    3360522,   -6621008,   12120150,
+            -20910712,   34424831,  -54752708,   85403432, -133592191,  218648005, -418913683, 1802660893,
+            834795053, -320106438,  181064358, -113288908,   72745986,  -46403777,   28856627,  -17256385,
+              9803707,   -5223925,    2570467,   -1143491,     445297,    -143505,      33923 },
+    .d = {      0,      0,     -1,      5,    -14,     33,    -69,    132,   -237,    401,
+             -649,   1019,  -1575,   2442,  -3785, -15710,  22393,  -6555,   3466,  -2124,
+             1360,   -874,    551,   -335,    195,   -107,     54,    -25,     10,     -4,      1 } },
+  { .h = {      -9929,      60243,    -222877,     640061,   -1558950,    3368948,   -6638672,   12154049,
+            -20971364,   34527438,  -54918874,   85664324, -133995378,  219273259, -419882709, 1798639198,
+            840527758, -321784541,  181951773, -113832652,   73094258,  -46627513,   28997614,  -17342227,
+              9853580,   -5251231,    2584352,   -1149925,     447939,    -144422,      34168 },
+    .d = {      0,      0,     -1,      5,    -14,     32,    -68,    130,   -233,    395,
+             -640,   1005,  -1552,   2405,  -3711, -15785,  22399,  -6524,   3446,  -2111,
+             1352,   -869,    547,   -333,    194,   -106,     54,    -25,     10,     -4,      1 } },
+  { .h = {      -9923,      60300,    -223232,     641329,   -1562459,    3377217,   -6656030,   12187397,
+            -21031080,   34628518,  -55082635,   85921481, -134392713,  219888817, -420832622, 1794598218,
+            846262028, -323454758,  182833955, -114372984,   73440320,  -46849852,   29137748,  -17427574,
+              9903182,   -5278399,    2598174,   -1156333,     450571,    -145337,      34413 },
+    .d = {      0,      0,     -1,      5,    -13,     32,    -67,    128,   -230,    389,
+             -630,    990,  -1529,   2367,  -3636, -15860,  22405,  -6493,   3425,  -2097,
+             1343,   -863,    544,   -331,    193,   -106,     54,    -25,     10,     -4,      1 } },
+  { .h = {      -9917,      60354,    -223576,     642565,   -1565893,    3385327,   -6673082,   12220195,
+            -21089857,   34728073,  -55243989,   86174899, -134784193,  220494677, -421763451, 1790538046,
+            851997746, -325117008,  183710863, -114909876,   73784157,  -47070783,   29277023,  -17512421,
+              9952511,   -5305428,    2611932,   -1162715,     453196,    -146249,      34657 },
+    .d = {      0,      0,     -1,      5,    -13,     31,    -65,    126,   -226,    383,
+             -621,    975,  -1506,   2329,  -3562, -15935,  22410,  -6462,   3405,  -2084,
+             1334,   -857,    541,   -329,    192,   -105,     53,    -25,     10,     -4,      1 } },
+  { .h = {      -9911,      60405,    -223908,     643770,   -1569252,    3393279,   -6689829,   12252441,
+            -21147696,   34826100,  -55402932,   86424576, -135169812,  221090836, -422675227, 1786458774,
+            857734794, -326771210,  184582451, -115443301,   74125752,  -47290294,   29415431,  -17596764,
+             10001563,   -5332318,    2625625,   -1169072,     455811,    -147160,      34901 },
+    .d = {      0,      0,     -1,      5,    -13,     30,    -64,    124,   -222,    377,
+             -611,    961,  -1483,   2291,  -3487, -16009,  22415,  -6430,   3384,  -2070,
+             1326,   -852,    537,   -327,    191,   -104,     53,    -25,     10,     -4,      1 } },
+  { .h = {      -9903,      60453,    -224229,     644943,   -1572536,    3401073,   -6706270,   12284136,
+            -21204597,   34922598,  -55559464,   86670509, -135549567,  221677294, -423567978, 1782360494,
+            863473054, -328417284,  185448679, -115973234,   74465086,  -47508375,   29552965,  -17680598,
+             10050337,   -5359065,    2639253,   -1175402,     458418,    -148068,      35146 },
+    .d = {      0,      0,     -1,      4,    -13,     30,    -63,    122,   -219,    371,
+             -602,    946,  -1460,   2253,  -3413, -16083,  22419,  -6398,   3363,  -2056,
+             1317,   -846,    534,   -325,    189,   -104,     53,    -25,     10,     -4,      1 } },
+  { .h = {      -9896,      60498,    -224539,     646085,   -1575746,    3408710,   -6722405,   12315280,
+            -21260560,   35017568,  -55713583,   86912693, -135923453,  222254049, -424441734, 1778243301,
+            869212410, -330055149,  186309501, -116499648,   74802143,  -47725014,   29689619,  -17763918,
+             10098829,   -5385669,    2652815,   -1181705,     461016,    -148975,      35390 },
+    .d = {      0,      0,     -1,      4,    -12,     29,    -62,    120,   -215,    365,
+             -593,    931,  -1438,   2215,  -3339, -16156,  22423,  -6366,   3341,  -2042,
+             1308,   -841,    530,   -323,    188,   -103,     53,    -25,     10,     -4,      1 } },
+  { .h = {      -9887,      60539,    -224838,     647195,   -1578882,    3416189,   -6738235,   12345874,
+            -21315583,   35111006,  -55865287,   87151127, -136291467,  222821099, -425296525, 1774107287,
+            874952744, -331684725,  187164875, -117022516,   75136907,  -47940201,   29825384,  -17846721,
+             10147037,   -5412129,    2666311,   -1187981,     463604,    -149879,      35633 },
+    .d = {      0,      0,     -1,      4,    -12,     29,    -61,    117,   -211,    359,
+             -583,    917,  -1415,   2177,  -3265, -16229,  22427,  -6333,   3320,  -2029,
+             1299,   -835,    527,   -321,    187,   -103,     52,    -24,     10,     -4,      1 } },
+  { .h = {      -9878,      60577,    -225125,     648275,   -1581943,    3423510,   -6753760,   12375916,
+            -21369666,   35202914,  -56014574,   87385808, -136653606,  223378444, -426132383, 1769952548,
+            880693936, -333305932,  188014759, -117541813,   75469360,  -48153925,   29960255,  -17929002,
+             10194959,   -5438443,    2679739,   -1194230,     466184,    -150781,      35877 },
+    .d = {      0,      0,     -1,      4,    -12,     28,    -59,    115,   -208,    353,
+             -574,    902,  -1392,   2139,  -3191, -16302,  22429,  -6300,   3298,  -2014,
+             1290,   -829,    523,   -319,    186,   -102,     52,    -24,     10,     -4,      1 } },
+  { .h = {      -9869,      60612,    -225402,     649323,   -1584931,    3430674,   -6768980,   12405407,
+            -21422811,   35293291,  -56161443,   87616733, -137009866,  223926085, -426949340, 1765779177,
+            886435871, -334918688,  188859110, -118057513,   75799485,  -48366174,   30094224,  -18010757,
+             10242591,   -5464610,    2693098,   -1200451,     468753,    -151680,      36120 },
+    .d = {      0,      0,     -1,      4,    -11,     27,    -58,    113,   -204,    347,
+             -564,    887,  -1369,   2101,  -3118, -16375,  22432,  -6267,   3276,  -2000,
+             1280,   -823,    520,   -317,    185,   -102,     52,    -24,     10,     -4,      1 } },
+  { .h = {      -9859,      60644,    -225667,     650341,   -1587844,    3437681,   -6783894,   12434347,
+            -21475015,   35382135,  -56305893,   87843900, -137360245,  224464019, -427747426, 1761587270,
+            892178428, -336522913,  189697885, -118569589,   76127267,  -48576939,   30227285,  -18091982,
+             10289932,   -5490628,    2706389,   -1206643,     471314,    -152577,      36363 },
+    .d = {      0,      0,     -1,      4,    -11,     27,    -57,    111,   -200,    341,
+             -555,    873,  -1346,   2063,  -3044, -16447,  22434,  -6233,   3255,  -1986,
+             1271,   -817,    516,   -315,    184,   -101,     52,    -24,     10,     -3,      1 } },
+  { .h = {      -9849,      60673,    -225921,     651327,   -1590683,    3444531,   -6798504,   12462736,
+            -21526280,   35469445,  -56447921,   88067306, -137704739,  224992249, -428526674, 1757376921,
+            897921490, -338118528,  190531042, -119078015,   76452687,  -48786207,   30359429,  -18172671,
+             10336978,   -5516495,    2719609,   -1212807,     473864,    -153472,      36606 },
+    .d = {      0,      0,     -1,      4,    -11,     26,    -56,    109,   -197,    335,
+             -545,    858,  -1323,   2025,  -2970, -16518,  22435,  -6199,   3232,  -1972,
+             1262,   -812,    513,   -313,    183,   -100,     51,    -24,     10,     -3,      1 } },
+  { .h = {      -9837,      60699,    -226164,     652282,   -1593448,    3451224,   -6812809,   12490575,
+            -21576605,   35555223,  -56587528,   88286949, -138043345,  225510775, -429287118, 1753148227,
+            903664939, -339705453,  191358538, -119582767,   76775731,  -48993969,   30490651,  -18252822,
+             10383728,   -5542211,    2732759,   -1218942,     476405,    -154364,      36848 },
+    .d = {      0,      0,     -1,      4,    -11,     26,    -55,    107,   -193,    329,
+             -536,    843,  -1300,   1988,  -2897, -16590,  22436,  -6165,   3210,  -1957,
+             1253,   -806,    509,   -311,    181,   -100,     51,    -24,     10,     -3,      1 } },
+  { .h = {      -9826,      60722,    -226397,     653207,   -1596140,    3457761,   -6826810,   12517863,
+            -21625989,   35639466,  -56724711,   88502828, -138376063,  226019598, -430028789, 1748901284,
+            909408656, -341283606,  192180331, -120083817,   77096380,  -49200213,   30620944,  -18332429,
+             10430178,   -5567774,    2745838,   -1225048,     478935,    -155253,      37091 },
+    .d = {      0,      0,     -1,      3,    -10,     25,    -54,    104,   -189,    323,
+             -526,    829,  -1277,   1950,  -2824, -16661,  22437,  -6130,   3188,  -1943,
+             1243,   -800,    505,   -309,    180,    -99,     51,    -24,     10,     -3,      1 } },
+  { .h = {      -9814,      60742,    -226618,     654101,   -1598758,    3464141,   -6840507,   12544600,
+            -21674434,   35722175,  -56859470,   88714941, -138702889,  226518719, -430751723, 1744636188,
+            915152522, -342852909,  192996379, -120581141,   77414619,  -49404929,   30750300,  -18411488,
+             10476326,   -5593182,    2758845,   -1231124,     481455,    -156140,      37333 },
+    .d = {      0,      0,     -1,      3,    -10,     24,    -52,    102,   -186,    317,
+             -517,    814,  -1254,   1912,  -2751, -16731,  22437,  -6095,   3165,  -1928,
+             1234,   -794,    502,   -307,    179,    -99,     51,    -24,     10,     -3,      1 } },
+  { .h = {      -9801,      60759,    -226828,     654964,   -1601303,    3470364,   -6853899,   12570787,
+            -21721938,   35803349,  -56991803,   88923286, -139023822,  227008140, -431455953, 1740353035,
+            920896419, -344413282,  193806641, -121074713,   77730431,  -49608106,   30878713,  -18489996,
+             10522170,   -5618434,    2771780,   -1237171,     483965,    -157025,      37574 },
+    .d = {      0,      0,     -1,      3,    -10,     24,    -51,    100,   -182,    311,
+             -507,    799,  -1231,   1874,  -2678, -16801,  22437,  -6060,   3142,  -1913,
+             1224,   -788,    498,   -304,    178,    -98,     50,    -23,     10,     -3,      1 } },
+  { .h = {      -9788,      60772,    -227028,     655796,   -1603774,    3476431,   -6866987,   12596424,
+            -21768503,   35882989,  -57121711,   89127861, -139338859,  227487864, -432141513, 1736051923,
+            926640227, -345964644,  194611074, -121564507,   78043800,  -49809734,   31006175,  -18567948,
+             10567707,   -5643529,    2784640,   -1243187,     486465,    -157906,      37816 },
+    .d = {      0,      0,     -1,      3,     -9,     23,    -50,     98,   -178,    305,
+             -498,    784,  -1208,   1836,  -2605, -16871,  22436,  -6025,   3119,  -1898,
+             1214,   -782,    494,   -302,    177,    -97,     50,    -23,     10,     -3,      1 } },
+  { .h = {      -9775,      60783,    -227216,     656598,   -1606173,    3482343,   -6879772,   12621511,
+            -21814127,   35961093,  -57249191,   89328665, -139648000,  227957892, -432808439, 1731732951,
+            932383828, -347506917,  195409636, -122050498,   78354710,  -50009801,   31132682,  -18645339,
+             10612935,   -5668465,    2797427,   -1249172,     488954,    -158785,      38057 },
+    .d = {      0,      0,     -1,      3,     -9,     22,    -49,     96,   -175,    299,
+             -488,    770,  -1185,   1798,  -2533, -16940,  22435,  -5989,   3096,  -1883,
+             1205,   -775,    490,   -300,    175,    -97,     50,    -23,     10,     -3,      1 } },
+  { .h = {      -9761,      60791,    -227394,     657370,   -1608498,    3488098,   -6892254,   12646049,
+            -21858812,   36037661,  -57374244,   89525696, -139951244,  228418228, -433456766, 1727396214,
+            938127103, -349040020,  196202287, -122532662,   78663144,  -50208298,   31258224,  -18722165,
+             10657850,   -5693241,    2810138,   -1255126,     491432,    -159661,      38297 },
+    .d = {      0,      0,     -1,      3,     -9,     22,    -48,     94,   -171,    293,
+             -479,    755,  -1162,   1760,  -2460, -17009,  22433,  -5953,   3073,  -1868,
+             1195,   -769,    487,   -298,    174,    -96,     49,    -23,     10,     -3,      1 } },
+  { .h = {      -9746,      60796,    -227561,     658111,   -1610750,    3493698,   -6904432,   12670037,
+            -21902557,   36112694,  -57496869,   89718955, -140248589,  228868874, -434086531, 1723041813,
+            943869931, -350563875,  196988985, -123010972,   78969086,  -50405214,   31382796,  -18798423,
+             10702451,   -5717855,    2822774,   -1261049,     493899,    -160534,      38537 },
+    .d = {      0,      0,     -1,      3,     -9,     21,    -46,     92,   -167,    287,
+             -470,    740,  -1138,   1723,  -2388, -17078,  22431,  -5916,   3050,  -1853,
+             1185,   -763,    483,   -296,    173,    -96,     49,    -23,     10,     -3,      1 } },
+  { .h = {      -9731,      60798,    -227718,     658822,   -1612930,    3499143,   -6916308,   12693475,
+            -21945362,   36186191,  -57617066,   89908439, -140540035,  229309834, -434697769, 1718669846,
+            949612195, -352078401,  197769688, -123485405,   79272521,  -50600538,   31506392,  -18874108,
+             10746735,   -5742307,    2835334,   -1266940,     496355,    -161404,      38777 },
+    .d = {      0,      0,     -1,      3,     -8,     21,    -45,     89,   -164,    281,
+             -460,    725,  -1115,   1685,  -2315, -17146,  22428,  -5879,   3026,  -1838,
+             1175,   -757,    479,   -293,    172,    -95,     49,    -23,     10,     -3,      1 } },
+  { .h = {      -9715,      60797,    -227864,     659502,   -1615036,    3504432,   -6927881,   12716365,
+            -21987228,   36258153,  -57734833,   90094149, -140825581,  229741112, -435290518, 1714280411,
+            955353774, -353583520,  198544355, -123955934,   79573432,  -50794261,   31629003,  -18949216,
+             10790700,   -5766593,    2847816,   -1272799,     498799,    -162271,      39017 },
+    .d = {      0,      0,     -1,      3,     -8,     20,    -44,     87,   -160,    275,
+             -451,    711,  -1092,   1647,  -2243, -17214,  22425,  -5842,   3002,  -1823,
+             1166,   -750,    475,   -291,    170,    -94,     48,    -23,     10,     -3,      1 } },
+  { .h = {      -9699,      60793,    -227999,     660153,   -1617071,    3509567,   -6939151,   12738707,
+            -22028155,   36328579,  -57850172,   90276083, -141105226,  230162713, -435864814, 1709873608,
+            961094550, -355079152,  199312946, -124422536,   79871803,  -50986371,   31750624,  -19023742,
+             10834343,   -5790714,    2860220,   -1278625,     501233,    -163136,      39256 },
+    .d = {      0,      0,      0,      2,     -8,     19,    -43,     85,   -156,    269,
+             -441,    696,  -1069,   1609,  -2171, -17282,  22421,  -5805,   2978,  -1807,
+             1156,   -744,    471,   -289,    169,    -94,     48,    -23,      9,     -3,      1 } },
+  { .h = {      -9683,      60786,    -228123,     660773,   -1619033,    3514547,   -6950120,   12760500,
+            -22068144,   36397470,  -57963081,   90454241, -141378971,  230574640, -436420696, 1705449538,
+            966834401, -356565219,  200075420, -124885185,   80167618,  -51176858,   31871248,  -19097683,
+             10877661,   -5814668,    2872546,   -1284419,     503654,    -163997,      39494 },
+    .d = {      0,      0,      0,      2,     -7,     19,    -42,     83,   -153,    263,
+             -432,    681,  -1046,   1571,  -2100, -17349,  22417,  -5767,   2954,  -1792,
+             1145,   -738,    467,   -287,    168,    -93,     48,    -23,      9,     -3,      1 } },
+  { .h = {      -9666,      60776,    -228237,     661364,   -1620923,    3519372,   -6960787,   12781745,
+            -22107194,   36464825,  -58073560,   90628622, -141646817,  230976898, -436958201, 1701008299,
+            972573210, -358041642,  200831735, -125343857,   80460862,  -51365712,   31990869,  -19171034,
+             10920653,   -5838454,    2884792,   -1290179,     506064,    -164855,      39732 },
+    .d = {      0,      0,      0,      2,     -7,     18,    -40,     81,   -149,    257,
+             -422,    666,  -1023,   1534,  -2028, -17415,  22413,  -5729,   2930,  -1776,
+             1135,   -731,    463,   -284,    167,    -92,     48,    -22,      9,     -3,      1 } },
+  { .h = {      -9649,      60764,    -228341,     661925,   -1622740,    3524043,   -6971152,   12802443,
+            -22145306,   36530646,  -58181610,   90799227, -141908762,  231369493, -437477369, 1696549993,
+            978310855, -359508342,  201581852, -125798527,   80751519,  -51552924,   32109479,  -19243792,
+             10963315,   -5862069,    2896958,   -1295906,     508463,    -165709,      39970 },
+    .d = {      0,      0,      0,      2,     -7,     18,    -39,     79,   -145,    251,
+             -413,    652,  -1000,   1496,  -1957, -17482,  22408,  -5691,   2906,  -1760,
+             1125,   -725,    459,   -282,    165,    -92,     47,    -22,      9,     -3,      1 } },
+  { .h = {      -9631,      60748,    -228434,     662455,   -1624486,    3528560,   -6981217,   12822594,
+            -22182480,   36594932,  -58287231,   90966055, -142164808,  231752431, -437978238, 1692074721,
+            984047218, -360965240,  202325730, -126249172,   81039573,  -51738481,   32227072,  -19315952,
+             11005645,   -5885513,    2909044,   -1301600,     510849,    -166561,      40207 },
+    .d = {      0,      0,      0,      2,     -7,     17,    -38,     77,   -142,    245,
+             -403,    637,   -977,   1458,  -1885, -17547,  22402,  -5652,   2881,  -1745,
+             1115,   -718,    455,   -280,    164,    -91,     47,    -22,      9,     -3,      1 } },
+  { .h = {      -9612,      60730,    -228516,     662957,   -1626161,    3532923,   -6990981,   12842199,
+            -22218718,   36657683,  -58390422,   91129106, -142414956,  232125716, -438460847, 1687582583,
+            989782177, -362412257,  203063328, -126695766,   81325008,  -51922376,   32343642,  -19387511,
+             11047641,   -5908784,    2921047,   -1307258,     513223,    -167409,      40444 },
+    .d = {      0,      0,      0,      2,     -6,     16,    -37,     74,   -138,    239,
+             -394,    622,   -954,   1420,  -1814, -17613,  22396,  -5614,   2857,  -1729,
+             1105,   -712,    451,   -277,    163,    -90,     47,    -22,      9,     -3,      1 } },
+  { .h = {      -9594,      60709,    -228589,     663428,   -1627763,    3537133,   -7000444,   12861257,
+            -22254018,   36718901,  -58491185,   91288381, -142659207,  232489356, -438925238, 1683073682,
+            995515614, -363849317,  203794607, -127138286,   81607810,  -52104596,   32459183,  -19458463,
+             11089301,   -5931881,    2932969,   -1312883,     515585,    -168254,      40680 },
+    .d = {      0,      0,      0,      2,     -6,     16,    -36,     72,   -134,    233,
+             -384,    607,   -931,   1383,  -1743, -17678,  22390,  -5574,   2832,  -1713,
+             1094,   -705,    447,   -275,    161,    -90,     46,    -22,      9,     -3,      1 } },
+  { .h = {      -9574,      60685,    -228651,     663870,   -1629294,    3541190,   -7009608,   12879769,
+            -22288383,   36778585,  -58589519,   91443880, -142897561,  232843356, -439371449, 1678548118,
+           1001247409, -365276339,  204519527, -127576707,   81887963,  -52285133,   32573687,  -19528805,
+             11130621,   -5954802,    2944807,   -1318472,     517934,    -169095,      40916 },
+    .d = {      0,      0,      0,      2,     -6,     15,    -35,     70,   -131,    227,
+             -375,    593,   -908,   1345,  -1672, -17743,  22383,  -5535,   2807,  -1696,
+             1084,   -699,    443,   -272,    160,    -89,     46,    -22,      9,     -3,      1 } },
+  { .h = {      -9555,      60659,    -228702,     664283,   -1630754,    3545093,   -7018472,   12897736,
+            -22321811,   36836736,  -58685425,   91595603, -143130020,  233187724, -439799522, 1674005995,
+           1006977440, -366693246,  205238047, -128011007,   82165451,  -52463977,   32687148,  -19598533,
+             11171600,   -5977547,    2956562,   -1324027,     520270,    -169933,      41151 },
+    .d = {      0,      0,      0,      1,     -5,     15,    -33,     68,   -127,    221,
+             -365,    578,   -885,   1308,  -1601, -17807,  22376,  -5495,   2782,  -1680,
+             1073,   -692,    439,   -270,    159,    -88,     46,    -22,      9,     -3,      1 } },
+  { .h = {      -9535,      60629,    -228744,     664666,   -1632143,    3548844,   -7027036,   12915159,
+            -22354305,   36893356,  -58778904,   91743552, -143356587,  233522467, -440209499, 1669447414,
+           1012705588, -368099960,  205950129, -128441160,   82440259,  -52641116,   32799560,  -19667644,
+             11212235,   -6000113,    2968232,   -1329545,     522594,    -170768,      41385 },
+    .d = {      0,      0,      0,      1,     -5,     14,    -32,     66,   -123,    215,
+             -356,    563,   -862,   1270,  -1531, -17871,  22368,  -5455,   2756,  -1664,
+             1063,   -685,    435,   -268,    157,    -87,     45,    -21,      9,     -3,      1 } },
+  { .h = {      -9514,      60597,    -228775,     665020,   -1633461,    3552443,   -7035302,   12932037,
+            -22385865,   36948443,  -58869955,   91887726, -143577263,  233847593, -440601420, 1664872479,
+           1018431732, -369496404,  206655733, -128867143,   82712372,  -52816543,   32910917,  -19736132,
+             11252524,   -6022500,    2979818,   -1335028,     524905,    -171598,      41619 },
+    .d = {      0,      0,      0,      1,     -5,     13,    -31,     64,   -120,    209,
+             -346,    548,   -839,   1232,  -1461, -17934,  22359,  -5414,   2731,  -1648,
+             1052,   -679,    431,   -265,    156,    -87,     45,    -21,      9,     -3,      1 } },
+  { .h = {      -9493,      60562,    -228796,     665345,   -1634708,    3555889,   -7043270,   12948372,
+            -22416490,   37002000,  -58958581,   92028128, -143792049,  234163108, -440975327, 1660281294,
+           1024155752, -370882499,  207354820, -129288933,   82981775,  -52990245,   33021212,  -19803994,
+             11292464,   -6044706,    2991317,   -1340474,     527203,    -172425,      41853 },
+    .d = {      0,      0,      0,      1,     -5,     13,    -30,     62,   -116,    203,
+             -337,    534,   -816,   1195,  -1390, -17997,  22351,  -5374,   2705,  -1631,
+             1042,   -672,    427,   -263,    155,    -86,     45,    -21,      9,     -3,      1 } },
+  { .h = {      -9472,      60525,    -228807,     665641,   -1635885,    3559183,   -7050940,   12964163,
+            -22446183,   37054027,  -59044782,   92164757, -144000949,  234469022, -441331264, 1655673960,
+           1029877529, -372258167,  208047350, -129706506,   83248452,  -53162215,   33130438,  -19871227,
+             11332052,   -6066729,    3002729,   -1345884,     529488,    -173249,      42085 },
+    .d = {      0,      0,      0,      1,     -4,     12,    -29,     60,   -112,    197,
+             -327,    519,   -793,   1158,  -1320, -18060,  22341,  -5333,   2679,  -1615,
+             1031,   -665,    422,   -260,    153,    -85,     44,    -21,      9,     -3,      1 } },
+  { .h = {      -9450,      60485,    -228807,     665908,   -1636992,    3562326,   -7058312,   12979412,
+            -22474943,   37104524,  -59128558,   92297616, -144203965,  234765344, -441669273, 1651050583,
+           1035596941, -373623333,  208733284, -130119839,   83512390,  -53332441,   33238591,  -19937825,
+             11371288,   -6088569,    3014055,   -1351257,     531760,    -174069,      42318 },
+    .d = {      0,      0,      0,      1,     -4,     12,    -28,     57,   -109,    191,
+             -318,    504,   -770,   1120,  -1250, -18122,  22332,  -5291,   2654,  -1598,
+             1020,   -658,    418,   -258,    152,    -85,     44,    -21,      9,     -3,      1 } },
+  { .h = {      -9428,      60442,    -228798,     666146,   -1638028,    3565318,   -7065387,   12994120,
+            -22502772,   37153493,  -59209911,   92426705, -144401100,  235052081, -441989397, 1646411267,
+           1041313867, -374977917,  209412584, -130528909,   83773572,  -53500915,   33345662,  -20003786,
+             11410167,   -6110223,    3025292,   -1356592,     534017,    -174885,      42549 },
+    .d = {      0,      0,      0,      1,     -4,     11,    -26,     55,   -105,    185,
+             -308,    490,   -747,   1083,  -1181, -18184,  22322,  -5250,   2627,  -1581,
+             1009,   -651,    414,   -255,    150,    -84,     44,    -21,      9,     -3,      1 } },
+  { .h = {      -9405,      60396,    -228779,     666355,   -1638994,    3568158,   -7072166,   13008286,
+            -22529670,   37200935,  -59288842,   92552027, -144592356,  235329243, -442291680, 1641756115,
+           1047028188, -376321843,  210085212, -130933692,   84031985,  -53667627,   33451646,  -20069105,
+             11448689,   -6131692,    3036440,   -1361890,     536262,    -175697,      42780 },
+    .d = {      0,      0,      0,      1,     -4,     11,    -25,     53,   -101,    179,
+             -299,    475,   -724,   1045,  -1111, -18246,  22311,  -5208,   2601,  -1564,
+              999,   -644,    410,   -253,    149,    -83,     43,    -21,      9,     -3,      1 } },
+  { .h = {      -9382,      60348,    -228750,     666536,   -1639890,    3570848,   -7078648,   13021911,
+            -22555638,   37246850,  -59365352,   92673582, -144777737,  235596840, -442576167, 1637085234,
+           1052739783, -377655035,  210751127, -131334166,   84287612,  -53832567,   33556537,  -20133778,
+             11486849,   -6152972,    3047499,   -1367149,     538492,    -176505,      43010 },
+    .d = {      0,      0,      0,      1,     -3,     10,    -24,     51,    -98,    173,
+             -289,    460,   -701,   1008,  -1042, -18307,  22300,  -5166,   2575,  -1547,
+              988,   -637,    405,   -250,    148,    -82,     43,    -20,      9,     -3,      1 } },
+  { .h = {      -9359,      60297,    -228711,     666688,   -1640717,    3573388,   -7084835,   13034997,
+            -22580677,   37291240,  -59439442,   92791373, -144957247,  235854881, -442842901, 1632398727,
+           1058448531, -378977415,  211410294, -131730307,   84540441,  -53995725,   33660329,  -20197801,
+             11524647,   -6174064,    3058468,   -1372370,     540709,    -177309,      43240 },
+    .d = {      0,      0,      0,      0,     -3,      9,    -23,     49,    -94,    167,
+             -280,    445,   -678,    971,   -973, -18367,  22288,  -5123,   2548,  -1530,
+              977,   -630,    401,   -248,    146,    -82,     42,    -20,      9,     -3,      1 } },
+  { .h = {      -9335,      60244,    -228662,     666812,   -1641474,    3575777,   -7090726,   13047543,
+            -22604788,   37334106,  -59511115,   92905402, -145130888,  236103377, -443091928, 1627696701,
+           1064154311, -380288906,  212062672, -132122094,   84790456,  -54157092,   33763015,  -20261171,
+             11562080,   -6194965,    3069345,   -1377553,     542911,    -178109,      43469 },
+    .d = {      0,      0,      0,      0,     -3,      9,    -22,     47,    -91,    161,
+             -271,    431,   -655,    933,   -904, -18427,  22276,  -5080,   2522,  -1513,
+              966,   -623,    397,   -245,    145,    -81,     42,    -20,      9,     -3,      1 } },
+  { .h = {      -9311,      60188,    -228603,     666907,   -1642162,    3578017,   -7096323,   13059551,
+            -22627972,   37375448,  -59580370,   93015670, -145298665,  236342337, -443323294, 1622979262,
+           1069857003, -381589432,  212708225, -132509503,   85037643,  -54316659,   33864589,  -20323884,
+             11599145,   -6215674,    3080131,   -1382696,     545099,    -178905,      43697 },
+    .d = {      0,      0,      0,      0,     -2,      8,    -21,     45,    -87,    156,
+             -261,    416,   -632,    896,   -835, -18487,  22264,  -5037,   2495,  -1496,
+              954,   -616,    392,   -242,    143,    -80,     42,    -20,      8,     -3,      1 } },
+  { .h = {      -9286,      60129,    -228535,     666974,   -1642781,    3580108,   -7101626,   13071020,
+            -22650229,   37415269,  -59647211,   93122180, -145460582,  236571774, -443537043, 1618246514,
+           1075556486, -382878918,  213346914, -132892511,   85281987,  -54474416,   33965046,  -20385936,
+             11635840,   -6236191,    3090825,   -1387800,     547273,    -179697,      43924 },
+    .d = {      0,      0,      0,      0,     -2,      8,    -20,     43,    -83,    150,
+             -252,    401,   -610,    859,   -766, -18547,  22251,  -4994,   2468,  -1479,
+              943,   -609,    388,   -240,    142,    -79,     41,    -20,      8,     -3,      1 } },
+  { .h = {      -9261,      60068,    -228457,     667013,   -1643331,    3582049,   -7106635,   13081953,
+            -22671561,   37453570,  -59711638,   93224934, -145616643,  236791698, -443733222, 1613498565,
+           1081252640, -384157285,  213978702, -133271098,   85523474,  -54630354,   34064379,  -20447323,
+             11672163,   -6256513,    3101426,   -1392864,     549432,    -180485,      44151 },
+    .d = {      0,      0,      0,      0,     -2,      7,    -18,     41,    -80,    144,
+             -242,    387,   -587,    822,   -698, -18606,  22237,  -4950,   2441,  -1461,
+              932,   -602,    384,   -237,    140,    -79,     41,    -20,      8,     -3,      1 } },
+  { .h = {      -9236,      60005,    -228369,     667023,   -1643812,    3583842,   -7111351,   13092350,
+            -22691969,   37490351,  -59773653,   93323935, -145766853,  237002120, -443911878, 1608735522,
+           1086945343, -385424460,  214603551, -133645239,   85762090,  -54784464,   34162582,  -20508041,
+             11708111,   -6276639,    3111933,   -1397889,     551576,    -181268,      44377 },
+    .d = {      0,      0,      0,      0,     -2,      6,    -17,     39,    -76,    138,
+             -233,    372,   -564,    785,   -630, -18664,  22223,  -4906,   2414,  -1444,
+              921,   -595,    379,   -235,    139,    -78,     41,    -19,      8,     -3,      1 } },
+  { .h = {      -9210,      59938,    -228272,     667006,   -1644225,    3585486,   -7115774,   13102211,
+            -22711454,   37525615,  -59833259,   93419185, -145911216,  237203053, -444073058, 1603957490,
+           1092634475, -386680365,  215221425, -134014914,   85997821,  -54936736,   34259649,  -20568086,
+             11743683,   -6296568,    3122346,   -1402872,     553706,    -182047,      44602 },
+    .d = {      0,      0,      0,      0,     -1,      6,    -16,     36,    -73,    132,
+             -223,    357,   -541,    748,   -562, -18722,  22209,  -4862,   2386,  -1427,
+              909,   -588,    375,   -232,    137,    -77,     40,    -19,      8,     -3,      1 } },
+  { .h = {      -9184,      59870,    -228165,     666961,   -1644569,    3586983,   -7119906,   13111538,
+            -22730017,   37559362,  -59890456,   93510688, -146049738,  237394508, -444216809, 1599164579,
+           1098319914, -387924925,  215832287, -134380101,   86230653,  -55087161,   34355574,  -20627456,
+             11778876,   -6316299,    3132663,   -1407815,     555820,    -182822,      44826 },
+    .d = {      0,      0,      0,      0,     -1,      5,    -15,     34,    -69,    126,
+             -214,    343,   -518,    711,   -494, -18780,  22194,  -4817,   2359,  -1409,
+              898,   -580,    370,   -229,    136,    -76,     40,    -19,      8,     -3,      1 } },
+  { .h = {      -9158,      59799,    -228049,     666888,   -1644846,    3588331,   -7123746,   13120330,
+            -22747660,   37591595,  -59945248,   93598445, -146182423,  237576498, -444343179, 1594356894,
+           1104001541, -389158065,  216436098, -134740776,   86460571,  -55235730,   34450352,  -20686145,
+             11813687,   -6335831,    3142885,   -1412717,     557920,    -183593,      45049 },
+    .d = {      0,      0,      0,      0,     -1,      5,    -14,     32,    -65,    120,
+             -205,    328,   -496,    674,   -426, -18837,  22178,  -4772,   2331,  -1391,
+              887,   -573,    366,   -227,    134,    -76,     40,    -19,      8,     -3,      1 } },
+  { .h = {      -9131,      59725,    -227923,     666788,   -1645054,    3589533,   -7127295,   13128590,
+            -22764382,   37622315,  -59997636,   93682461, -146309276,  237749036, -444452217, 1589534544,
+           1109679235, -390379709,  217032824, -135096920,   86687562,  -55382434,   34543977,  -20744151,
+             11848115,   -6355161,    3153010,   -1417577,     560004,    -184358,      45272 },
+    .d = {      0,      0,      1,      0,     -1,      4,    -13,     30,    -62,    114,
+             -195,    314,   -473,    637,   -358, -18894,  22163,  -4727,   2303,  -1373,
+              875,   -566,    361,   -224,    133,    -75,     39,    -19,      8,     -3,      1 } },
+  { .h = {      -9104,      59649,    -227787,     666660,   -1645195,    3590587,   -7130553,   13136318,
+            -22780186,   37651523,  -60047622,   93762738, -146430304,  237912134, -444543969, 1584697637,
+           1115352874, -391589782,  217622426, -135448510,   86911613,  -55527264,   34636442,  -20801469,
+             11882157,   -6374290,    3163038,   -1422395,     562072,    -185120,      45494 },
+    .d = {      0,      0,      1,     -1,      0,      4,    -12,     28,    -58,    108,
+             -186,    299,   -450,    600,   -291, -18951,  22146,  -4681,   2275,  -1356,
+              864,   -558,    357,   -221,    131,    -74,     39,    -19,      8,     -3,      1 } },
+  { .h = {      -9077,      59571,    -227643,     666505,   -1645269,    3591495,   -7133522,   13143514,
+            -22795073,   37679222,  -60095210,   93839280, -146545511,  238065806, -444618487, 1579846282,
+           1121022337, -392788209,  218204870, -135795525,   87132708,  -55670211,   34727741,  -20858096,
+             11915811,   -6393215,    3172968,   -1427171,     564125,    -185877,      45715 },
+    .d = {      0,      0,      1,     -1,      0,      3,    -10,     26,    -55,    102,
+             -177,    284,   -427,    564,   -224, -19007,  22130,  -4636,   2247,  -1338,
+              852,   -551,    352,   -218,    130,    -73,     38,    -18,      8,     -3,      1 } },
+  { .h = {      -9049,      59490,    -227489,     666322,   -1645275,    3592257,   -7136202,   13150180,
+            -22809044,   37705412,  -60140400,   93912090, -146654905,  238210066, -444675818, 1574980586,
+           1126687504, -393974916,  218780119, -136137943,   87350836,  -55811266,   34817870,  -20914029,
+             11949075,   -6411935,    3182800,   -1431905,     566163,    -186629,      45935 },
+    .d = {      0,      0,      1,     -1,      0,      2,     -9,     24,    -51,     96,
+             -167,    270,   -405,    527,   -157, -19062,  22112,  -4589,   2219,  -1320,
+              840,   -544,    347,   -216,    128,    -72,     38,    -18,      8,     -3,      1 } },
+  { .h = {      -9021,      59406,    -227325,     666112,   -1645214,    3592873,   -7138594,   13156317,
+            -22822101,   37730096,  -60183196,   93981172, -146758491,  238344927, -444716014, 1570100660,
+           1132348255, -395149827,  219348137, -136475744,   87565982,  -55950421,   34906822,  -20969263,
+             11981946,   -6430449,    3192532,   -1436596,     568184,    -187376,      46154 },
+    .d = {      0,      0,      1,     -1,      0,      2,     -8,     22,    -47,     91,
+             -158,    255,   -382,    490,    -90, -19117,  22095,  -4543,   2190,  -1301,
+              829,   -536,    343,   -213,    127,    -72,     38,    -18,      8,     -3,      1 } },
+  { .h = {      -8992,      59321,    -227153,     665875,   -1645087,    3593344,   -7140698,   13161925,
+            -22834244,   37753276,  -60223601,   94046529, -146856275,  238470405, -444739123, 1565206612,
+           1138004467, -396312870,  219908888, -136808906,   87778133,  -56087666,   34994592,  -21023795,
+             12014422,   -6448756,    3202164,   -1441243,     570189,    -188119,      46372 },
+    .d = {      0,      0,      1,     -1,      1,      1,     -7,     20,    -44,     85,
+             -148,    241,   -359,    454,    -24, -19172,  22076,  -4496,   2162,  -1283,
+              817,   -529,    338,   -210,    125,    -71,     37,    -18,      8,     -3,      1 } },
+  { .h = {      -8964,      59233,    -226971,     665611,   -1644893,    3593669,   -7142514,   13167005,
+            -22845475,   37774954,  -60261616,   94108166, -146948265,  238586513, -444745197, 1560298551,
+           1143656021, -397463968,  220462336, -137137408,   87987275,  -56222992,   35081174,  -21077622,
+             12046502,   -6466854,    3211696,   -1445848,     572178,    -188857,      46590 },
+    .d = {      0,      0,      1,     -1,      1,      1,     -6,     18,    -40,     79,
+             -139,    226,   -337,    417,     43, -19226,  22058,  -4450,   2133,  -1265,
+              805,   -521,    334,   -207,    124,    -70,     37,    -18,      8,     -3,      1 } },
+  { .h = {      -8935,      59142,    -226780,     665320,   -1644632,    3593850,   -7144044,   13171559,
+            -22855796,   37795131,  -60297245,   94166086, -147034466,  238693266, -444734286, 1555376588,
+           1149302795, -398603049,  221008448, -137461231,   88193396,  -56356392,   35166562,  -21130739,
+             12078183,   -6484743,    3221126,   -1450408,     574151,    -189590,      46806 },
+    .d = {      0,      0,      1,     -1,      1,      0,     -5,     16,    -37,     73,
+             -130,    212,   -314,    381,    109, -19280,  22039,  -4402,   2104,  -1247,
+              793,   -514,    329,   -205,    122,    -69,     36,    -18,      8,     -3,      1 } },
+  { .h = {      -8905,      59050,    -226580,     665003,   -1644306,    3593887,   -7145288,   13175588,
+            -22865208,   37813809,  -60330490,   94220294, -147114886,  238790681, -444706442, 1550440833,
+           1154944668, -399730038,  221547186, -137780352,   88396482,  -56487857,   35250750,  -21183144,
+             12109462,   -6502421,    3230454,   -1454924,     576107,    -190318,      47021 },
+    .d = {      0,      0,      1,     -1,      2,      0,     -4,     14,    -33,     67,
+             -121,    197,   -292,    344,    175, -19334,  22019,  -4355,   2076,  -1228,
+              781,   -506,    324,   -202,    121,    -68,     36,    -17,      8,     -3,      1 } },
+  { .h = {      -8875,      58955,    -226372,     664659,   -1643913,    3593780,   -7146247,   13179092,
+            -22873713,   37830991,  -60361355,   94270794, -147189533,  238878772, -444661716, 1545491395,
+           1160581521, -400844862,  222078518, -138094753,   88596521,  -56617378,   35333734,  -21234833,
+             12140339,   -6519886,    3239680,   -1459396,     578047,    -191041,      47236 },
+    .d = {      0,      0,      1,     -1,      2,     -1,     -3,     12,    -30,     61,
+             -111,    183,   -269,    308,    240, -19387,  21999,  -4307,   2046,  -1210,
+              769,   -498,    319,   -199,    119,    -67,     36,    -17,      8,     -3,      1 } },
+  { .h = {      -8845,      58857,    -226154,     664288,   -1643455,    3593529,   -7146921,   13182073,
+            -22881311,   37846679,  -60389842,   94317590, -147258413,  238957555, -444600161, 1540528385,
+           1166213232, -401947447,  222602407, -138404411,   88793498,  -56744946,   35415507,  -21285801,
+             12170809,   -6537137,    3248802,   -1463822,     579970,    -191759,      47449 },
+    .d = {      0,      0,      1,     -2,      2,     -2,     -2,     10,    -26,     55,
+             -102,    168,   -247,    271,    306, -19439,  21978,  -4259,   2017,  -1191,
+              757,   -491,    315,   -196,    117,    -67,     35,    -17,      7,     -3,      1 } },
+  { .h = {      -8815,      58758,    -225927,     663891,   -1642932,    3593136,   -7147311,   13184531,
+            -22888006,   37860875,  -60415955,   94360687, -147321534,  239027046, -444521828, 1535551915,
+           1171839680, -403037721,  223118819, -138709309,   88987402,  -56870553,   35496064,  -21336047,
+             12200872,   -6554174,    3257820,   -1468204,     581876,    -192472,      47662 },
+    .d = {      0,      0,      1,     -2,      2,     -2,      0,      8,    -23,     50,
+              -93,    154,   -224,    235,    371, -19491,  21957,  -4211,   1988,  -1172,
+              745,   -483,    310,   -193,    116,    -66,     35,    -17,      7,     -3,      1 } },
+  { .h = {      -8784,      58656,    -225691,     663468,   -1642343,    3592600,   -7147418,   13186468,
+            -22893797,   37873582,  -60439696,   94400090, -147378904,  239087262, -444426771, 1530562094,
+           1177460745, -404115611,  223627720, -139009424,   89178220,  -56994191,   35575400,  -21385565,
+             12230525,   -6570995,    3266734,   -1472540,     583764,    -193180,      47873 },
+    .d = {      0,      0,      1,     -2,      3,     -3,      1,      6,    -19,     44,
+              -83,    140,   -202,    199,    436, -19543,  21936,  -4162,   1958,  -1154,
+              733,   -475,    305,   -191,    114,    -65,     34,    -17,      7,     -3,      1 } },
+  { .h = {      -8753,      58552,    -225447,     663018,   -1641689,    3591922,   -7147243,   13187885,
+            -22898687,   37884800,  -60461069,   94435803, -147430531,  239138220, -444315043, 1525559035,
+           1183076306, -405181043,  224129077, -139304738,   89365939,  -57115851,   35653509,  -21434354,
+             12259767,   -6587598,    3275542,   -1476830,     585636,    -193882,      48083 },
+    .d = {      0,      0,      1,     -2,      3,     -3,      2,      4,    -16,     38,
+              -74,    125,   -179,    163,    501, -19594,  21914,  -4113,   1929,  -1135,
+              721,   -467,    300,   -188,    113,    -64,     34,    -17,      7,     -3,      1 } },
+  { .h = {      -8722,      58446,    -225193,     662542,   -1640971,    3591102,   -7146786,   13188782,
+            -22902677,   37894534,  -60480077,   94467831, -147476424,  239179937, -444186697, 1520542849,
+           1188686242, -406233945,  224622854, -139595231,   89550546,  -57235526,   35730386,  -21482409,
+             12288594,   -6603984,    3284244,   -1481074,     587490,    -194580,      48293 },
+    .d = {      0,      0,      1,     -2,      3,     -4,      3,      1,    -12,     32,
+              -65,    111,   -157,    127,    566, -19645,  21891,  -4064,   1899,  -1116,
+              709,   -460,    295,   -185,    111,    -63,     34,    -16,      7,     -3,      1 } },
+  { .h = {      -8691,      58338,    -224931,     662041,   -1640188,    3590141,   -7146048,   13189162,
+            -22905770,   37902785,  -60496724,   94496180, -147516590,  239212429, -444041787, 1515513647,
+           1194290433, -407274244,  225109019, -139880882,   89732029,  -57353207,   35806026,  -21529727,
+             12317005,   -6620149,    3292840,   -1485271,     589327,    -195272,      48501 },
+    .d = {      0,      0,      1,     -2,      3,     -4,      4,     -1,     -9,     26,
+              -56,     96,   -135,     91,    631, -19696,  21868,  -4014,   1869,  -1097,
+              697,   -452,    291,   -182,    109,    -62,     33,    -16,      7,     -3,      1 } },
+  { .h = {      -8659,      58227,    -224661,     661514,   -1639340,    3589038,   -7145029,   13189025,
+            -22907966,   37909556,  -60511014,   94520854, -147551038,  239235716, -443880367, 1510471543,
+           1199888758, -408301870,  225587537, -140161674,   89910376,  -57468886,   35880423,  -21576304,
+             12344998,   -6636093,    3301328,   -1489422,     591145,    -195958,      48708 },
+    .d = {      0,      0,      1,     -2,      4,     -5,      5,     -3,     -5,     21,
+              -47,     82,   -112,     55,    695, -19746,  21845,  -3964,   1839,  -1078,
+              684,   -444,    286,   -179,    108,    -61,     33,    -16,      7,     -3,      1 } },
+  { .h = {      -8627,      58114,    -224382,     660961,   -1638429,    3587796,   -7143731,   13188372,
+            -22909268,   37914849,  -60522949,   94541860, -147579778,  239249814, -443702493, 1505416646,
+           1205481096, -409316749,  226058377, -140437586,   90085574,  -57582554,   35953572,  -21622138,
+             12372571,   -6651816,    3309708,   -1493525,     592946,    -196639,      48914 },
+    .d = {      0,      0,      1,     -2,      4,     -5,      6,     -5,     -2,     15,
+              -37,     68,    -90,     19,    759, -19795,  21821,  -3914,   1809,  -1059,
+              672,   -436,    281,   -176,    106,    -61,     32,    -16,      7,     -3,      1 } },
+  { .h = {      -8595,      57999,    -224094,     660382,   -1637454,    3586414,   -7142154,   13187205,
+            -22909677,   37918666,  -60532534,   94559202, -147602817,  239254742, -443508218, 1500349072,
+           1211067328, -410318810,  226521504, -140708599,   90257611,  -57694205,   36025467,  -21667225,
+             12399722,   -6667315,    3317980,   -1497581,     594730,    -197315,      49118 },
+    .d = {      0,      0,      1,     -2,      4,     -6,      7,     -7,      2,      9,
+              -28,     53,    -68,    -16,    823, -19844,  21797,  -3864,   1779,  -1039,
+              660,   -428,    276,   -173,    104,    -60,     32,    -16,      7,     -3,      1 } },
+  { .h = {      -8562,      57882,    -223797,     659778,   -1636416,    3584892,   -7140299,   13185524,
+            -22909195,   37921012,  -60539772,   94572887, -147620166,  239250518, -443297599, 1495268931,
+           1216647333, -411307981,  226976886, -140974695,   90426476,  -57803830,   36096104,  -21711561,
+             12426448,   -6682590,    3326142,   -1501589,     596495,    -197985,      49322 },
+    .d = {      0,      0,      1,     -2,      4,     -6,      8,     -9,      5,      3,
+              -19,     39,    -46,    -52,    886, -19893,  21772,  -3813,   1748,  -1020,
+              647,   -420,    271,   -170,    103,    -59,     31,    -15,      7,     -3,      1 } },
+  { .h = {      -8529,      57763,    -223493,     659148,   -1635314,    3583231,   -7138167,   13183331,
+            -22907824,   37921887,  -60544667,   94582919, -147631834,  239237162, -443070691, 1490176337,
+           1222220990, -412284192,  227424490, -141235854,   90592156,  -57911420,   36165478,  -21755144,
+             12452748,   -6697638,    3334194,   -1505549,     598241,    -198650,      49525 },
+    .d = {      0,      0,      1,     -3,      5,     -7,      9,    -11,      9,     -2,
+              -10,     25,    -23,    -88,    950, -19941,  21747,  -3762,   1718,  -1001,
+              635,   -412,    266,   -167,    101,    -58,     31,    -15,      7,     -3,      1 } },
+  { .h = {      -8496,      57642,    -223179,     658494,   -1634149,    3581431,   -7135758,   13180628,
+            -22905567,   37921296,  -60547223,   94589305, -147637831,  239214692, -442827550, 1485071404,
+           1227788179, -413247372,  227864284, -141492058,   90754639,  -58016970,   36233582,  -21797970,
+             12478620,   -6712461,    3342136,   -1509461,     599969,    -199309,      49726 },
+    .d = {      0,      0,      1,     -3,      5,     -8,     10,    -13,     12,     -8,
+               -1,     11,     -1,   -123,   1013, -19989,  21721,  -3711,   1687,   -981,
+              622,   -404,    261,   -164,     99,    -57,     31,    -15,      7,     -3,      1 } },
+  { .h = {      -8463,      57519,    -222858,     657814,   -1632922,    3579493,   -7133074,   13177415,
+            -22902423,   37919240,  -60547445,   94592051, -147638165,  239183129, -442568232, 1479954244,
+           1233348780, -414197449,  228296236, -141743288,   90913914,  -58120470,   36300413,  -21840035,
+             12504061,   -6727055,    3349966,   -1513323,     601679,    -199962,      49926 },
+    .d = {      0,      0,      1,     -3,      5,     -8,     12,    -15,     16,    -14,
+                8,     -3,     21,   -159,   1076, -20036,  21695,  -3660,   1657,   -962,
+              610,   -396,    256,   -161,     98,    -56,     30,    -15,      7,     -3,      1 } },
+  { .h = {      -8429,      57394,    -222528,     657109,   -1631631,    3577418,   -7130114,   13173694,
+            -22898397,   37915722,  -60545336,   94591163, -147632848,  239142491, -442292794, 1474824971,
+           1238902672, -415134353,  228720314, -141989527,   91069968,  -58221913,   36365966,  -21881337,
+             12529070,   -6741419,    3357685,   -1517137,     603370,    -200609,      50125 },
+    .d = {      0,      0,      1,     -3,      5,     -9,     13,    -17,     19,    -19,
+               17,    -18,     43,   -194,   1139, -20083,  21668,  -3608,   1626,   -942,
+              597,   -388,    251,   -158,     96,    -55,     30,    -15,      7,     -3,      1 } },
+  { .h = {      -8395,      57266,    -222190,     656380,   -1630279,    3575206,   -7126881,   13169465,
+            -22893489,   37910746,  -60540900,   94586648, -147621889,  239092799, -442001294, 1469683699,
+           1244449736, -416058014,  229136486, -142230755,   91222791,  -58321291,   36430234,  -21921872,
+             12553645,   -6755554,    3365291,   -1520901,     605042,    -201251,      50323 },
+    .d = {      0,     -1,      1,     -3,      6,     -9,     14,    -18,     23,    -25,
+               26,    -32,     65,   -229,   1201, -20130,  21641,  -3556,   1595,   -923,
+              584,   -380,    246,   -155,     94,    -54,     29,    -15,      6,     -2,      1 } },
+  { .h = {      -8361,      57137,    -221843,     655626,   -1628865,    3572856,   -7123374,   13164731,
+            -22887701,   37904314,  -60534142,   94578511, -147605300,  239034073, -441693788, 1464530542,
+           1249989852, -416968361,  229544721, -142466955,   91372371,  -58418598,   36493214,  -21961638,
+             12577783,   -6769457,    3372784,   -1524615,     606695,    -201886,      50519 },
+    .d = {      0,     -1,      1,     -3,      6,    -10,     15,    -20,     26,    -31,
+               35,    -46,     87,   -265,   1263, -20176,  21613,  -3504,   1564,   -903,
+              572,   -372,    241,   -152,     93,    -53,     29,    -14,      6,     -2,      1 } },
+  { .h = {      -8327,      57005,    -221489,     654847,   -1627389,    3570371,   -7119595,   13159493,
+            -22881037,   37896429,  -60525066,   94566759, -147583089,  238966334, -441370334, 1459365614,
+           1255522899, -417865326,  229944988, -142698109,   91518697,  -58513824,   36554900,  -22000631,
+             12601483,   -6783127,    3380164,   -1528279,     608329,    -202516,      50714 },
+    .d = {      0,     -1,      1,     -3,      6,    -10,     16,    -22,     29,    -36,
+               44,    -60,    109,   -300,   1326, -20221,  21585,  -3451,   1532,   -883,
+              559,   -364,    236,   -149,     91,    -52,     28,    -14,      6,     -2,      1 } },
+  { .h = {      -8292,      56872,    -221126,     654044,   -1625851,    3567750,   -7115544,   13153752,
+            -22873497,   37887095,  -60513677,   94551399, -147555270,  238889602, -441030991, 1454189029,
+           1261048757, -418748839,  230337255, -142924199,   91661757,  -58606964,   36615288,  -22038847,
+             12624743,   -6796564,    3387428,   -1531893,     609944,    -203140,      50908 },
+    .d = {      0,     -1,      1,     -3,      6,    -11,     17,    -24,     33,    -42,
+               54,    -74,    131,   -335,   1387, -20266,  21557,  -3398,   1501,   -863,
+              546,   -356,    231,   -146,     89,    -52,     28,    -14,      6,     -2,      1 } },
+  { .h = {      -8257,      56737,    -220756,     653216,   -1624252,    3564993,   -7111222,   13147509,
+            -22865084,   37876314,  -60499979,   94532438, -147521851,  238803899, -440675817, 1449000903,
+           1266567307, -419618829,  230721491, -143145208,   91801541,  -58698010,   36674372,  -22076285,
+             12647561,   -6809766,    3394578,   -1535456,     611539,    -203758,      51100 },
+    .d = {      0,     -1,      1,     -3,      6,    -11,     18,    -26,     36,    -48,
+               63,    -88,    152,   -370,   1449, -20311,  21528,  -3345,   1469,   -843,
+              533,   -347,    226,   -143,     87,    -51,     27,    -14,      6,     -2,      1 } },
+  { .h = {      -8222,      56600,    -220377,     652364,   -1622593,    3562102,   -7106631,   13140766,
+            -22855799,   37864090,  -60483976,   94509882, -147482845,  238709246, -440304871, 1443801350,
+           1272078429, -420475228,  231097667, -143361118,   91938036,  -58786954,   36732149,  -22112940,
+             12669935,   -6822731,    3401613,   -1538969,     613115,    -204369,      51291 },
+    .d = {      0,     -1,      2,     -3,      7,    -12,     19,    -28,     40,    -53,
+               71,   -102,    174,   -405,   1510, -20355,  21498,  -3292,   1438,   -823,
+              520,   -339,    221,   -140,     86,    -50,     27,    -14,      6,     -2,      1 } },
+  { .h = {      -8187,      56460,    -219991,     651488,   -1620872,    3559077,   -7101770,   13133523,
+            -22845646,   37850426,  -60465674,   94483739, -147438263,  238605665, -439918212, 1438590484,
+           1277582004, -421317968,  231465752, -143571913,   92071233,  -58873790,   36788612,  -22148809,
+             12691863,   -6835460,    3408531,   -1542429,     614671,    -204975,      51481 },
+    .d = {      0,     -1,      2,     -4,      7,    -12,     20,    -30,     43,    -59,
+               80,   -116,    196,   -439,   1572, -20399,  21468,  -3238,   1406,   -803,
+              507,   -331,    215,   -137,     84,    -49,     27,    -13,      6,     -2,      1 } },
+  { .h = {      -8151,      56319,    -219596,     650588,   -1619091,    3555918,   -7096642,   13125784,
+            -22834626,   37835324,  -60445077,   94454015, -147388116,  238493179, -439515898, 1433368422,
+           1283077911, -422146980,  231825716, -143777574,   92201121,  -58958510,   36843758,  -22183891,
+             12713343,   -6847950,    3415332,   -1545839,     616207,    -205574,      51670 },
+    .d = {      0,     -1,      2,     -4,      7,    -13,     21,    -32,     46,    -65,
+               89,   -130,    218,   -474,   1632, -20442,  21438,  -3184,   1374,   -783,
+              494,   -323,    210,   -134,     82,    -48,     26,    -13,      6,     -2,      1 } },
+  { .h = {      -8116,      56176,    -219194,     649665,   -1617250,    3552625,   -7091245,   13117548,
+            -22822741,   37818789,  -60422190,   94420719, -147332416,  238371808, -439097991, 1428135278,
+           1288566031, -422962195,  232177529, -143978085,   92327688,  -59041107,   36897582,  -22218181,
+             12734373,   -6860201,    3422015,   -1549196,     617723,    -206167,      51857 },
+    .d = {      0,     -1,      2,     -4,      7,    -13,     22,    -34,     50,    -70,
+               98,   -144,    239,   -509,   1693, -20485,  21407,  -3130,   1342,   -763,
+              481,   -314,    205,   -131,     80,    -47,     26,    -13,      6,     -2,      1 } },
+  { .h = {      -8080,      56032,    -218784,     648717,   -1615350,    3549200,   -7085583,   13108818,
+            -22809994,   37800823,  -60397018,   94383857, -147271176,  238241577, -438664550, 1422891169,
+           1294046246, -423763546,  232521161, -144173430,   92450925,  -59121574,   36950080,  -22251677,
+             12754952,   -6872211,    3428581,   -1552501,     619219,    -206753,      52042 },
+    .d = {      0,     -1,      2,     -4,      8,    -14,     23,    -36,     53,    -76,
+              107,   -158,    261,   -543,   1754, -20527,  21376,  -3076,   1310,   -743,
+              468,   -306,    200,   -128,     79,    -46,     25,    -13,      6,     -2,      1 } },
+  { .h = {      -8044,      55885,    -218366,     647746,   -1613389,    3545643,   -7079655,   13099595,
+            -22796387,   37781431,  -60369566,   94343437, -147204406,  238102507, -438215636, 1417636210,
+           1299518435, -424550964,  232856583, -144363591,   92570820,  -59199905,   37001246,  -22284375,
+             12775078,   -6883980,    3435028,   -1555753,     620695,    -207333,      52227 },
+    .d = {      0,     -1,      2,     -4,      8,    -14,     24,    -38,     57,    -81,
+              116,   -172,    282,   -578,   1814, -20569,  21344,  -3021,   1278,   -723,
+              455,   -298,    195,   -125,     77,    -45,     25,    -12,      6,     -2,      1 } },
+  { .h = {      -8007,      55736,    -217941,     646752,   -1611369,    3541954,   -7073462,   13089880,
+            -22781922,   37760614,  -60339839,   94299467, -147132121,  237954622, -437751309, 1412370516,
+           1304982479, -425324382,  233183766, -144548553,   92687364,  -59276092,   37051076,  -22316273,
+             12794748,   -6895506,    3441355,   -1558952,     622150,    -207907,      52409 },
+    .d = {      0,     -1,      2,     -4,      8,    -15,     25,    -40,     60,    -87,
+              125,   -186,    304,   -612,   1874, -20611,  21312,  -2966,   1246,   -702,
+              442,   -289,    189,   -121,     75,    -44,     24,    -12,      6,     -2,      1 } },
+  { .h = {      -7971,      55586,    -217508,     645734,   -1609290,    3538134,   -7067006,   13079674,
+            -22766602,   37738378,  -60307842,   94251955, -147054331,  237797945, -437271630, 1407094204,
+           1310438260, -426083734,  233502682, -144728299,   92800546,  -59350129,   37099566,  -22347369,
+             12813961,   -6906788,    3447563,   -1562098,     623585,    -208474,      52591 },
+    .d = {      0,     -1,      2,     -4,      8,    -15,     26,    -42,     63,    -92,
+              134,   -199,    325,   -646,   1933, -20652,  21279,  -2911,   1213,   -682,
+              429,   -281,    184,   -118,     73,    -43,     24,    -12,      6,     -2,      1 } },
+  { .h = {      -7934,      55434,    -217067,     644693,   -1607153,    3534183,   -7060287,   13068981,
+            -22750428,   37714726,  -60273581,   94200907, -146971050,  237632500, -436776661, 1401807391,
+           1315885658, -426828951,  233813300, -144902813,   92910357,  -59422010,   37146712,  -22377658,
+             12832716,   -6917826,    3453650,   -1565191,     624999,    -209035,      52771 },
+    .d = {      0,     -1,      2,     -4,      9,    -16,     27,    -44,     67,    -98,
+              143,   -213,    347,   -680,   1993, -20692,  21246,  -2856,   1181,   -661,
+              416,   -272,    179,   -115,     71,    -42,     23,    -12,      5,     -2,      1 } },
+  { .h = {      -7897,      55280,    -216619,     643630,   -1604957,    3530102,   -7053306,   13057800,
+            -22733404,   37689660,  -60237060,   94146333, -146882291,  237458312, -436266463, 1396510193,
+           1321324555, -427559968,  234115594, -145072079,   93016785,  -59491726,   37192508,  -22407138,
+             12851010,   -6928617,    3459616,   -1568230,     626392,    -209589,      52949 },
+    .d = {      0,     -1,      2,     -4,      9,    -16,     28,    -46,     70,   -103,
+              151,   -227,    368,   -714,   2052, -20732,  21212,  -2800,   1148,   -641,
+              402,   -264,    174,   -112,     70,    -41,     23,    -12,      5,     -2,      1 } },
+  { .h = {      -7860,      55124,    -216163,     642543,   -1602702,    3525892,   -7046064,   13046133,
+            -22715531,   37663185,  -60198286,   94088241, -146788067,  237275403, -435741099, 1391202725,
+           1326754831, -428276718,  234409535, -145236081,   93119821,  -59559273,   37236951,  -22435807,
+             12868842,   -6939162,    3465460,   -1571215,     627764,    -210136,      53126 },
+    .d = {      0,     -1,      2,     -4,      9,    -17,     29,    -47,     73,   -109,
+              160,   -241,    389,   -748,   2111, -20772,  21178,  -2744,   1115,   -620,
+              389,   -255,    168,   -109,     68,    -40,     22,    -11,      5,     -2,      1 } },
+  { .h = {      -7823,      54967,    -215701,     641433,   -1600390,    3521552,   -7038562,   13033982,
+            -22696813,   37635305,  -60157264,   94026638, -146688390,  237083799, -435200630, 1385885106,
+           1332176369, -428979135,  234695096, -145394805,   93219456,  -59624643,   37280036,  -22463661,
+             12886209,   -6949459,    3471182,   -1574145,     629115,    -210677,      53301 },
+    .d = {      0,     -1,      2,     -4,      9,    -17,     30,    -49,     76,   -114,
+              169,   -254,    411,   -782,   2170, -20811,  21143,  -2688,   1083,   -599,
+              376,   -247,    163,   -106,     66,    -39,     22,    -11,      5,     -2,      1 } },
+  { .h = {      -7786,      54808,    -215230,     640301,   -1598020,    3517084,   -7030801,   13021349,
+            -22677251,   37606022,  -60113998,   93961533, -146583275,  236883525, -434645120, 1380557452,
+           1337589049, -429667152,  234972247, -145548234,   93315679,  -59687830,   37321760,  -22490698,
+             12903111,   -6959507,    3476782,   -1577021,     630445,    -211211,      53475 },
+    .d = {      0,     -1,      2,     -5,      9,    -18,     31,    -51,     80,   -120,
+              178,   -268,    432,   -816,   2228, -20850,  21108,  -2631,   1050,   -579,
+              363,   -238,    158,   -102,     64,    -38,     21,    -11,      5,     -2,      1 } },
+  { .h = {      -7748,      54647,    -214753,     639146,   -1595593,    3512488,   -7022782,   13008235,
+            -22656848,   37575342,  -60068496,   93892936, -146472735,  236674605, -434074631, 1375219881,
+           1342992754, -430340705,  235240963, -145696353,   93408482,  -59748827,   37362117,  -22516915,
+             12919545,   -6969304,    3482258,   -1579841,     631754,    -211738,      53647 },
+    .d = {      0,     -1,      2,     -5,     10,    -18,     32,    -53,     83,   -125,
+              186,   -282,    453,   -850,   2287, -20888,  21073,  -2574,   1017,   -558,
+              349,   -230,    152,    -99,     62,    -37,     21,    -11,      5,     -2,      1 } },
+  { .h = {      -7710,      54485,    -214268,     637969,   -1593109,    3507765,   -7014506,   12994642,
+            -22635607,   37543267,  -60020762,   93820853, -146356783,  236457064, -433489226, 1369872509,
+           1348387365, -430999729,  235501216, -145839147,   93497854,  -59807630,   37401104,  -22542310,
+             12935510,   -6978851,    3487609,   -1582607,     633040,    -212258,      53818 },
+    .d = {      0,     -1,      2,     -5,     10,    -19,     33,    -55,     86,   -131,
+              195,   -295,    474,   -883,   2345, -20926,  21037,  -2517,    983,   -537,
+              336,   -221,    147,    -96,     61,    -36,     20,    -11,      5,     -2,      1 } },
+  { .h = {      -7672,      54320,    -213776,     636770,   -1590568,    3502915,   -7005974,   12980572,
+            -22613530,   37509802,  -59970803,   93745295, -146235434,  236230929, -432888970, 1364515453,
+           1353772764, -431644157,  235752979, -145976602,   93583786,  -59864230,   37438716,  -22566879,
+             12951004,   -6988145,    3492837,   -1585316,     634306,    -212771,      53987 },
+    .d = {      0,     -1,      2,     -5,     10,    -19,     34,    -57,     89,   -136,
+              204,   -309,    495,   -917,   2403, -20963,  21000,  -2460,    950,   -516,
+              322,   -212,    142,    -93,     59,    -35,     20,    -10,      5,     -2,      1 } },
+  { .h = {      -7634,      54155,    -213277,     635549,   -1587970,    3497939,   -6997187,   12966025,
+            -22590620,   37474950,  -59918623,   93666270, -146108703,  235996225, -432273925, 1359148832,
+           1359148832, -432273925,  235996225, -146108703,   93666270,  -59918623,   37474950,  -22590620,
+             12966025,   -6997187,    3497939,   -1587970,     635549,    -213277,      54155 },
+    .d = {      0,     -1,      2,     -5,     10,    -20,     35,    -59,     93,   -142,
+              212,   -322,    516,   -950,   2460, -21000,  20963,  -2403,    917,   -495,
+              309,   -204,    136,    -89,     57,    -34,     19,    -10,      5,     -2,      1 } },
+  { .h = {      -7596,      53987,    -212771,     634306,   -1585316,    3492837,   -6988145,   12951004,
+            -22566879,   37438716,  -59864230,   93583786, -145976602,  235752979, -431644157, 1353772764,
+           1364515453, -432888970,  236230929, -146235434,   93745295,  -59970803,   37509802,  -22613530,
+             12980572,   -7005974,    3502915,   -1590568,     636770,    -213776,      54320 },
+    .d = {      0,     -1,      2,     -5,     11,    -20,     36,    -61,     96,   -147,
+              221,   -336,    537,   -983,   2517, -21037,  20926,  -2345,    883,   -474,
+              295,   -195,    131,    -86,     55,    -33,     19,    -10,      5,     -2,      1 } },
+  { .h = {      -7558,      53818,    -212258,     633040,   -1582607,    3487609,   -6978851,   12935510,
+            -22542310,   37401104,  -59807630,   93497854, -145839147,  235501216, -430999729, 1348387365,
+           1369872509, -433489226,  236457064, -146356783,   93820853,  -60020762,   37543267,  -22635607,
+             12994642,   -7014506,    3507765,   -1593109,     637969,    -214268,      54485 },
+    .d = {      0,     -1,      2,     -5,     11,    -21,     37,    -62,     99,   -152,
+              230,   -349,    558,  -1017,   2574, -21073,  20888,  -2287,    850,   -453,
+              282,   -186,    125,    -83,     53,    -32,     18,    -10,      5,     -2,      1 } },
+  { .h = {      -7519,      53647,    -211738,     631754,   -1579841,    3482258,   -6969304,   12919545,
+            -22516915,   37362117,  -59748827,   93408482, -145696353,  235240963, -430340705, 1342992754,
+           1375219881, -434074631,  236674605, -146472735,   93892936,  -60068496,   37575342,  -22656848,
+             13008235,   -7022782,    3512488,   -1595593,     639146,    -214753,      54647 },
+    .d = {      0,     -1,      2,     -5,     11,    -21,     38,    -64,    102,   -158,
+              238,   -363,    579,  -1050,   2631, -21108,  20850,  -2228,    816,   -432,
+              268,   -178,    120,    -80,     51,    -31,     18,     -9,      5,     -2,      1 } },
+  { .h = {      -7481,      53475,    -211211,     630445,   -1577021,    3476782,   -6959507,   12903111,
+            -22490698,   37321760,  -59687830,   93315679, -145548234,  234972247, -429667152, 1337589049,
+           1380557452, -434645120,  236883525, -146583275,   93961533,  -60113998,   37606022,  -22677251,
+             13021349,   -7030801,    3517084,   -1598020,     640301,    -215230,      54808 },
+    .d = {      0,     -1,      2,     -5,     11,    -22,     39,    -66,    106,   -163,
+              247,   -376,    599,  -1083,   2688, -21143,  20811,  -2170,    782,   -411,
+              254,   -169,    114,    -76,     49,    -30,     17,     -9,      4,     -2,      1 } },
+  { .h = {      -7442,      53301,    -210677,     629115,   -1574145,    3471182,   -6949459,   12886209,
+            -22463661,   37280036,  -59624643,   93219456, -145394805,  234695096, -428979135, 1332176369,
+           1385885106, -435200630,  237083799, -146688390,   94026638,  -60157264,   37635305,  -22696813,
+             13033982,   -7038562,    3521552,   -1600390,     641433,    -215701,      54967 },
+    .d = {      0,     -1,      2,     -5,     11,    -22,     40,    -68,    109,   -168,
+              255,   -389,    620,  -1115,   2744, -21178,  20772,  -2111,    748,   -389,
+              241,   -160,    109,    -73,     47,    -29,     17,     -9,      4,     -2,      1 } },
+  { .h = {      -7403,      53126,    -210136,     627764,   -1571215,    3465460,   -6939162,   12868842,
+            -22435807,   37236951,  -59559273,   93119821, -145236081,  234409535, -428276718, 1326754831,
+           1391202725, -435741099,  237275403, -146788067,   94088241,  -60198286,   37663185,  -22715531,
+             13046133,   -7046064,    3525892,   -1602702,     642543,    -216163,      55124 },
+    .d = {      0,     -1,      2,     -5,     12,    -23,     41,    -70,    112,   -174,
+              264,   -402,    641,  -1148,   2800, -21212,  20732,  -2052,    714,   -368,
+              227,   -151,    103,    -70,     46,    -28,     16,     -9,      4,     -2,      1 } },
+  { .h = {      -7364,      52949,    -209589,     626392,   -1568230,    3459616,   -6928617,   12851010,
+            -22407138,   37192508,  -59491726,   93016785, -145072079,  234115594, -427559968, 1321324555,
+           1396510193, -436266463,  237458312, -146882291,   94146333,  -60237060,   37689660,  -22733404,
+             13057800,   -7053306,    3530102,   -1604957,     643630,    -216619,      55280 },
+    .d = {      0,     -1,      2,     -5,     12,    -23,     42,    -71,    115,   -179,
+              272,   -416,    661,  -1181,   2856, -21246,  20692,  -1993,    680,   -347,
+              213,   -143,     98,    -67,     44,    -27,     16,     -9,      4,     -2,      1 } },
+  { .h = {      -7325,      52771,    -209035,     624999,   -1565191,    3453650,   -6917826,   12832716,
+            -22377658,   37146712,  -59422010,   92910357, -144902813,  233813300, -426828951, 1315885658,
+           1401807391, -436776661,  237632500, -146971050,   94200907,  -60273581,   37714726,  -22750428,
+             13068981,   -7060287,    3534183,   -1607153,     644693,    -217067,      55434 },
+    .d = {      0,     -1,      2,     -6,     12,    -24,     43,    -73,    118,   -184,
+              281,   -429,    682,  -1213,   2911, -21279,  20652,  -1933,    646,   -325,
+              199,   -134,     92,    -63,     42,    -26,     15,     -8,      4,     -2,      1 } },
+  { .h = {      -7285,      52591,    -208474,     623585,   -1562098,    3447563,   -6906788,   12813961,
+            -22347369,   37099566,  -59350129,   92800546, -144728299,  233502682, -426083734, 1310438260,
+           1407094204, -437271630,  237797945, -147054331,   94251955,  -60307842,   37738378,  -22766602,
+             13079674,   -7067006,    3538134,   -1609290,     645734,    -217508,      55586 },
+    .d = {      0,     -1,      2,     -6,     12,    -24,     44,    -75,    121,   -189,
+              289,   -442,    702,  -1246,   2966, -21312,  20611,  -1874,    612,   -304,
+              186,   -125,     87,    -60,     40,    -25,     15,     -8,      4,     -2,      1 } },
+  { .h = {      -7246,      52409,    -207907,     622150,   -1558952,    3441355,   -6895506,   12794748,
+            -22316273,   37051076,  -59276092,   92687364, -144548553,  233183766, -425324382, 1304982479,
+           1412370516, -437751309,  237954622, -147132121,   94299467,  -60339839,   37760614,  -22781922,
+             13089880,   -7073462,    3541954,   -1611369,     646752,    -217941,      55736 },
+    .d = {      0,     -1,      2,     -6,     12,    -25,     45,    -77,    125,   -195,
+              298,   -455,    723,  -1278,   3021, -21344,  20569,  -1814,    578,   -282,
+              172,   -116,     81,    -57,     38,    -24,     14,     -8,      4,     -2,      1 } },
+  { .h = {      -7206,      52227,    -207333,     620695,   -1555753,    3435028,   -6883980,   12775078,
+            -22284375,   37001246,  -59199905,   92570820, -144363591,  232856583, -424550964, 1299518435,
+           1417636210, -438215636,  238102507, -147204406,   94343437,  -60369566,   37781431,  -22796387,
+             13099595,   -7079655,    3545643,   -1613389,     647746,    -218366,      55885 },
+    .d = {      0,     -1,      2,     -6,     13,    -25,     46,    -79,    128,   -200,
+              306,   -468,    743,  -1310,   3076, -21376,  20527,  -1754,    543,   -261,
+              158,   -107,     76,    -53,     36,    -23,     14,     -8,      4,     -2,      1 } },
+  { .h = {      -7167,      52042,    -206753,     619219,   -1552501,    3428581,   -6872211,   12754952,
+            -22251677,   36950080,  -59121574,   92450925, -144173430,  232521161, -423763546, 1294046246,
+           1422891169, -438664550,  238241577, -147271176,   94383857,  -60397018,   37800823,  -22809994,
+             13108818,   -7085583,    3549200,   -1615350,     648717,    -218784,      56032 },
+    .d = {      0,     -1,      2,     -6,     13,    -26,     47,    -80,    131,   -205,
+              314,   -481,    763,  -1342,   3130, -21407,  20485,  -1693,    509,   -239,
+              144,    -98,     70,    -50,     34,    -22,     13,     -7,      4,     -2,      1 } },
+  { .h = {      -7127,      51857,    -206167,     617723,   -1549196,    3422015,   -6860201,   12734373,
+            -22218181,   36897582,  -59041107,   92327688, -143978085,  232177529, -422962195, 1288566031,
+           1428135278, -439097991,  238371808, -147332416,   94420719,  -60422190,   37818789,  -22822741,
+             13117548,   -7091245,    3552625,   -1617250,     649665,    -219194,      56176 },
+    .d = {      0,     -1,      2,     -6,     13,    -26,     48,    -82,    134,   -210,
+              323,   -494,    783,  -1374,   3184, -21438,  20442,  -1632,    474,   -218,
+              130,    -89,     65,    -46,     32,    -21,     13,     -7,      4,     -2,      1 } },
+  { .h = {      -7087,      51670,    -205574,     616207,   -1545839,    3415332,   -6847950,   12713343,
+            -22183891,   36843758,  -58958510,   92201121, -143777574,  231825716, -422146980, 1283077911,
+           1433368422, -439515898,  238493179, -147388116,   94454015,  -60445077,   37835324,  -22834626,
+             13125784,   -7096642,    3555918,   -1619091,     650588,    -219596,      56319 },
+    .d = {      0,     -1,      2,     -6,     13,    -27,     49,    -84,    137,   -215,
+              331,   -507,    803,  -1406,   3238, -21468,  20399,  -1572,    439,   -196,
+              116,    -80,     59,    -43,     30,    -20,     12,     -7,      4,     -2,      1 } },
+  { .h = {      -7047,      51481,    -204975,     614671,   -1542429,    3408531,   -6835460,   12691863,
+            -22148809,   36788612,  -58873790,   92071233, -143571913,  231465752, -421317968, 1277582004,
+           1438590484, -439918212,  238605665, -147438263,   94483739,  -60465674,   37850426,  -22845646,
+             13133523,   -7101770,    3559077,   -1620872,     651488,    -219991,      56460 },
+    .d = {      0,     -1,      2,     -6,     14,    -27,     50,    -86,    140,   -221,
+              339,   -520,    823,  -1438,   3292, -21498,  20355,  -1510,    405,   -174,
+              102,    -71,     53,    -40,     28,    -19,     12,     -7,      3,     -2,      1 } },
+  { .h = {      -7007,      51291,    -204369,     613115,   -1538969,    3401613,   -6822731,   12669935,
+            -22112940,   36732149,  -58786954,   91938036, -143361118,  231097667, -420475228, 1272078429,
+           1443801350, -440304871,  238709246, -147482845,   94509882,  -60483976,   37864090,  -22855799,
+             13140766,   -7106631,    3562102,   -1622593,     652364,    -220377,      56600 },
+    .d = {      0,     -1,      2,     -6,     14,    -27,     51,    -87,    143,   -226,
+              347,   -533,    843,  -1469,   3345, -21528,  20311,  -1449,    370,   -152,
+               88,    -63,     48,    -36,     26,    -18,     11,     -6,      3,     -1,      1 } },
+  { .h = {      -6967,      51100,    -203758,     611539,   -1535456,    3394578,   -6809766,   12647561,
+            -22076285,   36674372,  -58698010,   91801541, -143145208,  230721491, -419618829, 1266567307,
+           1449000903, -440675817,  238803899, -147521851,   94532438,  -60499979,   37876314,  -22865084,
+             13147509,   -7111222,    3564993,   -1624252,     653216,    -220756,      56737 },
+    .d = {      0,     -1,      2,     -6,     14,    -28,     52,    -89,    146,   -231,
+              356,   -546,    863,  -1501,   3398, -21557,  20266,  -1387,    335,   -131,
+               74,    -54,     42,    -33,     24,    -17,     11,     -6,      3,     -1,      1 } },
+  { .h = {      -6927,      50908,    -203140,     609944,   -1531893,    3387428,   -6796564,   12624743,
+            -22038847,   36615288,  -58606964,   91661757, -142924199,  230337255, -418748839, 1261048757,
+           1454189029, -441030991,  238889602, -147555270,   94551399,  -60513677,   37887095,  -22873497,
+             13153752,   -7115544,    3567750,   -1625851,     654044,    -221126,      56872 },
+    .d = {      0,     -1,      2,     -6,     14,    -28,     52,    -91,    149,   -236,
+              364,   -559,    883,  -1532,   3451, -21585,  20221,  -1326,    300,   -109,
+               60,    -44,     36,    -29,     22,    -16,     10,     -6,      3,     -1,      1 } },
+  { .h = {      -6886,      50714,    -202516,     608329,   -1528279,    3380164,   -6783127,   12601483,
+            -22000631,   36554900,  -58513824,   91518697, -142698109,  229944988, -417865326, 1255522899,
+           1459365614, -441370334,  238966334, -147583089,   94566759,  -60525066,   37896429,  -22881037,
+             13159493,   -7119595,    3570371,   -1627389,     654847,    -221489,      57005 },
+    .d = {      0,     -1,      2,     -6,     14,    -29,     53,    -93,    152,   -241,
+              372,   -572,    903,  -1564,   3504, -21613,  20176,  -1263,    265,    -87,
+               46,    -35,     31,    -26,     20,    -15,     10,     -6,      3,     -1,      1 } },
+  { .h = {      -6846,      50519,    -201886,     606695,   -1524615,    3372784,   -6769457,   12577783,
+            -21961638,   36493214,  -58418598,   91372371, -142466955,  229544721, -416968361, 1249989852,
+           1464530542, -441693788,  239034073, -147605300,   94578511,  -60534142,   37904314,  -22887701,
+             13164731,   -7123374,    3572856,   -1628865,     655626,    -221843,      57137 },
+    .d = {      0,     -1,      2,     -6,     15,    -29,     54,    -94,    155,   -246,
+              380,   -584,    923,  -1595,   3556, -21641,  20130,  -1201,    229,    -65,
+               32,    -26,     25,    -23,     18,    -14,      9,     -6,      3,     -1,      1 } },
+  { .h = {      -6805,      50323,    -201251,     605042,   -1520901,    3365291,   -6755554,   12553645,
+            -21921872,   36430234,  -58321291,   91222791, -142230755,  229136486, -416058014, 1244449736,
+           1469683699, -442001294,  239092799, -147621889,   94586648,  -60540900,   37910746,  -22893489,
+             13169465,   -7126881,    3575206,   -1630279,     656380,    -222190,      57266 },
+    .d = {      0,     -1,      3,     -7,     15,    -30,     55,    -96,    158,   -251,
+              388,   -597,    942,  -1626,   3608, -21668,  20083,  -1139,    194,    -43,
+               18,    -17,     19,    -19,     17,    -13,      9,     -5,      3,     -1,      0 } },
+  { .h = {      -6765,      50125,    -200609,     603370,   -1517137,    3357685,   -6741419,   12529070,
+            -21881337,   36365966,  -58221913,   91069968, -141989527,  228720314, -415134353, 1238902672,
+           1474824971, -442292794,  239142491, -147632848,   94591163,  -60545336,   37915722,  -22898397,
+             13173694,   -7130114,    3577418,   -1631631,     657109,    -222528,      57394 },
+    .d = {      0,     -1,      3,     -7,     15,    -30,     56,    -98,    161,   -256,
+              396,   -610,    962,  -1657,   3660, -21695,  20036,  -1076,    159,    -21,
+                3,     -8,     14,    -16,     15,    -12,      8,     -5,      3,     -1,      0 } },
+  { .h = {      -6724,      49926,    -199962,     601679,   -1513323,    3349966,   -6727055,   12504061,
+            -21840035,   36300413,  -58120470,   90913914, -141743288,  228296236, -414197449, 1233348780,
+           1479954244, -442568232,  239183129, -147638165,   94592051,  -60547445,   37919240,  -22902423,
+             13177415,   -7133074,    3579493,   -1632922,     657814,    -222858,      57519 },
+    .d = {      0,     -1,      3,     -7,     15,    -31,     57,    -99,    164,   -261,
+              404,   -622,    981,  -1687,   3711, -21721,  19989,  -1013,    123,      1,
+              -11,      1,      8,    -12,     13,    -10,      8,     -5,      3,     -1,      0 } },
+  { .h = {      -6684,      49726,    -199309,     599969,   -1509461,    3342136,   -6712461,   12478620,
+            -21797970,   36233582,  -58016970,   90754639, -141492058,  227864284, -413247372, 1227788179,
+           1485071404, -442827550,  239214692, -147637831,   94589305,  -60547223,   37921296,  -22905567,
+             13180628,   -7135758,    3581431,   -1634149,     658494,    -223179,      57642 },
+    .d = {      0,     -1,      3,     -7,     15,    -31,     58,   -101,    167,   -266,
+              412,   -635,   1001,  -1718,   3762, -21747,  19941,   -950,     88,     23,
+              -25,     10,      2,     -9,     11,     -9,      7,     -5,      3,     -1,      0 } },
+  { .h = {      -6643,      49525,    -198650,     598241,   -1505549,    3334194,   -6697638,   12452748,
+            -21755144,   36165478,  -57911420,   90592156, -141235854,  227424490, -412284192, 1222220990,
+           1490176337, -443070691,  239237162, -147631834,   94582919,  -60544667,   37921887,  -22907824,
+             13183331,   -7138167,    3583231,   -1635314,     659148,    -223493,      57763 },
+    .d = {      0,     -1,      3,     -7,     15,    -31,     59,   -103,    170,   -271,
+              420,   -647,   1020,  -1748,   3813, -21772,  19893,   -886,     52,     46,
+              -39,     19,     -3,     -5,      9,     -8,      6,     -4,      2,     -1,      0 } },
+  { .h = {      -6602,      49322,    -197985,     596495,   -1501589,    3326142,   -6682590,   12426448,
+            -21711561,   36096104,  -57803830,   90426476, -140974695,  226976886, -411307981, 1216647333,
+           1495268931, -443297599,  239250518, -147620166,   94572887,  -60539772,   37921012,  -22909195,
+             13185524,   -7140299,    3584892,   -1636416,     659778,    -223797,      57882 },
+    .d = {      0,     -1,      3,     -7,     16,    -32,     60,   -104,    173,   -276,
+              428,   -660,   1039,  -1779,   3864, -21797,  19844,   -823,     16,     68,
+              -53,     28,     -9,     -2,      7,     -7,      6,     -4,      2,     -1,      0 } },
+  { .h = {      -6561,      49118,    -197315,     594730,   -1497581,    3317980,   -6667315,   12399722,
+            -21667225,   36025467,  -57694205,   90257611, -140708599,  226521504, -410318810, 1211067328,
+           1500349072, -443508218,  239254742, -147602817,   94559202,  -60532534,   37918666,  -22909677,
+             13187205,   -7142154,    3586414,   -1637454,     660382,    -224094,      57999 },
+    .d = {      0,     -1,      3,     -7,     16,    -32,     61,   -106,    176,   -281,
+              436,   -672,   1059,  -1809,   3914, -21821,  19795,   -759,    -19,     90,
+              -68,     37,    -15,      2,      5,     -6,      5,     -4,      2,     -1,      0 } },
+  { .h = {      -6520,      48914,    -196639,     592946,   -1493525,    3309708,   -6651816,   12372571,
+            -21622138,   35953572,  -57582554,   90085574, -140437586,  226058377, -409316749, 1205481096,
+           1505416646, -443702493,  239249814, -147579778,   94541860,  -60522949,   37914849,  -22909268,
+             13188372,   -7143731,    3587796,   -1638429,     660961,    -224382,      58114 },
+    .d = {      0,     -1,      3,     -7,     16,    -33,     61,   -108,    179,   -286,
+              444,   -684,   1078,  -1839,   3964, -21845,  19746,   -695,    -55,    112,
+              -82,     47,    -21,      5,      3,     -5,      5,     -4,      2,     -1,      0 } },
+  { .h = {      -6479,      48708,    -195958,     591145,   -1489422,    3301328,   -6636093,   12344998,
+            -21576304,   35880423,  -57468886,   89910376, -140161674,  225587537, -408301870, 1199888758,
+           1510471543, -443880367,  239235716, -147551038,   94520854,  -60511014,   37909556,  -22907966,
+             13189025,   -7145029,    3589038,   -1639340,     661514,    -224661,      58227 },
+    .d = {      0,     -1,      3,     -7,     16,    -33,     62,   -109,    182,   -291,
+              452,   -697,   1097,  -1869,   4014, -21868,  19696,   -631,    -91,    135,
+              -96,     56,    -26,      9,      1,     -4,      4,     -3,      2,     -1,      0 } },
+  { .h = {      -6438,      48501,    -195272,     589327,   -1485271,    3292840,   -6620149,   12317005,
+            -21529727,   35806026,  -57353207,   89732029, -139880882,  225109019, -407274244, 1194290433,
+           1515513647, -444041787,  239212429, -147516590,   94496180,  -60496724,   37902785,  -22905770,
+             13189162,   -7146048,    3590141,   -1640188,     662041,    -224931,      58338 },
+    .d = {      0,     -1,      3,     -7,     16,    -34,     63,   -111,    185,   -295,
+              460,   -709,   1116,  -1899,   4064, -21891,  19645,   -566,   -127,    157,
+             -111,     65,    -32,     12,     -1,     -3,      4,     -3,      2,     -1,      0 } },
+  { .h = {      -6397,      48293,    -194580,     587490,   -1481074,    3284244,   -6603984,   12288594,
+            -21482409,   35730386,  -57235526,   89550546, -139595231,  224622854, -406233945, 1188686242,
+           1520542849, -444186697,  239179937, -147476424,   94467831,  -60480077,   37894534,  -22902677,
+             13188782,   -7146786,    3591102,   -1640971,     662542,    -225193,      58446 },
+    .d = {      0,     -1,      3,     -7,     17,    -34,     64,   -113,    188,   -300,
+              467,   -721,   1135,  -1929,   4113, -21914,  19594,   -501,   -163,    179,
+             -125,     74,    -38,     16,     -4,     -2,      3,     -3,      2,     -1,      0 } },
+  { .h = {      -6356,      48083,    -193882,     585636,   -1476830,    3275542,   -6587598,   12259767,
+            -21434354,   35653509,  -57115851,   89365939, -139304738,  224129077, -405181043, 1183076306,
+           1525559035, -444315043,  239138220, -147430531,   94435803,  -60461069,   37884800,  -22898687,
+             13187885,   -7147243,    3591922,   -1641689,     663018,    -225447,      58552 },
+    .d = {      0,     -1,      3,     -7,     17,    -34,     65,   -114,    191,   -305,
+              475,   -733,   1154,  -1958,   4162, -21936,  19543,   -436,   -199,    202,
+             -140,     83,    -44,     19,     -6,     -1,      3,     -3,      2,     -1,      0 } },
+  { .h = {      -6315,      47873,    -193180,     583764,   -1472540,    3266734,   -6570995,   12230525,
+            -21385565,   35575400,  -56994191,   89178220, -139009424,  223627720, -404115611, 1177460745,
+           1530562094, -444426771,  239087262, -147378904,   94400090,  -60439696,   37873582,  -22893797,
+             13186468,   -7147418,    3592600,   -1642343,     663468,    -225691,      58656 },
+    .d = {      0,     -1,      3,     -7,     17,    -35,     66,   -116,    193,   -310,
+              483,   -745,   1172,  -1988,   4211, -21957,  19491,   -371,   -235,    224,
+             -154,     93,    -50,     23,     -8,      0,      2,     -2,      2,     -1,      0 } },
+  { .h = {      -6273,      47662,    -192472,     581876,   -1468204,    3257820,   -6554174,   12200872,
+            -21336047,   35496064,  -56870553,   88987402, -138709309,  223118819, -403037721, 1171839680,
+           1535551915, -444521828,  239027046, -147321534,   94360687,  -60415955,   37860875,  -22888006,
+             13184531,   -7147311,    3593136,   -1642932,     663891,    -225927,      58758 },
+    .d = {      0,     -1,      3,     -7,     17,    -35,     67,   -117,    196,   -315,
+              491,   -757,   1191,  -2017,   4259, -21978,  19439,   -306,   -271,    247,
+             -168,    102,    -55,     26,    -10,      2,      2,     -2,      2,     -1,      0 } },
+  { .h = {      -6232,      47449,    -191759,     579970,   -1463822,    3248802,   -6537137,   12170809,
+            -21285801,   35415507,  -56744946,   88793498, -138404411,  222602407, -401947447, 1166213232,
+           1540528385, -444600161,  238957555, -147258413,   94317590,  -60389842,   37846679,  -22881311,
+             13182073,   -7146921,    3593529,   -1643455,     664288,    -226154,      58857 },
+    .d = {      0,     -1,      3,     -8,     17,    -36,     67,   -119,    199,   -319,
+              498,   -769,   1210,  -2046,   4307, -21999,  19387,   -240,   -308,    269,
+             -183,    111,    -61,     30,    -12,      3,      1,     -2,      1,     -1,      0 } },
+  { .h = {      -6191,      47236,    -191041,     578047,   -1459396,    3239680,   -6519886,   12140339,
+            -21234833,   35333734,  -56617378,   88596521, -138094753,  222078518, -400844862, 1160581521,
+           1545491395, -444661716,  238878772, -147189533,   94270794,  -60361355,   37830991,  -22873713,
+             13179092,   -7146247,    3593780,   -1643913,     664659,    -226372,      58955 },
+    .d = {      0,     -1,      3,     -8,     17,    -36,     68,   -121,    202,   -324,
+              506,   -781,   1228,  -2076,   4355, -22019,  19334,   -175,   -344,    292,
+             -197,    121,    -67,     33,    -14,      4,      0,     -2,      1,     -1,      0 } },
+  { .h = {      -6150,      47021,    -190318,     576107,   -1454924,    3230454,   -6502421,   12109462,
+            -21183144,   35250750,  -56487857,   88396482, -137780352,  221547186, -399730038, 1154944668,
+           1550440833, -444706442,  238790681, -147114886,   94220294,  -60330490,   37813809,  -22865208,
+             13175588,   -7145288,    3593887,   -1644306,     665003,    -226580,      59050 },
+    .d = {      0,     -1,      3,     -8,     18,    -36,     69,   -122,    205,   -329,
+              514,   -793,   1247,  -2104,   4402, -22039,  19280,   -109,   -381,    314,
+             -212,    130,    -73,     37,    -16,      5,      0,     -1,      1,     -1,      0 } },
+  { .h = {      -6108,      46806,    -189590,     574151,   -1450408,    3221126,   -6484743,   12078183,
+            -21130739,   35166562,  -56356392,   88193396, -137461231,  221008448, -398603049, 1149302795,
+           1555376588, -444734286,  238693266, -147034466,   94166086,  -60297245,   37795131,  -22855796,
+             13171559,   -7144044,    3593850,   -1644632,     665320,    -226780,      59142 },
+    .d = {      0,     -1,      3,     -8,     18,    -37,     70,   -124,    207,   -334,
+              521,   -805,   1265,  -2133,   4450, -22058,  19226,    -43,   -417,    337,
+             -226,    139,    -79,     40,    -18,      6,     -1,     -1,      1,     -1,      0 } },
+  { .h = {      -6067,      46590,    -188857,     572178,   -1445848,    3211696,   -6466854,   12046502,
+            -21077622,   35081174,  -56222992,   87987275, -137137408,  220462336, -397463968, 1143656021,
+           1560298551, -444745197,  238586513, -146948265,   94108166,  -60261616,   37774954,  -22845475,
+             13167005,   -7142514,    3593669,   -1644893,     665611,    -226971,      59233 },
+    .d = {      0,     -1,      3,     -8,     18,    -37,     71,   -125,    210,   -338,
+              529,   -817,   1283,  -2162,   4496, -22076,  19172,     24,   -454,    359,
+             -241,    148,    -85,     44,    -20,      7,     -1,     -1,      1,     -1,      0 } },
+  { .h = {      -6026,      46372,    -188119,     570189,   -1441243,    3202164,   -6448756,   12014422,
+            -21023795,   34994592,  -56087666,   87778133, -136808906,  219908888, -396312870, 1138004467,
+           1565206612, -444739123,  238470405, -146856275,   94046529,  -60223601,   37753276,  -22834244,
+             13161925,   -7140698,    3593344,   -1645087,     665875,    -227153,      59321 },
+    .d = {      0,     -1,      3,     -8,     18,    -38,     72,   -127,    213,   -343,
+              536,   -829,   1301,  -2190,   4543, -22095,  19117,     90,   -490,    382,
+             -255,    158,    -91,     47,    -22,      8,     -2,      0,      1,     -1,      0 } },
+  { .h = {      -5984,      46154,    -187376,     568184,   -1436596,    3192532,   -6430449,   11981946,
+            -20969263,   34906822,  -55950421,   87565982, -136475744,  219348137, -395149827, 1132348255,
+           1570100660, -444716014,  238344927, -146758491,   93981172,  -60183196,   37730096,  -22822101,
+             13156317,   -7138594,    3592873,   -1645214,     666112,    -227325,      59406 },
+    .d = {      0,     -1,      3,     -8,     18,    -38,     72,   -128,    216,   -347,
+              544,   -840,   1320,  -2219,   4589, -22112,  19062,    157,   -527,    405,
+             -270,    167,    -96,     51,    -24,      9,     -2,      0,      1,     -1,      0 } },
+  { .h = {      -5943,      45935,    -186629,     566163,   -1431905,    3182800,   -6411935,   11949075,
+            -20914029,   34817870,  -55811266,   87350836, -136137943,  218780119, -393974916, 1126687504,
+           1574980586, -444675818,  238210066, -146654905,   93912090,  -60140400,   37705412,  -22809044,
+             13150180,   -7136202,    3592257,   -1645275,     666322,    -227489,      59490 },
+    .d = {      0,     -1,      3,     -8,     18,    -38,     73,   -130,    218,   -352,
+              551,   -852,   1338,  -2247,   4636, -22130,  19007,    224,   -564,    427,
+             -284,    177,   -102,     55,    -26,     10,     -3,      0,      1,     -1,      0 } },
+  { .h = {      -5902,      45715,    -185877,     564125,   -1427171,    3172968,   -6393215,   11915811,
+            -20858096,   34727741,  -55670211,   87132708, -135795525,  218204870, -392788209, 1121022337,
+           1579846282, -444618487,  238065806, -146545511,   93839280,  -60095210,   37679222,  -22795073,
+             13143514,   -7133522,    3591495,   -1645269,     666505,    -227643,      59571 },
+    .d = {      0,     -1,      3,     -8,     19,    -39,     74,   -131,    221,   -357,
+              558,   -864,   1356,  -2275,   4681, -22146,  18951,    291,   -600,    450,
+             -299,    186,   -108,     58,    -28,     12,     -4,      0,      1,     -1,      0 } },
+  { .h = {      -5860,      45494,    -185120,     562072,   -1422395,    3163038,   -6374290,   11882157,
+            -20801469,   34636442,  -55527264,   86911613, -135448510,  217622426, -391589782, 1115352874,
+           1584697637, -444543969,  237912134, -146430304,   93762738,  -60047622,   37651523,  -22780186,
+             13136318,   -7130553,    3590587,   -1645195,     666660,    -227787,      59649 },
+    .d = {      0,     -1,      3,     -8,     19,    -39,     75,   -133,    224,   -361,
+              566,   -875,   1373,  -2303,   4727, -22163,  18894,    358,   -637,    473,
+             -314,    195,   -114,     62,    -30,     13,     -4,      1,      0,     -1,      0 } },
+  { .h = {      -5819,      45272,    -184358,     560004,   -1417577,    3153010,   -6355161,   11848115,
+            -20744151,   34543977,  -55382434,   86687562, -135096920,  217032824, -390379709, 1109679235,
+           1589534544, -444452217,  237749036, -146309276,   93682461,  -59997636,   37622315,  -22764382,
+             13128590,   -7127295,    3589533,   -1645054,     666788,    -227923,      59725 },
+    .d = {      0,     -1,      3,     -8,     19,    -40,     76,   -134,    227,   -366,
+              573,   -887,   1391,  -2331,   4772, -22178,  18837,    426,   -674,    496,
+             -328,    205,   -120,     65,    -32,     14,     -5,      1,      0,      0,      0 } },
+  { .h = {      -5777,      45049,    -183593,     557920,   -1412717,    3142885,   -6335831,   11813687,
+            -20686145,   34450352,  -55235730,   86460571, -134740776,  216436098, -389158065, 1104001541,
+           1594356894, -444343179,  237576498, -146182423,   93598445,  -59945248,   37591595,  -22747660,
+             13120330,   -7123746,    3588331,   -1644846,     666888,    -228049,      59799 },
+    .d = {      0,     -1,      3,     -8,     19,    -40,     76,   -136,    229,   -370,
+              580,   -898,   1409,  -2359,   4817, -22194,  18780,    494,   -711,    518,
+             -343,    214,   -126,     69,    -34,     15,     -5,      1,      0,      0,      0 } },
+  { .h = {      -5736,      44826,    -182822,     555820,   -1407815,    3132663,   -6316299,   11778876,
+            -20627456,   34355574,  -55087161,   86230653, -134380101,  215832287, -387924925, 1098319914,
+           1599164579, -444216809,  237394508, -146049738,   93510688,  -59890456,   37559362,  -22730017,
+             13111538,   -7119906,    3586983,   -1644569,     666961,    -228165,      59870 },
+    .d = {      0,     -1,      3,     -8,     19,    -40,     77,   -137,    232,   -375,
+              588,   -909,   1427,  -2386,   4862, -22209,  18722,    562,   -748,    541,
+             -357,    223,   -132,     73,    -36,     16,     -6,      1,      0,      0,      0 } },
+  { .h = {      -5695,      44602,    -182047,     553706,   -1402872,    3122346,   -6296568,   11743683,
+            -20568086,   34259649,  -54936736,   85997821, -134014914,  215221425, -386680365, 1092634475,
+           1603957490, -444073058,  237203053, -145911216,   93419185,  -59833259,   37525615,  -22711454,
+             13102211,   -7115774,    3585486,   -1644225,     667006,    -228272,      59938 },
+    .d = {      0,     -1,      3,     -8,     19,    -41,     78,   -139,    235,   -379,
+              595,   -921,   1444,  -2414,   4906, -22223,  18664,    630,   -785,    564,
+             -372,    233,   -138,     76,    -39,     17,     -6,      2,      0,      0,      0 } },
+  { .h = {      -5653,      44377,    -181268,     551576,   -1397889,    3111933,   -6276639,   11708111,
+            -20508041,   34162582,  -54784464,   85762090, -133645239,  214603551, -385424460, 1086945343,
+           1608735522, -443911878,  237002120, -145766853,   93323935,  -59773653,   37490351,  -22691969,
+             13092350,   -7111351,    3583842,   -1643812,     667023,    -228369,      60005 },
+    .d = {      0,     -1,      3,     -8,     20,    -41,     79,   -140,    237,   -384,
+              602,   -932,   1461,  -2441,   4950, -22237,  18606,    698,   -822,    587,
+             -387,    242,   -144,     80,    -41,     18,     -7,      2,      0,      0,      0 } },
+  { .h = {      -5612,      44151,    -180485,     549432,   -1392864,    3101426,   -6256513,   11672163,
+            -20447323,   34064379,  -54630354,   85523474, -133271098,  213978702, -384157285, 1081252640,
+           1613498565, -443733222,  236791698, -145616643,   93224934,  -59711638,   37453570,  -22671561,
+             13081953,   -7106635,    3582049,   -1643331,     667013,    -228457,      60068 },
+    .d = {      0,     -1,      3,     -8,     20,    -41,     79,   -142,    240,   -388,
+              609,   -943,   1479,  -2468,   4994, -22251,  18547,    766,   -859,    610,
+             -401,    252,   -150,     83,    -43,     20,     -8,      2,      0,      0,      0 } },
+  { .h = {      -5571,      43924,    -179697,     547273,   -1387800,    3090825,   -6236191,   11635840,
+            -20385936,   33965046,  -54474416,   85281987, -132892511,  213346914, -382878918, 1075556486,
+           1618246514, -443537043,  236571774, -145460582,   93122180,  -59647211,   37415269,  -22650229,
+             13071020,   -7101626,    3580108,   -1642781,     666974,    -228535,      60129 },
+    .d = {      0,     -1,      3,     -8,     20,    -42,     80,   -143,    242,   -392,
+              616,   -954,   1496,  -2495,   5037, -22264,  18487,    835,   -896,    632,
+             -416,    261,   -156,     87,    -45,     21,     -8,      2,      0,      0,      0 } },
+  { .h = {      -5530,      43697,    -178905,     545099,   -1382696,    3080131,   -6215674,   11599145,
+            -20323884,   33864589,  -54316659,   85037643, -132509503,  212708225, -381589432, 1069857003,
+           1622979262, -443323294,  236342337, -145298665,   93015670,  -59580370,   37375448,  -22627972,
+             13059551,   -7096323,    3578017,   -1642162,     666907,    -228603,      60188 },
+    .d = {      0,     -1,      3,     -9,     20,    -42,     81,   -145,    245,   -397,
+              623,   -966,   1513,  -2522,   5080, -22276,  18427,    904,   -933,    655,
+             -431,    271,   -161,     91,    -47,     22,     -9,      3,      0,      0,      0 } },
+  { .h = {      -5488,      43469,    -178109,     542911,   -1377553,    3069345,   -6194965,   11562080,
+            -20261171,   33763015,  -54157092,   84790456, -132122094,  212062672, -380288906, 1064154311,
+           1627696701, -443091928,  236103377, -145130888,   92905402,  -59511115,   37334106,  -22604788,
+             13047543,   -7090726,    3575777,   -1641474,     666812,    -228662,      60244 },
+    .d = {      0,     -1,      3,     -9,     20,    -42,     82,   -146,    248,   -401,
+              630,   -977,   1530,  -2548,   5123, -22288,  18367,    973,   -971,    678,
+             -445,    280,   -167,     94,    -49,     23,     -9,      3,      0,      0,      0 } },
+  { .h = {      -5447,      43240,    -177309,     540709,   -1372370,    3058468,   -6174064,   11524647,
+            -20197801,   33660329,  -53995725,   84540441, -131730307,  211410294, -378977415, 1058448531,
+           1632398727, -442842901,  235854881, -144957247,   92791373,  -59439442,   37291240,  -22580677,
+             13034997,   -7084835,    3573388,   -1640717,     666688,    -228711,      60297 },
+    .d = {      0,     -1,      3,     -9,     20,    -43,     82,   -148,    250,   -405,
+              637,   -988,   1547,  -2575,   5166, -22300,  18307,   1042,  -1008,    701,
+             -460,    289,   -173,     98,    -51,     24,    -10,      3,     -1,      0,      0 } },
+  { .h = {      -5406,      43010,    -176505,     538492,   -1367149,    3047499,   -6152972,   11486849,
+            -20133778,   33556537,  -53832567,   84287612, -131334166,  210751127, -377655035, 1052739783,
+           1637085234, -442576167,  235596840, -144777737,   92673582,  -59365352,   37246850,  -22555638,
+             13021911,   -7078648,    3570848,   -1639890,     666536,    -228750,      60348 },
+    .d = {      0,     -1,      3,     -9,     21,    -43,     83,   -149,    253,   -410,
+              644,   -999,   1564,  -2601,   5208, -22311,  18246,   1111,  -1045,    724,
+             -475,    299,   -179,    101,    -53,     25,    -11,      4,     -1,      0,      0 } },
+  { .h = {      -5365,      42780,    -175697,     536262,   -1361890,    3036440,   -6131692,   11448689,
+            -20069105,   33451646,  -53667627,   84031985, -130933692,  210085212, -376321843, 1047028188,
+           1641756115, -442291680,  235329243, -144592356,   92552027,  -59288842,   37200935,  -22529670,
+             13008286,   -7072166,    3568158,   -1638994,     666355,    -228779,      60396 },
+    .d = {      0,     -1,      3,     -9,     21,    -44,     84,   -150,    255,   -414,
+              651,  -1009,   1581,  -2627,   5250, -22322,  18184,   1181,  -1083,    747,
+             -490,    308,   -185,    105,    -55,     26,    -11,      4,     -1,      0,      0 } },
+  { .h = {      -5324,      42549,    -174885,     534017,   -1356592,    3025292,   -6110223,   11410167,
+            -20003786,   33345662,  -53500915,   83773572, -130528909,  209412584, -374977917, 1041313867,
+           1646411267, -441989397,  235052081, -144401100,   92426705,  -59209911,   37153493,  -22502772,
+             12994120,   -7065387,    3565318,   -1638028,     666146,    -228798,      60442 },
+    .d = {      0,     -1,      3,     -9,     21,    -44,     85,   -152,    258,   -418,
+              658,  -1020,   1598,  -2654,   5291, -22332,  18122,   1250,  -1120,    770,
+             -504,    318,   -191,    109,    -57,     28,    -12,      4,     -1,      0,      0 } },
+  { .h = {      -5282,      42318,    -174069,     531760,   -1351257,    3014055,   -6088569,   11371288,
+            -19937825,   33238591,  -53332441,   83512390, -130119839,  208733284, -373623333, 1035596941,
+           1651050583, -441669273,  234765344, -144203965,   92297616,  -59128558,   37104524,  -22474943,
+             12979412,   -7058312,    3562326,   -1636992,     665908,    -228807,      60485 },
+    .d = {      0,     -1,      3,     -9,     21,    -44,     85,   -153,    260,   -422,
+              665,  -1031,   1615,  -2679,   5333, -22341,  18060,   1320,  -1158,    793,
+             -519,    327,   -197,    112,    -60,     29,    -12,      4,     -1,      0,      0 } },
+  { .h = {      -5241,      42085,    -173249,     529488,   -1345884,    3002729,   -6066729,   11332052,
+            -19871227,   33130438,  -53162215,   83248452, -129706506,  208047350, -372258167, 1029877529,
+           1655673960, -441331264,  234469022, -144000949,   92164757,  -59044782,   37054027,  -22446183,
+             12964163,   -7050940,    3559183,   -1635885,     665641,    -228807,      60525 },
+    .d = {      0,     -1,      3,     -9,     21,    -45,     86,   -155,    263,   -427,
+              672,  -1042,   1631,  -2705,   5374, -22351,  17997,   1390,  -1195,    816,
+             -534,    337,   -203,    116,    -62,     30,    -13,      5,     -1,      0,      0 } },
+  { .h = {      -5200,      41853,    -172425,     527203,   -1340474,    2991317,   -6044706,   11292464,
+            -19803994,   33021212,  -52990245,   82981775, -129288933,  207354820, -370882499, 1024155752,
+           1660281294, -440975327,  234163108, -143792049,   92028128,  -58958581,   37002000,  -22416490,
+             12948372,   -7043270,    3555889,   -1634708,     665345,    -228796,      60562 },
+    .d = {      0,     -1,      3,     -9,     21,    -45,     87,   -156,    265,   -431,
+              679,  -1052,   1648,  -2731,   5414, -22359,  17934,   1461,  -1232,    839,
+             -548,    346,   -209,    120,    -64,     31,    -13,      5,     -1,      0,      0 } },
+  { .h = {      -5159,      41619,    -171598,     524905,   -1335028,    2979818,   -6022500,   11252524,
+            -19736132,   32910917,  -52816543,   82712372, -128867143,  206655733, -369496404, 1018431732,
+           1664872479, -440601420,  233847593, -143577263,   91887726,  -58869955,   36948443,  -22385865,
+             12932037,   -7035302,    3552443,   -1633461,     665020,    -228775,      60597 },
+    .d = {      0,     -1,      3,     -9,     21,    -45,     87,   -157,    268,   -435,
+              685,  -1063,   1664,  -2756,   5455, -22368,  17871,   1531,  -1270,    862,
+             -563,    356,   -215,    123,    -66,     32,    -14,      5,     -1,      0,      0 } },
+  { .h = {      -5119,      41385,    -170768,     522594,   -1329545,    2968232,   -6000113,   11212235,
+            -19667644,   32799560,  -52641116,   82440259, -128441160,  205950129, -368099960, 1012705588,
+           1669447414, -440209499,  233522467, -143356587,   91743552,  -58778904,   36893356,  -22354305,
+             12915159,   -7027036,    3548844,   -1632143,     664666,    -228744,      60629 },
+    .d = {      0,     -1,      3,     -9,     22,    -46,     88,   -159,    270,   -439,
+              692,  -1073,   1680,  -2782,   5495, -22376,  17807,   1601,  -1308,    885,
+             -578,    365,   -221,    127,    -68,     33,    -15,      5,     -1,      0,      0 } },
+  { .h = {      -5078,      41151,    -169933,     520270,   -1324027,    2956562,   -5977547,   11171600,
+            -19598533,   32687148,  -52463977,   82165451, -128011007,  205238047, -366693246, 1006977440,
+           1674005995, -439799522,  233187724, -143130020,   91595603,  -58685425,   36836736,  -22321811,
+             12897736,   -7018472,    3545093,   -1630754,     664283,    -228702,      60659 },
+    .d = {      0,     -1,      3,     -9,     22,    -46,     89,   -160,    272,   -443,
+              699,  -1084,   1696,  -2807,   5535, -22383,  17743,   1672,  -1345,    908,
+             -593,    375,   -227,    131,    -70,     35,    -15,      6,     -2,      0,      0 } },
+  { .h = {      -5037,      40916,    -169095,     517934,   -1318472,    2944807,   -5954802,   11130621,
+            -19528805,   32573687,  -52285133,   81887963, -127576707,  204519527, -365276339, 1001247409,
+           1678548118, -439371449,  232843356, -142897561,   91443880,  -58589519,   36778585,  -22288383,
+             12879769,   -7009608,    3541190,   -1629294,     663870,    -228651,      60685 },
+    .d = {      0,     -1,      3,     -9,     22,    -46,     90,   -161,    275,   -447,
+              705,  -1094,   1713,  -2832,   5574, -22390,  17678,   1743,  -1383,    931,
+             -607,    384,   -233,    134,    -72,     36,    -16,      6,     -2,      0,      0 } },
+  { .h = {      -4996,      40680,    -168254,     515585,   -1312883,    2932969,   -5931881,   11089301,
+            -19458463,   32459183,  -52104596,   81607810, -127138286,  203794607, -363849317,  995515614,
+           1683073682, -438925238,  232489356, -142659207,   91288381,  -58491185,   36718901,  -22254018,
+             12861257,   -7000444,    3537133,   -1627763,     663428,    -228589,      60709 },
+    .d = {      0,     -1,      3,     -9,     22,    -47,     90,   -163,    277,   -451,
+              712,  -1105,   1729,  -2857,   5614, -22396,  17613,   1814,  -1420,    954,
+             -622,    394,   -239,    138,    -74,     37,    -16,      6,     -2,      0,      0 } },
+  { .h = {      -4955,      40444,    -167409,     513223,   -1307258,    2921047,   -5908784,   11047641,
+            -19387511,   32343642,  -51922376,   81325008, -126695766,  203063328, -362412257,  989782177,
+           1687582583, -438460847,  232125716, -142414956,   91129106,  -58390422,   36657683,  -22218718,
+             12842199,   -6990981,    3532923,   -1626161,     662957,    -228516,      60730 },
+    .d = {      0,     -1,      3,     -9,     22,    -47,     91,   -164,    280,   -455,
+              718,  -1115,   1745,  -2881,   5652, -22402,  17547,   1885,  -1458,    977,
+             -637,    403,   -245,    142,    -77,     38,    -17,      7,     -2,      0,      0 } },
+  { .h = {      -4915,      40207,    -166561,     510849,   -1301600,    2909044,   -5885513,   11005645,
+            -19315952,   32227072,  -51738481,   81039573, -126249172,  202325730, -360965240,  984047218,
+           1692074721, -437978238,  231752431, -142164808,   90966055,  -58287231,   36594932,  -22182480,
+             12822594,   -6981217,    3528560,   -1624486,     662455,    -228434,      60748 },
+    .d = {      0,     -1,      3,     -9,     22,    -47,     92,   -165,    282,   -459,
+              725,  -1125,   1760,  -2906,   5691, -22408,  17482,   1957,  -1496,   1000,
+             -652,    413,   -251,    145,    -79,     39,    -18,      7,     -2,      0,      0 } },
+  { .h = {      -4874,      39970,    -165709,     508463,   -1295906,    2896958,   -5862069,   10963315,
+            -19243792,   32109479,  -51552924,   80751519, -125798527,  201581852, -359508342,  978310855,
+           1696549993, -437477369,  231369493, -141908762,   90799227,  -58181610,   36530646,  -22145306,
+             12802443,   -6971152,    3524043,   -1622740,     661925,    -228341,      60764 },
+    .d = {      0,     -1,      3,     -9,     22,    -48,     92,   -167,    284,   -463,
+              731,  -1135,   1776,  -2930,   5729, -22413,  17415,   2028,  -1534,   1023,
+             -666,    422,   -257,    149,    -81,     40,    -18,      7,     -2,      0,      0 } },
+  { .h = {      -4834,      39732,    -164855,     506064,   -1290179,    2884792,   -5838454,   10920653,
+            -19171034,   31990869,  -51365712,   80460862, -125343857,  200831735, -358041642,  972573210,
+           1701008299, -436958201,  230976898, -141646817,   90628622,  -58073560,   36464825,  -22107194,
+             12781745,   -6960787,    3519372,   -1620923,     661364,    -228237,      60776 },
+    .d = {      0,     -1,      3,     -9,     23,    -48,     93,   -168,    287,   -467,
+              738,  -1145,   1792,  -2954,   5767, -22417,  17349,   2100,  -1571,   1046,
+             -681,    432,   -263,    153,    -83,     42,    -19,      7,     -2,      0,      0 } },
+  { .h = {      -4793,      39494,    -163997,     503654,   -1284419,    2872546,   -5814668,   10877661,
+            -19097683,   31871248,  -51176858,   80167618, -124885185,  200075420, -356565219,  966834401,
+           1705449538, -436420696,  230574640, -141378971,   90454241,  -57963081,   36397470,  -22068144,
+             12760500,   -6950120,    3514547,   -1619033,     660773,    -228123,      60786 },
+    .d = {      0,     -1,      3,     -9,     23,    -48,     94,   -169,    289,   -471,
+              744,  -1156,   1807,  -2978,   5805, -22421,  17282,   2171,  -1609,   1069,
+             -696,    441,   -269,    156,    -85,     43,    -19,      8,     -2,      0,      0 } },
+  { .h = {      -4753,      39256,    -163136,     501233,   -1278625,    2860220,   -5790714,   10834343,
+            -19023742,   31750624,  -50986371,   79871803, -124422536,  199312946, -355079152,  961094550,
+           1709873608, -435864814,  230162713, -141105226,   90276083,  -57850172,   36328579,  -22028155,
+             12738707,   -6939151,    3509567,   -1617071,     660153,    -227999,      60793 },
+    .d = {      0,     -1,      3,    -10,     23,    -48,     94,   -170,    291,   -475,
+              750,  -1166,   1823,  -3002,   5842, -22425,  17214,   2243,  -1647,   1092,
+             -711,    451,   -275,    160,    -87,     44,    -20,      8,     -3,      1,      0 } },
+  { .h = {      -4713,      39017,    -162271,     498799,   -1272799,    2847816,   -5766593,   10790700,
+            -18949216,   31629003,  -50794261,   79573432, -123955934,  198544355, -353583520,  955353774,
+           1714280411, -435290518,  229741112, -140825581,   90094149,  -57734833,   36258153,  -21987228,
+             12716365,   -6927881,    3504432,   -1615036,     659502,    -227864,      60797 },
+    .d = {      0,     -1,      3,    -10,     23,    -49,     95,   -172,    293,   -479,
+              757,  -1175,   1838,  -3026,   5879, -22428,  17146,   2315,  -1685,   1115,
+             -725,    460,   -281,    164,    -89,     45,    -21,      8,     -3,      1,      0 } },
+  { .h = {      -4672,      38777,    -161404,     496355,   -1266940,    2835334,   -5742307,   10746735,
+            -18874108,   31506392,  -50600538,   79272521, -123485405,  197769688, -352078401,  949612195,
+           1718669846, -434697769,  229309834, -140540035,   89908439,  -57617066,   36186191,  -21945362,
+             12693475,   -6916308,    3499143,   -1612930,     658822,    -227718,      60798 },
+    .d = {      0,     -1,      3,    -10,     23,    -49,     96,   -173,    296,   -483,
+              763,  -1185,   1853,  -3050,   5916, -22431,  17078,   2388,  -1723,   1138,
+             -740,    470,   -287,    167,    -92,     46,    -21,      9,     -3,      1,      0 } },
+  { .h = {      -4632,      38537,    -160534,     493899,   -1261049,    2822774,   -5717855,   10702451,
+            -18798423,   31382796,  -50405214,   78969086, -123010972,  196988985, -350563875,  943869931,
+           1723041813, -434086531,  228868874, -140248589,   89718955,  -57496869,   36112694,  -21902557,
+             12670037,   -6904432,    3493698,   -1610750,     658111,    -227561,      60796 },
+    .d = {      0,     -1,      3,    -10,     23,    -49,     96,   -174,    298,   -487,
+              769,  -1195,   1868,  -3073,   5953, -22433,  17009,   2460,  -1760,   1162,
+             -755,    479,   -293,    171,    -94,     48,    -22,      9,     -3,      1,      0 } },
+  { .h = {      -4592,      38297,    -159661,     491432,   -1255126,    2810138,   -5693241,   10657850,
+            -18722165,   31258224,  -50208298,   78663144, -122532662,  196202287, -349040020,  938127103,
+           1727396214, -433456766,  228418228, -139951244,   89525696,  -57374244,   36037661,  -21858812,
+             12646049,   -6892254,    3488098,   -1608498,     657370,    -227394,      60791 },
+    .d = {      0,     -1,      3,    -10,     23,    -50,     97,   -175,    300,   -490,
+              775,  -1205,   1883,  -3096,   5989, -22435,  16940,   2533,  -1798,   1185,
+             -770,    488,   -299,    175,    -96,     49,    -22,      9,     -3,      1,      0 } },
+  { .h = {      -4552,      38057,    -158785,     488954,   -1249172,    2797427,   -5668465,   10612935,
+            -18645339,   31132682,  -50009801,   78354710, -122050498,  195409636, -347506917,  932383828,
+           1731732951, -432808439,  227957892, -139648000,   89328665,  -57249191,   35961093,  -21814127,
+             12621511,   -6879772,    3482343,   -1606173,     656598,    -227216,      60783 },
+    .d = {      0,     -1,      3,    -10,     23,    -50,     97,   -177,    302,   -494,
+              782,  -1214,   1898,  -3119,   6025, -22436,  16871,   2605,  -1836,   1208,
+             -784,    498,   -305,    178,    -98,     50,    -23,      9,     -3,      1,      0 } },
+  { .h = {      -4512,      37816,    -157906,     486465,   -1243187,    2784640,   -5643529,   10567707,
+            -18567948,   31006175,  -49809734,   78043800, -121564507,  194611074, -345964644,  926640227,
+           1736051923, -432141513,  227487864, -139338859,   89127861,  -57121711,   35882989,  -21768503,
+             12596424,   -6866987,    3476431,   -1603774,     655796,    -227028,      60772 },
+    .d = {      0,     -1,      3,    -10,     23,    -50,     98,   -178,    304,   -498,
+              788,  -1224,   1913,  -3142,   6060, -22437,  16801,   2678,  -1874,   1231,
+             -799,    507,   -311,    182,   -100,     51,    -24,     10,     -3,      1,      0 } },
+  { .h = {      -4473,      37574,    -157025,     483965,   -1237171,    2771780,   -5618434,   10522170,
+            -18489996,   30878713,  -49608106,   77730431, -121074713,  193806641, -344413282,  920896419,
+           1740353035, -431455953,  227008140, -139023822,   88923286,  -56991803,   35803349,  -21721938,
+             12570787,   -6853899,    3470364,   -1601303,     654964,    -226828,      60759 },
+    .d = {      0,     -1,      3,    -10,     24,    -51,     99,   -179,    307,   -502,
+              794,  -1234,   1928,  -3165,   6095, -22437,  16731,   2751,  -1912,   1254,
+             -814,    517,   -317,    186,   -102,     52,    -24,     10,     -3,      1,      0 } },
+  { .h = {      -4433,      37333,    -156140,     481455,   -1231124,    2758845,   -5593182,   10476326,
+            -18411488,   30750300,  -49404929,   77414619, -120581141,  192996379, -342852909,  915152522,
+           1744636188, -430751723,  226518719, -138702889,   88714941,  -56859470,   35722175,  -21674434,
+             12544600,   -6840507,    3464141,   -1598758,     654101,    -226618,      60742 },
+    .d = {      0,     -1,      3,    -10,     24,    -51,     99,   -180,    309,   -505,
+              800,  -1243,   1943,  -3188,   6130, -22437,  16661,   2824,  -1950,   1277,
+             -829,    526,   -323,    189,   -104,     54,    -25,     10,     -3,      1,      0 } },
+  { .h = {      -4393,      37091,    -155253,     478935,   -1225048,    2745838,   -5567774,   10430178,
+            -18332429,   30620944,  -49200213,   77096380, -120083817,  192180331, -341283606,  909408656,
+           1748901284, -430028789,  226019598, -138376063,   88502828,  -56724711,   35639466,  -21625989,
+             12517863,   -6826810,    3457761,   -1596140,     653207,    -226397,      60722 },
+    .d = {      0,     -1,      3,    -10,     24,    -51,    100,   -181,    311,   -509,
+              806,  -1253,   1957,  -3210,   6165, -22436,  16590,   2897,  -1988,   1300,
+             -843,    536,   -329,    193,   -107,     55,    -26,     11,     -4,      1,      0 } },
+  { .h = {      -4354,      36848,    -154364,     476405,   -1218942,    2732759,   -5542211,   10383728,
+            -18252822,   30490651,  -48993969,   76775731, -119582767,  191358538, -339705453,  903664939,
+           1753148227, -429287118,  225510775, -138043345,   88286949,  -56587528,   35555223,  -21576605,
+             12490575,   -6812809,    3451224,   -1593448,     652282,    -226164,      60699 },
+    .d = {      0,     -1,      3,    -10,     24,    -51,    100,   -183,    313,   -513,
+              812,  -1262,   1972,  -3232,   6199, -22435,  16518,   2970,  -2025,   1323,
+             -858,    545,   -335,    197,   -109,     56,    -26,     11,     -4,      1,      0 } },
+  { .h = {      -4314,      36606,    -153472,     473864,   -1212807,    2719609,   -5516495,   10336978,
+            -18172671,   30359429,  -48786207,   76452687, -119078015,  190531042, -338118528,  897921490,
+           1757376921, -428526674,  224992249, -137704739,   88067306,  -56447921,   35469445,  -21526280,
+             12462736,   -6798504,    3444531,   -1590683,     651327,    -225921,      60673 },
+    .d = {      0,     -1,      3,    -10,     24,    -52,    101,   -184,    315,   -516,
+              817,  -1271,   1986,  -3255,   6233, -22434,  16447,   3044,  -2063,   1346,
+             -873,    555,   -341,    200,   -111,     57,    -27,     11,     -4,      1,      0 } },
+  { .h = {      -4275,      36363,    -152577,     471314,   -1206643,    2706389,   -5490628,   10289932,
+            -18091982,   30227285,  -48576939,   76127267, -118569589,  189697885, -336522913,  892178428,
+           1761587270, -427747426,  224464019, -137360245,   87843900,  -56305893,   35382135,  -21475015,
+             12434347,   -6783894,    3437681,   -1587844,     650341,    -225667,      60644 },
+    .d = {      0,     -1,      4,    -10,     24,    -52,    102,   -185,    317,   -520,
+              823,  -1280,   2000,  -3276,   6267, -22432,  16375,   3118,  -2101,   1369,
+             -887,    564,   -347,    204,   -113,     58,    -27,     11,     -4,      1,      0 } },
+  { .h = {      -4236,      36120,    -151680,     468753,   -1200451,    2693098,   -5464610,   10242591,
+            -18010757,   30094224,  -48366174,   75799485, -118057513,  188859110, -334918688,  886435871,
+           1765779177, -426949340,  223926085, -137009866,   87616733,  -56161443,   35293291,  -21422811,
+             12405407,   -6768980,    3430674,   -1584931,     649323,    -225402,      60612 },
+    .d = {      0,     -1,      4,    -10,     24,    -52,    102,   -186,    319,   -523,
+              829,  -1290,   2014,  -3298,   6300, -22429,  16302,   3191,  -2139,   1392,
+             -902,    574,   -353,    208,   -115,     59,    -28,     12,     -4,      1,      0 } },
+  { .h = {      -4197,      35877,    -150781,     466184,   -1194230,    2679739,   -5438443,   10194959,
+            -17929002,   29960255,  -48153925,   75469360, -117541813,  188014759, -333305932,  880693936,
+           1769952548, -426132383,  223378444, -136653606,   87385808,  -56014574,   35202914,  -21369666,
+             12375916,   -6753760,    3423510,   -1581943,     648275,    -225125,      60577 },
+    .d = {      0,     -1,      4,    -10,     24,    -52,    103,   -187,    321,   -527,
+              835,  -1299,   2029,  -3320,   6333, -22427,  16229,   3265,  -2177,   1415,
+             -917,    583,   -359,    211,   -117,     61,    -29,     12,     -4,      1,      0 } },
+  { .h = {      -4158,      35633,    -149879,     463604,   -1187981,    2666311,   -5412129,   10147037,
+            -17846721,   29825384,  -47940201,   75136907, -117022516,  187164875, -331684725,  874952744,
+           1774107287, -425296525,  222821099, -136291467,   87151127,  -55865287,   35111006,  -21315583,
+             12345874,   -6738235,    3416189,   -1578882,     647195,    -224838,      60539 },
+    .d = {      0,     -1,      4,    -10,     25,    -53,    103,   -188,    323,   -530,
+              841,  -1308,   2042,  -3341,   6366, -22423,  16156,   3339,  -2215,   1438,
+             -931,    593,   -365,    215,   -120,     62,    -29,     12,     -4,      1,      0 } },
+  { .h = {      -4119,      35390,    -148975,     461016,   -1181705,    2652815,   -5385669,   10098829,
+            -17763918,   29689619,  -47725014,   74802143, -116499648,  186309501, -330055149,  869212410,
+           1778243301, -424441734,  222254049, -135923453,   86912693,  -55713583,   35017568,  -21260560,
+             12315280,   -6722405,    3408710,   -1575746,     646085,    -224539,      60498 },
+    .d = {      0,     -1,      4,    -10,     25,    -53,    104,   -189,    325,   -534,
+              846,  -1317,   2056,  -3363,   6398, -22419,  16083,   3413,  -2253,   1460,
+             -946,    602,   -371,    219,   -122,     63,    -30,     13,     -4,      1,      0 } },
+  { .h = {      -4080,      35146,    -148068,     458418,   -1175402,    2639253,   -5359065,   10050337,
+            -17680598,   29552965,  -47508375,   74465086, -115973234,  185448679, -328417284,  863473054,
+           1782360494, -423567978,  221677294, -135549567,   86670509,  -55559464,   34922598,  -21204597,
+             12284136,   -6706270,    3401073,   -1572536,     644943,    -224229,      60453 },
+    .d = {      0,     -1,      4,    -10,     25,    -53,    104,   -191,    327,   -537,
+              852,  -1326,   2070,  -3384,   6430, -22415,  16009,   3487,  -2291,   1483,
+             -961,    611,   -377,    222,   -124,     64,    -30,     13,     -5,      1,      0 } },
+  { .h = {      -4041,      34901,    -147160,     455811,   -1169072,    2625625,   -5332318,   10001563,
+            -17596764,   29415431,  -47290294,   74125752, -115443301,  184582451, -326771210,  857734794,
+           1786458774, -422675227,  221090836, -135169812,   86424576,  -55402932,   34826100,  -21147696,
+             12252441,   -6689829,    3393279,   -1569252,     643770,    -223908,      60405 },
+    .d = {      0,     -1,      4,    -10,     25,    -53,    105,   -192,    329,   -541,
+              857,  -1334,   2084,  -3405,   6462, -22410,  15935,   3562,  -2329,   1506,
+             -975,    621,   -383,    226,   -126,     65,    -31,     13,     -5,      1,      0 } },
+  { .h = {      -4003,      34657,    -146249,     453196,   -1162715,    2611932,   -5305428,    9952511,
+            -17512421,   29277023,  -47070783,   73784157, -114909876,  183710863, -325117008,  851997746,
+           1790538046, -421763451,  220494677, -134784193,   86174899,  -55243989,   34728073,  -21089857,
+             12220195,   -6673082,    3385327,   -1565893,     642565,    -223576,      60354 },
+    .d = {      0,     -1,      4,    -10,     25,    -54,    106,   -193,    331,   -544,
+              863,  -1343,   2097,  -3425,   6493, -22405,  15860,   3636,  -2367,   1529,
+             -990,    630,   -389,    230,   -128,     67,    -32,     13,     -5,      1,      0 } },
+  { .h = {      -3964,      34413,    -145337,     450571,   -1156333,    2598174,   -5278399,    9903182,
+            -17427574,   29137748,  -46849852,   73440320, -114372984,  182833955, -323454758,  846262028,
+           1794598218, -420832622,  219888817, -134392713,   85921481,  -55082635,   34628518,  -21031080,
+             12187397,   -6656030,    3377217,   -1562459,     641329,    -223232,      60300 },
+    .d = {      0,     -1,      4,    -10,     25,    -54,    106,   -194,    333,   -547,
+              869,  -1352,   2111,  -3446,   6524, -22399,  15785,   3711,  -2405,   1552,
+            -1005,    640,   -395,    233,   -130,     68,    -32,     14,     -5,      1,      0 } },
+  { .h = {      -3926,      34168,    -144422,     447939,   -1149925,    2584352,   -5251231,    9853580,
+            -17342227,   28997614,  -46627513,   73094258, -113832652,  181951773, -321784541,  840527758,
+           1798639198, -419882709,  219273259, -133995378,   85664324,  -54918874,   34527438,  -20971364,
+             12154049,   -6638672,    3368948,   -1558950,     640061,    -222877,      60243 },
+    .d = {      0,     -1,      4,    -10,     25,    -54,    107,   -195,    335,   -551,
+              874,  -1360,   2124,  -3466,   6555, -22393,  15710,   3785,  -2442,   1575,
+            -1019,    649,   -401,    237,   -132,     69,    -33,     14,     -5,      1,      0 } },
+  { .h = {      -3888,      33923,    -143505,     445297,   -1143491,    2570467,   -5223925,    9803707,
+            -17256385,   28856627,  -46403777,   72745986, -113288908,  181064358, -320106438,  834795053,
+           1802660893, -418913683,  218648005, -133592191,   85403432,  -54752708,   34424831,  -20910712,
+             12120150,   -6621008,    3360522,   -1555367,     638762,    -222510,      60183 },
+    .d = {      0,     -1,      4,    -10,     25,    -54,    107,   -196,    337,   -554,
+              879,  -1369,   2137,  -3487,   6586, -22387,  15634,   3860,  -2480,   1598,
+            -1034,    658,   -407,    241,   -135,     70,    -34,     14,     -5,      1,      0 } },
+  { .h = {      -3850,      33679,    -142587,     442648,   -1137032,    2556520,   -5196484,    9753565,
+            -17170051,   28714794,  -46178655,   72395523, -112741776,  180171755, -318420530,  829064029,
+           1806663212, -417925518,  218013059, -133183158,   85138809,  -54584139,   34320701,  -20849123,
+             12085701,   -6603038,    3351937,   -1551708,     637431,    -222133,      60119 },
+    .d = {      0,     -1,      4,    -10,     25,    -55,    108,   -197,    339,   -557,
+              885,  -1377,   2150,  -3507,   6616, -22380,  15558,   3935,  -2518,   1621,
+            -1048,    668,   -413,    244,   -137,     71,    -34,     15,     -5,      2,      0 } },
+  { .h = {      -3812,      33434,    -141666,     439990,   -1130549,    2542511,   -5168909,    9703157,
+            -17083230,   28572124,  -45952158,   72042886, -112191286,  179274007, -316726897,  823334805,
+           1810646063, -416918185,  217368423, -132768284,   84870458,  -54413168,   34215047,  -20786598,
+             12050700,   -6584762,    3343194,   -1547975,     636069,    -221743,      60052 },
+    .d = {      0,     -1,      4,    -10,     25,    -55,    108,   -198,    341,   -561,
+              890,  -1386,   2163,  -3527,   6646, -22372,  15482,   4010,  -2556,   1643,
+            -1063,    677,   -419,    248,   -139,     73,    -35,     15,     -5,      2,      0 } },
+  { .h = {      -3774,      33189,    -140744,     437324,   -1124041,    2528442,   -5141200,    9652486,
+            -16995927,   28428622,  -45724298,   71688092, -111637462,  178371159, -315025621,  817607496,
+           1814609356, -415891658,  216714101, -132347573,   84598384,  -54239799,   34107872,  -20723137,
+             12015150,   -6566181,    3334293,   -1544166,     634675,    -221343,      59982 },
+    .d = {      0,     -1,      4,    -10,     26,    -55,    109,   -199,    343,   -564,
+              895,  -1394,   2176,  -3547,   6675, -22364,  15405,   4085,  -2594,   1666,
+            -1077,    687,   -425,    252,   -141,     74,    -35,     15,     -6,      2,      0 } },
+  { .h = {      -3736,      32943,    -139820,     434651,   -1117509,    2514313,   -5113360,    9601554,
+            -16908146,   28284297,  -45495085,   71331158, -111080332,  177463253, -313316783,  811882219,
+           1818553000, -414845909,  216050096, -131921032,   84322590,  -54064033,   33999176,  -20658741,
+             11979049,   -6547293,    3325233,   -1540283,     633248,    -220930,      59908 },
+    .d = {      0,     -1,      4,    -10,     26,    -55,    109,   -200,    345,   -567,
+              901,  -1403,   2189,  -3566,   6704, -22356,  15328,   4160,  -2632,   1689,
+            -1092,    696,   -431,    255,   -143,     75,    -36,     15,     -6,      2,      0 } },
+  { .h = {      -3699,      32698,    -138894,     431970,   -1110954,    2500124,   -5085390,    9550365,
+            -16819891,   28139154,  -45264532,   70972102, -110519924,  176550333, -311600463,  806159090,
+           1822476905, -413780912,  215376414, -131488665,   84043081,  -53885875,   33888962,  -20593411,
+             11942398,   -6528100,    3316014,   -1536324,     631790,    -220506,      59831 },
+    .d = {      0,     -1,      4,    -11,     26,    -56,    110,   -201,    347,   -570,
+              906,  -1411,   2202,  -3586,   6733, -22347,  15250,   4235,  -2669,   1712,
+            -1106,    705,   -436,    259,   -145,     76,    -37,     16,     -6,      2,      0 } },
+  { .h = {      -3661,      32453,    -137966,     429281,   -1104376,    2485877,   -5057291,    9498920,
+            -16731167,   27993203,  -45032648,   70610941, -109956263,  175632445, -309876743,  800438226,
+           1826380981, -412696641,  214693057, -131050480,   83759861,  -53705325,   33777229,  -20527147,
+             11905198,   -6508600,    3306636,   -1532289,     630301,    -220071,      59751 },
+    .d = {      0,     -1,      4,    -11,     26,    -56,    110,   -202,    348,   -573,
+              911,  -1419,   2214,  -3605,   6762, -22338,  15172,   4311,  -2707,   1734,
+            -1121,    715,   -442,    262,   -147,     77,    -37,     16,     -6,      2,      0 } },
+  { .h = {      -3624,      32208,    -137037,     426585,   -1097774,    2471572,   -5029065,    9447222,
+            -16641979,   27846449,  -44799446,   70247693, -109389378,  174709631, -308145704,  794719743,
+           1830265140, -411593072,  214000033, -130606482,   83472934,  -53522387,   33663981,  -20459950,
+             11867447,   -6488795,    3297100,   -1528179,     628779,    -219624,      59668 },
+    .d = {      0,     -1,      4,    -11,     26,    -56,    111,   -203,    350,   -576,
+              916,  -1427,   2227,  -3624,   6790, -22328,  15094,   4386,  -2745,   1757,
+            -1135,    724,   -448,    266,   -150,     79,    -38,     16,     -6,      2,      0 } },
+  { .h = {      -3587,      31963,    -136107,     423882,   -1091150,    2457209,   -5000714,    9395274,
+            -16552330,   27698900,  -44564937,   69882376, -108819295,  173781936, -306407428,  789003756,
+           1834129292, -410470179,  213297345, -130156678,   83182306,  -53337064,   33549219,  -20391820,
+             11829148,   -6468683,    3287405,   -1523994,     627225,    -219165,      59581 },
+    .d = {      0,     -1,      4,    -11,     26,    -56,    111,   -204,    352,   -579,
+              921,  -1435,   2239,  -3643,   6818, -22318,  15016,   4462,  -2783,   1780,
+            -1150,    733,   -454,    270,   -152,     80,    -38,     17,     -6,      2,      0 } },
+  { .h = {      -3550,      31717,    -135175,     421171,   -1084504,    2442791,   -4972238,    9343078,
+            -16462226,   27550563,  -44329133,   69515006, -108246043,  172849404, -304661994,  783290382,
+           1837973349, -409327939,  212584999, -129701074,   82887980,  -53149359,   33432943,  -20322760,
+             11790300,   -6448266,    3277551,   -1519733,     625639,    -218695,      59491 },
+    .d = {      0,     -1,      4,    -11,     26,    -57,    112,   -205,    354,   -582,
+              926,  -1443,   2252,  -3661,   6846, -22307,  14937,   4538,  -2820,   1802,
+            -1164,    743,   -460,    273,   -154,     81,    -39,     17,     -6,      2,      0 } },
+  { .h = {      -3513,      31472,    -134241,     418454,   -1077836,    2428317,   -4943640,    9290638,
+            -16371671,   27401446,  -44092044,   69145602, -107669647,  171912081, -302909486,  777579736,
+           1841797224, -408166327,  211863002, -129239677,   82589962,  -52959275,   33315157,  -20252768,
+             11750903,   -6427543,    3267538,   -1515396,     624020,    -218213,      59397 },
+    .d = {      0,     -1,      4,    -11,     26,    -57,    112,   -206,    355,   -586,
+              931,  -1451,   2264,  -3680,   6873, -22296,  14858,   4613,  -2858,   1825,
+            -1179,    752,   -466,    277,   -156,     82,    -40,     17,     -6,      2,      0 } },
+  { .h = {      -3476,      31227,    -133306,     415729,   -1071147,    2413789,   -4914920,    9237955,
+            -16280669,   27251556,  -43853683,   68774181, -107090137,  170970009, -301149983,  771871933,
+           1845600829, -406985320,  211131359, -128772495,   82288257,  -52766815,   33195861,  -20181847,
+             11710958,   -6406514,    3257367,   -1510984,     622370,    -217719,      59300 },
+    .d = {      0,     -1,      4,    -11,     26,    -57,    113,   -207,    357,   -589,
+              936,  -1459,   2276,  -3698,   6900, -22285,  14778,   4689,  -2896,   1848,
+            -1193,    761,   -472,    281,   -158,     83,    -40,     18,     -7,      2,      0 } },
+  { .h = {      -3439,      30981,    -132370,     412999,   -1064436,    2399206,   -4886081,    9185033,
+            -16189225,   27100900,  -43614061,   68400761, -106507538,  170023235, -299383568,  766167088,
+           1849384077, -405784895,  210390078, -128299534,   81982870,  -52571982,   33075058,  -20109997,
+             11670464,   -6385180,    3247036,   -1506496,     620687,    -217214,      59200 },
+    .d = {      0,     -1,      4,    -11,     26,    -57,    113,   -208,    359,   -591,
+              941,  -1466,   2288,  -3717,   6927, -22273,  14698,   4765,  -2933,   1870,
+            -1207,    770,   -478,    284,   -160,     85,    -41,     18,     -7,      2,      0 } },
+  { .h = {      -3403,      30736,    -131432,     410261,   -1057704,    2384570,   -4857123,    9131874,
+            -16097343,   26949485,  -43373189,   68025361, -105921879,  169071802, -297610321,  760465317,
+           1853146881, -404565031,  209639165, -127820803,   81673807,  -52374780,   32952749,  -20037219,
+             11629424,   -6363540,    3236546,   -1501932,     618973,    -216696,      59096 },
+    .d = {      0,     -1,      4,    -11,     26,    -57,    114,   -209,    361,   -594,
+              946,  -1474,   2300,  -3735,   6953, -22260,  14618,   4841,  -2971,   1893,
+            -1222,    780,   -484,    288,   -162,     86,    -42,     18,     -7,      2,      0 } },
+  { .h = {      -3367,      30491,    -130493,     407517,   -1050953,    2369882,   -4828048,    9078481,
+            -16005028,   26797320,  -43131079,   67647996, -105333188,  168115755, -295830325,  754766734,
+           1856889155, -403325704,  208878628, -127336309,   81361072,  -52175212,   32828936,  -19963514,
+             11587836,   -6341595,    3225898,   -1497293,     617225,    -216167,      58989 },
+    .d = {      0,     -1,      4,    -11,     26,    -58,    114,   -209,    362,   -597,
+              951,  -1482,   2311,  -3752,   6979, -22247,  14538,   4917,  -3008,   1915,
+            -1236,    789,   -490,    292,   -165,     87,    -42,     18,     -7,      2,      0 } },
+  { .h = {      -3330,      30246,    -129553,     404767,   -1044181,    2355141,   -4798858,    9024856,
+            -15912284,   26644410,  -42887743,   67268687, -104741492,  167155140, -294043660,  749071454,
+           1860610814, -402066894,  208108475, -126846060,   81044673,  -51973282,   32703622,  -19888883,
+             11545701,   -6319344,    3215090,   -1492577,     615446,    -215626,      58878 },
+    .d = {      0,     -1,      4,    -11,     27,    -58,    114,   -210,    364,   -600,
+              955,  -1489,   2323,  -3770,   7005, -22234,  14457,   4993,  -3046,   1937,
+            -1250,    798,   -495,    295,   -167,     88,    -43,     19,     -7,      2,      0 } },
+  { .h = {      -3294,      30001,    -128611,     402011,   -1037389,    2340350,   -4769554,    8971002,
+            -15819117,   26490765,  -42643191,   66887450, -104146819,  166190000, -292250408,  743379590,
+           1864311772, -400788581,  207328714, -126350064,   80724614,  -51768993,   32576809,  -19813328,
+             11503020,   -6296789,    3204123,   -1487786,     613634,    -215073,      58764 },
+    .d = {      0,     -1,      4,    -11,     27,    -58,    115,   -211,    366,   -603,
+              960,  -1497,   2334,  -3788,   7030, -22220,  14376,   5070,  -3083,   1960,
+            -1265,    807,   -501,    299,   -169,     89,    -43,     19,     -7,      2,      0 } },
+  { .h = {      -3258,      29756,    -127669,     399249,   -1030578,    2325509,   -4740138,    8916922,
+            -15725529,   26336390,  -42397437,   66504303, -103549197,  165220382, -290450651,  737691259,
+           1867991946, -399490743,  206539354, -125848331,   80400902,  -51562349,   32448498,  -19736848,
+             11459794,   -6273928,    3192998,   -1482918,     611789,    -214509,      58647 },
+    .d = {      0,     -1,      4,    -11,     27,    -58,    115,   -212,    367,   -606,
+              965,  -1504,   2346,  -3805,   7055, -22206,  14294,   5146,  -3121,   1982,
+            -1279,    816,   -507,    302,   -171,     90,    -44,     19,     -7,      2,      0 } },
+  { .h = {      -3223,      29511,    -126725,     396482,   -1023748,    2310618,   -4710611,    8862619,
+            -15631527,   26181294,  -42150491,   66119265, -102948654,  164246330, -288644470,  732006572,
+           1871651249, -398173360,  205740402, -125340868,   80073543,  -51353354,   32318692,  -19659446,
+             11416022,   -6250763,    3181713,   -1477975,     609912,    -213932,      58526 },
+    .d = {      0,     -1,      4,    -11,     27,    -58,    116,   -213,    369,   -609,
+              969,  -1511,   2357,  -3822,   7080, -22191,  14212,   5222,  -3158,   2005,
+            -1293,    826,   -513,    306,   -173,     92,    -45,     20,     -7,      2,      0 } },
+  { .h = {      -3187,      29267,    -125781,     393708,   -1016899,    2295678,   -4680974,    8808094,
+            -15537115,   26025483,  -41902365,   65732354, -102345218,  163267889, -286831947,  726325645,
+           1875289599, -396836415,  204931870, -124827684,   79742542,  -51142012,   32187393,  -19581122,
+             11371705,   -6227292,    3170269,   -1472955,     608003,    -213343,      58401 },
+    .d = {      0,     -1,      4,    -11,     27,    -59,    116,   -214,    370,   -611,
+              974,  -1519,   2368,  -3839,   7105, -22176,  14130,   5299,  -3196,   2027,
+            -1307,    835,   -519,    310,   -175,     93,    -45,     20,     -8,      2,      0 } },
+  { .h = {      -3152,      29022,    -124835,     390929,   -1010032,    2280690,   -4651229,    8753351,
+            -15442296,   25868967,  -41653071,   65343587, -101738916,  162285105, -285013163,  720648590,
+           1878906912, -395479886,  204113765, -124308790,   79407907,  -50928327,   32054604,  -19501879,
+             11326844,   -6203518,    3158666,   -1467859,     606061,    -212743,      58273 },
+    .d = {      0,     -1,      4,    -11,     27,    -59,    117,   -215,    372,   -614,
+              978,  -1526,   2379,  -3856,   7129, -22160,  14048,   5376,  -3233,   2049,
+            -1321,    844,   -525,    313,   -177,     94,    -46,     20,     -8,      2,     -1 } },
+  { .h = {      -3116,      28778,    -123889,     388145,   -1003147,    2265655,   -4621377,    8698393,
+            -15347077,   25711750,  -41402621,   64952983, -101129777,  161298022, -283188199,  714975522,
+           1882503105, -394103757,  203286099, -123784194,   79069644,  -50712303,   31920326,  -19421716,
+             11281440,   -6179439,    3146905,   -1462688,     604086,    -212130,      58142 },
+    .d = {      0,     -1,      4,    -11,     27,    -59,    117,   -216,    374,   -617,
+              983,  -1533,   2390,  -3872,   7153, -22144,  13965,   5452,  -3270,   2071,
+            -1335,    853,   -530,    317,   -179,     95,    -47,     20,     -8,      2,     -1 } },
+  { .h = {      -3081,      28534,    -122942,     385355,    -996244,    2250574,   -4591421,    8643221,
+            -15251461,   25553842,  -41151026,   64560560, -100517830,  160306688, -281357138,  709306553,
+           1886078096, -392708009,  202448882, -123253905,   78727760,  -50493945,   31784563,  -19340636,
+             11235492,   -6155056,    3134984,   -1457440,     602079,    -211505,      58007 },
+    .d = {      0,     -1,      4,    -11,     27,    -59,    117,   -216,    375,   -620,
+              987,  -1540,   2401,  -3889,   7176, -22128,  13882,   5529,  -3308,   2094,
+            -1350,    862,   -536,    320,   -182,     96,    -47,     21,     -8,      2,     -1 } },
+  { .h = {      -3046,      28289,    -121993,     382561,    -989324,    2235447,   -4561361,    8587840,
+            -15155452,   25395250,  -40898298,   64166336,  -99903102,  159311145, -279520061,  703641796,
+           1889631802, -391292625,  201602123, -122717935,   78382262,  -50273256,   31647317,  -19258639,
+             11189003,   -6130369,    3122905,   -1452116,     600039,    -210869,      57868 },
+    .d = {      0,     -1,      4,    -11,     27,    -59,    118,   -217,    377,   -622,
+              992,  -1547,   2412,  -3905,   7199, -22111,  13798,   5606,  -3345,   2116,
+            -1364,    871,   -542,    324,   -184,     98,    -48,     21,     -8,      3,     -1 } },
+  { .h = {      -3011,      28046,    -121045,     379761,    -982387,    2220275,   -4531198,    8532251,
+            -15059057,   25235981,  -40644449,   63770330,  -99285621,  158311442, -277677049,  697981364,
+           1893164143, -389857588,  200745836, -122176292,   78033157,  -50050242,   31508590,  -19175727,
+             11141971,   -6105379,    3110667,   -1446715,     597966,    -210220,      57726 },
+    .d = {      0,     -1,      4,    -11,     27,    -59,    118,   -218,    378,   -625,
+              996,  -1554,   2423,  -3921,   7222, -22094,  13714,   5682,  -3382,   2138,
+            -1378,    880,   -548,    327,   -186,     99,    -48,     21,     -8,      3,     -1 } },
+  { .h = {      -2977,      27802,    -120095,     376957,    -975433,    2205059,   -4500935,    8476457,
+            -14962278,   25076043,  -40389491,   63372559,  -98665417,  157307622, -275828184,  692325369,
+           1896675037, -388402882,  199880029, -121628988,   77680451,  -49824906,   31368385,  -19091902,
+             11094398,   -6080085,    3098270,   -1441239,     595860,    -209559,      57581 },
+    .d = {      0,     -1,      4,    -11,     27,    -60,    119,   -219,    380,   -627,
+             1000,  -1561,   2433,  -3937,   7245, -22076,  13630,   5759,  -3419,   2160,
+            -1392,    889,   -553,    331,   -188,    100,    -49,     22,     -8,      3,     -1 } },
+  { .h = {      -2942,      27558,    -119145,     374148,    -968463,    2189799,   -4470573,    8420461,
+            -14865121,   24915443,  -40133436,   62973043,  -98042517,  156299732, -273973548,  686673924,
+           1900164403, -386928491,  199004717, -121076032,   77324153,  -49597254,   31226705,  -19007164,
+             11046285,   -6054488,    3085714,   -1435686,     593722,    -208886,      57431 },
+    .d = {      0,     -1,      4,    -11,     27,    -60,    119,   -220,    381,   -630,
+             1004,  -1567,   2444,  -3953,   7267, -22058,  13546,   5836,  -3456,   2182,
+            -1406,    898,   -559,    335,   -190,    101,    -50,     22,     -8,      3,     -1 } },
+  { .h = {      -2908,      27315,    -118194,     371334,    -961478,    2174496,   -4440114,    8364265,
+            -14767590,   24754189,  -39876295,   62571799,  -97416949,  155287817, -272113222,  681027140,
+           1903632161, -385434400,  198119910, -120517437,   76964270,  -49367290,   31083553,  -18921516,
+             10997632,   -6028588,    3073000,   -1430057,     591551,    -208201,      57278 },
+    .d = {      0,     -1,      4,    -11,     27,    -60,    119,   -220,    382,   -632,
+             1009,  -1574,   2454,  -3968,   7289, -22039,  13461,   5913,  -3493,   2204,
+            -1420,    907,   -565,    338,   -192,    102,    -50,     22,     -9,      3,     -1 } },
+  { .h = {      -2874,      27072,    -117242,     368516,    -954476,    2159152,   -4409557,    8307873,
+            -14669690,   24592288,  -39618081,   62168846,  -96788743,  154271923, -270247287,  675385130,
+           1907078233, -383920593,  197225622, -119953212,   76600809,  -49135018,   30938931,  -18834959,
+             10948440,   -6002386,    3060128,   -1424352,     589347,    -207504,      57122 },
+    .d = {      0,     -1,      4,    -11,     27,    -60,    120,   -221,    384,   -635,
+             1013,  -1581,   2464,  -3984,   7310, -22020,  13376,   5990,  -3530,   2226,
+            -1434,    916,   -571,    342,   -194,    104,    -51,     23,     -9,      3,     -1 } },
+  { .h = {      -2840,      26829,    -116290,     365694,    -947460,    2143766,   -4378907,    8251287,
+            -14571426,   24429748,  -39358805,   61764202,  -96157927,  153252097, -268375826,  669748005,
+           1910502538, -382387056,  196321865, -119383368,   76233778,  -48900445,   30792842,  -18747494,
+             10898709,   -5975882,    3047096,   -1418570,     587110,    -206794,      56962 },
+    .d = {      0,     -1,      4,    -11,     27,    -60,    120,   -222,    385,   -637,
+             1017,  -1587,   2474,  -3999,   7332, -22001,  13291,   6067,  -3567,   2248,
+            -1448,    925,   -576,    345,   -196,    105,    -52,     23,     -9,      3,     -1 } },
+  { .h = {      -2806,      26586,    -115337,     362868,    -940429,    2128340,   -4348163,    8194509,
+            -14472802,   24266577,  -39098479,   61357887,  -95524530,  152228383, -266498919,  664115876,
+           1913904997, -380833776,  195408652, -118807919,   75863185,  -48663574,   30645290,  -18659124,
+             10848442,   -5949075,    3033907,   -1412712,     584840,    -206072,      56798 },
+    .d = {      0,     -1,      4,    -11,     28,    -60,    120,   -223,    387,   -640,
+             1021,  -1594,   2484,  -4014,   7353, -21981,  13205,   6145,  -3604,   2270,
+            -1462,    934,   -582,    349,   -198,    106,    -52,     23,     -9,      3,     -1 } },
+  { .h = {      -2772,      26344,    -114384,     360037,    -933383,    2112874,   -4317327,    8137542,
+            -14373823,   24102782,  -38837116,   60949917,  -94888579,  151200828, -264616649,  658488855,
+           1917285534, -379260740,  194485998, -118226875,   75489039,  -48424412,   30496277,  -18569849,
+             10797637,   -5921967,    3020559,   -1406778,     582538,    -205338,      56631 },
+    .d = {      0,     -1,      4,    -11,     28,    -61,    121,   -223,    388,   -642,
+             1025,  -1600,   2494,  -4029,   7373, -21960,  13119,   6222,  -3641,   2292,
+            -1475,    943,   -588,    352,   -201,    107,    -53,     23,     -9,      3,     -1 } },
+  { .h = {      -2739,      26102,    -113431,     357203,    -926323,    2097369,   -4286401,    8080390,
+            -14274493,   23938370,  -38574727,   60540312,  -94250104,  150169478, -262729096,  652867053,
+           1920644069, -377667934,  193553915, -117640248,   75111347,  -48182962,   30345806,  -18479671,
+             10746297,   -5894558,    3007053,   -1400768,     580202,    -204592,      56460 },
+    .d = {      0,     -1,      4,    -11,     28,    -61,    121,   -224,    389,   -645,
+             1029,  -1606,   2504,  -4043,   7394, -21939,  13033,   6299,  -3678,   2313,
+            -1489,    952,   -593,    356,   -203,    108,    -53,     24,     -9,      3,     -1 } },
+  { .h = {      -2705,      25860,    -112477,     354365,    -919249,    2081826,   -4255386,    8023054,
+            -14174818,   23773349,  -38311324,   60129091,  -93609134,  149134379, -260836343,  647250579,
+           1923980526, -376055346,  192612420, -117048050,   74730119,  -47939232,   30193881,  -18388592,
+             10694422,   -5866848,    2993389,   -1394682,     577834,    -203834,      56285 },
+    .d = {      0,     -1,      4,    -11,     28,    -61,    121,   -225,    391,   -647,
+             1033,  -1613,   2513,  -4058,   7414, -21918,  12946,   6376,  -3714,   2335,
+            -1503,    961,   -599,    359,   -205,    109,    -54,     24,     -9,      3,     -1 } },
+  { .h = {      -2672,      25619,    -111523,     351524,    -912161,    2066245,   -4224283,    7965537,
+            -14074801,   23607727,  -38046919,   59716272,  -92965698,  148095577, -258938471,  641639544,
+           1927294828, -374422964,  191661525, -116450294,   74345361,  -47693225,   30040504,  -18296615,
+             10642012,   -5838838,    2979567,   -1388519,     575432,    -203063,      56107 },
+    .d = {      0,     -1,      4,    -11,     28,    -61,    122,   -225,    392,   -649,
+             1037,  -1619,   2523,  -4072,   7433, -21896,  12860,   6454,  -3751,   2357,
+            -1517,    970,   -605,    363,   -207,    111,    -55,     24,    -10,      3,     -1 } },
+  { .h = {      -2639,      25378,    -110569,     348679,    -905061,    2050628,   -4193095,    7907843,
+            -13974447,   23441512,  -37781525,   59301873,  -92319823,  147053118, -257035560,  636034059,
+           1930586899, -372770778,  190701247, -115846993,   73957084,  -47444948,   29885680,  -18203740,
+             10589070,   -5810527,    2965587,   -1382280,     572998,    -202280,      55925 },
+    .d = {      0,     -1,      4,    -11,     28,    -61,    122,   -226,    393,   -652,
+             1041,  -1625,   2532,  -4086,   7453, -21874,  12773,   6531,  -3788,   2378,
+            -1530,    979,   -610,    366,   -209,    112,    -55,     25,    -10,      3,     -1 } },
+  { .h = {      -2606,      25137,    -109614,     345831,    -897947,    2034974,   -4161822,    7849974,
+            -13873762,   23274711,  -37515153,   58885914,  -91671540,  146007049, -255127694,  630434233,
+           1933856663, -371098777,  189731601, -115238159,   73565296,  -47194406,   29729411,  -18109970,
+             10535595,   -5781917,    2951450,   -1375965,     570530,    -201484,      55739 },
+    .d = {      0,     -1,      4,    -11,     28,    -61,    122,   -227,    395,   -654,
+             1044,  -1631,   2542,  -4100,   7472, -21852,  12685,   6609,  -3824,   2400,
+            -1544,    988,   -616,    370,   -211,    113,    -56,     25,    -10,      3,     -1 } },
+  { .h = {      -2574,      24896,    -108660,     342980,    -890822,    2019286,   -4130467,    7791932,
+            -13772749,   23107331,  -37247816,   58468413,  -91020876,  144957415, -253214952,  624840175,
+           1937104044, -369406949,  188752602, -114623806,   73170006,  -46941605,   29571701,  -18015305,
+             10481588,   -5753007,    2937155,   -1369574,     568030,    -200676,      55550 },
+    .d = {      0,     -1,      4,    -11,     28,    -61,    123,   -227,    396,   -656,
+             1048,  -1637,   2551,  -4114,   7490, -21829,  12597,   6686,  -3861,   2421,
+            -1558,    996,   -622,    373,   -213,    114,    -56,     25,    -10,      3,     -1 } },
+  { .h = {      -2541,      24656,    -107705,     340126,    -883684,    2003563,   -4099030,    7733720,
+            -13671413,   22939381,  -36979525,   58049388,  -90367862,  143904264, -251297417,  619251996,
+           1940328969, -367695287,  187764267, -114003947,   72771223,  -46686550,   29412553,  -17919750,
+             10427051,   -5723799,    2922702,   -1363106,     565496,    -199856,      55356 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    123,   -228,    397,   -658,
+             1052,  -1643,   2560,  -4127,   7509, -21805,  12509,   6764,  -3897,   2443,
+            -1571,   1005,   -627,    377,   -215,    115,    -57,     26,    -10,      3,     -1 } },
+  { .h = {      -2509,      24416,    -106750,     337269,    -876534,    1987806,   -4067512,    7675341,
+            -13569760,   22770867,  -36710293,   57628859,  -89712525,  142847641, -249375170,  613669804,
+           1943531362, -365963779,  186766613, -113378595,   72368957,  -46429248,   29251971,  -17823304,
+             10371985,   -5694292,    2908093,   -1356563,     562930,    -199024,      55160 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    123,   -229,    398,   -660,
+             1055,  -1648,   2569,  -4141,   7527, -21782,  12421,   6841,  -3933,   2464,
+            -1585,   1014,   -633,    380,   -217,    116,    -58,     26,    -10,      3,     -1 } },
+  { .h = {      -2477,      24177,    -105795,     334409,    -869373,    1972016,   -4035917,    7616798,
+            -13467793,   22601798,  -36440131,   57206844,  -89054896,  141787593, -247448291,  608093708,
+           1946711150, -364212419,  185759656, -112747765,   71963216,  -46169705,   29089958,  -17725971,
+             10316390,   -5664487,    2893326,   -1349943,     560330,    -198179,      54959 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    124,   -229,    400,   -663,
+             1059,  -1654,   2578,  -4154,   7545, -21757,  12332,   6919,  -3970,   2486,
+            -1598,   1023,   -638,    384,   -219,    118,    -58,     26,    -10,      3,     -1 } },
+  { .h = {      -2445,      23937,    -104840,     331547,    -862201,    1956194,   -4004244,    7558093,
+            -13365517,   22432182,  -36169052,   56783363,  -88395002,  140724166, -245516863,  602523817,
+           1949868260, -362441196,  184743414, -112111470,   71554011,  -45907926,   28926518,  -17627752,
+             10260268,   -5634384,    2878403,   -1343247,     557698,    -197321,      54755 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    124,   -230,    401,   -665,
+             1062,  -1660,   2586,  -4167,   7562, -21733,  12244,   6996,  -4006,   2507,
+            -1612,   1031,   -644,    387,   -221,    119,    -59,     26,    -10,      3,     -1 } },
+  { .h = {      -2413,      23699,    -103885,     328682,    -855018,    1940340,   -3972496,    7499229,
+            -13262938,   22262025,  -35897069,   56358433,  -87732874,  139657407, -243580966,  596960238,
+           1953002619, -360650105,  183717904, -111469724,   71141351,  -45643919,   28761655,  -17528649,
+             10203620,   -5603985,    2863322,   -1336475,     555032,    -196452,      54546 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    124,   -231,    402,   -667,
+             1066,  -1665,   2595,  -4180,   7579, -21708,  12154,   7074,  -4042,   2528,
+            -1625,   1040,   -650,    391,   -223,    120,    -60,     27,    -11,      3,     -1 } },
+  { .h = {      -2381,      23460,    -102930,     325815,    -847824,    1924456,   -3940674,    7440209,
+            -13160059,   22091336,  -35624192,   55932073,  -87068540,  138587362, -241640682,  591403080,
+           1956114154, -358839138,  182683145, -110822543,   70725246,  -45377688,   28595372,  -17428665,
+             10146446,   -5573289,    2848085,   -1329628,     552333,    -195569,      54335 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    125,   -231,    403,   -669,
+             1069,  -1671,   2604,  -4193,   7596, -21682,  12065,   7152,  -4078,   2549,
+            -1639,   1049,   -655,    394,   -225,    121,    -60,     27,    -11,      3,     -1 } },
+  { .h = {      -2350,      23222,    -101975,     322946,    -840621,    1908541,   -3908779,    7381035,
+            -13056885,   21920123,  -35350435,   55504304,  -86402029,  137514078, -239696091,  585852451,
+           1959202795, -357008289,  181639155, -110169941,   70305706,  -45109241,   28427674,  -17327802,
+             10088748,   -5542296,    2832692,   -1322704,     549601,    -194675,      54119 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    125,   -232,    404,   -671,
+             1073,  -1676,   2612,  -4205,   7613, -21656,  11975,   7229,  -4114,   2570,
+            -1652,   1057,   -661,    397,   -227,    122,    -61,     27,    -11,      4,     -1 } },
+  { .h = {      -2319,      22985,    -101021,     320075,    -833407,    1892597,   -3876813,    7321711,
+            -12953421,   21748392,  -35075809,   55075142,  -85733371,  136437602, -237747275,  580308458,
+           1962268470, -355157550,  180585952, -109511933,   69882742,  -44838584,   28258564,  -17226061,
+             10030528,   -5511008,    2817142,   -1315705,     546836,    -193767,      53899 },
+    .d = {      0,     -1,      4,    -11,     28,    -62,    125,   -232,    405,   -673,
+             1076,  -1682,   2620,  -4217,   7629, -21630,  11885,   7307,  -4150,   2591,
+            -1666,   1066,   -666,    401,   -229,    123,    -61,     28,    -11,      4,     -1 } },
+  { .h = {      -2288,      22748,    -100067,     317201,    -826185,    1876625,   -3844777,    7262238,
+            -12849673,   21576152,  -34800327,   54644608,  -85062595,  135357979, -235794316,  574771207,
+           1965311107, -353286917,  179523556, -108848533,   69456363,  -44565724,   28088046,  -17123446,
+              9971785,   -5479426,    2801437,   -1308629,     544038,    -192848,      53676 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    125,   -233,    406,   -675,
+             1079,  -1687,   2628,  -4229,   7645, -21603,  11795,   7385,  -4186,   2612,
+            -1679,   1074,   -672,    404,   -231,    125,    -62,     28,    -11,      4,     -1 } },
+  { .h = {      -2257,      22511,     -99113,     314326,    -818953,    1860625,   -3812673,    7202620,
+            -12745643,   21403410,  -34524001,   54212720,  -84389731,  134275257, -233837292,  569240807,
+           1968330638, -351396386,  178451987, -108179758,   69026581,  -44290668,   27916125,  -17019957,
+              9912521,   -5447548,    2785576,   -1301478,     541207,    -191915,      53449 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    126,   -233,    407,   -677,
+             1083,  -1692,   2636,  -4241,   7660, -21576,  11705,   7463,  -4222,   2633,
+            -1692,   1083,   -677,    408,   -234,    126,    -63,     28,    -11,      4,     -1 } },
+  { .h = {      -2226,      22275,     -98159,     311450,    -811712,    1844597,   -3780502,    7142859,
+            -12641337,   21230175,  -34246843,   53779498,  -83714806,  133189482, -231876287,  563717363,
+           1971326992, -349485950,  177371263, -107505624,   68593405,  -44013421,   27742803,  -16915599,
+              9852738,   -5415377,    2769559,   -1294252,     538342,    -190971,      53218 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    126,   -234,    409,   -679,
+             1086,  -1697,   2644,  -4253,   7675, -21548,  11614,   7540,  -4257,   2654,
+            -1705,   1092,   -682,    411,   -236,    127,    -63,     29,    -11,      4,     -1 } },
+  { .h = {      -2196,      22039,     -97206,     308571,    -804463,    1828544,   -3748267,    7082958,
+            -12536761,   21056453,  -33968866,   53344959,  -83037852,  132100702, -229911380,  558200982,
+           1974300099, -347555607,  176281407, -106826145,   68156847,  -43733991,   27568087,  -16810372,
+              9792437,   -5382912,    2753386,   -1286949,     535445,    -190013,      52983 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    126,   -235,    410,   -680,
+             1089,  -1702,   2652,  -4265,   7690, -21520,  11523,   7618,  -4293,   2675,
+            -1718,   1100,   -688,    414,   -238,    128,    -64,     29,    -11,      4,     -1 } },
+  { .h = {      -2165,      21803,     -96253,     305692,    -797206,    1812464,   -3715967,    7022920,
+            -12431917,   20882253,  -33690081,   52909124,  -82358897,  131008962, -227942653,  552691770,
+           1977249893, -345605353,  175182437, -106141339,   67716917,  -43452386,   27391979,  -16704279,
+              9731619,   -5350154,    2737059,   -1279571,     532514,    -189044,      52745 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    126,   -235,    411,   -682,
+             1092,  -1707,   2660,  -4276,   7705, -21492,  11431,   7696,  -4328,   2696,
+            -1732,   1108,   -693,    418,   -240,    129,    -64,     29,    -12,      4,     -1 } },
+  { .h = {      -2135,      21569,     -95300,     302811,    -789941,    1796360,   -3683605,    6962747,
+            -12326812,   20707581,  -33410500,   52472011,  -81677970,  129914309, -225970185,  547189832,
+           1980176304, -343635185,  174074376, -105451221,   67273627,  -43168611,   27214483,  -16597324,
+              9670285,   -5317104,    2720577,   -1272117,     529551,    -188061,      52502 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    127,   -236,    412,   -684,
+             1095,  -1712,   2667,  -4287,   7719, -21463,  11340,   7774,  -4364,   2716,
+            -1745,   1117,   -699,    421,   -242,    130,    -65,     29,    -12,      4,     -1 } },
+  { .h = {      -2105,      21334,     -94348,     299929,    -782669,    1780232,   -3651182,    6902442,
+            -12221449,   20532447,  -33130137,   52033639,  -80995101,  128816790, -223994059,  541695274,
+           1983079265, -341645100,  172957244, -104755808,   66826988,  -42882675,   27035606,  -16489507,
+              9608436,   -5283763,    2703940,   -1264588,     526554,    -187066,      52256 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    127,   -236,    413,   -686,
+             1098,  -1717,   2675,  -4298,   7733, -21434,  11248,   7852,  -4399,   2737,
+            -1758,   1125,   -704,    425,   -244,    131,    -66,     30,    -12,      4,     -1 } },
+  { .h = {      -2076,      21100,     -93397,     297046,    -775390,    1764080,   -3618699,    6842008,
+            -12115834,   20356858,  -32849004,   51594027,  -80310320,  127716453, -222014353,  536208202,
+           1985958708, -339635098,  171831064, -104055117,   66377011,  -42594584,   26855350,  -16380833,
+              9546074,   -5250131,    2687149,   -1256984,     523524,    -186059,      52006 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    127,   -237,    414,   -688,
+             1101,  -1722,   2682,  -4309,   7747, -21404,  11156,   7929,  -4434,   2758,
+            -1771,   1134,   -709,    428,   -246,    133,    -66,     30,    -12,      4,     -1 } },
+  { .h = {      -2046,      20867,     -92446,     294162,    -768103,    1747906,   -3586159,    6781448,
+            -12009971,   20180821,  -32567112,   51153195,  -79623656,  126613343, -220031150,  530728719,
+           1988814568, -337605176,  170695856, -103349165,   65923708,  -42304347,   26673720,  -16271302,
+              9483201,   -5216208,    2670203,   -1249304,     520461,    -185039,      51752 },
+    .d = {      0,     -1,      4,    -11,     28,    -63,    127,   -237,    414,   -689,
+             1104,  -1727,   2690,  -4320,   7760, -21374,  11063,   8007,  -4470,   2778,
+            -1784,   1142,   -715,    431,   -248,    134,    -67,     30,    -12,      4,     -1 } },
+  { .h = {      -2017,      20634,     -91496,     291277,    -760811,    1731709,   -3553562,    6720763,
+            -11903865,   20004343,  -32284474,   50711161,  -78935138,  125507508, -218044529,  525256930,
+           1991646778, -335555334,  169551645, -102637970,   65467090,  -42011969,   26490721,  -16160919,
+              9419817,   -5181995,    2653104,   -1241549,     517365,    -184006,      51494 },
+    .d = {      0,     -1,      4,    -11,     29,    -63,    128,   -238,    415,   -691,
+             1107,  -1731,   2697,  -4330,   7773, -21344,  10971,   8085,  -4505,   2799,
+            -1797,   1150,   -720,    435,   -250,    135,    -67,     31,    -12,      4,     -1 } },
+  { .h = {      -1988,      20402,     -90546,     288392,    -753512,    1715492,   -3520910,    6659958,
+            -11797520,   19827434,  -32001102,   50267944,  -78244795,  124398993, -216054571,  519792940,
+           1994455274, -333485572,  168398453, -101921548,   65007169,  -41717460,   26306357,  -16049685,
+              9355923,   -5147494,    2635851,   -1233719,     514237,    -182961,      51232 },
+    .d = {      0,     -1,      4,    -11,     29,    -63,    128,   -238,    416,   -693,
+             1110,  -1736,   2704,  -4340,   7786, -21313,  10878,   8163,  -4540,   2819,
+            -1809,   1159,   -725,    438,   -252,    136,    -68,     31,    -12,      4,     -1 } },
+  { .h = {      -1959,      20170,     -89597,     285506,    -746208,    1699253,   -3488205,    6599034,
+            -11690942,   19650100,  -31717008,   49823564,  -77552658,  123287848, -214061355,  514336853,
+           1997239989, -331395889,  167236302, -101199917,   64543957,  -41420826,   26120633,  -15937603,
+              9291522,   -5112704,    2618445,   -1225814,     511075,    -181903,      50966 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    128,   -238,    417,   -694,
+             1113,  -1740,   2711,  -4351,   7798, -21282,  10785,   8241,  -4575,   2839,
+            -1822,   1167,   -731,    441,   -254,    137,    -69,     31,    -12,      4,     -1 } },
+  { .h = {      -1930,      19938,     -88649,     282620,    -738898,    1682995,   -3455447,    6537994,
+            -11584134,   19472350,  -31432206,   49378039,  -76858756,  122174117, -212064963,  508888771,
+           2000000860, -329286288,  166065217, -100473096,   64077467,  -41122075,   25933554,  -15824676,
+              9226615,   -5077626,    2600886,   -1217834,     507880,    -180833,      50697 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    128,   -239,    418,   -696,
+             1115,  -1745,   2717,  -4360,   7811, -21250,  10691,   8318,  -4609,   2859,
+            -1835,   1175,   -736,    444,   -256,    138,    -69,     31,    -13,      4,     -1 } },
+  { .h = {      -1901,      19708,     -87702,     279734,    -731583,    1666718,   -3422639,    6476841,
+            -11477102,   19294191,  -31146706,   48931389,  -76163119,  121057848, -210065474,  503448799,
+           2002737822, -327156768,  164885221,  -99741102,   63607710,  -40821216,   25745124,  -15710906,
+              9161203,   -5042261,    2583174,   -1209780,     504652,    -179749,      50423 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    128,   -239,    419,   -698,
+             1118,  -1749,   2724,  -4370,   7822, -21218,  10598,   8396,  -4644,   2879,
+            -1848,   1183,   -741,    448,   -257,    139,    -70,     32,    -13,      4,     -1 } },
+  { .h = {      -1873,      19477,     -86755,     276848,    -724263,    1650423,   -3389781,    6415578,
+            -11369850,   19115630,  -30860522,   48483633,  -75465775,  119939087, -208062969,  498017039,
+           2005450814, -325007333,  163696339,  -99003954,   63134699,  -40518255,   25555348,  -15596297,
+              9095288,   -5006610,    2565309,   -1201650,     501391,    -178654,      50146 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    129,   -240,    420,   -699,
+             1121,  -1753,   2731,  -4380,   7834, -21185,  10504,   8474,  -4679,   2900,
+            -1860,   1192,   -747,    451,   -259,    140,    -70,     32,    -13,      4,     -1 } },
+  { .h = {      -1845,      19248,     -85809,     273961,    -716939,    1634110,   -3356876,    6354207,
+            -11262383,   18936676,  -30573666,   48034790,  -74766755,  118817882, -206057527,  492593593,
+           2008139771, -322837984,  162498596,  -98261671,   62658446,  -40213202,   25364232,  -15480851,
+              9028871,   -4970674,    2547293,   -1193446,     498097,    -177545,      49865 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    129,   -240,    421,   -701,
+             1123,  -1757,   2737,  -4389,   7845, -21152,  10410,   8552,  -4713,   2920,
+            -1873,   1200,   -752,    454,   -261,    141,    -71,     32,    -13,      4,     -1 } },
+  { .h = {      -1817,      19019,     -84865,     271075,    -709610,    1617780,   -3323924,    6292732,
+            -11154706,   18757336,  -30286150,   47584879,  -74066087,  117694280, -204049229,  487178565,
+           2010804631, -320648725,  161292016,  -97514271,   62178965,  -39906064,   25171779,  -15364571,
+              8961953,   -4934452,    2529124,   -1185167,     494770,    -176424,      49579 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    129,   -241,    421,   -702,
+             1126,  -1762,   2743,  -4398,   7856, -21119,  10315,   8630,  -4748,   2939,
+            -1886,   1208,   -757,    457,   -263,    143,    -72,     33,    -13,      4,     -1 } },
+  { .h = {      -1789,      18790,     -83921,     268189,    -702278,    1601434,   -3290927,    6231154,
+            -11046822,   18577618,  -29997986,   47133919,  -73363803,  116568326, -202038153,  481772056,
+           2013445334, -318439559,  160076625,  -96761773,   61696267,  -39596849,   24977996,  -15247460,
+              8894537,   -4897947,    2510805,   -1176814,     491410,    -175291,      49290 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    129,   -241,    422,   -703,
+             1128,  -1766,   2750,  -4407,   7866, -21086,  10221,   8707,  -4782,   2959,
+            -1898,   1216,   -762,    461,   -265,    144,    -72,     33,    -13,      4,     -1 } },
+  { .h = {      -1761,      18562,     -82978,     265303,    -694942,    1585072,   -3257887,    6169476,
+            -10938738,   18397530,  -29709187,   46681929,  -72659931,  115440069, -200024381,  476374167,
+           2016061817, -316210490,  158852449,  -96004198,   61210367,  -39285566,   24782887,  -15129521,
+              8826623,   -4861158,    2492333,   -1168386,     488017,    -174144,      48997 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    129,   -241,    423,   -705,
+             1131,  -1770,   2756,  -4416,   7877, -21051,  10126,   8785,  -4816,   2979,
+            -1911,   1224,   -767,    464,   -267,    145,    -73,     33,    -13,      5,     -1 } },
+  { .h = {      -1734,      18335,     -82036,     262418,    -687603,    1568696,   -3224805,    6107702,
+            -10830458,   18217079,  -29419765,   46228929,  -71954501,  114309555, -198007990,  470985001,
+           2018654021, -313961522,  157619514,  -95241563,   60721276,  -38972224,   24586458,  -15010756,
+              8758214,   -4824087,    2473711,   -1159884,     484592,    -172985,      48700 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    129,   -242,    424,   -706,
+             1133,  -1773,   2762,  -4425,   7886, -21017,  10031,   8863,  -4850,   2999,
+            -1923,   1232,   -772,    467,   -269,    146,    -73,     33,    -14,      5,     -1 } },
+  { .h = {      -1706,      18108,     -81095,     259534,    -680261,    1552305,   -3191683,    6045833,
+            -10721985,   18036274,  -29129732,   45774938,  -71247542,  113176830, -195989062,  465604657,
+           2021221885, -311692662,  156377846,  -94473890,   60229009,  -38656830,   24388713,  -14891170,
+              8689311,   -4786734,    2454939,   -1151308,     481133,    -171814,      48398 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -242,    424,   -708,
+             1135,  -1777,   2767,  -4433,   7896, -20982,   9935,   8940,  -4884,   3018,
+            -1935,   1240,   -778,    470,   -271,    147,    -74,     34,    -14,      5,     -1 } },
+  { .h = {      -1679,      17882,     -80155,     256650,    -672917,    1535902,   -3158521,    5983872,
+            -10613326,   17855121,  -28839101,   45319975,  -70539085,  112041943, -193967675,  460233237,
+           2023765349, -309403914,  155127472,  -93701197,   59733579,  -38339393,   24189657,  -14770764,
+              8619916,   -4749100,    2436016,   -1142659,     477642,    -170630,      48093 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -242,    425,   -709,
+             1138,  -1781,   2773,  -4441,   7905, -20947,   9840,   9018,  -4918,   3038,
+            -1948,   1248,   -783,    474,   -273,    148,    -75,     34,    -14,      5,     -1 } },
+  { .h = {      -1653,      17656,     -79216,     253768,    -665570,    1519485,   -3125322,    5921823,
+            -10504484,   17673629,  -28547884,   44864059,  -69829158,  110904938, -191943908,  454870841,
+           2026284356, -307095284,  153868420,  -92923506,   59234998,  -38019923,   23989297,  -14649542,
+              8550030,   -4711185,    2416944,   -1133935,     474118,    -169433,      47784 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -243,    426,   -710,
+             1140,  -1785,   2779,  -4450,   7914, -20911,   9744,   9096,  -4952,   3057,
+            -1960,   1256,   -788,    477,   -275,    149,    -75,     34,    -14,      5,     -1 } },
+  { .h = {      -1626,      17432,     -78279,     250886,    -658221,    1503057,   -3092086,    5859688,
+            -10395464,   17491806,  -28256093,   44407209,  -69117792,  109765864, -189917841,  449517569,
+           2028778846, -304766781,  152600718,  -92140836,   58733282,  -37698427,   23787638,  -14527507,
+              8479654,   -4672992,    2397722,   -1125138,     470561,    -168223,      47471 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -243,    427,   -712,
+             1142,  -1788,   2784,  -4457,   7923, -20875,   9648,   9173,  -4986,   3077,
+            -1972,   1264,   -793,    480,   -277,    150,    -76,     35,    -14,      5,     -1 } },
+  { .h = {      -1599,      17207,     -77343,     248005,    -650871,    1486618,   -3058816,    5797468,
+            -10286272,   17309658,  -27963741,   43949445,  -68405016,  108624767, -187889553,  444173521,
+           2031248762, -302418410,  151324392,  -91353209,   58228444,  -37374915,   23584684,  -14404662,
+              8408792,   -4634520,    2378351,   -1116267,     466972,    -167001,      47154 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -243,    427,   -713,
+             1144,  -1792,   2790,  -4465,   7931, -20839,   9552,   9251,  -5019,   3096,
+            -1984,   1272,   -798,    483,   -279,    151,    -76,     35,    -14,      5,     -1 } },
+  { .h = {      -1573,      16984,     -76408,     245126,    -643519,    1470168,   -3025512,    5735169,
+            -10176911,   17127195,  -27670840,   43490785,  -67690859,  107481694, -185859123,  438838795,
+           2033694047, -300050179,  150039472,  -90560645,   57720498,  -37049395,   23380442,  -14281011,
+              8337444,   -4595771,    2358831,   -1107322,     463350,    -165766,      46833 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -244,    428,   -714,
+             1146,  -1795,   2795,  -4473,   7939, -20802,   9455,   9328,  -5053,   3115,
+            -1996,   1279,   -803,    486,   -281,    152,    -77,     35,    -14,      5,     -1 } },
+  { .h = {      -1547,      16761,     -75474,     242248,    -636167,    1453708,   -2992176,    5672790,
+            -10067386,   16944423,  -27377403,   43031250,  -66975353,  106336692, -183826630,  433513491,
+           2036114644, -297662098,  148745987,  -89763165,   57209457,  -36721877,   23174917,  -14156556,
+              8265612,   -4556745,    2339163,   -1098305,     459695,    -164519,      46508 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -244,    428,   -715,
+             1148,  -1798,   2800,  -4480,   7947, -20765,   9359,   9406,  -5086,   3134,
+            -2008,   1287,   -808,    489,   -282,    154,    -77,     36,    -14,      5,     -1 } },
+  { .h = {      -1521,      16539,     -74542,     239372,    -628813,    1437239,   -2958810,    5610337,
+             -9957702,   16761351,  -27083441,   42570857,  -66258525,  105189807, -181792152,  428197707,
+           2038510496, -295254174,  147443965,  -88960790,   56695337,  -36392370,   22968114,  -14031301,
+              8193298,   -4517443,    2319347,   -1089214,     456008,    -163258,      46179 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    130,   -244,    429,   -716,
+             1150,  -1802,   2805,  -4487,   7955, -20727,   9262,   9483,  -5119,   3153,
+            -2020,   1295,   -813,    492,   -284,    155,    -78,     36,    -15,      5,     -1 } },
+  { .h = {      -1496,      16317,     -73610,     236497,    -621460,    1420762,   -2925415,    5547810,
+             -9847864,   16577985,  -26788967,   42109627,  -65540406,  104041086, -179755768,  422891541,
+           2040881549, -292826418,  146133435,  -88153543,   56178151,  -36060884,   22760040,  -13905250,
+              8120504,   -4477866,    2299384,   -1080050,     452288,    -161986,      45846 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    430,   -717,
+             1152,  -1805,   2810,  -4494,   7962, -20689,   9165,   9561,  -5152,   3172,
+            -2032,   1303,   -818,    495,   -286,    156,    -79,     36,    -15,      5,     -1 } },
+  { .h = {      -1470,      16096,     -72681,     233624,    -614106,    1404277,   -2891991,    5485213,
+             -9737876,   16394334,  -26493994,   41647578,  -64821025,  102890577, -177717557,  417595092,
+           2043227747, -290378839,  144814429,  -87341444,   55657915,  -35727426,   22550700,  -13778404,
+              8047232,   -4438015,    2279273,   -1070813,     448535,    -160700,      45509 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    430,   -718,
+             1154,  -1808,   2815,  -4501,   7969, -20651,   9068,   9638,  -5185,   3191,
+            -2044,   1310,   -823,    499,   -288,    157,    -79,     36,    -15,      5,     -1 } },
+  { .h = {      -1445,      15876,     -71753,     230752,    -606753,    1387785,   -2858542,    5422548,
+             -9627743,   16210406,  -26198533,   41184730,  -64100412,  101738325, -175677597,  412308457,
+           2045549037, -287911449,  143486975,  -86524516,   55134643,  -35392008,   22340100,  -13650769,
+              7973483,   -4397891,    2259016,   -1061504,     444750,    -159402,      45167 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    431,   -720,
+             1156,  -1811,   2820,  -4508,   7975, -20612,   8970,   9716,  -5218,   3210,
+            -2056,   1318,   -828,    502,   -290,    158,    -80,     37,    -15,      5,     -1 } },
+  { .h = {      -1420,      15656,     -70826,     227883,    -599400,    1371287,   -2825068,    5359819,
+             -9517469,   16026208,  -25902598,   40721101,  -63378597,  100584377, -173635966,  407031733,
+           2047845363, -285424257,  142151105,  -85702782,   54608349,  -35054638,   22128246,  -13522348,
+              7899259,   -4357495,    2238612,   -1052122,     440933,    -158091,      44822 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    131,   -245,    431,   -721,
+             1158,  -1814,   2824,  -4514,   7981, -20573,   8872,   9793,  -5251,   3229,
+            -2068,   1325,   -832,    505,   -292,    159,    -80,     37,    -15,      5,     -1 } },
+  { .h = {      -1395,      15437,     -69901,     225016,    -592048,    1354783,   -2791570,    5297027,
+             -9407059,   15841748,  -25606200,   40256712,  -62655609,   99428780, -171592743,  401765016,
+           2050116673, -282917276,  140806849,  -84876262,   54079049,  -34715326,   21915143,  -13393143,
+              7824563,   -4316827,    2218063,   -1042668,     437083,    -156768,      44473 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    131,   -246,    432,   -722,
+             1160,  -1817,   2829,  -4520,   7987, -20534,   8774,   9870,  -5284,   3247,
+            -2079,   1333,   -837,    508,   -294,    160,    -81,     37,    -15,      5,     -1 } },
+  { .h = {      -1370,      15219,     -68977,     222151,    -584697,    1338274,   -2758050,    5234176,
+             -9296518,   15657033,  -25309351,   39791581,  -61931478,   98271581, -169548005,  396508404,
+           2052362915, -280390518,  139454238,  -84044981,   53546758,  -34374082,   21700798,  -13263158,
+              7749395,   -4275890,    2197368,   -1033141,     433201,    -155432,      44120 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    432,   -723,
+             1161,  -1820,   2833,  -4526,   7993, -20494,   8676,   9947,  -5316,   3266,
+            -2091,   1340,   -842,    511,   -295,    161,    -81,     37,    -15,      5,     -1 } },
+  { .h = {      -1346,      15002,     -68055,     219288,    -577348,    1321761,   -2724510,    5171267,
+             -9185851,   15472072,  -25012064,   39325727,  -61206234,   97112827, -167501830,  391261992,
+           2054584035, -277843995,  138093305,  -83208960,   53011491,  -34030916,   21485217,  -13132398,
+              7673759,   -4234683,    2176528,   -1023543,     429286,    -154083,      43762 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    433,   -723,
+             1163,  -1822,   2837,  -4532,   7998, -20454,   8578,  10025,  -5349,   3284,
+            -2102,   1348,   -847,    514,   -297,    162,    -82,     38,    -15,      5,     -1 } },
+  { .h = {      -1322,      14785,     -67134,     216428,    -570000,    1305245,   -2690950,    5108304,
+             -9075061,   15286872,  -24714352,   38859170,  -60479906,   95952563, -165454297,  386025876,
+           2056779983, -275277721,  136724081,  -82368224,   52473264,  -33685837,   21268406,  -13000864,
+              7597656,   -4193208,    2155544,   -1013872,     425339,    -152722,      43401 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    433,   -724,
+             1165,  -1825,   2841,  -4538,   8003, -20413,   8479,  10102,  -5381,   3302,
+            -2114,   1355,   -852,    517,   -299,    163,    -83,     38,    -16,      5,     -1 } },
+  { .h = {      -1298,      14569,     -66215,     213571,    -562655,    1288726,   -2657373,    5045289,
+             -8964154,   15101440,  -24416226,   38391928,  -59752524,   94790836, -163405482,  380800152,
+           2058950708, -272691710,  135346599,  -81522795,   51932092,  -33338855,   21050371,  -12868562,
+              7521087,   -4151465,    2134415,   -1004130,     421360,    -151348,      43036 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -246,    434,   -725,
+             1166,  -1828,   2845,  -4544,   8008, -20372,   8381,  10179,  -5413,   3321,
+            -2125,   1363,   -856,    520,   -301,    164,    -83,     38,    -16,      5,     -1 } },
+  { .h = {      -1274,      14354,     -65298,     210716,    -555312,    1272204,   -2623779,    4982226,
+             -8853134,   14915785,  -24117700,   37924022,  -59024117,   93627694, -161355463,  375584914,
+           2061096159, -270085976,  133960892,  -80672696,   51387990,  -32989982,   20831118,  -12735495,
+              7444056,   -4109457,    2113143,    -994316,     417349,    -149961,      42666 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    434,   -726,
+             1168,  -1830,   2849,  -4549,   8012, -20331,   8282,  10256,  -5445,   3339,
+            -2137,   1370,   -861,    523,   -303,    165,    -84,     39,    -16,      5,     -1 } },
+  { .h = {      -1250,      14140,     -64383,     207864,    -547971,    1255681,   -2590170,    4919115,
+             -8742006,   14729914,  -23818784,   37455469,  -58294714,   92463182, -159304318,  370380256,
+           2063216286, -267460534,  132566991,  -79817953,   50840975,  -32639226,   20610653,  -12601666,
+              7366564,   -4067183,    2091728,    -984431,     413306,    -148562,      42293 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    434,   -727,
+             1169,  -1833,   2853,  -4554,   8016, -20289,   8183,  10333,  -5477,   3357,
+            -2148,   1377,   -866,    526,   -304,    166,    -84,     39,    -16,      6,     -1 } },
+  { .h = {      -1227,      13926,     -63469,     205014,    -540634,    1239157,   -2556547,    4855961,
+             -8630775,   14543835,  -23519492,   36986290,  -57564347,   91297347, -157252124,  365186274,
+           2065311041, -264815399,  131164932,  -78958587,   50291062,  -32286597,   20388984,  -12467079,
+              7288613,   -4024645,    2070170,    -974475,     409231,    -147151,      41915 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    435,   -728,
+             1171,  -1835,   2857,  -4559,   8020, -20247,   8083,  10409,  -5509,   3375,
+            -2159,   1385,   -871,    529,   -306,    167,    -85,     39,    -16,      6,     -1 } },
+  { .h = {      -1203,      13713,     -62557,     202168,    -533300,    1222634,   -2522912,    4792765,
+             -8519444,   14357555,  -23219835,   36516503,  -56833043,   90130235, -155198957,  360003060,
+           2067380374, -262150588,  129754747,  -78094624,   49738269,  -31932108,   20166115,  -12331738,
+              7210205,   -3981843,    2048470,    -964448,     405123,    -145726,      41534 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    435,   -728,
+             1172,  -1837,   2860,  -4564,   8024, -20204,   7984,  10486,  -5540,   3393,
+            -2171,   1392,   -875,    532,   -308,    168,    -85,     39,    -16,      6,     -2 } },
+  { .h = {      -1180,      13501,     -61647,     199325,    -525969,    1206110,   -2489267,    4729531,
+             -8408019,   14171082,  -22919827,   36046127,  -56100833,   88961893, -153144895,  354830709,
+           2069424238, -259466116,  128336472,  -77226089,   49182610,  -31575767,   19942055,  -12195647,
+              7131342,   -3938780,    2026628,    -954350,     400984,    -144290,      41148 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    436,   -729,
+             1173,  -1840,   2864,  -4568,   8027, -20162,   7884,  10563,  -5572,   3410,
+            -2182,   1399,   -880,    535,   -310,    169,    -86,     40,    -16,      6,     -2 } },
+  { .h = {      -1157,      13289,     -60738,     196485,    -518643,    1189588,   -2455611,    4666260,
+             -8296504,   13984423,  -22619479,   35575182,  -55367747,   87792367, -151090015,  349669313,
+           2071442585, -256762002,  126910140,  -76353004,   48624102,  -31217585,   19716808,  -12058809,
+              7052027,   -3895456,    2004645,    -944182,     396813,    -142840,      40758 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    131,   -247,    436,   -730,
+             1175,  -1842,   2867,  -4573,   8030, -20119,   7784,  10640,  -5603,   3428,
+            -2193,   1406,   -884,    537,   -312,    170,    -86,     40,    -16,      6,     -2 } },
+  { .h = {      -1135,      13079,     -59832,     193648,    -511320,    1173068,   -2421948,    4602956,
+             -8184904,   13797587,  -22318803,   35103687,  -54633813,   86621703, -149034393,  344518965,
+           2073435368, -254038262,  125475786,  -75475396,   48062762,  -30857574,   19490382,  -11921228,
+              6972261,   -3851872,    1982521,    -933943,     392611,    -141378,      40364 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    132,   -247,    436,   -730,
+             1176,  -1844,   2870,  -4577,   8032, -20075,   7684,  10716,  -5634,   3446,
+            -2204,   1413,   -889,    540,   -313,    171,    -87,     40,    -17,      6,     -2 } },
+  { .h = {      -1112,      12869,     -58927,     190815,    -504002,    1156550,   -2388278,    4539621,
+             -8073224,   13610581,  -22017812,   34631661,  -53899061,   85449948, -146978105,  339379757,
+           2075402541, -251294915,  124033446,  -74593290,   47498606,  -30495743,   19262784,  -11782909,
+              6892048,   -3808029,    1960257,    -923634,     388376,    -139904,      39966 },
+    .d = {      0,     -1,      4,    -11,     29,    -65,    132,   -248,    437,   -731,
+             1177,  -1846,   2873,  -4581,   8035, -20031,   7584,  10793,  -5665,   3463,
+            -2215,   1420,   -894,    543,   -315,    172,    -88,     41,    -17,      6,     -2 } },
+  { .h = {      -1090,      12660,     -58025,     187986,    -496689,    1140036,   -2354603,    4476258,
+             -7961467,   13423413,  -21716518,   34159122,  -53163520,   84277148, -144921228,  334251781,
+           2077344058, -248531980,  122583155,  -73706710,   46931652,  -30132104,   19034020,  -11643856,
+              6811387,   -3763929,    1937854,    -913256,     384110,    -138417,      39564 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    132,   -248,    437,   -732,
+             1178,  -1848,   2876,  -4585,   8037, -19987,   7484,  10869,  -5696,   3481,
+            -2226,   1427,   -898,    546,   -317,    173,    -88,     41,    -17,      6,     -2 } },
+  { .h = {      -1068,      12451,     -57124,     185160,    -489381,    1123526,   -2320923,    4412869,
+             -7849638,   13236090,  -21414934,   33686091,  -52427221,   83103348, -142863839,  329135129,
+           2079259875, -245749476,  121124949,  -72815683,   46361915,  -29766667,   18804097,  -11504071,
+              6730284,   -3719572,    1915311,    -902807,     379812,    -136917,      39158 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    132,   -248,    437,   -732,
+             1179,  -1850,   2879,  -4589,   8038, -19942,   7383,  10946,  -5727,   3498,
+            -2236,   1434,   -903,    549,   -319,    174,    -89,     41,    -17,      6,     -2 } },
+  { .h = {      -1046,      12244,     -56226,     182338,    -482078,    1107020,   -2287241,    4349457,
+             -7737743,   13048619,  -21113071,   33212585,  -51690192,   81928596, -140806012,  324029892,
+           2081149946, -242947422,  119658865,  -71920233,   45789414,  -29399443,   18573022,  -11363560,
+              6648738,   -3674960,    1892629,    -892289,     375483,    -135405,      38748 },
+    .d = {      0,     -1,      4,    -11,     29,    -64,    132,   -248,    437,   -733,
+             1180,  -1851,   2882,  -4592,   8040, -19897,   7282,  11022,  -5758,   3515,
+            -2247,   1441,   -907,    552,   -320,    175,    -89,     41,    -17,      6,     -2 } },
+  { .h = {      -1024,      12037,     -55329,     179520,    -474781,    1090519,   -2253558,    4286024,
+             -7625785,   12861009,  -20810941,   32738625,  -50952463,   80752936, -138747824,  318936160,
+           2083014227, -240125839,  118184939,  -71020386,   45214165,  -29030444,   18340801,  -11222326,
+              6566753,   -3630093,    1869810,    -881702,     371122,    -133880,      38334 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -733,
+             1181,  -1853,   2884,  -4596,   8041, -19852,   7181,  11098,  -5788,   3532,
+            -2258,   1448,   -912,    555,   -322,    176,    -90,     42,    -17,      6,     -2 } },
+  { .h = {      -1003,      11831,     -54435,     176705,    -467489,    1074025,   -2219874,    4222574,
+             -7513769,   12673267,  -20508557,   32264229,  -50214063,   79576416, -136689351,  313854024,
+           2084852676, -237284748,  116703208,  -70116170,   44636186,  -28659681,   18107442,  -11080373,
+              6484331,   -3584974,    1846853,    -871045,     366730,    -132343,      37915 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -734,
+             1182,  -1855,   2887,  -4599,   8042, -19806,   7080,  11174,  -5818,   3549,
+            -2268,   1455,   -916,    557,   -324,    177,    -90,     42,    -17,      6,     -2 } },
+  { .h = {       -982,      11626,     -53543,     173895,    -460204,    1057537,   -2186193,    4159107,
+             -7401700,   12485401,  -20205931,   31789415,  -49475022,   78399081, -134630668,  308783574,
+           2086665250, -234424171,  115213710,  -69207609,   44055494,  -28287164,   17872951,  -10937706,
+              6401474,   -3539603,    1823759,    -860320,     362306,    -130794,      37493 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -734,
+             1183,  -1856,   2889,  -4602,   8042, -19760,   6979,  11250,  -5849,   3566,
+            -2279,   1462,   -920,    560,   -325,    178,    -91,     42,    -17,      6,     -2 } },
+  { .h = {       -961,      11422,     -52653,     171089,    -452926,    1041056,   -2152514,    4095628,
+             -7289582,   12297418,  -19903076,   31314204,  -48735369,   77220976, -132571850,  303724899,
+           2088451906, -231544129,  113716483,  -68294731,   43472106,  -27912905,   17637335,  -10794329,
+              6318185,   -3493981,    1800529,    -849526,     357852,    -129232,      37066 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -735,
+             1184,  -1858,   2892,  -4605,   8042, -19714,   6878,  11326,  -5879,   3583,
+            -2289,   1469,   -925,    563,   -327,    179,    -91,     42,    -18,      6,     -2 } },
+  { .h = {       -940,      11219,     -51765,     168288,    -445654,    1024583,   -2118839,    4032139,
+             -7177420,   12109325,  -19600002,   30838614,  -47995133,   76042149, -130512973,  298678087,
+           2090212602, -228644645,  112211564,  -67377562,   42886041,  -27536916,   17400603,  -10650246,
+              6234465,   -3448109,    1777163,    -838663,     353366,    -127658,      36636 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    132,   -248,    438,   -735,
+             1185,  -1859,   2894,  -4607,   8042, -19667,   6776,  11402,  -5908,   3599,
+            -2300,   1475,   -929,    566,   -329,    180,    -92,     43,    -18,      6,     -2 } },
+  { .h = {       -919,      11016,     -50879,     165491,    -438389,    1008118,   -2085169,    3968642,
+             -7065217,   11921131,  -19296723,   30362664,  -47254344,   74862644, -128454111,  293643229,
+           2091947299, -225725743,  110698992,  -66456129,   42297316,  -27159208,   17162760,  -10505461,
+              6150318,   -3401990,    1753661,    -827733,     348849,    -126071,      36201 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    438,   -736,
+             1185,  -1861,   2896,  -4610,   8042, -19620,   6674,  11478,  -5938,   3616,
+            -2310,   1482,   -933,    568,   -330,    181,    -92,     43,    -18,      6,     -2 } },
+  { .h = {       -899,      10815,     -49995,     162698,    -431131,     991663,   -2051507,    3905139,
+             -6952980,   11732842,  -18993251,   29886373,  -46513030,   73682507, -126395340,  288620412,
+           2093655956, -222787445,  109178806,  -65530460,   41705949,  -26779793,   16923814,  -10359978,
+              6065745,   -3355623,    1730025,    -816735,     344301,    -124472,      35762 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -736,
+             1186,  -1862,   2898,  -4612,   8041, -19573,   6573,  11553,  -5968,   3632,
+            -2320,   1489,   -938,    571,   -332,    182,    -93,     43,    -18,      6,     -2 } },
+  { .h = {       -879,      10614,     -49114,     159910,    -423881,     975217,   -2017852,    3841634,
+             -6840711,   11544467,  -18689597,   29409760,  -45771221,   72501784, -124336734,  283609724,
+           2095338532, -219829776,  107651045,  -64600581,   41111959,  -26398682,   16683772,  -10213803,
+              5980750,   -3309011,    1706255,    -805668,     339722,    -122860,      35319 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -736,
+             1187,  -1863,   2900,  -4614,   8040, -19525,   6471,  11629,  -5997,   3649,
+            -2330,   1495,   -942,    574,   -334,    183,    -93,     43,    -18,      6,     -2 } },
+  { .h = {       -859,      10414,     -48235,     157127,    -416639,     958782,   -1984207,    3778129,
+             -6728416,   11356013,  -18385774,   28932843,  -45028947,   71320521, -122278367,  278611252,
+           2096994989, -216852761,  106115748,  -63666520,   40515364,  -26015887,   16442641,  -10066938,
+              5895334,   -3262155,    1682352,    -794535,     335112,    -121236,      34872 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -736,
+             1187,  -1864,   2901,  -4616,   8039, -19477,   6368,  11704,  -6027,   3665,
+            -2341,   1502,   -946,    576,   -335,    184,    -94,     44,    -18,      6,     -2 } },
+  { .h = {       -839,      10215,     -47358,     154349,    -409406,     942358,   -1950573,    3714626,
+             -6616100,   11167487,  -18081794,   28455643,  -44286236,   70138763, -120220314,  273625084,
+           2098625289, -213856425,  104572956,  -62728305,   39916181,  -25631421,   16200430,   -9919389,
+              5809500,   -3215055,    1658315,    -783334,     330472,    -119600,      34421 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
+             1188,  -1865,   2903,  -4618,   8038, -19429,   6266,  11780,  -6056,   3681,
+            -2351,   1508,   -950,    579,   -337,    185,    -94,     44,    -18,      6,     -2 } },
+  { .h = {       -819,      10016,     -46484,     151575,    -402180,     925946,   -1916952,    3651127,
+             -6503765,   10978897,  -17777669,   27978177,  -43543117,   68956555, -118162649,  268651306,
+           2100229392, -210840793,  103022708,  -61785964,   39314430,  -25245294,   15957145,   -9771159,
+              5723250,   -3167714,    1634146,    -772067,     325801,    -117952,      33966 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
+             1189,  -1866,   2904,  -4620,   8036, -19380,   6164,  11855,  -6085,   3697,
+            -2361,   1515,   -954,    582,   -339,    186,    -95,     44,    -18,      6,     -2 } },
+  { .h = {       -800,       9819,     -45612,     148807,    -394964,     909546,   -1883343,    3587636,
+             -6391418,   10790250,  -17473411,   27500464,  -42799620,   67773944, -116105447,  263690004,
+           2101807263, -207805893,  101465046,  -60839525,   38710129,  -24857519,   15712794,   -9622254,
+              5636587,   -3120132,    1609846,    -760732,     321099,    -116291,      33507 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
+             1189,  -1867,   2906,  -4621,   8034, -19331,   6061,  11930,  -6113,   3713,
+            -2370,   1521,   -959,    584,   -340,    187,    -95,     45,    -18,      7,     -2 } },
+  { .h = {       -780,       9622,     -44743,     146043,    -387756,     893160,   -1849749,    3524155,
+             -6279062,   10601555,  -17169032,   27022523,  -42055773,   66590973, -114048779,  258741265,
+           2103358864, -204751752,   99900010,  -59889016,   38103297,  -24468108,   15467384,   -9472678,
+              5549513,   -3072310,    1585415,    -749332,     316367,    -114618,      33044 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
+             1189,  -1868,   2907,  -4622,   8031, -19282,   5958,  12005,  -6142,   3729,
+            -2380,   1527,   -963,    587,   -342,    188,    -96,     45,    -19,      7,     -2 } },
+  { .h = {       -761,       9427,     -43876,     143285,    -380558,     876786,   -1816172,    3460687,
+             -6166702,   10412817,  -16864544,   26544374,  -41311606,   65407689, -111992721,  253805172,
+           2104884159, -201678396,   98327641,  -58934467,   37493953,  -24077073,   15220923,   -9322436,
+              5462032,   -3024251,    1560853,    -737865,     311604,    -112932,      32576 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
+             1190,  -1869,   2908,  -4623,   8029, -19232,   5855,  12080,  -6171,   3744,
+            -2390,   1534,   -967,    589,   -343,    189,    -96,     45,    -19,      7,     -2 } },
+  { .h = {       -742,       9232,     -43011,     140533,    -373369,     860428,   -1782612,    3397233,
+             -6054343,   10224045,  -16559958,   26066034,  -40567148,   64224137, -109937346,  248881812,
+           2106383112, -198585854,   96747981,  -57975905,   36882115,  -23684427,   14973419,   -9171531,
+              5374145,   -2975956,    1536161,    -726332,     306812,    -111235,      32105 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -737,
+             1190,  -1869,   2909,  -4624,   8026, -19182,   5752,  12155,  -6199,   3760,
+            -2400,   1540,   -971,    592,   -345,    190,    -97,     45,    -19,      7,     -2 } },
+  { .h = {       -724,       9038,     -42149,     137786,    -366190,     844084,   -1749070,    3333797,
+             -5941988,   10035247,  -16255288,   25587523,  -39822427,   63040362, -107882726,  243971269,
+           2107855690, -195474154,   95161072,  -57013359,   36267804,  -23290181,   14724879,   -9019969,
+              5285855,   -2927425,    1511341,    -714734,     301989,    -109525,      31629 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -738,
+             1190,  -1870,   2910,  -4625,   8023, -19131,   5649,  12230,  -6227,   3775,
+            -2409,   1546,   -975,    595,   -346,    190,    -97,     46,    -19,      7,     -2 } },
+  { .h = {       -705,       8845,     -41290,     135044,    -359021,     827755,   -1715549,    3270380,
+             -5829642,    9846429,  -15950545,   25108859,  -39077472,   61856409, -105828936,  239073627,
+           2109301856, -192343325,   93566957,  -56046860,   35651038,  -22894349,   14475312,   -8867754,
+              5197165,   -2878660,    1486392,    -703071,     297135,    -107803,      31149 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -738,
+             1191,  -1870,   2911,  -4625,   8019, -19081,   5546,  12304,  -6255,   3791,
+            -2419,   1552,   -979,    597,   -348,    191,    -98,     46,    -19,      7,     -2 } },
+  { .h = {       -687,       8653,     -40433,     132308,    -351862,     811443,   -1682049,    3206986,
+             -5717310,    9657598,  -15645741,   24630061,  -38332313,   60672322, -103776046,  234188969,
+           2110721579, -189193398,   91965677,  -55076436,   35031837,  -22496943,   14224724,   -8714890,
+              5108078,   -2829663,    1461315,    -691342,     292252,    -106069,      30666 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -248,    439,   -738,
+             1191,  -1871,   2911,  -4626,   8015, -19030,   5442,  12379,  -6283,   3806,
+            -2428,   1558,   -983,    600,   -350,    192,    -98,     46,    -19,      7,     -2 } },
+  { .h = {       -669,       8462,     -39578,     129578,    -344714,     795148,   -1648572,    3143616,
+             -5604996,    9468764,  -15340887,   24151148,  -37586978,   59488148, -101724131,  229317379,
+           2112114824, -186024402,   90357277,  -54102116,   34410219,  -22097975,   13973124,   -8561384,
+              5018595,   -2780435,    1436111,    -679549,     287339,    -104323,      30178 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -247,    439,   -738,
+             1191,  -1871,   2912,  -4626,   8011, -18978,   5339,  12453,  -6310,   3821,
+            -2438,   1565,   -987,    602,   -351,    193,    -99,     46,    -19,      7,     -2 } },
+  { .h = {       -651,       8272,     -38727,     126853,    -337577,     778869,   -1615118,    3080274,
+             -5492704,    9279932,  -15035996,   23672137,  -36841495,   58303930,  -99673263,  224458939,
+           2113481560, -182836369,   88741798,  -53123931,   33786206,  -21697458,   13720519,   -8407239,
+              4928720,   -2730977,    1410780,    -667691,     282396,    -102564,      29686 },
+    .d = {      0,     -1,      3,    -11,     28,    -64,    131,   -247,    439,   -738,
+             1191,  -1871,   2913,  -4626,   8007, -18927,   5235,  12528,  -6338,   3836,
+            -2447,   1571,   -991,    605,   -353,    194,    -99,     47,    -19,      7,     -2 } },
+  { .h = {       -634,       8083,     -37877,     124134,    -330451,     762609,   -1581690,    3016961,
+             -5380439,    9091110,  -14731080,   23193049,  -36095894,   57119713,  -97623513,  219613732,
+           2114821754, -179629328,   87119286,  -52141911,   33159817,  -21295405,   13466919,   -8252459,
+              4838456,   -2681291,    1385324,    -655769,     277424,    -100794,      29190 },
+    .d = {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -738,
+             1191,  -1872,   2913,  -4626,   8002, -18875,   5131,  12602,  -6365,   3851,
+            -2456,   1576,   -994,    607,   -354,    195,   -100,     47,    -20,      7,     -2 } },
+  { .h = {       -616,       7894,     -37031,     121422,    -323336,     746368,   -1548288,    2953681,
+             -5268205,    8902306,  -14426151,   22713901,  -35350204,   55935542,  -95574954,  214781840,
+           2116135376, -176403313,   85489784,  -51156085,   32531071,  -20891829,   13212330,   -8097051,
+              4747805,   -2631378,    1359743,    -643783,     272422,     -99012,      28690 },
+    .d = {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -737,
+             1191,  -1872,   2913,  -4625,   7997, -18822,   5027,  12676,  -6392,   3866,
+            -2465,   1582,   -998,    610,   -356,    196,   -100,     47,    -20,      7,     -2 } },
+  { .h = {       -599,       7707,     -36187,     118716,    -316233,     730146,   -1514914,    2890435,
+             -5156006,    8713526,  -14121219,   22234712,  -34604452,   54751461,  -93527657,  209963344,
+           2117422394, -173158356,   83853337,  -50166485,   31899988,  -20486742,   12956761,   -7941018,
+              4656769,   -2581240,    1334037,    -631734,     267390,     -97217,      28185 },
+    .d = {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -737,
+             1191,  -1872,   2913,  -4625,   7992, -18770,   4923,  12749,  -6419,   3880,
+            -2474,   1588,  -1002,    612,   -357,    197,   -101,     47,    -20,      7,     -2 } },
+  { .h = {       -582,       7520,     -35346,     116015,    -309142,     713943,   -1481569,    2827226,
+             -5043847,    8524779,  -13816298,   21755501,  -33858668,   53567516,  -91481695,  205158325,
+           2118682778, -169894489,   82209988,  -49173140,   31266590,  -20080158,   12700219,   -7784366,
+              4565352,   -2530878,    1308208,    -619621,     262329,     -95411,      27677 },
+    .d = {      0,     -1,      3,    -11,     28,    -63,    130,   -247,    438,   -737,
+             1191,  -1872,   2913,  -4624,   7987, -18717,   4819,  12823,  -6446,   3895,
+            -2483,   1594,  -1006,    614,   -359,    198,   -101,     48,    -20,      7,     -2 } },
+  { .h = {       -565,       7335,     -34508,     113321,    -302063,     697761,   -1448254,    2764056,
+             -4931733,    8336071,  -13511399,   21276285,  -33112880,   52383750,  -89437138,  200366864,
+           2119916500, -166611747,   80559784,  -48176082,   30630895,  -19672089,   12442714,   -7627099,
+              4473557,   -2480293,    1282256,    -607446,     257239,     -93592,      27165 },
+    .d = {      0,     -1,      3,    -10,     28,    -63,    130,   -247,    438,   -737,
+             1191,  -1872,   2913,  -4623,   7981, -18663,   4715,  12897,  -6473,   3909,
+            -2492,   1600,  -1010,    617,   -360,    198,   -102,     48,    -20,      7,     -2 } },
+  { .h = {       -548,       7150,     -33672,     110634,    -294997,     681601,   -1414970,    2700928,
+             -4819666,    8147410,  -13206533,   20797084,  -32367116,   51200207,  -87394058,  195589041,
+           2121123531, -163310163,   78902770,  -47175341,   29992925,  -19262550,   12184254,   -7469223,
+              4381386,   -2429488,    1256181,    -595207,     252120,     -91762,      26649 },
+    .d = {      0,     -1,      3,    -10,     28,    -63,    130,   -246,    438,   -737,
+             1191,  -1872,   2913,  -4622,   7975, -18610,   4611,  12970,  -6499,   3923,
+            -2501,   1605,  -1013,    619,   -362,    199,   -102,     48,    -20,      7,     -2 } },
+  { .h = {       -532,       6966,     -32840,     107953,    -287943,     665461,   -1381720,    2637845,
+             -4707652,    7958803,  -12901713,   20317916,  -31621405,   50016933,  -85352525,  190824935,
+           2122303842, -159989771,   77238990,  -46170948,   29352700,  -18851553,   11924846,   -7310742,
+              4288842,   -2378463,    1229986,    -582907,     246971,     -89920,      26128 },
+    .d = {      0,     -1,      3,    -10,     28,    -63,    130,   -246,    437,   -737,
+             1190,  -1872,   2913,  -4621,   7968, -18556,   4506,  13044,  -6525,   3938,
+            -2510,   1611,  -1017,    621,   -363,    200,   -103,     48,    -20,      7,     -2 } },
+  { .h = {       -516,       6783,     -32010,     105278,    -280902,     649344,   -1348503,    2574808,
+             -4595696,    7770257,  -12596950,   19838799,  -30875776,   48833970,  -83312611,  186074626,
+           2123457406, -156650607,   75568493,  -45162935,   28710241,  -18439111,   11664499,   -7151662,
+              4195927,   -2327220,    1203669,    -570544,     241794,     -88066,      25604 },
+    .d = {      0,     -1,      3,    -10,     27,    -63,    130,   -246,    437,   -736,
+             1190,  -1871,   2912,  -4620,   7962, -18502,   4402,  13117,  -6551,   3952,
+            -2518,   1617,  -1021,    624,   -364,    201,   -103,     49,    -20,      7,     -2 } },
+  { .h = {       -499,       6601,     -31183,     102611,    -273875,     633250,   -1315322,    2511820,
+             -4483800,    7581779,  -12292256,   19359752,  -30130256,   47651363,  -81274386,  181338192,
+           2124584196, -153292707,   73891323,  -44151334,   28065568,  -18025238,   11403221,   -6991987,
+              4102646,   -2275761,    1177232,    -558120,     236588,     -86200,      25075 },
+    .d = {      0,     -1,      3,    -10,     27,    -63,    129,   -246,    437,   -736,
+             1190,  -1871,   2912,  -4618,   7955, -18447,   4297,  13190,  -6577,   3965,
+            -2527,   1622,  -1024,    626,   -366,    202,   -104,     49,    -20,      7,     -2 } },
+  { .h = {       -484,       6421,     -30358,      99950,    -266860,     617179,   -1282178,    2448884,
+             -4371970,    7393378,  -11987643,   18880792,  -29384875,   46469156,  -79237919,  176615712,
+           2125684186, -149916107,   72207528,  -43136176,   27418702,  -17609948,   11141021,   -6831722,
+              4009000,   -2224087,    1150676,    -545634,     231353,     -84322,      24543 },
+    .d = {      0,     -1,      3,    -10,     27,    -63,    129,   -246,    437,   -736,
+             1190,  -1871,   2911,  -4616,   7948, -18392,   4192,  13263,  -6603,   3979,
+            -2535,   1628,  -1028,    628,   -367,    203,   -104,     49,    -21,      7,     -2 } },
+  { .h = {       -468,       6241,     -29537,      97295,    -259860,     601133,   -1249071,    2386002,
+             -4260210,    7205059,  -11683122,   18401939,  -28639659,   45287394,  -77203282,  171907264,
+           2126757350, -146520843,   70517154,  -42117492,   26769665,  -17193253,   10877908,   -6670874,
+              3914992,   -2172199,    1124001,    -533087,     226090,     -82433,      24006 },
+    .d = {      0,     -1,      3,    -10,     27,    -63,    129,   -245,    436,   -735,
+             1189,  -1870,   2910,  -4614,   7940, -18337,   4087,  13336,  -6629,   3993,
+            -2544,   1633,  -1031,    631,   -369,    204,   -105,     49,    -21,      7,     -2 } },
+  { .h = {       -452,       6062,     -28719,      94648,    -252873,     585111,   -1216003,    2323175,
+             -4148524,    7016830,  -11378705,   17923210,  -27894638,   44106118,  -75170544,  167212925,
+           2127803664, -143106953,   68820250,  -41095316,   26118477,  -16775169,   10613890,   -6509446,
+              3820627,   -2120100,    1097209,    -520479,     220798,     -80531,      23465 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    129,   -245,    436,   -735,
+             1189,  -1869,   2909,  -4612,   7933, -18282,   3982,  13408,  -6654,   4006,
+            -2552,   1639,  -1035,    633,   -370,    204,   -105,     49,    -21,      7,     -2 } },
+  { .h = {       -437,       5884,     -27903,      92008,    -245901,     569114,   -1182975,    2260407,
+             -4036916,    6828699,  -11074403,   17444625,  -27149840,   42925374,  -73139775,  162532772,
+           2128823102, -139674474,   67116863,  -40069680,   25465160,  -16355707,   10348975,   -6347443,
+              3725905,   -2067791,    1070299,    -507811,     215478,     -78619,      22921 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    129,   -245,    436,   -734,
+             1188,  -1869,   2908,  -4610,   7925, -18226,   3877,  13481,  -6679,   4020,
+            -2560,   1644,  -1038,    635,   -371,    205,   -106,     50,    -21,      8,     -2 } },
+  { .h = {       -422,       5707,     -27091,      89375,    -238943,     553143,   -1149989,    2197701,
+             -3925391,    6640672,  -10770229,   16966199,  -26405292,   41745204,  -71111044,  157866881,
+           2129815641, -136223446,   65407040,  -39040615,   24809735,  -15934883,   10083172,   -6184873,
+              3630831,   -2015273,    1043274,    -495083,     210129,     -76694,      22372 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    129,   -245,    435,   -734,
+             1188,  -1868,   2907,  -4608,   7916, -18170,   3772,  13553,  -6704,   4033,
+            -2568,   1649,  -1042,    637,   -373,    206,   -106,     50,    -21,      8,     -2 } },
+  { .h = {       -407,       5531,     -26282,      86749,    -231999,     537198,   -1117046,    2135057,
+             -3813952,    6452756,  -10466193,   16487953,  -25661023,   40565652,  -69084421,  153215328,
+           2130781258, -132753906,   63690831,  -38008155,   24152223,  -15512709,    9816490,   -6021738,
+              3535407,   -1962548,    1016133,    -482295,     204753,     -74758,      21819 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    129,   -244,    435,   -734,
+             1187,  -1867,   2906,  -4605,   7908, -18114,   3667,  13625,  -6729,   4046,
+            -2576,   1654,  -1045,    639,   -374,    207,   -106,     50,    -21,      8,     -2 } },
+  { .h = {       -392,       5355,     -25475,      84130,    -225071,     521280,   -1084146,    2072479,
+             -3702605,    6264960,  -10162307,   16009905,  -24917060,   39386762,  -67059973,  148578190,
+           2131719931, -129265895,   61968284,  -36972332,   23492647,  -15089201,    9548938,   -5858045,
+              3439637,   -1909617,     988877,    -469448,     199348,     -72810,      21262 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    128,   -244,    435,   -733,
+             1186,  -1867,   2905,  -4602,   7899, -18057,   3561,  13697,  -6753,   4059,
+            -2584,   1659,  -1048,    642,   -375,    208,   -107,     50,    -21,      8,     -2 } },
+  { .h = {       -378,       5181,     -24672,      81519,    -218158,     505389,   -1051292,    2009969,
+             -3591352,    6077289,   -9858583,   15532071,  -24173432,   38208577,  -65037771,  143955541,
+           2132631636, -125759453,   60239449,  -35933179,   22831027,  -14664371,    9280524,   -5693799,
+              3343523,   -1856483,     961507,    -456542,     193916,     -70851,      20702 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    128,   -244,    434,   -733,
+             1186,  -1866,   2903,  -4599,   7890, -18000,   3456,  13769,  -6778,   4072,
+            -2592,   1665,  -1052,    644,   -377,    208,   -107,     51,    -21,      8,     -2 } },
+  { .h = {       -363,       5008,     -23871,      78915,    -211260,     489527,   -1018483,    1947529,
+             -3480199,    5889751,   -9555033,   15054471,  -23430166,   37031139,  -63017882,  139347456,
+           2133516355, -122234619,   58504374,  -34890731,   22167386,  -14238235,    9011258,   -5529006,
+              3247068,   -1803147,     934024,    -443577,     188456,     -68880,      20137 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    128,   -244,    434,   -732,
+             1185,  -1865,   2902,  -4596,   7881, -17943,   3350,  13841,  -6802,   4085,
+            -2600,   1670,  -1055,    646,   -378,    209,   -108,     51,    -21,      8,     -2 } },
+  { .h = {       -349,       4836,     -23074,      76319,    -204377,     473693,    -985723,    1885162,
+             -3369150,    5702353,   -9251667,   14577121,  -22687291,   35854493,  -61000375,  134754009,
+           2134374064, -118691435,   56763109,  -33845019,   21501746,  -13810806,    8741148,   -5363670,
+              3150276,   -1749610,     906429,    -430554,     182969,     -66897,      19568 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    128,   -243,    433,   -731,
+             1184,  -1864,   2900,  -4593,   7871, -17886,   3245,  13912,  -6826,   4097,
+            -2608,   1675,  -1058,    648,   -379,    210,   -108,     51,    -22,      8,     -2 } },
+  { .h = {       -335,       4665,     -22280,      73731,    -197511,     457889,    -953011,    1822869,
+             -3258207,    5515102,   -8948497,   14100041,  -21944833,   34678680,  -58985318,  130175273,
+           2135204746, -115129943,   55015705,  -32796078,   20834128,  -13382098,    8470202,   -5197797,
+              3053150,   -1695874,     878723,    -417473,     177454,     -64904,      18995 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    128,   -243,    433,   -731,
+             1183,  -1862,   2898,  -4590,   7861, -17828,   3139,  13983,  -6850,   4110,
+            -2616,   1680,  -1062,    650,   -381,    211,   -109,     51,    -22,      8,     -2 } },
+  { .h = {       -321,       4495,     -21489,      71150,    -190661,     442114,    -920349,    1760654,
+             -3147377,    5328005,   -8645534,   13623248,  -21202820,   33503743,  -56972778,  125611322,
+           2136008379, -111550184,   53262211,  -31743941,   20164555,  -12952127,    8198432,   -5031393,
+              2955692,   -1641941,     850906,    -404334,     171912,     -62899,      18419 },
+    .d = {      0,     -1,      3,    -10,     27,    -62,    127,   -243,    432,   -730,
+             1183,  -1861,   2897,  -4586,   7851, -17770,   3033,  14055,  -6873,   4122,
+            -2623,   1684,  -1065,    652,   -382,    211,   -109,     52,    -22,      8,     -2 } },
+  { .h = {       -308,       4325,     -20701,      68576,    -183827,     426370,    -887738,    1698518,
+             -3036663,    5141069,   -8342790,   13146760,  -20461281,   32329726,  -54962824,  121062229,
+           2136784946, -107952202,   51502679,  -30688643,   19493049,  -12520905,    7925844,   -4864462,
+              2857907,   -1587812,     822979,    -391138,     166343,     -60882,      17838 },
+    .d = {      0,     -1,      3,    -10,     27,    -61,    127,   -242,    432,   -730,
+             1182,  -1860,   2895,  -4582,   7841, -17712,   2928,  14126,  -6897,   4134,
+            -2631,   1689,  -1068,    654,   -383,    212,   -110,     52,    -22,      8,     -2 } },
+  { .h = {       -294,       4157,     -19916,      66011,    -177009,     410656,    -855179,    1636464,
+             -2926068,    4954301,   -8040277,   12670595,  -19720242,   31156670,  -52955522,  116528065,
+           2137534429, -104336040,   49737160,  -29630217,   18819633,  -12088448,    7652448,   -4697011,
+              2759796,   -1533489,     794942,    -377885,     160746,     -58854,      17253 },
+    .d = {      0,     -1,      3,    -10,     27,    -61,    127,   -242,    432,   -729,
+             1181,  -1859,   2893,  -4578,   7830, -17653,   2822,  14196,  -6920,   4147,
+            -2638,   1694,  -1071,    656,   -385,    213,   -110,     52,    -22,      8,     -2 } },
+  { .h = {       -281,       3990,     -19135,      63454,    -170209,     394974,    -822674,    1574494,
+             -2815598,    4767708,   -7738005,   12194771,  -18979731,   29984619,  -50950939,  112008904,
+           2138256809, -100701741,   47965704,  -28568698,   18144329,  -11654771,    7378255,   -4529046,
+              2661363,   -1478975,     766798,    -364576,     155123,     -56815,      16665 },
+    .d = {      0,     -1,      3,    -10,     26,    -61,    127,   -242,    431,   -728,
+             1180,  -1857,   2890,  -4574,   7820, -17594,   2716,  14267,  -6943,   4159,
+            -2645,   1699,  -1074,    658,   -386,    214,   -110,     52,    -22,      8,     -2 } },
+  { .h = {       -268,       3824,     -18357,      60905,    -163425,     379324,    -790223,    1512611,
+             -2705256,    4581297,   -7435986,   11719304,  -18239775,   28813615,  -48949143,  107504815,
+           2138952071,  -97049350,   46188364,  -27504121,   17467159,  -11219887,    7103271,   -4360570,
+              2562612,   -1424270,     738547,    -351210,     149473,     -54765,      16072 },
+    .d = {      0,     -1,      3,    -10,     26,    -61,    127,   -241,    431,   -727,
+             1179,  -1856,   2888,  -4570,   7808, -17535,   2610,  14338,  -6966,   4170,
+            -2652,   1703,  -1077,    660,   -387,    214,   -111,     52,    -22,      8,     -2 } },
+  { .h = {       -255,       3659,     -17582,      58363,    -156659,     363706,    -757828,    1450816,
+             -2595046,    4395074,   -7134230,   11244214,  -17500402,   27643699,  -46950199,  103015870,
+           2139620197,  -93378911,   44405192,  -26436519,   16788147,  -10783812,    6827508,   -4191591,
+              2463546,   -1369376,     710189,    -337789,     143797,     -52703,      15476 },
+    .d = {      0,     -1,      3,    -10,     26,    -61,    126,   -241,    430,   -727,
+             1178,  -1854,   2886,  -4566,   7797, -17476,   2504,  14408,  -6988,   4182,
+            -2660,   1708,  -1080,    662,   -388,    215,   -111,     53,    -22,      8,     -2 } },
+  { .h = {       -243,       3494,     -16810,      55830,    -149910,     348121,    -725490,    1389111,
+             -2484972,    4209048,   -6832750,   10769517,  -16761639,   26474914,  -44954175,   98542140,
+           2140261173,  -89690470,   42616239,  -25365928,   16107315,  -10346561,    6550974,   -4022114,
+              2364167,   -1314295,     681726,    -324312,     138094,     -50631,      14875 },
+    .d = {      0,     -1,      3,    -10,     26,    -61,    126,   -241,    429,   -726,
+             1177,  -1853,   2883,  -4561,   7785, -17416,   2398,  14478,  -7010,   4194,
+            -2667,   1713,  -1083,    664,   -389,    216,   -112,     53,    -22,      8,     -2 } },
+  { .h = {       -230,       3331,     -16041,      53306,    -143178,     332570,    -693210,    1327500,
+             -2375038,    4023224,   -6531557,   10295232,  -16023513,   25307302,  -42961136,   94083693,
+           2140874983,  -85984073,   40821559,  -24292383,   15424686,   -9908147,    6273678,   -3852144,
+              2264479,   -1259029,     653157,    -310780,     132365,     -48547,      14271 },
+    .d = {      0,     -1,      3,    -10,     26,    -61,    126,   -240,    429,   -725,
+             1175,  -1851,   2881,  -4556,   7773, -17356,   2292,  14548,  -7033,   4205,
+            -2673,   1717,  -1086,    666,   -391,    217,   -112,     53,    -22,      8,     -2 } },
+  { .h = {       -218,       3169,     -15276,      50789,    -136465,     317053,    -660989,    1265984,
+             -2265249,    3837609,   -6230661,    9821375,  -15286052,   24140905,  -40971148,   89640600,
+           2141461613,  -82259766,   39021205,  -23215919,   14740283,   -9468587,    5995631,   -3681687,
+              2164486,   -1203580,     624485,    -297194,     126610,     -46452,      13662 },
+    .d = {      0,     -1,      3,    -10,     26,    -60,    126,   -240,    428,   -724,
+             1174,  -1849,   2878,  -4551,   7761, -17296,   2185,  14618,  -7055,   4216,
+            -2680,   1721,  -1089,    668,   -392,    217,   -112,     53,    -23,      8,     -2 } },
+  { .h = {       -206,       3008,     -14514,      48281,    -129770,     301571,    -628828,    1204565,
+             -2155609,    3652211,   -5930074,    9347964,  -14549281,   22975765,  -38984277,   85212929,
+           2142021049,  -78517597,   37215229,  -22136572,   14054129,   -9027895,    5716840,   -3510749,
+              2064190,   -1147949,     595710,    -283554,     120829,     -44347,      13050 },
+    .d = {      0,     -1,      3,    -10,     26,    -60,    125,   -240,    428,   -723,
+             1173,  -1847,   2875,  -4546,   7749, -17235,   2079,  14687,  -7076,   4227,
+            -2687,   1726,  -1092,    670,   -393,    218,   -113,     53,    -23,      8,     -2 } },
+  { .h = {       -194,       2848,     -13756,      45782,    -123093,     286124,    -596729,    1143246,
+             -2046120,    3467036,   -5629806,    8875018,  -13813229,   21811922,  -37000587,   80800749,
+           2142553278,  -74757612,   35403685,  -21054376,   13366248,   -8586085,    5437317,   -3339336,
+              1963595,   -1092138,     566833,    -269860,     115022,     -42230,      12434 },
+    .d = {      0,     -1,      3,    -10,     26,    -60,    125,   -239,    427,   -722,
+             1172,  -1846,   2872,  -4541,   7736, -17174,   1973,  14757,  -7098,   4238,
+            -2694,   1730,  -1095,    671,   -394,    219,   -113,     54,    -23,      8,     -2 } },
+  { .h = {       -182,       2689,     -13000,      43291,    -116435,     270713,    -564693,    1082029,
+             -1936788,    3282090,   -5329870,    8402552,  -13077922,   20649420,  -35020145,   76404128,
+           2143058289,  -70979859,   33586628,  -19969368,   12676663,   -8143174,    5157070,   -3167453,
+              1862705,   -1036148,     537855,    -256112,     109189,     -40102,      11814 },
+    .d = {      0,     -1,      3,    -10,     26,    -60,    125,   -239,    426,   -722,
+             1170,  -1844,   2869,  -4536,   7723, -17113,   1866,  14826,  -7119,   4249,
+            -2700,   1734,  -1098,    673,   -395,    219,   -114,     54,    -23,      8,     -2 } },
+  { .h = {       -170,       2530,     -12248,      40808,    -109795,     255338,    -532720,    1020916,
+             -1827617,    3097382,   -5030275,    7930585,  -12343387,   19488299,  -33043014,   72023133,
+           2143536068,  -67184388,   31764111,  -18881583,   11985398,   -7699177,    4876108,   -2995106,
+              1761522,    -979983,     508776,    -242311,     103331,     -37964,      11190 },
+    .d = {      0,     -1,      3,    -10,     26,    -60,    125,   -238,    426,   -721,
+             1169,  -1842,   2866,  -4530,   7710, -17052,   1760,  14895,  -7140,   4260,
+            -2707,   1739,  -1100,    675,   -396,    220,   -114,     54,    -23,      8,     -2 } },
+  { .h = {       -159,       2373,     -11500,      38335,    -103175,     239999,    -500813,     959910,
+             -1718609,    2912917,   -4731034,    7459134,  -11609650,   18328599,  -31069260,   67657832,
+           2143986605,  -63371247,   29936188,  -17791058,   11292475,   -7254108,    4594443,   -2822301,
+              1660049,    -923643,     479598,    -228458,      97448,     -35815,      10562 },
+    .d = {      0,     -1,      3,    -10,     26,    -60,    124,   -238,    425,   -720,
+             1167,  -1840,   2863,  -4524,   7697, -16990,   1653,  14964,  -7161,   4270,
+            -2713,   1743,  -1103,    677,   -397,    221,   -114,     54,    -23,      8,     -2 } },
+  { .h = {       -148,       2217,     -10755,      35870,     -96573,     224698,    -468971,     899012,
+             -1609770,    2728702,   -4432156,    6988216,  -10876739,   17170364,  -29098946,   63308290,
+           2144409890,  -59540487,   28102916,  -16697829,   10597920,   -6807983,    4312082,   -2649044,
+              1558292,    -867130,     450322,    -214553,      91539,     -33655,       9931 },
+    .d = {      0,     -1,      3,    -10,     26,    -60,    124,   -237,    424,   -719,
+             1166,  -1837,   2860,  -4518,   7683, -16929,   1547,  15033,  -7182,   4281,
+            -2719,   1747,  -1106,    679,   -399,    221,   -115,     55,    -23,      8,     -2 } },
+  { .h = {       -137,       2062,     -10013,      33414,     -89992,     209435,    -437196,     838224,
+             -1501103,    2544744,   -4133653,    6517848,  -10144680,   16013633,  -27132137,   58974573,
+           2144805912,  -55692156,   26264348,  -15601931,    9901754,   -6360817,    4029037,   -2475340,
+              1456252,    -810447,     420948,    -200596,      85605,     -31484,       9295 },
+    .d = {      0,     -1,      3,    -10,     26,    -59,    124,   -237,    424,   -718,
+             1165,  -1835,   2856,  -4512,   7669, -16867,   1440,  15101,  -7202,   4291,
+            -2726,   1751,  -1108,    680,   -400,    222,   -115,     55,    -23,      9,     -2 } },
+  { .h = {       -126,       1908,      -9275,      30967,     -83429,     194210,    -405490,     777549,
+             -1392612,    2361049,   -3835536,    6048048,   -9413499,   14858447,  -25168896,   54656748,
+           2145174663,  -51826306,   24420541,  -14503403,    9204003,   -5912626,    3745316,   -2301196,
+              1353933,    -753595,     391477,    -186587,      79647,     -29303,       8656 },
+    .d = {      0,     -1,      3,    -10,     26,    -59,    124,   -237,    423,   -717,
+             1163,  -1833,   2853,  -4506,   7655, -16804,   1334,  15169,  -7223,   4301,
+            -2732,   1755,  -1111,    682,   -401,    223,   -115,     55,    -23,      9,     -3 } },
+  { .h = {       -115,       1755,      -8540,      28529,     -76887,     179024,    -373852,     716989,
+             -1284301,    2177625,   -3537815,    5578832,   -8683223,   13704847,  -23209287,   50354879,
+           2145516133,  -47942988,   22571549,  -13402279,    8504691,   -5463425,    3460929,   -2126618,
+              1251338,    -696575,     361911,    -172528,      73663,     -27111,       8013 },
+    .d = {      0,     -1,      3,     -9,     25,    -59,    123,   -236,    422,   -715,
+             1161,  -1831,   2849,  -4500,   7640, -16742,   1227,  15237,  -7243,   4311,
+            -2738,   1759,  -1113,    684,   -402,    223,   -116,     55,    -23,      9,     -3 } },
+  { .h = {       -104,       1603,      -7809,      26100,     -70365,     163877,    -342285,     656546,
+             -1176174,    1994478,   -3240501,    5110218,   -7953879,   12552874,  -21253374,   46069030,
+           2145830315,  -44042253,   20717430,  -12298598,    7803841,   -5013231,    3175887,   -1951612,
+              1148472,    -639390,     332250,    -158418,      67656,     -24908,       7366 },
+    .d = {      0,     -1,      3,     -9,     25,    -59,    123,   -236,    422,   -714,
+             1160,  -1828,   2845,  -4493,   7626, -16679,   1121,  15305,  -7262,   4321,
+            -2744,   1762,  -1116,    685,   -403,    224,   -116,     55,    -24,      9,     -3 } },
+  { .h = {        -94,       1452,      -7081,      23680,     -63863,     148770,    -310790,     596223,
+             -1068235,    1811614,   -2943606,    4642223,   -7225491,   11402568,  -19301218,   41799266,
+           2146117201,  -40124154,   18858239,  -11192397,    7101477,   -4562058,    2890199,   -1776183,
+              1045337,    -582042,     302495,    -144258,      61623,     -22695,       6715 },
+    .d = {      0,     -1,      3,     -9,     25,    -59,    123,   -235,    421,   -713,
+             1158,  -1826,   2841,  -4487,   7611, -16616,   1014,  15373,  -7282,   4331,
+            -2749,   1766,  -1118,    687,   -404,    225,   -117,     56,    -24,      9,     -3 } },
+  { .h = {        -84,       1302,      -6357,      21270,     -57381,     133704,    -279367,     536020,
+              -960486,    1629040,   -2647140,    4174863,   -6498088,   10253969,  -17352882,   37545650,
+           2146376785,  -36188744,   16994033,  -10083711,    6397625,   -4109922,    2603875,   -1600337,
+               941938,    -524533,     272648,    -130048,      55567,     -20472,       6060 },
+    .d = {      0,     -1,      3,     -9,     25,    -59,    122,   -235,    420,   -712,
+             1156,  -1823,   2837,  -4480,   7596, -16552,    907,  15440,  -7301,   4340,
+            -2755,   1770,  -1121,    688,   -405,    225,   -117,     56,    -24,      9,     -3 } },
+  { .h = {        -74,       1154,      -5637,      18869,     -50920,     118678,    -248018,     475941,
+              -852934,    1446762,   -2351113,    3708156,   -5771694,    9107118,  -15408430,   33308246,
+           2146609061,  -32236076,   15124869,   -8972580,    5692308,   -3656839,    2316925,   -1424081,
+               838276,    -466864,     242708,    -115789,      49487,     -18238,       5402 },
+    .d = {      0,     -1,      3,     -9,     25,    -59,    122,   -234,    419,   -711,
+             1155,  -1820,   2833,  -4473,   7580, -16489,    801,  15507,  -7321,   4350,
+            -2761,   1773,  -1123,    690,   -406,    226,   -117,     56,    -24,      9,     -3 } },
+  { .h = {        -64,       1006,      -4919,      16477,     -44480,     103693,    -216743,     415987,
+              -745580,    1264788,   -2055537,    3242118,   -5046336,    7962054,  -13467923,   29087114,
+           2146814023,  -28266203,   13250804,   -7859040,    4985550,   -3202825,    2029359,   -1247421,
+               734357,    -409037,     212677,    -101482,      43382,     -15994,       4740 },
+    .d = {      0,     -1,      3,     -9,     25,    -58,    122,   -234,    419,   -710,
+             1153,  -1818,   2829,  -4466,   7564, -16425,    694,  15574,  -7339,   4359,
+            -2766,   1777,  -1126,    692,   -407,    226,   -118,     56,    -24,      9,     -3 } },
+  { .h = {        -54,        859,      -4206,      14094,     -38061,      88751,    -185544,     356161,
+              -638430,    1083123,   -1760421,    2776767,   -4322040,    6818819,  -11531423,   24882319,
+           2146991666,  -24279180,   11371896,   -6743128,    4277377,   -2747896,    1741187,   -1070363,
+               630184,    -351055,     182557,     -87126,      37255,     -13739,       4074 },
+    .d = {      0,     -1,      3,     -9,     25,    -58,    122,   -233,    418,   -708,
+             1151,  -1815,   2825,  -4458,   7549, -16361,    587,  15641,  -7358,   4368,
+            -2772,   1781,  -1128,    693,   -408,    227,   -118,     56,    -24,      9,     -3 } },
+  { .h = {        -45,        713,      -3496,      11721,     -31663,      73850,    -154422,     296465,
+              -531486,     901775,   -1465777,    2312118,   -3598831,    5677450,   -9598992,   20693920,
+           2147141986,  -20275062,    9488202,   -5624884,    3567813,   -2292067,    1452419,    -892913,
+               525759,    -292918,     152348,     -72722,      31103,     -11474,       3404 },
+    .d = {      0,     -1,      3,     -9,     25,    -58,    121,   -233,    417,   -707,
+             1149,  -1812,   2821,  -4451,   7532, -16297,    480,  15708,  -7377,   4377,
+            -2777,   1784,  -1130,    695,   -409,    228,   -118,     56,    -24,      9,     -3 } },
+  { .h = {        -36,        568,      -2789,       9357,     -25287,      58993,    -123378,     236900,
+              -424753,     720749,   -1171616,    1848189,   -2876736,    4537989,   -7670691,   16521980,
+           2147264981,  -16253904,    7599782,   -4504345,    2856883,   -1835356,    1163066,    -715077,
+               421087,    -234630,     122050,     -58270,      24928,      -9200,       2731 },
+    .d = {      0,     -1,      3,     -9,     25,    -58,    121,   -232,    416,   -706,
+             1147,  -1809,   2816,  -4443,   7516, -16232,    374,  15774,  -7395,   4386,
+            -2782,   1787,  -1133,    696,   -410,    228,   -119,     57,    -24,      9,     -3 } },
+  { .h = {        -26,        425,      -2087,       7003,     -18932,      44179,     -92413,     177470,
+              -318234,     540052,    -877947,    1384996,   -2155779,    3400474,   -5746580,   12366558,
+           2147360646,  -12215763,    5706692,   -3381548,    2144612,   -1377777,     873137,    -536862,
+               316172,    -176193,      91666,     -43772,      18731,      -6915,       2054 },
+    .d = {      0,     -1,      3,     -9,     25,    -58,    121,   -232,    415,   -705,
+             1145,  -1806,   2812,  -4436,   7499, -16167,    267,  15840,  -7413,   4395,
+            -2787,   1791,  -1135,    698,   -411,    229,   -119,     57,    -24,      9,     -3 } },
+  { .h = {        -17,        282,      -1387,       4659,     -12599,      29408,     -61527,     118175,
+              -211933,     359691,    -584781,     922556,   -1435988,    2264944,   -3826721,    8227714,
+           2147428980,   -8160693,    3808993,   -2256533,    1431024,    -919347,     582643,    -358273,
+               211017,    -117607,      61195,     -29227,      12510,      -4620,       1373 },
+    .d = {      0,     -1,      3,     -9,     25,    -58,    120,   -231,    414,   -703,
+             1143,  -1803,   2807,  -4428,   7483, -16102,    160,  15906,  -7431,   4403,
+            -2792,   1794,  -1137,    699,   -412,    229,   -119,     57,    -24,      9,     -3 } },
+  { .h = {         -9,        141,       -692,       2325,      -6289,      14682,     -30723,      59017,
+              -105854,     179671,    -292128,     460885,    -717386,    1131440,   -1911174,    4105509,
+           2147469981,   -4088753,    1906742,   -1129337,     716145,    -460083,     291594,    -179317,
+               105625,     -58875,      30640,     -14637,       6266,      -2315,        688 },
+    .d = {      0,     -1,      3,     -9,     25,    -57,    120,   -231,    413,   -702,
+             1141,  -1800,   2802,  -4420,   7466, -16037,     53,  15972,  -7448,   4411,
+            -2797,   1797,  -1139,    700,   -413,    230,   -120,     57,    -24,      9,     -3 } },
 
   }
 };
@@ -24,10 +24,15 @@ extern const struct ResamplerTables {
   static const int KERNEL_Q = 512;
   static const int KERNEL_A = 16;
 
-  const int32_t h alignas(2 * KERNEL_A *
-                          sizeof(int32_t))[KERNEL_Q][2 * KERNEL_A];
-  const int16_t d alignas(2 * KERNEL_A *
-                          sizeof(int16_t))[KERNEL_Q][2 * KERNEL_A];
+  // The filter evaluation at a phase streams the coefficients `h` and their
+  // interpolation slopes `d`, which are interleaved in contiguous cache lines.
+
+  struct alignas(64) Phase {
+    int32_t h[2 * KERNEL_A];
+    int16_t d[2 * KERNEL_A];
+  };
+
+  const Phase phases[KERNEL_Q];
 
 } resampler_tables;
 
@@ -80,26 +80,17 @@ print("""\
 // clang-format off
 const ResamplerTables resampler_tables = {
 
-  .h = {
+  .phases = {
 """)
 for q in range(len(h) - 1):
-    layout = "  {{" + " {:10d}," * 8 + "\n" + \
-              "   " + " {:10d}," * 8 + "\n" + \
-              "   " + " {:10d}," * 8 + "\n" + \
-              "   " + " {:10d}," * 6 + " {:10d} }},"
-    print(layout.format(*h32[q]))
-print("""
-  },
-""")
-
-print("""\
-  .d = {
-""")
-for q in range(len(h) - 1):
-    layout = "  {{" + " {:6d}," * 10 + "\n" + \
-              "   " + " {:6d}," * 10 + "\n" + \
-              "   " + " {:6d}," * 10 + " {:2d} }},"
-    print(layout.format(*d32[q]))
+    layout = "  {{ .h = {{" + " {:10d}," * 8 + "\n" + \
+              "          " + " {:10d}," * 8 + "\n" + \
+              "          " + " {:10d}," * 8 + "\n" + \
+              "          " + " {:10d}," * 6 + " {:10d} }},\n" + \
+              "    .d = {{" + " {:6d}," * 10 + "\n" + \
+              "          " + " {:6d}," * 10 + "\n" + \
+              "          " + " {:6d}," * 10 + " {:6d} }} }},"
+    print(layout.format(*h32[q], *d32[q]))
 print("""
   }
 };
@@ -21,6 +21,7 @@
 #include <android/binder_manager.h>
 #include <android_bluetooth_flags.h>
 
+#include <cstring>
 #include <thread>
 #include <vector>
 
@@ -55,6 +56,7 @@ BluetoothAudioClientInterface::BluetoothAudioClientInterface(
       provider_factory_(nullptr),
       session_started_(false),
       data_mq_(nullptr),
+      data_mq_event_flag_(nullptr),
       transport_(instance),
       latency_modes_({LatencyMode::FREE}) {
   death_recipient_ = ::ndk::ScopedAIBinder_DeathRecipient(
@@ -414,7 +416,7 @@ int BluetoothAudioClientInterface::StartSession() {
   data_mq.reset(new DataMQ(mq_desc));
 
   if (data_mq && data_mq->isValid()) {
-    data_mq_ = std::move(data_mq);
+    SetDataMq(std::move(data_mq));
   } else if (transport_->GetSessionType() ==
                  SessionType::A2DP_HARDWARE_OFFLOAD_ENCODING_DATAPATH ||
              transport_->GetSessionType() ==
@@ -499,7 +501,7 @@ int BluetoothAudioClientInterface::EndSession() {
     LOG(ERROR) << __func__ << ": BluetoothAudioHal nullptr";
     return -EINVAL;
   }
-  data_mq_ = nullptr;
+  SetDataMq(nullptr);
 
   auto aidl_retval = provider_->endSession();
 
@@ -528,21 +530,61 @@ void BluetoothAudioClientInterface::FlushAudioData() {
     LOG(WARNING) << __func__ << ", data_mq_ invalid";
     return;
   }
+  // Drop the data in place, without reading it out of the fmq
   size_t size = data_mq_->availableToRead();
-  std::vector<MqDataType> buffer(size);
-
-  if (data_mq_->read(buffer.data(), size) != size) {
+  DataMQ::MemTransaction tx;
+  if (!data_mq_->beginRead(size, &tx) || !data_mq_->commitRead(size)) {
     LOG(WARNING) << __func__ << ", failed to flush data queue!";
   }
 }
 
+void BluetoothAudioClientInterface::SetDataMq(
+    std::unique_ptr<DataMQ> data_mq) {
+  if (data_mq_event_flag_ != nullptr) {
+    EventFlag::deleteEventFlag(&data_mq_event_flag_);
+  }
+  data_mq_ = std::move(data_mq);
+  if (data_mq_ == nullptr || data_mq_->getEventFlagWord() == nullptr) {
+    return;
+  }
+  if (EventFlag::createEventFlag(data_mq_->getEventFlagWord(),
+                                 &data_mq_event_flag_) != ::android::OK) {
+    LOG(WARNING) << __func__ << ": failed to create the fmq event flag";
+    data_mq_event_flag_ = nullptr;
+  }
+}
+
+void BluetoothAudioClientInterface::WaitForDataMq(uint32_t bits,
+                                                  int timeout_ms) {
+  if (data_mq_event_flag_ == nullptr) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+    return;
+  }
+  // Returns early when woken, HALs which do not wake the flag are still
+  // polled every |timeout_ms|
+  uint32_t state = 0;
+  data_mq_event_flag_->wait(bits, &state,
+                            static_cast<int64_t>(timeout_ms) * 1000000);
+}
+
 size_t BluetoothAudioSinkClientInterface::ReadAudioData(uint8_t* p_buf,
                                                         uint32_t len) {
+  if (p_buf == nullptr) return 0;
+
+  uint8_t* p_dst = p_buf;
+  return ReadAudioDataInPlace(len, [&p_dst](const uint8_t* p_src, size_t n) {
+    memcpy(p_dst, p_src, n);
+    p_dst += n;
+  });
+}
+
+size_t BluetoothAudioSinkClientInterface::ReadAudioDataInPlace(
+    uint32_t len, const AudioDataConsumer& consume) {
   if (!IsValid()) {
     LOG(ERROR) << __func__ << ": BluetoothAudioHal is not valid";
     return 0;
   }
-  if (p_buf == nullptr || len == 0) return 0;
+  if (len == 0) return 0;
 
   std::lock_guard<std::mutex> guard(internal_mutex_);
 
@@ -556,15 +598,21 @@ size_t BluetoothAudioSinkClientInterface::ReadAudioData(uint8_t* p_buf,
       if (avail_to_read > len - total_read) {
         avail_to_read = len - total_read;
       }
-      if (data_mq_->read((MqDataType*)p_buf + total_read, avail_to_read) == 0) {
+      DataMQ::MemTransaction tx;
+      if (!data_mq_->beginRead(avail_to_read, &tx)) {
         LOG(WARNING) << __func__ << ": len=" << len
                      << " total_read=" << total_read << " failed";
         break;
       }
+      for (const auto& region : {tx.getFirstRegion(), tx.getSecondRegion()}) {
+        if (region.getLength() == 0) continue;
+        consume(reinterpret_cast<const uint8_t*>(region.getAddress()),
+                region.getLength());
+      }
+      data_mq_->commitRead(avail_to_read);
       total_read += avail_to_read;
     } else if (timeout_ms >= kDefaultDataReadPollIntervalMs) {
-      std::this_thread::sleep_for(
-          std::chrono::milliseconds(kDefaultDataReadPollIntervalMs));
+      WaitForDataMq(kDataMqNotEmpty, kDefaultDataReadPollIntervalMs);
       timeout_ms -= kDefaultDataReadPollIntervalMs;
       continue;
     } else {
@@ -630,8 +678,7 @@ size_t BluetoothAudioSourceClientInterface::WriteAudioData(const uint8_t* p_buf,
       }
       total_written += avail_to_write;
     } else if (timeout_ms >= kDefaultDataWritePollIntervalMs) {
-      std::this_thread::sleep_for(
-          std::chrono::milliseconds(kDefaultDataWritePollIntervalMs));
+      WaitForDataMq(kDataMqNotFull, kDefaultDataWritePollIntervalMs);
       timeout_ms -= kDefaultDataWritePollIntervalMs;
       continue;
     } else {
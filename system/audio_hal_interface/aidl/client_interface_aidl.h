@@ -17,9 +17,11 @@
 #pragma once
 
 #include <fmq/AidlMessageQueue.h>
+#include <fmq/EventFlag.h>
 #include <hardware/audio.h>
 
 #include <ctime>
+#include <functional>
 #include <mutex>
 #include <vector>
 
@@ -59,6 +61,7 @@ using ::aidl::android::hardware::bluetooth::audio::PcmConfiguration;
 using ::aidl::android::hardware::common::fmq::MQDescriptor;
 using ::aidl::android::hardware::common::fmq::SynchronizedReadWrite;
 using ::android::AidlMessageQueue;
+using ::android::hardware::EventFlag;
 
 using MqDataType = int8_t;
 using MqDataMode = SynchronizedReadWrite;
@@ -169,6 +172,15 @@ class BluetoothAudioClientInterface {
 
   bool session_started_;
   std::unique_ptr<DataMQ> data_mq_;
+  // Event flag of |data_mq_|, when the audio HAL configured one, to wake up
+  // as soon as the other end of the fmq is written or read
+  EventFlag* data_mq_event_flag_;
+
+  /***
+   * Wait up to |timeout_ms| for the other end of the fmq to wake up
+   * |data_mq_event_flag_| with |bits|, or sleep without one
+   ***/
+  void WaitForDataMq(uint32_t bits, int timeout_ms);
 
   ::ndk::ScopedAIBinder_DeathRecipient death_recipient_;
   // static constexpr const char* kDefaultAudioProviderFactoryInterface =
@@ -177,6 +189,8 @@ class BluetoothAudioClientInterface {
       std::string() + IBluetoothAudioProviderFactory::descriptor + "/default";
 
  private:
+  void SetDataMq(std::unique_ptr<DataMQ> data_mq);
+
   IBluetoothTransportInstance* transport_;
   std::vector<AudioCapabilities> capabilities_;
   std::vector<LatencyMode> latency_modes_;
@@ -205,11 +219,22 @@ class BluetoothAudioSinkClientInterface : public BluetoothAudioClientInterface {
    ***/
   size_t ReadAudioData(uint8_t* p_buf, uint32_t len);
 
+  /***
+   * Read data from audio HAL through fmq, without copying it: |consume| is
+   * called with the contiguous regions of the fmq holding the data, two when
+   * it wraps around the end of the fmq, which is released once it returns.
+   ***/
+  using AudioDataConsumer =
+      std::function<void(const uint8_t* p_buf, size_t len)>;
+  size_t ReadAudioDataInPlace(uint32_t len, const AudioDataConsumer& consume);
+
  private:
   IBluetoothSinkTransportInstance* sink_;
 
   static constexpr int kDefaultDataReadTimeoutMs = 10;
   static constexpr int kDefaultDataReadPollIntervalMs = 1;
+  // FMQ_NOT_EMPTY, as woken by the writer of the fmq
+  static constexpr uint32_t kDataMqNotEmpty = 1 << 0;
 };
 
 class BluetoothAudioSourceClientInterface
@@ -237,6 +262,8 @@ class BluetoothAudioSourceClientInterface
 
   static constexpr int kDefaultDataWriteTimeoutMs = 10;
   static constexpr int kDefaultDataWritePollIntervalMs = 1;
+  // FMQ_NOT_FULL, as woken by the reader of the fmq
+  static constexpr uint32_t kDataMqNotFull = 1 << 1;
 };
 
 }  // namespace aidl
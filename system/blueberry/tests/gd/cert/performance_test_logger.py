@@ -14,7 +14,7 @@
 #   See the License for the specific language governing permissions and
 #   limitations under the License.
 
-from datetime import datetime
+from datetime import datetime, timedelta
 
 
 class PerformanceTestLogger(object):
@@ -69,3 +69,19 @@ class PerformanceTestLogger(object):
             self._check_interval_label(label)
             yield ((label, self.start_interval_points[label][i], self.end_interval_points[label][i])
                    for i in range(len(self.start_interval_points[label])))
+
+    def get_interval_summary(self, label):
+        """
+        Return a dictionary summarizing the intervals with specified label, in
+        a form that can be passed to record_data() so that results are written
+        to the machine readable test summary.
+        """
+        durations_ms = [interval / timedelta(milliseconds=1) for interval in self.get_duration_of_intervals(label)]
+        return {
+            "label": label,
+            "count": len(durations_ms),
+            "total_ms": sum(durations_ms),
+            "mean_ms": sum(durations_ms) / len(durations_ms),
+            "min_ms": min(durations_ms),
+            "max_ms": max(durations_ms),
+        }
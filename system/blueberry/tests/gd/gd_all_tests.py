@@ -27,6 +27,7 @@ from blueberry.tests.gd.iso.le_iso_test import LeIsoTest
 from blueberry.tests.gd.l2cap.classic.l2cap_performance_test import L2capPerformanceTest
 from blueberry.tests.gd.l2cap.classic.l2cap_test import L2capTest
 from blueberry.tests.gd.l2cap.le.dual_l2cap_test import DualL2capTest
+from blueberry.tests.gd.l2cap.le.le_l2cap_performance_test import LeL2capPerformanceTest
 from blueberry.tests.gd.l2cap.le.le_l2cap_test import LeL2capTest
 from blueberry.tests.gd.neighbor.neighbor_test import NeighborTest
 from blueberry.tests.gd.security.le_security_test import LeSecurityTest
@@ -39,7 +40,8 @@ from mobly import suite_runner
 ALL_TESTS = {
     CertSelfTest, SimpleHalTest, AclManagerTest, ControllerTest, DirectHciTest, LeAclManagerTest,
     LeAdvertisingManagerTest, LeScanningManagerTest, LeScanningWithSecurityTest, LeIsoTest, L2capPerformanceTest,
-    L2capTest, DualL2capTest, LeL2capTest, NeighborTest, LeSecurityTest, SecurityTest, ShimTest, StackTest
+    L2capTest, DualL2capTest, LeL2capPerformanceTest, LeL2capTest, NeighborTest, LeSecurityTest, SecurityTest,
+    ShimTest, StackTest
 }
 
 DISABLED_TESTS = set()
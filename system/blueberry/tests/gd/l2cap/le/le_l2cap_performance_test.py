@@ -0,0 +1,114 @@
+#
+#   Copyright 2020 - The Android Open Source Project
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+
+from datetime import timedelta
+
+import bluetooth_packets_python3 as bt_packets
+from blueberry.tests.gd.cert.matchers import L2capMatchers
+from blueberry.tests.gd.cert.truth import assertThat
+from blueberry.tests.gd.cert.performance_test_logger import PerformanceTestLogger
+from blueberry.tests.gd.cert import gd_base_test
+from blueberry.tests.gd.l2cap.le.le_l2cap_test import LeL2capTestBase
+
+from mobly import test_runner
+
+
+class LeL2capPerformanceTest(gd_base_test.GdBaseTestClass, LeL2capTestBase):
+    """
+    Measures throughput and latency of LE credit based channels. Each test
+    records a summary of its intervals with record_data(), so that results can
+    be compared across runs from the machine readable test summary.
+    """
+
+    def setup_class(self):
+        gd_base_test.GdBaseTestClass.setup_class(self, dut_module='L2CAP', cert_module='HCI_INTERFACES')
+
+    def setup_test(self):
+        gd_base_test.GdBaseTestClass.setup_test(self)
+        LeL2capTestBase.setup_test(self, self.dut, self.cert)
+        self.performance_test_logger = PerformanceTestLogger()
+
+    def teardown_test(self):
+        LeL2capTestBase.teardown_test(self)
+        gd_base_test.GdBaseTestClass.teardown_test(self)
+
+    def _record_intervals(self, label, payload_bytes=0):
+        summary = self.performance_test_logger.get_interval_summary(label)
+        if payload_bytes:
+            summary["throughput_kbps"] = payload_bytes * 8 / summary["total_ms"]
+        self.log.info("%s: %s" % (label, str(summary)))
+        self.record_data({"Test Name": self.current_test_info.name, "properties": summary})
+        return summary
+
+    def _credit_based_tx(self, mtu, packets):
+        """
+        Send the specified number of SDUs, each fitting in a single LE frame,
+        and return the duration of the transfer.
+        """
+        self._setup_link_from_cert()
+        # Give the DUT enough credits up front so the cert never has to top
+        # them up in the middle of the measurement.
+        (dut_channel, cert_channel) = self._open_channel_from_cert(mtu=mtu, mps=mtu + 2, initial_credit=packets)
+
+        self.performance_test_logger.start_interval("TX")
+        for _ in range(packets):
+            dut_channel.send(b'a' * mtu)
+        assertThat(cert_channel).emits(
+            L2capMatchers.FirstLeIFrame(b'a' * mtu, sdu_size=mtu),
+            at_least_times=packets,
+            timeout=timedelta(seconds=60))
+        self.performance_test_logger.end_interval("TX")
+
+        self._record_intervals("TX", payload_bytes=mtu * packets)
+        return self.performance_test_logger.get_duration_of_intervals("TX")[0]
+
+    def test_credit_based_tx_200_100(self):
+        duration = self._credit_based_tx(200, 100)
+        assertThat(duration).isWithin(timedelta(seconds=2))
+
+    def test_credit_based_tx_1000_100(self):
+        duration = self._credit_based_tx(1000, 100)
+        assertThat(duration).isWithin(timedelta(seconds=5))
+
+    def test_credit_based_end_to_end_latency(self):
+        self._setup_link_from_cert()
+        (dut_channel, cert_channel) = self._open_channel_from_cert()
+
+        data_packet = bt_packets.RawBuilder([0x61] * 100)
+        for _ in range(100):
+            self.performance_test_logger.start_interval("RX")
+            cert_channel.send_first_le_i_frame(100, data_packet)
+            assertThat(dut_channel).emits(L2capMatchers.PacketPayloadRawData(b'a' * 100))
+            self.performance_test_logger.end_interval("RX")
+
+        self._record_intervals("RX", payload_bytes=100 * 100)
+
+    def test_connection_setup_latency(self):
+        self.performance_test_logger.start_interval("LINK")
+        self._setup_link_from_cert()
+        self.performance_test_logger.end_interval("LINK")
+
+        for i in range(10):
+            self.performance_test_logger.start_interval("CHANNEL")
+            self._open_channel_from_cert(signal_id=i + 1, scid=0x0101 + i, psm=0x33 + 2 * i)
+            self.performance_test_logger.end_interval("CHANNEL")
+
+        self._record_intervals("LINK")
+        summary = self._record_intervals("CHANNEL")
+        assertThat(summary["max_ms"] < 1000).isTrue()
+
+
+if __name__ == '__main__':
+    test_runner.main()
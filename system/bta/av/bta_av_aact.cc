@@ -30,7 +30,9 @@
 #include <bluetooth/log.h>
 
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <map>
 #include <vector>
 
 #include "bta/av/bta_av_int.h"
@@ -68,6 +70,60 @@ namespace {
 
 constexpr char kBtmLogTag[] = "A2DP";
 
+/* Number of peers whose stream endpoint capabilities are remembered */
+constexpr size_t kPeerCapsCacheSize = 8;
+
+/* Capabilities returned by AVDTP Get (All) Capabilities, per peer and SEID.
+ * They are replayed on reconnection instead of querying every endpoint
+ * again, and dropped if opening the stream fails. */
+std::map<RawAddress, std::map<uint8_t, AvdtpSepConfig>> peer_caps_cache;
+uint64_t peer_caps_cache_hits = 0;
+
+bool peer_caps_cache_enabled() {
+  static const bool enabled =
+      osi_property_get_bool("bluetooth.core.a2dp.peer_caps_cache_enabled",
+                            false);
+  return enabled;
+}
+
+}  // namespace
+
+/*******************************************************************************
+ *
+ * Function         bta_av_cache_peer_caps
+ *
+ * Description      Remember the capabilities just received for the current
+ *                  stream endpoint of the peer.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+static void bta_av_cache_peer_caps(tBTA_AV_SCB* p_scb) {
+  if (!peer_caps_cache_enabled()) return;
+
+  const RawAddress& peer_address = p_scb->PeerAddress();
+  if (peer_caps_cache.find(peer_address) == peer_caps_cache.end() &&
+      peer_caps_cache.size() >= kPeerCapsCacheSize) {
+    peer_caps_cache.erase(peer_caps_cache.begin());
+  }
+  uint8_t seid = p_scb->sep_info[p_scb->sep_info_idx].seid;
+  peer_caps_cache[peer_address][seid] = p_scb->peer_cap;
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_av_peer_caps_cache_dump
+ *
+ * Description      Print the stream endpoint capabilities cache into dumpsys.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+void bta_av_peer_caps_cache_dump(int fd) {
+  dprintf(fd, "  Peer capabilities cache: %s peers: %zu hits: %llu\n",
+          peer_caps_cache_enabled() ? "enabled" : "disabled",
+          peer_caps_cache.size(),
+          static_cast<unsigned long long>(peer_caps_cache_hits));
 }
 
 /*****************************************************************************
@@ -324,6 +380,24 @@ static bool bta_av_next_getcap(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data) {
         (p_scb->sep_info[i].media_type == p_scb->media_type)) {
       p_scb->sep_info_idx = i;
 
+      /* capabilities already known from a previous connection */
+      if (peer_caps_cache_enabled()) {
+        auto peer = peer_caps_cache.find(p_scb->PeerAddress());
+        if (peer != peer_caps_cache.end()) {
+          auto cap = peer->second.find(p_scb->sep_info[i].seid);
+          if (cap != peer->second.end()) {
+            log::verbose("peer {} seid {} capabilities from cache",
+                         ADDRESS_TO_LOGGABLE_CSTR(p_scb->PeerAddress()),
+                         p_scb->sep_info[i].seid);
+            p_scb->peer_cap = cap->second;
+            peer_caps_cache_hits++;
+            bta_av_ssm_execute(p_scb, BTA_AV_STR_GETCAP_OK_EVT, p_data);
+            sent_cmd = true;
+            break;
+          }
+        }
+      }
+
       /* we got a stream; get its capabilities */
       bool get_all_cap = (p_scb->AvdtpVersion() >= AVDT_VERSION_1_3) &&
                          (A2DP_GetAvdtpVersion() >= AVDT_VERSION_1_3);
@@ -734,6 +808,8 @@ void bta_av_delay_co(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data) {
                p_data->str_msg.msg.delay_rpt_cmd.delay);
   p_scb->p_cos->delay(p_scb->hndl, p_scb->PeerAddress(),
                       p_data->str_msg.msg.delay_rpt_cmd.delay);
+  p_scb->sink_delay = p_data->str_msg.msg.delay_rpt_cmd.delay;
+  bta_av_update_audio_hold();
 }
 
 /*******************************************************************************
@@ -873,6 +949,8 @@ void bta_av_cleanup(tBTA_AV_SCB* p_scb, UNUSED_ATTR tBTA_AV_DATA* p_data) {
   p_scb->started = false;
   p_scb->use_rtp_header_marker_bit = false;
   p_scb->cong = false;
+  p_scb->sink_delay = 0;
+  p_scb->a2dp_hold = 0;
   p_scb->role = role;
   p_scb->cur_psc_mask = 0;
   p_scb->wait = 0;
@@ -1588,6 +1666,7 @@ void bta_av_save_caps(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data) {
       p_scb->num_seps, p_scb->sep_info_idx, p_scb->wait);
   log::verbose("codec: {}", A2DP_CodecInfoString(p_scb->peer_cap.codec_info));
 
+  bta_av_cache_peer_caps(p_scb);
   cfg = p_scb->peer_cap;
   /* let application know the capability of the SNK */
   if (p_scb->p_cos->getcfg(p_scb->hndl, p_scb->PeerAddress(), cfg.codec_info,
@@ -1668,6 +1747,9 @@ void bta_av_open_failed(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data) {
   p_scb->open_status = BTA_AV_FAIL_STREAM;
   bta_av_cco_close(p_scb, p_data);
 
+  /* the cached capabilities may be stale, query them again next time */
+  peer_caps_cache.erase(p_scb->PeerAddress());
+
   /* check whether there is already an opened audio or video connection with the
    * same device */
   for (idx = 0; (idx < BTA_AV_NUM_STRS) && (!is_av_opened); idx++) {
@@ -1728,6 +1810,8 @@ void bta_av_getcap_results(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data) {
   uint8_t media_type = A2DP_GetMediaType(p_scb->peer_cap.codec_info);
   tAVDT_SEP_INFO* p_info = &p_scb->sep_info[p_scb->sep_info_idx];
 
+  bta_av_cache_peer_caps(p_scb);
+
   cfg.num_codec = 1;
   cfg.num_protect = p_scb->peer_cap.num_protect;
   memcpy(cfg.codec_info, p_scb->peer_cap.codec_info, AVDT_CODEC_SIZE);
@@ -1980,6 +2064,7 @@ void bta_av_str_stopped(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data) {
 
     bta_av_stream_chg(p_scb, false);
     p_scb->co_started = false;
+    bta_av_update_audio_hold();
 
     p_scb->p_cos->stop(p_scb->hndl, p_scb->PeerAddress());
   }
@@ -2155,11 +2240,14 @@ void bta_av_data_path(tBTA_AV_SCB* p_scb, UNUSED_ATTR tBTA_AV_DATA* p_data) {
   p_scb->l2c_bufs =
       (uint8_t)L2CA_FlushChannel(p_scb->l2c_cid, L2CAP_FLUSH_CHANS_GET);
 
-  if (!list_is_empty(p_scb->a2dp_list)) {
+  if (list_length(p_scb->a2dp_list) > p_scb->a2dp_hold) {
     p_buf = (BT_HDR*)list_front(p_scb->a2dp_list);
     list_remove(p_scb->a2dp_list, p_buf);
     /* use q_info.a2dp data, read the timestamp */
     timestamp = *(uint32_t*)(p_buf + 1);
+  } else if (p_scb->a2dp_hold > 0) {
+    /* wait for a peer with a longer delay to duplicate enough data */
+    return;
   } else {
     new_buf = true;
     /* A2DP_list empty, call co_data, dup data to other channels */
@@ -2240,7 +2328,7 @@ void bta_av_data_path(tBTA_AV_SCB* p_scb, UNUSED_ATTR tBTA_AV_DATA* p_data) {
         list_append(p_scb->a2dp_list, p_buf);
       } else {
         /* just dequeue it from the a2dp_list */
-        if (list_length(p_scb->a2dp_list) < 3) {
+        if (list_length(p_scb->a2dp_list) < 3u + p_scb->a2dp_hold) {
           /* put it back to the queue */
           list_prepend(p_scb->a2dp_list, p_buf);
         } else {
@@ -2416,6 +2504,7 @@ void bta_av_start_ok(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data) {
     p_scb->p_cos->start(p_scb->hndl, p_scb->PeerAddress(),
                         p_scb->cfg.codec_info, &p_scb->no_rtp_header);
     p_scb->co_started = true;
+    bta_av_update_audio_hold();
 
     log::verbose("peer {} suspending: {}, role:0x{:x}, init {}",
                  ADDRESS_TO_LOGGABLE_CSTR(p_scb->PeerAddress()), suspend,
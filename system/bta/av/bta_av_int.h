@@ -155,6 +155,13 @@ enum {
  * queued to L2CAP */
 #define BTA_AV_QUEUE_DATA_CHK_NUM L2CAP_HIGH_PRI_MIN_XMIT_QUOTA
 
+/* Media packet interval assumed when converting the difference of delay
+ * reports of two peers sharing the encoded audio into packets to hold */
+#define BTA_AV_DUP_AUDIO_INTERVAL_MS 20
+
+/* Most packets held back on a peer to line it up with a slower one */
+#define BTA_AV_DUP_AUDIO_MAX_HOLD 10
+
 /* the number of ACL links with AVDT */
 #define BTA_AV_NUM_LINKS AVDT_NUM_LINKS
 
@@ -516,6 +523,8 @@ struct tBTA_AV_SCB final {
   tBTA_AV_SEP seps[BTAV_A2DP_CODEC_INDEX_MAX];
   AvdtpSepConfig peer_cap; /* buffer used for get capabilities */
   list_t* a2dp_list; /* used for audio channels only */
+  uint16_t sink_delay; /* last delay report of the peer, in 1/10 ms */
+  uint8_t a2dp_hold;   /* packets kept in a2dp_list to compensate latency */
   tBTA_AV_Q_INFO q_info;
   tAVDT_SEP_INFO sep_info[BTA_AV_NUM_SEPS]; /* stream discovery results */
   AvdtpSepConfig cfg;                       /* local SEP configuration */
@@ -750,6 +759,7 @@ void bta_av_free_scb(tBTA_AV_SCB* p_scb);
 /* main functions */
 void bta_av_api_deregister(tBTA_AV_DATA* p_data);
 void bta_av_dup_audio_buf(tBTA_AV_SCB* p_scb, BT_HDR* p_buf);
+void bta_av_update_audio_hold(void);
 void bta_av_sm_execute(tBTA_AV_CB* p_cb, uint16_t event, tBTA_AV_DATA* p_data);
 void bta_av_ssm_execute(tBTA_AV_SCB* p_scb, uint16_t event,
                         tBTA_AV_DATA* p_data);
@@ -846,6 +856,7 @@ void bta_av_offload_rsp(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data);
 void bta_av_vendor_offload_stop(void);
 void bta_av_st_rc_timer(tBTA_AV_SCB* p_scb, tBTA_AV_DATA* p_data);
 void bta_av_api_set_peer_sep(tBTA_AV_DATA* p_data);
+void bta_av_peer_caps_cache_dump(int fd);
 
 namespace fmt {
 template <>
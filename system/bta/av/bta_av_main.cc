@@ -27,6 +27,7 @@
 #include <base/logging.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
 #include <cstdint>
 
 #include "bta/av/bta_av_int.h"
@@ -1190,7 +1191,9 @@ void bta_av_dup_audio_buf(tBTA_AV_SCB* p_scb, BT_HDR* p_buf) {
     memcpy(p_new, p_buf, copy_size);
     list_append(p_scbi->a2dp_list, p_new);
 
-    if (list_length(p_scbi->a2dp_list) > p_bta_av_cfg->audio_mqs) {
+    /* held packets do not count against the queue size */
+    if (list_length(p_scbi->a2dp_list) >
+        p_bta_av_cfg->audio_mqs + p_scbi->a2dp_hold) {
       // Drop the oldest packet
       bta_av_co_audio_drop(p_scbi->hndl, p_scbi->PeerAddress());
       BT_HDR* p_buf_drop = static_cast<BT_HDR*>(list_front(p_scbi->a2dp_list));
@@ -1200,6 +1203,51 @@ void bta_av_dup_audio_buf(tBTA_AV_SCB* p_scb, BT_HDR* p_buf) {
   }
 }
 
+/*******************************************************************************
+ *
+ * Function         bta_av_update_audio_hold
+ *
+ * Description      Compute how many packets each started audio channel holds
+ *                  back in its a2dp_list so that peers sharing the encoded
+ *                  audio play it at the same time.  The peer reporting the
+ *                  largest delay holds nothing, the others hold the difference
+ *                  of delays.  Nothing is held with a single audio channel.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+void bta_av_update_audio_hold(void) {
+  uint16_t max_delay = 0;
+
+  for (int i = 0; i < BTA_AV_NUM_STRS; i++) {
+    tBTA_AV_SCB* p_scbi = bta_av_cb.p_scb[i];
+    if ((p_scbi == NULL) || !p_scbi->co_started) continue;
+    if (!(bta_av_cb.conn_audio & BTA_AV_HNDL_TO_MSK(i))) continue;
+    if (p_scbi->sink_delay > max_delay) max_delay = p_scbi->sink_delay;
+  }
+
+  for (int i = 0; i < BTA_AV_NUM_STRS; i++) {
+    tBTA_AV_SCB* p_scbi = bta_av_cb.p_scb[i];
+    if (p_scbi == NULL) continue;
+
+    uint8_t hold = 0;
+    if (bta_av_cb.audio_open_cnt >= 2 && p_scbi->co_started &&
+        (bta_av_cb.conn_audio & BTA_AV_HNDL_TO_MSK(i))) {
+      /* delay reports are in 1/10 ms */
+      int pkts = (max_delay - p_scbi->sink_delay) /
+                 (BTA_AV_DUP_AUDIO_INTERVAL_MS * 10);
+      hold = (uint8_t)std::min(pkts, BTA_AV_DUP_AUDIO_MAX_HOLD);
+    }
+
+    if (hold != p_scbi->a2dp_hold) {
+      log::info("peer {} bta_handle:0x{:x} delay:{} holds {} packets",
+                ADDRESS_TO_LOGGABLE_CSTR(p_scbi->PeerAddress()),
+                p_scbi->hndl, p_scbi->sink_delay, hold);
+      p_scbi->a2dp_hold = hold;
+    }
+  }
+}
+
 static void bta_av_non_state_machine_event(uint16_t event,
                                            tBTA_AV_DATA* p_data) {
   switch (event) {
@@ -1534,6 +1582,7 @@ void bta_debug_av_dump(int fd) {
   dprintf(fd, "  Offload start pending handle: %d\n",
           bta_av_cb.offload_start_pending_hndl);
   dprintf(fd, "  Offload started handle: %d\n", bta_av_cb.offload_started_hndl);
+  bta_av_peer_caps_cache_dump(fd);
 
   for (size_t i = 0; i < sizeof(bta_av_cb.lcb) / sizeof(bta_av_cb.lcb[0]);
        i++) {
@@ -1610,6 +1659,10 @@ void bta_debug_av_dump(int fd) {
     dprintf(fd, "    AVRCP allowed: %s\n", p_scb->use_rc ? "true" : "false");
     dprintf(fd, "    Stream started: %s\n", p_scb->started ? "true" : "false");
     dprintf(fd, "    Stream call-out started: %d\n", p_scb->co_started);
+    dprintf(fd, "    Sink delay (1/10 ms): %d\n", p_scb->sink_delay);
+    dprintf(fd, "    Held media packets: %d\n", p_scb->a2dp_hold);
+    dprintf(fd, "    Queued media packets: %zu\n",
+            list_length(p_scb->a2dp_list));
     dprintf(fd, "    AVDTP Reconfig supported: %s\n",
             p_scb->recfg_sup ? "true" : "false");
     dprintf(fd, "    AVDTP Suspend supported: %s\n",
@@ -727,6 +727,10 @@ class CsisClientImpl : public CsisClient {
              << static_cast<int>(g->GetCurrentLockState()) << "\n"
              << "    target lock state: "
              << static_cast<int>(g->GetTargetLockState()) << "\n"
+             << "    members discovered: " << g->GetMembersDiscovered()
+             << ", last after: " << g->GetLastMemberDiscoveryMs() << " ms\n"
+             << "    RSI resolutions: " << g->GetRsiResolutions()
+             << ", cache hits: " << g->GetRsiCacheHits() << "\n"
              << "    devices: \n";
       for (auto& device : devices_) {
         if (!g->IsDeviceInTheGroup(device)) {
@@ -1372,8 +1376,10 @@ class CsisClientImpl : public CsisClient {
           return csis_group->IsRsiMatching(rsi);
         });
     if (discovered_group_rsi != all_rsi.cend()) {
-      log::debug("Found set member {}",
-                 ADDRESS_TO_LOGGABLE_CSTR(result->bd_addr));
+      csis_group->OnMemberDiscovered();
+      log::debug("Found set member {} after {} ms",
+                 ADDRESS_TO_LOGGABLE_CSTR(result->bd_addr),
+                 csis_group->GetLastMemberDiscoveryMs());
 
       CacheAndAdvertiseExpectedMember(result->bd_addr,
                                       csis_group->GetGroupId());
@@ -1004,6 +1004,38 @@ TEST_F(CsisClientTest, test_get_current_size) {
   ASSERT_EQ(3, g_1->GetCurrentSize());
 }
 
+TEST_F(CsisClientTest, test_rsi_matching_is_cached) {
+  Octet16 sirk = {0x45, 0x7d, 0x7d, 0x09, 0x21, 0xa1, 0xfd, 0x22,
+                  0xce, 0xcd, 0x8c, 0x86, 0xdd, 0x72, 0xcc, 0xcd};
+  auto g_1 = std::make_shared<CsisGroup>(666, bluetooth::Uuid::kEmpty);
+  g_1->SetSirk(sirk);
+
+  /* RSI is hash(sirk, prand) || prand, most significant octet first */
+  Octet16 prand{};
+  prand[0] = 0x1b;
+  prand[1] = 0x32;
+  prand[2] = 0x5a;
+  Octet16 hash = crypto_toolbox::aes_128(sirk, prand);
+  const RawAddress rsi(std::array<uint8_t, RawAddress::kLength>{
+      prand[2], prand[1], prand[0], hash[2], hash[1], hash[0]});
+  const RawAddress other_rsi(std::array<uint8_t, RawAddress::kLength>{
+      0x5a, 0x32, 0x1b, 0x00, 0x00, 0x00});
+
+  ASSERT_TRUE(g_1->IsRsiMatching(rsi));
+  ASSERT_TRUE(g_1->IsRsiMatching(rsi));
+  ASSERT_FALSE(g_1->IsRsiMatching(other_rsi));
+  ASSERT_FALSE(g_1->IsRsiMatching(other_rsi));
+  ASSERT_EQ(g_1->GetRsiResolutions(), 2u);
+  ASSERT_EQ(g_1->GetRsiCacheHits(), 2u);
+
+  /* A new SIRK invalidates the cached results */
+  Octet16 other_sirk = sirk;
+  other_sirk[0] ^= 0xff;
+  g_1->SetSirk(other_sirk);
+  ASSERT_FALSE(g_1->IsRsiMatching(rsi));
+  ASSERT_EQ(g_1->GetRsiResolutions(), 3u);
+}
+
 TEST_F(CsisClientTest, test_set_current_lock_state_unset) {
   auto g_1 = std::make_shared<CsisGroup>(666, bluetooth::Uuid::kEmpty);
   g_1->SetCurrentLockState(CsisLockState::CSIS_STATE_UNSET);
@@ -21,6 +21,8 @@
 #include <bluetooth/log.h>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <map>
 #include <vector>
 
@@ -368,9 +370,25 @@ class CsisGroup {
                       CsisDevice::MatchAddress(csis_device->addr));
     return (it != devices_.end());
   }
+  /* Resolving an RSI costs an AES operation, while a set member advertises
+   * the same RSI until its address rotates. Recently resolved RSIs are
+   * remembered to resolve each of them once per SIRK. */
   bool IsRsiMatching(const RawAddress& rsi) const {
-    return is_rsi_match_sirk(rsi, GetSirk());
+    for (const auto& entry : rsi_cache_) {
+      if (entry.valid && entry.rsi == rsi) {
+        rsi_cache_hits_++;
+        return entry.match;
+      }
+    }
+
+    bool match = is_rsi_match_sirk(rsi, GetSirk());
+    rsi_resolutions_++;
+    rsi_cache_[rsi_cache_next_] = {rsi, match, true};
+    rsi_cache_next_ = (rsi_cache_next_ + 1) % kRsiCacheSize;
+    return match;
   }
+  uint32_t GetRsiCacheHits(void) const { return rsi_cache_hits_; }
+  uint32_t GetRsiResolutions(void) const { return rsi_resolutions_; }
   bool IsSirkBelongsToGroup(Octet16 sirk) const {
     return (sirk_available_ && sirk_ == sirk);
   }
@@ -381,6 +399,7 @@ class CsisGroup {
     }
     sirk_available_ = true;
     sirk_ = sirk;
+    rsi_cache_.fill({});
   }
 
   int GetNumOfConnectedDevices(void) {
@@ -395,9 +414,26 @@ class CsisGroup {
     log::debug("current discovery state: {}, new discovery state: {}",
                static_cast<int>(member_discovery_state_),
                static_cast<int>(state));
+    if (state == CsisDiscoveryState::CSIS_DISCOVERY_ONGOING &&
+        member_discovery_state_ != CsisDiscoveryState::CSIS_DISCOVERY_ONGOING) {
+      discovery_start_ = std::chrono::steady_clock::now();
+    }
     member_discovery_state_ = state;
   }
 
+  /* Record the time it took to find a member since discovery started */
+  void OnMemberDiscovered(void) {
+    last_member_discovery_ms_ =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - discovery_start_)
+            .count();
+    members_discovered_++;
+  }
+  int64_t GetLastMemberDiscoveryMs(void) const {
+    return last_member_discovery_ms_;
+  }
+  int GetMembersDiscovered(void) const { return members_discovered_; }
+
   void SetCurrentLockState(CsisLockState state) { lock_state_ = state; }
 
   void SetTargetLockState(CsisLockState state,
@@ -552,6 +588,20 @@ class CsisGroup {
 
   std::vector<std::shared_ptr<CsisDevice>> devices_;
   CsisDiscoveryState member_discovery_state_;
+  std::chrono::steady_clock::time_point discovery_start_;
+  int64_t last_member_discovery_ms_ = 0;
+  int members_discovered_ = 0;
+
+  struct RsiCacheEntry {
+    RawAddress rsi;
+    bool match;
+    bool valid;
+  };
+  static constexpr size_t kRsiCacheSize = 16;
+  mutable std::array<RsiCacheEntry, kRsiCacheSize> rsi_cache_{};
+  mutable size_t rsi_cache_next_ = 0;
+  mutable uint32_t rsi_cache_hits_ = 0;
+  mutable uint32_t rsi_resolutions_ = 0;
 
   CsisLockState lock_state_;
   CsisLockState target_lock_state_;
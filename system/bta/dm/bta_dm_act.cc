@@ -719,6 +719,7 @@ void bta_dm_acl_up(const RawAddress& bd_addr, tBT_TRANSPORT transport,
   device->pref_role = BTA_ANY_ROLE;
   device->reset_device_info();
   device->transport = transport;
+  bta_dm_pm_init_stats(device);
 
   if (bluetooth::shim::GetController()->SupportsSniffSubrating() &&
       acl_peer_supports_sniff_subrating(bd_addr)) {
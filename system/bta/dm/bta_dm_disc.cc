@@ -22,9 +22,11 @@
 #include <base/logging.h>
 #include <base/strings/stringprintf.h>
 #include <bluetooth/log.h>
+#include <inttypes.h>
 #include <stddef.h>
 
 #include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 #include "android_bluetooth_flags.h"
@@ -35,6 +37,7 @@
 #include "common/circular_buffer.h"
 #include "common/init_flags.h"
 #include "common/strings.h"
+#include "common/time_util.h"
 #include "device/include/interop.h"
 #include "include/bind_helpers.h"
 #include "include/check.h"
@@ -75,6 +78,58 @@ namespace {
 constexpr char kBtmLogTag[] = "SDP";
 
 tBTA_DM_SEARCH_CB bta_dm_search_cb;
+
+/* Names read during earlier searches are reused for this long instead of
+ * paging the peer again with a remote name request */
+constexpr uint64_t kRemoteNameCacheTtlMs = 10 * 60 * 1000;
+constexpr size_t kRemoteNameCacheMaxSize = 128;
+
+struct RemoteNameCacheEntry {
+  BD_NAME bd_name;
+  uint64_t timestamp_ms;
+};
+
+struct {
+  std::unordered_map<RawAddress, RemoteNameCacheEntry> entries;
+  uint64_t hits{0};
+  uint64_t misses{0};
+} remote_name_cache_;
+
+void bta_dm_remote_name_cache_store(const RawAddress& bd_addr,
+                                    const BD_NAME bd_name) {
+  const uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+  auto& entries = remote_name_cache_.entries;
+  if (entries.size() >= kRemoteNameCacheMaxSize &&
+      entries.find(bd_addr) == entries.end()) {
+    /* Evict the oldest name */
+    auto oldest = entries.begin();
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+      if (it->second.timestamp_ms < oldest->second.timestamp_ms) oldest = it;
+    }
+    entries.erase(oldest);
+  }
+  RemoteNameCacheEntry& entry = entries[bd_addr];
+  bd_name_copy(entry.bd_name, bd_name);
+  entry.timestamp_ms = now_ms;
+}
+
+bool bta_dm_remote_name_cache_lookup(const RawAddress& bd_addr,
+                                     BD_NAME bd_name) {
+  auto it = remote_name_cache_.entries.find(bd_addr);
+  if (it == remote_name_cache_.entries.end()) {
+    remote_name_cache_.misses++;
+    return false;
+  }
+  const uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+  if (now_ms - it->second.timestamp_ms > kRemoteNameCacheTtlMs) {
+    remote_name_cache_.entries.erase(it);
+    remote_name_cache_.misses++;
+    return false;
+  }
+  bd_name_copy(bd_name, it->second.bd_name);
+  remote_name_cache_.hits++;
+  return true;
+}
 }  // namespace
 
 static void bta_dm_gatt_disc_complete(uint16_t conn_id, tGATT_STATUS status);
@@ -487,6 +542,11 @@ static void bta_dm_remote_name_cmpl(const tBTA_DM_MSG* p_data) {
   if (!bd_name_is_empty(remote_name_msg.bd_name) && p_btm_inq_info) {
     p_btm_inq_info->appl_knows_rem_name = true;
   }
+  if (remote_name_msg.hci_status == HCI_SUCCESS &&
+      !bd_name_is_empty(remote_name_msg.bd_name)) {
+    bta_dm_remote_name_cache_store(remote_name_msg.bd_addr,
+                                   remote_name_msg.bd_name);
+  }
 
   // Callback with this property
   if (bta_dm_search_cb.p_search_cback != nullptr) {
@@ -1348,6 +1408,37 @@ static void bta_dm_discover_device(const RawAddress& remote_bd_addr) {
     bta_dm_search_cb.name_discover_done = true;
   }
 
+  /* A name read recently during an earlier search is reported from the cache,
+   * saving a page of the peer */
+  if (!bta_dm_search_cb.name_discover_done &&
+      bta_dm_search_get_state() == BTA_DM_SEARCH_ACTIVE &&
+      bta_dm_search_cb.p_btm_inq_info &&
+      !bta_dm_search_cb.p_btm_inq_info->appl_knows_rem_name) {
+    tBTA_DM_SEARCH search_data = {
+        .disc_res =  // tBTA_DM_DISC_RES
+        {
+            .bd_addr = remote_bd_addr,
+            .bd_name = {},
+            .services = {},
+            .device_type = {},
+            .num_uuids = 0UL,
+            .p_uuid_list = nullptr,
+            .result = BTA_SUCCESS,
+            .hci_status = HCI_SUCCESS,
+        },
+    };
+    if (bta_dm_remote_name_cache_lookup(remote_bd_addr,
+                                        search_data.disc_res.bd_name)) {
+      log::debug("Using cached remote name, skipping read remote name peer:{}",
+                 ADDRESS_TO_LOGGABLE_CSTR(remote_bd_addr));
+      bta_dm_search_cb.p_btm_inq_info->appl_knows_rem_name = true;
+      bta_dm_search_cb.name_discover_done = true;
+      if (bta_dm_search_cb.p_search_cback != nullptr) {
+        bta_dm_search_cb.p_search_cback(BTA_DM_NAME_READ_EVT, &search_data);
+      }
+    }
+  }
+
   /* if name discovery is not done and application needs remote name */
   if ((!bta_dm_search_cb.name_discover_done) &&
       ((bta_dm_search_cb.p_btm_inq_info == NULL) ||
@@ -2468,6 +2559,10 @@ void DumpsysBtaDmDisc(int fd) {
   }
   LOG_DUMPSYS(fd, " current bta_dm_search_state:%s",
               bta_dm_state_text(bta_dm_search_get_state()).c_str());
+  LOG_DUMPSYS(fd,
+              " remote name cache entries:%zu hits:%" PRIu64 " misses:%" PRIu64,
+              remote_name_cache_.entries.size(), remote_name_cache_.hits,
+              remote_name_cache_.misses);
 }
 #undef DUMPSYS_TAG
 
@@ -95,6 +95,19 @@ inline std::string device_info_text(tBTA_DM_DEV_INFO info) {
 #define BTA_DM_PM_EXECUTE 3
 typedef uint8_t tBTA_DM_PM_REQ;
 
+/* Power mode statistics of a link, reported in dumpsys */
+typedef struct {
+  tBTM_PM_STATUS mode;    /* current power mode */
+  uint64_t mode_since_ms; /* when the link entered the current power mode */
+  uint64_t time_in_mode_ms[BTM_PM_STS_PARK + 1];
+  uint32_t mode_changes;
+  uint32_t sniff_deferrals;
+  uint8_t consecutive_sniff_deferrals;
+  /* L2CAP traffic of the link when it was last sampled */
+  uint64_t traffic_bytes;
+  uint64_t traffic_sampled_ms;
+} tBTA_DM_PM_STATS;
+
 struct tBTA_DM_PEER_DEVICE {
   RawAddress peer_bdaddr;
   tBTA_DM_CONN_STATE conn_state;
@@ -140,6 +153,7 @@ struct tBTA_DM_PEER_DEVICE {
   tBTA_DM_PM_ACTION pm_mode_failed;
   bool remove_dev_pending;
   tBT_TRANSPORT transport;
+  tBTA_DM_PM_STATS pm_stats;
 };
 
 /* structure to store list of
@@ -332,6 +346,8 @@ void bta_dm_ble_get_energy_info(tBTA_BLE_ENERGY_INFO_CBACK*);
 
 void bta_dm_init_pm(void);
 void bta_dm_disable_pm(void);
+void bta_dm_pm_init_stats(tBTA_DM_PEER_DEVICE* p_dev);
+void DumpsysBtaDmPm(int fd);
 
 uint8_t bta_dm_get_av_count(void);
 tBTA_DM_PEER_DEVICE* bta_dm_find_peer_device(const RawAddress& peer_addr);
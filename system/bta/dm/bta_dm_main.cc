@@ -41,5 +41,6 @@ void DumpsysBtaDm(int fd) {
   LOG_DUMPSYS_TITLE(fd, DUMPSYS_TAG);
   DumpsysBtaDmDisc(fd);
   DumpsysBtaDmGattClient(fd);
+  DumpsysBtaDmPm(fd);
 }
 #undef DUMPSYS_TAG
@@ -26,7 +26,9 @@
 #include <base/functional/bind.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <mutex>
 #include <vector>
 
@@ -36,6 +38,7 @@
 #include "bta/sys/bta_sys.h"
 #include "btif/include/core_callbacks.h"
 #include "btif/include/stack_manager_t.h"
+#include "common/time_util.h"
 #include "hci/controller_interface.h"
 #include "main/shim/dumpsys.h"
 #include "main/shim/entry.h"
@@ -43,6 +46,7 @@
 #include "osi/include/properties.h"
 #include "stack/include/acl_api.h"
 #include "stack/include/btm_client_interface.h"
+#include "stack/include/l2c_api.h"
 #include "stack/include/main_thread.h"
 #include "types/raw_address.h"
 
@@ -85,6 +89,14 @@ static const char kPropertySniffAttempts[] =
 static const char kPropertySniffTimeouts[] =
     "bluetooth.core.classic.sniff_timeouts";
 
+/* A link that carried at least that much L2CAP traffic per second since it was
+ * last sampled is still in use, and its sniff timer is restarted instead of
+ * entering sniff mode. Profiles only report busy and idle for some of their
+ * traffic, e.g. not for RFCOMM serial ports. */
+static constexpr uint64_t kPmBusyLinkBytesPerSecond = 1000;
+/* Bounds the time a link is kept out of sniff mode by its traffic */
+static constexpr uint8_t kPmMaxConsecutiveSniffDeferrals = 3;
+
 /*******************************************************************************
  *
  * Function         bta_dm_init_pm
@@ -114,6 +126,106 @@ void bta_dm_init_pm(void) {
   }
 }
 
+/*******************************************************************************
+ *
+ * Function         bta_dm_pm_sample_traffic
+ *
+ * Description      Records the current L2CAP traffic of a link
+ *
+ *
+ * Returns          The number of bytes per second since the previous sample
+ *
+ ******************************************************************************/
+static uint64_t bta_dm_pm_sample_traffic(tBTA_DM_PEER_DEVICE* p_dev) {
+  tBTA_DM_PM_STATS& stats = p_dev->pm_stats;
+  uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+  uint64_t bytes =
+      L2CA_GetLinkTrafficBytes(p_dev->peer_bdaddr, BT_TRANSPORT_BR_EDR);
+
+  uint64_t bytes_per_second = 0;
+  /* The count goes down when a channel is closed */
+  if (bytes > stats.traffic_bytes && now_ms > stats.traffic_sampled_ms) {
+    bytes_per_second = (bytes - stats.traffic_bytes) * 1000 /
+                       (now_ms - stats.traffic_sampled_ms);
+  }
+  stats.traffic_bytes = bytes;
+  stats.traffic_sampled_ms = now_ms;
+  return bytes_per_second;
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_dm_pm_init_stats
+ *
+ * Description      Resets the power mode statistics of a new link
+ *
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+void bta_dm_pm_init_stats(tBTA_DM_PEER_DEVICE* p_dev) {
+  p_dev->pm_stats = {};
+  p_dev->pm_stats.mode = BTM_PM_STS_ACTIVE;
+  p_dev->pm_stats.mode_since_ms = bluetooth::common::time_get_os_boottime_ms();
+  bta_dm_pm_sample_traffic(p_dev);
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_dm_pm_update_stats
+ *
+ * Description      Accounts for a change of power mode of a link
+ *
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+static void bta_dm_pm_update_stats(tBTA_DM_PEER_DEVICE* p_dev,
+                                   tBTM_PM_STATUS mode) {
+  tBTA_DM_PM_STATS& stats = p_dev->pm_stats;
+  if (mode > BTM_PM_STS_PARK || mode == stats.mode) return;
+
+  uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+  stats.time_in_mode_ms[stats.mode] += now_ms - stats.mode_since_ms;
+  stats.mode = mode;
+  stats.mode_since_ms = now_ms;
+  stats.mode_changes++;
+
+  if (mode == BTM_PM_STS_ACTIVE) {
+    /* Traffic is measured from the start of the active period */
+    bta_dm_pm_sample_traffic(p_dev);
+  } else {
+    stats.consecutive_sniff_deferrals = 0;
+  }
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_dm_pm_defer_sniff
+ *
+ * Description      Checks whether a link that is about to enter sniff mode
+ *                  carried enough traffic to stay active a while longer.
+ *
+ *
+ * Returns          true if sniff mode should be deferred
+ *
+ ******************************************************************************/
+static bool bta_dm_pm_defer_sniff(tBTA_DM_PEER_DEVICE* p_dev) {
+  tBTA_DM_PM_STATS& stats = p_dev->pm_stats;
+  uint64_t bytes_per_second = bta_dm_pm_sample_traffic(p_dev);
+  if (bytes_per_second < kPmBusyLinkBytesPerSecond ||
+      stats.consecutive_sniff_deferrals >= kPmMaxConsecutiveSniffDeferrals) {
+    stats.consecutive_sniff_deferrals = 0;
+    return false;
+  }
+
+  stats.consecutive_sniff_deferrals++;
+  stats.sniff_deferrals++;
+  log::debug("Deferring sniff mode for busy peer:{} bytes_per_second:{}",
+             ADDRESS_TO_LOGGABLE_CSTR(p_dev->peer_bdaddr), bytes_per_second);
+  return true;
+}
+
 /*******************************************************************************
  *
  * Function         bta_dm_disable_pm
@@ -733,6 +845,11 @@ static void bta_dm_pm_set_mode(const RawAddress& peer_addr,
     log::warn("DEPRECATED Setting link to park mode peer:{}",
               ADDRESS_TO_LOGGABLE_CSTR(peer_addr));
   } else if (pm_action & BTA_DM_PM_SNIFF) {
+    /* restart the timer while the link is still carrying traffic */
+    if (pm_req == BTA_DM_PM_EXECUTE && bta_dm_pm_defer_sniff(p_peer_device)) {
+      bta_dm_pm_set_mode(peer_addr, BTA_DM_PM_NO_ACTION, BTA_DM_PM_RESTART);
+      return;
+    }
     /* dont initiate SNIFF, if link_policy has it disabled */
     if (BTM_is_sniff_allowed_for(peer_addr)) {
       log::debug("Link policy allows sniff mode so setting mode peer:{}",
@@ -1086,6 +1203,10 @@ void bta_dm_pm_btm_status(const RawAddress& bd_addr, tBTM_PM_STATUS status,
     return;
   }
 
+  if (hci_status == HCI_SUCCESS) {
+    bta_dm_pm_update_stats(p_dev, status);
+  }
+
   /* check new mode */
   switch (status) {
     case BTM_PM_STS_ACTIVE:
@@ -1233,3 +1354,32 @@ tBTM_CONTRL_STATE bta_dm_pm_obtain_controller_state(void) {
   log::verbose("bta_dm_pm_obtain_controller_state: {}", cur_state);
   return cur_state;
 }
+
+#define DUMPSYS_TAG "shim::legacy::bta::dm::pm"
+void DumpsysBtaDmPm(int fd) {
+  uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+  LOG_DUMPSYS(fd, " power mode statistics");
+  for (uint8_t i = 0; i < bta_dm_cb.device_list.count; i++) {
+    const tBTA_DM_PEER_DEVICE& device = bta_dm_cb.device_list.peer_device[i];
+    if (device.transport != BT_TRANSPORT_BR_EDR) continue;
+
+    const tBTA_DM_PM_STATS& stats = device.pm_stats;
+    uint64_t time_in_mode_ms[BTM_PM_STS_PARK + 1];
+    std::copy(std::begin(stats.time_in_mode_ms),
+              std::end(stats.time_in_mode_ms), time_in_mode_ms);
+    if (stats.mode <= BTM_PM_STS_PARK) {
+      time_in_mode_ms[stats.mode] += now_ms - stats.mode_since_ms;
+    }
+    LOG_DUMPSYS(fd,
+                "   peer:%s mode:%s changes:%u active:%llums sniff:%llums "
+                "hold:%llums park:%llums sniff_deferrals:%u",
+                ADDRESS_TO_LOGGABLE_CSTR(device.peer_bdaddr),
+                power_mode_status_text(stats.mode).c_str(), stats.mode_changes,
+                (unsigned long long)time_in_mode_ms[BTM_PM_STS_ACTIVE],
+                (unsigned long long)time_in_mode_ms[BTM_PM_STS_SNIFF],
+                (unsigned long long)time_in_mode_ms[BTM_PM_STS_HOLD],
+                (unsigned long long)time_in_mode_ms[BTM_PM_STS_PARK],
+                stats.sniff_deferrals);
+  }
+}
+#undef DUMPSYS_TAG
@@ -128,6 +128,7 @@ static void bta_gattc_enable() {
   if (bta_gattc_cb.state == BTA_GATTC_STATE_DISABLED) {
     /* initialize control block */
     bta_gattc_cb = tBTA_GATTC_CB();
+    bta_gattc_notif_index_clear();
     bta_gattc_cb.state = BTA_GATTC_STATE_ENABLED;
   } else {
     log::verbose("GATTC is already enabled");
@@ -156,6 +157,7 @@ void bta_gattc_disable() {
   /* no registered apps, indicate disable completed */
   if (bta_gattc_cb.state != BTA_GATTC_STATE_DISABLING) {
     bta_gattc_cb = tBTA_GATTC_CB();
+    bta_gattc_notif_index_clear();
     bta_gattc_cb.state = BTA_GATTC_STATE_DISABLED;
   }
 }
@@ -563,8 +565,16 @@ void bta_gattc_conn(tBTA_GATTC_CLCB* p_clcb, const tBTA_GATTC_DATA* p_data) {
 
       if (!db.IsEmpty()) p_clcb->p_srcb->gatt_database = db;
 
-      if (db.IsEmpty() ||
-          robust_caching_support != RobustCachingSupport::UNSUPPORTED) {
+      if (!db.IsEmpty() &&
+          robust_caching_support == RobustCachingSupport::SUPPORTED) {
+        // The stored database is used right away, and the database hash is
+        // read once it is, so that a changed server is rediscovered without
+        // delaying every reconnection by the hash round trip.
+        p_clcb->p_srcb->state = BTA_GATTC_SERV_IDLE;
+        bta_gattc_reset_discover_st(p_clcb->p_srcb, GATT_SUCCESS);
+        bta_gattc_validate_cached_db(p_clcb);
+      } else if (db.IsEmpty() ||
+                 robust_caching_support != RobustCachingSupport::UNSUPPORTED) {
         // If the peer device is expected to support robust caching, or if we
         // don't know its services yet, then we should do discovery (which may
         // short-circuit through a hash match, but might also do the full
@@ -1381,6 +1391,7 @@ static void bta_gattc_deregister_cmpl(tBTA_GATTC_RCB* p_clreg) {
   memset(&cb_data, 0, sizeof(tBTA_GATTC));
 
   GATT_Deregister(p_clreg->client_if);
+  bta_gattc_notif_index_remove_app(p_clreg);
   memset(p_clreg, 0, sizeof(tBTA_GATTC_RCB));
 
   cb_data.reg_oper.client_if = client_if;
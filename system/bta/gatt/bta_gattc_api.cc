@@ -311,6 +311,23 @@ const std::list<gatt::Service>* BTA_GATTC_GetServices(uint16_t conn_id) {
   return bta_gattc_get_services(conn_id);
 }
 
+/*******************************************************************************
+ *
+ * Function         BTA_GATTC_GetDatabaseHash
+ *
+ * Description      This function is called to get the database hash of the
+ *                  GATT database known for the given server.
+ *
+ * Parameters       conn_id: connection ID which identify the server.
+ *                  p_hash: output parameter which will contain the hash
+ *
+ * Returns          true if the database is known, false otherwise.
+ *
+ ******************************************************************************/
+bool BTA_GATTC_GetDatabaseHash(uint16_t conn_id, Octet16* p_hash) {
+  return bta_gattc_get_database_hash(conn_id, p_hash);
+}
+
 /*******************************************************************************
  *
  * Function         BTA_GATTC_GetCharacteristic
@@ -688,14 +705,9 @@ tGATT_STATUS BTA_GATTC_RegisterForNotifications(tGATT_IF client_if,
 
   p_clreg = bta_gattc_cl_get_regcb(client_if);
   if (p_clreg != NULL) {
-    for (i = 0; i < BTA_GATTC_NOTIF_REG_MAX; i++) {
-      if (p_clreg->notif_reg[i].in_use &&
-          p_clreg->notif_reg[i].remote_bda == bda &&
-          p_clreg->notif_reg[i].handle == handle) {
-        log::warn("notification already registered");
-        status = GATT_SUCCESS;
-        break;
-      }
+    if (bta_gattc_notif_index_find(p_clreg, bda, handle) != nullptr) {
+      log::warn("notification already registered");
+      status = GATT_SUCCESS;
     }
     if (status != GATT_SUCCESS) {
       for (i = 0; i < BTA_GATTC_NOTIF_REG_MAX; i++) {
@@ -707,6 +719,7 @@ tGATT_STATUS BTA_GATTC_RegisterForNotifications(tGATT_IF client_if,
           p_clreg->notif_reg[i].remote_bda = bda;
 
           p_clreg->notif_reg[i].handle = handle;
+          bta_gattc_notif_index_add(client_if, bda, handle, i);
           status = GATT_SUCCESS;
           break;
         }
@@ -752,14 +765,13 @@ tGATT_STATUS BTA_GATTC_DeregisterForNotifications(tGATT_IF client_if,
     return GATT_ILLEGAL_PARAMETER;
   }
 
-  for (int i = 0; i < BTA_GATTC_NOTIF_REG_MAX; i++) {
-    if (p_clreg->notif_reg[i].in_use &&
-        p_clreg->notif_reg[i].remote_bda == bda &&
-        p_clreg->notif_reg[i].handle == handle) {
-      log::verbose("deregistered bd_addr={}", ADDRESS_TO_LOGGABLE_STR(bda));
-      memset(&p_clreg->notif_reg[i], 0, sizeof(tBTA_GATTC_NOTIF_REG));
-      return GATT_SUCCESS;
-    }
+  tBTA_GATTC_NOTIF_REG* p_reg =
+      bta_gattc_notif_index_find(p_clreg, bda, handle);
+  if (p_reg != nullptr) {
+    log::verbose("deregistered bd_addr={}", ADDRESS_TO_LOGGABLE_STR(bda));
+    bta_gattc_notif_index_remove(client_if, bda, handle);
+    memset(p_reg, 0, sizeof(tBTA_GATTC_NOTIF_REG));
+    return GATT_SUCCESS;
   }
 
   log::error("registration not found bd_addr={}", ADDRESS_TO_LOGGABLE_STR(bda));
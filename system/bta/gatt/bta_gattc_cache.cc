@@ -30,6 +30,7 @@
 #include <base/strings/stringprintf.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <vector>
@@ -633,6 +634,17 @@ const std::list<Service>* bta_gattc_get_services(uint16_t conn_id) {
   return bta_gattc_get_services_srcb(p_srcb);
 }
 
+bool bta_gattc_get_database_hash(uint16_t conn_id, Octet16* p_hash) {
+  tBTA_GATTC_CLCB* p_clcb = bta_gattc_find_clcb_by_conn_id(conn_id);
+
+  if (p_clcb == NULL || p_clcb->p_srcb == NULL ||
+      p_clcb->p_srcb->gatt_database.IsEmpty())
+    return false;
+
+  *p_hash = p_clcb->p_srcb->gatt_database.Hash();
+  return true;
+}
+
 const Service* bta_gattc_get_service_for_handle_srcb(tBTA_GATTC_SERV* p_srcb,
                                                      uint16_t handle) {
   const std::list<Service>* services = bta_gattc_get_services_srcb(p_srcb);
@@ -747,6 +759,53 @@ bool bta_gattc_read_db_hash(tBTA_GATTC_CLCB* p_clcb, bool is_svc_chg) {
   return true;
 }
 
+/* handle the database hash read after the cached database was used */
+static void bta_gattc_validate_cached_db_cmpl(uint16_t conn_id,
+                                              tGATT_STATUS status,
+                                              uint16_t /* handle */,
+                                              uint16_t len, uint8_t* value,
+                                              void* /* data */) {
+  tBTA_GATTC_CLCB* p_clcb = bta_gattc_find_clcb_by_conn_id(conn_id);
+  if (!p_clcb || !p_clcb->p_srcb) return;
+
+  tBTA_GATTC_SERV* p_srcb = p_clcb->p_srcb;
+  Octet16 local_hash = p_srcb->gatt_database.Hash();
+  if (status == GATT_SUCCESS && len == local_hash.max_size() &&
+      std::equal(value, value + len, local_hash.begin())) {
+    log::debug("cached database of {} is up to date",
+               ADDRESS_TO_LOGGABLE_CSTR(p_srcb->server_bda));
+    return;
+  }
+
+  log::info("cached database of {} is out of date, status={}, start discovery",
+            ADDRESS_TO_LOGGABLE_CSTR(p_srcb->server_bda),
+            gatt_status_text(status));
+
+  /* handle it like a service changed indication covering the whole database,
+   * so the stale cache is not loaded again */
+  p_srcb->srvc_hdl_chg = true;
+  p_srcb->srvc_hdl_db_hash = true;
+  bta_gattc_sm_execute(p_clcb, BTA_GATTC_INT_DISCOVER_EVT, NULL);
+
+  for (uint8_t i = 0; i < BTA_GATTC_CL_MAX; i++) {
+    tBTA_GATTC_RCB* p_clrcb = &bta_gattc_cb.cl_rcb[i];
+    if (!p_clrcb->in_use || !p_clrcb->p_cback) continue;
+
+    tBTA_GATTC bta_gattc;
+    bta_gattc.service_changed.remote_bda = p_srcb->server_bda;
+    bta_gattc.service_changed.conn_id = conn_id;
+    (*p_clrcb->p_cback)(BTA_GATTC_SRVC_CHG_EVT, &bta_gattc);
+  }
+}
+
+/* request reading database hash to check the cached database already in use */
+void bta_gattc_validate_cached_db(tBTA_GATTC_CLCB* p_clcb) {
+  BTA_GATTC_ReadUsingCharUuid(p_clcb->bta_conn_id,
+                              Uuid::From16Bit(GATT_UUID_DATABASE_HASH), 0x0001,
+                              0xFFFF, GATT_AUTH_REQ_NONE,
+                              bta_gattc_validate_cached_db_cmpl, NULL);
+}
+
 /* handle response of reading database hash */
 static void bta_gattc_read_db_hash_cmpl(tBTA_GATTC_CLCB* p_clcb,
                                         const tBTA_GATTC_OP_CMPL* p_data,
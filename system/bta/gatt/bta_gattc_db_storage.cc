@@ -22,9 +22,15 @@
 #include <base/strings/string_number_conversions.h>
 #include <bluetooth/log.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
+#include <cstring>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "bta/gatt/bta_gattc_int.h"
@@ -77,11 +83,60 @@ static void bta_gattc_generate_hash_file_name(char* buffer, size_t buffer_len,
 
 static gatt::Database EMPTY_DB;
 
+static_assert(sizeof(StoredAttribute) == StoredAttribute::kSizeOnDisk,
+              "GATT cache files are mapped as arrays of StoredAttribute");
+
+/* Databases already loaded from storage, keyed by the inode of their hash
+ * file. The address files are hard links to the hash files, so all the
+ * devices sharing a database also share its entry. */
+struct LoadedDb {
+  struct timespec mtime;
+  off_t size;
+  uint64_t last_used;
+  gatt::Database database;
+};
+static std::map<std::pair<dev_t, ino_t>, LoadedDb> loaded_dbs;
+static uint64_t loaded_dbs_use_count = 0;
+
+static void bta_gattc_forget_loaded_db(const char* fname) {
+  struct stat buf;
+  if (stat(fname, &buf) == 0) loaded_dbs.erase({buf.st_dev, buf.st_ino});
+}
+
+/* Remove a database file, its inode may only be reused once the last link to
+ * it is gone */
+static void bta_gattc_unlink_db(const char* fname) {
+  struct stat buf;
+  if (stat(fname, &buf) == 0 && buf.st_nlink <= 1) {
+    loaded_dbs.erase({buf.st_dev, buf.st_ino});
+  }
+  unlink(fname);
+}
+
+static void bta_gattc_remember_loaded_db(const struct stat& buf,
+                                         const gatt::Database& database) {
+  if (loaded_dbs.size() >= GATT_HASH_MAX_SIZE) {
+    auto lru = loaded_dbs.begin();
+    for (auto it = loaded_dbs.begin(); it != loaded_dbs.end(); ++it) {
+      if (it->second.last_used < lru->second.last_used) lru = it;
+    }
+    loaded_dbs.erase(lru);
+  }
+  loaded_dbs[{buf.st_dev, buf.st_ino}] = LoadedDb{
+      .mtime = buf.st_mtim,
+      .size = buf.st_size,
+      .last_used = ++loaded_dbs_use_count,
+      .database = database,
+  };
+}
+
 /*******************************************************************************
  *
  * Function         bta_gattc_load_db
  *
- * Description      Load GATT database from storage.
+ * Description      Load GATT database from storage. The file is mapped and its
+ *                  attributes read in place, a file that was already loaded
+ *                  and did not change since is not read again.
  *
  * Parameter        fname: input file name
  *
@@ -90,48 +145,72 @@ static gatt::Database EMPTY_DB;
  *
  ******************************************************************************/
 static gatt::Database bta_gattc_load_db(const char* fname) {
-  FILE* fd = fopen(fname, "rb");
-  if (!fd) {
+  int fd = open(fname, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
     log::error("can't open GATT cache file {} for reading, error: {}", fname,
                strerror(errno));
     return EMPTY_DB;
   }
 
-  uint16_t cache_ver = 0;
-  uint16_t num_attr = 0;
+  struct stat buf;
+  if (fstat(fd, &buf) != 0) {
+    log::error("can't stat GATT cache file {}, error: {}", fname,
+               strerror(errno));
+    close(fd);
+    return EMPTY_DB;
+  }
 
-  if (fread(&cache_ver, sizeof(uint16_t), 1, fd) != 1) {
-    log::error("can't read GATT cache version from: {}", fname);
-    goto done;
+  auto loaded = loaded_dbs.find({buf.st_dev, buf.st_ino});
+  if (loaded != loaded_dbs.end() && loaded->second.size == buf.st_size &&
+      loaded->second.mtime.tv_sec == buf.st_mtim.tv_sec &&
+      loaded->second.mtime.tv_nsec == buf.st_mtim.tv_nsec) {
+    close(fd);
+    loaded->second.last_used = ++loaded_dbs_use_count;
+    return loaded->second.database;
   }
 
-  if (cache_ver != GATT_CACHE_VERSION) {
-    log::error("wrong GATT cache version: {}", fname);
-    goto done;
+  const size_t header_size = 2 * sizeof(uint16_t);
+  size_t file_size = buf.st_size;
+  if (file_size < header_size) {
+    log::error("can't read GATT cache header from: {}", fname);
+    close(fd);
+    return EMPTY_DB;
   }
 
-  if (fread(&num_attr, sizeof(uint16_t), 1, fd) != 1) {
-    log::error("can't read number of GATT attributes: {}", fname);
-    goto done;
+  void* map = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    log::error("can't map GATT cache file {}, error: {}", fname,
+               strerror(errno));
+    return EMPTY_DB;
   }
 
-  {
-    std::vector<StoredAttribute> attr(num_attr);
+  const uint8_t* data = static_cast<const uint8_t*>(map);
+  uint16_t cache_ver = 0;
+  uint16_t num_attr = 0;
+  memcpy(&cache_ver, data, sizeof(uint16_t));
+  memcpy(&num_attr, data + sizeof(uint16_t), sizeof(uint16_t));
 
-    if (fread(attr.data(), sizeof(StoredAttribute), num_attr, fd) != num_attr) {
-      log::error("can't read GATT attributes: {}", fname);
-      goto done;
-    }
-    fclose(fd);
+  gatt::Database result = EMPTY_DB;
+  if (cache_ver != GATT_CACHE_VERSION) {
+    log::error("wrong GATT cache version: {}", fname);
+  } else if (file_size < header_size + num_attr * sizeof(StoredAttribute)) {
+    log::error("can't read GATT attributes: {}", fname);
+  } else {
+    std::vector<StoredAttribute> attr(num_attr);
+    memcpy(attr.data(), data + header_size, num_attr * sizeof(StoredAttribute));
 
     bool success = false;
-    gatt::Database result = gatt::Database::Deserialize(attr, &success);
-    return success ? result : EMPTY_DB;
+    result = gatt::Database::Deserialize(attr, &success);
+    if (success) {
+      bta_gattc_remember_loaded_db(buf, result);
+    } else {
+      result = EMPTY_DB;
+    }
   }
 
-done:
-  fclose(fd);
-  return EMPTY_DB;
+  munmap(map, file_size);
+  return result;
 }
 
 /*******************************************************************************
@@ -239,6 +318,7 @@ void StoredAttribute::SerializeStoredAttribute(const StoredAttribute& attr,
  ******************************************************************************/
 static bool bta_gattc_store_db(const char* fname,
                                const std::vector<StoredAttribute>& attr) {
+  bta_gattc_forget_loaded_db(fname);
   FILE* fd = fopen(fname, "wb");
   if (!fd) {
     log::error("can't open GATT cache file for writing: {}", fname);
@@ -323,7 +403,7 @@ void bta_gattc_cache_link(const RawAddress& server_bda, const Octet16& hash) {
   bta_gattc_generate_cache_file_name(addr_file, sizeof(addr_file), server_bda);
   bta_gattc_generate_hash_file_name(hash_file, sizeof(hash_file), hash);
 
-  unlink(addr_file);  // remove addr file first if the file exists
+  bta_gattc_unlink_db(addr_file);  // remove addr file first if the file exists
   if (link(hash_file, addr_file) == -1) {
     log::error("link {} to {}, errno={}", addr_file, hash_file, errno);
   }
@@ -365,7 +445,7 @@ void bta_gattc_cache_reset(const RawAddress& server_bda) {
   log::verbose("");
   char fname[255] = {0};
   bta_gattc_generate_cache_file_name(fname, sizeof(fname), server_bda);
-  unlink(fname);
+  bta_gattc_unlink_db(fname);
 }
 
 /*******************************************************************************
@@ -445,13 +525,13 @@ static void bta_gattc_hash_remove_least_recently_used_if_possible() {
 
   // if the number of hash files exceeds the limit, remove the cadidate item.
   if (count > GATT_HASH_MAX_SIZE && !candidate_item.empty()) {
-    unlink(candidate_item.c_str());
+    bta_gattc_unlink_db(candidate_item.c_str());
     log::debug("delete hash file (size), name={}", candidate_item);
   }
 
   // If there is any file expired, also delete it.
   for (string expired_item : expired_items) {
-    unlink(expired_item.c_str());
+    bta_gattc_unlink_db(expired_item.c_str());
     log::debug("delete hash file (expired), name={}", expired_item);
   }
 }
@@ -457,6 +457,15 @@ void bta_gattc_cmpl_sendmsg(uint16_t conn_id, tGATTC_OPTYPE op,
 bool bta_gattc_check_notif_registry(tBTA_GATTC_RCB* p_clreg,
                                     tBTA_GATTC_SERV* p_srcb,
                                     tBTA_GATTC_NOTIFY* p_notify);
+tBTA_GATTC_NOTIF_REG* bta_gattc_notif_index_find(tBTA_GATTC_RCB* p_clreg,
+                                                 const RawAddress& bda,
+                                                 uint16_t handle);
+void bta_gattc_notif_index_add(tGATT_IF client_if, const RawAddress& bda,
+                               uint16_t handle, uint8_t idx);
+void bta_gattc_notif_index_remove(tGATT_IF client_if, const RawAddress& bda,
+                                  uint16_t handle);
+void bta_gattc_notif_index_remove_app(tBTA_GATTC_RCB* p_clreg);
+void bta_gattc_notif_index_clear();
 bool bta_gattc_mark_bg_conn(tGATT_IF client_if, const RawAddress& remote_bda,
                             bool add);
 bool bta_gattc_check_bg_conn(tGATT_IF client_if, const RawAddress& remote_bda,
@@ -478,6 +487,7 @@ tGATT_STATUS bta_gattc_discover_pri_service(uint16_t conn_id,
                                             tGATT_DISC_TYPE disc_type);
 void bta_gattc_search_service(tBTA_GATTC_CLCB* p_clcb, bluetooth::Uuid* p_uuid);
 const std::list<gatt::Service>* bta_gattc_get_services(uint16_t conn_id);
+bool bta_gattc_get_database_hash(uint16_t conn_id, Octet16* p_hash);
 const gatt::Service* bta_gattc_get_service_for_handle(uint16_t conn_id,
                                                       uint16_t handle);
 const gatt::Characteristic* bta_gattc_get_characteristic_srcb(
@@ -513,6 +523,7 @@ bool bta_gattc_conn_dealloc(const RawAddress& remote_bda);
 
 /* bta_gattc_cache */
 bool bta_gattc_read_db_hash(tBTA_GATTC_CLCB* p_clcb, bool is_svc_chg);
+void bta_gattc_validate_cached_db(tBTA_GATTC_CLCB* p_clcb);
 
 /* bta_gattc_db_storage */
 gatt::Database bta_gattc_hash_load(const Octet16& hash);
@@ -19,7 +19,9 @@
 #include <base/logging.h>
 #include <bluetooth/log.h>
 
+#include <iterator>
 #include <list>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -27,6 +29,8 @@
 #include "bta_gatt_queue.h"
 #include "os/log.h"
 #include "osi/include/allocator.h"
+#include "stack/include/bt_types.h"
+#include "types/raw_address.h"
 
 using gatt_operation = BtaGattQueue::gatt_operation;
 using namespace bluetooth;
@@ -38,6 +42,29 @@ constexpr uint8_t GATT_WRITE_DESC = 4;
 constexpr uint8_t GATT_CONFIG_MTU = 5;
 constexpr uint8_t GATT_READ_MULTI = 6;
 
+bool gatt_profile_get_eatt_support(const RawAddress& remote_bda);
+
+namespace {
+
+bool is_mergeable_read(const gatt_operation& op) {
+  return (op.type == GATT_READ_CHAR || op.type == GATT_READ_DESC) &&
+         !op.read_alone;
+}
+
+/* Read Multiple Variable Length is mandatory for servers supporting EATT */
+bool is_read_multi_var_supported(uint16_t conn_id) {
+  tGATT_IF gatt_if;
+  RawAddress remote_bda;
+  tBT_TRANSPORT transport;
+  if (!GATT_GetConnectionInfor(conn_id, &gatt_if, remote_bda, &transport)) {
+    return false;
+  }
+  return transport == BT_TRANSPORT_LE &&
+         gatt_profile_get_eatt_support(remote_bda);
+}
+
+}  // namespace
+
 struct gatt_read_op_data {
   GATT_READ_OP_CB cb;
   void* cb_data;
@@ -162,6 +189,10 @@ void BtaGattQueue::gatt_execute_next_op(uint16_t conn_id) {
 
   std::list<gatt_operation>& gatt_ops = map_ptr->second;
 
+  if (gatt_execute_merged_reads(conn_id, gatt_ops)) {
+    return;
+  }
+
   gatt_operation& op = gatt_ops.front();
 
   if (op.type == GATT_READ_CHAR) {
@@ -217,6 +248,91 @@ void BtaGattQueue::gatt_execute_next_op(uint16_t conn_id) {
   gatt_ops.pop_front();
 }
 
+/* Send the reads at the front of the queue in one Read Multiple Variable
+ * Length request, if there are at least two of them and the server supports
+ * it. Returns true if the request was sent. */
+bool BtaGattQueue::gatt_execute_merged_reads(
+    uint16_t conn_id, std::list<gatt_operation>& gatt_ops) {
+  auto second = std::next(gatt_ops.begin());
+  if (!is_mergeable_read(gatt_ops.front()) || second == gatt_ops.end() ||
+      !is_mergeable_read(*second) || !is_read_multi_var_supported(conn_id)) {
+    return false;
+  }
+
+  tBTA_GATTC_MULTI handles{};
+  auto* ops = new std::vector<gatt_operation>();
+  while (!gatt_ops.empty() && handles.num_attr < GATT_MAX_READ_MULTI_HANDLES &&
+         is_mergeable_read(gatt_ops.front())) {
+    handles.handles[handles.num_attr++] = gatt_ops.front().handle;
+    ops->push_back(std::move(gatt_ops.front()));
+    gatt_ops.pop_front();
+  }
+
+  log::verbose("conn_id=0x{:x} merged {} reads", conn_id, handles.num_attr);
+  BTA_GATTC_ReadMultiple(conn_id, handles, true, GATT_AUTH_REQ_NONE,
+                         gatt_merged_read_op_finished, ops);
+  return true;
+}
+
+void BtaGattQueue::gatt_merged_read_op_finished(uint16_t conn_id,
+                                                tGATT_STATUS status,
+                                                tBTA_GATTC_MULTI& handles,
+                                                uint16_t len, uint8_t* value,
+                                                void* data) {
+  std::unique_ptr<std::vector<gatt_operation>> ops(
+      static_cast<std::vector<gatt_operation>*>(data));
+
+  /* Length and value of each read, in request order. The response stops at
+   * the MTU, possibly in the middle of a value. */
+  std::vector<std::pair<uint16_t, uint8_t*>> values;
+  if (status == GATT_SUCCESS) {
+    uint8_t* p = value;
+    uint16_t remaining = len;
+    while (values.size() < ops->size() && remaining >= 2) {
+      uint16_t value_len;
+      STREAM_TO_UINT16(value_len, p);
+      remaining -= 2;
+      if (value_len > remaining) break;
+      values.emplace_back(value_len, p);
+      p += value_len;
+      remaining -= value_len;
+    }
+  }
+
+  /* Reads left without a value, or failed together with the other reads, are
+   * sent again one by one, unless the queue was cleaned meanwhile. */
+  auto map_ptr = gatt_op_queue.find(conn_id);
+  std::vector<gatt_operation> failed;
+  for (size_t i = ops->size(); i > values.size(); i--) {
+    gatt_operation& op = (*ops)[i - 1];
+    op.read_alone = true;
+    if (map_ptr != gatt_op_queue.end()) {
+      map_ptr->second.push_front(std::move(op));
+    } else {
+      failed.insert(failed.begin(), std::move(op));
+    }
+  }
+  log::verbose("conn_id=0x{:x} status={} read {} of {} handles", conn_id,
+               status, values.size(), handles.num_attr);
+
+  mark_as_not_executing(conn_id);
+  gatt_execute_next_op(conn_id);
+
+  for (size_t i = 0; i < values.size(); i++) {
+    gatt_operation& op = (*ops)[i];
+    if (op.read_cb) {
+      op.read_cb(conn_id, GATT_SUCCESS, op.handle, values[i].first,
+                 values[i].second, op.read_cb_data);
+    }
+  }
+  for (gatt_operation& op : failed) {
+    if (op.read_cb) {
+      op.read_cb(conn_id, status == GATT_SUCCESS ? GATT_ERROR : status,
+                 op.handle, 0, nullptr, op.read_cb_data);
+    }
+  }
+}
+
 void BtaGattQueue::Clean(uint16_t conn_id) {
   gatt_op_queue.erase(conn_id);
   gatt_op_queue_executing.erase(conn_id);
@@ -28,6 +28,7 @@
 #include <bluetooth/log.h>
 
 #include <cstdint>
+#include <unordered_map>
 
 #include "bta/gatt/bta_gattc_int.h"
 #include "common/init_flags.h"
@@ -470,6 +471,111 @@ BtaEnqueuedResult_t bta_gattc_enqueue(tBTA_GATTC_CLCB* p_clcb,
   return ENQUEUED_FOR_LATER;
 }
 
+/* Index of the notification registrations, by server address and then by
+ * client_if and handle, pointing at the registration slot in notif_reg.
+ * Only accessed from the main thread. */
+static std::unordered_map<RawAddress, std::unordered_map<uint32_t, uint8_t>>
+    notif_index;
+
+static uint32_t bta_gattc_notif_index_key(tGATT_IF client_if,
+                                          uint16_t handle) {
+  return (static_cast<uint32_t>(client_if) << 16) | handle;
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_gattc_notif_index_find
+ *
+ * Description      Look up the notification registration slot of an
+ *                  application for a server characteristic handle.
+ *
+ * Returns          The registration, or nullptr if not registered.
+ *
+ ******************************************************************************/
+tBTA_GATTC_NOTIF_REG* bta_gattc_notif_index_find(tBTA_GATTC_RCB* p_clreg,
+                                                 const RawAddress& bda,
+                                                 uint16_t handle) {
+  auto server = notif_index.find(bda);
+  if (server == notif_index.end()) return nullptr;
+
+  uint32_t key = bta_gattc_notif_index_key(p_clreg->client_if, handle);
+  auto entry = server->second.find(key);
+  if (entry == server->second.end()) return nullptr;
+
+  tBTA_GATTC_NOTIF_REG* p_reg = &p_clreg->notif_reg[entry->second];
+  if (!p_reg->in_use || p_reg->remote_bda != bda || p_reg->handle != handle) {
+    log::error("stale notification index entry handle=0x{:04x}", handle);
+    return nullptr;
+  }
+  return p_reg;
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_gattc_notif_index_add
+ *
+ * Description      Record the notification registration held in slot |idx|
+ *                  of the application notif_reg table.
+ *
+ * Returns          None.
+ *
+ ******************************************************************************/
+void bta_gattc_notif_index_add(tGATT_IF client_if, const RawAddress& bda,
+                               uint16_t handle, uint8_t idx) {
+  notif_index[bda][bta_gattc_notif_index_key(client_if, handle)] = idx;
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_gattc_notif_index_remove
+ *
+ * Description      Forget a notification registration, called when its slot
+ *                  is cleared.
+ *
+ * Returns          None.
+ *
+ ******************************************************************************/
+void bta_gattc_notif_index_remove(tGATT_IF client_if, const RawAddress& bda,
+                                  uint16_t handle) {
+  auto server = notif_index.find(bda);
+  if (server == notif_index.end()) return;
+
+  server->second.erase(bta_gattc_notif_index_key(client_if, handle));
+  if (server->second.empty()) notif_index.erase(server);
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_gattc_notif_index_remove_app
+ *
+ * Description      Forget every notification registration of an application,
+ *                  called when the application is deregistered.
+ *
+ * Returns          None.
+ *
+ ******************************************************************************/
+void bta_gattc_notif_index_remove_app(tBTA_GATTC_RCB* p_clreg) {
+  for (uint8_t i = 0; i < BTA_GATTC_NOTIF_REG_MAX; i++) {
+    if (p_clreg->notif_reg[i].in_use) {
+      bta_gattc_notif_index_remove(p_clreg->client_if,
+                                   p_clreg->notif_reg[i].remote_bda,
+                                   p_clreg->notif_reg[i].handle);
+    }
+  }
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_gattc_notif_index_clear
+ *
+ * Description      Forget every notification registration, called when the
+ *                  control block is reset.
+ *
+ * Returns          None.
+ *
+ ******************************************************************************/
+void bta_gattc_notif_index_clear() { notif_index.clear(); }
+
 /*******************************************************************************
  *
  * Function         bta_gattc_check_notif_registry
@@ -482,16 +588,11 @@ BtaEnqueuedResult_t bta_gattc_enqueue(tBTA_GATTC_CLCB* p_clcb,
 bool bta_gattc_check_notif_registry(tBTA_GATTC_RCB* p_clreg,
                                     tBTA_GATTC_SERV* p_srcb,
                                     tBTA_GATTC_NOTIFY* p_notify) {
-  uint8_t i;
-
-  for (i = 0; i < BTA_GATTC_NOTIF_REG_MAX; i++) {
-    if (p_clreg->notif_reg[i].in_use &&
-        p_clreg->notif_reg[i].remote_bda == p_srcb->server_bda &&
-        p_clreg->notif_reg[i].handle == p_notify->handle &&
-        !p_clreg->notif_reg[i].app_disconnected) {
-      log::verbose("Notification registered!");
-      return true;
-    }
+  tBTA_GATTC_NOTIF_REG* p_reg =
+      bta_gattc_notif_index_find(p_clreg, p_srcb->server_bda, p_notify->handle);
+  if (p_reg != nullptr && !p_reg->app_disconnected) {
+    log::verbose("Notification registered!");
+    return true;
   }
   return false;
 }
@@ -528,8 +629,10 @@ void bta_gattc_clear_notif_registration(tBTA_GATTC_SERV* p_srcb,
            * clear boundaries are always around service.
            */
           handle = p_clrcb->notif_reg[i].handle;
-          if (handle >= start_handle && handle <= end_handle)
+          if (handle >= start_handle && handle <= end_handle) {
+            bta_gattc_notif_index_remove(gatt_if, remote_bda, handle);
             memset(&p_clrcb->notif_reg[i], 0, sizeof(tBTA_GATTC_NOTIF_REG));
+          }
         }
       }
     }
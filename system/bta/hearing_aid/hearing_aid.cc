@@ -1369,6 +1369,35 @@ class HearingAidImpl : public HearingAid {
     hearingDevice->playback_started = true;
   }
 
+  /* LE CoC state of one side, read once per interval for both sides so that
+   * the sends of the two sides are scheduled from the same snapshot.
+   */
+  struct SidePacing {
+    HearingDevice* device = nullptr;
+    uint16_t cid = 0;
+    uint16_t packets_in_chans = 0;
+    uint16_t credit = L2CAP_LE_CREDIT_MAX;
+  };
+
+  SidePacing GetSidePacing(HearingDevice* device) {
+    SidePacing pacing;
+    if (device == nullptr) return pacing;
+
+    pacing.device = device;
+    pacing.cid = GAP_ConnGetL2CAPCid(device->gap_handle);
+    pacing.packets_in_chans =
+        L2CA_FlushChannel(pacing.cid, L2CAP_FLUSH_CHANS_GET);
+    pacing.credit = L2CA_GetPeerLECocCredit(device->address, pacing.cid);
+
+    // Per side queueing latency, see QueueingLatencyMs()
+    struct AudioStats& stats = device->audio_stats;
+    stats.queue_sample_count++;
+    stats.queued_packets_sum += pacing.packets_in_chans;
+    stats.queued_packets_max =
+        std::max<size_t>(stats.queued_packets_max, pacing.packets_in_chans);
+    return pacing;
+  }
+
   /* Compare the two sides LE CoC credit and return true to drop two sides
    * packet on these situations.
    * 1) The credit is close
@@ -1377,24 +1406,23 @@ class HearingAidImpl : public HearingAid {
    *
    * Otherwise, just flush audio packet one side.
    */
-  bool NeedToDropPacket(HearingDevice* target_side, HearingDevice* other_side) {
+  bool NeedToDropPacket(const SidePacing& target_side,
+                        const SidePacing& other_side) {
     // Just drop packet if the other side does not exist.
-    if (!other_side) {
+    if (!other_side.device) {
       log::debug("other side not connected to profile");
       return true;
     }
 
     uint16_t diff_credit = 0;
 
-    uint16_t target_current_credit = L2CA_GetPeerLECocCredit(
-        target_side->address, GAP_ConnGetL2CAPCid(target_side->gap_handle));
+    uint16_t target_current_credit = target_side.credit;
     if (target_current_credit == L2CAP_LE_CREDIT_MAX) {
       log::error("Get target side credit value fail.");
       return true;
     }
 
-    uint16_t other_current_credit = L2CA_GetPeerLECocCredit(
-        other_side->address, GAP_ConnGetL2CAPCid(other_side->gap_handle));
+    uint16_t other_current_credit = other_side.credit;
     if (other_current_credit == L2CAP_LE_CREDIT_MAX) {
       log::error("Get other side credit value fail.");
       return true;
@@ -1406,13 +1434,61 @@ class HearingAidImpl : public HearingAid {
       diff_credit = other_current_credit - target_current_credit;
     }
     log::debug("Target({}) Credit: {}, Other({}) Credit: {}, Init Credit: {}",
-               ADDRESS_TO_LOGGABLE_CSTR(target_side->address),
+               ADDRESS_TO_LOGGABLE_CSTR(target_side.device->address),
                target_current_credit,
-               ADDRESS_TO_LOGGABLE_CSTR(other_side->address),
+               ADDRESS_TO_LOGGABLE_CSTR(other_side.device->address),
                other_current_credit, init_credit);
     return diff_credit < (init_credit / 2 - 1);
   }
 
+  /* Returns true if both sides shall drop the frame, otherwise flushes the
+   * channel of the side whose queue is above the threshold.
+   */
+  bool PaceSide(const SidePacing& side, const SidePacing& other_side,
+                uint16_t l2cap_flush_threshold,
+                std::chrono::time_point<std::chrono::steady_clock> time_point) {
+    HearingDevice* device = side.device;
+    if (device == nullptr) return false;
+
+    bool need_drop = false;
+    if (side.packets_in_chans > l2cap_flush_threshold) {
+      // Compare the two sides LE CoC credit value to confirm need to drop or
+      // skip audio packet.
+      if (NeedToDropPacket(side, other_side) &&
+          IsBelowDropFrequency(time_point)) {
+        log::info("{} triggers dropping, {} packets in channel",
+                  ADDRESS_TO_LOGGABLE_CSTR(device->address),
+                  side.packets_in_chans);
+        need_drop = true;
+        device->audio_stats.trigger_drop_count++;
+      } else {
+        log::info("{} skipping {} packets",
+                  ADDRESS_TO_LOGGABLE_CSTR(device->address),
+                  side.packets_in_chans);
+        device->audio_stats.packet_flush_count += side.packets_in_chans;
+        device->audio_stats.frame_flush_count++;
+        L2CA_FlushChannel(side.cid, 0xffff);
+      }
+      hearingDevices.StartRssiLog();
+    }
+    check_and_do_rssi_read(device);
+    return need_drop;
+  }
+
+  /* Encodes |samples| into |encoded_data|, whose storage is kept across the
+   * intervals.
+   */
+  void EncodeSide(g722_encode_state_t* encoder_state,
+                  const std::vector<uint16_t>& samples,
+                  std::vector<uint8_t>& encoded_data) {
+    // G.722 never produces more than one byte per sample
+    encoded_data.resize(samples.size());
+    int encoded_size =
+        g722_encode(encoder_state, encoded_data.data(),
+                    (const int16_t*)samples.data(), samples.size());
+    encoded_data.resize(encoded_size);
+  }
+
   void OnAudioDataReadyResample(const std::vector<uint8_t>& data) {
     if (asrc == nullptr) {
       return OnAudioDataReady(data);
@@ -1452,8 +1528,10 @@ class HearingAidImpl : public HearingAid {
       return;
     }
 
-    std::vector<uint16_t> chan_left;
-    std::vector<uint16_t> chan_right;
+    std::vector<uint16_t>& chan_left = chan_left_;
+    std::vector<uint16_t>& chan_right = chan_right_;
+    chan_left.resize(num_samples);
+    chan_right.resize(num_samples);
     if (left == nullptr || right == nullptr) {
       for (int i = 0; i < num_samples; i++) {
         const uint8_t* sample = data.data() + i * 4;
@@ -1464,19 +1542,19 @@ class HearingAidImpl : public HearingAid {
         int16_t right = (int16_t)((*(sample + 1) << 8) + *sample) >> 1;
 
         uint16_t mono_data = (int16_t)(((uint32_t)left + (uint32_t)right) >> 1);
-        chan_left.push_back(mono_data);
-        chan_right.push_back(mono_data);
+        chan_left[i] = mono_data;
+        chan_right[i] = mono_data;
       }
     } else {
       for (int i = 0; i < num_samples; i++) {
         const uint8_t* sample = data.data() + i * 4;
 
         uint16_t left = (int16_t)((*(sample + 1) << 8) + *sample) >> 1;
-        chan_left.push_back(left);
+        chan_left[i] = left;
 
         sample += 2;
         uint16_t right = (int16_t)((*(sample + 1) << 8) + *sample) >> 1;
-        chan_right.push_back(right);
+        chan_right[i] = right;
       }
     }
 
@@ -1501,73 +1579,22 @@ class HearingAidImpl : public HearingAid {
 
     // divide encoded data into packets, add header, send.
 
-    // TODO: make those buffers static and global to prevent constant
-    // reallocations
-    // TODO: this should basically fit the encoded data, tune the size later
-    std::vector<uint8_t> encoded_data_left;
+    std::vector<uint8_t>& encoded_data_left = encoded_data_left_;
+    std::vector<uint8_t>& encoded_data_right = encoded_data_right_;
+    encoded_data_left.clear();
+    encoded_data_right.clear();
+    if (left) EncodeSide(encoder_state_left, chan_left, encoded_data_left);
+    if (right) EncodeSide(encoder_state_right, chan_right, encoded_data_right);
+
+    // Both sides are paced from the LE CoC state read at the same time
     auto time_point = std::chrono::steady_clock::now();
-    if (left) {
-      // TODO: instead of a magic number, we need to figure out the correct
-      // buffer size
-      encoded_data_left.resize(4000);
-      int encoded_size =
-          g722_encode(encoder_state_left, encoded_data_left.data(),
-                      (const int16_t*)chan_left.data(), chan_left.size());
-      encoded_data_left.resize(encoded_size);
-
-      uint16_t cid = GAP_ConnGetL2CAPCid(left->gap_handle);
-      uint16_t packets_in_chans = L2CA_FlushChannel(cid, L2CAP_FLUSH_CHANS_GET);
-      if (packets_in_chans > l2cap_flush_threshold) {
-        // Compare the two sides LE CoC credit value to confirm need to drop or
-        // skip audio packet.
-        if (NeedToDropPacket(left, right) && IsBelowDropFrequency(time_point)) {
-          log::info("{} triggers dropping, {} packets in channel",
-                    ADDRESS_TO_LOGGABLE_CSTR(left->address), packets_in_chans);
-          need_drop = true;
-          left->audio_stats.trigger_drop_count++;
-        } else {
-          log::info("{} skipping {} packets",
-                    ADDRESS_TO_LOGGABLE_CSTR(left->address), packets_in_chans);
-          left->audio_stats.packet_flush_count += packets_in_chans;
-          left->audio_stats.frame_flush_count++;
-          L2CA_FlushChannel(cid, 0xffff);
-        }
-        hearingDevices.StartRssiLog();
-      }
-      check_and_do_rssi_read(left);
-    }
-
-    std::vector<uint8_t> encoded_data_right;
-    if (right) {
-      // TODO: instead of a magic number, we need to figure out the correct
-      // buffer size
-      encoded_data_right.resize(4000);
-      int encoded_size =
-          g722_encode(encoder_state_right, encoded_data_right.data(),
-                      (const int16_t*)chan_right.data(), chan_right.size());
-      encoded_data_right.resize(encoded_size);
-
-      uint16_t cid = GAP_ConnGetL2CAPCid(right->gap_handle);
-      uint16_t packets_in_chans = L2CA_FlushChannel(cid, L2CAP_FLUSH_CHANS_GET);
-      if (packets_in_chans > l2cap_flush_threshold) {
-        // Compare the two sides LE CoC credit value to confirm need to drop or
-        // skip audio packet.
-        if (NeedToDropPacket(right, left) && IsBelowDropFrequency(time_point)) {
-          log::info("{} triggers dropping, {} packets in channel",
-                    ADDRESS_TO_LOGGABLE_CSTR(right->address), packets_in_chans);
-          need_drop = true;
-          right->audio_stats.trigger_drop_count++;
-        } else {
-          log::info("{} skipping {} packets",
-                    ADDRESS_TO_LOGGABLE_CSTR(right->address), packets_in_chans);
-          right->audio_stats.packet_flush_count += packets_in_chans;
-          right->audio_stats.frame_flush_count++;
-          L2CA_FlushChannel(cid, 0xffff);
-        }
-        hearingDevices.StartRssiLog();
-      }
-      check_and_do_rssi_read(right);
-    }
+    SidePacing left_pacing = GetSidePacing(left);
+    SidePacing right_pacing = GetSidePacing(right);
+
+    need_drop |= PaceSide(left_pacing, right_pacing, l2cap_flush_threshold,
+                          time_point);
+    need_drop |= PaceSide(right_pacing, left_pacing, l2cap_flush_threshold,
+                          time_point);
 
     size_t encoded_data_size =
         std::max(encoded_data_left.size(), encoded_data_right.size());
@@ -1766,6 +1793,12 @@ class HearingAidImpl : public HearingAid {
     }
   }
 
+  // Each packet queued in the LE CoC channel delays the audio by an interval
+  size_t QueueingLatencyMs(size_t queued_packets, size_t sample_count) {
+    if (sample_count == 0) return 0;
+    return queued_packets * default_data_interval_ms / sample_count;
+  }
+
   void Dump(int fd) {
     std::stringstream stream;
     for (const auto& device : hearingDevices.devices) {
@@ -1786,7 +1819,13 @@ class HearingAidImpl : public HearingAid {
           << device.audio_stats.packet_flush_count
           << "\n    Frame counts (sent/flush)                              : "
           << device.audio_stats.frame_send_count << " / "
-          << device.audio_stats.frame_flush_count << std::endl;
+          << device.audio_stats.frame_flush_count
+          << "\n    Queueing latency (avg/max)                             : "
+          << QueueingLatencyMs(device.audio_stats.queued_packets_sum,
+                               device.audio_stats.queue_sample_count)
+          << " / "
+          << QueueingLatencyMs(device.audio_stats.queued_packets_max, 1)
+          << " ms" << std::endl;
 
       DumpRssi(fd, device);
     }
@@ -1975,6 +2014,12 @@ class HearingAidImpl : public HearingAid {
 
   uint16_t init_credit;
 
+  // PCM and encoded frames of each side, reused for every interval
+  std::vector<uint16_t> chan_left_;
+  std::vector<uint16_t> chan_right_;
+  std::vector<uint8_t> encoded_data_left_;
+  std::vector<uint8_t> encoded_data_right_;
+
   HearingDevices hearingDevices;
 
   void find_server_changed_ccc_handle(uint16_t conn_id,
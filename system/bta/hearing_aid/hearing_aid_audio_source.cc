@@ -140,7 +140,7 @@ void start_audio_ticks() {
     log::fatal("Unsupported data interval: {}", data_interval_ms);
   }
 
-  wakelock_acquire();
+  wakelock_acquire_for("hearing_aid");
   audio_timer.SchedulePeriodic(get_main_thread()->GetWeakPtr(), FROM_HERE,
                                base::BindRepeating(&send_audio_data),
                                std::chrono::milliseconds(data_interval_ms));
@@ -150,7 +150,7 @@ void start_audio_ticks() {
 void stop_audio_ticks() {
   log::info("stopped");
   audio_timer.CancelAndWait();
-  wakelock_release();
+  wakelock_release_for("hearing_aid");
 }
 
 void hearing_aid_data_cb(tUIPC_CH_ID, tUIPC_EVENT event) {
@@ -897,21 +897,41 @@ static char* bta_hf_client_parse_ring(tBTA_HF_CLIENT_CB* client_cb,
   return buffer;
 }
 
+/* Scan an unsigned decimal value, skipping leading spaces. This replaces
+ * sscanf("%u") on the frequent indicator events. Returns the first character
+ * after the value, or NULL if there is no value or it overflows uint32_t */
+static char* bta_hf_client_scan_uint32(char* buffer, uint32_t* p_value) {
+  uint64_t value = 0;
+
+  while (*buffer == ' ') buffer++;
+
+  if (*buffer < '0' || *buffer > '9') {
+    return NULL;
+  }
+
+  while (*buffer >= '0' && *buffer <= '9') {
+    value = value * 10 + (*buffer - '0');
+    if (value > UINT32_MAX) {
+      return NULL;
+    }
+    buffer++;
+  }
+
+  *p_value = (uint32_t)value;
+  return buffer;
+}
+
 /* generic uint32 parser */
 static char* bta_hf_client_parse_uint32(
     tBTA_HF_CLIENT_CB* client_cb, char* buffer,
     void (*handler_callback)(tBTA_HF_CLIENT_CB*, uint32_t)) {
   uint32_t value;
-  int res;
-  int offset;
 
-  res = sscanf(buffer, "%u%n", &value, &offset);
-  if (res < 1) {
+  buffer = bta_hf_client_scan_uint32(buffer, &value);
+  if (buffer == NULL) {
     return NULL;
   }
 
-  buffer += offset;
-
   AT_CHECK_RN(buffer);
 
   handler_callback(client_cb, value);
@@ -1100,22 +1120,18 @@ static char* bta_hf_client_parse_bind(tBTA_HF_CLIENT_CB* client_cb,
 static char* bta_hf_client_parse_ciev(tBTA_HF_CLIENT_CB* client_cb,
                                       char* buffer) {
   uint32_t index, value;
-  int res;
-  int offset = 0;
+  char* tmp;
 
   AT_CHECK_EVENT(buffer, "+CIEV:");
 
-  res = sscanf(buffer, "%u,%u%n", &index, &value, &offset);
-  if (res < 2) {
-    return NULL;
-  }
-
-  if (offset == 0) {
+  tmp = bta_hf_client_scan_uint32(buffer, &index);
+  if (tmp == NULL || *tmp != ',' ||
+      (tmp = bta_hf_client_scan_uint32(tmp + 1, &value)) == NULL) {
     log::error("Format Error {}", buffer);
     return NULL;
   }
 
-  buffer += offset;
+  buffer = tmp;
 
   AT_CHECK_RN(buffer);
 
@@ -1599,26 +1615,59 @@ static char* bta_hf_client_process_unknown(tBTA_HF_CLIENT_CB* client_cb,
  */
 typedef char* (*tBTA_HF_CLIENT_PARSER_CALLBACK)(tBTA_HF_CLIENT_CB*, char*);
 
-static const tBTA_HF_CLIENT_PARSER_CALLBACK bta_hf_client_parser_cb[] = {
-    bta_hf_client_parse_ok,        bta_hf_client_parse_error,
-    bta_hf_client_parse_ring,      bta_hf_client_parse_brsf,
-    bta_hf_client_parse_cind,      bta_hf_client_parse_ciev,
-    bta_hf_client_parse_chld,      bta_hf_client_parse_bcs,
-    bta_hf_client_parse_bsir,      bta_hf_client_parse_cmeerror,
-    bta_hf_client_parse_vgm,       bta_hf_client_parse_vgme,
-    bta_hf_client_parse_vgs,       bta_hf_client_parse_vgse,
-    bta_hf_client_parse_bvra,      bta_hf_client_parse_clip,
-    bta_hf_client_parse_ccwa,      bta_hf_client_parse_cops,
-    bta_hf_client_parse_binp,      bta_hf_client_parse_clcc,
-    bta_hf_client_parse_cnum,      bta_hf_client_parse_btrh,
-    bta_hf_client_parse_bind,      bta_hf_client_parse_busy,
-    bta_hf_client_parse_delayed,   bta_hf_client_parse_no_carrier,
-    bta_hf_client_parse_no_answer, bta_hf_client_parse_rejectlisted,
-    bta_hf_client_process_unknown};
+/* Event prefix, without the leading <cr><lf>, and the parser handling it */
+typedef struct {
+  const char* event;
+  tBTA_HF_CLIENT_PARSER_CALLBACK parser;
+} tBTA_HF_CLIENT_PARSER;
+
+/* Tried in order, only the entries whose leading characters match the
+ * received event are called */
+static const tBTA_HF_CLIENT_PARSER bta_hf_client_parsers[] = {
+    {"OK", bta_hf_client_parse_ok},
+    {"ERROR", bta_hf_client_parse_error},
+    {"RING", bta_hf_client_parse_ring},
+    {"+BRSF:", bta_hf_client_parse_brsf},
+    {"+CIND:", bta_hf_client_parse_cind},
+    {"+CIEV:", bta_hf_client_parse_ciev},
+    {"+CHLD:", bta_hf_client_parse_chld},
+    {"+BCS:", bta_hf_client_parse_bcs},
+    {"+BSIR:", bta_hf_client_parse_bsir},
+    {"+CME ERROR:", bta_hf_client_parse_cmeerror},
+    {"+VGM:", bta_hf_client_parse_vgm},
+    {"+VGM=", bta_hf_client_parse_vgme},
+    {"+VGS:", bta_hf_client_parse_vgs},
+    {"+VGS=", bta_hf_client_parse_vgse},
+    {"+BVRA:", bta_hf_client_parse_bvra},
+    {"+CLIP:", bta_hf_client_parse_clip},
+    {"+CCWA:", bta_hf_client_parse_ccwa},
+    {"+COPS:", bta_hf_client_parse_cops},
+    {"+BINP:", bta_hf_client_parse_binp},
+    {"+CLCC:", bta_hf_client_parse_clcc},
+    {"+CNUM:", bta_hf_client_parse_cnum},
+    {"+BTRH:", bta_hf_client_parse_btrh},
+    {"+BIND:", bta_hf_client_parse_bind},
+    {"BUSY", bta_hf_client_parse_busy},
+    {"DELAYED", bta_hf_client_parse_delayed},
+    {"NO CARRIER", bta_hf_client_parse_no_carrier},
+    {"NO ANSWER", bta_hf_client_parse_no_answer},
+    {"REJECTLISTED", bta_hf_client_parse_rejectlisted}};
 
 /* calculate supported event list length */
-static const uint16_t bta_hf_client_parser_cb_count =
-    sizeof(bta_hf_client_parser_cb) / sizeof(bta_hf_client_parser_cb[0]);
+static const uint16_t bta_hf_client_parsers_count =
+    sizeof(bta_hf_client_parsers) / sizeof(bta_hf_client_parsers[0]);
+
+/* Cheap check on the leading characters of |event|, which are the same for
+ * at most two of the supported events, before the parser is called to
+ * compare the whole prefix */
+static bool bta_hf_client_parser_may_match(const char* parser_event,
+                                           const char* event) {
+  if (parser_event[0] != event[0] || parser_event[1] != event[1]) {
+    return false;
+  }
+  /* +XXXX events differ from the third character on */
+  return parser_event[0] != '+' || parser_event[2] == event[2];
+}
 
 #ifdef BTA_HF_CLIENT_AT_DUMP
 static void bta_hf_client_dump_at(tBTA_HF_CLIENT_CB* client_cb) {
@@ -1659,22 +1708,33 @@ static void bta_hf_client_at_parse_start(tBTA_HF_CLIENT_CB* client_cb) {
 
   while (*buf != '\0') {
     int i;
-    char* tmp = NULL;
+    char* tmp = buf;
+
+    /* every supported event starts with <cr><lf> */
+    if (buf[0] == '\r' && buf[1] == '\n') {
+      for (i = 0; i < bta_hf_client_parsers_count; i++) {
+        if (!bta_hf_client_parser_may_match(bta_hf_client_parsers[i].event,
+                                            buf + 2)) {
+          continue;
+        }
+        tmp = bta_hf_client_parsers[i].parser(client_cb, buf);
+        if (tmp == NULL) {
+          log::error("HFPCient: AT event/reply parsing failed, skipping");
+          tmp = bta_hf_client_skip_unknown(client_cb, buf);
+          break;
+        }
 
-    for (i = 0; i < bta_hf_client_parser_cb_count; i++) {
-      tmp = bta_hf_client_parser_cb[i](client_cb, buf);
-      if (tmp == NULL) {
-        log::error("HFPCient: AT event/reply parsing failed, skipping");
-        tmp = bta_hf_client_skip_unknown(client_cb, buf);
-        break;
+        /* matched */
+        if (tmp != buf) {
+          break;
+        }
       }
+    }
 
-      /* matched or unknown skipped, if unknown failed tmp is NULL so
-         this is also handled */
-      if (tmp != buf) {
-        buf = tmp;
-        break;
-      }
+    /* no match, if skipping the unknown event failed tmp is NULL so this is
+       also handled */
+    if (tmp == buf) {
+      tmp = bta_hf_client_process_unknown(client_cb, buf);
     }
 
     /* could not skip unknown (received garbage?)... disconnect */
@@ -357,6 +357,26 @@ static tBTA_HH_LE_RPT* bta_hh_le_find_report_entry(
   return NULL;
 }
 
+/*******************************************************************************
+ *
+ * Function         bta_hh_le_find_report_entry_by_handle
+ *
+ * Description      find the report entry by characteristic value handle. This
+ *                  avoids walking the GATT database for every notification.
+ *
+ ******************************************************************************/
+static tBTA_HH_LE_RPT* bta_hh_le_find_report_entry_by_handle(
+    tBTA_HH_DEV_CB* p_cb, uint16_t char_inst_id) {
+  tBTA_HH_LE_RPT* p_rpt = &p_cb->hid_srvc.report[0];
+
+  for (uint8_t i = 0; i < BTA_HH_LE_RPT_MAX; i++, p_rpt++) {
+    if (p_rpt->in_use && p_rpt->char_inst_id == char_inst_id) {
+      return p_rpt;
+    }
+  }
+  return NULL;
+}
+
 /*******************************************************************************
  *
  * Function         bta_hh_le_find_rpt_by_idtype
@@ -626,6 +646,46 @@ static void bta_hh_le_deregister_input_notif(tBTA_HH_DEV_CB* p_dev_cb) {
   }
 }
 
+/*******************************************************************************
+ *
+ * Function         bta_hh_le_save_db_hash
+ *
+ * Description      Remember which GATT database the cached reports belong to,
+ *                  so that the cache can be checked on the next connection.
+ *
+ ******************************************************************************/
+static void bta_hh_le_save_db_hash(tBTA_HH_DEV_CB* p_cb) {
+  Octet16 db_hash;
+  if (!BTA_GATTC_GetDatabaseHash(p_cb->conn_id, &db_hash)) return;
+
+  Octet16 saved_hash;
+  if (bta_hh_le_co_load_db_hash(p_cb->link_spec, &saved_hash) &&
+      saved_hash == db_hash)
+    return;
+
+  bta_hh_le_co_save_db_hash(p_cb->link_spec, db_hash);
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_hh_le_cache_matches_db
+ *
+ * Description      Check that the cached reports were discovered from the
+ *                  GATT database currently known for the device. A cache
+ *                  saved without a hash, or a database not known yet, is
+ *                  trusted as before.
+ *
+ ******************************************************************************/
+static bool bta_hh_le_cache_matches_db(tBTA_HH_DEV_CB* p_cb) {
+  Octet16 saved_hash;
+  if (!bta_hh_le_co_load_db_hash(p_cb->link_spec, &saved_hash)) return true;
+
+  Octet16 db_hash;
+  if (!BTA_GATTC_GetDatabaseHash(p_cb->conn_id, &db_hash)) return true;
+
+  return saved_hash == db_hash;
+}
+
 /*******************************************************************************
  *
  * Function         bta_hh_le_open_cmpl
@@ -636,6 +696,7 @@ static void bta_hh_le_deregister_input_notif(tBTA_HH_DEV_CB* p_dev_cb) {
 static void bta_hh_le_open_cmpl(tBTA_HH_DEV_CB* p_cb) {
   if (p_cb->disc_active == BTA_HH_LE_DISC_NONE) {
     bta_hh_le_hid_report_dbg(p_cb);
+    if (p_cb->status == BTA_HH_OK) bta_hh_le_save_db_hash(p_cb);
     bta_hh_le_register_input_notif(p_cb, p_cb->mode, true);
     bta_hh_sm_execute(p_cb, BTA_HH_OPEN_CMPL_EVT, NULL);
 
@@ -1007,8 +1068,13 @@ void bta_hh_security_cmpl(tBTA_HH_DEV_CB* p_cb,
       uint8_t num_rpt = 0;
       if ((p_rpt_cache = bta_hh_le_co_cache_load(p_cb->link_spec, &num_rpt,
                                                  p_cb->app_id)) != NULL) {
-        log::debug("Cache found, no need to perform service discovery");
-        bta_hh_process_cache_rpt(p_cb, p_rpt_cache, num_rpt);
+        if (bta_hh_le_cache_matches_db(p_cb)) {
+          log::debug("Cache found, no need to perform service discovery");
+          bta_hh_process_cache_rpt(p_cb, p_rpt_cache, num_rpt);
+        } else {
+          log::info("GATT database changed, discard the cached reports");
+          bta_hh_le_co_reset_rpt_cache(p_cb->link_spec, p_cb->app_id);
+        }
       }
     }
 
@@ -1583,43 +1649,35 @@ static void bta_hh_le_input_rpt_notify(tBTA_GATTC_NOTIFY* p_data) {
   uint8_t app_id;
   uint8_t* p_buf;
   tBTA_HH_LE_RPT* p_rpt;
+  /* report ID followed by the notification value */
+  uint8_t rpt_buf[GATT_MAX_ATTR_LEN + 1];
 
   if (p_dev_cb == NULL) {
     log::error("Unknown device, conn_id: 0x{:04x}", p_data->conn_id);
     return;
   }
 
-  const gatt::Characteristic* p_char =
-      BTA_GATTC_GetCharacteristic(p_dev_cb->conn_id, p_data->handle);
-  if (p_char == NULL) {
-    log::error("Unknown Characteristic, conn_id:0x{:04x}, handle:0x{:04x}",
+  /* Input reports arrive at up to a few hundred Hz, so look the report up in
+   * the report cache by value handle instead of resolving the characteristic
+   * and its owning service in the GATT database for every notification. */
+  p_rpt = bta_hh_le_find_report_entry_by_handle(p_dev_cb, p_data->handle);
+  if (p_rpt == NULL) {
+    log::error("Unknown Report, conn_id:0x{:04x}, handle:0x{:04x}",
                p_dev_cb->conn_id, p_data->handle);
     return;
   }
 
   app_id = p_dev_cb->app_id;
-
-  const gatt::Service* p_svc =
-      BTA_GATTC_GetOwningService(p_dev_cb->conn_id, p_char->value_handle);
-
-  p_rpt = bta_hh_le_find_report_entry(
-      p_dev_cb, p_svc->handle, p_char->uuid.As16Bit(), p_char->value_handle);
-  if (p_rpt == NULL) {
-    log::error("Unknown Report, uuid:{}, handle:0x{:04x}",
-               p_char->uuid.ToString(), p_char->value_handle);
-    return;
-  }
-
-  if (p_char->uuid == Uuid::From16Bit(GATT_UUID_HID_BT_MOUSE_INPUT))
+  if (p_rpt->uuid == GATT_UUID_HID_BT_MOUSE_INPUT)
     app_id = BTA_HH_APP_ID_MI;
-  else if (p_char->uuid == Uuid::From16Bit(GATT_UUID_HID_BT_KB_INPUT))
+  else if (p_rpt->uuid == GATT_UUID_HID_BT_KB_INPUT)
     app_id = BTA_HH_APP_ID_KB;
 
   log::verbose("report ID: {}", p_rpt->rpt_id);
 
   /* need to append report ID to the head of data */
   if (p_rpt->rpt_id != 0) {
-    p_buf = (uint8_t*)osi_malloc(p_data->len + 1);
+    p_buf = rpt_buf;
 
     p_buf[0] = p_rpt->rpt_id;
     memcpy(&p_buf[1], p_data->value, p_data->len);
@@ -1631,8 +1689,6 @@ static void bta_hh_le_input_rpt_notify(tBTA_GATTC_NOTIFY* p_data) {
   bta_hh_co_data((uint8_t)p_dev_cb->hid_handle, p_buf, p_data->len,
                  p_dev_cb->mode, 0, /* no sub class*/
                  p_dev_cb->dscp_info.ctry_code, p_dev_cb->link_spec, app_id);
-
-  if (p_buf != p_data->value) osi_free(p_buf);
 }
 
 /*******************************************************************************
@@ -552,6 +552,21 @@ void BTA_GATTC_DiscoverServiceByUuid(uint16_t conn_id,
  ******************************************************************************/
 const std::list<gatt::Service>* BTA_GATTC_GetServices(uint16_t conn_id);
 
+/*******************************************************************************
+ *
+ * Function         BTA_GATTC_GetDatabaseHash
+ *
+ * Description      This function is called to get the database hash of the
+ *                  GATT database known for the given server.
+ *
+ * Parameters       conn_id: connection ID which identify the server.
+ *                  p_hash: output parameter which will contain the hash
+ *
+ * Returns          true if the database is known, false otherwise.
+ *
+ ******************************************************************************/
+bool BTA_GATTC_GetDatabaseHash(uint16_t conn_id, Octet16* p_hash);
+
 /*******************************************************************************
  *
  * Function         BTA_GATTC_GetCharacteristic
@@ -32,6 +32,9 @@
  *
  * If you decide to use those methods in your app, make sure to not mix it with
  * existing BTA_GATTC_* API.
+ *
+ * When the server supports EATT, and so Read Multiple Variable Length, reads
+ * queued one after the other are sent together in a single request.
  */
 class BtaGattQueue {
  public:
@@ -71,6 +74,9 @@ class BtaGattQueue {
     /* write-specific fields */
     tGATT_WRITE_TYPE write_type;
     std::vector<uint8_t> value;
+
+    /* read that is not merged with the next reads */
+    bool read_alone;
   };
 
  private:
@@ -88,6 +94,13 @@ class BtaGattQueue {
                                           tBTA_GATTC_MULTI& handle,
                                           uint16_t len, uint8_t* value,
                                           void* data);
+  static bool gatt_execute_merged_reads(uint16_t conn_id,
+                                        std::list<gatt_operation>& gatt_ops);
+  static void gatt_merged_read_op_finished(uint16_t conn_id,
+                                           tGATT_STATUS status,
+                                           tBTA_GATTC_MULTI& handles,
+                                           uint16_t len, uint8_t* value,
+                                           void* data);
   // maps connection id to operations waiting for execution
   static std::unordered_map<uint16_t, std::list<gatt_operation>> gatt_op_queue;
   // contain connection ids that currently execute operations
@@ -85,6 +85,10 @@ struct AudioStats {
   size_t packet_flush_count;
   size_t frame_send_count;
   size_t frame_flush_count;
+  // Packets waiting in the LE CoC channel, sampled once per interval
+  size_t queue_sample_count;
+  size_t queued_packets_sum;
+  size_t queued_packets_max;
   std::deque<rssi_log> rssi_history;
 
   AudioStats() { Reset(); }
@@ -96,6 +100,9 @@ struct AudioStats {
     packet_flush_count = 0;
     frame_send_count = 0;
     frame_flush_count = 0;
+    queue_sample_count = 0;
+    queued_packets_sum = 0;
+    queued_packets_max = 0;
   }
 };
 
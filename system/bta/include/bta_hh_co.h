@@ -27,6 +27,7 @@
 #include <cstdint>
 
 #include "bta/include/bta_hh_api.h"
+#include "stack/include/bt_octets.h"
 #include "types/raw_address.h"
 
 typedef struct {
@@ -146,4 +147,36 @@ tBTA_HH_RPT_CACHE_ENTRY* bta_hh_le_co_cache_load(const tAclLinkSpec& link_spec,
 void bta_hh_le_co_reset_rpt_cache(const tAclLinkSpec& link_spec,
                                   uint8_t app_id);
 
+/*******************************************************************************
+ *
+ * Function         bta_hh_le_co_save_db_hash
+ *
+ * Description      This callout function is to save the hash of the GATT
+ *                  database the cached HOGP reports were discovered from.
+ *
+ * Parameters       link_spec  - acl link specification
+ *                  db_hash    - GATT database hash
+ *
+ * Returns          none
+ *
+ ******************************************************************************/
+void bta_hh_le_co_save_db_hash(const tAclLinkSpec& link_spec,
+                               const Octet16& db_hash);
+
+/*******************************************************************************
+ *
+ * Function         bta_hh_le_co_load_db_hash
+ *
+ * Description      This callout function is to load the hash of the GATT
+ *                  database the cached HOGP reports were discovered from.
+ *
+ * Parameters       link_spec  - acl link specification
+ *                  p_db_hash  - output parameter for the GATT database hash
+ *
+ * Returns          true if a hash is saved for the device.
+ *
+ ******************************************************************************/
+bool bta_hh_le_co_load_db_hash(const tAclLinkSpec& link_spec,
+                               Octet16* p_db_hash);
+
 #endif /* BTA_HH_CO_H */
@@ -29,6 +29,7 @@
 #include "common/time_util.h"
 #include "gd/hal/link_clocker.h"
 #include "os/log.h"
+#include "osi/include/thread_scheduler.h"
 #include "osi/include/wakelock.h"
 #include "stack/include/main_thread.h"
 
@@ -101,7 +102,8 @@ class SourceImpl : public LeAudioSourceAudioHalClient {
   bluetooth::audio::le_audio::LeAudioClientInterface::Sink* halSinkInterface_ =
       nullptr;
   LeAudioSourceAudioHalClient::Callbacks* audioSourceCallbacks_ = nullptr;
-  std::mutex audioSourceCallbacksMutex_;
+  // Shared by the real time worker thread and the main thread
+  PriorityInheritanceMutex audioSourceCallbacksMutex_;
   std::unique_ptr<bluetooth::audio::asrc::SourceAudioHalAsrc> asrc_;
 };
 
@@ -165,7 +167,7 @@ void SourceImpl::Release() {
 }
 
 bool SourceImpl::OnResumeReq(bool start_media_task) {
-  std::lock_guard<std::mutex> guard(audioSourceCallbacksMutex_);
+  std::lock_guard<PriorityInheritanceMutex> guard(audioSourceCallbacksMutex_);
   if (audioSourceCallbacks_ == nullptr) {
     LOG_ERROR("audioSourceCallbacks_ not set");
     return false;
@@ -209,14 +211,14 @@ void SourceImpl::SendAudioData() {
   if (IS_FLAG_ENABLED(leaudio_hal_client_asrc)) {
     auto asrc_buffers = asrc_->Run(data);
 
-    std::lock_guard<std::mutex> guard(audioSourceCallbacksMutex_);
+    std::lock_guard<PriorityInheritanceMutex> guard(audioSourceCallbacksMutex_);
     for (auto buffer : asrc_buffers) {
       if (audioSourceCallbacks_ != nullptr) {
         audioSourceCallbacks_->OnAudioDataReady(*buffer);
       }
     }
   } else {
-    std::lock_guard<std::mutex> guard(audioSourceCallbacksMutex_);
+    std::lock_guard<PriorityInheritanceMutex> guard(audioSourceCallbacksMutex_);
     if (audioSourceCallbacks_ != nullptr) {
       audioSourceCallbacks_->OnAudioDataReady(data);
     }
@@ -236,17 +238,25 @@ bool SourceImpl::InitAudioSinkThread() {
   }
 
   /* Schedule the rest of the operations */
-  if (!worker_thread_->EnableRealTimeScheduling()) {
+  worker_thread_->DoInThread(
+      FROM_HERE, base::BindOnce(
+                     [](std::string thread_name) {
+                       if (!thread_scheduler_apply_policy(
+                               thread_name.c_str())) {
 #if defined(__ANDROID__)
-    LOG(FATAL) << __func__ << ", Failed to increase media thread priority";
+                         LOG(FATAL) << "Failed to increase media thread "
+                                       "priority";
 #endif
-  }
+                       }
+                     },
+                     thread_name));
 
   return true;
 }
 
 void SourceImpl::StartAudioTicks() {
-  wakelock_acquire();
+  wakelock_acquire_for(is_broadcaster_ ? "le_audio_broadcast"
+                                       : "le_audio_unicast");
   if (IS_FLAG_ENABLED(leaudio_hal_client_asrc)) {
     asrc_ = std::make_unique<bluetooth::audio::asrc::SourceAudioHalAsrc>(
         std::make_shared<bluetooth::hal::NocpIsoEvents>(),
@@ -263,11 +273,12 @@ void SourceImpl::StartAudioTicks() {
 void SourceImpl::StopAudioTicks() {
   audio_timer_.CancelAndWait();
   asrc_.reset(nullptr);
-  wakelock_release();
+  wakelock_release_for(is_broadcaster_ ? "le_audio_broadcast"
+                                       : "le_audio_unicast");
 }
 
 bool SourceImpl::OnSuspendReq() {
-  std::lock_guard<std::mutex> guard(audioSourceCallbacksMutex_);
+  std::lock_guard<PriorityInheritanceMutex> guard(audioSourceCallbacksMutex_);
   if (CodecManager::GetInstance()->GetCodecLocation() ==
       types::CodecLocation::HOST) {
     if (IS_FLAG_ENABLED(run_ble_audio_ticks_in_worker_thread)) {
@@ -298,7 +309,7 @@ bool SourceImpl::OnSuspendReq() {
 
 bool SourceImpl::OnMetadataUpdateReq(
     const source_metadata_v7_t& source_metadata, DsaMode dsa_mode) {
-  std::lock_guard<std::mutex> guard(audioSourceCallbacksMutex_);
+  std::lock_guard<PriorityInheritanceMutex> guard(audioSourceCallbacksMutex_);
   if (audioSourceCallbacks_ == nullptr) {
     LOG(ERROR) << __func__ << ", audio receiver not started";
     return false;
@@ -354,7 +365,7 @@ bool SourceImpl::Start(const LeAudioCodecConfiguration& codec_configuration,
   LeAudioClientInterface::Get()->SetAllowedDsaModes(dsa_modes);
   halSinkInterface_->StartSession();
 
-  std::lock_guard<std::mutex> guard(audioSourceCallbacksMutex_);
+  std::lock_guard<PriorityInheritanceMutex> guard(audioSourceCallbacksMutex_);
   audioSourceCallbacks_ = audioReceiver;
   le_audio_sink_hal_state_ = HAL_STARTED;
   return true;
@@ -387,7 +398,7 @@ void SourceImpl::Stop() {
     }
   }
 
-  std::lock_guard<std::mutex> guard(audioSourceCallbacksMutex_);
+  std::lock_guard<PriorityInheritanceMutex> guard(audioSourceCallbacksMutex_);
   audioSourceCallbacks_ = nullptr;
 }
 
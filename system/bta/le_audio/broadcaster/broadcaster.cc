@@ -19,6 +19,7 @@
 #include <base/logging.h>
 #include <lc3.h>
 
+#include <algorithm>
 #include <mutex>
 
 #include "bta/include/bta_le_audio_broadcaster_api.h"
@@ -799,6 +800,7 @@ class LeAudioBroadcasterImpl : public LeAudioBroadcaster, public BigCallbacks {
       auto& broadcast = broadcast_pair.second;
       if (broadcast) stream << *broadcast;
     }
+    audio_receiver_.Dump(stream);
 
     dprintf(fd, "%s", stream.str().c_str());
   }
@@ -1010,22 +1012,26 @@ class LeAudioBroadcasterImpl : public LeAudioBroadcaster, public BigCallbacks {
                              .first) {}
 
     void CheckAndReconfigureEncoders() {
-      auto const& codec_id = codec_wrapper_.GetLeAudioCodecId();
       /* TODO: We should act smart and reuse current configurations */
-      sw_enc_.clear();
-      while (sw_enc_.size() != codec_wrapper_.GetNumChannels()) {
-        auto codec = le_audio::CodecInterface::CreateInstance(codec_id);
+      encoder_sets_.clear();
+      encoder_sets_.emplace_back(codec_wrapper_.GetOctetsPerCodecFrame());
+      CreateEncoders(encoder_sets_.front());
+    }
 
-        auto codec_status =
-            codec->InitEncoder(codec_wrapper_.GetLeAudioCodecConfiguration(),
-                               codec_wrapper_.GetLeAudioCodecConfiguration());
-        if (codec_status != le_audio::CodecInterface::Status::STATUS_OK) {
-          LOG_ERROR("Channel %d codec setup failed with err: %d",
-                    (uint32_t)sw_enc_.size(), codec_status);
-          return;
+    void Dump(std::stringstream& stream) const {
+      for (auto const& set : encoder_sets_) {
+        stream << "    Encoded SDUs of " << set.octets_per_codec_frame
+               << " octets per codec frame, shared by " << set.num_broadcasts
+               << " broadcast(s):\n";
+        for (size_t chan = 0; chan < set.stats.size(); ++chan) {
+          auto const& stats = set.stats[chan];
+          stream << "      BIS index " << chan + 1
+                 << ": encodes: " << stats.num_encodes << ", mean: "
+                 << (stats.num_encodes
+                         ? stats.total_encode_time_us / stats.num_encodes
+                         : 0)
+                 << " us, max: " << stats.max_encode_time_us << " us\n";
         }
-
-        sw_enc_.emplace_back(std::move(codec));
       }
     }
 
@@ -1038,7 +1044,7 @@ class LeAudioBroadcasterImpl : public LeAudioBroadcaster, public BigCallbacks {
     }
 
     static void sendBroadcastData(
-        const std::unique_ptr<BroadcastStateMachine>& broadcast,
+        BroadcastStateMachine* broadcast,
         std::vector<std::unique_ptr<le_audio::CodecInterface>>& encoders) {
       auto const& config = broadcast->GetBigConfig();
       if (config == std::nullopt) {
@@ -1068,28 +1074,67 @@ class LeAudioBroadcasterImpl : public LeAudioBroadcaster, public BigCallbacks {
 
       LOG_VERBOSE("Received %zu bytes.", data.size());
 
+      if (encoder_sets_.empty()) return;
+
       /* Constants for the channel data configuration */
       const auto num_channels = codec_wrapper_.GetNumChannels();
       const auto bytes_per_sample = (codec_wrapper_.GetBitsPerSample() / 8);
 
-      /* Prepare encoded data for all channels */
-      for (uint8_t chan = 0; chan < num_channels; ++chan) {
-        auto initial_channel_offset = chan * bytes_per_sample;
-        sw_enc_[chan]->Encode(data.data() + initial_channel_offset,
-                              num_channels,
-                              codec_wrapper_.GetOctetsPerCodecFrame());
-      }
-
       /* Currently there is no way to broadcast multiple distinct streams.
        * We just receive all system sounds mixed into a one stream and each
-       * broadcast gets the same data.
+       * broadcast gets the same data, encoded once per codec frame size.
        */
+      std::vector<std::pair<BroadcastStateMachine*, uint32_t>> streams;
+      for (auto& set : encoder_sets_) set.num_broadcasts = 0;
       for (auto& broadcast_pair : instance->broadcasts_) {
         auto& broadcast = broadcast_pair.second;
-        if ((broadcast->GetState() ==
-             BroadcastStateMachine::State::STREAMING) &&
-            !broadcast->IsMuted())
-          sendBroadcastData(broadcast, sw_enc_);
+        if ((broadcast->GetState() !=
+             BroadcastStateMachine::State::STREAMING) ||
+            broadcast->IsMuted())
+          continue;
+
+        auto set = GetEncoderSet(broadcast->GetCodecConfig());
+        if (set == nullptr) continue;
+        set->num_broadcasts++;
+        streams.emplace_back(broadcast.get(), set->octets_per_codec_frame);
+      }
+
+      /* The sets no longer in use are released, but the one of the audio
+       * source configuration.
+       */
+      encoder_sets_.erase(
+          std::remove_if(std::next(encoder_sets_.begin()), encoder_sets_.end(),
+                         [](auto const& set) { return !set.num_broadcasts; }),
+          encoder_sets_.end());
+
+      /* Prepare encoded data for all channels */
+      std::vector<le_audio::CodecInterface::EncodeJob> jobs;
+      jobs.reserve(encoder_sets_.size() * num_channels);
+      for (auto& set : encoder_sets_) {
+        for (uint8_t chan = 0; chan < set.encoders.size(); ++chan) {
+          auto initial_channel_offset = chan * bytes_per_sample;
+          jobs.push_back({set.encoders[chan].get(),
+                          data.data() + initial_channel_offset, num_channels,
+                          static_cast<uint16_t>(set.octets_per_codec_frame)});
+        }
+      }
+      le_audio::CodecInterface::EncodeBatch(jobs,
+                                            codec_wrapper_.GetDataIntervalUs());
+
+      auto job = jobs.cbegin();
+      for (auto& set : encoder_sets_) {
+        for (auto& stats : set.stats) {
+          stats.num_encodes++;
+          stats.total_encode_time_us += job->encode_time_us;
+          stats.max_encode_time_us =
+              std::max(stats.max_encode_time_us, job->encode_time_us);
+          job++;
+        }
+      }
+
+      for (auto [broadcast, octets_per_codec_frame] : streams) {
+        sendBroadcastData(broadcast,
+                          FindEncoderSet(octets_per_codec_frame)->encoders);
       }
       LOG_VERBOSE("All data sent.");
     }
@@ -1136,8 +1181,79 @@ class LeAudioBroadcasterImpl : public LeAudioBroadcaster, public BigCallbacks {
     }
 
    private:
+    struct BisEncodeStats {
+      size_t num_encodes = 0;
+      uint64_t total_encode_time_us = 0;
+      uint32_t max_encode_time_us = 0;
+    };
+
+    /* Encoders of the channels at a codec frame size. The channels are
+     * encoded once per set, and the encoded SDUs are shared by all the
+     * broadcasts (and their subgroups) using this codec frame size.
+     */
+    struct EncoderSet {
+      explicit EncoderSet(uint32_t octets_per_codec_frame)
+          : octets_per_codec_frame(octets_per_codec_frame) {}
+
+      uint32_t octets_per_codec_frame;
+      std::vector<std::unique_ptr<le_audio::CodecInterface>> encoders;
+      std::vector<BisEncodeStats> stats;
+      size_t num_broadcasts = 0;
+    };
+
+    bool CreateEncoders(EncoderSet& set) {
+      auto const& codec_id = codec_wrapper_.GetLeAudioCodecId();
+      while (set.encoders.size() != codec_wrapper_.GetNumChannels()) {
+        auto codec = le_audio::CodecInterface::CreateInstance(codec_id);
+
+        auto codec_status =
+            codec->InitEncoder(codec_wrapper_.GetLeAudioCodecConfiguration(),
+                               codec_wrapper_.GetLeAudioCodecConfiguration());
+        if (codec_status != le_audio::CodecInterface::Status::STATUS_OK) {
+          LOG_ERROR("Channel %d codec setup failed with err: %d",
+                    (uint32_t)set.encoders.size(), codec_status);
+          return false;
+        }
+
+        set.encoders.emplace_back(std::move(codec));
+        set.stats.emplace_back();
+      }
+      return true;
+    }
+
+    /* Returns the encoder set of a broadcast. The broadcasts sharing the PCM
+     * stream configuration of the audio source but having another codec frame
+     * size get their own set, the others use the set of the audio source.
+     */
+    EncoderSet* GetEncoderSet(const BroadcastCodecWrapper& config) {
+      auto octets_per_codec_frame = codec_wrapper_.GetOctetsPerCodecFrame();
+      if (config.GetLeAudioCodecConfiguration() ==
+          codec_wrapper_.GetLeAudioCodecConfiguration()) {
+        octets_per_codec_frame = config.GetOctetsPerCodecFrame();
+      }
+
+      auto set = FindEncoderSet(octets_per_codec_frame);
+      if (set != nullptr) return set;
+
+      LOG_INFO("Encoding an additional set of SDUs of %u octets per frame",
+               octets_per_codec_frame);
+      set = &encoder_sets_.emplace_back(octets_per_codec_frame);
+      if (!CreateEncoders(*set)) {
+        encoder_sets_.pop_back();
+        return nullptr;
+      }
+      return set;
+    }
+
+    EncoderSet* FindEncoderSet(uint32_t octets_per_codec_frame) {
+      for (auto& set : encoder_sets_) {
+        if (set.octets_per_codec_frame == octets_per_codec_frame) return &set;
+      }
+      return nullptr;
+    }
+
     BroadcastCodecWrapper codec_wrapper_;
-    std::vector<std::unique_ptr<le_audio::CodecInterface>> sw_enc_;
+    std::vector<EncoderSet> encoder_sets_;
   } audio_receiver_;
 
   bluetooth::le_audio::LeAudioBroadcasterCallbacks* callbacks_;
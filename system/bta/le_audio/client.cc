@@ -20,6 +20,7 @@
 #include <base/strings/string_number_conversions.h>
 #include <lc3.h>
 
+#include <array>
 #include <deque>
 #include <map>
 #include <mutex>
@@ -42,6 +43,7 @@
 #include "content_control_id_keeper.h"
 #include "device/include/controller.h"
 #include "devices.h"
+#include "iso_jitter_buffer.h"
 #include "include/check.h"
 #include "internal_include/bt_trace.h"
 #include "internal_include/stack_config.h"
@@ -49,6 +51,7 @@
 #include "le_audio_set_configuration_provider.h"
 #include "le_audio_types.h"
 #include "le_audio_utils.h"
+#include "metrics/counter_registry.h"
 #include "metrics_collector.h"
 #include "os/log.h"
 #include "osi/include/osi.h"
@@ -232,6 +235,7 @@ class LeAudioClientImpl : public LeAudioClient {
             {.sink = AudioContexts(), .source = AudioContexts()}),
         stream_setup_start_timestamp_(0),
         stream_setup_end_timestamp_(0),
+        stream_setup_warm_resume_(false),
         audio_receiver_state_(AudioState::IDLE),
         audio_sender_state_(AudioState::IDLE),
         in_call_(false),
@@ -918,6 +922,11 @@ class LeAudioClientImpl : public LeAudioClient {
                AseState::BTA_LE_AUDIO_ASE_STATE_STREAMING) {
       stream_setup_start_timestamp_ =
           bluetooth::common::time_get_os_boottime_us();
+      /* The CIG and the QoS configuration of the ASEs were kept since the
+       * last suspend, only the Enable operation is needed.
+       */
+      stream_setup_warm_resume_ =
+          group->GetState() == AseState::BTA_LE_AUDIO_ASE_STATE_QOS_CONFIGURED;
     }
 
     /* If assistant have some connected delegators that needs to be informed
@@ -1219,6 +1228,7 @@ class LeAudioClientImpl : public LeAudioClient {
 
     LOG_INFO("Group id: %d", group_id_to_close);
     if (alarm_is_scheduled(suspend_timeout_)) alarm_cancel(suspend_timeout_);
+    if (alarm_is_scheduled(disable_timer_)) alarm_cancel(disable_timer_);
 
     StopAudio();
     ClientAudioInterfaceRelease();
@@ -3325,8 +3335,12 @@ class LeAudioClientImpl : public LeAudioClient {
         sw_enc_left->Encode(mono.data(), 1, byte_count);
       }
     } else {
-      sw_enc_left->Encode(data.data(), 2, byte_count);
-      sw_enc_right->Encode(data.data() + bytes_per_sample, 2, byte_count);
+      std::vector<le_audio::CodecInterface::EncodeJob> jobs = {
+          {sw_enc_left.get(), data.data(), 2, byte_count},
+          {sw_enc_right.get(), data.data() + bytes_per_sample, 2, byte_count},
+      };
+      le_audio::CodecInterface::EncodeBatch(
+          jobs, current_source_codec_config.data_interval_us);
     }
 
     DLOG(INFO) << __func__ << " left_cis_handle: " << +left_cis_handle
@@ -3369,10 +3383,15 @@ class LeAudioClientImpl : public LeAudioClient {
           data, bytes_per_sample, number_of_required_samples_per_channel);
       sw_enc_left->Encode(mono.data(), 1, byte_count);
     } else {
-      sw_enc_left->Encode((const uint8_t*)data.data(), 2, byte_count);
-      // Output to the left channel buffer with `byte_count` offset
-      sw_enc_right->Encode((const uint8_t*)data.data() + 2, 2, byte_count,
-                           &sw_enc_left->GetDecodedSamples(), byte_count);
+      // Output the right channel to the left channel buffer with
+      // `byte_count` offset
+      std::vector<le_audio::CodecInterface::EncodeJob> jobs = {
+          {sw_enc_left.get(), data.data(), 2, byte_count},
+          {sw_enc_right.get(), data.data() + 2, 2, byte_count,
+           &sw_enc_left->GetDecodedSamples(), byte_count},
+      };
+      le_audio::CodecInterface::EncodeBatch(
+          jobs, current_source_codec_config.data_interval_us);
     }
 
     IsoManager::GetInstance()->SendIsoData(
@@ -3469,6 +3488,21 @@ class LeAudioClientImpl : public LeAudioClient {
       return;
     }
 
+    if (sink_jitter_buffer_) {
+      static auto* late_sdus =
+          bluetooth::metrics::CounterRegistry::Get().GetCounter(
+              "le_audio.sink.late_sdus");
+      size_t prev_late_sdus = sink_jitter_buffer_->GetStats().late_sdus;
+      sink_jitter_buffer_->Push(decoder == sw_dec_right.get() ? 1 : 0,
+                                timestamp, data, size,
+                                bluetooth::common::time_get_os_boottime_us());
+      if (sink_jitter_buffer_->GetStats().late_sdus != prev_late_sdus) {
+        late_sdus->Increment();
+      }
+      PlayoutSinkJitterBuffer();
+      return;
+    }
+
     if (!left_cis_handle || !right_cis_handle) {
       /* mono or just one device connected */
       decoder->Decode(data, size);
@@ -3524,6 +3558,48 @@ class LeAudioClientImpl : public LeAudioClient {
     cached_channel_ = decoder;
   }
 
+  /* Decodes and sends to AF the frames of the jitter buffer ready for playout,
+   * concealing the lost SDUs */
+  void PlayoutSinkJitterBuffer() {
+    static auto* lost_sdus =
+        bluetooth::metrics::CounterRegistry::Get().GetCounter(
+            "le_audio.sink.lost_sdus");
+    std::array<le_audio::CodecInterface*, 2> decoders = {sw_dec_left.get(),
+                                                          sw_dec_right.get()};
+    le_audio::IsoJitterBuffer::Frame frame;
+    while (sink_jitter_buffer_->Pop(&frame)) {
+      std::array<std::vector<int16_t>*, 2> pcm = {nullptr, nullptr};
+      for (size_t i = 0; i < decoders.size(); i++) {
+        auto state = frame.states[i];
+        if (state == le_audio::IsoJitterBuffer::ChannelState::ABSENT ||
+            decoders[i] == nullptr) {
+          continue;
+        }
+        /* Without an SDU, the LC3 decoder conceals the lost audio */
+        uint8_t* sdu = nullptr;
+        if (state == le_audio::IsoJitterBuffer::ChannelState::RECEIVED) {
+          sdu = frame.sdus[i].data();
+        } else {
+          lost_sdus->Increment();
+        }
+        decoders[i]->Decode(sdu, sdu ? frame.sdus[i].size() : 0);
+        sink_pcm_[i] = decoders[i]->GetDecodedSamples();
+        pcm[i] = &sink_pcm_[i];
+      }
+      if (pcm[0] == nullptr && pcm[1] == nullptr) continue;
+
+      int correction = sink_jitter_buffer_->TakeDriftCorrection(
+          pcm[0] ? pcm[0]->size() : pcm[1]->size());
+      for (auto* channel_pcm : pcm) {
+        if (channel_pcm) {
+          le_audio::IsoJitterBuffer::ApplyDriftCorrection(channel_pcm,
+                                                          correction);
+        }
+      }
+      SendAudioDataToAF(pcm[0], pcm[1]);
+    }
+  }
+
   void SendAudioDataToAF(std::vector<int16_t>* left,
                          std::vector<int16_t>* right = nullptr) {
     uint16_t to_write = 0;
@@ -3724,6 +3800,12 @@ class LeAudioClientImpl : public LeAudioClient {
         groupStateMachine_->StopStream(group);
         return;
       }
+
+      sink_jitter_buffer_.reset();
+      if (osi_property_get_bool(kSinkJitterBufferProp, false)) {
+        sink_jitter_buffer_ = std::make_unique<le_audio::IsoJitterBuffer>(
+            current_sink_codec_config.data_interval_us);
+      }
     }
     le_audio_sink_hal_client_->UpdateRemoteDelay(remote_delay_ms);
     ConfirmLocalAudioSinkStreamingRequest();
@@ -3750,6 +3832,7 @@ class LeAudioClientImpl : public LeAudioClient {
     if (sw_enc_right) sw_enc_right.reset();
     if (sw_dec_left) sw_dec_left.reset();
     if (sw_dec_right) sw_dec_right.reset();
+    sink_jitter_buffer_.reset();
     CleanCachedMicrophoneData();
   }
 
@@ -3798,6 +3881,13 @@ class LeAudioClientImpl : public LeAudioClient {
     if (conf) {
       printSingleConfiguration(fd, conf, true, false);
     }
+
+    auto stats = le_audio::CodecInterface::GetEncodeBatchStats();
+    dprintf(fd,
+            " Encoding: batches: %zu, deadline misses: %zu, last: %u us, "
+            "max: %u us\n",
+            stats.num_batches, stats.num_deadline_misses,
+            stats.last_encode_time_us, stats.max_encode_time_us);
   }
 
   void Dump(int fd) {
@@ -3828,7 +3918,26 @@ class LeAudioClientImpl : public LeAudioClient {
       dprintf(fd, ", %d ms", static_cast<int>(t));
     }
     dprintf(fd, "\n");
+    for (bool warm_resume : {false, true}) {
+      auto stats =
+          le_audio::MetricsCollector::Get()->GetTimeToAudioStats(warm_resume);
+      if (stats.count == 0) continue;
+      dprintf(fd,
+              "  Time to audio (%s): count: %u, avg: %d ms, max: %d ms, "
+              "last: %d ms\n",
+              warm_resume ? "warm" : "cold", stats.count,
+              static_cast<int>(stats.total_ms / stats.count),
+              static_cast<int>(stats.max_ms), static_cast<int>(stats.last_ms));
+    }
     printCurrentStreamConfiguration(fd);
+    if (sink_jitter_buffer_) {
+      const auto& stats = sink_jitter_buffer_->GetStats();
+      dprintf(fd,
+              "  Microphone jitter buffer: received: %zu, late: %zu, lost: "
+              "%zu, jitter: %u us, depth: %d, drift: %.1f ppm\n",
+              stats.received_sdus, stats.late_sdus, stats.lost_sdus,
+              stats.jitter_us, stats.depth, stats.drift_ppm);
+    }
     dprintf(fd, "  ----------------\n ");
     dprintf(fd, "  LE Audio Groups:\n");
     aseGroups_.Dump(fd, active_group_id_);
@@ -3843,6 +3952,7 @@ class LeAudioClientImpl : public LeAudioClient {
   void Cleanup() {
     StopVbcCloseTimeout();
     if (alarm_is_scheduled(suspend_timeout_)) alarm_cancel(suspend_timeout_);
+    if (alarm_is_scheduled(disable_timer_)) alarm_cancel(disable_timer_);
 
     if (active_group_id_ != bluetooth::groups::kGroupUnknown) {
       /* Bluetooth turned off while streaming */
@@ -3974,35 +4084,56 @@ class LeAudioClientImpl : public LeAudioClient {
                        remote_contexts);
   }
 
+  /* When enabled, the ASEs are only disabled once the ISO keep alive timeout
+   * expires. The CIG and the QoS configuration of the ASEs are kept for a
+   * while longer, so that the stream can be resumed with the Enable operation
+   * only.
+   */
+  uint64_t GetWarmResumeTimeoutMs() {
+    return osi_property_get_int32(kAudioSuspendKeepQosConfiguredTimeoutMsProp,
+                                  0);
+  }
+
+  bool IsWarmResumeEnabled() {
+    return !stack_config_get_interface()
+                ->get_pts_le_audio_disable_ases_before_stopping() &&
+           GetWarmResumeTimeoutMs() > 0;
+  }
+
   void OnAudioSuspend() {
     if (active_group_id_ == bluetooth::groups::kGroupUnknown) {
       LOG(WARNING) << ", there is no longer active group";
       return;
     }
 
+    /* Group should tie in time to get requested status */
+    uint64_t timeoutMs = kAudioSuspentKeepIsoAliveTimeoutMs;
+    timeoutMs = osi_property_get_int32(kAudioSuspentKeepIsoAliveTimeoutMsProp,
+                                       timeoutMs);
+
+    uint64_t disableTimeoutMs = 0;
     if (stack_config_get_interface()
             ->get_pts_le_audio_disable_ases_before_stopping()) {
-      LOG_INFO("Stream disable_timer_ started");
+      disableTimeoutMs = kAudioDisableTimeoutMs;
+      timeoutMs += kAudioDisableTimeoutMs;
+    } else if (IsWarmResumeEnabled()) {
+      disableTimeoutMs = timeoutMs;
+      timeoutMs += GetWarmResumeTimeoutMs();
+    }
+
+    if (disableTimeoutMs > 0) {
+      LOG_INFO("Stream disable_timer_ started: %d ms",
+               static_cast<int>(disableTimeoutMs));
       if (alarm_is_scheduled(disable_timer_)) alarm_cancel(disable_timer_);
 
       alarm_set_on_mloop(
-          disable_timer_, kAudioDisableTimeoutMs,
+          disable_timer_, disableTimeoutMs,
           [](void* data) {
             if (instance) instance->GroupSuspend(PTR_TO_INT(data));
           },
           INT_TO_PTR(active_group_id_));
     }
 
-    /* Group should tie in time to get requested status */
-    uint64_t timeoutMs = kAudioSuspentKeepIsoAliveTimeoutMs;
-    timeoutMs = osi_property_get_int32(kAudioSuspentKeepIsoAliveTimeoutMsProp,
-                                       timeoutMs);
-
-    if (stack_config_get_interface()
-            ->get_pts_le_audio_disable_ases_before_stopping()) {
-      timeoutMs += kAudioDisableTimeoutMs;
-    }
-
     LOG_DEBUG("Stream suspend_timeout_ started: %d ms",
               static_cast<int>(timeoutMs));
     if (alarm_is_scheduled(suspend_timeout_)) alarm_cancel(suspend_timeout_);
@@ -4236,6 +4367,8 @@ class LeAudioClientImpl : public LeAudioClient {
             /* Stream is up just restore it */
             if (alarm_is_scheduled(suspend_timeout_))
               alarm_cancel(suspend_timeout_);
+            if (alarm_is_scheduled(disable_timer_))
+              alarm_cancel(disable_timer_);
             ConfirmLocalAudioSourceStreamingRequest();
             le_audio::MetricsCollector::Get()->OnStreamStarted(
                 active_group_id_, configuration_context_type_);
@@ -4510,6 +4643,8 @@ class LeAudioClientImpl : public LeAudioClient {
             /* Stream is up just restore it */
             if (alarm_is_scheduled(suspend_timeout_))
               alarm_cancel(suspend_timeout_);
+            if (alarm_is_scheduled(disable_timer_))
+              alarm_cancel(disable_timer_);
             ConfirmLocalAudioSinkStreamingRequest();
             break;
           case AudioState::RELEASING:
@@ -4606,12 +4741,19 @@ class LeAudioClientImpl : public LeAudioClient {
       return false;
     }
 
-    if (group->GetState() != AseState::BTA_LE_AUDIO_ASE_STATE_STREAMING) {
+    /* The QoS configuration kept for a warm resume is no longer valid */
+    bool is_warm_suspended =
+        IsWarmResumeEnabled() && !group->IsInTransition() &&
+        group->GetState() == AseState::BTA_LE_AUDIO_ASE_STATE_QOS_CONFIGURED;
+
+    if (group->GetState() != AseState::BTA_LE_AUDIO_ASE_STATE_STREAMING &&
+        !is_warm_suspended) {
       DLOG(INFO) << __func__ << " Group is not streaming ";
       return false;
     }
 
     if (alarm_is_scheduled(suspend_timeout_)) alarm_cancel(suspend_timeout_);
+    if (alarm_is_scheduled(disable_timer_)) alarm_cancel(disable_timer_);
 
     /* Need to reconfigure stream */
     group->SetPendingConfiguration();
@@ -5447,7 +5589,7 @@ class LeAudioClientImpl : public LeAudioClient {
     }
   }
 
-  void take_stream_time(void) {
+  void take_stream_time(int group_id) {
     if (stream_setup_start_timestamp_ == 0) {
       return;
     }
@@ -5459,9 +5601,13 @@ class LeAudioClientImpl : public LeAudioClient {
     stream_setup_end_timestamp_ = bluetooth::common::time_get_os_boottime_us();
     stream_start_history_queue_.emplace_front(
         (stream_setup_end_timestamp_ - stream_setup_start_timestamp_) / 1000);
+    le_audio::MetricsCollector::Get()->OnStreamSetupCompleted(
+        group_id, stream_setup_warm_resume_,
+        stream_start_history_queue_.front());
 
     stream_setup_end_timestamp_ = 0;
     stream_setup_start_timestamp_ = 0;
+    stream_setup_warm_resume_ = false;
   }
 
   void notifyGroupStreamStatus(int group_id,
@@ -5504,7 +5650,7 @@ class LeAudioClientImpl : public LeAudioClient {
         ASSERT_LOG(group_id == active_group_id_, "invalid group id %d!=%d",
                    group_id, active_group_id_);
 
-        take_stream_time();
+        take_stream_time(group_id);
 
         le_audio::MetricsCollector::Get()->OnStreamStarted(
             active_group_id_, configuration_context_type_);
@@ -5546,6 +5692,7 @@ class LeAudioClientImpl : public LeAudioClient {
           groupStateMachine_->StopStream(group);
           stream_setup_start_timestamp_ =
               bluetooth::common::time_get_os_boottime_us();
+          stream_setup_warm_resume_ = false;
           return;
         }
 
@@ -5604,6 +5751,7 @@ class LeAudioClientImpl : public LeAudioClient {
         if (sw_enc_right) sw_enc_right.reset();
         if (sw_dec_left) sw_dec_left.reset();
         if (sw_dec_right) sw_dec_right.reset();
+        sink_jitter_buffer_.reset();
         CleanCachedMicrophoneData();
 
         if (group) {
@@ -5710,6 +5858,7 @@ class LeAudioClientImpl : public LeAudioClient {
   BidirectionalPair<AudioContexts> local_metadata_context_types_;
   uint64_t stream_setup_start_timestamp_;
   uint64_t stream_setup_end_timestamp_;
+  bool stream_setup_warm_resume_;
   std::deque<uint64_t> stream_start_history_queue_;
 
   /* Microphone (s) */
@@ -5775,6 +5924,8 @@ class LeAudioClientImpl : public LeAudioClient {
   static constexpr uint64_t kAudioDisableTimeoutMs = 3000;
   static constexpr char kAudioSuspentKeepIsoAliveTimeoutMsProp[] =
       "persist.bluetooth.leaudio.audio.suspend.timeoutms";
+  static constexpr char kAudioSuspendKeepQosConfiguredTimeoutMsProp[] =
+      "persist.bluetooth.leaudio.audio.suspend.keep_qos_configured.timeoutms";
   alarm_t* close_vbc_timeout_;
   alarm_t* suspend_timeout_;
   alarm_t* disable_timer_;
@@ -5783,6 +5934,12 @@ class LeAudioClientImpl : public LeAudioClient {
   uint32_t cached_channel_timestamp_ = 0;
   le_audio::CodecInterface* cached_channel_ = nullptr;
 
+  /* Microphone jitter buffer, replacing the cached channel when enabled */
+  static constexpr char kSinkJitterBufferProp[] =
+      "persist.bluetooth.leaudio.sink_jitter_buffer";
+  std::unique_ptr<le_audio::IsoJitterBuffer> sink_jitter_buffer_;
+  std::array<std::vector<int16_t>, 2> sink_pcm_;
+
   base::WeakPtrFactory<LeAudioClientImpl> weak_factory_{this};
 
   std::map<int, GroupStreamStatus> lastNotifiedGroupStreamStatusMap_;
@@ -20,15 +20,119 @@
 
 #include <base/logging.h>
 #include <lc3.h>
+#include <pthread.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <thread>
 #include <vector>
 
 #include "os/log.h"
+#include "osi/include/properties.h"
 
 namespace le_audio {
 
+namespace {
+constexpr char kParallelEncodingProp[] =
+    "persist.bluetooth.leaudio.parallel_encoding";
+
+constexpr size_t kMaxEncodeWorkers = 3;
+
+/* Worker threads, sharing with the calling thread the encoding of the
+ * channels of a batch. The pool lives as long as the process.
+ */
+class EncodeWorkerPool {
+ public:
+  static EncodeWorkerPool* Get() {
+    static EncodeWorkerPool* pool = []() -> EncodeWorkerPool* {
+      if (!osi_property_get_bool(kParallelEncodingProp, false)) return nullptr;
+      size_t num_cpus = std::thread::hardware_concurrency();
+      size_t num_workers =
+          std::clamp(num_cpus > 1 ? num_cpus - 1 : 1, size_t(1),
+                     kMaxEncodeWorkers);
+      LOG_INFO("Parallel encoding on %zu worker threads", num_workers);
+      return new EncodeWorkerPool(num_workers);
+    }();
+    return pool;
+  }
+
+  /* Runs `job(i)` for each i in [0, num_jobs), returns once all are done */
+  void Run(size_t num_jobs, const std::function<void(size_t)>& job) {
+    auto batch = std::make_shared<Batch>(job, num_jobs);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      batch_ = batch;
+    }
+    work_cv_.notify_all();
+
+    RunJobs(*batch);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [&batch] { return batch->pending == 0; });
+    batch_ = nullptr;
+  }
+
+ private:
+  struct Batch {
+    Batch(const std::function<void(size_t)>& job, size_t num_jobs)
+        : job(job), num_jobs(num_jobs), next(0), pending(num_jobs) {}
+
+    const std::function<void(size_t)>& job;
+    const size_t num_jobs;
+    std::atomic<size_t> next;
+    std::atomic<size_t> pending;
+  };
+
+  explicit EncodeWorkerPool(size_t num_workers) {
+    for (size_t i = 0; i < num_workers; i++) {
+      std::thread([this] { WorkerLoop(); }).detach();
+    }
+  }
+
+  void RunJobs(Batch& batch) {
+    for (size_t i; (i = batch.next++) < batch.num_jobs;) {
+      batch.job(i);
+      if (--batch.pending == 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_cv_.notify_all();
+      }
+    }
+  }
+
+  void WorkerLoop() {
+    pthread_setname_np(pthread_self(), "bt_le_audio_enc");
+
+    std::shared_ptr<Batch> last;
+    for (;;) {
+      std::shared_ptr<Batch> batch;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_cv_.wait(lock,
+                      [&] { return batch_ != nullptr && batch_ != last; });
+        batch = batch_;
+      }
+      // A batch completed before this worker woke up has no job left
+      RunJobs(*batch);
+      last = std::move(batch);
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  std::shared_ptr<Batch> batch_;
+};
+
+std::mutex encode_batch_stats_mutex;
+CodecInterface::EncodeBatchStats encode_batch_stats;
+}  // namespace
+
 struct CodecInterface::Impl {
   Impl(const types::LeAudioCodecId& codec_id) : codec_id_(codec_id) {}
   ~Impl() { Cleanup(); }
@@ -135,6 +239,20 @@ struct CodecInterface::Impl {
                                 uint16_t out_size,
                                 std::vector<int16_t>* out_buffer = nullptr,
                                 uint16_t out_offset = 0) {
+    auto status = PrepareEncode(out_size, &out_buffer, out_offset);
+    if (status != Status::STATUS_OK) {
+      return status;
+    }
+
+    return EncodePrepared(data, stride, out_size, out_buffer, out_offset);
+  }
+
+  /* Checks the encoder state, and sizes the output buffer of an encoding,
+   * which is returned in `out_buffer`.
+   */
+  CodecInterface::Status PrepareEncode(uint16_t out_size,
+                                       std::vector<int16_t>** out_buffer,
+                                       uint16_t out_offset) {
     if (!IsReady()) {
       LOG_ERROR("decoder not ready");
       return Status::STATUS_ERR_CODEC_NOT_READY;
@@ -148,8 +266,8 @@ struct CodecInterface::Impl {
     // For now only LC3 is supported
     if (codec_id_.coding_format == types::kLeAudioCodingFormatLC3) {
       // Prepare the encoded output buffer
-      if (out_buffer == nullptr) {
-        out_buffer = &output_channel_data_;
+      if (*out_buffer == nullptr) {
+        *out_buffer = &output_channel_data_;
       }
 
       // We have two bytes per sample in the buffer, while out_size and
@@ -158,9 +276,26 @@ struct CodecInterface::Impl {
       if (output_channel_samples_ < channel_samples) {
         output_channel_samples_ = channel_samples;
       }
-      adjustOutputBufferSizeIfNeeded(out_buffer);
+      adjustOutputBufferSizeIfNeeded(*out_buffer);
+
+      return Status::STATUS_OK;
+    }
+
+    LOG_ERROR("Invalid codec ID: [%d:%d:%d]", codec_id_.coding_format,
+              codec_id_.vendor_company_id, codec_id_.vendor_codec_id);
+    return Status::STATUS_ERR_INVALID_CODEC_ID;
+  }
 
-      // Encode
+  /* Encodes to an output buffer sized by PrepareEncode(). It does not modify
+   * the codec instance other than its encoder state, so that independent
+   * encoders can run in parallel.
+   */
+  CodecInterface::Status EncodePrepared(const uint8_t* data, int stride,
+                                        uint16_t out_size,
+                                        std::vector<int16_t>* out_buffer,
+                                        uint16_t out_offset) {
+    // For now only LC3 is supported
+    if (codec_id_.coding_format == types::kLeAudioCodingFormatLC3) {
       auto err =
           lc3_encode(lc3_.encoder_, lc3_.pcm_format_, data, stride, out_size,
                      ((uint8_t*)out_buffer->data()) + out_offset);
@@ -295,4 +430,83 @@ uint8_t CodecInterface::GetNumOfBytesPerSample() {
   return impl->GetNumOfBytesPerSample();
 };
 
+CodecInterface::Status CodecInterface::EncodeBatch(
+    std::vector<EncodeJob>& jobs, uint32_t deadline_us) {
+  auto start = std::chrono::steady_clock::now();
+
+  // Size the output buffers in the order of the jobs, as the encodings would
+  // do one after the other, then encode to the sized buffers.
+  std::vector<Status> statuses(jobs.size(), Status::STATUS_OK);
+  for (size_t i = 0; i < jobs.size(); i++) {
+    auto& job = jobs[i];
+    statuses[i] = job.codec->impl->PrepareEncode(job.out_size, &job.out_buffer,
+                                                 job.out_offset);
+  }
+
+  auto encode = [&jobs, &statuses](size_t i) {
+    if (statuses[i] != Status::STATUS_OK) return;
+    auto& job = jobs[i];
+    auto job_start = std::chrono::steady_clock::now();
+    statuses[i] = job.codec->impl->EncodePrepared(
+        job.data, job.stride, job.out_size, job.out_buffer, job.out_offset);
+    job.encode_time_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - job_start)
+            .count();
+  };
+
+  // The encoder state of a codec instance is updated by each encoding, the
+  // encodings of a same instance run one after the other.
+  bool independent = true;
+  for (size_t i = 1; i < jobs.size() && independent; i++) {
+    for (size_t j = 0; j < i && independent; j++) {
+      independent = jobs[i].codec != jobs[j].codec;
+    }
+  }
+
+  auto pool = jobs.size() > 1 && independent ? EncodeWorkerPool::Get()
+                                             : nullptr;
+  if (pool != nullptr) {
+    pool->Run(jobs.size(), encode);
+  } else {
+    for (size_t i = 0; i < jobs.size(); i++) encode(i);
+  }
+
+  uint32_t encode_time_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count();
+
+  size_t num_deadline_misses;
+  {
+    std::lock_guard<std::mutex> lock(encode_batch_stats_mutex);
+    auto& stats = encode_batch_stats;
+    stats.num_batches++;
+    stats.last_encode_time_us = encode_time_us;
+    stats.max_encode_time_us =
+        std::max(stats.max_encode_time_us, encode_time_us);
+    if (deadline_us > 0 && encode_time_us > deadline_us) {
+      stats.num_deadline_misses++;
+    }
+    num_deadline_misses = stats.num_deadline_misses;
+  }
+
+  // Do not flood the log when the encoding keeps missing the deadline
+  if (deadline_us > 0 && encode_time_us > deadline_us &&
+      num_deadline_misses % 100 == 1) {
+    LOG_WARN("Encoding %zu channels took %u us, deadline %u us (%zu misses)",
+             jobs.size(), encode_time_us, deadline_us, num_deadline_misses);
+  }
+
+  for (auto status : statuses) {
+    if (status != Status::STATUS_OK) return status;
+  }
+  return Status::STATUS_OK;
+}
+
+CodecInterface::EncodeBatchStats CodecInterface::GetEncodeBatchStats() {
+  std::lock_guard<std::mutex> lock(encode_batch_stats_mutex);
+  return encode_batch_stats;
+}
+
 }  // namespace le_audio
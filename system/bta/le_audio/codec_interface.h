@@ -68,6 +68,40 @@ class CodecInterface {
   virtual uint8_t GetNumOfBytesPerSample();
   virtual std::vector<int16_t>& GetDecodedSamples();
 
+  /* One channel encoding of a batch, with the parameters of Encode() */
+  struct EncodeJob {
+    CodecInterface* codec;
+    const uint8_t* data;
+    int stride;
+    uint16_t out_size;
+    std::vector<int16_t>* out_buffer = nullptr;
+    uint16_t out_offset = 0;
+    /* Set by EncodeBatch() */
+    uint32_t encode_time_us = 0;
+  };
+
+  /* Encode statistics of the batches, see EncodeBatch() */
+  struct EncodeBatchStats {
+    size_t num_batches = 0;
+    size_t num_deadline_misses = 0;
+    uint32_t max_encode_time_us = 0;
+    uint32_t last_encode_time_us = 0;
+  };
+
+  /* Encodes the independent channels of a batch, with the same result as
+   * calling Encode() for each job in order. When the parallel encoding is
+   * enabled (persist.bluetooth.leaudio.parallel_encoding), the jobs are spread
+   * over a small pool of worker threads and the calling thread.
+   * The output buffers are sized before encoding, so that several jobs can
+   * encode into the same output buffer at different offsets.
+   * The encoding of a batch taking longer than `deadline_us` (the SDU
+   * interval) is reported as a deadline miss.
+   * Returns STATUS_OK, or the status of the first job which failed.
+   */
+  static CodecInterface::Status EncodeBatch(std::vector<EncodeJob>& jobs,
+                                            uint32_t deadline_us);
+  static EncodeBatchStats GetEncodeBatchStats();
+
  private:
   struct Impl;
   Impl* impl;
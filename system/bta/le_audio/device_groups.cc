@@ -22,10 +22,12 @@
 #include "bta_csis_api.h"
 #include "btif/include/btif_profile_storage.h"
 #include "btm_iso_api.h"
+#include "common/time_util.h"
 #include "device/include/controller.h"
 #include "internal_include/bt_trace.h"
 #include "le_audio_set_configuration_provider.h"
 #include "metrics_collector.h"
+#include "osi/include/properties.h"
 
 namespace le_audio {
 
@@ -40,6 +42,11 @@ using types::DataPathState;
 using types::LeAudioContextType;
 using types::LeAudioCoreCodecConfig;
 
+static constexpr char kLowLatencyGamingModeProp[] =
+    "persist.bluetooth.leaudio.low_latency_gaming.enabled";
+static constexpr uint8_t kLowLatencyMinRetransmissionNumber = 1;
+static constexpr uint8_t kLowLatencyMaxRetransmissionBoost = 0x0F;
+
 /* LeAudioDeviceGroup Class methods implementation */
 void LeAudioDeviceGroup::AddNode(
     const std::shared_ptr<LeAudioDevice>& leAudioDevice) {
@@ -709,7 +716,11 @@ bool LeAudioDeviceGroup::GetPresentationDelay(uint32_t* delay,
     } while ((ase = leAudioDevice->GetNextActiveAseWithSameDirection(ase)));
   } while ((leAudioDevice = GetNextActiveDevice(leAudioDevice)));
 
-  if (preferred_delay_min <= preferred_delay_max &&
+  /* The gaming streams take the lowest delay the devices can do, rather
+   * than the one they prefer.
+   */
+  if (!IsLowLatencyGamingMode(GetConfigurationContextType()) &&
+      preferred_delay_min <= preferred_delay_max &&
       preferred_delay_min > delay_min && preferred_delay_min < delay_max) {
     *delay = preferred_delay_min;
   } else {
@@ -737,6 +748,41 @@ uint16_t LeAudioDeviceGroup::GetRemoteDelay(uint8_t direction) const {
   return remote_delay_ms;
 }
 
+bool LeAudioDeviceGroup::IsLowLatencyGamingMode(
+    LeAudioContextType context_type) const {
+  return context_type == LeAudioContextType::GAME &&
+         osi_property_get_bool(kLowLatencyGamingModeProp, false);
+}
+
+uint8_t LeAudioDeviceGroup::GetLowLatencyRetransmissionNumber(
+    uint8_t max_retrans_nb) const {
+  /* Never more retransmissions than the configuration or the device asks */
+  return std::min<uint8_t>(
+      max_retrans_nb,
+      kLowLatencyMinRetransmissionNumber + low_latency_retrans_boost_);
+}
+
+void LeAudioDeviceGroup::UpdateLinkQualityLosses(uint16_t conn_handle,
+                                                 uint32_t lost_packets) {
+  /* The counters of the link quality reports are cumulative for the lifetime
+   * of the CIS, a lower value is the baseline of a new CIS.
+   */
+  auto it = link_quality_lost_packets_.find(conn_handle);
+  bool has_new_losses = it != link_quality_lost_packets_.end() &&
+                        lost_packets > it->second;
+  link_quality_lost_packets_[conn_handle] = lost_packets;
+
+  if (!has_new_losses ||
+      !IsLowLatencyGamingMode(GetConfigurationContextType()) ||
+      low_latency_retrans_boost_ >= kLowLatencyMaxRetransmissionBoost) {
+    return;
+  }
+
+  low_latency_retrans_boost_++;
+  LOG_INFO("group %d, losses on cis handle 0x%04x, retransmission boost: %d",
+           group_id_, conn_handle, +low_latency_retrans_boost_);
+}
+
 bool LeAudioDeviceGroup::UpdateAudioContextAvailability(void) {
   LOG_DEBUG("%d", group_id_);
   auto old_contexts = GetAvailableContexts();
@@ -1817,9 +1863,83 @@ bool LeAudioDeviceGroup::IsAudioSetConfigurationSupported(
   return false;
 }
 
+/* The fingerprint of everything the configuration selection depends on: the
+ * group composition and state, and the ASEs, audio locations and PAC records
+ * of its devices. The groups of a same device model in the same state have the
+ * same fingerprint.
+ */
+std::string LeAudioDeviceGroup::GetConfigurationFingerprint(
+    LeAudioContextType context_type) const {
+  std::vector<uint8_t> fingerprint;
+  auto append = [&fingerprint](const void* data, size_t size) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    fingerprint.insert(fingerprint.end(), bytes, bytes + size);
+  };
+  auto append_value = [&append](auto value) { append(&value, sizeof(value)); };
+
+  append_value(context_type);
+  append_value(IsLowLatencyGamingMode(context_type));
+  append_value(CodecManager::GetInstance()->GetCodecLocation());
+  append_value(CodecManager::GetInstance()->IsOffloadDualBiDirSwbSupported());
+  append_value(Size());
+  append_value(NumOfConnected(context_type));
+  append_value(NumOfConnected());
+  append_value(GetGroupStrategy(Size()));
+
+  for (auto* device = GetFirstDevice(); device != nullptr;
+       device = GetNextDevice(device)) {
+    uint8_t num_snk_ases = 0, num_src_ases = 0;
+    for (auto const& ase : device->ases_) {
+      if (ase.direction == types::kLeAudioDirectionSink)
+        num_snk_ases++;
+      else
+        num_src_ases++;
+    }
+    append_value(num_snk_ases);
+    append_value(num_src_ases);
+    append_value(device->snk_audio_locations_.to_ulong());
+    append_value(device->src_audio_locations_.to_ulong());
+
+    for (auto const* pacs : {&device->snk_pacs_, &device->src_pacs_}) {
+      append_value(pacs->size());
+      for (auto const& [handles, records] : *pacs) {
+        append_value(records.size());
+        for (auto const& record : records) {
+          append_value(record.codec_id.coding_format);
+          append_value(record.codec_id.vendor_company_id);
+          append_value(record.codec_id.vendor_codec_id);
+          auto caps = record.codec_spec_caps.RawPacket();
+          append_value(caps.size());
+          append(caps.data(), caps.size());
+        }
+      }
+    }
+  }
+
+  return std::string(fingerprint.begin(), fingerprint.end());
+}
+
 const set_configurations::AudioSetConfiguration*
 LeAudioDeviceGroup::FindFirstSupportedConfiguration(
     LeAudioContextType context_type) const {
+  /* The selection is done once per device model and group state */
+  auto provider = AudioSetConfigurationProvider::Get();
+  auto fingerprint = GetConfigurationFingerprint(context_type);
+
+  const set_configurations::AudioSetConfiguration* conf = nullptr;
+  if (provider->GetMemoizedConfiguration(fingerprint, &conf)) {
+    LOG_DEBUG("memoized: %s", (conf ? conf->name.c_str() : "(none)"));
+    return conf;
+  }
+
+  conf = SelectFirstSupportedConfiguration(context_type);
+  provider->MemoizeConfiguration(fingerprint, conf);
+  return conf;
+}
+
+const set_configurations::AudioSetConfiguration*
+LeAudioDeviceGroup::SelectFirstSupportedConfiguration(
+    LeAudioContextType context_type) const {
   const set_configurations::AudioSetConfigurations* confs =
       AudioSetConfigurationProvider::Get()->GetConfigurations(context_type);
 
@@ -1841,6 +1961,23 @@ LeAudioDeviceGroup::FindFirstSupportedConfiguration(
   /* Filter out device set for each end every scenario */
 
   auto required_snk_strategy = GetGroupStrategy(Size());
+
+  /* The gaming streams go for the 7.5ms frames when supported */
+  if (IsLowLatencyGamingMode(context_type)) {
+    for (const auto& conf : *confs) {
+      bool has_short_frames = std::all_of(
+          conf->confs.begin(), conf->confs.end(), [](auto const& set_conf) {
+            return set_conf.codec.GetDataIntervalUs() == 7500;
+          });
+      if (has_short_frames &&
+          IsAudioSetConfigurationSupported(conf, context_type,
+                                           required_snk_strategy)) {
+        LOG_DEBUG("found low latency: %s", conf->name.c_str());
+        return conf;
+      }
+    }
+  }
+
   for (const auto& conf : *confs) {
     if (IsAudioSetConfigurationSupported(conf, context_type,
                                          required_snk_strategy)) {
@@ -1979,6 +2116,18 @@ void LeAudioDeviceGroup::Dump(int fd, int active_group_id) const {
          << stream_conf.stream_params.source.stream_locations.size() << ")\n"
          << "      allocated CISes: " << static_cast<int>(cig.cises.size());
 
+  if (IsLowLatencyGamingMode(GetConfigurationContextType())) {
+    stream << "\n      low latency gaming, retransmission boost: "
+           << +low_latency_retrans_boost_;
+  }
+
+  if (GetState() == AseState::BTA_LE_AUDIO_ASE_STATE_STREAMING &&
+      GetFirstActiveDevice() != nullptr) {
+    stream << "\n      remote delay (snk/src): "
+           << GetRemoteDelay(types::kLeAudioDirectionSink) << "/"
+           << GetRemoteDelay(types::kLeAudioDirectionSource) << " ms";
+  }
+
   if (cig.cises.size() > 0) {
     stream << "\n\t == CISes == ";
     for (auto cis : cig.cises) {
@@ -2006,6 +2155,8 @@ void LeAudioDeviceGroup::Dump(int fd, int active_group_id) const {
     }
   }
 
+  DumpStreamSetupTiming(stream);
+
   stream << "\n      == devices: ==";
 
   dprintf(fd, "%s", stream.str().c_str());
@@ -2022,6 +2173,80 @@ void LeAudioDeviceGroup::Dump(int fd, int active_group_id) const {
   dprintf(fd, "%s", stream_pacs.str().c_str());
 }
 
+void LeAudioDeviceGroup::StartStreamSetupTiming(
+    types::AseState target_state) {
+  stream_setup_start_us_ = 0;
+  if (target_state != AseState::BTA_LE_AUDIO_ASE_STATE_STREAMING ||
+      current_state_ == AseState::BTA_LE_AUDIO_ASE_STATE_STREAMING)
+    return;
+
+  stream_setup_start_us_ = bluetooth::common::time_get_os_boottime_us();
+  stream_setup_phase_start_us_ = stream_setup_start_us_;
+}
+
+void LeAudioDeviceGroup::UpdateStreamSetupTiming(void) {
+  if (stream_setup_start_us_ == 0) return;
+
+  StreamSetupPhase phase;
+  switch (current_state_) {
+    case AseState::BTA_LE_AUDIO_ASE_STATE_CODEC_CONFIGURED:
+      phase = kStreamSetupCodecConfigured;
+      break;
+    case AseState::BTA_LE_AUDIO_ASE_STATE_QOS_CONFIGURED:
+      phase = kStreamSetupQosConfigured;
+      break;
+    case AseState::BTA_LE_AUDIO_ASE_STATE_ENABLING:
+      phase = kStreamSetupEnabling;
+      break;
+    case AseState::BTA_LE_AUDIO_ASE_STATE_STREAMING:
+      phase = kStreamSetupStreaming;
+      break;
+    default:
+      /* The stream setup was aborted */
+      stream_setup_start_us_ = 0;
+      return;
+  }
+
+  auto add_sample = [this](StreamSetupPhase phase, uint64_t duration_us) {
+    auto& stats = stream_setup_stats_[phase];
+    stats.last_ms = duration_us / 1000;
+
+    size_t bucket = 0;
+    while (bucket < kStreamSetupHistogramBoundsMs.size() &&
+           stats.last_ms >= kStreamSetupHistogramBoundsMs[bucket])
+      bucket++;
+    stats.histogram[bucket]++;
+  };
+
+  auto now_us = bluetooth::common::time_get_os_boottime_us();
+  add_sample(phase, now_us - stream_setup_phase_start_us_);
+  stream_setup_phase_start_us_ = now_us;
+
+  if (phase == kStreamSetupStreaming) {
+    add_sample(kStreamSetupTotal, now_us - stream_setup_start_us_);
+    stream_setup_start_us_ = 0;
+  }
+}
+
+void LeAudioDeviceGroup::DumpStreamSetupTiming(
+    std::stringstream& stream) const {
+  static const char* kPhaseNames[kStreamSetupNumPhases] = {
+      "codec configured", "qos configured", "enabling", "streaming", "total"};
+
+  stream << "\n      stream setup phases (ms: ";
+  for (auto bound : kStreamSetupHistogramBoundsMs) {
+    stream << "<" << bound << " ";
+  }
+  stream << ">=" << kStreamSetupHistogramBoundsMs.back() << "):";
+
+  for (size_t phase = 0; phase < kStreamSetupNumPhases; phase++) {
+    auto const& stats = stream_setup_stats_[phase];
+    stream << "\n        " << kPhaseNames[phase] << ":";
+    for (auto count : stats.histogram) stream << " " << count;
+    stream << ",\tlast: " << stats.last_ms << " ms";
+  }
+}
+
 LeAudioDeviceGroup* LeAudioDeviceGroups::Add(int group_id) {
   /* Get first free group id */
   if (FindById(group_id)) {
@@ -25,9 +25,11 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <utility>  // for std::pair
 #include <vector>
 
@@ -194,6 +196,9 @@ class LeAudioDeviceGroup {
   uint8_t GetTargetPhy(uint8_t direction) const;
   bool GetPresentationDelay(uint32_t* delay, uint8_t direction) const;
   uint16_t GetRemoteDelay(uint8_t direction) const;
+  bool IsLowLatencyGamingMode(types::LeAudioContextType context_type) const;
+  uint8_t GetLowLatencyRetransmissionNumber(uint8_t max_retrans_nb) const;
+  void UpdateLinkQualityLosses(uint16_t conn_handle, uint32_t lost_packets);
   bool UpdateAudioContextAvailability(void);
   bool UpdateAudioSetConfigurationCache(types::LeAudioContextType ctx_type);
   bool ReloadAudioLocations(void);
@@ -240,6 +245,7 @@ class LeAudioDeviceGroup {
         bluetooth::common::ToString(current_state_) + "->" +
             bluetooth::common::ToString(state));
     current_state_ = state;
+    UpdateStreamSetupTiming();
 
     if (target_state_ == current_state_) {
       in_transition_ = false;
@@ -264,6 +270,7 @@ class LeAudioDeviceGroup {
         bluetooth::common::ToString(target_state_) + "->" +
             bluetooth::common::ToString(state));
 
+    if (state != target_state_) StartStreamSetupTiming(state);
     target_state_ = state;
 
     in_transition_ = target_state_ != current_state_;
@@ -382,6 +389,11 @@ class LeAudioDeviceGroup {
 
   const set_configurations::AudioSetConfiguration*
   FindFirstSupportedConfiguration(types::LeAudioContextType context_type) const;
+  const set_configurations::AudioSetConfiguration*
+  SelectFirstSupportedConfiguration(
+      types::LeAudioContextType context_type) const;
+  std::string GetConfigurationFingerprint(
+      types::LeAudioContextType context_type) const;
   bool ConfigureAses(
       const set_configurations::AudioSetConfiguration* audio_set_conf,
       types::LeAudioContextType context_type,
@@ -423,6 +435,40 @@ class LeAudioDeviceGroup {
   types::AseState current_state_;
   bool in_transition_;
   std::vector<std::weak_ptr<LeAudioDevice>> leAudioDevices_;
+
+  /* Timing of the stream setup phases, each phase ending when the group
+   * reaches one of the states on the way to streaming. The whole setup,
+   * i.e. the time to the first audio, is the last phase.
+   */
+  static constexpr std::array<uint32_t, 6> kStreamSetupHistogramBoundsMs = {
+      25, 50, 100, 200, 400, 800};
+  enum StreamSetupPhase {
+    kStreamSetupCodecConfigured,
+    kStreamSetupQosConfigured,
+    kStreamSetupEnabling,
+    kStreamSetupStreaming,
+    kStreamSetupTotal,
+    kStreamSetupNumPhases,
+  };
+  struct StreamSetupPhaseStats {
+    std::array<uint32_t, kStreamSetupHistogramBoundsMs.size() + 1> histogram;
+    uint32_t last_ms;
+  };
+  std::array<StreamSetupPhaseStats, kStreamSetupNumPhases>
+      stream_setup_stats_{};
+  uint64_t stream_setup_start_us_ = 0;
+  uint64_t stream_setup_phase_start_us_ = 0;
+
+  void StartStreamSetupTiming(types::AseState target_state);
+  void UpdateStreamSetupTiming(void);
+  void DumpStreamSetupTiming(std::stringstream& stream) const;
+
+  /* Low latency gaming mode: the streams start with the fewest
+   * retransmissions, and each link quality report showing new losses adds
+   * one retransmission to the next QoS configuration of the group.
+   */
+  uint8_t low_latency_retrans_boost_ = 0;
+  std::map<uint16_t, uint32_t> link_quality_lost_packets_;
 };
 
 /* LeAudioDeviceGroup class represents a wraper helper over all device groups in
@@ -34,6 +34,8 @@ tACL_CONN* btm_bda_to_acl(const RawAddress& bda, tBT_TRANSPORT transport) {
   return nullptr;
 }
 
+void osi_property_set_bool(const char* key, bool value);
+
 namespace bluetooth {
 namespace le_audio {
 namespace internal {
@@ -1654,6 +1656,75 @@ TEST_F(LeAudioAseConfigurationTest, test_num_of_connected) {
   ASSERT_EQ(0, group_->NumOfConnected());
 }
 
+TEST_F(LeAudioAseConfigurationTest, test_memoized_configuration_follows_pacs) {
+  LeAudioDevice* left = AddTestDevice(1, 1);
+  LeAudioDevice* right = AddTestDevice(1, 1);
+  ASSERT_EQ(2, group_->Size());
+
+  left->snk_audio_locations_ =
+      ::le_audio::codec_spec_conf::kLeAudioLocationFrontLeft;
+  right->snk_audio_locations_ =
+      ::le_audio::codec_spec_conf::kLeAudioLocationFrontRight;
+  group_->ReloadAudioLocations();
+
+  auto media_configuration = getSpecificConfiguration(
+      "SingleDev_TwoChanStereoSnk_48_4_High_Reliability",
+      LeAudioContextType::MEDIA);
+  ASSERT_NE(nullptr, media_configuration);
+
+  PublishedAudioCapabilitiesBuilder snk_pac_builder;
+  for (const auto& entry : (*media_configuration).confs) {
+    if (entry.direction == kLeAudioDirectionSink) {
+      snk_pac_builder.Add(entry.codec, 2);
+    }
+  }
+  left->snk_pacs_ = snk_pac_builder.Get();
+  right->snk_pacs_ = snk_pac_builder.Get();
+
+  group_->UpdateAudioSetConfigurationCache(LeAudioContextType::MEDIA);
+  auto configuration =
+      group_->GetCachedConfiguration(LeAudioContextType::MEDIA);
+  ASSERT_NE(nullptr, configuration);
+
+  /* Same group state, the memoized selection is used */
+  group_->InvalidateCachedConfigurations();
+  group_->UpdateAudioSetConfigurationCache(LeAudioContextType::MEDIA);
+  ASSERT_EQ(configuration,
+            group_->GetCachedConfiguration(LeAudioContextType::MEDIA));
+
+  /* Without the sink PACs, the selection is made again and fails */
+  left->snk_pacs_.clear();
+  right->snk_pacs_.clear();
+  ASSERT_TRUE(
+      group_->UpdateAudioSetConfigurationCache(LeAudioContextType::MEDIA));
+  ASSERT_EQ(nullptr, group_->GetCachedConfiguration(LeAudioContextType::MEDIA));
+}
+
+TEST_F(LeAudioAseConfigurationTest, test_low_latency_gaming_mode) {
+  AddTestDevice(1, 1);
+
+  osi_property_set_bool("persist.bluetooth.leaudio.low_latency_gaming.enabled",
+                        false);
+  ASSERT_FALSE(group_->IsLowLatencyGamingMode(LeAudioContextType::GAME));
+
+  osi_property_set_bool("persist.bluetooth.leaudio.low_latency_gaming.enabled",
+                        true);
+  ASSERT_TRUE(group_->IsLowLatencyGamingMode(LeAudioContextType::GAME));
+  ASSERT_FALSE(group_->IsLowLatencyGamingMode(LeAudioContextType::MEDIA));
+
+  /* Fewest retransmissions, never above the configured ones */
+  ASSERT_EQ(1, group_->GetLowLatencyRetransmissionNumber(4));
+  ASSERT_EQ(0, group_->GetLowLatencyRetransmissionNumber(0));
+
+  /* The losses of the non gaming streams do not add retransmissions */
+  group_->UpdateLinkQualityLosses(0x0010, 0);
+  group_->UpdateLinkQualityLosses(0x0010, 10);
+  ASSERT_EQ(1, group_->GetLowLatencyRetransmissionNumber(4));
+
+  osi_property_set_bool("persist.bluetooth.leaudio.low_latency_gaming.enabled",
+                        false);
+}
+
 /*
  * Failure happens when there is no matching single device scenario for dual
  * device scanario. Stereo location for single earbud seems to be invalid but
@@ -0,0 +1,234 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "iso_jitter_buffer.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "os/log.h"
+
+namespace le_audio {
+
+namespace {
+/* A channel without SDUs for this many SDU intervals is no longer waited for */
+constexpr int64_t kInactiveChannelSdus = 50;
+
+/* After this many frames without late SDUs, the depth floor is lowered */
+constexpr size_t kDepthDecayFrames = 1000;
+
+/* The drift is estimated from the minimal transit time of 1 s windows, against
+ * a reference window at least 10 s older. Larger estimates are not a drift of
+ * the clocks, and are ignored.
+ */
+constexpr int64_t kDriftWindowUs = 1000000;
+constexpr int64_t kDriftMinBaselineUs = 10000000;
+constexpr double kMaxDriftPpm = 200;
+}  // namespace
+
+IsoJitterBuffer::IsoJitterBuffer(uint32_t sdu_interval_us)
+    : sdu_interval_us_(std::max<uint32_t>(sdu_interval_us, 1)) {}
+
+/* ISO timestamps are 32 bit us counters, wrapping every ~71 minutes */
+__attribute__((no_sanitize("integer"))) int64_t
+IsoJitterBuffer::UnwrapTimestamp(uint32_t timestamp) {
+  unwrapped_timestamp_ += static_cast<int32_t>(timestamp - last_timestamp_);
+  last_timestamp_ = timestamp;
+  return unwrapped_timestamp_;
+}
+
+bool IsoJitterBuffer::IsChannelActive(int channel) const {
+  return last_channel_seq_[channel] >= 0 &&
+         newest_seq_ - last_channel_seq_[channel] < kInactiveChannelSdus;
+}
+
+void IsoJitterBuffer::UpdateArrivalStats(int channel, int64_t timestamp_us,
+                                         uint64_t arrival_us) {
+  int64_t transit_us = static_cast<int64_t>(arrival_us) - timestamp_us;
+  if (last_channel_seq_[channel] >= 0) {
+    int64_t delta_us = std::abs(transit_us - last_transit_us_[channel]);
+    jitter_q4_ += delta_us - ((jitter_q4_ + 8) >> 4);
+  }
+  last_transit_us_[channel] = transit_us;
+  stats_.jitter_us = jitter_q4_ >> 4;
+
+  if (timestamp_us - window_start_us_ < kDriftWindowUs) {
+    window_min_transit_us_ = std::min(window_min_transit_us_, transit_us);
+    return;
+  }
+
+  if (!has_reference_) {
+    has_reference_ = true;
+    reference_timestamp_us_ = window_start_us_;
+    reference_transit_us_ = window_min_transit_us_;
+  } else if (window_start_us_ - reference_timestamp_us_ >=
+             kDriftMinBaselineUs) {
+    double drift_ppm = (window_min_transit_us_ - reference_transit_us_) * 1e6 /
+                       (window_start_us_ - reference_timestamp_us_);
+    if (std::abs(drift_ppm) <= kMaxDriftPpm) {
+      stats_.drift_ppm = drift_ppm;
+    }
+  }
+  window_start_us_ = timestamp_us;
+  window_min_transit_us_ = transit_us;
+}
+
+void IsoJitterBuffer::UpdateDepth() {
+  int64_t jitter_depth = 1 + (4 * static_cast<int64_t>(stats_.jitter_us) +
+                               sdu_interval_us_ - 1) /
+                                  sdu_interval_us_;
+  stats_.depth = static_cast<int>(std::clamp<int64_t>(
+      std::max<int64_t>(jitter_depth, min_depth_), 1, kMaxDepth));
+}
+
+void IsoJitterBuffer::Push(int channel, uint32_t timestamp,
+                           const uint8_t* data, uint16_t size,
+                           uint64_t arrival_us) {
+  if (channel < 0 || channel >= kMaxChannels) {
+    LOG_ERROR("Invalid channel %d", channel);
+    return;
+  }
+
+  int64_t timestamp_us = UnwrapTimestamp(timestamp);
+  if (!started_) {
+    started_ = true;
+    first_timestamp_ = timestamp_us;
+    window_start_us_ = timestamp_us;
+    window_min_transit_us_ = static_cast<int64_t>(arrival_us) - timestamp_us;
+  }
+
+  /* Rounded to the closest SDU interval */
+  int64_t offset_us = timestamp_us - first_timestamp_ + sdu_interval_us_ / 2;
+  int64_t seq = offset_us >= 0
+                    ? offset_us / sdu_interval_us_
+                    : -((sdu_interval_us_ - 1 - offset_us) / sdu_interval_us_);
+
+  stats_.received_sdus++;
+  bool was_active = IsChannelActive(channel);
+  UpdateArrivalStats(channel, timestamp_us, arrival_us);
+  last_channel_seq_[channel] = std::max(last_channel_seq_[channel], seq);
+
+  if (seq < next_seq_) {
+    /* The first SDUs of a channel joining the stream are not late */
+    if (was_active) {
+      stats_.late_sdus++;
+      min_depth_ = std::min(min_depth_ + 1, kMaxDepth);
+      frames_since_late_ = 0;
+      LOG_DEBUG("Late SDU on channel %d, %d intervals behind", channel,
+                static_cast<int>(next_seq_ - seq));
+    }
+    UpdateDepth();
+    return;
+  }
+
+  newest_seq_ = std::max(newest_seq_, seq);
+  UpdateDepth();
+
+  auto [it, inserted] = frames_.try_emplace(seq);
+  Frame& frame = it->second;
+  if (inserted) {
+    frame.timestamp = timestamp;
+    frame.states.fill(ChannelState::ABSENT);
+  }
+  if (frame.states[channel] == ChannelState::RECEIVED) {
+    LOG_DEBUG("Duplicated SDU on channel %d", channel);
+    return;
+  }
+  frame.states[channel] = ChannelState::RECEIVED;
+  frame.sdus[channel].assign(data, data + size);
+}
+
+bool IsoJitterBuffer::Pop(Frame* frame) {
+  while (!frames_.empty()) {
+    /* After a pause of the stream, playout resumes with the next SDUs */
+    if (next_seq_ < frames_.begin()->first &&
+        newest_seq_ - next_seq_ > kMaxDepth) {
+      next_seq_ = frames_.begin()->first;
+    }
+
+    auto it = frames_.find(next_seq_);
+    bool complete = it != frames_.end();
+    for (int channel = 0; complete && channel < kMaxChannels; channel++) {
+      if (IsChannelActive(channel) &&
+          it->second.states[channel] != ChannelState::RECEIVED) {
+        complete = false;
+      }
+    }
+    if (!complete && newest_seq_ - next_seq_ < stats_.depth) {
+      return false;
+    }
+
+    Frame released;
+    if (it != frames_.end()) {
+      released = std::move(it->second);
+      frames_.erase(it);
+    } else {
+      released.timestamp = static_cast<uint32_t>(
+          first_timestamp_ + next_seq_ * sdu_interval_us_);
+      released.states.fill(ChannelState::ABSENT);
+    }
+    next_seq_++;
+
+    bool has_audio = false;
+    for (int channel = 0; channel < kMaxChannels; channel++) {
+      if (released.states[channel] == ChannelState::RECEIVED) {
+        has_audio = true;
+      } else if (IsChannelActive(channel)) {
+        released.states[channel] = ChannelState::LOST;
+        released.sdus[channel].clear();
+        stats_.lost_sdus++;
+        has_audio = true;
+      }
+    }
+    if (!has_audio) continue;
+
+    stats_.released_frames++;
+    if (++frames_since_late_ >= kDepthDecayFrames) {
+      frames_since_late_ = 0;
+      min_depth_ = std::max(min_depth_ - 1, 1);
+      UpdateDepth();
+    }
+    *frame = std::move(released);
+    return true;
+  }
+  return false;
+}
+
+int IsoJitterBuffer::TakeDriftCorrection(size_t samples_per_frame) {
+  drift_samples_ += samples_per_frame * stats_.drift_ppm / 1e6;
+  if (drift_samples_ >= 1) {
+    drift_samples_ -= 1;
+    return 1;
+  }
+  if (drift_samples_ <= -1) {
+    drift_samples_ += 1;
+    return -1;
+  }
+  return 0;
+}
+
+void IsoJitterBuffer::ApplyDriftCorrection(std::vector<int16_t>* samples,
+                                           int correction) {
+  if (samples->empty()) return;
+  if (correction > 0) {
+    samples->insert(samples->end(), correction, samples->back());
+  } else if (correction < 0) {
+    samples->resize(samples->size() -
+                    std::min<size_t>(-correction, samples->size()));
+  }
+}
+
+}  // namespace le_audio
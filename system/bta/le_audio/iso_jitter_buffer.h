@@ -0,0 +1,136 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace le_audio {
+
+/* Jitter buffer of the SDUs received over the CISes of the local sink
+ * (microphone) direction.
+ *
+ * The SDUs are ordered by their ISO timestamp, which is aligned to the SDU
+ * interval of the CIG, and the SDUs of the left and right channels with the
+ * same timestamp make up one frame. A frame is released for playout as soon as
+ * every active channel received its SDU, or once it has waited for the depth
+ * of the buffer, counted in SDU intervals, after which the missing SDUs are
+ * reported lost so that the decoder conceals them. SDUs arriving after their
+ * frame was released are late and dropped.
+ *
+ * The depth adapts to the arrival jitter of the SDUs, and grows when SDUs are
+ * late. The drift between the ISO clock and the local clock is estimated from
+ * the arrival times, for the caller to correct by slipping samples.
+ */
+class IsoJitterBuffer {
+ public:
+  static constexpr int kMaxChannels = 2;
+  static constexpr int kMaxDepth = 8;
+
+  enum class ChannelState {
+    /* The channel is not streaming, no audio for it */
+    ABSENT,
+    RECEIVED,
+    /* The SDU was lost, the decoder should conceal it */
+    LOST,
+  };
+
+  struct Frame {
+    uint32_t timestamp;
+    std::array<ChannelState, kMaxChannels> states;
+    std::array<std::vector<uint8_t>, kMaxChannels> sdus;
+  };
+
+  struct Stats {
+    size_t received_sdus = 0;
+    size_t late_sdus = 0;
+    size_t lost_sdus = 0;
+    size_t released_frames = 0;
+    uint32_t jitter_us = 0;
+    int depth = 1;
+    double drift_ppm = 0;
+  };
+
+  explicit IsoJitterBuffer(uint32_t sdu_interval_us);
+
+  /* Queues the SDU of `channel` with the ISO `timestamp`, received at the local
+   * time `arrival_us`.
+   */
+  void Push(int channel, uint32_t timestamp, const uint8_t* data,
+            uint16_t size, uint64_t arrival_us);
+
+  /* Moves the next frame ready for playout to `frame`.
+   * Returns false when no frame is ready.
+   */
+  bool Pop(Frame* frame);
+
+  /* Returns the number of samples, per channel, to add (positive) or remove
+   * (negative) from the `samples_per_frame` samples of the frame just popped,
+   * to compensate the clock drift.
+   */
+  int TakeDriftCorrection(size_t samples_per_frame);
+
+  /* Adds or removes `correction` samples at the end of `samples` */
+  static void ApplyDriftCorrection(std::vector<int16_t>* samples,
+                                   int correction);
+
+  const Stats& GetStats() const { return stats_; }
+
+ private:
+  int64_t UnwrapTimestamp(uint32_t timestamp);
+  void UpdateArrivalStats(int channel, int64_t timestamp_us,
+                          uint64_t arrival_us);
+  bool IsChannelActive(int channel) const;
+  void UpdateDepth();
+
+  const uint32_t sdu_interval_us_;
+
+  /* Frames by sequence number, the SDU interval count since the first SDU */
+  std::map<int64_t, Frame> frames_;
+  bool started_ = false;
+  int64_t next_seq_ = 0;
+  int64_t newest_seq_ = 0;
+
+  uint32_t last_timestamp_ = 0;
+  int64_t unwrapped_timestamp_ = 0;
+  int64_t first_timestamp_ = 0;
+
+  /* Sequence number of the last SDU of each channel, -1 before the first */
+  std::array<int64_t, kMaxChannels> last_channel_seq_ = {-1, -1};
+  std::array<int64_t, kMaxChannels> last_transit_us_ = {0, 0};
+
+  /* Running jitter estimate, in 1/16 us, as in RFC 3550 */
+  int64_t jitter_q4_ = 0;
+  /* Depth floor, raised by late SDUs and lowered after frames without any */
+  int min_depth_ = 1;
+  size_t frames_since_late_ = 0;
+
+  /* Clock drift estimation from the minimal transit time of each window */
+  int64_t window_start_us_ = 0;
+  int64_t window_min_transit_us_ = 0;
+  bool has_reference_ = false;
+  int64_t reference_timestamp_us_ = 0;
+  int64_t reference_transit_us_ = 0;
+  double drift_samples_ = 0;
+
+  Stats stats_;
+};
+
+}  // namespace le_audio
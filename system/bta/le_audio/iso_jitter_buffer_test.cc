@@ -0,0 +1,193 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "iso_jitter_buffer.h"
+
+#include <gtest/gtest.h>
+
+namespace le_audio {
+
+namespace {
+constexpr uint32_t kSduIntervalUs = 10000;
+constexpr uint8_t kSdu[] = {0x01, 0x02, 0x03};
+
+using ChannelState = IsoJitterBuffer::ChannelState;
+
+class IsoJitterBufferTest : public ::testing::Test {
+ protected:
+  /* Pushes the SDU of interval `seq` of `channel`, `delay_us` after its time */
+  void Push(int channel, int seq, int delay_us = 0) {
+    buffer_.Push(channel, Timestamp(seq), kSdu, sizeof(kSdu),
+                 kArrivalOffsetUs + seq * kSduIntervalUs + delay_us);
+  }
+
+  /* ISO timestamp of interval `seq`, starting close to the wrap around */
+  static uint32_t Timestamp(int seq) {
+    return static_cast<uint32_t>(uint64_t{kFirstTimestamp} +
+                                 seq * kSduIntervalUs);
+  }
+
+  int PopAll() {
+    int count = 0;
+    IsoJitterBuffer::Frame frame;
+    while (buffer_.Pop(&frame)) {
+      frames_.push_back(std::move(frame));
+      count++;
+    }
+    return count;
+  }
+
+  static constexpr uint32_t kFirstTimestamp = 0xFFFF0000;
+  static constexpr uint64_t kArrivalOffsetUs = 5000000;
+
+  IsoJitterBuffer buffer_{kSduIntervalUs};
+  std::vector<IsoJitterBuffer::Frame> frames_;
+};
+}  // namespace
+
+TEST_F(IsoJitterBufferTest, stereo_frames_released_when_complete) {
+  Push(0, 0);
+  EXPECT_EQ(PopAll(), 1);
+  Push(1, 0);
+  Push(0, 1);
+  EXPECT_EQ(PopAll(), 0);
+  Push(1, 1);
+  EXPECT_EQ(PopAll(), 1);
+
+  ASSERT_EQ(frames_.size(), 2u);
+  EXPECT_EQ(frames_[1].timestamp, Timestamp(1));
+  EXPECT_EQ(frames_[1].states[0], ChannelState::RECEIVED);
+  EXPECT_EQ(frames_[1].states[1], ChannelState::RECEIVED);
+  EXPECT_EQ(frames_[1].sdus[1],
+            std::vector<uint8_t>(kSdu, kSdu + sizeof(kSdu)));
+  /* The first SDU of the right channel joined the stream, it is not late */
+  EXPECT_EQ(buffer_.GetStats().late_sdus, 0u);
+}
+
+TEST_F(IsoJitterBufferTest, frames_are_ordered_across_timestamp_wrap) {
+  for (int seq = 0; seq < 200; seq++) {
+    Push(0, seq);
+  }
+  EXPECT_EQ(PopAll(), 200);
+  for (size_t i = 0; i < frames_.size(); i++) {
+    EXPECT_EQ(frames_[i].timestamp, Timestamp(i));
+  }
+  EXPECT_EQ(buffer_.GetStats().lost_sdus, 0u);
+}
+
+TEST_F(IsoJitterBufferTest, missing_sdu_is_concealed_after_the_depth) {
+  Push(0, 0);
+  Push(1, 0);
+  EXPECT_EQ(PopAll(), 1);
+
+  /* The right SDU of interval 1 is lost */
+  Push(0, 1);
+  EXPECT_EQ(PopAll(), 0);
+  Push(0, 2);
+  Push(1, 2);
+  EXPECT_EQ(PopAll(), 2);
+
+  EXPECT_EQ(frames_[1].states[0], ChannelState::RECEIVED);
+  EXPECT_EQ(frames_[1].states[1], ChannelState::LOST);
+  EXPECT_TRUE(frames_[1].sdus[1].empty());
+  EXPECT_EQ(buffer_.GetStats().lost_sdus, 1u);
+}
+
+TEST_F(IsoJitterBufferTest, missing_frame_is_concealed) {
+  Push(0, 0);
+  EXPECT_EQ(PopAll(), 1);
+  Push(0, 2);
+  EXPECT_EQ(PopAll(), 2);
+
+  EXPECT_EQ(frames_[1].timestamp, Timestamp(1));
+  EXPECT_EQ(frames_[1].states[0], ChannelState::LOST);
+  EXPECT_EQ(frames_[1].states[1], ChannelState::ABSENT);
+  EXPECT_EQ(frames_[2].states[0], ChannelState::RECEIVED);
+}
+
+TEST_F(IsoJitterBufferTest, late_sdu_is_dropped_and_grows_the_depth) {
+  Push(0, 0);
+  Push(1, 0);
+  Push(0, 1);
+  Push(0, 2);
+  Push(1, 2);
+  EXPECT_EQ(PopAll(), 3);
+  EXPECT_EQ(buffer_.GetStats().depth, 1);
+
+  Push(1, 1, 2 * kSduIntervalUs);
+  EXPECT_EQ(PopAll(), 0);
+  EXPECT_EQ(buffer_.GetStats().late_sdus, 1u);
+  EXPECT_EQ(buffer_.GetStats().depth, 2);
+
+  /* A missing SDU is now waited for one more interval */
+  Push(0, 3);
+  Push(0, 4);
+  Push(1, 4);
+  EXPECT_EQ(PopAll(), 0);
+  Push(0, 5);
+  Push(1, 5);
+  EXPECT_EQ(PopAll(), 3);
+}
+
+TEST_F(IsoJitterBufferTest, depth_follows_the_jitter) {
+  for (int seq = 0; seq < 100; seq++) {
+    Push(0, seq, (seq % 2) ? 15000 : 0);
+    PopAll();
+  }
+  EXPECT_GT(buffer_.GetStats().jitter_us, 10000u);
+  EXPECT_GT(buffer_.GetStats().depth, 4);
+  EXPECT_LE(buffer_.GetStats().depth, IsoJitterBuffer::kMaxDepth);
+}
+
+TEST_F(IsoJitterBufferTest, stopped_channel_is_no_longer_waited_for) {
+  for (int seq = 0; seq < 100; seq++) {
+    Push(0, seq);
+    if (seq < 10) Push(1, seq);
+    PopAll();
+  }
+  EXPECT_EQ(frames_.size(), 100u);
+  EXPECT_EQ(frames_[10].states[1], ChannelState::LOST);
+  EXPECT_EQ(frames_.back().states[1], ChannelState::ABSENT);
+  EXPECT_LE(buffer_.GetStats().lost_sdus, 50u);
+}
+
+TEST_F(IsoJitterBufferTest, drift_is_estimated_and_corrected) {
+  /* The SDUs arrive 1 us later every SDU interval, the ISO clock is 100 ppm
+   * slow compared to the local clock */
+  for (int seq = 0; seq < 3000; seq++) {
+    Push(0, seq, seq);
+    PopAll();
+  }
+  EXPECT_NEAR(buffer_.GetStats().drift_ppm, 100, 5);
+
+  /* 480 samples per 10 ms at 48 kHz, ~1 sample to add every 20 frames */
+  int correction = 0;
+  for (int i = 0; i < 200; i++) {
+    correction += buffer_.TakeDriftCorrection(480);
+  }
+  EXPECT_GE(correction, 9);
+  EXPECT_LE(correction, 11);
+}
+
+TEST_F(IsoJitterBufferTest, apply_drift_correction) {
+  std::vector<int16_t> samples = {1, 2, 3};
+  IsoJitterBuffer::ApplyDriftCorrection(&samples, 1);
+  EXPECT_EQ(samples, std::vector<int16_t>({1, 2, 3, 3}));
+  IsoJitterBuffer::ApplyDriftCorrection(&samples, -2);
+  EXPECT_EQ(samples, std::vector<int16_t>({1, 2}));
+}
+
+}  // namespace le_audio
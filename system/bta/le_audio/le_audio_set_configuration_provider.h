@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "le_audio_types.h"
 
 namespace le_audio {
@@ -38,6 +40,18 @@ class AudioSetConfigurationProvider {
   virtual bool CheckConfigurationIsDualBiDirSwb(
       const set_configurations::AudioSetConfiguration& set_configuration) const;
 
+  /* Memo of the configurations selected for the device groups, keyed by a
+   * fingerprint of everything the selection depends on. The groups of a same
+   * device model share the selections, which are valid as long as the
+   * configurations they point to, i.e. the provider lifetime.
+   */
+  bool GetMemoizedConfiguration(
+      const std::string& fingerprint,
+      const set_configurations::AudioSetConfiguration** configuration) const;
+  void MemoizeConfiguration(
+      const std::string& fingerprint,
+      const set_configurations::AudioSetConfiguration* configuration) const;
+
  private:
   struct impl;
   std::unique_ptr<impl> pimpl_;
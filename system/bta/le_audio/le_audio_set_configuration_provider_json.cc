@@ -16,10 +16,15 @@
  */
 
 #include <base/logging.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include "audio_hal_client/audio_hal_client.h"
 #include "audio_set_configurations_generated.h"
@@ -43,42 +48,84 @@ using le_audio::types::LeAudioContextType;
 namespace le_audio {
 using ::le_audio::CodecManager;
 
+static constexpr size_t kMaxMemoizedConfigurations = 256;
+
+/* The set configuration files: the binary compiled at build time from the
+ * JSON content, and the schema and the JSON content parsed when the binary is
+ * not available.
+ */
+struct ConfigurationFiles {
+  const char* binary;
+  const char* schema;
+  const char* content;
+};
+
 #ifdef __ANDROID__
-static const std::vector<
-    std::pair<const char* /*schema*/, const char* /*content*/>>
-    kLeAudioSetConfigs = {
-        {"/apex/com.android.btservices/etc/bluetooth/le_audio/"
-         "audio_set_configurations.bfbs",
-         "/apex/com.android.btservices/etc/bluetooth/le_audio/"
-         "audio_set_configurations.json"}};
-static const std::vector<
-    std::pair<const char* /*schema*/, const char* /*content*/>>
-    kLeAudioSetScenarios = {{"/apex/com.android.btservices/etc/bluetooth/"
-                             "le_audio/audio_set_scenarios.bfbs",
-                             "/apex/com.android.btservices/etc/bluetooth/"
-                             "le_audio/audio_set_scenarios.json"}};
+static const std::vector<ConfigurationFiles> kLeAudioSetConfigs = {
+    {"/apex/com.android.btservices/etc/bluetooth/le_audio/"
+     "audio_set_configurations.bin",
+     "/apex/com.android.btservices/etc/bluetooth/le_audio/"
+     "audio_set_configurations.bfbs",
+     "/apex/com.android.btservices/etc/bluetooth/le_audio/"
+     "audio_set_configurations.json"}};
+static const std::vector<ConfigurationFiles> kLeAudioSetScenarios = {
+    {"/apex/com.android.btservices/etc/bluetooth/le_audio/"
+     "audio_set_scenarios.bin",
+     "/apex/com.android.btservices/etc/bluetooth/le_audio/"
+     "audio_set_scenarios.bfbs",
+     "/apex/com.android.btservices/etc/bluetooth/le_audio/"
+     "audio_set_scenarios.json"}};
 #elif defined(TARGET_FLOSS)
-static const std::vector<
-    std::pair<const char* /*schema*/, const char* /*content*/>>
-    kLeAudioSetConfigs = {
-        {"/etc/bluetooth/le_audio/audio_set_configurations.bfbs",
-         "/etc/bluetooth/le_audio/audio_set_configurations.json"}};
-static const std::vector<
-    std::pair<const char* /*schema*/, const char* /*content*/>>
-    kLeAudioSetScenarios = {
-        {"/etc/bluetooth/le_audio/audio_set_scenarios.bfbs",
-         "/etc/bluetooth/le_audio/audio_set_scenarios.json"}};
+static const std::vector<ConfigurationFiles> kLeAudioSetConfigs = {
+    {"/etc/bluetooth/le_audio/audio_set_configurations.bin",
+     "/etc/bluetooth/le_audio/audio_set_configurations.bfbs",
+     "/etc/bluetooth/le_audio/audio_set_configurations.json"}};
+static const std::vector<ConfigurationFiles> kLeAudioSetScenarios = {
+    {"/etc/bluetooth/le_audio/audio_set_scenarios.bin",
+     "/etc/bluetooth/le_audio/audio_set_scenarios.bfbs",
+     "/etc/bluetooth/le_audio/audio_set_scenarios.json"}};
 #else
-static const std::vector<
-    std::pair<const char* /*schema*/, const char* /*content*/>>
-    kLeAudioSetConfigs = {
-        {"audio_set_configurations.bfbs", "audio_set_configurations.json"}};
-static const std::vector<
-    std::pair<const char* /*schema*/, const char* /*content*/>>
-    kLeAudioSetScenarios = {
-        {"audio_set_scenarios.bfbs", "audio_set_scenarios.json"}};
+static const std::vector<ConfigurationFiles> kLeAudioSetConfigs = {
+    {"audio_set_configurations.bin", "audio_set_configurations.bfbs",
+     "audio_set_configurations.json"}};
+static const std::vector<ConfigurationFiles> kLeAudioSetScenarios = {
+    {"audio_set_scenarios.bin", "audio_set_scenarios.bfbs",
+     "audio_set_scenarios.json"}};
 #endif
 
+/* Read-only mapping of a file, released with the object */
+class MappedFile {
+ public:
+  explicit MappedFile(const char* path) : data_(nullptr), size_(0) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr != MAP_FAILED) {
+        data_ = static_cast<const uint8_t*>(addr);
+        size_ = st.st_size;
+      }
+    }
+    close(fd);
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) munmap(const_cast<uint8_t*>(data_), size_);
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+};
+
 /** Provides a set configurations for the given context type */
 struct AudioSetConfigurationProviderJson {
   static constexpr auto kDefaultScenario = "Media";
@@ -460,8 +507,31 @@ struct AudioSetConfigurationProviderJson {
     if (!ok) return ok;
 
     /* Import from flatbuffers */
-    auto configurations_root = bluetooth::le_audio::GetAudioSetConfigurations(
-        configurations_parser_.builder_.GetBufferPointer());
+    return LoadConfigurationsFromFlat(
+        bluetooth::le_audio::GetAudioSetConfigurations(
+            configurations_parser_.builder_.GetBufferPointer()),
+        location);
+  }
+
+  bool LoadConfigurationsFromBinary(const char* binary_file,
+                                    types::CodecLocation location) {
+    MappedFile file(binary_file);
+    if (file.data() == nullptr) return false;
+
+    flatbuffers::Verifier verifier(file.data(), file.size());
+    if (!bluetooth::le_audio::VerifyAudioSetConfigurationsBuffer(verifier)) {
+      LOG_ERROR("Invalid audio set configurations in %s", binary_file);
+      return false;
+    }
+
+    /* The configurations are copied, the file is no longer needed after */
+    return LoadConfigurationsFromFlat(
+        bluetooth::le_audio::GetAudioSetConfigurations(file.data()), location);
+  }
+
+  bool LoadConfigurationsFromFlat(
+      const bluetooth::le_audio::AudioSetConfigurations* configurations_root,
+      types::CodecLocation location) {
     if (!configurations_root) return false;
 
     auto flat_qos_configs = configurations_root->qos_configurations();
@@ -539,8 +609,26 @@ struct AudioSetConfigurationProviderJson {
     if (!ok) return ok;
 
     /* Import from flatbuffers */
-    auto scenarios_root = bluetooth::le_audio::GetAudioSetScenarios(
-        scenarios_parser_.builder_.GetBufferPointer());
+    return LoadScenariosFromFlat(bluetooth::le_audio::GetAudioSetScenarios(
+        scenarios_parser_.builder_.GetBufferPointer()));
+  }
+
+  bool LoadScenariosFromBinary(const char* binary_file) {
+    MappedFile file(binary_file);
+    if (file.data() == nullptr) return false;
+
+    flatbuffers::Verifier verifier(file.data(), file.size());
+    if (!bluetooth::le_audio::VerifyAudioSetScenariosBuffer(verifier)) {
+      LOG_ERROR("Invalid audio set scenarios in %s", binary_file);
+      return false;
+    }
+
+    return LoadScenariosFromFlat(
+        bluetooth::le_audio::GetAudioSetScenarios(file.data()));
+  }
+
+  bool LoadScenariosFromFlat(
+      const bluetooth::le_audio::AudioSetScenarios* scenarios_root) {
     if (!scenarios_root) return false;
 
     auto flat_scenarios = scenarios_root->scenarios();
@@ -566,17 +654,20 @@ struct AudioSetConfigurationProviderJson {
     return true;
   }
 
-  bool LoadContent(
-      std::vector<std::pair<const char* /*schema*/, const char* /*content*/>>
-          config_files,
-      std::vector<std::pair<const char* /*schema*/, const char* /*content*/>>
-          scenario_files,
-      types::CodecLocation location) {
-    for (auto [schema, content] : config_files) {
+  bool LoadContent(const std::vector<ConfigurationFiles>& config_files,
+                   const std::vector<ConfigurationFiles>& scenario_files,
+                   types::CodecLocation location) {
+    for (auto [binary, schema, content] : config_files) {
+      if (LoadConfigurationsFromBinary(binary, location)) continue;
+
+      LOG_INFO("No precompiled configurations, parsing %s", content);
       if (!LoadConfigurationsFromFiles(schema, content, location)) return false;
     }
 
-    for (auto [schema, content] : scenario_files) {
+    for (auto [binary, schema, content] : scenario_files) {
+      if (LoadScenariosFromBinary(binary)) continue;
+
+      LOG_INFO("No precompiled scenarios, parsing %s", content);
       if (!LoadScenariosFromFiles(schema, content)) return false;
     }
     return true;
@@ -595,6 +686,7 @@ struct AudioSetConfigurationProvider::impl {
 
   void Cleanup() {
     ASSERT_LOG(config_provider_impl_, " Config provider not available.");
+    selection_memo_.clear();
     config_provider_impl_.reset();
   }
 
@@ -630,11 +722,17 @@ struct AudioSetConfigurationProvider::impl {
         }
       }
     }
+    stream << "\n  Memoized group configuration selections: "
+           << selection_memo_.size() << "\n";
     dprintf(fd, "%s", stream.str().c_str());
   }
 
   const AudioSetConfigurationProvider& config_provider_;
   std::unique_ptr<AudioSetConfigurationProviderJson> config_provider_impl_;
+
+  /* Selected configurations by group fingerprint */
+  std::unordered_map<std::string, const AudioSetConfiguration*>
+      selection_memo_;
 };
 
 static std::unique_ptr<AudioSetConfigurationProvider> config_provider;
@@ -741,6 +839,28 @@ bool AudioSetConfigurationProvider::CheckConfigurationIsDualBiDirSwb(
          dual_dev_dual_bidir_swb == le_audio::types::kLeAudioDirectionBoth;
 }
 
+bool AudioSetConfigurationProvider::GetMemoizedConfiguration(
+    const std::string& fingerprint,
+    const set_configurations::AudioSetConfiguration** configuration) const {
+  auto it = pimpl_->selection_memo_.find(fingerprint);
+  if (it == pimpl_->selection_memo_.end()) return false;
+
+  *configuration = it->second;
+  return true;
+}
+
+void AudioSetConfigurationProvider::MemoizeConfiguration(
+    const std::string& fingerprint,
+    const set_configurations::AudioSetConfiguration* configuration) const {
+  /* There are only a few device models around, a memo growing that large
+   * means that the fingerprints keep changing, start over.
+   */
+  if (pimpl_->selection_memo_.size() >= kMaxMemoizedConfigurations) {
+    pimpl_->selection_memo_.clear();
+  }
+  pimpl_->selection_memo_.insert_or_assign(fingerprint, configuration);
+}
+
 bool AudioSetConfigurationProvider::IsDualBiDirSwbSupported(void) const {
   if (pimpl_->IsRunning()) {
     return pimpl_->config_provider_impl_->IsDualBiDirSwbSupported();
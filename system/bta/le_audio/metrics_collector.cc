@@ -18,6 +18,7 @@
 
 #include <base/logging.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -282,6 +283,22 @@ void MetricsCollector::OnStreamEnded(int32_t group_id) {
   }
 }
 
+void MetricsCollector::OnStreamSetupCompleted(int32_t group_id,
+                                              bool warm_resume,
+                                              uint64_t time_to_audio_ms) {
+  if (group_id <= 0) return;
+  auto& stats = warm_resume ? warm_time_to_audio_ : cold_time_to_audio_;
+  stats.count++;
+  stats.total_ms += time_to_audio_ms;
+  stats.max_ms = std::max(stats.max_ms, time_to_audio_ms);
+  stats.last_ms = time_to_audio_ms;
+}
+
+TimeToAudioStats MetricsCollector::GetTimeToAudioStats(
+    bool warm_resume) const {
+  return warm_resume ? warm_time_to_audio_ : cold_time_to_audio_;
+}
+
 void MetricsCollector::OnBroadcastStateChanged(bool started) {
   if (started) {
     broadcast_beginning_timepoint_ = std::chrono::high_resolution_clock::now();
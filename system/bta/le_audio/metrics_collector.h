@@ -81,6 +81,16 @@ class GroupMetrics {
   virtual void Flush() = 0;
 };
 
+/* Time from the resume request of the Audio Framework to the streaming state
+ * of the group, in milliseconds.
+ */
+struct TimeToAudioStats {
+  uint32_t count = 0;
+  uint64_t total_ms = 0;
+  uint64_t max_ms = 0;
+  uint64_t last_ms = 0;
+};
+
 class MetricsCollector {
  public:
   static MetricsCollector* Get();
@@ -122,6 +132,25 @@ class MetricsCollector {
    */
   void OnStreamEnded(int32_t group_id);
 
+  /**
+   * When the stream requested by the Audio Framework reached the streaming
+   * state
+   *
+   * @param group_id Group ID of the associated stream.
+   * @param warm_resume if the stream was resumed from the QoS configured ASEs,
+   * without configuring the codec and the CIG again.
+   * @param time_to_audio_ms time from the resume request to the stream start.
+   */
+  void OnStreamSetupCompleted(int32_t group_id, bool warm_resume,
+                              uint64_t time_to_audio_ms);
+
+  /**
+   * Get the time to audio of the warm or cold stream setups
+   *
+   * @param warm_resume if the stats of the warm resumes are requested.
+   */
+  TimeToAudioStats GetTimeToAudioStats(bool warm_resume) const;
+
   /**
    * When there is a change in Bluetooth LE Audio broadcast state
    *
@@ -146,6 +175,9 @@ class MetricsCollector {
   std::unordered_map<int32_t, int32_t> group_size_table_;
 
   metrics::ClockTimePoint broadcast_beginning_timepoint_;
+
+  TimeToAudioStats warm_time_to_audio_;
+  TimeToAudioStats cold_time_to_audio_;
 };
 
 }  // namespace le_audio
@@ -40,6 +40,15 @@ void MetricsCollector::OnStreamStarted(
 
 void MetricsCollector::OnStreamEnded(int32_t group_id) {}
 
+void MetricsCollector::OnStreamSetupCompleted(int32_t group_id,
+                                              bool warm_resume,
+                                              uint64_t time_to_audio_ms) {}
+
+TimeToAudioStats MetricsCollector::GetTimeToAudioStats(
+    bool warm_resume) const {
+  return TimeToAudioStats();
+}
+
 void MetricsCollector::OnBroadcastStateChanged(bool started) {}
 
 void MetricsCollector::Flush() {}
@@ -373,6 +373,28 @@ TEST_F(MetricsCollectorTest, StreamingSessions) {
             static_cast<int32_t>(LeAudioMetricsContextType::COMMUNICATION));
 }
 
+TEST_F(MetricsCollectorTest, TimeToAudio) {
+  collector->OnStreamSetupCompleted(group_id1, false, 120);
+  collector->OnStreamSetupCompleted(group_id1, true, 30);
+  collector->OnStreamSetupCompleted(group_id2, false, 80);
+  /* Unknown groups are ignored */
+  collector->OnStreamSetupCompleted(0, true, 1000);
+
+  auto cold = collector->GetTimeToAudioStats(false);
+  ASSERT_EQ(cold.count, 2u);
+  ASSERT_EQ(cold.total_ms, 200u);
+  ASSERT_EQ(cold.max_ms, 120u);
+  ASSERT_EQ(cold.last_ms, 80u);
+
+  auto warm = collector->GetTimeToAudioStats(true);
+  ASSERT_EQ(warm.count, 1u);
+  ASSERT_EQ(warm.total_ms, 30u);
+  ASSERT_EQ(warm.max_ms, 30u);
+
+  /* Nothing is written to statsd */
+  ASSERT_EQ(log_count, 0);
+}
+
 TEST_F(MetricsCollectorTest, BroadastSessions) {
   last_broadcast_duration_nanos = 0;
   collector->OnBroadcastStateChanged(true);
@@ -64,4 +64,18 @@ uint16_t CodecInterface::GetNumOfSamplesPerChannel() {
 uint8_t CodecInterface::GetNumOfBytesPerSample() {
   return impl->GetNumOfBytesPerSample();
 };
+
+CodecInterface::Status CodecInterface::EncodeBatch(
+    std::vector<EncodeJob>& jobs, uint32_t deadline_us) {
+  auto status = Status::STATUS_OK;
+  for (auto& job : jobs) {
+    auto job_status = job.codec->Encode(job.data, job.stride, job.out_size,
+                                        job.out_buffer, job.out_offset);
+    if (status == Status::STATUS_OK) status = job_status;
+  }
+  return status;
+}
+CodecInterface::EncodeBatchStats CodecInterface::GetEncodeBatchStats() {
+  return EncodeBatchStats();
+}
 }  // namespace le_audio
@@ -716,6 +716,19 @@ class LeAudioGroupStateMachineImpl : public LeAudioGroupStateMachine {
     }
   }
 
+  /* The gaming streams start with the fewest retransmissions, which are only
+   * raised after the link quality reports show losses.
+   */
+  void ApplyLowLatencyQos(LeAudioDeviceGroup* group, struct ase* ase) {
+    if (!group->IsLowLatencyGamingMode(group->GetConfigurationContextType()))
+      return;
+
+    ase->retrans_nb =
+        group->GetLowLatencyRetransmissionNumber(ase->retrans_nb);
+    LOG_INFO("Low latency QoS settings, Retransmission Number: %d",
+             ase->retrans_nb);
+  }
+
   void ProcessHciNotifIsoLinkQualityRead(
       LeAudioDeviceGroup* group, LeAudioDevice* leAudioDevice,
       uint8_t conn_handle, uint32_t txUnackedPackets, uint32_t txFlushedPackets,
@@ -730,6 +743,10 @@ class LeAudioGroupStateMachineImpl : public LeAudioGroupStateMachine {
               << ", crcErrorPackets: " << loghex(crcErrorPackets)
               << ", rxUnreceivedPackets: " << loghex(rxUnreceivedPackets)
               << ", duplicatePackets: " << loghex(duplicatePackets);
+
+    if (group == nullptr) return;
+    group->UpdateLinkQualityLosses(
+        conn_handle, txFlushedPackets + crcErrorPackets + rxUnreceivedPackets);
   }
 
   void ReleaseCisIds(LeAudioDeviceGroup* group) {
@@ -1018,7 +1035,8 @@ class LeAudioGroupStateMachineImpl : public LeAudioGroupStateMachine {
     }
 
     if (osi_property_get_bool("persist.bluetooth.iso_link_quality_report",
-                              false)) {
+                              false) ||
+        group->IsLowLatencyGamingMode(group->GetConfigurationContextType())) {
       leAudioDevice->link_quality_timer =
           alarm_new_periodic("le_audio_cis_link_quality");
       leAudioDevice->link_quality_timer_data = event->cis_conn_hdl;
@@ -1979,6 +1997,7 @@ class LeAudioGroupStateMachineImpl : public LeAudioGroupStateMachine {
         ase->pres_delay_max = rsp.pres_delay_max;
         ase->preferred_pres_delay_min = rsp.preferred_pres_delay_min;
         ase->preferred_pres_delay_max = rsp.preferred_pres_delay_max;
+        ApplyLowLatencyQos(group, ase);
 
         SetAseState(leAudioDevice, ase,
                     AseState::BTA_LE_AUDIO_ASE_STATE_CODEC_CONFIGURED);
@@ -2104,6 +2123,7 @@ class LeAudioGroupStateMachineImpl : public LeAudioGroupStateMachine {
         ase->pres_delay_max = rsp.pres_delay_max;
         ase->preferred_pres_delay_min = rsp.preferred_pres_delay_min;
         ase->preferred_pres_delay_max = rsp.preferred_pres_delay_max;
+        ApplyLowLatencyQos(group, ase);
 
         /* This may be a notification from a re-configured ASE */
         ase->reconfigure = false;
@@ -25,6 +25,7 @@
 #include <hardware/bt_sdp.h>
 
 #include <cstdint>
+#include <deque>
 
 #include "bta/include/bta_sdp_api.h"
 #include "bta/sdp/bta_sdp_int.h"
@@ -44,6 +45,18 @@
 using namespace bluetooth::legacy::stack::sdp;
 using namespace bluetooth;
 
+/* A search waiting for the active one to complete, as the searches share the
+ * SDP discovery database. Identical requests are answered from one search. */
+typedef struct {
+  RawAddress bd_addr;
+  Uuid uuid;
+  uint16_t requests;
+} tBTA_SDP_PENDING_SEARCH;
+
+static std::deque<tBTA_SDP_PENDING_SEARCH> bta_sdp_pending_searches;
+
+static void bta_sdp_start_next_search(void);
+
 static void bta_create_mns_sdp_record(bluetooth_sdp_record* record,
                                       tSDP_DISC_REC* p_rec) {
   tSDP_DISC_ATTR* p_attr;
@@ -558,7 +571,10 @@ static void bta_sdp_search_cback(UNUSED_ATTR const RawAddress& bd_addr,
 
   bta_sdp_cb.sdp_active = false;
 
-  if (bta_sdp_cb.p_dm_cback == NULL) return;
+  if (bta_sdp_cb.p_dm_cback == NULL) {
+    bta_sdp_pending_searches.clear();
+    return;
+  }
 
   Uuid& uuid = *(reinterpret_cast<Uuid*>(const_cast<void*>(user_data)));
 
@@ -631,11 +647,17 @@ static void bta_sdp_search_cback(UNUSED_ATTR const RawAddress& bd_addr,
 
   tBTA_SDP bta_sdp;
   bta_sdp.sdp_search_comp = evt_data;
-  bta_sdp_cb.p_dm_cback(BTA_SDP_SEARCH_COMP_EVT, &bta_sdp, (void*)&uuid);
+  uint16_t requests = 1 + bta_sdp_cb.coalesced_requests;
+  bta_sdp_cb.coalesced_requests = 0;
+  for (uint16_t i = 0; i < requests; i++) {
+    bta_sdp_cb.p_dm_cback(BTA_SDP_SEARCH_COMP_EVT, &bta_sdp, (void*)&uuid);
+  }
   bluetooth::shim::CountCounterMetrics(
       android::bluetooth::CodePathCounterKeyEnum::SDP_SUCCESS, 1);
   osi_free(const_cast<void*>(
       user_data));  // We no longer need the user data to track the search
+
+  bta_sdp_start_next_search();
 }
 
 /*******************************************************************************
@@ -651,6 +673,7 @@ void bta_sdp_enable(tBTA_SDP_DM_CBACK* p_cback) {
   log::verbose("in, sdp_active:{}", bta_sdp_cb.sdp_active);
   tBTA_SDP_STATUS status = BTA_SDP_SUCCESS;
   bta_sdp_cb.p_dm_cback = p_cback;
+  bta_sdp_pending_searches.clear();
   tBTA_SDP bta_sdp;
   bta_sdp.status = status;
   bta_sdp_cb.p_dm_cback(BTA_SDP_ENABLE_EVT, &bta_sdp, NULL);
@@ -658,36 +681,48 @@ void bta_sdp_enable(tBTA_SDP_DM_CBACK* p_cback) {
 
 /*******************************************************************************
  *
- * Function     bta_sdp_search
+ * Function     bta_sdp_report_search_failure
  *
- * Description  Discovers all sdp records for an uuid on remote device
+ * Description  Reports a search that could not be performed to each of the
+ *              requests for it
  *
  * Returns      void
  *
  ******************************************************************************/
-void bta_sdp_search(const RawAddress bd_addr, const bluetooth::Uuid uuid) {
-  tBTA_SDP_STATUS status = BTA_SDP_FAILURE;
-
-  log::verbose("in, sdp_active:{}", bta_sdp_cb.sdp_active);
-
-  if (bta_sdp_cb.sdp_active) {
-    /* SDP is still in progress */
-    status = BTA_SDP_BUSY;
-    if (bta_sdp_cb.p_dm_cback) {
-      tBTA_SDP_SEARCH_COMP result;
-      memset(&result, 0, sizeof(result));
-      result.uuid = uuid;
-      result.remote_addr = bd_addr;
-      result.status = status;
-      tBTA_SDP bta_sdp;
-      bta_sdp.sdp_search_comp = result;
-      bta_sdp_cb.p_dm_cback(BTA_SDP_SEARCH_COMP_EVT, &bta_sdp, NULL);
-    }
-    return;
+static void bta_sdp_report_search_failure(const RawAddress& bd_addr,
+                                          const Uuid& uuid,
+                                          tBTA_SDP_STATUS status,
+                                          uint16_t requests) {
+  if (!bta_sdp_cb.p_dm_cback) return;
+
+  tBTA_SDP_SEARCH_COMP result;
+  memset(&result, 0, sizeof(result));
+  result.uuid = uuid;
+  result.remote_addr = bd_addr;
+  result.status = status;
+  tBTA_SDP bta_sdp;
+  bta_sdp.sdp_search_comp = result;
+  for (uint16_t i = 0; i < requests; i++) {
+    bta_sdp_cb.p_dm_cback(BTA_SDP_SEARCH_COMP_EVT, &bta_sdp, NULL);
   }
+}
 
+/*******************************************************************************
+ *
+ * Function     bta_sdp_start_search
+ *
+ * Description  Starts the SDP search for an uuid on remote device, on behalf
+ *              of the given number of identical requests
+ *
+ * Returns      void
+ *
+ ******************************************************************************/
+static void bta_sdp_start_search(const RawAddress& bd_addr, const Uuid& uuid,
+                                 uint16_t requests) {
   bta_sdp_cb.sdp_active = true;
   bta_sdp_cb.remote_addr = bd_addr;
+  bta_sdp_cb.active_uuid = uuid;
+  bta_sdp_cb.coalesced_requests = requests - 1;
 
   /* initialize the search for the uuid */
   log::verbose("init discovery with UUID: {}", uuid.ToString());
@@ -700,17 +735,12 @@ void bta_sdp_search(const RawAddress bd_addr, const bluetooth::Uuid uuid) {
           bd_addr, p_bta_sdp_cfg->p_sdp_db, bta_sdp_search_cback,
           (void*)bta_sdp_search_uuid)) {
     bta_sdp_cb.sdp_active = false;
+    bta_sdp_cb.coalesced_requests = 0;
+    osi_free(bta_sdp_search_uuid);
 
     /* failed to start SDP. report the failure right away */
+    bta_sdp_report_search_failure(bd_addr, uuid, BTA_SDP_FAILURE, requests);
     if (bta_sdp_cb.p_dm_cback) {
-      tBTA_SDP_SEARCH_COMP result;
-      memset(&result, 0, sizeof(result));
-      result.uuid = uuid;
-      result.remote_addr = bd_addr;
-      result.status = status;
-      tBTA_SDP bta_sdp;
-      bta_sdp.sdp_search_comp = result;
-      bta_sdp_cb.p_dm_cback(BTA_SDP_SEARCH_COMP_EVT, &bta_sdp, NULL);
       bluetooth::shim::CountCounterMetrics(
           android::bluetooth::CodePathCounterKeyEnum::SDP_FAILURE, 1);
     }
@@ -720,6 +750,66 @@ void bta_sdp_search(const RawAddress bd_addr, const bluetooth::Uuid uuid) {
   */
 }
 
+/*******************************************************************************
+ *
+ * Function     bta_sdp_start_next_search
+ *
+ * Description  Starts the oldest pending search, skipping the ones that fail
+ *              to start
+ *
+ * Returns      void
+ *
+ ******************************************************************************/
+static void bta_sdp_start_next_search(void) {
+  while (!bta_sdp_cb.sdp_active && !bta_sdp_pending_searches.empty()) {
+    tBTA_SDP_PENDING_SEARCH search = bta_sdp_pending_searches.front();
+    bta_sdp_pending_searches.pop_front();
+    bta_sdp_start_search(search.bd_addr, search.uuid, search.requests);
+  }
+}
+
+/*******************************************************************************
+ *
+ * Function     bta_sdp_search
+ *
+ * Description  Discovers all sdp records for an uuid on remote device. While
+ *              another search is in progress the request is queued, or joins
+ *              an identical search that is already active or queued.
+ *
+ * Returns      void
+ *
+ ******************************************************************************/
+void bta_sdp_search(const RawAddress bd_addr, const bluetooth::Uuid uuid) {
+  log::verbose("in, sdp_active:{}", bta_sdp_cb.sdp_active);
+
+  if (bta_sdp_cb.sdp_active) {
+    if (bta_sdp_cb.remote_addr == bd_addr && bta_sdp_cb.active_uuid == uuid) {
+      bta_sdp_cb.coalesced_requests++;
+      return;
+    }
+
+    for (auto& search : bta_sdp_pending_searches) {
+      if (search.bd_addr == bd_addr && search.uuid == uuid) {
+        search.requests++;
+        return;
+      }
+    }
+
+    if (bta_sdp_pending_searches.size() >= BTA_SDP_MAX_PENDING_SEARCHES) {
+      /* Too many searches waiting for SDP */
+      log::warn("search queue full, peer:{} uuid:{}",
+                ADDRESS_TO_LOGGABLE_CSTR(bd_addr), uuid.ToString());
+      bta_sdp_report_search_failure(bd_addr, uuid, BTA_SDP_BUSY, 1);
+      return;
+    }
+
+    bta_sdp_pending_searches.push_back({bd_addr, uuid, 1});
+    return;
+  }
+
+  bta_sdp_start_search(bd_addr, uuid, 1);
+}
+
 /*******************************************************************************
  *
  * Function     bta_sdp_record
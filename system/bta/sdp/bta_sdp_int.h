@@ -35,10 +35,16 @@
  *  Constants
  ****************************************************************************/
 
+/* Max number of distinct searches waiting for the active one to complete */
+#define BTA_SDP_MAX_PENDING_SEARCHES 16
+
 /* SDP control block */
 typedef struct {
   bool sdp_active;
   RawAddress remote_addr;
+  bluetooth::Uuid active_uuid;
+  uint16_t coalesced_requests; /* Identical requests answered together with */
+                               /* the active search */
   tBTA_SDP_DM_CBACK* p_dm_cback;
 } tBTA_SDP_CB;
 
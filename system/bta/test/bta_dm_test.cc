@@ -42,6 +42,7 @@
 #include "test/mock/mock_osi_properties.h"
 #include "test/mock/mock_stack_acl.h"
 #include "test/mock/mock_stack_btm_interface.h"
+#include "test/mock/mock_stack_l2cap_api.h"
 
 #define TEST_BT com::android::bluetooth::flags
 
@@ -610,6 +611,37 @@ TEST_F(BtaDmCustomAlarmTest, bta_dm_sniff_cback) {
   ASSERT_EQ(2, get_func_call_count("alarm_set_on_mloop"));
 }
 
+TEST_F(BtaDmTest, bta_dm_pm_defer_sniff__busy_link) {
+  tBTA_DM_PEER_DEVICE* device = bluetooth::legacy::testing::allocate_device_for(
+      kRawAddress, BT_TRANSPORT_BR_EDR);
+  ASSERT_TRUE(device != nullptr);
+
+  uint64_t traffic_bytes = 0;
+  test::mock::stack_l2cap_api::L2CA_GetLinkTrafficBytes.body =
+      [&traffic_bytes](const RawAddress& /* bd_addr */,
+                       tBT_TRANSPORT /* transport */) { return traffic_bytes; };
+  bta_dm_pm_init_stats(device);
+
+  // A busy link stays active a while longer
+  for (uint8_t i = 0; i < kPmMaxConsecutiveSniffDeferrals; i++) {
+    traffic_bytes += 2 * kPmBusyLinkBytesPerSecond;
+    device->pm_stats.traffic_sampled_ms -= 1000;
+    ASSERT_TRUE(bta_dm_pm_defer_sniff(device));
+  }
+
+  // But not forever
+  traffic_bytes += 2 * kPmBusyLinkBytesPerSecond;
+  device->pm_stats.traffic_sampled_ms -= 1000;
+  ASSERT_FALSE(bta_dm_pm_defer_sniff(device));
+
+  // An idle link enters sniff mode right away
+  device->pm_stats.traffic_sampled_ms -= 1000;
+  ASSERT_FALSE(bta_dm_pm_defer_sniff(device));
+  ASSERT_EQ(kPmMaxConsecutiveSniffDeferrals, device->pm_stats.sniff_deferrals);
+
+  test::mock::stack_l2cap_api::L2CA_GetLinkTrafficBytes = {};
+}
+
 TEST_F_WITH_FLAGS(BtaDmCustomAlarmTest, sniff_offload_feature__enable_flag,
                   REQUIRES_FLAGS_ENABLED(ACONFIG_FLAG(TEST_BT,
                                                       enable_sniff_offload))) {
@@ -792,22 +792,36 @@ class VolumeControlImpl : public VolumeControl {
       return;
     };
 
-    auto op = &ongoing_operations_.front();
+    /* Each device handles a single operation at a time, as a write carrying a
+     * stale change counter would be rejected. Operations on other devices, for
+     * example another group, do not have to wait for it.
+     */
+    std::vector<RawAddress> busy_devices;
+    for (auto& op : ongoing_operations_) {
+      bool is_blocked = std::any_of(
+          op.devices_.begin(), op.devices_.end(), [&busy_devices](auto& d) {
+            return std::find(busy_devices.begin(), busy_devices.end(), d) !=
+                   busy_devices.end();
+          });
+      busy_devices.insert(busy_devices.end(), op.devices_.begin(),
+                          op.devices_.end());
+
+      if (op.IsStarted()) {
+        log::info("wait until operation {} is complete", op.operation_id_);
+        continue;
+      }
+      if (is_blocked) continue;
 
-    log::info("operation_id: {}", op->operation_id_);
+      log::info("operation_id: {}", op.operation_id_);
+      op.Start();
 
-    if (op->IsStarted()) {
-      log::info("wait until operation {} is complete", op->operation_id_);
-      return;
+      alarm_set_on_mloop(op.operation_timeout_, 3000, operation_callback,
+                         INT_TO_PTR(op.operation_id_));
+      devices_control_point_helper(
+          op.devices_, op.opcode_,
+          op.arguments_.size() == 0 ? nullptr : &(op.arguments_),
+          op.operation_id_);
     }
-
-    op->Start();
-
-    alarm_set_on_mloop(op->operation_timeout_, 3000, operation_callback,
-                       INT_TO_PTR(op->operation_id_));
-    devices_control_point_helper(
-        op->devices_, op->opcode_,
-        op->arguments_.size() == 0 ? nullptr : &(op->arguments_));
   }
 
   void CancelVolumeOperation(int operation_id) {
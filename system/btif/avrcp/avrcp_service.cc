@@ -163,16 +163,48 @@ class MediaInterfaceWrapper : public MediaInterface {
   }
 
   void GetSongInfo(SongInfoCallback info_cb) override {
-    auto cb_lambda = [](SongInfoCallback cb, SongInfo data) {
-      do_in_main_thread(FROM_HERE, base::BindOnce(cb, data));
+    // Controllers keep polling the attributes of the current track. Answer
+    // them from the cache until the media layer reports a track change.
+    if (song_info_cache_->valid) {
+      do_in_main_thread(FROM_HERE,
+                        base::BindOnce(info_cb, song_info_cache_->info));
+      return;
+    }
+
+    auto cb_lambda = [](std::shared_ptr<SongInfoCache> cache,
+                        uint32_t generation, SongInfoCallback cb,
+                        SongInfo data) {
+      auto update_lambda = [](std::shared_ptr<SongInfoCache> cache,
+                              uint32_t generation, SongInfoCallback cb,
+                              SongInfo data) {
+        // Don't cache a reply that was requested before a track change
+        if (cache->generation == generation) {
+          cache->info = data;
+          cache->valid = true;
+        }
+        cb.Run(std::move(data));
+      };
+      do_in_main_thread(FROM_HERE, base::BindOnce(update_lambda, cache,
+                                                  generation, cb, data));
     };
 
-    auto bound_cb = base::Bind(cb_lambda, info_cb);
+    auto bound_cb = base::Bind(cb_lambda, song_info_cache_,
+                               song_info_cache_->generation, info_cb);
 
     do_in_avrcp_jni(base::Bind(&MediaInterface::GetSongInfo,
                                base::Unretained(wrapped_), bound_cb));
   }
 
+  // Drops the cached song info. May be called on any thread.
+  void InvalidateSongInfo() {
+    auto invalidate_lambda = [](std::shared_ptr<SongInfoCache> cache) {
+      cache->valid = false;
+      cache->generation++;
+    };
+    do_in_main_thread(FROM_HERE,
+                      base::BindOnce(invalidate_lambda, song_info_cache_));
+  }
+
   void GetPlayStatus(PlayStatusCallback status_cb) override {
     auto cb_lambda = [](PlayStatusCallback cb, PlayStatus status) {
       do_in_main_thread(FROM_HERE, base::BindOnce(cb, status));
@@ -260,7 +292,16 @@ class MediaInterfaceWrapper : public MediaInterface {
   }
 
  private:
+  // Song info of the current track, only accessed on the main thread
+  struct SongInfoCache {
+    bool valid = false;
+    uint32_t generation = 0;
+    SongInfo info;
+  };
+
   MediaInterface* wrapped_;
+  std::shared_ptr<SongInfoCache> song_info_cache_ =
+      std::make_shared<SongInfoCache>();
 };
 
 // A wrapper class for the media callbacks that handles thread
@@ -454,6 +495,7 @@ void AvrcpService::Cleanup() {
     delete volume_interface_;
   }
   delete media_interface_;
+  media_interface_ = nullptr;
 }
 
 void AvrcpService::RegisterBipServer(int psm) {
@@ -516,6 +558,12 @@ void AvrcpService::SendMediaUpdate(bool track_changed, bool play_state,
   log::info("track_changed={} :  play_state={} :  queue={}", track_changed,
             play_state, queue);
 
+  // The cached song info is dropped before the devices are updated so that
+  // they fetch the new track.
+  if (track_changed && media_interface_ != nullptr) {
+    media_interface_->InvalidateSongInfo();
+  }
+
   // This function may be called on any thread, we need to make sure that the
   // device update happens on the main thread.
   for (const auto& device :
@@ -531,6 +579,11 @@ void AvrcpService::SendFolderUpdate(bool available_players,
   log::info("available_players={} :  addressed_players={} :  uids={}",
             available_players, addressed_players, uids);
 
+  // A new addressed player plays another track
+  if (addressed_players && media_interface_ != nullptr) {
+    media_interface_->InvalidateSongInfo();
+  }
+
   // Ensure that the update is posted to the correct thread
   for (const auto& device :
        instance_->connection_handler_->GetListOfDevices()) {
@@ -28,6 +28,8 @@
 namespace bluetooth {
 namespace avrcp {
 
+class MediaInterfaceWrapper;
+
 /**
  * AvrcpService is the management interface for AVRCP Target. It handles any
  * required thread switching, interface registration, and provides an API
@@ -110,7 +112,7 @@ class AvrcpService : public MediaCallbacks {
   uint32_t ct_sdp_record_handle = -1;
   uint16_t profile_version = -1;
 
-  MediaInterface* media_interface_ = nullptr;
+  MediaInterfaceWrapper* media_interface_ = nullptr;
   VolumeInterface* volume_interface_ = nullptr;
   PlayerSettingsInterface* player_settings_interface_ = nullptr;
 
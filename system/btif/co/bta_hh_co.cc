@@ -29,9 +29,11 @@
 #include <unistd.h>
 
 #include <cerrno>
+#include <cstddef>
 
 #include "bta_hh_api.h"
 #include "btif_hh.h"
+#include "common/time_util.h"
 #include "device/include/controller.h"
 #include "include/check.h"
 #include "os/log.h"
@@ -127,16 +129,17 @@ static bool uhid_set_report_req_handler(btif_hh_device_t* p_dev,
 #endif  // ENABLE_UHID_SET_REPORT
 
 /*Internal function to perform UHID write and error checking*/
-static int uhid_write(int fd, const struct uhid_event* ev) {
+static int uhid_write(int fd, const struct uhid_event* ev,
+                      size_t size = sizeof(struct uhid_event)) {
   ssize_t ret;
-  OSI_NO_INTR(ret = write(fd, ev, sizeof(*ev)));
+  OSI_NO_INTR(ret = write(fd, ev, size));
 
   if (ret < 0) {
     int rtn = -errno;
     log::error("Cannot write to uhid:{}", strerror(errno));
     return rtn;
-  } else if (ret != (ssize_t)sizeof(*ev)) {
-    log::error("Wrong size written to uhid: {} != {}", ret, sizeof(*ev));
+  } else if (ret != (ssize_t)size) {
+    log::error("Wrong size written to uhid: {} != {}", ret, size);
     return -EFAULT;
   }
 
@@ -371,16 +374,50 @@ int bta_hh_co_write(int fd, uint8_t* rpt, uint16_t len) {
   log::verbose("UHID write {}", len);
 
   struct uhid_event ev;
-  memset(&ev, 0, sizeof(ev));
-  ev.type = UHID_INPUT;
-  ev.u.input.size = len;
-  if (len > sizeof(ev.u.input.data)) {
+  if (len > sizeof(ev.u.input2.data)) {
     log::warn("Report size greater than allowed size");
     return -1;
   }
-  memcpy(ev.u.input.data, rpt, len);
 
-  return uhid_write(fd, &ev);
+  // UHID_INPUT2 accepts a write truncated after the report, so only the
+  // header and the report are filled in and copied instead of the whole
+  // event of several KB.
+  ev.type = UHID_INPUT2;
+  ev.u.input2.size = len;
+  memcpy(ev.u.input2.data, rpt, len);
+
+  return uhid_write(fd, &ev, offsetof(struct uhid_event, u.input2.data) + len);
+}
+
+/* Internal function to find the histogram bucket of a duration */
+static size_t uhid_histogram_bucket(uint64_t duration_us) {
+  size_t bucket = 0;
+  uint64_t bound_us = BTIF_HH_HISTOGRAM_BASE_US;
+  while (bucket < BTIF_HH_HISTOGRAM_BUCKETS - 1 && duration_us >= bound_us) {
+    bucket++;
+    bound_us <<= 1;
+  }
+  return bucket;
+}
+
+/* Internal function to account an input report received at received_us */
+static void uhid_record_input_report(btif_hh_input_stats_t* stats,
+                                     uint64_t received_us, bool written) {
+  if (stats->num_reports > 0) {
+    stats->interval_histogram[uhid_histogram_bucket(
+        received_us - stats->last_report_us)]++;
+  }
+  stats->num_reports++;
+  stats->last_report_us = received_us;
+
+  if (!written) {
+    stats->num_write_errors++;
+    return;
+  }
+  uint64_t write_us =
+      bluetooth::common::time_get_os_boottime_us() - received_us;
+  stats->write_histogram[uhid_histogram_bucket(write_us)]++;
+  if (write_us > stats->max_write_us) stats->max_write_us = write_us;
 }
 
 /*******************************************************************************
@@ -452,6 +489,7 @@ bool bta_hh_co_open(uint8_t dev_handle, uint8_t sub_class,
   }
 
   p_dev->dev_status = BTHH_CONN_STATE_CONNECTED;
+  memset(&p_dev->input_stats, 0, sizeof(p_dev->input_stats));
   p_dev->get_rpt_id_queue = fixed_queue_new(SIZE_MAX);
   CHECK(p_dev->get_rpt_id_queue);
 #if ENABLE_UHID_SET_REPORT
@@ -519,6 +557,7 @@ void bta_hh_co_data(uint8_t dev_handle, uint8_t* p_rpt, uint16_t len,
                     uint8_t ctry_code,
                     UNUSED_ATTR const tAclLinkSpec& link_spec, uint8_t app_id) {
   btif_hh_device_t* p_dev;
+  uint64_t received_us = bluetooth::common::time_get_os_boottime_us();
 
   log::verbose(
       "dev_handle = {}, subclass = 0x{:02X}, mode = {}, ctry_code = {}, app_id "
@@ -543,7 +582,8 @@ void bta_hh_co_data(uint8_t dev_handle, uint8_t* p_rpt, uint16_t len,
 
   // Send the HID data to the kernel.
   if ((p_dev->fd >= 0) && p_dev->ready_for_data) {
-    bta_hh_co_write(p_dev->fd, p_rpt, len);
+    int ret = bta_hh_co_write(p_dev->fd, p_rpt, len);
+    uhid_record_input_report(&p_dev->input_stats, received_us, ret == 0);
   } else {
     log::warn("Error: fd = {}, ready {}, len = {}", p_dev->fd,
               p_dev->ready_for_data, len);
@@ -841,5 +881,56 @@ void bta_hh_le_co_reset_rpt_cache(const tAclLinkSpec& link_spec,
 
   btif_config_remove(bdstr, BTIF_STORAGE_KEY_HID_REPORT);
   btif_config_remove(bdstr, BTIF_STORAGE_KEY_HID_REPORT_VERSION);
+  btif_config_remove(bdstr, BTIF_STORAGE_KEY_HID_REPORT_DB_HASH);
   log::verbose("Reset cache for bda {}", ADDRESS_TO_LOGGABLE_CSTR(link_spec));
 }
+
+/*******************************************************************************
+ *
+ * Function         bta_hh_le_co_save_db_hash
+ *
+ * Description      This callout function is to save the hash of the GATT
+ *                  database the cached HOGP reports were discovered from.
+ *
+ * Parameters       link_spec  - acl link specification
+ *                  db_hash    - GATT database hash
+ *
+ * Returns          none
+ *
+ ******************************************************************************/
+void bta_hh_le_co_save_db_hash(const tAclLinkSpec& link_spec,
+                               const Octet16& db_hash) {
+  std::string addrstr = link_spec.addrt.ToString();
+  const char* bdstr = addrstr.c_str();
+
+  btif_config_set_bin(bdstr, BTIF_STORAGE_KEY_HID_REPORT_DB_HASH,
+                      db_hash.data(), db_hash.size());
+  log::verbose("Saved database hash for bda {}",
+               ADDRESS_TO_LOGGABLE_CSTR(link_spec));
+}
+
+/*******************************************************************************
+ *
+ * Function         bta_hh_le_co_load_db_hash
+ *
+ * Description      This callout function is to load the hash of the GATT
+ *                  database the cached HOGP reports were discovered from.
+ *
+ * Parameters       link_spec  - acl link specification
+ *                  p_db_hash  - output parameter for the GATT database hash
+ *
+ * Returns          true if a hash is saved for the device.
+ *
+ ******************************************************************************/
+bool bta_hh_le_co_load_db_hash(const tAclLinkSpec& link_spec,
+                               Octet16* p_db_hash) {
+  std::string addrstr = link_spec.addrt.ToString();
+  const char* bdstr = addrstr.c_str();
+
+  size_t len = btif_config_get_bin_length(bdstr,
+                                          BTIF_STORAGE_KEY_HID_REPORT_DB_HASH);
+  if (len != p_db_hash->size()) return false;
+
+  return btif_config_get_bin(bdstr, BTIF_STORAGE_KEY_HID_REPORT_DB_HASH,
+                             p_db_hash->data(), &len);
+}
@@ -426,4 +426,15 @@ bt_status_t btif_set_dynamic_audio_buffer_size(int codec, int size);
  ******************************************************************************/
 void btif_debug_linkkey_type_dump(int fd);
 
+/*******************************************************************************
+ *
+ * Function         btif_debug_bonded_devices_load_dump
+ *
+ * Description     Dump the time spent loading the bonded devices at enable
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+void btif_debug_bonded_devices_load_dump(int fd);
+
 #endif /* BTIF_API_H */
@@ -369,6 +369,31 @@ class BqrVseSubEvt {
 
 BluetoothQualityReportInterface* getBluetoothQualityReportInterface();
 
+// Receives the Link Quality related BQR events as they arrive, so that the
+// stack can adapt to the link quality instead of only logging it.
+class LinkQualityObserver {
+ public:
+  virtual ~LinkQualityObserver() = default;
+  // Called on the main thread for each Link Quality related BQR event. The
+  // address is resolved from the connection handle when the controller did not
+  // report it.
+  //
+  // @param event The parsed Link Quality related BQR event.
+  virtual void OnLinkQualityEvent(const BqrLinkQualityEvent& event) = 0;
+};
+
+// Start delivering Link Quality related BQR events to |observer|. Must be
+// called on the main thread.
+//
+// @param observer The observer to register, it must outlive its registration.
+void RegisterLinkQualityObserver(LinkQualityObserver* observer);
+
+// Stop delivering Link Quality related BQR events to |observer|. Must be
+// called on the main thread.
+//
+// @param observer The observer to unregister.
+void UnregisterLinkQualityObserver(LinkQualityObserver* observer);
+
 // Get a string representation of the Quality Report ID.
 //
 // @param quality_report_id The quality report ID to convert.
@@ -27,6 +27,7 @@
 #include <stdlib.h>
 
 #include <functional>
+#include <string>
 
 #include "abstract_message_loop.h"
 #include "bta/include/bta_api.h"
@@ -101,6 +102,12 @@ typedef struct {
 bt_status_t do_in_jni_thread(base::OnceClosure task);
 bt_status_t do_in_jni_thread(const base::Location& from_here,
                              base::OnceClosure task);
+/* Replaces the task posted with the same key if it did not run yet */
+bt_status_t do_in_jni_thread_coalesced(const base::Location& from_here,
+                                       std::string key, base::OnceClosure task);
+/* Runs the task ahead of the tasks already waiting on the JNI thread */
+bt_status_t do_in_jni_thread_urgent(const base::Location& from_here,
+                                    base::OnceClosure task);
 bool is_on_jni_thread();
 
 using BtJniClosure = std::function<void()>;
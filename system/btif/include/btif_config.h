@@ -56,6 +56,9 @@ size_t btif_config_get_bin_length(const std::string& section,
                                   const std::string& key);
 
 std::vector<RawAddress> btif_config_get_paired_devices();
+// Paired devices that have |key| set, without going through every device
+std::vector<RawAddress> btif_config_get_paired_devices_with_key(
+    const std::string& key);
 
 bool btif_config_clear(void);
 void btif_debug_config_dump(int fd);
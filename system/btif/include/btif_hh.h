@@ -48,6 +48,12 @@
 #define BTIF_HH_MAX_POLLING_ATTEMPTS 10
 #define BTIF_HH_POLLING_SLEEP_DURATION_US 5000
 
+/* Input report histogram buckets, bucket i counts samples below
+ * (BTIF_HH_HISTOGRAM_BASE_US << i) microseconds, the last bucket counts the
+ * rest */
+#define BTIF_HH_HISTOGRAM_BUCKETS 10
+#define BTIF_HH_HISTOGRAM_BASE_US 64
+
 #ifndef ENABLE_UHID_SET_REPORT
 #if defined(__ANDROID__) || defined(TARGET_FLOSS)
 #define ENABLE_UHID_SET_REPORT 1
@@ -84,6 +90,18 @@ inline std::string btif_hh_status_text(const BTIF_HH_STATUS& status) {
   }
 }
 
+/* Timing of the input reports forwarded to uhid */
+typedef struct {
+  uint32_t num_reports;
+  uint32_t num_write_errors;
+  uint64_t last_report_us;
+  uint64_t max_write_us;
+  /* Time between consecutive reports, shows the report rate jitter */
+  uint32_t interval_histogram[BTIF_HH_HISTOGRAM_BUCKETS];
+  /* Time from receiving a report to completing its uhid write */
+  uint32_t write_histogram[BTIF_HH_HISTOGRAM_BUCKETS];
+} btif_hh_input_stats_t;
+
 // Shared with uhid polling thread
 typedef struct {
   bthh_connection_state_t dev_status;
@@ -102,6 +120,7 @@ typedef struct {
   fixed_queue_t* set_rpt_id_queue;
 #endif // ENABLE_UHID_SET_REPORT
   bool local_vup;  // Indicated locally initiated VUP
+  btif_hh_input_stats_t input_stats;
 } btif_hh_device_t;
 
 /* Control block to maintain properties of devices */
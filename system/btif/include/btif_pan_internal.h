@@ -27,6 +27,8 @@
 #ifndef BTIF_PAN_INTERNAL_H
 #define BTIF_PAN_INTERNAL_H
 
+#include <cstdint>
+
 #include "internal_include/bt_target.h"
 #include "types/raw_address.h"
 
@@ -65,6 +67,16 @@ typedef struct {
   RawAddress eth_addr;
 } btpan_conn_t;
 
+typedef struct {
+  uint64_t tap_rx_frames;     // frames read from the TAP interface
+  uint64_t tap_rx_bytes;      // bytes read from the TAP interface
+  uint64_t tap_rx_wakeups;    // TAP read passes on the main thread
+  uint64_t tap_rx_congested;  // frames held back by a full BNEP queue
+  uint64_t tap_rx_cpu_us;     // thread CPU time spent in the TAP read passes
+  uint64_t tap_tx_frames;     // frames written to the TAP interface
+  uint64_t tap_tx_bytes;      // bytes written to the TAP interface
+} btpan_stats_t;
+
 typedef struct {
   int btl_if_handle;
   int btl_if_handle_panu;
@@ -75,6 +87,7 @@ typedef struct {
   btpan_conn_t conns[MAX_PAN_CONNS];
   int congest_packet_size;
   unsigned char congest_packet[1600];  // max ethernet packet size
+  btpan_stats_t stats;
 } btpan_cb_t;
 
 /*******************************************************************************
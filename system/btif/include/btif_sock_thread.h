@@ -54,5 +54,6 @@ int btsock_thread_post_cmd(int handle, int cmd_type,
 int btsock_thread_create(btsock_signaled_cb callback,
                          btsock_cmd_cb cmd_callback);
 int btsock_thread_exit(int handle);
+void btsock_thread_dump(int fd);
 
 #endif
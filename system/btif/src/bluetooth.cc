@@ -63,6 +63,7 @@
 #include "bta/include/bta_le_audio_broadcaster_api.h"
 #include "bta/include/bta_vc_api.h"
 #include "btif/avrcp/avrcp_service.h"
+#include "btif/include/btif_jni_task.h"
 #include "btif/include/btif_sock.h"
 #include "btif/include/core_callbacks.h"
 #include "btif/include/stack_manager_t.h"
@@ -94,11 +95,13 @@
 #include "include/check.h"
 #include "internal_include/bt_target.h"
 #include "main/shim/dumpsys.h"
+#include "metrics/counter_registry.h"
 #include "os/log.h"
 #include "os/parameter_provider.h"
 #include "osi/include/alarm.h"
 #include "osi/include/allocator.h"
 #include "osi/include/stack_power_telemetry.h"
+#include "osi/include/thread_scheduler.h"
 #include "osi/include/wakelock.h"
 #include "stack/btm/btm_sco_hfp_hal.h"
 #include "stack/gatt/connection_manager.h"
@@ -182,6 +185,8 @@ bt_status_t btif_hh_connect(const tAclLinkSpec* link_spec);
 bt_status_t btif_hd_execute_service(bool b_enable);
 
 extern void gatt_tcb_dump(int fd);
+extern void btm_inq_db_dump(int fd);
+extern void btm_ble_rpa_cache_dump(int fd);
 
 /*******************************************************************************
  *  Callbacks from bluetooth::core (see go/invisalign-bt)
@@ -810,19 +815,27 @@ static void dump(int fd, const char** arguments) {
   btif_debug_conn_dump(fd);
   btif_debug_bond_event_dump(fd);
   btif_debug_linkkey_type_dump(fd);
+  btif_debug_bonded_devices_load_dump(fd);
   btif_debug_rc_dump(fd);
   btif_debug_a2dp_dump(fd);
   btif_debug_av_dump(fd);
   bta_debug_av_dump(fd);
   stack_debug_avdtp_api_dump(fd);
   btif_sock_dump(fd);
+  btif_debug_pan_dump(fd);
   bluetooth::avrcp::AvrcpService::DebugDump(fd);
   btif_debug_config_dump(fd);
   gatt_tcb_dump(fd);
+  bluetooth::metrics::CounterRegistry::Get().Dump(fd);
+  btm_inq_db_dump(fd);
+  btm_ble_rpa_cache_dump(fd);
   device_debug_iot_config_dump(fd);
   BTA_HfClientDumpStatistics(fd);
   wakelock_debug_dump(fd);
+  jni_thread_dump(fd);
   alarm_debug_dump(fd);
+  osi_allocator_debug_dump(fd);
+  thread_scheduler_debug_dump(fd);
   bluetooth::csis::CsisClient::DebugDump(fd);
   ::le_audio::has::HasClient::DebugDump(fd);
   HearingAid::DebugDump(fd);
@@ -1469,7 +1482,8 @@ void invoke_le_test_mode_cb(bt_status_t status, uint16_t count) {
 // takes ownership of |uid_data|
 void invoke_energy_info_cb(bt_activity_energy_info energy_info,
                            bt_uid_traffic_t* uid_data) {
-  do_in_jni_thread(
+  // Answers a request that the Java layer waits on with a timeout
+  do_in_jni_thread_urgent(
       FROM_HERE,
       base::BindOnce(
           [](bt_activity_energy_info energy_info, bt_uid_traffic_t* uid_data) {
@@ -34,16 +34,20 @@
 #include "btif/include/btif_avrcp_audio_track.h"
 #include "btif/include/btif_util.h"  // CASE_RETURN_STR
 #include "common/message_loop_thread.h"
+#include "common/time_util.h"
 #include "include/check.h"
 #include "os/log.h"
 #include "osi/include/alarm.h"
 #include "osi/include/allocator.h"
 #include "osi/include/fixed_queue.h"
+#include "osi/include/properties.h"
+#include "osi/include/thread_scheduler.h"
+#include "stack/include/a2dp_jitter_buffer.h"
 #include "stack/include/bt_hdr.h"
 #include "types/raw_address.h"
 
 using bluetooth::common::MessageLoopThread;
-using LockGuard = std::lock_guard<std::mutex>;
+using LockGuard = std::lock_guard<PriorityInheritanceMutex>;
 using namespace bluetooth;
 
 /**
@@ -56,6 +60,14 @@ using namespace bluetooth;
 /* In case of A2DP Sink, we will delay start by 5 AVDTP Packets */
 #define MAX_A2DP_DELAYED_START_FRAME_COUNT 5
 
+/**
+ * When set, the received packets are played out at the rate of the decoder
+ * tick from an adaptive jitter buffer, and the lost audio is concealed, see
+ * btif_a2dp_sink_audio_playout().
+ */
+static const char kAdaptiveJitterBufferProperty[] =
+    "persist.bluetooth.a2dp_sink.adaptive_jitter_buffer";
+
 enum {
   BTIF_A2DP_SINK_STATE_OFF,
   BTIF_A2DP_SINK_STATE_STARTING_UP,
@@ -95,7 +107,19 @@ class BtifA2dpSinkControlBlock {
         channel_count(0),
         rx_focus_state(BTIF_A2DP_SINK_FOCUS_NOT_GRANTED),
         audio_track(nullptr),
-        decoder_interface(nullptr) {}
+        decoder_interface(nullptr),
+        adaptive_jitter_buffer(false),
+        decoded_us(0),
+        rx_queue_overflows(0) {
+    ResetJitterBuffer();
+  }
+
+  void ResetJitterBuffer() {
+    a2dp_jitter_buffer_reset(&jitter_buffer,
+                             BTIF_SINK_MEDIA_TIME_TICK_MS * 1000,
+                             MAX_INPUT_A2DP_FRAME_QUEUE_SZ - 1);
+    rx_queue_overflows = 0;
+  }
 
   void Reset() {
     if (audio_track != nullptr) {
@@ -112,6 +136,9 @@ class BtifA2dpSinkControlBlock {
     sample_rate = 0;
     channel_count = 0;
     decoder_interface = nullptr;
+    adaptive_jitter_buffer = false;
+    decoded_us = 0;
+    ResetJitterBuffer();
   }
 
   MessageLoopThread worker_thread;
@@ -124,10 +151,15 @@ class BtifA2dpSinkControlBlock {
   btif_a2dp_sink_focus_state_t rx_focus_state; /* audio focus state */
   void* audio_track;
   const tA2DP_DECODER_INTERFACE* decoder_interface;
+  tA2DP_JITTER_BUFFER jitter_buffer;
+  bool adaptive_jitter_buffer; /* playout from the jitter buffer when true */
+  uint64_t decoded_us;         /* decoded audio since the last reset */
+  size_t rx_queue_overflows;   /* packets dropped by a full rx_audio_queue */
 };
 
 // Mutex for below data structures.
-static std::mutex g_mutex;
+// Shared by the real time decoder thread and the btif and alarm threads
+static PriorityInheritanceMutex g_mutex;
 
 static BtifA2dpSinkControlBlock btif_a2dp_sink_cb("bt_a2dp_sink_worker_thread");
 
@@ -195,11 +227,6 @@ bool btif_a2dp_sink_init() {
   btif_a2dp_sink_cb.rx_audio_queue = fixed_queue_new(SIZE_MAX);
 
   /* Schedule the rest of the operations */
-  if (!btif_a2dp_sink_cb.worker_thread.EnableRealTimeScheduling()) {
-#if defined(__ANDROID__)
-    log::fatal("Failed to increase A2DP decoder thread priority");
-#endif
-  }
   btif_a2dp_sink_cb.worker_thread.DoInThread(
       FROM_HERE, base::BindOnce(btif_a2dp_sink_init_delayed));
   return true;
@@ -207,6 +234,12 @@ bool btif_a2dp_sink_init() {
 
 static void btif_a2dp_sink_init_delayed() {
   log::info("");
+  if (!thread_scheduler_apply_policy(
+          btif_a2dp_sink_cb.worker_thread.GetName().c_str())) {
+#if defined(__ANDROID__)
+    log::fatal("Failed to increase A2DP decoder thread priority");
+#endif
+  }
   btif_a2dp_sink_state = BTIF_A2DP_SINK_STATE_RUNNING;
 }
 
@@ -516,7 +549,17 @@ static void btif_a2dp_sink_audio_handle_start_decoding() {
             btif_decode_alarm_cb, nullptr);
 }
 
+// Must be called while locked.
+static uint32_t btif_a2dp_sink_audio_duration_us(uint32_t len) {
+  uint32_t bytes_per_frame =
+      btif_a2dp_sink_cb.channel_count * btif_a2dp_sink_cb.bits_per_sample / 8;
+  if (bytes_per_frame == 0 || btif_a2dp_sink_cb.sample_rate == 0) return 0;
+  return (uint64_t)(len / bytes_per_frame) * 1000000 /
+         btif_a2dp_sink_cb.sample_rate;
+}
+
 static void btif_a2dp_sink_on_decode_complete(uint8_t* data, uint32_t len) {
+  btif_a2dp_sink_cb.decoded_us += btif_a2dp_sink_audio_duration_us(len);
 #ifdef __ANDROID__
   BtifAvrcpAudioTrackWriteData(btif_a2dp_sink_cb.audio_track,
                                reinterpret_cast<void*>(data), len);
@@ -537,11 +580,52 @@ static void btif_a2dp_sink_handle_inc_media(BT_HDR* p_msg) {
   }
 }
 
+// Plays out one decoder tick of audio from the jitter buffer: the queued
+// packets are decoded until the tick has its audio, and the missing audio is
+// concealed by the decoder when the queue runs empty.
+// Must be called while locked.
+static void btif_a2dp_sink_audio_playout() {
+  tA2DP_JITTER_BUFFER* p_jitter_buffer = &btif_a2dp_sink_cb.jitter_buffer;
+  fixed_queue_t* rx_audio_queue = btif_a2dp_sink_cb.rx_audio_queue;
+
+  bool play = false;
+  size_t num_dropped = a2dp_jitter_buffer_on_tick(
+      p_jitter_buffer, fixed_queue_length(rx_audio_queue), &play);
+  while (num_dropped-- > 0) {
+    osi_free(fixed_queue_try_dequeue(rx_audio_queue));
+  }
+  if (!play) return;
+
+  while (a2dp_jitter_buffer_needs_audio(p_jitter_buffer)) {
+    uint64_t decoded_us = btif_a2dp_sink_cb.decoded_us;
+    BT_HDR* p_msg = (BT_HDR*)fixed_queue_try_dequeue(rx_audio_queue);
+    if (p_msg != nullptr) {
+      btif_a2dp_sink_handle_inc_media(p_msg);
+      osi_free(p_msg);
+      a2dp_jitter_buffer_on_decoded(
+          p_jitter_buffer, btif_a2dp_sink_cb.decoded_us - decoded_us);
+      continue;
+    }
+
+    if (!a2dp_jitter_buffer_on_underrun(p_jitter_buffer)) {
+      log::verbose("underrun, buffering");
+      break;
+    }
+    if (btif_a2dp_sink_cb.decoder_interface != nullptr &&
+        btif_a2dp_sink_cb.decoder_interface->decoder_conceal != nullptr) {
+      btif_a2dp_sink_cb.decoder_interface->decoder_conceal();
+    }
+    a2dp_jitter_buffer_on_concealed(p_jitter_buffer,
+                                    btif_a2dp_sink_cb.decoded_us - decoded_us);
+  }
+}
+
 static void btif_a2dp_sink_avk_handle_timer() {
   LockGuard lock(g_mutex);
 
   BT_HDR* p_msg;
-  if (fixed_queue_is_empty(btif_a2dp_sink_cb.rx_audio_queue)) {
+  if (!btif_a2dp_sink_cb.adaptive_jitter_buffer &&
+      fixed_queue_is_empty(btif_a2dp_sink_cb.rx_audio_queue)) {
     log::verbose("empty queue");
     return;
   }
@@ -554,6 +638,12 @@ static void btif_a2dp_sink_avk_handle_timer() {
   /* Play only in BTIF_A2DP_SINK_FOCUS_GRANTED case */
   if (btif_a2dp_sink_cb.rx_flush) {
     fixed_queue_flush(btif_a2dp_sink_cb.rx_audio_queue, osi_free);
+    a2dp_jitter_buffer_flush(&btif_a2dp_sink_cb.jitter_buffer);
+    return;
+  }
+
+  if (btif_a2dp_sink_cb.adaptive_jitter_buffer) {
+    btif_a2dp_sink_audio_playout();
     return;
   }
 
@@ -586,6 +676,7 @@ static void btif_a2dp_sink_audio_rx_flush_event() {
   LockGuard lock(g_mutex);
   // Flush all received encoded audio buffers
   fixed_queue_flush(btif_a2dp_sink_cb.rx_audio_queue, osi_free);
+  a2dp_jitter_buffer_flush(&btif_a2dp_sink_cb.jitter_buffer);
 }
 
 static void btif_a2dp_sink_decoder_update_event(
@@ -624,6 +715,10 @@ static void btif_a2dp_sink_decoder_update_event(
   btif_a2dp_sink_cb.rx_flush = false;
   log::verbose("reset to Sink role");
 
+  btif_a2dp_sink_cb.adaptive_jitter_buffer =
+      osi_property_get_bool(kAdaptiveJitterBufferProperty, false);
+  btif_a2dp_sink_cb.ResetJitterBuffer();
+
   bta_av_co_save_codec(p_buf->codec_info);
 
   btif_a2dp_sink_cb.decoder_interface =
@@ -670,18 +765,29 @@ uint8_t btif_a2dp_sink_enqueue_buf(BT_HDR* p_pkt) {
   p_msg->offset = 0;
   memcpy(p_msg->data, p_pkt->data + p_pkt->offset, p_pkt->len);
   fixed_queue_enqueue(btif_a2dp_sink_cb.rx_audio_queue, p_msg);
+  a2dp_jitter_buffer_on_arrival(
+      &btif_a2dp_sink_cb.jitter_buffer,
+      bluetooth::common::time_get_os_boottime_us(),
+      fixed_queue_length(btif_a2dp_sink_cb.rx_audio_queue));
 
   if (fixed_queue_length(btif_a2dp_sink_cb.rx_audio_queue) ==
       MAX_INPUT_A2DP_FRAME_QUEUE_SZ) {
     osi_free(fixed_queue_try_dequeue(btif_a2dp_sink_cb.rx_audio_queue));
+    btif_a2dp_sink_cb.rx_queue_overflows++;
     uint8_t ret = fixed_queue_length(btif_a2dp_sink_cb.rx_audio_queue);
     return ret;
   }
 
+  // The jitter buffer sizes the delayed start from the arrival jitter
+  size_t start_frame_count =
+      btif_a2dp_sink_cb.adaptive_jitter_buffer
+          ? a2dp_jitter_buffer_target_depth(&btif_a2dp_sink_cb.jitter_buffer)
+          : MAX_A2DP_DELAYED_START_FRAME_COUNT;
+
   // Avoid other checks if alarm has already been initialized.
   if (btif_a2dp_sink_cb.decode_alarm == nullptr &&
       fixed_queue_length(btif_a2dp_sink_cb.rx_audio_queue) >=
-          MAX_A2DP_DELAYED_START_FRAME_COUNT) {
+          start_frame_count) {
     log::verbose("Initiate decoding. Current focus state:{}",
                  btif_a2dp_sink_cb.rx_focus_state);
     if (btif_a2dp_sink_cb.rx_focus_state == BTIF_A2DP_SINK_FOCUS_GRANTED) {
@@ -706,8 +812,36 @@ void btif_a2dp_sink_audio_rx_flush_req() {
       FROM_HERE, base::BindOnce(btif_a2dp_sink_command_ready, p_buf));
 }
 
-void btif_a2dp_sink_debug_dump(int /* fd */) {
-  // Nothing to do
+void btif_a2dp_sink_debug_dump(int fd) {
+  LockGuard lock(g_mutex);
+  const tA2DP_JITTER_BUFFER* p_jitter_buffer =
+      &btif_a2dp_sink_cb.jitter_buffer;
+
+  dprintf(fd, "\nA2DP Sink State:\n");
+  dprintf(fd, "  Adaptive jitter buffer: %s\n",
+          btif_a2dp_sink_cb.adaptive_jitter_buffer ? "true" : "false");
+  dprintf(fd, "  Packets received                                : %zu\n",
+          p_jitter_buffer->packets_received);
+  dprintf(fd,
+          "  Arrival interval / jitter (ms)                  : %.2f / %.2f\n",
+          p_jitter_buffer->mean_interval_us / 1000.0,
+          p_jitter_buffer->jitter_us / 1000.0);
+  dprintf(fd,
+          "  Buffer depth in packets (current/target/max)    : %zu / %zu / "
+          "%zu\n",
+          fixed_queue_length(btif_a2dp_sink_cb.rx_audio_queue),
+          a2dp_jitter_buffer_target_depth(p_jitter_buffer),
+          p_jitter_buffer->max_queue_depth);
+  dprintf(fd, "  Underruns                                       : %zu\n",
+          p_jitter_buffer->underruns);
+  dprintf(fd,
+          "  Concealed frames (count/duration in ms)         : %zu / %llu\n",
+          p_jitter_buffer->concealed_frames,
+          (unsigned long long)p_jitter_buffer->concealed_us / 1000);
+  dprintf(fd,
+          "  Dropped packets (overflow/latency)              : %zu / %zu\n",
+          btif_a2dp_sink_cb.rx_queue_overflows,
+          p_jitter_buffer->dropped_packets);
 }
 
 void btif_a2dp_sink_set_focus_state_req(btif_a2dp_sink_focus_state_t state) {
@@ -731,6 +865,7 @@ static void btif_a2dp_sink_set_focus_state_event(
   btif_a2dp_sink_cb.rx_focus_state = state;
   if (btif_a2dp_sink_cb.rx_focus_state == BTIF_A2DP_SINK_FOCUS_NOT_GRANTED) {
     fixed_queue_flush(btif_a2dp_sink_cb.rx_audio_queue, osi_free);
+    a2dp_jitter_buffer_flush(&btif_a2dp_sink_cb.jitter_buffer);
     btif_a2dp_sink_cb.rx_flush = true;
   } else if (btif_a2dp_sink_cb.rx_focus_state == BTIF_A2DP_SINK_FOCUS_GRANTED) {
     btif_a2dp_sink_cb.rx_flush = false;
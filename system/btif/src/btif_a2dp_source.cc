@@ -32,8 +32,12 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <future>
+#include <memory>
+#include <vector>
 
+#include "audio/asrc/asrc_stage.h"
 #include "audio_a2dp_hw/include/audio_a2dp_hw.h"
 #include "audio_hal_interface/a2dp_encoding.h"
 #include "bta_av_ci.h"
@@ -46,14 +50,21 @@
 #include "common/metrics.h"
 #include "common/repeating_timer.h"
 #include "common/time_util.h"
+#include "hal/link_clocker.h"
 #include "include/check.h"
 #include "os/log.h"
+#include "os/trace.h"
 #include "osi/include/allocator.h"
 #include "osi/include/fixed_queue.h"
+#include "osi/include/properties.h"
+#include "osi/include/thread_scheduler.h"
 #include "osi/include/wakelock.h"
+#include "stack/include/a2dp_bitrate_controller.h"
 #include "stack/include/acl_api.h"
 #include "stack/include/acl_api_types.h"
 #include "stack/include/bt_hdr.h"
+#include "stack/include/btm_api.h"
+#include "stack/include/hcidefs.h"
 #include "types/raw_address.h"
 #include "udrv/include/uipc.h"
 
@@ -71,6 +82,20 @@ extern std::unique_ptr<tUIPC_STATE> a2dp_uipc;
  */
 #define MAX_OUTPUT_A2DP_FRAME_QUEUE_SZ (MAX_PCM_FRAME_NUM_PER_TICK * 2)
 
+/**
+ * When set, encoding is driven by the link taking the queued packets instead
+ * of the periodic media timer, see btif_a2dp_source_audio_handle_event().
+ */
+static const char kEventDrivenSchedulingProperty[] =
+    "persist.bluetooth.a2dp_source.event_driven_scheduling";
+
+/**
+ * When set, the audio read from the audio HAL is resampled to follow the
+ * clock of the link, recovered from the completed packets of the ACL link,
+ * see btif_a2dp_source_start_asrc().
+ */
+static const char kAsrcProperty[] = "persist.bluetooth.a2dp_source.asrc";
+
 class SchedulingStats {
  public:
   SchedulingStats() { Reset(); }
@@ -187,8 +212,14 @@ class BtifA2dpSource {
       : tx_audio_queue(nullptr),
         tx_flush(false),
         sw_audio_is_encoding(false),
+        media_event_streaming(false),
+        media_event_posted(false),
+        media_event_last_us(0),
+        media_link_last_us(0),
+        media_link_offset_us(0),
         encoder_interface(nullptr),
         encoder_interval_ms(0),
+        asrc_pcm_bytes_per_second(0),
         state_(kStateOff) {}
 
   void Reset() {
@@ -196,9 +227,16 @@ class BtifA2dpSource {
     tx_audio_queue = nullptr;
     tx_flush = false;
     media_alarm.CancelAndWait();
-    wakelock_release();
+    media_event_streaming = false;
+    media_event_last_us = 0;
+    media_link_last_us = 0;
+    media_link_offset_us = 0;
+    wakelock_release_for("a2dp_source");
     encoder_interface = nullptr;
     encoder_interval_ms = 0;
+    // Same order as btif_a2dp_source_stop_asrc()
+    asrc_packet_clock = nullptr;
+    asrc = nullptr;
     stats.Reset();
     accumulated_stats.Reset();
     state_ = kStateOff;
@@ -224,8 +262,18 @@ class BtifA2dpSource {
   bool tx_flush; /* Discards any outgoing data when true */
   bool sw_audio_is_encoding;
   RepeatingTimer media_alarm;
+  bool media_event_streaming; /* Streaming with event driven scheduling */
+  std::atomic<bool> media_event_posted; /* A link ready event is pending */
+  base::CancelableClosure media_event_task; /* Encoding once it is due */
+  uint64_t media_event_last_us;             /* Last event driven encoding */
+  uint64_t media_link_last_us;  /* Last encoding paced by the link clock */
+  double media_link_offset_us;  /* Link clock ahead of the local clock */
   const tA2DP_ENCODER_INTERFACE* encoder_interface;
   uint64_t encoder_interval_ms; /* Local copy of the encoder interval */
+  std::unique_ptr<bluetooth::audio::asrc::AsrcStage> asrc; /* Drift control */
+  std::shared_ptr<bluetooth::audio::asrc::PacketClock> asrc_packet_clock;
+  std::vector<uint8_t> asrc_read_buf;   /* Audio read from the audio HAL */
+  uint32_t asrc_pcm_bytes_per_second;   /* Rate of the resampled stream */
   BtifMediaStats stats;
   BtifMediaStats accumulated_stats;
 
@@ -267,6 +315,9 @@ static void btif_a2dp_source_audio_feeding_update_event(
     const btav_a2dp_codec_config_t& codec_audio_config);
 static bool btif_a2dp_source_audio_tx_flush_req(void);
 static void btif_a2dp_source_audio_handle_timer(void);
+static void btif_a2dp_source_audio_handle_event(void);
+static void btif_a2dp_source_start_asrc(void);
+static void btif_a2dp_source_stop_asrc(void);
 static uint32_t btif_a2dp_source_read_callback(uint8_t* p_buf, uint32_t len);
 static bool btif_a2dp_source_enqueue_callback(BT_HDR* p_buf, size_t frames_n,
                                               uint32_t bytes_read);
@@ -372,7 +423,9 @@ bool btif_a2dp_source_startup(void) {
 
 static void btif_a2dp_source_startup_delayed() {
   log::info("state={}", btif_a2dp_source_cb.StateStr());
-  if (!btif_a2dp_source_thread.EnableRealTimeScheduling()) {
+  osi_allocator_thread_cache_enable();
+  if (!thread_scheduler_apply_policy(
+          btif_a2dp_source_thread.GetName().c_str())) {
 #if defined(__ANDROID__)
     log::fatal("unable to enable real time scheduling");
 #endif
@@ -510,7 +563,10 @@ static void btif_a2dp_source_shutdown_delayed(
 
   // Stop the timer
   btif_a2dp_source_cb.media_alarm.CancelAndWait();
-  wakelock_release();
+  btif_a2dp_source_cb.media_event_task.Cancel();
+  btif_a2dp_source_cb.media_event_streaming = false;
+  btif_a2dp_source_stop_asrc();
+  wakelock_release_for("a2dp_source");
 
   if (bluetooth::audio::a2dp::is_hal_enabled()) {
     bluetooth::audio::a2dp::cleanup();
@@ -554,7 +610,8 @@ bool btif_a2dp_source_media_task_is_shutting_down(void) {
 
 // This runs on worker thread
 bool btif_a2dp_source_is_streaming(void) {
-  return btif_a2dp_source_cb.media_alarm.IsScheduled();
+  return btif_a2dp_source_cb.media_alarm.IsScheduled() ||
+         btif_a2dp_source_cb.media_event_streaming;
 }
 
 static void btif_a2dp_source_setup_codec(const RawAddress& peer_address) {
@@ -805,20 +862,32 @@ static void btif_a2dp_source_audio_tx_start_event(void) {
   /* Reset the media feeding state */
   CHECK(btif_a2dp_source_cb.encoder_interface != nullptr);
   btif_a2dp_source_cb.encoder_interface->feeding_reset();
+  btif_a2dp_source_start_asrc();
+  btif_a2dp_source_cb.media_link_last_us = 0;
+  btif_a2dp_source_cb.media_link_offset_us = 0;
 
+  bool event_driven =
+      osi_property_get_bool(kEventDrivenSchedulingProperty, false);
   log::verbose(
-      "starting timer {} ms",
+      "starting {} {} ms", event_driven ? "event driven encoding" : "timer",
       btif_a2dp_source_cb.encoder_interface->get_encoder_interval_ms());
 
   /* audio engine starting, reset tx suspended flag */
   btif_a2dp_source_cb.tx_flush = false;
 
-  wakelock_acquire();
-  btif_a2dp_source_cb.media_alarm.SchedulePeriodic(
-      btif_a2dp_source_thread.GetWeakPtr(), FROM_HERE,
-      base::BindRepeating(&btif_a2dp_source_audio_handle_timer),
-      std::chrono::milliseconds(
-          btif_a2dp_source_cb.encoder_interface->get_encoder_interval_ms()));
+  wakelock_acquire_for("a2dp_source");
+  if (event_driven) {
+    btif_a2dp_source_cb.media_event_streaming = true;
+    btif_a2dp_source_cb.media_event_last_us = 0;
+    btif_a2dp_source_thread.DoInThread(
+        FROM_HERE, base::BindOnce(&btif_a2dp_source_audio_handle_event));
+  } else {
+    btif_a2dp_source_cb.media_alarm.SchedulePeriodic(
+        btif_a2dp_source_thread.GetWeakPtr(), FROM_HERE,
+        base::BindRepeating(&btif_a2dp_source_audio_handle_timer),
+        std::chrono::milliseconds(
+            btif_a2dp_source_cb.encoder_interface->get_encoder_interval_ms()));
+  }
   btif_a2dp_source_cb.sw_audio_is_encoding = true;
 
   btif_a2dp_source_cb.stats.Reset();
@@ -864,7 +933,9 @@ static void btif_a2dp_source_audio_tx_stop_event(void) {
 
   /* Stop the timer first */
   btif_a2dp_source_cb.media_alarm.CancelAndWait();
-  wakelock_release();
+  btif_a2dp_source_cb.media_event_task.Cancel();
+  btif_a2dp_source_cb.media_event_streaming = false;
+  wakelock_release_for("a2dp_source");
 
   if (bluetooth::audio::a2dp::is_hal_enabled()) {
     bluetooth::audio::a2dp::ack_stream_suspended(A2DP_CTRL_ACK_SUCCESS);
@@ -895,8 +966,27 @@ static void btif_a2dp_source_audio_tx_stop_event(void) {
     btif_a2dp_source_cb.encoder_interface->feeding_reset();
 }
 
+/*
+ * With the ASRC, the audio is resampled to follow the clock of the link, and
+ * the encoder reads it at the rate the link completes the packets rather than
+ * at the rate of the local clock: otherwise, over long sessions, the drift
+ * between the clocks makes the TX queue grow until it is flushed. The time
+ * elapsed between two encodings is scaled by the rate of the link.
+ */
+static uint64_t btif_a2dp_source_link_timestamp_us(uint64_t timestamp_us) {
+  auto& cb = btif_a2dp_source_cb;
+  if (cb.media_link_last_us != 0) {
+    double link_rate = cb.asrc_packet_clock->GetLinkRate();
+    cb.media_link_offset_us +=
+        (timestamp_us - cb.media_link_last_us) * (link_rate - 1);
+  }
+  cb.media_link_last_us = timestamp_us;
+  return timestamp_us + static_cast<int64_t>(cb.media_link_offset_us);
+}
+
 static void btif_a2dp_source_audio_handle_timer(void) {
   if (btif_av_is_a2dp_offload_running()) return;
+  BT_TRACE_SCOPED("A2DP source encode");
 
 #ifndef TARGET_FLOSS
   uint64_t timestamp_us = bluetooth::common::time_get_os_boottime_us();
@@ -907,6 +997,9 @@ static void btif_a2dp_source_audio_handle_timer(void) {
 #endif
 
   log_tstamps_us("A2DP Source tx scheduling timer", timestamp_us);
+  if (btif_a2dp_source_cb.asrc_packet_clock != nullptr) {
+    timestamp_us = btif_a2dp_source_link_timestamp_us(timestamp_us);
+  }
 
   if (!btif_a2dp_source_is_streaming()) {
     log::error("ERROR Media task Scheduled after Suspend");
@@ -930,15 +1023,146 @@ static void btif_a2dp_source_audio_handle_timer(void) {
                           btif_a2dp_source_cb.encoder_interval_ms * 1000);
 }
 
-static uint32_t btif_a2dp_source_read_callback(uint8_t* p_buf, uint32_t len) {
-  uint32_t bytes_read = 0;
+static void btif_a2dp_source_audio_schedule_event(uint64_t delay_us) {
+  btif_a2dp_source_cb.media_event_task.Reset(
+      base::BindRepeating(&btif_a2dp_source_audio_handle_event));
+  btif_a2dp_source_thread.DoInThreadDelayed(
+      FROM_HERE, btif_a2dp_source_cb.media_event_task.callback(),
+      std::chrono::microseconds(delay_us));
+}
+
+/*
+ * With event driven scheduling, the next packets are encoded once the link
+ * has taken all the queued ones (see btif_a2dp_source_audio_readbuf()), so
+ * nothing wakes up the media task while the link is congested and the
+ * packets do not wait in the TX queue. Neither the audio HAL FMQ nor the
+ * UIPC socket signal when audio was written, hence the encoder interval
+ * tells when the next packet is due: when the link is ready earlier, the
+ * encoding is delayed until then.
+ */
+static void btif_a2dp_source_audio_handle_event(void) {
+  btif_a2dp_source_cb.media_event_posted = false;
+  if (!btif_a2dp_source_cb.media_event_streaming) return;
+
+  // Wait for the link to take the queued packets
+  if (!fixed_queue_is_empty(btif_a2dp_source_cb.tx_audio_queue)) return;
+
+  uint64_t interval_us = btif_a2dp_source_cb.encoder_interval_ms * 1000;
+  uint64_t now_us = bluetooth::common::time_get_os_boottime_us();
+  uint64_t due_us = btif_a2dp_source_cb.media_event_last_us + interval_us;
+  if (btif_a2dp_source_cb.media_event_last_us != 0 && now_us < due_us) {
+    btif_a2dp_source_audio_schedule_event(due_us - now_us);
+    return;
+  }
+
+  btif_a2dp_source_cb.media_event_last_us = now_us;
+  btif_a2dp_source_audio_handle_timer();
+
+  // Not enough audio for a packet yet, try again when the next one is due
+  if (fixed_queue_is_empty(btif_a2dp_source_cb.tx_audio_queue)) {
+    btif_a2dp_source_audio_schedule_event(interval_us);
+  }
+}
+
+/*
+ * The audio HAL and the link run from different clocks: without drift
+ * compensation, the audio accumulates in the pipeline or the link underruns
+ * over long sessions. The ASRC stage resamples the audio by encoder
+ * intervals, following the clock recovered from the Number Of Completed
+ * Packets events of the ACL link. A2DP packets carry a variable duration of
+ * audio, the packet clock converts the completed packets to intervals from
+ * the duration of the enqueued ones.
+ */
+static void btif_a2dp_source_start_asrc(void) {
+  btif_a2dp_source_stop_asrc();
+  if (!osi_property_get_bool(kAsrcProperty, false)) return;
 
+  A2dpCodecConfig* codec_config = bta_av_get_a2dp_current_codec();
+  uint8_t codec_info[AVDT_CODEC_SIZE];
+  if (codec_config == nullptr ||
+      !codec_config->copyOutOtaCodecConfig(codec_info)) {
+    log::warn("ASRC disabled: current codec is not set");
+    return;
+  }
+
+  int sample_rate = A2DP_GetTrackSampleRate(codec_info);
+  int bits_per_sample = A2DP_GetTrackBitsPerSample(codec_info);
+  int channel_count = A2DP_GetTrackChannelCount(codec_info);
+  int interval_us = btif_a2dp_source_cb.encoder_interval_ms * 1000;
+
+  // The resampler takes samples aligned on 16 or 32 bits
+  if (sample_rate <= 0 || channel_count <= 0 ||
+      (bits_per_sample != 16 && bits_per_sample != 32)) {
+    log::warn("ASRC disabled: unsupported PCM format {} Hz {} bits {} ch",
+              sample_rate, bits_per_sample, channel_count);
+    return;
+  }
+
+  uint16_t handle = BTM_GetHCIConnHandle(btif_av_source_active_peer(),
+                                         BT_TRANSPORT_BR_EDR);
+  if (handle == HCI_INVALID_HANDLE) {
+    log::warn("ASRC disabled: no ACL link");
+    return;
+  }
+
+  auto link_clock = std::make_shared<bluetooth::hal::AclNocpEvents>();
+  btif_a2dp_source_cb.asrc_packet_clock =
+      std::make_shared<bluetooth::audio::asrc::PacketClock>(link_clock,
+                                                            interval_us);
+  btif_a2dp_source_cb.asrc =
+      std::make_unique<bluetooth::audio::asrc::AsrcStage>(
+          btif_a2dp_source_cb.asrc_packet_clock, channel_count, sample_rate,
+          bits_per_sample, interval_us);
+  link_clock->Update(/*link_id*/ 0, handle);
+
+  btif_a2dp_source_cb.asrc_read_buf.resize(
+      btif_a2dp_source_cb.asrc->InputRemaining());
+  btif_a2dp_source_cb.asrc_pcm_bytes_per_second =
+      sample_rate * channel_count * (bits_per_sample / 8);
+
+  log::info("ASRC enabled: {} Hz {} bits {} ch, interval {} us, handle 0x{:x}",
+            sample_rate, bits_per_sample, channel_count, interval_us, handle);
+}
+
+static void btif_a2dp_source_stop_asrc(void) {
+  // The stage holds the last reference to the packet clock, which unbinds
+  // the link clock events before the clock recovery is destroyed.
+  btif_a2dp_source_cb.asrc_packet_clock = nullptr;
+  btif_a2dp_source_cb.asrc = nullptr;
+  btif_a2dp_source_cb.asrc_read_buf.clear();
+  btif_a2dp_source_cb.asrc_pcm_bytes_per_second = 0;
+}
+
+static uint32_t btif_a2dp_source_read_audio(uint8_t* p_buf, uint32_t len) {
   if (bluetooth::audio::a2dp::is_hal_enabled()) {
-    bytes_read = bluetooth::audio::a2dp::read(p_buf, len);
+    return bluetooth::audio::a2dp::read(p_buf, len);
   } else if (a2dp_uipc != nullptr) {
-    bytes_read = UIPC_Read(*a2dp_uipc, UIPC_CH_ID_AV_AUDIO, p_buf, len);
+    return UIPC_Read(*a2dp_uipc, UIPC_CH_ID_AV_AUDIO, p_buf, len);
+  }
+  return 0;
+}
+
+// Reads the resampled audio, without reading the audio HAL further than
+// needed to complete the resampling interval.
+static uint32_t btif_a2dp_source_read_asrc(uint8_t* p_buf, uint32_t len) {
+  auto& asrc = *btif_a2dp_source_cb.asrc;
+  auto& read_buf = btif_a2dp_source_cb.asrc_read_buf;
+
+  while (asrc.Available() < len) {
+    uint32_t bytes_read = btif_a2dp_source_read_audio(
+        read_buf.data(), std::min(asrc.InputRemaining(), read_buf.size()));
+    if (bytes_read == 0) break;
+    asrc.Write(read_buf.data(), bytes_read);
   }
 
+  return asrc.Read(p_buf, len);
+}
+
+static uint32_t btif_a2dp_source_read_callback(uint8_t* p_buf, uint32_t len) {
+  uint32_t bytes_read = btif_a2dp_source_cb.asrc != nullptr
+                            ? btif_a2dp_source_read_asrc(p_buf, len)
+                            : btif_a2dp_source_read_audio(p_buf, len);
+
   if (btif_a2dp_source_cb.sw_audio_is_encoding && bytes_read < len) {
     log::warn("UNDERFLOW: ONLY READ {} BYTES OUT OF {}", bytes_read, len);
     btif_a2dp_source_cb.stats.media_read_total_underflow_bytes +=
@@ -1009,6 +1233,8 @@ static bool btif_a2dp_source_enqueue_callback(BT_HDR* p_buf, size_t frames_n,
     log_a2dp_audio_overrun_event(
         btif_av_source_active_peer(), btif_a2dp_source_cb.encoder_interval_ms,
         drop_n, num_dropped_encoded_frames, num_dropped_encoded_bytes);
+    a2dp_bitrate_controller_report_dropped_packets(
+        a2dp_source_bitrate_controller(), drop_n);
 
     // Request additional debug info if we had to flush buffers
     RawAddress peer_bda = btif_av_source_active_peer();
@@ -1046,6 +1272,12 @@ static bool btif_a2dp_source_enqueue_callback(BT_HDR* p_buf, size_t frames_n,
 
   fixed_queue_enqueue(btif_a2dp_source_cb.tx_audio_queue, p_buf);
 
+  if (btif_a2dp_source_cb.asrc_packet_clock != nullptr && bytes_read > 0) {
+    btif_a2dp_source_cb.asrc_packet_clock->OnPacketQueued(
+        (uint64_t)bytes_read * 1000 * 1000 /
+        btif_a2dp_source_cb.asrc_pcm_bytes_per_second);
+  }
+
   return true;
 }
 
@@ -1056,6 +1288,7 @@ static void btif_a2dp_source_audio_tx_flush_event(void) {
 
   if (btif_a2dp_source_cb.encoder_interface != nullptr)
     btif_a2dp_source_cb.encoder_interface->feeding_flush();
+  if (btif_a2dp_source_cb.asrc != nullptr) btif_a2dp_source_cb.asrc->Flush();
 
   btif_a2dp_source_cb.stats.tx_queue_total_flushed_messages +=
       fixed_queue_length(btif_a2dp_source_cb.tx_audio_queue);
@@ -1088,6 +1321,14 @@ BT_HDR* btif_a2dp_source_audio_readbuf(void) {
     update_scheduling_stats(&btif_a2dp_source_cb.stats.tx_queue_dequeue_stats,
                             now_us,
                             btif_a2dp_source_cb.encoder_interval_ms * 1000);
+
+    // The link took the last queued packet, encode the next ones
+    if (btif_a2dp_source_cb.media_event_streaming &&
+        fixed_queue_is_empty(btif_a2dp_source_cb.tx_audio_queue) &&
+        !btif_a2dp_source_cb.media_event_posted.exchange(true)) {
+      btif_a2dp_source_thread.DoInThread(
+          FROM_HERE, base::BindOnce(&btif_a2dp_source_audio_handle_event));
+    }
   }
 
   return p_buf;
@@ -1151,6 +1392,10 @@ void btif_a2dp_source_debug_dump(int fd) {
   uint64_t ave_time_us;
 
   dprintf(fd, "\nA2DP State:\n");
+  dprintf(fd, "  Event driven scheduling: %s\n",
+          btif_a2dp_source_cb.media_event_streaming ? "true" : "false");
+  dprintf(fd, "  Link clock offset: %.0f us\n",
+          btif_a2dp_source_cb.media_link_offset_us);
   dprintf(fd, "  TxQueue:\n");
 
   dprintf(fd,
@@ -1407,6 +1652,15 @@ static void btm_read_failed_contact_counter_cb(void* data) {
   log::warn("device: {}, Failed Contact Counter: {}",
             ADDRESS_TO_LOGGABLE_CSTR(result->rem_bda),
             result->failed_contact_counter);
+
+  // The bitrate controller of the encoders lives on the worker thread
+  if (result->rem_bda == btif_av_source_active_peer()) {
+    btif_a2dp_source_thread.DoInThread(
+        FROM_HERE,
+        base::BindOnce(&a2dp_bitrate_controller_report_failed_contact_counter,
+                       a2dp_source_bitrate_controller(),
+                       result->failed_contact_counter));
+  }
 }
 
 static void btm_read_tx_power_cb(void* data) {
@@ -23,7 +23,9 @@
 #include <stdio.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <vector>
 
 #include "btif/include/stack_manager_t.h"
 #include "btif_bqr.h"
@@ -52,6 +54,8 @@ static std::unique_ptr<LeakyBondedQueue<BqrVseSubEvt>> kpBqrEventQueue(
     new LeakyBondedQueue<BqrVseSubEvt>(kBqrEventQueueSize));
 
 static uint16_t vendor_cap_supported_version;
+// Only accessed on the main thread
+static std::vector<LinkQualityObserver*> link_quality_observers;
 
 class BluetoothQualityReportInterfaceImpl;
 std::unique_ptr<BluetoothQualityReportInterface> bluetoothQualityReportInstance;
@@ -551,7 +555,18 @@ void AddLinkQualityEventToQueue(uint8_t length,
 
   p_bqr_event->ParseBqrLinkQualityEvt(length, p_link_quality_event);
 
+  if (p_bqr_event->bqr_link_quality_event_.bdaddr.IsEmpty()) {
+    tBTM_SEC_DEV_REC* dev = btm_find_dev_by_handle(
+        p_bqr_event->bqr_link_quality_event_.connection_handle);
+    if (dev != NULL) {
+      p_bqr_event->bqr_link_quality_event_.bdaddr = dev->RemoteAddress();
+    }
+  }
+
   log::warn("{}", *p_bqr_event);
+  for (LinkQualityObserver* observer : link_quality_observers) {
+    observer->OnLinkQualityEvent(p_bqr_event->bqr_link_quality_event_);
+  }
   GetInterfaceToProfiles()->events->invoke_link_quality_report_cb(
       bluetooth::common::time_get_os_boottime_ms(),
       p_bqr_event->bqr_link_quality_event_.quality_report_id,
@@ -597,14 +612,6 @@ void AddLinkQualityEventToQueue(uint8_t length,
 
     if (bqrItf != NULL) {
       bd_addr = p_bqr_event->bqr_link_quality_event_.bdaddr;
-      if (bd_addr.IsEmpty()) {
-        tBTM_SEC_DEV_REC* dev = btm_find_dev_by_handle(
-            p_bqr_event->bqr_link_quality_event_.connection_handle);
-        if (dev != NULL) {
-          bd_addr = dev->RemoteAddress();
-        }
-      }
-
       if (!bd_addr.IsEmpty()) {
         bqrItf->bqr_delivery_event(bd_addr, (uint8_t*)p_link_quality_event,
                                    length);
@@ -619,6 +626,22 @@ void AddLinkQualityEventToQueue(uint8_t length,
   kpBqrEventQueue->Enqueue(p_bqr_event.release());
 }
 
+void RegisterLinkQualityObserver(LinkQualityObserver* observer) {
+  if (std::find(link_quality_observers.begin(), link_quality_observers.end(),
+                observer) != link_quality_observers.end()) {
+    log::warn("Observer already registered");
+    return;
+  }
+  link_quality_observers.push_back(observer);
+}
+
+void UnregisterLinkQualityObserver(LinkQualityObserver* observer) {
+  link_quality_observers.erase(
+      std::remove(link_quality_observers.begin(), link_quality_observers.end(),
+                  observer),
+      link_quality_observers.end());
+}
+
 void DumpLmpLlMessage(uint8_t length, const uint8_t* p_lmp_ll_message_event) {
   std::unique_ptr<BqrVseSubEvt> p_bqr_event = std::make_unique<BqrVseSubEvt>();
 
@@ -689,6 +712,8 @@ int OpenBtSchedulingTraceLogFile() {
 
 void DebugDump(int fd) {
   dprintf(fd, "\nBT Quality Report Events: \n");
+  dprintf(fd, "Link quality observers: %zu\n",
+          link_quality_observers.size());
 
   if (kpBqrEventQueue->Empty()) {
     dprintf(fd, "Event queue is empty.\n");
@@ -322,6 +322,24 @@ std::vector<RawAddress> btif_config_get_paired_devices() {
   return result;
 }
 
+std::vector<RawAddress> btif_config_get_paired_devices_with_key(
+    const std::string& key) {
+  CHECK(bluetooth::shim::is_gd_stack_started_up());
+  std::vector<std::string> names =
+      bluetooth::shim::BtifConfigInterface::GetPersistentDevicesWithProperty(
+          key);
+
+  std::vector<RawAddress> result;
+  result.reserve(names.size());
+  for (const auto& name : names) {
+    RawAddress addr = {};
+    if (RawAddress::FromString(name, addr)) {
+      result.emplace_back(addr);
+    }
+  }
+  return result;
+}
+
 bool btif_config_remove(const std::string& section, const std::string& key) {
   CHECK(bluetooth::shim::is_gd_stack_started_up());
   return bluetooth::shim::BtifConfigInterface::RemoveProperty(section, key);
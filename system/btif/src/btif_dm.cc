@@ -49,6 +49,7 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <mutex>
 #include <optional>
 
@@ -336,130 +337,105 @@ bt_status_t btif_in_execute_service_request(tBTA_SERVICE_ID service_id,
   return GetInterfaceToProfiles()->toggleProfile(service_id, b_enable);
 }
 
-/**
- * Helper method to get asha advertising service data
- * @param inq_res {@code tBTA_DM_INQ_RES} inquiry result
- * @param asha_capability value will be updated as non-negative if found,
- * otherwise return -1
- * @param asha_truncated_hi_sync_id value will be updated if found, otherwise no
- * change
- */
-static void get_asha_service_data(const tBTA_DM_INQ_RES& inq_res,
-                                  int16_t& asha_capability,
-                                  uint32_t& asha_truncated_hi_sync_id) {
-  asha_capability = -1;
-  if (inq_res.p_eir) {
-    const RawAddress& bdaddr = inq_res.bd_addr;
-
-    // iterate through advertisement service data
-    const uint8_t* p_service_data = inq_res.p_eir;
-    uint8_t service_data_len = 0;
-    while ((p_service_data = AdvertiseDataParser::GetFieldByType(
-                p_service_data + service_data_len,
-                inq_res.eir_len - (p_service_data - inq_res.p_eir) -
-                    service_data_len,
-                BTM_BLE_AD_TYPE_SERVICE_DATA_TYPE, &service_data_len))) {
-      if (service_data_len < 2) {
-        continue;
-      }
-      uint16_t uuid;
-      const uint8_t* p_uuid = p_service_data;
-      STREAM_TO_UINT16(uuid, p_uuid);
-
-      if (uuid == 0xfdf0 /* ASHA service*/) {
-        log::info("ASHA found in {}", ADDRESS_TO_LOGGABLE_CSTR(bdaddr));
-
-        // ASHA advertisement service data length should be at least 8
-        if (service_data_len < 8) {
-          log::warn("ASHA device service_data_len too short");
-        } else {
-          // It is intended to save ASHA capability byte to int16_t
-          asha_capability = p_service_data[3];
-          log::info("asha_capability: {}", asha_capability);
-
-          const uint8_t* p_truncated_hisyncid = &(p_service_data[4]);
-          STREAM_TO_UINT32(asha_truncated_hi_sync_id, p_truncated_hisyncid);
-        }
-        break;
-      }
-    }
-  }
-}
+/* Fields of interest in the EIR or advertising data of an inquiry result */
+typedef struct {
+  /* Complete local name if present, shortened local name otherwise */
+  const uint8_t* p_name;
+  uint8_t name_len;
+  bool has_appearance;
+  uint16_t appearance;
+  /* Non-negative if ASHA capability was found */
+  int16_t asha_capability;
+  /* ASHA truncated HiSyncId, valid if asha_capability is non-negative */
+  uint32_t asha_truncated_hi_sync_id;
+} tBTIF_DM_EIR_FIELDS;
 
 /*******************************************************************************
  *
- * Function         check_eir_remote_name
+ * Function         parse_eir_fields
  *
- * Description      Check if remote name is in the EIR data
+ * Description      Extract the remote name, appearance and ASHA service data
+ *                  from the EIR data in a single pass. A device is reported
+ *                  many times per discovery, each field used to be looked up
+ *                  separately.
  *
- * Returns          true if remote name found
- *                  Populate p_remote_name, if provided and remote name found
+ * Returns          void
  *
  ******************************************************************************/
-static bool check_eir_remote_name(tBTA_DM_SEARCH* p_search_data,
-                                  uint8_t* p_remote_name,
-                                  uint8_t* p_remote_name_len) {
-  const uint8_t* p_eir_remote_name = NULL;
-  uint8_t remote_name_len = 0;
-
-  /* Check EIR for remote name and services */
-  if (p_search_data->inq_res.p_eir) {
-    p_eir_remote_name = AdvertiseDataParser::GetFieldByType(
-        p_search_data->inq_res.p_eir, p_search_data->inq_res.eir_len,
-        HCI_EIR_COMPLETE_LOCAL_NAME_TYPE, &remote_name_len);
-    if (!p_eir_remote_name) {
-      p_eir_remote_name = AdvertiseDataParser::GetFieldByType(
-          p_search_data->inq_res.p_eir, p_search_data->inq_res.eir_len,
-          HCI_EIR_SHORTENED_LOCAL_NAME_TYPE, &remote_name_len);
-    }
+static void parse_eir_fields(const tBTA_DM_INQ_RES& inq_res,
+                             tBTIF_DM_EIR_FIELDS* p_fields) {
+  *p_fields = {};
+  p_fields->asha_capability = -1;
+  if (!inq_res.p_eir) return;
+
+  const uint8_t* p_eir = inq_res.p_eir;
+  size_t eir_len = inq_res.eir_len;
+  bool complete_name_found = false;
+  bool appearance_checked = false;
+  bool asha_checked = false;
+  size_t position = 0;
+  /* Same walk as AdvertiseDataParser::GetFieldByType() */
+  while (position != eir_len) {
+    uint8_t len = p_eir[position];
+    if (len == 0) break;
+    if (position + len >= eir_len) break;
+
+    uint8_t type = p_eir[position + 1];
+    const uint8_t* p_data = p_eir + position + 2;
+    uint8_t data_len = len - 1;
+    position += len + 1;
+
+    switch (type) {
+      case HCI_EIR_COMPLETE_LOCAL_NAME_TYPE:
+        if (complete_name_found) break;
+        complete_name_found = true;
+        p_fields->p_name = p_data;
+        p_fields->name_len = std::min<uint8_t>(data_len, BD_NAME_LEN);
+        break;
 
-    if (p_eir_remote_name) {
-      if (remote_name_len > BD_NAME_LEN) remote_name_len = BD_NAME_LEN;
+      case HCI_EIR_SHORTENED_LOCAL_NAME_TYPE:
+        if (p_fields->p_name != nullptr) break;
+        p_fields->p_name = p_data;
+        p_fields->name_len = std::min<uint8_t>(data_len, BD_NAME_LEN);
+        break;
 
-      if (p_remote_name && p_remote_name_len) {
-        memcpy(p_remote_name, p_eir_remote_name, remote_name_len);
-        *(p_remote_name + remote_name_len) = 0;
-        *p_remote_name_len = remote_name_len;
-      }
+      case HCI_EIR_APPEARANCE_TYPE:
+        if (appearance_checked) break;
+        appearance_checked = true;
+        if (data_len >= 2) {
+          p_fields->has_appearance = true;
+          p_fields->appearance = *((uint16_t*)p_data);
+        }
+        break;
 
-      return true;
-    }
-  }
+      case BTM_BLE_AD_TYPE_SERVICE_DATA_TYPE: {
+        if (asha_checked || data_len < 2) break;
+        uint16_t uuid;
+        const uint8_t* p_uuid = p_data;
+        STREAM_TO_UINT16(uuid, p_uuid);
+        if (uuid != 0xfdf0 /* ASHA service*/) break;
 
-  return false;
-}
+        asha_checked = true;
+        log::info("ASHA found in {}", ADDRESS_TO_LOGGABLE_CSTR(inq_res.bd_addr));
 
-/*******************************************************************************
- *
- * Function         check_eir_appearance
- *
- * Description      Check if appearance is in the EIR data
- *
- * Returns          true if appearance found
- *                  Populate p_appearance, if provided and appearance found
- *
- ******************************************************************************/
-static bool check_eir_appearance(tBTA_DM_SEARCH* p_search_data,
-                                 uint16_t* p_appearance) {
-  const uint8_t* p_eir_appearance = NULL;
-  uint8_t appearance_len = 0;
-
-  /* Check EIR for remote name and services */
-  if (p_search_data->inq_res.p_eir) {
-    p_eir_appearance = AdvertiseDataParser::GetFieldByType(
-        p_search_data->inq_res.p_eir, p_search_data->inq_res.eir_len,
-        HCI_EIR_APPEARANCE_TYPE, &appearance_len);
-
-    if (p_eir_appearance && appearance_len >= 2) {
-      if (p_appearance) {
-        *p_appearance = *((uint16_t*)p_eir_appearance);
-      }
+        // ASHA advertisement service data length should be at least 8
+        if (data_len < 8) {
+          log::warn("ASHA device service_data_len too short");
+        } else {
+          // It is intended to save ASHA capability byte to int16_t
+          p_fields->asha_capability = p_data[3];
+          log::info("asha_capability: {}", p_fields->asha_capability);
 
-      return true;
+          const uint8_t* p_truncated_hisyncid = &(p_data[4]);
+          STREAM_TO_UINT32(p_fields->asha_truncated_hi_sync_id,
+                           p_truncated_hisyncid);
+        }
+      } break;
+
+      default:
+        break;
     }
   }
-
-  return false;
 }
 
 /*******************************************************************************
@@ -1502,10 +1478,12 @@ static void btif_dm_search_devices_evt(tBTA_DM_SEARCH_EVT event,
       uint8_t remote_name_len;
       uint8_t num_uuids = 0, max_num_uuid = 32;
       uint8_t uuid_list[32 * Uuid::kNumBytes16];
+      tBTIF_DM_EIR_FIELDS eir_fields;
 
+      parse_eir_fields(p_search_data->inq_res, &eir_fields);
       if (p_search_data->inq_res.inq_result_type != BT_DEVICE_TYPE_BLE) {
         p_search_data->inq_res.remt_name_not_required =
-            check_eir_remote_name(p_search_data, NULL, NULL);
+            eir_fields.p_name != nullptr;
       }
       RawAddress& bdaddr = p_search_data->inq_res.bd_addr;
 
@@ -1514,8 +1492,13 @@ static void btif_dm_search_devices_evt(tBTA_DM_SEARCH_EVT event,
                    p_search_data->inq_res.device_type);
       bdname.name[0] = 0;
 
-      if (!check_eir_remote_name(p_search_data, bdname.name, &remote_name_len))
+      if (eir_fields.p_name != nullptr) {
+        remote_name_len = eir_fields.name_len;
+        memcpy(bdname.name, eir_fields.p_name, remote_name_len);
+        bdname.name[remote_name_len] = 0;
+      } else {
         check_cached_remote_name(p_search_data, bdname.name, &remote_name_len);
+      }
 
       /* Check EIR for services */
       if (p_search_data->inq_res.p_eir) {
@@ -1598,23 +1581,16 @@ static void btif_dm_search_devices_evt(tBTA_DM_SEARCH_EVT event,
         // The default negative value means ASHA capability not found.
         // A non-negative value represents ASHA capability information is valid.
         // Because ASHA's capability is 1 byte, so int16_t is large enough.
-        int16_t asha_capability = -1;
-
-        // contains ASHA truncated HiSyncId if asha_capability is non-negative
-        uint32_t asha_truncated_hi_sync_id = 0;
-
-        get_asha_service_data(p_search_data->inq_res, asha_capability,
-                              asha_truncated_hi_sync_id);
-
         BTIF_STORAGE_FILL_PROPERTY(&properties[num_properties],
                                    BT_PROPERTY_REMOTE_ASHA_CAPABILITY,
-                                   sizeof(int16_t), &asha_capability);
+                                   sizeof(int16_t),
+                                   &eir_fields.asha_capability);
         num_properties++;
 
         BTIF_STORAGE_FILL_PROPERTY(&properties[num_properties],
                                    BT_PROPERTY_REMOTE_ASHA_TRUNCATED_HISYNCID,
                                    sizeof(uint32_t),
-                                   &asha_truncated_hi_sync_id);
+                                   &eir_fields.asha_truncated_hi_sync_id);
         num_properties++;
 
         // Floss expects that EIR uuids are immediately reported when the
@@ -1660,11 +1636,11 @@ static void btif_dm_search_devices_evt(tBTA_DM_SEARCH_EVT event,
         }
 
         // Floss needs appearance for metrics purposes
-        uint16_t appearance = 0;
-        if (check_eir_appearance(p_search_data, &appearance)) {
+        if (eir_fields.has_appearance) {
           BTIF_STORAGE_FILL_PROPERTY(&properties[num_properties],
-                                     BT_PROPERTY_APPEARANCE, sizeof(appearance),
-                                     &appearance);
+                                     BT_PROPERTY_APPEARANCE,
+                                     sizeof(eir_fields.appearance),
+                                     &eir_fields.appearance);
           num_properties++;
         }
 
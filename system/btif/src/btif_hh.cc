@@ -2002,6 +2002,19 @@ const bthh_interface_t* btif_hh_get_interface() {
   return &bthhInterface;
 }
 
+static std::string btif_hh_histogram_text(const uint32_t* histogram) {
+  std::string text;
+  for (unsigned i = 0; i < BTIF_HH_HISTOGRAM_BUCKETS - 1; i++) {
+    text += base::StringPrintf(" <%uus:%u", BTIF_HH_HISTOGRAM_BASE_US << i,
+                               histogram[i]);
+  }
+  text += base::StringPrintf(
+      " >=%uus:%u",
+      BTIF_HH_HISTOGRAM_BASE_US << (BTIF_HH_HISTOGRAM_BUCKETS - 2),
+      histogram[BTIF_HH_HISTOGRAM_BUCKETS - 1]);
+  return text;
+}
+
 #define DUMPSYS_TAG "shim::legacy::hid"
 void DumpsysHid(int fd) {
   LOG_DUMPSYS_TITLE(fd, DUMPSYS_TAG);
@@ -2018,6 +2031,16 @@ void DumpsysHid(int fd) {
                   bthh_connection_state_text(p_dev->dev_status).c_str(),
                   (p_dev->ready_for_data) ? ("T") : ("F"),
                   static_cast<int>(p_dev->hh_poll_thread_id));
+      const btif_hh_input_stats_t* stats = &p_dev->input_stats;
+      if (stats->num_reports > 0) {
+        LOG_DUMPSYS(fd, "    input reports:%u write_errors:%u max_write:%uus",
+                    stats->num_reports, stats->num_write_errors,
+                    static_cast<unsigned>(stats->max_write_us));
+        LOG_DUMPSYS(fd, "    report interval:%s",
+                    btif_hh_histogram_text(stats->interval_histogram).c_str());
+        LOG_DUMPSYS(fd, "    receive to uhid write:%s",
+                    btif_hh_histogram_text(stats->write_histogram).c_str());
+      }
     }
   }
   for (unsigned i = 0; i < BTIF_HH_MAX_ADDED_DEV; i++) {
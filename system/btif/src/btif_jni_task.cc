@@ -21,13 +21,20 @@
 #include <base/logging.h>
 #include <base/threading/platform_thread.h>
 #include <bluetooth/log.h>
+#include <stdio.h>
 
+#include <atomic>
 #include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "common/message_loop_thread.h"
 #include "include/hardware/bluetooth.h"
 #include "osi/include/allocator.h"
+#include "osi/include/thread_scheduler.h"
 #include "stack/include/bt_types.h"
 
 using base::PlatformThread;
@@ -35,9 +42,69 @@ using namespace bluetooth;
 
 static bluetooth::common::MessageLoopThread jni_thread("bt_jni_thread");
 
-void jni_thread_startup() { jni_thread.StartUp(); }
+namespace {
 
-void jni_thread_shutdown() { jni_thread.ShutDown(); }
+// Tasks posted with do_in_jni_thread_urgent(), run ahead of the other queued
+// tasks
+std::deque<base::OnceClosure> urgent_tasks;
+// Latest task posted with do_in_jni_thread_coalesced() for each key that is
+// still waiting to run
+std::unordered_map<std::string, base::OnceClosure> coalesced_tasks;
+std::mutex jni_queue_mutex;
+
+struct {
+  std::atomic<size_t> backlog{0};
+  std::atomic<size_t> max_backlog{0};
+  std::atomic<uint64_t> posted{0};
+  std::atomic<uint64_t> coalesced{0};
+  std::atomic<uint64_t> urgent{0};
+} jni_queue_stats;
+
+void run_urgent_tasks() {
+  std::deque<base::OnceClosure> tasks;
+  {
+    std::lock_guard<std::mutex> lock(jni_queue_mutex);
+    tasks.swap(urgent_tasks);
+  }
+  for (auto& task : tasks) {
+    std::move(task).Run();
+  }
+}
+
+void run_task(base::OnceClosure task) {
+  jni_queue_stats.backlog--;
+  run_urgent_tasks();
+  std::move(task).Run();
+}
+
+void run_coalesced_task(std::string key) {
+  base::OnceClosure task;
+  {
+    std::lock_guard<std::mutex> lock(jni_queue_mutex);
+    auto node = coalesced_tasks.extract(key);
+    if (node.empty()) return;
+    task = std::move(node.mapped());
+  }
+  std::move(task).Run();
+}
+
+}  // namespace
+
+void jni_thread_startup() {
+  jni_thread.StartUp();
+  jni_thread.DoInThread(FROM_HERE, base::BindOnce([]() {
+    thread_scheduler_apply_policy(jni_thread.GetName().c_str());
+  }));
+}
+
+void jni_thread_shutdown() {
+  jni_thread.ShutDown();
+
+  std::lock_guard<std::mutex> lock(jni_queue_mutex);
+  urgent_tasks.clear();
+  coalesced_tasks.clear();
+  jni_queue_stats.backlog = 0;
+}
 
 /*******************************************************************************
  *
@@ -102,10 +169,20 @@ bt_status_t btif_transfer_context(tBTIF_CBACK* p_cback, uint16_t event,
  **/
 bt_status_t do_in_jni_thread(const base::Location& from_here,
                              base::OnceClosure task) {
-  if (!jni_thread.DoInThread(from_here, std::move(task))) {
+  size_t backlog = ++jni_queue_stats.backlog;
+  if (!jni_thread.DoInThread(from_here,
+                             base::BindOnce(run_task, std::move(task)))) {
+    jni_queue_stats.backlog--;
     log::error("Post task to task runner failed!");
     return BT_STATUS_FAIL;
   }
+
+  jni_queue_stats.posted++;
+  size_t max_backlog = jni_queue_stats.max_backlog;
+  while (backlog > max_backlog &&
+         !jni_queue_stats.max_backlog.compare_exchange_weak(max_backlog,
+                                                            backlog)) {
+  }
   return BT_STATUS_SUCCESS;
 }
 
@@ -113,6 +190,62 @@ bt_status_t do_in_jni_thread(base::OnceClosure task) {
   return do_in_jni_thread(FROM_HERE, std::move(task));
 }
 
+/**
+ * This function posts a task that only needs to run if no more recent task
+ * was posted with the same key, e.g. the latest reading of a value for a
+ * device. A pending task with the same key is replaced and keeps its place in
+ * the queue.
+ **/
+bt_status_t do_in_jni_thread_coalesced(const base::Location& from_here,
+                                       std::string key,
+                                       base::OnceClosure task) {
+  {
+    std::lock_guard<std::mutex> lock(jni_queue_mutex);
+    auto it = coalesced_tasks.find(key);
+    if (it != coalesced_tasks.end()) {
+      it->second = std::move(task);
+      jni_queue_stats.coalesced++;
+      return BT_STATUS_SUCCESS;
+    }
+    coalesced_tasks.emplace(key, std::move(task));
+  }
+
+  bt_status_t status =
+      do_in_jni_thread(from_here, base::BindOnce(run_coalesced_task, key));
+  if (status != BT_STATUS_SUCCESS) {
+    std::lock_guard<std::mutex> lock(jni_queue_mutex);
+    coalesced_tasks.erase(key);
+  }
+  return status;
+}
+
+/**
+ * This function posts a task that runs before the tasks already waiting in
+ * the JNI message loop. It is meant for time sensitive events that do not
+ * need to be ordered with the other callbacks.
+ **/
+bt_status_t do_in_jni_thread_urgent(const base::Location& from_here,
+                                    base::OnceClosure task) {
+  {
+    std::lock_guard<std::mutex> lock(jni_queue_mutex);
+    urgent_tasks.push_back(std::move(task));
+  }
+  jni_queue_stats.urgent++;
+  // Runs the task if the queue is empty, otherwise the next task to run picks
+  // it up first.
+  return do_in_jni_thread(from_here, base::BindOnce(run_urgent_tasks));
+}
+
+void jni_thread_dump(int fd) {
+  dprintf(fd, "\nJNI thread queue:\n");
+  dprintf(fd, "  backlog: %zu (max %zu)\n", jni_queue_stats.backlog.load(),
+          jni_queue_stats.max_backlog.load());
+  dprintf(fd, "  posted: %llu coalesced: %llu urgent: %llu\n",
+          (unsigned long long)jni_queue_stats.posted.load(),
+          (unsigned long long)jni_queue_stats.coalesced.load(),
+          (unsigned long long)jni_queue_stats.urgent.load());
+}
+
 bool is_on_jni_thread() {
   return jni_thread.GetThreadId() == PlatformThread::CurrentId();
 }
@@ -25,6 +25,8 @@
 #include <hardware/bluetooth.h>
 
 #include <map>
+#include <utility>
+#include <vector>
 
 #include "btif_common.h"
 #include "btif_storage.h"
@@ -109,6 +111,61 @@ class BluetoothKeystoreInterfaceImpl
     return decryptedString;
   }
 
+  bool set_encrypt_keys_or_remove_keys(
+      std::vector<std::pair<std::string, std::string>> keys) override {
+    log::verbose("{} keys", keys.size());
+
+    if (!callbacks) {
+      log::warn("callback isn't ready. {} keys", keys.size());
+      return false;
+    }
+
+    // Save the values into a map.
+    for (const auto& [prefix, decryptedString] : keys) {
+      key_map[prefix] = decryptedString;
+    }
+
+    do_in_jni_thread(base::BindOnce(
+        &bluetooth::bluetooth_keystore::BluetoothKeystoreCallbacks::
+            set_encrypt_keys_or_remove_keys,
+        base::Unretained(callbacks), std::move(keys)));
+    return true;
+  }
+
+  std::vector<std::string> get_keys(
+      std::vector<std::string> prefixes) override {
+    log::verbose("{} keys", prefixes.size());
+
+    if (!callbacks) {
+      log::warn("callback isn't ready. {} keys", prefixes.size());
+      return std::vector<std::string>(prefixes.size());
+    }
+
+    // Only the keys not found in the map are fetched, with a single callback.
+    std::vector<std::string> missing_prefixes;
+    for (const auto& prefix : prefixes) {
+      if (key_map.find(prefix) == key_map.end()) {
+        missing_prefixes.push_back(prefix);
+      }
+    }
+    if (!missing_prefixes.empty()) {
+      std::vector<std::string> decryptedStrings =
+          callbacks->get_keys(missing_prefixes);
+      decryptedStrings.resize(missing_prefixes.size());
+      for (size_t i = 0; i < missing_prefixes.size(); i++) {
+        key_map[missing_prefixes[i]] = std::move(decryptedStrings[i]);
+      }
+      log::verbose("get {} keys from bluetoothkeystore.",
+                   missing_prefixes.size());
+    }
+
+    std::vector<std::string> keys;
+    for (const auto& prefix : prefixes) {
+      keys.push_back(key_map[prefix]);
+    }
+    return keys;
+  }
+
   void clear_map() override {
     log::verbose("");
 
@@ -36,12 +36,15 @@
 #include <linux/if_ether.h>
 #include <linux/if_tun.h>
 #include <net/if.h>
-#include <poll.h>
+#include <stdio.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "bta/include/bta_pan_api.h"
 #include "btif/include/btif_common.h"
+#include "btif/include/btif_pan.h"
 #include "btif/include/btif_pan_internal.h"
 #include "btif/include/btif_sock_thread.h"
 #include "device/include/controller.h"
@@ -398,18 +401,24 @@ int btpan_tap_send(int tap_fd, const RawAddress& src, const RawAddress& dst,
     eth_hdr.h_dest = dst;
     eth_hdr.h_src = src;
     eth_hdr.h_proto = htons(proto);
-    char packet[TAP_MAX_PKT_WRITE_LEN + sizeof(tETH_HDR)];
-    memcpy(packet, &eth_hdr, sizeof(tETH_HDR));
     if (len > TAP_MAX_PKT_WRITE_LEN) {
       log::error("btpan_tap_send eth packet size:{} is exceeded limit!", len);
       return -1;
     }
-    memcpy(packet + sizeof(tETH_HDR), buf, len);
 
-    /* Send data to network interface */
+    /* Send data to network interface, gathering the header and the payload
+     * instead of copying both into a bounce buffer */
+    struct iovec iov[2] = {
+        {.iov_base = &eth_hdr, .iov_len = sizeof(tETH_HDR)},
+        {.iov_base = const_cast<char*>(buf), .iov_len = len},
+    };
     ssize_t ret;
-    OSI_NO_INTR(ret = write(tap_fd, packet, len + sizeof(tETH_HDR)));
+    OSI_NO_INTR(ret = writev(tap_fd, iov, 2));
     log::verbose("ret:{}", ret);
+    if (ret > 0) {
+      btpan_cb.stats.tap_tx_frames++;
+      btpan_cb.stats.tap_tx_bytes += ret;
+    }
     return (int)ret;
   }
   return -1;
@@ -641,50 +650,61 @@ static void bta_pan_callback(tBTA_PAN_EVT event, tBTA_PAN* p_data) {
                         sizeof(tBTA_PAN), NULL);
 }
 
-#define IS_EXCEPTION(e) ((e) & (POLLHUP | POLLRDHUP | POLLERR | POLLNVAL))
-static void btu_exec_tap_fd_read(int fd) {
-  struct pollfd ufd;
+static uint64_t btpan_thread_cpu_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
 
+static void btu_exec_tap_fd_read(int fd) {
   if (fd == INVALID_FD || fd != btpan_cb.tap_fd) return;
 
+  uint64_t start_cpu_us = btpan_thread_cpu_us();
+  btpan_cb.stats.tap_rx_wakeups++;
+
   // Don't occupy BTU context too long, avoid buffer overruns and
   // give other profiles a chance to run by limiting the amount of memory
   // PAN can use.
   for (int i = 0; i < PAN_BUF_MAX && btif_is_enabled() && btpan_cb.flow; i++) {
-    BT_HDR* buffer = (BT_HDR*)osi_malloc(PAN_BUF_SIZE);
-    buffer->offset = PAN_MINIMUM_OFFSET;
-    buffer->len = PAN_BUF_SIZE - sizeof(BT_HDR) - buffer->offset;
-
-    uint8_t* packet = (uint8_t*)buffer + sizeof(BT_HDR) + buffer->offset;
-
     // If we don't have an undelivered packet left over, pull one from the TAP
     // driver.
     // We save it in the congest_packet right away in case we can't deliver it
     // in this
     // attempt.
+    // The TAP fd is non-blocking, so the read itself tells when the driver
+    // queue is drained and no extra poll is needed per frame.
     if (!btpan_cb.congest_packet_size) {
       ssize_t ret;
       OSI_NO_INTR(ret = read(fd, btpan_cb.congest_packet,
                              sizeof(btpan_cb.congest_packet)));
+      if (ret == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
       switch (ret) {
         case -1:
           log::error("unable to read from driver: {}", strerror(errno));
-          osi_free(buffer);
+          btpan_cb.stats.tap_rx_cpu_us += btpan_thread_cpu_us() - start_cpu_us;
           // add fd back to monitor thread to try it again later
           btsock_thread_add_fd(pan_pth, fd, 0, SOCK_THREAD_FD_RD, 0);
           return;
         case 0:
           log::warn("end of file reached.");
-          osi_free(buffer);
+          btpan_cb.stats.tap_rx_cpu_us += btpan_thread_cpu_us() - start_cpu_us;
           // add fd back to monitor thread to process the exception
           btsock_thread_add_fd(pan_pth, fd, 0, SOCK_THREAD_FD_RD, 0);
           return;
         default:
           btpan_cb.congest_packet_size = ret;
+          btpan_cb.stats.tap_rx_frames++;
+          btpan_cb.stats.tap_rx_bytes += ret;
           break;
       }
     }
 
+    BT_HDR* buffer = (BT_HDR*)osi_malloc(PAN_BUF_SIZE);
+    buffer->offset = PAN_MINIMUM_OFFSET;
+    buffer->len = PAN_BUF_SIZE - sizeof(BT_HDR) - buffer->offset;
+
+    uint8_t* packet = (uint8_t*)buffer + sizeof(BT_HDR) + buffer->offset;
+
     memcpy(packet, btpan_cb.congest_packet,
            MIN(btpan_cb.congest_packet_size, buffer->len));
     buffer->len = MIN(btpan_cb.congest_packet_size, buffer->len);
@@ -697,33 +717,49 @@ static void btu_exec_tap_fd_read(int fd) {
       tETH_HDR hdr;
       memcpy(&hdr, packet, sizeof(tETH_HDR));
 
-      // Skip the ethernet header.
+      // Skip the ethernet header. The BNEP header is then built in the
+      // headroom left in front of the payload, without moving the payload.
       buffer->len -= sizeof(tETH_HDR);
       buffer->offset += sizeof(tETH_HDR);
-      if (forward_bnep(&hdr, buffer) != FORWARD_CONGEST)
+      if (forward_bnep(&hdr, buffer) != FORWARD_CONGEST) {
         btpan_cb.congest_packet_size = 0;
+      } else {
+        btpan_cb.stats.tap_rx_congested++;
+      }
     } else {
       log::warn("dropping packet of length {}", buffer->len);
       btpan_cb.congest_packet_size = 0;
       osi_free(buffer);
     }
-
-    // Bail out of the loop if reading from the TAP fd would block.
-    ufd.fd = fd;
-    ufd.events = POLLIN;
-    ufd.revents = 0;
-
-    int ret;
-    OSI_NO_INTR(ret = poll(&ufd, 1, 0));
-    if (ret <= 0 || IS_EXCEPTION(ufd.revents)) break;
   }
 
+  btpan_cb.stats.tap_rx_cpu_us += btpan_thread_cpu_us() - start_cpu_us;
+
   if (btpan_cb.flow) {
     // add fd back to monitor thread when the flow is on
     btsock_thread_add_fd(pan_pth, fd, 0, SOCK_THREAD_FD_RD, 0);
   }
 }
 
+void btif_debug_pan_dump(int fd) {
+  const btpan_stats_t& stats = btpan_cb.stats;
+  dprintf(fd, "\nPAN TAP data path:\n");
+  dprintf(fd, "  enabled: %d, tap fd: %d, flow: %d\n", btpan_cb.enabled,
+          btpan_cb.tap_fd, btpan_cb.flow);
+  dprintf(fd, "  rx frames: %llu, rx bytes: %llu, rx congested: %llu\n",
+          (unsigned long long)stats.tap_rx_frames,
+          (unsigned long long)stats.tap_rx_bytes,
+          (unsigned long long)stats.tap_rx_congested);
+  dprintf(fd, "  tx frames: %llu, tx bytes: %llu\n",
+          (unsigned long long)stats.tap_tx_frames,
+          (unsigned long long)stats.tap_tx_bytes);
+  if (stats.tap_rx_wakeups != 0 && stats.tap_rx_frames != 0) {
+    dprintf(fd, "  rx frames per wakeup: %.1f, rx CPU per frame: %.1f us\n",
+            (double)stats.tap_rx_frames / stats.tap_rx_wakeups,
+            (double)stats.tap_rx_cpu_us / stats.tap_rx_frames);
+  }
+}
+
 static void btif_pan_close_all_conns() {
   if (!stack_initialized) return;
 
@@ -222,6 +222,9 @@ typedef struct {
   alarm_t* rc_play_status_timer;
   bool rc_features_processed;
   uint64_t rc_playing_uid;
+  /* The metadata of rc_playing_uid was requested on its track change, the
+   * interim response of the re-registration that follows needs no request */
+  bool rc_track_metadata_requested;
   bool rc_procedure_complete;
   rc_transaction_set_t transaction_set;
   tBTA_AV_FEAT peer_ct_features;
@@ -469,6 +472,7 @@ void initialize_device(btif_rc_device_cb_t* p_dev) {
   p_dev->rc_play_status_timer = nullptr;
   p_dev->rc_features_processed = false;
   p_dev->rc_playing_uid = 0;
+  p_dev->rc_track_metadata_requested = false;
   p_dev->rc_procedure_complete = false;
   p_dev->peer_ct_features = 0;
   p_dev->peer_tg_features = 0;
@@ -3281,11 +3285,20 @@ static void handle_notification_response(tBTA_AV_META_MSG* pmeta_msg,
         if (rc_is_track_id_valid(p_rsp->param.track) != true) {
           break;
         } else {
+          uint64_t uid;
           uint8_t* p_data = p_rsp->param.track;
-          BE_STREAM_TO_UINT64(p_dev->rc_playing_uid, p_data);
+          BE_STREAM_TO_UINT64(uid, p_data);
           get_play_status_cmd(p_dev);
-          get_metadata_attribute_cmd(attr_list_size, attr_list,
-                                    p_dev);
+          /* Targets without browsing report every track as UID 0, a change
+           * between the two responses is only seen with real UIDs */
+          if (p_dev->rc_track_metadata_requested && uid != 0 &&
+              uid == p_dev->rc_playing_uid) {
+            log::verbose("Metadata of the track already requested");
+          } else {
+            p_dev->rc_playing_uid = uid;
+            get_metadata_attribute_cmd(attr_list_size, attr_list, p_dev);
+          }
+          p_dev->rc_track_metadata_requested = false;
         }
         break;
 
@@ -3316,8 +3329,8 @@ static void handle_notification_response(tBTA_AV_META_MSG* pmeta_msg,
         break;
 
       case AVRC_EVT_PLAY_POS_CHANGED:
-        do_in_jni_thread(
-            FROM_HERE,
+        do_in_jni_thread_coalesced(
+            FROM_HERE, "play_position " + p_dev->rc_addr.ToString(),
             base::BindOnce(bt_rc_ctrl_callbacks->play_position_changed_cb,
                            p_dev->rc_addr, 0, p_rsp->param.play_pos));
 
@@ -3393,12 +3406,18 @@ static void handle_notification_response(tBTA_AV_META_MSG* pmeta_msg,
 
         break;
 
-      case AVRC_EVT_TRACK_CHANGE:
+      case AVRC_EVT_TRACK_CHANGE: {
         if (rc_is_track_id_valid(p_rsp->param.track) != true) {
           break;
         }
+        /* Request the metadata of the new track with its UID, the interim
+         * response of the re-registration only needs another request if it
+         * reports a different track */
+        uint8_t* p_data = p_rsp->param.track;
+        BE_STREAM_TO_UINT64(p_dev->rc_playing_uid, p_data);
+        p_dev->rc_track_metadata_requested = true;
         get_metadata_attribute_cmd(attr_list_size, attr_list, p_dev);
-        break;
+      } break;
 
       case AVRC_EVT_APP_SETTING_CHANGE: {
         btrc_player_settings_t app_settings;
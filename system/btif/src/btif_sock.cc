@@ -197,6 +197,8 @@ void btif_sock_dump(int fd) {
     index %= SOCK_LOGGER_SIZE_MAX;
   } while (index != head);
   dprintf(fd, "\n");
+
+  btsock_thread_dump(fd);
 }
 
 void SockConnectionEvent::dump(const int fd) {
@@ -23,6 +23,7 @@
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 
 #include <cstdint>
 #include <mutex>
@@ -902,10 +903,58 @@ static sent_status_t send_data_to_app(int fd, BT_HDR* p_buf) {
   return SENT_PARTIAL;
 }
 
+// Most incoming buffers gathered in one write to the app socket.
+#define RFC_INCOMING_MAX_IOV 16
+
+// Sends the front buffers of the incoming queue in one write, and frees the
+// buffers sent completely. SENT_ALL means all of the gathered buffers were
+// sent, there may be more left in the queue.
+static sent_status_t send_incoming_que_to_app(rfc_slot_t* slot) {
+  struct iovec iov[RFC_INCOMING_MAX_IOV];
+  int num_bufs = 0;
+  size_t total = 0;
+  for (const list_node_t* node = list_begin(slot->incoming_queue);
+       node != list_end(slot->incoming_queue) &&
+       num_bufs < RFC_INCOMING_MAX_IOV;
+       node = list_next(node), num_bufs++) {
+    BT_HDR* p_buf = (BT_HDR*)list_node(node);
+    iov[num_bufs].iov_base = p_buf->data + p_buf->offset;
+    iov[num_bufs].iov_len = p_buf->len;
+    total += p_buf->len;
+  }
+
+  ssize_t sent = 0;
+  if (total) {
+    struct msghdr msg = {};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = num_bufs;
+    OSI_NO_INTR(sent = sendmsg(slot->fd, &msg, MSG_DONTWAIT));
+
+    if (sent == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) return SENT_NONE;
+      log::error("error writing RFCOMM data back to app: {}", strerror(errno));
+      return SENT_FAILED;
+    }
+
+    if (sent == 0) return SENT_FAILED;
+  }
+
+  for (int i = 0; i < num_bufs; i++) {
+    BT_HDR* p_buf = (BT_HDR*)list_front(slot->incoming_queue);
+    if (sent < p_buf->len) {
+      p_buf->offset += sent;
+      p_buf->len -= sent;
+      return SENT_PARTIAL;
+    }
+    sent -= p_buf->len;
+    list_remove(slot->incoming_queue, p_buf);
+  }
+  return SENT_ALL;
+}
+
 static bool flush_incoming_que_on_wr_signal(rfc_slot_t* slot) {
   while (!list_is_empty(slot->incoming_queue)) {
-    BT_HDR* p_buf = (BT_HDR*)list_front(slot->incoming_queue);
-    switch (send_data_to_app(slot->fd, p_buf)) {
+    switch (send_incoming_que_to_app(slot)) {
       case SENT_NONE:
       case SENT_PARTIAL:
         // monitor the fd to get callback when app is ready to receive data
@@ -914,11 +963,9 @@ static bool flush_incoming_que_on_wr_signal(rfc_slot_t* slot) {
         return true;
 
       case SENT_ALL:
-        list_remove(slot->incoming_queue, p_buf);
         break;
 
       case SENT_FAILED:
-        list_remove(slot->incoming_queue, p_buf);
         return false;
     }
   }
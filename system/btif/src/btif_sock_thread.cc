@@ -20,7 +20,7 @@
  *
  *  Filename:      btif_sock_thread.cc
  *
- *  Description:   socket select thread
+ *  Description:   socket epoll thread
  *
  ******************************************************************************/
 
@@ -32,12 +32,11 @@
 #include <bluetooth/log.h>
 #include <fcntl.h>
 #include <features.h>
-#include <poll.h>
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/select.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/un.h>
@@ -58,10 +57,11 @@
 
 #define MAX_THREAD 8
 #define MAX_POLL 64
-#define POLL_EXCEPTION_EVENTS (POLLHUP | POLLRDHUP | POLLERR | POLLNVAL)
+/* EPOLLERR and EPOLLHUP are always reported, without being requested */
+#define POLL_EXCEPTION_EVENTS (EPOLLHUP | EPOLLRDHUP | EPOLLERR)
 #define IS_EXCEPTION(e) ((e)&POLL_EXCEPTION_EVENTS)
-#define IS_READ(e) ((e)&POLLIN)
-#define IS_WRITE(e) ((e)&POLLOUT)
+#define IS_READ(e) ((e)&EPOLLIN)
+#define IS_WRITE(e) ((e)&EPOLLOUT)
 /*cmd executes in socket poll thread */
 #define CMD_WAKEUP 1
 #define CMD_EXIT 2
@@ -72,19 +72,27 @@
 using namespace bluetooth;
 
 struct poll_slot_t {
-  struct pollfd pfd;
+  int fd;
   uint32_t user_id;
   int type;
   int flags;
 };
+struct poll_stats_t {
+  uint64_t wakeup_count;    // epoll_wait returns
+  uint64_t signal_count;    // socket signals dispatched to the callback
+  uint64_t callback_us_sum; // time spent in the callback
+  uint64_t callback_us_max;
+  int max_poll_count;       // most fds watched at once
+};
 struct thread_slot_t {
   int cmd_fdr, cmd_fdw;
+  int epoll_fd;
   int poll_count;
   poll_slot_t ps[MAX_POLL];
-  int psi[MAX_POLL];  // index of poll slot
   std::optional<pthread_t> thread_id;
   btsock_signaled_cb callback;
   btsock_cmd_cb cmd_callback;
+  poll_stats_t stats;
   int used;
 };
 static thread_slot_t ts[MAX_THREAD];
@@ -139,6 +147,10 @@ static int alloc_thread_slot() {
 static void free_thread_slot(int h) {
   if (0 <= h && h < MAX_THREAD) {
     close_cmd_fd(h);
+    if (ts[h].epoll_fd != -1) {
+      close(ts[h].epoll_fd);
+      ts[h].epoll_fd = -1;
+    }
     ts[h].used = 0;
   } else
     log::error("invalid thread handle:{}", h);
@@ -150,6 +162,7 @@ void btsock_thread_init() {
     int h;
     for (h = 0; h < MAX_THREAD; h++) {
       ts[h].cmd_fdr = ts[h].cmd_fdw = -1;
+      ts[h].epoll_fd = -1;
       ts[h].used = 0;
       ts[h].thread_id = std::nullopt;
       ts[h].poll_count = 0;
@@ -179,7 +192,7 @@ int btsock_thread_create(btsock_signaled_cb callback,
   return h;
 }
 
-/* create dummy socket pair used to wake up select loop */
+/* create dummy socket pair used to wake up epoll loop */
 static inline void init_cmd_fd(int h) {
   asrt(ts[h].cmd_fdr == -1 && ts[h].cmd_fdw == -1);
   if (socketpair(AF_UNIX, SOCK_STREAM, 0, &ts[h].cmd_fdr) < 0) {
@@ -329,31 +342,56 @@ static void init_poll(int h) {
   ts[h].thread_id = std::nullopt;
   ts[h].callback = NULL;
   ts[h].cmd_callback = NULL;
+  ts[h].stats = {};
   for (i = 0; i < MAX_POLL; i++) {
-    ts[h].ps[i].pfd.fd = -1;
-    ts[h].psi[i] = -1;
+    memset(&ts[h].ps[i], 0, sizeof(ts[h].ps[i]));
+    ts[h].ps[i].fd = -1;
+  }
+  ts[h].epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (ts[h].epoll_fd == -1) {
+    log::error("epoll_create1 failed: {}", strerror(errno));
+    return;
   }
   init_cmd_fd(h);
 }
-static inline unsigned int flags2pevents(int flags) {
-  unsigned int pevents = 0;
-  if (flags & SOCK_THREAD_FD_WR) pevents |= POLLOUT;
-  if (flags & SOCK_THREAD_FD_RD) pevents |= POLLIN;
+static inline uint32_t flags2pevents(int flags) {
+  uint32_t pevents = 0;
+  if (flags & SOCK_THREAD_FD_WR) pevents |= EPOLLOUT;
+  if (flags & SOCK_THREAD_FD_RD) pevents |= EPOLLIN;
   pevents |= POLL_EXCEPTION_EVENTS;
   return pevents;
 }
 
+/* Watches the fd of the slot in the epoll set for the events of its flags.
+ * The slot index and the fd are both kept in the event data, so that the
+ * events of a slot removed and reused meanwhile can be told apart. */
+static inline void watch_poll(int h, int i, bool added) {
+  poll_slot_t* ps = &ts[h].ps[i];
+  struct epoll_event event = {};
+  event.events = flags2pevents(ps->flags);
+  event.data.u64 = ((uint64_t)i << 32) | (uint32_t)ps->fd;
+
+  int op = added ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+  if (epoll_ctl(ts[h].epoll_fd, op, ps->fd, &event) == 0) return;
+
+  // Closing an fd removes it from the epoll set, and its number can come back
+  // while it is still in a slot
+  if (op == EPOLL_CTL_MOD && errno == ENOENT &&
+      epoll_ctl(ts[h].epoll_fd, EPOLL_CTL_ADD, ps->fd, &event) == 0)
+    return;
+  log::error("epoll_ctl failed for fd:{}, errno:{}, err:{}", ps->fd, errno,
+             strerror(errno));
+}
+
 static inline void set_poll(poll_slot_t* ps, int fd, int type, int flags,
                             uint32_t user_id) {
-  ps->pfd.fd = fd;
+  ps->fd = fd;
   ps->user_id = user_id;
   if (ps->type != 0 && ps->type != type)
     log::error("poll socket type should not changed! type was:{}, type now:{}",
                ps->type, type);
   ps->type = type;
   ps->flags = flags;
-  ps->pfd.events = flags2pevents(flags);
-  ps->pfd.revents = 0;
 }
 static inline void add_poll(int h, int fd, int type, int flags,
                             uint32_t user_id) {
@@ -363,33 +401,39 @@ static inline void add_poll(int h, int fd, int type, int flags,
   poll_slot_t* ps = ts[h].ps;
 
   for (i = 0; i < MAX_POLL; i++) {
-    if (ps[i].pfd.fd == fd) {
+    if (ps[i].fd == fd) {
       asrt(ts[h].poll_count < MAX_POLL);
 
       set_poll(&ps[i], fd, type, flags | ps[i].flags, user_id);
+      watch_poll(h, i, false);
       return;
-    } else if (empty < 0 && ps[i].pfd.fd == -1)
+    } else if (empty < 0 && ps[i].fd == -1)
       empty = i;
   }
   if (empty >= 0) {
     asrt(ts[h].poll_count < MAX_POLL);
     set_poll(&ps[empty], fd, type, flags, user_id);
+    watch_poll(h, empty, true);
     ++ts[h].poll_count;
+    if (ts[h].poll_count > ts[h].stats.max_poll_count)
+      ts[h].stats.max_poll_count = ts[h].poll_count;
     return;
   }
   log::error("exceeded max poll slot:{}!", MAX_POLL);
 }
 static inline void remove_poll(int h, poll_slot_t* ps, int flags) {
   if (flags == ps->flags) {
-    // all monitored events signaled. To remove it, just clear the slot
+    // all monitored events signaled. To remove it, clear the slot and stop
+    // watching the fd, which may already be closed
+    epoll_ctl(ts[h].epoll_fd, EPOLL_CTL_DEL, ps->fd, NULL);
     --ts[h].poll_count;
     memset(ps, 0, sizeof(*ps));
-    ps->pfd.fd = -1;
+    ps->fd = -1;
   } else {
     // one read or one write monitor event signaled, removed the accordding bit
     ps->flags &= ~flags;
-    // update the poll events mask
-    ps->pfd.events = flags2pevents(ps->flags);
+    // update the epoll events mask
+    watch_poll(h, ps - ts[h].ps, false);
   }
 }
 static int process_cmd_sock(int h) {
@@ -410,7 +454,7 @@ static int process_cmd_sock(int h) {
     case CMD_REMOVE_FD:
       for (int i = 1; i < MAX_POLL; ++i) {
         poll_slot_t* poll_slot = &ts[h].ps[i];
-        if (poll_slot->pfd.fd == cmd.fd) {
+        if (poll_slot->fd == cmd.fd) {
           remove_poll(h, poll_slot, poll_slot->flags);
           break;
         }
@@ -433,96 +477,101 @@ static int process_cmd_sock(int h) {
   return true;
 }
 
-static void process_data_sock(int h, struct pollfd* pfds, int pfds_count,
-                              int event_count) {
-  asrt(event_count <= pfds_count);
-  int i;
-  for (i = 1; i < pfds_count; i++) {
-    if (pfds[i].revents) {
-      int ps_i = ts[h].psi[i];
-      if (ts[h].ps[ps_i].pfd.fd == -1) {
-        log::info("Socket has been removed from poll set");
-        continue;
-      }
-      asrt(pfds[i].fd == ts[h].ps[ps_i].pfd.fd);
-      uint32_t user_id = ts[h].ps[ps_i].user_id;
-      int type = ts[h].ps[ps_i].type;
-      int flags = 0;
-      if (IS_READ(pfds[i].revents)) {
-        flags |= SOCK_THREAD_FD_RD;
-      }
-      if (IS_WRITE(pfds[i].revents)) {
-        flags |= SOCK_THREAD_FD_WR;
-      }
-      if (IS_EXCEPTION(pfds[i].revents)) {
-        flags |= SOCK_THREAD_FD_EXCEPTION;
-        // remove the whole slot not flags
-        remove_poll(h, &ts[h].ps[ps_i], ts[h].ps[ps_i].flags);
-      } else if (flags)
-        remove_poll(h, &ts[h].ps[ps_i],
-                    flags);  // remove the monitor flags that already processed
-      if (flags) ts[h].callback(pfds[i].fd, type, flags, user_id);
-    }
-  }
+static inline uint64_t now_us() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
 }
 
-static void prepare_poll_fds(int h, struct pollfd* pfds) {
-  int count = 0;
-  int ps_i = 0;
-  int pfd_i = 0;
-  asrt(ts[h].poll_count <= MAX_POLL);
-  while (count < ts[h].poll_count) {
-    if (ps_i >= MAX_POLL) {
-      log::error(
-          "exceed max poll range, ps_i:{}, MAX_POLL:{}, count:{}, "
-          "ts[h].poll_count:{}",
-          ps_i, MAX_POLL, count, ts[h].poll_count);
-      return;
-    }
-    if (ts[h].ps[ps_i].pfd.fd >= 0) {
-      pfds[pfd_i] = ts[h].ps[ps_i].pfd;
-      ts[h].psi[pfd_i] = ps_i;
-      count++;
-      pfd_i++;
-    }
-    ps_i++;
+static void process_data_sock(int h, const struct epoll_event* event) {
+  int ps_i = event->data.u64 >> 32;
+  int fd = (int)(uint32_t)event->data.u64;
+  poll_slot_t* ps = &ts[h].ps[ps_i];
+  if (ps->fd != fd) {
+    log::info("Socket has been removed from poll set");
+    return;
+  }
+  uint32_t user_id = ps->user_id;
+  int type = ps->type;
+  int flags = 0;
+  if (IS_READ(event->events)) {
+    flags |= SOCK_THREAD_FD_RD;
+  }
+  if (IS_WRITE(event->events)) {
+    flags |= SOCK_THREAD_FD_WR;
+  }
+  if (IS_EXCEPTION(event->events)) {
+    flags |= SOCK_THREAD_FD_EXCEPTION;
+    // remove the whole slot not flags
+    remove_poll(h, ps, ps->flags);
+  } else if (flags) {
+    // remove the monitor flags that already processed
+    remove_poll(h, ps, flags);
+  }
+  if (flags) {
+    uint64_t start_us = now_us();
+    ts[h].callback(fd, type, flags, user_id);
+    uint64_t elapsed_us = now_us() - start_us;
+
+    poll_stats_t* stats = &ts[h].stats;
+    stats->signal_count++;
+    stats->callback_us_sum += elapsed_us;
+    if (elapsed_us > stats->callback_us_max)
+      stats->callback_us_max = elapsed_us;
   }
 }
+
 static void* sock_poll_thread(void* arg) {
-  std::array<struct pollfd, MAX_POLL> pfds;
+  std::array<struct epoll_event, MAX_POLL> events;
 
   int h = (intptr_t)arg;
   for (;;) {
-    pfds = {};
-    prepare_poll_fds(h, pfds.data());
     int ret;
-    OSI_NO_INTR(ret = poll(pfds.data(), ts[h].poll_count, -1));
+    OSI_NO_INTR(ret = epoll_wait(ts[h].epoll_fd, events.data(), events.size(),
+                                 -1));
     if (ret == -1) {
-      log::error("poll ret -1, exit the thread, errno:{}, err:{}", errno,
+      log::error("epoll_wait ret -1, exit the thread, errno:{}, err:{}", errno,
                  strerror(errno));
       break;
     }
-    if (ret != 0) {
-      int need_process_data_fd = true;
-      int pfds_count = ts[h].poll_count;
-      if (pfds[0].revents)  // cmd fd always is the first one
-      {
-        asrt(pfds[0].fd == ts[h].cmd_fdr);
+    ts[h].stats.wakeup_count++;
+
+    // The commands are processed first, they may remove the signaled fds
+    bool exit = false;
+    for (int i = 0; i < ret; i++) {
+      if ((events[i].data.u64 >> 32) == 0 &&
+          (int)(uint32_t)events[i].data.u64 == ts[h].cmd_fdr) {
         if (!process_cmd_sock(h)) {
           log::info("h:{}, process_cmd_sock return false, exit...", h);
-          break;
+          exit = true;
         }
-        if (ret == 1)
-          need_process_data_fd = false;
-        else
-          ret--;  // exclude the cmd fd
+        events[i] = events[--ret];
+        break;
       }
-      if (need_process_data_fd)
-        process_data_sock(h, pfds.data(), pfds_count, ret);
-    } else {
-      log::info("no data, select ret: {}", ret);
-    };
+    }
+    if (exit) break;
+
+    for (int i = 0; i < ret; i++) process_data_sock(h, &events[i]);
   }
   log::info("socket poll thread exiting, h:{}", h);
   return 0;
 }
+
+void btsock_thread_dump(int fd) {
+  dprintf(fd, "\nSocket Poll Threads:\n");
+  for (int h = MAX_THREAD - 1; h >= 0; h--) {
+    if (!ts[h].used) continue;
+    const poll_stats_t& stats = ts[h].stats;
+    dprintf(fd,
+            "  h:%d watched:%d max_watched:%d wakeups:%llu signals:%llu "
+            "callback_us_mean:%llu callback_us_max:%llu\n",
+            h, ts[h].poll_count, stats.max_poll_count,
+            (unsigned long long)stats.wakeup_count,
+            (unsigned long long)stats.signal_count,
+            (unsigned long long)(stats.signal_count
+                                     ? stats.callback_us_sum /
+                                           stats.signal_count
+                                     : 0),
+            (unsigned long long)stats.callback_us_max);
+  }
+}
@@ -35,6 +35,7 @@
 #include <alloca.h>
 #include <base/logging.h>
 #include <bluetooth/log.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -48,6 +49,7 @@
 #include "btif_storage.h"
 #include "btif_util.h"
 #include "common/init_flags.h"
+#include "common/time_util.h"
 #include "core_callbacks.h"
 #include "device/include/controller.h"
 #include "internal_include/bt_target.h"
@@ -515,6 +517,15 @@ static bt_status_t btif_in_fetch_bonded_devices(
   return BT_STATUS_SUCCESS;
 }
 
+/* Time spent in each step of loading the bonded devices at enable */
+static struct {
+  uint32_t num_devices;
+  uint64_t le_devices_ms;
+  uint64_t add_devices_ms;
+  uint64_t adapter_properties_ms;
+  uint64_t remote_properties_ms;
+} bonded_devices_load_timing;
+
 static void btif_read_le_key(const uint8_t key_type, const size_t key_len,
                              RawAddress bd_addr, const tBLE_ADDR_TYPE addr_type,
                              const bool add_key, bool* device_added,
@@ -911,9 +922,8 @@ bt_status_t btif_storage_remove_bonded_device(
  */
 static void remove_devices_with_sample_ltk() {
   std::vector<RawAddress> bad_ltk;
-  for (const auto& bd_addr : btif_config_get_paired_devices()) {
-    auto name = bd_addr.ToString();
-
+  for (const auto& bd_addr :
+       btif_config_get_paired_devices_with_key(BTIF_STORAGE_KEY_LE_KEY_PENC)) {
     tBTA_LE_KEY_VALUE key;
     memset(&key, 0, sizeof(key));
 
@@ -947,8 +957,11 @@ static void remove_devices_with_sample_ltk() {
  *
  ******************************************************************************/
 void btif_storage_load_le_devices(void) {
+  uint64_t start_ms = bluetooth::common::time_get_os_boottime_ms();
   btif_bonded_devices_t bonded_devices;
-  btif_in_fetch_bonded_devices(&bonded_devices, 1);
+  /* Only the addresses are needed here, the devices are added to BTA by
+   * btif_storage_load_bonded_devices() */
+  btif_in_fetch_bonded_devices(&bonded_devices, 0);
   std::unordered_set<RawAddress> bonded_addresses;
   for (uint16_t i = 0; i < bonded_devices.num_devices; i++) {
     bonded_addresses.insert(bonded_devices.devices[i]);
@@ -1004,6 +1017,8 @@ void btif_storage_load_le_devices(void) {
           device.first, device.second);
     }
   }
+  bonded_devices_load_timing.le_devices_ms =
+      bluetooth::common::time_get_os_boottime_ms() - start_ms;
 }
 
 /*******************************************************************************
@@ -1033,9 +1048,13 @@ bt_status_t btif_storage_load_bonded_devices(void) {
   Uuid remote_uuids[BT_MAX_NUM_UUIDS];
   bt_status_t status;
 
+  uint64_t start_ms = bluetooth::common::time_get_os_boottime_ms();
   remove_devices_with_sample_ltk();
 
   btif_in_fetch_bonded_devices(&bonded_devices, 1);
+  uint64_t added_ms = bluetooth::common::time_get_os_boottime_ms();
+  bonded_devices_load_timing.num_devices = bonded_devices.num_devices;
+  bonded_devices_load_timing.add_devices_ms = added_ms - start_ms;
 
   /* Now send the adapter_properties_cb with all adapter_properties */
   {
@@ -1095,6 +1114,10 @@ bt_status_t btif_storage_load_bonded_devices(void) {
     osi_free(devices_list);
   }
 
+  uint64_t adapter_properties_ms = bluetooth::common::time_get_os_boottime_ms();
+  bonded_devices_load_timing.adapter_properties_ms =
+      adapter_properties_ms - added_ms;
+
   log::verbose("Number of bonded devices found={}", bonded_devices.num_devices);
 
   {
@@ -1172,6 +1195,8 @@ bt_status_t btif_storage_load_bonded_devices(void) {
                                  remote_properties);
     }
   }
+  bonded_devices_load_timing.remote_properties_ms =
+      bluetooth::common::time_get_os_boottime_ms() - adapter_properties_ms;
   return BT_STATUS_SUCCESS;
 }
 
@@ -1602,6 +1627,19 @@ void btif_storage_remove_gatt_cl_db_hash(const RawAddress& bd_addr) {
                        bd_addr));
 }
 
+void btif_debug_bonded_devices_load_dump(int fd) {
+  dprintf(fd, "\nBonded devices loading at enable:\n");
+  dprintf(fd, "  Devices: %u\n", bonded_devices_load_timing.num_devices);
+  dprintf(fd, "  LE address consolidation: %" PRIu64 " ms\n",
+          bonded_devices_load_timing.le_devices_ms);
+  dprintf(fd, "  Adding devices and keys: %" PRIu64 " ms\n",
+          bonded_devices_load_timing.add_devices_ms);
+  dprintf(fd, "  Adapter properties: %" PRIu64 " ms\n",
+          bonded_devices_load_timing.adapter_properties_ms);
+  dprintf(fd, "  Remote device properties: %" PRIu64 " ms\n",
+          bonded_devices_load_timing.remote_properties_ms);
+}
+
 void btif_debug_linkkey_type_dump(int fd) {
   dprintf(fd, "\nLink Key Types:\n");
   for (const auto& bd_addr : btif_config_get_paired_devices()) {
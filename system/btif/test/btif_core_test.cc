@@ -19,6 +19,8 @@
 
 #include <future>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "bta/include/bta_ag_api.h"
 #include "bta/include/bta_av_api.h"
@@ -213,6 +215,58 @@ TEST_F(BtifCoreTest, test_post_on_bt_jni_simple3) {
   ASSERT_EQ(val, future.get());
 }
 
+TEST_F(BtifCoreTest, test_do_in_jni_thread_coalesced) {
+  std::promise<void> blocked;
+  std::future<void> unblock = blocked.get_future();
+  ASSERT_EQ(BT_STATUS_SUCCESS,
+            do_in_jni_thread(base::BindOnce(
+                [](std::future<void>* unblock) { unblock->wait(); },
+                &unblock)));
+
+  std::vector<int> values;
+  for (int val : {1, 2, 3}) {
+    ASSERT_EQ(BT_STATUS_SUCCESS,
+              do_in_jni_thread_coalesced(
+                  FROM_HERE, "key",
+                  base::BindOnce([](std::vector<int>* values,
+                                    int val) { values->push_back(val); },
+                                 &values, val)));
+  }
+
+  std::promise<void> promise;
+  std::future<void> future = promise.get_future();
+  post_on_bt_jni([&promise]() { promise.set_value(); });
+  blocked.set_value();
+  ASSERT_EQ(std::future_status::ready, future.wait_for(timeout_time));
+  ASSERT_EQ(std::vector<int>({3}), values);
+}
+
+TEST_F(BtifCoreTest, test_do_in_jni_thread_urgent) {
+  std::promise<void> blocked;
+  std::future<void> unblock = blocked.get_future();
+  ASSERT_EQ(BT_STATUS_SUCCESS,
+            do_in_jni_thread(base::BindOnce(
+                [](std::future<void>* unblock) { unblock->wait(); },
+                &unblock)));
+
+  std::vector<std::string> order;
+  post_on_bt_jni([&order]() { order.push_back("regular"); });
+  ASSERT_EQ(BT_STATUS_SUCCESS,
+            do_in_jni_thread_urgent(
+                FROM_HERE, base::BindOnce(
+                               [](std::vector<std::string>* order) {
+                                 order->push_back("urgent");
+                               },
+                               &order)));
+
+  std::promise<void> promise;
+  std::future<void> future = promise.get_future();
+  post_on_bt_jni([&promise]() { promise.set_value(); });
+  blocked.set_value();
+  ASSERT_EQ(std::future_status::ready, future.wait_for(timeout_time));
+  ASSERT_EQ(std::vector<std::string>({"urgent", "regular"}), order);
+}
+
 extern const char* dump_av_sm_event_name(int event);
 TEST_F(BtifCoreTest, dump_av_sm_event_name) {
   std::vector<std::pair<int, std::string>> events = {
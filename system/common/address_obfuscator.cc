@@ -38,6 +38,7 @@ bool AddressObfuscator::IsSaltValid(const Octet32& salt_256bit) {
 void AddressObfuscator::Initialize(const Octet32& salt_256bit) {
   std::lock_guard<std::recursive_mutex> lock(instance_mutex_);
   salt_256bit_ = salt_256bit;
+  cache_.clear();
 }
 
 bool AddressObfuscator::IsInitialized() {
@@ -48,13 +49,23 @@ bool AddressObfuscator::IsInitialized() {
 std::string AddressObfuscator::Obfuscate(const RawAddress& address) {
   std::lock_guard<std::recursive_mutex> lock(instance_mutex_);
   CHECK(IsInitialized());
+  auto cached = cache_.find(address);
+  if (cached != cache_.end()) {
+    return cached->second;
+  }
   std::array<uint8_t, EVP_MAX_MD_SIZE> result = {};
   unsigned int out_len = 0;
   CHECK(::HMAC(EVP_sha256(), salt_256bit_.data(), salt_256bit_.size(),
                address.address, address.kLength, result.data(),
                &out_len) != nullptr);
   CHECK_EQ(out_len, static_cast<unsigned int>(kOctet32Length));
-  return std::string(reinterpret_cast<const char*>(result.data()), out_len);
+  std::string obfuscated(reinterpret_cast<const char*>(result.data()),
+                         out_len);
+  if (cache_.size() >= kMaxCachedAddresses) {
+    cache_.clear();
+  }
+  cache_[address] = obfuscated;
+  return obfuscated;
 }
 
 }  // namespace common
@@ -20,6 +20,7 @@
 
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "hci/octets.h"
 #include "raw_address.h"
@@ -61,14 +62,21 @@ class AddressObfuscator {
   /**
    * Obfuscate Bluetooth MAC address into an anonymous ID string
    *
+   * Results are cached per address until the salt changes, so repeated
+   * lookups for the same devices do not recompute the HMAC
+   *
    * @param address Bluetooth MAC address to be obfuscated
    * @return the obfuscated MAC address in 256 bit
    */
   std::string Obfuscate(const RawAddress& address);
 
  private:
+  // Cached results are dropped all at once when this many addresses are cached
+  static constexpr size_t kMaxCachedAddresses = 256;
+
   AddressObfuscator() : salt_256bit_({0}) {}
   Octet32 salt_256bit_;
+  std::unordered_map<RawAddress, std::string> cache_;
   std::recursive_mutex instance_mutex_;
 };
 
@@ -26,12 +26,14 @@
 
 #include "abstract_message_loop.h"
 #include "common/message_loop_thread.h"
+#include "common/task_queue_thread.h"
 #include "include/check.h"
 #include "osi/include/fixed_queue.h"
 #include "osi/include/thread.h"
 
 using ::benchmark::State;
 using bluetooth::common::MessageLoopThread;
+using bluetooth::common::TaskQueueThread;
 
 #define NUM_MESSAGES_TO_SEND 100000
 
@@ -373,6 +375,142 @@ BENCHMARK_F(BM_MessageLooopThread, sequential_execution)(State& state) {
   }
 };
 
+class BM_TaskQueueThread : public BM_ThreadPerformance {
+ protected:
+  void SetUp(State& st) override {
+    BM_ThreadPerformance::SetUp(st);
+    std::future<void> set_up_future = set_up_promise_->get_future();
+    task_queue_thread_ = new TaskQueueThread("BM_TaskQueueThread thread");
+    task_queue_thread_->StartUp();
+    task_queue_thread_->DoInThread(
+        FROM_HERE, base::BindOnce(&std::promise<void>::set_value,
+                                  base::Unretained(set_up_promise_.get())));
+    set_up_future.wait();
+  }
+
+  void TearDown(State& st) override {
+    task_queue_thread_->ShutDown();
+    delete task_queue_thread_;
+    task_queue_thread_ = nullptr;
+    BM_ThreadPerformance::TearDown(st);
+  }
+
+  TaskQueueThread* task_queue_thread_ = nullptr;
+};
+
+BENCHMARK_F(BM_TaskQueueThread, batch_enque_dequeue)(State& state) {
+  for (auto _ : state) {
+    g_counter = 0;
+    g_counter_promise = std::make_unique<std::promise<void>>();
+    std::future<void> counter_future = g_counter_promise->get_future();
+    for (int i = 0; i < NUM_MESSAGES_TO_SEND; i++) {
+      fixed_queue_enqueue(bt_msg_queue_, (void*)&g_counter);
+      task_queue_thread_->DoInThread(
+          FROM_HERE, base::BindOnce(&callback_batch, bt_msg_queue_, nullptr));
+    }
+    counter_future.wait();
+  }
+};
+
+BENCHMARK_F(BM_TaskQueueThread, batch_enque_dequeue_lambda)(State& state) {
+  for (auto _ : state) {
+    g_counter = 0;
+    g_counter_promise = std::make_unique<std::promise<void>>();
+    std::future<void> counter_future = g_counter_promise->get_future();
+    for (int i = 0; i < NUM_MESSAGES_TO_SEND; i++) {
+      fixed_queue_enqueue(bt_msg_queue_, (void*)&g_counter);
+      fixed_queue_t* queue = bt_msg_queue_;
+      task_queue_thread_->DoInThread(
+          [queue]() { callback_batch(queue, nullptr); });
+    }
+    counter_future.wait();
+  }
+};
+
+BENCHMARK_F(BM_TaskQueueThread, sequential_execution)(State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < NUM_MESSAGES_TO_SEND; i++) {
+      g_counter_promise = std::make_unique<std::promise<void>>();
+      std::future<void> counter_future = g_counter_promise->get_future();
+      task_queue_thread_->DoInThread(
+          FROM_HERE, base::BindOnce(&callback_sequential, nullptr));
+      counter_future.wait();
+    }
+  }
+};
+
+// Latency of a task that hops from a reactor thread, standing in for the gd
+// stack thread, to a MessageLoopThread standing in for the main thread. The
+// main thread runs either on its own thread or on the reactor thread.
+class BM_MainThreadHop : public BM_ThreadPerformance {
+ protected:
+  void SetUp(State& st) override {
+    BM_ThreadPerformance::SetUp(st);
+    stack_thread_ = new TaskQueueThread("BM_MainThreadHop stack thread");
+    stack_thread_->StartUp();
+    main_thread_ = new MessageLoopThread("BM_MainThreadHop main thread");
+    if (IsMerged()) {
+      main_thread_->StartUpOn(
+          [this](base::OnceClosure task, std::chrono::microseconds delay) {
+            stack_thread_->DoInThreadDelayed(FROM_HERE, std::move(task),
+                                             delay);
+          });
+    } else {
+      main_thread_->StartUp();
+    }
+  }
+
+  void TearDown(State& st) override {
+    main_thread_->ShutDown();
+    delete main_thread_;
+    main_thread_ = nullptr;
+    stack_thread_->ShutDown();
+    delete stack_thread_;
+    stack_thread_ = nullptr;
+    BM_ThreadPerformance::TearDown(st);
+  }
+
+  virtual bool IsMerged() const = 0;
+
+  // Deliver NUM_MESSAGES_TO_SEND events from the stack thread to the main
+  // thread one at a time, as the ACL and HCI event paths do
+  void RunSequentialHops(State& state) {
+    for (auto _ : state) {
+      for (int i = 0; i < NUM_MESSAGES_TO_SEND; i++) {
+        g_counter_promise = std::make_unique<std::promise<void>>();
+        std::future<void> counter_future = g_counter_promise->get_future();
+        MessageLoopThread* main_thread = main_thread_;
+        stack_thread_->DoInThread([main_thread]() {
+          main_thread->DoInThread(
+              FROM_HERE, base::BindOnce(&callback_sequential, nullptr));
+        });
+        counter_future.wait();
+      }
+    }
+  }
+
+  TaskQueueThread* stack_thread_ = nullptr;
+  MessageLoopThread* main_thread_ = nullptr;
+};
+
+class BM_SeparateMainThread : public BM_MainThreadHop {
+ protected:
+  bool IsMerged() const override { return false; }
+};
+
+class BM_MergedMainThread : public BM_MainThreadHop {
+ protected:
+  bool IsMerged() const override { return true; }
+};
+
+BENCHMARK_F(BM_SeparateMainThread, sequential_hop)(State& state) {
+  RunSequentialHops(state);
+};
+
+BENCHMARK_F(BM_MergedMainThread, sequential_hop)(State& state) {
+  RunSequentialHops(state);
+};
+
 class BM_LibChromeThread : public BM_ThreadPerformance {
  protected:
   void SetUp(State& st) override {
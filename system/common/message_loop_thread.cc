@@ -50,7 +50,8 @@ MessageLoopThread::MessageLoopThread(const std::string& thread_name)
       thread_id_(-1),
       linux_tid_(-1),
       weak_ptr_factory_(this),
-      shutting_down_(false) {}
+      shutting_down_(false),
+      pump_scheduled_(false) {}
 
 MessageLoopThread::~MessageLoopThread() { ShutDown(); }
 
@@ -59,7 +60,7 @@ void MessageLoopThread::StartUp() {
   std::future<void> start_up_future = start_up_promise.get_future();
   {
     std::lock_guard<std::recursive_mutex> api_lock(api_mutex_);
-    if (thread_ != nullptr) {
+    if (thread_ != nullptr || external_post_) {
       LOG(WARNING) << __func__ << ": thread " << *this << " is already started";
 
       return;
@@ -70,6 +71,25 @@ void MessageLoopThread::StartUp() {
   start_up_future.wait();
 }
 
+void MessageLoopThread::StartUpOn(ExternalPost external_post) {
+  std::promise<void> start_up_promise;
+  std::future<void> start_up_future = start_up_promise.get_future();
+  {
+    std::lock_guard<std::recursive_mutex> api_lock(api_mutex_);
+    if (thread_ != nullptr || external_post_) {
+      LOG(WARNING) << __func__ << ": thread " << *this << " is already started";
+      return;
+    }
+    external_post_ = std::move(external_post);
+    pump_scheduled_ = false;
+    external_post_(base::BindOnce(&MessageLoopThread::RunOnExternalLoop,
+                                  base::Unretained(this),
+                                  std::move(start_up_promise)),
+                   std::chrono::microseconds(0));
+  }
+  start_up_future.wait();
+}
+
 bool MessageLoopThread::DoInThread(const base::Location& from_here,
                                    base::OnceClosure task) {
   return DoInThreadDelayed(from_here, std::move(task),
@@ -93,13 +113,18 @@ bool MessageLoopThread::DoInThreadDelayed(const base::Location& from_here,
                << ", from " << from_here.ToString();
     return false;
   }
+  if (external_post_) {
+    SchedulePump(delay);
+  }
   return true;
 }
 
 void MessageLoopThread::ShutDown() {
+  std::promise<void> shut_down_promise;
+  std::future<void> shut_down_future = shut_down_promise.get_future();
   {
     std::lock_guard<std::recursive_mutex> api_lock(api_mutex_);
-    if (thread_ == nullptr) {
+    if (thread_ == nullptr && !external_post_) {
       LOG(INFO) << __func__ << ": thread " << *this << " is already stopped";
       return;
     }
@@ -115,13 +140,25 @@ void MessageLoopThread::ShutDown() {
     CHECK_NE(thread_id_, base::PlatformThread::CurrentId())
         << __func__ << " should not be called on the thread itself. "
         << "Otherwise, deadlock may happen.";
-    run_loop_->QuitWhenIdle();
+    if (external_post_) {
+      external_post_(
+          base::BindOnce(&MessageLoopThread::ShutDownOnExternalLoop,
+                         base::Unretained(this), std::move(shut_down_promise)),
+          std::chrono::microseconds(0));
+    } else {
+      run_loop_->QuitWhenIdle();
+    }
+  }
+  if (thread_ != nullptr) {
+    thread_->join();
+  } else {
+    shut_down_future.wait();
   }
-  thread_->join();
   {
     std::lock_guard<std::recursive_mutex> api_lock(api_mutex_);
     delete thread_;
     thread_ = nullptr;
+    external_post_ = nullptr;
     shutting_down_ = false;
   }
 }
@@ -211,6 +248,54 @@ void MessageLoopThread::Run(std::promise<void> start_up_promise) {
   }
 }
 
+void MessageLoopThread::RunOnExternalLoop(
+    std::promise<void> start_up_promise) {
+  std::lock_guard<std::recursive_mutex> api_lock(api_mutex_);
+  LOG(INFO) << __func__ << ": message loop starting for thread "
+            << thread_name_ << " on an external event loop";
+  message_loop_ = new btbase::AbstractMessageLoop();
+  thread_id_ = base::PlatformThread::CurrentId();
+  linux_tid_ = static_cast<pid_t>(syscall(SYS_gettid));
+  start_up_promise.set_value();
+}
+
+void MessageLoopThread::ShutDownOnExternalLoop(
+    std::promise<void> shut_down_promise) {
+  // Run the tasks posted before ShutDown(), as QuitWhenIdle() does
+  Pump();
+  {
+    std::lock_guard<std::recursive_mutex> api_lock(api_mutex_);
+    thread_id_ = -1;
+    linux_tid_ = -1;
+    delete message_loop_;
+    message_loop_ = nullptr;
+    LOG(INFO) << __func__ << ": message loop finished for thread "
+              << thread_name_;
+  }
+  shut_down_promise.set_value();
+}
+
+void MessageLoopThread::SchedulePump(std::chrono::microseconds delay) {
+  // Immediate tasks posted before the pump runs are drained by it
+  if (delay.count() == 0 && pump_scheduled_.exchange(true)) {
+    return;
+  }
+  external_post_(
+      base::BindOnce(&MessageLoopThread::Pump, base::Unretained(this)), delay);
+}
+
+void MessageLoopThread::Pump() {
+  pump_scheduled_ = false;
+  {
+    std::lock_guard<std::recursive_mutex> api_lock(api_mutex_);
+    // Pumps delayed past ShutDown() find no message loop
+    if (message_loop_ == nullptr) {
+      return;
+    }
+  }
+  base::RunLoop().RunUntilIdle();
+}
+
 void MessageLoopThread::Post(base::OnceClosure closure) {
   DoInThread(FROM_HERE, std::move(closure));
 }
@@ -22,6 +22,9 @@
 #include <base/threading/platform_thread.h>
 #include <unistd.h>
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <future>
 #include <string>
 #include <thread>
@@ -39,6 +42,12 @@ namespace common {
  */
 class MessageLoopThread final : public IPostableContext {
  public:
+  /**
+   * Posts a task to run on an event loop owned by someone else, after a delay
+   */
+  using ExternalPost = std::function<void(base::OnceClosure task,
+                                          std::chrono::microseconds delay)>;
+
   /**
    * Create a message loop thread with name. Thread won't be running until
    * StartUp is called.
@@ -64,6 +73,24 @@ class MessageLoopThread final : public IPostableContext {
    */
   void StartUp();
 
+  /**
+   * Start this message loop on an event loop owned by someone else instead of
+   * on a thread of its own. The message loop is created on the thread that
+   * runs the tasks given to |external_post|, and is drained there whenever a
+   * task posted to this thread becomes ready, so that the two event loops
+   * exchange tasks without a thread hop. Blocks until the message loop is
+   * created.
+   *
+   * |external_post| must run the tasks it is given in order, on a single
+   * thread that does not run a libchrome message loop of its own, until
+   * ShutDown() returns.
+   *
+   * Repeated call to this method will only start this thread once
+   *
+   * @param external_post posts tasks to the hosting event loop
+   */
+  void StartUpOn(ExternalPost external_post);
+
   /**
    * Post a task to run on this thread
    *
@@ -226,6 +253,26 @@ class MessageLoopThread final : public IPostableContext {
    */
   void Run(std::promise<void> start_up_promise);
 
+  /**
+   * Create the message loop on the hosting event loop, see StartUpOn()
+   */
+  void RunOnExternalLoop(std::promise<void> start_up_promise);
+
+  /**
+   * Delete the message loop on the hosting event loop, see ShutDown()
+   */
+  void ShutDownOnExternalLoop(std::promise<void> shut_down_promise);
+
+  /**
+   * Ask the hosting event loop to drain the message loop after |delay|
+   */
+  void SchedulePump(std::chrono::microseconds delay);
+
+  /**
+   * Run the ready tasks of the message loop, on the hosting event loop
+   */
+  void Pump();
+
   mutable std::recursive_mutex api_mutex_;
   const std::string thread_name_;
   btbase::AbstractMessageLoop* message_loop_;
@@ -236,6 +283,10 @@ class MessageLoopThread final : public IPostableContext {
   pid_t linux_tid_;
   base::WeakPtrFactory<MessageLoopThread> weak_ptr_factory_;
   bool shutting_down_;
+  // Set when the message loop is hosted by another event loop
+  ExternalPost external_post_;
+  // Whether a pump for immediate tasks is queued on the hosting event loop
+  std::atomic<bool> pump_scheduled_;
 };
 
 inline std::ostream& operator<<(std::ostream& os,
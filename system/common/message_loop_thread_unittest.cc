@@ -26,7 +26,10 @@
 #include <sys/capability.h>
 #include <syscall.h>
 
+#include "common/task_queue_thread.h"
+
 using bluetooth::common::MessageLoopThread;
+using bluetooth::common::TaskQueueThread;
 
 /**
  * Unit tests to verify MessageLoopThread. Must have CAP_SYS_NICE capability.
@@ -346,3 +349,45 @@ TEST_F(MessageLoopThreadTest, test_post_twice) {
   message_loop_thread.ShutDown();
   ASSERT_EQ(counter, 2);
 }
+
+// Verify that a message loop hosted by another event loop runs its tasks,
+// including delayed ones, on the hosting thread
+TEST_F(MessageLoopThreadTest, test_start_up_on_external_loop) {
+  TaskQueueThread host("host_thread");
+  host.StartUp();
+  MessageLoopThread message_loop_thread("test_thread");
+  message_loop_thread.StartUpOn(
+      [&host](base::OnceClosure task, std::chrono::microseconds delay) {
+        host.DoInThreadDelayed(FROM_HERE, std::move(task), delay);
+      });
+  ASSERT_TRUE(message_loop_thread.IsRunning());
+  ASSERT_EQ(message_loop_thread.GetThreadId(), host.GetThreadId());
+
+  std::promise<base::PlatformThreadId> thread_id_promise;
+  auto thread_id_future = thread_id_promise.get_future();
+  message_loop_thread.DoInThreadDelayed(
+      FROM_HERE,
+      base::BindOnce(&MessageLoopThreadTest::GetThreadId,
+                     base::Unretained(this), std::move(thread_id_promise)),
+      std::chrono::milliseconds(10));
+  ASSERT_EQ(thread_id_future.get(), host.GetThreadId());
+
+  int counter = 0;
+  for (int i = 0; i < 10; i++) {
+    message_loop_thread.DoInThread(
+        FROM_HERE,
+        base::BindOnce([](int* counter) { (*counter)++; }, &counter));
+  }
+  message_loop_thread.ShutDown();
+  ASSERT_EQ(counter, 10);
+  ASSERT_FALSE(message_loop_thread.IsRunning());
+  ASSERT_FALSE(message_loop_thread.DoInThread(
+      FROM_HERE, base::BindOnce(&MessageLoopThreadTest::ShouldNotHappen,
+                                base::Unretained(this))));
+
+  // The message loop can be started again on its own thread
+  message_loop_thread.StartUp();
+  ASSERT_NE(message_loop_thread.GetThreadId(), host.GetThreadId());
+  message_loop_thread.ShutDown();
+  host.ShutDown();
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+
+namespace bluetooth {
+
+namespace common {
+
+/**
+ * Link embedded in the elements of an MpscQueue
+ */
+struct MpscQueueNode {
+  std::atomic<MpscQueueNode*> mpsc_next{nullptr};
+};
+
+/**
+ * An intrusive, unbounded, lock-free multi-producer single-consumer queue.
+ *
+ * Elements derive from MpscQueueNode and are linked through it, so the queue
+ * itself never allocates. Push() is wait-free and may be called from any
+ * thread; Pop() and IsEmpty() may only be called from the single consumer
+ * thread. The queue does not own its elements.
+ *
+ * Pop() may return nullptr while a concurrent Push() is halfway through
+ * linking its element, even though IsEmpty() returns false. The element
+ * becomes visible as soon as that Push() returns.
+ */
+template <typename T>
+class MpscQueue {
+ public:
+  MpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  /**
+   * Append an element to the queue
+   *
+   * @param element element to append, must not be in any queue
+   */
+  void Push(T* element) { PushNode(static_cast<MpscQueueNode*>(element)); }
+
+  /**
+   * Remove the oldest element from the queue
+   *
+   * @return the oldest element, nullptr if no element is ready
+   */
+  T* Pop() {
+    MpscQueueNode* tail = tail_;
+    MpscQueueNode* next = tail->mpsc_next.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+      if (next == nullptr) {
+        return nullptr;
+      }
+      tail_ = next;
+      tail = next;
+      next = next->mpsc_next.load(std::memory_order_acquire);
+    }
+    if (next != nullptr) {
+      tail_ = next;
+      return static_cast<T*>(tail);
+    }
+    if (tail != head_.load(std::memory_order_acquire)) {
+      // A producer swapped the head but has not linked its element yet
+      return nullptr;
+    }
+    // tail is the last element, push the stub behind it so it can be removed
+    PushNode(&stub_);
+    next = tail->mpsc_next.load(std::memory_order_acquire);
+    if (next != nullptr) {
+      tail_ = next;
+      return static_cast<T*>(tail);
+    }
+    return nullptr;
+  }
+
+  /**
+   * Check whether any element has been pushed and not popped yet
+   *
+   * @return true iff the queue holds no element
+   */
+  bool IsEmpty() const {
+    return tail_ == &stub_ && stub_.mpsc_next.load() == nullptr;
+  }
+
+ private:
+  void PushNode(MpscQueueNode* node) {
+    node->mpsc_next.store(nullptr, std::memory_order_relaxed);
+    MpscQueueNode* prev = head_.exchange(node, std::memory_order_acq_rel);
+    // Sequentially consistent so that a consumer about to sleep either sees
+    // the element or is seen as sleeping by the producer.
+    prev->mpsc_next.store(node);
+  }
+
+  MpscQueueNode stub_;
+  // Last pushed node, written by producers
+  std::atomic<MpscQueueNode*> head_;
+  // Oldest node, only accessed by the consumer
+  MpscQueueNode* tail_;
+};
+
+}  // namespace common
+
+}  // namespace bluetooth
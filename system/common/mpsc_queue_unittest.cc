@@ -0,0 +1,97 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/mpsc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace testing {
+
+using bluetooth::common::MpscQueue;
+using bluetooth::common::MpscQueueNode;
+
+struct Item : public MpscQueueNode {
+  int producer = 0;
+  int value = 0;
+};
+
+TEST(MpscQueueTest, empty_queue_pops_nothing) {
+  MpscQueue<Item> queue;
+  EXPECT_TRUE(queue.IsEmpty());
+  EXPECT_EQ(queue.Pop(), nullptr);
+}
+
+TEST(MpscQueueTest, pop_in_push_order) {
+  MpscQueue<Item> queue;
+  Item items[3];
+  for (int i = 0; i < 3; i++) {
+    items[i].value = i;
+    queue.Push(&items[i]);
+  }
+  EXPECT_FALSE(queue.IsEmpty());
+  for (int i = 0; i < 3; i++) {
+    Item* item = queue.Pop();
+    ASSERT_NE(item, nullptr);
+    EXPECT_EQ(item->value, i);
+  }
+  EXPECT_TRUE(queue.IsEmpty());
+  EXPECT_EQ(queue.Pop(), nullptr);
+
+  // Elements can be queued again once popped
+  queue.Push(&items[1]);
+  EXPECT_EQ(queue.Pop(), &items[1]);
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(MpscQueueTest, concurrent_producers_keep_their_order) {
+  constexpr int kProducers = 4;
+  constexpr int kItemsPerProducer = 10000;
+  MpscQueue<Item> queue;
+  std::vector<Item> items(kProducers * kItemsPerProducer);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; p++) {
+    producers.emplace_back([&queue, &items, p]() {
+      for (int i = 0; i < kItemsPerProducer; i++) {
+        Item& item = items[p * kItemsPerProducer + i];
+        item.producer = p;
+        item.value = i;
+        queue.Push(&item);
+      }
+    });
+  }
+
+  std::vector<int> next_value(kProducers, 0);
+  int received = 0;
+  while (received < kProducers * kItemsPerProducer) {
+    Item* item = queue.Pop();
+    if (item == nullptr) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(item->value, next_value[item->producer]);
+    next_value[item->producer]++;
+    received++;
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+}  // namespace testing
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "task_queue_thread.h"
+
+#include <base/logging.h>
+#include <base/strings/stringprintf.h>
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace bluetooth {
+namespace common {
+
+TaskQueueThread::TaskQueueThread(const std::string& thread_name)
+    : thread_name_(thread_name),
+      thread_(nullptr),
+      thread_id_(-1),
+      running_(false),
+      quit_(false),
+      next_sequence_(0),
+      sleeping_(false) {}
+
+TaskQueueThread::~TaskQueueThread() {
+  ShutDown();
+  // Tasks posted by a thread racing with ShutDown()
+  DropPendingTasks();
+}
+
+void TaskQueueThread::StartUp() {
+  std::promise<void> start_up_promise;
+  std::future<void> start_up_future = start_up_promise.get_future();
+  {
+    std::lock_guard<std::mutex> api_lock(api_mutex_);
+    if (thread_ != nullptr) {
+      LOG(WARNING) << __func__ << ": thread " << thread_name_
+                   << " is already started";
+      return;
+    }
+    quit_ = false;
+    thread_ = new std::thread(&TaskQueueThread::Run, this,
+                              std::move(start_up_promise));
+  }
+  start_up_future.wait();
+}
+
+void TaskQueueThread::ShutDown() {
+  std::thread* thread;
+  {
+    std::lock_guard<std::mutex> api_lock(api_mutex_);
+    if (thread_ == nullptr) {
+      LOG(INFO) << __func__ << ": thread " << thread_name_
+                << " is already stopped";
+      return;
+    }
+    CHECK_NE(thread_id_, base::PlatformThread::CurrentId())
+        << __func__ << " should not be called on the thread itself. "
+        << "Otherwise, deadlock may happen.";
+    thread = thread_;
+    thread_ = nullptr;
+  }
+  running_ = false;
+  quit_ = true;
+  if (sleeping_) {
+    std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+    wake_cv_.notify_one();
+  }
+  thread->join();
+  delete thread;
+
+  std::lock_guard<std::mutex> api_lock(api_mutex_);
+  DropPendingTasks();
+}
+
+bool TaskQueueThread::DoInThread(const base::Location& from_here,
+                                 base::OnceClosure task) {
+  return DoInThreadDelayed(from_here, std::move(task),
+                           std::chrono::microseconds(0));
+}
+
+bool TaskQueueThread::DoInThreadDelayed(const base::Location& from_here,
+                                        base::OnceClosure task,
+                                        std::chrono::microseconds delay) {
+  if (!Enqueue(new QueuedTask([task = std::move(task)]() mutable {
+                 std::move(task).Run();
+               }),
+               delay)) {
+    LOG(ERROR) << __func__ << ": thread " << thread_name_
+               << " is not running, from " << from_here.ToString();
+    return false;
+  }
+  return true;
+}
+
+void TaskQueueThread::Post(base::OnceClosure closure) {
+  DoInThread(FROM_HERE, std::move(closure));
+}
+
+bool TaskQueueThread::Enqueue(QueuedTask* task,
+                              std::chrono::microseconds delay) {
+  if (!running_) {
+    delete task;
+    return false;
+  }
+  if (delay.count() > 0) {
+    task->deadline = std::chrono::steady_clock::now() + delay;
+  }
+  incoming_tasks_.Push(task);
+  if (sleeping_) {
+    std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+    wake_cv_.notify_one();
+  }
+  return true;
+}
+
+base::PlatformThreadId TaskQueueThread::GetThreadId() const {
+  std::lock_guard<std::mutex> api_lock(api_mutex_);
+  return thread_id_;
+}
+
+std::string TaskQueueThread::GetName() const { return thread_name_; }
+
+std::string TaskQueueThread::ToString() const {
+  std::lock_guard<std::mutex> api_lock(api_mutex_);
+  return base::StringPrintf("%s(%d)", thread_name_.c_str(), thread_id_);
+}
+
+bool TaskQueueThread::IsRunning() const { return running_; }
+
+void TaskQueueThread::Run(std::promise<void> start_up_promise) {
+  {
+    std::lock_guard<std::mutex> api_lock(api_mutex_);
+    LOG(INFO) << __func__ << ": task queue starting for thread "
+              << thread_name_;
+    base::PlatformThread::SetName(thread_name_);
+    thread_id_ = base::PlatformThread::CurrentId();
+    running_ = true;
+    start_up_promise.set_value();
+  }
+
+  while (true) {
+    DrainIncomingTasks();
+    auto now = std::chrono::steady_clock::now();
+    while (!delayed_tasks_.empty() && delayed_tasks_.top()->deadline <= now) {
+      ready_tasks_.push(delayed_tasks_.top());
+      delayed_tasks_.pop();
+    }
+
+    if (!ready_tasks_.empty()) {
+      while (!ready_tasks_.empty()) {
+        QueuedTask* task = ready_tasks_.front();
+        ready_tasks_.pop();
+        task->Run();
+        delete task;
+      }
+      continue;
+    }
+
+    if (quit_ && incoming_tasks_.IsEmpty()) {
+      break;
+    }
+
+    std::unique_lock<std::mutex> wake_lock(wake_mutex_);
+    sleeping_ = true;
+    // Checked after sleeping_ is set, a producer either sees sleeping_ or has
+    // made its task visible here.
+    if (incoming_tasks_.IsEmpty() && !quit_) {
+      if (delayed_tasks_.empty()) {
+        wake_cv_.wait(wake_lock);
+      } else {
+        wake_cv_.wait_until(wake_lock, delayed_tasks_.top()->deadline);
+      }
+    }
+    sleeping_ = false;
+  }
+
+  std::lock_guard<std::mutex> api_lock(api_mutex_);
+  LOG(INFO) << __func__ << ": task queue finished for thread " << thread_name_;
+  thread_id_ = -1;
+}
+
+void TaskQueueThread::DrainIncomingTasks() {
+  while (!incoming_tasks_.IsEmpty()) {
+    QueuedTask* task = incoming_tasks_.Pop();
+    if (task == nullptr) {
+      // A producer is in the middle of pushing its task
+      std::this_thread::yield();
+      continue;
+    }
+    if (task->deadline == std::chrono::steady_clock::time_point()) {
+      ready_tasks_.push(task);
+    } else {
+      task->sequence = next_sequence_++;
+      delayed_tasks_.push(task);
+    }
+  }
+}
+
+void TaskQueueThread::DropPendingTasks() {
+  DrainIncomingTasks();
+  while (!ready_tasks_.empty()) {
+    delete ready_tasks_.front();
+    ready_tasks_.pop();
+  }
+  while (!delayed_tasks_.empty()) {
+    delete delayed_tasks_.top();
+    delayed_tasks_.pop();
+  }
+}
+
+}  // namespace common
+}  // namespace bluetooth
@@ -0,0 +1,267 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <base/functional/callback.h>
+#include <base/location.h>
+#include <base/threading/platform_thread.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/i_postable_context.h"
+#include "common/mpsc_queue.h"
+
+namespace bluetooth {
+
+namespace common {
+
+/**
+ * A task queued on a TaskQueueThread.
+ *
+ * Callables of up to kInlineSize bytes, which includes base::OnceClosure and
+ * lambdas capturing a few pointers, are stored inside the task itself so that
+ * posting them costs a single allocation. Larger callables are moved to the
+ * heap.
+ */
+class QueuedTask : public MpscQueueNode {
+ public:
+  static constexpr size_t kInlineSize = 6 * sizeof(void*);
+
+  template <typename Callable>
+  explicit QueuedTask(Callable&& callable) {
+    using Stored = std::decay_t<Callable>;
+    if constexpr (sizeof(Stored) <= kInlineSize &&
+                  alignof(Stored) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible_v<Stored>) {
+      new (storage_) Stored(std::forward<Callable>(callable));
+      invoke_ = [](void* storage) { (*static_cast<Stored*>(storage))(); };
+      destroy_ = [](void* storage) {
+        static_cast<Stored*>(storage)->~Stored();
+      };
+    } else {
+      new (storage_) Stored*(new Stored(std::forward<Callable>(callable)));
+      invoke_ = [](void* storage) { (**static_cast<Stored**>(storage))(); };
+      destroy_ = [](void* storage) { delete *static_cast<Stored**>(storage); };
+    }
+  }
+
+  QueuedTask(const QueuedTask&) = delete;
+  QueuedTask& operator=(const QueuedTask&) = delete;
+
+  ~QueuedTask() { destroy_(storage_); }
+
+  void Run() { invoke_(storage_); }
+
+  // Time at which the task becomes ready, the epoch for immediate tasks
+  std::chrono::steady_clock::time_point deadline;
+  // Order in which delayed tasks with the same deadline are run
+  uint64_t sequence = 0;
+
+ private:
+  alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+  void (*invoke_)(void*);
+  void (*destroy_)(void*);
+};
+
+/**
+ * A worker thread that runs tasks posted from any thread, in order.
+ *
+ * This is an alternative to MessageLoopThread for hot paths: tasks are queued
+ * on an intrusive lock-free MpscQueue instead of the libchrome message loop
+ * queue, so posting never takes a lock unless the thread is asleep.
+ *
+ * No libchrome message loop runs on this thread, tasks must not rely on
+ * base::ThreadTaskRunnerHandle or base::RunLoop.
+ */
+class TaskQueueThread final : public IPostableContext {
+ public:
+  /**
+   * Create a task queue thread with name. Thread won't be running until
+   * StartUp is called.
+   *
+   * @param thread_name name of this worker thread
+   */
+  explicit TaskQueueThread(const std::string& thread_name);
+
+  TaskQueueThread(const TaskQueueThread&) = delete;
+  TaskQueueThread& operator=(const TaskQueueThread&) = delete;
+
+  /**
+   * Shut down the thread and destroy the tasks that did not run
+   */
+  ~TaskQueueThread();
+
+  /**
+   * Start the underlying thread. Blocks until the thread is running.
+   *
+   * Repeated call to this method will only start this thread once
+   */
+  void StartUp();
+
+  /**
+   * Run the tasks posted so far, then stop the thread. Delayed tasks that are
+   * not due yet are destroyed without running. Blocks until the thread is
+   * joined. This thread can be re-started again using StartUp()
+   *
+   * NOTE: Should never be called on the thread itself to avoid deadlock
+   */
+  void ShutDown();
+
+  /**
+   * Post a task to run on this thread
+   *
+   * @param from_here location where this task is originated
+   * @param task task created through base::Bind()
+   * @return true if task is successfully scheduled, false if task cannot be
+   * scheduled
+   */
+  bool DoInThread(const base::Location& from_here, base::OnceClosure task);
+
+  /**
+   * Post a task to run on this thread after a specified delay
+   *
+   * @param from_here location where this task is originated
+   * @param task task created through base::Bind()
+   * @param delay delay for the task to be executed
+   * @return true if task is successfully scheduled, false if task cannot be
+   * scheduled
+   */
+  bool DoInThreadDelayed(const base::Location& from_here,
+                         base::OnceClosure task,
+                         std::chrono::microseconds delay);
+
+  /**
+   * Post a callable, such as a lambda, to run on this thread. Small callables
+   * are stored without a separate allocation.
+   *
+   * @param callable callable taking no argument
+   * @return true if task is successfully scheduled, false if task cannot be
+   * scheduled
+   */
+  template <typename Callable>
+  bool DoInThread(Callable&& callable) {
+    return Enqueue(new QueuedTask(std::forward<Callable>(callable)),
+                   std::chrono::microseconds(0));
+  }
+
+  /**
+   * Wrapper around DoInThread without a location.
+   */
+  void Post(base::OnceClosure closure) override;
+
+  /**
+   * Get the current thread ID returned by PlatformThread::CurrentId()
+   *
+   * @return this thread's ID, -1 if the thread is not running
+   */
+  base::PlatformThreadId GetThreadId() const;
+
+  /**
+   * Get this thread's name set in constructor
+   *
+   * @return this thread's name set in constructor
+   */
+  std::string GetName() const;
+
+  /**
+   * Get a string representation of this thread
+   *
+   * @return a string representation of this thread
+   */
+  std::string ToString() const;
+
+  /**
+   * Check if this thread is running
+   *
+   * @return true iff this thread is running and is able to do task
+   */
+  bool IsRunning() const;
+
+ private:
+  struct LaterDeadline {
+    bool operator()(const QueuedTask* a, const QueuedTask* b) const {
+      if (a->deadline != b->deadline) {
+        return a->deadline > b->deadline;
+      }
+      return a->sequence > b->sequence;
+    }
+  };
+
+  /**
+   * Queue a task, deleting it if the thread is not running
+   */
+  bool Enqueue(QueuedTask* task, std::chrono::microseconds delay);
+
+  /**
+   * Actual method to run the thread, blocking until ShutDown() is called
+   */
+  void Run(std::promise<void> start_up_promise);
+
+  /**
+   * Move the queued tasks to the run queue or the delayed tasks
+   */
+  void DrainIncomingTasks();
+
+  /**
+   * Destroy every task that did not run
+   */
+  void DropPendingTasks();
+
+  mutable std::mutex api_mutex_;
+  const std::string thread_name_;
+  std::thread* thread_;
+  base::PlatformThreadId thread_id_;
+  std::atomic<bool> running_;
+  std::atomic<bool> quit_;
+
+  MpscQueue<QueuedTask> incoming_tasks_;
+  // Only accessed by this thread
+  std::queue<QueuedTask*> ready_tasks_;
+  std::priority_queue<QueuedTask*, std::vector<QueuedTask*>, LaterDeadline>
+      delayed_tasks_;
+  uint64_t next_sequence_;
+
+  // Wake up protocol: this thread sets sleeping_ and checks the queue again
+  // under wake_mutex_ before waiting, producers only take wake_mutex_ when
+  // they see sleeping_ set.
+  std::atomic<bool> sleeping_;
+  std::mutex wake_mutex_;
+  std::condition_variable wake_cv_;
+};
+
+inline std::ostream& operator<<(std::ostream& os,
+                                const bluetooth::common::TaskQueueThread& a) {
+  os << a.ToString();
+  return os;
+}
+
+}  // namespace common
+
+}  // namespace bluetooth
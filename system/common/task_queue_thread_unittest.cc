@@ -0,0 +1,151 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "task_queue_thread.h"
+
+#include <array>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <base/functional/bind.h>
+#include <base/threading/platform_thread.h>
+
+using bluetooth::common::TaskQueueThread;
+
+class TaskQueueThreadTest : public ::testing::Test {
+ protected:
+  void SetUp() override { thread_.StartUp(); }
+  void TearDown() override { thread_.ShutDown(); }
+
+  // Wait for the tasks posted so far to run
+  void Sync() {
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    ASSERT_TRUE(thread_.DoInThread([&promise]() { promise.set_value(); }));
+    future.wait();
+  }
+
+  TaskQueueThread thread_{"TaskQueueThreadTest"};
+};
+
+TEST_F(TaskQueueThreadTest, test_running_thread) {
+  EXPECT_TRUE(thread_.IsRunning());
+  EXPECT_NE(thread_.GetThreadId(), -1);
+  EXPECT_EQ(thread_.GetName(), "TaskQueueThreadTest");
+}
+
+TEST_F(TaskQueueThreadTest, test_task_runs_on_thread) {
+  std::promise<base::PlatformThreadId> thread_id_promise;
+  auto thread_id_future = thread_id_promise.get_future();
+  ASSERT_TRUE(thread_.DoInThread(
+      FROM_HERE, base::BindOnce(
+                     [](std::promise<base::PlatformThreadId>* promise) {
+                       promise->set_value(base::PlatformThread::CurrentId());
+                     },
+                     &thread_id_promise)));
+  EXPECT_EQ(thread_id_future.get(), thread_.GetThreadId());
+}
+
+TEST_F(TaskQueueThreadTest, test_tasks_from_each_thread_run_in_order) {
+  constexpr int kProducers = 4;
+  constexpr int kTasksPerProducer = 10000;
+  // Only accessed on thread_
+  std::vector<int> next_value(kProducers, 0);
+  int out_of_order = 0;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; p++) {
+    producers.emplace_back([&, p]() {
+      for (int i = 0; i < kTasksPerProducer; i++) {
+        thread_.DoInThread([&, p, i]() {
+          if (next_value[p] != i) {
+            out_of_order++;
+          }
+          next_value[p] = i + 1;
+        });
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  Sync();
+  EXPECT_EQ(out_of_order, 0);
+  for (int p = 0; p < kProducers; p++) {
+    EXPECT_EQ(next_value[p], kTasksPerProducer);
+  }
+}
+
+TEST_F(TaskQueueThreadTest, test_large_callable) {
+  std::array<uint8_t, 256> payload{};
+  payload[255] = 42;
+  std::promise<int> promise;
+  auto future = promise.get_future();
+  ASSERT_TRUE(thread_.DoInThread(
+      [payload, &promise]() { promise.set_value(payload[255]); }));
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST_F(TaskQueueThreadTest, test_delayed_tasks_run_by_deadline) {
+  std::vector<int> order;
+  std::promise<void> promise;
+  auto future = promise.get_future();
+  auto start = std::chrono::steady_clock::now();
+  thread_.DoInThreadDelayed(
+      FROM_HERE, base::BindOnce([](std::vector<int>* order,
+                                   std::promise<void>* promise) {
+        order->push_back(2);
+        promise->set_value();
+      }, &order, &promise),
+      std::chrono::milliseconds(30));
+  thread_.DoInThreadDelayed(
+      FROM_HERE,
+      base::BindOnce([](std::vector<int>* order) { order->push_back(1); },
+                     &order),
+      std::chrono::milliseconds(10));
+  thread_.DoInThread([&order]() { order.push_back(0); });
+  future.wait();
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(30));
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+}
+
+TEST_F(TaskQueueThreadTest, test_shutdown_runs_pending_tasks) {
+  int counter = 0;
+  for (int i = 0; i < 100; i++) {
+    thread_.DoInThread([&counter]() { counter++; });
+  }
+  auto delayed = std::make_shared<int>(0);
+  thread_.DoInThreadDelayed(
+      FROM_HERE, base::BindOnce([](std::shared_ptr<int>) {}, delayed),
+      std::chrono::seconds(10));
+  thread_.ShutDown();
+  EXPECT_EQ(counter, 100);
+  // The delayed task was destroyed without running
+  EXPECT_EQ(delayed.use_count(), 1);
+  EXPECT_FALSE(thread_.IsRunning());
+}
+
+TEST_F(TaskQueueThreadTest, test_do_in_thread_after_shutdown) {
+  thread_.ShutDown();
+  EXPECT_FALSE(thread_.DoInThread([]() { FAIL() << "Should not happen"; }));
+
+  thread_.StartUp();
+  EXPECT_TRUE(thread_.IsRunning());
+  Sync();
+}
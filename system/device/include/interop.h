@@ -416,3 +416,7 @@ bool interop_get_allowlisted_media_players_list(list_t* p_bl_devices);
 
 // Return feature's enum value according to feature'name.
 int interop_feature_name_to_feature_id(const char* feature_name);
+
+// Return the number of times |feature| was checked against the interop
+// database since the module was initialized.
+uint64_t interop_get_check_count(const interop_feature_t feature);
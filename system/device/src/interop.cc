@@ -32,10 +32,14 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "btcore/include/module.h"
 #include "btif/include/btif_storage.h"
@@ -184,8 +188,228 @@ typedef struct {
     interop_addr_range_entry_t addr_range_entry;
   } entry_type;
 
+  // Position of the entry in |interop_list|, set when it is added
+  uint64_t sequence;
 } interop_db_entry_t;
 
+// Index of the entries of |interop_list|, kept up to date as entries are
+// added and removed, so that a match is a few hash table lookups instead of a
+// walk over the whole database.
+//
+// Address and name entries match any query they are a prefix of. They are
+// indexed by prefix and looked up once per prefix length in use for the
+// feature. Buckets keep their entries in list order so that the first match
+// is the one a walk of |interop_list| would find.
+//
+// Guarded by |interop_list_lock|.
+class InteropDatabaseIndex {
+ public:
+  void Add(interop_db_entry_t* entry) {
+    entry->sequence = next_sequence_++;
+    if (entry->bl_type == INTEROP_BL_TYPE_ADDR_RANGE) {
+      ranges_[Feature(*entry)].push_back(entry);
+      return;
+    }
+    std::string key = EntryKey(*entry);
+    if (IsPrefixType(entry->bl_type)) {
+      prefix_lengths_[PrefixId(*entry)][key.size()]++;
+    }
+    buckets_[std::move(key)].push_back(entry);
+  }
+
+  void Remove(const interop_db_entry_t* entry) {
+    if (entry->bl_type == INTEROP_BL_TYPE_ADDR_RANGE) {
+      EraseFrom(ranges_, Feature(*entry), entry);
+      return;
+    }
+    std::string key = EntryKey(*entry);
+    if (IsPrefixType(entry->bl_type)) {
+      auto lengths = prefix_lengths_.find(PrefixId(*entry));
+      if (lengths != prefix_lengths_.end()) {
+        if (--lengths->second[key.size()] == 0) {
+          lengths->second.erase(key.size());
+        }
+        if (lengths->second.empty()) prefix_lengths_.erase(lengths);
+      }
+    }
+    EraseFrom(buckets_, key, entry);
+  }
+
+  void Clear() {
+    buckets_.clear();
+    prefix_lengths_.clear();
+    ranges_.clear();
+  }
+
+  // Returns the first entry of |interop_list| matching |query|. If
+  // |entry_type| is a single type, only entries of the same type as |query|
+  // are considered.
+  interop_db_entry_t* Match(const interop_db_entry_t& query,
+                            interop_entry_type entry_type) const {
+    auto accept = [&query, entry_type](const interop_db_entry_t* entry) {
+      if (entry_type != INTEROP_ENTRY_TYPE_STATIC &&
+          entry_type != INTEROP_ENTRY_TYPE_DYNAMIC) {
+        return true;
+      }
+      return entry->bl_entry_type == query.bl_entry_type;
+    };
+
+    if (query.bl_type == INTEROP_BL_TYPE_ADDR_RANGE) {
+      auto ranges = ranges_.find(Feature(query));
+      if (ranges == ranges_.end()) return nullptr;
+      const RawAddress& addr = query.entry_type.addr_range_entry.addr_start;
+      for (interop_db_entry_t* entry : ranges->second) {
+        const interop_addr_range_entry_t& range =
+            entry->entry_type.addr_range_entry;
+        if (addr >= range.addr_start && addr <= range.addr_end &&
+            accept(entry)) {
+          return entry;
+        }
+      }
+      return nullptr;
+    }
+
+    if (!IsPrefixType(query.bl_type)) {
+      auto bucket = buckets_.find(EntryKey(query));
+      if (bucket == buckets_.end()) return nullptr;
+      auto entry =
+          std::find_if(bucket->second.begin(), bucket->second.end(), accept);
+      return entry == bucket->second.end() ? nullptr : *entry;
+    }
+
+    auto lengths = prefix_lengths_.find(PrefixId(query));
+    if (lengths == prefix_lengths_.end()) return nullptr;
+    std::string key = QueryKey(query);
+    interop_db_entry_t* found = nullptr;
+    for (const auto& [length, count] : lengths->second) {
+      if (length > key.size()) break;
+      auto bucket = buckets_.find(key.substr(0, length));
+      if (bucket == buckets_.end()) continue;
+      auto entry =
+          std::find_if(bucket->second.begin(), bucket->second.end(), accept);
+      if (entry != bucket->second.end() &&
+          (found == nullptr || (*entry)->sequence < found->sequence)) {
+        found = *entry;
+      }
+    }
+    return found;
+  }
+
+ private:
+  static bool IsPrefixType(interop_bl_type type) {
+    return type == INTEROP_BL_TYPE_ADDR || type == INTEROP_BL_TYPE_NAME;
+  }
+
+  static uint16_t Feature(const interop_db_entry_t& entry) {
+    switch (entry.bl_type) {
+      case INTEROP_BL_TYPE_ADDR:
+        return entry.entry_type.addr_entry.feature;
+      case INTEROP_BL_TYPE_NAME:
+        return entry.entry_type.name_entry.feature;
+      case INTEROP_BL_TYPE_MANUFACTURE:
+        return entry.entry_type.mnfr_entry.feature;
+      case INTEROP_BL_TYPE_VNDR_PRDT:
+        return entry.entry_type.vnr_pdt_entry.feature;
+      case INTEROP_BL_TYPE_SSR_MAX_LAT:
+        return entry.entry_type.ssr_max_lat_entry.feature;
+      case INTEROP_BL_TYPE_VERSION:
+        return entry.entry_type.version_entry.feature;
+      case INTEROP_BL_TYPE_LMP_VERSION:
+        return entry.entry_type.lmp_version_entry.feature;
+      case INTEROP_BL_TYPE_ADDR_RANGE:
+        return entry.entry_type.addr_range_entry.feature;
+    }
+    return END_OF_INTEROP_LIST;
+  }
+
+  static uint32_t PrefixId(const interop_db_entry_t& entry) {
+    return (uint32_t)entry.bl_type << 16 | Feature(entry);
+  }
+
+  // Type and feature of |entry| followed by |length| bytes of |data|
+  static std::string MakeKey(const interop_db_entry_t& entry, const void* data,
+                             size_t length) {
+    uint16_t feature = Feature(entry);
+    std::string key;
+    key.reserve(1 + sizeof(feature) + length);
+    key.push_back((char)entry.bl_type);
+    key.append((const char*)&feature, sizeof(feature));
+    key.append((const char*)data, length);
+    return key;
+  }
+
+  // Names match regardless of case
+  static std::string NameKey(const interop_db_entry_t& entry) {
+    std::string key = MakeKey(entry, entry.entry_type.name_entry.name,
+                              strlen(entry.entry_type.name_entry.name));
+    for (size_t i = 1 + sizeof(uint16_t); i < key.size(); i++) {
+      key[i] = tolower((unsigned char)key[i]);
+    }
+    return key;
+  }
+
+  // Key of a database entry, the prefix to match for address and name entries
+  static std::string EntryKey(const interop_db_entry_t& entry) {
+    switch (entry.bl_type) {
+      case INTEROP_BL_TYPE_ADDR:
+        return MakeKey(entry, &entry.entry_type.addr_entry.addr,
+                       std::min(entry.entry_type.addr_entry.length,
+                                sizeof(RawAddress)));
+      case INTEROP_BL_TYPE_NAME:
+        return NameKey(entry);
+      case INTEROP_BL_TYPE_MANUFACTURE:
+        return MakeKey(entry, &entry.entry_type.mnfr_entry.manufacturer,
+                       sizeof(uint16_t));
+      case INTEROP_BL_TYPE_VNDR_PRDT: {
+        uint16_t ids[] = {entry.entry_type.vnr_pdt_entry.vendor_id,
+                          entry.entry_type.vnr_pdt_entry.product_id};
+        return MakeKey(entry, ids, sizeof(ids));
+      }
+      case INTEROP_BL_TYPE_SSR_MAX_LAT:
+        return MakeKey(entry, &entry.entry_type.ssr_max_lat_entry.addr, 3);
+      case INTEROP_BL_TYPE_VERSION:
+        return MakeKey(entry, &entry.entry_type.version_entry.version,
+                       sizeof(uint16_t));
+      case INTEROP_BL_TYPE_LMP_VERSION:
+        return MakeKey(entry, &entry.entry_type.lmp_version_entry.addr, 3);
+      case INTEROP_BL_TYPE_ADDR_RANGE:
+        break;
+    }
+    return MakeKey(entry, nullptr, 0);
+  }
+
+  // Key of a queried address or name, that matching entries are a prefix of
+  static std::string QueryKey(const interop_db_entry_t& query) {
+    if (query.bl_type == INTEROP_BL_TYPE_NAME) return NameKey(query);
+    return MakeKey(query, &query.entry_type.addr_entry.addr,
+                   sizeof(RawAddress));
+  }
+
+  template <typename Map, typename Key>
+  static void EraseFrom(Map& map, const Key& key,
+                        const interop_db_entry_t* entry) {
+    auto bucket = map.find(key);
+    if (bucket == map.end()) return;
+    auto& entries = bucket->second;
+    entries.erase(std::remove(entries.begin(), entries.end(), entry),
+                  entries.end());
+    if (entries.empty()) map.erase(bucket);
+  }
+
+  std::unordered_map<std::string, std::vector<interop_db_entry_t*>> buckets_;
+  // Prefix lengths of the keys of address and name entries per type and
+  // feature, with the number of entries of each length
+  std::unordered_map<uint32_t, std::map<size_t, size_t>> prefix_lengths_;
+  // Address range entries per feature
+  std::unordered_map<uint16_t, std::vector<interop_db_entry_t*>> ranges_;
+  uint64_t next_sequence_ = 0;
+};
+
+static InteropDatabaseIndex interop_db_index;
+
+// Number of checks of each feature since the module was initialized
+static std::atomic<uint64_t> interop_check_count[END_OF_INTEROP_LIST];
+
 static const char* interop_feature_string_(const interop_feature_t feature);
 static void interop_free_entry_(void* data);
 static void interop_lazy_init_(void);
@@ -207,6 +431,12 @@ static void interop_config_flush(void);
 static bool interop_config_remove(const std::string& section,
                                   const std::string& key);
 
+static void interop_count_check_(const interop_feature_t feature) {
+  if (feature < END_OF_INTEROP_LIST) {
+    interop_check_count[feature].fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
 // Interface functions
 
 bool interop_match_addr(const interop_feature_t feature,
@@ -265,6 +495,11 @@ void interop_database_add(const uint16_t feature, const RawAddress* addr,
   interop_database_add_addr(feature, addr, length);
 }
 
+uint64_t interop_get_check_count(const interop_feature_t feature) {
+  if (feature >= END_OF_INTEROP_LIST) return 0;
+  return interop_check_count[feature].load(std::memory_order_relaxed);
+}
+
 void interop_database_clear() {
   LOG_DEBUG("interop_is_initialized: %d interop_list: %p",
             interop_is_initialized, interop_list);
@@ -297,6 +532,9 @@ static void interop_init_feature_name_id_map() {
 // Module life-cycle functions
 static future_t* interop_init(void) {
   interop_init_feature_name_id_map();
+  for (auto& count : interop_check_count) {
+    count.store(0, std::memory_order_relaxed);
+  }
 
   interop_lazy_init_();
   interop_is_initialized = true;
@@ -305,6 +543,7 @@ static future_t* interop_init(void) {
 
 static future_t* interop_clean_up(void) {
   pthread_mutex_lock(&interop_list_lock);
+  interop_db_index.Clear();
   list_free(interop_list);
   interop_list = NULL;
   list_free(media_player_list);
@@ -634,6 +873,7 @@ static void interop_database_add_(interop_db_entry_t* db_entry, bool persist) {
 
   if (interop_list) {
     list_append(interop_list, db_entry);
+    interop_db_index.Add(db_entry);
   }
 
   pthread_mutex_unlock(&interop_list_lock);
@@ -650,133 +890,24 @@ static bool interop_database_match(interop_db_entry_t* entry,
                                    interop_db_entry_t** ret_entry,
                                    interop_entry_type entry_type) {
   CHECK(entry);
-  bool found = false;
   pthread_mutex_lock(&interop_list_lock);
   if (interop_list == NULL || list_length(interop_list) == 0) {
     pthread_mutex_unlock(&interop_list_lock);
     return false;
   }
 
-  const list_node_t* node = list_begin(interop_list);
-
-  while (node != list_end(interop_list)) {
-    interop_db_entry_t* db_entry = (interop_db_entry_t*)list_node(node);
-    CHECK(db_entry);
-
-    if (entry->bl_type != db_entry->bl_type) {
-      node = list_next(node);
-      continue;
-    }
-
-    if ((entry_type == INTEROP_ENTRY_TYPE_STATIC) ||
-        (entry_type == INTEROP_ENTRY_TYPE_DYNAMIC)) {
-      if (entry->bl_entry_type != db_entry->bl_entry_type) {
-        node = list_next(node);
-        continue;
-      }
-    }
-
-    switch (db_entry->bl_type) {
-      case INTEROP_BL_TYPE_ADDR: {
-        interop_addr_entry_t* src = &entry->entry_type.addr_entry;
-        interop_addr_entry_t* cur = &db_entry->entry_type.addr_entry;
-        if ((src->feature == cur->feature) &&
-            (!memcmp(&src->addr, &cur->addr, cur->length))) {
-          /* cur len is used to remove src entry from config file, when
-           * interop_database_remove_addr is called. */
-          src->length = cur->length;
-          found = true;
-        }
-        break;
-      }
-      case INTEROP_BL_TYPE_NAME: {
-        interop_name_entry_t* src = &entry->entry_type.name_entry;
-        interop_name_entry_t* cur = &db_entry->entry_type.name_entry;
-
-        if ((src->feature == cur->feature) &&
-            (strcasestr(src->name, cur->name) == src->name)) {
-          found = true;
-        }
-        break;
-      }
-      case INTEROP_BL_TYPE_MANUFACTURE: {
-        interop_manufacturer_t* src = &entry->entry_type.mnfr_entry;
-        interop_manufacturer_t* cur = &db_entry->entry_type.mnfr_entry;
-
-        if (src->feature == cur->feature &&
-            src->manufacturer == cur->manufacturer) {
-          found = true;
-        }
-        break;
-      }
-      case INTEROP_BL_TYPE_VNDR_PRDT: {
-        interop_hid_multitouch_t* src = &entry->entry_type.vnr_pdt_entry;
-        interop_hid_multitouch_t* cur = &db_entry->entry_type.vnr_pdt_entry;
-
-        if ((src->feature == cur->feature) &&
-            (src->vendor_id == cur->vendor_id) &&
-            (src->product_id == cur->product_id)) {
-          found = true;
-        }
-        break;
-      }
-      case INTEROP_BL_TYPE_SSR_MAX_LAT: {
-        interop_hid_ssr_max_lat_t* src = &entry->entry_type.ssr_max_lat_entry;
-        interop_hid_ssr_max_lat_t* cur =
-            &db_entry->entry_type.ssr_max_lat_entry;
-
-        if ((src->feature == cur->feature) &&
-            !memcmp(&src->addr, &cur->addr, 3)) {
-          found = true;
-        }
-        break;
-      }
-      case INTEROP_BL_TYPE_VERSION: {
-        interop_version_t* src = &entry->entry_type.version_entry;
-        interop_version_t* cur = &db_entry->entry_type.version_entry;
-
-        if ((src->feature == cur->feature) && (src->version == cur->version)) {
-          found = true;
-        }
-        break;
-      }
-      case INTEROP_BL_TYPE_LMP_VERSION: {
-        interop_lmp_version_t* src = &entry->entry_type.lmp_version_entry;
-        interop_lmp_version_t* cur = &db_entry->entry_type.lmp_version_entry;
-
-        if ((src->feature == cur->feature) &&
-            (!memcmp(&src->addr, &cur->addr, 3))) {
-          found = true;
-        }
-        break;
-      }
-      case INTEROP_BL_TYPE_ADDR_RANGE: {
-        interop_addr_range_entry_t* src = &entry->entry_type.addr_range_entry;
-        interop_addr_range_entry_t* cur =
-            &db_entry->entry_type.addr_range_entry;
-
-        // src->addr_start has the actual address, which need to be searched in
-        // the range
-        if ((src->feature == cur->feature) &&
-            (src->addr_start >= cur->addr_start) &&
-            (src->addr_start <= cur->addr_end)) {
-          found = true;
-        }
-        break;
-      }
-      default:
-        LOG_ERROR("bl_type: %d not handled", db_entry->bl_type);
-        break;
-    }
-
-    if (found && ret_entry) {
-      *ret_entry = db_entry;
-      break;
+  interop_db_entry_t* db_entry = interop_db_index.Match(*entry, entry_type);
+  if (db_entry != NULL) {
+    if (db_entry->bl_type == INTEROP_BL_TYPE_ADDR) {
+      /* cur len is used to remove src entry from config file, when
+       * interop_database_remove_addr is called. */
+      entry->entry_type.addr_entry.length =
+          db_entry->entry_type.addr_entry.length;
     }
-    node = list_next(node);
+    if (ret_entry) *ret_entry = db_entry;
   }
   pthread_mutex_unlock(&interop_list_lock);
-  return found;
+  return db_entry != NULL;
 }
 
 static bool interop_database_remove_(interop_db_entry_t* entry) {
@@ -791,6 +922,7 @@ static bool interop_database_remove_(interop_db_entry_t* entry) {
 
   // first remove it from linked list
   pthread_mutex_lock(&interop_list_lock);
+  interop_db_index.Remove(ret_entry);
   list_remove(interop_list, (void*)ret_entry);
   pthread_mutex_unlock(&interop_list_lock);
 
@@ -1293,6 +1425,7 @@ void interop_database_add_addr_lmp_version(const interop_feature_t feature,
 
 bool interop_database_match_manufacturer(const interop_feature_t feature,
                                          uint16_t manufacturer) {
+  interop_count_check_(feature);
   interop_db_entry_t entry;
 
   entry.bl_type = INTEROP_BL_TYPE_MANUFACTURE;
@@ -1314,6 +1447,7 @@ bool interop_database_match_manufacturer(const interop_feature_t feature,
 
 bool interop_database_match_name(const interop_feature_t feature,
                                  const char* name) {
+  interop_count_check_(feature);
   char trim_name[KEY_MAX_LENGTH] = {'\0'};
   CHECK(name);
 
@@ -1339,6 +1473,7 @@ bool interop_database_match_name(const interop_feature_t feature,
 
 bool interop_database_match_addr(const interop_feature_t feature,
                                  const RawAddress* addr) {
+  interop_count_check_(feature);
   CHECK(addr);
 
   interop_db_entry_t entry;
@@ -1374,6 +1509,7 @@ bool interop_database_match_addr(const interop_feature_t feature,
 
 bool interop_database_match_vndr_prdt(const interop_feature_t feature,
                                       uint16_t vendor_id, uint16_t product_id) {
+  interop_count_check_(feature);
   interop_db_entry_t entry;
 
   entry.bl_type = INTEROP_BL_TYPE_VNDR_PRDT;
@@ -1398,6 +1534,7 @@ bool interop_database_match_vndr_prdt(const interop_feature_t feature,
 bool interop_database_match_addr_get_max_lat(const interop_feature_t feature,
                                              const RawAddress* addr,
                                              uint16_t* max_lat) {
+  interop_count_check_(feature);
   interop_db_entry_t entry;
   interop_db_entry_t* ret_entry = NULL;
 
@@ -1421,6 +1558,7 @@ bool interop_database_match_addr_get_max_lat(const interop_feature_t feature,
 
 bool interop_database_match_version(const interop_feature_t feature,
                                     uint16_t version) {
+  interop_count_check_(feature);
   interop_db_entry_t entry;
 
   entry.bl_type = INTEROP_BL_TYPE_VERSION;
@@ -1443,6 +1581,7 @@ bool interop_database_match_addr_get_lmp_ver(const interop_feature_t feature,
                                              const RawAddress* addr,
                                              uint8_t* lmp_ver,
                                              uint16_t* lmp_sub_ver) {
+  interop_count_check_(feature);
   interop_db_entry_t entry;
   interop_db_entry_t* ret_entry = NULL;
 
@@ -1579,6 +1718,7 @@ bool interop_database_remove_feature(const interop_feature_t feature) {
 
     if (entry_match) {
       pthread_mutex_lock(&interop_list_lock);
+      interop_db_index.Remove(entry);
       list_remove(interop_list, (void*)entry);
       pthread_mutex_unlock(&interop_list_lock);
     }
@@ -834,3 +834,56 @@ TEST_F(InteropTest, test_dynamic_did_version) {
 
   module_clean_up(&interop_module);
 }
+
+TEST_F(InteropTest, test_dynamic_addr_prefix_lengths) {
+  module_init(&interop_module);
+
+  RawAddress test_address;
+  RawAddress::FromString("11:22:33:44:55:66", test_address);
+  RawAddress other_address;
+  RawAddress::FromString("11:22:77:44:55:66", other_address);
+  RawAddress miss_address;
+  RawAddress::FromString("11:22:33:99:55:66", miss_address);
+
+  interop_database_add_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &test_address,
+                            4);
+  interop_database_add_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &other_address,
+                            3);
+  EXPECT_TRUE(
+      interop_match_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &test_address));
+  EXPECT_TRUE(
+      interop_match_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &other_address));
+  EXPECT_FALSE(
+      interop_match_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &miss_address));
+  EXPECT_FALSE(interop_match_addr(INTEROP_DISABLE_AUTO_PAIRING, &test_address));
+
+  interop_database_remove_addr(INTEROP_DISABLE_SNIFF_DURING_SCO,
+                               &test_address);
+  EXPECT_FALSE(
+      interop_match_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &test_address));
+  EXPECT_TRUE(
+      interop_match_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &other_address));
+
+  interop_database_remove_addr(INTEROP_DISABLE_SNIFF_DURING_SCO,
+                               &other_address);
+  EXPECT_FALSE(
+      interop_match_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &other_address));
+
+  module_clean_up(&interop_module);
+}
+
+TEST_F(InteropTest, test_check_count) {
+  module_init(&interop_module);
+
+  RawAddress test_address;
+  RawAddress::FromString("11:22:33:44:55:66", test_address);
+
+  EXPECT_EQ(interop_get_check_count(INTEROP_DISABLE_SNIFF_DURING_SCO), 0u);
+  interop_match_addr(INTEROP_DISABLE_SNIFF_DURING_SCO, &test_address);
+  interop_match_name(INTEROP_DISABLE_SNIFF_DURING_SCO, "TEST");
+  interop_database_match_version(INTEROP_DISABLE_SNIFF_DURING_SCO, 0x0001);
+  EXPECT_EQ(interop_get_check_count(INTEROP_DISABLE_SNIFF_DURING_SCO), 3u);
+  EXPECT_EQ(interop_get_check_count(INTEROP_DISABLE_AUTO_PAIRING), 0u);
+
+  module_clean_up(&interop_module);
+}
@@ -32,6 +32,7 @@
 #include "DitherGenerator.h"
 #include "Qmf.h"
 #include "Quantiser.h"
+#include "SimdKernels.h"
 #include "SubbandFunctionsCommon.h"
 
 /* Function to carry out a single-channel aptX encode on 4 new PCM samples */
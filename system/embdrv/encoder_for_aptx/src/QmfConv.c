@@ -20,28 +20,20 @@
  *----------------------------------------------------------------------------*/
 
 #include "Qmf.h"
+#include "SimdKernels.h"
 
-void AsmQmfConvO(const int16_t* p1dl_buffPtr, const int16_t* p2dl_buffPtr,
-                 const int32_t* coeffPtr, int32_t* convSumDiff) {
-  /* Since all manipulated data are "int16_t" it is possible to
-   * reduce the number of loads by using int32_t type and manipulating
-   * pairs of data
-   */
-  int32_t acc;
-  // Manual inlining as IAR compiler does not seem to do it itself...
-  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
-  int32_t tmp_round0;
-  int64_t local_acc0;
-  int64_t local_acc1;
+/* Scalar reference of QmfConvOSimd, see SimdKernels.h */
+static void QmfConvOMac(const int16_t* p1dl_buffPtr,
+                        const int16_t* p2dl_buffPtr,
+                        const int32_t* coeffPtr, int64_t* convAcc) {
   int32_t coeffVal0;
   int32_t coeffVal1;
   int16_t data0;
   int16_t data1;
   int16_t data2;
   int16_t data3;
-  int32_t phaseConv[2];
-  int32_t convSum;
-  int32_t convDiff;
+  int64_t local_acc0;
+  int64_t local_acc1;
 
   coeffVal0 = (*(coeffPtr));
   coeffVal1 = (*(coeffPtr + 1));
@@ -139,6 +131,35 @@ void AsmQmfConvO(const int16_t* p1dl_buffPtr, const int16_t* p2dl_buffPtr,
   local_acc0 += ((int64_t)(coeffVal1) * (int64_t)data2);
   local_acc1 += ((int64_t)(coeffVal1) * (int64_t)data3);
 
+  convAcc[0] = local_acc0;
+  convAcc[1] = local_acc1;
+}
+
+void AsmQmfConvO(const int16_t* p1dl_buffPtr, const int16_t* p2dl_buffPtr,
+                 const int32_t* coeffPtr, int32_t* convSumDiff) {
+  /* Since all manipulated data are "int16_t" it is possible to
+   * reduce the number of loads by using int32_t type and manipulating
+   * pairs of data
+   */
+  int32_t acc;
+  // Manual inlining as IAR compiler does not seem to do it itself...
+  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
+  int32_t tmp_round0;
+  int64_t local_acc0;
+  int64_t local_acc1;
+  int64_t convAcc[2];
+  int32_t phaseConv[2];
+  int32_t convSum;
+  int32_t convDiff;
+
+  if (simdKernelsAvailable()) {
+    QmfConvOSimd(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  } else {
+    QmfConvOMac(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  }
+  local_acc0 = convAcc[0];
+  local_acc1 = convAcc[1];
+
   tmp_round0 = (int32_t)local_acc0 & 0x00FFFFL;
 
   local_acc0 += 0x004000L;
@@ -191,22 +212,18 @@ void AsmQmfConvO(const int16_t* p1dl_buffPtr, const int16_t* p2dl_buffPtr,
   *(convSumDiff + 2) = convDiff;
 }
 
-void AsmQmfConvI(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
-                 const int32_t* coeffPtr, int32_t* filterOutputs) {
-  int32_t acc;
-  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
-  int32_t tmp_round0;
-  int64_t local_acc0;
-  int64_t local_acc1;
+/* Scalar reference of QmfConvISimd, see SimdKernels.h */
+static void QmfConvIMac(const int32_t* p1dl_buffPtr,
+                        const int32_t* p2dl_buffPtr,
+                        const int32_t* coeffPtr, int64_t* convAcc) {
   int32_t coeffVal0;
   int32_t coeffVal1;
   int32_t data0;
   int32_t data1;
   int32_t data2;
   int32_t data3;
-  int32_t phaseConv[2];
-  int32_t convSum;
-  int32_t convDiff;
+  int64_t local_acc0;
+  int64_t local_acc1;
 
   coeffVal0 = (*(coeffPtr));
   coeffVal1 = (*(coeffPtr + 1));
@@ -304,6 +321,30 @@ void AsmQmfConvI(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
   local_acc0 += ((int64_t)(coeffVal1)*data2);
   local_acc1 += ((int64_t)(coeffVal1)*data3);
 
+  convAcc[0] = local_acc0;
+  convAcc[1] = local_acc1;
+}
+
+void AsmQmfConvI(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
+                 const int32_t* coeffPtr, int32_t* filterOutputs) {
+  int32_t acc;
+  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
+  int32_t tmp_round0;
+  int64_t local_acc0;
+  int64_t local_acc1;
+  int64_t convAcc[2];
+  int32_t phaseConv[2];
+  int32_t convSum;
+  int32_t convDiff;
+
+  if (simdKernelsAvailable()) {
+    QmfConvISimd(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  } else {
+    QmfConvIMac(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  }
+  local_acc0 = convAcc[0];
+  local_acc1 = convAcc[1];
+
   tmp_round0 = (int32_t)local_acc0;
 
   local_acc0 += 0x00400000L;
@@ -0,0 +1,73 @@
+/**
+ * Copyright (C) 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*------------------------------------------------------------------------------
+ *
+ *  Vector (NEON / SSE4.1) versions of the QMF convolutions and of the
+ *  predictor zero filter. The 64-bit accumulations are exact, so these give
+ *  the same results as the scalar reference code in QmfConv.c and
+ *  SubbandFunctionsCommon.h, which is used when simdKernelsAvailable()
+ *  returns 0.
+ *
+ *----------------------------------------------------------------------------*/
+
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+#ifdef _GCC
+#pragma GCC visibility push(hidden)
+#endif
+
+#include "AptxParameters.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define APTX_SIMD_SSE4 1
+#elif defined(__ARM_NEON)
+#define APTX_SIMD_NEON 1
+#endif
+
+/* Returns 1 if the vector kernels can run on this CPU. SSE4.1 is checked at
+ * runtime, NEON is part of the ARM ABIs the encoder is built for. */
+XBT_INLINE_ int32_t simdKernelsAvailable(void) {
+#if defined(APTX_SIMD_SSE4)
+  return __builtin_cpu_supports("sse4.1") != 0;
+#elif defined(APTX_SIMD_NEON)
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+/* Outer QMF convolution: convAcc[0] is the sum of coeffPtr[k] *
+ * p1dl_buffPtr[-k] and convAcc[1] the sum of coeffPtr[k] * p2dl_buffPtr[k],
+ * for k in [0, 16). */
+void QmfConvOSimd(const int16_t* p1dl_buffPtr, const int16_t* p2dl_buffPtr,
+                  const int32_t* coeffPtr, int64_t* convAcc);
+
+/* Inner QMF convolution, same as QmfConvOSimd on 32-bit delay lines. */
+void QmfConvISimd(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
+                  const int32_t* coeffPtr, int64_t* convAcc);
+
+/* Updates the numZeros zero filter coefficients from the sign of the zero
+ * delay line samples (zDataPt[-k] for coefficient k) and returns the zero
+ * filter convolution of the updated coefficients with the delay line delayed
+ * by one sample, invQ being the newest sample. */
+int64_t zeroFilterSimd(int32_t* zeroCoeffPt, const int32_t* zDataPt,
+                       int32_t invQ, int32_t invQincr_pos,
+                       int32_t invQincr_neg, int32_t numZeros);
+
+#ifdef _GCC
+#pragma GCC visibility pop
+#endif
+#endif  // SIMDKERNELS_H
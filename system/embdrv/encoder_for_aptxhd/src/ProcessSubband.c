@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "AptxParameters.h"
+#include "SimdKernels.h"
 #include "SubbandFunctions.h"
 #include "SubbandFunctionsCommon.h"
 
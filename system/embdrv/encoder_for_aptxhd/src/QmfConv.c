@@ -20,30 +20,20 @@
  *----------------------------------------------------------------------------*/
 
 #include "Qmf.h"
+#include "SimdKernels.h"
 
-void AsmQmfConvO_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
-                    const int32_t* coeffPtr, int32_t* convSumDiff) {
-  /* Since all manipulated data are "int16_t" it is possible to
-   * reduce the number of loads by using int32_t type and manipulating
-   * pairs of data
-   */
-
-  int32_t acc;
-  // Manual inlining as IAR compiler does not seem to do it itself...
-  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
-  int32_t tmp_round0;
-  int64_t local_acc0;
-  int64_t local_acc1;
-
+/* Scalar reference of QmfConvSimd_HD, see SimdKernels.h */
+static void QmfConvOMac_HD(const int32_t* p1dl_buffPtr,
+                           const int32_t* p2dl_buffPtr,
+                           const int32_t* coeffPtr, int64_t* convAcc) {
   int32_t coeffVal0;
   int32_t coeffVal1;
   int32_t data0;
   int32_t data1;
   int32_t data2;
   int32_t data3;
-  int32_t phaseConv[2];
-  int32_t convSum;
-  int32_t convDiff;
+  int64_t local_acc0;
+  int64_t local_acc1;
 
   coeffVal0 = (*(coeffPtr));
   coeffVal1 = (*(coeffPtr + 1));
@@ -141,6 +131,37 @@ void AsmQmfConvO_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
   local_acc0 += ((int64_t)(coeffVal1) * (int64_t)data2);
   local_acc1 += ((int64_t)(coeffVal1) * (int64_t)data3);
 
+  convAcc[0] = local_acc0;
+  convAcc[1] = local_acc1;
+}
+
+void AsmQmfConvO_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
+                    const int32_t* coeffPtr, int32_t* convSumDiff) {
+  /* Since all manipulated data are "int16_t" it is possible to
+   * reduce the number of loads by using int32_t type and manipulating
+   * pairs of data
+   */
+
+  int32_t acc;
+  // Manual inlining as IAR compiler does not seem to do it itself...
+  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
+  int32_t tmp_round0;
+  int64_t local_acc0;
+  int64_t local_acc1;
+  int64_t convAcc[2];
+
+  int32_t phaseConv[2];
+  int32_t convSum;
+  int32_t convDiff;
+
+  if (simdKernelsAvailable()) {
+    QmfConvSimd_HD(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  } else {
+    QmfConvOMac_HD(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  }
+  local_acc0 = convAcc[0];
+  local_acc1 = convAcc[1];
+
   tmp_round0 = (int32_t)local_acc0;
 
   local_acc0 += 0x00400000L;
@@ -196,23 +217,18 @@ void AsmQmfConvO_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
   *(convSumDiff + 2) = convDiff;
 }
 
-void AsmQmfConvI_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
-                    const int32_t* coeffPtr, int32_t* filterOutputs) {
-  int32_t acc;
-  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
-  int32_t tmp_round0;
-  int64_t local_acc0;
-  int64_t local_acc1;
-
+/* Scalar reference of QmfConvSimd_HD, see SimdKernels.h */
+static void QmfConvIMac_HD(const int32_t* p1dl_buffPtr,
+                           const int32_t* p2dl_buffPtr,
+                           const int32_t* coeffPtr, int64_t* convAcc) {
   int32_t coeffVal0;
   int32_t coeffVal1;
   int32_t data0;
   int32_t data1;
   int32_t data2;
   int32_t data3;
-  int32_t phaseConv[2];
-  int32_t convSum;
-  int32_t convDiff;
+  int64_t local_acc0;
+  int64_t local_acc1;
 
   coeffVal0 = (*(coeffPtr));
   coeffVal1 = (*(coeffPtr + 1));
@@ -310,6 +326,31 @@ void AsmQmfConvI_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
   local_acc0 += ((int64_t)(coeffVal1)*data2);
   local_acc1 += ((int64_t)(coeffVal1)*data3);
 
+  convAcc[0] = local_acc0;
+  convAcc[1] = local_acc1;
+}
+
+void AsmQmfConvI_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
+                    const int32_t* coeffPtr, int32_t* filterOutputs) {
+  int32_t acc;
+  // WARNING: This inlining assumes that m_qmfDelayLineLength == 16
+  int32_t tmp_round0;
+  int64_t local_acc0;
+  int64_t local_acc1;
+  int64_t convAcc[2];
+
+  int32_t phaseConv[2];
+  int32_t convSum;
+  int32_t convDiff;
+
+  if (simdKernelsAvailable()) {
+    QmfConvSimd_HD(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  } else {
+    QmfConvIMac_HD(p1dl_buffPtr, p2dl_buffPtr, coeffPtr, convAcc);
+  }
+  local_acc0 = convAcc[0];
+  local_acc1 = convAcc[1];
+
   tmp_round0 = (int32_t)local_acc0;
 
   local_acc0 += 0x00400000L;
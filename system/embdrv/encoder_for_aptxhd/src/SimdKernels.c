@@ -0,0 +1,223 @@
+/**
+ * Copyright (C) 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SimdKernels.h"
+
+#include <stdlib.h>
+
+#if defined(APTX_SIMD_SSE4)
+#include <smmintrin.h>
+#define SIMD_TARGET_ __attribute__((target("sse4.1")))
+#elif defined(APTX_SIMD_NEON)
+#include <arm_neon.h>
+#define SIMD_TARGET_
+#endif
+
+#if defined(APTX_SIMD_SSE4) || defined(APTX_SIMD_NEON)
+
+/* Scalar zero filter for the coefficients left over after the groups of 4 */
+static int64_t zeroFilterTail(int32_t* zeroCoeffPt, const int32_t* zDataPt,
+                              int32_t oldZData, int32_t invQincr_pos,
+                              int32_t invQincr_neg, int32_t k,
+                              int32_t numZeros) {
+  int64_t accL = 0;
+  for (; k < numZeros; k++) {
+    int32_t zData0 = *(zDataPt - k);
+    int32_t coeffValue = *(zeroCoeffPt + k);
+    int32_t acc;
+    if (zData0 < 0L) {
+      acc = invQincr_neg - coeffValue;
+    } else {
+      acc = invQincr_pos - coeffValue;
+    }
+    if ((acc & 0x1FF) == 0x100) {
+      coeffValue--;
+    }
+    acc = (acc >> 8) + coeffValue;
+    accL += (int64_t)acc * (int64_t)(oldZData);
+    oldZData = zData0;
+    *(zeroCoeffPt + k) = acc;
+  }
+  return accL;
+}
+
+#endif
+
+#if defined(APTX_SIMD_SSE4)
+
+#define REVERSE_LANES_ _MM_SHUFFLE(0, 1, 2, 3)
+
+/* acc += the 64-bit products of the signed 32-bit lanes of a and b */
+SIMD_TARGET_ static __m128i mulAcc(__m128i acc, __m128i a, __m128i b) {
+  acc = _mm_add_epi64(acc, _mm_mul_epi32(a, b));
+  return _mm_add_epi64(acc, _mm_mul_epi32(_mm_srli_epi64(a, 32),
+                                          _mm_srli_epi64(b, 32)));
+}
+
+SIMD_TARGET_ static int64_t sumLanes(__m128i acc) {
+  int64_t lanes[2];
+  _mm_storeu_si128((__m128i*)lanes, acc);
+  return lanes[0] + lanes[1];
+}
+
+/* Stores the sums of the lanes of acc0 and acc1 to convAcc[0] and [1] */
+SIMD_TARGET_ static void storeSums(__m128i acc0, __m128i acc1,
+                                   int64_t* convAcc) {
+  _mm_storeu_si128((__m128i*)convAcc,
+                   _mm_add_epi64(_mm_unpacklo_epi64(acc0, acc1),
+                                 _mm_unpackhi_epi64(acc0, acc1)));
+}
+
+SIMD_TARGET_ void QmfConvSimd_HD(const int32_t* p1dl_buffPtr,
+                                 const int32_t* p2dl_buffPtr,
+                                 const int32_t* coeffPtr, int64_t* convAcc) {
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+  int32_t k;
+
+  for (k = 0; k < 16; k += 4) {
+    __m128i coeff = _mm_loadu_si128((const __m128i*)(coeffPtr + k));
+    __m128i data1 = _mm_loadu_si128((const __m128i*)(p1dl_buffPtr - k - 3));
+    __m128i data2 = _mm_loadu_si128((const __m128i*)(p2dl_buffPtr + k));
+    acc0 = mulAcc(acc0, coeff, _mm_shuffle_epi32(data1, REVERSE_LANES_));
+    acc1 = mulAcc(acc1, coeff, data2);
+  }
+  storeSums(acc0, acc1, convAcc);
+}
+
+SIMD_TARGET_ int64_t zeroFilterSimd_HD(int32_t* zeroCoeffPt,
+                                       const int32_t* zDataPt, int32_t invQ,
+                                       int32_t invQincr_pos,
+                                       int32_t invQincr_neg,
+                                       int32_t numZeros) {
+  const __m128i incrPos = _mm_set1_epi32(invQincr_pos);
+  const __m128i incrNeg = _mm_set1_epi32(invQincr_neg);
+  const __m128i roundMask = _mm_set1_epi32(0x1FF);
+  const __m128i roundTie = _mm_set1_epi32(0x100);
+  __m128i prevData = _mm_set1_epi32(invQ);
+  __m128i acc = _mm_setzero_si128();
+  int32_t k;
+
+  for (k = 0; k + 4 <= numZeros; k += 4) {
+    __m128i zData = _mm_shuffle_epi32(
+        _mm_loadu_si128((const __m128i*)(zDataPt - k - 3)), REVERSE_LANES_);
+    __m128i coeff = _mm_loadu_si128((const __m128i*)(zeroCoeffPt + k));
+    __m128i incr = _mm_blendv_epi8(
+        incrPos, incrNeg, _mm_cmplt_epi32(zData, _mm_setzero_si128()));
+    __m128i diff = _mm_sub_epi32(incr, coeff);
+    /* Same rounding correction as the reference, the comparison is -1 */
+    coeff = _mm_add_epi32(_mm_srai_epi32(diff, 8), coeff);
+    coeff = _mm_add_epi32(
+        coeff, _mm_cmpeq_epi32(_mm_and_si128(diff, roundMask), roundTie));
+    _mm_storeu_si128((__m128i*)(zeroCoeffPt + k), coeff);
+    /* Each coefficient multiplies the sample preceding its own */
+    acc = mulAcc(acc, coeff, _mm_alignr_epi8(zData, prevData, 12));
+    prevData = zData;
+  }
+  return sumLanes(acc) +
+         zeroFilterTail(zeroCoeffPt, zDataPt, _mm_extract_epi32(prevData, 3),
+                        invQincr_pos, invQincr_neg, k, numZeros);
+}
+
+#elif defined(APTX_SIMD_NEON)
+
+/* acc += the 64-bit products of the signed 32-bit lanes of a and b */
+static int64x2_t mulAcc(int64x2_t acc, int32x4_t a, int32x4_t b) {
+  acc = vmlal_s32(acc, vget_low_s32(a), vget_low_s32(b));
+  return vmlal_s32(acc, vget_high_s32(a), vget_high_s32(b));
+}
+
+static int64_t sumLanes(int64x2_t acc) {
+  return vgetq_lane_s64(acc, 0) + vgetq_lane_s64(acc, 1);
+}
+
+static int32x4_t reverseLanes(int32x4_t v) {
+  v = vrev64q_s32(v);
+  return vcombine_s32(vget_high_s32(v), vget_low_s32(v));
+}
+
+void QmfConvSimd_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
+                    const int32_t* coeffPtr, int64_t* convAcc) {
+  int64x2_t acc0 = vdupq_n_s64(0);
+  int64x2_t acc1 = vdupq_n_s64(0);
+  int32_t k;
+
+  for (k = 0; k < 16; k += 4) {
+    int32x4_t coeff = vld1q_s32(coeffPtr + k);
+    int32x4_t data1 = reverseLanes(vld1q_s32(p1dl_buffPtr - k - 3));
+    int32x4_t data2 = vld1q_s32(p2dl_buffPtr + k);
+    acc0 = mulAcc(acc0, coeff, data1);
+    acc1 = mulAcc(acc1, coeff, data2);
+  }
+  convAcc[0] = sumLanes(acc0);
+  convAcc[1] = sumLanes(acc1);
+}
+
+int64_t zeroFilterSimd_HD(int32_t* zeroCoeffPt, const int32_t* zDataPt,
+                          int32_t invQ, int32_t invQincr_pos,
+                          int32_t invQincr_neg, int32_t numZeros) {
+  const int32x4_t incrPos = vdupq_n_s32(invQincr_pos);
+  const int32x4_t incrNeg = vdupq_n_s32(invQincr_neg);
+  const int32x4_t roundMask = vdupq_n_s32(0x1FF);
+  const int32x4_t roundTie = vdupq_n_s32(0x100);
+  int32x4_t prevData = vdupq_n_s32(invQ);
+  int64x2_t acc = vdupq_n_s64(0);
+  int32_t k;
+
+  for (k = 0; k + 4 <= numZeros; k += 4) {
+    int32x4_t zData = reverseLanes(vld1q_s32(zDataPt - k - 3));
+    int32x4_t coeff = vld1q_s32(zeroCoeffPt + k);
+    int32x4_t incr =
+        vbslq_s32(vcltq_s32(zData, vdupq_n_s32(0)), incrNeg, incrPos);
+    int32x4_t diff = vsubq_s32(incr, coeff);
+    /* Same rounding correction as the reference, the comparison is -1 */
+    coeff = vaddq_s32(vshrq_n_s32(diff, 8), coeff);
+    coeff = vaddq_s32(coeff, vreinterpretq_s32_u32(vceqq_s32(
+                                 vandq_s32(diff, roundMask), roundTie)));
+    vst1q_s32(zeroCoeffPt + k, coeff);
+    /* Each coefficient multiplies the sample preceding its own */
+    acc = mulAcc(acc, coeff, vextq_s32(prevData, zData, 3));
+    prevData = zData;
+  }
+  return sumLanes(acc) +
+         zeroFilterTail(zeroCoeffPt, zDataPt, vgetq_lane_s32(prevData, 3),
+                        invQincr_pos, invQincr_neg, k, numZeros);
+}
+
+#else
+
+/* simdKernelsAvailable() returns 0, the scalar code is used instead */
+void QmfConvSimd_HD(const int32_t* p1dl_buffPtr, const int32_t* p2dl_buffPtr,
+                    const int32_t* coeffPtr, int64_t* convAcc) {
+  (void)p1dl_buffPtr;
+  (void)p2dl_buffPtr;
+  (void)coeffPtr;
+  (void)convAcc;
+  abort();
+}
+
+int64_t zeroFilterSimd_HD(int32_t* zeroCoeffPt, const int32_t* zDataPt,
+                          int32_t invQ, int32_t invQincr_pos,
+                          int32_t invQincr_neg, int32_t numZeros) {
+  (void)zeroCoeffPt;
+  (void)zDataPt;
+  (void)invQ;
+  (void)invQincr_pos;
+  (void)invQincr_neg;
+  (void)numZeros;
+  abort();
+}
+
+#endif
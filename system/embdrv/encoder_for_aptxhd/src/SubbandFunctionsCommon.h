@@ -295,29 +295,34 @@ XBT_INLINE_ void performPredictionFiltering(const int32_t invQ,
   SubbandDataPt->m_predData.m_zeroDelayLine.modulo = invQ;
 
   /* Iterate over the number of coefficients for this subband */
-  oldZData = invQ;
-  accL = 0;
-  for (k = 0; k < 12; k++) {
-    uint32_t tmp_round0;
-    int32_t coeffValue;
-    int32_t zData0;
-
-    /* ------------------------------------------------------------------*/
-    zData0 = (*(cbuf_pt--));
-    coeffValue = *(zeroCoeffPt + k);
-    if (zData0 < 0L) {
-      acc = invQincr_neg - coeffValue;
-    } else {
-      acc = invQincr_pos - coeffValue;
-    }
-    tmp_round0 = acc;
-    acc = (acc >> 8) + coeffValue;
-    if (((tmp_round0 << 23) ^ 0x80000000) == 0) {
-      acc--;
+  if (simdKernelsAvailable()) {
+    accL = zeroFilterSimd_HD(zeroCoeffPt, cbuf_pt, invQ, invQincr_pos,
+                             invQincr_neg, 12);
+  } else {
+    oldZData = invQ;
+    accL = 0;
+    for (k = 0; k < 12; k++) {
+      uint32_t tmp_round0;
+      int32_t coeffValue;
+      int32_t zData0;
+
+      /* ------------------------------------------------------------------*/
+      zData0 = (*(cbuf_pt--));
+      coeffValue = *(zeroCoeffPt + k);
+      if (zData0 < 0L) {
+        acc = invQincr_neg - coeffValue;
+      } else {
+        acc = invQincr_pos - coeffValue;
+      }
+      tmp_round0 = acc;
+      acc = (acc >> 8) + coeffValue;
+      if (((tmp_round0 << 23) ^ 0x80000000) == 0) {
+        acc--;
+      }
+      accL += (int64_t)acc * (int64_t)(oldZData);
+      oldZData = zData0;
+      *(zeroCoeffPt + k) = acc;
     }
-    accL += (int64_t)acc * (int64_t)(oldZData);
-    oldZData = zData0;
-    *(zeroCoeffPt + k) = acc;
   }
 
   acc = (int32_t)(accL >> 22);
@@ -402,26 +407,31 @@ XBT_INLINE_ void performPredictionFilteringLL(const int32_t invQ,
   SubbandDataPt->m_predData.m_zeroDelayLine.modulo = invQ;
 
   /* Iterate over the number of coefficients for this subband */
-  oldZData = invQ;
-  accL = 0;
-  for (k = 0; k < 24; k++) {
-    int32_t zData0;
-    int32_t coeffValue;
-
-    zData0 = (*(cbuf_pt--));
-    coeffValue = *(zeroCoeffPt + k);
-    if (zData0 < 0L) {
-      acc = invQincr_neg - coeffValue;
-    } else {
-      acc = invQincr_pos - coeffValue;
-    }
-    if (((acc << 23) ^ 0x80000000) == 0) {
-      coeffValue--;
+  if (simdKernelsAvailable()) {
+    accL = zeroFilterSimd_HD(zeroCoeffPt, cbuf_pt, invQ, invQincr_pos,
+                             invQincr_neg, 24);
+  } else {
+    oldZData = invQ;
+    accL = 0;
+    for (k = 0; k < 24; k++) {
+      int32_t zData0;
+      int32_t coeffValue;
+
+      zData0 = (*(cbuf_pt--));
+      coeffValue = *(zeroCoeffPt + k);
+      if (zData0 < 0L) {
+        acc = invQincr_neg - coeffValue;
+      } else {
+        acc = invQincr_pos - coeffValue;
+      }
+      if (((acc << 23) ^ 0x80000000) == 0) {
+        coeffValue--;
+      }
+      acc = (acc >> 8) + coeffValue;
+      accL += (int64_t)acc * (int64_t)(oldZData);
+      oldZData = zData0;
+      *(zeroCoeffPt + k) = acc;
     }
-    acc = (acc >> 8) + coeffValue;
-    accL += (int64_t)acc * (int64_t)(oldZData);
-    oldZData = zData0;
-    *(zeroCoeffPt + k) = acc;
   }
 
   acc = (int32_t)(accL >> 22);
@@ -505,30 +515,35 @@ XBT_INLINE_ void performPredictionFilteringHL(const int32_t invQ,
   SubbandDataPt->m_predData.m_zeroDelayLine.modulo = invQ;
 
   /* Iterate over the number of coefficients for this subband */
-  oldZData = invQ;
-  accL = 0;
-
-  for (k = 0; k < 6; k++) {
-    uint32_t tmp_round0;
-    int32_t coeffValue;
-    int32_t zData0;
-
-    /* ------------------------------------------------------------------*/
-    zData0 = (*(cbuf_pt--));
-    coeffValue = *(zeroCoeffPt + k);
-    if (zData0 < 0L) {
-      acc = invQincr_neg - coeffValue;
-    } else {
-      acc = invQincr_pos - coeffValue;
-    }
-    tmp_round0 = acc;
-    acc = (acc >> 8) + coeffValue;
-    if (((tmp_round0 << 23) ^ roundCte) == 0) {
-      acc--;
+  if (simdKernelsAvailable()) {
+    accL = zeroFilterSimd_HD(zeroCoeffPt, cbuf_pt, invQ, invQincr_pos,
+                             invQincr_neg, 6);
+  } else {
+    oldZData = invQ;
+    accL = 0;
+
+    for (k = 0; k < 6; k++) {
+      uint32_t tmp_round0;
+      int32_t coeffValue;
+      int32_t zData0;
+
+      /* ------------------------------------------------------------------*/
+      zData0 = (*(cbuf_pt--));
+      coeffValue = *(zeroCoeffPt + k);
+      if (zData0 < 0L) {
+        acc = invQincr_neg - coeffValue;
+      } else {
+        acc = invQincr_pos - coeffValue;
+      }
+      tmp_round0 = acc;
+      acc = (acc >> 8) + coeffValue;
+      if (((tmp_round0 << 23) ^ roundCte) == 0) {
+        acc--;
+      }
+      accL += (int64_t)acc * (int64_t)(oldZData);
+      oldZData = zData0;
+      *(zeroCoeffPt + k) = acc;
     }
-    accL += (int64_t)acc * (int64_t)(oldZData);
-    oldZData = zData0;
-    *(zeroCoeffPt + k) = acc;
   }
 
   acc = (int32_t)(accL >> 22);
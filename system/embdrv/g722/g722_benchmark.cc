@@ -0,0 +1,119 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <dirent.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "g722_enc_dec.h"
+
+using ::benchmark::State;
+
+// The inputs are the files of the fuzzer corpus given with
+// `--corpus=<directory>`, or one second of pseudo random noise at 16 kHz
+// when no corpus is given.
+static std::vector<std::vector<uint8_t>> corpus;
+
+static void LoadCorpus(const char* path) {
+  DIR* dir = opendir(path);
+  if (dir == nullptr) return;
+
+  for (struct dirent* entry; (entry = readdir(dir)) != nullptr;) {
+    if (entry->d_name[0] == '.') continue;
+    std::ifstream file(std::string(path) + "/" + entry->d_name,
+                       std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    if (!data.empty()) corpus.push_back(std::move(data));
+  }
+  closedir(dir);
+}
+
+static void LoadNoise() {
+  std::vector<uint8_t> data(16000 * sizeof(int16_t));
+  uint32_t seed = 1;
+  for (auto& byte : data) {
+    seed = seed * 1103515245u + 12345u;
+    byte = seed >> 16;
+  }
+  corpus.push_back(std::move(data));
+}
+
+static void BM_G722Encode(State& state) {
+  std::vector<std::vector<int16_t>> pcm;
+  for (const auto& data : corpus) {
+    // The encoder accepts only an even number of samples
+    std::vector<int16_t> samples(data.size() / 4 * 2);
+    memcpy(samples.data(), data.data(), samples.size() * sizeof(int16_t));
+    for (auto& sample : samples) sample >>= 1;
+    pcm.push_back(std::move(samples));
+  }
+
+  size_t num_samples = 0;
+  for (auto _ : state) {
+    for (const auto& samples : pcm) {
+      std::vector<uint8_t> encoded(samples.size() / 2);
+      g722_encode_state_t* encoder = g722_encode_init(nullptr, 64000, 0);
+      int len = g722_encode(encoder, encoded.data(), samples.data(),
+                            samples.size());
+      benchmark::DoNotOptimize(len);
+      g722_encode_release(encoder);
+      num_samples += samples.size();
+    }
+  }
+  state.SetItemsProcessed(num_samples);
+}
+BENCHMARK(BM_G722Encode);
+
+static void BM_G722Decode(State& state) {
+  size_t num_samples = 0;
+  for (auto _ : state) {
+    for (const auto& data : corpus) {
+      std::vector<int16_t> decoded(data.size() * 2);
+      g722_decode_state_t* decoder = g722_decode_init(nullptr, 64000, 0);
+      uint32_t len = g722_decode(decoder, decoded.data(), data.data(),
+                                 data.size(), 0xffff);
+      benchmark::DoNotOptimize(len);
+      g722_decode_release(decoder);
+      num_samples += len;
+    }
+  }
+  state.SetItemsProcessed(num_samples);
+}
+BENCHMARK(BM_G722Decode);
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--corpus=", 9) == 0) {
+      LoadCorpus(argv[i] + 9);
+      for (int j = i; j < argc; j++) argv[j] = argv[j + 1];
+      argc--;
+      i--;
+    }
+  }
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  if (corpus.empty()) LoadNoise();
+  ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -30,6 +30,7 @@
 
 #include "g722_typedefs.h"
 #include "g722_enc_dec.h"
+#include "g722_qmf.h"
 
 #if !defined(FALSE)
 #define FALSE 0
@@ -252,14 +253,6 @@ static int16_t qm6[64] =
       1688,   1360,   1040,    728,
        432,    136,   -432,   -136
 };
-static int16_t qmf_coeffs_even[12] =
-{
-      3,  -11,   12,   32, -210,  951, 3876, -805,  362, -156,   53,  -11,
-};
-static int16_t qmf_coeffs_odd[12] =
-{
-    -11,   53, -156,  362, -805, 3876, 951,  -210,   32,   12,  -11,    3
-};
 
 uint32_t g722_decode(g722_decode_state_t *s, int16_t amp[], const uint8_t g722_data[], int len, uint16_t gain)
 {
@@ -276,7 +269,6 @@ uint32_t g722_decode(g722_decode_state_t *s, int16_t amp[], const uint8_t g722_d
     int wd3;
     int code;
     uint32_t outlen;
-    int i;
     int j;
 
     outlen = 0;
@@ -390,19 +382,8 @@ uint32_t g722_decode(g722_decode_state_t *s, int16_t amp[], const uint8_t g722_d
         block4(&s->band[1], dhigh);
 
         /* Apply the receive QMF */
-        for (i = 0;  i < 22;  i++)
-            s->x[i] = s->x[i + 2];
-        s->x[22] = rlow + rhigh;
-        s->x[23] = rlow - rhigh;
-
-        // we should get PERF numbers for the following loop 
-        xout1 = 0;
-        xout2 = 0;
-        for (i = 0;  i < 12;  i++)
-        {
-            xout2 += s->x[2*i]   * qmf_coeffs_even[i];
-            xout1 += s->x[2*i+1] * qmf_coeffs_odd[i];
-        }
+        g722_qmf_push(s->x, rlow + rhigh, rlow - rhigh);
+        g722_qmf_filter(s->x, &xout2, &xout1);
         xout1 = NLDECOMPRESS_PREPROCESS_SAMPLE_WITH_GAIN((int16_t) __ssat16(xout1 >> 11), gain);
         xout2 = NLDECOMPRESS_PREPROCESS_SAMPLE_WITH_GAIN((int16_t) __ssat16(xout2 >> 11), gain);
         if (s->dac_pcm)
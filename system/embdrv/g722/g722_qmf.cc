@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "g722_qmf.h"
+
+#include <stdint.h>
+
+/* QMF coefficients interleaved for the even and odd positions of the
+ * signal history: kQmfCoeffs[2*i] = qmf_coeffs[i] and
+ * kQmfCoeffs[2*i + 1] = qmf_coeffs[11 - i]. */
+alignas(16) static const int32_t kQmfCoeffs[24] = {
+    3,    -11, -11,  53,  12,  -156, 32,   362, -210, -805, 951, 3876,
+    3876, 951, -805, -210, 362, 32,  -156, 12,  53,   -11,  -11, 3,
+};
+
+//
+// Generic QMF Filtering
+//
+
+static inline void FilterGeneric(const int x[24], int* sum_even,
+                                 int* sum_odd) {
+  int even = 0;
+  int odd = 0;
+  for (int i = 0; i < 24; i += 2) {
+    even += x[i] * kQmfCoeffs[i];
+    odd += x[i + 1] * kQmfCoeffs[i + 1];
+  }
+  *sum_even = even;
+  *sum_odd = odd;
+}
+
+#if __ARM_NEON
+
+//
+// ARM Neon QMF Filtering
+//
+
+#include <arm_neon.h>
+
+void g722_qmf_filter(const int x[24], int* sum_even, int* sum_odd) {
+  int32x4_t s = vmulq_s32(vld1q_s32(x), vld1q_s32(kQmfCoeffs));
+  for (int i = 4; i < 24; i += 4)
+    s = vmlaq_s32(s, vld1q_s32(x + i), vld1q_s32(kQmfCoeffs + i));
+
+  // The even and odd lanes hold the sums of the even and odd positions
+  int32x2_t s2 = vadd_s32(vget_low_s32(s), vget_high_s32(s));
+  *sum_even = vget_lane_s32(s2, 0);
+  *sum_odd = vget_lane_s32(s2, 1);
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+//
+// x86 SSE4.1 QMF Filtering, selected at runtime
+//
+
+#include <immintrin.h>
+
+__attribute__((target("sse4.1"))) static void FilterSse4(const int x[24],
+                                                         int* sum_even,
+                                                         int* sum_odd) {
+  __m128i s = _mm_setzero_si128();
+  for (int i = 0; i < 24; i += 4) {
+    __m128i x0 = _mm_loadu_si128((const __m128i*)(x + i));
+    __m128i h0 = _mm_load_si128((const __m128i*)(kQmfCoeffs + i));
+    s = _mm_add_epi32(s, _mm_mullo_epi32(x0, h0));
+  }
+
+  // The even and odd lanes hold the sums of the even and odd positions
+  s = _mm_add_epi32(s, _mm_unpackhi_epi64(s, s));
+  *sum_even = _mm_cvtsi128_si32(s);
+  *sum_odd = _mm_extract_epi32(s, 1);
+}
+
+static const bool has_sse4 = [] {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.1");
+}();
+
+void g722_qmf_filter(const int x[24], int* sum_even, int* sum_odd) {
+  if (has_sse4)
+    FilterSse4(x, sum_even, sum_odd);
+  else
+    FilterGeneric(x, sum_even, sum_odd);
+}
+
+#else
+
+void g722_qmf_filter(const int x[24], int* sum_even, int* sum_odd) {
+  FilterGeneric(x, sum_even, sum_odd);
+}
+
+#endif
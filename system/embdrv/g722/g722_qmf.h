@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef G722_QMF_H
+#define G722_QMF_H
+
+/* The 24 taps QMF filters of the transmit and receive sides share the same
+ * coefficients. The signal history `x` is filtered by the coefficients
+ * interleaved for the even and the odd positions of the history, and the
+ * two partial sums returned:
+ *   `sum_even` = sum of x[2*i] * qmf_coeffs[i]
+ *   `sum_odd`  = sum of x[2*i + 1] * qmf_coeffs[11 - i]
+ *
+ * The values of the history fit in 16 bits, the sums are computed exactly
+ * on 32 bits, whatever the implementation selected for the CPU. */
+void g722_qmf_filter(const int x[24], int* sum_even, int* sum_odd);
+
+/* Shifts the signal history by two samples, and appends `x0` and `x1`. */
+static inline void g722_qmf_push(int x[24], int x0, int x1) {
+  for (int i = 0; i < 22; i++) x[i] = x[i + 2];
+  x[22] = x0;
+  x[23] = x1;
+}
+
+#endif  // G722_QMF_H
@@ -23,6 +23,11 @@
  *
  ******************************************************************************/
 #include <string.h>
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "sbc_enc_func_declare.h"
 #include "sbc_encoder.h"
 /*#include <math.h>*/
@@ -1185,6 +1190,102 @@ static int16_t* s16X =
 #endif
 #endif
 
+#if (SBC_ARM_ASM_OPT == FALSE) && (SBC_IPAQ_OPT == TRUE) && \
+    (SBC_IS_64_MULT_IN_WINDOW_ACCU == FALSE) &&                \
+    (defined(__ARM_NEON) || defined(__SSE2__))
+#define SBC_SIMD_WINDOW_ACCU TRUE
+#else
+#define SBC_SIMD_WINDOW_ACCU FALSE
+#endif
+
+#if (SBC_SIMD_WINDOW_ACCU == TRUE)
+/* Coefficients of WINDOW_PARTIAL_4 and WINDOW_PARTIAL_8 as a matrix: with n
+ * twice the number of subbands, s32DCTY[i] is the sum over j of
+ * coeff[j][i] * s16X[ChOffset + n * j + i] */
+static const int16_t gas16WindowCoeff4[5][8] = {
+    {0, WIND_4_SUBBANDS_1_0, WIND_4_SUBBANDS_2_0, WIND_4_SUBBANDS_3_0,
+     WIND_4_SUBBANDS_4_0, WIND_4_SUBBANDS_3_4, WIND_4_SUBBANDS_2_4,
+     WIND_4_SUBBANDS_1_4},
+    {WIND_4_SUBBANDS_0_1, WIND_4_SUBBANDS_1_1, WIND_4_SUBBANDS_2_1,
+     WIND_4_SUBBANDS_3_1, WIND_4_SUBBANDS_4_1, WIND_4_SUBBANDS_3_3,
+     WIND_4_SUBBANDS_2_3, WIND_4_SUBBANDS_1_3},
+    {WIND_4_SUBBANDS_0_2, WIND_4_SUBBANDS_1_2, WIND_4_SUBBANDS_2_2,
+     WIND_4_SUBBANDS_3_2, WIND_4_SUBBANDS_4_2, WIND_4_SUBBANDS_3_2,
+     WIND_4_SUBBANDS_2_2, WIND_4_SUBBANDS_1_2},
+    {-WIND_4_SUBBANDS_0_2, WIND_4_SUBBANDS_1_3, WIND_4_SUBBANDS_2_3,
+     WIND_4_SUBBANDS_3_3, WIND_4_SUBBANDS_4_1, WIND_4_SUBBANDS_3_1,
+     WIND_4_SUBBANDS_2_1, WIND_4_SUBBANDS_1_1},
+    {-WIND_4_SUBBANDS_0_1, WIND_4_SUBBANDS_1_4, WIND_4_SUBBANDS_2_4,
+     WIND_4_SUBBANDS_3_4, WIND_4_SUBBANDS_4_0, WIND_4_SUBBANDS_3_0,
+     WIND_4_SUBBANDS_2_0, WIND_4_SUBBANDS_1_0},
+};
+
+static const int16_t gas16WindowCoeff8[5][16] = {
+    {0, WIND_8_SUBBANDS_1_0, WIND_8_SUBBANDS_2_0, WIND_8_SUBBANDS_3_0,
+     WIND_8_SUBBANDS_4_0, WIND_8_SUBBANDS_5_0, WIND_8_SUBBANDS_6_0,
+     WIND_8_SUBBANDS_7_0, WIND_8_SUBBANDS_8_0, WIND_8_SUBBANDS_7_4,
+     WIND_8_SUBBANDS_6_4, WIND_8_SUBBANDS_5_4, WIND_8_SUBBANDS_4_4,
+     WIND_8_SUBBANDS_3_4, WIND_8_SUBBANDS_2_4, WIND_8_SUBBANDS_1_4},
+    {WIND_8_SUBBANDS_0_1, WIND_8_SUBBANDS_1_1, WIND_8_SUBBANDS_2_1,
+     WIND_8_SUBBANDS_3_1, WIND_8_SUBBANDS_4_1, WIND_8_SUBBANDS_5_1,
+     WIND_8_SUBBANDS_6_1, WIND_8_SUBBANDS_7_1, WIND_8_SUBBANDS_8_1,
+     WIND_8_SUBBANDS_7_3, WIND_8_SUBBANDS_6_3, WIND_8_SUBBANDS_5_3,
+     WIND_8_SUBBANDS_4_3, WIND_8_SUBBANDS_3_3, WIND_8_SUBBANDS_2_3,
+     WIND_8_SUBBANDS_1_3},
+    {WIND_8_SUBBANDS_0_2, WIND_8_SUBBANDS_1_2, WIND_8_SUBBANDS_2_2,
+     WIND_8_SUBBANDS_3_2, WIND_8_SUBBANDS_4_2, WIND_8_SUBBANDS_5_2,
+     WIND_8_SUBBANDS_6_2, WIND_8_SUBBANDS_7_2, WIND_8_SUBBANDS_8_2,
+     WIND_8_SUBBANDS_7_2, WIND_8_SUBBANDS_6_2, WIND_8_SUBBANDS_5_2,
+     WIND_8_SUBBANDS_4_2, WIND_8_SUBBANDS_3_2, WIND_8_SUBBANDS_2_2,
+     WIND_8_SUBBANDS_1_2},
+    {-WIND_8_SUBBANDS_0_2, WIND_8_SUBBANDS_1_3, WIND_8_SUBBANDS_2_3,
+     WIND_8_SUBBANDS_3_3, WIND_8_SUBBANDS_4_3, WIND_8_SUBBANDS_5_3,
+     WIND_8_SUBBANDS_6_3, WIND_8_SUBBANDS_7_3, WIND_8_SUBBANDS_8_1,
+     WIND_8_SUBBANDS_7_1, WIND_8_SUBBANDS_6_1, WIND_8_SUBBANDS_5_1,
+     WIND_8_SUBBANDS_4_1, WIND_8_SUBBANDS_3_1, WIND_8_SUBBANDS_2_1,
+     WIND_8_SUBBANDS_1_1},
+    {-WIND_8_SUBBANDS_0_1, WIND_8_SUBBANDS_1_4, WIND_8_SUBBANDS_2_4,
+     WIND_8_SUBBANDS_3_4, WIND_8_SUBBANDS_4_4, WIND_8_SUBBANDS_5_4,
+     WIND_8_SUBBANDS_6_4, WIND_8_SUBBANDS_7_4, WIND_8_SUBBANDS_8_0,
+     WIND_8_SUBBANDS_7_0, WIND_8_SUBBANDS_6_0, WIND_8_SUBBANDS_5_0,
+     WIND_8_SUBBANDS_4_0, WIND_8_SUBBANDS_3_0, WIND_8_SUBBANDS_2_0,
+     WIND_8_SUBBANDS_1_0},
+};
+
+/* Vectorized WINDOW_PARTIAL_4 and WINDOW_PARTIAL_8, giving the same s32DCTY
+ * since the scalar accumulation never overflows 32 bits */
+static void SbcWindowAccuSimd(const int16_t* ps16X, const int16_t* ps16Coeff,
+                              int32_t n, int32_t* ps32DCTY) {
+  int32_t i, j;
+#if defined(__ARM_NEON)
+  for (i = 0; i < n; i += 4) {
+    int32x4_t acc = vmull_s16(vld1_s16(ps16Coeff + i), vld1_s16(ps16X + i));
+    for (j = 1; j < 5; j++) {
+      acc = vmlal_s16(acc, vld1_s16(ps16Coeff + n * j + i),
+                      vld1_s16(ps16X + n * j + i));
+    }
+    vst1q_s32(ps32DCTY + i, acc);
+  }
+#else
+  for (i = 0; i < n; i += 8) {
+    __m128i acc_lo = _mm_setzero_si128();
+    __m128i acc_hi = _mm_setzero_si128();
+    for (j = 0; j < 5; j++) {
+      __m128i coeff =
+          _mm_loadu_si128((const __m128i*)(ps16Coeff + n * j + i));
+      __m128i x = _mm_loadu_si128((const __m128i*)(ps16X + n * j + i));
+      __m128i prod_lo = _mm_mullo_epi16(coeff, x);
+      __m128i prod_hi = _mm_mulhi_epi16(coeff, x);
+      acc_lo = _mm_add_epi32(acc_lo, _mm_unpacklo_epi16(prod_lo, prod_hi));
+      acc_hi = _mm_add_epi32(acc_hi, _mm_unpackhi_epi16(prod_lo, prod_hi));
+    }
+    _mm_storeu_si128((__m128i*)(ps32DCTY + i), acc_lo);
+    _mm_storeu_si128((__m128i*)(ps32DCTY + i + 4), acc_hi);
+  }
+#endif
+}
+#endif
+
 static int16_t ShiftCounter = 0;
 extern int16_t EncMaxShiftCounter;
 /****************************************************************************
@@ -1205,7 +1306,7 @@ void SbcAnalysisFilter4(SBC_ENC_PARAMS* pstrEncParams, int16_t* input) {
 #if (SBC_IPAQ_OPT == TRUE)
 #if (SBC_IS_64_MULT_IN_WINDOW_ACCU == TRUE)
   register int64_t s64Temp, s64Temp2;
-#else
+#elif (SBC_SIMD_WINDOW_ACCU == FALSE)
   register int32_t s32Temp, s32Temp2;
 #endif
 #else
@@ -1257,7 +1358,12 @@ void SbcAnalysisFilter4(SBC_ENC_PARAMS* pstrEncParams, int16_t* input) {
     for (s32Ch = 0; s32Ch < s32NumOfChannels; s32Ch++) {
       ChOffset = s32Ch * Offset2 + Offset;
 
+#if (SBC_SIMD_WINDOW_ACCU == TRUE)
+      SbcWindowAccuSimd(s16X + ChOffset, &gas16WindowCoeff4[0][0],
+                        SUB_BANDS_4 * 2, s32DCTY);
+#else
       WINDOW_PARTIAL_4
+#endif
 
       SBC_FastIDCT4(s32DCTY, ps32SbBuf);
 
@@ -1296,7 +1402,7 @@ void SbcAnalysisFilter8(SBC_ENC_PARAMS* pstrEncParams, int16_t* input) {
 #if (SBC_IPAQ_OPT == TRUE)
 #if (SBC_IS_64_MULT_IN_WINDOW_ACCU == TRUE)
   register int64_t s64Temp, s64Temp2;
-#else
+#elif (SBC_SIMD_WINDOW_ACCU == FALSE)
   register int32_t s32Temp, s32Temp2;
 #endif
 #else
@@ -1370,7 +1476,12 @@ void SbcAnalysisFilter8(SBC_ENC_PARAMS* pstrEncParams, int16_t* input) {
     for (s32Ch = 0; s32Ch < s32NumOfChannels; s32Ch++) {
       ChOffset = s32Ch * Offset2 + Offset;
 
+#if (SBC_SIMD_WINDOW_ACCU == TRUE)
+      SbcWindowAccuSimd(s16X + ChOffset, &gas16WindowCoeff8[0][0],
+                        SUB_BANDS_8 * 2, s32DCTY);
+#else
       WINDOW_PARTIAL_8
+#endif
 
       SBC_FastIDCT8(s32DCTY, ps32SbBuf);
 
@@ -52,6 +52,30 @@ class LibAptxEncTest : public ::testing::Test {
     aptxbtenc_encodestereo(aptxbtenc, &pcmL, &pcmR, &encoded_sample);
     ASSERT_EQ(encoded_sample, codeword);
   }
+
+  // Encode |num_codewords| codewords of pseudo random noise, with an amplitude
+  // changing every 256 codewords, and return the FNV-1a hash of the codewords
+  uint32_t encode_noise_hash(size_t num_codewords) {
+    uint32_t seed = 1;
+    uint32_t hash = 2166136261u;
+    for (size_t idx = 0; idx < num_codewords; idx++) {
+      int shift = (idx / 256) % 12;
+      uint32_t pcmL[4];
+      uint32_t pcmR[4];
+      for (size_t i = 0; i < 4; i++) {
+        seed = seed * 1103515245u + 12345u;
+        pcmL[i] = static_cast<int16_t>(seed >> 16) >> shift;
+        seed = seed * 1103515245u + 12345u;
+        pcmR[i] = static_cast<int16_t>(seed >> 16) >> shift;
+      }
+      uint32_t encoded_sample;
+      aptxbtenc_encodestereo(aptxbtenc, &pcmL, &pcmR, &encoded_sample);
+      for (size_t i = 0; i < 4; i++) {
+        hash = (hash ^ ((encoded_sample >> (8 * i)) & 0xff)) * 16777619u;
+      }
+    }
+    return hash;
+  }
 };
 
 TEST_F(LibAptxEncTest, encode_fake_data) {
@@ -75,3 +99,9 @@ TEST_F(LibAptxEncTest, encode_fake_data) {
     ++idx;
   }
 }
+
+// Long enough for the predictors to adapt, the encoder must give the same
+// codewords whether or not the vector kernels are used
+TEST_F(LibAptxEncTest, encode_noise) {
+  ASSERT_EQ(encode_noise_hash(6144), 2731970340u);
+}
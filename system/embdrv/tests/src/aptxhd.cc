@@ -55,6 +55,32 @@ class LibAptxHdEncTest : public ::testing::Test {
     ASSERT_EQ(encoded_sample[0], codeword[0]);
     ASSERT_EQ(encoded_sample[1], codeword[1]);
   }
+
+  // Encode |num_codewords| codewords of pseudo random noise, with an amplitude
+  // changing every 256 codewords, and return the FNV-1a hash of the codewords
+  uint32_t encode_noise_hash(size_t num_codewords) {
+    uint32_t seed = 1;
+    uint32_t hash = 2166136261u;
+    for (size_t idx = 0; idx < num_codewords; idx++) {
+      int shift = (idx / 256) % 20;
+      uint32_t pcmL[4];
+      uint32_t pcmR[4];
+      for (size_t i = 0; i < 4; i++) {
+        seed = seed * 1103515245u + 12345u;
+        pcmL[i] = (static_cast<int32_t>(seed) >> 8) >> shift;
+        seed = seed * 1103515245u + 12345u;
+        pcmR[i] = (static_cast<int32_t>(seed) >> 8) >> shift;
+      }
+      uint32_t encoded_sample[2];
+      aptxhdbtenc_encodestereo(aptxhdbtenc, &pcmL, &pcmR,
+                               (void*)encoded_sample);
+      for (size_t i = 0; i < 8; i++) {
+        hash = (hash ^ ((encoded_sample[i / 4] >> (8 * (i % 4))) & 0xff)) *
+               16777619u;
+      }
+    }
+    return hash;
+  }
 };
 
 TEST_F(LibAptxHdEncTest, encode_fake_data) {
@@ -78,3 +104,9 @@ TEST_F(LibAptxHdEncTest, encode_fake_data) {
     ++idx;
   }
 }
+
+// Long enough for the predictors to adapt, the encoder must give the same
+// codewords whether or not the vector kernels are used
+TEST_F(LibAptxHdEncTest, encode_noise) {
+  ASSERT_EQ(encode_noise_hash(10240), 1580585605u);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "aptXHDbtenc.h"
+
+using ::benchmark::State;
+
+// One second of 24 bit stereo pseudo random noise at 48 kHz, 4 samples per
+// channel and codeword
+static constexpr size_t kNumCodewords = 48000 / 4;
+
+static void BM_AptxHdEncode(State& state) {
+  std::vector<uint32_t> pcm(kNumCodewords * 8);
+  uint32_t seed = 1;
+  for (auto& sample : pcm) {
+    seed = seed * 1103515245u + 12345u;
+    sample = static_cast<int32_t>(seed) >> 8;
+  }
+
+  void* aptxhdbtenc = malloc(SizeofAptxhdbtenc());
+  aptxhdbtenc_init(aptxhdbtenc, 0);
+  for (auto _ : state) {
+    for (size_t idx = 0; idx < kNumCodewords; idx++) {
+      uint32_t encoded_sample[2];
+      aptxhdbtenc_encodestereo(aptxhdbtenc, &pcm[idx * 8], &pcm[idx * 8 + 4],
+                               encoded_sample);
+      benchmark::DoNotOptimize(encoded_sample);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumCodewords);
+  free(aptxhdbtenc);
+}
+BENCHMARK(BM_AptxHdEncode);
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+}
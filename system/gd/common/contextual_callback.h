@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #include "bind.h"
 #include "callback.h"
 #include "i_postable_context.h"
@@ -41,12 +45,15 @@ class ContextualOnceCallback<R(Args...)> {
   ContextualOnceCallback& operator=(ContextualOnceCallback&&) noexcept = default;
 
   void Invoke(Args... args) {
-    context_->Post(common::BindOnce(std::move(callback_), std::forward<Args>(args)...));
+    std::tuple<std::decay_t<Args>...> bound(std::forward<Args>(args)...);
+    context_->PostInline([callback = std::move(callback_), bound = std::move(bound)]() mutable {
+      std::apply([&callback](auto&... bound_args) { std::move(callback).Run(std::move(bound_args)...); }, bound);
+    });
   }
 
   void InvokeIfNotEmpty(Args... args) {
     if (context_ != nullptr) {
-      context_->Post(common::BindOnce(std::move(callback_), std::forward<Args>(args)...));
+      Invoke(std::forward<Args>(args)...);
     }
   }
 
@@ -81,12 +88,15 @@ class ContextualCallback<R(Args...)> {
   ContextualCallback& operator=(ContextualCallback&&) noexcept = default;
 
   void Invoke(Args... args) {
-    context_->Post(common::BindOnce(callback_, std::forward<Args>(args)...));
+    std::tuple<std::decay_t<Args>...> bound(std::forward<Args>(args)...);
+    context_->PostInline([callback = callback_, bound = std::move(bound)]() mutable {
+      std::apply([&callback](auto&... bound_args) { callback.Run(std::move(bound_args)...); }, bound);
+    });
   }
 
   void InvokeIfNotEmpty(Args... args) {
     if (context_ != nullptr) {
-      context_->Post(common::BindOnce(callback_, std::forward<Args>(args)...));
+      Invoke(std::forward<Args>(args)...);
     }
   }
 
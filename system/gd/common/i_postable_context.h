@@ -18,6 +18,8 @@
 
 #include <base/functional/bind.h>
 
+#include "common/inline_closure.h"
+
 namespace bluetooth {
 namespace common {
 
@@ -25,6 +27,12 @@ class IPostableContext {
  public:
   virtual ~IPostableContext(){};
   virtual void Post(base::OnceClosure closure) = 0;
+
+  // Post a closure that does not need a BindState. Contexts that queue InlineClosure directly override this, the
+  // others wrap it in a OnceClosure.
+  virtual void PostInline(InlineClosure closure) {
+    Post(base::BindOnce([](InlineClosure closure) { std::move(closure).Run(); }, std::move(closure)));
+  }
 };
 
 }  // namespace common
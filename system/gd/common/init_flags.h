@@ -58,6 +58,10 @@ class InitFlags final {
     return init_flags::get_hci_adapter();
   }
 
+  inline static bool IsPerAdapterFilesEnabled() {
+    return init_flags::per_adapter_files_is_enabled();
+  }
+
   inline static void SetAllForTesting() {
     init_flags::set_all_for_testing();
   }
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace bluetooth {
+namespace common {
+
+// A move-only closure that stores callables of up to kInlineSize bytes inline instead of on the heap.
+//
+// Unlike common::BindOnce, which allocates a BindState for every closure, wrapping a lambda or an existing
+// common::OnceClosure in an InlineClosure does not allocate. Larger callables fall back to the heap, and every such
+// allocation is counted in GetHeapAllocationCount() so that tests can check a data path is allocation free.
+class InlineClosure {
+ public:
+  static constexpr size_t kInlineSize = 8 * sizeof(void*);
+
+  InlineClosure() = default;
+
+  template <
+      typename Callable,
+      typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, InlineClosure>>>
+  InlineClosure(Callable&& callable) {
+    using Stored = std::decay_t<Callable>;
+    if constexpr (
+        sizeof(Stored) <= kInlineSize && alignof(Stored) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<Stored>) {
+      new (storage_) Stored(std::forward<Callable>(callable));
+      ops_ = &kInlineOps<Stored>;
+    } else {
+      heap_allocation_count_.fetch_add(1, std::memory_order_relaxed);
+      *reinterpret_cast<Stored**>(storage_) = new Stored(std::forward<Callable>(callable));
+      ops_ = &kHeapOps<Stored>;
+    }
+  }
+
+  InlineClosure(const InlineClosure&) = delete;
+  InlineClosure& operator=(const InlineClosure&) = delete;
+
+  InlineClosure(InlineClosure&& other) noexcept {
+    MoveFrom(std::move(other));
+  }
+
+  InlineClosure& operator=(InlineClosure&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(std::move(other));
+    }
+    return *this;
+  }
+
+  ~InlineClosure() {
+    Reset();
+  }
+
+  explicit operator bool() const {
+    return ops_ != nullptr;
+  }
+
+  // Run the callable and destroy it, leaving this closure empty
+  void Run() && {
+    const Ops* ops = ops_;
+    ops_ = nullptr;
+    ops->run(storage_);
+    ops->destroy(storage_);
+  }
+
+  // Number of closures that did not fit inline, since the process started
+  static uint64_t GetHeapAllocationCount() {
+    return heap_allocation_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Ops {
+    void (*run)(void* storage);
+    // Move constructs the callable in |to| and destroys the one in |from|
+    void (*relocate)(void* from, void* to);
+    void (*destroy)(void* storage);
+  };
+
+  template <typename Stored>
+  static void Invoke(Stored& callable) {
+    if constexpr (std::is_invocable_v<Stored&>) {
+      callable();
+    } else {
+      // common::OnceClosure can only be run as an rvalue
+      std::move(callable).Run();
+    }
+  }
+
+  template <typename Stored>
+  static constexpr Ops kInlineOps = {
+      [](void* storage) { Invoke(*static_cast<Stored*>(storage)); },
+      [](void* from, void* to) {
+        Stored* stored = static_cast<Stored*>(from);
+        new (to) Stored(std::move(*stored));
+        stored->~Stored();
+      },
+      [](void* storage) { static_cast<Stored*>(storage)->~Stored(); },
+  };
+
+  template <typename Stored>
+  static constexpr Ops kHeapOps = {
+      [](void* storage) { Invoke(**static_cast<Stored**>(storage)); },
+      [](void* from, void* to) { *static_cast<Stored**>(to) = *static_cast<Stored**>(from); },
+      [](void* storage) { delete *static_cast<Stored**>(storage); },
+  };
+
+  void MoveFrom(InlineClosure&& other) {
+    ops_ = other.ops_;
+    if (ops_ != nullptr) {
+      ops_->relocate(other.storage_, storage_);
+      other.ops_ = nullptr;
+    }
+  }
+
+  void Reset() {
+    if (ops_ != nullptr) {
+      ops_->destroy(storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  static inline std::atomic<uint64_t> heap_allocation_count_{0};
+
+  const Ops* ops_ = nullptr;
+  alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+};
+
+}  // namespace common
+}  // namespace bluetooth
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/inline_closure.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+#include "common/bind.h"
+#include "common/callback.h"
+
+namespace testing {
+
+using bluetooth::common::InlineClosure;
+
+TEST(InlineClosureTest, small_lambda_is_stored_inline) {
+  uint64_t heap_allocations = InlineClosure::GetHeapAllocationCount();
+  int counter = 0;
+  InlineClosure closure([&counter]() { counter++; });
+  EXPECT_TRUE(closure);
+  std::move(closure).Run();
+  EXPECT_EQ(counter, 1);
+  EXPECT_FALSE(closure);
+  EXPECT_EQ(InlineClosure::GetHeapAllocationCount(), heap_allocations);
+}
+
+TEST(InlineClosureTest, large_lambda_falls_back_to_heap) {
+  uint64_t heap_allocations = InlineClosure::GetHeapAllocationCount();
+  std::array<int, 64> values{};
+  values[63] = 7;
+  int result = 0;
+  InlineClosure closure([values, &result]() { result = values[63]; });
+  EXPECT_EQ(InlineClosure::GetHeapAllocationCount(), heap_allocations + 1);
+  std::move(closure).Run();
+  EXPECT_EQ(result, 7);
+}
+
+TEST(InlineClosureTest, move_only_captures_are_moved_and_destroyed) {
+  auto value = std::make_shared<int>(3);
+  int result = 0;
+  {
+    InlineClosure closure([owned = std::make_unique<std::shared_ptr<int>>(value), &result]() { result = **owned; });
+    InlineClosure moved = std::move(closure);
+    EXPECT_FALSE(closure);
+    EXPECT_EQ(value.use_count(), 2);
+    std::move(moved).Run();
+    EXPECT_EQ(value.use_count(), 1);
+
+    // A closure destroyed without running releases its captures too
+    InlineClosure never_run([value]() {});
+    EXPECT_EQ(value.use_count(), 2);
+  }
+  EXPECT_EQ(result, 3);
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(InlineClosureTest, wraps_once_closure) {
+  int counter = 0;
+  InlineClosure closure(bluetooth::common::BindOnce([](int* counter) { (*counter)++; }, &counter));
+  std::move(closure).Run();
+  EXPECT_EQ(counter, 1);
+}
+
+}  // namespace testing
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aes_hw.h"
+
+#include <cstdlib>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AES_HW_X86
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#elif (defined(__aarch64__) || defined(__arm__)) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+#define AES_HW_ARM
+#include <arm_neon.h>
+#endif
+
+namespace crypto_toolbox {
+
+#if defined(AES_HW_X86)
+
+bool aes_hw_available() {
+  static const bool available = __builtin_cpu_supports("aes");
+  return available;
+}
+
+__attribute__((target("aes,sse2"))) void aes_hw_encrypt(
+    const unsigned char in[N_BLOCK], unsigned char out[N_BLOCK], const aes_context& ctx) {
+  const uint_8t* round_key = ctx.ksch;
+  __m128i state = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  state = _mm_xor_si128(state, _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_key)));
+  for (uint_8t r = 1; r < ctx.rnd; r++) {
+    round_key += N_BLOCK;
+    state = _mm_aesenc_si128(state, _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_key)));
+  }
+  round_key += N_BLOCK;
+  state = _mm_aesenclast_si128(state, _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_key)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), state);
+}
+
+#elif defined(AES_HW_ARM)
+
+bool aes_hw_available() {
+  return true;
+}
+
+void aes_hw_encrypt(const unsigned char in[N_BLOCK], unsigned char out[N_BLOCK], const aes_context& ctx) {
+  const uint_8t* round_key = ctx.ksch;
+  uint8x16_t state = vld1q_u8(in);
+  // AESE adds the round key before the byte substitution and row shift
+  for (uint_8t r = 1; r < ctx.rnd; r++) {
+    state = vaesmcq_u8(vaeseq_u8(state, vld1q_u8(round_key)));
+    round_key += N_BLOCK;
+  }
+  state = vaeseq_u8(state, vld1q_u8(round_key));
+  round_key += N_BLOCK;
+  vst1q_u8(out, veorq_u8(state, vld1q_u8(round_key)));
+}
+
+#else
+
+bool aes_hw_available() {
+  return false;
+}
+
+void aes_hw_encrypt(const unsigned char[N_BLOCK], unsigned char[N_BLOCK], const aes_context&) {
+  abort();
+}
+
+#endif
+
+}  // namespace crypto_toolbox
@@ -0,0 +1,32 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "aes.h"
+
+namespace crypto_toolbox {
+
+// Whether aes_hw_encrypt can run: the CPU has AES instructions (AES-NI on
+// x86, checked at runtime), or the build targets them (ARMv8 Cryptography
+// Extension)
+bool aes_hw_available();
+
+// Same as aes_encrypt, with the key schedule prepared by aes_set_key, using
+// the AES instructions of the CPU. Only call when aes_hw_available().
+void aes_hw_encrypt(const unsigned char in[N_BLOCK], unsigned char out[N_BLOCK], const aes_context& ctx);
+
+}  // namespace crypto_toolbox
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "crypto_toolbox/aes.h"
+#include "crypto_toolbox/crypto_toolbox.h"
+
+using ::benchmark::State;
+using bluetooth::hci::Octet16;
+
+namespace crypto_toolbox {
+
+namespace {
+
+const Octet16 kKey{0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+
+}  // namespace
+
+// One block with the portable implementation, as aes_128 used to
+static void BM_AesPortable(State& state) {
+  Octet16 message{};
+  Octet16 output;
+  for (auto _ : state) {
+    aes_context ctx;
+    aes_set_key(kKey.data(), kKey.size(), &ctx);
+    aes_encrypt(message.data(), output.data(), &ctx);
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AesPortable);
+
+static void BM_Aes128(State& state) {
+  Octet16 message{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(aes_128(kKey, message));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Aes128);
+
+// CMAC of one block, of the message of f4 (65 bytes), and of a long signed
+// ATT write
+static void BM_AesCmac(State& state) {
+  std::vector<uint8_t> message(state.range(0), 0x5a);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(aes_cmac(kKey, message.data(), message.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_AesCmac)->Arg(16)->Arg(65)->Arg(512);
+
+}  // namespace crypto_toolbox
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "crypto_toolbox/aes.h"
+#include "crypto_toolbox/aes_hw.h"
 #include "hci/octets.h"
 
 namespace crypto_toolbox {
@@ -354,4 +355,30 @@ TEST(CryptoToolboxTest, bt_spec_example_d_12_test) {
   EXPECT_EQ(expected_ltk, ltk);
 }
 
+// The AES instructions of the CPU encrypt as the portable implementation
+TEST(CryptoToolboxTest, aes_hw_encrypt_test) {
+  if (!aes_hw_available()) {
+    GTEST_SKIP() << "no AES instructions";
+  }
+
+  uint8_t key[32];
+  uint8_t in[16];
+  for (uint8_t i = 0; i < sizeof(key); i++) key[i] = 0x11 * i + 1;
+  for (uint8_t i = 0; i < sizeof(in); i++) in[i] = 0x35 * i;
+
+  for (uint8_t key_length : {16, 24, 32}) {
+    aes_context ctx;
+    aes_set_key(key, key_length, &ctx);
+    for (int block = 0; block < 16; block++) {
+      uint8_t expected[16];
+      uint8_t output[16];
+      aes_encrypt(in, expected, &ctx);
+      aes_hw_encrypt(in, output, ctx);
+      EXPECT_TRUE(memcmp(output, expected, kOctet16Length) == 0);
+      // next input, so that every round key and state byte varies
+      memcpy(in, expected, sizeof(in));
+    }
+  }
+}
+
 }  // namespace crypto_toolbox
@@ -21,12 +21,13 @@
 #include <poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <chrono>
 #include <csignal>
 #include <mutex>
-#include <queue>
+#include <deque>
 
 #include "common/init_flags.h"
 #include "hal/hci_hal.h"
@@ -52,7 +53,10 @@ constexpr uint8_t kHciAclHeaderSize = 4;
 constexpr uint8_t kHciScoHeaderSize = 3;
 constexpr uint8_t kHciEvtHeaderSize = 2;
 constexpr uint8_t kHciIsoHeaderSize = 4;
-constexpr int kBufSize = 1024 + 4 + 1;  // DeviceProperties::acl_data_packet_size_ + ACL header + H4 header
+// The user channel delivers one packet per read, size the buffer for the largest ACL packet the controller may send
+constexpr int kBufSize = kH4HeaderSize + kHciAclHeaderSize + 0xffff;
+// Packets received or sent with a single recvmmsg / sendmmsg call
+constexpr int kMaxBatchSize = 8;
 
 constexpr uint8_t BTPROTO_HCI = 1;
 constexpr uint16_t HCI_CHANNEL_USER = 1;
@@ -248,8 +252,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(command);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::CMD);
-    packet.insert(packet.cbegin(), kH4Command);
-    write_to_fd(packet);
+    write_to_fd(kH4Command, std::move(packet));
   }
 
   void sendAclData(HciPacket data) override {
@@ -257,8 +260,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(data);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::ACL);
-    packet.insert(packet.cbegin(), kH4Acl);
-    write_to_fd(packet);
+    write_to_fd(kH4Acl, std::move(packet));
   }
 
   void sendScoData(HciPacket data) override {
@@ -266,8 +268,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(data);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::SCO);
-    packet.insert(packet.cbegin(), kH4Sco);
-    write_to_fd(packet);
+    write_to_fd(kH4Sco, std::move(packet));
   }
 
   void sendIsoData(HciPacket data) override {
@@ -275,8 +276,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(data);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::ISO);
-    packet.insert(packet.cbegin(), kH4Iso);
-    write_to_fd(packet);
+    write_to_fd(kH4Iso, std::move(packet));
   }
 
   uint16_t getMsftOpcode() override {
@@ -346,13 +346,16 @@ class HciHalHost : public HciHal {
   bluetooth::os::Thread hci_incoming_thread_ =
       bluetooth::os::Thread("hci_incoming_thread", bluetooth::os::Thread::Priority::NORMAL);
   bluetooth::os::Reactor::Reactable* reactable_ = nullptr;
-  std::queue<std::vector<uint8_t>> hci_outgoing_queue_;
+  // Outgoing packets with their H4 type, the type is written in front of the payload with writev
+  std::deque<std::pair<uint8_t, HciPacket>> hci_outgoing_queue_;
+  // One kBufSize buffer per batched packet, allocated once as the largest packets do not fit on the thread stack
+  std::vector<uint8_t> incoming_buffer_ = std::vector<uint8_t>(kBufSize * kMaxBatchSize);
   SnoopLogger* btsnoop_logger_ = nullptr;
   LinkClocker* link_clocker_ = nullptr;
 
-  void write_to_fd(HciPacket packet) {
+  void write_to_fd(uint8_t h4_type, HciPacket packet) {
     // TODO: replace this with new queue when it's ready
-    hci_outgoing_queue_.emplace(packet);
+    hci_outgoing_queue_.emplace_back(h4_type, std::move(packet));
     if (hci_outgoing_queue_.size() == 1) {
       hci_incoming_thread_.GetReactor()->ModifyRegistration(reactable_, os::Reactor::REACT_ON_READ_WRITE);
     }
@@ -361,12 +364,25 @@ class HciHalHost : public HciHal {
   void send_packet_ready() {
     std::lock_guard<std::mutex> lock(api_mutex_);
     if (hci_outgoing_queue_.empty()) return;
-    auto packet_to_send = hci_outgoing_queue_.front();
-    auto bytes_written = write(sock_fd_, (void*)packet_to_send.data(), packet_to_send.size());
-    hci_outgoing_queue_.pop();
-    if (bytes_written == -1) {
+    // Hand every queued packet to the kernel in one call, each as its H4 type followed by the payload
+    struct iovec iov[kMaxBatchSize][2];
+    struct mmsghdr msgs[kMaxBatchSize] = {};
+    int batch_size = 0;
+    for (auto& packet_to_send : hci_outgoing_queue_) {
+      if (batch_size == kMaxBatchSize) break;
+      iov[batch_size][0] = {.iov_base = &packet_to_send.first, .iov_len = kH4HeaderSize};
+      iov[batch_size][1] = {.iov_base = packet_to_send.second.data(), .iov_len = packet_to_send.second.size()};
+      msgs[batch_size].msg_hdr.msg_iov = iov[batch_size];
+      msgs[batch_size].msg_hdr.msg_iovlen = 2;
+      batch_size++;
+    }
+    int sent;
+    RUN_NO_INTR(sent = sendmmsg(sock_fd_, msgs, batch_size, 0));
+    if (sent == -1) {
       abort();
     }
+    // Packets that were not sent stay queued for the next write ready callback
+    hci_outgoing_queue_.erase(hci_outgoing_queue_.begin(), hci_outgoing_queue_.begin() + sent);
     if (hci_outgoing_queue_.empty()) {
       hci_incoming_thread_.GetReactor()->ModifyRegistration(reactable_, os::Reactor::REACT_ON_READ_ONLY);
     }
@@ -380,26 +396,43 @@ class HciHalHost : public HciHal {
         return;
       }
     }
-    uint8_t buf[kBufSize] = {};
+    // The user channel keeps packet boundaries, read every packet already queued on the socket in one call
+    struct iovec iov[kMaxBatchSize];
+    struct mmsghdr msgs[kMaxBatchSize] = {};
+    for (int i = 0; i < kMaxBatchSize; i++) {
+      iov[i] = {.iov_base = incoming_buffer_.data() + i * kBufSize, .iov_len = kBufSize};
+      msgs[i].msg_hdr.msg_iov = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int received_count;
+    RUN_NO_INTR(received_count = recvmmsg(sock_fd_, msgs, kMaxBatchSize, MSG_DONTWAIT, nullptr));
 
-    ssize_t received_size;
-    RUN_NO_INTR(received_size = read(sock_fd_, buf, kBufSize));
+    if (received_count == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return;
+    }
 
     // we don't want crash when the chipset is broken.
-    if (received_size == -1) {
+    if (received_count == -1) {
       LOG_ERROR("Can't receive from socket: %s", strerror(errno));
       close(sock_fd_);
       raise(SIGINT);
       return;
     }
 
-    if (received_size == 0) {
-      LOG_WARN("Can't read H4 header. EOF received");
-      // First close sock fd before raising sigint
-      close(sock_fd_);
-      raise(SIGINT);
-      return;
+    for (int i = 0; i < received_count; i++) {
+      if (msgs[i].msg_len == 0) {
+        LOG_WARN("Can't read H4 header. EOF received");
+        // First close sock fd before raising sigint
+        close(sock_fd_);
+        raise(SIGINT);
+        return;
+      }
+      handle_incoming_packet(static_cast<uint8_t*>(iov[i].iov_base), msgs[i].msg_len);
     }
+  }
+
+  void handle_incoming_packet(const uint8_t* buf, ssize_t received_size) {
 
     if (buf[0] == kH4Event) {
       ASSERT_LOG(
@@ -422,7 +455,7 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping an event after processing");
           return;
         }
-        incoming_packet_callback_->hciEventReceived(receivedHciPacket);
+        incoming_packet_callback_->hciEventReceived(std::move(receivedHciPacket));
       }
     }
 
@@ -436,7 +469,6 @@ class HciHalHost : public HciHal {
           "malformed ACL length received: %d != %d",
           payload_size,
           hci_acl_data_total_length);
-      ASSERT_LOG(hci_acl_data_total_length <= kBufSize - kH4HeaderSize - kHciAclHeaderSize, "packet too long");
 
       HciPacket receivedHciPacket;
       receivedHciPacket.assign(buf + kH4HeaderSize, buf + kH4HeaderSize + kHciAclHeaderSize + payload_size);
@@ -448,7 +480,7 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping an ACL packet after processing");
           return;
         }
-        incoming_packet_callback_->aclDataReceived(receivedHciPacket);
+        incoming_packet_callback_->aclDataReceived(std::move(receivedHciPacket));
       }
     }
 
@@ -472,7 +504,7 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping a SCO packet after processing");
           return;
         }
-        incoming_packet_callback_->scoDataReceived(receivedHciPacket);
+        incoming_packet_callback_->scoDataReceived(std::move(receivedHciPacket));
       }
     }
 
@@ -496,10 +528,9 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping a ISO packet after processing");
           return;
         }
-        incoming_packet_callback_->isoDataReceived(receivedHciPacket);
+        incoming_packet_callback_->isoDataReceived(std::move(receivedHciPacket));
       }
     }
-    memset(buf, 0, kBufSize);
   }
 };
 
@@ -18,15 +18,18 @@
 
 #include <netdb.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <array>
 #include <chrono>
 #include <csignal>
+#include <deque>
 #include <mutex>
-#include <queue>
 
 #include "hal/hci_hal.h"
 #include "hal/snoop_logger.h"
@@ -51,6 +54,9 @@ constexpr uint8_t kHciEvtHeaderSize = 2;
 constexpr uint8_t kHciIsoHeaderSize = 4;
 constexpr int kBufSize = 1024 + 4 + 1;  // DeviceProperties::acl_data_packet_size_ + ACL header + H4 header
 
+// Maximum number of queued packets sent with a single writev()
+constexpr size_t kMaxPacketsPerWrite = 32;
+
 int ConnectToSocket() {
   auto* config = bluetooth::hal::HciHalHostRootcanalConfig::Get();
   const std::string& server = config->GetServerAddress();
@@ -90,6 +96,14 @@ int ConnectToSocket() {
     LOG_ERROR("can't control socket fd: %s", strerror(errno));
     return INVALID_FD;
   }
+
+  // Commands and data are small and latency sensitive, do not let them wait
+  // for the acknowledgement of the previous packet.
+  int no_delay = 1;
+  ret = setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+  if (ret == -1) {
+    LOG_WARN("can't disable Nagle's algorithm: %s", strerror(errno));
+  }
   return socket_fd;
 }
 }  // namespace
@@ -125,8 +139,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(command);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::CMD);
-    packet.insert(packet.cbegin(), kH4Command);
-    write_to_fd(packet);
+    write_to_fd(kH4Command, std::move(packet));
   }
 
   void sendAclData(HciPacket data) override {
@@ -134,8 +147,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(data);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::ACL);
-    packet.insert(packet.cbegin(), kH4Acl);
-    write_to_fd(packet);
+    write_to_fd(kH4Acl, std::move(packet));
   }
 
   void sendScoData(HciPacket data) override {
@@ -143,8 +155,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(data);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::SCO);
-    packet.insert(packet.cbegin(), kH4Sco);
-    write_to_fd(packet);
+    write_to_fd(kH4Sco, std::move(packet));
   }
 
   void sendIsoData(HciPacket data) override {
@@ -152,8 +163,7 @@ class HciHalHost : public HciHal {
     ASSERT(sock_fd_ != INVALID_FD);
     std::vector<uint8_t> packet = std::move(data);
     btsnoop_logger_->Capture(packet, SnoopLogger::Direction::OUTGOING, SnoopLogger::PacketType::ISO);
-    packet.insert(packet.cbegin(), kH4Iso);
-    write_to_fd(packet);
+    write_to_fd(kH4Iso, std::move(packet));
   }
 
  protected:
@@ -210,12 +220,15 @@ class HciHalHost : public HciHal {
   bluetooth::os::Thread hci_incoming_thread_ =
       bluetooth::os::Thread("hci_incoming_thread", bluetooth::os::Thread::Priority::NORMAL);
   bluetooth::os::Reactor::Reactable* reactable_ = nullptr;
-  std::queue<std::vector<uint8_t>> hci_outgoing_queue_;
+  // Packets waiting to be sent, with their H4 packet type
+  std::deque<std::pair<uint8_t, HciPacket>> hci_outgoing_queue_;
+  // Number of bytes of the first queued packet already sent, H4 header included
+  size_t hci_outgoing_offset_ = 0;
   SnoopLogger* btsnoop_logger_ = nullptr;
 
-  void write_to_fd(HciPacket packet) {
+  void write_to_fd(uint8_t h4_type, HciPacket packet) {
     // TODO: replace this with new queue when it's ready
-    hci_outgoing_queue_.emplace(packet);
+    hci_outgoing_queue_.emplace_back(h4_type, std::move(packet));
     if (hci_outgoing_queue_.size() == 1) {
       hci_incoming_thread_.GetReactor()->ModifyRegistration(reactable_, os::Reactor::REACT_ON_READ_WRITE);
     }
@@ -224,12 +237,44 @@ class HciHalHost : public HciHal {
   void send_packet_ready() {
     std::lock_guard<std::mutex> lock(api_mutex_);
     if (hci_outgoing_queue_.empty()) return;
-    auto packet_to_send = hci_outgoing_queue_.front();
-    auto bytes_written = write(sock_fd_, (void*)packet_to_send.data(), packet_to_send.size());
-    hci_outgoing_queue_.pop();
+
+    // Send as many queued packets as possible with a single system call, the
+    // H4 header of each packet is sent from its own buffer.
+    std::array<struct iovec, 2 * kMaxPacketsPerWrite> iov;
+    int iovcnt = 0;
+    size_t offset = hci_outgoing_offset_;
+    for (auto& [h4_type, packet] : hci_outgoing_queue_) {
+      if (iovcnt + 2 > static_cast<int>(iov.size())) {
+        break;
+      }
+      if (offset < kH4HeaderSize) {
+        iov[iovcnt++] = {.iov_base = &h4_type, .iov_len = kH4HeaderSize};
+        offset = kH4HeaderSize;
+      }
+      size_t packet_offset = offset - kH4HeaderSize;
+      iov[iovcnt++] = {.iov_base = packet.data() + packet_offset, .iov_len = packet.size() - packet_offset};
+      offset = 0;
+    }
+
+    ssize_t bytes_written;
+    RUN_NO_INTR(bytes_written = writev(sock_fd_, iov.data(), iovcnt));
     if (bytes_written == -1) {
       abort();
     }
+
+    // Drop the packets that were completely sent, and remember how much of the
+    // next one was.
+    size_t sent = hci_outgoing_offset_ + bytes_written;
+    while (!hci_outgoing_queue_.empty()) {
+      size_t packet_size = kH4HeaderSize + hci_outgoing_queue_.front().second.size();
+      if (sent < packet_size) {
+        break;
+      }
+      sent -= packet_size;
+      hci_outgoing_queue_.pop_front();
+    }
+    hci_outgoing_offset_ = sent;
+
     if (hci_outgoing_queue_.empty()) {
       hci_incoming_thread_.GetReactor()->ModifyRegistration(reactable_, os::Reactor::REACT_ON_READ_ONLY);
     }
@@ -288,7 +333,7 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping an event after processing");
           return;
         }
-        incoming_packet_callback_->hciEventReceived(receivedHciPacket);
+        incoming_packet_callback_->hciEventReceived(std::move(receivedHciPacket));
       }
     }
 
@@ -312,7 +357,7 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping an ACL packet after processing");
           return;
         }
-        incoming_packet_callback_->aclDataReceived(receivedHciPacket);
+        incoming_packet_callback_->aclDataReceived(std::move(receivedHciPacket));
       }
     }
 
@@ -336,7 +381,7 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping a SCO packet after processing");
           return;
         }
-        incoming_packet_callback_->scoDataReceived(receivedHciPacket);
+        incoming_packet_callback_->scoDataReceived(std::move(receivedHciPacket));
       }
     }
 
@@ -360,7 +405,7 @@ class HciHalHost : public HciHal {
           LOG_INFO("Dropping a ISO packet after processing");
           return;
         }
-        incoming_packet_callback_->isoDataReceived(receivedHciPacket);
+        incoming_packet_callback_->isoDataReceived(std::move(receivedHciPacket));
       }
     }
     memset(buf, 0, kBufSize);
@@ -17,52 +17,81 @@
 #include "hal/link_clocker.h"
 
 #include <algorithm>
+#include <mutex>
+#include <vector>
 
 namespace bluetooth::hal {
 
 static constexpr uint16_t kInvalidConnectionHandle = 0xFFFF;
 
-static class : public bluetooth::audio::asrc::ClockHandler {
-  void OnEvent(uint32_t, int, int) override {}
-} g_empty_handler;
+// Clock sources bound to a handler, by kind of events. The handlers are called
+// with the lock held, so that a source no longer reports events once destroyed.
+template <typename T>
+struct Subscriptions {
+  std::mutex mutex;
+  std::vector<T*> sources;
 
-static std::atomic<bluetooth::audio::asrc::ClockHandler*> g_nocp_iso_handler = &g_empty_handler;
+  void Add(T* source) {
+    if (std::find(sources.begin(), sources.end(), source) == sources.end()) {
+      sources.push_back(source);
+    }
+  }
 
-static struct {
-  std::mutex mutex;
-  bluetooth::audio::asrc::ClockHandler* handler;
-  struct {
-    uint16_t connection_handle;
-    uint16_t stream_cid;
-  } links[2];
-} g_credit_ind_handler = {.handler = &g_empty_handler, .links = {{}, {}}};
+  void Remove(T* source) {
+    sources.erase(std::remove(sources.begin(), sources.end(), source), sources.end());
+  }
+};
+
+static Subscriptions<NocpIsoEvents> g_nocp_iso_sources;
+static Subscriptions<L2capCreditIndEvents> g_credit_ind_sources;
+static Subscriptions<AclNocpEvents> g_acl_nocp_sources;
 
 NocpIsoEvents::~NocpIsoEvents() {
-  g_nocp_iso_handler = &g_empty_handler;
+  std::lock_guard<std::mutex> guard(g_nocp_iso_sources.mutex);
+  g_nocp_iso_sources.Remove(this);
 }
 
 void NocpIsoEvents::Bind(bluetooth::audio::asrc::ClockHandler* handler) {
-  g_nocp_iso_handler = handler;
+  std::lock_guard<std::mutex> guard(g_nocp_iso_sources.mutex);
+  handler_ = handler;
+  g_nocp_iso_sources.Add(this);
 }
 
 L2capCreditIndEvents::~L2capCreditIndEvents() {
-  std::lock_guard<std::mutex> guard(g_credit_ind_handler.mutex);
-  g_credit_ind_handler.handler = &g_empty_handler;
-  g_credit_ind_handler.links[0].connection_handle = kInvalidConnectionHandle;
-  g_credit_ind_handler.links[1].connection_handle = kInvalidConnectionHandle;
+  std::lock_guard<std::mutex> guard(g_credit_ind_sources.mutex);
+  g_credit_ind_sources.Remove(this);
 }
 
 void L2capCreditIndEvents::Bind(bluetooth::audio::asrc::ClockHandler* handler) {
-  std::lock_guard<std::mutex> guard(g_credit_ind_handler.mutex);
-  g_credit_ind_handler.handler = handler;
-  g_credit_ind_handler.links[0].connection_handle = kInvalidConnectionHandle;
-  g_credit_ind_handler.links[1].connection_handle = kInvalidConnectionHandle;
+  std::lock_guard<std::mutex> guard(g_credit_ind_sources.mutex);
+  handler_ = handler;
+  links_[0].connection_handle = kInvalidConnectionHandle;
+  links_[1].connection_handle = kInvalidConnectionHandle;
+  g_credit_ind_sources.Add(this);
 }
 
 void L2capCreditIndEvents::Update(int link_id, uint16_t connection_handle, uint16_t stream_cid) {
-  std::lock_guard<std::mutex> guard(g_credit_ind_handler.mutex);
-  g_credit_ind_handler.links[link_id].connection_handle = connection_handle;
-  g_credit_ind_handler.links[link_id].stream_cid = stream_cid;
+  std::lock_guard<std::mutex> guard(g_credit_ind_sources.mutex);
+  links_[link_id].connection_handle = connection_handle;
+  links_[link_id].stream_cid = stream_cid;
+}
+
+AclNocpEvents::~AclNocpEvents() {
+  std::lock_guard<std::mutex> guard(g_acl_nocp_sources.mutex);
+  g_acl_nocp_sources.Remove(this);
+}
+
+void AclNocpEvents::Bind(bluetooth::audio::asrc::ClockHandler* handler) {
+  std::lock_guard<std::mutex> guard(g_acl_nocp_sources.mutex);
+  handler_ = handler;
+  connection_handles_[0] = kInvalidConnectionHandle;
+  connection_handles_[1] = kInvalidConnectionHandle;
+  g_acl_nocp_sources.Add(this);
+}
+
+void AclNocpEvents::Update(int link_id, uint16_t connection_handle) {
+  std::lock_guard<std::mutex> guard(g_acl_nocp_sources.mutex);
+  connection_handles_[link_id] = connection_handle;
 }
 
 LinkClocker::LinkClocker() : cig_id_(-1), cis_handle_(-1) {}
@@ -140,16 +169,36 @@ void LinkClocker::OnHciEvent(const HciPacket& packet) {
       const uint8_t* item = payload + 1;
       if (payload_length < size_t(1 + 4 * num_handles)) return;
 
+      auto timestamp = std::chrono::system_clock::now().time_since_epoch();
+      unsigned timestamp_us =
+          std::chrono::duration_cast<std::chrono::microseconds>(timestamp).count();
+
+      {
+        std::lock_guard<std::mutex> guard(g_acl_nocp_sources.mutex);
+        for (i = 0; i < num_handles; i++) {
+          uint16_t handle = (item[4 * i] | (item[4 * i + 1] << 8)) & 0xfff;
+          for (auto source : g_acl_nocp_sources.sources) {
+            for (int link_id = 0; link_id < 2; link_id++) {
+              if (source->connection_handles_[link_id] == handle) {
+                source->handler_->OnEvent(timestamp_us, link_id, item[4 * i + 2] | (item[4 * i + 3] << 8));
+              }
+            }
+          }
+        }
+      }
+
       for (i = 0; i < num_handles && ((item[0] | (item[1] << 8)) & 0xfff) != cis_handle_;
            i++, item += 4)
         ;
       if (i >= num_handles) return;
 
-      auto timestamp = std::chrono::system_clock::now().time_since_epoch();
-      unsigned timestamp_us =
-          std::chrono::duration_cast<std::chrono::microseconds>(timestamp).count();
       int num_of_completed_packets = item[2] | (item[3] << 8);
-      (*g_nocp_iso_handler).OnEvent(timestamp_us, 0, num_of_completed_packets);
+      {
+        std::lock_guard<std::mutex> guard(g_nocp_iso_sources.mutex);
+        for (auto source : g_nocp_iso_sources.sources) {
+          source->handler_->OnEvent(timestamp_us, 0, num_of_completed_packets);
+        }
+      }
 
       break;
     }
@@ -208,11 +257,13 @@ void LinkClocker::OnAclDataReceived(const HciPacket& packet) {
           std::chrono::duration_cast<std::chrono::microseconds>(timestamp).count();
 
       {
-        std::lock_guard<std::mutex> guard(g_credit_ind_handler.mutex);
-        for (int link_id = 0; link_id < 2; link_id++) {
-          auto const& link = g_credit_ind_handler.links[link_id];
-          if (link.connection_handle == handle && link.stream_cid == channel_id) {
-            g_credit_ind_handler.handler->OnEvent(timestamp_us, link_id, credits);
+        std::lock_guard<std::mutex> guard(g_credit_ind_sources.mutex);
+        for (auto source : g_credit_ind_sources.sources) {
+          for (int link_id = 0; link_id < 2; link_id++) {
+            auto const& link = source->links_[link_id];
+            if (link.connection_handle == handle && link.stream_cid == channel_id) {
+              source->handler_->OnEvent(timestamp_us, link_id, credits);
+            }
           }
         }
       }
@@ -22,21 +22,55 @@
 
 namespace bluetooth::hal {
 
+// The clock sources below are subscriptions to the link clock events filtered
+// by the LinkClocker: each bound instance receives the events of its own
+// links, so that several audio paths (LE Audio, A2DP, Hearing Aid) can follow
+// the controller clock at the same time.
+
 class NocpIsoEvents : public bluetooth::audio::asrc::ClockSource {
  public:
   NocpIsoEvents() = default;
   ~NocpIsoEvents() override;
 
   void Bind(bluetooth::audio::asrc::ClockHandler*) override;
+
+ private:
+  friend class LinkClocker;
+  bluetooth::audio::asrc::ClockHandler* handler_ = nullptr;
 };
 
 class L2capCreditIndEvents : public bluetooth::audio::asrc::ClockSource {
  public:
-  L2capCreditIndEvents() {}
+  L2capCreditIndEvents() = default;
   ~L2capCreditIndEvents() override;
 
   void Bind(bluetooth::audio::asrc::ClockHandler*) override;
   void Update(int link_id, uint16_t connection_handle, uint16_t stream_cid);
+
+ private:
+  friend class LinkClocker;
+  bluetooth::audio::asrc::ClockHandler* handler_ = nullptr;
+  struct {
+    uint16_t connection_handle;
+    uint16_t stream_cid;
+  } links_[2] = {{0xFFFF, 0}, {0xFFFF, 0}};
+};
+
+// Number Of Completed Packets events of ACL links. The events count all the
+// packets of the link, not only the ones of the audio stream: the clock
+// handler should tolerate the occasional signaling packet.
+class AclNocpEvents : public bluetooth::audio::asrc::ClockSource {
+ public:
+  AclNocpEvents() = default;
+  ~AclNocpEvents() override;
+
+  void Bind(bluetooth::audio::asrc::ClockHandler*) override;
+  void Update(int link_id, uint16_t connection_handle);
+
+ private:
+  friend class LinkClocker;
+  bluetooth::audio::asrc::ClockHandler* handler_ = nullptr;
+  uint16_t connection_handles_[2] = {0xFFFF, 0xFFFF};
 };
 
 class LinkClocker : public ::bluetooth::Module {
@@ -20,8 +20,11 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <chrono>
+#include <cstring>
+#include <memory>
 #include <sstream>
 
 #include "common/circular_buffer.h"
@@ -42,10 +45,16 @@ using bluetooth::os::fake_timer::fake_timerfd_get_clock;
 namespace bluetooth {
 namespace hal {
 
+FilterTracker::FilterTracker() {
+  l2c_local_cid.set(1);
+  l2c_remote_cid.set(1);
+  rfcomm_channels.set(0);
+}
+
 // Adds L2CAP channel to acceptlist.
 void FilterTracker::AddL2capCid(uint16_t local_cid, uint16_t remote_cid) {
-  l2c_local_cid.insert(local_cid);
-  l2c_remote_cid.insert(remote_cid);
+  l2c_local_cid.set(local_cid);
+  l2c_remote_cid.set(remote_cid);
 }
 
 // Sets L2CAP channel that RFCOMM uses.
@@ -57,32 +66,32 @@ void FilterTracker::SetRfcommCid(uint16_t local_cid, uint16_t remote_cid) {
 // Remove L2CAP channel from acceptlist.
 void FilterTracker::RemoveL2capCid(uint16_t local_cid, uint16_t remote_cid) {
   if (rfcomm_local_cid == local_cid) {
-    rfcomm_channels.clear();
-    rfcomm_channels.insert(0);
+    rfcomm_channels.reset();
+    rfcomm_channels.set(0);
     rfcomm_local_cid = 0;
     rfcomm_remote_cid = 0;
   }
 
-  l2c_local_cid.erase(local_cid);
-  l2c_remote_cid.erase(remote_cid);
+  // The signaling channel stays acceptlisted
+  if (local_cid != 1) l2c_local_cid.reset(local_cid);
+  if (remote_cid != 1) l2c_remote_cid.reset(remote_cid);
 }
 
 void FilterTracker::AddRfcommDlci(uint8_t channel) {
-  rfcomm_channels.insert(channel);
+  rfcomm_channels.set(channel);
 }
 
-bool FilterTracker::IsAcceptlistedL2cap(bool local, uint16_t cid) {
-  const auto& set = local ? l2c_local_cid : l2c_remote_cid;
-  return (set.find(cid) != set.end());
+bool FilterTracker::IsAcceptlistedL2cap(bool local, uint16_t cid) const {
+  return local ? l2c_local_cid.test(cid) : l2c_remote_cid.test(cid);
 }
 
-bool FilterTracker::IsRfcommChannel(bool local, uint16_t cid) {
+bool FilterTracker::IsRfcommChannel(bool local, uint16_t cid) const {
   const auto& channel = local ? rfcomm_local_cid : rfcomm_remote_cid;
   return cid == channel;
 }
 
-bool FilterTracker::IsAcceptlistedDlci(uint8_t dlci) {
-  return rfcomm_channels.find(dlci) != rfcomm_channels.end();
+bool FilterTracker::IsAcceptlistedDlci(uint8_t dlci) const {
+  return rfcomm_channels.test(dlci);
 }
 
 void ProfilesFilter::SetupProfilesFilter(bool pbap_filtered, bool map_filtered) {
@@ -302,8 +311,26 @@ using namespace std::chrono_literals;
 constexpr std::chrono::hours kBtSnoozLogLifeTime = 12h;
 constexpr std::chrono::hours kBtSnoozLogDeleteRepeatingAlarmInterval = 1h;
 
+// In async write mode the writer thread wakes up once this many bytes are pending, or after
+// kBtSnoopAsyncWriteFlushInterval, whichever comes first. Records that would grow the pending
+// buffer beyond kBtSnoopAsyncWriteMaxPendingBytes are dropped and accounted for in the log.
+constexpr size_t kBtSnoopAsyncWriteBatchBytes = 64 * 1024;
+constexpr size_t kBtSnoopAsyncWriteMaxPendingBytes = 4 * 1024 * 1024;
+constexpr std::chrono::milliseconds kBtSnoopAsyncWriteFlushInterval = 100ms;
+
+// Filter trackers by ACL connection handle, allocated when the first channel of the connection is
+// acceptlisted. Packets of connections without one only have the L2CAP signaling channel logged.
+constexpr size_t kMaxAclConnectionHandles = 0x1000;
 std::mutex filter_tracker_list_mutex;
-std::unordered_map<uint16_t, FilterTracker> filter_tracker_list;
+std::array<std::unique_ptr<FilterTracker>, kMaxAclConnectionHandles> filter_tracker_list;
+
+FilterTracker& GetOrCreateFilterTracker(uint16_t conn_handle) {
+  auto& filters = filter_tracker_list[conn_handle & (kMaxAclConnectionHandles - 1)];
+  if (filters == nullptr) {
+    filters = std::make_unique<FilterTracker>();
+  }
+  return *filters;
+}
 std::unordered_map<uint16_t, uint16_t> local_cid_to_acl;
 
 std::mutex a2dpMediaChannels_mutex;
@@ -331,6 +358,10 @@ std::string get_last_log_path(std::string log_file_path) {
   return log_file_path.append(".last");
 }
 
+std::string get_ring_log_path(std::string log_file_path) {
+  return log_file_path.append(".ring");
+}
+
 void delete_btsnoop_files(const std::string& log_path) {
   LOG_INFO("Deleting logs if they exist");
   if (os::FileExists(log_path)) {
@@ -348,6 +379,10 @@ void delete_btsnoop_files(const std::string& log_path) {
   } else {
     LOG_INFO("Last log file does not exist at \"%s\"", log_path.c_str());
   }
+  auto ring_log_path = get_ring_log_path(log_path);
+  if (os::FileExists(ring_log_path) && !os::RemoveFile(ring_log_path)) {
+    LOG_ERROR("Failed to remove ring log file at \"%s\"", ring_log_path.c_str());
+  }
 }
 
 void delete_old_btsnooz_files(const std::string& log_path, const std::chrono::milliseconds log_life_time) {
@@ -453,6 +488,10 @@ const std::string SnoopLogger::kBtSnoopLogFilterProfilePbapModeProperty =
 const std::string SnoopLogger::kBtSnoopLogFilterProfileRfcommProperty =
     "persist.bluetooth.snooplogfilter.profiles.rfcomm.enabled";
 const std::string SnoopLogger::kSoCManufacturerProperty = "ro.soc.manufacturer";
+// Moves btsnoop file writes off the capture path onto a batching writer thread
+const std::string SnoopLogger::kBtSnoopAsyncWriteProperty = "persist.bluetooth.btsnoopasyncwrite";
+// Size in bytes of the pre-allocated btsnoop ring file, ring file mode is disabled when unset or 0
+const std::string SnoopLogger::kBtSnoopRingFileSizeProperty = "persist.bluetooth.btsnoopringfilesize";
 
 // persist.bluetooth.btsnooplogmode
 const std::string SnoopLogger::kBtSnoopLogModeDisabled = "disabled";
@@ -486,7 +525,9 @@ SnoopLogger::SnoopLogger(
     bool qualcomm_debug_log_enabled,
     const std::chrono::milliseconds snooz_log_life_time,
     const std::chrono::milliseconds snooz_log_delete_alarm_interval,
-    bool snoop_log_persists)
+    bool snoop_log_persists,
+    bool async_write_enabled,
+    size_t ring_file_size)
     : snoop_log_path_(std::move(snoop_log_path)),
       snooz_log_path_(std::move(snooz_log_path)),
       max_packets_per_file_(max_packets_per_file),
@@ -494,7 +535,9 @@ SnoopLogger::SnoopLogger(
       qualcomm_debug_log_enabled_(qualcomm_debug_log_enabled),
       snooz_log_life_time_(snooz_log_life_time),
       snooz_log_delete_alarm_interval_(snooz_log_delete_alarm_interval),
-      snoop_log_persists(snoop_log_persists) {
+      snoop_log_persists(snoop_log_persists),
+      async_write_enabled_(async_write_enabled),
+      ring_file_size_(ring_file_size) {
   btsnoop_mode_ = btsnoop_mode;
 
   if (btsnoop_mode_ == kBtSnoopLogModeFiltered) {
@@ -625,7 +668,9 @@ bool SnoopLogger::ShouldFilterLog(bool is_received, uint8_t* packet) {
   uint16_t conn_handle =
       ((((uint16_t)packet[ACL_CHANNEL_OFFSET + 1]) << 8) + packet[ACL_CHANNEL_OFFSET]) & 0x0fff;
   std::lock_guard<std::mutex> lock(filter_tracker_list_mutex);
-  auto& filters = filter_tracker_list[conn_handle];
+  static const FilterTracker kDefaultFilterTracker;
+  const FilterTracker* p_filters = filter_tracker_list[conn_handle].get();
+  const FilterTracker& filters = p_filters != nullptr ? *p_filters : kDefaultFilterTracker;
   uint16_t cid = (packet[L2CAP_CHANNEL_OFFSET + 1] << 8) + packet[L2CAP_CHANNEL_OFFSET];
   if (filters.IsRfcommChannel(is_received, cid)) {
     uint8_t rfcomm_event = packet[RFCOMM_EVENT_OFFSET] & 0b11101111;
@@ -888,7 +933,7 @@ void SnoopLogger::AcceptlistL2capChannel(
 
   // This will create the entry if there is no associated filter with the
   // connection.
-  filter_tracker_list[conn_handle].AddL2capCid(local_cid, remote_cid);
+  GetOrCreateFilterTracker(conn_handle).AddL2capCid(local_cid, remote_cid);
 }
 
 void SnoopLogger::AcceptlistRfcommDlci(uint16_t conn_handle, uint16_t local_cid, uint8_t dlci) {
@@ -900,7 +945,7 @@ void SnoopLogger::AcceptlistRfcommDlci(uint16_t conn_handle, uint16_t local_cid,
   LOG_DEBUG("Acceptlisting rfcomm channel: local cid=%d, dlci=%d", local_cid, dlci);
   std::lock_guard<std::mutex> lock(filter_tracker_list_mutex);
 
-  filter_tracker_list[conn_handle].AddRfcommDlci(dlci);
+  GetOrCreateFilterTracker(conn_handle).AddRfcommDlci(dlci);
 }
 
 void SnoopLogger::AddRfcommL2capChannel(
@@ -917,7 +962,7 @@ void SnoopLogger::AddRfcommL2capChannel(
       remote_cid);
   std::lock_guard<std::mutex> lock(filter_tracker_list_mutex);
 
-  filter_tracker_list[conn_handle].SetRfcommCid(local_cid, remote_cid);
+  GetOrCreateFilterTracker(conn_handle).SetRfcommCid(local_cid, remote_cid);
   local_cid_to_acl.insert({local_cid, conn_handle});
 }
 
@@ -935,7 +980,7 @@ void SnoopLogger::ClearL2capAcceptlist(
       remote_cid);
   std::lock_guard<std::mutex> lock(filter_tracker_list_mutex);
 
-  filter_tracker_list[conn_handle].RemoveL2capCid(local_cid, remote_cid);
+  GetOrCreateFilterTracker(conn_handle).RemoveL2capCid(local_cid, remote_cid);
 }
 
 bool SnoopLogger::IsA2dpMediaChannel(uint16_t conn_handle, uint16_t cid, bool is_local_cid) {
@@ -1243,6 +1288,21 @@ void SnoopLogger::Capture(HciPacket& packet, Direction direction, PacketType typ
       header.length_captured = htonl(length);
     }
 
+    if (socket_ != nullptr) {
+      socket_->Write(&header, sizeof(PacketHeaderType));
+      socket_->Write(packet.data(), (size_t)(length - 1));
+    }
+
+    if (ring_file_ != nullptr) {
+      ring_file_->Write(&header, sizeof(PacketHeaderType), packet.data(), length - 1);
+      return;
+    }
+
+    if (async_write_enabled_) {
+      EnqueueAsyncRecord(header, packet.data(), length - 1);
+      return;
+    }
+
     packet_counter_++;
     if (packet_counter_ > max_packets_per_file_) {
       OpenNextSnoopLogFile();
@@ -1254,11 +1314,6 @@ void SnoopLogger::Capture(HciPacket& packet, Direction direction, PacketType typ
       LOG_ERROR("Failed to write packet payload for btsnoop, error: \"%s\"", strerror(errno));
     }
 
-    if (socket_ != nullptr) {
-      socket_->Write(&header, sizeof(PacketHeaderType));
-      socket_->Write(packet.data(), (size_t)(length - 1));
-    }
-
     // std::ofstream::flush() pushes user data into kernel memory. The data will be written even if this process
     // crashes. However, data will be lost if there is a kernel panic, which is out of scope of BT snoop log.
     // NOTE: std::ofstream::write() followed by std::ofstream::flush() has similar effect as UNIX write(fd, data, len)
@@ -1269,6 +1324,152 @@ void SnoopLogger::Capture(HciPacket& packet, Direction direction, PacketType typ
   }
 }
 
+bool SnoopLogger::OpenRingFile() {
+  std::lock_guard<std::recursive_mutex> lock(file_mutex_);
+  auto ring_file_path = get_ring_log_path(snoop_log_path_);
+  auto last_file_path = get_last_log_path(snoop_log_path_);
+
+  // A ring file left behind means the previous session did not stop cleanly, recover its content
+  // as the latest log before rotating
+  if (os::FileExists(ring_file_path)) {
+    LOG_INFO("Recovering snoop ring file \"%s\" from previous session", ring_file_path.c_str());
+    SnoopLoggerRingFile::Linearize(ring_file_path, snoop_log_path_);
+  }
+  if (os::FileExists(snoop_log_path_) && !os::RenameFile(snoop_log_path_, last_file_path)) {
+    LOG_ERROR(
+        "Unabled to rename existing snoop log from \"%s\" to \"%s\"",
+        snoop_log_path_.c_str(),
+        last_file_path.c_str());
+  }
+
+  mode_t prevmask = umask(0);
+  ring_file_ = std::make_unique<SnoopLoggerRingFile>(ring_file_path, ring_file_size_);
+  bool opened = ring_file_->Open();
+  umask(prevmask);
+  if (!opened) {
+    LOG_ERROR("Unable to set up snoop ring file, falling back to regular snoop log");
+    ring_file_.reset();
+    return false;
+  }
+  LOG_INFO(
+      "Snoop Logs ring file enabled, %zu chunks of %zu bytes",
+      ring_file_->GetChunkCount(),
+      SnoopLoggerRingFile::kDefaultChunkSize);
+  return true;
+}
+
+void SnoopLogger::CloseRingFile() {
+  std::lock_guard<std::recursive_mutex> lock(file_mutex_);
+  if (ring_file_ == nullptr) {
+    return;
+  }
+  if (ring_file_->LinearizeTo(snoop_log_path_)) {
+    ring_file_->Close();
+    os::RemoveFile(ring_file_->GetPath());
+  } else {
+    // Keep the ring file around, it is recovered on next start
+    ring_file_->Close();
+  }
+  ring_file_.reset();
+}
+
+void SnoopLogger::EnqueueAsyncRecord(
+    const PacketHeaderType& header, const uint8_t* payload, size_t payload_length) {
+  std::lock_guard<std::mutex> lock(pending_mutex_);
+  if (!writer_running_) {
+    return;
+  }
+  size_t record_length = sizeof(PacketHeaderType) + payload_length;
+  if (pending_records_.size() + record_length > kBtSnoopAsyncWriteMaxPendingBytes) {
+    pending_dropped_packets_++;
+    return;
+  }
+  auto header_bytes = reinterpret_cast<const uint8_t*>(&header);
+  pending_records_.insert(pending_records_.end(), header_bytes, header_bytes + sizeof(PacketHeaderType));
+  pending_records_.insert(pending_records_.end(), payload, payload + payload_length);
+  if (pending_records_.size() >= kBtSnoopAsyncWriteBatchBytes) {
+    pending_cv_.notify_one();
+  }
+}
+
+void SnoopLogger::StartAsyncWriter() {
+  std::lock_guard<std::mutex> lock(pending_mutex_);
+  pending_records_.reserve(kBtSnoopAsyncWriteBatchBytes);
+  pending_dropped_packets_ = 0;
+  writer_running_ = true;
+  writer_thread_ = std::thread(&SnoopLogger::AsyncWriterLoop, this);
+}
+
+void SnoopLogger::StopAsyncWriter() {
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (!writer_running_) {
+      return;
+    }
+    writer_running_ = false;
+  }
+  pending_cv_.notify_one();
+  // The writer drains whatever is still pending before exiting
+  writer_thread_.join();
+}
+
+void SnoopLogger::AsyncWriterLoop() {
+  std::vector<uint8_t> batch;
+  batch.reserve(kBtSnoopAsyncWriteBatchBytes);
+  bool running = true;
+  while (running) {
+    size_t dropped_packets = 0;
+    {
+      std::unique_lock<std::mutex> lock(pending_mutex_);
+      pending_cv_.wait_for(lock, kBtSnoopAsyncWriteFlushInterval, [this] {
+        return !writer_running_ || pending_records_.size() >= kBtSnoopAsyncWriteBatchBytes;
+      });
+      running = writer_running_;
+      batch.swap(pending_records_);
+      std::swap(dropped_packets, pending_dropped_packets_);
+    }
+    if (dropped_packets > 0) {
+      LOG_WARN("Dropped %zu btsnoop packets, writer is falling behind", dropped_packets);
+    }
+    if (!batch.empty()) {
+      WriteRecordBatch(batch);
+      batch.clear();
+    }
+  }
+}
+
+void SnoopLogger::WriteRecordBatch(const std::vector<uint8_t>& batch) {
+  // Only the writer thread touches btsnoop_ostream_ and packet_counter_ while it is running, so
+  // file_mutex_ is only needed around rotation and the capture path never waits on disk I/O.
+  auto write_range = [this, &batch](size_t begin, size_t end) {
+    if (begin != end &&
+        !btsnoop_ostream_.write(reinterpret_cast<const char*>(batch.data() + begin), end - begin)) {
+      LOG_ERROR("Failed to write packet batch for btsnoop, error: \"%s\"", strerror(errno));
+    }
+  };
+
+  size_t begin = 0;
+  size_t offset = 0;
+  while (offset < batch.size()) {
+    PacketHeaderType header;
+    std::memcpy(&header, batch.data() + offset, sizeof(PacketHeaderType));
+    size_t record_length = sizeof(PacketHeaderType) + ntohl(header.length_captured) - PACKET_TYPE_LENGTH;
+
+    packet_counter_++;
+    if (packet_counter_ > max_packets_per_file_) {
+      write_range(begin, offset);
+      OpenNextSnoopLogFile();
+      begin = offset;
+    }
+    offset += record_length;
+  }
+  write_range(begin, batch.size());
+
+  if (!btsnoop_ostream_.flush()) {
+    LOG_ERROR("Failed to flush, error: \"%s\"", strerror(errno));
+  }
+}
+
 void SnoopLogger::DumpSnoozLogToFile(const std::vector<std::string>& data) const {
   std::lock_guard<std::recursive_mutex> lock(file_mutex_);
   if (btsnoop_mode_ != kBtSnoopLogModeDisabled) {
@@ -1318,7 +1519,9 @@ void SnoopLogger::ListDependencies(ModuleList* /* list */) const {
 void SnoopLogger::Start() {
   std::lock_guard<std::recursive_mutex> lock(file_mutex_);
   if (btsnoop_mode_ != kBtSnoopLogModeDisabled) {
-    OpenNextSnoopLogFile();
+    if (ring_file_size_ == 0 || !OpenRingFile()) {
+      OpenNextSnoopLogFile();
+    }
 
     if (btsnoop_mode_ == kBtSnoopLogModeFiltered) {
       EnableFilters();
@@ -1336,6 +1539,11 @@ void SnoopLogger::Start() {
       snoop_logger_socket_thread_.reset();
       snoop_logger_socket_thread_ = nullptr;
     }
+
+    if (async_write_enabled_ && ring_file_ == nullptr) {
+      LOG_INFO("Snoop Logs async write enabled");
+      StartAsyncWriter();
+    }
   }
   alarm_ = std::make_unique<os::RepeatingAlarm>(GetHandler());
   alarm_->Schedule(
@@ -1343,8 +1551,12 @@ void SnoopLogger::Start() {
 }
 
 void SnoopLogger::Stop() {
+  // Must happen before taking file_mutex_, the writer takes it when rotating files
+  StopAsyncWriter();
+
   std::lock_guard<std::recursive_mutex> lock(file_mutex_);
   LOG_DEBUG("Closing btsnoop log data at %s", snoop_log_path_.c_str());
+  CloseRingFile();
   CloseCurrentSnoopLogFile();
 
   if (snoop_logger_socket_thread_ != nullptr) {
@@ -1369,6 +1581,13 @@ void SnoopLogger::Stop() {
 
 DumpsysDataFinisher SnoopLogger::GetDumpsysData(
     flatbuffers::FlatBufferBuilder* /* builder */) const {
+  {
+    std::lock_guard<std::recursive_mutex> lock(file_mutex_);
+    if (ring_file_ != nullptr) {
+      LOG_DEBUG("Linearizing btsnoop ring file to %s", snoop_log_path_.c_str());
+      ring_file_->LinearizeTo(snoop_log_path_);
+    }
+  }
   LOG_DEBUG("Dumping btsnooz log data to %s", snooz_log_path_.c_str());
   DumpSnoozLogToFile(btsnooz_buffer_.Pull());
   return EmptyDumpsysDataFinisher;
@@ -1444,6 +1663,21 @@ bool SnoopLogger::IsBtSnoopLogPersisted() {
   return is_debuggable && os::GetSystemPropertyBool(kBtSnoopLogPersists, false);
 }
 
+bool SnoopLogger::IsBtSnoopAsyncWriteEnabled() {
+  return os::GetSystemPropertyBool(kBtSnoopAsyncWriteProperty, false);
+}
+
+size_t SnoopLogger::GetRingFileSize() {
+  auto ring_file_size_prop = os::GetSystemProperty(kBtSnoopRingFileSizeProperty);
+  if (ring_file_size_prop) {
+    auto ring_file_size = common::Uint64FromString(ring_file_size_prop.value());
+    if (ring_file_size) {
+      return ring_file_size.value();
+    }
+  }
+  return 0;
+}
+
 bool SnoopLogger::IsQualcommDebugLogEnabled() {
   // Check system prop if the soc manufacturer is Qualcomm
   bool qualcomm_debug_log_enabled = false;
@@ -1465,7 +1699,9 @@ const ModuleFactory SnoopLogger::Factory = ModuleFactory([]() {
       IsQualcommDebugLogEnabled(),
       kBtSnoozLogLifeTime,
       kBtSnoozLogDeleteRepeatingAlarmInterval,
-      IsBtSnoopLogPersisted());
+      IsBtSnoopLogPersisted(),
+      IsBtSnoopAsyncWriteEnabled(),
+      GetRingFileSize());
 });
 
 }  // namespace hal
@@ -16,14 +16,18 @@
 
 #pragma once
 
+#include <bitset>
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "common/circular_buffer.h"
 #include "hal/hci_hal.h"
+#include "hal/snoop_logger_ring_file.h"
 #include "hal/snoop_logger_socket_interface.h"
 #include "hal/snoop_logger_socket_thread.h"
 #include "hal/syscall_wrapper_impl.h"
@@ -37,14 +41,18 @@ namespace hal {
 static uint64_t file_creation_time;
 #endif
 
+// Acceptlisted channels of one ACL connection. The channels are flat tables indexed by CID and DLCI,
+// updated when channels are opened and closed, so that filtering a packet is a single lookup.
 class FilterTracker {
  public:
+  FilterTracker();
+
   // NOTE: 1 is used as a static CID for L2CAP signaling
-  std::unordered_set<uint16_t> l2c_local_cid = {1};
-  std::unordered_set<uint16_t> l2c_remote_cid = {1};
+  std::bitset<0x10000> l2c_local_cid;
+  std::bitset<0x10000> l2c_remote_cid;
   uint16_t rfcomm_local_cid = 0;
   uint16_t rfcomm_remote_cid = 0;
-  std::unordered_set<uint16_t> rfcomm_channels = {0};
+  std::bitset<0x100> rfcomm_channels;
 
   // Adds L2C channel to acceptlist.
   void AddL2capCid(uint16_t local_cid, uint16_t remote_cid);
@@ -57,11 +65,11 @@ class FilterTracker {
 
   void AddRfcommDlci(uint8_t channel);
 
-  bool IsAcceptlistedL2cap(bool local, uint16_t cid);
+  bool IsAcceptlistedL2cap(bool local, uint16_t cid) const;
 
-  bool IsRfcommChannel(bool local, uint16_t cid);
+  bool IsRfcommChannel(bool local, uint16_t cid) const;
 
-  bool IsAcceptlistedDlci(uint8_t dlci);
+  bool IsAcceptlistedDlci(uint8_t dlci) const;
 };
 
 typedef enum {
@@ -152,6 +160,8 @@ class SnoopLogger : public ::bluetooth::Module {
   static const std::string kBtSnoopLogFilterProfilePbapModeProperty;
   static const std::string kBtSnoopLogFilterProfileRfcommProperty;
   static const std::string kSoCManufacturerProperty;
+  static const std::string kBtSnoopAsyncWriteProperty;
+  static const std::string kBtSnoopRingFileSizeProperty;
 
   static const std::string kBtSnoopLogModeDisabled;
   static const std::string kBtSnoopLogModeFiltered;
@@ -207,6 +217,14 @@ class SnoopLogger : public ::bluetooth::Module {
   // Returns whether snoop log persists even after restarting Bluetooth
   static bool IsBtSnoopLogPersisted();
 
+  // Returns whether btsnoop file writes are batched on a background thread
+  // Changes to this value is only effective after restarting Bluetooth
+  static bool IsBtSnoopAsyncWriteEnabled();
+
+  // Returns the size in bytes of the memory mapped btsnoop ring file, 0 when ring file mode is off
+  // Changes to this value is only effective after restarting Bluetooth
+  static size_t GetRingFileSize();
+
   // Has to be defined from 1 to 4 per btsnoop format
   enum PacketType {
     CMD = 1,
@@ -288,7 +306,9 @@ class SnoopLogger : public ::bluetooth::Module {
       bool qualcomm_debug_log_enabled,
       const std::chrono::milliseconds snooz_log_life_time,
       const std::chrono::milliseconds snooz_log_delete_alarm_interval,
-      bool snoop_log_persists);
+      bool snoop_log_persists,
+      bool async_write_enabled = false,
+      size_t ring_file_size = 0);
   void CloseCurrentSnoopLogFile();
   void OpenNextSnoopLogFile();
   void DumpSnoozLogToFile(const std::vector<std::string>& data) const;
@@ -331,6 +351,19 @@ class SnoopLogger : public ::bluetooth::Module {
       uint32_t& length,
       PacketHeaderType header);
 
+  // Async write mode: Capture() appends filtered records to |pending_records_| and the writer
+  // thread drains them to the btsnoop file in batches, flushing once per batch.
+  void StartAsyncWriter();
+  void StopAsyncWriter();
+  void EnqueueAsyncRecord(const PacketHeaderType& header, const uint8_t* payload, size_t payload_length);
+  void AsyncWriterLoop();
+  void WriteRecordBatch(const std::vector<uint8_t>& batch);
+
+  // Ring file mode: records are copied into a pre-allocated memory mapped file and turned into a
+  // regular btsnoop log at |snoop_log_path_| on dumpsys and when the module stops.
+  bool OpenRingFile();
+  void CloseRingFile();
+
   std::unique_ptr<SnoopLoggerSocketThread> snoop_logger_socket_thread_;
 
  private:
@@ -349,6 +382,17 @@ class SnoopLogger : public ::bluetooth::Module {
   SnoopLoggerSocketInterface* socket_;
   SyscallWrapperImpl syscall_if;
   bool snoop_log_persists = false;
+
+  bool async_write_enabled_ = false;
+  std::mutex pending_mutex_;
+  std::condition_variable pending_cv_;
+  std::vector<uint8_t> pending_records_;
+  size_t pending_dropped_packets_ = 0;
+  bool writer_running_ = false;
+  std::thread writer_thread_;
+
+  size_t ring_file_size_ = 0;
+  std::unique_ptr<SnoopLoggerRingFile> ring_file_;
 };
 
 }  // namespace hal
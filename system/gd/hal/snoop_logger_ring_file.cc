@@ -0,0 +1,234 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hal/snoop_logger_ring_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include "hal/snoop_logger_common.h"
+#include "os/log.h"
+#include "os/utils.h"
+
+namespace bluetooth {
+namespace hal {
+
+namespace {
+
+// Chunks start after the first page, which only holds the file header
+constexpr size_t kDataOffset = 4096;
+
+constexpr size_t kMinChunkCount = 2;
+
+}  // namespace
+
+SnoopLoggerRingFile::SnoopLoggerRingFile(std::string path, size_t file_size, size_t chunk_size)
+    : path_(std::move(path)),
+      chunk_size_(chunk_size),
+      chunk_count_(std::max(file_size / chunk_size, kMinChunkCount)),
+      file_size_(kDataOffset + chunk_count_ * chunk_size_) {
+  ASSERT(chunk_size_ > sizeof(ChunkHeaderType));
+}
+
+SnoopLoggerRingFile::~SnoopLoggerRingFile() {
+  Close();
+}
+
+bool SnoopLoggerRingFile::Open() {
+  Close();
+
+  RUN_NO_INTR(fd_ = open(path_.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666));
+  if (fd_ < 0) {
+    LOG_ERROR("Unable to open snoop ring file at \"%s\", error: \"%s\"", path_.c_str(), strerror(errno));
+    return false;
+  }
+  if (ftruncate(fd_, file_size_) != 0) {
+    LOG_ERROR("Unable to size snoop ring file to %zu bytes, error: \"%s\"", file_size_, strerror(errno));
+    Close();
+    return false;
+  }
+  // Allocate all blocks up front so that writes never hit the filesystem allocator. Not every
+  // filesystem supports it, the sparse file is still usable in that case.
+  int ret = posix_fallocate(fd_, 0, file_size_);
+  if (ret != 0) {
+    LOG_WARN("Unable to pre-allocate snoop ring file, error: \"%s\"", strerror(ret));
+  }
+
+  void* base = mmap(nullptr, file_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (base == MAP_FAILED) {
+    LOG_ERROR("Unable to map snoop ring file, error: \"%s\"", strerror(errno));
+    Close();
+    return false;
+  }
+  base_ = static_cast<uint8_t*>(base);
+
+  FileHeaderType header = kRingFileHeader;
+  header.chunk_size = chunk_size_;
+  header.chunk_count = chunk_count_;
+  std::memcpy(base_, &header, sizeof(header));
+  for (size_t i = 0; i < chunk_count_; i++) {
+    std::memset(ChunkHeaderAt(i), 0, sizeof(ChunkHeaderType));
+  }
+
+  current_chunk_ = 0;
+  sequence_ = 1;
+  ChunkHeaderAt(current_chunk_)->sequence = sequence_;
+  return true;
+}
+
+void SnoopLoggerRingFile::Close() {
+  if (base_ != nullptr) {
+    munmap(base_, file_size_);
+    base_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+}
+
+SnoopLoggerRingFile::ChunkHeaderType* SnoopLoggerRingFile::ChunkHeaderAt(size_t index) const {
+  return reinterpret_cast<ChunkHeaderType*>(base_ + kDataOffset + index * chunk_size_);
+}
+
+uint8_t* SnoopLoggerRingFile::ChunkDataAt(size_t index) const {
+  return base_ + kDataOffset + index * chunk_size_ + sizeof(ChunkHeaderType);
+}
+
+void SnoopLoggerRingFile::AdvanceChunk() {
+  current_chunk_ = (current_chunk_ + 1) % chunk_count_;
+  auto* chunk = ChunkHeaderAt(current_chunk_);
+  // Invalidate the content first so that a crash in between never exposes stale records under the
+  // new sequence number
+  chunk->used_bytes = 0;
+  chunk->sequence = ++sequence_;
+}
+
+bool SnoopLoggerRingFile::Write(
+    const void* header, size_t header_length, const void* payload, size_t payload_length) {
+  if (base_ == nullptr) {
+    return false;
+  }
+  const size_t capacity = chunk_size_ - sizeof(ChunkHeaderType);
+  const size_t record_length = header_length + payload_length;
+  if (record_length > capacity) {
+    LOG_WARN("Dropping %zu bytes snoop record, larger than ring chunk", record_length);
+    return false;
+  }
+
+  auto* chunk = ChunkHeaderAt(current_chunk_);
+  if (chunk->used_bytes + record_length > capacity) {
+    AdvanceChunk();
+    chunk = ChunkHeaderAt(current_chunk_);
+  }
+  uint8_t* dest = ChunkDataAt(current_chunk_) + chunk->used_bytes;
+  std::memcpy(dest, header, header_length);
+  std::memcpy(dest + header_length, payload, payload_length);
+  // Only publish the record once it is complete
+  chunk->used_bytes += record_length;
+  return true;
+}
+
+bool SnoopLoggerRingFile::LinearizeTo(const std::string& btsnoop_path) const {
+  if (base_ == nullptr) {
+    return false;
+  }
+  return LinearizeMapping(base_, file_size_, btsnoop_path);
+}
+
+bool SnoopLoggerRingFile::Linearize(const std::string& ring_path, const std::string& btsnoop_path) {
+  int fd;
+  RUN_NO_INTR(fd = open(ring_path.c_str(), O_RDONLY | O_CLOEXEC));
+  if (fd < 0) {
+    LOG_ERROR("Unable to open snoop ring file at \"%s\", error: \"%s\"", ring_path.c_str(), strerror(errno));
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < kDataOffset) {
+    LOG_ERROR("Invalid snoop ring file at \"%s\"", ring_path.c_str());
+    close(fd);
+    return false;
+  }
+  size_t length = st.st_size;
+  void* base = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    LOG_ERROR("Unable to map snoop ring file, error: \"%s\"", strerror(errno));
+    return false;
+  }
+  bool result = LinearizeMapping(static_cast<const uint8_t*>(base), length, btsnoop_path);
+  munmap(base, length);
+  return result;
+}
+
+bool SnoopLoggerRingFile::LinearizeMapping(const uint8_t* base, size_t length, const std::string& btsnoop_path) {
+  FileHeaderType header;
+  std::memcpy(&header, base, sizeof(header));
+  if (std::memcmp(
+          header.identification_pattern,
+          kRingFileHeader.identification_pattern,
+          sizeof(header.identification_pattern)) != 0 ||
+      header.version_number != kRingFileHeader.version_number || header.chunk_size <= sizeof(ChunkHeaderType) ||
+      kDataOffset + static_cast<size_t>(header.chunk_size) * header.chunk_count > length) {
+    LOG_ERROR("Snoop ring file header is invalid, skip linearizing");
+    return false;
+  }
+
+  // Collect the chunks in use, oldest first
+  std::vector<std::pair<uint64_t, const uint8_t*>> chunks;
+  const size_t capacity = header.chunk_size - sizeof(ChunkHeaderType);
+  for (size_t i = 0; i < header.chunk_count; i++) {
+    const uint8_t* chunk = base + kDataOffset + i * header.chunk_size;
+    ChunkHeaderType chunk_header;
+    std::memcpy(&chunk_header, chunk, sizeof(chunk_header));
+    if (chunk_header.sequence == 0 || chunk_header.used_bytes == 0 || chunk_header.used_bytes > capacity) {
+      continue;
+    }
+    uint64_t sequence = chunk_header.sequence;
+    chunks.emplace_back(sequence, chunk);
+  }
+  std::sort(chunks.begin(), chunks.end());
+
+  std::ofstream btsnoop_ostream(btsnoop_path, std::ios::binary | std::ios::out);
+  if (!btsnoop_ostream.good()) {
+    LOG_ERROR("Unable to open snoop log at \"%s\", error: \"%s\"", btsnoop_path.c_str(), strerror(errno));
+    return false;
+  }
+  btsnoop_ostream.write(
+      reinterpret_cast<const char*>(&SnoopLoggerCommon::kBtSnoopFileHeader), sizeof(SnoopLoggerCommon::FileHeaderType));
+  for (const auto& [sequence, chunk] : chunks) {
+    ChunkHeaderType chunk_header;
+    std::memcpy(&chunk_header, chunk, sizeof(chunk_header));
+    btsnoop_ostream.write(reinterpret_cast<const char*>(chunk + sizeof(ChunkHeaderType)), chunk_header.used_bytes);
+  }
+  if (!btsnoop_ostream.flush()) {
+    LOG_ERROR("Failed to write linearized snoop log, error: \"%s\"", strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+}  // namespace hal
+}  // namespace bluetooth
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bluetooth {
+namespace hal {
+
+// Fixed size, pre-allocated and memory mapped btsnoop log.
+//
+// The file is split into equally sized chunks. Records are appended to the current chunk with a
+// memcpy and never span two chunks; once a chunk is full the next one (modulo the chunk count) is
+// reused with a higher sequence number. Each chunk header only accounts for complete records, so
+// the file is consistent at any point in time and survives a crash of the process. Linearize()
+// turns the chunks back into a regular btsnoop file, oldest chunk first.
+class SnoopLoggerRingFile {
+ public:
+  static constexpr size_t kDefaultChunkSize = 256 * 1024;
+
+  struct FileHeaderType {
+    uint8_t identification_pattern[8];
+    uint32_t version_number;
+    uint32_t chunk_size;
+    uint32_t chunk_count;
+    uint32_t reserved;
+  } __attribute__((__packed__));
+
+  struct ChunkHeaderType {
+    uint64_t sequence;
+    uint32_t used_bytes;
+    uint32_t reserved;
+  } __attribute__((__packed__));
+
+  static constexpr FileHeaderType kRingFileHeader = {
+      .identification_pattern = {'b', 't', 's', 'n', 'r', 'i', 'n', 'g'},
+      .version_number = 1,
+      .chunk_size = 0,
+      .chunk_count = 0,
+      .reserved = 0};
+
+  // |file_size| is rounded down to a whole number of chunks, with a minimum of two chunks
+  SnoopLoggerRingFile(std::string path, size_t file_size, size_t chunk_size = kDefaultChunkSize);
+  SnoopLoggerRingFile(const SnoopLoggerRingFile&) = delete;
+  SnoopLoggerRingFile& operator=(const SnoopLoggerRingFile&) = delete;
+  ~SnoopLoggerRingFile();
+
+  // Creates (or truncates) the file at |path|, allocates its blocks and maps it
+  bool Open();
+  void Close();
+  bool IsOpen() const {
+    return base_ != nullptr;
+  }
+
+  // Appends one btsnoop record made of |header| followed by |payload|. Returns false if the record
+  // is larger than a chunk and has been dropped.
+  bool Write(const void* header, size_t header_length, const void* payload, size_t payload_length);
+
+  // Writes the records held in the mapped file to |btsnoop_path| as a regular btsnoop file
+  bool LinearizeTo(const std::string& btsnoop_path) const;
+
+  // Same as LinearizeTo() for a ring file left on disk, e.g. by a previous session
+  static bool Linearize(const std::string& ring_path, const std::string& btsnoop_path);
+
+  const std::string& GetPath() const {
+    return path_;
+  }
+  size_t GetChunkCount() const {
+    return chunk_count_;
+  }
+
+ private:
+  static bool LinearizeMapping(const uint8_t* base, size_t length, const std::string& btsnoop_path);
+
+  ChunkHeaderType* ChunkHeaderAt(size_t index) const;
+  uint8_t* ChunkDataAt(size_t index) const;
+  void AdvanceChunk();
+
+  std::string path_;
+  size_t chunk_size_;
+  size_t chunk_count_;
+  size_t file_size_;
+  int fd_ = -1;
+  uint8_t* base_ = nullptr;
+  size_t current_chunk_ = 0;
+  uint64_t sequence_ = 0;
+};
+
+}  // namespace hal
+}  // namespace bluetooth
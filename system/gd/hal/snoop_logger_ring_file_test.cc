@@ -0,0 +1,158 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hal/snoop_logger_ring_file.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "hal/snoop_logger_common.h"
+
+namespace testing {
+
+using bluetooth::hal::SnoopLoggerCommon;
+using bluetooth::hal::SnoopLoggerRingFile;
+
+namespace {
+
+constexpr size_t kChunkSize = 128;
+constexpr size_t kRecordHeaderSize = 8;
+constexpr size_t kRecordPayloadSize = 24;
+constexpr size_t kRecordSize = kRecordHeaderSize + kRecordPayloadSize;
+// (kChunkSize - chunk header) / kRecordSize
+constexpr size_t kRecordsPerChunk = 3;
+
+std::vector<uint8_t> ReadFile(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+class SnoopLoggerRingFileTest : public Test {
+ protected:
+  void SetUp() override {
+    temp_dir_ = std::filesystem::temp_directory_path();
+    ring_path_ = temp_dir_ / "btsnoop_hci.log.ring";
+    btsnoop_path_ = temp_dir_ / "btsnoop_hci.log";
+    std::filesystem::remove(ring_path_);
+    std::filesystem::remove(btsnoop_path_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(ring_path_);
+    std::filesystem::remove(btsnoop_path_);
+  }
+
+  // Writes record |index|, every byte of which is set to |index|
+  static void WriteRecord(SnoopLoggerRingFile& ring, uint8_t index) {
+    std::vector<uint8_t> header(kRecordHeaderSize, index);
+    std::vector<uint8_t> payload(kRecordPayloadSize, index);
+    ASSERT_TRUE(ring.Write(header.data(), header.size(), payload.data(), payload.size()));
+  }
+
+  // Checks that |btsnoop_path_| is a btsnoop file holding records [first, last]
+  void ExpectRecords(uint8_t first, uint8_t last) {
+    auto content = ReadFile(btsnoop_path_);
+    ASSERT_EQ(
+        content.size(),
+        sizeof(SnoopLoggerCommon::FileHeaderType) + kRecordSize * (last - first + 1));
+    ASSERT_EQ(
+        0,
+        std::memcmp(
+            content.data(), &SnoopLoggerCommon::kBtSnoopFileHeader, sizeof(SnoopLoggerCommon::FileHeaderType)));
+    size_t offset = sizeof(SnoopLoggerCommon::FileHeaderType);
+    for (int index = first; index <= last; index++) {
+      for (size_t i = 0; i < kRecordSize; i++) {
+        ASSERT_EQ(content[offset + i], index);
+      }
+      offset += kRecordSize;
+    }
+  }
+
+  std::filesystem::path temp_dir_;
+  std::filesystem::path ring_path_;
+  std::filesystem::path btsnoop_path_;
+};
+
+TEST_F(SnoopLoggerRingFileTest, file_is_preallocated) {
+  SnoopLoggerRingFile ring(ring_path_.string(), 4 * kChunkSize, kChunkSize);
+  ASSERT_TRUE(ring.Open());
+  ASSERT_EQ(ring.GetChunkCount(), 4u);
+  ASSERT_TRUE(std::filesystem::exists(ring_path_));
+  auto size = std::filesystem::file_size(ring_path_);
+  ring.Close();
+  ASSERT_EQ(size, std::filesystem::file_size(ring_path_));
+  ASSERT_GE(size, 4 * kChunkSize);
+}
+
+TEST_F(SnoopLoggerRingFileTest, linearize_before_wrap) {
+  SnoopLoggerRingFile ring(ring_path_.string(), 4 * kChunkSize, kChunkSize);
+  ASSERT_TRUE(ring.Open());
+  for (uint8_t i = 1; i <= 5; i++) {
+    WriteRecord(ring, i);
+  }
+  ASSERT_TRUE(ring.LinearizeTo(btsnoop_path_.string()));
+  ExpectRecords(1, 5);
+}
+
+TEST_F(SnoopLoggerRingFileTest, linearize_after_wrap_keeps_newest_chunks) {
+  SnoopLoggerRingFile ring(ring_path_.string(), 4 * kChunkSize, kChunkSize);
+  ASSERT_TRUE(ring.Open());
+  // Fill 5 chunks worth of records plus one, the ring holds 4 chunks
+  const uint8_t count = 5 * kRecordsPerChunk + 1;
+  for (uint8_t i = 1; i <= count; i++) {
+    WriteRecord(ring, i);
+  }
+  ASSERT_TRUE(ring.LinearizeTo(btsnoop_path_.string()));
+  // The two oldest chunks have been recycled
+  ExpectRecords(2 * kRecordsPerChunk + 1, count);
+}
+
+TEST_F(SnoopLoggerRingFileTest, linearize_file_left_on_disk) {
+  {
+    SnoopLoggerRingFile ring(ring_path_.string(), 2 * kChunkSize, kChunkSize);
+    ASSERT_TRUE(ring.Open());
+    for (uint8_t i = 1; i <= 4; i++) {
+      WriteRecord(ring, i);
+    }
+  }
+  ASSERT_TRUE(SnoopLoggerRingFile::Linearize(ring_path_.string(), btsnoop_path_.string()));
+  ExpectRecords(1, 4);
+}
+
+TEST_F(SnoopLoggerRingFileTest, oversized_record_is_dropped) {
+  SnoopLoggerRingFile ring(ring_path_.string(), 2 * kChunkSize, kChunkSize);
+  ASSERT_TRUE(ring.Open());
+  std::vector<uint8_t> payload(kChunkSize, 0xff);
+  ASSERT_FALSE(ring.Write(payload.data(), kRecordHeaderSize, payload.data(), payload.size()));
+  WriteRecord(ring, 1);
+  ASSERT_TRUE(ring.LinearizeTo(btsnoop_path_.string()));
+  ExpectRecords(1, 1);
+}
+
+TEST_F(SnoopLoggerRingFileTest, invalid_file_is_not_linearized) {
+  std::ofstream(ring_path_, std::ios::binary) << std::string(8192, 'x');
+  ASSERT_FALSE(SnoopLoggerRingFile::Linearize(ring_path_.string(), btsnoop_path_.string()));
+  ASSERT_FALSE(std::filesystem::exists(btsnoop_path_));
+}
+
+}  // namespace testing
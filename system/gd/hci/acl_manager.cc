@@ -25,6 +25,7 @@
 #include "dumpsys_data_generated.h"
 #include "hci/acl_manager/acl_scheduler.h"
 #include "hci/acl_manager/classic_impl.h"
+#include "hci/acl_manager/deficit_round_robin_scheduler.h"
 #include "hci/acl_manager/le_acceptlist_callbacks.h"
 #include "hci/acl_manager/le_acl_connection.h"
 #include "hci/acl_manager/le_impl.h"
@@ -33,6 +34,7 @@
 #include "hci/hci_layer.h"
 #include "hci/remote_name_request.h"
 #include "hci_acl_manager_generated.h"
+#include "os/system_properties.h"
 #include "security/security_module.h"
 #include "storage/config_keys.h"
 #include "storage/storage_module.h"
@@ -41,6 +43,8 @@ namespace bluetooth {
 namespace hci {
 
 constexpr uint16_t kQualcommDebugHandle = 0xedc;
+// Either "round_robin" (default) or "deficit_round_robin"
+constexpr char kPropertyAclScheduler[] = "bluetooth.acl.scheduler";
 
 using acl_manager::AclConnection;
 using common::Bind;
@@ -55,6 +59,9 @@ using acl_manager::LeAcceptlistCallbacks;
 using acl_manager::LeAclConnection;
 using acl_manager::LeConnectionCallbacks;
 
+using acl_manager::AclLinkQos;
+using acl_manager::DeficitRoundRobinScheduler;
+using acl_manager::PacketScheduler;
 using acl_manager::RoundRobinScheduler;
 
 using acl_manager::AclScheduler;
@@ -66,7 +73,12 @@ struct AclManager::impl {
     hci_layer_ = acl_manager_.GetDependency<HciLayer>();
     handler_ = acl_manager_.GetHandler();
     controller_ = acl_manager_.GetDependency<Controller>();
-    round_robin_scheduler_ = new RoundRobinScheduler(handler_, controller_, hci_layer_->GetAclQueueEnd());
+    if (os::GetSystemProperty(kPropertyAclScheduler).value_or("") == "deficit_round_robin") {
+      LOG_INFO("Using deficit round robin ACL scheduler");
+      round_robin_scheduler_ = new DeficitRoundRobinScheduler(handler_, controller_, hci_layer_->GetAclQueueEnd());
+    } else {
+      round_robin_scheduler_ = new RoundRobinScheduler(handler_, controller_, hci_layer_->GetAclQueueEnd());
+    }
     acl_scheduler_ = acl_manager_.GetDependency<AclScheduler>();
 
     remote_name_request_module_ = acl_manager_.GetDependency<RemoteNameRequestModule>();
@@ -190,7 +202,7 @@ struct AclManager::impl {
   os::Handler* handler_ = nullptr;
   Controller* controller_ = nullptr;
   HciLayer* hci_layer_ = nullptr;
-  RoundRobinScheduler* round_robin_scheduler_ = nullptr;
+  PacketScheduler* round_robin_scheduler_ = nullptr;
   common::BidiQueueEnd<AclBuilder, AclView>* hci_queue_end_ = nullptr;
   std::atomic_bool enqueue_registered_ = false;
   uint16_t default_link_policy_settings_ = 0xffff;
@@ -256,6 +268,11 @@ void AclManager::CreateConnection(Address address) {
   CallOn(pimpl_->classic_impl_, &classic_impl::create_connection, address);
 }
 
+void AclManager::SetClassicPageParameters(
+    Address address, PageScanRepetitionMode page_scan_repetition_mode, uint16_t clock_offset) {
+  CallOn(pimpl_->classic_impl_, &classic_impl::set_page_parameters, address, page_scan_repetition_mode, clock_offset);
+}
+
 void AclManager::CreateLeConnection(AddressWithType address_with_type, bool is_direct) {
   if (!is_direct) {
     CallOn(pimpl_->le_impl_, &le_impl::add_device_to_background_connection_list, address_with_type);
@@ -413,7 +430,11 @@ uint16_t AclManager::HACK_GetLeHandle(Address address) {
 }
 
 void AclManager::HACK_SetAclTxPriority(uint8_t handle, bool high_priority) {
-  CallOn(pimpl_->round_robin_scheduler_, &RoundRobinScheduler::SetLinkPriority, handle, high_priority);
+  CallOn(pimpl_->round_robin_scheduler_, &PacketScheduler::SetLinkPriority, handle, high_priority);
+}
+
+void AclManager::SetAclLinkQos(uint16_t handle, AclLinkQos qos) {
+  CallOn(pimpl_->round_robin_scheduler_, &PacketScheduler::SetLinkQos, handle, qos);
 }
 
 void AclManager::ListDependencies(ModuleList* list) const {
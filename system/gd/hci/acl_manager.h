@@ -20,6 +20,7 @@
 #include <future>
 #include <memory>
 
+#include "hci/acl_manager/acl_link_qos.h"
 #include "hci/acl_manager/connection_callbacks.h"
 #include "hci/acl_manager/le_acceptlist_callbacks.h"
 #include "hci/acl_manager/le_connection_callbacks.h"
@@ -85,6 +86,10 @@ class AclManager : public Module {
   // Generates OnConnectSuccess if connected, or OnConnectFail otherwise
   virtual void CreateConnection(Address address);
 
+  // Page scan repetition mode and clock offset (without the valid bit) to use the next time |address| is paged
+  virtual void SetClassicPageParameters(
+      Address address, PageScanRepetitionMode page_scan_repetition_mode, uint16_t clock_offset);
+
   // Generates OnLeConnectSuccess if connected, or OnLeConnectFail otherwise
   virtual void CreateLeConnection(AddressWithType address_with_type, bool is_direct);
 
@@ -174,6 +179,10 @@ class AclManager : public Module {
 
   virtual void HACK_SetAclTxPriority(uint8_t handle, bool high_priority);
 
+  // Weight and latency target of the link in the ACL packet scheduler, same as
+  // AclConnection::SetLinkQos()
+  virtual void SetAclLinkQos(uint16_t handle, acl_manager::AclLinkQos qos);
+
   struct impl;
   std::unique_ptr<impl> pimpl_;
 };
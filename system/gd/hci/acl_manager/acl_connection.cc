@@ -16,6 +16,8 @@
 
 #include "hci/acl_manager/acl_connection.h"
 
+#include "os/log.h"
+
 namespace bluetooth {
 namespace hci {
 namespace acl_manager {
@@ -24,6 +26,14 @@ AclConnection::QueueUpEnd* AclConnection::GetAclQueueEnd() const {
   return queue_up_end_;
 }
 
+void AclConnection::SetLinkQos(AclLinkQos qos) {
+  if (link_qos_callback_.IsEmpty()) {
+    LOG_WARN("Link qos of handle %d can not be configured", handle_);
+    return;
+  }
+  link_qos_callback_.Invoke(handle_, qos);
+}
+
 }  // namespace acl_manager
 }  // namespace hci
 }  // namespace bluetooth
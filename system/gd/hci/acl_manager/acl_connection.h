@@ -17,6 +17,8 @@
 #pragma once
 
 #include "common/bidi_queue.h"
+#include "common/contextual_callback.h"
+#include "hci/acl_manager/acl_link_qos.h"
 #include "hci/hci_packets.h"
 
 namespace bluetooth {
@@ -42,7 +44,12 @@ class AclConnection {
   using QueueDownEnd = common::BidiQueueEnd<PacketView<kLittleEndian>, BasePacketBuilder>;
   virtual QueueUpEnd* GetAclQueueEnd() const;
 
+  // Weight and latency target of this link in the ACL packet scheduler
+  virtual void SetLinkQos(AclLinkQos qos);
+
   bool locally_initiated_{false};
+  // Set by the owner of the connection, forwards SetLinkQos() to the packet scheduler
+  common::ContextualCallback<void(uint16_t, AclLinkQos)> link_qos_callback_{};
 
  protected:
   AclConnection(QueueUpEnd* queue_up_end, uint16_t handle) : queue_up_end_(queue_up_end), handle_(handle) {}
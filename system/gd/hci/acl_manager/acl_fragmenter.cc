@@ -16,20 +16,40 @@
 
 #include "hci/acl_manager/acl_fragmenter.h"
 
-#include "packet/fragmenting_inserter.h"
+#include <algorithm>
+#include <utility>
 
 namespace bluetooth {
 namespace hci {
 namespace acl_manager {
 
+AclFragment::AclFragment(std::shared_ptr<const std::vector<uint8_t>> packet, size_t begin, size_t end)
+    : packet_(std::move(packet)), begin_(begin), end_(end) {}
+
+size_t AclFragment::size() const {
+  return end_ - begin_;
+}
+
+void AclFragment::Serialize(packet::BitInserter& it) const {
+  for (size_t i = begin_; i < end_; i++) {
+    it.insert_byte((*packet_)[i]);
+  }
+}
+
 AclFragmenter::AclFragmenter(size_t mtu, std::unique_ptr<packet::BasePacketBuilder> packet)
     : mtu_(mtu), packet_(std::move(packet)) {}
 
-std::vector<std::unique_ptr<packet::RawBuilder>> AclFragmenter::GetFragments() {
-  std::vector<std::unique_ptr<packet::RawBuilder>> to_return;
-  packet::FragmentingInserter fragmenting_inserter(mtu_, std::back_insert_iterator(to_return));
-  packet_->Serialize(fragmenting_inserter);
-  fragmenting_inserter.finalize();
+std::vector<std::unique_ptr<packet::BasePacketBuilder>> AclFragmenter::GetFragments() {
+  // Serialize once, the fragments share the buffer instead of each copying its part
+  auto serialized = std::make_shared<std::vector<uint8_t>>();
+  packet_->SerializeInto(*serialized);
+
+  std::vector<std::unique_ptr<packet::BasePacketBuilder>> to_return;
+  to_return.reserve((serialized->size() + mtu_ - 1) / mtu_);
+  for (size_t begin = 0; begin < serialized->size(); begin += mtu_) {
+    size_t end = std::min(begin + mtu_, serialized->size());
+    to_return.push_back(std::make_unique<AclFragment>(serialized, begin, end));
+  }
   return to_return;
 }
 
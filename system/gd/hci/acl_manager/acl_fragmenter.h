@@ -16,22 +16,36 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "packet/base_packet_builder.h"
-#include "packet/raw_builder.h"
 
 namespace bluetooth {
 namespace hci {
 namespace acl_manager {
 
+// One fragment of a packet, referencing the buffer the whole packet was serialized into once
+class AclFragment : public packet::BasePacketBuilder {
+ public:
+  AclFragment(std::shared_ptr<const std::vector<uint8_t>> packet, size_t begin, size_t end);
+
+  size_t size() const override;
+  void Serialize(packet::BitInserter& it) const override;
+
+ private:
+  std::shared_ptr<const std::vector<uint8_t>> packet_;
+  size_t begin_;
+  size_t end_;
+};
+
 class AclFragmenter {
  public:
   AclFragmenter(size_t mtu, std::unique_ptr<packet::BasePacketBuilder> input);
   virtual ~AclFragmenter() = default;
 
-  std::vector<std::unique_ptr<packet::RawBuilder>> GetFragments();
+  std::vector<std::unique_ptr<packet::BasePacketBuilder>> GetFragments();
 
  private:
   size_t mtu_;
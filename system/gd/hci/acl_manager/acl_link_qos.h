@@ -0,0 +1,44 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace bluetooth {
+namespace hci {
+namespace acl_manager {
+
+// Scheduling parameters of an ACL link, see DeficitRoundRobinScheduler
+struct AclLinkQos {
+  static constexpr uint16_t kDefaultWeight = 1;
+
+  // Share of the controller buffers given to this link relative to the other links with data
+  // to send, must not be zero
+  uint16_t weight = kDefaultWeight;
+  // Packets that have been waiting longer than this are sent ahead of the other links, zero
+  // disables it
+  std::chrono::milliseconds latency_target{0};
+
+  bool operator==(const AclLinkQos& other) const {
+    return weight == other.weight && latency_target == other.latency_target;
+  }
+};
+
+}  // namespace acl_manager
+}  // namespace hci
+}  // namespace bluetooth
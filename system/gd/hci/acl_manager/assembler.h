@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <forward_list>
 #include <memory>
 #include <vector>
 
@@ -41,8 +42,8 @@ class PacketViewForRecombination : public packet::PacketView<packet::kLittleEndi
   PacketViewForRecombination(const PacketView& packetView)
       : PacketView(packetView), received_first_(true) {}
 
-  PacketViewForRecombination()
-      : PacketView(PacketView<packet::kLittleEndian>(std::make_shared<std::vector<uint8_t>>())) {}
+  // Empty stage without any fragment, so that resetting it after every packet does not allocate
+  PacketViewForRecombination() : PacketView(std::forward_list<packet::View>()) {}
 
   void AppendPacketView(packet::PacketView<packet::kLittleEndian> to_append) {
     Append(to_append);
@@ -59,7 +60,7 @@ class PacketViewForRecombination : public packet::PacketView<packet::kLittleEndi
 // Per spec 5.1 Vol 2 Part B 5.3, ACL link shall carry L2CAP data. Therefore, an ACL packet shall
 // contain L2CAP PDU. This function returns the PDU size of the L2CAP starting packet, or
 // kL2capBasicFrameHeaderSize if it's invalid.
-size_t GetL2capPduSize(packet::PacketView<packet::kLittleEndian> pdu) {
+size_t GetL2capPduSize(const packet::PacketView<packet::kLittleEndian>& pdu) {
   if (pdu.size() < 2) {
     return kL2capBasicFrameHeaderSize;  // We need at least 4 bytes to send it to L2CAP
   }
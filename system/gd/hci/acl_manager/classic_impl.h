@@ -17,12 +17,13 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 
 #include "common/bind.h"
 #include "common/init_flags.h"
 #include "hci/acl_manager/acl_scheduler.h"
 #include "hci/acl_manager/assembler.h"
-#include "hci/acl_manager/round_robin_scheduler.h"
+#include "hci/acl_manager/packet_scheduler.h"
 #include "hci/class_of_device.h"
 #include "hci/controller.h"
 #include "hci/event_checkers.h"
@@ -52,7 +53,7 @@ struct classic_impl : public security::ISecurityManagerListener {
       HciLayer* hci_layer,
       Controller* controller,
       os::Handler* handler,
-      RoundRobinScheduler* round_robin_scheduler,
+      PacketScheduler* round_robin_scheduler,
       bool crash_on_unknown_handle,
       AclScheduler* acl_scheduler,
       RemoteNameRequestModule* remote_name_request_module)
@@ -268,12 +269,26 @@ struct classic_impl : public security::ISecurityManagerListener {
     return connections.is_classic_link_already_connected(address);
   }
 
+  void set_page_parameters(Address address, PageScanRepetitionMode page_scan_repetition_mode, uint16_t clock_offset) {
+    if (page_parameters_.size() >= kMaxPageParameters && page_parameters_.count(address) == 0) {
+      page_parameters_.erase(page_parameters_.begin());
+    }
+    page_parameters_[address] = {page_scan_repetition_mode, clock_offset};
+  }
+
   void create_connection(Address address) {
     // TODO: Configure default connection parameters?
     uint16_t packet_type = 0x4408 /* DM 1,3,5 */ | 0x8810 /*DH 1,3,5 */;
     PageScanRepetitionMode page_scan_repetition_mode = PageScanRepetitionMode::R1;
     uint16_t clock_offset = 0;
     ClockOffsetValid clock_offset_valid = ClockOffsetValid::INVALID;
+    // Paging with the last known clock offset lets the controller start on the right train
+    auto page_parameters = page_parameters_.find(address);
+    if (page_parameters != page_parameters_.end()) {
+      page_scan_repetition_mode = page_parameters->second.page_scan_repetition_mode;
+      clock_offset = page_parameters->second.clock_offset;
+      clock_offset_valid = ClockOffsetValid::VALID;
+    }
     CreateConnectionRoleSwitch allow_role_switch = CreateConnectionRoleSwitch::ALLOW_ROLE_SWITCH;
     ASSERT(client_callbacks_ != nullptr);
     std::unique_ptr<CreateConnectionBuilder> packet = CreateConnectionBuilder::Create(
@@ -338,10 +353,11 @@ struct classic_impl : public security::ISecurityManagerListener {
     uint16_t handle = connection_complete.GetConnectionHandle();
     auto queue = std::make_shared<AclConnection::Queue>(10);
     auto queue_down_end = queue->GetDownEnd();
-    round_robin_scheduler_->Register(RoundRobinScheduler::ConnectionType::CLASSIC, handle, queue);
+    round_robin_scheduler_->Register(PacketScheduler::ConnectionType::CLASSIC, handle, queue);
     std::unique_ptr<ClassicAclConnection> connection(
         new ClassicAclConnection(std::move(queue), acl_connection_interface_, handle, address));
     connection->locally_initiated_ = initiator == Initiator::LOCALLY_INITIATED;
+    connection->link_qos_callback_ = handler_->BindOn(round_robin_scheduler_, &PacketScheduler::SetLinkQos);
     connections.add(
         handle,
         AddressWithType{address, AddressType::PUBLIC_DEVICE_ADDRESS},
@@ -513,6 +529,15 @@ struct classic_impl : public security::ISecurityManagerListener {
       return;
     }
     uint16_t handle = complete_view.GetConnectionHandle();
+    Address address = connections.get_address(handle);
+    if (address != Address::kEmpty) {
+      auto page_parameters = page_parameters_.find(address);
+      set_page_parameters(
+          address,
+          page_parameters == page_parameters_.end() ? PageScanRepetitionMode::R1
+                                                    : page_parameters->second.page_scan_repetition_mode,
+          complete_view.GetClockOffset());
+    }
     connections.execute(handle, [=](ConnectionManagementCallbacks* callbacks) {
       uint16_t clock_offset = complete_view.GetClockOffset();
       callbacks->OnReadClockOffsetComplete(clock_offset);
@@ -759,7 +784,7 @@ struct classic_impl : public security::ISecurityManagerListener {
 
   HciLayer* hci_layer_ = nullptr;
   Controller* controller_ = nullptr;
-  RoundRobinScheduler* round_robin_scheduler_ = nullptr;
+  PacketScheduler* round_robin_scheduler_ = nullptr;
   AclScheduler* acl_scheduler_ = nullptr;
   RemoteNameRequestModule* remote_name_request_module_ = nullptr;
   AclConnectionInterface* acl_connection_interface_ = nullptr;
@@ -770,6 +795,14 @@ struct classic_impl : public security::ISecurityManagerListener {
   common::Callback<bool(Address, ClassOfDevice)> should_accept_connection_;
   std::unique_ptr<RoleChangeView> delayed_role_change_ = nullptr;
 
+  struct PageParameters {
+    PageScanRepetitionMode page_scan_repetition_mode;
+    uint16_t clock_offset;
+  };
+  static constexpr size_t kMaxPageParameters = 64;
+  // Last known page scan repetition mode and clock offset of remote devices, used when paging them again
+  std::unordered_map<Address, PageParameters> page_parameters_;
+
   std::unique_ptr<security::SecurityManager> security_manager_;
 };
 
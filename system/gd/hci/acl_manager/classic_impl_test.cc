@@ -26,6 +26,7 @@
 #include "hci/acl_manager/acl_scheduler.h"
 #include "hci/acl_manager/connection_callbacks_mock.h"
 #include "hci/acl_manager/connection_management_callbacks_mock.h"
+#include "hci/acl_manager/round_robin_scheduler.h"
 #include "hci/address.h"
 #include "hci/controller_mock.h"
 #include "hci/hci_layer_fake.h"
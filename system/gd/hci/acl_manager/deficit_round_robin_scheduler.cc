@@ -0,0 +1,309 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hci/acl_manager/deficit_round_robin_scheduler.h"
+
+#include <algorithm>
+
+#include "hci/acl_manager/acl_fragmenter.h"
+#include "os/log.h"
+
+namespace bluetooth {
+namespace hci {
+namespace acl_manager {
+
+namespace {
+
+// Handle, flags and length
+constexpr size_t kAclHeaderSize = 4;
+
+}  // namespace
+
+DeficitRoundRobinScheduler::DeficitRoundRobinScheduler(
+    os::Handler* handler, Controller* controller, common::BidiQueueEnd<AclBuilder, AclView>* hci_queue_end)
+    : handler_(handler), controller_(controller), hci_queue_end_(hci_queue_end) {
+  max_acl_packet_credits_ = controller_->GetNumAclPacketBuffers();
+  acl_packet_credits_ = max_acl_packet_credits_;
+  hci_mtu_ = controller_->GetAclPacketLength();
+  LeBufferSize le_buffer_size = controller_->GetLeBufferSize();
+  le_max_acl_packet_credits_ = le_buffer_size.total_num_le_packets_;
+  le_acl_packet_credits_ = le_max_acl_packet_credits_;
+  le_hci_mtu_ = le_buffer_size.le_data_packet_length_;
+  controller_->RegisterCompletedAclPacketsCallback(
+      handler->BindOn(this, &DeficitRoundRobinScheduler::incoming_acl_credits));
+}
+
+DeficitRoundRobinScheduler::~DeficitRoundRobinScheduler() {
+  for (auto& [handle, link] : links_) {
+    if (link.dequeue_is_registered_) {
+      link.dequeue_is_registered_ = false;
+      link.queue_->GetDownEnd()->UnregisterDequeue();
+    }
+  }
+  if (enqueue_registered_) {
+    enqueue_registered_ = false;
+    hci_queue_end_->UnregisterEnqueue();
+  }
+  controller_->UnregisterCompletedAclPacketsCallback();
+}
+
+void DeficitRoundRobinScheduler::Register(
+    ConnectionType connection_type, uint16_t handle, std::shared_ptr<acl_manager::AclConnection::Queue> queue) {
+  ASSERT(links_.count(handle) == 0);
+  Link link;
+  link.connection_type_ = connection_type;
+  link.queue_ = std::move(queue);
+  auto [it, inserted] = links_.emplace(handle, std::move(link));
+  update_dequeue_registration(handle, it->second);
+}
+
+void DeficitRoundRobinScheduler::Unregister(uint16_t handle) {
+  auto it = links_.find(handle);
+  ASSERT(it != links_.end());
+  Link& link = it->second;
+  // Reclaim outstanding packets
+  if (link.connection_type_ == ConnectionType::CLASSIC) {
+    acl_packet_credits_ += link.number_of_sent_packets_;
+  } else {
+    le_acl_packet_credits_ += link.number_of_sent_packets_;
+  }
+  if (link.dequeue_is_registered_) {
+    link.dequeue_is_registered_ = false;
+    link.queue_->GetDownEnd()->UnregisterDequeue();
+  }
+  links_.erase(it);
+  active_links_.remove(handle);
+  update_enqueue_registration();
+}
+
+void DeficitRoundRobinScheduler::SetLinkPriority(uint16_t handle, bool high_priority) {
+  auto it = links_.find(handle);
+  if (it == links_.end()) {
+    LOG_WARN("handle %d is invalid", handle);
+    return;
+  }
+  it->second.high_priority_ = high_priority;
+}
+
+void DeficitRoundRobinScheduler::SetLinkQos(uint16_t handle, AclLinkQos qos) {
+  auto it = links_.find(handle);
+  if (it == links_.end()) {
+    LOG_WARN("handle %d is invalid", handle);
+    return;
+  }
+  if (qos.weight == 0) {
+    LOG_WARN("Invalid weight 0 for handle %d, using %d", handle, AclLinkQos::kDefaultWeight);
+    qos.weight = AclLinkQos::kDefaultWeight;
+  }
+  LOG_INFO(
+      "handle %d weight %d latency target %d ms",
+      handle,
+      qos.weight,
+      static_cast<int>(qos.latency_target.count()));
+  it->second.qos_ = qos;
+}
+
+uint16_t DeficitRoundRobinScheduler::GetCredits() {
+  return acl_packet_credits_;
+}
+
+uint16_t DeficitRoundRobinScheduler::GetLeCredits() {
+  return le_acl_packet_credits_;
+}
+
+bool DeficitRoundRobinScheduler::has_credits(ConnectionType connection_type) const {
+  return connection_type == ConnectionType::CLASSIC ? acl_packet_credits_ > 0 : le_acl_packet_credits_ > 0;
+}
+
+size_t DeficitRoundRobinScheduler::quantum(const Link& link) const {
+  size_t mtu = link.connection_type_ == ConnectionType::CLASSIC ? hci_mtu_ : le_hci_mtu_;
+  return link.qos_.weight * (mtu + kAclHeaderSize);
+}
+
+void DeficitRoundRobinScheduler::update_dequeue_registration(uint16_t handle, Link& link) {
+  bool can_buffer = link.fragments_.size() < kMaxBufferedFragments;
+  if (can_buffer && !link.dequeue_is_registered_) {
+    link.dequeue_is_registered_ = true;
+    link.queue_->GetDownEnd()->RegisterDequeue(
+        handler_, common::Bind(&DeficitRoundRobinScheduler::buffer_packet, common::Unretained(this), handle));
+  } else if (!can_buffer && link.dequeue_is_registered_) {
+    link.dequeue_is_registered_ = false;
+    link.queue_->GetDownEnd()->UnregisterDequeue();
+  }
+}
+
+void DeficitRoundRobinScheduler::update_enqueue_registration() {
+  bool can_send = has_fragment_to_send();
+  if (can_send && !enqueue_registered_) {
+    enqueue_registered_ = true;
+    hci_queue_end_->RegisterEnqueue(
+        handler_,
+        common::Bind(&DeficitRoundRobinScheduler::handle_enqueue_next_fragment, common::Unretained(this)));
+  } else if (!can_send && enqueue_registered_) {
+    enqueue_registered_ = false;
+    hci_queue_end_->UnregisterEnqueue();
+  }
+}
+
+void DeficitRoundRobinScheduler::buffer_packet(uint16_t handle) {
+  auto it = links_.find(handle);
+  if (it == links_.end()) {
+    LOG_ERROR("Ignore since ACL connection vanished with handle: 0x%X", handle);
+    return;
+  }
+  Link& link = it->second;
+  auto packet = link.queue_->GetDownEnd()->TryDequeue();
+  ASSERT(packet != nullptr);
+
+  bool was_active = !link.fragments_.empty();
+  auto now = std::chrono::steady_clock::now();
+  size_t mtu = link.connection_type_ == ConnectionType::CLASSIC ? hci_mtu_ : le_hci_mtu_;
+  PacketBoundaryFlag packet_boundary_flag = packet->IsFlushable()
+                                                ? PacketBoundaryFlag::FIRST_AUTOMATICALLY_FLUSHABLE
+                                                : PacketBoundaryFlag::FIRST_NON_AUTOMATICALLY_FLUSHABLE;
+  if (packet->size() <= mtu) {
+    link.fragments_.push_back(
+        {AclBuilder::Create(handle, packet_boundary_flag, BroadcastFlag::POINT_TO_POINT, std::move(packet)), now});
+  } else {
+    auto fragments = AclFragmenter(mtu, std::move(packet)).GetFragments();
+    for (size_t i = 0; i < fragments.size(); i++) {
+      link.fragments_.push_back(
+          {AclBuilder::Create(handle, packet_boundary_flag, BroadcastFlag::POINT_TO_POINT, std::move(fragments[i])),
+           now});
+      packet_boundary_flag = PacketBoundaryFlag::CONTINUING_FRAGMENT;
+    }
+  }
+  if (!was_active) {
+    active_links_.push_back(handle);
+  }
+  update_dequeue_registration(handle, link);
+  update_enqueue_registration();
+}
+
+bool DeficitRoundRobinScheduler::has_fragment_to_send() const {
+  return std::any_of(active_links_.begin(), active_links_.end(), [this](uint16_t handle) {
+    return has_credits(links_.at(handle).connection_type_);
+  });
+}
+
+uint16_t DeficitRoundRobinScheduler::select_next_link() {
+  for (uint16_t handle : active_links_) {
+    const Link& link = links_.at(handle);
+    if (link.high_priority_ && has_credits(link.connection_type_)) {
+      return handle;
+    }
+  }
+
+  // Links past their latency target, earliest deadline first
+  auto now = std::chrono::steady_clock::now();
+  bool late_link_found = false;
+  uint16_t late_handle = 0;
+  std::chrono::steady_clock::time_point earliest_deadline;
+  for (uint16_t handle : active_links_) {
+    const Link& link = links_.at(handle);
+    if (link.qos_.latency_target.count() == 0 || !has_credits(link.connection_type_)) {
+      continue;
+    }
+    auto deadline = link.fragments_.front().buffered_time_ + link.qos_.latency_target;
+    if (deadline <= now && (!late_link_found || deadline < earliest_deadline)) {
+      late_link_found = true;
+      late_handle = handle;
+      earliest_deadline = deadline;
+    }
+  }
+  if (late_link_found) {
+    return late_handle;
+  }
+
+  // Terminates since has_fragment_to_send() holds and each turn grows the deficit of a link that
+  // can send by at least a full fragment
+  while (true) {
+    uint16_t handle = active_links_.front();
+    Link& link = links_.at(handle);
+    if (has_credits(link.connection_type_)) {
+      if (!link.has_turn_) {
+        link.has_turn_ = true;
+        link.deficit_ += static_cast<int64_t>(quantum(link));
+      }
+      if (link.deficit_ >= static_cast<int64_t>(link.fragments_.front().packet_->size())) {
+        return handle;
+      }
+    }
+    link.has_turn_ = false;
+    active_links_.splice(active_links_.end(), active_links_, active_links_.begin());
+  }
+}
+
+// Invoked from some external Queue Reactable context
+std::unique_ptr<AclBuilder> DeficitRoundRobinScheduler::handle_enqueue_next_fragment() {
+  ASSERT(has_fragment_to_send());
+  uint16_t handle = select_next_link();
+  Link& link = links_.at(handle);
+
+  auto packet = std::move(link.fragments_.front().packet_);
+  link.fragments_.pop_front();
+  link.deficit_ -= static_cast<int64_t>(packet->size());
+  link.number_of_sent_packets_++;
+  if (link.connection_type_ == ConnectionType::CLASSIC) {
+    acl_packet_credits_ -= 1;
+  } else {
+    le_acl_packet_credits_ -= 1;
+  }
+
+  if (link.fragments_.empty()) {
+    // An idle link does not keep its unused deficit, only the debt of early sends
+    active_links_.remove(handle);
+    link.deficit_ = std::min<int64_t>(link.deficit_, 0);
+    link.has_turn_ = false;
+  }
+  update_dequeue_registration(handle, link);
+  update_enqueue_registration();
+  return packet;
+}
+
+void DeficitRoundRobinScheduler::incoming_acl_credits(uint16_t handle, uint16_t credits) {
+  auto it = links_.find(handle);
+  if (it == links_.end()) {
+    return;
+  }
+  Link& link = it->second;
+
+  if (link.number_of_sent_packets_ >= credits) {
+    link.number_of_sent_packets_ -= credits;
+  } else {
+    LOG_WARN("receive more credits than we sent");
+    link.number_of_sent_packets_ = 0;
+  }
+
+  if (link.connection_type_ == ConnectionType::CLASSIC) {
+    acl_packet_credits_ += credits;
+    if (acl_packet_credits_ > max_acl_packet_credits_) {
+      acl_packet_credits_ = max_acl_packet_credits_;
+      LOG_WARN("acl packet credits overflow due to receive %hx credits", credits);
+    }
+  } else {
+    le_acl_packet_credits_ += credits;
+    if (le_acl_packet_credits_ > le_max_acl_packet_credits_) {
+      le_acl_packet_credits_ = le_max_acl_packet_credits_;
+      LOG_WARN("le acl packet credits overflow due to receive %hx credits", credits);
+    }
+  }
+  update_enqueue_registration();
+}
+
+}  // namespace acl_manager
+}  // namespace hci
+}  // namespace bluetooth
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <chrono>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+
+#include "common/bidi_queue.h"
+#include "hci/acl_manager/acl_connection.h"
+#include "hci/acl_manager/acl_link_qos.h"
+#include "hci/acl_manager/packet_scheduler.h"
+#include "hci/controller.h"
+#include "hci/hci_packets.h"
+#include "os/handler.h"
+
+namespace bluetooth {
+namespace hci {
+namespace acl_manager {
+
+// Deficit round robin over the links that have fragments ready to send.
+//
+// Every link buffers up to kMaxBufferedFragments fragments. Each time a link gets its turn its
+// deficit grows by weight * quantum bytes, and it sends fragments while its deficit covers them,
+// so over time the links with data share the controller buffers in proportion to their weight
+// regardless of their packet sizes. On top of that, high priority links are always served
+// first, and a link whose oldest fragment has waited longer than its latency target is served
+// ahead of its turn; the fragment is still charged to its deficit, which keeps the link within
+// its share in the long run.
+class DeficitRoundRobinScheduler : public PacketScheduler {
+ public:
+  static constexpr size_t kMaxBufferedFragments = 8;
+
+  DeficitRoundRobinScheduler(
+      os::Handler* handler, Controller* controller, common::BidiQueueEnd<AclBuilder, AclView>* hci_queue_end);
+  ~DeficitRoundRobinScheduler() override;
+
+  void Register(
+      ConnectionType connection_type,
+      uint16_t handle,
+      std::shared_ptr<acl_manager::AclConnection::Queue> queue) override;
+  void Unregister(uint16_t handle) override;
+  void SetLinkPriority(uint16_t handle, bool high_priority) override;
+  void SetLinkQos(uint16_t handle, AclLinkQos qos) override;
+  uint16_t GetCredits() override;
+  uint16_t GetLeCredits() override;
+
+ private:
+  struct Fragment {
+    std::unique_ptr<AclBuilder> packet_;
+    std::chrono::steady_clock::time_point buffered_time_;
+  };
+
+  struct Link {
+    ConnectionType connection_type_;
+    std::shared_ptr<acl_manager::AclConnection::Queue> queue_;
+    AclLinkQos qos_;
+    bool high_priority_ = false;
+    bool dequeue_is_registered_ = false;
+    uint16_t number_of_sent_packets_ = 0;  // Track credits
+    std::deque<Fragment> fragments_;
+    // Bytes this link may still send in the current round, negative after a latency target
+    // forced it ahead of its turn
+    int64_t deficit_ = 0;
+    bool has_turn_ = false;
+  };
+
+  bool has_credits(ConnectionType connection_type) const;
+  size_t quantum(const Link& link) const;
+  void update_dequeue_registration(uint16_t handle, Link& link);
+  void update_enqueue_registration();
+  void buffer_packet(uint16_t handle);
+  bool has_fragment_to_send() const;
+  uint16_t select_next_link();
+  std::unique_ptr<AclBuilder> handle_enqueue_next_fragment();
+  void incoming_acl_credits(uint16_t handle, uint16_t credits);
+
+  os::Handler* handler_ = nullptr;
+  Controller* controller_ = nullptr;
+  common::BidiQueueEnd<AclBuilder, AclView>* hci_queue_end_ = nullptr;
+  std::map<uint16_t, Link> links_;
+  // Links with buffered fragments, in round order; the link at the front has the turn
+  std::list<uint16_t> active_links_;
+  uint16_t max_acl_packet_credits_ = 0;
+  uint16_t acl_packet_credits_ = 0;
+  uint16_t le_max_acl_packet_credits_ = 0;
+  uint16_t le_acl_packet_credits_ = 0;
+  size_t hci_mtu_{0};
+  size_t le_hci_mtu_{0};
+  bool enqueue_registered_ = false;
+};
+
+}  // namespace acl_manager
+}  // namespace hci
+}  // namespace bluetooth
@@ -0,0 +1,365 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hci/acl_manager/deficit_round_robin_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <queue>
+#include <thread>
+
+#include "common/bidi_queue.h"
+#include "common/callback.h"
+#include "hci/controller.h"
+#include "hci/hci_packets.h"
+#include "os/handler.h"
+#include "os/log.h"
+#include "packet/raw_builder.h"
+
+using ::bluetooth::common::BidiQueue;
+using ::bluetooth::common::Callback;
+using ::bluetooth::os::Handler;
+using ::bluetooth::os::Thread;
+
+using namespace std::chrono_literals;
+
+namespace bluetooth {
+namespace hci {
+namespace acl_manager {
+namespace {
+
+class TestController : public Controller {
+ public:
+  uint16_t GetNumAclPacketBuffers() const {
+    return max_acl_packet_credits_;
+  }
+
+  uint16_t GetAclPacketLength() const {
+    return hci_mtu_;
+  }
+
+  LeBufferSize GetLeBufferSize() const {
+    LeBufferSize le_buffer_size;
+    le_buffer_size.le_data_packet_length_ = le_hci_mtu_;
+    le_buffer_size.total_num_le_packets_ = le_max_acl_packet_credits_;
+    return le_buffer_size;
+  }
+
+  void RegisterCompletedAclPacketsCallback(CompletedAclPacketsCallback cb) {
+    acl_credits_callback_ = cb;
+  }
+
+  void SendCompletedAclPacketsCallback(uint16_t handle, uint16_t credits) {
+    acl_credits_callback_.Invoke(handle, credits);
+  }
+
+  void UnregisterCompletedAclPacketsCallback() {
+    acl_credits_callback_ = {};
+  }
+
+  const uint16_t max_acl_packet_credits_ = 10;
+  const uint16_t hci_mtu_ = 1024;
+  const uint16_t le_max_acl_packet_credits_ = 15;
+  const uint16_t le_hci_mtu_ = 27;
+
+ private:
+  CompletedAclPacketsCallback acl_credits_callback_;
+};
+
+class DeficitRoundRobinSchedulerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    thread_ = new Thread("thread", Thread::Priority::NORMAL);
+    handler_ = new Handler(thread_);
+    controller_ = new TestController();
+    scheduler_ = new DeficitRoundRobinScheduler(handler_, controller_, hci_queue_.GetUpEnd());
+    hci_queue_.GetDownEnd()->RegisterDequeue(
+        handler_, common::Bind(&DeficitRoundRobinSchedulerTest::HciDownEndDequeue, common::Unretained(this)));
+  }
+
+  void TearDown() override {
+    hci_queue_.GetDownEnd()->UnregisterDequeue();
+    delete scheduler_;
+    delete controller_;
+    handler_->Clear();
+    delete handler_;
+    delete thread_;
+  }
+
+  void sync_handler() {
+    ASSERT(thread_ != nullptr);
+    ASSERT(thread_->GetReactor()->WaitForIdle(2s));
+  }
+
+  void EnqueueAclUpEnd(AclConnection::QueueUpEnd* queue_up_end, std::vector<uint8_t> packet) {
+    if (enqueue_promise_ != nullptr) {
+      enqueue_future_->wait();
+    }
+    enqueue_promise_ = std::make_unique<std::promise<void>>();
+    enqueue_future_ = std::make_unique<std::future<void>>(enqueue_promise_->get_future());
+    queue_up_end->RegisterEnqueue(handler_, common::Bind(&DeficitRoundRobinSchedulerTest::enqueue_callback,
+                                                         common::Unretained(this), queue_up_end, packet));
+  }
+
+  std::unique_ptr<packet::BasePacketBuilder> enqueue_callback(AclConnection::QueueUpEnd* queue_up_end,
+                                                              std::vector<uint8_t> packet) {
+    auto packet_one = std::make_unique<packet::RawBuilder>(2000);
+    packet_one->AddOctets(packet);
+    queue_up_end->UnregisterEnqueue();
+    enqueue_promise_->set_value();
+    return packet_one;
+  };
+
+  void HciDownEndDequeue() {
+    auto packet = hci_queue_.GetDownEnd()->TryDequeue();
+    // Convert from a Builder to a View
+    auto bytes = std::make_shared<std::vector<uint8_t>>();
+    bluetooth::packet::BitInserter i(*bytes);
+    bytes->reserve(packet->size());
+    packet->Serialize(i);
+    auto packet_view = bluetooth::packet::PacketView<bluetooth::packet::kLittleEndian>(bytes);
+    AclView acl_packet_view = AclView::Create(packet_view);
+    ASSERT_TRUE(acl_packet_view.IsValid());
+    PacketView<true> count_view = acl_packet_view.GetPayload();
+    sent_acl_packets_.push(acl_packet_view);
+
+    packet_count_--;
+    if (packet_count_ == 0) {
+      std::promise<void>* prom = packet_promise_.release();
+      prom->set_value();
+      delete prom;
+    }
+  }
+
+  void VerifyPacket(uint16_t handle, std::vector<uint8_t> packet) {
+    auto acl_packet_view = sent_acl_packets_.front();
+    ASSERT_EQ(handle, acl_packet_view.GetHandle());
+    auto payload = acl_packet_view.GetPayload();
+    for (size_t i = 0; i < payload.size(); i++) {
+      ASSERT_EQ(payload[i], packet[i]);
+    }
+    sent_acl_packets_.pop();
+  }
+
+  void SetPacketFuture(uint16_t count) {
+    ASSERT_EQ(packet_promise_, nullptr) << "Promises, Promises, ... Only one at a time.";
+    packet_count_ = count;
+    packet_promise_ = std::make_unique<std::promise<void>>();
+    packet_future_ = std::make_unique<std::future<void>>(packet_promise_->get_future());
+  }
+
+  // Waits until every packet enqueued so far has been buffered by the scheduler
+  void WaitForBufferedPackets() {
+    enqueue_future_->wait();
+    sync_handler();
+  }
+
+  // Uses all the classic credits on another link, the packets enqueued next stay buffered until
+  // the credits are returned
+  void ExhaustCredits() {
+    scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, kCreditsHandle, credits_queue_);
+    ASSERT_NO_FATAL_FAILURE(SetPacketFuture(controller_->max_acl_packet_credits_));
+    for (uint16_t i = 0; i < controller_->max_acl_packet_credits_; i++) {
+      EnqueueAclUpEnd(credits_queue_->GetUpEnd(), {0x00});
+    }
+    packet_future_->wait();
+    for (uint16_t i = 0; i < controller_->max_acl_packet_credits_; i++) {
+      sent_acl_packets_.pop();
+    }
+    ASSERT_EQ(scheduler_->GetCredits(), 0);
+  }
+
+  void ReturnCredits(uint16_t credits) {
+    ASSERT_NO_FATAL_FAILURE(SetPacketFuture(credits));
+    controller_->SendCompletedAclPacketsCallback(kCreditsHandle, credits);
+    packet_future_->wait();
+  }
+
+  // A packet filling exactly one classic fragment
+  std::vector<uint8_t> MtuPacket(uint8_t value) {
+    return std::vector<uint8_t>(controller_->hci_mtu_, value);
+  }
+
+  static constexpr uint16_t kCreditsHandle = 0x0f;
+  std::shared_ptr<AclConnection::Queue> credits_queue_ = std::make_shared<AclConnection::Queue>(20);
+  BidiQueue<AclView, AclBuilder> hci_queue_{3};
+  Thread* thread_;
+  Handler* handler_;
+  TestController* controller_;
+  DeficitRoundRobinScheduler* scheduler_;
+  std::queue<AclView> sent_acl_packets_;
+  uint16_t packet_count_;
+  std::unique_ptr<std::promise<void>> packet_promise_;
+  std::unique_ptr<std::future<void>> packet_future_;
+  std::unique_ptr<std::promise<void>> enqueue_promise_;
+  std::unique_ptr<std::future<void>> enqueue_future_;
+};
+
+TEST_F(DeficitRoundRobinSchedulerTest, startup_teardown) {}
+
+TEST_F(DeficitRoundRobinSchedulerTest, buffer_packet_from_two_connections) {
+  uint16_t handle = 0x01;
+  uint16_t le_handle = 0x02;
+  auto connection_queue = std::make_shared<AclConnection::Queue>(10);
+  auto le_connection_queue = std::make_shared<AclConnection::Queue>(10);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, handle, connection_queue);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::LE, le_handle, le_connection_queue);
+
+  ASSERT_NO_FATAL_FAILURE(SetPacketFuture(2));
+  std::vector<uint8_t> packet = {0x01, 0x02, 0x03};
+  std::vector<uint8_t> le_packet = {0x04, 0x05, 0x06};
+  EnqueueAclUpEnd(le_connection_queue->GetUpEnd(), le_packet);
+  EnqueueAclUpEnd(connection_queue->GetUpEnd(), packet);
+
+  packet_future_->wait();
+  VerifyPacket(le_handle, le_packet);
+  VerifyPacket(handle, packet);
+  ASSERT_EQ(scheduler_->GetCredits(), controller_->max_acl_packet_credits_ - 1);
+  ASSERT_EQ(scheduler_->GetLeCredits(), controller_->le_max_acl_packet_credits_ - 1);
+
+  scheduler_->Unregister(handle);
+  scheduler_->Unregister(le_handle);
+}
+
+TEST_F(DeficitRoundRobinSchedulerTest, fragments_are_sent_in_order) {
+  uint16_t le_handle = 0x02;
+  auto le_connection_queue = std::make_shared<AclConnection::Queue>(10);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::LE, le_handle, le_connection_queue);
+
+  ASSERT_NO_FATAL_FAILURE(SetPacketFuture(3));
+  std::vector<uint8_t> le_packet;
+  std::vector<uint8_t> le_packet_part1;
+  std::vector<uint8_t> le_packet_part2;
+  std::vector<uint8_t> le_packet_part3;
+  for (uint8_t i = 0; i < controller_->le_hci_mtu_; i++) {
+    le_packet_part1.push_back(i);
+    le_packet_part2.push_back(i * 2);
+    le_packet_part3.push_back(i * 3);
+  }
+  le_packet.insert(le_packet.end(), le_packet_part1.begin(), le_packet_part1.end());
+  le_packet.insert(le_packet.end(), le_packet_part2.begin(), le_packet_part2.end());
+  le_packet.insert(le_packet.end(), le_packet_part3.begin(), le_packet_part3.end());
+  EnqueueAclUpEnd(le_connection_queue->GetUpEnd(), le_packet);
+
+  packet_future_->wait();
+  VerifyPacket(le_handle, le_packet_part1);
+  VerifyPacket(le_handle, le_packet_part2);
+  VerifyPacket(le_handle, le_packet_part3);
+  ASSERT_EQ(scheduler_->GetLeCredits(), controller_->le_max_acl_packet_credits_ - 3);
+
+  scheduler_->Unregister(le_handle);
+}
+
+TEST_F(DeficitRoundRobinSchedulerTest, credits_are_shared_by_weight) {
+  uint16_t handle1 = 0x01;
+  uint16_t handle2 = 0x02;
+  auto connection_queue1 = std::make_shared<AclConnection::Queue>(10);
+  auto connection_queue2 = std::make_shared<AclConnection::Queue>(10);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, handle1, connection_queue1);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, handle2, connection_queue2);
+  AclLinkQos qos;
+  qos.weight = 2;
+  scheduler_->SetLinkQos(handle2, qos);
+  ASSERT_NO_FATAL_FAILURE(ExhaustCredits());
+
+  for (uint8_t i = 0; i < 4; i++) {
+    EnqueueAclUpEnd(connection_queue1->GetUpEnd(), MtuPacket(0x10 + i));
+  }
+  for (uint8_t i = 0; i < 4; i++) {
+    EnqueueAclUpEnd(connection_queue2->GetUpEnd(), MtuPacket(0x20 + i));
+  }
+  WaitForBufferedPackets();
+  ASSERT_NO_FATAL_FAILURE(ReturnCredits(8));
+
+  // One fragment per turn for the first link, two for the second one
+  VerifyPacket(handle1, MtuPacket(0x10));
+  VerifyPacket(handle2, MtuPacket(0x20));
+  VerifyPacket(handle2, MtuPacket(0x21));
+  VerifyPacket(handle1, MtuPacket(0x11));
+  VerifyPacket(handle2, MtuPacket(0x22));
+  VerifyPacket(handle2, MtuPacket(0x23));
+  VerifyPacket(handle1, MtuPacket(0x12));
+  VerifyPacket(handle1, MtuPacket(0x13));
+
+  scheduler_->Unregister(handle1);
+  scheduler_->Unregister(handle2);
+}
+
+TEST_F(DeficitRoundRobinSchedulerTest, high_priority_link_is_served_first) {
+  uint16_t handle1 = 0x01;
+  uint16_t handle2 = 0x02;
+  auto connection_queue1 = std::make_shared<AclConnection::Queue>(10);
+  auto connection_queue2 = std::make_shared<AclConnection::Queue>(10);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, handle1, connection_queue1);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, handle2, connection_queue2);
+  scheduler_->SetLinkPriority(handle2, true);
+  ASSERT_NO_FATAL_FAILURE(ExhaustCredits());
+
+  EnqueueAclUpEnd(connection_queue1->GetUpEnd(), MtuPacket(0x10));
+  EnqueueAclUpEnd(connection_queue1->GetUpEnd(), MtuPacket(0x11));
+  EnqueueAclUpEnd(connection_queue2->GetUpEnd(), MtuPacket(0x20));
+  EnqueueAclUpEnd(connection_queue2->GetUpEnd(), MtuPacket(0x21));
+  WaitForBufferedPackets();
+  ASSERT_NO_FATAL_FAILURE(ReturnCredits(4));
+
+  VerifyPacket(handle2, MtuPacket(0x20));
+  VerifyPacket(handle2, MtuPacket(0x21));
+  VerifyPacket(handle1, MtuPacket(0x10));
+  VerifyPacket(handle1, MtuPacket(0x11));
+
+  scheduler_->Unregister(handle1);
+  scheduler_->Unregister(handle2);
+}
+
+TEST_F(DeficitRoundRobinSchedulerTest, late_link_is_served_ahead_of_its_turn) {
+  uint16_t handle1 = 0x01;
+  uint16_t handle2 = 0x02;
+  auto connection_queue1 = std::make_shared<AclConnection::Queue>(10);
+  auto connection_queue2 = std::make_shared<AclConnection::Queue>(10);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, handle1, connection_queue1);
+  scheduler_->Register(DeficitRoundRobinScheduler::ConnectionType::CLASSIC, handle2, connection_queue2);
+  AclLinkQos qos;
+  qos.latency_target = std::chrono::milliseconds(1);
+  scheduler_->SetLinkQos(handle2, qos);
+  ASSERT_NO_FATAL_FAILURE(ExhaustCredits());
+
+  EnqueueAclUpEnd(connection_queue1->GetUpEnd(), MtuPacket(0x10));
+  EnqueueAclUpEnd(connection_queue1->GetUpEnd(), MtuPacket(0x11));
+  EnqueueAclUpEnd(connection_queue2->GetUpEnd(), MtuPacket(0x20));
+  WaitForBufferedPackets();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  ASSERT_NO_FATAL_FAILURE(ReturnCredits(3));
+
+  VerifyPacket(handle2, MtuPacket(0x20));
+  VerifyPacket(handle1, MtuPacket(0x10));
+  VerifyPacket(handle1, MtuPacket(0x11));
+
+  scheduler_->Unregister(handle1);
+  scheduler_->Unregister(handle2);
+}
+
+TEST_F(DeficitRoundRobinSchedulerTest, unregister_reclaims_credits) {
+  ASSERT_NO_FATAL_FAILURE(ExhaustCredits());
+  scheduler_->Unregister(kCreditsHandle);
+  ASSERT_EQ(scheduler_->GetCredits(), controller_->max_acl_packet_credits_);
+}
+
+}  // namespace
+}  // namespace acl_manager
+}  // namespace hci
+}  // namespace bluetooth
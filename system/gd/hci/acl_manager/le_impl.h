@@ -31,7 +31,7 @@
 #include "hci/acl_manager/le_acl_connection.h"
 #include "hci/acl_manager/le_connection_callbacks.h"
 #include "hci/acl_manager/le_connection_management_callbacks.h"
-#include "hci/acl_manager/round_robin_scheduler.h"
+#include "hci/acl_manager/packet_scheduler.h"
 #include "hci/controller.h"
 #include "hci/hci_layer.h"
 #include "hci/hci_packets.h"
@@ -122,7 +122,7 @@ struct le_impl : public bluetooth::hci::LeAddressManagerCallback {
       HciLayer* hci_layer,
       Controller* controller,
       os::Handler* handler,
-      RoundRobinScheduler* round_robin_scheduler,
+      PacketScheduler* round_robin_scheduler,
       bool crash_on_unknown_handle)
       : hci_layer_(hci_layer), controller_(controller), round_robin_scheduler_(round_robin_scheduler) {
     hci_layer_ = hci_layer;
@@ -451,7 +451,7 @@ struct le_impl : public bluetooth::hci::LeAddressManagerCallback {
     auto role_specific_data = initialize_role_specific_data(role);
     auto queue = std::make_shared<AclConnection::Queue>(10);
     auto queue_down_end = queue->GetDownEnd();
-    round_robin_scheduler_->Register(RoundRobinScheduler::ConnectionType::LE, handle, queue);
+    round_robin_scheduler_->Register(PacketScheduler::ConnectionType::LE, handle, queue);
     std::unique_ptr<LeAclConnection> connection(new LeAclConnection(
         std::move(queue),
         le_acl_connection_interface_,
@@ -464,6 +464,7 @@ struct le_impl : public bluetooth::hci::LeAddressManagerCallback {
     connection->supervision_timeout_ = supervision_timeout;
     connection->in_filter_accept_list_ = in_filter_accept_list;
     connection->locally_initiated_ = (role == hci::Role::CENTRAL);
+    connection->link_qos_callback_ = handler_->BindOn(round_robin_scheduler_, &PacketScheduler::SetLinkQos);
 
     if (packet.GetSubeventCode() == SubeventCode::ENHANCED_CONNECTION_COMPLETE) {
       LeEnhancedConnectionCompleteView connection_complete =
@@ -1205,7 +1206,7 @@ struct le_impl : public bluetooth::hci::LeAddressManagerCallback {
   HciLayer* hci_layer_ = nullptr;
   Controller* controller_ = nullptr;
   os::Handler* handler_ = nullptr;
-  RoundRobinScheduler* round_robin_scheduler_ = nullptr;
+  PacketScheduler* round_robin_scheduler_ = nullptr;
   LeAddressManager* le_address_manager_ = nullptr;
   LeAclConnectionInterface* le_acl_connection_interface_ = nullptr;
   LeConnectionCallbacks* le_client_callbacks_ = nullptr;
@@ -25,6 +25,7 @@
 #include "common/testing/log_capture.h"
 #include "hci/acl_manager/le_connection_callbacks.h"
 #include "hci/acl_manager/le_connection_management_callbacks.h"
+#include "hci/acl_manager/round_robin_scheduler.h"
 #include "hci/address_with_type.h"
 #include "hci/controller.h"
 #include "hci/hci_layer_fake.h"
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "hci/acl_manager/acl_connection.h"
+#include "hci/acl_manager/acl_link_qos.h"
+
+namespace bluetooth {
+namespace hci {
+namespace acl_manager {
+
+// Moves the outgoing packets of the ACL connections to the HCI layer, sharing the controller
+// buffers between the links. All methods must be called on the scheduler handler.
+class PacketScheduler {
+ public:
+  virtual ~PacketScheduler() = default;
+
+  enum ConnectionType { CLASSIC, LE };
+
+  virtual void Register(
+      ConnectionType connection_type, uint16_t handle, std::shared_ptr<acl_manager::AclConnection::Queue> queue) = 0;
+  virtual void Unregister(uint16_t handle) = 0;
+  // High priority links (A2DP) are served before any other link
+  virtual void SetLinkPriority(uint16_t handle, bool high_priority) = 0;
+  virtual void SetLinkQos(uint16_t handle, AclLinkQos qos) = 0;
+  virtual uint16_t GetCredits() = 0;
+  virtual uint16_t GetLeCredits() = 0;
+};
+
+}  // namespace acl_manager
+}  // namespace hci
+}  // namespace bluetooth
@@ -0,0 +1,408 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "common/bidi_queue.h"
+#include "common/bind.h"
+#include "hci/acl_manager/deficit_round_robin_scheduler.h"
+#include "hci/acl_manager/round_robin_scheduler.h"
+#include "hci/controller.h"
+#include "hci/hci_packets.h"
+#include "os/handler.h"
+#include "os/log.h"
+#include "os/repeating_alarm.h"
+#include "os/thread.h"
+#include "packet/raw_builder.h"
+
+using ::benchmark::State;
+
+namespace bluetooth {
+namespace hci {
+namespace acl_manager {
+
+namespace {
+
+constexpr uint16_t kNumAclPacketBuffers = 8;
+constexpr uint16_t kAclPacketLength = 1021;
+constexpr uint16_t kNumLePacketBuffers = 8;
+constexpr uint16_t kLePacketLength = 251;
+// Time the controller needs to transmit one fragment before it returns the credit. Classic and LE
+// share the radio, fragments are transmitted one after the other.
+constexpr std::chrono::microseconds kFragmentAirtime = std::chrono::microseconds(625);
+// Packets each periodic link delivers per benchmark iteration
+constexpr size_t kPacketsPerIteration = 20;
+
+enum SchedulerType { ROUND_ROBIN, DEFICIT_ROUND_ROBIN };
+
+struct LinkTraffic {
+  std::string name;
+  PacketScheduler::ConnectionType connection_type;
+  size_t packet_size;
+  // Zero for a link that always has data to send
+  std::chrono::milliseconds period;
+  bool high_priority;
+  AclLinkQos qos;
+};
+
+struct TrafficMix {
+  std::vector<LinkTraffic> links;
+};
+
+AclLinkQos MakeQos(uint16_t weight, std::chrono::milliseconds latency_target) {
+  AclLinkQos qos;
+  qos.weight = weight;
+  qos.latency_target = latency_target;
+  return qos;
+}
+
+const std::vector<TrafficMix>& TrafficMixes() {
+  using std::chrono::milliseconds;
+  static const std::vector<TrafficMix> mixes = {
+      // LE HID keyboard next to a GATT firmware update
+      {{
+          {"hid", PacketScheduler::ConnectionType::LE, 20, milliseconds(10), false, MakeQos(2, milliseconds(15))},
+          {"gatt", PacketScheduler::ConnectionType::LE, 244, milliseconds(0), false, MakeQos(1, milliseconds(0))},
+      }},
+      // A2DP stream, LE HID keyboard, GATT firmware update and PAN tether
+      {{
+          {"a2dp", PacketScheduler::ConnectionType::CLASSIC, 895, milliseconds(20), true, MakeQos(1, milliseconds(0))},
+          {"hid", PacketScheduler::ConnectionType::LE, 20, milliseconds(10), false, MakeQos(2, milliseconds(15))},
+          {"gatt", PacketScheduler::ConnectionType::LE, 244, milliseconds(0), false, MakeQos(1, milliseconds(0))},
+          {"pan", PacketScheduler::ConnectionType::CLASSIC, 1500, milliseconds(0), false, MakeQos(1, milliseconds(0))},
+      }},
+  };
+  return mixes;
+}
+
+std::vector<uint8_t> GetPacketBytes(std::unique_ptr<packet::BasePacketBuilder> packet) {
+  std::vector<uint8_t> bytes;
+  BitInserter i(bytes);
+  bytes.reserve(packet->size());
+  packet->Serialize(i);
+  return bytes;
+}
+
+class BenchmarkController : public Controller {
+ public:
+  uint16_t GetNumAclPacketBuffers() const override {
+    return kNumAclPacketBuffers;
+  }
+
+  uint16_t GetAclPacketLength() const override {
+    return kAclPacketLength;
+  }
+
+  LeBufferSize GetLeBufferSize() const override {
+    LeBufferSize le_buffer_size;
+    le_buffer_size.le_data_packet_length_ = kLePacketLength;
+    le_buffer_size.total_num_le_packets_ = kNumLePacketBuffers;
+    return le_buffer_size;
+  }
+
+  void RegisterCompletedAclPacketsCallback(CompletedAclPacketsCallback cb) override {
+    acl_credits_callback_ = cb;
+  }
+
+  void UnregisterCompletedAclPacketsCallback() override {
+    acl_credits_callback_ = {};
+  }
+
+  void SendCompletedAclPacketsCallback(uint16_t handle, uint16_t credits) {
+    acl_credits_callback_.Invoke(handle, credits);
+  }
+
+ private:
+  CompletedAclPacketsCallback acl_credits_callback_;
+};
+
+}  // namespace
+
+// Replays a traffic mix (second argument) through a scheduler (first argument) and reports the
+// latency of the periodic links and the throughput of the bulk links.
+class BM_PacketScheduler : public ::benchmark::Fixture {
+ protected:
+  struct Link {
+    LinkTraffic traffic;
+    uint16_t handle;
+    std::shared_ptr<AclConnection::Queue> queue;
+    std::unique_ptr<os::RepeatingAlarm> alarm;
+    bool enqueue_registered = false;
+    // Generation time of the periodic packets not handed to the HCI layer yet
+    std::deque<std::chrono::steady_clock::time_point> generated_times;
+    size_t pending_packets = 0;
+    size_t delivered_packets = 0;
+    size_t delivered_bytes = 0;
+    std::chrono::microseconds total_latency{0};
+    std::chrono::microseconds max_latency{0};
+  };
+
+  void SetUp(State& st) override {
+    ::benchmark::Fixture::SetUp(st);
+    thread_ = std::make_unique<os::Thread>("scheduler_thread", os::Thread::Priority::NORMAL);
+    handler_ = std::make_unique<os::Handler>(thread_.get());
+    controller_thread_ = std::make_unique<os::Thread>("controller_thread", os::Thread::Priority::NORMAL);
+    controller_handler_ = std::make_unique<os::Handler>(controller_thread_.get());
+    controller_ = std::make_unique<BenchmarkController>();
+    hci_queue_ = std::make_unique<common::BidiQueue<AclView, AclBuilder>>(3);
+    air_deadline_ = {};
+    iteration_target_ = 0;
+    sent_fragments_ = 0;
+    last_sent_fragments_ = 0;
+    drained_ = false;
+    if (st.range(0) == DEFICIT_ROUND_ROBIN) {
+      scheduler_ = std::make_unique<DeficitRoundRobinScheduler>(handler_.get(), controller_.get(), hci_queue_->GetUpEnd());
+    } else {
+      scheduler_ = std::make_unique<RoundRobinScheduler>(handler_.get(), controller_.get(), hci_queue_->GetUpEnd());
+    }
+    hci_queue_->GetDownEnd()->RegisterDequeue(
+        handler_.get(), common::Bind(&BM_PacketScheduler::on_fragment_sent, common::Unretained(this)));
+
+    uint16_t handle = 0x0001;
+    for (const auto& traffic : TrafficMixes()[st.range(1)].links) {
+      auto link = std::make_unique<Link>();
+      link->traffic = traffic;
+      link->handle = handle++;
+      link->queue = std::make_shared<AclConnection::Queue>(10);
+      links_.push_back(std::move(link));
+    }
+    RunOnHandler(&BM_PacketScheduler::start_traffic);
+  }
+
+  void TearDown(State& st) override {
+    RunOnHandler(&BM_PacketScheduler::stop_generating);
+    // Let the scheduler send what it has buffered, the queues must be left unregistered
+    do {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      RunOnHandler(&BM_PacketScheduler::check_drained);
+    } while (!drained_);
+    RunOnHandler(&BM_PacketScheduler::stop_traffic);
+    controller_handler_->Clear();
+    controller_handler_->WaitUntilStopped(std::chrono::milliseconds(1000));
+    scheduler_.reset();
+    handler_->Clear();
+    handler_->WaitUntilStopped(std::chrono::milliseconds(1000));
+    links_.clear();
+    hci_queue_.reset();
+    controller_.reset();
+    controller_handler_.reset();
+    controller_thread_.reset();
+    handler_.reset();
+    thread_.reset();
+    ::benchmark::Fixture::TearDown(st);
+  }
+
+  void RunOnHandler(void (BM_PacketScheduler::*method)(std::promise<void>)) {
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    handler_->Post(common::BindOnce(method, common::Unretained(this), std::move(promise)));
+    future.wait();
+  }
+
+  void start_traffic(std::promise<void> promise) {
+    for (auto& link : links_) {
+      scheduler_->Register(link->traffic.connection_type, link->handle, link->queue);
+      scheduler_->SetLinkPriority(link->handle, link->traffic.high_priority);
+      scheduler_->SetLinkQos(link->handle, link->traffic.qos);
+      if (link->traffic.period.count() == 0) {
+        register_enqueue(link.get());
+      } else {
+        link->alarm = std::make_unique<os::RepeatingAlarm>(handler_.get());
+        link->alarm->Schedule(
+            common::Bind(&BM_PacketScheduler::generate_packet, common::Unretained(this), link.get()),
+            link->traffic.period);
+      }
+    }
+    promise.set_value();
+  }
+
+  void stop_generating(std::promise<void> promise) {
+    for (auto& link : links_) {
+      if (link->alarm != nullptr) {
+        link->alarm->Cancel();
+        link->alarm.reset();
+      }
+      if (link->enqueue_registered) {
+        link->enqueue_registered = false;
+        link->queue->GetUpEnd()->UnregisterEnqueue();
+      }
+    }
+    promise.set_value();
+  }
+
+  // Drained once all the credits are back and nothing has been sent since the previous check
+  void check_drained(std::promise<void> promise) {
+    drained_ = scheduler_->GetCredits() == kNumAclPacketBuffers && scheduler_->GetLeCredits() == kNumLePacketBuffers &&
+               sent_fragments_ == last_sent_fragments_;
+    last_sent_fragments_ = sent_fragments_;
+    promise.set_value();
+  }
+
+  void stop_traffic(std::promise<void> promise) {
+    hci_queue_->GetDownEnd()->UnregisterDequeue();
+    for (auto& link : links_) {
+      scheduler_->Unregister(link->handle);
+    }
+    promise.set_value();
+  }
+
+  void register_enqueue(Link* link) {
+    link->enqueue_registered = true;
+    link->queue->GetUpEnd()->RegisterEnqueue(
+        handler_.get(), common::Bind(&BM_PacketScheduler::enqueue_packet, common::Unretained(this), link));
+  }
+
+  void generate_packet(Link* link) {
+    link->generated_times.push_back(std::chrono::steady_clock::now());
+    link->pending_packets++;
+    if (!link->enqueue_registered) {
+      register_enqueue(link);
+    }
+  }
+
+  std::unique_ptr<packet::BasePacketBuilder> enqueue_packet(Link* link) {
+    if (link->traffic.period.count() != 0 && --link->pending_packets == 0) {
+      link->enqueue_registered = false;
+      link->queue->GetUpEnd()->UnregisterEnqueue();
+    }
+    return std::make_unique<packet::RawBuilder>(std::vector<uint8_t>(link->traffic.packet_size));
+  }
+
+  void on_fragment_sent() {
+    auto bytes = GetPacketBytes(hci_queue_->GetDownEnd()->TryDequeue());
+    auto acl_view = AclView::Create(bluetooth::packet::PacketView<bluetooth::packet::kLittleEndian>(
+        std::make_shared<std::vector<uint8_t>>(bytes)));
+    ASSERT(acl_view.IsValid());
+    uint16_t handle = acl_view.GetHandle();
+    sent_fragments_++;
+
+    Link* link = links_[handle - 1].get();
+    link->delivered_bytes += acl_view.GetPayload().size();
+    if (link->traffic.period.count() != 0 &&
+        acl_view.GetPacketBoundaryFlag() != PacketBoundaryFlag::CONTINUING_FRAGMENT) {
+      auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - link->generated_times.front());
+      link->generated_times.pop_front();
+      link->delivered_packets++;
+      link->total_latency += latency;
+      link->max_latency = std::max(link->max_latency, latency);
+      check_iteration_done();
+    }
+
+    // Transmit the fragment, the credit comes back once it is on air
+    auto now = std::chrono::steady_clock::now();
+    air_deadline_ = std::max(air_deadline_, now) + kFragmentAirtime;
+    controller_handler_->Post(
+        common::BindOnce(&BM_PacketScheduler::complete_fragment, common::Unretained(this), handle, air_deadline_));
+  }
+
+  void complete_fragment(uint16_t handle, std::chrono::steady_clock::time_point deadline) {
+    std::this_thread::sleep_until(deadline);
+    controller_->SendCompletedAclPacketsCallback(handle, 1);
+  }
+
+  void check_iteration_done() {
+    if (iteration_promise_ == nullptr) {
+      return;
+    }
+    for (auto& link : links_) {
+      if (link->traffic.period.count() != 0 && link->delivered_packets < iteration_target_) {
+        return;
+      }
+    }
+    iteration_promise_->set_value();
+    iteration_promise_ = nullptr;
+  }
+
+  void start_iteration(std::promise<void>* promise) {
+    iteration_target_ += kPacketsPerIteration;
+    iteration_promise_ = promise;
+  }
+
+  void RunIteration() {
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    handler_->Post(common::BindOnce(&BM_PacketScheduler::start_iteration, common::Unretained(this), &promise));
+    future.wait();
+  }
+
+  void ReportCounters(State& state) {
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    // Read the statistics on the handler, where they are updated
+    handler_->Post(common::BindOnce(
+        [](BM_PacketScheduler* fixture, State* state, std::promise<void> promise) {
+          for (auto& link : fixture->links_) {
+            const auto& name = link->traffic.name;
+            if (link->traffic.period.count() != 0 && link->delivered_packets != 0) {
+              state->counters[name + "_avg_latency_us"] =
+                  static_cast<double>(link->total_latency.count()) / link->delivered_packets;
+              state->counters[name + "_max_latency_us"] = static_cast<double>(link->max_latency.count());
+            } else {
+              state->counters[name + "_bytes_per_second"] =
+                  ::benchmark::Counter(link->delivered_bytes, ::benchmark::Counter::kIsRate);
+            }
+          }
+          promise.set_value();
+        },
+        common::Unretained(this),
+        common::Unretained(&state),
+        std::move(promise)));
+    future.wait();
+  }
+
+  std::unique_ptr<os::Thread> thread_;
+  std::unique_ptr<os::Handler> handler_;
+  std::unique_ptr<os::Thread> controller_thread_;
+  std::unique_ptr<os::Handler> controller_handler_;
+  std::unique_ptr<BenchmarkController> controller_;
+  std::unique_ptr<common::BidiQueue<AclView, AclBuilder>> hci_queue_;
+  std::unique_ptr<PacketScheduler> scheduler_;
+  std::vector<std::unique_ptr<Link>> links_;
+  std::chrono::steady_clock::time_point air_deadline_;
+  size_t iteration_target_ = 0;
+  size_t sent_fragments_ = 0;
+  size_t last_sent_fragments_ = 0;
+  bool drained_ = false;
+  std::promise<void>* iteration_promise_ = nullptr;
+};
+
+BENCHMARK_DEFINE_F(BM_PacketScheduler, replay_traffic_mix)(State& state) {
+  for (auto _ : state) {
+    RunIteration();
+  }
+  ReportCounters(state);
+}
+
+BENCHMARK_REGISTER_F(BM_PacketScheduler, replay_traffic_mix)
+    ->Args({ROUND_ROBIN, 0})
+    ->Args({DEFICIT_ROUND_ROBIN, 0})
+    ->Args({ROUND_ROBIN, 1})
+    ->Args({DEFICIT_ROUND_ROBIN, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace acl_manager
+}  // namespace hci
+}  // namespace bluetooth
@@ -16,6 +16,7 @@
 
 #include "hci/acl_manager/round_robin_scheduler.h"
 #include "hci/acl_manager/acl_fragmenter.h"
+#include "os/trace.h"
 
 namespace bluetooth {
 namespace hci {
@@ -77,6 +78,10 @@ void RoundRobinScheduler::SetLinkPriority(uint16_t handle, bool high_priority) {
   acl_queue_handler->second.high_priority_ = high_priority;
 }
 
+void RoundRobinScheduler::SetLinkQos(uint16_t handle, AclLinkQos /* qos */) {
+  LOG_INFO("Ignoring link qos of handle %d, not supported by the round robin scheduler", handle);
+}
+
 uint16_t RoundRobinScheduler::GetCredits() {
   return acl_packet_credits_;
 }
@@ -193,17 +198,21 @@ void RoundRobinScheduler::send_next_fragment() {
 
 // Invoked from some external Queue Reactable context 1
 std::unique_ptr<AclBuilder> RoundRobinScheduler::handle_enqueue_next_fragment() {
+  BT_TRACE_SCOPED("ACL fragment TX");
   ConnectionType connection_type = fragments_to_send_.front().first;
   if (connection_type == ConnectionType::CLASSIC) {
     ASSERT(acl_packet_credits_ > 0);
     acl_packet_credits_ -= 1;
+    BT_TRACE_COUNTER("ACL credits", acl_packet_credits_);
   } else {
     ASSERT(le_acl_packet_credits_ > 0);
     le_acl_packet_credits_ -= 1;
+    BT_TRACE_COUNTER("LE ACL credits", le_acl_packet_credits_);
   }
 
   auto raw_pointer = fragments_to_send_.front().second.release();
   fragments_to_send_.pop();
+  BT_TRACE_COUNTER("ACL fragments queued", fragments_to_send_.size());
   if (fragments_to_send_.empty()) {
     if (enqueue_registered_.exchange(false)) {
       hci_queue_end_->UnregisterEnqueue();
@@ -21,6 +21,7 @@
 #include "common/bidi_queue.h"
 #include "common/multi_priority_queue.h"
 #include "hci/acl_manager/acl_connection.h"
+#include "hci/acl_manager/packet_scheduler.h"
 #include "hci/controller.h"
 #include "hci/hci_packets.h"
 #include "os/handler.h"
@@ -29,13 +30,11 @@ namespace bluetooth {
 namespace hci {
 namespace acl_manager {
 
-class RoundRobinScheduler {
+class RoundRobinScheduler : public PacketScheduler {
  public:
   RoundRobinScheduler(
       os::Handler* handler, Controller* controller, common::BidiQueueEnd<AclBuilder, AclView>* hci_queue_end);
-  ~RoundRobinScheduler();
-
-  enum ConnectionType { CLASSIC, LE };
+  ~RoundRobinScheduler() override;
 
   struct acl_queue_handler {
     ConnectionType connection_type_;
@@ -46,11 +45,13 @@ class RoundRobinScheduler {
   };
 
   void Register(ConnectionType connection_type, uint16_t handle,
-                std::shared_ptr<acl_manager::AclConnection::Queue> queue);
-  void Unregister(uint16_t handle);
-  void SetLinkPriority(uint16_t handle, bool high_priority);
-  uint16_t GetCredits();
-  uint16_t GetLeCredits();
+                std::shared_ptr<acl_manager::AclConnection::Queue> queue) override;
+  void Unregister(uint16_t handle) override;
+  void SetLinkPriority(uint16_t handle, bool high_priority) override;
+  // Only the link priority is taken into account by this scheduler
+  void SetLinkQos(uint16_t handle, AclLinkQos qos) override;
+  uint16_t GetCredits() override;
+  uint16_t GetLeCredits() override;
 
  private:
   void start_round_robin();
@@ -33,6 +33,7 @@
 #include "os/log.h"
 #include "os/metrics.h"
 #include "os/system_properties.h"
+#include "storage/storage_module.h"
 #include "sysprops/sysprops_module.h"
 
 namespace bluetooth {
@@ -50,13 +51,21 @@ constexpr bool kDefaultErroneousDataReportingEnabled = true;
 static const std::string kPropertyErroneousDataReportingEnabled =
     "bluetooth.hci.erroneous_data_reporting.enabled";
 
+constexpr bool kDefaultCapabilitySnapshotEnabled = false;
+static const std::string kPropertyCapabilitySnapshotEnabled =
+    "bluetooth.core.controller.capability_snapshot.enabled";
+static const char kCapabilitySnapshotProperty[] = "ControllerCapabilities";
+// Bump when the layout of the snapshot changes
+constexpr uint8_t kCapabilitySnapshotFormat = 1;
+
 using os::Handler;
 
 struct Controller::impl {
   impl(Controller& module) : module_(module) {}
 
-  void Start(hci::HciLayer* hci) {
+  void Start(hci::HciLayer* hci, storage::StorageModule* storage) {
     hci_ = hci;
+    storage_ = storage;
     Handler* handler = module_.GetHandler();
     hci_->RegisterEventHandler(
         EventCode::NUMBER_OF_COMPLETED_PACKETS, handler->BindOn(this, &Controller::impl::NumberOfCompletedPackets));
@@ -67,25 +76,48 @@ struct Controller::impl {
                          handler->BindOnceOn(this, &Controller::impl::read_local_name_complete_handler));
     hci_->EnqueueCommand(ReadLocalVersionInformationBuilder::Create(),
                          handler->BindOnceOn(this, &Controller::impl::read_local_version_information_complete_handler));
-    hci_->EnqueueCommand(ReadLocalSupportedCommandsBuilder::Create(),
-                         handler->BindOnceOn(this, &Controller::impl::read_local_supported_commands_complete_handler));
 
-    hci_->EnqueueCommand(
-        LeReadLocalSupportedFeaturesBuilder::Create(),
-        handler->BindOnceOn(this, &Controller::impl::le_read_local_supported_features_handler));
+    bool snapshot_enabled =
+        os::GetSystemPropertyBool(kPropertyCapabilitySnapshotEnabled, kDefaultCapabilitySnapshotEnabled);
+    bool snapshot_loaded = false;
+    if (snapshot_enabled) {
+      // The snapshot is only valid for the same controller and firmware, read what identifies them first
+      std::promise<void> promise;
+      auto future = promise.get_future();
+      hci_->EnqueueCommand(
+          ReadBdAddrBuilder::Create(),
+          handler->BindOnceOn(this, &Controller::impl::read_controller_mac_address_handler, std::move(promise)));
+      future.wait();
+      snapshot_loaded = load_capability_snapshot();
+    }
 
-    hci_->EnqueueCommand(
-        LeReadSupportedStatesBuilder::Create(),
-        handler->BindOnceOn(this, &Controller::impl::le_read_supported_states_handler));
+    if (!snapshot_loaded) {
+      hci_->EnqueueCommand(
+          ReadLocalSupportedCommandsBuilder::Create(),
+          handler->BindOnceOn(this, &Controller::impl::read_local_supported_commands_complete_handler));
+
+      hci_->EnqueueCommand(
+          LeReadLocalSupportedFeaturesBuilder::Create(),
+          handler->BindOnceOn(this, &Controller::impl::le_read_local_supported_features_handler));
+
+      hci_->EnqueueCommand(
+          LeReadSupportedStatesBuilder::Create(),
+          handler->BindOnceOn(this, &Controller::impl::le_read_supported_states_handler));
 
-    // Wait for all extended features read
-    std::promise<void> features_promise;
-    auto features_future = features_promise.get_future();
+      // Wait for all extended features read
+      std::promise<void> features_promise;
+      auto features_future = features_promise.get_future();
 
-    hci_->EnqueueCommand(ReadLocalExtendedFeaturesBuilder::Create(0x00),
-                         handler->BindOnceOn(this, &Controller::impl::read_local_extended_features_complete_handler,
-                                             std::move(features_promise)));
-    features_future.wait();
+      hci_->EnqueueCommand(ReadLocalExtendedFeaturesBuilder::Create(0x00),
+                           handler->BindOnceOn(this, &Controller::impl::read_local_extended_features_complete_handler,
+                                               std::move(features_promise)));
+      features_future.wait();
+
+      if (snapshot_enabled) {
+        save_capability_snapshot();
+      }
+    }
+    disable_commands_from_property();
 
     le_set_event_mask(MaskLeEventMask(local_version_information_.hci_version_, kDefaultLeEventMask));
 
@@ -235,6 +267,7 @@ struct Controller::impl {
 
   void Stop() {
     hci_ = nullptr;
+    storage_ = nullptr;
   }
 
   void NumberOfCompletedPackets(EventView event) {
@@ -324,7 +357,10 @@ struct Controller::impl {
     ErrorCode status = complete_view.GetStatus();
     ASSERT_LOG(status == ErrorCode::SUCCESS, "Status 0x%02hhx, %s", status, ErrorCodeText(status).c_str());
     local_supported_commands_ = complete_view.GetSupportedCommands();
+  }
 
+  // Applied once the supported commands are known, so that the snapshot keeps what the controller reported
+  void disable_commands_from_property() {
     if (auto disabledCommands = os::GetSystemProperty(kPropertyDisabledCommands)) {
       for (const auto& command : android::base::Split(*disabledCommands, ",")) {
         uint16_t index = std::stoi(command);
@@ -335,6 +371,79 @@ struct Controller::impl {
     }
   }
 
+  // Identifies the controller and firmware a capability snapshot was taken from
+  std::vector<uint8_t> capability_snapshot_key() const {
+    std::vector<uint8_t> key;
+    key.push_back(kCapabilitySnapshotFormat);
+    key.push_back(static_cast<uint8_t>(local_version_information_.hci_version_));
+    key.push_back(local_version_information_.hci_revision_ & 0xff);
+    key.push_back(local_version_information_.hci_revision_ >> 8);
+    key.push_back(static_cast<uint8_t>(local_version_information_.lmp_version_));
+    key.push_back(local_version_information_.manufacturer_name_ & 0xff);
+    key.push_back(local_version_information_.manufacturer_name_ >> 8);
+    key.push_back(local_version_information_.lmp_subversion_ & 0xff);
+    key.push_back(local_version_information_.lmp_subversion_ >> 8);
+    key.insert(key.end(), mac_address_.address.begin(), mac_address_.address.end());
+    return key;
+  }
+
+  // The snapshot holds the supported commands, LE features, LE states and the extended feature pages, which
+  // decide what else is read during Start()
+  void save_capability_snapshot() {
+    std::vector<uint8_t> snapshot = capability_snapshot_key();
+    auto append_uint64 = [&snapshot](uint64_t value) {
+      for (size_t i = 0; i < sizeof(value); i++) {
+        snapshot.push_back(static_cast<uint8_t>(value >> (8 * i)));
+      }
+    };
+    snapshot.insert(snapshot.end(), local_supported_commands_.begin(), local_supported_commands_.end());
+    append_uint64(le_local_supported_features_);
+    append_uint64(le_supported_states_);
+    for (uint64_t page : extended_lmp_features_array_) {
+      append_uint64(page);
+    }
+    storage_->SetBin(storage::StorageModule::kAdapterSection, kCapabilitySnapshotProperty, snapshot);
+  }
+
+  bool load_capability_snapshot() {
+    auto snapshot = storage_->GetBin(storage::StorageModule::kAdapterSection, kCapabilitySnapshotProperty);
+    if (!snapshot.has_value()) {
+      LOG_INFO("No controller capability snapshot");
+      return false;
+    }
+
+    std::vector<uint8_t> key = capability_snapshot_key();
+    size_t fixed_size = key.size() + local_supported_commands_.size() + 2 * sizeof(uint64_t);
+    if (snapshot->size() < fixed_size + sizeof(uint64_t) ||
+        (snapshot->size() - fixed_size) % sizeof(uint64_t) != 0 ||
+        !std::equal(key.begin(), key.end(), snapshot->begin())) {
+      LOG_INFO("Controller capability snapshot does not match the controller");
+      return false;
+    }
+
+    auto it = snapshot->begin() + key.size();
+    auto read_uint64 = [&it]() {
+      uint64_t value = 0;
+      for (size_t i = 0; i < sizeof(value); i++) {
+        value |= static_cast<uint64_t>(*it++) << (8 * i);
+      }
+      return value;
+    };
+    std::copy(it, it + local_supported_commands_.size(), local_supported_commands_.begin());
+    it += local_supported_commands_.size();
+    le_local_supported_features_ = read_uint64();
+    le_supported_states_ = read_uint64();
+    extended_lmp_features_array_.clear();
+    while (it != snapshot->end()) {
+      uint64_t page = read_uint64();
+      bluetooth::os::LogMetricBluetoothLocalSupportedFeatures(
+          static_cast<uint8_t>(extended_lmp_features_array_.size()), page);
+      extended_lmp_features_array_.push_back(page);
+    }
+    LOG_INFO("Loaded controller capabilities from snapshot");
+    return true;
+  }
+
   void read_local_extended_features_complete_handler(std::promise<void> promise, CommandCompleteView view) {
     auto complete_view = ReadLocalExtendedFeaturesCompleteView::Create(view);
     ASSERT(complete_view.IsValid());
@@ -1212,6 +1321,7 @@ struct Controller::impl {
   Controller& module_;
 
   HciLayer* hci_;
+  storage::StorageModule* storage_;
 
   CompletedAclPacketsCallback acl_credits_callback_{};
   CompletedAclPacketsCallback acl_monitor_credits_callback_{};
@@ -1559,10 +1669,11 @@ const ModuleFactory Controller::Factory = ModuleFactory([]() { return new Contro
 void Controller::ListDependencies(ModuleList* list) const {
   list->add<hci::HciLayer>();
   list->add<sysprops::SyspropsModule>();
+  list->add<storage::StorageModule>();
 }
 
 void Controller::Start() {
-  impl_->Start(GetDependency<hci::HciLayer>());
+  impl_->Start(GetDependency<hci::HciLayer>(), GetDependency<storage::StorageModule>());
 }
 
 void Controller::Stop() {
@@ -21,6 +21,7 @@
 #include <unistd.h>
 
 #include <chrono>
+#include <filesystem>
 #include <future>
 #include <memory>
 #include <sstream>
@@ -30,8 +31,10 @@
 #include "hci/address.h"
 #include "hci/hci_layer_fake.h"
 #include "module_dumper.h"
+#include "os/system_properties.h"
 #include "os/thread.h"
 #include "packet/raw_builder.h"
+#include "storage/storage_module.h"
 
 using namespace bluetooth;
 using namespace std::chrono_literals;
@@ -106,6 +109,7 @@ class HciLayerFakeForController : public HciLayerFake {
             num_packets, ErrorCode::SUCCESS, local_version_information);
       } break;
       case (OpCode::READ_LOCAL_SUPPORTED_COMMANDS): {
+        supported_commands_reads_++;
         std::array<uint8_t, 64> supported_commands;
         for (int i = 0; i < 37; i++) {
           supported_commands[i] = 0xff;
@@ -277,6 +281,13 @@ class HciLayerFakeForController : public HciLayerFake {
   uint64_t event_mask = 0;
   uint64_t le_event_mask = 0;
   uint16_t dynamic_audio_buffer_time = 0;
+  int supported_commands_reads_ = 0;
+};
+
+class StorageModuleFake : public storage::StorageModule {
+ public:
+  explicit StorageModuleFake(std::string config_file_path)
+      : StorageModule(std::move(config_file_path), std::chrono::milliseconds(100), 10, false, false) {}
 };
 
 class ControllerTest : public ::testing::Test {
@@ -284,6 +295,18 @@ class ControllerTest : public ::testing::Test {
   void SetUp() override {
     feature_spec_version = feature_spec_version_;
     bluetooth::common::InitFlags::SetAllForTesting();
+    config_path_ = std::filesystem::temp_directory_path() / "controller_test_config.conf";
+    RemoveConfigFiles();
+    StartController();
+  }
+
+  void TearDown() override {
+    fake_registry_.StopAll();
+    RemoveConfigFiles();
+  }
+
+  void StartController() {
+    fake_registry_.InjectTestModule(&storage::StorageModule::Factory, new StorageModuleFake(config_path_.string()));
     test_hci_layer_ = new HciLayerFakeForController;
     test_hci_layer_->vendor_capabilities_ = std::move(vendor_capabilities_);
     vendor_capabilities_.reset();
@@ -293,8 +316,10 @@ class ControllerTest : public ::testing::Test {
     controller_ = static_cast<Controller*>(fake_registry_.GetModuleUnderTest(&Controller::Factory));
   }
 
-  void TearDown() override {
-    fake_registry_.StopAll();
+  void RemoveConfigFiles() {
+    for (const auto& extension : {".conf", ".bak", ".journal"}) {
+      std::filesystem::remove(std::filesystem::path(config_path_).replace_extension(extension));
+    }
   }
 
   TestModuleRegistry fake_registry_;
@@ -304,9 +329,29 @@ class ControllerTest : public ::testing::Test {
   os::Handler* client_handler_ = nullptr;
   uint16_t feature_spec_version_ = 98;
   std::unique_ptr<EventBuilder> vendor_capabilities_ = nullptr;
+  std::filesystem::path config_path_;
 };
 }  // namespace
 
+class ControllerCapabilitySnapshotTest : public ControllerTest {
+ protected:
+  void SetUp() override {
+    os::SetSystemProperty("bluetooth.core.controller.capability_snapshot.enabled", "true");
+    ControllerTest::SetUp();
+  }
+
+  void TearDown() override {
+    ControllerTest::TearDown();
+    os::SetSystemProperty("bluetooth.core.controller.capability_snapshot.enabled", "false");
+  }
+
+  void RestartController() {
+    ASSERT_TRUE(fake_registry_.SynchronizeModuleHandler(&storage::StorageModule::Factory, 100ms));
+    fake_registry_.StopAll();
+    StartController();
+  }
+};
+
 class Controller055Test : public ControllerTest {
  protected:
   void SetUp() override {
@@ -416,6 +461,21 @@ TEST_F(ControllerTest, read_controller_info) {
   ASSERT_TRUE(controller_->GetLocalSupportedBrEdrCodecIds().size() > 0);
 }
 
+TEST_F(ControllerCapabilitySnapshotTest, restart_reads_capabilities_from_snapshot) {
+  ASSERT_EQ(test_hci_layer_->supported_commands_reads_, 1);
+  uint64_t le_supported_states = controller_->GetLeSupportedStates();
+  uint64_t local_features = controller_->GetLocalFeatures(2);
+  bool supports_codecs = controller_->IsSupported(OpCode::READ_LOCAL_SUPPORTED_CODECS_V1);
+
+  RestartController();
+
+  ASSERT_EQ(test_hci_layer_->supported_commands_reads_, 0);
+  ASSERT_EQ(controller_->GetLeSupportedStates(), le_supported_states);
+  ASSERT_EQ(controller_->GetLocalFeatures(2), local_features);
+  ASSERT_EQ(controller_->IsSupported(OpCode::READ_LOCAL_SUPPORTED_CODECS_V1), supports_codecs);
+  ASSERT_EQ(controller_->GetLocalVersionInformation().lmp_subversion_, 0x5678);
+}
+
 TEST_F(ControllerTest, read_write_local_name) {
   ASSERT_EQ(controller_->GetLocalName(), "DUT");
   controller_->WriteLocalName("New name");
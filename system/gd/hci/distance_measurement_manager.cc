@@ -676,7 +676,7 @@ struct DistanceMeasurementManager::impl {
     }
 
     std::vector<CsProcedureData>& data_list = cs_trackers_[connection_handle].procedure_data_list;
-    for (CsProcedureData procedure_data : data_list) {
+    for (const CsProcedureData& procedure_data : data_list) {
       if (procedure_data.counter == procedure_counter) {
         // Data already exist, return
         return;
@@ -730,11 +730,13 @@ struct DistanceMeasurementManager::impl {
   }
 
   void parse_cs_result_data(
-      std::vector<LeCsResultDataStructure> result_data_structures,
+      const std::vector<LeCsResultDataStructure>& result_data_structures,
       CsProcedureData& procedure_data,
       CsRole role) {
     uint8_t num_antenna_paths = procedure_data.num_antenna_paths;
-    for (auto result_data_structure : result_data_structures) {
+    // Reused for every step, a subevent can carry up to 160 steps
+    auto bytes = std::make_shared<std::vector<uint8_t>>();
+    for (const auto& result_data_structure : result_data_structures) {
       uint16_t mode = result_data_structure.step_mode_;
       uint16_t step_channel = result_data_structure.step_channel_;
       LOG_VERBOSE(
@@ -744,7 +746,7 @@ struct DistanceMeasurementManager::impl {
           (uint16_t)result_data_structure.step_data_.size());
 
       // Parse data into structs from an iterator
-      auto bytes = std::make_shared<std::vector<uint8_t>>();
+      bytes->clear();
       if (mode == 0x02 || mode == 0x03) {
         // Add one byte for the length of Tone_PCT[k], Tone_Quality_Indicator[k]
         bytes->emplace_back(num_antenna_paths + 1);
@@ -790,7 +792,7 @@ struct DistanceMeasurementManager::impl {
           if (role == CsRole::INITIATOR) {
             procedure_data.step_channel.push_back(step_channel);
           }
-          auto tone_data = tone_data_view.tone_data_;
+          const auto& tone_data = tone_data_view.tone_data_;
           uint8_t permutation_index = tone_data_view.antenna_permutation_index_;
           // Parse in ascending order of antenna position with tone extension data at the end
           uint16_t num_tone_data = num_antenna_paths + 1;
@@ -839,7 +841,7 @@ struct DistanceMeasurementManager::impl {
     return num_signed;
   }
 
-  void print_raw_data(std::vector<uint8_t> raw_data) {
+  void print_raw_data(const std::vector<uint8_t>& raw_data) {
     std::string raw_data_str = "";
     auto for_end = raw_data.size() - 1;
     for (size_t i = 0; i < for_end; i++) {
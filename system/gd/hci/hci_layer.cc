@@ -20,14 +20,26 @@
 #include <signal.h>
 #endif
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+
 #include "common/bind.h"
 #include "common/init_flags.h"
 #include "common/stop_watch.h"
+#include "dumpsys_data_generated.h"
 #include "hci/class_of_device.h"
 #include "hci/hci_metrics_logging.h"
+#include "hci_layer_generated.h"
+#include "module_dumper_flatbuffer.h"
 #include "os/alarm.h"
 #include "os/metrics.h"
 #include "os/queue.h"
+#include "os/system_properties.h"
+#include "os/trace.h"
 #include "osi/include/stack_power_telemetry.h"
 #include "packet/packet_builder.h"
 #include "storage/storage_module.h"
@@ -52,6 +64,82 @@ using os::Alarm;
 using os::Handler;
 using std::unique_ptr;
 
+// Maximum number of commands sent to the controller before their response came back, still bounded
+// by the Num_HCI_Command_Packets credits the controller grants. Only commands without side effects
+// are pipelined, see is_pipelined_command().
+static const char kPropertyMaxOutstandingCommands[] = "bluetooth.hci.max_outstanding_commands";
+static constexpr uint32_t kMaxOutstandingCommandsLimit = 8;
+
+// Commands that only read controller state. They can be in flight together since the order in which
+// they complete does not matter, any other command waits until everything before it has completed.
+static bool is_pipelined_command(OpCode op_code) {
+  switch (op_code) {
+    case OpCode::READ_LOCAL_NAME:
+    case OpCode::READ_LOCAL_VERSION_INFORMATION:
+    case OpCode::READ_LOCAL_SUPPORTED_COMMANDS:
+    case OpCode::READ_LOCAL_SUPPORTED_FEATURES:
+    case OpCode::READ_LOCAL_EXTENDED_FEATURES:
+    case OpCode::READ_BUFFER_SIZE:
+    case OpCode::READ_BD_ADDR:
+    case OpCode::READ_LOCAL_SUPPORTED_CODECS_V1:
+    case OpCode::READ_LOCAL_SUPPORTED_CODECS_V2:
+    case OpCode::LE_READ_BUFFER_SIZE_V1:
+    case OpCode::LE_READ_BUFFER_SIZE_V2:
+    case OpCode::LE_READ_LOCAL_SUPPORTED_FEATURES:
+    case OpCode::LE_READ_SUPPORTED_STATES:
+    case OpCode::LE_READ_FILTER_ACCEPT_LIST_SIZE:
+    case OpCode::LE_READ_RESOLVING_LIST_SIZE:
+    case OpCode::LE_READ_MAXIMUM_DATA_LENGTH:
+    case OpCode::LE_READ_SUGGESTED_DEFAULT_DATA_LENGTH:
+    case OpCode::LE_READ_MAXIMUM_ADVERTISING_DATA_LENGTH:
+    case OpCode::LE_READ_NUMBER_OF_SUPPORTED_ADVERTISING_SETS:
+    case OpCode::LE_READ_PERIODIC_ADVERTISER_LIST_SIZE:
+    case OpCode::LE_READ_ADVERTISING_PHYSICAL_CHANNEL_TX_POWER:
+    case OpCode::LE_READ_TRANSMIT_POWER:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Upper bounds of the command latency histogram buckets, the last bucket holds everything above.
+static constexpr std::array<std::chrono::milliseconds, 10> kCommandLatencyBuckets = {
+    std::chrono::milliseconds(1),
+    std::chrono::milliseconds(2),
+    std::chrono::milliseconds(5),
+    std::chrono::milliseconds(10),
+    std::chrono::milliseconds(20),
+    std::chrono::milliseconds(50),
+    std::chrono::milliseconds(100),
+    std::chrono::milliseconds(200),
+    std::chrono::milliseconds(500),
+    std::chrono::milliseconds(1000),
+};
+
+// Time a command spent in the queue before it was sent, and until its Command Complete or Command
+// Status came back, accumulated per opcode.
+struct CommandLatencyStats {
+  uint64_t count{0};
+  std::chrono::steady_clock::duration total_latency{};
+  std::chrono::steady_clock::duration max_latency{};
+  std::chrono::steady_clock::duration total_queue_wait{};
+  std::chrono::steady_clock::duration max_queue_wait{};
+  std::array<uint64_t, kCommandLatencyBuckets.size() + 1> histogram{};
+
+  void record(std::chrono::steady_clock::duration queue_wait, std::chrono::steady_clock::duration latency) {
+    count++;
+    total_latency += latency;
+    max_latency = std::max(max_latency, latency);
+    total_queue_wait += queue_wait;
+    max_queue_wait = std::max(max_queue_wait, queue_wait);
+    size_t bucket = 0;
+    while (bucket < kCommandLatencyBuckets.size() && latency >= kCommandLatencyBuckets[bucket]) {
+      bucket++;
+    }
+    histogram[bucket]++;
+  }
+};
+
 static void fail_if_reset_complete_not_success(CommandCompleteView complete) {
   auto reset_complete = ResetCompleteView::Create(complete);
   ASSERT(reset_complete.IsValid());
@@ -70,6 +158,7 @@ class CommandQueueEntry {
       unique_ptr<CommandBuilder> command_packet,
       ContextualOnceCallback<void(CommandCompleteView)> on_complete_function)
       : command(std::move(command_packet)),
+        enqueue_time(std::chrono::steady_clock::now()),
         waiting_for_status_(false),
         on_complete(std::move(on_complete_function)) {}
 
@@ -77,11 +166,16 @@ class CommandQueueEntry {
       unique_ptr<CommandBuilder> command_packet,
       ContextualOnceCallback<void(CommandStatusView)> on_status_function)
       : command(std::move(command_packet)),
+        enqueue_time(std::chrono::steady_clock::now()),
         waiting_for_status_(true),
         on_status(std::move(on_status_function)) {}
 
   unique_ptr<CommandBuilder> command;
+  // Set once the command is serialized, which may happen before it is sent
+  std::shared_ptr<std::vector<uint8_t>> command_bytes;
   unique_ptr<CommandView> command_view;
+  std::chrono::steady_clock::time_point enqueue_time;
+  std::chrono::steady_clock::time_point send_time;
 
   bool waiting_for_status_;
   ContextualOnceCallback<void(CommandStatusView)> on_status;
@@ -105,7 +199,12 @@ class CommandQueueEntry {
 
 struct HciLayer::impl {
   impl(hal::HciHal* hal, HciLayer& module) : hal_(hal), module_(module) {
-    hci_timeout_alarm_ = new Alarm(module.GetHandler());
+    hci_timeout_alarm_ = new Alarm(module.GetHandler(), os::AlarmClass::CRITICAL);
+    max_outstanding_commands_ = std::clamp(
+        os::GetSystemPropertyUint32(kPropertyMaxOutstandingCommands, 1), 1u, kMaxOutstandingCommandsLimit);
+    if (max_outstanding_commands_ > 1) {
+      LOG_INFO("Pipelining up to %u read commands", max_outstanding_commands_);
+    }
   }
 
   ~impl() {
@@ -126,32 +225,32 @@ struct HciLayer::impl {
   }
 
   void on_outbound_acl_ready() {
+    BT_TRACE_SCOPED("HCI ACL TX");
     auto packet = acl_queue_.GetDownEnd()->TryDequeue();
     std::vector<uint8_t> bytes;
-    BitInserter bi(bytes);
-    packet->Serialize(bi);
+    packet->SerializeInto(bytes);
     hal_->sendAclData(bytes);
   }
 
   void on_outbound_sco_ready() {
     auto packet = sco_queue_.GetDownEnd()->TryDequeue();
     std::vector<uint8_t> bytes;
-    BitInserter bi(bytes);
-    packet->Serialize(bi);
+    packet->SerializeInto(bytes);
     hal_->sendScoData(bytes);
   }
 
   void on_outbound_iso_ready() {
+    BT_TRACE_SCOPED("HCI ISO TX");
     auto packet = iso_queue_.GetDownEnd()->TryDequeue();
     std::vector<uint8_t> bytes;
-    BitInserter bi(bytes);
-    packet->Serialize(bi);
+    packet->SerializeInto(bytes);
     hal_->sendIsoData(bytes);
   }
 
   template <typename TResponse>
   void enqueue_command(unique_ptr<CommandBuilder> command, ContextualOnceCallback<void(TResponse)> on_response) {
     command_queue_.emplace_back(std::move(command), std::move(on_response));
+    BT_TRACE_COUNTER("HCI command queue", command_queue_.size());
     send_next_command();
   }
 
@@ -192,22 +291,24 @@ struct HciLayer::impl {
         logging_id.c_str(),
         op_code,
         OpCodeText(op_code).c_str());
-    if (waiting_command_ == OpCode::CONTROLLER_DEBUG_INFO && op_code != OpCode::CONTROLLER_DEBUG_INFO) {
+    OpCode waiting_command = oldest_waiting_command();
+    if (waiting_command == OpCode::CONTROLLER_DEBUG_INFO && op_code != OpCode::CONTROLLER_DEBUG_INFO) {
       LOG_ERROR("Discarding event that came after timeout 0x%02hx (%s)", op_code, OpCodeText(op_code).c_str());
       common::StopWatch::DumpStopWatchLog();
       return;
     }
+    auto command = find_waiting_command(op_code);
     ASSERT_LOG(
-        waiting_command_ == op_code,
+        command != command_queue_.end(),
         "Waiting for 0x%02hx (%s), got 0x%02hx (%s)",
-        waiting_command_,
-        OpCodeText(waiting_command_).c_str(),
+        waiting_command,
+        OpCodeText(waiting_command).c_str(),
         op_code,
         OpCodeText(op_code).c_str());
 
     bool is_vendor_specific = static_cast<int>(op_code) & (0x3f << 10);
     CommandStatusView status_view = CommandStatusView::Create(event);
-    if (is_vendor_specific && (is_status && !command_queue_.front().waiting_for_status_) &&
+    if (is_vendor_specific && (is_status && !command->waiting_for_status_) &&
         (status_view.IsValid() && status_view.GetStatus() == ErrorCode::UNKNOWN_HCI_COMMAND)) {
       // If this is a command status of a vendor specific command, and command complete is expected,
       // we can't treat this as hard failure since we have no way of probing this lack of support at
@@ -215,15 +316,14 @@ struct HciLayer::impl {
       // packet, which will be interpreted as invalid response.
       CommandCompleteView command_complete_view = CommandCompleteView::Create(
           EventView::Create(PacketView<kLittleEndian>(std::make_shared<std::vector<uint8_t>>(std::vector<uint8_t>()))));
-      command_queue_.front().GetCallback<CommandCompleteView>()->Invoke(
-          std::move(command_complete_view));
+      command->GetCallback<CommandCompleteView>()->Invoke(std::move(command_complete_view));
     } else {
-      if (command_queue_.front().waiting_for_status_ == is_status) {
-        command_queue_.front().GetCallback<TResponse>()->Invoke(std::move(response_view));
+      if (command->waiting_for_status_ == is_status) {
+        command->GetCallback<TResponse>()->Invoke(std::move(response_view));
       } else {
         CommandCompleteView command_complete_view = CommandCompleteView::Create(
             EventView::Create(PacketView<kLittleEndian>(std::make_shared<std::vector<uint8_t>>(std::vector<uint8_t>()))));
-        command_queue_.front().GetCallback<CommandCompleteView>()->Invoke(std::move(command_complete_view));
+        command->GetCallback<CommandCompleteView>()->Invoke(std::move(command_complete_view));
       }
     }
 
@@ -235,7 +335,7 @@ struct HciLayer::impl {
     // would return UNKNOWN_CONNECTION in some cases.
     if (op_code == OpCode::LE_READ_REMOTE_FEATURES && is_status && status_view.IsValid() &&
         status_view.GetStatus() == ErrorCode::UNKNOWN_CONNECTION) {
-      auto& command_view = *command_queue_.front().command_view;
+      auto& command_view = *command->command_view;
       auto le_read_features_view = bluetooth::hci::LeReadRemoteFeaturesView::Create(
           LeConnectionManagementCommandView::Create(AclCommandView::Create(command_view)));
       if (le_read_features_view.IsValid()) {
@@ -245,14 +345,64 @@ struct HciLayer::impl {
     }
 #endif
 
-    command_queue_.pop_front();
-    waiting_command_ = OpCode::NONE;
+    record_command_latency(op_code, *command);
+    command_queue_.erase(command);
+    num_waiting_commands_--;
     if (hci_timeout_alarm_ != nullptr) {
       hci_timeout_alarm_->Cancel();
+      if (num_waiting_commands_ > 0) {
+        schedule_hci_timeout(oldest_waiting_command());
+      }
       send_next_command();
     }
   }
 
+  void record_command_latency(OpCode op_code, const CommandQueueEntry& command) {
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(command_latency_mutex_);
+    command_latencies_[op_code].record(command.send_time - command.enqueue_time, now - command.send_time);
+  }
+
+  // Commands are sent in queue order, so the ones waiting for a response are always the first
+  // |num_waiting_commands_| entries of |command_queue_|.
+  OpCode oldest_waiting_command() const {
+    if (num_waiting_commands_ == 0) {
+      return OpCode::NONE;
+    }
+    return command_queue_.front().command_view->GetOpCode();
+  }
+
+  std::list<CommandQueueEntry>::iterator find_waiting_command(OpCode op_code) {
+    auto it = command_queue_.begin();
+    for (size_t i = 0; i < num_waiting_commands_; i++, it++) {
+      if (it->command_view->GetOpCode() == op_code) {
+        return it;
+      }
+    }
+    return command_queue_.end();
+  }
+
+  // A command may only join other commands in flight when all of them are pipelined commands and
+  // none of them shares its opcode, so that each response maps to exactly one command.
+  bool can_send_while_waiting(const CommandQueueEntry& next, OpCode next_op_code) const {
+    if (num_waiting_commands_ >= max_outstanding_commands_ || !is_pipelined_command(next_op_code) ||
+        next.waiting_for_status_) {
+      return false;
+    }
+    auto it = command_queue_.begin();
+    for (size_t i = 0; i < num_waiting_commands_; i++, it++) {
+      OpCode op_code = it->command_view->GetOpCode();
+      if (op_code == next_op_code || !is_pipelined_command(op_code)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void schedule_hci_timeout(OpCode op_code) {
+    hci_timeout_alarm_->Schedule(BindOnce(&impl::on_hci_timeout, common::Unretained(this), op_code), kHciTimeoutMs);
+  }
+
   void on_hci_timeout(OpCode op_code) {
     common::StopWatch::DumpStopWatchLog();
     LOG_ERROR("Timed out waiting for 0x%02hx (%s)", op_code, OpCodeText(op_code).c_str());
@@ -262,7 +412,7 @@ struct HciLayer::impl {
     // Clear any waiting commands (there is an abort coming anyway)
     command_queue_.clear();
     command_credits_ = 1;
-    waiting_command_ = OpCode::NONE;
+    num_waiting_commands_ = 0;
     // Ignore the response, since we don't know what might come back.
     enqueue_command(ControllerDebugInfoBuilder::Create(), module_.GetHandler()->BindOnce([](CommandCompleteView) {}));
     // Don't time out for this one;
@@ -272,7 +422,7 @@ struct HciLayer::impl {
       hci_timeout_alarm_ = nullptr;
     }
     if (hci_abort_alarm_ == nullptr) {
-      hci_abort_alarm_ = new Alarm(module_.GetHandler());
+      hci_abort_alarm_ = new Alarm(module_.GetHandler(), os::AlarmClass::CRITICAL);
       hci_abort_alarm_->Schedule(BindOnce(&abort_after_time_out, op_code), kHciTimeoutRestartMs);
     } else {
       LOG_WARN("Unable to schedul abort timer");
@@ -280,33 +430,36 @@ struct HciLayer::impl {
   }
 
   void send_next_command() {
-    if (command_credits_ == 0) {
-      return;
-    }
-    if (waiting_command_ != OpCode::NONE) {
-      return;
-    }
-    if (command_queue_.size() == 0) {
-      return;
-    }
-    std::shared_ptr<std::vector<uint8_t>> bytes = std::make_shared<std::vector<uint8_t>>();
-    BitInserter bi(*bytes);
-    command_queue_.front().command->Serialize(bi);
-    hal_->sendHciCommand(*bytes);
-
-    auto cmd_view = CommandView::Create(PacketView<kLittleEndian>(bytes));
-    ASSERT(cmd_view.IsValid());
-    OpCode op_code = cmd_view.GetOpCode();
-    power_telemetry::GetInstance().LogHciCmdDetail();
-    command_queue_.front().command_view = std::make_unique<CommandView>(std::move(cmd_view));
-    log_link_layer_connection_command(command_queue_.front().command_view);
-    log_classic_pairing_command_status(command_queue_.front().command_view, ErrorCode::STATUS_UNKNOWN);
-    waiting_command_ = op_code;
-    command_credits_ = 0;  // Only allow one outstanding command
-    if (hci_timeout_alarm_ != nullptr) {
-      hci_timeout_alarm_->Schedule(BindOnce(&impl::on_hci_timeout, common::Unretained(this), op_code), kHciTimeoutMs);
-    } else {
-      LOG_WARN("%s sent without an hci-timeout timer", OpCodeText(op_code).c_str());
+    while (command_credits_ > 0 && num_waiting_commands_ < command_queue_.size()) {
+      auto& next = *std::next(command_queue_.begin(), num_waiting_commands_);
+      if (next.command_view == nullptr) {
+        next.command_bytes = std::make_shared<std::vector<uint8_t>>();
+        next.command->SerializeInto(*next.command_bytes);
+        auto cmd_view = CommandView::Create(PacketView<kLittleEndian>(next.command_bytes));
+        ASSERT(cmd_view.IsValid());
+        next.command_view = std::make_unique<CommandView>(std::move(cmd_view));
+      }
+      OpCode op_code = next.command_view->GetOpCode();
+      if (num_waiting_commands_ > 0 && !can_send_while_waiting(next, op_code)) {
+        return;
+      }
+
+      BT_TRACE_SCOPED_ID("HCI command TX", op_code);
+      next.send_time = std::chrono::steady_clock::now();
+      hal_->sendHciCommand(*next.command_bytes);
+      power_telemetry::GetInstance().LogHciCmdDetail();
+      log_link_layer_connection_command(next.command_view);
+      log_classic_pairing_command_status(next.command_view, ErrorCode::STATUS_UNKNOWN);
+      num_waiting_commands_++;
+      command_credits_--;
+      if (hci_timeout_alarm_ != nullptr) {
+        // The timeout always tracks the oldest command waiting for a response
+        if (num_waiting_commands_ == 1) {
+          schedule_hci_timeout(op_code);
+        }
+      } else {
+        LOG_WARN("%s sent without an hci-timeout timer", OpCodeText(op_code).c_str());
+      }
     }
   }
 
@@ -317,33 +470,35 @@ struct HciLayer::impl {
         EventCode::LE_META_EVENT,
         EventCodeText(EventCode::LE_META_EVENT).c_str());
     // Allow GD Cert tests to register for CONNECTION_REQUEST
+    auto& event_handler = event_handlers_[static_cast<uint8_t>(event)];
     if (event == EventCode::CONNECTION_REQUEST && module_.on_acl_connection_request_.IsEmpty()) {
       LOG_INFO("Registering test for CONNECTION_REQUEST, since there's no ACL");
-      event_handlers_.erase(event);
+      event_handler = {};
     }
     ASSERT_LOG(
-        event_handlers_.count(event) == 0,
+        event_handler.IsEmpty(),
         "Can not register a second handler for %02hhx (%s)",
         event,
         EventCodeText(event).c_str());
-    event_handlers_[event] = handler;
+    event_handler = handler;
   }
 
   void unregister_event(EventCode event) {
-    event_handlers_.erase(event);
+    event_handlers_[static_cast<uint8_t>(event)] = {};
   }
 
   void register_le_event(SubeventCode event, ContextualCallback<void(LeMetaEventView)> handler) {
+    auto& subevent_handler = subevent_handlers_[static_cast<uint8_t>(event)];
     ASSERT_LOG(
-        subevent_handlers_.count(event) == 0,
+        subevent_handler.IsEmpty(),
         "Can not register a second handler for %02hhx (%s)",
         event,
         SubeventCodeText(event).c_str());
-    subevent_handlers_[event] = handler;
+    subevent_handler = handler;
   }
 
   void unregister_le_event(SubeventCode event) {
-    subevent_handlers_.erase(subevent_handlers_.find(event));
+    subevent_handlers_[static_cast<uint8_t>(event)] = {};
   }
 
   static void abort_after_root_inflammation(uint8_t vse_error) {
@@ -361,7 +516,7 @@ struct HciLayer::impl {
       hci_timeout_alarm_ = nullptr;
     }
     if (hci_abort_alarm_ == nullptr) {
-      hci_abort_alarm_ = new Alarm(module_.GetHandler());
+      hci_abort_alarm_ = new Alarm(module_.GetHandler(), os::AlarmClass::CRITICAL);
       hci_abort_alarm_->Schedule(BindOnce(&abort_after_root_inflammation, vse_error_reason), kHciTimeoutRestartMs);
     } else {
       LOG_WARN("Abort timer already scheduled");
@@ -370,6 +525,7 @@ struct HciLayer::impl {
 
   void on_hci_event(EventView event) {
     ASSERT(event.IsValid());
+    BT_TRACE_SCOPED_ID("HCI event RX", event.GetEventCode());
     if (command_queue_.empty()) {
       auto event_code = event.GetEventCode();
       // BT Core spec 5.2 (Volume 4, Part E section 4.4) allows anytime
@@ -405,6 +561,7 @@ struct HciLayer::impl {
     }
     power_telemetry::GetInstance().LogHciEvtDetail();
     EventCode event_code = event.GetEventCode();
+    event_counts_[static_cast<uint8_t>(event_code)].fetch_add(1, std::memory_order_relaxed);
     // Root Inflamation is a special case, since it aborts here
     if (event_code == EventCode::VENDOR_SPECIFIC) {
       auto view = VendorSpecificEventView::Create(event);
@@ -431,15 +588,17 @@ struct HciLayer::impl {
       case EventCode::HARDWARE_ERROR:
         on_hardware_error(event);
         break;
-      default:
-        if (event_handlers_.find(event_code) == event_handlers_.end()) {
+      default: {
+        auto& event_handler = event_handlers_[static_cast<uint8_t>(event_code)];
+        if (event_handler.IsEmpty()) {
           LOG_WARN(
               "Unhandled event of type 0x%02hhx (%s)",
               event_code,
               EventCodeText(event_code).c_str());
         } else {
-          event_handlers_[event_code].Invoke(event);
+          event_handler.Invoke(event);
         }
+      }
     }
   }
 
@@ -461,11 +620,71 @@ struct HciLayer::impl {
     LeMetaEventView meta_event_view = LeMetaEventView::Create(event);
     ASSERT(meta_event_view.IsValid());
     SubeventCode subevent_code = meta_event_view.GetSubeventCode();
-    if (subevent_handlers_.find(subevent_code) == subevent_handlers_.end()) {
+    subevent_counts_[static_cast<uint8_t>(subevent_code)].fetch_add(1, std::memory_order_relaxed);
+    auto& subevent_handler = subevent_handlers_[static_cast<uint8_t>(subevent_code)];
+    if (subevent_handler.IsEmpty()) {
       LOG_WARN("Unhandled le subevent of type 0x%02hhx (%s)", subevent_code, SubeventCodeText(subevent_code).c_str());
       return;
     }
-    subevent_handlers_[subevent_code].Invoke(meta_event_view);
+    subevent_handler.Invoke(meta_event_view);
+  }
+
+  template <typename TCode>
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<HciEventCountData>>> dump_counts(
+      flatbuffers::FlatBufferBuilder* fb_builder,
+      const std::array<std::atomic<uint64_t>, kNumEventCodes>& counts,
+      std::string (*code_text)(const TCode&)) const {
+    std::vector<std::pair<uint64_t, uint8_t>> non_zero_counts;
+    for (size_t code = 0; code < counts.size(); code++) {
+      uint64_t count = counts[code].load(std::memory_order_relaxed);
+      if (count > 0) {
+        non_zero_counts.emplace_back(count, static_cast<uint8_t>(code));
+      }
+    }
+    std::sort(non_zero_counts.rbegin(), non_zero_counts.rend());
+
+    std::vector<flatbuffers::Offset<HciEventCountData>> count_data;
+    for (const auto& [count, code] : non_zero_counts) {
+      auto name = fb_builder->CreateString(code_text(static_cast<TCode>(code)));
+      count_data.push_back(CreateHciEventCountData(*fb_builder, code, name, count));
+    }
+    return fb_builder->CreateVector(count_data);
+  }
+
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<HciCommandLatencyData>>> dump_command_latencies(
+      flatbuffers::FlatBufferBuilder* fb_builder) const {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    std::lock_guard<std::mutex> lock(command_latency_mutex_);
+    std::vector<flatbuffers::Offset<HciCommandLatencyData>> latency_data;
+    for (const auto& [op_code, stats] : command_latencies_) {
+      auto name = fb_builder->CreateString(OpCodeText(op_code));
+      auto histogram = fb_builder->CreateVector(stats.histogram.data(), stats.histogram.size());
+      HciCommandLatencyDataBuilder builder(*fb_builder);
+      builder.add_op_code(static_cast<uint16_t>(op_code));
+      builder.add_name(name);
+      builder.add_count(stats.count);
+      builder.add_mean_latency_us(duration_cast<microseconds>(stats.total_latency).count() / stats.count);
+      builder.add_max_latency_us(duration_cast<microseconds>(stats.max_latency).count());
+      builder.add_mean_queue_wait_us(duration_cast<microseconds>(stats.total_queue_wait).count() / stats.count);
+      builder.add_max_queue_wait_us(duration_cast<microseconds>(stats.max_queue_wait).count());
+      builder.add_latency_histogram(histogram);
+      latency_data.push_back(builder.Finish());
+    }
+    return fb_builder->CreateVector(latency_data);
+  }
+
+  flatbuffers::Offset<HciLayerData> dump(flatbuffers::FlatBufferBuilder* fb_builder) const {
+    auto title = fb_builder->CreateString("----- Hci Layer Dumpsys -----");
+    auto event_counts = dump_counts<EventCode>(fb_builder, event_counts_, &EventCodeText);
+    auto le_subevent_counts = dump_counts<SubeventCode>(fb_builder, subevent_counts_, &SubeventCodeText);
+    auto command_latencies = dump_command_latencies(fb_builder);
+    HciLayerDataBuilder builder(*fb_builder);
+    builder.add_title(title);
+    builder.add_event_counts(event_counts);
+    builder.add_le_subevent_counts(le_subevent_counts);
+    builder.add_command_latencies(command_latencies);
+    return builder.Finish();
   }
 
   hal::HciHal* hal_;
@@ -474,9 +693,19 @@ struct HciLayer::impl {
   // Command Handling
   std::list<CommandQueueEntry> command_queue_;
 
-  std::map<EventCode, ContextualCallback<void(EventView)>> event_handlers_;
-  std::map<SubeventCode, ContextualCallback<void(LeMetaEventView)>> subevent_handlers_;
-  OpCode waiting_command_{OpCode::NONE};
+  // Event and LE subevent codes are a single byte, handlers and counters are indexed by them directly
+  static constexpr size_t kNumEventCodes = 256;
+  std::array<ContextualCallback<void(EventView)>, kNumEventCodes> event_handlers_{};
+  std::array<ContextualCallback<void(LeMetaEventView)>, kNumEventCodes> subevent_handlers_{};
+  // Written on the HCI handler, read by dumpsys
+  std::array<std::atomic<uint64_t>, kNumEventCodes> event_counts_{};
+  std::array<std::atomic<uint64_t>, kNumEventCodes> subevent_counts_{};
+  // Number of commands at the front of |command_queue_| that were sent and wait for a response
+  size_t num_waiting_commands_{0};
+  uint32_t max_outstanding_commands_{1};
+  // Written on the HCI handler, read by dumpsys
+  mutable std::mutex command_latency_mutex_;
+  std::map<OpCode, CommandLatencyStats> command_latencies_;
   uint8_t command_credits_{1};  // Send reset first
   Alarm* hci_timeout_alarm_{nullptr};
   Alarm* hci_abort_alarm_{nullptr};
@@ -499,12 +728,14 @@ struct HciLayer::hal_callbacks : public hal::HciHalCallbacks {
   hal_callbacks(HciLayer& module) : module_(module) {}
 
   void hciEventReceived(hal::HciPacket event_bytes) override {
-    auto packet = packet::PacketView<packet::kLittleEndian>(std::make_shared<std::vector<uint8_t>>(event_bytes));
+    auto packet =
+        packet::PacketView<packet::kLittleEndian>(std::make_shared<std::vector<uint8_t>>(std::move(event_bytes)));
     EventView event = EventView::Create(packet);
     module_.CallOn(module_.impl_, &impl::on_hci_event, std::move(event));
   }
 
   void aclDataReceived(hal::HciPacket data_bytes) override {
+    BT_TRACE_SCOPED("HCI ACL RX");
     auto packet = packet::PacketView<packet::kLittleEndian>(
         std::make_shared<std::vector<uint8_t>>(std::move(data_bytes)));
     auto acl = std::make_unique<AclView>(AclView::Create(packet));
@@ -760,6 +991,17 @@ DistanceMeasurementInterface* HciLayer::GetDistanceMeasurementInterface(
 
 const ModuleFactory HciLayer::Factory = ModuleFactory([]() { return new HciLayer(); });
 
+DumpsysDataFinisher HciLayer::GetDumpsysData(flatbuffers::FlatBufferBuilder* builder) const {
+  ASSERT(builder != nullptr);
+  if (impl_ == nullptr) {
+    return EmptyDumpsysDataFinisher;
+  }
+  auto dumpsys_data = impl_->dump(builder);
+  return [dumpsys_data](DumpsysDataBuilder* dumpsys_builder) {
+    dumpsys_builder->add_hci_layer_dumpsys_data(dumpsys_data);
+  };
+}
+
 void HciLayer::ListDependencies(ModuleList* list) const {
   list->add<hal::HciHal>();
   list->add<storage::StorageModule>();
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+#include "common/bind.h"
+#include "hal/hci_hal.h"
+#include "hci/hci_layer.h"
+#include "hci/hci_packets.h"
+#include "module.h"
+#include "os/handler.h"
+#include "os/system_properties.h"
+#include "os/thread.h"
+#include "packet/raw_builder.h"
+
+using ::benchmark::State;
+
+namespace bluetooth {
+namespace hci {
+
+namespace {
+
+// Round trip of a command over the transport, including controller processing
+constexpr std::chrono::microseconds kCommandRoundTrip = std::chrono::microseconds(500);
+constexpr uint8_t kNumHciCommandPackets = 8;
+
+std::vector<uint8_t> GetPacketBytes(std::unique_ptr<packet::BasePacketBuilder> packet) {
+  std::vector<uint8_t> bytes;
+  BitInserter i(bytes);
+  bytes.reserve(packet->size());
+  packet->Serialize(i);
+  return bytes;
+}
+
+// Answers every command with a successful Command Complete kCommandRoundTrip after it was sent.
+// Responses are produced in order on a dedicated thread, so commands that are in flight together
+// overlap their round trips the way they would with a real controller.
+class LatencyHciHal : public hal::HciHal {
+ public:
+  LatencyHciHal() : thread_("controller_thread", os::Thread::Priority::NORMAL), handler_(&thread_) {}
+
+  ~LatencyHciHal() {
+    handler_.Clear();
+    handler_.WaitUntilStopped(std::chrono::milliseconds(1000));
+  }
+
+  void registerIncomingPacketCallback(hal::HciHalCallbacks* callback) override {
+    callbacks_ = callback;
+  }
+
+  void unregisterIncomingPacketCallback() override {
+    callbacks_ = nullptr;
+  }
+
+  void sendHciCommand(hal::HciPacket command) override {
+    auto op_code = static_cast<OpCode>(command[0] | (command[1] << 8));
+    auto deadline = std::chrono::steady_clock::now() + kCommandRoundTrip;
+    handler_.Post(common::BindOnce(&LatencyHciHal::respond, common::Unretained(this), op_code, deadline));
+  }
+
+  void sendAclData(hal::HciPacket /* data */) override {}
+
+  void sendScoData(hal::HciPacket /* data */) override {}
+
+  void sendIsoData(hal::HciPacket /* data */) override {}
+
+  std::string ToString() const override {
+    return std::string("LatencyHciHal");
+  }
+
+ protected:
+  void ListDependencies(ModuleList* /* list */) const override {}
+
+  void Start() override {}
+
+  void Stop() override {}
+
+ private:
+  void respond(OpCode op_code, std::chrono::steady_clock::time_point deadline) {
+    std::this_thread::sleep_until(deadline);
+    // Status byte only, enough for every Command Complete view to be valid
+    auto status = std::make_unique<packet::RawBuilder>(std::vector<uint8_t>{0x00});
+    auto event = GetPacketBytes(CommandCompleteBuilder::Create(kNumHciCommandPackets, op_code, std::move(status)));
+    if (callbacks_ != nullptr) {
+      callbacks_->hciEventReceived(std::move(event));
+    }
+  }
+
+  os::Thread thread_;
+  os::Handler handler_;
+  hal::HciHalCallbacks* callbacks_ = nullptr;
+};
+
+}  // namespace
+
+// Sends the burst of read commands issued by Controller::Start() with a varying number of commands
+// allowed in flight (the benchmark argument).
+class BM_HciLayerCommandPipelining : public ::benchmark::Fixture {
+ protected:
+  void SetUp(State& st) override {
+    ::benchmark::Fixture::SetUp(st);
+    os::SetSystemProperty("bluetooth.hci.max_outstanding_commands", std::to_string(st.range(0)));
+    hal_ = new LatencyHciHal();
+    registry_.InjectTestModule(&hal::HciHal::Factory, hal_);
+    registry_.Start<HciLayer>(&registry_.GetTestThread());
+    hci_ = static_cast<HciLayer*>(registry_.GetModuleUnderTest(&HciLayer::Factory));
+    handler_ = registry_.GetTestModuleHandler(&HciLayer::Factory);
+    // Let the initial reset complete
+    registry_.SynchronizeModuleHandler(&HciLayer::Factory, std::chrono::milliseconds(100));
+  }
+
+  void TearDown(State& st) override {
+    registry_.StopAll();
+    os::ClearSystemPropertiesForHost();
+    benchmark::Fixture::TearDown(st);
+  }
+
+  void SendControllerStartCommands() {
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    remaining_ = kNumCommands;
+    promise_ = &promise;
+    Enqueue(ReadLocalNameBuilder::Create());
+    Enqueue(ReadLocalVersionInformationBuilder::Create());
+    Enqueue(ReadLocalSupportedCommandsBuilder::Create());
+    Enqueue(ReadLocalSupportedFeaturesBuilder::Create());
+    Enqueue(ReadLocalExtendedFeaturesBuilder::Create(0x00));
+    Enqueue(ReadBufferSizeBuilder::Create());
+    Enqueue(ReadBdAddrBuilder::Create());
+    Enqueue(LeReadBufferSizeV1Builder::Create());
+    Enqueue(LeReadLocalSupportedFeaturesBuilder::Create());
+    Enqueue(LeReadSupportedStatesBuilder::Create());
+    Enqueue(LeReadFilterAcceptListSizeBuilder::Create());
+    Enqueue(LeReadResolvingListSizeBuilder::Create());
+    Enqueue(LeReadMaximumDataLengthBuilder::Create());
+    Enqueue(LeReadSuggestedDefaultDataLengthBuilder::Create());
+    Enqueue(LeReadMaximumAdvertisingDataLengthBuilder::Create());
+    Enqueue(LeReadNumberOfSupportedAdvertisingSetsBuilder::Create());
+    future.wait();
+  }
+
+  void Enqueue(std::unique_ptr<CommandBuilder> command) {
+    hci_->EnqueueCommand(std::move(command), handler_->BindOnceOn(this, &BM_HciLayerCommandPipelining::on_complete));
+  }
+
+  void on_complete(CommandCompleteView /* view */) {
+    if (--remaining_ == 0) {
+      promise_->set_value();
+    }
+  }
+
+  static constexpr size_t kNumCommands = 16;
+
+  TestModuleRegistry registry_;
+  LatencyHciHal* hal_ = nullptr;
+  HciLayer* hci_ = nullptr;
+  os::Handler* handler_ = nullptr;
+  size_t remaining_ = 0;
+  std::promise<void>* promise_ = nullptr;
+};
+
+BENCHMARK_DEFINE_F(BM_HciLayerCommandPipelining, controller_start_commands)(State& state) {
+  for (auto _ : state) {
+    SendControllerStartCommands();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumCommands);
+}
+
+BENCHMARK_REGISTER_F(BM_HciLayerCommandPipelining, controller_start_commands)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace hci
+}  // namespace bluetooth
@@ -31,6 +31,7 @@
 #include "module.h"
 #include "os/fake_timer/fake_timerfd.h"
 #include "os/handler.h"
+#include "os/system_properties.h"
 #include "os/thread.h"
 #include "packet/raw_builder.h"
 
@@ -278,6 +279,25 @@ TEST_F(HciLayerDeathTest, abort_on_second_register_le_event_handler) {
       "");
 }
 
+TEST_F(HciLayerTest, event_handler_can_be_registered_again_after_unregister) {
+  FailIfResetNotSent();
+  hci_->RegisterEventHandler(
+      EventCode::SIMPLE_PAIRING_COMPLETE, hci_handler_->Bind([](EventView /* view */) {
+        ADD_FAILURE() << "Unregistered handler was invoked";
+      }));
+  hci_->UnregisterEventHandler(EventCode::SIMPLE_PAIRING_COMPLETE);
+  sync_handler();
+
+  std::promise<void> promise;
+  auto future = promise.get_future();
+  hci_->RegisterEventHandler(
+      EventCode::SIMPLE_PAIRING_COMPLETE,
+      hci_handler_->Bind(
+          [](std::promise<void>* promise, EventView /* view */) { promise->set_value(); }, common::Unretained(&promise)));
+  hal_->InjectEvent(SimplePairingCompleteBuilder::Create(ErrorCode::SUCCESS, Address::kEmpty));
+  ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(1)));
+}
+
 TEST_F(HciLayerTest, our_acl_event_callback_is_invoked) {
   FailIfResetNotSent();
   hci_->GetAclConnectionInterface(
@@ -494,5 +514,141 @@ TEST_F(HciLayerTest, command_status_callback_is_invoked_with_failure_status) {
   sync_handler();
 }
 
+TEST_F(HciLayerTest, only_one_command_outstanding_by_default) {
+  FailIfResetNotSent();
+  hal_->InjectEvent(ResetCompleteBuilder::Create(4, ErrorCode::SUCCESS));
+  hci_->EnqueueCommand(
+      ReadLocalVersionInformationBuilder::Create(), hci_handler_->BindOnce([](CommandCompleteView /* view */) {}));
+  hci_->EnqueueCommand(ReadBufferSizeBuilder::Create(), hci_handler_->BindOnce([](CommandCompleteView /* view */) {}));
+  sync_handler();
+
+  auto sent_command = hal_->GetSentCommand();
+  ASSERT_TRUE(sent_command.has_value());
+  ASSERT_EQ(sent_command->GetOpCode(), OpCode::READ_LOCAL_VERSION_INFORMATION);
+  ASSERT_FALSE(hal_->GetSentCommand(std::chrono::milliseconds(100)).has_value());
+
+  hal_->InjectEvent(CommandCompleteBuilder::Create(
+      4, OpCode::READ_LOCAL_VERSION_INFORMATION, std::make_unique<packet::RawBuilder>()));
+  sent_command = hal_->GetSentCommand();
+  ASSERT_TRUE(sent_command.has_value());
+  ASSERT_EQ(sent_command->GetOpCode(), OpCode::READ_BUFFER_SIZE);
+}
+
+class HciLayerPipeliningTest : public HciLayerTest {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(os::SetSystemProperty("bluetooth.hci.max_outstanding_commands", "3"));
+    HciLayerTest::SetUp();
+    FailIfResetNotSent();
+    hal_->InjectEvent(ResetCompleteBuilder::Create(4, ErrorCode::SUCCESS));
+    sync_handler();
+  }
+
+  void TearDown() override {
+    HciLayerTest::TearDown();
+    os::ClearSystemPropertiesForHost();
+  }
+
+  void EnqueueCommand(std::unique_ptr<CommandBuilder> command) {
+    hci_->EnqueueCommand(std::move(command), hci_handler_->BindOnceOn(this, &HciLayerPipeliningTest::on_complete));
+  }
+
+  void InjectComplete(OpCode op_code) {
+    hal_->InjectEvent(CommandCompleteBuilder::Create(4, op_code, std::make_unique<packet::RawBuilder>()));
+    sync_handler();
+  }
+
+  void ExpectSent(OpCode op_code) {
+    auto sent_command = hal_->GetSentCommand();
+    ASSERT_TRUE(sent_command.has_value());
+    ASSERT_EQ(sent_command->GetOpCode(), op_code);
+  }
+
+  void ExpectNothingSent() {
+    ASSERT_FALSE(hal_->GetSentCommand(std::chrono::milliseconds(100)).has_value());
+  }
+
+  void on_complete(CommandCompleteView view) {
+    completed_.push_back(view.GetCommandOpCode());
+  }
+
+  std::vector<OpCode> completed_;
+};
+
+TEST_F(HciLayerPipeliningTest, read_commands_are_pipelined) {
+  EnqueueCommand(ReadLocalVersionInformationBuilder::Create());
+  EnqueueCommand(ReadLocalSupportedCommandsBuilder::Create());
+  EnqueueCommand(ReadBufferSizeBuilder::Create());
+  EnqueueCommand(ReadBdAddrBuilder::Create());
+  sync_handler();
+
+  ExpectSent(OpCode::READ_LOCAL_VERSION_INFORMATION);
+  ExpectSent(OpCode::READ_LOCAL_SUPPORTED_COMMANDS);
+  ExpectSent(OpCode::READ_BUFFER_SIZE);
+  // Limited by the maximum number of outstanding commands
+  ExpectNothingSent();
+
+  // Responses are matched by opcode, whatever order they come in
+  InjectComplete(OpCode::READ_BUFFER_SIZE);
+  ExpectSent(OpCode::READ_BD_ADDR);
+  InjectComplete(OpCode::READ_LOCAL_VERSION_INFORMATION);
+  InjectComplete(OpCode::READ_BD_ADDR);
+  InjectComplete(OpCode::READ_LOCAL_SUPPORTED_COMMANDS);
+
+  std::vector<OpCode> expected = {
+      OpCode::READ_BUFFER_SIZE,
+      OpCode::READ_LOCAL_VERSION_INFORMATION,
+      OpCode::READ_BD_ADDR,
+      OpCode::READ_LOCAL_SUPPORTED_COMMANDS};
+  ASSERT_EQ(completed_, expected);
+}
+
+TEST_F(HciLayerPipeliningTest, other_commands_are_serialized) {
+  EnqueueCommand(ReadLocalVersionInformationBuilder::Create());
+  EnqueueCommand(ReadBufferSizeBuilder::Create());
+  EnqueueCommand(ResetBuilder::Create());
+  EnqueueCommand(ReadBdAddrBuilder::Create());
+  sync_handler();
+
+  ExpectSent(OpCode::READ_LOCAL_VERSION_INFORMATION);
+  ExpectSent(OpCode::READ_BUFFER_SIZE);
+  // Reset waits until all previous commands completed
+  ExpectNothingSent();
+
+  InjectComplete(OpCode::READ_LOCAL_VERSION_INFORMATION);
+  ExpectNothingSent();
+  InjectComplete(OpCode::READ_BUFFER_SIZE);
+  ExpectSent(OpCode::RESET);
+  // Reads after reset wait for it to complete
+  ExpectNothingSent();
+
+  InjectComplete(OpCode::RESET);
+  ExpectSent(OpCode::READ_BD_ADDR);
+}
+
+TEST_F(HciLayerPipeliningTest, same_opcode_is_not_pipelined) {
+  EnqueueCommand(ReadLocalExtendedFeaturesBuilder::Create(0x00));
+  EnqueueCommand(ReadLocalExtendedFeaturesBuilder::Create(0x01));
+  sync_handler();
+
+  ExpectSent(OpCode::READ_LOCAL_EXTENDED_FEATURES);
+  ExpectNothingSent();
+  InjectComplete(OpCode::READ_LOCAL_EXTENDED_FEATURES);
+  ExpectSent(OpCode::READ_LOCAL_EXTENDED_FEATURES);
+}
+
+TEST_F(HciLayerPipeliningTest, pipelining_is_bounded_by_controller_credits) {
+  hal_->InjectEvent(CommandCompleteBuilder::Create(1, OpCode::NONE, std::make_unique<packet::RawBuilder>()));
+  sync_handler();
+  EnqueueCommand(ReadLocalVersionInformationBuilder::Create());
+  EnqueueCommand(ReadBufferSizeBuilder::Create());
+  sync_handler();
+
+  ExpectSent(OpCode::READ_LOCAL_VERSION_INFORMATION);
+  ExpectNothingSent();
+  InjectComplete(OpCode::READ_LOCAL_VERSION_INFORMATION);
+  ExpectSent(OpCode::READ_BUFFER_SIZE);
+}
+
 }  // namespace hci
 }  // namespace bluetooth
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "hci/address.h"
+#include "hci/hci_packets.h"
+#include "l2cap/l2cap_packets.h"
+#include "packet/raw_builder.h"
+
+using ::benchmark::State;
+using ::bluetooth::packet::PacketView;
+using ::bluetooth::packet::RawBuilder;
+
+namespace bluetooth {
+namespace hci {
+
+namespace {
+
+constexpr uint16_t kHandle = 0x0040;
+constexpr uint16_t kChannelId = 0x0040;
+
+std::unique_ptr<RawBuilder> MakePayload(size_t size) {
+  std::vector<uint8_t> payload(size);
+  for (size_t i = 0; i < size; i++) {
+    payload[i] = static_cast<uint8_t>(i);
+  }
+  return std::make_unique<RawBuilder>(std::move(payload));
+}
+
+std::unique_ptr<AclBuilder> MakeAcl(size_t l2cap_payload_size) {
+  return AclBuilder::Create(
+      kHandle,
+      PacketBoundaryFlag::FIRST_AUTOMATICALLY_FLUSHABLE,
+      BroadcastFlag::POINT_TO_POINT,
+      l2cap::BasicFrameBuilder::Create(kChannelId, MakePayload(l2cap_payload_size)));
+}
+
+std::unique_ptr<EventBuilder> MakeNumberOfCompletedPackets(size_t handles) {
+  std::vector<CompletedPackets> completed_packets(handles);
+  for (size_t i = 0; i < handles; i++) {
+    completed_packets[i].connection_handle_ = kHandle + i;
+    completed_packets[i].host_num_of_completed_packets_ = 1;
+  }
+  return NumberOfCompletedPacketsBuilder::Create(completed_packets);
+}
+
+std::unique_ptr<EventBuilder> MakeExtendedAdvertisingReport(size_t reports) {
+  std::vector<LeExtendedAdvertisingResponseRaw> responses(reports);
+  for (size_t i = 0; i < reports; i++) {
+    responses[i].address_type_ = DirectAdvertisingAddressType::RANDOM_DEVICE_ADDRESS;
+    responses[i].address_ = Address({static_cast<uint8_t>(i), 0x00, 0x00, 0x00, 0x00, 0xc0});
+    responses[i].advertising_sid_ = static_cast<uint8_t>(i % 16);
+    responses[i].rssi_ = -60;
+    // Fill the 255 byte event: subevent code, count, then 24 bytes of fixed fields per report
+    responses[i].advertising_data_ = std::vector<uint8_t>(253 / reports - 24, 0x42);
+  }
+  return LeExtendedAdvertisingReportRawBuilder::Create(responses);
+}
+
+template <typename T>
+PacketView<kLittleEndian> Serialize(std::unique_ptr<T> builder) {
+  return PacketView<kLittleEndian>(std::make_shared<std::vector<uint8_t>>(builder->SerializeToBytes()));
+}
+
+}  // namespace
+
+// Outbound ACL data, as done for each fragment sent to the controller
+static void BM_BuildAcl(State& state) {
+  for (auto _ : state) {
+    auto bytes = MakeAcl(state.range(0))->SerializeToBytes();
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * (state.range(0) + 8));
+}
+
+// Inbound ACL data, down to the L2CAP channel id used to route it
+static void BM_ParseAcl(State& state) {
+  auto packet = Serialize(MakeAcl(state.range(0)));
+  for (auto _ : state) {
+    auto acl = AclView::Create(packet);
+    if (!acl.IsValid()) {
+      state.SkipWithError("Invalid ACL packet");
+      break;
+    }
+    auto frame = l2cap::BasicFrameView::Create(acl.GetPayload());
+    if (!frame.IsValid()) {
+      state.SkipWithError("Invalid L2CAP frame");
+      break;
+    }
+    benchmark::DoNotOptimize(frame.GetChannelId());
+  }
+  state.SetBytesProcessed(state.iterations() * packet.size());
+}
+
+static void BM_BuildNumberOfCompletedPackets(State& state) {
+  for (auto _ : state) {
+    auto bytes = MakeNumberOfCompletedPackets(state.range(0))->SerializeToBytes();
+    benchmark::DoNotOptimize(bytes.data());
+  }
+}
+
+static void BM_ParseNumberOfCompletedPackets(State& state) {
+  auto packet = Serialize(MakeNumberOfCompletedPackets(state.range(0)));
+  for (auto _ : state) {
+    auto event = EventView::Create(packet);
+    auto complete_view = NumberOfCompletedPacketsView::Create(event);
+    if (!complete_view.IsValid()) {
+      state.SkipWithError("Invalid Number Of Completed Packets event");
+      break;
+    }
+    auto completed_packets = complete_view.GetCompletedPackets();
+    benchmark::DoNotOptimize(completed_packets.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ParseExtendedAdvertisingReport(State& state) {
+  auto packet = Serialize(MakeExtendedAdvertisingReport(state.range(0)));
+  for (auto _ : state) {
+    auto event = EventView::Create(packet);
+    auto meta_event = LeMetaEventView::Create(event);
+    auto report = LeExtendedAdvertisingReportRawView::Create(meta_event);
+    if (!report.IsValid()) {
+      state.SkipWithError("Invalid LE Extended Advertising Report event");
+      break;
+    }
+    auto responses = report.GetResponses();
+    benchmark::DoNotOptimize(responses.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Empty L2CAP signalling payload, typical LE ACL buffer and EDR ACL buffer
+BENCHMARK(BM_BuildAcl)->Arg(0)->Arg(247)->Arg(1017);
+BENCHMARK(BM_ParseAcl)->Arg(0)->Arg(247)->Arg(1017);
+// One link, and as many links as the stack supports
+BENCHMARK(BM_BuildNumberOfCompletedPackets)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(BM_ParseNumberOfCompletedPackets)->Arg(1)->Arg(4)->Arg(16);
+// A single report carrying a full fragment, and several short reports
+BENCHMARK(BM_ParseExtendedAdvertisingReport)->Arg(1)->Arg(4)->Arg(8);
+
+}  // namespace hci
+}  // namespace bluetooth
@@ -246,6 +246,10 @@ AddressWithType LeAddressManager::NewNonResolvableAddress() {
 }
 
 void LeAddressManager::pause_registered_clients() {
+  if (!pause_start_.has_value()) {
+    pause_start_ = std::chrono::steady_clock::now();
+    pause_window_commands_ = 0;
+  }
   for (auto& client : registered_clients_) {
     switch (client.second) {
       case ClientState::PAUSED:
@@ -262,7 +266,28 @@ void LeAddressManager::pause_registered_clients() {
 
 void LeAddressManager::push_command(Command command) {
   pause_registered_clients();
-  cached_commands_.push(std::move(command));
+  cached_commands_.push_back(std::move(command));
+}
+
+void LeAddressManager::push_resolving_list_commands(std::vector<Command> commands) {
+  // Address resolution is disabled while the resolving list changes. When the enable of a previous update is still
+  // queued, drop it instead of disabling again, so back to back updates share a single disable/enable pair.
+  if (!cached_commands_.empty() &&
+      cached_commands_.back().command_type == CommandType::SET_ADDRESS_RESOLUTION_ENABLE) {
+    cached_commands_.pop_back();
+  } else {
+    auto disable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::DISABLED);
+    Command disable = {CommandType::SET_ADDRESS_RESOLUTION_DISABLE, HCICommand{std::move(disable_builder)}};
+    cached_commands_.push_back(std::move(disable));
+  }
+
+  for (auto& command : commands) {
+    cached_commands_.push_back(std::move(command));
+  }
+
+  auto enable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::ENABLED);
+  Command enable = {CommandType::SET_ADDRESS_RESOLUTION_ENABLE, HCICommand{std::move(enable_builder)}};
+  cached_commands_.push_back(std::move(enable));
 }
 
 void LeAddressManager::ack_pause(LeAddressManagerCallback* callback) {
@@ -303,7 +328,17 @@ void LeAddressManager::resume_registered_clients() {
     return;
   }
 
-  LOG_INFO("Resuming registered clients");
+  if (pause_start_.has_value()) {
+    auto pause_duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - pause_start_.value());
+    LOG_INFO(
+        "Resuming registered clients after %lld ms paused for %zu commands",
+        static_cast<long long>(pause_duration.count()),
+        pause_window_commands_);
+    pause_start_.reset();
+  } else {
+    LOG_INFO("Resuming registered clients");
+  }
   for (auto& client : registered_clients_) {
     client.second = ClientState::WAITING_FOR_RESUME;
     client.first->OnResume();
@@ -318,7 +353,7 @@ void LeAddressManager::ack_resume(LeAddressManagerCallback* callback) {
 
 void LeAddressManager::prepare_to_rotate() {
   Command command = {CommandType::ROTATE_RANDOM_ADDRESS, RotateRandomAddressCommand{}};
-  cached_commands_.push(std::move(command));
+  cached_commands_.push_back(std::move(command));
   pause_registered_clients();
 }
 
@@ -359,7 +394,7 @@ void LeAddressManager::rotate_random_address() {
 
 void LeAddressManager::prepare_to_update_irk(UpdateIRKCommand update_irk_command) {
   Command command = {CommandType::UPDATE_IRK, update_irk_command};
-  cached_commands_.push(std::move(command));
+  cached_commands_.push_back(std::move(command));
   if (registered_clients_.empty()) {
     handle_next_command();
   } else {
@@ -460,7 +495,8 @@ void LeAddressManager::handle_next_command() {
 
   ASSERT(!cached_commands_.empty());
   auto command = std::move(cached_commands_.front());
-  cached_commands_.pop();
+  cached_commands_.pop_front();
+  pause_window_commands_++;
 
   std::visit(
       [this](auto&& command) {
@@ -494,27 +530,18 @@ void LeAddressManager::AddDeviceToResolvingList(
     return;
   }
 
-  // Disable Address resolution
-  auto disable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::DISABLED);
-  Command disable = {CommandType::SET_ADDRESS_RESOLUTION_ENABLE, HCICommand{std::move(disable_builder)}};
-  cached_commands_.push(std::move(disable));
-
+  std::vector<Command> commands;
   auto packet_builder = hci::LeAddDeviceToResolvingListBuilder::Create(
       peer_identity_address_type, peer_identity_address, peer_irk, local_irk);
-  Command command = {CommandType::ADD_DEVICE_TO_RESOLVING_LIST, HCICommand{std::move(packet_builder)}};
-  cached_commands_.push(std::move(command));
+  commands.push_back({CommandType::ADD_DEVICE_TO_RESOLVING_LIST, HCICommand{std::move(packet_builder)}});
 
   if (supports_ble_privacy_) {
     auto packet_builder =
         hci::LeSetPrivacyModeBuilder::Create(peer_identity_address_type, peer_identity_address, PrivacyMode::DEVICE);
-    Command command = {CommandType::LE_SET_PRIVACY_MODE, HCICommand{std::move(packet_builder)}};
-    cached_commands_.push(std::move(command));
+    commands.push_back({CommandType::LE_SET_PRIVACY_MODE, HCICommand{std::move(packet_builder)}});
   }
 
-  // Enable Address resolution
-  auto enable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::ENABLED);
-  Command enable = {CommandType::SET_ADDRESS_RESOLUTION_ENABLE, HCICommand{std::move(enable_builder)}};
-  cached_commands_.push(std::move(enable));
+  handler_->BindOnceOn(this, &LeAddressManager::push_resolving_list_commands, std::move(commands)).Invoke();
 
   if (registered_clients_.empty()) {
     handler_->BindOnceOn(this, &LeAddressManager::handle_next_command).Invoke();
@@ -536,20 +563,12 @@ void LeAddressManager::RemoveDeviceFromResolvingList(
     return;
   }
 
-  // Disable Address resolution
-  auto disable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::DISABLED);
-  Command disable = {CommandType::SET_ADDRESS_RESOLUTION_ENABLE, HCICommand{std::move(disable_builder)}};
-  cached_commands_.push(std::move(disable));
-
+  std::vector<Command> commands;
   auto packet_builder =
       hci::LeRemoveDeviceFromResolvingListBuilder::Create(peer_identity_address_type, peer_identity_address);
-  Command command = {CommandType::REMOVE_DEVICE_FROM_RESOLVING_LIST, HCICommand{std::move(packet_builder)}};
-  cached_commands_.push(std::move(command));
+  commands.push_back({CommandType::REMOVE_DEVICE_FROM_RESOLVING_LIST, HCICommand{std::move(packet_builder)}});
 
-  // Enable Address resolution
-  auto enable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::ENABLED);
-  Command enable = {CommandType::SET_ADDRESS_RESOLUTION_ENABLE, HCICommand{std::move(enable_builder)}};
-  cached_commands_.push(std::move(enable));
+  handler_->BindOnceOn(this, &LeAddressManager::push_resolving_list_commands, std::move(commands)).Invoke();
 
   if (registered_clients_.empty()) {
     handler_->BindOnceOn(this, &LeAddressManager::handle_next_command).Invoke();
@@ -569,20 +588,11 @@ void LeAddressManager::ClearResolvingList() {
     return;
   }
 
-  // Disable Address resolution
-  auto disable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::DISABLED);
-  Command disable = {CommandType::SET_ADDRESS_RESOLUTION_ENABLE, HCICommand{std::move(disable_builder)}};
-  cached_commands_.push(std::move(disable));
-
+  std::vector<Command> commands;
   auto packet_builder = hci::LeClearResolvingListBuilder::Create();
-  Command command = {CommandType::CLEAR_RESOLVING_LIST, HCICommand{std::move(packet_builder)}};
-  cached_commands_.push(std::move(command));
-
-  // Enable Address resolution
-  auto enable_builder = hci::LeSetAddressResolutionEnableBuilder::Create(hci::Enable::ENABLED);
-  Command enable = {CommandType::SET_ADDRESS_RESOLUTION_ENABLE, HCICommand{std::move(enable_builder)}};
-  cached_commands_.push(std::move(enable));
+  commands.push_back({CommandType::CLEAR_RESOLVING_LIST, HCICommand{std::move(packet_builder)}});
 
+  handler_->BindOnceOn(this, &LeAddressManager::push_resolving_list_commands, std::move(commands)).Invoke();
   handler_->BindOnceOn(this, &LeAddressManager::pause_registered_clients).Invoke();
 }
 
@@ -15,8 +15,12 @@
  */
 #pragma once
 
+#include <chrono>
+#include <deque>
 #include <map>
+#include <optional>
 #include <variant>
+#include <vector>
 
 #include "common/callback.h"
 #include "hci/address_with_type.h"
@@ -124,6 +128,7 @@ class LeAddressManager {
     REMOVE_DEVICE_FROM_RESOLVING_LIST,
     CLEAR_RESOLVING_LIST,
     SET_ADDRESS_RESOLUTION_ENABLE,
+    SET_ADDRESS_RESOLUTION_DISABLE,
     LE_SET_PRIVACY_MODE,
     UPDATE_IRK,
   };
@@ -141,12 +146,14 @@ class LeAddressManager {
   };
 
   struct Command {
-    CommandType command_type;  // Note that this field is only intended for logging, not control flow
+    // Note that this field is only intended for logging, and to coalesce address resolution toggles
+    CommandType command_type;
     std::variant<RotateRandomAddressCommand, UpdateIRKCommand, HCICommand> contents;
   };
 
   void pause_registered_clients();
   void push_command(Command command);
+  void push_resolving_list_commands(std::vector<Command> commands);
   void ack_pause(LeAddressManagerCallback* callback);
   void resume_registered_clients();
   void ack_resume(LeAddressManagerCallback* callback);
@@ -176,8 +183,11 @@ class LeAddressManager {
   Octet16 rotation_irk_;
   uint8_t accept_list_size_;
   uint8_t resolving_list_size_;
-  std::queue<Command> cached_commands_;
+  std::deque<Command> cached_commands_;
   bool supports_ble_privacy_{false};
+  // Start of the current window with the clients paused, and the number of commands sent during it
+  std::optional<std::chrono::steady_clock::time_point> pause_start_;
+  size_t pause_window_commands_{0};
 };
 
 }  // namespace hci
@@ -17,9 +17,11 @@
 
 #include <android_bluetooth_flags.h>
 
+#include <chrono>
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 #include "common/init_flags.h"
 #include "common/strings.h"
@@ -48,6 +50,10 @@ constexpr int64_t kLeAdvertisingTxPowerMax = 20;
 constexpr int64_t kLeTxPathLossCompMin = -128;
 constexpr int64_t kLeTxPathLossCompMax = 127;
 
+// Payload updates of an advertising set that arrive within this interval of
+// the previous write are coalesced, and only the latest one is written.
+constexpr std::chrono::milliseconds kDataUpdateCoalescingInterval(200);
+
 // system properties
 const std::string kLeTxPathLossCompProperty = "bluetooth.hardware.radio.le_tx_path_loss_comp_db";
 
@@ -83,6 +89,12 @@ struct Advertiser {
   bool directed = false;
   bool in_use = false;
   std::unique_ptr<os::Alarm> address_rotation_alarm;
+  // Coalescing of payload updates. While a payload was written within the
+  // coalescing interval, the latest update received since then is kept in
+  // pending_data. Index 0 is the advertising data, index 1 the scan response.
+  std::unique_ptr<os::Alarm> data_update_alarm[2];
+  bool data_update_coalescing[2] = {false, false};
+  std::optional<std::vector<GapData>> pending_data[2];
 };
 
 /**
@@ -393,6 +405,11 @@ struct LeAdvertisingManager::impl : public bluetooth::hci::LeAddressManagerCallb
         advertising_sets_[advertiser_id].address_rotation_alarm.reset();
       }
     }
+    for (auto& alarm : advertising_sets_[advertiser_id].data_update_alarm) {
+      if (alarm != nullptr) {
+        alarm->Cancel();
+      }
+    }
     advertising_sets_.erase(advertiser_id);
     if (advertising_sets_.empty() && address_manager_registered) {
       le_address_manager_->Unregister(this);
@@ -1123,6 +1140,63 @@ struct LeAdvertisingManager::impl : public bluetooth::hci::LeAddressManagerCallb
     }
   }
 
+  // Writes the payload right away, unless one was written within the coalescing interval. In that
+  // case it replaces any update still waiting, and is written when the interval ends.
+  void update_data(AdvertiserId advertiser_id, bool set_scan_rsp, std::vector<GapData> data) {
+    if (advertising_sets_.count(advertiser_id) == 0) {
+      set_data(advertiser_id, set_scan_rsp, data);
+      return;
+    }
+
+    auto& advertiser = advertising_sets_[advertiser_id];
+    auto& alarm = advertiser.data_update_alarm[set_scan_rsp];
+    auto& pending = advertiser.pending_data[set_scan_rsp];
+    if (advertiser.data_update_coalescing[set_scan_rsp]) {
+      if (pending.has_value() && advertising_callbacks_ != nullptr) {
+        // the superseded update will never be written, report it as done
+        if (set_scan_rsp) {
+          advertising_callbacks_->OnScanResponseDataSet(
+              advertiser_id, AdvertisingCallback::AdvertisingStatus::SUCCESS);
+        } else {
+          advertising_callbacks_->OnAdvertisingDataSet(
+              advertiser_id, AdvertisingCallback::AdvertisingStatus::SUCCESS);
+        }
+      }
+      pending = std::move(data);
+      return;
+    }
+
+    set_data(advertiser_id, set_scan_rsp, data);
+    if (alarm == nullptr) {
+      alarm = std::make_unique<os::Alarm>(module_handler_);
+    }
+    advertiser.data_update_coalescing[set_scan_rsp] = true;
+    alarm->Schedule(
+        common::BindOnce(
+            &impl::on_data_update_interval_end, common::Unretained(this), advertiser_id, set_scan_rsp),
+        kDataUpdateCoalescingInterval);
+  }
+
+  void on_data_update_interval_end(AdvertiserId advertiser_id, bool set_scan_rsp) {
+    if (advertising_sets_.count(advertiser_id) == 0) {
+      return;
+    }
+
+    auto& advertiser = advertising_sets_[advertiser_id];
+    if (!advertiser.pending_data[set_scan_rsp].has_value()) {
+      advertiser.data_update_coalescing[set_scan_rsp] = false;
+      return;
+    }
+
+    std::vector<GapData> data = std::move(*advertiser.pending_data[set_scan_rsp]);
+    advertiser.pending_data[set_scan_rsp].reset();
+    set_data(advertiser_id, set_scan_rsp, data);
+    advertiser.data_update_alarm[set_scan_rsp]->Schedule(
+        common::BindOnce(
+            &impl::on_data_update_interval_end, common::Unretained(this), advertiser_id, set_scan_rsp),
+        kDataUpdateCoalescingInterval);
+  }
+
   void send_data_fragment(
       AdvertiserId advertiser_id, bool set_scan_rsp, std::vector<GapData> data, Operation operation) {
     if (IS_FLAG_ENABLED(divide_long_single_gap_data)) {
@@ -1972,7 +2046,7 @@ void LeAdvertisingManager::SetParameters(AdvertiserId advertiser_id, Advertising
 }
 
 void LeAdvertisingManager::SetData(AdvertiserId advertiser_id, bool set_scan_rsp, std::vector<GapData> data) {
-  CallOn(pimpl_.get(), &impl::set_data, advertiser_id, set_scan_rsp, data);
+  CallOn(pimpl_.get(), &impl::update_data, advertiser_id, set_scan_rsp, data);
 }
 
 void LeAdvertisingManager::EnableAdvertiser(
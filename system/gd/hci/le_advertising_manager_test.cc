@@ -1219,6 +1219,44 @@ TEST_F(LeExtendedAdvertisingAPITest, set_data_with_invalid_length) {
   sync_client_handler();
 }
 
+TEST_F(LeExtendedAdvertisingAPITest, set_data_coalesces_rapid_updates) {
+  std::vector<GapData> advertising_data{};
+  GapData data_item{};
+  data_item.data_type_ = GapDataType::COMPLETE_LOCAL_NAME;
+  data_item.data_ = {'a'};
+  advertising_data.push_back(data_item);
+
+  // The first update is written right away
+  le_advertising_manager_->SetData(advertiser_id_, false, advertising_data);
+  ASSERT_EQ(OpCode::LE_SET_EXTENDED_ADVERTISING_DATA, test_hci_layer_->GetCommand().GetOpCode());
+  EXPECT_CALL(
+      mock_advertising_callback_,
+      OnAdvertisingDataSet(advertiser_id_, AdvertisingCallback::AdvertisingStatus::SUCCESS))
+      .Times(3);
+  test_hci_layer_->IncomingEvent(
+      LeSetExtendedAdvertisingDataCompleteBuilder::Create(uint8_t{1}, ErrorCode::SUCCESS));
+
+  // Updates within the coalescing interval replace each other
+  advertising_data[0].data_ = {'b'};
+  le_advertising_manager_->SetData(advertiser_id_, false, advertising_data);
+  advertising_data[0].data_ = {'c'};
+  le_advertising_manager_->SetData(advertiser_id_, false, advertising_data);
+
+  // and only the latest one is written once the interval ends
+  auto command = test_hci_layer_->GetCommand();
+  ASSERT_EQ(OpCode::LE_SET_EXTENDED_ADVERTISING_DATA, command.GetOpCode());
+  auto data_command_view =
+      LeSetExtendedAdvertisingDataView::Create(LeAdvertisingCommandView::Create(command));
+  ASSERT_TRUE(data_command_view.IsValid());
+  auto written_data = data_command_view.GetAdvertisingData();
+  ASSERT_FALSE(written_data.empty());
+  ASSERT_EQ(std::vector<uint8_t>{'c'}, written_data.back().data_);
+  test_hci_layer_->IncomingEvent(
+      LeSetExtendedAdvertisingDataCompleteBuilder::Create(uint8_t{1}, ErrorCode::SUCCESS));
+
+  sync_client_handler();
+}
+
 TEST_F_WITH_FLAGS(
     LeExtendedAdvertisingAPITest,
     set_data_valid_max_251_ad_data_length_test,
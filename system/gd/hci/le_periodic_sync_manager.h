@@ -17,8 +17,11 @@
 
 #include <android_bluetooth_flags.h>
 
+#include <algorithm>
 #include <chrono>
+#include <list>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include "common/callback.h"
@@ -39,6 +42,9 @@ namespace hci {
 
 constexpr std::chrono::duration kPeriodicSyncTimeout = std::chrono::seconds(30);
 constexpr int kMaxSyncTransactions = 16;
+// Syncs requested, queued or established. Create sync requests are sent one at a time, the controller reports its own
+// limit on established syncs through the sync established status.
+constexpr int kMaxPeriodicSyncs = 64;
 
 enum PeriodicSyncState : int {
   PERIODIC_SYNC_STATE_IDLE = 0,
@@ -78,6 +84,14 @@ struct PendingPeriodicSyncRequest {
   uint16_t skip;
   uint16_t sync_timeout;
   os::Alarm sync_timeout_alarm;
+  std::chrono::steady_clock::time_point sent_time;
+};
+
+struct PeriodicSyncStatistics {
+  uint64_t syncs_established = 0;
+  uint64_t syncs_failed = 0;
+  std::chrono::milliseconds total_time_to_sync{0};
+  std::chrono::milliseconds max_time_to_sync{0};
 };
 
 class PeriodicSyncManager {
@@ -95,7 +109,7 @@ class PeriodicSyncManager {
   }
 
   void StartSync(const PeriodicSyncStates& request, uint16_t skip, uint16_t sync_timeout) {
-    if (periodic_syncs_.size() >= kMaxSyncTransactions) {
+    if (periodic_syncs_.size() >= kMaxPeriodicSyncs) {
       int status = static_cast<int>(ErrorCode::CONNECTION_REJECTED_LIMITED_RESOURCES);
       callbacks_->OnPeriodicSyncStarted(
           request.request_id, status, 0, request.advertiser_sid, request.address_with_type, 0, 0);
@@ -125,7 +139,7 @@ class PeriodicSyncManager {
           handler_->BindOnce(check_complete<LePeriodicAdvertisingTerminateSyncCompleteView>));
       return;
     };
-    periodic_syncs_.erase(periodic_sync);
+    RemoveSyncRequest(periodic_sync);
     le_scanning_interface_->EnqueueCommand(
         hci::LePeriodicAdvertisingTerminateSyncBuilder::Create(handle),
         handler_->BindOnce(check_complete<LePeriodicAdvertisingTerminateSyncCompleteView>));
@@ -148,7 +162,7 @@ class PeriodicSyncManager {
       LOG_DEBUG("[PSync]: Removing Sync request from queue");
       CleanUpRequest(adv_sid, address);
     }
-    periodic_syncs_.erase(periodic_sync);
+    RemoveSyncRequest(periodic_sync);
   }
 
   void TransferSync(
@@ -256,6 +270,9 @@ class PeriodicSyncManager {
         GetPendingSyncFromAddressAndSid(event_view.GetAdvertiserAddress(), event_view.GetAdvertisingSid());
     if (pending_sync_request != pending_sync_requests_.end()) {
       pending_sync_request->sync_timeout_alarm.Cancel();
+      if (pending_sync_request->busy) {
+        UpdateStatistics(event_view.GetStatus(), pending_sync_request->sent_time);
+      }
     }
 
     auto address_with_type = AddressWithType(event_view.GetAdvertiserAddress(), event_view.GetAdvertiserAddressType());
@@ -287,6 +304,7 @@ class PeriodicSyncManager {
     }
     periodic_sync->sync_handle = event_view.GetSyncHandle();
     periodic_sync->sync_state = PERIODIC_SYNC_STATE_ESTABLISHED;
+    established_syncs_[periodic_sync->sync_handle] = periodic_sync;
     callbacks_->OnPeriodicSyncStarted(
         periodic_sync->request_id,
         (uint8_t)event_view.GetStatus(),
@@ -345,7 +363,7 @@ class PeriodicSyncManager {
       LOG_ERROR("[PSync]: index not found for handle %u", sync_handle);
       return;
     }
-    periodic_syncs_.erase(periodic_sync);
+    RemoveSyncRequest(periodic_sync);
   }
 
   void HandleLePeriodicAdvertisingSyncTransferReceived(LePeriodicAdvertisingSyncTransferReceivedView event_view) {
@@ -420,14 +438,18 @@ class PeriodicSyncManager {
     callbacks_->OnBigInfoReport(sync_handle, event_view.GetEncryption() == Enable::ENABLED ? true : false);
   }
 
+  const PeriodicSyncStatistics& GetStatistics() const {
+    return statistics_;
+  }
+
  private:
+  // Called for every periodic advertising report, hence indexed by handle
   std::list<PeriodicSyncStates>::iterator GetEstablishedSyncFromHandle(uint16_t handle) {
-    for (auto it = periodic_syncs_.begin(); it != periodic_syncs_.end(); it++) {
-      if (it->sync_handle == handle && it->sync_state == PeriodicSyncState::PERIODIC_SYNC_STATE_ESTABLISHED) {
-        return it;
-      }
+    auto it = established_syncs_.find(handle);
+    if (it == established_syncs_.end()) {
+      return periodic_syncs_.end();
     }
-    return periodic_syncs_.end();
+    return it->second;
   }
 
   std::list<PeriodicSyncStates>::iterator GetSyncFromAddressWithTypeAndSid(
@@ -460,9 +482,31 @@ class PeriodicSyncManager {
   }
 
   void RemoveSyncRequest(std::list<PeriodicSyncStates>::iterator it) {
+    if (it->sync_state == PERIODIC_SYNC_STATE_ESTABLISHED) {
+      auto established_sync = established_syncs_.find(it->sync_handle);
+      if (established_sync != established_syncs_.end() && established_sync->second == it) {
+        established_syncs_.erase(established_sync);
+      }
+    }
     periodic_syncs_.erase(it);
   }
 
+  void UpdateStatistics(ErrorCode status, std::chrono::steady_clock::time_point sent_time) {
+    if (status != ErrorCode::SUCCESS) {
+      statistics_.syncs_failed++;
+      return;
+    }
+    auto time_to_sync =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sent_time);
+    statistics_.syncs_established++;
+    statistics_.total_time_to_sync += time_to_sync;
+    statistics_.max_time_to_sync = std::max(statistics_.max_time_to_sync, time_to_sync);
+    LOG_INFO(
+        "[PSync]: synced in %lld ms, average %lld ms",
+        static_cast<long long>(time_to_sync.count()),
+        static_cast<long long>(statistics_.total_time_to_sync.count() / statistics_.syncs_established));
+  }
+
   std::list<PeriodicSyncTransferStates>::iterator GetSyncTransferRequestFromConnectionHandle(
       uint16_t connection_handle) {
     for (auto it = periodic_sync_transfers_.begin(); it != periodic_sync_transfers_.end(); it++) {
@@ -506,6 +550,7 @@ class PeriodicSyncManager {
       return;
     }
     request.busy = true;
+    request.sent_time = std::chrono::steady_clock::now();
     request.sync_timeout_alarm.Cancel();
     HandleStartSyncRequest(request.advertiser_sid, request.address_with_type, request.skip, request.sync_timeout);
     request.sync_timeout_alarm.Schedule(
@@ -544,7 +589,9 @@ class PeriodicSyncManager {
   ScanningCallback* callbacks_;
   std::list<PendingPeriodicSyncRequest> pending_sync_requests_;
   std::list<PeriodicSyncStates> periodic_syncs_;
+  std::unordered_map<uint16_t, std::list<PeriodicSyncStates>::iterator> established_syncs_;
   std::list<PeriodicSyncTransferStates> periodic_sync_transfers_;
+  PeriodicSyncStatistics statistics_;
   LeScanningReassembler scanning_reassembler_;
   bool sync_received_callback_registered_ = false;
   int sync_received_callback_id{};
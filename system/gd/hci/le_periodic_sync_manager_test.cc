@@ -286,6 +286,8 @@ TEST_F(PeriodicSyncManagerTest, handle_advertising_sync_established_test) {
   auto event_view = LePeriodicAdvertisingSyncEstablishedView::Create(
       LeMetaEventView::Create(EventView::Create(GetPacketView(std::move(builder)))));
   periodic_sync_manager_->HandleLePeriodicAdvertisingSyncEstablished(event_view);
+  ASSERT_EQ(1u, periodic_sync_manager_->GetStatistics().syncs_established);
+  ASSERT_EQ(0u, periodic_sync_manager_->GetStatistics().syncs_failed);
   sync_handler();
 }
 
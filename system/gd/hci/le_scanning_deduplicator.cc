@@ -0,0 +1,123 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hci/le_scanning_deduplicator.h"
+
+#include <cstdlib>
+#include <functional>
+
+#include "os/log.h"
+
+namespace bluetooth::hci {
+
+namespace {
+
+/// FNV-1a, cheap enough to run on every complete report.
+uint64_t HashAdvertisingData(const std::vector<uint8_t>& data) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (uint8_t byte : data) {
+    hash = (hash ^ byte) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+}  // namespace
+
+void LeScanningDeduplicator::SetConfig(const AdvertisingReportDedupConfig& config) {
+  if (config == config_) {
+    return;
+  }
+  LOG_INFO(
+      "Advertising report deduplication window %d ms rssi threshold %d dB",
+      static_cast<int>(config.window.count()),
+      config.rssi_threshold);
+  config_ = config;
+  cache_.clear();
+}
+
+bool LeScanningDeduplicator::ProcessAdvertisingReport(
+    uint16_t event_type,
+    uint8_t address_type,
+    Address address,
+    uint8_t advertising_sid,
+    int8_t rssi,
+    const std::vector<uint8_t>& advertising_data,
+    std::chrono::steady_clock::time_point now) {
+  if (!IsEnabled()) {
+    return true;
+  }
+
+  ReportKey key{
+      .address = address,
+      .address_type = address_type,
+      .advertising_sid = advertising_sid,
+      .event_type = event_type,
+      .data_size = advertising_data.size(),
+      .data_hash = HashAdvertisingData(advertising_data)};
+
+  auto it = cache_.find(key);
+  if (it != cache_.end()) {
+    LastReport& last_report = it->second;
+    bool expired = now - last_report.time >= config_.window;
+    bool rssi_changed = config_.rssi_threshold != 0 &&
+                        std::abs(rssi - last_report.rssi) >= config_.rssi_threshold;
+    if (!expired && !rssi_changed) {
+      return false;
+    }
+    last_report = {.time = now, .rssi = rssi};
+    return true;
+  }
+
+  if (cache_.size() >= kMaximumCacheSize) {
+    MakeRoom(now);
+  }
+  cache_.emplace(key, LastReport{.time = now, .rssi = rssi});
+  return true;
+}
+
+void LeScanningDeduplicator::MakeRoom(std::chrono::steady_clock::time_point now) {
+  for (auto it = cache_.begin(); it != cache_.end();) {
+    if (now - it->second.time >= config_.window) {
+      it = cache_.erase(it);
+    } else {
+      it++;
+    }
+  }
+  if (cache_.size() < kMaximumCacheSize) {
+    return;
+  }
+  auto oldest = cache_.begin();
+  for (auto it = cache_.begin(); it != cache_.end(); it++) {
+    if (it->second.time < oldest->second.time) {
+      oldest = it;
+    }
+  }
+  cache_.erase(oldest);
+}
+
+bool LeScanningDeduplicator::ReportKey::operator==(const ReportKey& other) const {
+  return address == other.address && address_type == other.address_type &&
+         advertising_sid == other.advertising_sid && event_type == other.event_type &&
+         data_size == other.data_size && data_hash == other.data_hash;
+}
+
+size_t LeScanningDeduplicator::ReportKeyHash::operator()(const ReportKey& key) const {
+  size_t hash = std::hash<Address>{}(key.address);
+  hash ^= (static_cast<size_t>(key.address_type) << 8) | key.advertising_sid;
+  hash ^= static_cast<size_t>(key.event_type) << 16;
+  return hash ^ static_cast<size_t>(key.data_hash);
+}
+
+}  // namespace bluetooth::hci
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "hci/address.h"
+
+namespace bluetooth::hci {
+
+/// Deduplication settings of a scanner.
+struct AdvertisingReportDedupConfig {
+  /// An advertiser repeating the same payload is reported at most once per
+  /// window. Zero disables deduplication.
+  std::chrono::milliseconds window{0};
+  /// A repeated payload is still reported when its RSSI moved by at least
+  /// this many dB since it was last reported. Zero ignores RSSI changes.
+  uint8_t rssi_threshold{0};
+
+  bool operator==(const AdvertisingReportDedupConfig& other) const {
+    return window == other.window && rssi_threshold == other.rssi_threshold;
+  }
+  bool operator!=(const AdvertisingReportDedupConfig& other) const {
+    return !(*this == other);
+  }
+};
+
+/// The LE Scanning deduplicator drops complete advertising reports that
+/// repeat a report of the same advertiser, with the same payload, that was
+/// forwarded within the configured window, unless the RSSI changed
+/// significantly.
+
+class LeScanningDeduplicator {
+ public:
+  LeScanningDeduplicator() = default;
+
+  LeScanningDeduplicator(const LeScanningDeduplicator&) = delete;
+
+  LeScanningDeduplicator& operator=(const LeScanningDeduplicator&) = delete;
+
+  /// Replace the configuration. The reports seen so far are forgotten when
+  /// the configuration changes.
+  void SetConfig(const AdvertisingReportDedupConfig& config);
+
+  bool IsEnabled() const {
+    return config_.window.count() > 0;
+  }
+
+  /// Process a complete advertising report.
+  /// Returns true if the report must be forwarded, false if it is a
+  /// duplicate.
+  bool ProcessAdvertisingReport(
+      uint16_t event_type,
+      uint8_t address_type,
+      Address address,
+      uint8_t advertising_sid,
+      int8_t rssi,
+      const std::vector<uint8_t>& advertising_data,
+      std::chrono::steady_clock::time_point now);
+
+  /// Forget the reports seen so far, the next report of every advertiser
+  /// is forwarded.
+  void Clear() {
+    cache_.clear();
+  }
+
+ private:
+  /// Advertisers remembered at most. When full, the expired entries are
+  /// dropped first, then the least recently reported advertiser.
+  static constexpr size_t kMaximumCacheSize = 512;
+
+  struct ReportKey {
+    Address address;
+    uint8_t address_type;
+    uint8_t advertising_sid;
+    uint16_t event_type;
+    size_t data_size;
+    uint64_t data_hash;
+
+    bool operator==(const ReportKey& other) const;
+  };
+
+  struct ReportKeyHash {
+    size_t operator()(const ReportKey& key) const;
+  };
+
+  struct LastReport {
+    std::chrono::steady_clock::time_point time;
+    int8_t rssi;
+  };
+
+  void MakeRoom(std::chrono::steady_clock::time_point now);
+
+  AdvertisingReportDedupConfig config_;
+  std::unordered_map<ReportKey, LastReport, ReportKeyHash> cache_;
+};
+
+}  // namespace bluetooth::hci
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hci/le_scanning_deduplicator.h"
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace bluetooth::hci {
+
+// Event type fields.
+static constexpr uint16_t kConnectable = 0x1;
+static constexpr uint16_t kLegacy = 0x10;
+
+static constexpr uint8_t kPublicAddress = 0x0;
+static constexpr uint8_t kSidNotPresent = 0xff;
+
+// Test addresses.
+static const Address kTestAddress1 = Address({0, 1, 2, 3, 4, 5});
+static const Address kTestAddress2 = Address({0, 1, 2, 3, 4, 6});
+
+class LeScanningDeduplicatorTest : public ::testing::Test {
+ protected:
+  bool Process(
+      Address address,
+      int8_t rssi,
+      const std::vector<uint8_t>& data,
+      std::chrono::milliseconds elapsed,
+      uint8_t sid = kSidNotPresent) {
+    return deduplicator_.ProcessAdvertisingReport(
+        kLegacy | kConnectable, kPublicAddress, address, sid, rssi, data, start_ + elapsed);
+  }
+
+  LeScanningDeduplicator deduplicator_;
+  std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+};
+
+TEST_F(LeScanningDeduplicatorTest, disabled_by_default) {
+  ASSERT_FALSE(deduplicator_.IsEnabled());
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+}
+
+TEST_F(LeScanningDeduplicatorTest, drop_repeated_reports_within_window) {
+  deduplicator_.SetConfig({.window = 1000ms});
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+  ASSERT_FALSE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 100ms));
+  ASSERT_FALSE(Process(kTestAddress1, -70, {0x2, 0x1, 0x6}, 999ms));
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 1000ms));
+  ASSERT_FALSE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 1500ms));
+}
+
+TEST_F(LeScanningDeduplicatorTest, forward_different_advertisers_and_payloads) {
+  deduplicator_.SetConfig({.window = 1000ms});
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+  ASSERT_TRUE(Process(kTestAddress2, -50, {0x2, 0x1, 0x6}, 0ms));
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms, 0x1));
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x4}, 0ms));
+  ASSERT_FALSE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+}
+
+TEST_F(LeScanningDeduplicatorTest, forward_rssi_changes) {
+  deduplicator_.SetConfig({.window = 1000ms, .rssi_threshold = 10});
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+  ASSERT_FALSE(Process(kTestAddress1, -59, {0x2, 0x1, 0x6}, 100ms));
+  ASSERT_TRUE(Process(kTestAddress1, -60, {0x2, 0x1, 0x6}, 200ms));
+  // The RSSI is compared with the last forwarded report.
+  ASSERT_FALSE(Process(kTestAddress1, -51, {0x2, 0x1, 0x6}, 300ms));
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 400ms));
+}
+
+TEST_F(LeScanningDeduplicatorTest, config_change_forgets_reports) {
+  deduplicator_.SetConfig({.window = 1000ms});
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+  deduplicator_.SetConfig({.window = 1000ms});
+  ASSERT_FALSE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+  deduplicator_.SetConfig({.window = 2000ms});
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+  deduplicator_.Clear();
+  ASSERT_TRUE(Process(kTestAddress1, -50, {0x2, 0x1, 0x6}, 0ms));
+}
+
+TEST_F(LeScanningDeduplicatorTest, bounded_cache) {
+  deduplicator_.SetConfig({.window = 1000ms});
+  for (uint16_t i = 0; i < 1024; i++) {
+    Address address({static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), 0, 0, 0, 0});
+    ASSERT_TRUE(Process(address, -50, {0x2, 0x1, 0x6}, std::chrono::milliseconds(i / 4)));
+  }
+  // The most recent advertisers are still remembered.
+  Address address({0xff, 0x03, 0, 0, 0, 0});
+  ASSERT_FALSE(Process(address, -50, {0x2, 0x1, 0x6}, 300ms));
+}
+
+}  // namespace bluetooth::hci
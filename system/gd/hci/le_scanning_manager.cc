@@ -26,8 +26,10 @@
 #include "hci/hci_layer.h"
 #include "hci/hci_packets.h"
 #include "hci/le_periodic_sync_manager.h"
+#include "hci/le_scanning_deduplicator.h"
 #include "hci/le_scanning_interface.h"
 #include "hci/le_scanning_reassembler.h"
+#include "hci/le_scanning_software_filter.h"
 #include "hci/vendor_specific_event_manager.h"
 #include "module.h"
 #include "os/handler.h"
@@ -74,6 +76,7 @@ enum class ScanApiType {
 struct Scanner {
   Uuid app_uuid;
   bool in_use;
+  AdvertisingReportDedupConfig dedup_config;
 };
 
 class NullScanningCallback : public ScanningCallback {
@@ -469,6 +472,11 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
             event_type, address_type, address, advertising_sid, advertising_data);
 
     if (processed_report.has_value()) {
+      if (use_software_filter_ && software_filter_enabled_ &&
+          !software_filter_.Matches(address, rssi, processed_report->data)) {
+        return;
+      }
+
       switch (address_type) {
         case (uint8_t)AddressType::PUBLIC_DEVICE_ADDRESS:
         case (uint8_t)AddressType::PUBLIC_IDENTITY_ADDRESS:
@@ -484,6 +492,17 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
                                              ? processed_report->extended_event_type
                                              : event_type;
 
+      if (!scanning_deduplicator_.ProcessAdvertisingReport(
+              result_event_type,
+              address_type,
+              address,
+              advertising_sid,
+              rssi,
+              processed_report->data,
+              std::chrono::steady_clock::now())) {
+        return;
+      }
+
       scanning_callbacks_->OnScanResult(
           result_event_type,
           address_type,
@@ -554,6 +573,8 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
       if (!scanners_[i].in_use) {
         scanners_[i].app_uuid = app_uuid;
         scanners_[i].in_use = true;
+        scanners_[i].dedup_config = {};
+        update_dedup_config();
         scanning_callbacks_->OnScannerRegistered(app_uuid, i, ScanningCallback::ScanningStatus::SUCCESS);
         return;
       }
@@ -572,6 +593,8 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
     if (scanners_[scanner_id].in_use) {
       scanners_[scanner_id].in_use = false;
       scanners_[scanner_id].app_uuid = Uuid::kEmpty;
+      scanners_[scanner_id].dedup_config = {};
+      update_dedup_config();
     } else {
       LOG_WARN("Unregister scanner with unused scanner id");
     }
@@ -581,6 +604,8 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
     // On-resume flag should always be reset if there is an explicit start/stop call.
     scan_on_resume_ = false;
     if (start) {
+      // Report every advertiser at least once per scan
+      scanning_deduplicator_.Clear();
       configure_scan();
       start_scan();
     } else {
@@ -692,17 +717,55 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
     scanning_callbacks_->OnSetScannerParameterComplete(scanner_id, ScanningCallback::SUCCESS);
   }
 
+  void set_scan_result_dedup(ScannerId scanner_id, AdvertisingReportDedupConfig config) {
+    if (scanner_id <= 0 || scanner_id > kMaxAppNum || !scanners_[scanner_id].in_use) {
+      LOG_WARN("Invalid scanner id %d", scanner_id);
+      return;
+    }
+    scanners_[scanner_id].dedup_config = config;
+    update_dedup_config();
+  }
+
+  // Results are shared by all the scanners, so a report is only dropped when every registered
+  // scanner would drop it: the shortest window and the smallest RSSI threshold apply, and a
+  // scanner without deduplication disables it.
+  void update_dedup_config() {
+    AdvertisingReportDedupConfig config;
+    bool first = true;
+    for (uint8_t i = 1; i <= kMaxAppNum; i++) {
+      if (!scanners_[i].in_use) {
+        continue;
+      }
+      const AdvertisingReportDedupConfig& scanner_config = scanners_[i].dedup_config;
+      if (scanner_config.window.count() <= 0) {
+        config = {};
+        break;
+      }
+      if (first || scanner_config.window < config.window) {
+        config.window = scanner_config.window;
+      }
+      if (scanner_config.rssi_threshold != 0 &&
+          (config.rssi_threshold == 0 || scanner_config.rssi_threshold < config.rssi_threshold)) {
+        config.rssi_threshold = scanner_config.rssi_threshold;
+      }
+      first = false;
+    }
+    scanning_deduplicator_.SetConfig(config);
+  }
+
   void set_scan_filter_policy(LeScanningFilterPolicy filter_policy) {
     filter_policy_ = filter_policy;
   }
 
   void scan_filter_enable(bool enable) {
-    if (!is_filter_supported_) {
-      LOG_WARN("Advertising filter is not supported");
+    software_filter_enabled_ = enable;
+    Enable apcf_enable = enable ? Enable::ENABLED : Enable::DISABLED;
+    if (!is_filter_supported_ || use_software_filter_) {
+      // The controller must deliver every report to the software filter
+      scanning_callbacks_->OnFilterEnable(apcf_enable, (uint8_t)ErrorCode::SUCCESS);
       return;
     }
 
-    Enable apcf_enable = enable ? Enable::ENABLED : Enable::DISABLED;
     le_scanning_interface_->EnqueueCommand(
         LeAdvFilterEnableBuilder::Create(apcf_enable),
         module_handler_->BindOnceOn(this, &impl::on_advertising_filter_complete));
@@ -719,10 +782,75 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
     return false;
   }
 
+  // Filters that do not fit in the controller are matched in software. Every filter is also kept
+  // by the software filter, so that it can take over all of them: the controller filtering is
+  // disabled as long as the software filter is used.
+  bool is_software_filter_index(uint8_t filter_index) {
+    if (!is_filter_supported_) {
+      return true;
+    }
+    // Zero when the controller does not report its number of filters
+    uint8_t max_filter = controller_->GetVendorCapabilities().max_filter_;
+    return max_filter != 0 && filter_index >= max_filter;
+  }
+
+  uint8_t software_filter_available_spaces() {
+    return LeScanningSoftwareFilter::kMaximumFilters - software_filter_.NumFilters();
+  }
+
+  void start_software_filter() {
+    if (use_software_filter_) {
+      return;
+    }
+    LOG_INFO("Advertising filters exceed the controller, filtering in software");
+    use_software_filter_ = true;
+    if (is_filter_supported_ && software_filter_enabled_) {
+      le_scanning_interface_->EnqueueCommand(
+          LeAdvFilterEnableBuilder::Create(Enable::DISABLED),
+          module_handler_->BindOnce(check_complete<LeAdvFilterCompleteView>));
+    }
+  }
+
+  void stop_software_filter() {
+    if (!use_software_filter_ || !is_filter_supported_) {
+      return;
+    }
+    LOG_INFO("Advertising filters fit in the controller again");
+    use_software_filter_ = false;
+    if (software_filter_enabled_) {
+      le_scanning_interface_->EnqueueCommand(
+          LeAdvFilterEnableBuilder::Create(Enable::ENABLED),
+          module_handler_->BindOnce(check_complete<LeAdvFilterCompleteView>));
+    }
+  }
+
   void scan_filter_parameter_setup(
       ApcfAction action, uint8_t filter_index, AdvertisingFilterParameter advertising_filter_parameter) {
+    switch (action) {
+      case ApcfAction::ADD:
+        software_filter_.SetParameters(filter_index, (int8_t)advertising_filter_parameter.rssi_high_thresh);
+        break;
+      case ApcfAction::DELETE:
+        software_filter_.RemoveFilter(filter_index);
+        break;
+      case ApcfAction::CLEAR:
+        software_filter_.Clear();
+        stop_software_filter();
+        break;
+      default:
+        break;
+    }
+    if (action != ApcfAction::CLEAR && is_software_filter_index(filter_index)) {
+      if (action == ApcfAction::ADD) {
+        start_software_filter();
+      }
+      scanning_callbacks_->OnFilterParamSetup(
+          software_filter_available_spaces(), action, (uint8_t)ErrorCode::SUCCESS);
+      return;
+    }
     if (!is_filter_supported_) {
-      LOG_WARN("Advertising filter is not supported");
+      scanning_callbacks_->OnFilterParamSetup(
+          software_filter_available_spaces(), action, (uint8_t)ErrorCode::SUCCESS);
       return;
     }
 
@@ -784,11 +912,6 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
   }
 
   void scan_filter_add(uint8_t filter_index, std::vector<AdvertisingPacketContentFilterCommand> filters) {
-    if (!is_filter_supported_) {
-      LOG_WARN("Advertising filter is not supported");
-      return;
-    }
-
     ApcfAction apcf_action = ApcfAction::ADD;
     for (auto filter : filters) {
       /* If data is passed, both mask and data have to be the same length */
@@ -797,6 +920,14 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
         continue;
       }
 
+      software_filter_.AddFilter(filter_index, filter);
+      if (is_software_filter_index(filter_index)) {
+        start_software_filter();
+        scanning_callbacks_->OnFilterConfigCallback(
+            filter.filter_type, software_filter_available_spaces(), apcf_action, (uint8_t)ErrorCode::SUCCESS);
+        continue;
+      }
+
       switch (filter.filter_type) {
         case ApcfFilterType::BROADCASTER_ADDRESS: {
           update_address_filter(apcf_action, filter_index, filter.address, filter.application_address_type, filter.irk);
@@ -1597,9 +1728,15 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
     uint8_t num_of_records = complete_view.GetNumOfRecords();
     auto report_format = complete_view.GetBatchScanDataRead();
     if (num_of_records == 0) {
+      // Hand the accumulated results over instead of copying them, they can be large after a long
+      // batch scan.
+      std::vector<uint8_t> results;
+      auto node = batch_scan_result_cache_.extract(scanner_id);
+      if (!node.empty()) {
+        results = std::move(node.mapped());
+      }
       scanning_callbacks_->OnBatchScanReports(
-          scanner_id, 0x00, (int)report_format, total_num_of_records, batch_scan_result_cache_[scanner_id]);
-      batch_scan_result_cache_.erase(scanner_id);
+          scanner_id, 0x00, (int)report_format, total_num_of_records, std::move(results));
     } else {
       auto raw_data = complete_view.GetRawData();
       batch_scan_result_cache_[scanner_id].insert(
@@ -1698,6 +1835,10 @@ struct LeScanningManager::impl : public LeAddressManagerCallback {
   bool scan_on_resume_ = false;
   bool paused_ = false;
   LeScanningReassembler scanning_reassembler_;
+  LeScanningDeduplicator scanning_deduplicator_;
+  LeScanningSoftwareFilter software_filter_;
+  bool use_software_filter_ = false;
+  bool software_filter_enabled_ = false;
   bool is_filter_supported_ = false;
   bool is_ad_type_filter_supported_ = false;
   bool is_batch_scan_supported_ = false;
@@ -1764,6 +1905,10 @@ void LeScanningManager::SetScanParameters(
   CallOn(pimpl_.get(), &impl::set_scan_parameters, scanner_id, scan_type, scan_interval, scan_window);
 }
 
+void LeScanningManager::SetScanResultDeduplication(ScannerId scanner_id, AdvertisingReportDedupConfig config) {
+  CallOn(pimpl_.get(), &impl::set_scan_result_dedup, scanner_id, config);
+}
+
 void LeScanningManager::SetScanFilterPolicy(LeScanningFilterPolicy filter_policy) {
   CallOn(pimpl_.get(), &impl::set_scan_filter_policy, filter_policy);
 }
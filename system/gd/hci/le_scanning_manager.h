@@ -21,6 +21,7 @@
 #include "common/callback.h"
 #include "hci/address_with_type.h"
 #include "hci/hci_packets.h"
+#include "hci/le_scanning_deduplicator.h"
 #include "hci/le_scanning_callback.h"
 #include "hci/uuid.h"
 #include "module.h"
@@ -55,6 +56,10 @@ class LeScanningManager : public bluetooth::Module {
   virtual void SetScanParameters(
       ScannerId scanner_id, LeScanType scan_type, uint16_t scan_interval, uint16_t scan_window);
 
+  // Drop the scan results that repeat a result recently reported for the same advertiser and
+  // payload. Reports are only dropped when every registered scanner asked for it.
+  virtual void SetScanResultDeduplication(ScannerId scanner_id, AdvertisingReportDedupConfig config);
+
   virtual void SetScanFilterPolicy(LeScanningFilterPolicy filter_policy);
 
   /* Scan filter */
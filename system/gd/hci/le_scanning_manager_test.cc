@@ -151,6 +151,14 @@ class TestController : public Controller {
     support_ble_periodic_advertising_sync_transfer_ = support;
   }
 
+  VendorCapabilities GetVendorCapabilities() const override {
+    return vendor_capabilities_;
+  }
+
+  void SetMaxFilter(uint8_t max_filter) {
+    vendor_capabilities_.max_filter_ = max_filter;
+  }
+
  protected:
   void Start() override {}
   void Stop() override {}
@@ -160,6 +168,7 @@ class TestController : public Controller {
   std::set<OpCode> supported_opcodes_{};
   bool support_ble_extended_advertising_ = false;
   bool support_ble_periodic_advertising_sync_transfer_ = false;
+  VendorCapabilities vendor_capabilities_{};
 };
 
 class TestLeAddressManager : public LeAddressManager {
@@ -621,6 +630,31 @@ TEST_F(LeScanningManagerAndroidHciTest, scan_filter_add_ad_type_test) {
       LeAdvFilterADTypeCompleteBuilder::Create(uint8_t{1}, ErrorCode::SUCCESS, ApcfAction::ADD, 0x0a));
 }
 
+TEST_F(LeScanningManagerAndroidHciTest, scan_filter_beyond_controller_filters_test) {
+  test_controller_->SetMaxFilter(1);
+  std::vector<AdvertisingPacketContentFilterCommand> filters = {};
+  filters.push_back(make_filter(ApcfFilterType::LOCAL_NAME));
+
+  // The filter does not fit in the controller and is kept in software
+  EXPECT_CALL(
+      mock_callbacks_,
+      OnFilterConfigCallback(ApcfFilterType::LOCAL_NAME, _, ApcfAction::ADD, (uint8_t)ErrorCode::SUCCESS));
+  le_scanning_manager->ScanFilterAdd(0x01, filters);
+  sync_client_handler();
+
+  AdvertisingFilterParameter advertising_filter_parameter{};
+  advertising_filter_parameter.delivery_mode = DeliveryMode::IMMEDIATE;
+  EXPECT_CALL(mock_callbacks_, OnFilterParamSetup(_, ApcfAction::ADD, (uint8_t)ErrorCode::SUCCESS));
+  le_scanning_manager->ScanFilterParameterSetup(ApcfAction::ADD, 0x01, advertising_filter_parameter);
+  sync_client_handler();
+
+  // The controller filtering stays disabled so that the software filter sees every report
+  EXPECT_CALL(mock_callbacks_, OnFilterEnable(Enable::ENABLED, (uint8_t)ErrorCode::SUCCESS));
+  le_scanning_manager->ScanFilterEnable(true);
+  sync_client_handler();
+  test_hci_layer_->AssertNoQueuedCommand();
+}
+
 TEST_F(LeScanningManagerAndroidHciTest, read_batch_scan_result) {
   le_scanning_manager->BatchScanConifgStorage(100, 0, 95, 0x00);
   sync_client_handler();
@@ -846,6 +880,36 @@ TEST_F(LeScanningManagerExtendedTest, ignore_on_pause_on_resume_after_unregister
   ASSERT_EQ(test_le_address_manager->test_client_state_, TestLeAddressManager::TestClientState::UNREGISTERED);
 }
 
+TEST_F(LeScanningManagerExtendedTest, deduplicate_scan_results_test) {
+  EXPECT_CALL(mock_callbacks_, OnScannerRegistered(_, 1, ScanningCallback::ScanningStatus::SUCCESS));
+  le_scanning_manager->RegisterScanner(Uuid::kEmpty);
+  le_scanning_manager->SetScanResultDeduplication(1, {.window = std::chrono::seconds(10)});
+
+  // Enable scan
+  le_scanning_manager->Scan(true);
+  ASSERT_EQ(OpCode::LE_SET_EXTENDED_SCAN_PARAMETERS, test_hci_layer_->GetCommand().GetOpCode());
+  test_hci_layer_->IncomingEvent(LeSetExtendedScanParametersCompleteBuilder::Create(uint8_t{1}, ErrorCode::SUCCESS));
+  ASSERT_EQ(OpCode::LE_SET_EXTENDED_SCAN_ENABLE, test_hci_layer_->GetCommand().GetOpCode());
+  test_hci_layer_->IncomingEvent(LeSetExtendedScanEnableCompleteBuilder::Create(uint8_t{1}, ErrorCode::SUCCESS));
+
+  LeExtendedAdvertisingResponse report{};
+  report.connectable_ = 1;
+  report.address_type_ = DirectAdvertisingAddressType::PUBLIC_DEVICE_ADDRESS;
+  Address::FromString("12:34:56:78:9a:bc", report.address_);
+  LengthAndData flags_data{};
+  flags_data.data_.push_back(static_cast<uint8_t>(GapDataType::FLAGS));
+  flags_data.data_.push_back(0x34);
+  report.advertising_data_ = {flags_data};
+
+  // The repeated report is dropped, the new payload is not
+  EXPECT_CALL(mock_callbacks_, OnScanResult).Times(2);
+  test_hci_layer_->IncomingLeMetaEvent(LeExtendedAdvertisingReportBuilder::Create({report}));
+  test_hci_layer_->IncomingLeMetaEvent(LeExtendedAdvertisingReportBuilder::Create({report}));
+  report.advertising_data_[0].data_[1] = 0x06;
+  test_hci_layer_->IncomingLeMetaEvent(LeExtendedAdvertisingReportBuilder::Create({report}));
+  sync_client_handler();
+}
+
 TEST_F(LeScanningManagerExtendedTest, drop_insignificant_bytes_test) {
   // Enable scan
   le_scanning_manager->Scan(true);
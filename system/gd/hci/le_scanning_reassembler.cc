@@ -15,6 +15,8 @@
  */
 #include "hci/le_scanning_reassembler.h"
 
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 
@@ -32,6 +34,14 @@
 
 namespace bluetooth::hci {
 
+LeScanningReassembler::LeScanningReassembler()
+    : arena_(std::make_unique<uint8_t[]>(kMaximumCacheSize * kMaximumFragmentDataSize)) {
+  table_.fill(kInvalidIndex);
+  for (size_t i = 0; i < kMaximumCacheSize; i++) {
+    free_indices_[free_count_++] = static_cast<uint8_t>(kMaximumCacheSize - 1 - i);
+  }
+}
+
 std::optional<LeScanningReassembler::CompleteAdvertisingData>
 LeScanningReassembler::ProcessAdvertisingReport(
     uint16_t event_type,
@@ -67,12 +77,16 @@ LeScanningReassembler::ProcessAdvertisingReport(
   }
 
   // Concatenate the data with existing fragments.
-  std::list<AdvertisingFragment>::iterator advertising_fragment =
-      AppendFragment(key, event_type, advertising_data);
+  uint8_t index = AppendFragment(key, event_type, advertising_data);
+  if (index == kInvalidIndex) {
+    return {};
+  }
+  AdvertisingFragment& advertising_fragment = fragments_[index];
 
   // Trim the advertising data when the complete payload is received.
   if (data_status != DataStatus::CONTINUING) {
-    advertising_fragment->data = TrimAdvertisingData(advertising_fragment->data);
+    advertising_fragment.data_size =
+        TrimAdvertisingDataInPlace(FragmentData(index), advertising_fragment.data_size);
   }
 
   // TODO(b/272120114) waiting for a scan response here is prone to failure as the
@@ -90,10 +104,11 @@ LeScanningReassembler::ProcessAdvertisingReport(
 
   // Otherwise the full advertising report has been reassembled,
   // removed the cache entry and return the complete advertising data.
+  uint8_t* data = FragmentData(index);
   CompleteAdvertisingData result{
-      .extended_event_type = advertising_fragment->extended_event_type,
-      .data = std::move(advertising_fragment->data)};
-  cache_.erase(advertising_fragment);
+      .extended_event_type = advertising_fragment.extended_event_type,
+      .data = std::vector<uint8_t>(data, data + advertising_fragment.data_size)};
+  EraseFragment(index);
   return result;
 }
 
@@ -120,24 +135,29 @@ std::optional<std::vector<uint8_t>> LeScanningReassembler::ProcessPeriodicAdvert
 /// GAP Data entries.
 std::vector<uint8_t> LeScanningReassembler::TrimAdvertisingData(
     const std::vector<uint8_t>& advertising_data) {
+  std::vector<uint8_t> significant_advertising_data(advertising_data);
+  significant_advertising_data.resize(
+      TrimAdvertisingDataInPlace(significant_advertising_data.data(), significant_advertising_data.size()));
+  return significant_advertising_data;
+}
+
+size_t LeScanningReassembler::TrimAdvertisingDataInPlace(uint8_t* advertising_data, size_t size) {
   // Remove empty and overflowing entries from the advertising data.
-  std::vector<uint8_t> significant_advertising_data;
-  for (size_t offset = 0; offset < advertising_data.size();) {
-    size_t remaining_size = advertising_data.size() - offset;
+  // Entries are only ever moved towards the start of the data.
+  size_t significant_size = 0;
+  for (size_t offset = 0; offset < size;) {
+    size_t remaining_size = size - offset;
     uint8_t entry_size = advertising_data[offset];
 
     if (entry_size != 0 && entry_size < remaining_size) {
-      significant_advertising_data.push_back(entry_size);
-      significant_advertising_data.insert(
-          significant_advertising_data.end(),
-          advertising_data.begin() + offset + 1,
-          advertising_data.begin() + offset + 1 + entry_size);
+      std::memmove(advertising_data + significant_size, advertising_data + offset, entry_size + 1);
+      significant_size += entry_size + 1;
     }
 
     offset += entry_size + 1;
   }
 
-  return significant_advertising_data;
+  return significant_size;
 }
 
 LeScanningReassembler::AdvertisingKey::AdvertisingKey(
@@ -154,58 +174,147 @@ LeScanningReassembler::AdvertisingKey::AdvertisingKey(
   }
 }
 
-bool LeScanningReassembler::AdvertisingKey::operator==(const AdvertisingKey& other) {
+bool LeScanningReassembler::AdvertisingKey::operator==(const AdvertisingKey& other) const {
   return address == other.address && sid == other.sid;
 }
 
+size_t LeScanningReassembler::AdvertisingKey::Hash() const {
+  size_t hash = address.has_value() ? std::hash<AddressWithType>{}(*address) : 0;
+  // Missing values hash differently from any present value
+  size_t sid_value = sid.has_value() ? *sid : 0x100;
+  return hash ^ (sid_value * 0x9e3779b97f4a7c15ull) ^ (hash >> 17);
+}
+
 /// Append to the current advertising data of the selected advertiser.
 /// If the advertiser is unknown a new entry is added, optionally by
-/// dropping the oldest advertiser.
-std::list<LeScanningReassembler::AdvertisingFragment>::iterator
-LeScanningReassembler::AppendFragment(
+/// dropping the least recently updated advertiser.
+/// Returns kInvalidIndex if the data does not fit in the fragment.
+uint8_t LeScanningReassembler::AppendFragment(
     const AdvertisingKey& key, uint16_t extended_event_type, const std::vector<uint8_t>& data) {
-  auto it = FindFragment(key);
-  if (it != cache_.end()) {
+  uint8_t index = FindFragment(key);
+  if (index != kInvalidIndex) {
+    AdvertisingFragment& fragment = fragments_[index];
     // Legacy scan responses don't contain a 'connectable' bit, so this adds the
     // 'connectable' bit from the initial report.
     if ((extended_event_type & (1 << kLegacyBit)) &&
         (extended_event_type & (1 << kScanResponseBit))) {
-      it->extended_event_type =
-          extended_event_type | (it->extended_event_type & (1 << kConnectableBit));
+      fragment.extended_event_type =
+          extended_event_type | (fragment.extended_event_type & (1 << kConnectableBit));
     } else {
-      it->extended_event_type = extended_event_type;
+      fragment.extended_event_type = extended_event_type;
     }
-    it->data.insert(it->data.end(), data.cbegin(), data.cend());
-    return it;
+    LruUnlink(index);
+    LruPushFront(index);
+  } else {
+    index = InsertFragment(key);
+    fragments_[index].extended_event_type = extended_event_type;
   }
 
-  if (cache_.size() > kMaximumCacheSize) {
-    cache_.pop_back();
+  AdvertisingFragment& fragment = fragments_[index];
+  if (fragment.data_size + data.size() > kMaximumFragmentDataSize) {
+    LOG_WARN("Dropping advertising data larger than %zu bytes", kMaximumFragmentDataSize);
+    EraseFragment(index);
+    return kInvalidIndex;
   }
+  std::memcpy(FragmentData(index) + fragment.data_size, data.data(), data.size());
+  fragment.data_size += data.size();
+  return index;
+}
 
-  cache_.emplace_front(key, extended_event_type, data);
-  return cache_.begin();
+/// Add an empty fragment for the advertiser, dropping the least recently
+/// updated advertiser when the cache is full.
+uint8_t LeScanningReassembler::InsertFragment(const AdvertisingKey& key) {
+  if (free_count_ == 0) {
+    EraseFragment(lru_tail_);
+  }
+  uint8_t index = free_indices_[--free_count_];
+  AdvertisingFragment& fragment = fragments_[index];
+  fragment.key = key;
+  fragment.hash = key.Hash();
+  fragment.data_size = 0;
+
+  size_t position = fragment.hash & (kCacheTableSize - 1);
+  while (table_[position] != kInvalidIndex) {
+    position = (position + 1) & (kCacheTableSize - 1);
+  }
+  table_[position] = index;
+  LruPushFront(index);
+  return index;
+}
+
+void LeScanningReassembler::EraseFragment(uint8_t index) {
+  constexpr size_t kMask = kCacheTableSize - 1;
+  size_t position = fragments_[index].hash & kMask;
+  while (table_[position] != index) {
+    position = (position + 1) & kMask;
+  }
+  table_[position] = kInvalidIndex;
+
+  // Shift back the following entries of the probe sequence that may no longer
+  // be found past the hole.
+  for (size_t next = (position + 1) & kMask; table_[next] != kInvalidIndex; next = (next + 1) & kMask) {
+    size_t home = fragments_[table_[next]].hash & kMask;
+    if (((next - home) & kMask) >= ((next - position) & kMask)) {
+      table_[position] = table_[next];
+      table_[next] = kInvalidIndex;
+      position = next;
+    }
+  }
+
+  LruUnlink(index);
+  fragments_[index] = AdvertisingFragment();
+  free_indices_[free_count_++] = index;
 }
 
 void LeScanningReassembler::RemoveFragment(const AdvertisingKey& key) {
-  auto it = FindFragment(key);
-  if (it != cache_.end()) {
-    cache_.erase(it);
+  uint8_t index = FindFragment(key);
+  if (index != kInvalidIndex) {
+    EraseFragment(index);
   }
 }
 
-bool LeScanningReassembler::ContainsFragment(const AdvertisingKey& key) {
-  return FindFragment(key) != cache_.end();
+bool LeScanningReassembler::ContainsFragment(const AdvertisingKey& key) const {
+  return FindFragment(key) != kInvalidIndex;
 }
 
-std::list<LeScanningReassembler::AdvertisingFragment>::iterator LeScanningReassembler::FindFragment(
-    const AdvertisingKey& key) {
-  for (auto it = cache_.begin(); it != cache_.end(); it++) {
-    if (it->key == key) {
-      return it;
+uint8_t LeScanningReassembler::FindFragment(const AdvertisingKey& key) const {
+  size_t hash = key.Hash();
+  for (size_t position = hash & (kCacheTableSize - 1); table_[position] != kInvalidIndex;
+       position = (position + 1) & (kCacheTableSize - 1)) {
+    const AdvertisingFragment& fragment = fragments_[table_[position]];
+    if (fragment.hash == hash && fragment.key == key) {
+      return table_[position];
     }
   }
-  return cache_.end();
+  return kInvalidIndex;
+}
+
+void LeScanningReassembler::LruUnlink(uint8_t index) {
+  AdvertisingFragment& fragment = fragments_[index];
+  if (fragment.lru_prev != kInvalidIndex) {
+    fragments_[fragment.lru_prev].lru_next = fragment.lru_next;
+  } else {
+    lru_head_ = fragment.lru_next;
+  }
+  if (fragment.lru_next != kInvalidIndex) {
+    fragments_[fragment.lru_next].lru_prev = fragment.lru_prev;
+  } else {
+    lru_tail_ = fragment.lru_prev;
+  }
+  fragment.lru_prev = kInvalidIndex;
+  fragment.lru_next = kInvalidIndex;
+}
+
+void LeScanningReassembler::LruPushFront(uint8_t index) {
+  AdvertisingFragment& fragment = fragments_[index];
+  fragment.lru_prev = kInvalidIndex;
+  fragment.lru_next = lru_head_;
+  if (lru_head_ != kInvalidIndex) {
+    fragments_[lru_head_].lru_prev = index;
+  } else {
+    lru_tail_ = index;
+  }
+  lru_head_ = index;
 }
 
 /// Append to the current advertising data of the selected periodic advertiser.
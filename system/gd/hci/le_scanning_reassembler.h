@@ -17,8 +17,10 @@
 
 #include <gtest/gtest_prod.h>
 
+#include <array>
 #include <cstdint>
 #include <list>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -40,7 +42,7 @@ class LeScanningReassembler {
     std::vector<uint8_t> data;
   };
 
-  LeScanningReassembler(){};
+  LeScanningReassembler();
 
   LeScanningReassembler(const LeScanningReassembler&) = delete;
 
@@ -97,19 +99,22 @@ class LeScanningReassembler {
     std::optional<AddressWithType> address;
     std::optional<uint8_t> sid;
 
+    AdvertisingKey() = default;
     AdvertisingKey(Address address, DirectAdvertisingAddressType address_type, uint8_t sid);
-    bool operator==(const AdvertisingKey& other);
+    bool operator==(const AdvertisingKey& other) const;
+    size_t Hash() const;
   };
 
-  /// Packs incomplete advertising data.
+  /// Packs incomplete advertising data. The data itself is stored in the
+  /// arena slot of the same index.
   struct AdvertisingFragment {
     AdvertisingKey key;
-    uint16_t extended_event_type;
-    std::vector<uint8_t> data;
-
-    AdvertisingFragment(
-        const AdvertisingKey& key, uint16_t extended_event_type, const std::vector<uint8_t>& data)
-        : key(key), extended_event_type(extended_event_type), data(data.begin(), data.end()) {}
+    size_t hash{0};
+    uint16_t extended_event_type{0};
+    size_t data_size{0};
+    // Neighbours in the least recently used list
+    uint8_t lru_prev{kInvalidIndex};
+    uint8_t lru_next{kInvalidIndex};
   };
 
   /// Packs incomplete periodic advertising data.
@@ -126,18 +131,47 @@ class LeScanningReassembler {
   /// applicable.
   /// The cached advertising data is removed as soon as the complete
   /// advertisement is got (including the scan response).
+  /// Fragments are found through an open-addressed table keyed by the
+  /// advertising key, and their data is appended in place into a fixed
+  /// arena slot, so that processing a report does not allocate. When the
+  /// cache is full the least recently updated advertiser is dropped.
   static constexpr size_t kMaximumCacheSize = 16;
-  std::list<AdvertisingFragment> cache_;
+  static constexpr uint8_t kInvalidIndex = 0xff;
+  /// Advertising data and scan response data of up to 1650 bytes each.
+  static constexpr size_t kMaximumFragmentDataSize = 2 * 1650;
+  /// Kept at most half full so that probe sequences stay short.
+  static constexpr size_t kCacheTableSize = 2 * kMaximumCacheSize;
+  static_assert((kCacheTableSize & (kCacheTableSize - 1)) == 0, "The table size must be a power of two");
+
+  std::array<AdvertisingFragment, kMaximumCacheSize> fragments_;
+  std::unique_ptr<uint8_t[]> arena_;
+  /// Fragment index for each table position, or kInvalidIndex.
+  std::array<uint8_t, kCacheTableSize> table_;
+  std::array<uint8_t, kMaximumCacheSize> free_indices_;
+  size_t free_count_{0};
+  uint8_t lru_head_{kInvalidIndex};
+  uint8_t lru_tail_{kInvalidIndex};
 
   /// Advertising cache management methods.
-  std::list<AdvertisingFragment>::iterator AppendFragment(
-      const AdvertisingKey& key, uint16_t extended_event_type, const std::vector<uint8_t>& data);
+  uint8_t AppendFragment(const AdvertisingKey& key, uint16_t extended_event_type, const std::vector<uint8_t>& data);
+
+  uint8_t InsertFragment(const AdvertisingKey& key);
+
+  void EraseFragment(uint8_t index);
 
   void RemoveFragment(const AdvertisingKey& key);
 
-  bool ContainsFragment(const AdvertisingKey& key);
+  bool ContainsFragment(const AdvertisingKey& key) const;
 
-  std::list<AdvertisingFragment>::iterator FindFragment(const AdvertisingKey& key);
+  uint8_t FindFragment(const AdvertisingKey& key) const;
+
+  uint8_t* FragmentData(uint8_t index) const {
+    return arena_.get() + index * kMaximumFragmentDataSize;
+  }
+
+  void LruUnlink(uint8_t index);
+
+  void LruPushFront(uint8_t index);
 
   /// Advertising cache for de-fragmenting periodic advertising reports.
   static constexpr size_t kMaximumPeriodicCacheSize = 16;
@@ -152,6 +186,9 @@ class LeScanningReassembler {
   /// GAP Data entries.
   static std::vector<uint8_t> TrimAdvertisingData(const std::vector<uint8_t>& advertising_data);
 
+  /// Same as TrimAdvertisingData, in place. Returns the trimmed size.
+  static size_t TrimAdvertisingDataInPlace(uint8_t* advertising_data, size_t size);
+
   FRIEND_TEST(LeScanningReassemblerTest, trim_advertising_data);
 };
 
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "hci/le_scanning_reassembler.h"
+
+using ::benchmark::State;
+
+namespace bluetooth {
+namespace hci {
+
+namespace {
+
+// Event type fields
+constexpr uint16_t kScannable = 0x2;
+constexpr uint16_t kScanResponse = 0x8;
+constexpr uint16_t kLegacy = 0x10;
+constexpr uint16_t kComplete = 0x0;
+constexpr uint16_t kContinuation = 0x20;
+
+constexpr uint8_t kSidNotPresent = 0xff;
+
+// Largest advertising data carried by a single extended advertising report
+constexpr size_t kExtendedFragmentSize = 229;
+constexpr size_t kLegacyDataSize = 31;
+
+struct Report {
+  uint16_t event_type;
+  Address address;
+  uint8_t sid;
+  const std::vector<uint8_t>* data;
+};
+
+// GAP data entries of the maximum length, as found in full payloads.
+std::vector<uint8_t> MakeAdvertisingData(size_t size) {
+  std::vector<uint8_t> data;
+  while (data.size() < size) {
+    size_t entry_size = std::min<size_t>(size - data.size() - 1, 0xff);
+    data.push_back(static_cast<uint8_t>(entry_size));
+    data.insert(data.end(), entry_size, 0x42);
+  }
+  return data;
+}
+
+// A crowded scan: the extended advertisers interleave their three reports per
+// event, while the legacy scannable advertisers send an advertising report
+// followed by its scan response.
+std::vector<Report> MakeTrace(size_t extended_advertisers, size_t legacy_advertisers) {
+  static const std::vector<uint8_t> kExtendedFragment = MakeAdvertisingData(kExtendedFragmentSize);
+  static const std::vector<uint8_t> kLegacyData = MakeAdvertisingData(kLegacyDataSize);
+
+  std::vector<Report> trace;
+  auto address = [](size_t i) {
+    return Address({static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), 0x00, 0x00, 0x00, 0xc0});
+  };
+  for (size_t fragment = 0; fragment < 3; fragment++) {
+    uint16_t event_type = fragment == 2 ? kComplete : kContinuation;
+    for (size_t i = 0; i < extended_advertisers; i++) {
+      trace.push_back({event_type, address(i), static_cast<uint8_t>(i % 16), &kExtendedFragment});
+    }
+  }
+  for (size_t i = 0; i < legacy_advertisers; i++) {
+    Address legacy_address = address(extended_advertisers + i);
+    trace.push_back({kLegacy | kScannable, legacy_address, kSidNotPresent, &kLegacyData});
+    trace.push_back({kLegacy | kScannable | kScanResponse, legacy_address, kSidNotPresent, &kLegacyData});
+  }
+  return trace;
+}
+
+}  // namespace
+
+// Replays reports from as many interleaved extended advertisers as the
+// benchmark argument, plus as many legacy scannable advertisers.
+static void BM_LeScanningReassemblerCrowdedScan(State& state) {
+  size_t advertisers = state.range(0);
+  auto trace = MakeTrace(advertisers, advertisers);
+  LeScanningReassembler reassembler;
+  size_t complete_reports = 0;
+  for (auto _ : state) {
+    for (const auto& report : trace) {
+      auto result = reassembler.ProcessAdvertisingReport(
+          report.event_type,
+          static_cast<uint8_t>(AddressType::RANDOM_DEVICE_ADDRESS),
+          report.address,
+          report.sid,
+          *report.data);
+      if (result.has_value()) {
+        complete_reports++;
+      }
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * trace.size());
+  state.counters["complete_reports"] =
+      benchmark::Counter(complete_reports, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_LeScanningReassemblerCrowdedScan)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
+}  // namespace hci
+}  // namespace bluetooth
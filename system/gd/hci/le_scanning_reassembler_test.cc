@@ -387,6 +387,58 @@ TEST_F(LeScanningReassemblerTest, interleaved_advertising) {
       std::vector<uint8_t>({0x2, 0x3, 0x3}));
 }
 
+TEST_F(LeScanningReassemblerTest, evict_least_recently_updated_advertising) {
+  // Start one more advertising event than fits in the cache, updating the
+  // first advertiser along the way.
+  for (uint8_t sid = 0; sid <= 16; sid++) {
+    ASSERT_FALSE(reassembler_
+                     .ProcessAdvertisingReport(
+                         kContinuation,
+                         (uint8_t)AddressType::PUBLIC_DEVICE_ADDRESS,
+                         kTestAddress,
+                         sid,
+                         {0x2, sid})
+                     .has_value());
+    if (sid == 8) {
+      ASSERT_FALSE(reassembler_
+                       .ProcessAdvertisingReport(
+                           kContinuation,
+                           (uint8_t)AddressType::PUBLIC_DEVICE_ADDRESS,
+                           kTestAddress,
+                           0x0,
+                           {0x0})
+                       .has_value());
+    }
+  }
+
+  ASSERT_EQ(
+      reassembler_
+          .ProcessAdvertisingReport(
+              kComplete, (uint8_t)AddressType::PUBLIC_DEVICE_ADDRESS, kTestAddress, 0x0, {0x0})
+          .value()
+          .data,
+      std::vector<uint8_t>({0x2, 0x0, 0x0}));
+
+  for (uint8_t sid = 2; sid <= 16; sid++) {
+    ASSERT_EQ(
+        reassembler_
+            .ProcessAdvertisingReport(
+                kComplete, (uint8_t)AddressType::PUBLIC_DEVICE_ADDRESS, kTestAddress, sid, {sid})
+            .value()
+            .data,
+        std::vector<uint8_t>({0x2, sid, sid}));
+  }
+
+  // The second advertiser was the least recently updated and was dropped.
+  ASSERT_EQ(
+      reassembler_
+          .ProcessAdvertisingReport(
+              kComplete, (uint8_t)AddressType::PUBLIC_DEVICE_ADDRESS, kTestAddress, 0x1, {0x1})
+          .value()
+          .data,
+      std::vector<uint8_t>());
+}
+
 TEST_F(LeScanningReassemblerTest, periodic_advertising) {
   // Test periodic advertising.
   ASSERT_FALSE(
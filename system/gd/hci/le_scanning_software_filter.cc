@@ -0,0 +1,301 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hci/le_scanning_software_filter.h"
+
+#include <algorithm>
+
+#include "os/log.h"
+
+namespace bluetooth::hci {
+
+namespace {
+
+/// Offset of the 16 and 32 bit values in the little endian representation of
+/// a UUID built from the Bluetooth base UUID.
+constexpr size_t kShortUuidOffset = 12;
+
+/// Compares all the bytes without branching, so that the loop is vectorized.
+bool MaskedEqual(const uint8_t* data, const uint8_t* value, const uint8_t* mask, size_t size) {
+  uint8_t difference = 0;
+  for (size_t i = 0; i < size; i++) {
+    difference |= (data[i] ^ value[i]) & mask[i];
+  }
+  return difference == 0;
+}
+
+std::vector<uint8_t> MaskOrAllOnes(const std::vector<uint8_t>& mask, size_t size) {
+  return mask.empty() ? std::vector<uint8_t>(size, 0xff) : mask;
+}
+
+}  // namespace
+
+void LeScanningSoftwareFilter::AddFilter(
+    uint8_t filter_index, const AdvertisingPacketContentFilterCommand& filter) {
+  filters_[filter_index].content_filters.push_back(filter);
+  compiled_ = false;
+}
+
+void LeScanningSoftwareFilter::SetParameters(uint8_t filter_index, int8_t rssi_threshold) {
+  Filter& filter = filters_[filter_index];
+  filter.enabled = true;
+  filter.rssi_threshold = rssi_threshold;
+  compiled_ = false;
+}
+
+void LeScanningSoftwareFilter::RemoveFilter(uint8_t filter_index) {
+  filters_.erase(filter_index);
+  compiled_ = false;
+}
+
+void LeScanningSoftwareFilter::Clear() {
+  filters_.clear();
+  compiled_ = false;
+}
+
+size_t LeScanningSoftwareFilter::NumFilters() const {
+  return std::count_if(filters_.begin(), filters_.end(), [](const auto& entry) { return entry.second.enabled; });
+}
+
+bool LeScanningSoftwareFilter::Matches(
+    const Address& address, int8_t rssi, const std::vector<uint8_t>& advertising_data) {
+  if (!compiled_) {
+    Compile();
+  }
+  if (compiled_filters_.empty()) {
+    return false;
+  }
+
+  // Single pass over the AD structures, evaluating the conditions of their
+  // type that did not match yet.
+  std::fill(matched_types_.begin(), matched_types_.end(), 0);
+  const size_t size = advertising_data.size();
+  for (size_t offset = 0; offset < size;) {
+    uint8_t length = advertising_data[offset];
+    if (length == 0 || offset + 1 + length > size) {
+      break;
+    }
+    uint8_t ad_type = advertising_data[offset + 1];
+    const uint8_t* payload = advertising_data.data() + offset + 2;
+    for (uint16_t condition_index : conditions_by_ad_type_[ad_type]) {
+      const Condition& condition = conditions_[condition_index];
+      if ((matched_types_[condition.filter] & condition.type_bit) == 0 && condition.Matches(payload, length - 1)) {
+        matched_types_[condition.filter] |= condition.type_bit;
+      }
+    }
+    offset += length + 1;
+  }
+
+  for (size_t i = 0; i < compiled_filters_.size(); i++) {
+    const CompiledFilter& filter = compiled_filters_[i];
+    if (rssi < filter.rssi_threshold) {
+      continue;
+    }
+    uint16_t matched_types = matched_types_[i];
+    if (std::find(filter.addresses.begin(), filter.addresses.end(), address) != filter.addresses.end()) {
+      matched_types |= FilterTypeBit(ApcfFilterType::BROADCASTER_ADDRESS);
+    }
+    if ((matched_types & filter.required_types) == filter.required_types) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool LeScanningSoftwareFilter::Condition::Matches(const uint8_t* payload, size_t size) const {
+  if (element_size == 0) {
+    if (exact_size ? size != value.size() : size < value.size()) {
+      return false;
+    }
+    return MaskedEqual(payload, value.data(), mask.data(), value.size());
+  }
+  for (size_t offset = 0; offset + element_size <= size; offset += element_size) {
+    if (MaskedEqual(payload + offset, value.data(), mask.data(), element_size)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void LeScanningSoftwareFilter::Compile() {
+  compiled_filters_.clear();
+  conditions_.clear();
+  for (auto& conditions : conditions_by_ad_type_) {
+    conditions.clear();
+  }
+
+  for (const auto& [filter_index, filter] : filters_) {
+    if (!filter.enabled) {
+      continue;
+    }
+    uint16_t compiled_filter = compiled_filters_.size();
+    compiled_filters_.push_back({.required_types = 0, .rssi_threshold = filter.rssi_threshold, .addresses = {}});
+    for (const auto& content_filter : filter.content_filters) {
+      CompileContentFilter(compiled_filter, content_filter);
+    }
+  }
+
+  matched_types_.assign(compiled_filters_.size(), 0);
+  compiled_ = true;
+}
+
+void LeScanningSoftwareFilter::CompileContentFilter(
+    uint16_t filter, const AdvertisingPacketContentFilterCommand& content_filter) {
+  switch (content_filter.filter_type) {
+    case ApcfFilterType::BROADCASTER_ADDRESS: {
+      compiled_filters_[filter].addresses.push_back(content_filter.address);
+    } break;
+    case ApcfFilterType::SERVICE_UUID:
+    case ApcfFilterType::SERVICE_SOLICITATION_UUID: {
+      bool solicitation = content_filter.filter_type == ApcfFilterType::SERVICE_SOLICITATION_UUID;
+      auto value = content_filter.uuid.To128BitLE();
+      Uuid::UUID128Bit mask;
+      if (content_filter.uuid_mask.IsEmpty()) {
+        mask.fill(0xff);
+      } else {
+        mask = content_filter.uuid_mask.To128BitLE();
+      }
+      size_t uuid_size = content_filter.uuid.GetShortestRepresentationSize();
+      // Advertisers may list a UUID in any representation it fits in.
+      std::vector<std::pair<std::vector<GapDataType>, size_t>> representations;
+      if (uuid_size <= Uuid::kNumBytes16) {
+        representations.push_back(
+            {solicitation ? std::vector<GapDataType>{GapDataType::LIST_16BIT_SERVICE_SOLICITATION_UUIDS}
+                          : std::vector<GapDataType>{GapDataType::INCOMPLETE_LIST_16_BIT_UUIDS,
+                                                     GapDataType::COMPLETE_LIST_16_BIT_UUIDS},
+             Uuid::kNumBytes16});
+      }
+      if (uuid_size <= Uuid::kNumBytes32) {
+        representations.push_back(
+            {solicitation ? std::vector<GapDataType>{GapDataType::LIST_32BIT_SERVICE_SOLICITATION_UUIDS}
+                          : std::vector<GapDataType>{GapDataType::INCOMPLETE_LIST_32_BIT_UUIDS,
+                                                     GapDataType::COMPLETE_LIST_32_BIT_UUIDS},
+             Uuid::kNumBytes32});
+      }
+      representations.push_back(
+          {solicitation ? std::vector<GapDataType>{GapDataType::LIST_128BIT_SERVICE_SOLICITATION_UUIDS}
+                        : std::vector<GapDataType>{GapDataType::INCOMPLETE_LIST_128_BIT_UUIDS,
+                                                   GapDataType::COMPLETE_LIST_128_BIT_UUIDS},
+           Uuid::kNumBytes128});
+      for (const auto& [ad_types, element_size] : representations) {
+        size_t offset = element_size == Uuid::kNumBytes128 ? 0 : kShortUuidOffset;
+        for (GapDataType ad_type : ad_types) {
+          AddCondition(
+              static_cast<uint8_t>(ad_type),
+              filter,
+              content_filter.filter_type,
+              element_size,
+              false,
+              std::vector<uint8_t>(value.begin() + offset, value.begin() + offset + element_size),
+              std::vector<uint8_t>(mask.begin() + offset, mask.begin() + offset + element_size));
+        }
+      }
+    } break;
+    case ApcfFilterType::LOCAL_NAME: {
+      for (GapDataType ad_type : {GapDataType::SHORTENED_LOCAL_NAME, GapDataType::COMPLETE_LOCAL_NAME}) {
+        AddCondition(
+            static_cast<uint8_t>(ad_type),
+            filter,
+            content_filter.filter_type,
+            0,
+            true,
+            content_filter.name,
+            std::vector<uint8_t>(content_filter.name.size(), 0xff));
+      }
+    } break;
+    case ApcfFilterType::MANUFACTURER_DATA: {
+      uint16_t company_mask = content_filter.company_mask != 0 ? content_filter.company_mask : 0xffff;
+      std::vector<uint8_t> value = {
+          static_cast<uint8_t>(content_filter.company), static_cast<uint8_t>(content_filter.company >> 8)};
+      value.insert(value.end(), content_filter.data.begin(), content_filter.data.end());
+      std::vector<uint8_t> mask = {static_cast<uint8_t>(company_mask), static_cast<uint8_t>(company_mask >> 8)};
+      auto data_mask = MaskOrAllOnes(content_filter.data_mask, content_filter.data.size());
+      mask.insert(mask.end(), data_mask.begin(), data_mask.end());
+      AddCondition(
+          static_cast<uint8_t>(GapDataType::MANUFACTURER_SPECIFIC_DATA),
+          filter,
+          content_filter.filter_type,
+          0,
+          false,
+          std::move(value),
+          std::move(mask));
+    } break;
+    case ApcfFilterType::SERVICE_DATA: {
+      // The data starts with the service UUID
+      for (GapDataType ad_type :
+           {GapDataType::SERVICE_DATA_16_BIT_UUIDS,
+            GapDataType::SERVICE_DATA_32_BIT_UUIDS,
+            GapDataType::SERVICE_DATA_128_BIT_UUIDS}) {
+        AddCondition(
+            static_cast<uint8_t>(ad_type),
+            filter,
+            content_filter.filter_type,
+            0,
+            false,
+            content_filter.data,
+            MaskOrAllOnes(content_filter.data_mask, content_filter.data.size()));
+      }
+    } break;
+    case ApcfFilterType::TRANSPORT_DISCOVERY_DATA: {
+      AddCondition(
+          static_cast<uint8_t>(GapDataType::TRANSPORT_DISCOVERY_DATA),
+          filter,
+          content_filter.filter_type,
+          0,
+          false,
+          {content_filter.org_id, content_filter.tds_flags},
+          {0xff, content_filter.tds_flags_mask});
+    } break;
+    case ApcfFilterType::AD_TYPE: {
+      AddCondition(
+          content_filter.ad_type,
+          filter,
+          content_filter.filter_type,
+          0,
+          false,
+          content_filter.data,
+          MaskOrAllOnes(content_filter.data_mask, content_filter.data.size()));
+    } break;
+    default: {
+      LOG_WARN("Filter type %d is not supported in software", static_cast<int>(content_filter.filter_type));
+      return;
+    }
+  }
+  compiled_filters_[filter].required_types |= FilterTypeBit(content_filter.filter_type);
+}
+
+void LeScanningSoftwareFilter::AddCondition(
+    uint8_t ad_type,
+    uint16_t filter,
+    ApcfFilterType filter_type,
+    uint8_t element_size,
+    bool exact_size,
+    std::vector<uint8_t> value,
+    std::vector<uint8_t> mask) {
+  if (mask.size() != value.size()) {
+    LOG_WARN("Ignoring filter with a mask of %zu bytes for %zu bytes of data", mask.size(), value.size());
+    return;
+  }
+  conditions_by_ad_type_[ad_type].push_back(conditions_.size());
+  conditions_.push_back(
+      {.filter = filter,
+       .type_bit = FilterTypeBit(filter_type),
+       .element_size = element_size,
+       .exact_size = exact_size,
+       .value = std::move(value),
+       .mask = std::move(mask)});
+}
+
+}  // namespace bluetooth::hci
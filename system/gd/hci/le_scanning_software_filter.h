@@ -0,0 +1,124 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "hci/address.h"
+#include "hci/le_scanning_callback.h"
+
+namespace bluetooth::hci {
+
+/// The LE Scanning software filter matches complete advertising reports
+/// against APCF content filters, for the filters that do not fit in the
+/// controller.
+/// As with the filters programmed by the stack into the controller, the
+/// entries of a filter index of the same type are alternatives, and all the
+/// types used by a filter index must match. A report is accepted when any
+/// filter index matches it.
+
+class LeScanningSoftwareFilter {
+ public:
+  /// Filter indexes are 8 bits wide.
+  static constexpr size_t kMaximumFilters = 256;
+
+  LeScanningSoftwareFilter() = default;
+
+  LeScanningSoftwareFilter(const LeScanningSoftwareFilter&) = delete;
+
+  LeScanningSoftwareFilter& operator=(const LeScanningSoftwareFilter&) = delete;
+
+  /// Add a content filter to a filter index.
+  void AddFilter(uint8_t filter_index, const AdvertisingPacketContentFilterCommand& filter);
+
+  /// Enable a filter index, like the APCF filtering parameters do. Reports
+  /// with a lower RSSI are ignored.
+  void SetParameters(uint8_t filter_index, int8_t rssi_threshold);
+
+  /// Remove a filter index with its content filters.
+  void RemoveFilter(uint8_t filter_index);
+
+  /// Remove all the filters.
+  void Clear();
+
+  /// Number of filter indexes with their parameters set.
+  size_t NumFilters() const;
+
+  /// Returns true if any filter index accepts the report.
+  bool Matches(const Address& address, int8_t rssi, const std::vector<uint8_t>& advertising_data);
+
+ private:
+  /// Bit of each filter type in the set of types used by a filter index.
+  static constexpr uint16_t FilterTypeBit(ApcfFilterType filter_type) {
+    return 1 << static_cast<uint8_t>(filter_type);
+  }
+
+  struct Filter {
+    bool enabled{false};
+    int8_t rssi_threshold{-128};
+    std::vector<AdvertisingPacketContentFilterCommand> content_filters;
+  };
+
+  /// Masked comparison of one AD structure payload, compiled from a content
+  /// filter. When element_size is not zero the payload is a list, and any
+  /// element may match.
+  struct Condition {
+    uint16_t filter;
+    uint16_t type_bit;
+    uint8_t element_size;
+    bool exact_size;
+    std::vector<uint8_t> value;
+    std::vector<uint8_t> mask;
+
+    bool Matches(const uint8_t* payload, size_t size) const;
+  };
+
+  struct CompiledFilter {
+    uint16_t required_types;
+    int8_t rssi_threshold;
+    std::vector<Address> addresses;
+  };
+
+  void Compile();
+
+  void CompileContentFilter(uint16_t filter, const AdvertisingPacketContentFilterCommand& content_filter);
+
+  void AddCondition(
+      uint8_t ad_type,
+      uint16_t filter,
+      ApcfFilterType filter_type,
+      uint8_t element_size,
+      bool exact_size,
+      std::vector<uint8_t> value,
+      std::vector<uint8_t> mask);
+
+  std::map<uint8_t, Filter> filters_;
+
+  /// Compiled form of the enabled filters: the conditions to evaluate for
+  /// each AD type, so that every AD structure of a report is only looked at
+  /// by the conditions that may match it.
+  bool compiled_{true};
+  std::vector<CompiledFilter> compiled_filters_;
+  std::vector<Condition> conditions_;
+  std::array<std::vector<uint16_t>, 256> conditions_by_ad_type_;
+  /// Types matched so far by each compiled filter, reused across reports.
+  std::vector<uint16_t> matched_types_;
+};
+
+}  // namespace bluetooth::hci
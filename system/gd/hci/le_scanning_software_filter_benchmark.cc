@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "hci/le_scanning_software_filter.h"
+
+using ::benchmark::State;
+
+namespace bluetooth {
+namespace hci {
+
+namespace {
+
+// Flags, a list of 16 bit UUIDs, a complete local name and manufacturer data
+const std::vector<uint8_t> kAdvertisingData = {
+    0x02, 0x01, 0x06, 0x07, 0x03, 0x0f, 0x18, 0x0d, 0x18, 0x0a, 0x18, 0x09, 0x09, 'b', 'e', 'n',
+    'c',  'h',  'm',  'a',  'r',  'k',  0x0b, 0xff, 0xe0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09};
+
+// Filter index i alternates service UUID, local name and manufacturer data
+// filters that none of the reports match, as when most apps wait for
+// devices that are not around.
+void AddFilters(LeScanningSoftwareFilter& software_filter, size_t num_filters) {
+  for (size_t i = 0; i < num_filters; i++) {
+    AdvertisingPacketContentFilterCommand filter{};
+    switch (i % 3) {
+      case 0:
+        filter.filter_type = ApcfFilterType::SERVICE_UUID;
+        filter.uuid = Uuid::From16Bit(0x2000 + i);
+        break;
+      case 1:
+        filter.filter_type = ApcfFilterType::LOCAL_NAME;
+        filter.name = {'d', 'e', 'v', static_cast<uint8_t>(i)};
+        break;
+      case 2:
+        filter.filter_type = ApcfFilterType::MANUFACTURER_DATA;
+        filter.company = 0x00e0;
+        filter.data = {0x01, 0x02, static_cast<uint8_t>(i)};
+        break;
+    }
+    software_filter.AddFilter(i, filter);
+    software_filter.SetParameters(i, -128);
+  }
+}
+
+}  // namespace
+
+static void BM_LeScanningSoftwareFilterMatches(State& state) {
+  LeScanningSoftwareFilter software_filter;
+  AddFilters(software_filter, state.range(0));
+  Address address({0x01, 0x02, 0x03, 0x04, 0x05, 0x06});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(software_filter.Matches(address, -60, kAdvertisingData));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LeScanningSoftwareFilterMatches)->Arg(16)->Arg(64)->Arg(256);
+
+}  // namespace hci
+}  // namespace bluetooth
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hci/le_scanning_software_filter.h"
+
+#include <gtest/gtest.h>
+
+namespace bluetooth::hci {
+
+// Test addresses.
+static const Address kTestAddress1 = Address({0, 1, 2, 3, 4, 5});
+static const Address kTestAddress2 = Address({0, 1, 2, 3, 4, 6});
+
+static constexpr int8_t kRssi = -60;
+
+// Flags, complete list of 16 bit UUIDs 0x180f and 0x180d, complete local name "dev"
+// and manufacturer data of company 0x00e0.
+static const std::vector<uint8_t> kAdvertisingData = {
+    0x2, 0x1, 0x6, 0x5, 0x3, 0x0f, 0x18, 0x0d, 0x18, 0x4, 0x9, 'd', 'e', 'v', 0x5, 0xff, 0xe0, 0x00, 0x1, 0x2};
+
+class LeScanningSoftwareFilterTest : public ::testing::Test {
+ protected:
+  static AdvertisingPacketContentFilterCommand ServiceUuid(Uuid uuid) {
+    AdvertisingPacketContentFilterCommand filter{};
+    filter.filter_type = ApcfFilterType::SERVICE_UUID;
+    filter.uuid = uuid;
+    return filter;
+  }
+
+  static AdvertisingPacketContentFilterCommand LocalName(std::string name) {
+    AdvertisingPacketContentFilterCommand filter{};
+    filter.filter_type = ApcfFilterType::LOCAL_NAME;
+    filter.name = std::vector<uint8_t>(name.begin(), name.end());
+    return filter;
+  }
+
+  static AdvertisingPacketContentFilterCommand ManufacturerData(
+      uint16_t company, std::vector<uint8_t> data, std::vector<uint8_t> data_mask) {
+    AdvertisingPacketContentFilterCommand filter{};
+    filter.filter_type = ApcfFilterType::MANUFACTURER_DATA;
+    filter.company = company;
+    filter.data = data;
+    filter.data_mask = data_mask;
+    return filter;
+  }
+
+  static AdvertisingPacketContentFilterCommand BroadcasterAddress(Address address) {
+    AdvertisingPacketContentFilterCommand filter{};
+    filter.filter_type = ApcfFilterType::BROADCASTER_ADDRESS;
+    filter.address = address;
+    return filter;
+  }
+
+  LeScanningSoftwareFilter filter_;
+};
+
+TEST_F(LeScanningSoftwareFilterTest, no_filter) {
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, filter_needs_parameters) {
+  filter_.AddFilter(0, LocalName("dev"));
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+  filter_.SetParameters(0, -128);
+  ASSERT_EQ(filter_.NumFilters(), 1u);
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, service_uuid) {
+  filter_.AddFilter(0, ServiceUuid(Uuid::From16Bit(0x180d)));
+  filter_.SetParameters(0, -128);
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+
+  filter_.RemoveFilter(0);
+  filter_.AddFilter(0, ServiceUuid(Uuid::From16Bit(0x180a)));
+  filter_.SetParameters(0, -128);
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+
+  // 16 bit UUIDs also match their 128 bit representation
+  auto uuid = Uuid::From16Bit(0x180a).To128BitLE();
+  std::vector<uint8_t> data = {0x11, 0x7};
+  data.insert(data.end(), uuid.begin(), uuid.end());
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, kRssi, data));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, local_name) {
+  filter_.AddFilter(0, LocalName("de"));
+  filter_.SetParameters(0, -128);
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+  filter_.AddFilter(0, LocalName("dev"));
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, manufacturer_data) {
+  filter_.AddFilter(0, ManufacturerData(0x00e0, {0x1, 0x3}, {0xff, 0x0}));
+  filter_.SetParameters(0, -128);
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+
+  filter_.AddFilter(1, ManufacturerData(0x00e0, {0x1, 0x3}, {}));
+  filter_.SetParameters(1, -128);
+  filter_.RemoveFilter(0);
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, all_filter_types_must_match) {
+  filter_.AddFilter(0, BroadcasterAddress(kTestAddress1));
+  filter_.AddFilter(0, LocalName("dev"));
+  filter_.SetParameters(0, -128);
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+  ASSERT_FALSE(filter_.Matches(kTestAddress2, kRssi, kAdvertisingData));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, any_filter_index_may_match) {
+  filter_.AddFilter(0, BroadcasterAddress(kTestAddress2));
+  filter_.SetParameters(0, -128);
+  filter_.AddFilter(1, LocalName("other"));
+  filter_.SetParameters(1, -128);
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+  filter_.AddFilter(2, ServiceUuid(Uuid::From16Bit(0x180f)));
+  filter_.SetParameters(2, -128);
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+  filter_.Clear();
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, rssi_threshold) {
+  filter_.AddFilter(0, LocalName("dev"));
+  filter_.SetParameters(0, -50);
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, kAdvertisingData));
+  ASSERT_TRUE(filter_.Matches(kTestAddress1, -50, kAdvertisingData));
+}
+
+TEST_F(LeScanningSoftwareFilterTest, malformed_advertising_data) {
+  filter_.AddFilter(0, LocalName("dev"));
+  filter_.SetParameters(0, -128);
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, {0x4, 0x9, 'd', 'e'}));
+  ASSERT_FALSE(filter_.Matches(kTestAddress1, kRssi, {}));
+}
+
+}  // namespace bluetooth::hci
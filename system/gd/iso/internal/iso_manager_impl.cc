@@ -251,14 +251,15 @@ void IsoManagerImpl::RemoveCigComplete(hci::CommandCompleteView command_complete
 }
 
 void IsoManagerImpl::SendIsoPacket(uint16_t cis_handle, std::vector<uint8_t> packet) {
+  uint16_t iso_sdu_length = packet.size();
+  // The payload is moved all the way into the builder, SDUs are not copied on the way down
   auto builder = hci::IsoWithoutTimestampBuilder::Create(
       cis_handle,
       hci::IsoPacketBoundaryFlag::COMPLETE_SDU,
       0 /* sequence_number */,
-      packet.size() /* iso_sdu_length */,
+      iso_sdu_length,
       hci::IsoPacketStatusFlag::VALID,
-      std::make_unique<bluetooth::packet::RawBuilder>(packet));
-  LOG_INFO("%c%c", packet[0], packet[1]);
+      std::make_unique<bluetooth::packet::RawBuilder>(std::move(packet)));
   iso_enqueue_buffer_->Enqueue(std::move(builder), iso_handler_);
 }
 
@@ -97,7 +97,7 @@ void IsoManager::RemoveCig(uint8_t cig_id) {
 }
 
 void IsoManager::SendIsoPacket(uint16_t cis_handle, std::vector<uint8_t> packet) {
-  iso_handler_->CallOn(iso_manager_impl_, &internal::IsoManagerImpl::SendIsoPacket, cis_handle, packet);
+  iso_handler_->CallOn(iso_manager_impl_, &internal::IsoManagerImpl::SendIsoPacket, cis_handle, std::move(packet));
 }
 
 }  // namespace iso
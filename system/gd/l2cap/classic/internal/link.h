@@ -232,7 +232,7 @@ class Link : public l2cap::internal::ILink,
   FixedChannelServiceManagerImpl* fixed_service_manager_;
   LinkManager* link_manager_;
   std::unordered_map<Cid, PendingDynamicChannelConnection> local_cid_to_pending_dynamic_channel_connection_map_;
-  os::Alarm link_idle_disconnect_alarm_{l2cap_handler_};
+  os::Alarm link_idle_disconnect_alarm_{l2cap_handler_, os::AlarmClass::LAZY};
   ClassicSignallingManager signalling_manager_;
   uint16_t acl_handle_;
   Mtu remote_connectionless_mtu_ = kMinimumClassicMtu;
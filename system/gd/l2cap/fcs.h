@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace bluetooth {
@@ -28,8 +29,14 @@ class Fcs {
 
   void AddByte(uint8_t byte);
 
+  // Same result as calling AddByte() on each byte, but processes 8 bytes per step.
+  void AddBytes(const uint8_t* data, size_t length);
+
   uint16_t GetChecksum() const;
 
+  // Continues the checksum |crc| over a contiguous buffer.
+  static uint16_t Compute(uint16_t crc, const uint8_t* data, size_t length);
+
  private:
   uint16_t crc;
 };
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "l2cap/fcs.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace bluetooth {
+namespace l2cap {
+namespace {
+
+uint16_t ChecksumByteByByte(const std::vector<uint8_t>& data, size_t begin, size_t end) {
+  Fcs fcs;
+  fcs.Initialize();
+  for (size_t i = begin; i < end; i++) {
+    fcs.AddByte(data[i]);
+  }
+  return fcs.GetChecksum();
+}
+
+TEST(L2capFcsTest, check_value) {
+  std::string input = "123456789";
+  std::vector<uint8_t> data(input.begin(), input.end());
+  ASSERT_EQ(ChecksumByteByByte(data, 0, data.size()), 0xbb3d);
+
+  Fcs fcs;
+  fcs.Initialize();
+  fcs.AddBytes(data.data(), data.size());
+  ASSERT_EQ(fcs.GetChecksum(), 0xbb3d);
+}
+
+TEST(L2capFcsTest, add_bytes_matches_add_byte) {
+  std::vector<uint8_t> data(300);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<uint8_t>(i * 37 + 11);
+  }
+  // Cover every alignment and every length of the tail that is not a multiple of 8
+  for (size_t begin = 0; begin < 8; begin++) {
+    for (size_t end = begin; end <= data.size(); end++) {
+      ASSERT_EQ(Fcs::Compute(0, data.data() + begin, end - begin), ChecksumByteByByte(data, begin, end))
+          << "begin " << begin << " end " << end;
+    }
+  }
+}
+
+TEST(L2capFcsTest, add_bytes_continues_checksum) {
+  std::vector<uint8_t> data(100, 0xa5);
+  Fcs fcs;
+  fcs.Initialize();
+  fcs.AddBytes(data.data(), 13);
+  fcs.AddByte(data[13]);
+  fcs.AddBytes(data.data() + 14, data.size() - 14);
+  ASSERT_EQ(fcs.GetChecksum(), ChecksumByteByByte(data, 0, data.size()));
+}
+
+}  // namespace
+}  // namespace l2cap
+}  // namespace bluetooth
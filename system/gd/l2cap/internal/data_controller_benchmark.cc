@@ -0,0 +1,198 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "common/bidi_queue.h"
+#include "l2cap/internal/basic_mode_channel_data_controller.h"
+#include "l2cap/internal/enhanced_retransmission_mode_channel_data_controller.h"
+#include "l2cap/internal/ilink.h"
+#include "l2cap/internal/le_credit_based_channel_data_controller.h"
+#include "l2cap/internal/scheduler.h"
+#include "l2cap/l2cap_packets.h"
+#include "os/handler.h"
+#include "os/thread.h"
+#include "packet/bit_inserter.h"
+#include "packet/raw_builder.h"
+
+using ::benchmark::State;
+
+namespace bluetooth {
+namespace l2cap {
+namespace internal {
+
+namespace {
+
+constexpr Cid kCid = 0x41;
+constexpr Cid kRemoteCid = 0x42;
+constexpr uint16_t kLeMps = 247;
+
+// Counts the packets the data controller announces, standing in for the link scheduler
+class CountingScheduler : public Scheduler {
+ public:
+  void OnPacketsReady(Cid /* cid */, int number_packets) override {
+    ready_packets_ += number_packets;
+  }
+  int ready_packets_ = 0;
+};
+
+class NullLink : public ILink {
+ public:
+  void SendDisconnectionRequest(Cid /* local_cid */, Cid /* remote_cid */) override {}
+  hci::AddressWithType GetDevice() const override {
+    return hci::AddressWithType();
+  }
+};
+
+std::unique_ptr<packet::BasePacketBuilder> CreateSdu(size_t size) {
+  std::vector<uint8_t> payload(size);
+  for (size_t i = 0; i < size; i++) {
+    payload[i] = static_cast<uint8_t>(i);
+  }
+  return std::make_unique<packet::RawBuilder>(std::move(payload));
+}
+
+double Percentile(std::vector<std::chrono::nanoseconds>& samples, double fraction) {
+  if (samples.empty()) {
+    return 0;
+  }
+  auto nth = samples.begin() + static_cast<size_t>(fraction * (samples.size() - 1));
+  std::nth_element(samples.begin(), nth, samples.end());
+  return std::chrono::duration<double, std::micro>(*nth).count();
+}
+
+class BM_DataController : public ::benchmark::Fixture {
+ public:
+  void SetUp(State& /* state */) override {
+    thread_ = new os::Thread("benchmark_thread", os::Thread::Priority::NORMAL);
+    handler_ = new os::Handler(thread_);
+  }
+
+  void TearDown(State& /* state */) override {
+    handler_->Clear();
+    delete handler_;
+    delete thread_;
+  }
+
+ protected:
+  // Send one SDU per iteration and serialize every PDU the controller produces, as the link would before handing
+  // them to the ACL queue. |after_sdu| runs once the PDUs are drained, outside of the measured latency.
+  template <typename AfterSdu>
+  void Run(State& state, DataController* controller, AfterSdu after_sdu) {
+    const size_t sdu_size = state.range(0);
+    std::vector<uint8_t> pdu_bytes;
+    std::vector<std::chrono::nanoseconds> latencies;
+    size_t pdus = 0;
+    for (auto _ : state) {
+      auto sdu = CreateSdu(sdu_size);
+      auto start = std::chrono::steady_clock::now();
+      controller->OnSdu(std::move(sdu));
+      while (scheduler_.ready_packets_ > 0) {
+        scheduler_.ready_packets_--;
+        auto pdu = controller->GetNextPacket();
+        pdu_bytes.clear();
+        pdu_bytes.reserve(pdu->size());
+        BitInserter inserter(pdu_bytes);
+        pdu->Serialize(inserter);
+        after_sdu.OnPdu(pdu_bytes);
+        pdus++;
+      }
+      latencies.push_back(std::chrono::steady_clock::now() - start);
+      after_sdu.OnSduSent(controller);
+    }
+    state.SetBytesProcessed(state.iterations() * sdu_size);
+    state.counters["pdus_per_sdu"] = static_cast<double>(pdus) / state.iterations();
+    state.counters["p50_latency_us"] = Percentile(latencies, 0.5);
+    state.counters["p99_latency_us"] = Percentile(latencies, 0.99);
+  }
+
+  struct NoPeer {
+    void OnPdu(const std::vector<uint8_t>& /* pdu */) {}
+    void OnSduSent(DataController* /* controller */) {}
+  };
+
+  os::Thread* thread_ = nullptr;
+  os::Handler* handler_ = nullptr;
+  CountingScheduler scheduler_;
+  NullLink link_;
+  common::BidiQueue<Scheduler::UpperEnqueue, Scheduler::UpperDequeue> channel_queue_{10};
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(BM_DataController, basic_mode)(State& state) {
+  BasicModeDataController controller(kCid, kRemoteCid, channel_queue_.GetDownEnd(), handler_, &scheduler_);
+  Run(state, &controller, NoPeer{});
+}
+
+BENCHMARK_DEFINE_F(BM_DataController, enhanced_retransmission_mode)(State& state) {
+  ErtmController controller(&link_, kCid, kRemoteCid, channel_queue_.GetDownEnd(), handler_, &scheduler_);
+  // The peer acknowledges every I-frame once the SDU is sent, so the transmit window never fills up
+  struct AckingPeer {
+    void OnPdu(const std::vector<uint8_t>& pdu) {
+      auto bytes = std::make_shared<std::vector<uint8_t>>(pdu);
+      auto standard_frame = StandardFrameView::Create(BasicFrameView::Create(PacketView<kLittleEndian>(bytes)));
+      if (!standard_frame.IsValid() || standard_frame.GetFrameType() != FrameType::I_FRAME) {
+        return;
+      }
+      auto i_frame = EnhancedInformationFrameView::Create(standard_frame);
+      next_tx_seq = (i_frame.GetTxSeq() + 1) % 64;
+    }
+    void OnSduSent(DataController* controller) {
+      auto ack = EnhancedSupervisoryFrameBuilder::Create(
+          kCid, SupervisoryFunction::RECEIVER_READY, Poll::NOT_SET, Final::NOT_SET, next_tx_seq);
+      auto bytes = std::make_shared<std::vector<uint8_t>>();
+      BitInserter inserter(*bytes);
+      ack->Serialize(inserter);
+      controller->OnPdu(PacketView<kLittleEndian>(bytes));
+    }
+    uint8_t next_tx_seq = 0;
+  };
+  Run(state, &controller, AckingPeer{});
+}
+
+BENCHMARK_DEFINE_F(BM_DataController, le_credit_based_mode)(State& state) {
+  LeCreditBasedDataController controller(
+      &link_, kCid, kRemoteCid, channel_queue_.GetDownEnd(), handler_, &scheduler_);
+  controller.SetMtu(state.range(0));
+  controller.SetMps(kLeMps);
+  // The peer returns the credits used by each SDU, as a receiver keeping up with the sender would
+  struct CreditingPeer {
+    void OnPdu(const std::vector<uint8_t>& /* pdu */) {
+      used_credits++;
+    }
+    void OnSduSent(DataController* controller) {
+      static_cast<LeCreditBasedDataController*>(controller)->OnCredit(used_credits);
+      used_credits = 0;
+    }
+    uint16_t used_credits = 0;
+  };
+  controller.OnCredit(64);
+  Run(state, &controller, CreditingPeer{});
+}
+
+// Small control SDU, default classic MTU, typical LE audio and OTS SDUs, large file transfer SDU
+BENCHMARK_REGISTER_F(BM_DataController, basic_mode)->Arg(48)->Arg(672)->Arg(4096)->Arg(8192);
+BENCHMARK_REGISTER_F(BM_DataController, enhanced_retransmission_mode)->Arg(48)->Arg(672)->Arg(4096)->Arg(8192);
+BENCHMARK_REGISTER_F(BM_DataController, le_credit_based_mode)->Arg(48)->Arg(672)->Arg(4096)->Arg(8192);
+
+}  // namespace internal
+}  // namespace l2cap
+}  // namespace bluetooth
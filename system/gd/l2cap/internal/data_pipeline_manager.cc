@@ -22,11 +22,24 @@
 #include "l2cap/internal/data_pipeline_manager.h"
 #include "l2cap/internal/sender.h"
 #include "os/log.h"
+#include "os/system_properties.h"
 
 namespace bluetooth {
 namespace l2cap {
 namespace internal {
 
+namespace {
+constexpr char kPropertyScheduler[] = "bluetooth.l2cap.scheduler";
+}  // namespace
+
+std::unique_ptr<Scheduler> DataPipelineManager::CreateScheduler(
+    DataPipelineManager* data_pipeline_manager, LowerQueueUpEnd* link_queue_up_end, os::Handler* handler) {
+  if (os::GetSystemProperty(kPropertyScheduler).value_or("") == "fifo") {
+    return std::make_unique<Fifo>(data_pipeline_manager, link_queue_up_end, handler);
+  }
+  return std::make_unique<WeightedFair>(data_pipeline_manager, link_queue_up_end, handler);
+}
+
 void DataPipelineManager::AttachChannel(Cid cid, std::shared_ptr<ChannelImpl> channel, ChannelMode mode) {
   ASSERT(sender_map_.find(cid) == sender_map_.end());
   sender_map_.emplace(std::piecewise_construct, std::forward_as_tuple(cid),
@@ -62,6 +75,11 @@ void DataPipelineManager::SetChannelTxPriority(Cid cid, bool high_priority) {
   scheduler_->SetChannelTxPriority(cid, high_priority);
 }
 
+void DataPipelineManager::SetChannelTxWeight(Cid cid, uint16_t weight) {
+  ASSERT(sender_map_.find(cid) != sender_map_.end());
+  scheduler_->SetChannelTxWeight(cid, weight);
+}
+
 }  // namespace internal
 }  // namespace l2cap
 }  // namespace bluetooth
@@ -121,6 +121,22 @@ TEST_F(LeCreditBasedDataControllerTest, transmit_segmented) {
   EXPECT_EQ(data, "cd");
 }
 
+TEST_F(LeCreditBasedDataControllerTest, transmit_pending_frames_use_up_credits) {
+  common::BidiQueue<Scheduler::UpperEnqueue, Scheduler::UpperDequeue> channel_queue{10};
+  testing::MockScheduler scheduler;
+  testing::MockILink link;
+  LeCreditBasedDataController controller{&link, 0x41, 0x41, channel_queue.GetDownEnd(), queue_handler_, &scheduler};
+  controller.SetMps(4);
+  // No credits yet, both segments stay pending
+  controller.OnSdu(CreateSdu({'a', 'b', 'c', 'd'}));
+  EXPECT_CALL(scheduler, OnPacketsReady(0x41, 2));
+  controller.OnCredit(3);
+  // Only one credit is left after the pending segments were released
+  EXPECT_CALL(scheduler, OnPacketsReady(0x41, 1));
+  controller.OnSdu(CreateSdu({'e', 'f'}));
+  controller.OnSdu(CreateSdu({'g', 'h'}));
+}
+
 TEST_F(LeCreditBasedDataControllerTest, receive_unsegmented) {
   common::BidiQueue<Scheduler::UpperEnqueue, Scheduler::UpperDequeue> channel_queue{10};
   testing::MockScheduler scheduler;
@@ -61,6 +61,12 @@ class Scheduler {
    */
   virtual void SetChannelTxPriority(Cid /* cid */, bool /* high_priority */) {}
 
+  /**
+   * Share of the link given to the cid relative to the other channels with
+   * packets to send, for schedulers that support it.
+   */
+  virtual void SetChannelTxWeight(Cid /* cid */, uint16_t /* weight */) {}
+
   /**
    * Called by data controller to indicate that a channel is closed and packets
    * should be dropped
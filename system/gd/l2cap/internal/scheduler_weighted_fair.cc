@@ -0,0 +1,147 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "l2cap/internal/scheduler_weighted_fair.h"
+
+#include <algorithm>
+
+#include "l2cap/internal/data_pipeline_manager.h"
+#include "os/log.h"
+
+namespace bluetooth {
+namespace l2cap {
+namespace internal {
+
+WeightedFair::WeightedFair(
+    DataPipelineManager* data_pipeline_manager, LowerQueueUpEnd* link_queue_up_end, os::Handler* handler)
+    : data_pipeline_manager_(data_pipeline_manager), link_queue_up_end_(link_queue_up_end), handler_(handler) {
+  ASSERT(link_queue_up_end_ != nullptr && handler_ != nullptr);
+}
+
+// Invoked from some external Handler context
+WeightedFair::~WeightedFair() {
+  try_unregister_link_queue_enqueue();
+}
+
+// Invoked within L2CAP Handler context
+void WeightedFair::OnPacketsReady(Cid cid, int number_packets) {
+  if (number_packets <= 0) {
+    return;
+  }
+  auto& channel = channels_[cid];
+  if (channel.ready_packets == 0) {
+    active_channels_.push_back(cid);
+  }
+  channel.ready_packets += number_packets;
+  try_register_link_queue_enqueue();
+}
+
+// Invoked within L2CAP Handler context
+void WeightedFair::SetChannelTxPriority(Cid cid, bool high_priority) {
+  auto channel = channels_.find(cid);
+  if (channel == channels_.end()) {
+    if (high_priority) {
+      channels_[cid].high_priority = true;
+    }
+    return;
+  }
+  channel->second.high_priority = high_priority;
+}
+
+// Invoked within L2CAP Handler context
+void WeightedFair::SetChannelTxWeight(Cid cid, uint16_t weight) {
+  if (weight == 0) {
+    LOG_WARN("Invalid weight 0 for cid 0x%x, using %d", cid, kDefaultWeight);
+    weight = kDefaultWeight;
+  }
+  channels_[cid].weight = weight;
+}
+
+// Invoked within L2CAP Handler context
+void WeightedFair::RemoveChannel(Cid cid) {
+  channels_.erase(cid);
+  active_channels_.remove(cid);
+  if (active_channels_.empty()) {
+    try_unregister_link_queue_enqueue();
+  }
+}
+
+Cid WeightedFair::select_next_channel() {
+  for (Cid cid : active_channels_) {
+    if (channels_[cid].high_priority) {
+      return cid;
+    }
+  }
+  // Terminates since every turn adds a positive amount to the deficit of the channel
+  while (true) {
+    Cid cid = active_channels_.front();
+    auto& channel = channels_[cid];
+    if (!channel.has_turn) {
+      channel.has_turn = true;
+      channel.deficit += channel.weight * kQuantum;
+    }
+    if (channel.deficit > 0) {
+      return cid;
+    }
+    channel.has_turn = false;
+    active_channels_.splice(active_channels_.end(), active_channels_, active_channels_.begin());
+  }
+}
+
+// Invoked from some external Queue Reactable context
+std::unique_ptr<WeightedFair::UpperDequeue> WeightedFair::link_queue_enqueue_callback() {
+  ASSERT(!active_channels_.empty());
+  Cid cid = select_next_channel();
+  auto& channel = channels_[cid];
+  channel.ready_packets--;
+  if (channel.ready_packets == 0) {
+    // An idle channel does not keep its unused deficit, only what it went over
+    active_channels_.remove(cid);
+    channel.deficit = std::min<int64_t>(channel.deficit, 0);
+    channel.has_turn = false;
+  }
+
+  auto packet = data_pipeline_manager_->GetDataController(cid)->GetNextPacket();
+  if (!channel.high_priority) {
+    channel.deficit -= static_cast<int64_t>(packet->size());
+  }
+  data_pipeline_manager_->OnPacketSent(cid);
+  if (active_channels_.empty()) {
+    try_unregister_link_queue_enqueue();
+  }
+  return packet;
+}
+
+void WeightedFair::try_register_link_queue_enqueue() {
+  if (link_queue_enqueue_registered_) {
+    return;
+  }
+  link_queue_enqueue_registered_ = true;
+  link_queue_up_end_->RegisterEnqueue(
+      handler_, common::Bind(&WeightedFair::link_queue_enqueue_callback, common::Unretained(this)));
+}
+
+void WeightedFair::try_unregister_link_queue_enqueue() {
+  if (!link_queue_enqueue_registered_) {
+    return;
+  }
+  link_queue_enqueue_registered_ = false;
+  link_queue_up_end_->UnregisterEnqueue();
+}
+
+}  // namespace internal
+}  // namespace l2cap
+}  // namespace bluetooth
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include "common/bidi_queue.h"
+#include "common/bind.h"
+#include "l2cap/cid.h"
+#include "l2cap/internal/scheduler.h"
+#include "os/handler.h"
+
+namespace bluetooth {
+namespace l2cap {
+namespace internal {
+class DataPipelineManager;
+
+/**
+ * Schedule the channels of a link with deficit round robin.
+ *
+ * Only the packets reported by OnPacketsReady() are dequeued from a channel, and data controllers
+ * only report the packets that may be sent with the current remote credits (LE credit based flow
+ * control) or transmit window (ERTM), so a blocked channel never holds the link. Channels set to
+ * high priority are served first. The other channels with ready packets take turns: at each turn
+ * a channel may send weight * kQuantum bytes, the excess of the last packet being carried over to
+ * its next turn, so a bulk channel can no longer delay the small packets of the other channels
+ * by more than one turn.
+ */
+class WeightedFair : public Scheduler {
+ public:
+  static constexpr uint16_t kDefaultWeight = 1;
+  static constexpr int64_t kQuantum = 1024;
+
+  WeightedFair(DataPipelineManager* data_pipeline_manager, LowerQueueUpEnd* link_queue_up_end, os::Handler* handler);
+  ~WeightedFair();
+  void OnPacketsReady(Cid cid, int number_packets) override;
+  void SetChannelTxPriority(Cid cid, bool high_priority) override;
+  void SetChannelTxWeight(Cid cid, uint16_t weight) override;
+  void RemoveChannel(Cid cid) override;
+
+ private:
+  struct ChannelState {
+    int ready_packets = 0;
+    bool high_priority = false;
+    uint16_t weight = kDefaultWeight;
+    // Bytes left in the current turn, negative when the last packet went over it
+    int64_t deficit = 0;
+    bool has_turn = false;
+  };
+
+  DataPipelineManager* data_pipeline_manager_;
+  LowerQueueUpEnd* link_queue_up_end_;
+  os::Handler* handler_;
+  std::unordered_map<Cid, ChannelState> channels_;
+  // Channels with ready packets, in round order; the channel at the front has the turn
+  std::list<Cid> active_channels_;
+  bool link_queue_enqueue_registered_ = false;
+
+  Cid select_next_channel();
+  void try_register_link_queue_enqueue();
+  void try_unregister_link_queue_enqueue();
+  std::unique_ptr<LowerEnqueue> link_queue_enqueue_callback();
+};
+
+}  // namespace internal
+}  // namespace l2cap
+}  // namespace bluetooth
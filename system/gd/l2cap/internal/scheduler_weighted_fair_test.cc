@@ -0,0 +1,182 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "l2cap/internal/scheduler_weighted_fair.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "l2cap/internal/channel_impl_mock.h"
+#include "l2cap/internal/data_controller_mock.h"
+#include "l2cap/internal/data_pipeline_manager_mock.h"
+#include "os/handler.h"
+#include "os/mock_queue.h"
+#include "os/thread.h"
+#include "packet/raw_builder.h"
+
+namespace bluetooth {
+namespace l2cap {
+namespace internal {
+namespace {
+
+using ::testing::_;
+using ::testing::Return;
+
+std::unique_ptr<packet::BasePacketBuilder> CreateSdu(std::vector<uint8_t> payload) {
+  auto raw_builder = std::make_unique<packet::RawBuilder>();
+  raw_builder->AddOctets(payload);
+  return raw_builder;
+}
+
+PacketView<kLittleEndian> GetPacketView(std::unique_ptr<packet::BasePacketBuilder> packet) {
+  auto bytes = std::make_shared<std::vector<uint8_t>>();
+  BitInserter i(*bytes);
+  bytes->reserve(packet->size());
+  packet->Serialize(i);
+  return packet::PacketView<packet::kLittleEndian>(bytes);
+}
+
+std::unique_ptr<packet::BasePacketBuilder> CreateFrame(Cid cid, size_t payload_size) {
+  return BasicFrameBuilder::Create(cid, CreateSdu(std::vector<uint8_t>(payload_size, 'x')));
+}
+
+class MyDataController : public testing::MockDataController {
+ public:
+  std::unique_ptr<BasePacketBuilder> GetNextPacket() override {
+    auto next = std::move(next_packets.front());
+    next_packets.pop();
+    return next;
+  }
+
+  std::queue<std::unique_ptr<BasePacketBuilder>> next_packets;
+};
+
+class L2capSchedulerWeightedFairTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    thread_ = new os::Thread("test_thread", os::Thread::Priority::NORMAL);
+    queue_handler_ = new os::Handler(thread_);
+    mock_data_pipeline_manager_ = new testing::MockDataPipelineManager(queue_handler_, &queue_end_);
+    scheduler_ = new WeightedFair(mock_data_pipeline_manager_, &queue_end_, queue_handler_);
+    EXPECT_CALL(*mock_data_pipeline_manager_, GetDataController(1)).WillRepeatedly(Return(&data_controller_1_));
+    EXPECT_CALL(*mock_data_pipeline_manager_, GetDataController(2)).WillRepeatedly(Return(&data_controller_2_));
+  }
+
+  void TearDown() override {
+    delete scheduler_;
+    delete mock_data_pipeline_manager_;
+    queue_handler_->Clear();
+    delete queue_handler_;
+    delete thread_;
+  }
+
+  // Channel ids of the enqueued packets, in sending order
+  std::vector<Cid> GetSentChannels() {
+    std::vector<Cid> channels;
+    while (!enqueue_.enqueued.empty()) {
+      auto packet_view = GetPacketView(std::move(enqueue_.enqueued.front()));
+      enqueue_.enqueued.pop();
+      auto basic_frame_view = BasicFrameView::Create(packet_view);
+      EXPECT_TRUE(basic_frame_view.IsValid());
+      channels.push_back(basic_frame_view.GetChannelId());
+    }
+    return channels;
+  }
+
+  os::Thread* thread_ = nullptr;
+  os::Handler* queue_handler_ = nullptr;
+  os::MockIQueueDequeue<Scheduler::LowerDequeue> dequeue_;
+  os::MockIQueueEnqueue<Scheduler::LowerEnqueue> enqueue_;
+  common::BidiQueueEnd<Scheduler::LowerEnqueue, Scheduler::LowerDequeue> queue_end_{&enqueue_, &dequeue_};
+  testing::MockDataPipelineManager* mock_data_pipeline_manager_ = nullptr;
+  MyDataController data_controller_1_;
+  MyDataController data_controller_2_;
+  WeightedFair* scheduler_ = nullptr;
+};
+
+TEST_F(L2capSchedulerWeightedFairTest, send_packet) {
+  auto frame = BasicFrameBuilder::Create(1, CreateSdu({'a', 'b', 'c'}));
+  data_controller_1_.next_packets.push(std::move(frame));
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(1));
+  scheduler_->OnPacketsReady(1, 1);
+  enqueue_.run_enqueue();
+  auto&& packet = enqueue_.enqueued.front();
+  auto packet_view = GetPacketView(std::move(packet));
+  auto basic_frame_view = BasicFrameView::Create(packet_view);
+  ASSERT_TRUE(basic_frame_view.IsValid());
+  ASSERT_EQ(basic_frame_view.GetChannelId(), 1);
+  auto payload = basic_frame_view.GetPayload();
+  ASSERT_EQ(std::string(payload.begin(), payload.end()), "abc");
+  enqueue_.enqueued.pop();
+  // Nothing left to send
+  ASSERT_EQ(enqueue_.registered_handler, nullptr);
+}
+
+TEST_F(L2capSchedulerWeightedFairTest, prioritize_channel) {
+  data_controller_1_.next_packets.push(CreateFrame(1, 3));
+  data_controller_2_.next_packets.push(CreateFrame(2, 3));
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(1));
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(2));
+  scheduler_->SetChannelTxPriority(1, true);
+  scheduler_->OnPacketsReady(2, 1);
+  scheduler_->OnPacketsReady(1, 1);
+  enqueue_.run_enqueue(2);
+  ASSERT_EQ(GetSentChannels(), std::vector<Cid>({1, 2}));
+}
+
+TEST_F(L2capSchedulerWeightedFairTest, remove_channel) {
+  data_controller_1_.next_packets.push(CreateFrame(1, 3));
+  data_controller_2_.next_packets.push(CreateFrame(2, 3));
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(2));
+  scheduler_->OnPacketsReady(1, 1);
+  scheduler_->OnPacketsReady(2, 1);
+  scheduler_->RemoveChannel(1);
+  enqueue_.run_enqueue(2);
+  ASSERT_EQ(GetSentChannels(), std::vector<Cid>({2}));
+}
+
+TEST_F(L2capSchedulerWeightedFairTest, channels_take_turns) {
+  // Every packet of channel 1 uses up a whole turn
+  for (int i = 0; i < 3; i++) {
+    data_controller_1_.next_packets.push(CreateFrame(1, WeightedFair::kQuantum));
+  }
+  data_controller_2_.next_packets.push(CreateFrame(2, 3));
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(1)).Times(3);
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(2));
+  scheduler_->OnPacketsReady(1, 3);
+  scheduler_->OnPacketsReady(2, 1);
+  enqueue_.run_enqueue(4);
+  ASSERT_EQ(GetSentChannels(), std::vector<Cid>({1, 2, 1, 1}));
+}
+
+TEST_F(L2capSchedulerWeightedFairTest, channels_share_link_by_weight) {
+  for (int i = 0; i < 3; i++) {
+    data_controller_1_.next_packets.push(CreateFrame(1, WeightedFair::kQuantum));
+    data_controller_2_.next_packets.push(CreateFrame(2, WeightedFair::kQuantum));
+  }
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(1)).Times(3);
+  EXPECT_CALL(*mock_data_pipeline_manager_, OnPacketSent(2)).Times(3);
+  scheduler_->SetChannelTxWeight(1, 2);
+  scheduler_->OnPacketsReady(1, 3);
+  scheduler_->OnPacketsReady(2, 3);
+  enqueue_.run_enqueue(6);
+  ASSERT_EQ(GetSentChannels(), std::vector<Cid>({1, 1, 2, 1, 2, 2}));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace l2cap
+}  // namespace bluetooth
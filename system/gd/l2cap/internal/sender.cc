@@ -24,6 +24,7 @@
 #include "l2cap/internal/sender.h"
 #include "os/handler.h"
 #include "os/log.h"
+#include "os/trace.h"
 
 namespace bluetooth {
 namespace l2cap {
@@ -82,6 +83,7 @@ void Sender::try_register_dequeue() {
 
 // From external context
 void Sender::dequeue_callback() {
+  BT_TRACE_SCOPED_ID("L2CAP SDU TX", channel_id_);
   auto packet = queue_end_->TryDequeue();
   ASSERT(packet != nullptr);
   handler_->Post(
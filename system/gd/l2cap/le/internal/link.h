@@ -183,7 +183,7 @@ class Link : public l2cap::internal::ILink,
   DynamicChannelServiceManagerImpl* dynamic_service_manager_;
   LeSignallingManager signalling_manager_;
   std::unordered_map<Cid, PendingDynamicChannelConnection> local_cid_to_pending_dynamic_channel_connection_map_;
-  os::Alarm link_idle_disconnect_alarm_{l2cap_handler_};
+  os::Alarm link_idle_disconnect_alarm_{l2cap_handler_, os::AlarmClass::LAZY};
   LinkOptions link_options_{acl_connection_.get(), this, l2cap_handler_};
   LinkManager* link_manager_;
   SignalId update_request_signal_id_ = kInvalidSignalId;
@@ -18,6 +18,7 @@
 #include "metrics/counter_metrics.h"
 
 #include "common/bind.h"
+#include "metrics/counter_registry.h"
 #include "os/log.h"
 #include "os/metrics.h"
 
@@ -96,6 +97,7 @@ void CounterMetrics::DrainBufferedCounters() {
     Count(pair.first, pair.second);
   }
   counters_.clear();
+  CounterRegistry::Get().ReportDeltas([this](int32_t key, int64_t delta) { Count(key, delta); });
 }
 
 }  // namespace metrics
@@ -0,0 +1,191 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "metrics/counter_registry.h"
+
+#include <unistd.h>
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "os/log.h"
+
+namespace bluetooth {
+namespace metrics {
+
+namespace {
+
+// Threads are assigned a stripe in the order they first increment a counter
+size_t CurrentStripe() {
+  static std::atomic<size_t> next_stripe{0};
+  thread_local size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % Counter::kNumStripes;
+  return stripe;
+}
+
+}  // namespace
+
+void Counter::Increment(int64_t delta) {
+  stripes_[CurrentStripe()].value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+int64_t Counter::Get() const {
+  int64_t total = 0;
+  for (const auto& stripe : stripes_) {
+    total += stripe.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+size_t Histogram::GetBucket(uint64_t value) {
+  if (value == 0) {
+    return 0;
+  }
+  size_t bucket = 64 - __builtin_clzll(value);
+  return bucket < kNumBuckets ? bucket : kNumBuckets - 1;
+}
+
+void Histogram::Record(uint64_t value) {
+  buckets_[GetBucket(value)].fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::array<uint64_t, Histogram::kNumBuckets> Histogram::GetBuckets() const {
+  std::array<uint64_t, kNumBuckets> buckets;
+  for (size_t i = 0; i < kNumBuckets; i++) {
+    buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+  return buckets;
+}
+
+uint64_t Histogram::GetCount() const {
+  uint64_t count = 0;
+  for (const auto& bucket : buckets_) {
+    count += bucket.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+void Gauge::Set(int64_t value) {
+  value_.store(value, std::memory_order_relaxed);
+  int64_t high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+  while (value > high_water_mark &&
+         !high_water_mark_.compare_exchange_weak(high_water_mark, value, std::memory_order_relaxed)) {
+  }
+}
+
+CounterRegistry& CounterRegistry::Get() {
+  static CounterRegistry* instance = new CounterRegistry();
+  return *instance;
+}
+
+bool CounterRegistry::IsValidName(const std::string& name) {
+  if (name.empty() || name.front() == '.' || name.back() == '.' || name.find('.') == std::string::npos) {
+    return false;
+  }
+  for (char c : name) {
+    if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '.')) {
+      return false;
+    }
+  }
+  return name.find("..") == std::string::npos;
+}
+
+Counter* CounterRegistry::GetCounter(const std::string& name, int32_t metrics_key) {
+  ASSERT_LOG(IsValidName(name), "Invalid counter name %s", name.c_str());
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& counter = counters_[name];
+  if (counter == nullptr) {
+    counter.reset(new Counter(name, metrics_key));
+  }
+  ASSERT_LOG(
+      counter->metrics_key_ == metrics_key,
+      "Counter %s registered with metrics keys %d and %d",
+      name.c_str(),
+      counter->metrics_key_,
+      metrics_key);
+  return counter.get();
+}
+
+Histogram* CounterRegistry::GetHistogram(const std::string& name) {
+  ASSERT_LOG(IsValidName(name), "Invalid histogram name %s", name.c_str());
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& histogram = histograms_[name];
+  if (histogram == nullptr) {
+    histogram.reset(new Histogram(name));
+  }
+  return histogram.get();
+}
+
+Gauge* CounterRegistry::GetGauge(const std::string& name) {
+  ASSERT_LOG(IsValidName(name), "Invalid gauge name %s", name.c_str());
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& gauge = gauges_[name];
+  if (gauge == nullptr) {
+    gauge.reset(new Gauge(name));
+  }
+  return gauge.get();
+}
+
+void CounterRegistry::ReportDeltas(const std::function<void(int32_t key, int64_t delta)>& report) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [name, counter] : counters_) {
+    if (counter->metrics_key_ == kNoMetricsKey) {
+      continue;
+    }
+    int64_t value = counter->Get();
+    int64_t delta = value - counter->reported_value_;
+    if (delta > 0) {
+      report(counter->metrics_key_, delta);
+    }
+    counter->reported_value_ = value;
+  }
+}
+
+void CounterRegistry::Dump(int fd) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  dprintf(fd, "\nCounters:\n");
+  for (const auto& [name, counter] : counters_) {
+    dprintf(fd, "  %s: %" PRId64 "\n", name.c_str(), counter->Get());
+  }
+  dprintf(fd, "Histograms:\n");
+  for (const auto& [name, histogram] : histograms_) {
+    dprintf(
+        fd,
+        "  %s: count: %" PRIu64 " sum: %" PRIu64 "\n",
+        name.c_str(),
+        histogram->GetCount(),
+        histogram->GetSum());
+    auto buckets = histogram->GetBuckets();
+    for (size_t i = 0; i < Histogram::kNumBuckets; i++) {
+      if (buckets[i] == 0) {
+        continue;
+      }
+      uint64_t lower = i == 0 ? 0 : uint64_t{1} << (i - 1);
+      if (i == Histogram::kNumBuckets - 1) {
+        dprintf(fd, "    [%" PRIu64 ", inf): %" PRIu64 "\n", lower, buckets[i]);
+      } else {
+        dprintf(fd, "    [%" PRIu64 ", %" PRIu64 "): %" PRIu64 "\n", lower, uint64_t{1} << i, buckets[i]);
+      }
+    }
+  }
+  dprintf(fd, "Gauges:\n");
+  for (const auto& [name, gauge] : gauges_) {
+    dprintf(
+        fd, "  %s: %" PRId64 " high-water mark: %" PRId64 "\n", name.c_str(), gauge->Get(), gauge->GetHighWaterMark());
+  }
+}
+
+}  // namespace metrics
+}  // namespace bluetooth
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace bluetooth {
+namespace metrics {
+
+// A named counter that any thread may increment without taking a lock.
+//
+// The value is striped over a few cache line sized slots, each thread always increments the same slot, so that
+// concurrent increments from different threads rarely contend on the same cache line. Reading sums every slot.
+class Counter {
+ public:
+  static constexpr size_t kNumStripes = 8;
+
+  Counter(const Counter&) = delete;
+  Counter& operator=(const Counter&) = delete;
+
+  void Increment(int64_t delta = 1);
+  int64_t Get() const;
+
+  const std::string& GetName() const {
+    return name_;
+  }
+
+  // Key reported to the metrics pipeline, kNoMetricsKey if the counter is only shown in dumpsys
+  int32_t GetMetricsKey() const {
+    return metrics_key_;
+  }
+
+ private:
+  friend class CounterRegistry;
+
+  Counter(const std::string& name, int32_t metrics_key) : name_(name), metrics_key_(metrics_key) {}
+
+  struct alignas(64) Stripe {
+    std::atomic<int64_t> value{0};
+  };
+
+  const std::string name_;
+  const int32_t metrics_key_;
+  std::array<Stripe, kNumStripes> stripes_;
+  // Value at the last CounterRegistry::ReportDeltas(), only accessed with the registry lock held
+  int64_t reported_value_ = 0;
+};
+
+// A named histogram of unsigned values, recorded without taking a lock.
+//
+// Bucket 0 holds the value 0 and bucket i holds values in [2^(i-1), 2^i), the last bucket is unbounded.
+class Histogram {
+ public:
+  static constexpr size_t kNumBuckets = 32;
+
+  Histogram(const Histogram&) = delete;
+  Histogram& operator=(const Histogram&) = delete;
+
+  void Record(uint64_t value);
+
+  std::array<uint64_t, kNumBuckets> GetBuckets() const;
+  uint64_t GetCount() const;
+  uint64_t GetSum() const {
+    return sum_.load(std::memory_order_relaxed);
+  }
+
+  const std::string& GetName() const {
+    return name_;
+  }
+
+  static size_t GetBucket(uint64_t value);
+
+ private:
+  friend class CounterRegistry;
+
+  explicit Histogram(const std::string& name) : name_(name) {}
+
+  const std::string name_;
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
+  std::atomic<uint64_t> sum_{0};
+};
+
+// A named gauge of the current use of a resource, such as a pool of control blocks, and of the highest use seen
+// since the process started, its high-water mark. Set without taking a lock.
+class Gauge {
+ public:
+  Gauge(const Gauge&) = delete;
+  Gauge& operator=(const Gauge&) = delete;
+
+  void Set(int64_t value);
+
+  int64_t Get() const {
+    return value_.load(std::memory_order_relaxed);
+  }
+  int64_t GetHighWaterMark() const {
+    return high_water_mark_.load(std::memory_order_relaxed);
+  }
+
+  const std::string& GetName() const {
+    return name_;
+  }
+
+ private:
+  friend class CounterRegistry;
+
+  explicit Gauge(const std::string& name) : name_(name) {}
+
+  const std::string name_;
+  std::atomic<int64_t> value_{0};
+  std::atomic<int64_t> high_water_mark_{0};
+};
+
+// Process wide registry of the counters, histograms and gauges of every module, exported through dumpsys and, for counters
+// registered with a metrics key, through CounterMetrics.
+//
+// Names are lowercase dot separated paths starting with the module, such as "gatt.server.static_value_reads".
+// Registration takes a lock and should be done once, by keeping the returned pointer, which stays valid for the
+// lifetime of the process.
+class CounterRegistry {
+ public:
+  static constexpr int32_t kNoMetricsKey = 0;
+
+  static CounterRegistry& Get();
+
+  // Return the counter called |name|, creating it on first use
+  Counter* GetCounter(const std::string& name, int32_t metrics_key = kNoMetricsKey);
+
+  // Return the histogram called |name|, creating it on first use
+  Histogram* GetHistogram(const std::string& name);
+
+  // Return the gauge called |name|, creating it on first use
+  Gauge* GetGauge(const std::string& name);
+
+  // Call |report| with the increase of every counter that has a metrics key since the previous call
+  void ReportDeltas(const std::function<void(int32_t key, int64_t delta)>& report);
+
+  void Dump(int fd) const;
+
+  static bool IsValidName(const std::string& name);
+
+ private:
+  CounterRegistry() = default;
+
+  mutable std::mutex mutex_;
+  std::map<std::string, std::unique_ptr<Counter>> counters_;
+  std::map<std::string, std::unique_ptr<Histogram>> histograms_;
+  std::map<std::string, std::unique_ptr<Gauge>> gauges_;
+};
+
+}  // namespace metrics
+}  // namespace bluetooth
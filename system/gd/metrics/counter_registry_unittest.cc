@@ -0,0 +1,111 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "metrics/counter_registry.h"
+
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace bluetooth {
+namespace metrics {
+namespace {
+
+constexpr int32_t kTestMetricsKey = 1000;
+
+TEST(CounterRegistryTest, same_name_returns_same_counter) {
+  Counter* counter = CounterRegistry::Get().GetCounter("test.registry.same_name");
+  EXPECT_EQ(counter, CounterRegistry::Get().GetCounter("test.registry.same_name"));
+  EXPECT_EQ(counter->GetName(), "test.registry.same_name");
+  EXPECT_NE(counter, CounterRegistry::Get().GetCounter("test.registry.other_name"));
+}
+
+TEST(CounterRegistryTest, concurrent_increments) {
+  constexpr int kThreads = 4;
+  constexpr int kIncrements = 10000;
+  Counter* counter = CounterRegistry::Get().GetCounter("test.registry.concurrent");
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([counter]() {
+      for (int i = 0; i < kIncrements; i++) {
+        counter->Increment();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter->Get(), kThreads * kIncrements);
+}
+
+TEST(CounterRegistryTest, report_deltas_of_counters_with_metrics_key) {
+  Counter* counter = CounterRegistry::Get().GetCounter("test.registry.reported", kTestMetricsKey);
+  CounterRegistry::Get().GetCounter("test.registry.not_reported")->Increment(5);
+  std::map<int32_t, int64_t> reported;
+  auto report = [&reported](int32_t key, int64_t delta) { reported[key] += delta; };
+
+  counter->Increment(3);
+  CounterRegistry::Get().ReportDeltas(report);
+  EXPECT_EQ(reported.size(), 1u);
+  EXPECT_EQ(reported[kTestMetricsKey], 3);
+
+  counter->Increment(2);
+  CounterRegistry::Get().ReportDeltas(report);
+  EXPECT_EQ(reported[kTestMetricsKey], 5);
+}
+
+TEST(CounterRegistryTest, histogram_buckets) {
+  EXPECT_EQ(Histogram::GetBucket(0), 0u);
+  EXPECT_EQ(Histogram::GetBucket(1), 1u);
+  EXPECT_EQ(Histogram::GetBucket(3), 2u);
+  EXPECT_EQ(Histogram::GetBucket(4), 3u);
+  EXPECT_EQ(Histogram::GetBucket(UINT64_MAX), Histogram::kNumBuckets - 1);
+
+  Histogram* histogram = CounterRegistry::Get().GetHistogram("test.registry.histogram");
+  histogram->Record(0);
+  histogram->Record(5);
+  histogram->Record(7);
+  auto buckets = histogram->GetBuckets();
+  EXPECT_EQ(buckets[0], 1u);
+  EXPECT_EQ(buckets[3], 2u);
+  EXPECT_EQ(histogram->GetCount(), 3u);
+  EXPECT_EQ(histogram->GetSum(), 12u);
+}
+
+TEST(CounterRegistryTest, gauge_high_water_mark) {
+  Gauge* gauge = CounterRegistry::Get().GetGauge("test.registry.gauge");
+  EXPECT_EQ(gauge, CounterRegistry::Get().GetGauge("test.registry.gauge"));
+  gauge->Set(3);
+  gauge->Set(7);
+  gauge->Set(2);
+  EXPECT_EQ(gauge->Get(), 2);
+  EXPECT_EQ(gauge->GetHighWaterMark(), 7);
+}
+
+TEST(CounterRegistryTest, valid_names) {
+  EXPECT_TRUE(CounterRegistry::IsValidName("gatt.server.static_value_reads"));
+  EXPECT_TRUE(CounterRegistry::IsValidName("a2dp.tx_packets"));
+  EXPECT_FALSE(CounterRegistry::IsValidName("tx_packets"));
+  EXPECT_FALSE(CounterRegistry::IsValidName("A2dp.tx_packets"));
+  EXPECT_FALSE(CounterRegistry::IsValidName("a2dp..tx_packets"));
+  EXPECT_FALSE(CounterRegistry::IsValidName(".a2dp"));
+  EXPECT_FALSE(CounterRegistry::IsValidName("a2dp.tx packets"));
+}
+
+}  // namespace
+}  // namespace metrics
+}  // namespace bluetooth
@@ -25,6 +25,8 @@ using ::bluetooth::os::Thread;
 namespace bluetooth {
 
 constexpr std::chrono::milliseconds kModuleStopTimeout = std::chrono::milliseconds(2000);
+// Modules share a single thread, let each wakeup drain a few closures before yielding to the other modules
+constexpr size_t kModuleHandlerMaxTasksPerWakeup = 8;
 
 ModuleFactory::ModuleFactory(std::function<Module*()> ctor) : ctor_(ctor) {
 }
@@ -66,7 +68,7 @@ void ModuleRegistry::Start(ModuleList* modules, Thread* thread) {
 
 void ModuleRegistry::set_registry_and_handler(Module* instance, Thread* thread) const {
   instance->registry_ = this;
-  instance->handler_ = new Handler(thread);
+  instance->handler_ = new Handler(thread, kModuleHandlerMaxTasksPerWakeup);
 }
 
 Module* ModuleRegistry::Start(const ModuleFactory* module, Thread* thread) {
@@ -86,10 +88,13 @@ Module* ModuleRegistry::Start(const ModuleFactory* module, Thread* thread) {
   LOG_INFO("Finished starting dependencies and calling Start() of %s", instance->ToString().c_str());
 
   last_instance_ = "starting " + instance->ToString();
+  auto start_begin = std::chrono::steady_clock::now();
   instance->Start();
+  instance->start_time_ =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_begin);
   start_order_.push_back(module);
   started_modules_[module] = instance;
-  LOG_INFO("Started %s", instance->ToString().c_str());
+  LOG_INFO("Started %s in %lld us", instance->ToString().c_str(), static_cast<long long>(instance->start_time_.count()));
   return instance;
 }
 
@@ -120,6 +120,8 @@ class Module : protected ModuleStateDumper {
   ::bluetooth::os::Handler* handler_ = nullptr;
   ModuleList dependencies_;
   const ModuleRegistry* registry_;
+  // Time spent in Start(), dependencies are started before and not included
+  std::chrono::microseconds start_time_{0};
 };
 
 class ModuleRegistry {
@@ -21,13 +21,62 @@
 
 #include "common/init_flags.h"
 #include "dumpsys_data_generated.h"
+#include "handler_generated.h"
 #include "module.h"
+#include "os/handler.h"
 #include "os/wakelock_manager.h"
 
+using ::bluetooth::os::HandlerStats;
 using ::bluetooth::os::WakelockManager;
 
 namespace bluetooth {
 
+namespace {
+
+flatbuffers::Offset<os::HandlerData> GetHandlerDumpsysData(
+    flatbuffers::FlatBufferBuilder* builder, const std::string& name, const HandlerStats& stats) {
+  std::vector<int64_t> upper_bounds;
+  for (size_t i = 0; i < HandlerStats::kNumHistogramBuckets; i++) {
+    upper_bounds.push_back(HandlerStats::GetHistogramBucketUpperBound(i).count());
+  }
+  std::vector<uint64_t> queueing_latency_histogram(
+      stats.queueing_latency_histogram.begin(), stats.queueing_latency_histogram.end());
+  std::vector<uint64_t> execution_time_histogram(
+      stats.execution_time_histogram.begin(), stats.execution_time_histogram.end());
+
+  std::vector<flatbuffers::Offset<os::HandlerSlowTaskData>> slow_tasks;
+  for (const auto& slow_task : stats.slow_tasks) {
+    slow_tasks.push_back(os::CreateHandlerSlowTaskData(
+        *builder,
+        builder->CreateString(slow_task.location),
+        slow_task.count,
+        slow_task.max_execution_time.count()));
+  }
+
+  auto name_offset = builder->CreateString(name);
+  auto upper_bounds_offset = builder->CreateVector(upper_bounds);
+  auto queueing_latency_histogram_offset = builder->CreateVector(queueing_latency_histogram);
+  auto execution_time_histogram_offset = builder->CreateVector(execution_time_histogram);
+  auto slow_tasks_offset = builder->CreateVector(slow_tasks);
+
+  os::HandlerDataBuilder handler_builder(*builder);
+  handler_builder.add_name(name_offset);
+  handler_builder.add_wakeups(stats.wakeups);
+  handler_builder.add_tasks(stats.tasks);
+  handler_builder.add_max_tasks_per_wakeup(stats.max_tasks_per_wakeup);
+  handler_builder.add_total_queueing_latency_us(stats.total_queueing_latency.count());
+  handler_builder.add_max_queueing_latency_us(stats.max_queueing_latency.count());
+  handler_builder.add_total_execution_time_us(stats.total_execution_time.count());
+  handler_builder.add_max_execution_time_us(stats.max_execution_time.count());
+  handler_builder.add_histogram_bucket_upper_bounds_us(upper_bounds_offset);
+  handler_builder.add_queueing_latency_histogram(queueing_latency_histogram_offset);
+  handler_builder.add_execution_time_histogram(execution_time_histogram_offset);
+  handler_builder.add_slow_tasks(slow_tasks_offset);
+  return handler_builder.Finish();
+}
+
+}  // namespace
+
 void ModuleDumper::DumpState(std::string* output, std::ostringstream& oss) const {
   ASSERT(output != nullptr);
 
@@ -48,21 +97,54 @@ void ModuleDumper::DumpState(std::string* output, std::ostringstream& oss) const
 
   auto wakelock_offset = WakelockManager::Get().GetDumpsysData(&builder);
 
+  std::vector<flatbuffers::Offset<os::HandlerData>> handlers;
   std::queue<DumpsysDataFinisher> queue;
   for (auto it = module_registry_.start_order_.rbegin(); it != module_registry_.start_order_.rend();
        it++) {
     auto instance = module_registry_.started_modules_.find(*it);
     ASSERT(instance != module_registry_.started_modules_.end());
+    if (instance->second->handler_ != nullptr) {
+      handlers.push_back(GetHandlerDumpsysData(
+          &builder, instance->second->ToString(), instance->second->handler_->GetStats()));
+    }
     instance->second->GetDumpsysData();
     instance->second->GetDumpsysData(fd_);
     instance->second->GetDumpsysData(oss);
     queue.push(instance->second->GetDumpsysData(&builder));
   }
 
+  std::vector<flatbuffers::Offset<ModuleStartData>> module_starts;
+  int64_t total_start_time_us = 0;
+  for (const auto& module : module_registry_.start_order_) {
+    auto instance = module_registry_.started_modules_.find(module);
+    ASSERT(instance != module_registry_.started_modules_.end());
+    int64_t start_time_us = instance->second->start_time_.count();
+    module_starts.push_back(
+        CreateModuleStartData(builder, builder.CreateString(instance->second->ToString()), start_time_us));
+    total_start_time_us += start_time_us;
+  }
+
+  auto startup_title = builder.CreateString("----- Module Startup -----");
+  auto module_starts_vector = builder.CreateVector(module_starts);
+  ModuleStartupDataBuilder startup_builder(builder);
+  startup_builder.add_title(startup_title);
+  startup_builder.add_total_start_time_us(total_start_time_us);
+  startup_builder.add_modules(module_starts_vector);
+  auto startup_offset = startup_builder.Finish();
+
+  auto handlers_title = builder.CreateString("----- Module Handlers -----");
+  auto handlers_vector = builder.CreateVector(handlers);
+  os::HandlersDataBuilder handlers_builder(builder);
+  handlers_builder.add_title(handlers_title);
+  handlers_builder.add_handlers(handlers_vector);
+  auto handlers_offset = handlers_builder.Finish();
+
   DumpsysDataBuilder data_builder(builder);
   data_builder.add_title(title);
   data_builder.add_init_flags(init_flags_offset);
   data_builder.add_wakelock_manager_data(wakelock_offset);
+  data_builder.add_handlers_data(handlers_offset);
+  data_builder.add_module_startup_data(startup_offset);
 
   while (!queue.empty()) {
     queue.front()(&data_builder);
@@ -306,6 +306,13 @@ TEST_F(ModuleTest, dump_state) {
   auto test_data = data->module_unittest_data();
   EXPECT_STREQ("Initial Test String", test_data->title()->c_str());
 
+  auto startup_data = data->module_startup_data();
+  ASSERT_NE(nullptr, startup_data);
+  ASSERT_EQ(1u, startup_data->modules()->size());
+  EXPECT_STREQ("TestModuleDumpState", startup_data->modules()->Get(0)->name()->c_str());
+  EXPECT_GE(startup_data->modules()->Get(0)->start_time_us(), 0);
+  EXPECT_EQ(startup_data->modules()->Get(0)->start_time_us(), startup_data->total_start_time_us());
+
   TestModuleDumpState* test_module =
       static_cast<TestModuleDumpState*>(registry_->Start(&TestModuleDumpState::Factory, nullptr));
   test_module->test_string_ = "A Second Test String";
@@ -28,13 +28,26 @@
 namespace bluetooth {
 namespace os {
 
+// How much an alarm may be delayed past its delay so that it expires together with other alarms instead of waking up
+// the system on its own:
+//  - CRITICAL alarms expire at their deadline.
+//  - NORMAL alarms may be delayed by 1/256 of their delay, up to 10 ms.
+//  - LAZY alarms may be delayed by 1/8 of their delay, up to 1 s. For timeouts that only need to expire eventually,
+//    such as idle disconnection.
+// Delayed alarms expire at the time in their window with the most trailing zero bits, so that alarms with nearby
+// deadlines are given the same expiration time.
+enum class AlarmClass { CRITICAL, NORMAL, LAZY };
+
+// Returns the number of expirations of delayed alarms that shared their wakeup with a previous one.
+uint64_t GetAlarmWakeupsSaved();
+
 // A single-shot alarm for reactor-based thread, implemented by Linux timerfd.
 // When it's constructed, it will register a reactable on the specified thread; when it's destroyed, it will unregister
 // itself from the thread.
 class Alarm {
  public:
   // Create and register a single-shot alarm on a given handler
-  explicit Alarm(Handler* handler);
+  explicit Alarm(Handler* handler, AlarmClass alarm_class = AlarmClass::NORMAL);
 
   Alarm(const Alarm&) = delete;
   Alarm& operator=(const Alarm&) = delete;
@@ -51,7 +64,10 @@ class Alarm {
  private:
   common::OnceClosure task_;
   Handler* handler_;
+  AlarmClass alarm_class_;
   int fd_ = 0;
+  // Expiration time of a delayed alarm on the alarm clock, 0 if not delayed
+  uint64_t expiration_ms_ = 0;
   Reactor::Reactable* token_;
   mutable std::mutex mutex_;
   void on_fire();
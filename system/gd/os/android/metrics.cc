@@ -27,6 +27,7 @@
 #include "common/metric_id_manager.h"
 #include "common/strings.h"
 #include "hci/hci_packets.h"
+#include "os/deferred_event_queue.h"
 #include "os/log.h"
 
 namespace bluetooth {
@@ -43,6 +44,15 @@ using bluetooth::hci::EventCode;
  */
 static const BytesField byteField(nullptr, 0);
 
+// Events reported from connection and streaming paths are written from this thread, so that the metric id lookup
+// and the statsd socket write never run on the reporting thread. Intentionally leaked, events may be reported until
+// the process exits.
+static DeferredEventQueue& GetMetricsEventQueue() {
+  static constexpr size_t kMetricsEventQueueCapacity = 256;
+  static DeferredEventQueue* queue = new DeferredEventQueue("bt_metrics", kMetricsEventQueueCapacity);
+  return *queue;
+}
+
 void LogMetricLinkLayerConnectionEvent(
     const Address* address,
     uint32_t connection_handle,
@@ -53,36 +63,41 @@ void LogMetricLinkLayerConnectionEvent(
     uint16_t hci_ble_event,
     uint16_t cmd_status,
     uint16_t reason_code) {
-  int metric_id = 0;
-  if (address != nullptr) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(*address);
-  }
-  int ret = stats_write(
-      BLUETOOTH_LINK_LAYER_CONNECTION_EVENT,
-      byteField,
-      connection_handle,
-      direction,
-      link_type,
-      hci_cmd,
-      hci_event,
-      hci_ble_event,
-      cmd_status,
-      reason_code,
-      metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed to log status %s , reason %s, from cmd %s, event %s,  ble_event %s, for %s, handle %d, type %s, "
-        "error %d",
-        common::ToHexString(cmd_status).c_str(),
-        common::ToHexString(reason_code).c_str(),
-        common::ToHexString(hci_cmd).c_str(),
-        common::ToHexString(hci_event).c_str(),
-        common::ToHexString(hci_ble_event).c_str(),
-        address ? ADDRESS_TO_LOGGABLE_CSTR(*address) : "(NULL)",
+  // The address is only valid during this call
+  bool has_address = address != nullptr;
+  Address remote_address = has_address ? *address : Address::kEmpty;
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (has_address) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(remote_address);
+    }
+    int ret = stats_write(
+        BLUETOOTH_LINK_LAYER_CONNECTION_EVENT,
+        byteField,
         connection_handle,
-        common::ToHexString(link_type).c_str(),
-        ret);
-  }
+        direction,
+        link_type,
+        hci_cmd,
+        hci_event,
+        hci_ble_event,
+        cmd_status,
+        reason_code,
+        metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed to log status %s , reason %s, from cmd %s, event %s,  ble_event %s, for %s, handle %d, type %s, "
+          "error %d",
+          common::ToHexString(cmd_status).c_str(),
+          common::ToHexString(reason_code).c_str(),
+          common::ToHexString(hci_cmd).c_str(),
+          common::ToHexString(hci_event).c_str(),
+          common::ToHexString(hci_ble_event).c_str(),
+          has_address ? ADDRESS_TO_LOGGABLE_CSTR(remote_address) : "(NULL)",
+          connection_handle,
+          common::ToHexString(link_type).c_str(),
+          ret);
+    }
+  });
 }
 
 void LogMetricHciTimeoutEvent(uint32_t hci_cmd) {
@@ -94,36 +109,41 @@ void LogMetricHciTimeoutEvent(uint32_t hci_cmd) {
 
 void LogMetricRemoteVersionInfo(
     uint16_t handle, uint8_t status, uint8_t version, uint16_t manufacturer_name, uint16_t subversion) {
-  int ret = stats_write(BLUETOOTH_REMOTE_VERSION_INFO_REPORTED, handle, status, version, manufacturer_name, subversion);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for handle %d, status %s, version %s, manufacturer_name %s, subversion %s, error %d",
-        handle,
-        common::ToHexString(status).c_str(),
-        common::ToHexString(version).c_str(),
-        common::ToHexString(manufacturer_name).c_str(),
-        common::ToHexString(subversion).c_str(),
-        ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int ret =
+        stats_write(BLUETOOTH_REMOTE_VERSION_INFO_REPORTED, handle, status, version, manufacturer_name, subversion);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for handle %d, status %s, version %s, manufacturer_name %s, subversion %s, error %d",
+          handle,
+          common::ToHexString(status).c_str(),
+          common::ToHexString(version).c_str(),
+          common::ToHexString(manufacturer_name).c_str(),
+          common::ToHexString(subversion).c_str(),
+          ret);
+    }
+  });
 }
 
 void LogMetricA2dpAudioUnderrunEvent(
     const Address& address, uint64_t encoding_interval_millis, int num_missing_pcm_bytes) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int64_t encoding_interval_nanos = encoding_interval_millis * 1000000;
-  int ret = stats_write(
-      BLUETOOTH_A2DP_AUDIO_UNDERRUN_REPORTED, byteField, encoding_interval_nanos, num_missing_pcm_bytes, metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for %s, encoding_interval_nanos %s, num_missing_pcm_bytes %d, error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
-        std::to_string(encoding_interval_nanos).c_str(),
-        num_missing_pcm_bytes,
-        ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int64_t encoding_interval_nanos = encoding_interval_millis * 1000000;
+    int ret = stats_write(
+        BLUETOOTH_A2DP_AUDIO_UNDERRUN_REPORTED, byteField, encoding_interval_nanos, num_missing_pcm_bytes, metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for %s, encoding_interval_nanos %s, num_missing_pcm_bytes %d, error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          std::to_string(encoding_interval_nanos).c_str(),
+          num_missing_pcm_bytes,
+          ret);
+    }
+  });
 }
 
 void LogMetricA2dpAudioOverrunEvent(
@@ -132,48 +152,53 @@ void LogMetricA2dpAudioOverrunEvent(
     int num_dropped_buffers,
     int num_dropped_encoded_frames,
     int num_dropped_encoded_bytes) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-
-  int64_t encoding_interval_nanos = encoding_interval_millis * 1000000;
-  int ret = stats_write(
-      BLUETOOTH_A2DP_AUDIO_OVERRUN_REPORTED,
-      byteField,
-      encoding_interval_nanos,
-      num_dropped_buffers,
-      num_dropped_encoded_frames,
-      num_dropped_encoded_bytes,
-      metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed to log for %s, encoding_interval_nanos %s, num_dropped_buffers %d, "
-        "num_dropped_encoded_frames %d, num_dropped_encoded_bytes %d, error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
-        std::to_string(encoding_interval_nanos).c_str(),
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+
+    int64_t encoding_interval_nanos = encoding_interval_millis * 1000000;
+    int ret = stats_write(
+        BLUETOOTH_A2DP_AUDIO_OVERRUN_REPORTED,
+        byteField,
+        encoding_interval_nanos,
         num_dropped_buffers,
         num_dropped_encoded_frames,
         num_dropped_encoded_bytes,
-        ret);
-  }
+        metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed to log for %s, encoding_interval_nanos %s, num_dropped_buffers %d, "
+          "num_dropped_encoded_frames %d, num_dropped_encoded_bytes %d, error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          std::to_string(encoding_interval_nanos).c_str(),
+          num_dropped_buffers,
+          num_dropped_encoded_frames,
+          num_dropped_encoded_bytes,
+          ret);
+    }
+  });
 }
 
 void LogMetricA2dpPlaybackEvent(const Address& address, int playback_state, int audio_coding_mode) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-
-  int ret = stats_write(BLUETOOTH_A2DP_PLAYBACK_STATE_CHANGED, byteField, playback_state, audio_coding_mode, metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed to log for %s, playback_state %d, audio_coding_mode %d,error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
-        playback_state,
-        audio_coding_mode,
-        ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+
+    int ret =
+        stats_write(BLUETOOTH_A2DP_PLAYBACK_STATE_CHANGED, byteField, playback_state, audio_coding_mode, metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed to log for %s, playback_state %d, audio_coding_mode %d,error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          playback_state,
+          audio_coding_mode,
+          ret);
+    }
+  });
 }
 
 void LogMetricA2dpSessionMetricsEvent(
@@ -197,82 +222,90 @@ void LogMetricHfpPacketLossStats(
     uint16_t /* codec_type */) {}
 
 void LogMetricReadRssiResult(const Address& address, uint16_t handle, uint32_t cmd_status, int8_t rssi) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int ret = stats_write(BLUETOOTH_DEVICE_RSSI_REPORTED, byteField, handle, cmd_status, rssi, metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for %s, handle %d, status %s, rssi %d dBm, error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
-        handle,
-        common::ToHexString(cmd_status).c_str(),
-        rssi,
-        ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int ret = stats_write(BLUETOOTH_DEVICE_RSSI_REPORTED, byteField, handle, cmd_status, rssi, metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for %s, handle %d, status %s, rssi %d dBm, error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          handle,
+          common::ToHexString(cmd_status).c_str(),
+          rssi,
+          ret);
+    }
+  });
 }
 
 void LogMetricReadFailedContactCounterResult(
     const Address& address, uint16_t handle, uint32_t cmd_status, int32_t failed_contact_counter) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int ret = stats_write(
-      BLUETOOTH_DEVICE_FAILED_CONTACT_COUNTER_REPORTED,
-      byteField,
-      handle,
-      cmd_status,
-      failed_contact_counter,
-      metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for %s, handle %d, status %s, failed_contact_counter %d packets, error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int ret = stats_write(
+        BLUETOOTH_DEVICE_FAILED_CONTACT_COUNTER_REPORTED,
+        byteField,
         handle,
-        common::ToHexString(cmd_status).c_str(),
+        cmd_status,
         failed_contact_counter,
-        ret);
-  }
+        metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for %s, handle %d, status %s, failed_contact_counter %d packets, error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          handle,
+          common::ToHexString(cmd_status).c_str(),
+          failed_contact_counter,
+          ret);
+    }
+  });
 }
 
 void LogMetricReadTxPowerLevelResult(
     const Address& address, uint16_t handle, uint32_t cmd_status, int32_t transmit_power_level) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int ret = stats_write(
-      BLUETOOTH_DEVICE_TX_POWER_LEVEL_REPORTED, byteField, handle, cmd_status, transmit_power_level, metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for %s, handle %d, status %s, transmit_power_level %d packets, error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
-        handle,
-        common::ToHexString(cmd_status).c_str(),
-        transmit_power_level,
-        ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int ret = stats_write(
+        BLUETOOTH_DEVICE_TX_POWER_LEVEL_REPORTED, byteField, handle, cmd_status, transmit_power_level, metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for %s, handle %d, status %s, transmit_power_level %d packets, error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          handle,
+          common::ToHexString(cmd_status).c_str(),
+          transmit_power_level,
+          ret);
+    }
+  });
 }
 
 void LogMetricSmpPairingEvent(
     const Address& address, uint16_t smp_cmd, android::bluetooth::DirectionEnum direction, uint16_t smp_fail_reason) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int ret =
-      stats_write(BLUETOOTH_SMP_PAIRING_EVENT_REPORTED, byteField, smp_cmd, direction, smp_fail_reason, metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for %s, smp_cmd %s, direction %d, smp_fail_reason %s, error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
-        common::ToHexString(smp_cmd).c_str(),
-        direction,
-        common::ToHexString(smp_fail_reason).c_str(),
-        ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int ret =
+        stats_write(BLUETOOTH_SMP_PAIRING_EVENT_REPORTED, byteField, smp_cmd, direction, smp_fail_reason, metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for %s, smp_cmd %s, direction %d, smp_fail_reason %s, error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          common::ToHexString(smp_cmd).c_str(),
+          direction,
+          common::ToHexString(smp_fail_reason).c_str(),
+          ret);
+    }
+  });
 }
 
 void LogMetricClassicPairingEvent(
@@ -283,37 +316,39 @@ void LogMetricClassicPairingEvent(
     uint16_t cmd_status,
     uint16_t reason_code,
     int64_t event_value) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int ret = stats_write(
-      BLUETOOTH_CLASSIC_PAIRING_EVENT_REPORTED,
-      byteField,
-      handle,
-      hci_cmd,
-      hci_event,
-      cmd_status,
-      reason_code,
-      event_value,
-      metric_id);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for %s, handle %d, hci_cmd %s, hci_event %s, cmd_status %s, "
-        "reason %s, event_value %s, error %d",
-        ADDRESS_TO_LOGGABLE_CSTR(address),
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int ret = stats_write(
+        BLUETOOTH_CLASSIC_PAIRING_EVENT_REPORTED,
+        byteField,
         handle,
-        common::ToHexString(hci_cmd).c_str(),
-        common::ToHexString(hci_event).c_str(),
-        common::ToHexString(cmd_status).c_str(),
-        common::ToHexString(reason_code).c_str(),
-        std::to_string(event_value).c_str(),
-        ret);
-  }
-
-  if (static_cast<EventCode>(hci_event) == EventCode::SIMPLE_PAIRING_COMPLETE) {
-    common::LogConnectionAdminAuditEvent("Pairing", address, static_cast<ErrorCode>(cmd_status));
-  }
+        hci_cmd,
+        hci_event,
+        cmd_status,
+        reason_code,
+        event_value,
+        metric_id);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for %s, handle %d, hci_cmd %s, hci_event %s, cmd_status %s, "
+          "reason %s, event_value %s, error %d",
+          ADDRESS_TO_LOGGABLE_CSTR(address),
+          handle,
+          common::ToHexString(hci_cmd).c_str(),
+          common::ToHexString(hci_event).c_str(),
+          common::ToHexString(cmd_status).c_str(),
+          common::ToHexString(reason_code).c_str(),
+          std::to_string(event_value).c_str(),
+          ret);
+    }
+
+    if (static_cast<EventCode>(hci_event) == EventCode::SIMPLE_PAIRING_COMPLETE) {
+      common::LogConnectionAdminAuditEvent("Pairing", address, static_cast<ErrorCode>(cmd_status));
+    }
+  });
 }
 
 void LogMetricSdpAttribute(
@@ -486,53 +521,59 @@ void LogMetricBluetoothLocalVersions(
 
 void LogMetricBluetoothDisconnectionReasonReported(
     uint32_t reason, const Address& address, uint32_t connection_handle) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int ret = stats_write(BLUETOOTH_DISCONNECTION_REASON_REPORTED, reason, metric_id, connection_handle);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for LogMetricBluetoothDisconnectionReasonReported, "
-        "reason %d, metric_id %d, connection_handle %d, error %d",
-        reason,
-        metric_id,
-        connection_handle,
-        ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int ret = stats_write(BLUETOOTH_DISCONNECTION_REASON_REPORTED, reason, metric_id, connection_handle);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for LogMetricBluetoothDisconnectionReasonReported, "
+          "reason %d, metric_id %d, connection_handle %d, error %d",
+          reason,
+          metric_id,
+          connection_handle,
+          ret);
+    }
+  });
 }
 
 void LogMetricBluetoothRemoteSupportedFeatures(
     const Address& address, uint32_t page, uint64_t features, uint32_t connection_handle) {
-  int metric_id = 0;
-  if (!address.IsEmpty()) {
-    metric_id = MetricIdManager::GetInstance().AllocateId(address);
-  }
-  int ret = stats_write(
-      BLUETOOTH_REMOTE_SUPPORTED_FEATURES_REPORTED,
-      metric_id,
-      page,
-      static_cast<int64_t>(features),
-      connection_handle);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed for LogMetricBluetoothRemoteSupportedFeatures, "
-        "metric_id %d, page %d, features %s, connection_handle %d, error %d",
+  GetMetricsEventQueue().Post([=]() {
+    int metric_id = 0;
+    if (!address.IsEmpty()) {
+      metric_id = MetricIdManager::GetInstance().AllocateId(address);
+    }
+    int ret = stats_write(
+        BLUETOOTH_REMOTE_SUPPORTED_FEATURES_REPORTED,
         metric_id,
         page,
-        std::to_string(features).c_str(),
-        connection_handle,
-        ret);
-  }
+        static_cast<int64_t>(features),
+        connection_handle);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed for LogMetricBluetoothRemoteSupportedFeatures, "
+          "metric_id %d, page %d, features %s, connection_handle %d, error %d",
+          metric_id,
+          page,
+          std::to_string(features).c_str(),
+          connection_handle,
+          ret);
+    }
+  });
 }
 
 void LogMetricBluetoothCodePathCounterMetrics(int32_t key, int64_t count) {
-  int ret = stats_write(BLUETOOTH_CODE_PATH_COUNTER, key, count);
-  if (ret < 0) {
-    LOG_WARN(
-        "Failed counter metrics for %d, count %s, error %d",
-        key, std::to_string(count).c_str(), ret);
-  }
+  GetMetricsEventQueue().Post([=]() {
+    int ret = stats_write(BLUETOOTH_CODE_PATH_COUNTER, key, count);
+    if (ret < 0) {
+      LOG_WARN(
+          "Failed counter metrics for %d, count %s, error %d",
+          key, std::to_string(count).c_str(), ret);
+    }
+  });
 }
 
 void LogMetricBluetoothLEConnectionMetricEvent(
@@ -22,6 +22,7 @@
 #include <mutex>
 #include <string>
 
+#include "common/init_flags.h"
 #include "os/log.h"
 
 namespace bluetooth {
@@ -33,6 +34,17 @@ std::string config_file_path;
 std::string snoop_log_file_path;
 std::string snooz_log_file_path;
 std::string sysprops_file_path;
+
+// Each adapter is served by its own process. With per adapter files enabled, the processes of the adapters other than
+// hci0 keep their config and logs in their own files, e.g. bt_config_hci1.conf, so that adapters can run concurrently.
+std::string AdapterFilePath(const std::string& path) {
+  int adapter_index = common::InitFlags::GetAdapterIndex();
+  if (adapter_index == 0 || !common::InitFlags::IsPerAdapterFilesEnabled()) {
+    return path;
+  }
+  size_t extension = path.find_last_of('.');
+  return path.substr(0, extension) + "_hci" + std::to_string(adapter_index) + path.substr(extension);
+}
 }  // namespace
 
 // Write to $PWD/bt_stack.conf if $PWD can be found, otherwise, write to $HOME/bt_stack.conf
@@ -43,7 +55,7 @@ std::string ParameterProvider::ConfigFilePath() {
       return config_file_path;
     }
   }
-  return "/var/lib/bluetooth/bt_config.conf";
+  return AdapterFilePath("/var/lib/bluetooth/bt_config.conf");
 }
 
 void ParameterProvider::OverrideConfigFilePath(const std::string& path) {
@@ -59,7 +71,7 @@ std::string ParameterProvider::SnoopLogFilePath() {
     }
   }
 
-  return "/var/log/bluetooth/btsnoop_hci.log";
+  return AdapterFilePath("/var/log/bluetooth/btsnoop_hci.log");
 }
 
 void ParameterProvider::OverrideSnoopLogFilePath(const std::string& path) {
@@ -74,7 +86,7 @@ std::string ParameterProvider::SnoozLogFilePath() {
       return snooz_log_file_path;
     }
   }
-  return "/var/log/bluetooth/btsnooz_hci.log";
+  return AdapterFilePath("/var/log/bluetooth/btsnooz_hci.log");
 }
 
 std::string ParameterProvider::SyspropsFilePath() {
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace bluetooth {
+namespace os {
+
+// A bounded multi-producer queue of small callables that are run in batches on a dedicated thread.
+//
+// This is meant for fire-and-forget work, such as writing metrics, that should not add latency to the thread
+// reporting the event. Every slot is allocated when the queue is created and callables are stored inline, so Post()
+// never allocates and never takes a lock unless the worker thread is asleep. When the queue is full the callable is
+// dropped and counted instead of blocking the caller.
+class DeferredEventQueue {
+ public:
+  // Largest callable that can be posted, enforced at compile time
+  static constexpr size_t kInlineSize = 16 * sizeof(void*);
+
+  // Create a queue holding up to |capacity| events, rounded up to a power of two, and start its worker thread
+  DeferredEventQueue(const std::string& name, size_t capacity);
+  DeferredEventQueue(const DeferredEventQueue&) = delete;
+  DeferredEventQueue& operator=(const DeferredEventQueue&) = delete;
+
+  // Run the events posted so far, then stop the worker thread
+  ~DeferredEventQueue();
+
+  // Queue |callable| to run on the worker thread. Returns false, and destroys |callable| without running it, when the
+  // queue is full.
+  template <typename Callable>
+  bool Post(Callable&& callable) {
+    using Stored = std::decay_t<Callable>;
+    static_assert(sizeof(Stored) <= kInlineSize, "Callable is too large for an inline slot");
+    static_assert(alignof(Stored) <= alignof(std::max_align_t), "Callable is over-aligned");
+
+    Slot* slot = ClaimSlot();
+    if (slot == nullptr) {
+      return false;
+    }
+    new (slot->storage) Stored(std::forward<Callable>(callable));
+    slot->run_and_destroy = [](void* storage) {
+      Stored* stored = static_cast<Stored*>(storage);
+      (*stored)();
+      stored->~Stored();
+    };
+    Publish(slot);
+    return true;
+  }
+
+  // Block until every event posted before this call has run. Must not be called on the worker thread.
+  void Flush();
+
+  // Number of events dropped because the queue was full
+  uint64_t GetDroppedCount() const {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  // Number of events run on the worker thread
+  uint64_t GetProcessedCount() const {
+    return processed_count_.load(std::memory_order_relaxed);
+  }
+
+  const std::string& GetName() const {
+    return name_;
+  }
+
+ private:
+  struct Slot {
+    // Equal to the position of the slot when it is free, one past it once an event is published
+    std::atomic<size_t> sequence;
+    size_t position;
+    void (*run_and_destroy)(void*);
+    alignas(std::max_align_t) unsigned char storage[kInlineSize];
+  };
+
+  Slot* ClaimSlot();
+  void Publish(Slot* slot);
+  bool RunOne();
+  bool IsNextReady() const;
+  void Run();
+
+  const std::string name_;
+  const size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+
+  alignas(64) std::atomic<size_t> enqueue_position_{0};
+  // Only accessed by the worker thread
+  alignas(64) size_t dequeue_position_{0};
+  uint64_t reported_dropped_count_{0};
+
+  std::atomic<uint64_t> dropped_count_{0};
+  std::atomic<uint64_t> processed_count_{0};
+
+  // Wake up protocol: the worker sets sleeping_ and checks the next slot again under wake_mutex_ before waiting,
+  // producers only take wake_mutex_ when they see sleeping_ set.
+  std::atomic<bool> sleeping_{false};
+  std::atomic<bool> quit_{false};
+  std::mutex wake_mutex_;
+  std::condition_variable wake_cv_;
+  std::thread thread_;
+};
+
+}  // namespace os
+}  // namespace bluetooth
@@ -55,7 +55,7 @@ int fake_timerfd_create(int /* clockid */, int /* flags */) {
 
 int fake_timerfd_settime(
     int fd,
-    int /* flags */,
+    int flags,
     const struct itimerspec* new_value,
     struct itimerspec* /* old_value */) {
   if (fake_timers.find(fd) == fake_timers.end()) {
@@ -64,14 +64,14 @@ int fake_timerfd_settime(
 
   FakeTimerFd* entry = fake_timers[fd];
 
-  uint64_t trigger_delta_ms = timespec_to_ms(&new_value->it_value);
-  entry->active = trigger_delta_ms != 0;
+  uint64_t trigger_value_ms = timespec_to_ms(&new_value->it_value);
+  entry->active = trigger_value_ms != 0;
   if (!entry->active) {
     return 0;
   }
 
   uint64_t period_ms = timespec_to_ms(&new_value->it_interval);
-  entry->trigger_ms = clock + trigger_delta_ms;
+  entry->trigger_ms = (flags & TFD_TIMER_ABSTIME) ? trigger_value_ms : clock + trigger_value_ms;
   entry->period_ms = period_ms;
   return 0;
 }
@@ -85,6 +85,12 @@ int fake_timerfd_close(int fd) {
   return close(fd);
 }
 
+int fake_clock_gettime(clockid_t /* clock_id */, struct timespec* tp) {
+  tp->tv_sec = clock / 1000;
+  tp->tv_nsec = clock % 1000 * 1000000;
+  return 0;
+}
+
 void fake_timerfd_reset() {
   clock = 0;
   max_clock = UINT64_MAX;
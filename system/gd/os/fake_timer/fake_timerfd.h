@@ -30,6 +30,8 @@ int fake_timerfd_settime(int fd, int flags, const struct itimerspec* new_value,
 
 int fake_timerfd_close(int fd);
 
+int fake_clock_gettime(clockid_t clock_id, struct timespec* tp);
+
 void fake_timerfd_reset();
 
 void fake_timerfd_advance(uint64_t ms);
@@ -16,7 +16,9 @@
 
 #include "os/handler.h"
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include "common/bind.h"
 #include "common/callback.h"
@@ -28,42 +30,61 @@ namespace bluetooth {
 namespace os {
 using common::OnceClosure;
 
-Handler::Handler(Thread* thread) : tasks_(new std::queue<OnceClosure>()), thread_(thread) {
-  event_ = thread_->GetReactor()->NewEvent();
+Handler::Handler(Thread* thread) : Handler(thread, kDefaultMaxTasksPerWakeup) {}
+
+Handler::Handler(Thread* thread, size_t max_tasks_per_wakeup)
+    : state_(std::make_shared<State>()), thread_(thread), max_tasks_per_wakeup_(max_tasks_per_wakeup) {
+  ASSERT(max_tasks_per_wakeup_ > 0);
+  state_->tasks = new std::queue<PendingTask>();
+  state_->event = thread_->GetReactor()->NewEvent();
   reactable_ = thread_->GetReactor()->Register(
-      event_->Id(), common::Bind(&Handler::handle_next_event, common::Unretained(this)), common::Closure());
+      state_->event->Id(), common::Bind(&Handler::handle_next_event, common::Unretained(this)), common::Closure());
 }
 
 Handler::~Handler() {
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    ASSERT_LOG(was_cleared(), "Handlers must be cleared before they are destroyed");
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    ASSERT_LOG(state_->was_cleared(), "Handlers must be cleared before they are destroyed");
   }
-  event_->Close();
+  state_->event->Close();
 }
 
 void Handler::Post(OnceClosure closure) {
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (was_cleared()) {
-      LOG_WARN("Posting to a handler which has been cleared");
-      return;
-    }
-    tasks_->emplace(std::move(closure));
+  Post(base::Location(), std::move(closure));
+}
+
+void Handler::Post(const base::Location& from_here, OnceClosure closure) {
+  PostInline(from_here, common::InlineClosure(std::move(closure)));
+}
+
+void Handler::PostInline(common::InlineClosure closure) {
+  PostInline(base::Location(), std::move(closure));
+}
+
+void Handler::PostInline(const base::Location& from_here, common::InlineClosure closure) {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  if (state_->was_cleared()) {
+    LOG_WARN("Posting to a handler which has been cleared");
+    return;
+  }
+  bool was_empty = state_->tasks->empty();
+  state_->tasks->push(PendingTask{std::move(closure), std::chrono::steady_clock::now(), from_here});
+  // The event stays readable until the queue is drained, only the first closure needs to wake the reactor up.
+  if (was_empty) {
+    state_->event->Notify();
   }
-  event_->Notify();
 }
 
 void Handler::Clear() {
-  std::queue<OnceClosure>* tmp = nullptr;
+  std::queue<PendingTask>* tmp = nullptr;
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    ASSERT_LOG(!was_cleared(), "Handlers must only be cleared once");
-    std::swap(tasks_, tmp);
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    ASSERT_LOG(!state_->was_cleared(), "Handlers must only be cleared once");
+    std::swap(state_->tasks, tmp);
   }
   delete tmp;
 
-  event_->Clear();
+  state_->event->Clear();
 
   thread_->GetReactor()->Unregister(reactable_);
   reactable_ = nullptr;
@@ -74,21 +95,107 @@ void Handler::WaitUntilStopped(std::chrono::milliseconds timeout) {
   ASSERT(thread_->GetReactor()->WaitForUnregisteredReactable(timeout));
 }
 
+HandlerStats Handler::GetStats() const {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->stats;
+}
+
+void Handler::State::RecordExecution(const base::Location& from_here, std::chrono::microseconds execution_time) {
+  stats.tasks++;
+  stats.total_execution_time += execution_time;
+  stats.max_execution_time = std::max(stats.max_execution_time, execution_time);
+  stats.execution_time_histogram[HandlerStats::GetHistogramBucket(execution_time)]++;
+
+  if (execution_time < HandlerStats::kSlowTaskThreshold) {
+    return;
+  }
+
+  std::string location = from_here.has_source_info() ? from_here.ToString() : "unknown";
+  LOG_WARN("Slow task took %lld us, posted from %s", (long long)execution_time.count(), location.c_str());
+
+  auto& slow_tasks = stats.slow_tasks;
+  auto it = std::find_if(slow_tasks.begin(), slow_tasks.end(), [&location](const HandlerStats::SlowTask& task) {
+    return task.location == location;
+  });
+  if (it == slow_tasks.end()) {
+    if (slow_tasks.size() == HandlerStats::kMaxSlowTaskLocations) {
+      if (slow_tasks.back().max_execution_time >= execution_time) {
+        return;
+      }
+      slow_tasks.pop_back();
+    }
+    slow_tasks.push_back(HandlerStats::SlowTask{.location = std::move(location)});
+    it = slow_tasks.end() - 1;
+  }
+  it->count++;
+  it->max_execution_time = std::max(it->max_execution_time, execution_time);
+  std::stable_sort(slow_tasks.begin(), slow_tasks.end(), [](const auto& a, const auto& b) {
+    return a.max_execution_time > b.max_execution_time;
+  });
+}
+
 void Handler::handle_next_event() {
-  common::OnceClosure closure;
+  // Closures may destroy this handler, only the shared state is used once they start running.
+  std::shared_ptr<State> state = state_;
+  std::vector<PendingTask> batch;
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    bool has_data = event_->Read();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->was_cleared()) {
+      return;
+    }
+    ASSERT_LOG(!state->tasks->empty(), "Notified for work but no work available");
 
-    if (was_cleared()) {
+    auto now = std::chrono::steady_clock::now();
+    batch.reserve(std::min(max_tasks_per_wakeup_, state->tasks->size()));
+    while (!state->tasks->empty() && batch.size() < max_tasks_per_wakeup_) {
+      PendingTask& task = state->tasks->front();
+      auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - task.post_time);
+      state->stats.total_queueing_latency += latency;
+      state->stats.max_queueing_latency = std::max(state->stats.max_queueing_latency, latency);
+      state->stats.queueing_latency_histogram[HandlerStats::GetHistogramBucket(latency)]++;
+      batch.push_back(std::move(task));
+      state->tasks->pop();
+    }
+    if (state->tasks->empty()) {
+      state->event->Read();
+    }
+    state->stats.wakeups++;
+    state->stats.max_tasks_per_wakeup = std::max(state->stats.max_tasks_per_wakeup, batch.size());
+  }
+
+  for (size_t i = 0; i < batch.size(); i++) {
+    auto start = std::chrono::steady_clock::now();
+    std::move(batch[i].closure).Run();
+    auto execution_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->RecordExecution(batch[i].from_here, execution_time);
+    if (state->was_cleared()) {
       return;
     }
-    ASSERT_LOG(has_data, "Notified for work but no work available");
+  }
+}
 
-    closure = std::move(tasks_->front());
-    tasks_->pop();
+size_t HandlerStats::GetHistogramBucket(std::chrono::microseconds duration) {
+  size_t bucket = 0;
+  auto upper_bound = kFirstBucketUpperBound;
+  while (bucket < kNumHistogramBuckets - 1 && duration >= upper_bound) {
+    upper_bound *= 4;
+    bucket++;
+  }
+  return bucket;
+}
+
+std::chrono::microseconds HandlerStats::GetHistogramBucketUpperBound(size_t bucket) {
+  if (bucket >= kNumHistogramBuckets - 1) {
+    return std::chrono::microseconds::max();
+  }
+  auto upper_bound = kFirstBucketUpperBound;
+  for (size_t i = 0; i < bucket; i++) {
+    upper_bound *= 4;
   }
-  std::move(closure).Run();
+  return upper_bound;
 }
 
 }  // namespace os
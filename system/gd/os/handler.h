@@ -16,27 +16,81 @@
 
 #pragma once
 
+#include <base/location.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
+#include <vector>
 
 #include "common/bind.h"
 #include "common/callback.h"
 #include "common/contextual_callback.h"
+#include "common/inline_closure.h"
 #include "os/thread.h"
 #include "os/utils.h"
 
 namespace bluetooth {
 namespace os {
 
+// Counters describing how a handler's queue is being drained
+struct HandlerStats {
+  // Histogram buckets grow by 4x from 16us: [0, 16us), [16us, 64us), ..., [262ms, inf)
+  static constexpr size_t kNumHistogramBuckets = 10;
+  static constexpr std::chrono::microseconds kFirstBucketUpperBound{16};
+  // Closures running longer than this are reported as slow
+  static constexpr std::chrono::milliseconds kSlowTaskThreshold{20};
+  // Number of distinct slow task locations kept, the fastest ones are evicted first
+  static constexpr size_t kMaxSlowTaskLocations = 16;
+
+  struct SlowTask {
+    std::string location;
+    uint64_t count = 0;
+    std::chrono::microseconds max_execution_time{0};
+  };
+
+  // Number of times the reactor woke the handler up
+  uint64_t wakeups = 0;
+  // Number of closures executed
+  uint64_t tasks = 0;
+  // Largest number of closures executed on a single wakeup
+  size_t max_tasks_per_wakeup = 0;
+  // Time closures spent queued between Post() and the start of their execution
+  std::chrono::microseconds total_queueing_latency{0};
+  std::chrono::microseconds max_queueing_latency{0};
+  std::array<uint64_t, kNumHistogramBuckets> queueing_latency_histogram{};
+  // Time closures spent executing
+  std::chrono::microseconds total_execution_time{0};
+  std::chrono::microseconds max_execution_time{0};
+  std::array<uint64_t, kNumHistogramBuckets> execution_time_histogram{};
+  // Posting locations of the slowest closures, sorted from slowest to fastest
+  std::vector<SlowTask> slow_tasks;
+
+  // Index of the histogram bucket |duration| falls into
+  static size_t GetHistogramBucket(std::chrono::microseconds duration);
+  // Upper bound of a histogram bucket, the last bucket is unbounded
+  static std::chrono::microseconds GetHistogramBucketUpperBound(size_t bucket);
+};
+
 // A message-queue style handler for reactor-based thread to handle incoming events from different threads. When it's
 // constructed, it will register a reactable on the specified thread; when it's destroyed, it will unregister itself
 // from the thread.
+//
+// The reactor is only notified when the queue goes from empty to non-empty. On each wakeup the handler executes up to
+// |max_tasks_per_wakeup| closures before yielding back to the reactor, so that a burst of posted closures does not pay
+// a reactor round trip per closure while other reactables on the same thread still get a chance to run.
 class Handler : public common::IPostableContext {
  public:
+  static constexpr size_t kDefaultMaxTasksPerWakeup = 1;
+
   // Create and register a handler on given thread
   explicit Handler(Thread* thread);
+  Handler(Thread* thread, size_t max_tasks_per_wakeup);
 
   Handler(const Handler&) = delete;
   Handler& operator=(const Handler&) = delete;
@@ -47,12 +101,22 @@ class Handler : public common::IPostableContext {
   // Enqueue a closure to the queue of this handler
   virtual void Post(common::OnceClosure closure) override;
 
+  // Enqueue a closure to the queue of this handler, |from_here| is used to attribute slow closures in GetStats()
+  void Post(const base::Location& from_here, common::OnceClosure closure);
+
+  // Enqueue a callable to the queue of this handler, without allocating when it fits in common::InlineClosure
+  void PostInline(common::InlineClosure closure) override;
+  void PostInline(const base::Location& from_here, common::InlineClosure closure);
+
   // Remove all pending events from the queue of this handler
   void Clear();
 
   // Die if the current reactable doesn't stop before the timeout.  Must be called after Clear()
   void WaitUntilStopped(std::chrono::milliseconds timeout);
 
+  // Snapshot of the queueing and execution counters of this handler
+  HandlerStats GetStats() const;
+
   template <typename Functor, typename... Args>
   void Call(Functor&& functor, Args&&... args) {
     Post(common::BindOnce(std::forward<Functor>(functor), std::forward<Args>(args)...));
@@ -90,19 +154,38 @@ class Handler : public common::IPostableContext {
   template <typename T>
   friend class Queue;
 
+  template <typename T>
+  friend class SpscQueue;
+
   friend class Alarm;
 
   friend class RepeatingAlarm;
 
  private:
-  inline bool was_cleared() const {
-    return tasks_ == nullptr;
+  struct PendingTask {
+    common::InlineClosure closure;
+    std::chrono::steady_clock::time_point post_time;
+    base::Location from_here;
   };
-  std::queue<common::OnceClosure>* tasks_;
+
+  // State shared with handle_next_event(), so that a closure may clear and destroy the handler it runs on while the
+  // rest of its batch is being discarded.
+  struct State {
+    inline bool was_cleared() const {
+      return tasks == nullptr;
+    };
+    // Must be called with |mutex| held
+    void RecordExecution(const base::Location& from_here, std::chrono::microseconds execution_time);
+    std::queue<PendingTask>* tasks;
+    std::unique_ptr<Reactor::Event> event;
+    HandlerStats stats;
+    mutable std::mutex mutex;
+  };
+
+  std::shared_ptr<State> state_;
   Thread* thread_;
-  std::unique_ptr<Reactor::Event> event_;
+  const size_t max_tasks_per_wakeup_;
   Reactor::Reactable* reactable_;
-  mutable std::mutex mutex_;
   void handle_next_event();
 };
 
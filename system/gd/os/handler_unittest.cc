@@ -18,6 +18,7 @@
 
 #include <future>
 #include <thread>
+#include <vector>
 
 #include "common/bind.h"
 #include "common/callback.h"
@@ -116,6 +117,146 @@ TEST_F(HandlerTest, callback_with_promise) {
   handler_->Clear();
 }
 
+TEST_F(HandlerTest, post_inline_and_contextual_callback_do_not_allocate) {
+  std::promise<int> promise;
+  auto future = promise.get_future();
+  auto callback = handler_->BindOnce(
+      [](std::promise<int> promise, int value) { promise.set_value(value); }, std::move(promise));
+
+  uint64_t heap_allocations = common::InlineClosure::GetHeapAllocationCount();
+  std::promise<void> posted;
+  auto posted_future = posted.get_future();
+  handler_->PostInline([&posted]() { posted.set_value(); });
+  callback.Invoke(42);
+  posted_future.wait();
+  EXPECT_EQ(future.get(), 42);
+  EXPECT_EQ(common::InlineClosure::GetHeapAllocationCount(), heap_allocations);
+  handler_->Clear();
+}
+
+class BatchedHandlerTest : public ::testing::Test {
+ protected:
+  static constexpr size_t kMaxTasksPerWakeup = 4;
+
+  void SetUp() override {
+    thread_ = new Thread("test_thread", Thread::Priority::NORMAL);
+    handler_ = new Handler(thread_, kMaxTasksPerWakeup);
+  }
+  void TearDown() override {
+    delete handler_;
+    delete thread_;
+  }
+
+  Handler* handler_;
+  Thread* thread_;
+};
+
+TEST_F(BatchedHandlerTest, tasks_run_in_order) {
+  constexpr int kNumTasks = 100;
+  std::vector<int> order;
+  std::promise<void> blocker_started;
+  auto blocker_started_future = blocker_started.get_future();
+  std::promise<void> can_continue;
+  auto can_continue_future = can_continue.get_future().share();
+
+  // Hold the handler so that the following closures pile up in its queue
+  handler_->Post(common::BindOnce(
+      [](std::promise<void> started, std::shared_future<void> can_continue) {
+        started.set_value();
+        can_continue.wait();
+      },
+      std::move(blocker_started),
+      can_continue_future));
+  blocker_started_future.wait();
+
+  for (int i = 0; i < kNumTasks; i++) {
+    handler_->Post(common::BindOnce([](std::vector<int>* order, int i) { order->push_back(i); }, &order, i));
+  }
+  std::promise<void> done;
+  auto done_future = done.get_future();
+  handler_->Post(common::BindOnce(&std::promise<void>::set_value, common::Unretained(&done)));
+  can_continue.set_value();
+  done_future.wait();
+
+  ASSERT_EQ(order.size(), (size_t)kNumTasks);
+  for (int i = 0; i < kNumTasks; i++) {
+    ASSERT_EQ(order[i], i);
+  }
+
+  handler_->Clear();
+  handler_->WaitUntilStopped(std::chrono::milliseconds(2000));
+
+  auto stats = handler_->GetStats();
+  EXPECT_EQ(stats.tasks, (uint64_t)kNumTasks + 2);
+  EXPECT_EQ(stats.max_tasks_per_wakeup, kMaxTasksPerWakeup);
+  EXPECT_LT(stats.wakeups, stats.tasks);
+}
+
+TEST_F(BatchedHandlerTest, clear_discards_rest_of_batch) {
+  int val = 0;
+  std::promise<void> closure_started;
+  auto closure_started_future = closure_started.get_future();
+  std::promise<void> closure_can_continue;
+  auto can_continue_future = closure_can_continue.get_future();
+  std::promise<void> closure_finished;
+  auto closure_finished_future = closure_finished.get_future();
+
+  // Queue both closures before the handler gets a chance to run, so that they end up in the same batch
+  handler_->Post(common::BindOnce(
+      [](int* val,
+         std::promise<void> closure_started,
+         std::future<void> can_continue_future,
+         std::promise<void> closure_finished) {
+        closure_started.set_value();
+        *val = *val + 1;
+        can_continue_future.wait();
+        closure_finished.set_value();
+      },
+      common::Unretained(&val),
+      std::move(closure_started),
+      std::move(can_continue_future),
+      std::move(closure_finished)));
+  handler_->Post(common::BindOnce([]() { ASSERT_TRUE(false); }));
+  closure_started_future.wait();
+  handler_->Clear();
+  closure_can_continue.set_value();
+  closure_finished_future.wait();
+  ASSERT_EQ(val, 1);
+}
+
+TEST_F(HandlerTest, slow_task_reported_with_location) {
+  std::promise<void> done;
+  auto done_future = done.get_future();
+  handler_->Post(FROM_HERE, common::BindOnce([]() {
+    std::this_thread::sleep_for(HandlerStats::kSlowTaskThreshold + std::chrono::milliseconds(5));
+  }));
+  handler_->Post(FROM_HERE, common::BindOnce(&std::promise<void>::set_value, common::Unretained(&done)));
+  done_future.wait();
+  handler_->Clear();
+  handler_->WaitUntilStopped(std::chrono::milliseconds(2000));
+
+  auto stats = handler_->GetStats();
+  EXPECT_EQ(stats.tasks, 2u);
+  ASSERT_EQ(stats.slow_tasks.size(), 1u);
+  EXPECT_NE(stats.slow_tasks[0].location.find("handler_unittest.cc"), std::string::npos);
+  EXPECT_EQ(stats.slow_tasks[0].count, 1u);
+  EXPECT_GE(stats.slow_tasks[0].max_execution_time, HandlerStats::kSlowTaskThreshold);
+  EXPECT_EQ(stats.execution_time_histogram[HandlerStats::GetHistogramBucket(stats.max_execution_time)], 1u);
+}
+
+TEST(HandlerStatsTest, histogram_buckets) {
+  using std::chrono::microseconds;
+  EXPECT_EQ(HandlerStats::GetHistogramBucket(microseconds(0)), 0u);
+  EXPECT_EQ(HandlerStats::GetHistogramBucket(microseconds(15)), 0u);
+  EXPECT_EQ(HandlerStats::GetHistogramBucket(microseconds(16)), 1u);
+  EXPECT_EQ(HandlerStats::GetHistogramBucket(microseconds(63)), 1u);
+  EXPECT_EQ(HandlerStats::GetHistogramBucket(microseconds(64)), 2u);
+  EXPECT_EQ(HandlerStats::GetHistogramBucket(std::chrono::seconds(10)), HandlerStats::kNumHistogramBuckets - 1);
+  EXPECT_EQ(HandlerStats::GetHistogramBucketUpperBound(0), microseconds(16));
+  EXPECT_EQ(HandlerStats::GetHistogramBucketUpperBound(2), microseconds(256));
+  EXPECT_EQ(HandlerStats::GetHistogramBucketUpperBound(HandlerStats::kNumHistogramBuckets - 1), microseconds::max());
+}
+
 // For Death tests, all the threading needs to be done in the ASSERT_DEATH call
 class HandlerDeathTest : public ::testing::Test {
  protected:
@@ -22,6 +22,7 @@
 #include <cstring>
 
 #include "common/bind.h"
+#include "os/linux_generic/alarm_timer.h"
 #include "os/linux_generic/linux.h"
 #include "os/log.h"
 #include "os/utils.h"
@@ -37,7 +38,8 @@ namespace os {
 using common::Closure;
 using common::OnceClosure;
 
-Alarm::Alarm(Handler* handler) : handler_(handler), fd_(TIMERFD_CREATE(ALARM_CLOCK, 0)) {
+Alarm::Alarm(Handler* handler, AlarmClass alarm_class)
+    : handler_(handler), alarm_class_(alarm_class), fd_(TIMERFD_CREATE(ALARM_CLOCK, 0)) {
   ASSERT_LOG(fd_ != -1, "cannot create timerfd: %s", strerror(errno));
 
   token_ = handler_->thread_->GetReactor()->Register(
@@ -54,10 +56,7 @@ Alarm::~Alarm() {
 
 void Alarm::Schedule(OnceClosure task, std::chrono::milliseconds delay) {
   std::lock_guard<std::mutex> lock(mutex_);
-  long delay_ms = delay.count();
-  itimerspec timer_itimerspec{{/* interval for periodic timer */}, {delay_ms / 1000, delay_ms % 1000 * 1000000}};
-  int result = TIMERFD_SETTIME(fd_, 0, &timer_itimerspec, nullptr);
-  ASSERT(result == 0);
+  expiration_ms_ = ArmAlarmTimer(fd_, ALARM_CLOCK, alarm_class_, delay, std::chrono::milliseconds(0));
 
   task_ = std::move(task);
 }
@@ -74,6 +73,9 @@ void Alarm::on_fire() {
   auto task = std::move(task_);
   uint64_t times_invoked;
   auto bytes_read = read(fd_, &times_invoked, sizeof(uint64_t));
+  if (expiration_ms_ != 0) {
+    RecordDelayedAlarmExpiration(expiration_ms_);
+  }
   lock.unlock();
   ASSERT(bytes_read == static_cast<ssize_t>(sizeof(uint64_t)));
   ASSERT_LOG(
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "os/linux_generic/alarm_timer.h"
+
+#include <sys/timerfd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+#include "os/linux_generic/linux.h"
+#include "os/log.h"
+
+namespace bluetooth {
+namespace os {
+
+static constexpr uint64_t kNormalMaxSlackMs = 10;
+static constexpr uint64_t kLazyMaxSlackMs = 1000;
+
+static std::mutex wakeups_mutex;
+static uint64_t last_expiration_ms = 0;
+static uint64_t wakeups_saved = 0;
+
+static uint64_t GetSlackMs(AlarmClass alarm_class, uint64_t delay_ms) {
+  switch (alarm_class) {
+    case AlarmClass::CRITICAL:
+      return 0;
+    case AlarmClass::NORMAL:
+      return std::min(delay_ms / 256, kNormalMaxSlackMs);
+    case AlarmClass::LAZY:
+      return std::min(delay_ms / 8, kLazyMaxSlackMs);
+  }
+  return 0;
+}
+
+uint64_t ArmAlarmTimer(
+    int fd,
+    clockid_t clock_id,
+    AlarmClass alarm_class,
+    std::chrono::milliseconds delay,
+    std::chrono::milliseconds period) {
+  long delay_ms = delay.count();
+  long period_ms = period.count();
+  itimerspec timer_itimerspec{
+      {period_ms / 1000, period_ms % 1000 * 1000000}, {delay_ms / 1000, delay_ms % 1000 * 1000000}};
+
+  uint64_t slack_ms = delay_ms > 0 ? GetSlackMs(alarm_class, delay_ms) : 0;
+  if (slack_ms == 0) {
+    int result = TIMERFD_SETTIME(fd, 0, &timer_itimerspec, nullptr);
+    ASSERT(result == 0);
+    return 0;
+  }
+
+  timespec now;
+  int result = TIMERFD_CLOCK_GETTIME(clock_id, &now);
+  ASSERT_LOG(result == 0, "cannot read clock %d: %s", clock_id, strerror(errno));
+  uint64_t deadline_ms = now.tv_sec * 1000 + (now.tv_nsec + 999999) / 1000000 + delay_ms;
+
+  // Move the deadline to the time in [deadline, deadline + slack] with the most trailing zero bits
+  uint64_t limit_ms = deadline_ms + slack_ms;
+  int bit = 63 - __builtin_clzll(deadline_ms ^ limit_ms);
+  uint64_t expiration_ms = limit_ms & ~((1ULL << bit) - 1);
+
+  timer_itimerspec.it_value = {
+      static_cast<time_t>(expiration_ms / 1000), static_cast<long>(expiration_ms % 1000 * 1000000)};
+  result = TIMERFD_SETTIME(fd, TFD_TIMER_ABSTIME, &timer_itimerspec, nullptr);
+  ASSERT(result == 0);
+  return expiration_ms;
+}
+
+void RecordDelayedAlarmExpiration(uint64_t expiration_ms) {
+  std::lock_guard<std::mutex> lock(wakeups_mutex);
+  if (expiration_ms == last_expiration_ms) {
+    wakeups_saved++;
+  }
+  last_expiration_ms = expiration_ms;
+}
+
+uint64_t GetAlarmWakeupsSaved() {
+  std::lock_guard<std::mutex> lock(wakeups_mutex);
+  return wakeups_saved;
+}
+
+}  // namespace os
+}  // namespace bluetooth
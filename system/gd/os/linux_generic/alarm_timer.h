@@ -0,0 +1,42 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <time.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "os/alarm.h"
+
+namespace bluetooth {
+namespace os {
+
+// Arms the timerfd |fd| of an alarm of |alarm_class| to expire after |delay| on |clock_id|, and then every |period| if
+// it is not zero. Returns the first expiration time in ms if it was delayed by the slack of the class, 0 otherwise.
+uint64_t ArmAlarmTimer(
+    int fd,
+    clockid_t clock_id,
+    AlarmClass alarm_class,
+    std::chrono::milliseconds delay,
+    std::chrono::milliseconds period);
+
+// Records the expiration of a timer at the delayed |expiration_ms| returned by ArmAlarmTimer().
+void RecordDelayedAlarmExpiration(uint64_t expiration_ms);
+
+}  // namespace os
+}  // namespace bluetooth
@@ -50,9 +50,9 @@ class AlarmTest : public ::testing::Test {
     handler_->Post(common::BindOnce(fake_timerfd_advance, ms));
   }
   Alarm* alarm_;
+  Handler* handler_;
 
  private:
-  Handler* handler_;
   Thread* thread_;
 };
 
@@ -71,6 +71,39 @@ TEST_F(AlarmTest, schedule) {
   ASSERT_FALSE(future.valid());
 }
 
+TEST_F(AlarmTest, schedule_lazy) {
+  delete alarm_;
+  alarm_ = new Alarm(handler_, AlarmClass::LAZY);
+  std::promise<void> promise;
+  auto future = promise.get_future();
+  // Delayed by up to 125 ms, to 1024 ms
+  alarm_->Schedule(
+      BindOnce(&std::promise<void>::set_value, common::Unretained(&promise)), std::chrono::milliseconds(1000));
+  fake_timer_advance(1000);
+  ASSERT_EQ(future.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+  fake_timer_advance(24);
+  future.get();
+}
+
+TEST_F(AlarmTest, lazy_alarms_share_wakeup) {
+  uint64_t wakeups_saved = GetAlarmWakeupsSaved();
+  Alarm first_alarm(handler_, AlarmClass::LAZY);
+  Alarm second_alarm(handler_, AlarmClass::LAZY);
+  std::promise<void> first_promise;
+  std::promise<void> second_promise;
+  auto first_future = first_promise.get_future();
+  auto second_future = second_promise.get_future();
+  // Both delayed to 2048 ms
+  first_alarm.Schedule(
+      BindOnce(&std::promise<void>::set_value, common::Unretained(&first_promise)), std::chrono::milliseconds(2000));
+  second_alarm.Schedule(
+      BindOnce(&std::promise<void>::set_value, common::Unretained(&second_promise)), std::chrono::milliseconds(2040));
+  fake_timer_advance(2048);
+  first_future.get();
+  second_future.get();
+  EXPECT_EQ(GetAlarmWakeupsSaved(), wakeups_saved + 1);
+}
+
 TEST_F(AlarmTest, cancel_alarm) {
   alarm_->Schedule(BindOnce([]() { ASSERT_TRUE(false) << "Should not happen"; }), std::chrono::milliseconds(3));
   alarm_->Cancel();
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "os/deferred_event_queue.h"
+
+#include <pthread.h>
+
+#include <future>
+
+#include "os/log.h"
+
+namespace bluetooth {
+namespace os {
+
+namespace {
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+}  // namespace
+
+DeferredEventQueue::DeferredEventQueue(const std::string& name, size_t capacity)
+    : name_(name), mask_(RoundUpToPowerOfTwo(capacity) - 1), slots_(new Slot[mask_ + 1]) {
+  for (size_t i = 0; i <= mask_; i++) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  thread_ = std::thread(&DeferredEventQueue::Run, this);
+}
+
+DeferredEventQueue::~DeferredEventQueue() {
+  quit_ = true;
+  if (sleeping_) {
+    std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+    wake_cv_.notify_one();
+  }
+  thread_.join();
+}
+
+void DeferredEventQueue::Flush() {
+  std::promise<void> promise;
+  auto future = promise.get_future();
+  // Unlike regular events, the flush marker must not be dropped
+  while (!Post([&promise]() { promise.set_value(); })) {
+    std::this_thread::yield();
+  }
+  future.wait();
+}
+
+DeferredEventQueue::Slot* DeferredEventQueue::ClaimSlot() {
+  size_t position = enqueue_position_.load(std::memory_order_relaxed);
+  while (true) {
+    Slot* slot = &slots_[position & mask_];
+    size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+    if (difference == 0) {
+      if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        slot->position = position;
+        return slot;
+      }
+    } else if (difference < 0) {
+      // The slot still holds the event posted one lap ago
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    } else {
+      position = enqueue_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void DeferredEventQueue::Publish(Slot* slot) {
+  // Sequentially consistent so that a worker about to sleep either sees the event or is seen as sleeping here
+  slot->sequence.store(slot->position + 1);
+  if (sleeping_) {
+    std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+    wake_cv_.notify_one();
+  }
+}
+
+bool DeferredEventQueue::IsNextReady() const {
+  return slots_[dequeue_position_ & mask_].sequence.load() == dequeue_position_ + 1;
+}
+
+bool DeferredEventQueue::RunOne() {
+  if (!IsNextReady()) {
+    return false;
+  }
+  Slot* slot = &slots_[dequeue_position_ & mask_];
+  processed_count_.fetch_add(1, std::memory_order_relaxed);
+  slot->run_and_destroy(slot->storage);
+  slot->sequence.store(dequeue_position_ + mask_ + 1, std::memory_order_release);
+  dequeue_position_++;
+  return true;
+}
+
+void DeferredEventQueue::Run() {
+  pthread_setname_np(pthread_self(), name_.substr(0, 15).c_str());
+
+  while (true) {
+    // Everything posted since the last wake up runs as one batch
+    while (RunOne()) {
+    }
+
+    uint64_t dropped_count = GetDroppedCount();
+    if (dropped_count != reported_dropped_count_) {
+      LOG_WARN(
+          "%s dropped %llu events, %llu in total",
+          name_.c_str(),
+          static_cast<unsigned long long>(dropped_count - reported_dropped_count_),
+          static_cast<unsigned long long>(dropped_count));
+      reported_dropped_count_ = dropped_count;
+    }
+
+    std::unique_lock<std::mutex> wake_lock(wake_mutex_);
+    sleeping_ = true;
+    // Checked after sleeping_ is set, a producer either sees sleeping_ or has published its event here
+    if (!IsNextReady()) {
+      if (quit_) {
+        break;
+      }
+      wake_cv_.wait(wake_lock);
+    }
+    sleeping_ = false;
+  }
+}
+
+}  // namespace os
+}  // namespace bluetooth
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "os/deferred_event_queue.h"
+
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace bluetooth {
+namespace os {
+namespace {
+
+TEST(DeferredEventQueueTest, events_run_on_worker_thread) {
+  DeferredEventQueue queue("test_queue", 8);
+  std::promise<std::thread::id> promise;
+  auto future = promise.get_future();
+  ASSERT_TRUE(queue.Post([&promise]() { promise.set_value(std::this_thread::get_id()); }));
+  EXPECT_NE(future.get(), std::this_thread::get_id());
+  queue.Flush();
+  EXPECT_EQ(queue.GetProcessedCount(), 2u);
+  EXPECT_EQ(queue.GetDroppedCount(), 0u);
+}
+
+TEST(DeferredEventQueueTest, events_from_each_thread_run_in_order) {
+  constexpr int kProducers = 4;
+  constexpr int kEventsPerProducer = 10000;
+  DeferredEventQueue queue("test_queue", 256);
+  // Only accessed on the worker thread
+  std::vector<int> next_value(kProducers, 0);
+  int out_of_order = 0;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; p++) {
+    producers.emplace_back([&, p]() {
+      for (int i = 0; i < kEventsPerProducer; i++) {
+        while (!queue.Post([&, p, i]() {
+          if (next_value[p] != i) {
+            out_of_order++;
+          }
+          next_value[p] = i + 1;
+        })) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  queue.Flush();
+  EXPECT_EQ(out_of_order, 0);
+  for (int p = 0; p < kProducers; p++) {
+    EXPECT_EQ(next_value[p], kEventsPerProducer);
+  }
+}
+
+TEST(DeferredEventQueueTest, full_queue_drops_events) {
+  DeferredEventQueue queue("test_queue", 4);
+  std::promise<void> blocked;
+  std::shared_future<void> unblock = blocked.get_future().share();
+  std::promise<void> started;
+  auto started_future = started.get_future();
+  ASSERT_TRUE(queue.Post([&started, unblock]() {
+    started.set_value();
+    unblock.wait();
+  }));
+  started_future.wait();
+
+  // The running event keeps its slot until it returns, three more fit
+  int counter = 0;
+  for (int i = 0; i < 3; i++) {
+    EXPECT_TRUE(queue.Post([&counter]() { counter++; }));
+  }
+  auto dropped = std::make_shared<int>(0);
+  EXPECT_FALSE(queue.Post([dropped]() { FAIL() << "Should not happen"; }));
+  EXPECT_EQ(dropped.use_count(), 1);
+  EXPECT_EQ(queue.GetDroppedCount(), 1u);
+
+  blocked.set_value();
+  queue.Flush();
+  EXPECT_EQ(counter, 3);
+}
+
+TEST(DeferredEventQueueTest, destructor_runs_pending_events) {
+  int counter = 0;
+  {
+    DeferredEventQueue queue("test_queue", 128);
+    for (int i = 0; i < 100; i++) {
+      queue.Post([&counter]() { counter++; });
+    }
+  }
+  EXPECT_EQ(counter, 100);
+}
+
+}  // namespace
+}  // namespace os
+}  // namespace bluetooth
@@ -25,8 +25,10 @@
 #define TIMERFD_CREATE ::bluetooth::os::fake_timer::fake_timerfd_create
 #define TIMERFD_SETTIME ::bluetooth::os::fake_timer::fake_timerfd_settime
 #define TIMERFD_CLOSE ::bluetooth::os::fake_timer::fake_timerfd_close
+#define TIMERFD_CLOCK_GETTIME ::bluetooth::os::fake_timer::fake_clock_gettime
 #else
 #define TIMERFD_CREATE timerfd_create
 #define TIMERFD_SETTIME timerfd_settime
 #define TIMERFD_CLOSE close
+#define TIMERFD_CLOCK_GETTIME clock_gettime
 #endif
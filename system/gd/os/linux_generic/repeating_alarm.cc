@@ -22,6 +22,7 @@
 #include <cstring>
 
 #include "common/bind.h"
+#include "os/linux_generic/alarm_timer.h"
 #include "os/linux_generic/linux.h"
 #include "os/log.h"
 #include "os/utils.h"
@@ -36,7 +37,8 @@ namespace bluetooth {
 namespace os {
 using common::Closure;
 
-RepeatingAlarm::RepeatingAlarm(Handler* handler) : handler_(handler), fd_(TIMERFD_CREATE(ALARM_CLOCK, 0)) {
+RepeatingAlarm::RepeatingAlarm(Handler* handler, AlarmClass alarm_class)
+    : handler_(handler), alarm_class_(alarm_class), fd_(TIMERFD_CREATE(ALARM_CLOCK, 0)) {
   ASSERT(fd_ != -1);
 
   token_ = handler_->thread_->GetReactor()->Register(
@@ -53,11 +55,8 @@ RepeatingAlarm::~RepeatingAlarm() {
 
 void RepeatingAlarm::Schedule(Closure task, std::chrono::milliseconds period) {
   std::lock_guard<std::mutex> lock(mutex_);
-  long period_ms = period.count();
-  itimerspec timer_itimerspec{{period_ms / 1000, period_ms % 1000 * 1000000},
-                              {period_ms / 1000, period_ms % 1000 * 1000000}};
-  int result = TIMERFD_SETTIME(fd_, 0, &timer_itimerspec, nullptr);
-  ASSERT(result == 0);
+  expiration_ms_ = ArmAlarmTimer(fd_, ALARM_CLOCK, alarm_class_, period, period);
+  period_ms_ = period.count();
 
   task_ = std::move(task);
 }
@@ -74,6 +73,10 @@ void RepeatingAlarm::on_fire() {
   auto task = task_;
   uint64_t times_invoked;
   auto bytes_read = read(fd_, &times_invoked, sizeof(uint64_t));
+  if (expiration_ms_ != 0 && bytes_read == static_cast<ssize_t>(sizeof(uint64_t))) {
+    RecordDelayedAlarmExpiration(expiration_ms_ + (times_invoked - 1) * period_ms_);
+    expiration_ms_ += times_invoked * period_ms_;
+  }
   lock.unlock();
   task.Run();
   ASSERT(bytes_read == static_cast<ssize_t>(sizeof(uint64_t)));
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+template <typename T>
+SpscQueue<T>::Signal::Signal(bool set) : fd_(eventfd(set ? 1 : 0, EFD_NONBLOCK)) {
+  ASSERT(fd_ != -1);
+}
+
+template <typename T>
+SpscQueue<T>::Signal::~Signal() {
+  ASSERT_LOG(close(fd_) != -1, "close failed: %s", strerror(errno));
+}
+
+template <typename T>
+void SpscQueue<T>::Signal::Set() {
+  auto write_result = eventfd_write(fd_, 1);
+  ASSERT_LOG(write_result != -1, "set failed: %s", strerror(errno));
+}
+
+template <typename T>
+void SpscQueue<T>::Signal::Reset() {
+  eventfd_t value = 0;
+  auto read_result = eventfd_read(fd_, &value);
+  ASSERT_LOG(read_result != -1 || errno == EAGAIN, "reset failed: %s", strerror(errno));
+}
+
+template <typename T>
+SpscQueue<T>::SpscQueue(size_t capacity)
+    : capacity_(capacity), ring_(capacity), enqueue_(true), dequeue_(false) {
+  ASSERT(capacity_ > 0);
+}
+
+template <typename T>
+SpscQueue<T>::~SpscQueue() {
+  ASSERT_LOG(enqueue_.handler_ == nullptr, "Enqueue is not unregistered");
+  ASSERT_LOG(dequeue_.handler_ == nullptr, "Dequeue is not unregistered");
+}
+
+template <typename T>
+void SpscQueue<T>::RegisterEnqueue(Handler* handler, EnqueueCallback callback) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ASSERT(enqueue_.handler_ == nullptr);
+  ASSERT(enqueue_.reactable_ == nullptr);
+  enqueue_.handler_ = handler;
+  enqueue_.reactable_ = enqueue_.handler_->thread_->GetReactor()->Register(
+      enqueue_.signal_.GetFd(),
+      base::Bind(&SpscQueue<T>::EnqueueCallbackInternal, base::Unretained(this), std::move(callback)),
+      base::Closure());
+}
+
+template <typename T>
+void SpscQueue<T>::UnregisterEnqueue() {
+  UnregisterEndpoint(enqueue_);
+}
+
+template <typename T>
+void SpscQueue<T>::RegisterDequeue(Handler* handler, DequeueCallback callback) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ASSERT(dequeue_.handler_ == nullptr);
+  ASSERT(dequeue_.reactable_ == nullptr);
+  dequeue_.handler_ = handler;
+  dequeue_.reactable_ = dequeue_.handler_->thread_->GetReactor()->Register(
+      dequeue_.signal_.GetFd(),
+      base::Bind(&SpscQueue<T>::DequeueCallbackInternal, base::Unretained(this), std::move(callback)),
+      base::Closure());
+}
+
+template <typename T>
+void SpscQueue<T>::UnregisterDequeue() {
+  UnregisterEndpoint(dequeue_);
+}
+
+template <typename T>
+void SpscQueue<T>::UnregisterEndpoint(QueueEndpoint& endpoint) {
+  Reactor* reactor = nullptr;
+  Reactor::Reactable* to_unregister = nullptr;
+  bool wait_for_unregister = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT(endpoint.reactable_ != nullptr);
+    reactor = endpoint.handler_->thread_->GetReactor();
+    wait_for_unregister = (!endpoint.handler_->thread_->IsSameThread());
+    to_unregister = endpoint.reactable_;
+    endpoint.reactable_ = nullptr;
+    endpoint.handler_ = nullptr;
+  }
+  reactor->Unregister(to_unregister);
+  if (wait_for_unregister) {
+    reactor->WaitForUnregisteredReactable(std::chrono::milliseconds(1000));
+  }
+}
+
+template <typename T>
+std::unique_ptr<T> SpscQueue<T>::TryDequeue() {
+  size_t head = head_.load();
+  if (head == tail_.load()) {
+    return nullptr;
+  }
+
+  std::unique_ptr<T> data = std::move(ring_[head % capacity_]);
+  head_.store(head + 1);
+  // Load the tail after publishing the new head, so that either this end sees the item that filled the queue or
+  // the enqueue end sees the freed slot.
+  size_t tail = tail_.load();
+
+  // Wake up the enqueue end only on the full to non-full transition.
+  if (tail - head >= capacity_) {
+    enqueue_.signal_.Set();
+  }
+
+  // Stop waking up the dequeue end once drained. Check again after the reset, in case the enqueue end pushed an
+  // item and raised the signal in between.
+  if (head + 1 == tail) {
+    dequeue_.signal_.Reset();
+    if (Size() != 0) {
+      dequeue_.signal_.Set();
+    }
+  }
+  return data;
+}
+
+template <typename T>
+void SpscQueue<T>::EnqueueCallbackInternal(EnqueueCallback callback) {
+  if (Size() == capacity_) {
+    // Stale wakeup, the queue filled up since the signal was raised.
+    enqueue_.signal_.Reset();
+    if (Size() < capacity_) {
+      enqueue_.signal_.Set();
+    }
+    return;
+  }
+
+  std::unique_ptr<T> data = callback.Run();
+  ASSERT(data != nullptr);
+
+  size_t tail = tail_.load();
+  ring_[tail % capacity_] = std::move(data);
+  tail_.store(tail + 1);
+  size_t size = tail + 1 - head_.load();
+
+  // Wake up the dequeue end only on the empty to non-empty transition.
+  if (size == 1) {
+    dequeue_.signal_.Set();
+  }
+
+  if (size == capacity_) {
+    enqueue_.signal_.Reset();
+    if (Size() < capacity_) {
+      enqueue_.signal_.Set();
+    }
+  }
+}
+
+template <typename T>
+void SpscQueue<T>::DequeueCallbackInternal(DequeueCallback callback) {
+  if (Size() == 0) {
+    // Stale wakeup, the queue was drained since the signal was raised.
+    dequeue_.signal_.Reset();
+    if (Size() != 0) {
+      dequeue_.signal_.Set();
+    }
+    return;
+  }
+  callback.Run();
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "os/spsc_queue.h"
+
+#include <chrono>
+#include <future>
+#include <queue>
+
+#include "common/bind.h"
+#include "gtest/gtest.h"
+#include "os/handler.h"
+#include "os/thread.h"
+
+using namespace std::chrono_literals;
+
+namespace bluetooth {
+namespace os {
+namespace {
+
+constexpr int kQueueSize = 10;
+
+class SpscQueueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    enqueue_thread_ = new Thread("enqueue_thread", Thread::Priority::NORMAL);
+    enqueue_handler_ = new Handler(enqueue_thread_);
+    dequeue_thread_ = new Thread("dequeue_thread", Thread::Priority::NORMAL);
+    dequeue_handler_ = new Handler(dequeue_thread_);
+  }
+  void TearDown() override {
+    enqueue_handler_->Clear();
+    delete enqueue_handler_;
+    delete enqueue_thread_;
+    dequeue_handler_->Clear();
+    delete dequeue_handler_;
+    delete dequeue_thread_;
+  }
+
+  void SyncHandler(Handler* handler) {
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    handler->Post(common::BindOnce([](std::promise<void> promise) { promise.set_value(); }, std::move(promise)));
+    ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+  }
+
+  Thread* enqueue_thread_;
+  Handler* enqueue_handler_;
+  Thread* dequeue_thread_;
+  Handler* dequeue_handler_;
+};
+
+TEST_F(SpscQueueTest, try_dequeue_empty_queue) {
+  SpscQueue<int> queue(kQueueSize);
+  EXPECT_EQ(queue.TryDequeue(), nullptr);
+}
+
+TEST_F(SpscQueueTest, enqueue_stops_when_full) {
+  SpscQueue<int> queue(kQueueSize);
+  int next = 0;
+  enqueue_handler_->Post(common::BindOnce(
+      [](SpscQueue<int>* queue, Handler* handler, int* next) {
+        queue->RegisterEnqueue(
+            handler, common::Bind([](int* next) { return std::make_unique<int>((*next)++); }, common::Unretained(next)));
+      },
+      common::Unretained(&queue),
+      common::Unretained(enqueue_handler_),
+      common::Unretained(&next)));
+
+  std::this_thread::sleep_for(20ms);
+  SyncHandler(enqueue_handler_);
+  EXPECT_EQ(next, kQueueSize);
+
+  queue.UnregisterEnqueue();
+  for (int i = 0; i < kQueueSize; i++) {
+    auto data = queue.TryDequeue();
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(*data, i);
+  }
+  EXPECT_EQ(queue.TryDequeue(), nullptr);
+}
+
+TEST_F(SpscQueueTest, dequeue_callback_not_invoked_when_empty) {
+  SpscQueue<int> queue(kQueueSize);
+  int count = 0;
+  queue.RegisterDequeue(
+      dequeue_handler_, common::Bind([](int* count) { (*count)++; }, common::Unretained(&count)));
+  std::this_thread::sleep_for(20ms);
+  SyncHandler(dequeue_handler_);
+  EXPECT_EQ(count, 0);
+  queue.UnregisterDequeue();
+}
+
+TEST_F(SpscQueueTest, transfer_in_order_across_threads) {
+  constexpr int kNumItems = 10000;
+  SpscQueue<int> queue(kQueueSize);
+
+  std::queue<std::unique_ptr<int>> to_enqueue;
+  for (int i = 0; i < kNumItems; i++) {
+    to_enqueue.push(std::make_unique<int>(i));
+  }
+
+  std::promise<void> done;
+  auto done_future = done.get_future();
+  int expected = 0;
+  queue.RegisterDequeue(
+      dequeue_handler_,
+      common::Bind(
+          [](SpscQueue<int>* queue, int* expected, std::promise<void>* done) {
+            auto data = queue->TryDequeue();
+            ASSERT_NE(data, nullptr);
+            ASSERT_EQ(*data, *expected);
+            if (++(*expected) == kNumItems) {
+              queue->UnregisterDequeue();
+              done->set_value();
+            }
+          },
+          common::Unretained(&queue),
+          common::Unretained(&expected),
+          common::Unretained(&done)));
+
+  queue.RegisterEnqueue(
+      enqueue_handler_,
+      common::Bind(
+          [](SpscQueue<int>* queue, std::queue<std::unique_ptr<int>>* to_enqueue) {
+            auto data = std::move(to_enqueue->front());
+            to_enqueue->pop();
+            if (to_enqueue->empty()) {
+              queue->UnregisterEnqueue();
+            }
+            return data;
+          },
+          common::Unretained(&queue),
+          common::Unretained(&to_enqueue)));
+
+  ASSERT_EQ(done_future.wait_for(5s), std::future_status::ready);
+  EXPECT_EQ(expected, kNumItems);
+  EXPECT_EQ(queue.TryDequeue(), nullptr);
+}
+
+TEST_F(SpscQueueTest, enqueue_buffer) {
+  constexpr int kNumItems = 100;
+  SpscQueue<int> queue(kQueueSize);
+  EnqueueBuffer<int> enqueue_buffer(&queue);
+
+  std::promise<void> done;
+  auto done_future = done.get_future();
+  int expected = 0;
+  queue.RegisterDequeue(
+      dequeue_handler_,
+      common::Bind(
+          [](SpscQueue<int>* queue, int* expected, std::promise<void>* done) {
+            auto data = queue->TryDequeue();
+            ASSERT_NE(data, nullptr);
+            ASSERT_EQ(*data, *expected);
+            if (++(*expected) == kNumItems) {
+              queue->UnregisterDequeue();
+              done->set_value();
+            }
+          },
+          common::Unretained(&queue),
+          common::Unretained(&expected),
+          common::Unretained(&done)));
+
+  for (int i = 0; i < kNumItems; i++) {
+    enqueue_buffer.Enqueue(std::make_unique<int>(i), enqueue_handler_);
+  }
+
+  ASSERT_EQ(done_future.wait_for(5s), std::future_status::ready);
+  SyncHandler(enqueue_handler_);
+  EXPECT_EQ(enqueue_buffer.Size(), 0u);
+}
+
+}  // namespace
+}  // namespace os
+}  // namespace bluetooth
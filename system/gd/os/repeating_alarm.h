@@ -21,6 +21,7 @@
 #include <mutex>
 
 #include "common/callback.h"
+#include "os/alarm.h"
 #include "os/handler.h"
 #include "os/thread.h"
 #include "os/utils.h"
@@ -34,7 +35,7 @@ namespace os {
 class RepeatingAlarm {
  public:
   // Create and register a repeating alarm on a given handler
-  explicit RepeatingAlarm(Handler* handler);
+  explicit RepeatingAlarm(Handler* handler, AlarmClass alarm_class = AlarmClass::NORMAL);
 
   RepeatingAlarm(const RepeatingAlarm&) = delete;
   RepeatingAlarm& operator=(const RepeatingAlarm&) = delete;
@@ -51,7 +52,11 @@ class RepeatingAlarm {
  private:
   common::Closure task_;
   Handler* handler_;
+  AlarmClass alarm_class_;
   int fd_ = 0;
+  // Next expiration time of a delayed alarm on the alarm clock, 0 if not delayed
+  uint64_t expiration_ms_ = 0;
+  uint64_t period_ms_ = 0;
   Reactor::Reactable* token_;
   mutable std::mutex mutex_;
   void on_fire();
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "os/handler.h"
+#include "os/queue.h"
+
+namespace bluetooth {
+namespace os {
+
+// A bounded queue for the common case of exactly one enqueue handler and one dequeue handler, with the same
+// registration semantics as |Queue|.
+//
+// Items are kept in a lock-free ring buffer. Instead of signalling an eventfd for every item, the dequeue end is
+// woken up only when the queue goes from empty to non-empty and the enqueue end only when it goes from full to
+// non-full, so a burst of packets costs a single wakeup on each side.
+//
+// Only one thread may enqueue (through the registered EnqueueCallback) and only one thread may call TryDequeue
+// at any time.
+template <typename T>
+class SpscQueue : public IQueueEnqueue<T>, public IQueueDequeue<T> {
+ public:
+  // See documentation for |Queue|
+  using EnqueueCallback = common::Callback<std::unique_ptr<T>()>;
+  using DequeueCallback = common::Callback<void()>;
+  // Create a queue with |capacity| is the maximum number of messages a queue can contain
+  explicit SpscQueue(size_t capacity);
+  ~SpscQueue();
+  // Register |callback| that will be called on |handler| when the queue is able to enqueue one piece of data.
+  // This will cause a crash if handler or callback has already been registered before.
+  void RegisterEnqueue(Handler* handler, EnqueueCallback callback) override;
+  // Unregister current EnqueueCallback from this queue, this will cause a crash if not registered yet.
+  void UnregisterEnqueue() override;
+  // Register |callback| that will be called on |handler| when the queue has at least one piece of data ready
+  // for dequeue. This will cause a crash if handler or callback has already been registered before.
+  void RegisterDequeue(Handler* handler, DequeueCallback callback) override;
+  // Unregister current DequeueCallback from this queue, this will cause a crash if not registered yet.
+  void UnregisterDequeue() override;
+
+  // Try to dequeue an item from this queue. Return nullptr when there is nothing in the queue.
+  std::unique_ptr<T> TryDequeue() override;
+
+ private:
+  // A level-triggered eventfd, readable while it is set.
+  class Signal {
+   public:
+    explicit Signal(bool set);
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+    ~Signal();
+    void Set();
+    void Reset();
+    int GetFd() const {
+      return fd_;
+    }
+
+   private:
+    int fd_;
+  };
+
+  class QueueEndpoint {
+   public:
+    explicit QueueEndpoint(bool readable) : signal_(readable), handler_(nullptr), reactable_(nullptr) {}
+    Signal signal_;
+    Handler* handler_;
+    Reactor::Reactable* reactable_;
+  };
+
+  void EnqueueCallbackInternal(EnqueueCallback callback);
+  void DequeueCallbackInternal(DequeueCallback callback);
+  void UnregisterEndpoint(QueueEndpoint& endpoint);
+
+  size_t Size() const {
+    return tail_.load() - head_.load();
+  }
+
+  const size_t capacity_;
+  std::vector<std::unique_ptr<T>> ring_;
+  // Monotonic positions, |tail_| is only written by the enqueue end and |head_| only by the dequeue end.
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  // A mutex that guards endpoint registration, not the data path
+  std::mutex mutex_;
+
+  QueueEndpoint enqueue_;
+  QueueEndpoint dequeue_;
+};
+
+#include "os/linux_generic/spsc_queue.tpp"
+
+}  // namespace os
+}  // namespace bluetooth
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Trace events for the data paths.
+//
+// On Android the events are emitted through atrace with the Bluetooth tag, and recorded by Perfetto
+// when that category is enabled. A disabled tag costs a single load and branch per event.
+//
+// On other platforms the events are recorded in an in-memory ring buffer when the stack is built
+// with BT_TRACE_RING_BUFFER defined, and compile to nothing otherwise. The define must be set for
+// the whole build, not per file.
+//
+//   BT_TRACE_SCOPED("HCI ACL TX");                 // slice covering the rest of the scope
+//   BT_TRACE_SCOPED_ID("L2CAP SDU TX", cid);       // slice annotated with a handle or channel id
+//   BT_TRACE_COUNTER("ACL credits", credits);      // counter track
+
+#if defined(__ANDROID__)
+#include <cutils/trace.h>
+
+#include <cstdio>
+#elif defined(BT_TRACE_RING_BUFFER)
+#include <array>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#endif
+
+namespace bluetooth {
+namespace os {
+
+#if defined(__ANDROID__)
+
+class ScopedTrace {
+ public:
+  explicit ScopedTrace(const char* name) {
+    if (atrace_is_tag_enabled(ATRACE_TAG_BLUETOOTH)) {
+      enabled_ = true;
+      atrace_begin(ATRACE_TAG_BLUETOOTH, name);
+    }
+  }
+
+  ScopedTrace(const char* name, uint32_t id) {
+    if (atrace_is_tag_enabled(ATRACE_TAG_BLUETOOTH)) {
+      enabled_ = true;
+      char annotated_name[64];
+      snprintf(annotated_name, sizeof(annotated_name), "%s 0x%04x", name, id);
+      atrace_begin(ATRACE_TAG_BLUETOOTH, annotated_name);
+    }
+  }
+
+  ~ScopedTrace() {
+    if (enabled_) {
+      atrace_end(ATRACE_TAG_BLUETOOTH);
+    }
+  }
+
+  ScopedTrace(const ScopedTrace&) = delete;
+  ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+ private:
+  bool enabled_{false};
+};
+
+inline void TraceCounter(const char* name, int64_t value) {
+  atrace_int64(ATRACE_TAG_BLUETOOTH, name, value);
+}
+
+#elif defined(BT_TRACE_RING_BUFFER)
+
+struct TraceRecord {
+  enum class Type : uint8_t { BEGIN, END, COUNTER };
+
+  std::chrono::steady_clock::time_point timestamp;
+  Type type;
+  // Names are string literals, only the pointer is stored
+  const char* name;
+  // Handle or channel id for BEGIN, value for COUNTER
+  int64_t value;
+};
+
+class TraceRingBuffer {
+ public:
+  static constexpr size_t kCapacity = 4096;
+
+  static TraceRingBuffer& Get() {
+    static TraceRingBuffer ring_buffer;
+    return ring_buffer;
+  }
+
+  void Record(TraceRecord::Type type, const char* name, int64_t value) {
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_[next_ % kCapacity] = {now, type, name, value};
+    next_++;
+  }
+
+  // Visit the recorded events, oldest first.
+  void ForEach(const std::function<void(const TraceRecord&)>& visitor) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t first = next_ > kCapacity ? next_ - kCapacity : 0;
+    for (size_t i = first; i < next_; i++) {
+      visitor(records_[i % kCapacity]);
+    }
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::array<TraceRecord, kCapacity> records_{};
+  size_t next_{0};
+};
+
+class ScopedTrace {
+ public:
+  explicit ScopedTrace(const char* name, uint32_t id = 0) : name_(name) {
+    TraceRingBuffer::Get().Record(TraceRecord::Type::BEGIN, name, id);
+  }
+
+  ~ScopedTrace() {
+    TraceRingBuffer::Get().Record(TraceRecord::Type::END, name_, 0);
+  }
+
+  ScopedTrace(const ScopedTrace&) = delete;
+  ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+ private:
+  const char* name_;
+};
+
+inline void TraceCounter(const char* name, int64_t value) {
+  TraceRingBuffer::Get().Record(TraceRecord::Type::COUNTER, name, value);
+}
+
+#endif
+
+}  // namespace os
+}  // namespace bluetooth
+
+#if defined(__ANDROID__) || defined(BT_TRACE_RING_BUFFER)
+#define BT_TRACE_CONCAT_INNER(a, b) a##b
+#define BT_TRACE_CONCAT(a, b) BT_TRACE_CONCAT_INNER(a, b)
+#define BT_TRACE_SCOPED(name) ::bluetooth::os::ScopedTrace BT_TRACE_CONCAT(bt_trace_, __LINE__)(name)
+#define BT_TRACE_SCOPED_ID(name, id) \
+  ::bluetooth::os::ScopedTrace BT_TRACE_CONCAT(bt_trace_, __LINE__)(name, static_cast<uint32_t>(id))
+#define BT_TRACE_COUNTER(name, value) ::bluetooth::os::TraceCounter(name, static_cast<int64_t>(value))
+#else
+#define BT_TRACE_SCOPED(name) \
+  do {                        \
+  } while (0)
+#define BT_TRACE_SCOPED_ID(name, id) \
+  do {                               \
+  } while (0)
+#define BT_TRACE_COUNTER(name, value) \
+  do {                                \
+  } while (0)
+#endif
@@ -38,6 +38,14 @@ class BasePacketBuilder {
   // Write to the vector with the given iterator.
   virtual void Serialize(BitInserter& it) const = 0;
 
+  // Append the packet to |output|. The vector is grown once to fit size()
+  // bytes up front so that the byte by byte insertion never reallocates.
+  void SerializeInto(std::vector<uint8_t>& output) const {
+    output.reserve(output.size() + size());
+    BitInserter it(output);
+    Serialize(it);
+  }
+
   void SetFlushable(bool is_flushable) {
     is_flushable_ = is_flushable;
   }
@@ -138,7 +138,7 @@ uint8_t Iterator<little_endian>::operator*() const {
       end_);
   size_t index = index_;
 
-  for (auto view : data_) {
+  for (const auto& view : data_) {
     if (index < view.size()) {
       return view[index];
     }
@@ -156,6 +156,21 @@ size_t Iterator<little_endian>::NumBytesRemaining() const {
   return 0;
 }
 
+template <bool little_endian>
+const uint8_t* Iterator<little_endian>::ContiguousBytes(size_t length) const {
+  if (NumBytesRemaining() < length) {
+    return nullptr;
+  }
+  size_t index = index_;
+  for (const auto& view : data_) {
+    if (index < view.size()) {
+      return (index + length <= view.size()) ? view.data() + index : nullptr;
+    }
+    index -= view.size();
+  }
+  return nullptr;
+}
+
 template <bool little_endian>
 Iterator<little_endian> Iterator<little_endian>::Subrange(size_t index, size_t length) const {
   Iterator<little_endian> to_return(*this);
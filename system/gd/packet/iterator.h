@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <forward_list>
 #include <memory>
 #include <type_traits>
@@ -84,6 +85,21 @@ class Iterator : public IteratorTraits {
     T extracted_value{};
     uint8_t* value_ptr = (uint8_t*)&extracted_value;
 
+    // Fast path: the value does not straddle two fragments, so copy it in one
+    // go instead of searching the fragment list once per byte.
+    const uint8_t* bytes = ContiguousBytes(sizeof(T));
+    if (bytes != nullptr) {
+      if (little_endian) {
+        std::memcpy(value_ptr, bytes, sizeof(T));
+      } else {
+        for (size_t i = 0; i < sizeof(T); i++) {
+          value_ptr[sizeof(T) - i - 1] = bytes[i];
+        }
+      }
+      index_ += sizeof(T);
+      return extracted_value;
+    }
+
     for (size_t i = 0; i < sizeof(T); i++) {
       size_t index = (little_endian ? i : sizeof(T) - i - 1);
       value_ptr[index] = this->operator*();
@@ -95,6 +111,16 @@ class Iterator : public IteratorTraits {
   template <typename T, typename std::enable_if<std::is_base_of_v<CustomFieldFixedSizeInterface<T>, T>, int>::type = 0>
   T extract() {
     T extracted_value{};
+    const uint8_t* bytes = ContiguousBytes(CustomFieldFixedSizeInterface<T>::length());
+    if (bytes != nullptr) {
+      for (size_t i = 0; i < CustomFieldFixedSizeInterface<T>::length(); i++) {
+        size_t index = (little_endian ? i : CustomFieldFixedSizeInterface<T>::length() - i - 1);
+        extracted_value.data()[index] = bytes[i];
+      }
+      index_ += CustomFieldFixedSizeInterface<T>::length();
+      return extracted_value;
+    }
+
     for (size_t i = 0; i < CustomFieldFixedSizeInterface<T>::length(); i++) {
       size_t index = (little_endian ? i : CustomFieldFixedSizeInterface<T>::length() - i - 1);
       extracted_value.data()[index] = this->operator*();
@@ -104,6 +130,10 @@ class Iterator : public IteratorTraits {
   }
 
  private:
+  // Returns a pointer to the next |length| bytes if they are in bounds and
+  // held by a single fragment, nullptr otherwise.
+  const uint8_t* ContiguousBytes(size_t length) const;
+
   std::forward_list<View> data_;
   size_t index_;
   size_t begin_;
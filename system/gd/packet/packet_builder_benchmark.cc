@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "packet/bit_inserter.h"
+#include "packet/raw_builder.h"
+
+using ::benchmark::State;
+
+namespace bluetooth {
+namespace packet {
+
+namespace {
+
+RawBuilder CreateBuilder(size_t size) {
+  std::vector<uint8_t> payload(size);
+  for (size_t i = 0; i < size; i++) {
+    payload[i] = static_cast<uint8_t>(i);
+  }
+  return RawBuilder(std::move(payload));
+}
+
+}  // namespace
+
+// Growing the vector as the bytes are inserted, as done before SerializeInto
+static void BM_SerializeGrowing(State& state) {
+  auto builder = CreateBuilder(state.range(0));
+  for (auto _ : state) {
+    std::vector<uint8_t> bytes;
+    BitInserter it(bytes);
+    builder.Serialize(it);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * builder.size());
+}
+
+static void BM_SerializeInto(State& state) {
+  auto builder = CreateBuilder(state.range(0));
+  for (auto _ : state) {
+    std::vector<uint8_t> bytes;
+    builder.SerializeInto(bytes);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * builder.size());
+}
+
+// HCI command, small ACL fragment, typical LE ACL buffer and EDR ACL buffer
+BENCHMARK(BM_SerializeGrowing)->Arg(8)->Arg(27)->Arg(251)->Arg(1021);
+BENCHMARK(BM_SerializeInto)->Arg(8)->Arg(27)->Arg(251)->Arg(1021);
+
+}  // namespace packet
+}  // namespace bluetooth
@@ -96,6 +96,17 @@ TEST(PacketBuilderEndianTest, insertTest) {
   ASSERT_EQ(*big.FinalPacket(), *little.FinalPacket());
 }
 
+TEST(PacketBuilderEndianTest, serializeIntoTest) {
+  EndianBuilder<true> little(0x04, 0x0605, 0x0a090807, 0x1211100f0e0d0c0b);
+  std::vector<uint8_t> bytes{0xff};
+  little.SerializeInto(bytes);
+  ASSERT_EQ(bytes.size(), 1 + little.size());
+  ASSERT_GE(bytes.capacity(), 1 + little.size());
+  ASSERT_EQ(bytes[0], 0xff);
+  ASSERT_EQ(std::vector<uint8_t>(bytes.begin() + 1, bytes.end()), *little.FinalPacket());
+  ASSERT_EQ(little.SerializeToBytes(), *little.FinalPacket());
+}
+
 template <typename T>
 class VectorBuilder : public PacketBuilder<true> {
  public:
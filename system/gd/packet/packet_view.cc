@@ -17,6 +17,7 @@
 #include "packet/packet_view.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "os/log.h"
 
@@ -26,7 +27,7 @@ namespace packet {
 template <bool little_endian>
 PacketView<little_endian>::PacketView(const std::forward_list<class View> fragments)
     : fragments_(fragments), length_(0) {
-  for (auto fragment : fragments_) {
+  for (const auto& fragment : fragments_) {
     length_ += fragment.size();
   }
 }
@@ -68,6 +69,16 @@ size_t PacketView<little_endian>::size() const {
   return length_;
 }
 
+template <bool little_endian>
+void PacketView<little_endian>::CopyTo(uint8_t* destination) const {
+  for (const auto& fragment : fragments_) {
+    if (fragment.size() != 0) {
+      std::memcpy(destination, fragment.data(), fragment.size());
+      destination += fragment.size();
+    }
+  }
+}
+
 template <bool little_endian>
 std::forward_list<View> PacketView<little_endian>::GetSubviewList(size_t begin, size_t end) const {
   ASSERT(begin <= end);
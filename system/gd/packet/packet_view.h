@@ -48,6 +48,9 @@ class PacketView {
 
   size_t size() const;
 
+  // Copy the whole packet to |destination|, which must hold size() bytes, one fragment at a time
+  void CopyTo(uint8_t* destination) const;
+
   PacketView<true> GetLittleEndianSubview(size_t begin, size_t end) const;
   PacketView<false> GetBigEndianSubview(size_t begin, size_t end) const;
 
@@ -556,6 +556,20 @@ TEST_F(PacketViewMultiViewTest, dereferenceTestBigEndian) {
   ASSERT_DEATH(*multi_itr, "");
 }
 
+TEST_F(PacketViewMultiViewTest, extractAcrossFragmentsTest) {
+  for (size_t i = 0; i + sizeof(uint32_t) <= single_view.size(); i++) {
+    auto single_itr = single_view.begin() + i;
+    auto multi_itr = multi_view.begin() + i;
+    ASSERT_EQ(single_itr.extract<uint32_t>(), multi_itr.extract<uint32_t>());
+    ASSERT_EQ(single_itr, multi_itr);
+  }
+  for (size_t i = 0; i + Address::kLength <= single_view.size(); i++) {
+    auto single_itr = single_view.begin() + i;
+    auto multi_itr = multi_view.begin() + i;
+    ASSERT_EQ(single_itr.extract<Address>(), multi_itr.extract<Address>());
+  }
+}
+
 TEST_F(PacketViewMultiViewTest, arrayOperatorTest) {
   for (size_t i = 0; i < single_view.size(); i++) {
     ASSERT_EQ(single_view[i], multi_view[i]);
@@ -563,6 +577,12 @@ TEST_F(PacketViewMultiViewTest, arrayOperatorTest) {
   ASSERT_DEATH(multi_view[single_view.size()], "");
 }
 
+TEST_F(PacketViewMultiViewTest, copyToTest) {
+  std::vector<uint8_t> copy(multi_view.size());
+  multi_view.CopyTo(copy.data());
+  ASSERT_EQ(copy, count_all);
+}
+
 TEST_F(PacketViewMultiViewAppendTest, sizeTestAppend) {
   ASSERT_EQ(single_view.size(), multi_view.size());
 }
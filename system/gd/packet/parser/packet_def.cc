@@ -200,19 +200,29 @@ void PacketDef::GenValidator(std::ostream& s) const {
     s << "    return true;" << std::endl;
     s << "  } else {" << std::endl;
     s << "    was_validated_ = true;" << std::endl;
-    s << "    return (was_validated_ = Validate());" << std::endl;
+    s << "    if (!(was_validated_ = Validate())) {" << std::endl;
+    s << "      return false;" << std::endl;
+    s << "    }" << std::endl;
+    s << "    validated_depth_ = ValidationDepth();" << std::endl;
+    s << "    return true;" << std::endl;
     s << "  }" << std::endl;
     s << "}" << std::endl;
   }
 
   // Generate the private validator Validate().
   // The method is overridden by all child classes.
+  // A child view is created from an already validated parent view, so the
+  // ancestors are only validated again when the parent was not.
+  size_t parent_depth = GetAncestors().size();
   s << "protected:" << std::endl;
   if (parent_ == nullptr) {
+    s << "virtual size_t ValidationDepth() const { return 1; }" << std::endl;
     s << "virtual bool Validate() const {" << std::endl;
   } else {
+    s << "size_t ValidationDepth() const override { return " << parent_depth + 1 << "; }" << std::endl;
     s << "bool Validate() const override {" << std::endl;
-    s << "  if (!" << parent_->name_ << "View::Validate()) {" << std::endl;
+    s << "  if (validated_depth_ < " << parent_depth << " && !" << parent_->name_ << "View::Validate()) {"
+      << std::endl;
     s << "    return false;" << std::endl;
     s << "  }" << std::endl;
   }
@@ -343,6 +353,8 @@ void PacketDef::GenValidator(std::ostream& s) const {
   s << "}\n";
   if (parent_ == nullptr) {
     s << "bool was_validated_{false};\n";
+    // Number of levels of the view hierarchy, from the root, known to be valid.
+    s << "size_t validated_depth_{0};\n";
   }
 }
 
@@ -471,8 +483,7 @@ void PacketDef::GenBuilderDefinitionPybind11(std::ostream& s) const {
   }
   s << ".def(\"Serialize\", [](" << name_ << "Builder& builder){";
   s << "std::vector<uint8_t> bytes;";
-  s << "BitInserter bi(bytes);";
-  s << "builder.Serialize(bi);";
+  s << "builder.SerializeInto(bytes);";
   s << "return bytes;})";
   s << ";\n";
 }
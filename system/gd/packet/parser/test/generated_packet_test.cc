@@ -94,6 +94,16 @@ TEST(GeneratedPacketTest, testChildTwoTwoThree) {
   ASSERT_TRUE(grandchild_view.IsValid());
 }
 
+TEST(GeneratedPacketTest, testChildOfUnvalidatedParent) {
+  auto packet_bytes = std::make_shared<std::vector<uint8_t>>();
+  PacketView<kLittleEndian> packet_bytes_view(packet_bytes);
+  ParentTwoView parent_view = ParentTwoView::Create(packet_bytes_view);
+
+  // The parent was never validated, so the child still validates it.
+  ChildTwoTwoView child_view = ChildTwoTwoView::Create(parent_view);
+  ASSERT_FALSE(child_view.IsValid());
+}
+
 TEST(GeneratedPacketTest, testChild) {
   uint16_t field_name = 0xa2a1;
   uint8_t footer = 0xb1;
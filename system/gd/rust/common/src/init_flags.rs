@@ -243,6 +243,7 @@ init_flags!(
         irk_rotation,
         leaudio_targeted_announcement_reconnection_mode = true,
         pbap_pse_dynamic_version_upgrade = false,
+        per_adapter_files,
         private_gatt = true,
         redact_log = true,
         rust_event_loop = true,
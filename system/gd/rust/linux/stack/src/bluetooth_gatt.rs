@@ -1208,7 +1208,7 @@ impl ScanSettings {
 }
 
 /// Represents scan result
-#[derive(Debug)]
+#[derive(Debug, Clone)]
 pub struct ScanResult {
     pub name: String,
     pub address: String,
@@ -4071,24 +4071,27 @@ impl BtifGattScannerCallbacks for BluetoothGatt {
         periodic_adv_int: u16,
         adv_data: Vec<u8>,
     ) {
+        // Parse the advertisement once, rather than once per registered callback.
+        let scan_result = ScanResult {
+            name: adv_parser::extract_name(adv_data.as_slice()),
+            address: address.to_string(),
+            addr_type,
+            event_type,
+            primary_phy,
+            secondary_phy,
+            advertising_sid,
+            tx_power,
+            rssi,
+            periodic_adv_int,
+            flags: adv_parser::extract_flags(adv_data.as_slice()),
+            service_uuids: adv_parser::extract_service_uuids(adv_data.as_slice()),
+            service_data: adv_parser::extract_service_data(adv_data.as_slice()),
+            manufacturer_data: adv_parser::extract_manufacturer_data(adv_data.as_slice()),
+            adv_data,
+        };
+
         self.scanner_callbacks.for_all_callbacks(|callback| {
-            callback.on_scan_result(ScanResult {
-                name: adv_parser::extract_name(adv_data.as_slice()),
-                address: address.to_string(),
-                addr_type,
-                event_type,
-                primary_phy,
-                secondary_phy,
-                advertising_sid,
-                tx_power,
-                rssi,
-                periodic_adv_int,
-                flags: adv_parser::extract_flags(adv_data.as_slice()),
-                service_uuids: adv_parser::extract_service_uuids(adv_data.as_slice()),
-                service_data: adv_parser::extract_service_data(adv_data.as_slice()),
-                manufacturer_data: adv_parser::extract_manufacturer_data(adv_data.as_slice()),
-                adv_data: adv_data.clone(),
-            });
+            callback.on_scan_result(scan_result.clone());
         });
     }
 
@@ -4105,34 +4108,33 @@ impl BtifGattScannerCallbacks for BluetoothGatt {
             }
         };
 
-        self.scanner_callbacks.for_all_callbacks(|callback| {
-            let adv_data =
-                [&track_adv_info.adv_packet[..], &track_adv_info.scan_response[..]].concat();
-
-            let scan_result = ScanResult {
-                name: adv_parser::extract_name(adv_data.as_slice()),
-                address: track_adv_info.advertiser_address.to_string(),
-                addr_type: track_adv_info.advertiser_address_type,
-                event_type: 0, /* not used */
-                primary_phy: LePhy::Phy1m as u8,
-                secondary_phy: 0,      /* not used */
-                advertising_sid: 0xff, /* not present */
-                /* A bug in libbluetooth that uses u8 for TX power.
-                 * TODO(b/261482382): Fix the data type in C++ layer to use i8 instead of u8. */
-                tx_power: track_adv_info.tx_power as i8,
-                rssi: track_adv_info.rssi,
-                periodic_adv_int: 0, /* not used */
-                flags: adv_parser::extract_flags(adv_data.as_slice()),
-                service_uuids: adv_parser::extract_service_uuids(adv_data.as_slice()),
-                service_data: adv_parser::extract_service_data(adv_data.as_slice()),
-                manufacturer_data: adv_parser::extract_manufacturer_data(adv_data.as_slice()),
-                adv_data,
-            };
+        let adv_data = [&track_adv_info.adv_packet[..], &track_adv_info.scan_response[..]].concat();
+
+        let scan_result = ScanResult {
+            name: adv_parser::extract_name(adv_data.as_slice()),
+            address: track_adv_info.advertiser_address.to_string(),
+            addr_type: track_adv_info.advertiser_address_type,
+            event_type: 0, /* not used */
+            primary_phy: LePhy::Phy1m as u8,
+            secondary_phy: 0,      /* not used */
+            advertising_sid: 0xff, /* not present */
+            /* A bug in libbluetooth that uses u8 for TX power.
+             * TODO(b/261482382): Fix the data type in C++ layer to use i8 instead of u8. */
+            tx_power: track_adv_info.tx_power as i8,
+            rssi: track_adv_info.rssi,
+            periodic_adv_int: 0, /* not used */
+            flags: adv_parser::extract_flags(adv_data.as_slice()),
+            service_uuids: adv_parser::extract_service_uuids(adv_data.as_slice()),
+            service_data: adv_parser::extract_service_data(adv_data.as_slice()),
+            manufacturer_data: adv_parser::extract_manufacturer_data(adv_data.as_slice()),
+            adv_data,
+        };
 
+        self.scanner_callbacks.for_all_callbacks(|callback| {
             if track_adv_info.advertiser_state == 0x01 {
-                callback.on_advertisement_found(scanner_id, scan_result);
+                callback.on_advertisement_found(scanner_id, scan_result.clone());
             } else {
-                callback.on_advertisement_lost(scanner_id, scan_result);
+                callback.on_advertisement_lost(scanner_id, scan_result.clone());
             }
         });
     }
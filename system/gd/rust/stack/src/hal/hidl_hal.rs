@@ -83,34 +83,31 @@ fn on_init_complete() {
 }
 
 fn on_event(data: &[u8]) {
-    log::error!("got event: {:02x?}", data);
-    let callbacks = CALLBACKS.lock().unwrap();
+    // Parse before taking the lock, so the parse does not serialize with the
+    // other packet types coming up from the HAL
     match Event::parse(data) {
-        Ok(p) => callbacks.as_ref().unwrap().evt_tx.send(p).unwrap(),
+        Ok(p) => CALLBACKS.lock().unwrap().as_ref().unwrap().evt_tx.send(p).unwrap(),
         Err(e) => log::error!("failure to parse event: {:?} data: {:02x?}", e, data),
     }
 }
 
 fn on_acl(data: &[u8]) {
-    let callbacks = CALLBACKS.lock().unwrap();
     match Acl::parse(data) {
-        Ok(p) => callbacks.as_ref().unwrap().acl_tx.send(p).unwrap(),
+        Ok(p) => CALLBACKS.lock().unwrap().as_ref().unwrap().acl_tx.send(p).unwrap(),
         Err(e) => log::error!("failure to parse incoming ACL: {:?} data: {:02x?}", e, data),
     }
 }
 
 fn on_sco(data: &[u8]) {
-    let callbacks = CALLBACKS.lock().unwrap();
     match Sco::parse(data) {
-        Ok(p) => callbacks.as_ref().unwrap().sco_tx.send(p).unwrap(),
+        Ok(p) => CALLBACKS.lock().unwrap().as_ref().unwrap().sco_tx.send(p).unwrap(),
         Err(e) => log::error!("failure to parse incoming SCO: {:?} data: {:02x?}", e, data),
     }
 }
 
 fn on_iso(data: &[u8]) {
-    let callbacks = CALLBACKS.lock().unwrap();
     match Iso::parse(data) {
-        Ok(p) => callbacks.as_ref().unwrap().iso_tx.send(p).unwrap(),
+        Ok(p) => CALLBACKS.lock().unwrap().as_ref().unwrap().iso_tx.send(p).unwrap(),
         Err(e) => log::error!("failure to parse incoming ISO: {:?} data: {:02x?}", e, data),
     }
 }
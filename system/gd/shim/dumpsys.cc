@@ -21,6 +21,8 @@
 #include <unistd.h>
 
 #include <future>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -46,6 +48,8 @@ constexpr char kDumpsysTitle[] = "----- Gd Dumpsys ------";
 struct Dumpsys::impl {
  public:
   void DumpWithArgsSync(int fd, const char** args, std::promise<void> promise);
+  void CollectState(int fd, std::promise<std::string> promise);
+  void WriteFilteredState(int fd, std::string dumpsys_data);
   int GetNumberOfBundledSchemas() const;
 
   impl(const Dumpsys& dumpsys_module, const dumpsys::ReflectionSchema& reflection_schema);
@@ -60,9 +64,14 @@ struct Dumpsys::impl {
 
  private:
   void DumpWithArgsAsync(int fd, const char** args);
+  std::string GetState(int fd);
 
   const Dumpsys& dumpsys_module_;
   const dumpsys::ReflectionSchema reflection_schema_;
+
+  // The schema does not change between dumps, it is deserialized once
+  mutable std::mutex json_parser_mutex_;
+  mutable std::unique_ptr<flatbuffers::Parser> json_parser_;
 };
 
 const ModuleFactory Dumpsys::Factory =
@@ -100,23 +109,28 @@ std::string Dumpsys::impl::PrintAsJson(std::string* dumpsys_data) const {
     return std::string(buf);
   }
 
-  const reflection::Schema* schema = reflection_schema_.FindInReflectionSchema(root_name);
-  if (schema == nullptr) {
-    char buf[255];
-    snprintf(buf, sizeof(buf), "ERROR: Unable to find schema root name:%s\n", root_name.c_str());
-    LOG_WARN("%s", buf);
-    return std::string(buf);
-  }
-
-  flatbuffers::IDLOptions options{};
-  options.output_default_scalars_in_json = true;
-  flatbuffers::Parser parser{options};
-  if (!parser.Deserialize(schema)) {
-    char buf[255];
-    snprintf(buf, sizeof(buf), "ERROR: Unable to deserialize bundle root name:%s\n", root_name.c_str());
-    LOG_WARN("%s", buf);
-    return std::string(buf);
+  std::lock_guard<std::mutex> lock(json_parser_mutex_);
+  if (json_parser_ == nullptr) {
+    const reflection::Schema* schema = reflection_schema_.FindInReflectionSchema(root_name);
+    if (schema == nullptr) {
+      char buf[255];
+      snprintf(buf, sizeof(buf), "ERROR: Unable to find schema root name:%s\n", root_name.c_str());
+      LOG_WARN("%s", buf);
+      return std::string(buf);
+    }
+
+    flatbuffers::IDLOptions options{};
+    options.output_default_scalars_in_json = true;
+    auto parser = std::make_unique<flatbuffers::Parser>(options);
+    if (!parser->Deserialize(schema)) {
+      char buf[255];
+      snprintf(buf, sizeof(buf), "ERROR: Unable to deserialize bundle root name:%s\n", root_name.c_str());
+      LOG_WARN("%s", buf);
+      return std::string(buf);
+    }
+    json_parser_ = std::move(parser);
   }
+  const flatbuffers::Parser& parser = *json_parser_;
 
   std::string jsongen;
   // GenerateText was renamed to GenText in 23.5.26 because the return behavior was changed.
@@ -135,8 +149,7 @@ std::string Dumpsys::impl::PrintAsJson(std::string* dumpsys_data) const {
   return jsongen;
 }
 
-void Dumpsys::impl::DumpWithArgsAsync(int fd, const char** args) {
-  ParsedDumpsysArgs parsed_dumpsys_args(args);
+std::string Dumpsys::impl::GetState(int fd) {
   const auto registry = dumpsys_module_.GetModuleRegistry();
 
   int dumper_fd = STDOUT_FILENO;
@@ -147,13 +160,25 @@ void Dumpsys::impl::DumpWithArgsAsync(int fd, const char** args) {
   std::string dumpsys_data;
   std::ostringstream oss;
   dumper.DumpState(&dumpsys_data, oss);
+  return dumpsys_data;
+}
 
+void Dumpsys::impl::CollectState(int fd, std::promise<std::string> promise) {
+  promise.set_value(GetState(fd));
+}
+
+void Dumpsys::impl::WriteFilteredState(int fd, std::string dumpsys_data) {
   dprintf(fd, " ----- Filtering as Developer -----\n");
   FilterAsDeveloper(&dumpsys_data);
 
   dprintf(fd, "%s", PrintAsJson(&dumpsys_data).c_str());
 }
 
+void Dumpsys::impl::DumpWithArgsAsync(int fd, const char** args) {
+  ParsedDumpsysArgs parsed_dumpsys_args(args);
+  WriteFilteredState(fd, GetState(fd));
+}
+
 void Dumpsys::impl::DumpWithArgsSync(int fd, const char** args, std::promise<void> promise) {
   DumpWithArgsAsync(fd, args);
   promise.set_value();
@@ -166,10 +191,12 @@ void Dumpsys::Dump(int fd, const char** args) {
   if (fd <= 0) {
     return;
   }
-  std::promise<void> promise;
+  // Only collecting the module states needs the module handler, filtering and printing them to json runs on the
+  // calling thread so that the stack is not held for the whole dump
+  std::promise<std::string> promise;
   auto future = promise.get_future();
-  CallOn(pimpl_.get(), &Dumpsys::impl::DumpWithArgsSync, fd, args, std::move(promise));
-  future.get();
+  CallOn(pimpl_.get(), &Dumpsys::impl::CollectState, fd, std::move(promise));
+  pimpl_->WriteFilteredState(fd, future.get());
 }
 
 void Dumpsys::Dump(int fd, const char** args, std::promise<void> promise) {
@@ -16,11 +16,14 @@
 
 #include "storage/config_cache.h"
 
+#include <algorithm>
+#include <chrono>
 #include <ios>
 #include <sstream>
 #include <utility>
 
 #include "hci/enum_helper.h"
+#include "metrics/counter_registry.h"
 #include "os/parameter_provider.h"
 #include "storage/mutation.h"
 
@@ -56,6 +59,82 @@ const std::unordered_set<std::string_view> kClassicPropertyNames = {
 
 const std::string ConfigCache::kDefaultSectionName = "Global";
 
+namespace {
+
+std::chrono::microseconds ToMicroseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration);
+}
+
+bool HasSameValue(
+    const common::ListMap<std::string, std::string>& properties, const std::string& property, const std::string& value) {
+  auto property_iter = properties.find(property);
+  return property_iter != properties.end() && property_iter->second == value;
+}
+
+}  // namespace
+
+// Observers only measure the time they wait when the lock is not available right away, so that uncontended lookups
+// stay cheap
+class ConfigCache::SharedLock {
+ public:
+  explicit SharedLock(const ConfigCache& cache) : cache_(cache) {
+    if (cache_.mutex_.try_lock_shared()) {
+      return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    cache_.mutex_.lock_shared();
+    auto wait_time = ToMicroseconds(std::chrono::steady_clock::now() - start);
+    std::lock_guard<std::mutex> lock(cache_.lock_stats_mutex_);
+    cache_.lock_stats_.contended_shared_locks++;
+    cache_.lock_stats_.total_shared_wait_time += wait_time;
+    cache_.lock_stats_.max_shared_wait_time = std::max(cache_.lock_stats_.max_shared_wait_time, wait_time);
+  }
+  SharedLock(const SharedLock&) = delete;
+  SharedLock& operator=(const SharedLock&) = delete;
+  ~SharedLock() {
+    cache_.mutex_.unlock_shared();
+  }
+
+ private:
+  const ConfigCache& cache_;
+};
+
+// Modifiers are rare, they always measure how long they hold the lock
+class ConfigCache::ExclusiveLock {
+ public:
+  explicit ExclusiveLock(ConfigCache& cache) : cache_(cache) {
+    if (!cache_.mutex_.try_lock()) {
+      contended_ = true;
+      auto start = std::chrono::steady_clock::now();
+      cache_.mutex_.lock();
+      wait_time_ = ToMicroseconds(std::chrono::steady_clock::now() - start);
+    }
+    acquired_ = std::chrono::steady_clock::now();
+  }
+  ExclusiveLock(const ExclusiveLock&) = delete;
+  ExclusiveLock& operator=(const ExclusiveLock&) = delete;
+  ~ExclusiveLock() {
+    auto hold_time = ToMicroseconds(std::chrono::steady_clock::now() - acquired_);
+    cache_.mutex_.unlock();
+    std::lock_guard<std::mutex> lock(cache_.lock_stats_mutex_);
+    LockStats& stats = cache_.lock_stats_;
+    stats.exclusive_locks++;
+    stats.total_exclusive_hold_time += hold_time;
+    stats.max_exclusive_hold_time = std::max(stats.max_exclusive_hold_time, hold_time);
+    if (contended_) {
+      stats.contended_exclusive_locks++;
+      stats.total_exclusive_wait_time += wait_time_;
+      stats.max_exclusive_wait_time = std::max(stats.max_exclusive_wait_time, wait_time_);
+    }
+  }
+
+ private:
+  ConfigCache& cache_;
+  bool contended_ = false;
+  std::chrono::microseconds wait_time_{0};
+  std::chrono::steady_clock::time_point acquired_;
+};
+
 std::string kEncryptedStr = "encrypted";
 
 ConfigCache::ConfigCache(size_t temp_device_capacity, std::unordered_set<std::string_view> persistent_property_names)
@@ -65,16 +144,28 @@ ConfigCache::ConfigCache(size_t temp_device_capacity, std::unordered_set<std::st
       temporary_devices_(temp_device_capacity) {}
 
 void ConfigCache::SetPersistentConfigChangedCallback(std::function<void()> persistent_config_changed_callback) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
   persistent_config_changed_callback_ = std::move(persistent_config_changed_callback);
 }
 
+std::vector<std::string> ConfigCache::TakeChangedPersistentSections(bool* cleared) {
+  ExclusiveLock lock(*this);
+  *cleared = persistent_sections_cleared_;
+  persistent_sections_cleared_ = false;
+  std::vector<std::string> sections(changed_persistent_sections_.begin(), changed_persistent_sections_.end());
+  changed_persistent_sections_.clear();
+  return sections;
+}
+
 ConfigCache::ConfigCache(ConfigCache&& other) noexcept
     : persistent_config_changed_callback_(nullptr),
       persistent_property_names_(std::move(other.persistent_property_names_)),
       information_sections_(std::move(other.information_sections_)),
       persistent_devices_(std::move(other.persistent_devices_)),
-      temporary_devices_(std::move(other.temporary_devices_)) {
+      temporary_devices_(std::move(other.temporary_devices_)),
+      changed_persistent_sections_(std::move(other.changed_persistent_sections_)),
+      persistent_sections_cleared_(other.persistent_sections_cleared_),
+      sections_with_property_(std::move(other.sections_with_property_)) {
   ASSERT_LOG(
       other.persistent_config_changed_callback_ == nullptr,
       "Can't assign after setting the callback");
@@ -84,8 +175,8 @@ ConfigCache& ConfigCache::operator=(ConfigCache&& other) noexcept {
   if (&other == this) {
     return *this;
   }
-  std::lock_guard<std::recursive_mutex> my_lock(mutex_);
-  std::lock_guard<std::recursive_mutex> others_lock(other.mutex_);
+  ExclusiveLock my_lock(*this);
+  ExclusiveLock others_lock(other);
   ASSERT_LOG(
       other.persistent_config_changed_callback_ == nullptr,
       "Can't assign after setting the callback");
@@ -94,12 +185,19 @@ ConfigCache& ConfigCache::operator=(ConfigCache&& other) noexcept {
   information_sections_ = std::move(other.information_sections_);
   persistent_devices_ = std::move(other.persistent_devices_);
   temporary_devices_ = std::move(other.temporary_devices_);
+  changed_persistent_sections_ = std::move(other.changed_persistent_sections_);
+  persistent_sections_cleared_ = other.persistent_sections_cleared_;
+  sections_with_property_ = std::move(other.sections_with_property_);
   return *this;
 }
 
 bool ConfigCache::operator==(const ConfigCache& rhs) const {
-  std::lock_guard<std::recursive_mutex> my_lock(mutex_);
-  std::lock_guard<std::recursive_mutex> others_lock(rhs.mutex_);
+  if (&rhs == this) {
+    return true;
+  }
+  SharedLock my_lock(*this);
+  SharedLock others_lock(rhs);
+  std::scoped_lock lru_lock(temporary_devices_mutex_, rhs.temporary_devices_mutex_);
   return persistent_property_names_ == rhs.persistent_property_names_ &&
          information_sections_ == rhs.information_sections_ && persistent_devices_ == rhs.persistent_devices_ &&
          temporary_devices_ == rhs.temporary_devices_;
@@ -110,7 +208,12 @@ bool ConfigCache::operator!=(const ConfigCache& rhs) const {
 }
 
 void ConfigCache::Clear() {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
+  if (information_sections_.size() > 0 || persistent_devices_.size() > 0) {
+    // Nothing that changed before is left to write
+    changed_persistent_sections_.clear();
+    persistent_sections_cleared_ = true;
+  }
   if (information_sections_.size() > 0) {
     information_sections_.clear();
     PersistentConfigChangedCallback();
@@ -122,16 +225,20 @@ void ConfigCache::Clear() {
   if (temporary_devices_.size() > 0) {
     temporary_devices_.clear();
   }
+  sections_with_property_.clear();
 }
 
 bool ConfigCache::HasSection(const std::string& section) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
-  return information_sections_.contains(section) || persistent_devices_.contains(section) ||
-         temporary_devices_.contains(section);
+  SharedLock lock(*this);
+  if (information_sections_.contains(section) || persistent_devices_.contains(section)) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lru_lock(temporary_devices_mutex_);
+  return temporary_devices_.contains(section);
 }
 
 bool ConfigCache::HasProperty(const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  SharedLock lock(*this);
   auto section_iter = information_sections_.find(section);
   if (section_iter != information_sections_.end()) {
     return section_iter->second.find(property) != section_iter->second.end();
@@ -140,6 +247,7 @@ bool ConfigCache::HasProperty(const std::string& section, const std::string& pro
   if (section_iter != persistent_devices_.end()) {
     return section_iter->second.find(property) != section_iter->second.end();
   }
+  std::lock_guard<std::mutex> lru_lock(temporary_devices_mutex_);
   section_iter = temporary_devices_.find(section);
   if (section_iter != temporary_devices_.end()) {
     return section_iter->second.find(property) != section_iter->second.end();
@@ -148,7 +256,7 @@ bool ConfigCache::HasProperty(const std::string& section, const std::string& pro
 }
 
 std::optional<std::string> ConfigCache::GetProperty(const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  SharedLock lock(*this);
   auto section_iter = information_sections_.find(section);
   if (section_iter != information_sections_.end()) {
     auto property_iter = section_iter->second.find(property);
@@ -167,6 +275,7 @@ std::optional<std::string> ConfigCache::GetProperty(const std::string& section,
       return value;
     }
   }
+  std::lock_guard<std::mutex> lru_lock(temporary_devices_mutex_);
   section_iter = temporary_devices_.find(section);
   if (section_iter != temporary_devices_.end()) {
     auto property_iter = section_iter->second.find(property);
@@ -178,7 +287,11 @@ std::optional<std::string> ConfigCache::GetProperty(const std::string& section,
 }
 
 void ConfigCache::SetProperty(std::string section, std::string property, std::string value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
+  SetPropertyLocked(std::move(section), std::move(property), std::move(value));
+}
+
+void ConfigCache::SetPropertyLocked(std::string section, std::string property, std::string value) {
   TrimAfterNewLine(section);
   TrimAfterNewLine(property);
   TrimAfterNewLine(value);
@@ -189,12 +302,18 @@ void ConfigCache::SetProperty(std::string section, std::string property, std::st
     if (section_iter == information_sections_.end()) {
       section_iter = information_sections_.try_emplace_back(section, common::ListMap<std::string, std::string>{}).first;
     }
+    if (HasSameValue(section_iter->second, property, value)) {
+      return;
+    }
+    IndexProperty(section, property);
     section_iter->second.insert_or_assign(property, std::move(value));
-    PersistentConfigChangedCallback();
+    PersistentSectionChanged(section);
     return;
   }
   auto section_iter = persistent_devices_.find(section);
+  bool became_persistent = false;
   if (section_iter == persistent_devices_.end() && IsPersistentProperty(property)) {
+    became_persistent = true;
     // move paired devices or create new paired device when a link key is set
     auto section_properties = temporary_devices_.extract(section);
     if (section_properties) {
@@ -212,31 +331,58 @@ void ConfigCache::SetProperty(std::string section, std::string property, std::st
         value = kEncryptedStr;
       }
     }
+    // Rewriting a device blob with the content it already has, as profiles do on every reconnection, must not
+    // schedule a config save
+    if (!became_persistent && HasSameValue(section_iter->second, property, value)) {
+      return;
+    }
+    IndexProperty(section, property);
     section_iter->second.insert_or_assign(property, std::move(value));
-    PersistentConfigChangedCallback();
+    PersistentSectionChanged(section);
     return;
   }
   section_iter = temporary_devices_.find(section);
   if (section_iter == temporary_devices_.end()) {
     auto triple = temporary_devices_.try_emplace(section, common::ListMap<std::string, std::string>{});
     section_iter = std::get<0>(triple);
+    auto& evicted = std::get<2>(triple);
+    if (evicted) {
+      UnindexSection(evicted->first, evicted->second);
+    }
   }
+  IndexProperty(section, property);
   section_iter->second.insert_or_assign(property, std::move(value));
 }
 
 bool ConfigCache::RemoveSection(const std::string& section) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
+  return RemoveSectionLocked(section);
+}
+
+bool ConfigCache::RemoveSectionLocked(const std::string& section) {
   // sections are unique among all three maps, hence removing from one of them is enough
-  if (information_sections_.extract(section) || persistent_devices_.extract(section)) {
-    PersistentConfigChangedCallback();
+  for (auto* config_section : {&information_sections_, &persistent_devices_}) {
+    auto section_properties = config_section->extract(section);
+    if (section_properties) {
+      UnindexSection(section, section_properties->second);
+      PersistentSectionChanged(section);
+      return true;
+    }
+  }
+  auto section_properties = temporary_devices_.extract(section);
+  if (section_properties) {
+    UnindexSection(section, section_properties->second);
     return true;
-  } else {
-    return temporary_devices_.extract(section).has_value();
   }
+  return false;
 }
 
 bool ConfigCache::RemoveProperty(const std::string& section, const std::string& property) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
+  return RemovePropertyLocked(section, property);
+}
+
+bool ConfigCache::RemovePropertyLocked(const std::string& section, const std::string& property) {
   auto section_iter = information_sections_.find(section);
   if (section_iter != information_sections_.end()) {
     auto value = section_iter->second.extract(property);
@@ -245,7 +391,8 @@ bool ConfigCache::RemoveProperty(const std::string& section, const std::string&
       information_sections_.erase(section_iter);
     }
     if (value.has_value()) {
-      PersistentConfigChangedCallback();
+      UnindexProperty(section, property);
+      PersistentSectionChanged(section);
       return true;
     } else {
       return false;
@@ -260,10 +407,14 @@ bool ConfigCache::RemoveProperty(const std::string& section, const std::string&
     } else if (value && IsPersistentProperty(property)) {
       // move unpaired device
       auto section_properties = persistent_devices_.extract(section);
-      temporary_devices_.insert_or_assign(section, std::move(section_properties->second));
+      auto evicted = temporary_devices_.insert_or_assign(section, std::move(section_properties->second));
+      if (evicted) {
+        UnindexSection(evicted->first, evicted->second);
+      }
     }
     if (value.has_value()) {
-      PersistentConfigChangedCallback();
+      UnindexProperty(section, property);
+      PersistentSectionChanged(section);
       if (os::ParameterProvider::GetBtKeystoreInterface() != nullptr && os::ParameterProvider::IsCommonCriteriaMode() &&
           InEncryptKeyNameList(property)) {
         os::ParameterProvider::GetBtKeystoreInterface()->set_encrypt_key_or_remove_key(section + "-" + property, "");
@@ -279,38 +430,76 @@ bool ConfigCache::RemoveProperty(const std::string& section, const std::string&
     if (section_iter->second.size() == 0) {
       temporary_devices_.erase(section_iter);
     }
-    return value.has_value();
+    if (value.has_value()) {
+      UnindexProperty(section, property);
+      return true;
+    }
+    return false;
   }
   return false;
 }
 
 void ConfigCache::ConvertEncryptOrDecryptKeyIfNeeded() {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
   LOG_INFO("%s", __func__);
-  auto persistent_sections = GetPersistentSections();
-  for (const auto& section : persistent_sections) {
-    auto section_iter = persistent_devices_.find(section);
+  auto* keystore = os::ParameterProvider::GetBtKeystoreInterface();
+  if (keystore == nullptr) {
+    return;
+  }
+  auto start = std::chrono::steady_clock::now();
+  bool common_criteria_mode = os::ParameterProvider::IsCommonCriteriaMode();
+
+  // Collect every key to convert first, so that the keystore is called once per direction instead of once per key.
+  // Keys that are already encrypted in common criteria mode are left alone, they are decrypted on first use by
+  // GetProperty().
+  std::vector<std::pair<std::string, std::string>> encrypt_keys;
+  std::vector<std::pair<std::string, std::string>> encrypt_properties;
+  std::vector<std::string> decrypt_prefixes;
+  std::vector<std::pair<std::string, std::string>> decrypt_properties;
+  for (const auto& [section, properties] : persistent_devices_) {
     for (const auto& property : kEncryptKeyNameList) {
-      auto property_iter = section_iter->second.find(std::string(property));
-      if (property_iter != section_iter->second.end()) {
-        bool is_encrypted = property_iter->second == kEncryptedStr;
-        if ((!property_iter->second.empty()) && os::ParameterProvider::GetBtKeystoreInterface() != nullptr &&
-            os::ParameterProvider::IsCommonCriteriaMode() && !is_encrypted) {
-          if (os::ParameterProvider::GetBtKeystoreInterface()->set_encrypt_key_or_remove_key(
-                  section + "-" + std::string(property), property_iter->second)) {
-            SetProperty(section, std::string(property), kEncryptedStr);
-          }
-        }
-        if (os::ParameterProvider::GetBtKeystoreInterface() != nullptr && is_encrypted) {
-          std::string value_str =
-              os::ParameterProvider::GetBtKeystoreInterface()->get_key(section + "-" + std::string(property));
-          if (!os::ParameterProvider::IsCommonCriteriaMode()) {
-            SetProperty(section, std::string(property), value_str);
-          }
-        }
+      auto property_iter = properties.find(std::string(property));
+      if (property_iter == properties.end()) {
+        continue;
       }
+      bool is_encrypted = property_iter->second == kEncryptedStr;
+      std::string prefix = section + "-" + std::string(property);
+      if (!property_iter->second.empty() && common_criteria_mode && !is_encrypted) {
+        encrypt_keys.emplace_back(prefix, property_iter->second);
+        encrypt_properties.emplace_back(section, std::string(property));
+      } else if (is_encrypted && !common_criteria_mode) {
+        decrypt_prefixes.emplace_back(prefix);
+        decrypt_properties.emplace_back(section, std::string(property));
+      }
+    }
+  }
+
+  if (!encrypt_keys.empty() && keystore->set_encrypt_keys_or_remove_keys(std::move(encrypt_keys))) {
+    for (const auto& [section, property] : encrypt_properties) {
+      SetPropertyLocked(section, property, kEncryptedStr);
+    }
+  }
+  if (!decrypt_prefixes.empty()) {
+    auto values = keystore->get_keys(std::move(decrypt_prefixes));
+    for (size_t i = 0; i < decrypt_properties.size() && i < values.size(); i++) {
+      SetPropertyLocked(decrypt_properties[i].first, decrypt_properties[i].second, std::move(values[i]));
     }
   }
+
+  auto elapsed_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  static auto* conversion_ms = metrics::CounterRegistry::Get().GetHistogram("storage.keystore.conversion_ms");
+  static auto* encrypted_keys = metrics::CounterRegistry::Get().GetCounter("storage.keystore.encrypted_keys");
+  static auto* decrypted_keys = metrics::CounterRegistry::Get().GetCounter("storage.keystore.decrypted_keys");
+  conversion_ms->Record(elapsed_ms);
+  encrypted_keys->Increment(encrypt_properties.size());
+  decrypted_keys->Increment(decrypt_properties.size());
+  LOG_INFO(
+      "%s: encrypted %zu keys, decrypted %zu keys in %lld ms",
+      __func__,
+      encrypt_properties.size(),
+      decrypt_properties.size(),
+      static_cast<long long>(elapsed_ms));
 }
 
 bool ConfigCache::IsDeviceSection(const std::string& section) {
@@ -322,26 +511,29 @@ bool ConfigCache::IsPersistentProperty(const std::string& property) const {
 }
 
 void ConfigCache::RemoveSectionWithProperty(const std::string& property) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
-  size_t num_persistent_removed = 0;
-  for (auto* config_section : {&information_sections_, &persistent_devices_}) {
-    for (auto it = config_section->begin(); it != config_section->end();) {
-      if (it->second.contains(property)) {
-        LOG_INFO("Removing persistent section %s with property %s", it->first.c_str(), property.c_str());
-        it = config_section->erase(it);
-        num_persistent_removed++;
-        continue;
-      }
-      it++;
-    }
+  ExclusiveLock lock(*this);
+  auto sections_iter = sections_with_property_.find(property);
+  if (sections_iter == sections_with_property_.end()) {
+    return;
   }
-  for (auto it = temporary_devices_.begin(); it != temporary_devices_.end();) {
-    if (it->second.contains(property)) {
-      LOG_INFO("Removing temporary section %s with property %s", it->first.c_str(), property.c_str());
-      it = temporary_devices_.erase(it);
-      continue;
+  // Removed sections are unindexed, hence iterate over a copy
+  auto sections = sections_iter->second;
+  size_t num_persistent_removed = 0;
+  for (const auto& section : sections) {
+    if (auto section_properties = information_sections_.extract(section)) {
+      LOG_INFO("Removing persistent section %s with property %s", section.c_str(), property.c_str());
+      UnindexSection(section, section_properties->second);
+      changed_persistent_sections_.insert(section);
+      num_persistent_removed++;
+    } else if (auto section_properties = persistent_devices_.extract(section)) {
+      LOG_INFO("Removing persistent section %s with property %s", section.c_str(), property.c_str());
+      UnindexSection(section, section_properties->second);
+      changed_persistent_sections_.insert(section);
+      num_persistent_removed++;
+    } else if (auto section_properties = temporary_devices_.extract(section)) {
+      LOG_INFO("Removing temporary section %s with property %s", section.c_str(), property.c_str());
+      UnindexSection(section, section_properties->second);
     }
-    it++;
   }
   if (num_persistent_removed > 0) {
     PersistentConfigChangedCallback();
@@ -349,7 +541,7 @@ void ConfigCache::RemoveSectionWithProperty(const std::string& property) {
 }
 
 std::vector<std::string> ConfigCache::GetPersistentSections() const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  SharedLock lock(*this);
   std::vector<std::string> paired_devices;
   paired_devices.reserve(persistent_devices_.size());
   for (const auto& elem : persistent_devices_) {
@@ -359,19 +551,19 @@ std::vector<std::string> ConfigCache::GetPersistentSections() const {
 }
 
 void ConfigCache::Commit(std::queue<MutationEntry>& mutation_entries) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
   while (!mutation_entries.empty()) {
     auto entry = std::move(mutation_entries.front());
     mutation_entries.pop();
     switch (entry.entry_type) {
       case MutationEntry::EntryType::SET:
-        SetProperty(std::move(entry.section), std::move(entry.property), std::move(entry.value));
+        SetPropertyLocked(std::move(entry.section), std::move(entry.property), std::move(entry.value));
         break;
       case MutationEntry::EntryType::REMOVE_PROPERTY:
-        RemoveProperty(entry.section, entry.property);
+        RemovePropertyLocked(entry.section, entry.property);
         break;
       case MutationEntry::EntryType::REMOVE_SECTION:
-        RemoveSection(entry.section);
+        RemoveSectionLocked(entry.section);
         break;
         // do not write a default case so that when a new enum is defined, compilation would fail automatically
     }
@@ -379,7 +571,7 @@ void ConfigCache::Commit(std::queue<MutationEntry>& mutation_entries) {
 }
 
 std::string ConfigCache::SerializeToLegacyFormat() const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  SharedLock lock(*this);
   std::stringstream serialized;
   for (const auto* config_section : {&information_sections_, &persistent_devices_}) {
     for (const auto& section : *config_section) {
@@ -393,29 +585,87 @@ std::string ConfigCache::SerializeToLegacyFormat() const {
   return serialized.str();
 }
 
+std::optional<std::vector<std::pair<std::string, std::string>>> ConfigCache::GetPersistentSectionContent(
+    const std::string& section) const {
+  SharedLock lock(*this);
+  for (const auto* config_section : {&information_sections_, &persistent_devices_}) {
+    auto section_iter = config_section->find(section);
+    if (section_iter != config_section->end()) {
+      return std::vector<std::pair<std::string, std::string>>(
+          section_iter->second.begin(), section_iter->second.end());
+    }
+  }
+  return std::nullopt;
+}
+
 std::vector<ConfigCache::SectionAndPropertyValue> ConfigCache::GetSectionNamesWithProperty(
     const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  SharedLock lock(*this);
   std::vector<SectionAndPropertyValue> result;
-  for (auto* config_section : {&information_sections_, &persistent_devices_}) {
-    for (const auto& elem : *config_section) {
-      auto it = elem.second.find(property);
-      if (it != elem.second.end()) {
-        result.emplace_back(SectionAndPropertyValue{.section = elem.first, .property = it->second});
-        continue;
+  auto sections_iter = sections_with_property_.find(property);
+  if (sections_iter == sections_with_property_.end()) {
+    return result;
+  }
+  std::vector<std::string> sections(sections_iter->second.begin(), sections_iter->second.end());
+  std::sort(sections.begin(), sections.end());
+  for (const auto* config_section : {&information_sections_, &persistent_devices_}) {
+    for (const auto& section : sections) {
+      auto section_iter = config_section->find(section);
+      if (section_iter != config_section->end()) {
+        result.emplace_back(
+            SectionAndPropertyValue{.section = section, .property = section_iter->second.find(property)->second});
       }
     }
   }
-  for (const auto& elem : temporary_devices_) {
-    auto it = elem.second.find(property);
-    if (it != elem.second.end()) {
-      result.emplace_back(SectionAndPropertyValue{.section = elem.first, .property = it->second});
-      continue;
+  std::lock_guard<std::mutex> lru_lock(temporary_devices_mutex_);
+  for (const auto& section : sections) {
+    auto section_iter = temporary_devices_.find(section);
+    if (section_iter != temporary_devices_.end()) {
+      result.emplace_back(
+          SectionAndPropertyValue{.section = section, .property = section_iter->second.find(property)->second});
     }
   }
   return result;
 }
 
+std::vector<std::string> ConfigCache::GetPersistentSectionsWithProperty(const std::string& property) const {
+  SharedLock lock(*this);
+  std::vector<std::string> result;
+  auto sections_iter = sections_with_property_.find(property);
+  if (sections_iter == sections_with_property_.end()) {
+    return result;
+  }
+  for (const auto& section : sections_iter->second) {
+    if (persistent_devices_.contains(section)) {
+      result.push_back(section);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+void ConfigCache::IndexProperty(const std::string& section, const std::string& property) {
+  sections_with_property_[property].insert(section);
+}
+
+void ConfigCache::UnindexProperty(const std::string& section, const std::string& property) {
+  auto sections_iter = sections_with_property_.find(property);
+  if (sections_iter == sections_with_property_.end()) {
+    return;
+  }
+  sections_iter->second.erase(section);
+  if (sections_iter->second.empty()) {
+    sections_with_property_.erase(sections_iter);
+  }
+}
+
+void ConfigCache::UnindexSection(
+    const std::string& section, const common::ListMap<std::string, std::string>& properties) {
+  for (const auto& property : properties) {
+    UnindexProperty(section, property.first);
+  }
+}
+
 namespace {
 
 bool FixDeviceTypeInconsistencyInSection(
@@ -468,11 +718,13 @@ bool FixDeviceTypeInconsistencyInSection(
 }  // namespace
 
 bool ConfigCache::FixDeviceTypeInconsistencies() {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ExclusiveLock lock(*this);
   bool persistent_device_changed = false;
   for (auto* config_section : {&information_sections_, &persistent_devices_}) {
     for (auto& elem : *config_section) {
       if (FixDeviceTypeInconsistencyInSection(elem.first, elem.second)) {
+        IndexProperty(elem.first, "DevType");
+        changed_persistent_sections_.insert(elem.first);
         persistent_device_changed = true;
       }
     }
@@ -480,6 +732,7 @@ bool ConfigCache::FixDeviceTypeInconsistencies() {
   bool temp_device_changed = false;
   for (auto& elem : temporary_devices_) {
     if (FixDeviceTypeInconsistencyInSection(elem.first, elem.second)) {
+      IndexProperty(elem.first, "DevType");
       temp_device_changed = true;
     }
   }
@@ -491,7 +744,7 @@ bool ConfigCache::FixDeviceTypeInconsistencies() {
 
 bool ConfigCache::HasAtLeastOneMatchingPropertiesInSection(
     const std::string& section, const std::unordered_set<std::string_view>& property_names) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  SharedLock lock(*this);
   const common::ListMap<std::string, std::string>* section_ptr;
   if (!IsDeviceSection(section)) {
     auto section_iter = information_sections_.find(section);
@@ -502,6 +755,7 @@ bool ConfigCache::HasAtLeastOneMatchingPropertiesInSection(
   } else {
     auto section_iter = persistent_devices_.find(section);
     if (section_iter == persistent_devices_.end()) {
+      std::lock_guard<std::mutex> lru_lock(temporary_devices_mutex_);
       section_iter = temporary_devices_.find(section);
       if (section_iter == temporary_devices_.end()) {
         return false;
@@ -517,8 +771,13 @@ bool ConfigCache::HasAtLeastOneMatchingPropertiesInSection(
   return false;
 }
 
+ConfigCache::LockStats ConfigCache::GetLockStats() const {
+  std::lock_guard<std::mutex> lock(lock_stats_mutex_);
+  return lock_stats_;
+}
+
 bool ConfigCache::IsPersistentSection(const std::string& section) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  SharedLock lock(*this);
   return persistent_devices_.contains(section);
 }
 
@@ -15,13 +15,17 @@
  */
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -48,9 +52,24 @@ class Mutation;
 // The definition of persistent sections is up to the user and is defined through the |persistent_property_names|
 // argument. When these properties are link key properties, then persistent sections is equal to bonded devices
 //
-// This class is thread safe
+// This class is thread safe, observers run in parallel and only modifiers are serialized
 class ConfigCache {
  public:
+  // Contention on the config lock, and how long modifiers keep others out
+  struct LockStats {
+    // Observers that had to wait for a modifier
+    uint64_t contended_shared_locks = 0;
+    std::chrono::microseconds total_shared_wait_time{0};
+    std::chrono::microseconds max_shared_wait_time{0};
+    uint64_t exclusive_locks = 0;
+    // Modifiers that had to wait for observers or another modifier
+    uint64_t contended_exclusive_locks = 0;
+    std::chrono::microseconds total_exclusive_wait_time{0};
+    std::chrono::microseconds max_exclusive_wait_time{0};
+    std::chrono::microseconds total_exclusive_hold_time{0};
+    std::chrono::microseconds max_exclusive_hold_time{0};
+  };
+
   ConfigCache(size_t temp_device_capacity, std::unordered_set<std::string_view> persistent_property_names);
 
   ConfigCache(const ConfigCache&) = delete;
@@ -95,7 +114,16 @@ class ConfigCache {
       return !(*this == rhs);
     }
   };
+  // Common sections come first, then persistent devices, then temporary devices, each group sorted by section name
   virtual std::vector<SectionAndPropertyValue> GetSectionNamesWithProperty(const std::string& property) const;
+  // Return a copy of the persistent device MAC addresses that have |property| set
+  virtual std::vector<std::string> GetPersistentSectionsWithProperty(const std::string& property) const;
+  // Return a copy of the lock statistics since construction
+  virtual LockStats GetLockStats() const;
+  // Return the properties of a persistent section as they are written to disk, std::nullopt if the section is not
+  // persistent
+  virtual std::optional<std::vector<std::pair<std::string, std::string>>> GetPersistentSectionContent(
+      const std::string& section) const;
 
   // modifiers
   // Commit all mutation entries in sequence while holding the config mutex
@@ -110,7 +138,11 @@ class ConfigCache {
   // remove all content in this config cache, restore it to the state after the explicit constructor
   virtual void Clear();
   // Set a callback to notify interested party that a persistent config change has just happened
+  // The callback runs while the config is locked and must not access the config
   virtual void SetPersistentConfigChangedCallback(std::function<void()> persistent_config_changed_callback);
+  // Return the sections whose persistent content changed since the last call, including the sections that were removed
+  // or became temporary. |cleared| is set when all the persistent content was removed in between, e.g. by Clear()
+  virtual std::vector<std::string> TakeChangedPersistentSections(bool* cleared);
 
   // Device config specific methods
   // TODO: methods here should be moved to a device specific config cache if this config cache is supposed to be generic
@@ -125,7 +157,11 @@ class ConfigCache {
   static const std::string kDefaultSectionName;
 
  private:
-  mutable std::recursive_mutex mutex_;
+  class SharedLock;
+  class ExclusiveLock;
+  mutable std::shared_mutex mutex_;
+  mutable std::mutex lock_stats_mutex_;
+  mutable LockStats lock_stats_;
   // A callback to notify interested party that a persistent config change has just happened, empty by default
   std::function<void()> persistent_config_changed_callback_;
   // A set of property names that if set would make a section persistent and if non of these properties are set, a
@@ -138,6 +174,25 @@ class ConfigCache {
   // Information about temporary devices, normally unpaired, will not be written to disk, will be evicted automatically
   // if capacity exceeds given value during initialization
   common::LruCache<std::string, common::ListMap<std::string, std::string>> temporary_devices_;
+  // Looking up a temporary device warms it up, which reorders the cache, hence observers serialize their lookups
+  mutable std::mutex temporary_devices_mutex_;
+  // Sections whose persistent content changed since the last TakeChangedPersistentSections(), so that the changes can
+  // be written to disk without serializing the whole config
+  std::unordered_set<std::string> changed_persistent_sections_;
+  bool persistent_sections_cleared_ = false;
+  // Names of the sections that have a property set, among all three maps above, so that sections can be looked up by
+  // property without going through every section
+  std::unordered_map<std::string, std::unordered_set<std::string>> sections_with_property_;
+
+  // Modifiers for callers that already hold an exclusive lock
+  void SetPropertyLocked(std::string section, std::string property, std::string value);
+  bool RemoveSectionLocked(const std::string& section);
+  bool RemovePropertyLocked(const std::string& section, const std::string& property);
+
+  // Keep sections_with_property_ up to date with the three maps
+  void IndexProperty(const std::string& section, const std::string& property);
+  void UnindexProperty(const std::string& section, const std::string& property);
+  void UnindexSection(const std::string& section, const common::ListMap<std::string, std::string>& properties);
 
   // Convenience method to check if the callback is valid before calling it
   inline void PersistentConfigChangedCallback() const {
@@ -145,6 +200,12 @@ class ConfigCache {
       persistent_config_changed_callback_();
     }
   }
+
+  // Record the change of a persistent section before notifying it
+  inline void PersistentSectionChanged(const std::string& section) {
+    changed_persistent_sections_.insert(section);
+    PersistentConfigChangedCallback();
+  }
 };
 
 }  // namespace storage
@@ -20,6 +20,8 @@
 #include <gtest/gtest.h>
 
 #include <cstdio>
+#include <thread>
+#include <vector>
 
 #include "hci/enum_helper.h"
 #include "storage/config_keys.h"
@@ -280,6 +282,89 @@ TEST(ConfigCacheTest, persistent_config_changed_callback_test) {
   ASSERT_EQ(num_change, 4);
 }
 
+TEST(ConfigCacheTest, persistent_config_unchanged_value_test) {
+  ConfigCache config(100, Device::kLinkKeyProperties);
+  int num_change = 0;
+  config.SetPersistentConfigChangedCallback([&num_change] { num_change++; });
+  config.SetProperty("A", "B", "C");
+  config.SetProperty("A", "B", "C");
+  ASSERT_EQ(num_change, 1);
+  config.SetProperty("CC:DD:EE:FF:00:11", "B", "AABBAABBCCDDEE");
+  config.SetProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDEE");
+  ASSERT_EQ(num_change, 2);
+  config.SetProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDEE");
+  config.SetProperty("CC:DD:EE:FF:00:11", "B", "AABBAABBCCDDEE");
+  ASSERT_EQ(num_change, 2);
+  config.SetProperty("CC:DD:EE:FF:00:11", "B", "CCDD");
+  ASSERT_EQ(num_change, 3);
+  ASSERT_THAT(config.GetProperty("CC:DD:EE:FF:00:11", "B"), Optional(StrEq("CCDD")));
+}
+
+TEST(ConfigCacheTest, changed_persistent_sections_test) {
+  ConfigCache config(100, Device::kLinkKeyProperties);
+  bool cleared = true;
+  config.SetProperty("A", "B", "C");
+  config.SetProperty("AA:BB:CC:DD:EE:FF", "B", "C");
+  config.SetProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDEE");
+  ASSERT_THAT(config.TakeChangedPersistentSections(&cleared), UnorderedElementsAre("A", "CC:DD:EE:FF:00:11"));
+  ASSERT_FALSE(cleared);
+  ASSERT_THAT(config.TakeChangedPersistentSections(&cleared), IsEmpty());
+
+  // A section that became temporary changed too
+  config.RemoveProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY);
+  ASSERT_THAT(config.TakeChangedPersistentSections(&cleared), ElementsAre("CC:DD:EE:FF:00:11"));
+  ASSERT_FALSE(config.GetPersistentSectionContent("CC:DD:EE:FF:00:11"));
+  ASSERT_THAT(
+      config.GetPersistentSectionContent("A"), Optional(ElementsAre(std::pair<std::string, std::string>("B", "C"))));
+
+  config.SetProperty("A", "B", "D");
+  config.Clear();
+  ASSERT_THAT(config.TakeChangedPersistentSections(&cleared), IsEmpty());
+  ASSERT_TRUE(cleared);
+}
+
+TEST(ConfigCacheTest, lock_stats_test) {
+  ConfigCache config(100, Device::kLinkKeyProperties);
+  config.SetProperty("A", "B", "C");
+  std::queue<bluetooth::storage::MutationEntry> entries;
+  entries.push(bluetooth::storage::MutationEntry::Set(
+      bluetooth::storage::MutationEntry::PropertyType::NORMAL, "A", "C", "D"));
+  entries.push(bluetooth::storage::MutationEntry::Remove(
+      bluetooth::storage::MutationEntry::PropertyType::NORMAL, "A", "B"));
+  config.Commit(entries);
+  ASSERT_THAT(config.GetProperty("A", "C"), Optional(StrEq("D")));
+  ASSERT_FALSE(config.HasProperty("A", "B"));
+  // Observers are not counted, and a commit takes the lock once for all its entries
+  auto stats = config.GetLockStats();
+  ASSERT_EQ(stats.exclusive_locks, 2u);
+  ASSERT_EQ(stats.contended_shared_locks, 0u);
+  ASSERT_EQ(stats.contended_exclusive_locks, 0u);
+  ASSERT_GE(stats.total_exclusive_hold_time, stats.max_exclusive_hold_time);
+}
+
+TEST(ConfigCacheTest, concurrent_observers_and_modifiers_test) {
+  ConfigCache config(100, Device::kLinkKeyProperties);
+  config.SetProperty(GetTestAddress(0), BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDEE");
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; i++) {
+    readers.emplace_back([&config] {
+      for (int j = 0; j < 1000; j++) {
+        ASSERT_TRUE(config.HasSection(GetTestAddress(0)));
+        config.GetProperty(GetTestAddress(1), "B");
+        config.SerializeToLegacyFormat();
+      }
+    });
+  }
+  for (int j = 0; j < 1000; j++) {
+    config.SetProperty(GetTestAddress(1), "B", std::to_string(j));
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  ASSERT_THAT(config.GetProperty(GetTestAddress(1), "B"), Optional(StrEq("999")));
+  ASSERT_EQ(config.GetLockStats().exclusive_locks, 1001u);
+}
+
 TEST(ConfigCacheTest, fix_device_type_inconsistency_missing_devtype_no_keys_test) {
   ConfigCache config(100, Device::kLinkKeyProperties);
   config.SetProperty("A", "B", "C");
@@ -420,6 +505,56 @@ TEST(ConfigCacheTest, test_get_section_with_property) {
           SectionAndPropertyValue{.section = "AA:BB:CC:DD:EE:FF", .property = "C"}));
 }
 
+TEST(ConfigCacheTest, test_get_section_with_property_follows_changes) {
+  ConfigCache config(2, Device::kLinkKeyProperties);
+  config.SetProperty("A", "B", "C");
+  config.SetProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDEE");
+  config.SetProperty("CC:DD:EE:FF:00:11", "B", "D");
+  config.SetProperty("BB:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDEF");
+  config.SetProperty("BB:DD:EE:FF:00:11", "B", "E");
+  config.SetProperty("AA:BB:CC:DD:EE:FF", "B", "F");
+  ASSERT_THAT(
+      config.GetSectionNamesWithProperty("B"),
+      ElementsAre(
+          SectionAndPropertyValue{.section = "A", .property = "C"},
+          SectionAndPropertyValue{.section = "BB:DD:EE:FF:00:11", .property = "E"},
+          SectionAndPropertyValue{.section = "CC:DD:EE:FF:00:11", .property = "D"},
+          SectionAndPropertyValue{.section = "AA:BB:CC:DD:EE:FF", .property = "F"}));
+  ASSERT_THAT(
+      config.GetPersistentSectionsWithProperty(BTIF_STORAGE_KEY_LINK_KEY),
+      ElementsAre("BB:DD:EE:FF:00:11", "CC:DD:EE:FF:00:11"));
+
+  // Unpaired device is still found as a temporary device
+  config.RemoveProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY);
+  ASSERT_THAT(config.GetPersistentSectionsWithProperty(BTIF_STORAGE_KEY_LINK_KEY), ElementsAre("BB:DD:EE:FF:00:11"));
+  ASSERT_THAT(
+      config.GetSectionNamesWithProperty("B"),
+      ElementsAre(
+          SectionAndPropertyValue{.section = "A", .property = "C"},
+          SectionAndPropertyValue{.section = "BB:DD:EE:FF:00:11", .property = "E"},
+          SectionAndPropertyValue{.section = "AA:BB:CC:DD:EE:FF", .property = "F"},
+          SectionAndPropertyValue{.section = "CC:DD:EE:FF:00:11", .property = "D"}));
+
+  // Evicted temporary device is no longer found
+  config.SetProperty("DD:EE:FF:00:11:22", "C", "G");
+  ASSERT_THAT(
+      config.GetSectionNamesWithProperty("B"),
+      ElementsAre(
+          SectionAndPropertyValue{.section = "A", .property = "C"},
+          SectionAndPropertyValue{.section = "BB:DD:EE:FF:00:11", .property = "E"},
+          SectionAndPropertyValue{.section = "CC:DD:EE:FF:00:11", .property = "D"}));
+
+  config.RemoveSection("BB:DD:EE:FF:00:11");
+  config.RemoveProperty("A", "B");
+  ASSERT_THAT(
+      config.GetSectionNamesWithProperty("B"),
+      ElementsAre(SectionAndPropertyValue{.section = "CC:DD:EE:FF:00:11", .property = "D"}));
+  ASSERT_THAT(config.GetPersistentSectionsWithProperty(BTIF_STORAGE_KEY_LINK_KEY), IsEmpty());
+
+  config.Clear();
+  ASSERT_THAT(config.GetSectionNamesWithProperty("B"), IsEmpty());
+}
+
 TEST(ConfigCacheTest, test_get_sections_matching_at_least_one_property) {
   ConfigCache config(100, Device::kLinkKeyProperties);
   config.SetProperty("A", "B", "C");
@@ -0,0 +1,285 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "storage/config_journal_file.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "os/files.h"
+#include "os/log.h"
+
+namespace bluetooth {
+namespace storage {
+
+namespace {
+
+// File layout: magic, version, then records of
+//   type (1 byte) | payload size (4 bytes) | checksum of type and payload (4 bytes) | payload
+// Integers are little endian, strings are their size (4 bytes) followed by their bytes.
+constexpr char kMagic[] = {'B', 'T', 'C', 'J'};
+constexpr uint8_t kVersion = 1;
+constexpr size_t kFileHeaderSize = sizeof(kMagic) + 1;
+constexpr size_t kRecordHeaderSize = 9;
+
+enum class RecordType : uint8_t {
+  // Section name, number of properties, then each property name and value
+  SECTION = 1,
+  // Section name
+  REMOVE_SECTION = 2,
+  // Empty
+  CLEAR = 3,
+};
+
+// FNV-1a, to detect torn or corrupted records
+uint32_t Checksum(uint8_t type, const std::string& payload) {
+  uint32_t hash = 2166136261u;
+  hash = (hash ^ type) * 16777619u;
+  for (char c : payload) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+void PutUint32(std::string& out, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+void PutString(std::string& out, const std::string& value) {
+  PutUint32(out, value.size());
+  out.append(value);
+}
+
+void PutRecord(std::string& out, RecordType type, const std::string& payload) {
+  out.push_back(static_cast<char>(type));
+  PutUint32(out, payload.size());
+  PutUint32(out, Checksum(static_cast<uint8_t>(type), payload));
+  out.append(payload);
+}
+
+// Reads from a buffer, every read fails once the end of the buffer was passed
+class Reader {
+ public:
+  Reader(const char* data, size_t size) : data_(data), size_(size) {}
+
+  bool GetUint32(uint32_t* value) {
+    if (size_ - offset_ < 4) {
+      return false;
+    }
+    *value = 0;
+    for (int i = 0; i < 4; i++) {
+      *value |= static_cast<uint32_t>(static_cast<uint8_t>(data_[offset_ + i])) << (8 * i);
+    }
+    offset_ += 4;
+    return true;
+  }
+
+  bool GetString(std::string* value) {
+    uint32_t size;
+    if (!GetUint32(&size) || size_ - offset_ < size) {
+      return false;
+    }
+    value->assign(data_ + offset_, size);
+    offset_ += size;
+    return true;
+  }
+
+  bool AtEnd() const {
+    return offset_ == size_;
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+bool ApplyRecord(RecordType type, const char* payload, size_t size, ConfigCache* cache) {
+  Reader reader(payload, size);
+  switch (type) {
+    case RecordType::SECTION: {
+      std::string section;
+      uint32_t num_properties;
+      if (!reader.GetString(&section) || !reader.GetUint32(&num_properties)) {
+        return false;
+      }
+      std::vector<std::pair<std::string, std::string>> properties;
+      for (uint32_t i = 0; i < num_properties; i++) {
+        std::string property;
+        std::string value;
+        if (!reader.GetString(&property) || !reader.GetString(&value)) {
+          return false;
+        }
+        properties.emplace_back(std::move(property), std::move(value));
+      }
+      if (!reader.AtEnd() || section.empty()) {
+        return false;
+      }
+      cache->RemoveSection(section);
+      for (auto& [property, value] : properties) {
+        cache->SetProperty(section, std::move(property), std::move(value));
+      }
+      return true;
+    }
+    case RecordType::REMOVE_SECTION: {
+      std::string section;
+      if (!reader.GetString(&section) || !reader.AtEnd()) {
+        return false;
+      }
+      cache->RemoveSection(section);
+      return true;
+    }
+    case RecordType::CLEAR: {
+      if (!reader.AtEnd()) {
+        return false;
+      }
+      cache->Clear();
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+ConfigJournalFile::ConfigJournalFile(std::string path) : path_(std::move(path)) {
+  ASSERT(!path_.empty());
+}
+
+bool ConfigJournalFile::Append(const ConfigCache& cache, const std::vector<std::string>& sections, bool cleared) {
+  std::string records;
+  // Missing, or created by an append that did not complete
+  bool new_file = Size() < kFileHeaderSize;
+  if (new_file) {
+    records.append(kMagic, sizeof(kMagic));
+    records.push_back(static_cast<char>(kVersion));
+  }
+  if (cleared) {
+    PutRecord(records, RecordType::CLEAR, {});
+  }
+  for (const auto& section : sections) {
+    std::string payload;
+    PutString(payload, section);
+    auto properties = cache.GetPersistentSectionContent(section);
+    if (!properties) {
+      PutRecord(records, RecordType::REMOVE_SECTION, payload);
+      continue;
+    }
+    PutUint32(payload, properties->size());
+    for (const auto& [property, value] : *properties) {
+      PutString(payload, property);
+      PutString(payload, value);
+    }
+    PutRecord(records, RecordType::SECTION, payload);
+  }
+
+  int flags = O_WRONLY | O_CREAT | O_APPEND | (new_file ? O_TRUNC : 0);
+  int fd = open(path_.c_str(), flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+  if (fd < 0) {
+    LOG_ERROR("unable to open journal '%s', error: %s", path_.c_str(), strerror(errno));
+    return false;
+  }
+  const char* data = records.data();
+  size_t remaining = records.size();
+  while (remaining > 0) {
+    ssize_t written = write(fd, data, remaining);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      LOG_ERROR("unable to append to journal '%s', error: %s", path_.c_str(), strerror(errno));
+      close(fd);
+      return false;
+    }
+    data += written;
+    remaining -= written;
+  }
+  if (fsync(fd) != 0) {
+    LOG_WARN("unable to fsync journal '%s', error: %s", path_.c_str(), strerror(errno));
+    // Allow fsync to fail and continue
+  }
+  if (close(fd) != 0) {
+    LOG_ERROR("unable to close journal '%s', error: %s", path_.c_str(), strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+bool ConfigJournalFile::Replay(ConfigCache* cache) {
+  if (!os::FileExists(path_)) {
+    return true;
+  }
+  auto content = os::ReadSmallFile(path_);
+  if (!content) {
+    return false;
+  }
+  if (content->size() < kFileHeaderSize || content->compare(0, sizeof(kMagic), kMagic, sizeof(kMagic)) != 0 ||
+      static_cast<uint8_t>((*content)[sizeof(kMagic)]) != kVersion) {
+    LOG_WARN("ignoring journal '%s' with an invalid header", path_.c_str());
+    return false;
+  }
+  size_t offset = kFileHeaderSize;
+  size_t num_records = 0;
+  while (offset < content->size()) {
+    if (content->size() - offset < kRecordHeaderSize) {
+      LOG_WARN("journal '%s' ends with a torn record after %zu records", path_.c_str(), num_records);
+      return false;
+    }
+    auto type = static_cast<uint8_t>((*content)[offset]);
+    uint32_t size;
+    uint32_t checksum;
+    Reader(content->data() + offset + 1, 4).GetUint32(&size);
+    Reader(content->data() + offset + 5, 4).GetUint32(&checksum);
+    offset += kRecordHeaderSize;
+    if (content->size() - offset < size) {
+      LOG_WARN("journal '%s' ends with a torn record after %zu records", path_.c_str(), num_records);
+      return false;
+    }
+    std::string payload = content->substr(offset, size);
+    if (Checksum(type, payload) != checksum ||
+        !ApplyRecord(static_cast<RecordType>(type), payload.data(), payload.size(), cache)) {
+      LOG_WARN("journal '%s' has a corrupted record after %zu records", path_.c_str(), num_records);
+      return false;
+    }
+    offset += size;
+    num_records++;
+  }
+  LOG_INFO("replayed %zu records from journal '%s'", num_records, path_.c_str());
+  return true;
+}
+
+size_t ConfigJournalFile::Size() const {
+  struct stat file_stat {};
+  if (stat(path_.c_str(), &file_stat) != 0) {
+    return 0;
+  }
+  return file_stat.st_size;
+}
+
+bool ConfigJournalFile::Delete() {
+  if (!os::FileExists(path_)) {
+    return false;
+  }
+  return os::RemoveFile(path_);
+}
+
+}  // namespace storage
+}  // namespace bluetooth
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/config_cache.h"
+
+namespace bluetooth {
+namespace storage {
+
+// Binary append-only log of the persistent config changes made since the legacy config file was last written
+//
+// Each record holds the full persistent content of one changed section, the removal of a section that is no longer
+// persistent, or the removal of all persistent content. Replaying the records in order on top of the legacy config
+// file they follow gives back the config, and replaying them again on top of a more recent legacy config file that
+// already contains them is harmless. Records are length prefixed and checksummed, a record torn by a crash while being
+// appended ends the replay.
+class ConfigJournalFile {
+ public:
+  static ConfigJournalFile FromPath(std::string path) {
+    return ConfigJournalFile(std::move(path));
+  }
+  explicit ConfigJournalFile(std::string path);
+  // Append records for |sections| of |cache|, preceded by the removal of all persistent content when |cleared| is set
+  bool Append(const ConfigCache& cache, const std::vector<std::string>& sections, bool cleared);
+  // Apply the records to |cache|, return false if the journal is corrupted after the records that were applied
+  bool Replay(ConfigCache* cache);
+  // Size of the journal on disk, 0 if it does not exist
+  size_t Size() const;
+  bool Delete();
+
+ private:
+  std::string path_;
+};
+
+}  // namespace storage
+}  // namespace bluetooth
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "storage/config_journal_file.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "os/files.h"
+#include "storage/config_keys.h"
+#include "storage/device.h"
+
+namespace testing {
+
+using bluetooth::os::ReadSmallFile;
+using bluetooth::os::WriteToFile;
+using bluetooth::storage::ConfigCache;
+using bluetooth::storage::ConfigJournalFile;
+using bluetooth::storage::Device;
+
+class ConfigJournalFileTest : public Test {
+ protected:
+  void SetUp() override {
+    temp_journal_ = std::filesystem::temp_directory_path() / "temp_config.journal";
+    std::filesystem::remove(temp_journal_);
+    config_.SetProperty("A", "B", "C");
+    config_.SetProperty("AA:BB:CC:DD:EE:FF", "B", "C");
+    config_.SetProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDEE");
+    // Start from a config, as if it was on disk
+    base_ = Copy(config_);
+    bool cleared = false;
+    config_.TakeChangedPersistentSections(&cleared);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(temp_journal_);
+  }
+
+  static ConfigCache Copy(const ConfigCache& config) {
+    ConfigCache copy(100, Device::kLinkKeyProperties);
+    for (const auto& section : {"A", "AA:BB:CC:DD:EE:FF", "CC:DD:EE:FF:00:11", "DD:EE:FF:00:11:22"}) {
+      auto properties = config.GetPersistentSectionContent(section);
+      if (properties) {
+        for (const auto& [property, value] : *properties) {
+          copy.SetProperty(section, property, value);
+        }
+      }
+    }
+    return copy;
+  }
+
+  bool Save() {
+    bool cleared = false;
+    auto sections = config_.TakeChangedPersistentSections(&cleared);
+    return ConfigJournalFile::FromPath(temp_journal_.string()).Append(config_, sections, cleared);
+  }
+
+  std::filesystem::path temp_journal_;
+  ConfigCache config_{100, Device::kLinkKeyProperties};
+  ConfigCache base_{100, Device::kLinkKeyProperties};
+};
+
+TEST_F(ConfigJournalFileTest, replay_changes_test) {
+  config_.SetProperty("A", "B", "D");
+  config_.SetProperty("DD:EE:FF:00:11:22", BTIF_STORAGE_KEY_LINK_KEY, "AABBAABBCCDDFF");
+  ASSERT_TRUE(Save());
+  // Unpaired device
+  config_.RemoveProperty("CC:DD:EE:FF:00:11", BTIF_STORAGE_KEY_LINK_KEY);
+  ASSERT_TRUE(Save());
+
+  ASSERT_TRUE(ConfigJournalFile::FromPath(temp_journal_.string()).Replay(&base_));
+  EXPECT_THAT(base_.GetProperty("A", "B"), Optional(StrEq("D")));
+  EXPECT_THAT(base_.GetPersistentSections(), ElementsAre("DD:EE:FF:00:11:22"));
+  EXPECT_FALSE(base_.HasSection("CC:DD:EE:FF:00:11"));
+
+  // Replaying on top of a config that already has the changes gives the same config
+  auto latest = Copy(config_);
+  ASSERT_TRUE(ConfigJournalFile::FromPath(temp_journal_.string()).Replay(&latest));
+  EXPECT_EQ(latest, base_);
+}
+
+TEST_F(ConfigJournalFileTest, replay_clear_test) {
+  config_.Clear();
+  config_.SetProperty("E", "F", "G");
+  ASSERT_TRUE(Save());
+
+  ASSERT_TRUE(ConfigJournalFile::FromPath(temp_journal_.string()).Replay(&base_));
+  EXPECT_FALSE(base_.HasSection("A"));
+  EXPECT_TRUE(base_.GetPersistentSections().empty());
+  EXPECT_THAT(base_.GetProperty("E", "F"), Optional(StrEq("G")));
+}
+
+TEST_F(ConfigJournalFileTest, append_is_proportional_to_change_test) {
+  config_.SetProperty("A", "B", "D");
+  ASSERT_TRUE(Save());
+  auto size = ConfigJournalFile::FromPath(temp_journal_.string()).Size();
+  config_.SetProperty("A", "B", "E");
+  ASSERT_TRUE(Save());
+  auto record_size = ConfigJournalFile::FromPath(temp_journal_.string()).Size() - size;
+  // Header and section name, property count, property name and value
+  EXPECT_EQ(record_size, 9u + 5u + 4u + 5u + 5u);
+}
+
+TEST_F(ConfigJournalFileTest, torn_record_test) {
+  config_.SetProperty("A", "B", "D");
+  ASSERT_TRUE(Save());
+  config_.SetProperty("A", "B", "E");
+  ASSERT_TRUE(Save());
+
+  auto content = ReadSmallFile(temp_journal_.string());
+  ASSERT_TRUE(content);
+  std::filesystem::resize_file(temp_journal_, content->size() - 1);
+  ASSERT_FALSE(ConfigJournalFile::FromPath(temp_journal_.string()).Replay(&base_));
+  // The complete records are applied
+  EXPECT_THAT(base_.GetProperty("A", "B"), Optional(StrEq("D")));
+}
+
+TEST_F(ConfigJournalFileTest, invalid_file_test) {
+  ASSERT_TRUE(WriteToFile(temp_journal_.string(), "[A]\nB = D\n"));
+  ASSERT_FALSE(ConfigJournalFile::FromPath(temp_journal_.string()).Replay(&base_));
+  EXPECT_THAT(base_.GetProperty("A", "B"), Optional(StrEq("C")));
+}
+
+TEST_F(ConfigJournalFileTest, missing_file_test) {
+  EXPECT_EQ(ConfigJournalFile::FromPath(temp_journal_.string()).Size(), 0u);
+  ASSERT_TRUE(ConfigJournalFile::FromPath(temp_journal_.string()).Replay(&base_));
+  EXPECT_FALSE(ConfigJournalFile::FromPath(temp_journal_.string()).Delete());
+}
+
+}  // namespace testing
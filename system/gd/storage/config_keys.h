@@ -60,6 +60,7 @@
 #define BTIF_STORAGE_KEY_HID_PRODUCT_ID "HidProductId"
 #define BTIF_STORAGE_KEY_HID_RECONNECT_ALLOWED "HidReConnectAllowed"
 #define BTIF_STORAGE_KEY_HID_REPORT "HidReport"
+#define BTIF_STORAGE_KEY_HID_REPORT_DB_HASH "HidReportDbHash"
 #define BTIF_STORAGE_KEY_HID_REPORT_VERSION "HidReportVersion"
 #define BTIF_STORAGE_KEY_HID_SSR_MAX_LATENCY "HidSSRMaxLatency"
 #define BTIF_STORAGE_KEY_HID_SSR_MIN_TIMEOUT "HidSSRMinTimeout"
@@ -16,13 +16,19 @@
 
 #include "storage/storage_module.h"
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <functional>
 #include <iomanip>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <utility>
 
 #include "common/bind.h"
+#include "dumpsys_data_generated.h"
 #include "metrics/counter_metrics.h"
 #include "os/alarm.h"
 #include "os/files.h"
@@ -30,9 +36,11 @@
 #include "os/parameter_provider.h"
 #include "os/system_properties.h"
 #include "storage/config_cache.h"
+#include "storage/config_journal_file.h"
 #include "storage/config_keys.h"
 #include "storage/legacy_config_file.h"
 #include "storage/mutation.h"
+#include "storage_module_generated.h"
 
 namespace bluetooth {
 namespace storage {
@@ -41,6 +49,9 @@ using os::Alarm;
 using os::Handler;
 
 static const std::string kFactoryResetProperty = "persist.bluetooth.factoryreset";
+// Keep the parsed config in memory when the stack stops, and reuse it on the next start if the config file was not
+// changed in between, so that restarting the stack does not parse the config again
+static const std::string kWarmRestartProperty = "bluetooth.storage.warm_restart.enabled";
 
 static const size_t kDefaultTempDeviceCapacity = 10000;
 // Save config whenever there is a change, but delay it by this value so that burst config change won't overwhelm disk
@@ -48,6 +59,9 @@ static const std::chrono::milliseconds kDefaultConfigSaveDelay = std::chrono::mi
 // Writing a config to disk takes a minimum 10 ms on a decent x86_64 machine, and 20 ms if including backup file
 // The config saving delay must be bigger than this value to avoid overwhelming the disk
 static const std::chrono::milliseconds kMinConfigSaveDelay = std::chrono::milliseconds(20);
+// The config file is rewritten once the journal is larger than it, but not before the journal reaches this size so
+// that small configs are not rewritten on every change
+static const size_t kMinJournalCompactionSize = 16 * 1024;
 
 const int kConfigFileComparePass = 1;
 const int kConfigBackupComparePass = 2;
@@ -74,6 +88,7 @@ StorageModule::StorageModule(
       is_single_user_mode_(is_single_user_mode) {
   // e.g. "/data/misc/bluedroid/bt_config.conf" to "/data/misc/bluedroid/bt_config.bak"
   config_backup_path_ = config_file_path_.substr(0, config_file_path_.find_last_of('.')) + ".bak";
+  config_journal_path_ = config_file_path_.substr(0, config_file_path_.find_last_of('.')) + ".journal";
   ASSERT_LOG(
       config_save_delay > kMinConfigSaveDelay,
       "Config save delay of %lld ms is not enough, must be at least %lld ms to avoid overwhelming the disk",
@@ -83,6 +98,7 @@ StorageModule::StorageModule(
 
 StorageModule::~StorageModule() {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::unique_lock<std::shared_mutex> pimpl_lock(pimpl_mutex_);
   pimpl_.reset();
 }
 
@@ -98,10 +114,65 @@ struct StorageModule::impl {
   ConfigCache cache_;
   ConfigCache memory_only_cache_;
   bool has_pending_config_save_ = false;
+  // The journal bypasses the config checksum kept in common criteria mode, hence it is disabled in that mode
+  bool journal_enabled_ = false;
+  // Set when the journal can't be appended to, e.g. it ends with a torn record or the config was read from the backup
+  bool journal_needs_compaction_ = false;
+  // Size of the config file written by the last compaction
+  size_t config_size_ = 0;
 };
 
+namespace {
+
+// Config left by the last stopped storage module, along with the hash of the config file it matches
+struct WarmConfig {
+  std::string config_file_path;
+  size_t config_file_hash;
+  ConfigCache cache;
+};
+
+std::mutex warm_config_mutex;
+std::optional<WarmConfig> warm_config;
+
+void KeepWarmConfig(const std::string& config_file_path, ConfigCache cache) {
+  auto content = os::ReadSmallFile(config_file_path);
+  std::lock_guard<std::mutex> lock(warm_config_mutex);
+  if (!content) {
+    warm_config.reset();
+    return;
+  }
+  warm_config.emplace(WarmConfig{config_file_path, std::hash<std::string>{}(*content), std::move(cache)});
+}
+
+// Return the config kept by the last stopped storage module if it still matches the config file on disk
+std::optional<ConfigCache> TakeWarmConfig(const std::string& config_file_path, const std::string& journal_path) {
+  std::optional<WarmConfig> warm;
+  {
+    std::lock_guard<std::mutex> lock(warm_config_mutex);
+    warm = std::move(warm_config);
+    warm_config.reset();
+  }
+  if (!warm || warm->config_file_path != config_file_path || ConfigJournalFile::FromPath(journal_path).Size() > 0) {
+    return std::nullopt;
+  }
+  auto content = os::ReadSmallFile(config_file_path);
+  if (!content || std::hash<std::string>{}(*content) != warm->config_file_hash) {
+    LOG_INFO("Config at %s changed since the stack stopped, reading it again", config_file_path.c_str());
+    return std::nullopt;
+  }
+  return std::move(warm->cache);
+}
+
+}  // namespace
+
+static bool IsConfigJournalEnabled() {
+  return !(
+      bluetooth::os::ParameterProvider::GetBtKeystoreInterface() != nullptr &&
+      bluetooth::os::ParameterProvider::IsCommonCriteriaMode());
+}
+
 Mutation StorageModule::Modify() {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return Mutation(&pimpl_->cache_, &pimpl_->memory_only_cache_);
 }
 
@@ -121,17 +192,41 @@ void StorageModule::SaveImmediately() {
     pimpl_->config_save_alarm_.Cancel();
     pimpl_->has_pending_config_save_ = false;
   }
+  bool cleared = false;
+  auto changed_sections = pimpl_->cache_.TakeChangedPersistentSections(&cleared);
+  // The journal is appended to even when compacting, so that the config file it follows plus the journal is always
+  // complete while the config file is being rewritten
+  if (pimpl_->journal_enabled_ && !pimpl_->journal_needs_compaction_ && os::FileExists(config_file_path_)) {
+    auto journal = ConfigJournalFile::FromPath(config_journal_path_);
+    if (journal.Append(pimpl_->cache_, changed_sections, cleared)) {
+      if (journal.Size() <= std::max(kMinJournalCompactionSize, pimpl_->config_size_)) {
+        return;
+      }
+    } else {
+      LOG_ERROR("Unable to append to config journal, writing the whole config");
+    }
+  }
+  CompactConfig();
+}
+
+void StorageModule::CompactConfig() {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::string serialized = pimpl_->cache_.SerializeToLegacyFormat();
   // 1. rename old config to backup name
   if (os::FileExists(config_file_path_)) {
     ASSERT(os::RenameFile(config_file_path_, config_backup_path_));
   }
   // 2. write in-memory config to disk, if failed, backup can still be used
-  ASSERT(LegacyConfigFile::FromPath(config_file_path_).Write(pimpl_->cache_));
+  ASSERT(os::WriteToFile(config_file_path_, serialized));
   // 3. now write back up to disk as well
-  if (!LegacyConfigFile::FromPath(config_backup_path_).Write(pimpl_->cache_)) {
+  if (!os::WriteToFile(config_backup_path_, serialized)) {
     LOG_ERROR("Unable to write backup config file");
   }
-  // 4. save checksum if it is running in common criteria mode
+  // 4. both files have all the changes, the journal is no longer needed
+  ConfigJournalFile::FromPath(config_journal_path_).Delete();
+  pimpl_->journal_needs_compaction_ = false;
+  pimpl_->config_size_ = serialized.size();
+  // 5. save checksum if it is running in common criteria mode
   if (bluetooth::os::ParameterProvider::GetBtKeystoreInterface() != nullptr &&
       bluetooth::os::ParameterProvider::IsCommonCriteriaMode()) {
     bluetooth::os::ParameterProvider::GetBtKeystoreInterface()->set_encrypt_key_or_remove_key(
@@ -155,28 +250,55 @@ void StorageModule::Start() {
     LOG_INFO("%s is true, delete config files", kFactoryResetProperty.c_str());
     LegacyConfigFile::FromPath(config_file_path_).Delete();
     LegacyConfigFile::FromPath(config_backup_path_).Delete();
+    ConfigJournalFile::FromPath(config_journal_path_).Delete();
     os::SetSystemProperty(kFactoryResetProperty, "false");
   }
+  bool journal_enabled = IsConfigJournalEnabled();
+  bool journal_needs_compaction = false;
+  if (!journal_enabled) {
+    ConfigJournalFile::FromPath(config_journal_path_).Delete();
+  }
   if (!is_config_checksum_pass(kConfigFileComparePass)) {
     LegacyConfigFile::FromPath(config_file_path_).Delete();
   }
   if (!is_config_checksum_pass(kConfigBackupComparePass)) {
     LegacyConfigFile::FromPath(config_backup_path_).Delete();
   }
+  // Always taken, so that a config kept before the property was cleared is not reused later
+  auto previous_config = TakeWarmConfig(config_file_path_, config_journal_path_);
+  if (!os::GetSystemPropertyBool(kWarmRestartProperty, false)) {
+    previous_config.reset();
+  }
   bool save_needed = false;
-  auto config = LegacyConfigFile::FromPath(config_file_path_).Read(temp_devices_capacity_);
+  std::optional<ConfigCache> config;
+  if (previous_config) {
+    LOG_INFO("Reusing the config of the previous stack run");
+    config = std::move(previous_config);
+  } else {
+    config = LegacyConfigFile::FromPath(config_file_path_).Read(temp_devices_capacity_);
+  }
   if (!config || !config->HasSection(kAdapterSection)) {
     LOG_WARN("cannot load config at %s, using backup at %s.", config_file_path_.c_str(), config_backup_path_.c_str());
     config = LegacyConfigFile::FromPath(config_backup_path_).Read(temp_devices_capacity_);
     file_source = "Backup";
     // Make sure to update the file, since it wasn't read from the config_file_path_
     save_needed = true;
+    journal_needs_compaction = true;
   }
   if (!config || !config->HasSection(kAdapterSection)) {
     LOG_WARN("cannot load backup config at %s; creating new empty ones", config_backup_path_.c_str());
     config.emplace(temp_devices_capacity_, Device::kLinkKeyProperties);
     file_source = "Empty";
+    // The journal has nothing left to apply to
+    ConfigJournalFile::FromPath(config_journal_path_).Delete();
+  } else if (journal_enabled && !ConfigJournalFile::FromPath(config_journal_path_).Replay(&config.value())) {
+    // Keep what could be replayed, but don't append after a corrupted record
+    save_needed = true;
+    journal_needs_compaction = true;
   }
+  // What was read is already on disk
+  bool cleared = false;
+  config->TakeChangedPersistentSections(&cleared);
   if (!file_source.empty()) {
     config->SetProperty(kInfoSection, kFileSourceProperty, std::move(file_source));
   }
@@ -195,7 +317,14 @@ void StorageModule::Start() {
   }
   config->FixDeviceTypeInconsistencies();
   // TODO (b/158035889) Migrate metrics module to GD
-  pimpl_ = std::make_unique<impl>(GetHandler(), std::move(config.value()), temp_devices_capacity_);
+  size_t config_size = config->SerializeToLegacyFormat().size();
+  {
+    std::unique_lock<std::shared_mutex> pimpl_lock(pimpl_mutex_);
+    pimpl_ = std::make_unique<impl>(GetHandler(), std::move(config.value()), temp_devices_capacity_);
+  }
+  pimpl_->journal_enabled_ = journal_enabled;
+  pimpl_->journal_needs_compaction_ = journal_needs_compaction;
+  pimpl_->config_size_ = config_size;
   if (save_needed) {
     // Set a timer and write the new config file to disk.
     SaveDelayed();
@@ -213,9 +342,19 @@ void StorageModule::Stop() {
     // Save pending changes before stopping the module.
     SaveImmediately();
   }
+  if (ConfigJournalFile::FromPath(config_journal_path_).Size() > 0) {
+    // Leave an up to date config file for the tools that read it
+    CompactConfig();
+  }
   if (bluetooth::os::ParameterProvider::GetBtKeystoreInterface() != nullptr) {
     bluetooth::os::ParameterProvider::GetBtKeystoreInterface()->clear_map();
   }
+  std::unique_lock<std::shared_mutex> pimpl_lock(pimpl_mutex_);
+  if (os::GetSystemPropertyBool(kWarmRestartProperty, false) &&
+      ConfigJournalFile::FromPath(config_journal_path_).Size() == 0) {
+    pimpl_->cache_.SetPersistentConfigChangedCallback(nullptr);
+    KeepWarmConfig(config_file_path_, std::move(pimpl_->cache_));
+  }
   pimpl_.reset();
 }
 
@@ -223,8 +362,37 @@ std::string StorageModule::ToString() const {
   return "Storage Module";
 }
 
+DumpsysDataFinisher StorageModule::GetDumpsysData(flatbuffers::FlatBufferBuilder* builder) const {
+  ASSERT(builder != nullptr);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
+  if (pimpl_ == nullptr) {
+    return EmptyDumpsysDataFinisher;
+  }
+  auto stats = pimpl_->cache_.GetLockStats();
+  auto title = builder->CreateString("----- Storage Module Dumpsys -----");
+  ConfigCacheLockDataBuilder lock_builder(*builder);
+  lock_builder.add_contended_shared_locks(stats.contended_shared_locks);
+  lock_builder.add_total_shared_wait_time_us(stats.total_shared_wait_time.count());
+  lock_builder.add_max_shared_wait_time_us(stats.max_shared_wait_time.count());
+  lock_builder.add_exclusive_locks(stats.exclusive_locks);
+  lock_builder.add_contended_exclusive_locks(stats.contended_exclusive_locks);
+  lock_builder.add_total_exclusive_wait_time_us(stats.total_exclusive_wait_time.count());
+  lock_builder.add_max_exclusive_wait_time_us(stats.max_exclusive_wait_time.count());
+  lock_builder.add_total_exclusive_hold_time_us(stats.total_exclusive_hold_time.count());
+  lock_builder.add_max_exclusive_hold_time_us(stats.max_exclusive_hold_time.count());
+  auto config_lock = lock_builder.Finish();
+
+  StorageModuleDataBuilder storage_builder(*builder);
+  storage_builder.add_title(title);
+  storage_builder.add_config_lock(config_lock);
+  auto dumpsys_data = storage_builder.Finish();
+  return [dumpsys_data](DumpsysDataBuilder* dumpsys_builder) {
+    dumpsys_builder->add_storage_module_dumpsys_data(dumpsys_data);
+  };
+}
+
 Device StorageModule::GetDeviceByLegacyKey(hci::Address legacy_key_address) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return Device(
       &pimpl_->cache_,
       &pimpl_->memory_only_cache_,
@@ -233,7 +401,7 @@ Device StorageModule::GetDeviceByLegacyKey(hci::Address legacy_key_address) {
 }
 
 Device StorageModule::GetDeviceByClassicMacAddress(hci::Address classic_address) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return Device(
       &pimpl_->cache_,
       &pimpl_->memory_only_cache_,
@@ -242,7 +410,7 @@ Device StorageModule::GetDeviceByClassicMacAddress(hci::Address classic_address)
 }
 
 Device StorageModule::GetDeviceByLeIdentityAddress(hci::Address le_identity_address) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return Device(
       &pimpl_->cache_,
       &pimpl_->memory_only_cache_,
@@ -251,7 +419,7 @@ Device StorageModule::GetDeviceByLeIdentityAddress(hci::Address le_identity_addr
 }
 
 std::vector<Device> StorageModule::GetBondedDevices() {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   auto persistent_sections = pimpl_->cache_.GetPersistentSections();
   std::vector<Device> result;
   result.reserve(persistent_sections.size());
@@ -266,116 +434,121 @@ bool StorageModule::is_config_checksum_pass(int check_bit) {
 }
 
 bool StorageModule::HasSection(const std::string& section) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return pimpl_->cache_.HasSection(section);
 }
 
 bool StorageModule::HasProperty(const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return pimpl_->cache_.HasProperty(section, property);
 }
 
 std::optional<std::string> StorageModule::GetProperty(
     const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return pimpl_->cache_.GetProperty(section, property);
 }
 
 void StorageModule::SetProperty(std::string section, std::string property, std::string value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   pimpl_->cache_.SetProperty(section, property, value);
 }
 
 std::vector<std::string> StorageModule::GetPersistentSections() const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return pimpl_->cache_.GetPersistentSections();
 }
 
+std::vector<std::string> StorageModule::GetPersistentSectionsWithProperty(const std::string& property) const {
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
+  return pimpl_->cache_.GetPersistentSectionsWithProperty(property);
+}
+
 void StorageModule::RemoveSection(const std::string& section) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   pimpl_->cache_.RemoveSection(section);
 }
 
 bool StorageModule::RemoveProperty(const std::string& section, const std::string& property) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return pimpl_->cache_.RemoveProperty(section, property);
 }
 
 void StorageModule::ConvertEncryptOrDecryptKeyIfNeeded() {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   pimpl_->cache_.ConvertEncryptOrDecryptKeyIfNeeded();
 }
 
 void StorageModule::RemoveSectionWithProperty(const std::string& property) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return pimpl_->cache_.RemoveSectionWithProperty(property);
 }
 
 void StorageModule::SetBool(const std::string& section, const std::string& property, bool value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   ConfigCacheHelper::FromConfigCache(pimpl_->cache_).SetBool(section, property, value);
 }
 
 std::optional<bool> StorageModule::GetBool(
     const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return ConfigCacheHelper::FromConfigCache(pimpl_->cache_).GetBool(section, property);
 }
 
 void StorageModule::SetUint64(
     const std::string& section, const std::string& property, uint64_t value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   ConfigCacheHelper::FromConfigCache(pimpl_->cache_).SetUint64(section, property, value);
 }
 
 std::optional<uint64_t> StorageModule::GetUint64(
     const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return ConfigCacheHelper::FromConfigCache(pimpl_->cache_).GetUint64(section, property);
 }
 
 void StorageModule::SetUint32(
     const std::string& section, const std::string& property, uint32_t value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   ConfigCacheHelper::FromConfigCache(pimpl_->cache_).SetUint32(section, property, value);
 }
 
 std::optional<uint32_t> StorageModule::GetUint32(
     const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return ConfigCacheHelper::FromConfigCache(pimpl_->cache_).GetUint32(section, property);
 }
 void StorageModule::SetInt64(
     const std::string& section, const std::string& property, int64_t value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   ConfigCacheHelper::FromConfigCache(pimpl_->cache_).SetInt64(section, property, value);
 }
 std::optional<int64_t> StorageModule::GetInt64(
     const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return ConfigCacheHelper::FromConfigCache(pimpl_->cache_).GetInt64(section, property);
 }
 
 void StorageModule::SetInt(const std::string& section, const std::string& property, int value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   ConfigCacheHelper::FromConfigCache(pimpl_->cache_).SetInt(section, property, value);
 }
 
 std::optional<int> StorageModule::GetInt(
     const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return ConfigCacheHelper::FromConfigCache(pimpl_->cache_).GetInt(section, property);
 }
 
 void StorageModule::SetBin(
     const std::string& section, const std::string& property, const std::vector<uint8_t>& value) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   ConfigCacheHelper::FromConfigCache(pimpl_->cache_).SetBin(section, property, value);
 }
 
 std::optional<std::vector<uint8_t>> StorageModule::GetBin(
     const std::string& section, const std::string& property) const {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(pimpl_mutex_);
   return ConfigCacheHelper::FromConfigCache(pimpl_->cache_).GetBin(section, property);
 }
 
@@ -21,6 +21,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -42,6 +43,7 @@ class SecurityManagerImpl;
 
 namespace hci {
 class AclManager;
+class Controller;
 }
 
 namespace storage {
@@ -118,9 +120,11 @@ class StorageModule : public bluetooth::Module {
   void Start() override;
   void Stop() override;
   std::string ToString() const override;
+  DumpsysDataFinisher GetDumpsysData(flatbuffers::FlatBufferBuilder* builder) const override;  // Module
 
   friend shim::BtifConfigInterface;
   friend hci::AclManager;
+  friend hci::Controller;
   friend security::internal::SecurityManagerImpl;
   // For unit test only
   ConfigCache* GetMemoryOnlyConfigCache();
@@ -129,12 +133,15 @@ class StorageModule : public bluetooth::Module {
   void SaveDelayed();
   // In some cases, one may want to save the config immediately to disk. Call this method with caution as it runs
   // immediately on the calling thread
+  // Changes are appended to the config journal, the config file is only rewritten once the journal grows past the
+  // size of the config
   void SaveImmediately();
   // remove all content in this config cache, restore it to the state after the explicit constructor
   void Clear();
 
   // Create the storage module where:
-  // - config_file_path is the path to the config file on disk, a .bak file will be created with the original
+  // - config_file_path is the path to the config file on disk, a .bak file will be created with the original, and a
+  //   .journal file with the changes made since it was written
   // - config_save_delay is the duration after which to dump config to disk after SaveDelayed() is called
   // - temp_devices_capacity is the number of temporary, typically unpaired devices to hold in a memory based LRU
   // - is_restricted_mode and is_single_user_mode are flags from upper layer
@@ -153,6 +160,8 @@ class StorageModule : public bluetooth::Module {
   void SetProperty(std::string section, std::string property, std::string value);
 
   std::vector<std::string> GetPersistentSections() const;
+  // Persistent sections that have |property| set
+  std::vector<std::string> GetPersistentSectionsWithProperty(const std::string& property) const;
 
   void RemoveSection(const std::string& section);
   bool RemoveProperty(const std::string& section, const std::string& property);
@@ -177,15 +186,22 @@ class StorageModule : public bluetooth::Module {
 
  private:
   struct impl;
+  // Serializes starting, stopping and saving the config
   mutable std::recursive_mutex mutex_;
+  // Guards the lifetime of pimpl_ for the accessors, so that reading the config, which is thread safe on its own,
+  // does not wait for the config to be saved
+  mutable std::shared_mutex pimpl_mutex_;
   std::unique_ptr<impl> pimpl_;
   std::string config_file_path_;
   std::string config_backup_path_;
+  std::string config_journal_path_;
   std::chrono::milliseconds config_save_delay_;
   size_t temp_devices_capacity_;
   bool is_restricted_mode_;
   bool is_single_user_mode_;
   static bool is_config_checksum_pass(int check_bit);
+  // Write the whole config to the config file and its backup, and delete the journal
+  void CompactConfig();
 };
 
 }  // namespace storage
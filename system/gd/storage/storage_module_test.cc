@@ -31,6 +31,7 @@
 #include "os/fake_timer/fake_timerfd.h"
 #include "os/files.h"
 #include "storage/config_cache.h"
+#include "storage/config_journal_file.h"
 #include "storage/config_keys.h"
 #include "storage/device.h"
 #include "storage/legacy_config_file.h"
@@ -41,6 +42,7 @@ using bluetooth::TestModuleRegistry;
 using bluetooth::hci::Address;
 using bluetooth::os::fake_timer::fake_timerfd_advance;
 using bluetooth::storage::ConfigCache;
+using bluetooth::storage::ConfigJournalFile;
 using bluetooth::storage::Device;
 using bluetooth::storage::LegacyConfigFile;
 using bluetooth::storage::StorageModule;
@@ -108,6 +110,7 @@ class StorageModuleTest : public Test {
     temp_dir_ = std::filesystem::temp_directory_path();
     temp_config_ = temp_dir_ / "temp_config.txt";
     temp_backup_config_ = temp_dir_ / "temp_config.bak";
+    temp_journal_ = temp_dir_ / "temp_config.journal";
     DeleteConfigFiles();
     ASSERT_FALSE(std::filesystem::exists(temp_config_));
     ASSERT_FALSE(std::filesystem::exists(temp_backup_config_));
@@ -125,6 +128,18 @@ class StorageModuleTest : public Test {
     if (std::filesystem::exists(temp_backup_config_)) {
       ASSERT_TRUE(std::filesystem::remove(temp_backup_config_));
     }
+    if (std::filesystem::exists(temp_journal_)) {
+      ASSERT_TRUE(std::filesystem::remove(temp_journal_));
+    }
+  }
+
+  // Read the config as saved on disk, the config file followed by the journal
+  std::optional<ConfigCache> ReadSavedConfig() {
+    auto config = LegacyConfigFile::FromPath(temp_config_.string()).Read(kTestTempDevicesCapacity);
+    if (config && !ConfigJournalFile::FromPath(temp_journal_.string()).Replay(&config.value())) {
+      return std::nullopt;
+    }
+    return config;
   }
 
   void FakeTimerAdvance(std::chrono::milliseconds time) {
@@ -147,6 +162,7 @@ class StorageModuleTest : public Test {
   std::filesystem::path temp_dir_;
   std::filesystem::path temp_config_;
   std::filesystem::path temp_backup_config_;
+  std::filesystem::path temp_journal_;
 };
 
 TEST_F(StorageModuleTest, empty_config_no_op_test) {
@@ -238,7 +254,7 @@ TEST_F(StorageModuleTest, save_config_test) {
       Optional(StrEq("foo")));
   ASSERT_TRUE(WaitForReactorIdle(kTestConfigSaveDelay));
 
-  auto config = LegacyConfigFile::FromPath(temp_config_.string()).Read(kTestTempDevicesCapacity);
+  auto config = ReadSavedConfig();
   ASSERT_TRUE(config);
   ASSERT_THAT(
       config->GetProperty("01:02:03:ab:cd:ea", BTIF_STORAGE_KEY_NAME), Optional(StrEq("foo")));
@@ -247,7 +263,7 @@ TEST_F(StorageModuleTest, save_config_test) {
   storage->RemovePropertyPublic("01:02:03:ab:cd:ea", BTIF_STORAGE_KEY_NAME);
   ASSERT_TRUE(WaitForReactorIdle(kTestConfigSaveDelay));
   LOG_INFO("After waiting 2");
-  config = LegacyConfigFile::FromPath(temp_config_.string()).Read(kTestTempDevicesCapacity);
+  config = ReadSavedConfig();
   ASSERT_TRUE(config);
   ASSERT_FALSE(config->HasProperty("01:02:03:ab:cd:ea", BTIF_STORAGE_KEY_NAME));
 
@@ -255,7 +271,7 @@ TEST_F(StorageModuleTest, save_config_test) {
   storage->RemoveSectionPublic("01:02:03:ab:cd:ea");
   ASSERT_TRUE(WaitForReactorIdle(kTestConfigSaveDelay));
   LOG_INFO("After waiting 3");
-  config = LegacyConfigFile::FromPath(temp_config_.string()).Read(kTestTempDevicesCapacity);
+  config = ReadSavedConfig();
   ASSERT_TRUE(config);
   ASSERT_FALSE(config->HasSection("01:02:03:ab:cd:ea"));
 
@@ -266,6 +282,53 @@ TEST_F(StorageModuleTest, save_config_test) {
   ASSERT_TRUE(std::filesystem::exists(temp_config_));
 }
 
+TEST_F(StorageModuleTest, changes_are_journaled_test) {
+  ASSERT_TRUE(bluetooth::os::WriteToFile(temp_config_.string(), kReadTestConfig));
+
+  auto* storage = new TestStorageModule(temp_config_.string(), kTestConfigSaveDelay, false, false);
+  test_registry_.InjectTestModule(&StorageModule::Factory, storage);
+
+  storage->SetPropertyPublic("01:02:03:ab:cd:ea", BTIF_STORAGE_KEY_NAME, "foo");
+  storage->SetPropertyPublic("01:02:03:ab:cd:eb", BTIF_STORAGE_KEY_LINK_KEY, "fedcba0987654321fedcba0987654329");
+  storage->RemoveSectionPublic("Metrics");
+  ASSERT_TRUE(WaitForReactorIdle(kTestConfigSaveDelay));
+
+  // Only the journal was written
+  auto config_file = bluetooth::os::ReadSmallFile(temp_config_.string());
+  ASSERT_TRUE(config_file);
+  ASSERT_EQ(*config_file, kReadTestConfig);
+  ASSERT_TRUE(std::filesystem::exists(temp_journal_));
+
+  auto config = ReadSavedConfig();
+  ASSERT_TRUE(config);
+  ASSERT_THAT(config->GetProperty("01:02:03:ab:cd:ea", BTIF_STORAGE_KEY_NAME), Optional(StrEq("foo")));
+  ASSERT_THAT(config->GetPersistentSections(), ElementsAre("01:02:03:ab:cd:ea", "01:02:03:ab:cd:eb"));
+  ASSERT_FALSE(config->HasSection("Metrics"));
+
+  // Stopping writes the config file back
+  test_registry_.StopAll();
+  ASSERT_FALSE(std::filesystem::exists(temp_journal_));
+  auto config_read = LegacyConfigFile::FromPath(temp_config_.string()).Read(kTestTempDevicesCapacity);
+  ASSERT_TRUE(config_read);
+  ASSERT_EQ(*config, *config_read);
+}
+
+TEST_F(StorageModuleTest, journal_is_replayed_test) {
+  ASSERT_TRUE(bluetooth::os::WriteToFile(temp_config_.string(), kReadTestConfig));
+  auto config = LegacyConfigFile::FromPath(temp_config_.string()).Read(kTestTempDevicesCapacity);
+  ASSERT_TRUE(config);
+  bool cleared = false;
+  config->TakeChangedPersistentSections(&cleared);
+  config->SetProperty("01:02:03:ab:cd:ea", BTIF_STORAGE_KEY_NAME, "foo");
+  ASSERT_TRUE(ConfigJournalFile::FromPath(temp_journal_.string())
+                  .Append(*config, config->TakeChangedPersistentSections(&cleared), cleared));
+
+  auto* storage = new TestStorageModule(temp_config_.string(), kTestConfigSaveDelay, false, false);
+  test_registry_.InjectTestModule(&StorageModule::Factory, storage);
+  ASSERT_THAT(storage->GetPropertyPublic("01:02:03:ab:cd:ea", BTIF_STORAGE_KEY_NAME), Optional(StrEq("foo")));
+  test_registry_.StopAll();
+}
+
 TEST_F(StorageModuleTest, get_bonded_devices_test) {
   // Prepare config file
   ASSERT_TRUE(bluetooth::os::WriteToFile(temp_config_.string(), kReadTestConfig));
@@ -336,4 +399,48 @@ TEST_F(StorageModuleTest, no_config_causes_a_write) {
   ASSERT_TRUE(std::filesystem::exists(temp_config_));
 }
 
+static const std::string kWarmRestartProperty = "bluetooth.storage.warm_restart.enabled";
+
+TEST_F(StorageModuleTest, warm_restart_reuses_the_config) {
+  ASSERT_TRUE(bluetooth::os::SetSystemProperty(kWarmRestartProperty, "true"));
+  ASSERT_TRUE(bluetooth::os::WriteToFile(temp_config_.string(), kReadTestConfig));
+
+  auto* storage = new TestStorageModule(temp_config_.string(), kTestConfigSaveDelay, false, false);
+  test_registry_.InjectTestModule(&StorageModule::Factory, storage);
+  // Not persisted, only kept if the config is reused
+  storage->SetPropertyPublic("01:02:03:ab:cd:eb", BTIF_STORAGE_KEY_NAME, "temporary");
+  test_registry_.StopAll();
+
+  storage = new TestStorageModule(temp_config_.string(), kTestConfigSaveDelay, false, false);
+  test_registry_.InjectTestModule(&StorageModule::Factory, storage);
+  ASSERT_TRUE(storage->HasSectionPublic("01:02:03:ab:cd:eb"));
+  ASSERT_THAT(storage->GetPersistentSectionsPublic(), ElementsAre("01:02:03:ab:cd:ea"));
+  test_registry_.StopAll();
+
+  ASSERT_TRUE(bluetooth::os::SetSystemProperty(kWarmRestartProperty, "false"));
+}
+
+TEST_F(StorageModuleTest, warm_restart_reads_a_changed_config) {
+  ASSERT_TRUE(bluetooth::os::SetSystemProperty(kWarmRestartProperty, "true"));
+  ASSERT_TRUE(bluetooth::os::WriteToFile(temp_config_.string(), kReadTestConfig));
+
+  auto* storage = new TestStorageModule(temp_config_.string(), kTestConfigSaveDelay, false, false);
+  test_registry_.InjectTestModule(&StorageModule::Factory, storage);
+  storage->SetPropertyPublic("01:02:03:ab:cd:eb", BTIF_STORAGE_KEY_NAME, "temporary");
+  test_registry_.StopAll();
+
+  // The config file is changed while the stack is stopped
+  std::string changed_config = kReadTestConfig + "[01:02:03:ab:cd:ec]\nLinkKey = fedcba0987654321fedcba0987654329\n\n";
+  ASSERT_TRUE(bluetooth::os::WriteToFile(temp_config_.string(), changed_config));
+
+  storage = new TestStorageModule(temp_config_.string(), kTestConfigSaveDelay, false, false);
+  test_registry_.InjectTestModule(&StorageModule::Factory, storage);
+  ASSERT_FALSE(storage->HasSectionPublic("01:02:03:ab:cd:eb"));
+  ASSERT_THAT(
+      storage->GetPersistentSectionsPublic(), UnorderedElementsAre("01:02:03:ab:cd:ea", "01:02:03:ab:cd:ec"));
+  test_registry_.StopAll();
+
+  ASSERT_TRUE(bluetooth::os::SetSystemProperty(kWarmRestartProperty, "false"));
+}
+
 }  // namespace testing
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include <raw_address.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -92,6 +93,36 @@ class ScanningCallbacks {
                             int8_t tx_power, int8_t rssi,
                             uint16_t periodic_adv_int,
                             std::vector<uint8_t> adv_data) = 0;
+  /* Scan results collected over a short window, when
+   * bluetooth.core.le.scan_result_batch_window_ms is set. |records| holds
+   * |num_records| records, each one made of event_type (2 bytes), addr_type
+   * (1), bda (6), primary_phy (1), secondary_phy (1), advertising_sid (1),
+   * tx_power (1), rssi (1), periodic_adv_int (2), the adv_data length (2) and
+   * adv_data. Multi-byte fields are little endian. By default each record is
+   * delivered through OnScanResult. */
+  virtual void OnScanResults(std::vector<uint8_t> records, int num_records) {
+    const uint8_t* p = records.data();
+    const uint8_t* end = p + records.size();
+    for (int i = 0; i < num_records && end - p >= 18; i++) {
+      uint16_t event_type = p[0] | (p[1] << 8);
+      uint8_t addr_type = p[2];
+      RawAddress bda;
+      std::copy(p + 3, p + 9, bda.address);
+      uint8_t primary_phy = p[9];
+      uint8_t secondary_phy = p[10];
+      uint8_t advertising_sid = p[11];
+      int8_t tx_power = static_cast<int8_t>(p[12]);
+      int8_t rssi = static_cast<int8_t>(p[13]);
+      uint16_t periodic_adv_int = p[14] | (p[15] << 8);
+      uint16_t adv_data_len = p[16] | (p[17] << 8);
+      p += 18;
+      if (end - p < adv_data_len) break;
+      OnScanResult(event_type, addr_type, bda, primary_phy, secondary_phy,
+                   advertising_sid, tx_power, rssi, periodic_adv_int,
+                   std::vector<uint8_t>(p, p + adv_data_len));
+      p += adv_data_len;
+    }
+  }
   virtual void OnTrackAdvFoundLost(
       AdvertisingTrackInfo advertising_track_info) = 0;
   virtual void OnBatchScanReports(int client_if, int status, int report_format,
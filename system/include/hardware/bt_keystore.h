@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "string"
 
 namespace bluetooth {
@@ -31,6 +34,23 @@ class BluetoothKeystoreCallbacks {
 
   /** Callback for get key. */
   virtual std::string get_key(std::string prefix) = 0;
+
+  /** Callback for key encrypt or remove key of several keys at once. */
+  virtual void set_encrypt_keys_or_remove_keys(
+      std::vector<std::pair<std::string, std::string>> keys) {
+    for (auto& [prefix, decryptedString] : keys) {
+      set_encrypt_key_or_remove_key(prefix, decryptedString);
+    }
+  }
+
+  /** Callback for get several keys at once, in the order of |prefixes|. */
+  virtual std::vector<std::string> get_keys(std::vector<std::string> prefixes) {
+    std::vector<std::string> keys;
+    for (auto& prefix : prefixes) {
+      keys.push_back(get_key(prefix));
+    }
+    return keys;
+  }
 };
 
 class BluetoothKeystoreInterface {
@@ -50,6 +70,14 @@ class BluetoothKeystoreInterface {
   /** Interface for get key. */
   virtual std::string get_key(std::string prefix) = 0;
 
+  /** Interface for key encrypt or remove key of several keys at once. */
+  virtual bool set_encrypt_keys_or_remove_keys(
+      std::vector<std::pair<std::string, std::string>> keys) = 0;
+
+  /** Interface for get several keys at once, in the order of |prefixes|. */
+  virtual std::vector<std::string> get_keys(
+      std::vector<std::string> prefixes) = 0;
+
   /** Interface for clear map. */
   virtual void clear_map() = 0;
 };
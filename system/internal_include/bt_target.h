@@ -589,6 +589,12 @@
 #define PORT_RX_BUF_CRITICAL_WM 15
 #endif
 
+/* The most credits granted to a port delivering its data to a socket, which
+ * grow from the credits of the high watermark while the socket keeps up. */
+#ifndef PORT_RX_BUF_CREDIT_MAX_WM
+#define PORT_RX_BUF_CREDIT_MAX_WM 30
+#endif
+
 /* The port transmit queue high watermark level, in bytes. */
 #ifndef PORT_TX_HIGH_WM
 #define PORT_TX_HIGH_WM (BTA_RFC_MTU_SIZE * PORT_TX_BUF_HIGH_WM)
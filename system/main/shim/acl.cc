@@ -18,10 +18,14 @@
 
 #include <base/location.h>
 #include <base/strings/stringprintf.h>
+#include <inttypes.h>
 #include <time.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <future>
 #include <map>
@@ -50,6 +54,7 @@
 #include "main/shim/entry.h"
 #include "main/shim/helpers.h"
 #include "main/shim/stack.h"
+#include "os/alarm.h"
 #include "os/handler.h"
 #include "osi/include/allocator.h"
 #include "stack/acl/acl.h"
@@ -132,6 +137,27 @@ constexpr char kBtmLogTag[] = "ACL";
 
 using SendDataUpwards = void (*const)(BT_HDR*);
 using OnDisconnect = std::function<void(HciHandle, hci::ErrorCode reason)>;
+using OnRemoteInfoRead = std::function<void(HciHandle)>;
+
+// Classic links read the remote version and features as soon as they are
+// connected. When many links come up together these reads are admitted a few
+// links at a time, so that the first links become usable quickly instead of
+// all of them competing for the controller command credits.
+constexpr size_t kMaxRemoteInfoReadsInFlight = 3;
+// A link that did not complete its reads in that time gives up its slot
+constexpr std::chrono::milliseconds kRemoteInfoReadTimeout =
+    std::chrono::seconds(5);
+// Upper bounds of the time to usable link histogram buckets, the last bucket
+// holds the longer times
+constexpr std::array<std::chrono::milliseconds, 6> kTimeToUsableLinkBuckets = {
+    std::chrono::milliseconds(100),  std::chrono::milliseconds(250),
+    std::chrono::milliseconds(500),  std::chrono::milliseconds(1000),
+    std::chrono::milliseconds(2500), std::chrono::milliseconds(5000),
+};
+// Major device class of audio and video devices
+constexpr uint32_t kMajorClassAudioVideo = 0x04;
+// Audio and telephony service classes
+constexpr uint32_t kServiceClassAudioTelephony = 0x600000;
 
 constexpr char kConnectionDescriptorTimeFormat[] = "%Y-%m-%d %H:%M:%S";
 
@@ -415,12 +441,10 @@ class ShimAclConnection {
   void data_ready_callback() {
     auto packet = queue_up_end_->TryDequeue();
     uint16_t length = packet->size();
-    std::vector<uint8_t> preamble;
-    preamble.push_back(LowByte(handle_));
-    preamble.push_back(HighByte(handle_));
-    preamble.push_back(LowByte(length));
-    preamble.push_back(HighByte(length));
-    BT_HDR* p_buf = MakeLegacyBtHdrPacket(std::move(packet), preamble);
+    const uint8_t preamble[] = {LowByte(handle_), HighByte(handle_),
+                                LowByte(length), HighByte(length)};
+    BT_HDR* p_buf =
+        MakeLegacyBtHdrPacket(std::move(packet), preamble, sizeof(preamble));
     ASSERT_LOG(p_buf != nullptr,
                "Unable to allocate BT_HDR legacy packet handle:%04x", handle_);
     if (send_data_upwards_ == nullptr) {
@@ -504,6 +528,7 @@ class ClassicShimAclConnection
  public:
   ClassicShimAclConnection(
       SendDataUpwards send_data_upwards, OnDisconnect on_disconnect,
+      OnRemoteInfoRead on_remote_info_read,
       const shim::legacy::acl_classic_link_interface_t& interface,
       os::Handler* handler,
       std::unique_ptr<hci::acl_manager::ClassicAclConnection> connection,
@@ -511,6 +536,7 @@ class ClassicShimAclConnection
       : ShimAclConnection(connection->GetHandle(), send_data_upwards, handler,
                           connection->GetAclQueueEnd(), creation_time),
         on_disconnect_(on_disconnect),
+        on_remote_info_read_(on_remote_info_read),
         interface_(interface),
         connection_(std::move(connection)) {}
 
@@ -656,6 +682,8 @@ class ClassicShimAclConnection
     TRY_POSTING_ON_MAIN(interface_.on_read_remote_version_information_complete,
                         ToLegacyHciErrorCode(hci_status), handle_, lmp_version,
                         manufacturer_name, sub_version);
+    remote_version_read_ = true;
+    MaybeReportRemoteInfoRead();
   }
 
   void OnReadRemoteSupportedFeaturesComplete(uint64_t features) override {
@@ -667,6 +695,8 @@ class ClassicShimAclConnection
       return;
     }
     LOG_DEBUG("Device does not support extended features");
+    remote_features_read_ = true;
+    MaybeReportRemoteInfoRead();
   }
 
   void OnReadRemoteExtendedFeaturesComplete(uint8_t page_number,
@@ -678,11 +708,17 @@ class ClassicShimAclConnection
     // Supported features aliases to extended features page 0
     if (page_number == 0 && !(features & ((uint64_t(1) << 63)))) {
       LOG_DEBUG("Device does not support extended features");
+      remote_features_read_ = true;
+      MaybeReportRemoteInfoRead();
       return;
     }
 
-    if (max_page_number != 0 && page_number != max_page_number)
+    if (max_page_number != 0 && page_number != max_page_number) {
       connection_->ReadRemoteExtendedFeatures(page_number + 1);
+      return;
+    }
+    remote_features_read_ = true;
+    MaybeReportRemoteInfoRead();
   }
 
   hci::Address GetRemoteAddress() const { return connection_->GetAddress(); }
@@ -719,8 +755,22 @@ class ClassicShimAclConnection
 
  private:
   OnDisconnect on_disconnect_;
+  OnRemoteInfoRead on_remote_info_read_;
   const shim::legacy::acl_classic_link_interface_t interface_;
   std::unique_ptr<hci::acl_manager::ClassicAclConnection> connection_;
+
+  bool remote_version_read_{false};
+  bool remote_features_read_{false};
+  bool remote_info_read_reported_{false};
+
+  void MaybeReportRemoteInfoRead() {
+    if (!remote_version_read_ || !remote_features_read_ ||
+        remote_info_read_reported_) {
+      return;
+    }
+    remote_info_read_reported_ = true;
+    on_remote_info_read_(handle_);
+  }
 };
 
 class LeShimAclConnection
@@ -854,10 +904,12 @@ class LeShimAclConnection
 };
 
 struct shim::legacy::Acl::impl {
-  impl(uint8_t max_acceptlist_size, uint8_t max_address_resolution_size)
+  impl(os::Handler* handler, uint8_t max_acceptlist_size,
+       uint8_t max_address_resolution_size)
       : shadow_acceptlist_(ShadowAcceptlist(max_acceptlist_size)),
         shadow_address_resolution_list_(
-            ShadowAddressResolutionList(max_address_resolution_size)) {}
+            ShadowAddressResolutionList(max_address_resolution_size)),
+        remote_info_read_timer_(std::make_unique<os::Alarm>(handler)) {}
 
   std::map<HciHandle, std::unique_ptr<ClassicShimAclConnection>>
       handle_to_classic_connection_map_;
@@ -873,6 +925,116 @@ struct shim::legacy::Acl::impl {
   ShadowAcceptlist shadow_acceptlist_;
   ShadowAddressResolutionList shadow_address_resolution_list_;
 
+  // Remote information reads, see kMaxRemoteInfoReadsInFlight
+  std::map<hci::Address, hci::ClassOfDevice> connect_request_class_of_device_;
+  std::deque<HciHandle> pending_urgent_remote_info_reads_;
+  std::deque<HciHandle> pending_remote_info_reads_;
+  std::map<HciHandle, std::chrono::steady_clock::time_point>
+      remote_info_reads_in_flight_;
+  std::unique_ptr<os::Alarm> remote_info_read_timer_;
+  bool remote_info_read_timer_scheduled_{false};
+  size_t remote_info_reads_deferred_{0};
+  size_t remote_info_reads_timed_out_{0};
+  std::array<size_t, kTimeToUsableLinkBuckets.size() + 1>
+      time_to_usable_link_histogram_{};
+
+  // Links that carry audio, or were initiated locally, have their remote
+  // information read first.
+  bool IsUrgentRemoteInfoRead(const hci::Address& address,
+                              bool locally_initiated) {
+    if (locally_initiated) return true;
+    auto it = connect_request_class_of_device_.find(address);
+    if (it == connect_request_class_of_device_.end()) return false;
+    uint32_t cod = it->second.ToUint32Legacy();
+    return ((cod >> 8) & 0x1f) == kMajorClassAudioVideo ||
+           (cod & kServiceClassAudioTelephony) != 0;
+  }
+
+  void ScheduleRemoteInfoRead(HciHandle handle, bool urgent) {
+    if (remote_info_reads_in_flight_.size() >= kMaxRemoteInfoReadsInFlight) {
+      remote_info_reads_deferred_++;
+      LOG_DEBUG("Deferring remote information read handle:%hu urgent:%s",
+                handle, urgent ? "true" : "false");
+    }
+    if (urgent) {
+      pending_urgent_remote_info_reads_.push_back(handle);
+    } else {
+      pending_remote_info_reads_.push_back(handle);
+    }
+    StartRemoteInfoReads();
+  }
+
+  void StartRemoteInfoReads() {
+    while (remote_info_reads_in_flight_.size() < kMaxRemoteInfoReadsInFlight) {
+      std::deque<HciHandle>& pending = !pending_urgent_remote_info_reads_.empty()
+                                           ? pending_urgent_remote_info_reads_
+                                           : pending_remote_info_reads_;
+      if (pending.empty()) break;
+      HciHandle handle = pending.front();
+      pending.pop_front();
+
+      auto connection = handle_to_classic_connection_map_.find(handle);
+      if (connection == handle_to_classic_connection_map_.end()) continue;
+      remote_info_reads_in_flight_[handle] = std::chrono::steady_clock::now();
+      connection->second->ReadRemoteControllerInformation();
+    }
+
+    if (!remote_info_reads_in_flight_.empty() &&
+        !remote_info_read_timer_scheduled_) {
+      remote_info_read_timer_scheduled_ = true;
+      remote_info_read_timer_->Schedule(
+          common::BindOnce(&impl::OnRemoteInfoReadTimeout,
+                           common::Unretained(this)),
+          kRemoteInfoReadTimeout);
+    }
+  }
+
+  void OnRemoteInfoRead(HciHandle handle) {
+    if (remote_info_reads_in_flight_.erase(handle) == 0) return;
+
+    auto connection = handle_to_classic_connection_map_.find(handle);
+    if (connection != handle_to_classic_connection_map_.end()) {
+      auto time_to_usable_link =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::system_clock::now() -
+              connection->second->GetCreationTime());
+      size_t bucket = 0;
+      while (bucket < kTimeToUsableLinkBuckets.size() &&
+             time_to_usable_link > kTimeToUsableLinkBuckets[bucket]) {
+        bucket++;
+      }
+      time_to_usable_link_histogram_[bucket]++;
+    }
+    StartRemoteInfoReads();
+  }
+
+  void CancelRemoteInfoRead(HciHandle handle) {
+    for (auto* pending :
+         {&pending_urgent_remote_info_reads_, &pending_remote_info_reads_}) {
+      pending->erase(std::remove(pending->begin(), pending->end(), handle),
+                     pending->end());
+    }
+    if (remote_info_reads_in_flight_.erase(handle) != 0) {
+      StartRemoteInfoReads();
+    }
+  }
+
+  void OnRemoteInfoReadTimeout() {
+    remote_info_read_timer_scheduled_ = false;
+    auto now = std::chrono::steady_clock::now();
+    for (auto it = remote_info_reads_in_flight_.begin();
+         it != remote_info_reads_in_flight_.end();) {
+      if (now - it->second >= kRemoteInfoReadTimeout) {
+        LOG_WARN("Remote information read timed out handle:%hu", it->first);
+        remote_info_reads_timed_out_++;
+        it = remote_info_reads_in_flight_.erase(it);
+      } else {
+        it++;
+      }
+    }
+    StartRemoteInfoReads();
+  }
+
   bool IsClassicAcl(HciHandle handle) {
     return handle_to_classic_connection_map_.find(handle) !=
            handle_to_classic_connection_map_.end();
@@ -1189,6 +1351,24 @@ struct shim::legacy::Acl::impl {
       }
     }
 
+    LOG_DUMPSYS(fd,
+                "Remote information reads in_flight:%zu pending:%zu "
+                "deferred:%zu timed_out:%zu",
+                remote_info_reads_in_flight_.size(),
+                pending_urgent_remote_info_reads_.size() +
+                    pending_remote_info_reads_.size(),
+                remote_info_reads_deferred_, remote_info_reads_timed_out_);
+    std::string histogram;
+    for (size_t i = 0; i < kTimeToUsableLinkBuckets.size(); i++) {
+      histogram += base::StringPrintf(
+          " <=%lldms:%zu", (long long)kTimeToUsableLinkBuckets[i].count(),
+          time_to_usable_link_histogram_[i]);
+    }
+    histogram += base::StringPrintf(
+        " >%lldms:%zu", (long long)kTimeToUsableLinkBuckets.back().count(),
+        time_to_usable_link_histogram_.back());
+    LOG_DUMPSYS(fd, "Classic time to usable link%s", histogram.c_str());
+
     auto acceptlist = shadow_acceptlist_.GetCopy();
     LOG_DUMPSYS(fd,
                 "Shadow le accept list              size:%-3zu "
@@ -1221,6 +1401,12 @@ void DumpsysL2cap(int fd) {
     if (!lcb.in_use) continue;
     LOG_DUMPSYS(fd, "link_state:%s", link_state_text(lcb.link_state).c_str());
     LOG_DUMPSYS(fd, "handle:0x%04x", lcb.Handle());
+    if (lcb.traffic_conn_params.fast_count != 0) {
+      LOG_DUMPSYS(fd, "traffic conn params fast:%s to_fast:%u to_relaxed:%u",
+                  common::ToString(lcb.traffic_conn_params.fast).c_str(),
+                  lcb.traffic_conn_params.fast_count,
+                  lcb.traffic_conn_params.relaxed_count);
+    }
 
     const tL2C_CCB* ccb = lcb.ccb_queue.p_first_ccb;
     while (ccb != nullptr) {
@@ -1228,6 +1414,18 @@ void DumpsysL2cap(int fd) {
           fd, "  active channel lcid:0x%04x rcid:0x%04x is_ecoc:%s in_use:%s",
           ccb->local_cid, ccb->remote_cid, common::ToString(ccb->ecoc).c_str(),
           common::ToString(ccb->in_use).c_str());
+      LOG_DUMPSYS(fd, "    tx bytes:%u packets:%u rx bytes:%u packets:%u",
+                  ccb->metrics.tx.bytes, ccb->metrics.tx.packets,
+                  ccb->metrics.rx.bytes, ccb->metrics.rx.packets);
+      if (ccb->credit_starvation.count != 0) {
+        LOG_DUMPSYS(fd,
+                    "    credit starvation count:%u total_ms:%" PRIu64
+                    " ongoing:%s",
+                    ccb->credit_starvation.count,
+                    ccb->credit_starvation.total_ms,
+                    common::ToString(ccb->credit_starvation.since_ms != 0)
+                        .c_str());
+      }
       ccb = ccb->p_next_ccb;
     }
   }
@@ -1383,7 +1581,7 @@ shim::legacy::Acl::Acl(os::Handler* handler,
     : handler_(handler), acl_interface_(acl_interface) {
   ASSERT(handler_ != nullptr);
   ValidateAclInterface(acl_interface_);
-  pimpl_ = std::make_unique<Acl::impl>(max_acceptlist_size,
+  pimpl_ = std::make_unique<Acl::impl>(handler_, max_acceptlist_size,
                                        max_address_resolution_size);
   GetAclManager()->RegisterCallbacks(this, handler_);
   GetAclManager()->RegisterLeCallbacks(this, handler_);
@@ -1503,6 +1701,7 @@ void shim::legacy::Acl::OnClassicLinkDisconnected(HciHandle handle,
   TeardownTime teardown_time = std::chrono::system_clock::now();
 
   pimpl_->handle_to_classic_connection_map_.erase(handle);
+  pimpl_->CancelRemoteInfoRead(handle);
   TRY_POSTING_ON_MAIN(acl_interface_.connection.classic.on_disconnected,
                       ToLegacyHciErrorCode(hci::ErrorCode::SUCCESS), handle,
                       ToLegacyHciErrorCode(reason));
@@ -1605,11 +1804,14 @@ void shim::legacy::Acl::OnConnectSuccess(
                   acl_interface_.on_send_data_upwards,
                   std::bind(&shim::legacy::Acl::OnClassicLinkDisconnected, this,
                             std::placeholders::_1, std::placeholders::_2),
+                  std::bind(&shim::legacy::Acl::impl::OnRemoteInfoRead,
+                            pimpl_.get(), std::placeholders::_1),
                   acl_interface_.link.classic, handler_, std::move(connection),
                   std::chrono::system_clock::now()));
   pimpl_->handle_to_classic_connection_map_[handle]->RegisterCallbacks();
-  pimpl_->handle_to_classic_connection_map_[handle]
-      ->ReadRemoteControllerInformation();
+  pimpl_->ScheduleRemoteInfoRead(
+      handle, pimpl_->IsUrgentRemoteInfoRead(remote_address, locally_initiated));
+  pimpl_->connect_request_class_of_device_.erase(remote_address);
 
   TRY_POSTING_ON_MAIN(acl_interface_.connection.classic.on_connected, bd_addr,
                       handle, false, locally_initiated);
@@ -1625,6 +1827,7 @@ void shim::legacy::Acl::OnConnectSuccess(
 void shim::legacy::Acl::OnConnectRequest(hci::Address address,
                                          hci::ClassOfDevice cod) {
   const RawAddress bd_addr = ToRawAddress(address);
+  pimpl_->connect_request_class_of_device_[address] = cod;
 
   TRY_POSTING_ON_MAIN(acl_interface_.connection.classic.on_connect_request,
                       bd_addr, cod);
@@ -1637,6 +1840,7 @@ void shim::legacy::Acl::OnConnectFail(hci::Address address,
                                       hci::ErrorCode reason,
                                       bool locally_initiated) {
   const RawAddress bd_addr = ToRawAddress(address);
+  pimpl_->connect_request_class_of_device_.erase(address);
   TRY_POSTING_ON_MAIN(acl_interface_.connection.classic.on_failed, bd_addr,
                       ToLegacyHciErrorCode(reason), locally_initiated);
   LOG_WARN("Connection failed classic remote:%s reason:%s",
@@ -42,6 +42,15 @@ void bluetooth::shim::ACL_CreateClassicConnection(
   Stack::GetInstance()->GetAcl()->CreateClassicConnection(address);
 }
 
+void bluetooth::shim::ACL_SetClassicPageParameters(
+    const RawAddress& raw_address, uint8_t page_scan_rep_mode,
+    uint16_t clock_offset) {
+  bluetooth::shim::GetAclManager()->SetClassicPageParameters(
+      ToGdAddress(raw_address),
+      hci::PageScanRepetitionMode(page_scan_rep_mode),
+      clock_offset & (~BTM_CLOCK_OFFSET_VALID));
+}
+
 void bluetooth::shim::ACL_CancelClassicConnection(
     const RawAddress& raw_address) {
   auto address = ToGdAddress(raw_address);
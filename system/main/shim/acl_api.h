@@ -28,6 +28,9 @@ namespace bluetooth {
 namespace shim {
 
 void ACL_CreateClassicConnection(const RawAddress& raw_address);
+void ACL_SetClassicPageParameters(const RawAddress& raw_address,
+                                  uint8_t page_scan_rep_mode,
+                                  uint16_t clock_offset);
 void ACL_CancelClassicConnection(const RawAddress& raw_address);
 bool ACL_AcceptLeConnectionFrom(const tBLE_BD_ADDR& legacy_address_with_type,
                                 bool is_direct);
@@ -19,12 +19,17 @@
  */
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <vector>
 
 #include "hci/le_scanning_callback.h"
 #include "include/hardware/ble_scanner.h"
+#include "os/alarm.h"
+#include "stack/include/bt_dev_class.h"
 #include "types/ble_address_with_type.h"
 #include "types/bluetooth/uuid.h"
 #include "types/raw_address.h"
@@ -145,8 +150,29 @@ class BleScannerInterfaceImpl : public ::BleScannerInterface,
       bluetooth::hci::AdvertisingPacketContentFilterCommand&
           advertising_packet_content_filter_command,
       ApcfCommand apcf_command);
+
+  // Device properties found in an advertisement, parsed on the scanning
+  // thread so that the advertising data is not posted along with them
+  struct RemoteProperties {
+    bluetooth::hci::DeviceType device_type;
+    bool has_name;
+    bool invalid_name;
+    bt_bdname_t name;
+    DEV_CLASS dev_class;
+  };
+  static RemoteProperties parse_remote_properties(
+      const std::vector<uint8_t>& advertising_data);
   void handle_remote_properties(RawAddress bd_addr, tBLE_ADDR_TYPE addr_type,
-                                std::vector<uint8_t> advertising_data);
+                                RemoteProperties properties);
+  void flush_scan_result_batch();
+
+  // Scan results waiting to be delivered together through
+  // ScanningCallbacks::OnScanResults, see scan_result_batch_window_.
+  std::chrono::milliseconds scan_result_batch_window_{0};
+  std::unique_ptr<os::Alarm> scan_result_batch_alarm_;
+  std::mutex scan_result_batch_mutex_;
+  std::vector<uint8_t> scan_result_batch_;
+  int scan_result_batch_size_ = 0;
 
   class AddressCache {
    public:
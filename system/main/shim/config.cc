@@ -150,6 +150,11 @@ std::vector<std::string> BtifConfigInterface::GetPersistentDevices() {
   return GetStorage()->GetPersistentSections();
 }
 
+std::vector<std::string> BtifConfigInterface::GetPersistentDevicesWithProperty(
+    const std::string& property) {
+  return GetStorage()->GetPersistentSectionsWithProperty(property);
+}
+
 void BtifConfigInterface::ConvertEncryptOrDecryptKeyIfNeeded() {
   GetStorage()->ConvertEncryptOrDecryptKeyIfNeeded();
 }
@@ -54,6 +54,8 @@ class BtifConfigInterface {
                              const std::string& key);
   static void RemoveSection(const std::string& section);
   static std::vector<std::string> GetPersistentDevices();
+  static std::vector<std::string> GetPersistentDevicesWithProperty(
+      const std::string& property);
   static void ConvertEncryptOrDecryptKeyIfNeeded();
   static void Clear();
 };
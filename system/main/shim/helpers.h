@@ -108,10 +108,9 @@ inline tBLE_BD_ADDR ToLegacyAddressWithType(
 
 inline std::unique_ptr<bluetooth::packet::RawBuilder> MakeUniquePacket(
     const uint8_t* data, size_t len, bool is_flushable) {
-  bluetooth::packet::RawBuilder builder;
-  std::vector<uint8_t> bytes(data, data + len);
-  auto payload = std::make_unique<bluetooth::packet::RawBuilder>();
-  payload->AddOctets(bytes);
+  // Move the single copy of the payload into the builder
+  auto payload = std::make_unique<bluetooth::packet::RawBuilder>(
+      std::vector<uint8_t>(data, data + len));
   payload->SetFlushable(is_flushable);
   return payload;
 }
@@ -119,14 +118,18 @@ inline std::unique_ptr<bluetooth::packet::RawBuilder> MakeUniquePacket(
 inline BT_HDR* MakeLegacyBtHdrPacket(
     std::unique_ptr<bluetooth::hci::PacketView<bluetooth::hci::kLittleEndian>>
         packet,
-    const std::vector<uint8_t>& preamble) {
-  std::vector<uint8_t> packet_vector(packet->begin(), packet->end());
+    const uint8_t* preamble, size_t preamble_size) {
+  // The payload is copied fragment by fragment straight into the BT_HDR, and
+  // only the header is cleared since every payload byte is written.
+  const size_t packet_size = packet->size();
   BT_HDR* buffer = static_cast<BT_HDR*>(
-      osi_calloc(packet_vector.size() + preamble.size() + sizeof(BT_HDR)));
-  std::copy(preamble.begin(), preamble.end(), buffer->data);
-  std::copy(packet_vector.begin(), packet_vector.end(),
-            buffer->data + preamble.size());
-  buffer->len = preamble.size() + packet_vector.size();
+      osi_malloc(packet_size + preamble_size + sizeof(BT_HDR)));
+  buffer->event = 0;
+  buffer->offset = 0;
+  buffer->layer_specific = 0;
+  std::copy(preamble, preamble + preamble_size, buffer->data);
+  packet->CopyTo(buffer->data + preamble_size);
+  buffer->len = preamble_size + packet_size;
   return buffer;
 }
 
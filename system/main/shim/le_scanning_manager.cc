@@ -26,6 +26,7 @@
 
 #include "advertise_data_parser.h"
 #include "btif/include/btif_common.h"
+#include "common/bind.h"
 #include "hci/address.h"
 #include "hci/le_scanning_manager.h"
 #include "hci/msft.h"
@@ -36,6 +37,7 @@
 #include "main/shim/le_scanning_manager.h"
 #include "main/shim/shim.h"
 #include "os/log.h"
+#include "os/system_properties.h"
 #include "stack/btm/btm_int_types.h"
 #include "stack/include/bt_dev_class.h"
 #include "stack/include/btm_log_history.h"
@@ -61,6 +63,12 @@ constexpr uint8_t kFilterLogicAnd = 0x01;
 constexpr uint8_t kLowestRssiValue = 129;
 constexpr uint16_t kAllowAllFilter = 0x00;
 constexpr uint16_t kListLogicOr = 0x01;
+// Scan results are delivered in batches collected over this window, 0 delivers
+// each one as it comes
+constexpr char kScanResultBatchWindowProperty[] =
+    "bluetooth.core.le.scan_result_batch_window_ms";
+// Batches are delivered early once they hold that many results
+constexpr int kScanResultBatchMaxSize = 64;
 
 class DefaultScanningCallback : public ::ScanningCallbacks {
   void OnScannerRegistered(const bluetooth::Uuid /* app_uuid */,
@@ -134,7 +142,7 @@ void btm_ble_process_adv_pkt_cont_for_inquiry(
     uint16_t event_type, tBLE_ADDR_TYPE address_type,
     const RawAddress& raw_address, uint8_t primary_phy, uint8_t secondary_phy,
     uint8_t advertising_sid, int8_t tx_power, int8_t rssi,
-    uint16_t periodic_adv_int, std::vector<uint8_t> advertising_data);
+    uint16_t periodic_adv_int, const std::vector<uint8_t>& advertising_data);
 
 extern void btif_dm_update_ble_remote_properties(const RawAddress& bd_addr,
                                                  BD_NAME bd_name,
@@ -156,6 +164,15 @@ void BleScannerInterfaceImpl::Init() {
   if (bluetooth::shim::GetMsftExtensionManager()) {
     bluetooth::shim::GetMsftExtensionManager()->SetScanningCallback(this);
   }
+
+  scan_result_batch_window_ = std::chrono::milliseconds(
+      bluetooth::os::GetSystemPropertyUint32(kScanResultBatchWindowProperty, 0));
+  if (scan_result_batch_window_.count() > 0) {
+    LOG_INFO("Batching scan results over %d ms",
+             static_cast<int>(scan_result_batch_window_.count()));
+    scan_result_batch_alarm_ = std::make_unique<bluetooth::os::Alarm>(
+        bluetooth::shim::GetGdShimHandler());
+  }
 }
 
 /** Registers a scanner with the stack */
@@ -531,27 +548,87 @@ void BleScannerInterfaceImpl::OnScanResult(
   btm_cb.neighbor.le_scan.results++;
   if (ble_addr_type != BLE_ADDR_ANONYMOUS) {
     btm_ble_process_adv_addr(raw_address, &ble_addr_type);
-  }
-
-  do_in_jni_thread(
-      FROM_HERE,
-      base::BindOnce(&BleScannerInterfaceImpl::handle_remote_properties,
-                     base::Unretained(this), raw_address, ble_addr_type,
-                     advertising_data));
 
-  do_in_jni_thread(
-      FROM_HERE,
-      base::BindOnce(&ScanningCallbacks::OnScanResult,
-                     base::Unretained(scanning_callbacks_), event_type,
-                     static_cast<uint8_t>(address_type), raw_address,
-                     primary_phy, secondary_phy, advertising_sid, tx_power,
-                     rssi, periodic_advertising_interval, advertising_data));
+    // Only the parsed properties are posted, the advertising data itself is
+    // copied once, into the scan result delivered to the scanner callbacks
+    do_in_jni_thread(
+        FROM_HERE,
+        base::BindOnce(&BleScannerInterfaceImpl::handle_remote_properties,
+                       base::Unretained(this), raw_address, ble_addr_type,
+                       parse_remote_properties(advertising_data)));
+  }
 
   // TODO: Remove when StartInquiry in GD part implemented
   btm_ble_process_adv_pkt_cont_for_inquiry(
       event_type, ble_addr_type, raw_address, primary_phy, secondary_phy,
       advertising_sid, tx_power, rssi, periodic_advertising_interval,
       advertising_data);
+
+  if (scan_result_batch_alarm_ != nullptr) {
+    bool flush = false;
+    {
+      std::lock_guard<std::mutex> lock(scan_result_batch_mutex_);
+      std::vector<uint8_t>& batch = scan_result_batch_;
+      batch.push_back(event_type & 0xff);
+      batch.push_back(event_type >> 8);
+      batch.push_back(address_type);
+      batch.insert(batch.end(), raw_address.address,
+                   raw_address.address + sizeof(raw_address.address));
+      batch.push_back(primary_phy);
+      batch.push_back(secondary_phy);
+      batch.push_back(advertising_sid);
+      batch.push_back(static_cast<uint8_t>(tx_power));
+      batch.push_back(static_cast<uint8_t>(rssi));
+      batch.push_back(periodic_advertising_interval & 0xff);
+      batch.push_back(periodic_advertising_interval >> 8);
+      batch.push_back(advertising_data.size() & 0xff);
+      batch.push_back(advertising_data.size() >> 8);
+      batch.insert(batch.end(), advertising_data.begin(),
+                   advertising_data.end());
+
+      scan_result_batch_size_++;
+      if (scan_result_batch_size_ == 1) {
+        scan_result_batch_alarm_->Schedule(
+            bluetooth::common::BindOnce(
+                &BleScannerInterfaceImpl::flush_scan_result_batch,
+                bluetooth::common::Unretained(this)),
+            scan_result_batch_window_);
+      }
+      flush = scan_result_batch_size_ >= kScanResultBatchMaxSize;
+    }
+    if (flush) {
+      scan_result_batch_alarm_->Cancel();
+      flush_scan_result_batch();
+    }
+  } else {
+    do_in_jni_thread(
+        FROM_HERE,
+        base::BindOnce(&ScanningCallbacks::OnScanResult,
+                       base::Unretained(scanning_callbacks_), event_type,
+                       static_cast<uint8_t>(address_type), raw_address,
+                       primary_phy, secondary_phy, advertising_sid, tx_power,
+                       rssi, periodic_advertising_interval,
+                       std::move(advertising_data)));
+  }
+}
+
+void BleScannerInterfaceImpl::flush_scan_result_batch() {
+  std::vector<uint8_t> records;
+  int num_records;
+  {
+    std::lock_guard<std::mutex> lock(scan_result_batch_mutex_);
+    if (scan_result_batch_size_ == 0) {
+      return;
+    }
+    records.swap(scan_result_batch_);
+    num_records = scan_result_batch_size_;
+    scan_result_batch_size_ = 0;
+  }
+
+  do_in_jni_thread(
+      FROM_HERE, base::BindOnce(&ScanningCallbacks::OnScanResults,
+                                base::Unretained(scanning_callbacks_),
+                                std::move(records), num_records));
 }
 
 void BleScannerInterfaceImpl::OnTrackAdvFoundLost(
@@ -604,7 +681,7 @@ void BleScannerInterfaceImpl::OnBatchScanReports(int client_if, int status,
       FROM_HERE,
       base::BindOnce(&ScanningCallbacks::OnBatchScanReports,
                      base::Unretained(scanning_callbacks_), client_if, status,
-                     report_format, num_records, data));
+                     report_format, num_records, std::move(data)));
 }
 
 void BleScannerInterfaceImpl::OnBatchScanThresholdCrossed(int client_if) {
@@ -754,27 +831,24 @@ bool BleScannerInterfaceImpl::parse_filter_command(
   return true;
 }
 
-void BleScannerInterfaceImpl::handle_remote_properties(
-    RawAddress bd_addr, tBLE_ADDR_TYPE addr_type,
-    std::vector<uint8_t> advertising_data) {
-  if (!bluetooth::shim::is_gd_stack_started_up()) {
-    LOG_WARN("Gd stack is stopped, return");
-    return;
-  }
-
-  // skip anonymous advertisment
-  if (addr_type == BLE_ADDR_ANONYMOUS) {
-    return;
-  }
+BleScannerInterfaceImpl::RemoteProperties
+BleScannerInterfaceImpl::parse_remote_properties(
+    const std::vector<uint8_t>& advertising_data) {
+  RemoteProperties properties = {
+      .device_type = bluetooth::hci::DeviceType::LE,
+      .has_name = false,
+      .invalid_name = false,
+      .name = {0},
+      .dev_class = btm_ble_get_appearance_as_cod(advertising_data),
+  };
 
-  auto device_type = bluetooth::hci::DeviceType::LE;
   uint8_t flag_len;
   const uint8_t* p_flag = AdvertiseDataParser::GetFieldByType(
       advertising_data, BTM_BLE_AD_TYPE_FLAG, &flag_len);
 
   if (p_flag != NULL && flag_len != 0) {
     if ((BTM_BLE_BREDR_NOT_SPT & *p_flag) == 0) {
-      device_type = bluetooth::hci::DeviceType::DUAL;
+      properties.device_type = bluetooth::hci::DeviceType::DUAL;
     }
   }
 
@@ -787,30 +861,55 @@ void BleScannerInterfaceImpl::handle_remote_properties(
         advertising_data, HCI_EIR_SHORTENED_LOCAL_NAME_TYPE, &remote_name_len);
   }
 
+  if (p_eir_remote_name) {
+    if (remote_name_len > BD_NAME_LEN + 1 ||
+        (remote_name_len == BD_NAME_LEN + 1 &&
+         p_eir_remote_name[BD_NAME_LEN] != '\0')) {
+      properties.invalid_name = true;
+    } else {
+      properties.has_name = true;
+      memcpy(properties.name.name, p_eir_remote_name, remote_name_len);
+      if (remote_name_len < BD_NAME_LEN + 1)
+        properties.name.name[remote_name_len] = '\0';
+    }
+  }
+  return properties;
+}
+
+void BleScannerInterfaceImpl::handle_remote_properties(
+    RawAddress bd_addr, tBLE_ADDR_TYPE addr_type,
+    RemoteProperties properties) {
+  if (!bluetooth::shim::is_gd_stack_started_up()) {
+    LOG_WARN("Gd stack is stopped, return");
+    return;
+  }
+
+  // skip anonymous advertisment
+  if (addr_type == BLE_ADDR_ANONYMOUS) {
+    return;
+  }
+
+  auto device_type = properties.device_type;
   bt_bdname_t bdname = {0};
 
   // update device name
-  if (p_eir_remote_name) {
+  if (properties.has_name || properties.invalid_name) {
     if (!address_cache_.find(bd_addr)) {
       address_cache_.add(bd_addr);
 
-      if (remote_name_len > BD_NAME_LEN + 1 ||
-          (remote_name_len == BD_NAME_LEN + 1 &&
-           p_eir_remote_name[BD_NAME_LEN] != '\0')) {
-        LOG_INFO("%s dropping invalid packet - device name too long: %d",
-                 __func__, remote_name_len);
+      if (properties.invalid_name) {
+        LOG_INFO("%s dropping invalid packet - device name too long",
+                 __func__);
         return;
       }
 
-      memcpy(bdname.name, p_eir_remote_name, remote_name_len);
-      if (remote_name_len < BD_NAME_LEN + 1)
-        bdname.name[remote_name_len] = '\0';
+      bdname = properties.name;
       btif_dm_update_ble_remote_properties(bd_addr, bdname.name, kDevClassEmpty,
                                            device_type);
     }
   }
 
-  DEV_CLASS dev_class = btm_ble_get_appearance_as_cod(advertising_data);
+  DEV_CLASS dev_class = properties.dev_class;
   if (dev_class != kDevClassUnclassified) {
     btif_dm_update_ble_remote_properties(bd_addr, bdname.name, dev_class,
                                          device_type);
@@ -819,10 +918,21 @@ void BleScannerInterfaceImpl::handle_remote_properties(
   auto* storage_module = bluetooth::shim::GetStorage();
   bluetooth::hci::Address address = ToGdAddress(bd_addr);
 
-  // update device type
-  auto mutation = storage_module->Modify();
+  // Most results come from devices already known with the same types, whose
+  // storage entry does not need to be modified again
   bluetooth::storage::Device device =
       storage_module->GetDeviceByLegacyKey(address);
+  auto stored_type = device.GetDeviceType();
+  if (stored_type.has_value() &&
+      (*stored_type == device_type ||
+       *stored_type == bluetooth::hci::DeviceType::DUAL) &&
+      device.Le().GetAddressType() ==
+          static_cast<bluetooth::hci::AddressType>(addr_type)) {
+    return;
+  }
+
+  // update device type
+  auto mutation = storage_module->Modify();
   mutation.Add(device.SetDeviceType(device_type));
   mutation.Commit();
 
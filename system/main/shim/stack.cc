@@ -45,7 +45,9 @@
 #include "main/shim/le_scanning_manager.h"
 #include "metrics/counter_metrics.h"
 #include "os/log.h"
+#include "osi/include/thread_scheduler.h"
 #include "shim/dumpsys.h"
+#include "stack/include/main_thread.h"
 #include "storage/storage_module.h"
 #include "sysprops/sysprops_module.h"
 
@@ -120,11 +122,23 @@ void Stack::Start(ModuleList* modules) {
   ASSERT_LOG(!is_running_, "%s Gd stack already running", __func__);
   LOG_INFO("%s Starting Gd stack", __func__);
 
-  stack_thread_ =
-      new os::Thread("gd_stack_thread", os::Thread::Priority::REAL_TIME);
+  // Share the main thread when it is merged with the gd stack thread, so that
+  // the data path does not hop between the two threads
+  stack_thread_ = get_merged_main_thread();
+  owns_stack_thread_ = stack_thread_ == nullptr;
+  if (owns_stack_thread_) {
+    stack_thread_ =
+        new os::Thread("gd_stack_thread", os::Thread::Priority::REAL_TIME);
+  } else {
+    LOG_INFO("%s Running Gd stack on the main thread", __func__);
+  }
   stack_manager_.StartUp(modules, stack_thread_);
 
   stack_handler_ = new os::Handler(stack_thread_);
+  if (owns_stack_thread_) {
+    stack_handler_->Post(common::BindOnce(
+        []() { thread_scheduler_apply_policy("gd_stack_thread"); }));
+  }
 
   LOG_INFO("%s Successfully toggled Gd stack", __func__);
 }
@@ -153,9 +167,12 @@ void Stack::Stop() {
   delete stack_handler_;
   stack_handler_ = nullptr;
 
-  stack_thread_->Stop();
-  delete stack_thread_;
+  if (owns_stack_thread_) {
+    stack_thread_->Stop();
+    delete stack_thread_;
+  }
   stack_thread_ = nullptr;
+  owns_stack_thread_ = false;
 
   LOG_INFO("%s Successfully shut down Gd stack", __func__);
 }
@@ -81,6 +81,8 @@ class Stack {
   StackManager stack_manager_;
   bool is_running_ = false;
   os::Thread* stack_thread_ = nullptr;
+  // False when the stack runs on the merged main thread
+  bool owns_stack_thread_ = true;
   os::Handler* stack_handler_ = nullptr;
   legacy::Acl* acl_ = nullptr;
   Btm* btm_ = nullptr;
@@ -268,9 +268,14 @@ class MockClassicAclConnection
   MockEnQueue<hci::BasePacketBuilder> tx_;
   MockDeQueue<packet::PacketView<hci::kLittleEndian>> rx_;
 
-  bool ReadRemoteVersionInformation() override { return true; }
+  bool ReadRemoteVersionInformation() override {
+    read_remote_version_information_cnt_++;
+    return true;
+  }
   bool ReadRemoteSupportedFeatures() override { return true; }
 
+  int read_remote_version_information_cnt_{0};
+
   std::function<void(uint8_t)> read_remote_extended_features_function_{};
 
   bool ReadRemoteExtendedFeatures(uint8_t page_number) override {
@@ -753,6 +758,49 @@ TEST_F(MainShimTestWithClassicConnection, read_extended_feature) {
   raw_connection_->read_remote_extended_features_function_ = {};
 }
 
+TEST_F(MainShimTest, classic_remote_info_reads_are_throttled) {
+  auto acl = MakeAcl();
+
+  std::vector<MockClassicAclConnection*> raw_connections;
+  for (uint16_t handle = 1; handle <= 4; handle++) {
+    hci::Address address(
+        {0x11, 0x22, 0x33, 0x44, 0x55, static_cast<uint8_t>(handle)});
+    auto connection =
+        std::make_unique<MockClassicAclConnection>(address, handle);
+    raw_connections.push_back(connection.get());
+    acl->OnConnectSuccess(std::move(connection));
+  }
+
+  // Only the first links read the remote information right away
+  ASSERT_EQ(1, raw_connections[0]->read_remote_version_information_cnt_);
+  ASSERT_EQ(1, raw_connections[1]->read_remote_version_information_cnt_);
+  ASSERT_EQ(1, raw_connections[2]->read_remote_version_information_cnt_);
+  ASSERT_EQ(0, raw_connections[3]->read_remote_version_information_cnt_);
+
+  // The last link starts once one of the first links is usable
+  raw_connections[0]->callbacks_->OnReadRemoteVersionInformationComplete(
+      hci::ErrorCode::SUCCESS, 0x0b, 0x000f, 0x1234);
+  ASSERT_EQ(0, raw_connections[3]->read_remote_version_information_cnt_);
+  raw_connections[0]->callbacks_->OnReadRemoteSupportedFeaturesComplete(0);
+  ASSERT_EQ(1, raw_connections[3]->read_remote_version_information_cnt_);
+
+  for (auto* raw_connection : raw_connections) {
+    auto handle_promise = std::promise<uint16_t>();
+    auto rx_disconnect_future = handle_promise.get_future();
+    mock_function_handle_promise_map["mock_connection_classic_on_disconnected"] =
+        std::move(handle_promise);
+    raw_connection->callbacks_->OnDisconnection(hci::ErrorCode::SUCCESS);
+    ASSERT_EQ(raw_connection->GetHandle(), rx_disconnect_future.get());
+  }
+
+  // *Our* task completing indicates reactor is done
+  std::promise<void> done;
+  auto future = done.get_future();
+  handler_->Call([](std::promise<void> done) { done.set_value(); },
+                 std::move(done));
+  future.wait();
+}
+
 TEST_F(MainShimTest, acl_dumpsys) {
   MakeAcl()->Dump(std::make_unique<DevNullOrStdErr>()->Fd());
 }
@@ -28,6 +28,20 @@ typedef struct thread_t thread_t;
 // Prototype for the alarm callback function.
 typedef void (*alarm_callback_t)(void* data);
 
+// How much an alarm may be delayed past its interval so that it fires
+// together with other alarms instead of waking up the system on its own.
+typedef enum {
+  // Fires at its deadline.
+  ALARM_CLASS_CRITICAL,
+  // May be delayed by 1/256 of its interval, up to 10 ms. This is the class
+  // of new alarms.
+  ALARM_CLASS_NORMAL,
+  // May be delayed by 1/8 of its interval, up to 1 s. For timeouts
+  // that only need to fire eventually, such as idle disconnection or address
+  // rotation.
+  ALARM_CLASS_LAZY,
+} alarm_class_t;
+
 // Creates a new one-time off alarm object with user-assigned
 // |name|. |name| may not be NULL, and a copy of the string will
 // be stored internally. The value of |name| has no semantic
@@ -73,6 +87,10 @@ void alarm_free(alarm_t* alarm);
 void alarm_set(alarm_t* alarm, uint64_t interval_ms, alarm_callback_t cb,
                void* data);
 
+// Sets the class of |alarm|, which applies from the next time it is set.
+// |alarm| may not be NULL.
+void alarm_set_class(alarm_t* alarm, alarm_class_t alarm_class);
+
 // Sets an |alarm| to execute a callback in the main message loop. This function
 // is same as |alarm_set| except that the |cb| callback is scheduled for
 // execution in the context of the main message loop.
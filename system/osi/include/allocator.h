@@ -47,6 +47,43 @@ void osi_free(void* ptr);
 // |p_ptr| cannot be NULL.
 void osi_free_and_reset(void** p_ptr);
 
+// Enable the size-class pool backing |osi_malloc| and |osi_calloc|.
+// Requests that fit one of the pool size classes are served from a
+// pre-allocated arena; larger requests, or requests made while a size class
+// is exhausted, fall back to the system allocator. Buffers allocated before
+// the pool got enabled are still released correctly by |osi_free|.
+// This function is idempotent and the pool stays enabled for the lifetime of
+// the process.
+void osi_allocator_pool_enable(void);
+bool osi_allocator_pool_is_enabled(void);
+
+// Let the calling thread keep a small local cache of free pool blocks so that
+// allocating and freeing on that thread does not contend on the pool locks.
+// Intended for the threads that churn through packet buffers, e.g. the main
+// thread and the A2DP source thread.
+void osi_allocator_thread_cache_enable(void);
+
+// Enable the accounting of the |osi_malloc| and |osi_calloc| allocations by
+// tag. Allocations are accounted to the tag of the calling thread, which is
+// the thread name unless set with |osi_allocator_set_thread_tag|. The live
+// bytes, peak live bytes and allocation count of every tag are part of
+// |osi_allocator_debug_dump|. Tagging relies on the size-class pool, which it
+// enables; buffers allocated before tagging got enabled are not accounted.
+// This function is idempotent.
+void osi_allocator_tagging_enable(void);
+bool osi_allocator_tagging_is_enabled(void);
+
+// Account the allocations of the calling thread to |tag|, e.g. to separate a
+// module sharing its thread with others. Names are truncated to 31 chars.
+void osi_allocator_set_thread_tag(const char* tag);
+
+// Return the bytes currently allocated by |tag|, 0 for an unknown tag.
+int64_t osi_allocator_get_tag_live_bytes(const char* tag);
+
+// Dump the allocator pool statistics to the |fd| file descriptor.
+// The information is in user-readable text format. The |fd| must be valid.
+void osi_allocator_debug_dump(int fd);
+
 class OsiObject {
  public:
   OsiObject(void* ptr);
@@ -15,16 +15,145 @@
 //   empty sections.
 // - Duplicate keys in a section will overwrite previous values.
 // - All strings are case sensitive.
+// - Sections and keys are kept in insertion order, which is the order used by
+//   |config_save|, and are also indexed by name for constant time lookups.
 
 #include <stdbool.h>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 
 // The default section name to use if a key/value pair is not defined within
 // a section.
 #define CONFIG_DEFAULT_SECTION "Global"
 
+// A std::list of |T| indexed by the |Key| member of its elements. Iteration
+// follows insertion order while |Find| is a hash table lookup. When several
+// elements share a key, |Find| returns the first one in list order.
+// The key of an element must not be modified while it is in the list.
+template <typename T, std::string T::*Key>
+class config_list_t {
+ public:
+  using iterator = typename std::list<T>::iterator;
+  using const_iterator = typename std::list<T>::const_iterator;
+
+  config_list_t() = default;
+  config_list_t(const config_list_t& other) : list_(other.list_) { Reindex(); }
+  config_list_t(config_list_t&& other) noexcept { *this = std::move(other); }
+
+  config_list_t& operator=(const config_list_t& other) {
+    if (this != &other) {
+      list_ = other.list_;
+      Reindex();
+    }
+    return *this;
+  }
+
+  config_list_t& operator=(config_list_t&& other) noexcept {
+    if (this != &other) {
+      // Moving a std::list keeps its iterators valid, so the index can follow.
+      list_ = std::move(other.list_);
+      index_ = std::move(other.index_);
+      duplicates_ = other.duplicates_;
+      other.clear();
+    }
+    return *this;
+  }
+
+  iterator begin() { return list_.begin(); }
+  iterator end() { return list_.end(); }
+  const_iterator begin() const { return list_.begin(); }
+  const_iterator end() const { return list_.end(); }
+
+  size_t size() const { return list_.size(); }
+  bool empty() const { return list_.empty(); }
+
+  T& front() { return list_.front(); }
+  const T& front() const { return list_.front(); }
+  T& back() { return list_.back(); }
+  const T& back() const { return list_.back(); }
+
+  iterator Find(std::string_view key) {
+    auto it = index_.find(key);
+    return it == index_.end() ? list_.end() : it->second;
+  }
+
+  const_iterator Find(std::string_view key) const {
+    auto it = index_.find(key);
+    return it == index_.end() ? list_.end() : const_iterator(it->second);
+  }
+
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    list_.emplace_back(std::forward<Args>(args)...);
+    Index(std::prev(list_.end()));
+    return list_.back();
+  }
+
+  void push_back(const T& value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  iterator erase(iterator pos) {
+    Unindex(pos);
+    return list_.erase(pos);
+  }
+
+  void pop_front() { erase(list_.begin()); }
+
+  void clear() {
+    index_.clear();
+    list_.clear();
+    duplicates_ = 0;
+  }
+
+  // Sorting moves no element, only the first of duplicated keys can change.
+  template <typename Compare>
+  void sort(Compare comp) {
+    list_.sort(comp);
+    if (duplicates_ > 0) Reindex();
+  }
+
+ private:
+  void Index(iterator pos) {
+    if (!index_.emplace(std::string_view((*pos).*Key), pos).second) {
+      duplicates_++;
+    }
+  }
+
+  void Unindex(iterator pos) {
+    auto it = index_.find((*pos).*Key);
+    if (it->second != pos) {
+      // A duplicate that was never indexed
+      duplicates_--;
+      return;
+    }
+    index_.erase(it);
+    if (duplicates_ == 0) return;
+    for (auto next = std::next(pos); next != list_.end(); ++next) {
+      if ((*next).*Key == (*pos).*Key) {
+        index_.emplace(std::string_view((*next).*Key), next);
+        duplicates_--;
+        return;
+      }
+    }
+  }
+
+  void Reindex() {
+    index_.clear();
+    duplicates_ = 0;
+    for (auto it = list_.begin(); it != list_.end(); ++it) Index(it);
+  }
+
+  std::list<T> list_;
+  // Keys point into the elements of |list_|, whose nodes never move.
+  std::unordered_map<std::string_view, iterator> index_;
+  size_t duplicates_ = 0;
+};
+
 struct entry_t {
   std::string key;
   std::string value;
@@ -32,14 +161,14 @@ struct entry_t {
 
 struct section_t {
   std::string name;
-  std::list<entry_t> entries;
+  config_list_t<entry_t, &entry_t::key> entries;
   void Set(std::string key, std::string value);
   std::list<entry_t>::iterator Find(const std::string& key);
   bool Has(const std::string& key);
 };
 
 struct config_t {
-  std::list<section_t> sections;
+  config_list_t<section_t, &section_t::name> sections;
   std::list<section_t>::iterator Find(const std::string& section);
   bool Has(const std::string& section);
 };
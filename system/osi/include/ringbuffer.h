@@ -22,10 +22,22 @@
 
 typedef struct ringbuffer_t ringbuffer_t;
 
+// A region of the ringbuffer, split in two contiguous spans when it wraps
+// around the end of the buffer. |second| is NULL when |second_length| is 0.
+typedef struct {
+  uint8_t* first;
+  size_t first_length;
+  uint8_t* second;
+  size_t second_length;
+} ringbuffer_spans_t;
+
 // NOTE:
-// None of the functions below are thread safe when it comes to accessing the
-// *rb pointer. It is *NOT* possible to insert and pop/delete at the same time.
-// Callers must protect the *rb pointer separately.
+// The functions below are not thread safe, with one exception: a single
+// producer thread may call |ringbuffer_insert|, |ringbuffer_writable_spans|
+// and |ringbuffer_commit_write| while a single consumer thread calls
+// |ringbuffer_peek|, |ringbuffer_pop|, |ringbuffer_delete| and
+// |ringbuffer_readable_spans|, without any lock. Any other concurrent use of
+// the *rb pointer must be protected by the callers.
 
 // Create a ringbuffer with the specified size
 // Returns NULL if memory allocation failed. Resulting pointer must be freed
@@ -60,3 +72,19 @@ size_t ringbuffer_pop(ringbuffer_t* rb, uint8_t* p, size_t length);
 // Deletes |length| bytes from the ringbuffer starting from the head
 // Return actual number of bytes deleted.
 size_t ringbuffer_delete(ringbuffer_t* rb, size_t length);
+
+// Fills |spans| with the data in the buffer, starting from the head, so that
+// it can be read in place. Returns the number of bytes in |spans|. The data
+// stays in the buffer until released with |ringbuffer_delete|.
+size_t ringbuffer_readable_spans(const ringbuffer_t* rb,
+                                 ringbuffer_spans_t* spans);
+
+// Fills |spans| with the free space of the buffer, following the data, so
+// that it can be written in place. Returns the number of bytes in |spans|.
+// The bytes written are added to the buffer by |ringbuffer_commit_write|.
+size_t ringbuffer_writable_spans(ringbuffer_t* rb, ringbuffer_spans_t* spans);
+
+// Adds the first |length| bytes written in the spans returned by
+// |ringbuffer_writable_spans| to the buffer. Returns the actual number of
+// bytes added, which can be less than |length| if the buffer is full.
+size_t ringbuffer_commit_write(ringbuffer_t* rb, size_t length);
@@ -16,5 +16,73 @@
 
 #pragma once
 
+#include <pthread.h>
+#include <sys/types.h>
+
 bool thread_scheduler_enable_real_time(pid_t pid);
 bool thread_scheduler_get_priority_range(int& min, int& max);
+
+// Class of CPUs a thread may run on. On a heterogeneous SoC the performance
+// cores are the ones with the largest cpu_capacity, every other core is an
+// efficiency core. On a homogeneous SoC every class maps to all the CPUs.
+typedef enum {
+  THREAD_CPU_ANY,
+  THREAD_CPU_PERFORMANCE,
+  THREAD_CPU_EFFICIENCY,
+} thread_cpu_class_t;
+
+typedef struct {
+  // Run with SCHED_FIFO at |priority| instead of SCHED_OTHER
+  bool real_time;
+  int priority;
+  thread_cpu_class_t cpu_class;
+} thread_policy_t;
+
+// Parses a policy of the form "<scheduling>[,<cpu class>]" where scheduling
+// is "other", "fifo" or "fifo:<priority>" and the cpu class is "any",
+// "performance" or "efficiency". Returns false, leaving |policy| untouched,
+// if |value| is malformed.
+bool thread_scheduler_parse_policy(const char* value, thread_policy_t* policy);
+
+// Returns the policy of the thread named |thread_name|. The built-in default
+// can be overridden with the property
+// "bluetooth.core.thread_policy.<thread_name>".
+thread_policy_t thread_scheduler_get_policy(const char* thread_name);
+
+// Applies the policy of |thread_name| to the calling thread and records the
+// thread so that its scheduling latency shows up in
+// thread_scheduler_debug_dump(). Returns false if the scheduling class or the
+// affinity could not be set.
+bool thread_scheduler_apply_policy(const char* thread_name);
+
+// Dumps the policy of each thread registered with
+// thread_scheduler_apply_policy() along with the time it spent runnable but
+// waiting for a CPU, as accounted by the kernel.
+void thread_scheduler_debug_dump(int fd);
+
+// A mutex with priority inheritance, for state shared between a real time
+// thread and SCHED_OTHER threads: a SCHED_OTHER thread holding the lock runs
+// at the priority of the real time thread waiting for it, so a preempted
+// holder cannot stall the audio path. Meets the Lockable requirements.
+class PriorityInheritanceMutex {
+ public:
+  PriorityInheritanceMutex() {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    pthread_mutex_init(&mutex_, &attr);
+    pthread_mutexattr_destroy(&attr);
+  }
+  ~PriorityInheritanceMutex() { pthread_mutex_destroy(&mutex_); }
+
+  PriorityInheritanceMutex(const PriorityInheritanceMutex&) = delete;
+  PriorityInheritanceMutex& operator=(const PriorityInheritanceMutex&) =
+      delete;
+
+  void lock() { pthread_mutex_lock(&mutex_); }
+  void unlock() { pthread_mutex_unlock(&mutex_); }
+  bool try_lock() { return pthread_mutex_trylock(&mutex_) == 0; }
+
+ private:
+  pthread_mutex_t mutex_;
+};
@@ -37,6 +37,20 @@ bool wakelock_acquire(void);
 // Return true on success, otherwise false.
 bool wakelock_release(void);
 
+// Acquire the Bluetooth wakelock on behalf of |source|, a short name of the
+// profile or alarm keeping the system awake such as "a2dp_source". The time
+// until |source| releases the wakelock is attributed to it in
+// wakelock_debug_dump() and in the wake event metrics. Sources share the
+// single Bluetooth wakelock, so their hold times may overlap.
+// The function is thread safe.
+// Return true on success, otherwise false.
+bool wakelock_acquire_for(const char* source);
+
+// Release the Bluetooth wakelock on behalf of |source|.
+// The function is thread safe.
+// Return true on success, otherwise false.
+bool wakelock_release_for(const char* source);
+
 // Cleanup the wakelock internal state.
 // This function should be called by the OSI module cleanup during
 // graceful shutdown.
@@ -30,13 +30,15 @@
 #include <string.h>
 #include <time.h>
 
+#include <algorithm>
+#include <map>
 #include <mutex>
+#include <string>
 
 #include "check.h"
 #include "os/log.h"
 #include "osi/include/allocator.h"
 #include "osi/include/fixed_queue.h"
-#include "osi/include/list.h"
 #include "osi/include/osi.h"
 #include "osi/include/thread.h"
 #include "osi/include/wakelock.h"
@@ -79,6 +81,36 @@ struct CancelableClosureInStruct {
   }
 };
 
+// Pending alarms are kept in a hierarchical timer wheel. Level |n| has
+// ALARM_WHEEL_SLOTS slots of 2^(n * ALARM_WHEEL_SLOT_BITS) ms each; an alarm
+// is filed at the lowest level where its deadline shares the slots of the
+// upper levels with the time the wheel was last advanced to. Setting and
+// canceling an alarm is O(1), and alarms are moved to a lower level
+// (cascaded) when the wheel reaches their slot.
+#define ALARM_WHEEL_LEVELS 4
+#define ALARM_WHEEL_SLOT_BITS 6
+#define ALARM_WHEEL_SLOTS (1 << ALARM_WHEEL_SLOT_BITS)
+#define ALARM_WHEEL_SLOT_MASK (ALARM_WHEEL_SLOTS - 1)
+
+// A list of alarms, in the order they were added.
+typedef struct {
+  alarm_t* head;
+  alarm_t* tail;
+} alarm_slot_t;
+
+typedef struct {
+  // The time the wheel has been advanced to
+  uint64_t now_ms;
+  size_t count;
+  // Bitmap of the non-empty slots of each level
+  uint64_t occupied[ALARM_WHEEL_LEVELS];
+  alarm_slot_t slots[ALARM_WHEEL_LEVELS][ALARM_WHEEL_SLOTS];
+  // Alarms whose deadline has been reached, waiting to be dispatched
+  alarm_slot_t expired;
+  // Alarms beyond the range of the top level
+  alarm_slot_t overflow;
+} alarm_wheel_t;
+
 struct alarm_t {
   // The mutex is held while the callback for this alarm is being executed.
   // It allows us to release the coarse-grained monitor lock while a
@@ -92,11 +124,19 @@ struct alarm_t {
   uint64_t prev_deadline_ms;  // Previous deadline - used for accounting of
                               // periodic timers
   bool is_periodic;
+  alarm_class_t alarm_class;
+  bool deferred;  // True, if the deadline was delayed by the class slack
   fixed_queue_t* queue;  // The processing queue to add this alarm to
   alarm_callback_t callback;
   void* data;
   alarm_stats_t stats;
 
+  // Position in the timer wheel. |wheel_slot| is NULL if the alarm is not
+  // pending.
+  alarm_slot_t* wheel_slot;
+  alarm_t* wheel_prev;
+  alarm_t* wheel_next;
+
   bool for_msg_loop;  // True, if the alarm should be processed on message loop
   CancelableClosureInStruct closure;  // posted to message loop for processing
 };
@@ -108,14 +148,35 @@ struct alarm_t {
 int64_t TIMER_INTERVAL_FOR_WAKELOCK_IN_MS = 3000;
 static const clockid_t CLOCK_ID = CLOCK_BOOTTIME;
 
+// Maximum delay of the normal and lazy alarms, see |alarm_class_t|.
+static const uint64_t ALARM_NORMAL_MAX_SLACK_MS = 10;
+static const uint64_t ALARM_LAZY_MAX_SLACK_MS = 1000;
+
 // This mutex ensures that the |alarm_set|, |alarm_cancel|, and alarm callback
 // functions execute serially and not concurrently. As a result, this mutex
-// also protects the |alarms| list.
+// also protects the |alarms| wheel.
 static std::mutex alarms_mutex;
-static list_t* alarms;
+static alarm_wheel_t* alarms;
 static timer_t timer;
 static timer_t wakeup_timer;
 static bool timer_set;
+// Deadline of the earliest pending alarm when the timers were last armed,
+// UINT64_MAX if there was none.
+static uint64_t timer_deadline_ms = UINT64_MAX;
+
+// Number of wakeups avoided by dispatching delayed alarms together with other
+// alarms.
+static size_t wakeups_saved;
+
+// Name of the alarm the wakelock was acquired for, while |timer_set|
+static std::string wakelock_holder;
+
+// Number of times the wakeup timer fired, by name of the first alarm it
+// dispatched. Kept beyond the lifetime of the alarms, up to
+// MAX_WAKEUP_SOURCES names.
+static const size_t MAX_WAKEUP_SOURCES = 64;
+static const char* OTHER_WAKEUP_SOURCE = "other";
+static std::map<std::string, size_t> wakeups_by_alarm;
 
 // All alarm callbacks are dispatched from |dispatcher_thread|
 static thread_t* dispatcher_thread;
@@ -153,6 +214,198 @@ static void update_stat(stat_t* stat, uint64_t delta_ms) {
   stat->count++;
 }
 
+// Delays |deadline_ms| by up to the slack of |alarm_class| for |interval_ms|,
+// to the time in that window with the most trailing zero bits. Alarms with
+// nearby deadlines are thus moved to the same deadline, and dispatched
+// together.
+static uint64_t apply_slack(alarm_class_t alarm_class, uint64_t deadline_ms,
+                            uint64_t interval_ms) {
+  uint64_t slack_ms = 0;
+  switch (alarm_class) {
+    case ALARM_CLASS_CRITICAL:
+      break;
+    case ALARM_CLASS_NORMAL:
+      slack_ms = std::min(interval_ms / 256, ALARM_NORMAL_MAX_SLACK_MS);
+      break;
+    case ALARM_CLASS_LAZY:
+      slack_ms = std::min(interval_ms / 8, ALARM_LAZY_MAX_SLACK_MS);
+      break;
+  }
+  if (slack_ms == 0) return deadline_ms;
+
+  uint64_t limit_ms = deadline_ms + slack_ms;
+  int bit = 63 - __builtin_clzll(deadline_ms ^ limit_ms);
+  return limit_ms & ~((1ULL << bit) - 1);
+}
+
+static void wheel_append(alarm_slot_t* slot, alarm_t* alarm) {
+  alarm->wheel_slot = slot;
+  alarm->wheel_prev = slot->tail;
+  alarm->wheel_next = NULL;
+  if (slot->tail != NULL) {
+    slot->tail->wheel_next = alarm;
+  } else {
+    slot->head = alarm;
+  }
+  slot->tail = alarm;
+}
+
+// Files |alarm| in the slot matching its deadline.
+static void wheel_insert(alarm_wheel_t* wheel, alarm_t* alarm) {
+  uint64_t deadline_ms = alarm->deadline_ms;
+  alarm_slot_t* slot;
+
+  if (deadline_ms <= wheel->now_ms) {
+    slot = &wheel->expired;
+  } else {
+    int level = (63 - __builtin_clzll(deadline_ms ^ wheel->now_ms)) /
+                ALARM_WHEEL_SLOT_BITS;
+    if (level >= ALARM_WHEEL_LEVELS) {
+      slot = &wheel->overflow;
+    } else {
+      int index = (deadline_ms >> (level * ALARM_WHEEL_SLOT_BITS)) &
+                  ALARM_WHEEL_SLOT_MASK;
+      slot = &wheel->slots[level][index];
+      wheel->occupied[level] |= 1ULL << index;
+    }
+  }
+
+  wheel_append(slot, alarm);
+  wheel->count++;
+}
+
+static void wheel_remove(alarm_wheel_t* wheel, alarm_t* alarm) {
+  alarm_slot_t* slot = alarm->wheel_slot;
+  if (slot == NULL) return;
+
+  if (alarm->wheel_prev != NULL) {
+    alarm->wheel_prev->wheel_next = alarm->wheel_next;
+  } else {
+    slot->head = alarm->wheel_next;
+  }
+  if (alarm->wheel_next != NULL) {
+    alarm->wheel_next->wheel_prev = alarm->wheel_prev;
+  } else {
+    slot->tail = alarm->wheel_prev;
+  }
+
+  if (slot->head == NULL && slot >= &wheel->slots[0][0] &&
+      slot <= &wheel->slots[ALARM_WHEEL_LEVELS - 1][ALARM_WHEEL_SLOTS - 1]) {
+    ptrdiff_t position = slot - &wheel->slots[0][0];
+    wheel->occupied[position / ALARM_WHEEL_SLOTS] &=
+        ~(1ULL << (position % ALARM_WHEEL_SLOTS));
+  }
+
+  alarm->wheel_slot = NULL;
+  alarm->wheel_prev = NULL;
+  alarm->wheel_next = NULL;
+  wheel->count--;
+}
+
+// Empties |slot| and returns its alarms, linked through |wheel_next|.
+static alarm_t* wheel_detach(alarm_wheel_t* wheel, alarm_slot_t* slot) {
+  alarm_t* head = slot->head;
+  slot->head = NULL;
+  slot->tail = NULL;
+  for (alarm_t* alarm = head; alarm != NULL; alarm = alarm->wheel_next) {
+    alarm->wheel_slot = NULL;
+    alarm->wheel_prev = NULL;
+    wheel->count--;
+  }
+  return head;
+}
+
+static void wheel_reinsert(alarm_wheel_t* wheel, alarm_t* alarms) {
+  while (alarms != NULL) {
+    alarm_t* alarm = alarms;
+    alarms = alarm->wheel_next;
+    wheel_insert(wheel, alarm);
+  }
+}
+
+// Returns the alarm of |slot| with the earliest deadline, |slot| must not be
+// empty.
+static alarm_t* slot_earliest(const alarm_slot_t* slot) {
+  alarm_t* earliest = slot->head;
+  for (alarm_t* alarm = slot->head; alarm != NULL; alarm = alarm->wheel_next)
+    if (alarm->deadline_ms < earliest->deadline_ms) earliest = alarm;
+  return earliest;
+}
+
+static uint64_t slot_min_deadline(const alarm_slot_t* slot) {
+  return slot->head == NULL ? UINT64_MAX : slot_earliest(slot)->deadline_ms;
+}
+
+// Finds the pending alarm with the earliest deadline. Returns NULL if there
+// are none.
+static alarm_t* wheel_next_alarm(const alarm_wheel_t* wheel) {
+  if (wheel->expired.head != NULL) return wheel->expired.head;
+
+  // The occupied slots of a level are all after the ones of the levels below,
+  // and only the slots of level 0 hold alarms with a single deadline.
+  for (int level = 0; level < ALARM_WHEEL_LEVELS; level++) {
+    if (wheel->occupied[level] == 0) continue;
+    const alarm_slot_t* slot =
+        &wheel->slots[level][__builtin_ctzll(wheel->occupied[level])];
+    return (level == 0) ? slot->head : slot_earliest(slot);
+  }
+
+  if (wheel->overflow.head != NULL) return slot_earliest(&wheel->overflow);
+
+  return NULL;
+}
+
+// Advances the wheel to |now_ms|, moving the alarms whose deadline has been
+// reached to the expired list and cascading the slots that were reached.
+static void wheel_advance(alarm_wheel_t* wheel, uint64_t now_ms) {
+  while (wheel->now_ms < now_ms) {
+    int level = 0;
+    while (level < ALARM_WHEEL_LEVELS && wheel->occupied[level] == 0) level++;
+
+    if (level == ALARM_WHEEL_LEVELS) {
+      // Only the overflow list may be left. Move the wheel to the range of
+      // the top level holding the earliest of them, if it has been reached,
+      // and re-file them.
+      const int top_shift = ALARM_WHEEL_LEVELS * ALARM_WHEEL_SLOT_BITS;
+      uint64_t deadline_ms = slot_min_deadline(&wheel->overflow);
+      if (deadline_ms > now_ms) {
+        bool range_changed =
+            (wheel->now_ms >> top_shift) != (now_ms >> top_shift);
+        wheel->now_ms = now_ms;
+        if (range_changed)
+          wheel_reinsert(wheel, wheel_detach(wheel, &wheel->overflow));
+        return;
+      }
+
+      wheel->now_ms = (deadline_ms >> top_shift) << top_shift;
+      wheel_reinsert(wheel, wheel_detach(wheel, &wheel->overflow));
+      continue;
+    }
+
+    int index = __builtin_ctzll(wheel->occupied[level]);
+    const int level_shift = level * ALARM_WHEEL_SLOT_BITS;
+    const int upper_shift = level_shift + ALARM_WHEEL_SLOT_BITS;
+    uint64_t slot_start_ms = ((wheel->now_ms >> upper_shift) << upper_shift) |
+                             ((uint64_t)index << level_shift);
+    if (slot_start_ms > now_ms) {
+      // No slot is reached, and the alarms are still filed correctly for
+      // |now_ms| since it is in the same range of the upper levels.
+      wheel->now_ms = now_ms;
+      return;
+    }
+
+    wheel->now_ms = slot_start_ms;
+    wheel->occupied[level] &= ~(1ULL << index);
+    wheel_reinsert(wheel, wheel_detach(wheel, &wheel->slots[level][index]));
+  }
+}
+
+// Empties the expired list and returns its alarms in deadline order, linked
+// through |wheel_next|.
+static alarm_t* wheel_take_expired(alarm_wheel_t* wheel) {
+  return wheel_detach(wheel, &wheel->expired);
+}
+
 alarm_t* alarm_new(const char* name) { return alarm_new_internal(name, false); }
 
 alarm_t* alarm_new_periodic(const char* name) {
@@ -171,6 +424,7 @@ static alarm_t* alarm_new_internal(const char* name, bool is_periodic) {
   std::shared_ptr<std::recursive_mutex> ptr(new std::recursive_mutex());
   ret->callback_mutex = ptr;
   ret->is_periodic = is_periodic;
+  ret->alarm_class = ALARM_CLASS_NORMAL;
   ret->stats.name = osi_strdup(name);
 
   ret->for_msg_loop = false;
@@ -211,6 +465,13 @@ void alarm_set(alarm_t* alarm, uint64_t interval_ms, alarm_callback_t cb,
                      false);
 }
 
+void alarm_set_class(alarm_t* alarm, alarm_class_t alarm_class) {
+  CHECK(alarm != NULL);
+
+  std::lock_guard<std::mutex> lock(alarms_mutex);
+  alarm->alarm_class = alarm_class;
+}
+
 void alarm_set_on_mloop(alarm_t* alarm, uint64_t interval_ms,
                         alarm_callback_t cb, void* data) {
   alarm_set_internal(alarm, interval_ms, cb, data, NULL, true);
@@ -255,8 +516,8 @@ void alarm_cancel(alarm_t* alarm) {
 // Internal implementation of canceling an alarm.
 // The caller must hold the |alarms_mutex|
 static void alarm_cancel_internal(alarm_t* alarm) {
-  bool needs_reschedule =
-      (!list_is_empty(alarms) && list_front(alarms) == alarm);
+  bool needs_reschedule = (alarm->wheel_slot != NULL &&
+                           alarm->deadline_ms <= timer_deadline_ms);
 
   remove_pending_alarm(alarm);
 
@@ -296,8 +557,9 @@ void alarm_cleanup(void) {
   semaphore_free(alarm_expired);
   alarm_expired = NULL;
 
-  list_free(alarms);
+  osi_free(alarms);
   alarms = NULL;
+  timer_deadline_ms = UINT64_MAX;
 }
 
 static bool lazy_initialize(void) {
@@ -310,11 +572,8 @@ static bool lazy_initialize(void) {
 
   std::lock_guard<std::mutex> lock(alarms_mutex);
 
-  alarms = list_new(NULL);
-  if (!alarms) {
-    LOG_ERROR("%s unable to allocate alarm list.", __func__);
-    goto error;
-  }
+  alarms = static_cast<alarm_wheel_t*>(osi_calloc(sizeof(alarm_wheel_t)));
+  timer_deadline_ms = UINT64_MAX;
 
   if (!timer_create_internal(CLOCK_ID, &timer)) goto error;
   timer_initialized = true;
@@ -375,7 +634,7 @@ error:
 
   if (timer_initialized) timer_delete(timer);
 
-  list_free(alarms);
+  osi_free(alarms);
   alarms = NULL;
 
   return false;
@@ -393,10 +652,10 @@ static uint64_t now_ms(void) {
   return (ts.tv_sec * 1000LL) + (ts.tv_nsec / 1000000LL);
 }
 
-// Remove alarm from internal alarm list and the processing queue
+// Remove alarm from internal alarm wheel and the processing queue
 // The caller must hold the |alarms_mutex|
 static void remove_pending_alarm(alarm_t* alarm) {
-  list_remove(alarms, alarm);
+  wheel_remove(alarms, alarm);
 
   if (alarm->for_msg_loop) {
     alarm->closure.i.Cancel();
@@ -411,10 +670,10 @@ static void remove_pending_alarm(alarm_t* alarm) {
 
 // Must be called with |alarms_mutex| held
 static void schedule_next_instance(alarm_t* alarm) {
-  // If the alarm is currently set and it's at the start of the list,
-  // we'll need to re-schedule since we've adjusted the earliest deadline.
-  bool needs_reschedule =
-      (!list_is_empty(alarms) && list_front(alarms) == alarm);
+  // If the alarm is currently set and the timers are armed for it, we'll need
+  // to re-schedule since we've adjusted the earliest deadline.
+  bool needs_reschedule = (alarm->wheel_slot != NULL &&
+                           alarm->deadline_ms <= timer_deadline_ms);
   if (alarm->callback) remove_pending_alarm(alarm);
 
   // Calculate the next deadline for this alarm
@@ -423,28 +682,16 @@ static void schedule_next_instance(alarm_t* alarm) {
   if ((alarm->is_periodic) && (alarm->period_ms != 0))
     ms_into_period =
         ((just_now_ms - alarm->creation_time_ms) % alarm->period_ms);
-  alarm->deadline_ms = just_now_ms + (alarm->period_ms - ms_into_period);
+  uint64_t deadline_ms = just_now_ms + (alarm->period_ms - ms_into_period);
+  alarm->deadline_ms =
+      apply_slack(alarm->alarm_class, deadline_ms, alarm->period_ms);
+  alarm->deferred = (alarm->deadline_ms != deadline_ms);
 
-  // Add it into the timer list sorted by deadline (earliest deadline first).
-  if (list_is_empty(alarms) ||
-      ((alarm_t*)list_front(alarms))->deadline_ms > alarm->deadline_ms) {
-    list_prepend(alarms, alarm);
-  } else {
-    for (list_node_t* node = list_begin(alarms); node != list_end(alarms);
-         node = list_next(node)) {
-      list_node_t* next = list_next(node);
-      if (next == list_end(alarms) ||
-          ((alarm_t*)list_node(next))->deadline_ms > alarm->deadline_ms) {
-        list_insert_after(alarms, node, alarm);
-        break;
-      }
-    }
-  }
+  wheel_insert(alarms, alarm);
 
   // If the new alarm has the earliest deadline, we need to re-evaluate our
   // schedule.
-  if (needs_reschedule ||
-      (!list_is_empty(alarms) && list_front(alarms) == alarm)) {
+  if (needs_reschedule || alarm->deadline_ms < timer_deadline_ms) {
     reschedule_root_alarm();
   }
 }
@@ -454,26 +701,33 @@ static void reschedule_root_alarm(void) {
   CHECK(alarms != NULL);
 
   const bool timer_was_set = timer_set;
-  alarm_t* next;
+  alarm_t* next_alarm;
+  uint64_t next_deadline_ms;
   int64_t next_expiration;
 
   // If used in a zeroed state, disarms the timer.
   struct itimerspec timer_time;
   memset(&timer_time, 0, sizeof(timer_time));
 
-  if (list_is_empty(alarms)) goto done;
+  timer_deadline_ms = UINT64_MAX;
+  next_alarm = wheel_next_alarm(alarms);
+  if (next_alarm == NULL) goto done;
 
-  next = static_cast<alarm_t*>(list_front(alarms));
-  next_expiration = next->deadline_ms - now_ms();
+  next_deadline_ms = next_alarm->deadline_ms;
+  timer_deadline_ms = next_deadline_ms;
+  next_expiration = next_deadline_ms - now_ms();
   if (next_expiration < TIMER_INTERVAL_FOR_WAKELOCK_IN_MS) {
     if (!timer_set) {
-      if (!wakelock_acquire()) {
+      // The wakelock is held until no alarm is due soon, charge it to the
+      // alarm that made it necessary
+      wakelock_holder = next_alarm->stats.name;
+      if (!wakelock_acquire_for(wakelock_holder.c_str())) {
         LOG_ERROR("%s unable to acquire wake lock", __func__);
       }
     }
 
-    timer_time.it_value.tv_sec = (next->deadline_ms / 1000);
-    timer_time.it_value.tv_nsec = (next->deadline_ms % 1000) * 1000000LL;
+    timer_time.it_value.tv_sec = (next_deadline_ms / 1000);
+    timer_time.it_value.tv_nsec = (next_deadline_ms % 1000) * 1000000LL;
 
     // It is entirely unsafe to call timer_settime(2) with a zeroed timerspec
     // for timers with *_ALARM clock IDs. Although the man page states that the
@@ -498,8 +752,8 @@ static void reschedule_root_alarm(void) {
     struct itimerspec wakeup_time;
     memset(&wakeup_time, 0, sizeof(wakeup_time));
 
-    wakeup_time.it_value.tv_sec = (next->deadline_ms / 1000);
-    wakeup_time.it_value.tv_nsec = (next->deadline_ms % 1000) * 1000000LL;
+    wakeup_time.it_value.tv_sec = (next_deadline_ms / 1000);
+    wakeup_time.it_value.tv_nsec = (next_deadline_ms % 1000) * 1000000LL;
     if (timer_settime(wakeup_timer, TIMER_ABSTIME, &wakeup_time, NULL) == -1)
       LOG_ERROR("%s unable to set wakeup timer: %s", __func__, strerror(errno));
   }
@@ -508,7 +762,7 @@ done:
   timer_set =
       timer_time.it_value.tv_sec != 0 || timer_time.it_value.tv_nsec != 0;
   if (timer_was_set && !timer_set) {
-    wakelock_release();
+    wakelock_release_for(wakelock_holder.c_str());
   }
 
   if (timer_settime(timer, TIMER_ABSTIME, &timer_time, NULL) == -1)
@@ -618,40 +872,67 @@ static void callback_dispatch(UNUSED_ATTR void* context) {
     if (!dispatcher_thread_active) break;
 
     std::lock_guard<std::mutex> lock(alarms_mutex);
-    alarm_t* alarm;
-
-    // Take into account that the alarm may get cancelled before we get to it.
-    // We're done here if there are no alarms or the alarm at the front is in
-    // the future. Exit right away since there's nothing left to do.
-    if (list_is_empty(alarms) ||
-        (alarm = static_cast<alarm_t*>(list_front(alarms)))->deadline_ms >
-            now_ms()) {
-      reschedule_root_alarm();
-      continue;
+
+    // Without the wakelock, the signal came from the wakeup timer, which may
+    // have resumed the system
+    const bool from_wakeup_timer = !timer_set;
+
+    // Take into account that the alarms may get cancelled before we get to
+    // them, or that the signal was for an alarm that was rescheduled. All the
+    // alarms whose deadline has passed are dispatched in a single batch. The
+    // batch is detached from the wheel first, so that periodic alarms
+    // rescheduled below are dispatched on the next signal.
+    wheel_advance(alarms, now_ms());
+    alarm_t* next = wheel_take_expired(alarms);
+    size_t batch_count = 0;
+    size_t deferred_count = 0;
+
+    if (from_wakeup_timer && next != NULL) {
+      const char* source = next->stats.name;
+      if (wakeups_by_alarm.size() >= MAX_WAKEUP_SOURCES &&
+          wakeups_by_alarm.count(source) == 0) {
+        source = OTHER_WAKEUP_SOURCE;
+      }
+      wakeups_by_alarm[source]++;
     }
 
-    list_remove(alarms, alarm);
+    while (next != NULL) {
+      alarm_t* alarm = next;
+      next = alarm->wheel_next;
+      alarm->wheel_next = NULL;
 
-    if (alarm->is_periodic) {
-      alarm->prev_deadline_ms = alarm->deadline_ms;
-      schedule_next_instance(alarm);
-      alarm->stats.rescheduled_count++;
-    }
-    reschedule_root_alarm();
+      batch_count++;
+      if (alarm->deferred) deferred_count++;
 
-    // Enqueue the alarm for processing
-    if (alarm->for_msg_loop) {
-      if (!get_main_thread()) {
-        LOG_ERROR("%s: message loop already NULL. Alarm: %s", __func__,
-                  alarm->stats.name);
-        continue;
+      if (alarm->is_periodic) {
+        alarm->prev_deadline_ms = alarm->deadline_ms;
+        schedule_next_instance(alarm);
+        alarm->stats.rescheduled_count++;
       }
 
-      alarm->closure.i.Reset(Bind(alarm_ready_mloop, alarm));
-      get_main_thread()->DoInThread(FROM_HERE, alarm->closure.i.callback());
-    } else {
-      fixed_queue_enqueue(alarm->queue, alarm);
+      // Enqueue the alarm for processing
+      if (alarm->for_msg_loop) {
+        if (!get_main_thread()) {
+          LOG_ERROR("%s: message loop already NULL. Alarm: %s", __func__,
+                    alarm->stats.name);
+          continue;
+        }
+
+        alarm->closure.i.Reset(Bind(alarm_ready_mloop, alarm));
+        get_main_thread()->DoInThread(FROM_HERE, alarm->closure.i.callback());
+      } else {
+        fixed_queue_enqueue(alarm->queue, alarm);
+      }
+    }
+
+    // Each delayed alarm would have woken up the system on its own, except
+    // for one of them if the whole batch was delayed.
+    if (deferred_count > 0) {
+      wakeups_saved +=
+          (deferred_count == batch_count) ? deferred_count - 1 : deferred_count;
     }
+
+    reschedule_root_alarm();
   }
 
   LOG_INFO("%s Callback thread exited", __func__);
@@ -717,24 +998,8 @@ static void dump_stat(int fd, stat_t* stat, const char* description) {
           (unsigned long long)average_time_ms);
 }
 
-void alarm_debug_dump(int fd) {
-  dprintf(fd, "\nBluetooth Alarms Statistics:\n");
-
-  std::lock_guard<std::mutex> lock(alarms_mutex);
-
-  if (alarms == NULL) {
-    dprintf(fd, "  None\n");
-    return;
-  }
-
-  uint64_t just_now_ms = now_ms();
-
-  dprintf(fd, "  Total Alarms: %zu\n\n", list_length(alarms));
-
-  // Dump info for each alarm
-  for (list_node_t* node = list_begin(alarms); node != list_end(alarms);
-       node = list_next(node)) {
-    alarm_t* alarm = (alarm_t*)list_node(node);
+static void dump_slot(int fd, const alarm_slot_t* slot, uint64_t just_now_ms) {
+  for (alarm_t* alarm = slot->head; alarm != NULL; alarm = alarm->wheel_next) {
     alarm_stats_t* stats = &alarm->stats;
 
     dprintf(fd, "  Alarm : %s (%s)\n", stats->name,
@@ -764,3 +1029,33 @@ void alarm_debug_dump(int fd) {
     dprintf(fd, "\n");
   }
 }
+
+void alarm_debug_dump(int fd) {
+  dprintf(fd, "\nBluetooth Alarms Statistics:\n");
+
+  std::lock_guard<std::mutex> lock(alarms_mutex);
+
+  if (alarms == NULL) {
+    dprintf(fd, "  None\n");
+    return;
+  }
+
+  uint64_t just_now_ms = now_ms();
+
+  dprintf(fd, "  Total Alarms: %zu\n", alarms->count);
+  dprintf(fd, "  Wakeups saved by delaying alarms: %zu\n", wakeups_saved);
+  dprintf(fd, "  Wakeups by alarm:\n");
+  for (const auto& [name, count] : wakeups_by_alarm) {
+    dprintf(fd, "    %-47s: %zu\n", name.c_str(), count);
+  }
+  dprintf(fd, "\n");
+
+  // Dump info for each alarm, roughly in the order they will expire
+  dump_slot(fd, &alarms->expired, just_now_ms);
+  for (int level = 0; level < ALARM_WHEEL_LEVELS; level++) {
+    for (int index = 0; index < ALARM_WHEEL_SLOTS; index++) {
+      dump_slot(fd, &alarms->slots[level][index], just_now_ms);
+    }
+  }
+  dump_slot(fd, &alarms->overflow, just_now_ms);
+}
@@ -18,11 +18,299 @@
 #include "osi/include/allocator.h"
 
 #include <base/logging.h>
+#include <pthread.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include "check.h"
 
+namespace {
+
+// Buffer sizes the legacy stack allocates on every packet: small control
+// buffers, BT_SMALL_BUFFER_SIZE, L2CAP_MTU_SIZE and BT_DEFAULT_BUFFER_SIZE
+// plus the BT_HDR header and some headroom.
+struct SizeClassConfig {
+  size_t block_size;
+  size_t block_count;
+};
+
+constexpr SizeClassConfig kSizeClasses[] = {
+    {64, 512}, {256, 512}, {704, 256}, {1792, 128}, {4160, 64},
+};
+constexpr size_t kNumSizeClasses =
+    sizeof(kSizeClasses) / sizeof(kSizeClasses[0]);
+constexpr size_t kMaxPooledSize = kSizeClasses[kNumSizeClasses - 1].block_size;
+
+// Number of blocks a thread with a local cache keeps per size class before
+// returning them to the shared free list.
+constexpr size_t kMagazineSize = 16;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct SizeClass {
+  size_t block_size{0};
+  uint8_t* begin{nullptr};
+  uint8_t* end{nullptr};
+
+  std::mutex mutex;
+  FreeBlock* free_list{nullptr};
+
+  std::atomic<size_t> in_use{0};
+  std::atomic<size_t> max_in_use{0};
+  std::atomic<uint64_t> alloc_count{0};
+  std::atomic<uint64_t> fallback_count{0};
+  std::atomic<uint64_t> magazine_hit_count{0};
+};
+
+struct Pool {
+  uint8_t* begin{nullptr};
+  uint8_t* end{nullptr};
+  SizeClass classes[kNumSizeClasses];
+};
+
+Pool pool;
+std::atomic<bool> pool_enabled{false};
+std::once_flag pool_once;
+
+// Per-thread cache of free blocks, only used on threads that opted in
+// through osi_allocator_thread_cache_enable().
+struct Magazine {
+  bool enabled{false};
+  size_t count[kNumSizeClasses]{};
+  FreeBlock* blocks[kNumSizeClasses][kMagazineSize];
+
+  ~Magazine() {
+    for (size_t i = 0; i < kNumSizeClasses; i++) {
+      SizeClass& size_class = pool.classes[i];
+      std::lock_guard<std::mutex> lock(size_class.mutex);
+      while (count[i] > 0) {
+        FreeBlock* block = blocks[i][--count[i]];
+        block->next = size_class.free_list;
+        size_class.free_list = block;
+      }
+    }
+  }
+};
+
+thread_local Magazine magazine;
+
+// Allocation tagging. The tag and size of each allocation are kept out of the
+// buffer: in a table per size class for pool blocks, in a map for the larger
+// allocations served by the system allocator.
+constexpr size_t kMaxTags = 32;
+constexpr size_t kMaxTagNameLength = 32;
+constexpr uint16_t kOtherTag = 0;
+constexpr uint16_t kUntrackedTag = UINT16_MAX;
+
+struct AllocationTag {
+  uint16_t tag{kUntrackedTag};
+  uint32_t size{0};
+};
+
+struct TagStats {
+  char name[kMaxTagNameLength]{};
+  std::atomic<int64_t> live_bytes{0};
+  std::atomic<int64_t> peak_bytes{0};
+  std::atomic<uint64_t> alloc_count{0};
+  // Allocation count at the previous dump, for the allocation rate
+  uint64_t dumped_alloc_count{0};
+};
+
+struct Tags {
+  // Protects the tag registration and |large_allocations|
+  std::mutex mutex;
+  size_t count{0};
+  TagStats stats[kMaxTags];
+  std::unique_ptr<AllocationTag[]> blocks[kNumSizeClasses];
+  std::unordered_map<void*, AllocationTag> large_allocations;
+  std::chrono::steady_clock::time_point dump_time;
+};
+
+Tags tags;
+std::atomic<bool> tagging_enabled{false};
+std::once_flag tagging_once;
+thread_local int thread_tag = -1;
+
+void pool_create() {
+  size_t total_size = 0;
+  for (const auto& config : kSizeClasses) {
+    total_size += config.block_size * config.block_count;
+  }
+
+  pool.begin = static_cast<uint8_t*>(malloc(total_size));
+  CHECK(pool.begin);
+  pool.end = pool.begin + total_size;
+
+  uint8_t* cursor = pool.begin;
+  for (size_t i = 0; i < kNumSizeClasses; i++) {
+    SizeClass& size_class = pool.classes[i];
+    size_class.block_size = kSizeClasses[i].block_size;
+    size_class.begin = cursor;
+    for (size_t j = 0; j < kSizeClasses[i].block_count; j++) {
+      FreeBlock* block = reinterpret_cast<FreeBlock*>(cursor);
+      block->next = size_class.free_list;
+      size_class.free_list = block;
+      cursor += size_class.block_size;
+    }
+    size_class.end = cursor;
+  }
+  pool_enabled.store(true, std::memory_order_release);
+}
+
+bool pool_owns(const void* ptr) {
+  // The pool is never released once created, so a pointer inside the arena
+  // always belongs to it regardless of when the pool got enabled.
+  return pool_enabled.load(std::memory_order_acquire) &&
+         static_cast<const uint8_t*>(ptr) >= pool.begin &&
+         static_cast<const uint8_t*>(ptr) < pool.end;
+}
+
+void* pool_alloc(size_t size) {
+  if (!pool_enabled.load(std::memory_order_acquire) || size > kMaxPooledSize) {
+    return nullptr;
+  }
+
+  size_t index = 0;
+  while (kSizeClasses[index].block_size < size) index++;
+  SizeClass& size_class = pool.classes[index];
+
+  FreeBlock* block = nullptr;
+  if (magazine.enabled && magazine.count[index] > 0) {
+    block = magazine.blocks[index][--magazine.count[index]];
+    size_class.magazine_hit_count.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    block = size_class.free_list;
+    if (block != nullptr) size_class.free_list = block->next;
+  }
+
+  if (block == nullptr) {
+    size_class.fallback_count.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  size_class.alloc_count.fetch_add(1, std::memory_order_relaxed);
+  size_t in_use = size_class.in_use.fetch_add(1, std::memory_order_relaxed) + 1;
+  size_t max_in_use = size_class.max_in_use.load(std::memory_order_relaxed);
+  while (in_use > max_in_use &&
+         !size_class.max_in_use.compare_exchange_weak(
+             max_in_use, in_use, std::memory_order_relaxed)) {
+  }
+  return block;
+}
+
+void pool_free(void* ptr) {
+  size_t index = 0;
+  while (static_cast<uint8_t*>(ptr) >= pool.classes[index].end) index++;
+  SizeClass& size_class = pool.classes[index];
+  size_class.in_use.fetch_sub(1, std::memory_order_relaxed);
+
+  FreeBlock* block = static_cast<FreeBlock*>(ptr);
+  if (magazine.enabled && magazine.count[index] < kMagazineSize) {
+    magazine.blocks[index][magazine.count[index]++] = block;
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(size_class.mutex);
+  block->next = size_class.free_list;
+  size_class.free_list = block;
+}
+
+uint16_t tag_register(const char* name) {
+  std::lock_guard<std::mutex> lock(tags.mutex);
+  for (size_t i = 0; i < tags.count; i++) {
+    if (strncmp(tags.stats[i].name, name, kMaxTagNameLength - 1) == 0) {
+      return i;
+    }
+  }
+  if (tags.count == kMaxTags) return kOtherTag;
+  snprintf(tags.stats[tags.count].name, kMaxTagNameLength, "%s", name);
+  return tags.count++;
+}
+
+void tagging_create() {
+  osi_allocator_pool_enable();
+  for (size_t i = 0; i < kNumSizeClasses; i++) {
+    tags.blocks[i].reset(new AllocationTag[kSizeClasses[i].block_count]);
+  }
+  tag_register("other");
+  tags.dump_time = std::chrono::steady_clock::now();
+  tagging_enabled.store(true, std::memory_order_release);
+}
+
+uint16_t current_tag() {
+  if (thread_tag < 0) {
+    char name[16] = "other";
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    thread_tag = tag_register(name);
+  }
+  return thread_tag;
+}
+
+AllocationTag& pool_block_tag(const void* ptr) {
+  size_t index = 0;
+  while (static_cast<const uint8_t*>(ptr) >= pool.classes[index].end) index++;
+  const SizeClass& size_class = pool.classes[index];
+  size_t block = (static_cast<const uint8_t*>(ptr) - size_class.begin) /
+                 size_class.block_size;
+  return tags.blocks[index][block];
+}
+
+void tag_alloc(void* ptr, size_t size) {
+  if (!tagging_enabled.load(std::memory_order_acquire)) return;
+
+  AllocationTag allocation = {current_tag(), static_cast<uint32_t>(size)};
+  if (pool_owns(ptr)) {
+    pool_block_tag(ptr) = allocation;
+  } else {
+    std::lock_guard<std::mutex> lock(tags.mutex);
+    tags.large_allocations[ptr] = allocation;
+  }
+
+  TagStats& stats = tags.stats[allocation.tag];
+  stats.alloc_count.fetch_add(1, std::memory_order_relaxed);
+  int64_t live_bytes =
+      stats.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  int64_t peak_bytes = stats.peak_bytes.load(std::memory_order_relaxed);
+  while (live_bytes > peak_bytes &&
+         !stats.peak_bytes.compare_exchange_weak(peak_bytes, live_bytes,
+                                                 std::memory_order_relaxed)) {
+  }
+}
+
+void tag_free(void* ptr) {
+  if (!tagging_enabled.load(std::memory_order_acquire)) return;
+
+  AllocationTag allocation;
+  if (pool_owns(ptr)) {
+    AllocationTag& block_tag = pool_block_tag(ptr);
+    allocation = block_tag;
+    block_tag.tag = kUntrackedTag;
+  } else {
+    std::lock_guard<std::mutex> lock(tags.mutex);
+    auto it = tags.large_allocations.find(ptr);
+    if (it == tags.large_allocations.end()) return;
+    allocation = it->second;
+    tags.large_allocations.erase(it);
+  }
+  if (allocation.tag == kUntrackedTag) return;
+
+  tags.stats[allocation.tag].live_bytes.fetch_sub(allocation.size,
+                                                  std::memory_order_relaxed);
+}
+
+}  // namespace
+
 char* osi_strdup(const char* str) {
   size_t size = strlen(str) + 1;  // + 1 for the null terminator
   char* new_string = (char*)malloc(size);
@@ -50,19 +338,36 @@ char* osi_strndup(const char* str, size_t len) {
 
 void* osi_malloc(size_t size) {
   CHECK(static_cast<ssize_t>(size) >= 0);
-  void* ptr = malloc(size);
-  CHECK(ptr);
+  void* ptr = pool_alloc(size);
+  if (ptr == nullptr) {
+    ptr = malloc(size);
+    CHECK(ptr);
+  }
+  tag_alloc(ptr, size);
   return ptr;
 }
 
 void* osi_calloc(size_t size) {
   CHECK(static_cast<ssize_t>(size) >= 0);
-  void* ptr = calloc(1, size);
-  CHECK(ptr);
+  void* ptr = pool_alloc(size);
+  if (ptr != nullptr) {
+    memset(ptr, 0, size);
+  } else {
+    ptr = calloc(1, size);
+    CHECK(ptr);
+  }
+  tag_alloc(ptr, size);
   return ptr;
 }
 
-void osi_free(void* ptr) { free(ptr); }
+void osi_free(void* ptr) {
+  if (ptr != nullptr) tag_free(ptr);
+  if (ptr != nullptr && pool_owns(ptr)) {
+    pool_free(ptr);
+    return;
+  }
+  free(ptr);
+}
 
 void osi_free_and_reset(void** p_ptr) {
   CHECK(p_ptr != NULL);
@@ -70,6 +375,90 @@ void osi_free_and_reset(void** p_ptr) {
   *p_ptr = NULL;
 }
 
+void osi_allocator_pool_enable(void) { std::call_once(pool_once, pool_create); }
+
+bool osi_allocator_pool_is_enabled(void) {
+  return pool_enabled.load(std::memory_order_acquire);
+}
+
+void osi_allocator_thread_cache_enable(void) { magazine.enabled = true; }
+
+void osi_allocator_tagging_enable(void) {
+  std::call_once(tagging_once, tagging_create);
+}
+
+bool osi_allocator_tagging_is_enabled(void) {
+  return tagging_enabled.load(std::memory_order_acquire);
+}
+
+void osi_allocator_set_thread_tag(const char* tag) {
+  thread_tag = tag_register(tag);
+}
+
+int64_t osi_allocator_get_tag_live_bytes(const char* tag) {
+  std::lock_guard<std::mutex> lock(tags.mutex);
+  for (size_t i = 0; i < tags.count; i++) {
+    if (strncmp(tags.stats[i].name, tag, kMaxTagNameLength - 1) == 0) {
+      return tags.stats[i].live_bytes.load(std::memory_order_relaxed);
+    }
+  }
+  return 0;
+}
+
+static void osi_allocator_tags_dump(int fd) {
+  std::lock_guard<std::mutex> lock(tags.mutex);
+  auto now = std::chrono::steady_clock::now();
+  double elapsed_s =
+      std::chrono::duration<double>(now - tags.dump_time).count();
+  tags.dump_time = now;
+
+  dprintf(fd, "\nBluetooth Allocator Tags:\n");
+  dprintf(fd, "  %-31s %12s %12s %12s %12s\n", "Tag", "Live bytes",
+          "Peak bytes", "Allocs", "Allocs/s");
+  for (size_t i = 0; i < tags.count; i++) {
+    TagStats& stats = tags.stats[i];
+    uint64_t alloc_count = stats.alloc_count.load(std::memory_order_relaxed);
+    double rate = elapsed_s > 0
+                      ? (alloc_count - stats.dumped_alloc_count) / elapsed_s
+                      : 0;
+    stats.dumped_alloc_count = alloc_count;
+    dprintf(fd, "  %-31s %12lld %12lld %12llu %12.1f\n", stats.name,
+            (long long)stats.live_bytes.load(std::memory_order_relaxed),
+            (long long)stats.peak_bytes.load(std::memory_order_relaxed),
+            (unsigned long long)alloc_count, rate);
+  }
+}
+
+void osi_allocator_debug_dump(int fd) {
+  dprintf(fd, "\nBluetooth Allocator Pool Statistics:\n");
+
+  if (!osi_allocator_pool_is_enabled()) {
+    dprintf(fd, "  Disabled\n");
+    return;
+  }
+
+  dprintf(fd, "  %-10s %8s %8s %8s %12s %12s %12s\n", "Block size",
+          "Blocks", "In use", "Max used", "Allocs", "Cache hits",
+          "Fallbacks");
+  for (size_t i = 0; i < kNumSizeClasses; i++) {
+    const SizeClass& size_class = pool.classes[i];
+    dprintf(fd, "  %-10zu %8zu %8zu %8zu %12llu %12llu %12llu\n",
+            size_class.block_size, kSizeClasses[i].block_count,
+            size_class.in_use.load(std::memory_order_relaxed),
+            size_class.max_in_use.load(std::memory_order_relaxed),
+            (unsigned long long)size_class.alloc_count.load(
+                std::memory_order_relaxed),
+            (unsigned long long)size_class.magazine_hit_count.load(
+                std::memory_order_relaxed),
+            (unsigned long long)size_class.fallback_count.load(
+                std::memory_order_relaxed));
+  }
+
+  if (osi_allocator_tagging_is_enabled()) {
+    osi_allocator_tags_dump(fd);
+  }
+}
+
 const allocator_t allocator_calloc = {osi_calloc, osi_free};
 
 const allocator_t allocator_malloc = {osi_malloc, osi_free};
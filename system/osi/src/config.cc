@@ -32,16 +32,16 @@
 
 #include <cerrno>
 #include <sstream>
+#include <string_view>
 #include <type_traits>
 
 #include "check.h"
 
 void section_t::Set(std::string key, std::string value) {
-  for (entry_t& entry : entries) {
-    if (entry.key == key) {
-      entry.value = value;
-      return;
-    }
+  auto entry = entries.Find(key);
+  if (entry != entries.end()) {
+    entry->value = std::move(value);
+    return;
   }
   // add a new key to the section
   entries.emplace_back(
@@ -49,9 +49,7 @@ void section_t::Set(std::string key, std::string value) {
 }
 
 std::list<entry_t>::iterator section_t::Find(const std::string& key) {
-  return std::find_if(
-      entries.begin(), entries.end(),
-      [&key](const entry_t& entry) { return entry.key == key; });
+  return entries.Find(key);
 }
 
 bool section_t::Has(const std::string& key) {
@@ -59,9 +57,7 @@ bool section_t::Has(const std::string& key) {
 }
 
 std::list<section_t>::iterator config_t::Find(const std::string& section) {
-  return std::find_if(
-      sections.begin(), sections.end(),
-      [&section](const section_t& sec) { return sec.name == section; });
+  return sections.Find(section);
 }
 
 bool config_t::Has(const std::string& key) {
@@ -74,9 +70,7 @@ template <typename T,
           class = typename std::enable_if<std::is_same<
               config_t, typename std::remove_const<T>::type>::value>>
 static auto section_find(T& config, const std::string& section) {
-  return std::find_if(
-      config.sections.begin(), config.sections.end(),
-      [&section](const section_t& sec) { return sec.name == section; });
+  return config.sections.Find(section);
 }
 
 static const entry_t* entry_find(const config_t& config,
@@ -85,11 +79,10 @@ static const entry_t* entry_find(const config_t& config,
   auto sec = section_find(config, section);
   if (sec == config.sections.end()) return nullptr;
 
-  for (const entry_t& entry : sec->entries) {
-    if (entry.key == key) return &entry;
-  }
+  auto entry = sec->entries.Find(key);
+  if (entry == sec->entries.end()) return nullptr;
 
-  return nullptr;
+  return &*entry;
 }
 
 std::unique_ptr<config_t> config_new_empty(void) {
@@ -224,14 +217,7 @@ void config_set_string(config_t* config, const std::string& section,
     value_no_newline = value;
   }
 
-  for (entry_t& entry : sec->entries) {
-    if (entry.key == key) {
-      entry.value = value_no_newline;
-      return;
-    }
-  }
-
-  sec->entries.emplace_back(entry_t{.key = key, .value = value_no_newline});
+  sec->Set(key, std::move(value_no_newline));
 }
 
 bool config_remove_section(config_t* config, const std::string& section) {
@@ -250,15 +236,11 @@ bool config_remove_key(config_t* config, const std::string& section,
   auto sec = section_find(*config, section);
   if (sec == config->sections.end()) return false;
 
-  for (auto entry = sec->entries.begin(); entry != sec->entries.end();
-       ++entry) {
-    if (entry->key == key) {
-      sec->entries.erase(entry);
-      return true;
-    }
-  }
+  auto entry = sec->entries.Find(key);
+  if (entry == sec->entries.end()) return false;
 
-  return false;
+  sec->entries.erase(entry);
+  return true;
 }
 
 bool config_save(const config_t& config, const std::string& filename) {
@@ -477,15 +459,11 @@ error2:
   return false;
 }
 
-static char* trim(char* str) {
-  while (isspace(*str)) ++str;
-
-  if (!*str) return str;
-
-  char* end_str = str + strlen(str) - 1;
-  while (end_str > str && isspace(*end_str)) --end_str;
-
-  end_str[1] = '\0';
+static std::string_view trim(std::string_view str) {
+  while (!str.empty() && isspace(static_cast<unsigned char>(str.front())))
+    str.remove_prefix(1);
+  while (!str.empty() && isspace(static_cast<unsigned char>(str.back())))
+    str.remove_suffix(1);
   return str;
 }
 
@@ -493,37 +471,66 @@ static bool config_parse(FILE* fp, config_t* config) {
   CHECK(fp != nullptr);
   CHECK(config != nullptr);
 
-  int line_num = 0;
-  char line[4096];
-  char section[4096];
-  strcpy(section, CONFIG_DEFAULT_SECTION);
+  // Read the whole file at once and parse its lines in place.
+  std::string content;
+  struct stat st;
+  if (fstat(fileno(fp), &st) == 0 && st.st_size > 0) {
+    content.reserve(st.st_size);
+  }
+  char buffer[4096];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+    content.append(buffer, read);
+  }
+  if (ferror(fp)) {
+    LOG(ERROR) << __func__ << ": unable to read file: " << strerror(errno);
+    return false;
+  }
 
-  while (fgets(line, sizeof(line), fp)) {
-    char* line_ptr = trim(line);
+  int line_num = 0;
+  std::string_view section = CONFIG_DEFAULT_SECTION;
+  // Section of |config| the key/value pairs of |section| go to. It is looked
+  // up when the first pair is found so that empty sections are not created.
+  section_t* current = nullptr;
+
+  std::string_view remaining = content;
+  while (!remaining.empty()) {
+    size_t line_end = remaining.find('\n');
+    std::string_view line = remaining.substr(0, line_end);
+    remaining.remove_prefix(
+        line_end == std::string_view::npos ? remaining.size() : line_end + 1);
     ++line_num;
+    // Text following a NUL character on a line is ignored.
+    line = trim(line.substr(0, line.find('\0')));
 
     // Skip blank and comment lines.
-    if (*line_ptr == '\0' || *line_ptr == '#') continue;
+    if (line.empty() || line.front() == '#') continue;
 
-    if (*line_ptr == '[') {
-      size_t len = strlen(line_ptr);
-      if (line_ptr[len - 1] != ']') {
+    if (line.front() == '[') {
+      if (line.back() != ']') {
         VLOG(1) << __func__ << ": unterminated section name on line "
                 << line_num;
         return false;
       }
-      strncpy(section, line_ptr + 1, len - 2);  // NOLINT (len < 4096)
-      section[len - 2] = '\0';
+      section = line.substr(1, line.size() - 2);
+      current = nullptr;
     } else {
-      char* split = strchr(line_ptr, '=');
-      if (!split) {
+      size_t split = line.find('=');
+      if (split == std::string_view::npos) {
         VLOG(1) << __func__ << ": no key/value separator found on line "
                 << line_num;
         return false;
       }
 
-      *split = '\0';
-      config_set_string(config, section, trim(line_ptr), trim(split + 1));
+      if (current == nullptr) {
+        auto sec = config->sections.Find(section);
+        current = sec != config->sections.end()
+                      ? &*sec
+                      : &config->sections.emplace_back(
+                            section_t{.name = std::string(section)});
+      }
+      current->Set(std::string(trim(line.substr(0, split))),
+                   std::string(trim(line.substr(split + 1))));
     }
   }
   return true;
@@ -18,6 +18,10 @@
 
 #include <base/logging.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
 
 #include "check.h"
 #include "osi/include/allocator.h"
@@ -25,51 +29,73 @@
 
 struct ringbuffer_t {
   size_t total;
-  size_t available;
+  // Number of bytes in the buffer. Written by both the producer and the
+  // consumer, which own |tail| and |head| respectively: the release and
+  // acquire ordering makes the bytes it accounts for visible to the other
+  // side.
+  std::atomic<size_t> size;
   uint8_t* base;
   uint8_t* head;
   uint8_t* tail;
 };
 
+// Splits the |length| bytes starting at |start| around the end of the buffer
+static void ringbuffer_split(const ringbuffer_t* rb, uint8_t* start,
+                             size_t length, ringbuffer_spans_t* spans) {
+  const size_t to_end = rb->base + rb->total - start;
+  spans->first = start;
+  spans->first_length = std::min(length, to_end);
+  spans->second_length = length - spans->first_length;
+  spans->second = spans->second_length > 0 ? rb->base : NULL;
+}
+
+// Advances |p| by |length| bytes, wrapping around the end of the buffer
+static uint8_t* ringbuffer_advance(const ringbuffer_t* rb, uint8_t* p,
+                                   size_t length) {
+  p += length;
+  if (p >= (rb->base + rb->total)) p -= rb->total;
+  return p;
+}
+
 ringbuffer_t* ringbuffer_init(const size_t size) {
-  ringbuffer_t* p =
-      static_cast<ringbuffer_t*>(osi_calloc(sizeof(ringbuffer_t)));
+  ringbuffer_t* p = new ringbuffer_t;
 
   p->base = static_cast<uint8_t*>(osi_calloc(size));
   p->head = p->tail = p->base;
-  p->total = p->available = size;
+  p->total = size;
+  p->size = 0;
 
   return p;
 }
 
 void ringbuffer_free(ringbuffer_t* rb) {
   if (rb != NULL) osi_free(rb->base);
-  osi_free(rb);
+  delete rb;
 }
 
 size_t ringbuffer_available(const ringbuffer_t* rb) {
   CHECK(rb);
-  return rb->available;
+  return rb->total - rb->size.load(std::memory_order_acquire);
 }
 
 size_t ringbuffer_size(const ringbuffer_t* rb) {
   CHECK(rb);
-  return rb->total - rb->available;
+  return rb->size.load(std::memory_order_acquire);
 }
 
 size_t ringbuffer_insert(ringbuffer_t* rb, const uint8_t* p, size_t length) {
   CHECK(rb);
   CHECK(p);
 
-  if (length > ringbuffer_available(rb)) length = ringbuffer_available(rb);
+  ringbuffer_spans_t spans;
+  length = std::min(length, ringbuffer_writable_spans(rb, &spans));
+  if (length == 0) return 0;
 
-  for (size_t i = 0; i != length; ++i) {
-    *rb->tail++ = *p++;
-    if (rb->tail >= (rb->base + rb->total)) rb->tail = rb->base;
-  }
+  const size_t first = std::min(length, spans.first_length);
+  memcpy(spans.first, p, first);
+  if (length > first) memcpy(spans.second, p + first, length - first);
 
-  rb->available -= length;
-  return length;
+  return ringbuffer_commit_write(rb, length);
 }
 
 size_t ringbuffer_delete(ringbuffer_t* rb, size_t length) {
@@ -77,10 +103,8 @@ size_t ringbuffer_delete(ringbuffer_t* rb, size_t length) {
 
   if (length > ringbuffer_size(rb)) length = ringbuffer_size(rb);
 
-  rb->head += length;
-  if (rb->head >= (rb->base + rb->total)) rb->head -= rb->total;
-
-  rb->available += length;
+  rb->head = ringbuffer_advance(rb, rb->head, length);
+  rb->size.fetch_sub(length, std::memory_order_release);
   return length;
 }
 
@@ -89,16 +113,19 @@ size_t ringbuffer_peek(const ringbuffer_t* rb, off_t offset, uint8_t* p,
   CHECK(rb);
   CHECK(p);
   CHECK(offset >= 0);
-  CHECK((size_t)offset <= ringbuffer_size(rb));
-
-  uint8_t* b = ((rb->head - rb->base + offset) % rb->total) + rb->base;
-  const size_t bytes_to_copy = (offset + length > ringbuffer_size(rb))
-                                   ? ringbuffer_size(rb) - offset
-                                   : length;
-
-  for (size_t copied = 0; copied < bytes_to_copy; ++copied) {
-    *p++ = *b++;
-    if (b >= (rb->base + rb->total)) b = rb->base;
+  const size_t size = ringbuffer_size(rb);
+  CHECK((size_t)offset <= size);
+
+  const size_t bytes_to_copy =
+      (offset + length > size) ? size - offset : length;
+  if (bytes_to_copy == 0) return 0;
+
+  ringbuffer_spans_t spans;
+  ringbuffer_split(rb, ringbuffer_advance(rb, rb->head, offset), bytes_to_copy,
+                   &spans);
+  memcpy(p, spans.first, spans.first_length);
+  if (spans.second_length > 0) {
+    memcpy(p + spans.first_length, spans.second, spans.second_length);
   }
 
   return bytes_to_copy;
@@ -109,9 +136,34 @@ size_t ringbuffer_pop(ringbuffer_t* rb, uint8_t* p, size_t length) {
   CHECK(p);
 
   const size_t copied = ringbuffer_peek(rb, 0, p, length);
-  rb->head += copied;
-  if (rb->head >= (rb->base + rb->total)) rb->head -= rb->total;
+  return ringbuffer_delete(rb, copied);
+}
 
-  rb->available += copied;
-  return copied;
+size_t ringbuffer_readable_spans(const ringbuffer_t* rb,
+                                 ringbuffer_spans_t* spans) {
+  CHECK(rb);
+  CHECK(spans);
+
+  const size_t size = ringbuffer_size(rb);
+  ringbuffer_split(rb, rb->head, size, spans);
+  return size;
+}
+
+size_t ringbuffer_writable_spans(ringbuffer_t* rb, ringbuffer_spans_t* spans) {
+  CHECK(rb);
+  CHECK(spans);
+
+  const size_t available = ringbuffer_available(rb);
+  ringbuffer_split(rb, rb->tail, available, spans);
+  return available;
+}
+
+size_t ringbuffer_commit_write(ringbuffer_t* rb, size_t length) {
+  CHECK(rb);
+
+  if (length > ringbuffer_available(rb)) length = ringbuffer_available(rb);
+
+  rb->tail = ringbuffer_advance(rb, rb->tail, length);
+  rb->size.fetch_add(length, std::memory_order_release);
+  return length;
 }
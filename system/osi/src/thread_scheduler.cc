@@ -14,11 +14,114 @@
  * limitations under the License.
  */
 
+#define LOG_TAG "bt_osi_thread_scheduler"
+
+#include "osi/include/thread_scheduler.h"
+
 #include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/sysinfo.h>
 #include <sys/types.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "os/log.h"
+#include "osi/include/properties.h"
 
 namespace {
 constexpr int kRealTimeFifoSchedulingPriority = 1;
+
+constexpr char kPolicyPropertyPrefix[] = "bluetooth.core.thread_policy.";
+
+// Threads on the audio and HCI data paths are real time by default, the
+// other threads inherit the policy of their creator.
+const std::map<std::string, thread_policy_t> kDefaultPolicies = {
+    {"bt_a2dp_source_worker_thread",
+     {true, kRealTimeFifoSchedulingPriority, THREAD_CPU_ANY}},
+    {"bt_a2dp_sink_worker_thread",
+     {true, kRealTimeFifoSchedulingPriority, THREAD_CPU_ANY}},
+    {"bt_le_audio_unicast_sink_worker_thread",
+     {true, kRealTimeFifoSchedulingPriority, THREAD_CPU_ANY}},
+    {"bt_le_audio_broadcast_sink_worker_thread",
+     {true, kRealTimeFifoSchedulingPriority, THREAD_CPU_ANY}},
+    {"gd_stack_thread",
+     {true, kRealTimeFifoSchedulingPriority, THREAD_CPU_ANY}},
+    {"bt_jni_thread", {false, 0, THREAD_CPU_ANY}},
+};
+
+struct CpuClasses {
+  cpu_set_t performance;
+  cpu_set_t efficiency;
+};
+
+// Splits the CPUs by their capacity, read once from sysfs
+const CpuClasses& get_cpu_classes() {
+  static CpuClasses classes;
+  static std::once_flag once;
+  std::call_once(once, []() {
+    int num_cpus = get_nprocs_conf();
+    if (num_cpus > CPU_SETSIZE) num_cpus = CPU_SETSIZE;
+    long capacities[CPU_SETSIZE];
+    long max_capacity = -1;
+    bool known = true;
+    for (int cpu = 0; cpu < num_cpus; cpu++) {
+      char path[64];
+      snprintf(path, sizeof(path),
+               "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpu);
+      capacities[cpu] = -1;
+      FILE* file = fopen(path, "r");
+      if (file != nullptr) {
+        if (fscanf(file, "%ld", &capacities[cpu]) != 1) capacities[cpu] = -1;
+        fclose(file);
+      }
+      if (capacities[cpu] < 0) known = false;
+      if (capacities[cpu] > max_capacity) max_capacity = capacities[cpu];
+    }
+
+    CPU_ZERO(&classes.performance);
+    CPU_ZERO(&classes.efficiency);
+    for (int cpu = 0; cpu < num_cpus; cpu++) {
+      if (!known || capacities[cpu] == max_capacity) {
+        CPU_SET(cpu, &classes.performance);
+      }
+      if (!known || capacities[cpu] < max_capacity) {
+        CPU_SET(cpu, &classes.efficiency);
+      }
+    }
+    // Homogeneous SoC, every CPU is in both classes
+    if (CPU_COUNT(&classes.efficiency) == 0) {
+      classes.efficiency = classes.performance;
+    }
+  });
+  return classes;
+}
+
+const char* cpu_class_text(thread_cpu_class_t cpu_class) {
+  switch (cpu_class) {
+    case THREAD_CPU_ANY:
+      return "any";
+    case THREAD_CPU_PERFORMANCE:
+      return "performance";
+    case THREAD_CPU_EFFICIENCY:
+      return "efficiency";
+  }
+  return "unknown";
+}
+
+struct RegisteredThread {
+  pid_t linux_tid;
+  thread_policy_t policy;
+};
+
+std::mutex registered_threads_mutex;
+std::map<std::string, RegisteredThread> registered_threads;
 }  // namespace
 
 bool thread_scheduler_enable_real_time(pid_t linux_tid) {
@@ -32,3 +135,122 @@ bool thread_scheduler_get_priority_range(int& min, int& max) {
   max = sched_get_priority_max(SCHED_FIFO);
   return (min != -1 && max != -1) ? true : false;
 }
+
+bool thread_scheduler_parse_policy(const char* value, thread_policy_t* policy) {
+  std::string text(value);
+  std::string scheduling = text.substr(0, text.find(','));
+  std::string cpus = scheduling.size() < text.size()
+                         ? text.substr(scheduling.size() + 1)
+                         : std::string("any");
+
+  thread_policy_t parsed = {false, 0, THREAD_CPU_ANY};
+  if (scheduling == "fifo") {
+    parsed.real_time = true;
+    parsed.priority = kRealTimeFifoSchedulingPriority;
+  } else if (scheduling.rfind("fifo:", 0) == 0) {
+    char* end = nullptr;
+    const char* number = scheduling.c_str() + strlen("fifo:");
+    long priority = strtol(number, &end, 10);
+    if (end == number || *end != '\0' ||
+        priority < sched_get_priority_min(SCHED_FIFO) ||
+        priority > sched_get_priority_max(SCHED_FIFO)) {
+      return false;
+    }
+    parsed.real_time = true;
+    parsed.priority = static_cast<int>(priority);
+  } else if (scheduling != "other") {
+    return false;
+  }
+
+  if (cpus == "performance") {
+    parsed.cpu_class = THREAD_CPU_PERFORMANCE;
+  } else if (cpus == "efficiency") {
+    parsed.cpu_class = THREAD_CPU_EFFICIENCY;
+  } else if (cpus != "any") {
+    return false;
+  }
+
+  *policy = parsed;
+  return true;
+}
+
+thread_policy_t thread_scheduler_get_policy(const char* thread_name) {
+  thread_policy_t policy = {false, 0, THREAD_CPU_ANY};
+  auto it = kDefaultPolicies.find(thread_name);
+  if (it != kDefaultPolicies.end()) policy = it->second;
+
+  std::string key = std::string(kPolicyPropertyPrefix) + thread_name;
+  char value[PROPERTY_VALUE_MAX] = {0};
+  if (osi_property_get(key.c_str(), value, "") > 0 &&
+      !thread_scheduler_parse_policy(value, &policy)) {
+    LOG_WARN("%s ignoring malformed %s: %s", __func__, key.c_str(), value);
+  }
+  return policy;
+}
+
+bool thread_scheduler_apply_policy(const char* thread_name) {
+  const thread_policy_t policy = thread_scheduler_get_policy(thread_name);
+  const pid_t linux_tid = static_cast<pid_t>(syscall(SYS_gettid));
+  bool success = true;
+
+  if (policy.real_time) {
+    struct sched_param rt_params = {.sched_priority = policy.priority};
+    if (sched_setscheduler(linux_tid, SCHED_FIFO, &rt_params) != 0) {
+      LOG_ERROR("%s unable to set SCHED_FIFO priority %d for %s, error %s",
+                __func__, policy.priority, thread_name, strerror(errno));
+      success = false;
+    }
+  }
+
+  if (policy.cpu_class != THREAD_CPU_ANY) {
+    const CpuClasses& classes = get_cpu_classes();
+    const cpu_set_t* cpus = policy.cpu_class == THREAD_CPU_PERFORMANCE
+                                ? &classes.performance
+                                : &classes.efficiency;
+    if (sched_setaffinity(linux_tid, sizeof(cpu_set_t), cpus) != 0) {
+      LOG_ERROR("%s unable to restrict %s to %s cores, error %s", __func__,
+                thread_name, cpu_class_text(policy.cpu_class),
+                strerror(errno));
+      success = false;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(registered_threads_mutex);
+  registered_threads[thread_name] = {linux_tid, policy};
+  return success;
+}
+
+void thread_scheduler_debug_dump(int fd) {
+  dprintf(fd, "\nBluetooth Thread Scheduling:\n");
+  dprintf(fd, "  %-42s %7s %6s %-11s %12s %12s %10s\n", "Thread", "Tid",
+          "Policy", "CPUs", "Run (ms)", "Wait (ms)", "Wait/slice");
+
+  std::lock_guard<std::mutex> lock(registered_threads_mutex);
+  for (const auto& [name, thread] : registered_threads) {
+    char policy[16];
+    if (thread.policy.real_time) {
+      snprintf(policy, sizeof(policy), "fifo:%d", thread.policy.priority);
+    } else {
+      snprintf(policy, sizeof(policy), "other");
+    }
+    dprintf(fd, "  %-42s %7d %6s %-11s ", name.c_str(), thread.linux_tid,
+            policy, cpu_class_text(thread.policy.cpu_class));
+
+    // Time on CPU, time runnable but waiting for a CPU, and number of
+    // timeslices, all accounted by the kernel scheduler
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/task/%d/schedstat",
+             thread.linux_tid);
+    unsigned long long run_ns = 0, wait_ns = 0, slices = 0;
+    FILE* file = fopen(path, "r");
+    bool read = file != nullptr &&
+                fscanf(file, "%llu %llu %llu", &run_ns, &wait_ns, &slices) == 3;
+    if (file != nullptr) fclose(file);
+    if (!read) {
+      dprintf(fd, "%12s %12s %10s\n", "-", "-", "-");
+      continue;
+    }
+    dprintf(fd, "%12llu %12llu %8lluus\n", run_ns / 1000000,
+            wait_ns / 1000000, slices > 0 ? wait_ns / slices / 1000 : 0);
+  }
+}
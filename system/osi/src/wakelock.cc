@@ -29,8 +29,12 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <map>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/logging.h"
 #include "common/metrics.h"
@@ -44,6 +48,7 @@ static bool is_native = true;
 
 static const clockid_t CLOCK_ID = CLOCK_BOOTTIME;
 static const char* WAKE_LOCK_ID = "bluetooth_timer";
+static const char* DEFAULT_SOURCE = "unattributed";
 static const std::string DEFAULT_WAKE_LOCK_PATH = "/sys/power/wake_lock";
 static const std::string DEFAULT_WAKE_UNLOCK_PATH = "/sys/power/wake_unlock";
 static std::string wake_lock_path;
@@ -73,6 +78,17 @@ typedef struct {
 
 static wakelock_stats_t wakelock_stats;
 
+// Wakelock statistics of each source the wakelock was acquired for
+typedef struct {
+  bool is_held;
+  size_t acquired_count;
+  uint64_t max_held_interval_ms;
+  uint64_t total_held_interval_ms;
+  uint64_t last_acquired_timestamp_ms;
+} wakelock_source_stats_t;
+
+static std::map<std::string, wakelock_source_stats_t> wakelock_source_stats;
+
 // This mutex ensures that the functions that update and dump the statistics
 // are executed serially.
 static std::mutex stats_mutex;
@@ -84,8 +100,10 @@ static bt_status_t wakelock_release_native(void);
 static void wakelock_initialize(void);
 static void wakelock_initialize_native(void);
 static void reset_wakelock_stats(void);
-static void update_wakelock_acquired_stats(bt_status_t acquired_status);
-static void update_wakelock_released_stats(bt_status_t released_status);
+static void update_wakelock_acquired_stats(bt_status_t acquired_status,
+                                           const char* source);
+static void update_wakelock_released_stats(bt_status_t released_status,
+                                           const char* source);
 
 void wakelock_set_os_callouts(bt_os_callouts_t* callouts) {
   wakelock_os_callouts = callouts;
@@ -93,7 +111,9 @@ void wakelock_set_os_callouts(bt_os_callouts_t* callouts) {
   LOG_INFO("%s set to %s", __func__, (is_native) ? "native" : "non-native");
 }
 
-bool wakelock_acquire(void) {
+bool wakelock_acquire(void) { return wakelock_acquire_for(DEFAULT_SOURCE); }
+
+bool wakelock_acquire_for(const char* source) {
   pthread_once(&initialized, wakelock_initialize);
 
   bt_status_t status = BT_STATUS_FAIL;
@@ -103,7 +123,7 @@ bool wakelock_acquire(void) {
   else
     status = wakelock_acquire_callout();
 
-  update_wakelock_acquired_stats(status);
+  update_wakelock_acquired_stats(status, source);
 
   if (status != BT_STATUS_SUCCESS)
     LOG_ERROR("%s unable to acquire wake lock: %d", __func__, status);
@@ -139,7 +159,9 @@ static bt_status_t wakelock_acquire_native(void) {
   return BT_STATUS_SUCCESS;
 }
 
-bool wakelock_release(void) {
+bool wakelock_release(void) { return wakelock_release_for(DEFAULT_SOURCE); }
+
+bool wakelock_release_for(const char* source) {
   pthread_once(&initialized, wakelock_initialize);
 
   bt_status_t status = BT_STATUS_FAIL;
@@ -149,7 +171,7 @@ bool wakelock_release(void) {
   else
     status = wakelock_release_callout();
 
-  update_wakelock_released_stats(status);
+  update_wakelock_released_stats(status, source);
 
   return (status == BT_STATUS_SUCCESS);
 }
@@ -244,6 +266,7 @@ static void reset_wakelock_stats(void) {
   wakelock_stats.last_acquired_timestamp_ms = 0;
   wakelock_stats.last_released_timestamp_ms = 0;
   wakelock_stats.last_reset_timestamp_ms = now_ms();
+  wakelock_source_stats.clear();
 }
 
 //
@@ -251,10 +274,11 @@ static void reset_wakelock_stats(void) {
 //
 // This function should be called every time when the wakelock is acquired.
 // |acquired_status| is the status code that was return when the wakelock was
-// acquired.
+// acquired, |source| is the source it was acquired for.
 // This function is thread-safe.
 //
-static void update_wakelock_acquired_stats(bt_status_t acquired_status) {
+static void update_wakelock_acquired_stats(bt_status_t acquired_status,
+                                           const char* source) {
   const uint64_t just_now_ms = now_ms();
 
   std::lock_guard<std::mutex> lock(stats_mutex);
@@ -264,6 +288,15 @@ static void update_wakelock_acquired_stats(bt_status_t acquired_status) {
     wakelock_stats.last_acquired_error = acquired_status;
   }
 
+  if (acquired_status == BT_STATUS_SUCCESS) {
+    wakelock_source_stats_t& source_stats = wakelock_source_stats[source];
+    if (!source_stats.is_held) {
+      source_stats.is_held = true;
+      source_stats.acquired_count++;
+      source_stats.last_acquired_timestamp_ms = just_now_ms;
+    }
+  }
+
   if (wakelock_stats.is_acquired) {
     return;
   }
@@ -273,7 +306,8 @@ static void update_wakelock_acquired_stats(bt_status_t acquired_status) {
   wakelock_stats.last_acquired_timestamp_ms = just_now_ms;
 
   BluetoothMetricsLogger::GetInstance()->LogWakeEvent(
-      bluetooth::common::WAKE_EVENT_ACQUIRED, "", "", just_now_ms);
+      bluetooth::common::WAKE_EVENT_ACQUIRED, source, WAKE_LOCK_ID,
+      just_now_ms);
 }
 
 //
@@ -281,10 +315,11 @@ static void update_wakelock_acquired_stats(bt_status_t acquired_status) {
 //
 // This function should be called every time when the wakelock is released.
 // |released_status| is the status code that was return when the wakelock was
-// released.
+// released, |source| is the source it was released for.
 // This function is thread-safe.
 //
-static void update_wakelock_released_stats(bt_status_t released_status) {
+static void update_wakelock_released_stats(bt_status_t released_status,
+                                           const char* source) {
   const uint64_t just_now_ms = now_ms();
 
   std::lock_guard<std::mutex> lock(stats_mutex);
@@ -294,6 +329,16 @@ static void update_wakelock_released_stats(bt_status_t released_status) {
     wakelock_stats.last_released_error = released_status;
   }
 
+  auto it = wakelock_source_stats.find(source);
+  if (it != wakelock_source_stats.end() && it->second.is_held) {
+    wakelock_source_stats_t& source_stats = it->second;
+    uint64_t held_ms = just_now_ms - source_stats.last_acquired_timestamp_ms;
+    source_stats.is_held = false;
+    source_stats.total_held_interval_ms += held_ms;
+    source_stats.max_held_interval_ms =
+        std::max(source_stats.max_held_interval_ms, held_ms);
+  }
+
   if (!wakelock_stats.is_acquired) {
     return;
   }
@@ -315,7 +360,8 @@ static void update_wakelock_released_stats(bt_status_t released_status) {
   wakelock_stats.total_acquired_interval_ms += delta_ms;
 
   BluetoothMetricsLogger::GetInstance()->LogWakeEvent(
-      bluetooth::common::WAKE_EVENT_RELEASED, "", "", just_now_ms);
+      bluetooth::common::WAKE_EVENT_RELEASED, source, WAKE_LOCK_ID,
+      just_now_ms);
 }
 
 void wakelock_debug_dump(int fd) {
@@ -363,4 +409,31 @@ void wakelock_debug_dump(int fd) {
   dprintf(fd, "  Total run time (ms)            : %llu\n",
           (unsigned long long)(just_now_ms -
                                wakelock_stats.last_reset_timestamp_ms));
+
+  if (wakelock_source_stats.empty()) return;
+
+  // Sources holding the wakelock the longest first
+  std::vector<std::pair<std::string, wakelock_source_stats_t>> sources(
+      wakelock_source_stats.begin(), wakelock_source_stats.end());
+  for (auto& [source, source_stats] : sources) {
+    if (source_stats.is_held) {
+      uint64_t held_ms = just_now_ms - source_stats.last_acquired_timestamp_ms;
+      source_stats.total_held_interval_ms += held_ms;
+      source_stats.max_held_interval_ms =
+          std::max(source_stats.max_held_interval_ms, held_ms);
+    }
+  }
+  std::sort(sources.begin(), sources.end(), [](const auto& a, const auto& b) {
+    return a.second.total_held_interval_ms > b.second.total_held_interval_ms;
+  });
+
+  dprintf(fd, "  Acquired time by source:\n");
+  dprintf(fd, "    %-40s %5s %10s %12s %10s\n", "Source", "Held", "Acquired",
+          "Total (ms)", "Max (ms)");
+  for (const auto& [source, source_stats] : sources) {
+    dprintf(fd, "    %-40s %5s %10zu %12llu %10llu\n", source.c_str(),
+            source_stats.is_held ? "yes" : "no", source_stats.acquired_count,
+            (unsigned long long)source_stats.total_held_interval_ms,
+            (unsigned long long)source_stats.max_held_interval_ms);
+  }
 }
@@ -198,6 +198,25 @@ TEST_F(AlarmTest, test_set_long) {
   alarm_free(alarm);
 }
 
+TEST_F(AlarmTest, test_set_lazy) {
+  alarm_t* alarm = alarm_new("alarm_test.test_set_lazy");
+  alarm_set_class(alarm, ALARM_CLASS_LAZY);
+  alarm_set(alarm, 100, cb, NULL);
+
+  // The alarm may be delayed by up to 1/8 of its interval.
+  uint64_t remaining_ms = alarm_get_remaining_ms(alarm);
+  EXPECT_GE(remaining_ms, 100 - EPSILON_MS);
+  EXPECT_LE(remaining_ms, 112u);
+  EXPECT_EQ(cb_counter, 0);
+
+  semaphore_wait(semaphore);
+
+  EXPECT_EQ(cb_counter, 1);
+  EXPECT_FALSE(is_wake_lock_acquired);
+
+  alarm_free(alarm);
+}
+
 TEST_F(AlarmTest, test_set_short_short) {
   alarm_t* alarm[2] = {alarm_new("alarm_test.test_set_short_short_0"),
                        alarm_new("alarm_test.test_set_short_short_1")};
@@ -318,6 +337,36 @@ TEST_F(AlarmTest, test_callback_ordering) {
   EXPECT_FALSE(is_wake_lock_acquired);
 }
 
+// Test whether the callbacks are invoked in deadline order when the alarms are
+// set in the reverse order, with deadlines filed at different timer wheel
+// levels.
+TEST_F(AlarmTest, test_callback_ordering_reverse) {
+  const uint64_t intervals_ms[] = {10, 50, 100, 300, 700};
+  const int num_alarms = sizeof(intervals_ms) / sizeof(intervals_ms[0]);
+  alarm_t* alarms[num_alarms];
+
+  for (int i = 0; i < num_alarms; i++) {
+    const std::string alarm_name =
+        "alarm_test.test_callback_ordering_reverse[" + std::to_string(i) + "]";
+    alarms[i] = alarm_new(alarm_name.c_str());
+  }
+
+  for (int i = num_alarms - 1; i >= 0; i--) {
+    alarm_set(alarms[i], intervals_ms[i], ordered_cb, INT_TO_PTR(i));
+  }
+
+  for (int i = 1; i <= num_alarms; i++) {
+    semaphore_wait(semaphore);
+    EXPECT_GE(cb_counter, i);
+  }
+  EXPECT_EQ(cb_counter, num_alarms);
+  EXPECT_EQ(cb_misordered_counter, 0);
+
+  for (int i = 0; i < num_alarms; i++) alarm_free(alarms[i]);
+
+  EXPECT_FALSE(is_wake_lock_acquired);
+}
+
 // Test whether the callbacks are involed in the expected order on a
 // message loop.
 TEST_F(AlarmTest, test_callback_ordering_on_mloop) {
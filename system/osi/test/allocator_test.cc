@@ -20,6 +20,8 @@
 #include <gtest/gtest.h>
 
 #include <cstring>
+#include <thread>
+#include <vector>
 
 class AllocatorTest : public ::testing::Test {};
 
@@ -48,3 +50,96 @@ TEST_F(AllocatorTest, test_osi_strndup) {
   EXPECT_EQ(0, strcmp(str, copy_str));
   osi_free(copy_str);
 }
+
+TEST_F(AllocatorTest, test_pool_reuses_freed_block) {
+  osi_allocator_pool_enable();
+  ASSERT_TRUE(osi_allocator_pool_is_enabled());
+
+  void* first = osi_malloc(100);
+  osi_free(first);
+  void* second = osi_malloc(120);
+  EXPECT_EQ(first, second);
+  osi_free(second);
+}
+
+TEST_F(AllocatorTest, test_pool_calloc_zeroes_reused_block) {
+  osi_allocator_pool_enable();
+
+  uint8_t* buffer = static_cast<uint8_t*>(osi_malloc(200));
+  memset(buffer, 0xa5, 200);
+  osi_free(buffer);
+
+  buffer = static_cast<uint8_t*>(osi_calloc(200));
+  for (size_t i = 0; i < 200; i++) {
+    ASSERT_EQ(0, buffer[i]);
+  }
+  osi_free(buffer);
+}
+
+TEST_F(AllocatorTest, test_pool_large_and_strdup_buffers) {
+  osi_allocator_pool_enable();
+
+  // Larger than any size class, served by the system allocator.
+  void* large = osi_malloc(64 * 1024);
+  ASSERT_NE(nullptr, large);
+  osi_free(large);
+
+  char* copy_str = osi_strdup("IloveBluetooth");
+  EXPECT_EQ(0, strcmp("IloveBluetooth", copy_str));
+  osi_free(copy_str);
+}
+
+TEST_F(AllocatorTest, test_pool_exhaustion_falls_back) {
+  osi_allocator_pool_enable();
+
+  std::vector<void*> buffers;
+  for (size_t i = 0; i < 1024; i++) {
+    void* ptr = osi_malloc(4096);
+    ASSERT_NE(nullptr, ptr);
+    memset(ptr, 0, 4096);
+    buffers.push_back(ptr);
+  }
+  for (void* ptr : buffers) {
+    osi_free(ptr);
+  }
+}
+
+TEST_F(AllocatorTest, test_pool_thread_cache) {
+  osi_allocator_pool_enable();
+
+  std::thread thread([]() {
+    osi_allocator_thread_cache_enable();
+    void* first = osi_malloc(32);
+    osi_free(first);
+    void* second = osi_malloc(32);
+    EXPECT_EQ(first, second);
+    osi_free(second);
+  });
+  thread.join();
+}
+
+TEST_F(AllocatorTest, test_tagging_accounts_live_bytes) {
+  osi_allocator_tagging_enable();
+  ASSERT_TRUE(osi_allocator_tagging_is_enabled());
+  ASSERT_TRUE(osi_allocator_pool_is_enabled());
+
+  std::thread thread([]() {
+    osi_allocator_set_thread_tag("test.tagging");
+    void* pooled = osi_malloc(100);
+    void* large = osi_calloc(64 * 1024);
+    EXPECT_EQ(100 + 64 * 1024,
+              osi_allocator_get_tag_live_bytes("test.tagging"));
+
+    osi_free(pooled);
+    EXPECT_EQ(64 * 1024, osi_allocator_get_tag_live_bytes("test.tagging"));
+    osi_free(large);
+    EXPECT_EQ(0, osi_allocator_get_tag_live_bytes("test.tagging"));
+  });
+  thread.join();
+
+  // Buffers that were not accounted, such as osi_strdup() ones, are released
+  // without affecting the tags.
+  char* copy_str = osi_strdup("IloveBluetooth");
+  osi_free(copy_str);
+  EXPECT_EQ(0, osi_allocator_get_tag_live_bytes("test.tagging"));
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <stdio.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "osi/include/config.h"
+
+using ::benchmark::State;
+
+namespace {
+
+const std::filesystem::path kConfigFile =
+    std::filesystem::temp_directory_path() / "config_benchmark.conf";
+
+// Keys stored for each bonded device in bt_config.conf
+const std::vector<std::string> kDeviceKeys = {
+    "Name",         "DevClass",       "DevType",
+    "AddrType",     "Timestamp",      "Manufacturer",
+    "LmpVer",       "LmpSubVer",      "MetricsId",
+    "LinkKeyType",  "PinLength",      "LinkKey",
+    "Service",      "VendorIdSource", "VendorId",
+    "ProductId",    "ProductVersion", "LE_KEY_PENC",
+    "LE_KEY_PID",   "LE_KEY_PCSRK",   "LE_KEY_LENC",
+    "LE_KEY_LCSRK", "LE_KEY_LID",     "GattClientSupportedFeatures",
+};
+
+std::string DeviceAddress(int index) {
+  char address[18];
+  snprintf(address, sizeof(address), "aa:bb:cc:%02x:%02x:%02x",
+           (index >> 16) & 0xff, (index >> 8) & 0xff, index & 0xff);
+  return address;
+}
+
+// Write a bt_config.conf with an adapter section and |num_devices| bonded
+// devices, formatted as config_save does.
+void WriteConfigFile(int num_devices) {
+  FILE* fp = fopen(kConfigFile.c_str(), "wt");
+  fprintf(fp, "[Info]\nFileSource = Empty\nTimeCreated = 2024-01-01 00:00:00"
+              "\n\n[Adapter]\nAddress = 00:11:22:33:44:55\nName = Pixel\n"
+              "ScanMode = 0\nDiscoveryTimeout = 120\n\n");
+  for (int i = 0; i < num_devices; i++) {
+    fprintf(fp, "[%s]\n", DeviceAddress(i).c_str());
+    for (const std::string& key : kDeviceKeys) {
+      fprintf(fp, "%s = 0123456789abcdef0123456789abcdef%d\n", key.c_str(), i);
+    }
+    fprintf(fp, "\n");
+  }
+  fclose(fp);
+}
+
+}  // namespace
+
+static void BM_ConfigParse(State& state) {
+  WriteConfigFile(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(config_new(kConfigFile.c_str()));
+  }
+  std::filesystem::remove(kConfigFile);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConfigParse)->Arg(10)->Arg(100)->Arg(500);
+
+// Look up every key of a device, as done when loading bonded devices
+static void BM_ConfigGetString(State& state) {
+  WriteConfigFile(state.range(0));
+  std::unique_ptr<config_t> config = config_new(kConfigFile.c_str());
+  std::filesystem::remove(kConfigFile);
+  int device = 0;
+  for (auto _ : state) {
+    const std::string section = DeviceAddress(device);
+    for (const std::string& key : kDeviceKeys) {
+      benchmark::DoNotOptimize(
+          config_get_string(*config, section, key, nullptr));
+    }
+    device = (device + 1) % state.range(0);
+  }
+  state.SetItemsProcessed(state.iterations() * kDeviceKeys.size());
+}
+BENCHMARK(BM_ConfigGetString)->Arg(10)->Arg(100)->Arg(500);
+
+static void BM_ConfigSetString(State& state) {
+  WriteConfigFile(state.range(0));
+  std::unique_ptr<config_t> config = config_new(kConfigFile.c_str());
+  std::filesystem::remove(kConfigFile);
+  int device = 0;
+  for (auto _ : state) {
+    config_set_string(config.get(), DeviceAddress(device), "Timestamp",
+                      "1700000000");
+    device = (device + 1) % state.range(0);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigSetString)->Arg(10)->Arg(100)->Arg(500);
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include <filesystem>
+#include <vector>
 
 static const std::filesystem::path kConfigFile =
     std::filesystem::temp_directory_path() / "config_test.conf";
@@ -271,3 +272,54 @@ TEST_F(ConfigTest, checksum_save) {
 
   EXPECT_TRUE(std::filesystem::remove(filename));
 }
+
+TEST_F(ConfigTest, config_keeps_insertion_order) {
+  std::unique_ptr<config_t> config = config_new_empty();
+  config_set_string(config.get(), "b", "z", "0");
+  config_set_string(config.get(), "a", "y", "1");
+  config_set_string(config.get(), "b", "x", "2");
+  config_set_string(config.get(), "c", "w", "3");
+  EXPECT_TRUE(config_remove_section(config.get(), "a"));
+  config_set_string(config.get(), "a", "v", "4");
+
+  std::vector<std::string> names;
+  for (const section_t& section : config->sections) {
+    names.push_back(section.name);
+  }
+  EXPECT_EQ(names, std::vector<std::string>({"b", "c", "a"}));
+  std::vector<std::string> keys;
+  for (const entry_t& entry : config->Find("b")->entries) {
+    keys.push_back(entry.key);
+  }
+  EXPECT_EQ(keys, std::vector<std::string>({"z", "x"}));
+}
+
+TEST_F(ConfigTest, config_list_duplicate_keys) {
+  config_t config;
+  config.sections.emplace_back(section_t{.name = "dup"});
+  config.sections.emplace_back(section_t{.name = "other"});
+  config.sections.emplace_back(section_t{.name = "dup"});
+  config.sections.back().Set("key", "second");
+
+  // The first section with a name is found, then the next one once erased
+  auto first = config.Find("dup");
+  EXPECT_EQ(first, config.sections.begin());
+  config.sections.erase(first);
+  ASSERT_TRUE(config.Has("dup"));
+  EXPECT_TRUE(config.Find("dup")->Has("key"));
+  config.sections.erase(config.Find("dup"));
+  EXPECT_FALSE(config.Has("dup"));
+  EXPECT_TRUE(config.Has("other"));
+}
+
+TEST_F(ConfigTest, config_copy_is_independent) {
+  std::unique_ptr<config_t> config = config_new(CONFIG_FILE);
+  ASSERT_NE(config, nullptr);
+  config_t copy = *config;
+  config_remove_section(config.get(), "DID");
+
+  EXPECT_FALSE(config_has_section(*config, "DID"));
+  EXPECT_EQ(config_get_int(copy, "DID", "version", 0), 0x1436);
+  config_t moved = std::move(copy);
+  EXPECT_EQ(config_get_int(moved, "DID", "version", 0), 0x1436);
+}
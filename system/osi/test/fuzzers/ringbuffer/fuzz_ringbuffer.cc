@@ -34,7 +34,7 @@ ringbuffer_t* getArbitraryRingBuf(std::vector<ringbuffer_t*>* ringbuf_vector,
 void callArbitraryFunction(std::vector<ringbuffer_t*>* ringbuf_vector,
                            FuzzedDataProvider* dataProvider) {
   // Get our function identifier
-  char func_id = dataProvider->ConsumeIntegralInRange<char>(0, 8);
+  char func_id = dataProvider->ConsumeIntegralInRange<char>(0, 10);
 
   ringbuffer_t* buf = nullptr;
   switch (func_id) {
@@ -137,6 +137,36 @@ void callArbitraryFunction(std::vector<ringbuffer_t*>* ringbuf_vector,
       }
     }
       return;
+    case 9: {
+      buf = getArbitraryRingBuf(ringbuf_vector, dataProvider);
+      if (buf == nullptr) {
+        return;
+      }
+      ringbuffer_spans_t spans;
+      size_t size = ringbuffer_readable_spans(buf, &spans);
+      std::vector<uint8_t> dst_buf(size);
+      memcpy(dst_buf.data(), spans.first, spans.first_length);
+      if (spans.second_length > 0) {
+        memcpy(dst_buf.data() + spans.first_length, spans.second,
+               spans.second_length);
+      }
+      ringbuffer_delete(
+          buf, dataProvider->ConsumeIntegralInRange<size_t>(0, size));
+    }
+      return;
+    case 10: {
+      buf = getArbitraryRingBuf(ringbuf_vector, dataProvider);
+      if (buf == nullptr) {
+        return;
+      }
+      ringbuffer_spans_t spans;
+      ringbuffer_writable_spans(buf, &spans);
+      std::vector<uint8_t> bytes =
+          dataProvider->ConsumeBytes<uint8_t>(spans.first_length);
+      memcpy(spans.first, bytes.data(), bytes.size());
+      ringbuffer_commit_write(buf, bytes.size());
+    }
+      return;
     default:
       return;
   }
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "osi/include/osi.h"
 #include "osi/include/ringbuffer.h"
 
@@ -137,3 +139,87 @@ TEST(RingbufferTest, test_multi_insert_delete) {
 
   ringbuffer_free(rb);
 }
+
+TEST(RingbufferTest, test_spans) {
+  ringbuffer_t* rb = ringbuffer_init(8);
+  ringbuffer_spans_t spans;
+
+  EXPECT_EQ((size_t)0, ringbuffer_readable_spans(rb, &spans));
+  EXPECT_EQ((size_t)8, ringbuffer_writable_spans(rb, &spans));
+  EXPECT_EQ((size_t)8, spans.first_length);
+  EXPECT_EQ((size_t)0, spans.second_length);
+  EXPECT_EQ(nullptr, spans.second);
+
+  // Write in place, then move the head so that the free space wraps
+  memset(spans.first, 0xAA, 6);
+  EXPECT_EQ((size_t)6, ringbuffer_commit_write(rb, 6));
+  EXPECT_EQ((size_t)4, ringbuffer_delete(rb, 4));
+
+  EXPECT_EQ((size_t)6, ringbuffer_writable_spans(rb, &spans));
+  EXPECT_EQ((size_t)2, spans.first_length);
+  EXPECT_EQ((size_t)4, spans.second_length);
+  memset(spans.first, 0xBB, spans.first_length);
+  memset(spans.second, 0xCC, 3);
+  EXPECT_EQ((size_t)5, ringbuffer_commit_write(rb, 5));
+  EXPECT_EQ((size_t)1, ringbuffer_available(rb));
+
+  uint8_t content[] = {0xAA, 0xAA, 0xBB, 0xBB, 0xCC, 0xCC, 0xCC};
+  EXPECT_EQ((size_t)7, ringbuffer_readable_spans(rb, &spans));
+  EXPECT_EQ((size_t)4, spans.first_length);
+  EXPECT_EQ((size_t)3, spans.second_length);
+  EXPECT_EQ(0, memcmp(content, spans.first, spans.first_length));
+  EXPECT_EQ(0, memcmp(content + spans.first_length, spans.second,
+                      spans.second_length));
+
+  // Commits are bounded by the free space
+  EXPECT_EQ((size_t)1, ringbuffer_commit_write(rb, 10));
+  EXPECT_EQ((size_t)8, ringbuffer_size(rb));
+
+  ringbuffer_free(rb);
+}
+
+TEST(RingbufferTest, test_single_producer_single_consumer) {
+  constexpr size_t kBytes = 1 << 18;
+  ringbuffer_t* rb = ringbuffer_init(1000);
+
+  std::thread producer([rb]() {
+    uint8_t chunk[97];
+    size_t written = 0;
+    while (written < kBytes) {
+      size_t length = std::min(sizeof(chunk), kBytes - written);
+      for (size_t i = 0; i < length; i++) chunk[i] = (written + i) & 0xFF;
+      size_t added = 0;
+      while (added < length) {
+        size_t inserted = ringbuffer_insert(rb, chunk + added, length - added);
+        if (inserted == 0) std::this_thread::yield();
+        added += inserted;
+      }
+      written += length;
+    }
+  });
+
+  size_t read = 0;
+  size_t errors = 0;
+  while (read < kBytes) {
+    ringbuffer_spans_t spans;
+    size_t length = ringbuffer_readable_spans(rb, &spans);
+    if (length == 0) {
+      std::this_thread::yield();
+      continue;
+    }
+    for (size_t i = 0; i < spans.first_length; i++) {
+      if (spans.first[i] != ((read + i) & 0xFF)) errors++;
+    }
+    for (size_t i = 0; i < spans.second_length; i++) {
+      if (spans.second[i] != ((read + spans.first_length + i) & 0xFF)) {
+        errors++;
+      }
+    }
+    read += ringbuffer_delete(rb, length);
+  }
+  producer.join();
+
+  EXPECT_EQ((size_t)0, errors);
+  EXPECT_EQ((size_t)0, ringbuffer_size(rb));
+  ringbuffer_free(rb);
+}
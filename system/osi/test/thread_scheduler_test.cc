@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "osi/include/thread_scheduler.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "osi/include/properties.h"
+
+TEST(ThreadSchedulerTest, test_parse_policy) {
+  thread_policy_t policy;
+  ASSERT_TRUE(thread_scheduler_parse_policy("other", &policy));
+  EXPECT_FALSE(policy.real_time);
+  EXPECT_EQ(policy.cpu_class, THREAD_CPU_ANY);
+
+  ASSERT_TRUE(thread_scheduler_parse_policy("fifo,performance", &policy));
+  EXPECT_TRUE(policy.real_time);
+  EXPECT_EQ(policy.priority, 1);
+  EXPECT_EQ(policy.cpu_class, THREAD_CPU_PERFORMANCE);
+
+  ASSERT_TRUE(thread_scheduler_parse_policy("fifo:3,efficiency", &policy));
+  EXPECT_TRUE(policy.real_time);
+  EXPECT_EQ(policy.priority, 3);
+  EXPECT_EQ(policy.cpu_class, THREAD_CPU_EFFICIENCY);
+}
+
+TEST(ThreadSchedulerTest, test_parse_malformed_policy) {
+  thread_policy_t policy = {true, 2, THREAD_CPU_PERFORMANCE};
+  EXPECT_FALSE(thread_scheduler_parse_policy("", &policy));
+  EXPECT_FALSE(thread_scheduler_parse_policy("rr", &policy));
+  EXPECT_FALSE(thread_scheduler_parse_policy("fifo:", &policy));
+  EXPECT_FALSE(thread_scheduler_parse_policy("fifo:1000", &policy));
+  EXPECT_FALSE(thread_scheduler_parse_policy("other,little", &policy));
+  // Left untouched
+  EXPECT_TRUE(policy.real_time);
+  EXPECT_EQ(policy.priority, 2);
+  EXPECT_EQ(policy.cpu_class, THREAD_CPU_PERFORMANCE);
+}
+
+TEST(ThreadSchedulerTest, test_default_policy) {
+  thread_policy_t policy =
+      thread_scheduler_get_policy("bt_a2dp_source_worker_thread");
+  EXPECT_TRUE(policy.real_time);
+  EXPECT_EQ(policy.cpu_class, THREAD_CPU_ANY);
+
+  policy = thread_scheduler_get_policy("thread_scheduler_test_thread");
+  EXPECT_FALSE(policy.real_time);
+  EXPECT_EQ(policy.cpu_class, THREAD_CPU_ANY);
+}
+
+TEST(ThreadSchedulerTest, test_apply_policy_and_dump) {
+  ASSERT_EQ(0, osi_property_set(
+                   "bluetooth.core.thread_policy.thread_scheduler_test_thread",
+                   "other,efficiency"));
+  thread_policy_t policy =
+      thread_scheduler_get_policy("thread_scheduler_test_thread");
+  EXPECT_FALSE(policy.real_time);
+  EXPECT_EQ(policy.cpu_class, THREAD_CPU_EFFICIENCY);
+
+  bool applied = false;
+  std::thread thread([&applied]() {
+    applied = thread_scheduler_apply_policy("thread_scheduler_test_thread");
+  });
+  thread.join();
+  EXPECT_TRUE(applied);
+
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  thread_scheduler_debug_dump(fds[1]);
+  close(fds[1]);
+  std::string dump;
+  char chunk[256];
+  ssize_t len;
+  while ((len = read(fds[0], chunk, sizeof(chunk))) > 0) {
+    dump.append(chunk, len);
+  }
+  close(fds[0]);
+  EXPECT_NE(dump.find("thread_scheduler_test_thread"), std::string::npos);
+  EXPECT_NE(dump.find("efficiency"), std::string::npos);
+}
+
+TEST(ThreadSchedulerTest, test_priority_inheritance_mutex) {
+  PriorityInheritanceMutex mutex;
+  int counter = 0;
+  std::thread thread([&]() {
+    for (int i = 0; i < 1000; i++) {
+      std::lock_guard<PriorityInheritanceMutex> lock(mutex);
+      counter++;
+    }
+  });
+  for (int i = 0; i < 1000; i++) {
+    std::lock_guard<PriorityInheritanceMutex> lock(mutex);
+    counter++;
+  }
+  thread.join();
+  EXPECT_EQ(counter, 2000);
+
+  ASSERT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
@@ -23,6 +23,9 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
+
+#include <string>
 
 #include "osi/include/wakelock.h"
 
@@ -155,3 +158,40 @@ TEST_F(WakelockTest, test_set_paths) {
     ASSERT_FALSE(IsFileWakeLockAcquired());
   }
 }
+
+TEST_F(WakelockTest, test_source_attribution) {
+  wakelock_set_os_callouts(&bt_wakelock_callouts);
+
+  ASSERT_TRUE(wakelock_acquire_for("wakelock_test.first"));
+  ASSERT_TRUE(is_wake_lock_acquired);
+  ASSERT_TRUE(wakelock_acquire_for("wakelock_test.second"));
+  ASSERT_TRUE(wakelock_release_for("wakelock_test.first"));
+  ASSERT_TRUE(wakelock_acquire_for("wakelock_test.first"));
+  ASSERT_TRUE(wakelock_release_for("wakelock_test.first"));
+
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  wakelock_debug_dump(fds[1]);
+  close(fds[1]);
+  std::string dump;
+  char chunk[256];
+  ssize_t len;
+  while ((len = read(fds[0], chunk, sizeof(chunk))) > 0) {
+    dump.append(chunk, len);
+  }
+  close(fds[0]);
+
+  size_t first = dump.find("wakelock_test.first");
+  size_t second = dump.find("wakelock_test.second");
+  ASSERT_NE(first, std::string::npos);
+  ASSERT_NE(second, std::string::npos);
+  // The first source was acquired twice and is released, the second one is
+  // still held
+  std::string first_line = dump.substr(first, dump.find('\n', first) - first);
+  std::string second_line =
+      dump.substr(second, dump.find('\n', second) - second);
+  EXPECT_NE(first_line.find(" no "), std::string::npos);
+  EXPECT_NE(first_line.find(" 2 "), std::string::npos);
+  EXPECT_NE(second_line.find(" yes "), std::string::npos);
+  EXPECT_NE(second_line.find(" 1 "), std::string::npos);
+}
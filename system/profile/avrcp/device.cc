@@ -1150,10 +1150,9 @@ void Device::HandleGetFolderItems(uint8_t label,
                      weak_ptr_factory_.GetWeakPtr(), label, pkt));
       break;
     case Scope::VFS:
-      media_interface_->GetFolderItems(
-          curr_browsed_player_id_, CurrentFolder(),
-          base::Bind(&Device::GetVFSListResponse,
-                     weak_ptr_factory_.GetWeakPtr(), label, pkt));
+      GetFolderItems(CurrentFolder(),
+                     base::Bind(&Device::GetVFSListResponse,
+                                weak_ptr_factory_.GetWeakPtr(), label, pkt));
       break;
     case Scope::NOW_PLAYING:
       media_interface_->GetNowPlayingList(
@@ -1191,10 +1190,9 @@ void Device::HandleGetTotalNumberOfItems(
       break;
     }
     case Scope::VFS:
-      media_interface_->GetFolderItems(
-          curr_browsed_player_id_, CurrentFolder(),
-          base::Bind(&Device::GetTotalNumberOfItemsVFSResponse,
-                     weak_ptr_factory_.GetWeakPtr(), label));
+      GetFolderItems(CurrentFolder(),
+                     base::Bind(&Device::GetTotalNumberOfItemsVFSResponse,
+                                weak_ptr_factory_.GetWeakPtr(), label));
       break;
     case Scope::NOW_PLAYING:
       media_interface_->GetNowPlayingList(
@@ -1217,12 +1215,12 @@ void Device::GetTotalNumberOfItemsMediaPlayersResponse(
   send_message(label, true, std::move(builder));
 }
 
-void Device::GetTotalNumberOfItemsVFSResponse(uint8_t label,
-                                              std::vector<ListItem> list) {
-  log::verbose("num_items={}", list.size());
+void Device::GetTotalNumberOfItemsVFSResponse(
+    uint8_t label, std::shared_ptr<const MediaFolderItems> folder) {
+  log::verbose("num_items={}", folder->items.size());
 
   auto builder = GetTotalNumberOfItemsResponseBuilder::MakeBuilder(
-      Status::NO_ERROR, 0x0000, list.size());
+      Status::NO_ERROR, 0x0000, folder->items.size());
   send_message(label, true, std::move(builder));
 }
 
@@ -1278,19 +1276,16 @@ void Device::HandleChangePath(uint8_t label,
     log::verbose("Popping Path from stack: new path=\"{}\"", CurrentFolder());
   }
 
-  media_interface_->GetFolderItems(
-      curr_browsed_player_id_, CurrentFolder(),
-      base::Bind(&Device::ChangePathResponse, weak_ptr_factory_.GetWeakPtr(),
-                 label, pkt));
+  GetFolderItems(CurrentFolder(),
+                 base::Bind(&Device::ChangePathResponse,
+                            weak_ptr_factory_.GetWeakPtr(), label, pkt));
 }
 
-void Device::ChangePathResponse(uint8_t label,
-                                std::shared_ptr<ChangePathRequest> pkt,
-                                std::vector<ListItem> list) {
-  // TODO (apanicke): Reconstruct the VFS ID's here. Right now it gets
-  // reconstructed in GetFolderItemsVFS
-  auto builder =
-      ChangePathResponseBuilder::MakeBuilder(Status::NO_ERROR, list.size());
+void Device::ChangePathResponse(
+    uint8_t label, std::shared_ptr<ChangePathRequest> pkt,
+    std::shared_ptr<const MediaFolderItems> folder) {
+  auto builder = ChangePathResponseBuilder::MakeBuilder(Status::NO_ERROR,
+                                                        folder->items.size());
   send_message(label, true, std::move(builder));
 }
 
@@ -1326,10 +1321,9 @@ void Device::HandleGetItemAttributes(
       // then we can auto send the error without calling up. We do this check
       // later right now though in order to prevent race conditions with updates
       // on the media layer.
-      media_interface_->GetFolderItems(
-          curr_browsed_player_id_, CurrentFolder(),
-          base::Bind(&Device::GetItemAttributesVFSResponse,
-                     weak_ptr_factory_.GetWeakPtr(), label, pkt));
+      GetFolderItems(CurrentFolder(),
+                     base::Bind(&Device::GetItemAttributesVFSResponse,
+                                weak_ptr_factory_.GetWeakPtr(), label, pkt));
       break;
     default:
       log::error("{}: UNKNOWN SCOPE FOR HANDLE GET ITEM ATTRIBUTES",
@@ -1389,7 +1383,7 @@ void Device::GetItemAttributesNowPlayingResponse(
 
 void Device::GetItemAttributesVFSResponse(
     uint8_t label, std::shared_ptr<GetItemAttributesRequest> pkt,
-    std::vector<ListItem> item_list) {
+    std::shared_ptr<const MediaFolderItems> folder) {
   log::verbose("uid={}", loghex(pkt->GetUid()));
 
   auto media_id = vfs_ids_.get_media_id(pkt->GetUid());
@@ -1407,11 +1401,9 @@ void Device::GetItemAttributesVFSResponse(
   ListItem item_requested;
   item_requested.type = ListItem::SONG;
 
-  for (const auto& temp : item_list) {
-    if ((temp.type == ListItem::FOLDER && temp.folder.media_id == media_id) ||
-        (temp.type == ListItem::SONG && temp.song.media_id == media_id)) {
-      item_requested = temp;
-    }
+  const ListItem* item = folder->find(media_id);
+  if (item != nullptr) {
+    item_requested = *item;
   }
 
   // Filter out DEFAULT_COVER_ART handle if this device has no client
@@ -1503,9 +1495,9 @@ std::set<AttributeEntry> filter_attributes_requested(
   return result;
 }
 
-void Device::GetVFSListResponse(uint8_t label,
-                                std::shared_ptr<GetFolderItemsRequest> pkt,
-                                std::vector<ListItem> items) {
+void Device::GetVFSListResponse(
+    uint8_t label, std::shared_ptr<GetFolderItemsRequest> pkt,
+    std::shared_ptr<const MediaFolderItems> folder) {
   log::verbose("start_item={} end_item={}", pkt->GetStartItem(),
                pkt->GetEndItem());
 
@@ -1513,28 +1505,18 @@ void Device::GetVFSListResponse(uint8_t label,
   auto builder = GetFolderItemsResponseBuilder::MakeVFSBuilder(
       Status::NO_ERROR, 0x0000, browse_mtu_);
 
-  // TODO (apanicke): Add test that checks if vfs_ids_ is the correct size after
-  // an operation.
-  for (const auto& item : items) {
-    if (item.type == ListItem::FOLDER) {
-      vfs_ids_.insert(item.folder.media_id);
-    } else if (item.type == ListItem::SONG) {
-      vfs_ids_.insert(item.song.media_id);
-    }
-  }
-
-  // Add the elements retrieved in the last get folder items request and map
-  // them to UIDs The maps will be cleared every time a directory change
-  // happens. These items do not need to correspond with the now playing list as
-  // the UID's only need to be unique in the context of the current scope and
-  // the current folder
+  // Add the elements of the requested range. Their UIDs were assigned when the
+  // folder was fetched. These items do not need to correspond with the now
+  // playing list as the UID's only need to be unique in the context of the
+  // current scope and the current folder
+  const auto& items = folder->items;
   for (auto i = pkt->GetStartItem(); i <= pkt->GetEndItem() && i < items.size();
        i++) {
     if (items[i].type == ListItem::FOLDER) {
-      auto folder = items[i].folder;
+      const auto& folder_info = items[i].folder;
       // right now we always use folders of mixed type
-      FolderItem folder_item(vfs_ids_.get_uid(folder.media_id), 0x00,
-                             folder.is_playable, folder.name);
+      FolderItem folder_item(vfs_ids_.get_uid(folder_info.media_id), 0x00,
+                             folder_info.is_playable, folder_info.name);
       if (!builder->AddFolder(folder_item)) break;
     } else if (items[i].type == ListItem::SONG) {
       auto song = items[i].song;
@@ -1567,6 +1549,41 @@ void Device::GetVFSListResponse(uint8_t label,
   send_message(label, true, std::move(builder));
 }
 
+void Device::GetFolderItems(std::string media_id, FolderCallback folder_cb) {
+  uint16_t player_id = curr_browsed_player_id_;
+  auto folder = folder_cache_.get(player_id, media_id);
+  if (folder != nullptr) {
+    log::verbose("folder=\"{}\" num_items={} (cached)", media_id,
+                 folder->items.size());
+    folder_cb.Run(folder);
+    return;
+  }
+
+  media_interface_->GetFolderItems(
+      player_id, media_id,
+      base::Bind(&Device::FolderItemsResponse, weak_ptr_factory_.GetWeakPtr(),
+                 player_id, media_id, folder_cb));
+}
+
+void Device::FolderItemsResponse(uint16_t player_id, std::string media_id,
+                                 FolderCallback folder_cb,
+                                 std::vector<ListItem> items) {
+  log::verbose("folder=\"{}\" num_items={}", media_id, items.size());
+
+  // Map the items to UIDs once per fetch rather than on every page request.
+  // TODO (apanicke): Add test that checks if vfs_ids_ is the correct size after
+  // an operation.
+  for (const auto& item : items) {
+    if (item.type == ListItem::FOLDER) {
+      vfs_ids_.insert(item.folder.media_id);
+    } else if (item.type == ListItem::SONG) {
+      vfs_ids_.insert(item.song.media_id);
+    }
+  }
+
+  folder_cb.Run(folder_cache_.put(player_id, media_id, std::move(items)));
+}
+
 void Device::GetNowPlayingListResponse(
     uint8_t label, std::shared_ptr<GetFolderItemsRequest> pkt,
     std::string /* unused curr_song_id */, std::vector<SongInfo> song_list) {
@@ -1648,6 +1665,7 @@ void Device::SetBrowsedPlayerResponse(
   }
 
   curr_browsed_player_id_ = pkt->GetPlayerId();
+  folder_cache_.clear();
 
   // Clear the path and push the new root.
   current_path_ = std::stack<std::string>();
@@ -1684,6 +1702,11 @@ void Device::SendFolderUpdate(bool available_players, bool addressed_player,
   CHECK(media_interface_);
   log::verbose("");
 
+  // The browsed folders may have changed, fetch them again on the next request
+  if (available_players || addressed_player || uids) {
+    folder_cache_.clear();
+  }
+
   if (available_players) {
     HandleAvailablePlayerUpdate();
   }
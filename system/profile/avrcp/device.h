@@ -43,6 +43,7 @@
 #include "packet/avrcp/set_browsed_player.h"
 #include "packet/avrcp/set_player_application_setting_value.h"
 #include "packet/avrcp/vendor_packet.h"
+#include "profile/avrcp/media_folder_cache.h"
 #include "profile/avrcp/media_id_map.h"
 #include "raw_address.h"
 
@@ -221,9 +222,9 @@ class Device {
   virtual void GetMediaPlayerListResponse(
       uint8_t label, std::shared_ptr<GetFolderItemsRequest> pkt,
       uint16_t curr_player, std::vector<MediaPlayerInfo> players);
-  virtual void GetVFSListResponse(uint8_t label,
-                                  std::shared_ptr<GetFolderItemsRequest> pkt,
-                                  std::vector<ListItem> items);
+  virtual void GetVFSListResponse(
+      uint8_t label, std::shared_ptr<GetFolderItemsRequest> pkt,
+      std::shared_ptr<const MediaFolderItems> folder);
   virtual void GetNowPlayingListResponse(
       uint8_t label, std::shared_ptr<GetFolderItemsRequest> pkt,
       std::string curr_song_id, std::vector<SongInfo> song_list);
@@ -233,8 +234,8 @@ class Device {
       uint8_t label, std::shared_ptr<GetTotalNumberOfItemsRequest> pkt);
   virtual void GetTotalNumberOfItemsMediaPlayersResponse(
       uint8_t label, uint16_t curr_player, std::vector<MediaPlayerInfo> list);
-  virtual void GetTotalNumberOfItemsVFSResponse(uint8_t label,
-                                                std::vector<ListItem> items);
+  virtual void GetTotalNumberOfItemsVFSResponse(
+      uint8_t label, std::shared_ptr<const MediaFolderItems> folder);
   virtual void GetTotalNumberOfItemsNowPlayingResponse(
       uint8_t label, std::string curr_song_id, std::vector<SongInfo> song_list);
 
@@ -246,7 +247,7 @@ class Device {
       std::string curr_media_id, std::vector<SongInfo> song_list);
   virtual void GetItemAttributesVFSResponse(
       uint8_t label, std::shared_ptr<GetItemAttributesRequest> pkt,
-      std::vector<ListItem> item_list);
+      std::shared_ptr<const MediaFolderItems> folder);
 
   // SET BROWSED PLAYER
   virtual void HandleSetBrowsedPlayer(
@@ -258,9 +259,9 @@ class Device {
   // CHANGE PATH
   virtual void HandleChangePath(uint8_t label,
                                 std::shared_ptr<ChangePathRequest> request);
-  virtual void ChangePathResponse(uint8_t label,
-                                  std::shared_ptr<ChangePathRequest> request,
-                                  std::vector<ListItem> list);
+  virtual void ChangePathResponse(
+      uint8_t label, std::shared_ptr<ChangePathRequest> request,
+      std::shared_ptr<const MediaFolderItems> folder);
 
   // PLAY ITEM
   virtual void HandlePlayItem(uint8_t label,
@@ -322,6 +323,18 @@ class Device {
     return current_path_.top();
   }
 
+  // Number of browsed folders whose contents are kept between requests.
+  static constexpr size_t kFolderCacheSize = 4;
+
+  // Fetches the contents of a folder on the browsed player, from the folder
+  // cache when a previous request already fetched it.
+  using FolderCallback =
+      base::Callback<void(std::shared_ptr<const MediaFolderItems>)>;
+  void GetFolderItems(std::string media_id, FolderCallback folder_cb);
+  void FolderItemsResponse(uint16_t player_id, std::string media_id,
+                           FolderCallback folder_cb,
+                           std::vector<ListItem> items);
+
   void send_message(uint8_t label, bool browse,
                     std::unique_ptr<::bluetooth::PacketBuilder> message) {
     active_labels_.erase(label);
@@ -360,6 +373,7 @@ class Device {
 
   MediaIdMap vfs_ids_;
   MediaIdMap now_playing_ids_;
+  MediaFolderCache folder_cache_{kFolderCacheSize};
 
   uint32_t play_pos_interval_ = 0;
 
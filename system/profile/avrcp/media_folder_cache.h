@@ -0,0 +1,109 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hardware/avrcp/avrcp.h"
+
+namespace bluetooth {
+namespace avrcp {
+
+// The contents of a browsed folder as returned by the Media Interface, along
+// with an index from media ID to position so that single items can be looked
+// up without walking the whole folder.
+struct MediaFolderItems {
+  explicit MediaFolderItems(std::vector<ListItem> list)
+      : items(std::move(list)) {
+    for (size_t i = 0; i < items.size(); i++) {
+      const auto& item = items[i];
+      index[item.type == ListItem::FOLDER ? item.folder.media_id
+                                          : item.song.media_id] = i;
+    }
+  }
+
+  // Returns the last item with the given media ID, or nullptr if none.
+  const ListItem* find(const std::string& media_id) const {
+    const auto& it = index.find(media_id);
+    if (it == index.end()) return nullptr;
+    return &items[it->second];
+  }
+
+  std::vector<ListItem> items;
+  std::unordered_map<std::string, size_t> index;
+};
+
+// A helper class that keeps the contents of the most recently browsed
+// folders. A remote device pages through a folder with one request per page,
+// and each of these requests would otherwise fetch and convert the whole
+// folder from the Media Interface again.
+class MediaFolderCache {
+ public:
+  explicit MediaFolderCache(size_t capacity) : capacity_(capacity) {}
+
+  void clear() { entries_.clear(); }
+
+  size_t size() const { return entries_.size(); }
+
+  // Returns the cached folder and marks it as the most recently used one, or
+  // nullptr if the folder is not cached.
+  std::shared_ptr<const MediaFolderItems> get(uint16_t player_id,
+                                              const std::string& media_id) {
+    for (auto it = entries_.begin(); it != entries_.end(); it++) {
+      if (it->player_id == player_id && it->media_id == media_id) {
+        entries_.splice(entries_.begin(), entries_, it);
+        return entries_.front().folder;
+      }
+    }
+    return nullptr;
+  }
+
+  // Caches the contents of a folder, evicting the least recently used folder
+  // when the cache is full.
+  std::shared_ptr<const MediaFolderItems> put(uint16_t player_id,
+                                              const std::string& media_id,
+                                              std::vector<ListItem> items) {
+    for (auto it = entries_.begin(); it != entries_.end(); it++) {
+      if (it->player_id == player_id && it->media_id == media_id) {
+        entries_.erase(it);
+        break;
+      }
+    }
+
+    auto folder = std::make_shared<const MediaFolderItems>(std::move(items));
+    entries_.push_front(Entry{player_id, media_id, folder});
+    while (entries_.size() > capacity_) entries_.pop_back();
+    return folder;
+  }
+
+ private:
+  struct Entry {
+    uint16_t player_id;
+    std::string media_id;
+    std::shared_ptr<const MediaFolderItems> folder;
+  };
+
+  size_t capacity_;
+  std::list<Entry> entries_;
+};
+
+}  // namespace avrcp
+}  // namespace bluetooth
@@ -1020,6 +1020,38 @@ TEST_F(AvrcpDeviceTest, getVFSFolderTest) {
   SendBrowseMessage(1, request);
 }
 
+TEST_F(AvrcpDeviceTest, getVFSFolderCacheTest) {
+  MockMediaInterface interface;
+  NiceMock<MockA2dpInterface> a2dp_interface;
+
+  test_device->RegisterInterfaces(&interface, &a2dp_interface, nullptr,
+                                  nullptr);
+
+  FolderInfo info = {"test_id", true, "Test Folder"};
+  ListItem item = {ListItem::FOLDER, info, SongInfo()};
+  std::vector<ListItem> list = {item};
+
+  // The second request is served from the cache, the third one follows a UIDs
+  // update and fetches the folder again.
+  EXPECT_CALL(interface, GetFolderItems(_, "", _))
+      .Times(2)
+      .WillRepeatedly(InvokeCb<2>(list));
+
+  for (uint8_t label = 1; label <= 3; label++) {
+    auto expected_response = GetFolderItemsResponseBuilder::MakeVFSBuilder(
+        Status::NO_ERROR, 0x0000, 0xFFFF);
+    expected_response->AddFolder(FolderItem(1, 0, true, "Test Folder"));
+    EXPECT_CALL(response_cb,
+                Call(label, true, matchPacket(std::move(expected_response))))
+        .Times(1);
+  }
+
+  SendBrowseMessage(1, TestBrowsePacket::Make(get_folder_items_request_vfs));
+  SendBrowseMessage(2, TestBrowsePacket::Make(get_folder_items_request_vfs));
+  test_device->SendFolderUpdate(false, false, true);
+  SendBrowseMessage(3, TestBrowsePacket::Make(get_folder_items_request_vfs));
+}
+
 TEST_F(AvrcpDeviceTest, getFolderItemsMtuTest) {
   auto truncated_packet = GetFolderItemsResponseBuilder::MakeVFSBuilder(
       Status::NO_ERROR, 0x0000, 0xFFFF);
@@ -1084,8 +1116,9 @@ TEST_F(AvrcpDeviceTest, changePathTest) {
   ListItem item3 = {ListItem::FOLDER, info3, SongInfo()};
   ListItem item4 = {ListItem::FOLDER, info4, SongInfo()};
   std::vector<ListItem> list1 = {item2, item3, item4};
+  // Test Folder1 is fetched once and then served from the folder cache
   EXPECT_CALL(interface, GetFolderItems(_, "test_id1", _))
-      .Times(3)
+      .Times(1)
       .WillRepeatedly(InvokeCb<2>(list1));
 
   std::vector<ListItem> list2 = {};
@@ -244,8 +244,9 @@ impl GattCallbacks for GattCallbacksImpl {
         self.0.as_ref().unwrap().on_indication_sent_confirmation(
             conn_id.0,
             match result {
-                Ok(()) => 0, // GATT_SUCCESS
-                _ => 133,    // GATT_ERROR
+                Ok(()) => 0,                            // GATT_SUCCESS
+                Err(IndicationError::QueueFull) => 143, // GATT_CONGESTED
+                _ => 133,                               // GATT_ERROR
             },
         )
     }
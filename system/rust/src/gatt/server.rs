@@ -5,6 +5,7 @@ mod att_database;
 pub mod att_server_bearer;
 pub mod gatt_database;
 mod indication_handler;
+pub mod indication_queue;
 mod request_handler;
 pub mod services;
 mod transactions;
@@ -1,3 +1,5 @@
+use std::rc::Rc;
+
 use async_trait::async_trait;
 use bitflags::bitflags;
 
@@ -7,6 +9,7 @@ use crate::{
     packets::{
         AttAttributeDataChild, AttAttributeDataView, AttErrorCode, AttHandleBuilder, AttHandleView,
     },
+    utils::join::join_all,
 };
 
 impl From<AttHandleView<'_>> for AttHandle {
@@ -74,6 +77,18 @@ pub trait AttDatabase {
         handle: AttHandle,
     ) -> Result<AttAttributeDataChild, AttErrorCode>;
 
+    /// Read several attributes by handle, returning the results in the same
+    /// order as the handles.
+    ///
+    /// The reads are all issued before any of them is awaited, so that reads
+    /// resolved asynchronously by the upper layers proceed in parallel.
+    async fn read_attributes(
+        &self,
+        handles: &[AttHandle],
+    ) -> Vec<Result<AttAttributeDataChild, AttErrorCode>> {
+        join_all(handles.iter().map(|handle| self.read_attribute(*handle))).await
+    }
+
     /// Write to an attribute by handle
     async fn write_attribute(
         &self,
@@ -89,12 +104,20 @@ pub trait AttDatabase {
     /// Expected to return them in sorted order.
     fn list_attributes(&self) -> Vec<AttAttribute>;
 
+    /// List all the attributes in this database, sharing the list instead of
+    /// copying it when the implementation keeps one.
+    ///
+    /// Expected to return them in sorted order.
+    fn list_attributes_shared(&self) -> Rc<[AttAttribute]> {
+        self.list_attributes().into()
+    }
+
     /// Produce an implementation of StableAttDatabase
     fn snapshot(&self) -> SnapshottedAttDatabase<'_>
     where
         Self: Sized,
     {
-        SnapshottedAttDatabase { attributes: self.list_attributes(), backing: self }
+        SnapshottedAttDatabase { attributes: self.list_attributes_shared(), backing: self }
     }
 }
 
@@ -105,13 +128,14 @@ pub trait AttDatabase {
 /// caching its result the first time.
 pub trait StableAttDatabase: AttDatabase {
     fn find_attribute(&self, handle: AttHandle) -> Option<AttAttribute> {
-        self.list_attributes().into_iter().find(|attr| attr.handle == handle)
+        let attributes = self.list_attributes_shared();
+        attributes.binary_search_by_key(&handle, |attr| attr.handle).ok().map(|i| attributes[i])
     }
 }
 
 /// A snapshot of an AttDatabase implementing StableAttDatabase.
 pub struct SnapshottedAttDatabase<'a> {
-    attributes: Vec<AttAttribute>,
+    attributes: Rc<[AttAttribute]>,
     backing: &'a (dyn AttDatabase),
 }
 
@@ -124,6 +148,13 @@ impl AttDatabase for SnapshottedAttDatabase<'_> {
         self.backing.read_attribute(handle).await
     }
 
+    async fn read_attributes(
+        &self,
+        handles: &[AttHandle],
+    ) -> Vec<Result<AttAttributeDataChild, AttErrorCode>> {
+        self.backing.read_attributes(handles).await
+    }
+
     async fn write_attribute(
         &self,
         handle: AttHandle,
@@ -137,6 +168,10 @@ impl AttDatabase for SnapshottedAttDatabase<'_> {
     }
 
     fn list_attributes(&self) -> Vec<AttAttribute> {
+        self.attributes.to_vec()
+    }
+
+    fn list_attributes_shared(&self) -> Rc<[AttAttribute]> {
         self.attributes.clone()
     }
 }
@@ -2,7 +2,11 @@
 //! It handles ATT transactions and unacknowledged operations, backed by an
 //! AttDatabase (that may in turn be backed by an upper-layer protocol)
 
-use std::{cell::Cell, future::Future};
+use std::{
+    cell::Cell,
+    future::Future,
+    time::{Duration, Instant},
+};
 
 use anyhow::Result;
 use log::{error, trace, warn};
@@ -29,6 +33,7 @@ use super::{
     att_database::AttDatabase,
     command_handler::AttCommandHandler,
     indication_handler::{ConfirmationWatcher, IndicationError, IndicationHandler},
+    indication_queue::{IndicationQueue, IndicationQueueMetrics, MAX_QUEUED_INDICATIONS},
     request_handler::AttRequestHandler,
 };
 
@@ -37,6 +42,20 @@ enum AttRequestState<T: AttDatabase> {
     Pending(Option<OwnedHandle<()>>),
 }
 
+/// Counters describing the ATT transactions of a bearer
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct AttRequestMetrics {
+    /// The number of requests currently being answered (at most one per bearer)
+    pub in_flight: usize,
+    /// The number of requests answered
+    pub completed: u64,
+    /// The number of requests dropped since they arrived while another one
+    /// was in flight
+    pub dropped: u64,
+    /// The longest time taken to answer a request
+    pub max_latency: Duration,
+}
+
 /// The errors that can occur while trying to send a packet
 #[derive(Debug)]
 pub enum SendError {
@@ -56,9 +75,11 @@ pub struct AttServerBearer<T: AttDatabase> {
 
     // request state
     curr_request: Cell<AttRequestState<T>>,
+    request_metrics: Cell<AttRequestMetrics>,
 
     // indication state
     indication_handler: SharedMutex<IndicationHandler<T>>,
+    indication_queue: IndicationQueue,
     pending_confirmation: ConfirmationWatcher,
 
     // command handler (across all bearers)
@@ -78,8 +99,10 @@ impl<T: AttDatabase + Clone + 'static> AttServerBearer<T> {
             mtu: AttMtu::new(),
 
             curr_request: AttRequestState::Idle(AttRequestHandler::new(db.clone())).into(),
+            request_metrics: Cell::default(),
 
             indication_handler: SharedMutex::new(indication_handler),
+            indication_queue: IndicationQueue::new(MAX_QUEUED_INDICATIONS),
             pending_confirmation,
 
             command_handler: AttCommandHandler::new(db),
@@ -113,7 +136,9 @@ impl<T: AttDatabase + Clone + 'static> WeakBoxRef<'_, AttServerBearer<T>> {
 
     /// Send an indication, wait for the peer confirmation, and return the
     /// appropriate status If multiple calls are outstanding, they are
-    /// executed in FIFO order.
+    /// executed in FIFO order. At most MAX_QUEUED_INDICATIONS can be
+    /// outstanding, and an outstanding indication not sent yet is dropped
+    /// if another one is queued for the same handle.
     pub fn send_indication(
         &self,
         handle: AttHandle,
@@ -121,11 +146,16 @@ impl<T: AttDatabase + Clone + 'static> WeakBoxRef<'_, AttServerBearer<T>> {
     ) -> impl Future<Output = Result<(), IndicationError>> {
         trace!("sending indication for handle {handle:?}");
 
+        let queued = self.indication_queue.enqueue(handle);
         let locked_indication_handler = self.indication_handler.lock();
         let pending_mtu = self.mtu.snapshot();
         let this = self.downgrade();
 
         async move {
+            let mut queued = queued.map_err(|err| {
+                warn!("indication for handle {handle:?} rejected since the queue is full");
+                err
+            })?;
             // first wait until we are at the head of the queue and are ready to send
             // indications
             let mut indication_handler = locked_indication_handler
@@ -141,11 +171,33 @@ impl<T: AttDatabase + Clone + 'static> WeakBoxRef<'_, AttServerBearer<T>> {
                     warn!("indication for handle {handle:?} cancelled while waiting for MTU exchange to complete since the connection dropped");
                     IndicationError::SendError(SendError::ConnectionDropped)
                 })?;
+            // skip the value if a more recent one is queued
+            queued.start().map_err(|err| {
+                trace!("indication for handle {handle:?} superseded while queued");
+                err
+            })?;
             // finally, send, and wait for a response
             indication_handler.send(handle, data, mtu, |packet| this.try_send_packet(packet)).await
         }
     }
 
+    /// Resolves once another indication can be queued without being rejected
+    pub fn indication_queue_ready(&self) -> impl Future<Output = ()> {
+        self.indication_queue.ready()
+    }
+
+    /// The counters of the indication queue
+    pub fn indication_queue_metrics(&self) -> IndicationQueueMetrics {
+        self.indication_queue.metrics()
+    }
+
+    /// The counters of the ATT transactions. Each bearer answers its requests
+    /// independently, so with several bearers on a connection their
+    /// transactions are in flight at the same time.
+    pub fn request_metrics(&self) -> AttRequestMetrics {
+        self.request_metrics.get()
+    }
+
     /// Handle a snooped MTU event, to update the MTU we use for our various
     /// operations
     pub fn handle_mtu_event(&self, mtu_event: MtuEvent) -> Result<()> {
@@ -161,11 +213,19 @@ impl<T: AttDatabase + Clone + 'static> WeakBoxRef<'_, AttServerBearer<T>> {
                 let mtu = self.mtu.snapshot_or_default();
                 let packet = packet.to_owned_packet();
                 let this = self.downgrade();
+                self.update_request_metrics(|metrics| metrics.in_flight = 1);
                 let task = spawn_local(async move {
                     trace!("starting ATT transaction");
+                    let started = Instant::now();
                     let reply = request_handler.process_packet(packet.view(), mtu).await;
+                    let latency = started.elapsed();
                     this.with(|this| {
                         this.map(|this| {
+                            this.update_request_metrics(|metrics| {
+                                metrics.in_flight = 0;
+                                metrics.completed += 1;
+                                metrics.max_latency = metrics.max_latency.max(latency);
+                            });
                             match this.send_packet(reply) {
                                 Ok(_) => {
                                     trace!("reply packet sent")
@@ -191,6 +251,7 @@ impl<T: AttDatabase + Clone + 'static> WeakBoxRef<'_, AttServerBearer<T>> {
             }
             AttRequestState::Pending(_) => {
                 warn!("multiple ATT operations cannot simultaneously take place, dropping one");
+                self.update_request_metrics(|metrics| metrics.dropped += 1);
                 // TODO(aryarahul) - disconnect connection here;
                 curr_request
             }
@@ -198,6 +259,14 @@ impl<T: AttDatabase + Clone + 'static> WeakBoxRef<'_, AttServerBearer<T>> {
     }
 }
 
+impl<T: AttDatabase> AttServerBearer<T> {
+    fn update_request_metrics(&self, update: impl FnOnce(&mut AttRequestMetrics)) {
+        let mut metrics = self.request_metrics.get();
+        update(&mut metrics);
+        self.request_metrics.set(metrics);
+    }
+}
+
 impl<T: AttDatabase + Clone + 'static> WeakBox<AttServerBearer<T>> {
     fn try_send_packet(&self, packet: impl Into<AttChild>) -> Result<(), SendError> {
         self.with(|this| {
@@ -387,6 +456,74 @@ mod test {
             assert_eq!(rx.try_recv(), Err(TryRecvError::Empty));
             // assert no callbacks are pending
             assert_eq!(data_rx.try_recv().unwrap_err(), TryRecvError::Empty);
+            // assert the second request was counted as dropped
+            let metrics = conn.as_ref().request_metrics();
+            assert_eq!(metrics.in_flight, 0);
+            assert_eq!(metrics.completed, 1);
+            assert_eq!(metrics.dropped, 1);
+        });
+    }
+
+    #[test]
+    fn test_transactions_on_bearers_are_independent() {
+        // arrange: two bearers on the same database, as with EATT
+        let (datastore, mut data_rx) = MockDatastore::new();
+        let db = SharedBox::new(GattDatabase::new());
+        db.add_service_with_handles(
+            GattServiceWithHandle {
+                handle: AttHandle(1),
+                type_: Uuid::new(1),
+                characteristics: vec![GattCharacteristicWithHandle {
+                    handle: VALID_HANDLE,
+                    type_: Uuid::new(2),
+                    permissions: AttPermissions::READABLE,
+                    descriptors: vec![],
+                }],
+            },
+            Rc::new(datastore),
+        )
+        .unwrap();
+        let (tx, mut rx) = unbounded_channel();
+        let open_bearer = || {
+            let tx = tx.clone();
+            SharedBox::new(AttServerBearer::new(db.get_att_database(TCB_IDX), move |packet| {
+                tx.send(packet).unwrap();
+                Ok(())
+            }))
+        };
+        let bearer1 = open_bearer();
+        let bearer2 = open_bearer();
+        let data = AttAttributeDataChild::RawData([1, 2].into());
+
+        block_on_locally(async {
+            // act: send a read request on each bearer before replying to either
+            let req = build_att_view_or_crash(AttReadRequestBuilder {
+                attribute_handle: VALID_HANDLE.into(),
+            });
+            bearer1.as_ref().handle_packet(req.view());
+            bearer2.as_ref().handle_packet(req.view());
+
+            // assert: both reads reached the upper layer at the same time
+            let mut replies = vec![];
+            for _ in 0..2 {
+                let MockDatastoreEvents::Read(_, VALID_HANDLE, _, data_resp) =
+                    data_rx.recv().await.unwrap()
+                else {
+                    unreachable!();
+                };
+                replies.push(data_resp);
+            }
+            assert_eq!(bearer1.as_ref().request_metrics().in_flight, 1);
+            assert_eq!(bearer2.as_ref().request_metrics().in_flight, 1);
+
+            for data_resp in replies {
+                data_resp.send(Ok(data.clone())).unwrap();
+            }
+            for _ in 0..2 {
+                assert_eq!(rx.recv().await.unwrap().opcode, AttOpcode::READ_RESPONSE);
+            }
+            assert_eq!(bearer1.as_ref().request_metrics().dropped, 0);
+            assert_eq!(bearer2.as_ref().request_metrics().dropped, 0);
         });
     }
 
@@ -555,6 +692,83 @@ mod test {
         });
     }
 
+    #[test]
+    fn test_queued_indications_superseded_value_dropped() {
+        block_on_locally(async {
+            // arrange: an outstanding indication
+            let (conn, mut rx) = open_connection();
+            let pending_send1 =
+                spawn_local(conn.as_ref().send_indication(
+                    VALID_HANDLE,
+                    AttAttributeDataChild::RawData([1, 2, 3].into()),
+                ));
+            rx.recv().await.unwrap();
+
+            // act: queue two values of another handle
+            let pending_send2 = spawn_local(conn.as_ref().send_indication(
+                ANOTHER_VALID_HANDLE,
+                AttAttributeDataChild::RawData([1, 2, 3].into()),
+            ));
+            let pending_send3 = spawn_local(conn.as_ref().send_indication(
+                ANOTHER_VALID_HANDLE,
+                AttAttributeDataChild::RawData([4, 5, 6].into()),
+            ));
+            // then confirm the first indication
+            conn.as_ref().handle_packet(
+                build_att_view_or_crash(AttHandleValueConfirmationBuilder {}).view(),
+            );
+            let sent = rx.recv().await.unwrap();
+
+            // assert: only the most recent value of the second handle was sent
+            assert!(matches!(pending_send1.await.unwrap(), Ok(())));
+            assert!(matches!(pending_send2.await.unwrap(), Err(IndicationError::Superseded)));
+            assert_eq!(sent.opcode, AttOpcode::HANDLE_VALUE_INDICATION);
+            assert_eq!(rx.try_recv(), Err(TryRecvError::Empty));
+            assert!(!pending_send3.is_finished());
+            assert_eq!(conn.as_ref().indication_queue_metrics().coalesced, 1);
+        });
+    }
+
+    #[test]
+    fn test_indication_queue_full() {
+        block_on_locally(async {
+            // arrange: a full queue
+            let (conn, _) = open_connection();
+            let mut pending_sends = vec![];
+            for i in 0..MAX_QUEUED_INDICATIONS {
+                pending_sends.push(spawn_local(conn.as_ref().send_indication(
+                    AttHandle(100 + i as u16),
+                    AttAttributeDataChild::RawData([1, 2, 3].into()),
+                )));
+            }
+
+            // act: queue one more
+            let rejected = conn
+                .as_ref()
+                .send_indication(VALID_HANDLE, AttAttributeDataChild::RawData([1, 2, 3].into()))
+                .await;
+
+            // assert: the extra indication was rejected
+            assert!(matches!(rejected, Err(IndicationError::QueueFull)));
+            // and the queue drains once the queued ones complete
+            for pending_send in pending_sends {
+                assert!(matches!(
+                    pending_send.await.unwrap(),
+                    Err(IndicationError::AttributeNotFound)
+                ));
+            }
+            assert_eq!(
+                conn.as_ref().indication_queue_metrics(),
+                IndicationQueueMetrics {
+                    depth: 0,
+                    max_depth: MAX_QUEUED_INDICATIONS,
+                    coalesced: 0,
+                    rejected: 1
+                }
+            );
+        });
+    }
+
     #[test]
     fn test_indication_connection_drop() {
         block_on_locally(async {
@@ -91,9 +91,23 @@ pub struct GattDatabase {
     listeners: RefCell<Vec<Rc<dyn GattDatabaseCallbacks>>>,
 }
 
-#[derive(Default)]
 struct GattDatabaseSchema {
     attributes: BTreeMap<AttHandle, AttAttributeWithBackingValue>,
+    /// The attributes in handle order, rebuilt whenever a service is added or
+    /// removed so that snapshots can share it instead of copying it
+    attribute_list: Rc<[AttAttribute]>,
+}
+
+impl Default for GattDatabaseSchema {
+    fn default() -> Self {
+        Self { attributes: BTreeMap::new(), attribute_list: Vec::new().into() }
+    }
+}
+
+impl GattDatabaseSchema {
+    fn update_attribute_list(&mut self) {
+        self.attribute_list = self.attributes.values().map(|attr| attr.attribute).collect();
+    }
 }
 
 #[derive(Clone)]
@@ -265,6 +279,7 @@ impl GattDatabase {
 
         // if we made it here, we successfully loaded the new service
         static_data.attributes.extend(attributes.clone());
+        static_data.update_attribute_list();
 
         // re-entrancy via the listeners is possible, so we prevent it by dropping here
         drop(static_data);
@@ -307,6 +322,7 @@ impl GattDatabase {
 
         // clear out attributes
         static_data.attributes.retain(|curr_handle, _| !in_service_pred(*curr_handle));
+        static_data.update_attribute_list();
 
         // re-entrancy via the listeners is possible, so we prevent it by dropping here
         drop(static_data);
@@ -481,9 +497,13 @@ impl AttDatabase for AttDatabaseImpl {
     }
 
     fn list_attributes(&self) -> Vec<AttAttribute> {
+        self.list_attributes_shared().to_vec()
+    }
+
+    fn list_attributes_shared(&self) -> Rc<[AttAttribute]> {
         self.gatt_db.with(|db| {
-            db.map(|db| db.schema.borrow().attributes.values().map(|attr| attr.attribute).collect())
-                .unwrap_or_default()
+            db.map(|db| db.schema.borrow().attribute_list.clone())
+                .unwrap_or_else(|| Vec::new().into())
         })
     }
 }
@@ -517,10 +537,13 @@ mod test {
     use tokio::{join, sync::mpsc::error::TryRecvError, task::spawn_local};
 
     use crate::{
-        gatt::mocks::{
-            mock_database_callbacks::{MockCallbackEvents, MockCallbacks},
-            mock_datastore::{MockDatastore, MockDatastoreEvents},
-            mock_raw_datastore::{MockRawDatastore, MockRawDatastoreEvents},
+        gatt::{
+            mocks::{
+                mock_database_callbacks::{MockCallbackEvents, MockCallbacks},
+                mock_datastore::{MockDatastore, MockDatastoreEvents},
+                mock_raw_datastore::{MockRawDatastore, MockRawDatastoreEvents},
+            },
+            server::att_database::StableAttDatabase,
         },
         packets::Packet,
         utils::{
@@ -669,6 +692,45 @@ mod test {
         );
     }
 
+    #[test]
+    fn test_snapshot_unaffected_by_service_removal() {
+        // arrange two services, each with a single characteristic
+        let (gatt_datastore, _) = MockDatastore::new();
+        let gatt_datastore = Rc::new(gatt_datastore);
+        let gatt_db = SharedBox::new(GattDatabase::new());
+        for service_handle in [1, 4] {
+            gatt_db
+                .add_service_with_handles(
+                    GattServiceWithHandle {
+                        handle: AttHandle(service_handle),
+                        type_: SERVICE_TYPE,
+                        characteristics: vec![GattCharacteristicWithHandle {
+                            handle: AttHandle(service_handle + 2),
+                            type_: CHARACTERISTIC_TYPE,
+                            permissions: AttPermissions::READABLE,
+                            descriptors: vec![],
+                        }],
+                    },
+                    gatt_datastore.clone(),
+                )
+                .unwrap();
+        }
+        let att_db = gatt_db.get_att_database(TCB_IDX);
+        let snapshot = att_db.snapshot();
+
+        // act: remove the second service
+        gatt_db.remove_service_at_handle(AttHandle(4)).unwrap();
+
+        // assert: the snapshot still sees it, but a new snapshot does not
+        assert_eq!(snapshot.list_attributes().len(), 6);
+        assert_eq!(snapshot.find_attribute(AttHandle(6)).unwrap().type_, CHARACTERISTIC_TYPE);
+        assert_eq!(att_db.snapshot().find_attribute(AttHandle(6)), None);
+        assert_eq!(
+            att_db.snapshot().find_attribute(AttHandle(3)).unwrap().type_,
+            CHARACTERISTIC_TYPE
+        );
+    }
+
     #[test]
     fn test_single_characteristic_declaration() {
         let (gatt_datastore, _) = MockDatastore::new();
@@ -36,6 +36,11 @@ pub enum IndicationError {
     ConfirmationTimeout,
     /// The connection was dropped while waiting for a confirmation
     ConnectionDroppedWhileWaitingForConfirmation,
+    /// Too many indications are already queued on this connection
+    QueueFull,
+    /// A more recent value of the same attribute was queued before this one
+    /// could be sent, so this one was dropped
+    Superseded,
 }
 
 pub struct IndicationHandler<T> {
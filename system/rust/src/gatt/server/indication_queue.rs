@@ -0,0 +1,210 @@
+//! This module bounds the indications queued on a bearer, so that a producer
+//! faster than the peer confirmations is told to back off instead of growing
+//! the queue without limit. Queued values of a handle that are superseded by a
+//! more recent value of the same handle are dropped without being sent.
+
+use std::{cell::RefCell, collections::HashMap, future::Future, rc::Rc};
+
+use tokio::sync::Notify;
+
+use crate::gatt::ids::AttHandle;
+
+use super::indication_handler::IndicationError;
+
+/// The maximum number of indications queued or in flight on a bearer
+pub const MAX_QUEUED_INDICATIONS: usize = 16;
+
+/// Counters describing the indication queue of a bearer
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct IndicationQueueMetrics {
+    /// The number of indications currently queued or in flight
+    pub depth: usize,
+    /// The largest depth reached so far
+    pub max_depth: usize,
+    /// The number of queued indications dropped since a more recent value of
+    /// the same handle was queued after them
+    pub coalesced: u64,
+    /// The number of indications rejected since the queue was full
+    pub rejected: u64,
+}
+
+#[derive(Default)]
+struct QueueState {
+    metrics: IndicationQueueMetrics,
+    // the most recent queued (not yet sent) entry of each handle
+    latest: HashMap<AttHandle, u64>,
+    next_entry: u64,
+}
+
+/// The indication queue of a bearer
+pub struct IndicationQueue {
+    capacity: usize,
+    state: Rc<RefCell<QueueState>>,
+    capacity_available: Rc<Notify>,
+}
+
+impl IndicationQueue {
+    /// Constructor, for a queue holding at most `capacity` indications
+    pub fn new(capacity: usize) -> Self {
+        Self {
+            capacity,
+            state: Rc::new(RefCell::new(QueueState::default())),
+            capacity_available: Rc::new(Notify::new()),
+        }
+    }
+
+    /// Reserve a place in the queue for an indication of `handle`. A queued
+    /// indication of the same handle that was not sent yet gives up its place
+    /// to this one.
+    pub fn enqueue(&self, handle: AttHandle) -> Result<QueuedIndication, IndicationError> {
+        let mut state = self.state.borrow_mut();
+        let id = state.next_entry;
+        state.next_entry += 1;
+
+        if state.latest.insert(handle, id).is_some() {
+            state.metrics.coalesced += 1;
+        } else if state.metrics.depth >= self.capacity {
+            state.latest.remove(&handle);
+            state.metrics.rejected += 1;
+            return Err(IndicationError::QueueFull);
+        } else {
+            state.metrics.depth += 1;
+            state.metrics.max_depth = state.metrics.max_depth.max(state.metrics.depth);
+        }
+
+        Ok(QueuedIndication {
+            handle,
+            id,
+            started: false,
+            state: self.state.clone(),
+            capacity_available: self.capacity_available.clone(),
+        })
+    }
+
+    /// Resolves once the queue has room for another indication
+    pub fn ready(&self) -> impl Future<Output = ()> {
+        let capacity = self.capacity;
+        let state = self.state.clone();
+        let capacity_available = self.capacity_available.clone();
+        async move {
+            loop {
+                let notified = capacity_available.notified();
+                if state.borrow().metrics.depth < capacity {
+                    return;
+                }
+                notified.await;
+            }
+        }
+    }
+
+    /// The current counters of the queue
+    pub fn metrics(&self) -> IndicationQueueMetrics {
+        self.state.borrow().metrics
+    }
+}
+
+/// A place in the indication queue, released when dropped
+pub struct QueuedIndication {
+    handle: AttHandle,
+    id: u64,
+    started: bool,
+    state: Rc<RefCell<QueueState>>,
+    capacity_available: Rc<Notify>,
+}
+
+impl QueuedIndication {
+    /// Mark the indication as being sent. Fails if a more recent value of the
+    /// same handle was queued in the meantime, in which case this one should
+    /// not be sent at all.
+    pub fn start(&mut self) -> Result<(), IndicationError> {
+        let mut state = self.state.borrow_mut();
+        if state.latest.get(&self.handle) != Some(&self.id) {
+            return Err(IndicationError::Superseded);
+        }
+        state.latest.remove(&self.handle);
+        self.started = true;
+        Ok(())
+    }
+}
+
+impl Drop for QueuedIndication {
+    fn drop(&mut self) {
+        let mut state = self.state.borrow_mut();
+        if !self.started {
+            if state.latest.get(&self.handle) != Some(&self.id) {
+                // a more recent value took over this place in the queue
+                return;
+            }
+            state.latest.remove(&self.handle);
+        }
+        state.metrics.depth -= 1;
+        self.capacity_available.notify_waiters();
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use crate::utils::task::{block_on_locally, try_await};
+
+    use super::*;
+
+    const HANDLE: AttHandle = AttHandle(1);
+    const ANOTHER_HANDLE: AttHandle = AttHandle(2);
+
+    #[test]
+    fn test_queue_full() {
+        let queue = IndicationQueue::new(1);
+
+        let _queued = queue.enqueue(HANDLE).unwrap();
+
+        assert!(matches!(queue.enqueue(ANOTHER_HANDLE), Err(IndicationError::QueueFull)));
+        assert_eq!(
+            queue.metrics(),
+            IndicationQueueMetrics { depth: 1, max_depth: 1, coalesced: 0, rejected: 1 }
+        );
+    }
+
+    #[test]
+    fn test_superseded_value_gives_up_its_place() {
+        let queue = IndicationQueue::new(1);
+
+        let mut first = queue.enqueue(HANDLE).unwrap();
+        let mut second = queue.enqueue(HANDLE).unwrap();
+
+        assert!(matches!(first.start(), Err(IndicationError::Superseded)));
+        drop(first);
+        assert_eq!(queue.metrics().depth, 1);
+        assert!(second.start().is_ok());
+        assert_eq!(queue.metrics().coalesced, 1);
+    }
+
+    #[test]
+    fn test_started_value_is_not_superseded() {
+        let queue = IndicationQueue::new(2);
+
+        let mut first = queue.enqueue(HANDLE).unwrap();
+        first.start().unwrap();
+        let mut second = queue.enqueue(HANDLE).unwrap();
+
+        assert_eq!(queue.metrics().depth, 2);
+        assert_eq!(queue.metrics().coalesced, 0);
+        drop(first);
+        assert!(second.start().is_ok());
+    }
+
+    #[test]
+    fn test_ready_once_a_place_is_released() {
+        block_on_locally(async {
+            let queue = IndicationQueue::new(1);
+            let mut queued = queue.enqueue(HANDLE).unwrap();
+            queued.start().unwrap();
+
+            let pending_ready = try_await(queue.ready()).await.unwrap_err();
+            drop(queued);
+
+            pending_ready.await;
+            assert_eq!(queue.metrics().depth, 0);
+            assert_eq!(queue.metrics().max_depth, 1);
+        });
+    }
+}
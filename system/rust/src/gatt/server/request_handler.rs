@@ -5,8 +5,8 @@ use crate::{
     packets::{
         AttChild, AttErrorCode, AttErrorResponseBuilder, AttFindByTypeValueRequestView,
         AttFindInformationRequestView, AttOpcode, AttReadByGroupTypeRequestView,
-        AttReadByTypeRequestView, AttReadRequestView, AttView, AttWriteRequestView, Packet,
-        ParseError,
+        AttReadByTypeRequestView, AttReadMultipleRequestView, AttReadMultipleVariableRequestView,
+        AttReadRequestView, AttView, AttWriteRequestView, Packet, ParseError,
     },
 };
 
@@ -16,7 +16,11 @@ use super::{
         find_by_type_value::handle_find_by_type_value_request,
         find_information_request::handle_find_information_request,
         read_by_group_type_request::handle_read_by_group_type_request,
-        read_by_type_request::handle_read_by_type_request, read_request::handle_read_request,
+        read_by_type_request::handle_read_by_type_request,
+        read_multiple_request::{
+            handle_read_multiple_request, handle_read_multiple_variable_request,
+        },
+        read_request::handle_read_request,
         write_request::handle_write_request,
     },
 };
@@ -61,6 +65,18 @@ impl<Db: AttDatabase> AttRequestHandler<Db> {
             AttOpcode::READ_REQUEST => {
                 Ok(handle_read_request(AttReadRequestView::try_parse(packet)?, mtu, &self.db).await)
             }
+            AttOpcode::READ_MULTIPLE_REQUEST => Ok(handle_read_multiple_request(
+                AttReadMultipleRequestView::try_parse(packet)?,
+                mtu,
+                &self.db,
+            )
+            .await),
+            AttOpcode::READ_MULTIPLE_VARIABLE_REQUEST => Ok(handle_read_multiple_variable_request(
+                AttReadMultipleVariableRequestView::try_parse(packet)?,
+                mtu,
+                &self.db,
+            )
+            .await),
             AttOpcode::READ_BY_GROUP_TYPE_REQUEST => {
                 handle_read_by_group_type_request(
                     AttReadByGroupTypeRequestView::try_parse(packet)?,
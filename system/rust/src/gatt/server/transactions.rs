@@ -3,5 +3,6 @@ pub mod find_information_request;
 mod helpers;
 pub mod read_by_group_type_request;
 pub mod read_by_type_request;
+pub mod read_multiple_request;
 pub mod read_request;
 pub mod write_request;
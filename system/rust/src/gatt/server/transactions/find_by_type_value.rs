@@ -22,10 +22,11 @@ pub async fn handle_find_by_type_value_request(
     mtu: usize,
     db: &impl StableAttDatabase,
 ) -> AttChild {
+    let attributes = db.list_attributes_shared();
     let Some(attrs) = filter_to_range(
         request.get_starting_handle().into(),
         request.get_ending_handle().into(),
-        db.list_attributes().into_iter(),
+        attributes.iter().copied(),
     ) else {
         return AttErrorResponseBuilder {
             opcode_in_error: AttOpcode::FIND_BY_TYPE_VALUE_REQUEST,
@@ -19,10 +19,11 @@ pub fn handle_find_information_request<T: AttDatabase>(
     mtu: usize,
     db: &T,
 ) -> AttChild {
+    let attributes = db.list_attributes_shared();
     let Some(attrs) = filter_to_range(
         request.get_starting_handle().into(),
         request.get_ending_handle().into(),
-        db.list_attributes().into_iter(),
+        attributes.iter().copied(),
     ) else {
         return AttErrorResponseBuilder {
             opcode_in_error: AttOpcode::FIND_INFORMATION_REQUEST,
@@ -37,11 +37,14 @@ pub fn find_group_end(
         return None; // invalid / unsupported grouping attribute
     }
 
+    let attributes = db.list_attributes_shared();
+    // ignore attributes at or before the current position
+    let group_body = attributes.partition_point(|attr| attr.handle <= group_start.handle);
+
     Some(
-        db.list_attributes()
-            .into_iter()
-            // ignore attributes at or before the current position
-            .skip_while(|attr| attr.handle <= group_start.handle)
+        attributes[group_body..]
+            .iter()
+            .copied()
             // consider only attributes strictly within the current group
             .take_while(|attr| {
                 get_grouping_level(attr.type_) > get_grouping_level(group_start.type_)
@@ -43,10 +43,11 @@ pub async fn handle_read_by_group_type_request(
         error_code: AttErrorCode::ATTRIBUTE_NOT_FOUND,
     };
 
+    let attributes = db.list_attributes_shared();
     let Some(attrs) = filter_to_range(
         request.get_starting_handle().into(),
         request.get_ending_handle().into(),
-        db.list_attributes().into_iter(),
+        attributes.iter().copied(),
     ) else {
         failure_response.error_code = AttErrorCode::INVALID_HANDLE;
         return Ok(failure_response.into());
@@ -0,0 +1,231 @@
+use crate::{
+    gatt::{ids::AttHandle, server::att_database::AttDatabase},
+    packets::{
+        AttAttributeDataBuilder, AttAttributeDataChild, AttChild, AttErrorCode,
+        AttErrorResponseBuilder, AttOpcode, AttReadMultipleRequestView,
+        AttReadMultipleResponseBuilder, AttReadMultipleVariableRequestView,
+        AttReadMultipleVariableResponseBuilder, Serializable,
+    },
+};
+
+pub async fn handle_read_multiple_request<T: AttDatabase>(
+    request: AttReadMultipleRequestView<'_>,
+    mtu: usize,
+    db: &T,
+) -> AttChild {
+    let handles = request.get_handles_iter().map(AttHandle::from).collect::<Vec<_>>();
+
+    match read_values(AttOpcode::READ_MULTIPLE_REQUEST, &handles, db).await {
+        Ok(values) => {
+            // as per 5.3 3F 3.4.4.8 ATT_READ_MULTIPLE_RSP, the concatenated values
+            // are truncated to MTU - 1
+            let mut out = values.concat();
+            out.truncate(mtu - 1);
+            AttReadMultipleResponseBuilder {
+                value: AttAttributeDataBuilder {
+                    _child_: AttAttributeDataChild::RawData(out.into_boxed_slice()),
+                },
+            }
+            .into()
+        }
+        Err(error_response) => error_response.into(),
+    }
+}
+
+pub async fn handle_read_multiple_variable_request<T: AttDatabase>(
+    request: AttReadMultipleVariableRequestView<'_>,
+    mtu: usize,
+    db: &T,
+) -> AttChild {
+    let handles = request.get_handles_iter().map(AttHandle::from).collect::<Vec<_>>();
+
+    match read_values(AttOpcode::READ_MULTIPLE_VARIABLE_REQUEST, &handles, db).await {
+        Ok(values) => {
+            // as per 5.3 3F 3.4.4.12 ATT_READ_MULTIPLE_VARIABLE_RSP, the Length Value
+            // Tuple List is truncated to MTU - 1, so only the last value included
+            // may be partial
+            let mut out = vec![];
+            for value in values {
+                let Ok(len) = u16::try_from(value.len()) else {
+                    return error_response(
+                        AttOpcode::READ_MULTIPLE_VARIABLE_REQUEST,
+                        handles[0],
+                        AttErrorCode::UNLIKELY_ERROR,
+                    )
+                    .into();
+                };
+                out.extend_from_slice(&len.to_le_bytes());
+                out.extend(value);
+                if out.len() >= mtu - 1 {
+                    break;
+                }
+            }
+            out.truncate(mtu - 1);
+            AttReadMultipleVariableResponseBuilder {
+                value: AttAttributeDataBuilder {
+                    _child_: AttAttributeDataChild::RawData(out.into_boxed_slice()),
+                },
+            }
+            .into()
+        }
+        Err(error_response) => error_response.into(),
+    }
+}
+
+/// Read all of the requested attributes concurrently. If any of them fails,
+/// the error refers to the first failing handle in request order, as per
+/// 5.3 3F 3.4.4.7 and 3.4.4.11.
+async fn read_values<T: AttDatabase>(
+    opcode: AttOpcode,
+    handles: &[AttHandle],
+    db: &T,
+) -> Result<Vec<Vec<u8>>, AttErrorResponseBuilder> {
+    if handles.is_empty() {
+        return Err(error_response(opcode, AttHandle(0), AttErrorCode::INVALID_PDU));
+    }
+
+    db.read_attributes(handles)
+        .await
+        .into_iter()
+        .zip(handles)
+        .map(|(value, handle)| match value {
+            Ok(value) => value
+                .to_vec()
+                .map_err(|_| error_response(opcode, *handle, AttErrorCode::UNLIKELY_ERROR)),
+            Err(error_code) => Err(error_response(opcode, *handle, error_code)),
+        })
+        .collect()
+}
+
+fn error_response(
+    opcode_in_error: AttOpcode,
+    handle: AttHandle,
+    error_code: AttErrorCode,
+) -> AttErrorResponseBuilder {
+    AttErrorResponseBuilder { opcode_in_error, handle_in_error: handle.into(), error_code }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+
+    use crate::{
+        core::uuid::Uuid,
+        gatt::server::{
+            att_database::{AttAttribute, AttPermissions},
+            test::test_att_db::TestAttDatabase,
+        },
+        packets::{AttReadMultipleRequestBuilder, AttReadMultipleVariableRequestBuilder},
+        utils::packet::{build_att_data, build_view_or_crash},
+    };
+
+    fn make_db() -> TestAttDatabase {
+        let attribute = |handle, permissions| AttAttribute {
+            handle: AttHandle(handle),
+            type_: Uuid::new(0x1234),
+            permissions,
+        };
+        TestAttDatabase::new(vec![
+            (attribute(3, AttPermissions::READABLE), vec![1, 2]),
+            (attribute(4, AttPermissions::READABLE), vec![3, 4, 5]),
+            (attribute(5, AttPermissions::empty()), vec![6]),
+        ])
+    }
+
+    fn do_read_multiple(handles: &[u16], mtu: usize, db: &TestAttDatabase) -> AttChild {
+        let att_view = build_view_or_crash(AttReadMultipleRequestBuilder {
+            handles: handles.iter().map(|handle| AttHandle(*handle).into()).collect(),
+        });
+        tokio_test::block_on(handle_read_multiple_request(att_view.view(), mtu, db))
+    }
+
+    fn do_read_multiple_variable(handles: &[u16], mtu: usize, db: &TestAttDatabase) -> AttChild {
+        let att_view = build_view_or_crash(AttReadMultipleVariableRequestBuilder {
+            handles: handles.iter().map(|handle| AttHandle(*handle).into()).collect(),
+        });
+        tokio_test::block_on(handle_read_multiple_variable_request(att_view.view(), mtu, db))
+    }
+
+    #[test]
+    fn test_read_multiple() {
+        let db = make_db();
+
+        let response = do_read_multiple(&[4, 3], 31, &db);
+
+        response.to_vec().unwrap(); // check it serializes
+        assert_eq!(
+            response,
+            AttChild::AttReadMultipleResponse(AttReadMultipleResponseBuilder {
+                value: build_att_data(AttAttributeDataChild::RawData([3, 4, 5, 1, 2].into()))
+            })
+        );
+    }
+
+    #[test]
+    fn test_truncated_read_multiple() {
+        let db = make_db();
+
+        let response = do_read_multiple(&[3, 4], 4, &db);
+
+        assert_eq!(response.to_vec().unwrap(), vec![1, 2, 3]);
+    }
+
+    #[test]
+    fn test_read_multiple_reports_first_failing_handle() {
+        let db = make_db();
+
+        let response = do_read_multiple(&[3, 5, 6], 31, &db);
+
+        assert_eq!(
+            response,
+            AttChild::AttErrorResponse(AttErrorResponseBuilder {
+                opcode_in_error: AttOpcode::READ_MULTIPLE_REQUEST,
+                handle_in_error: AttHandle(5).into(),
+                error_code: AttErrorCode::READ_NOT_PERMITTED,
+            })
+        );
+    }
+
+    #[test]
+    fn test_read_multiple_variable() {
+        let db = make_db();
+
+        let response = do_read_multiple_variable(&[3, 4], 31, &db);
+
+        response.to_vec().unwrap(); // check it serializes
+        assert_eq!(
+            response,
+            AttChild::AttReadMultipleVariableResponse(AttReadMultipleVariableResponseBuilder {
+                value: build_att_data(AttAttributeDataChild::RawData(
+                    [2, 0, 1, 2, 3, 0, 3, 4, 5].into()
+                ))
+            })
+        );
+    }
+
+    #[test]
+    fn test_truncated_read_multiple_variable() {
+        let db = make_db();
+
+        let response = do_read_multiple_variable(&[3, 4, 3], 8, &db);
+
+        // the second value is cut short, and the third one is left out
+        assert_eq!(response.to_vec().unwrap(), vec![2, 0, 1, 2, 3, 0, 3]);
+    }
+
+    #[test]
+    fn test_read_multiple_variable_missing_handle() {
+        let db = make_db();
+
+        let response = do_read_multiple_variable(&[3, 6], 31, &db);
+
+        assert_eq!(
+            response,
+            AttChild::AttErrorResponse(AttErrorResponseBuilder {
+                opcode_in_error: AttOpcode::READ_MULTIPLE_VARIABLE_REQUEST,
+                handle_in_error: AttHandle(6).into(),
+                error_code: AttErrorCode::INVALID_HANDLE,
+            })
+        );
+    }
+}
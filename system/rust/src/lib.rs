@@ -22,7 +22,11 @@ use log::{info, warn};
 use tokio::task::LocalSet;
 
 use self::core::shared_box::SharedBox;
-use std::{rc::Rc, sync::Mutex};
+use std::{
+    rc::Rc,
+    sync::Mutex,
+    time::{Duration, Instant},
+};
 use tokio::runtime::Builder;
 
 use tokio::sync::mpsc;
@@ -61,6 +65,44 @@ pub struct ModuleViews<'a> {
 
 static GLOBAL_MODULE_REGISTRY: Mutex<Option<GlobalModuleRegistry>> = Mutex::new(None);
 
+/// Timing of the callbacks posted into the Rust thread from foreign threads
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct MainThreadMetrics {
+    /// The number of callbacks run on the Rust thread
+    pub callbacks: u64,
+    /// The total time callbacks spent queued before starting to run
+    pub total_scheduling_delay: Duration,
+    /// The longest time a callback spent queued before starting to run
+    pub max_scheduling_delay: Duration,
+    /// The total time spent running callbacks
+    pub total_run_time: Duration,
+    /// The longest time spent running a single callback
+    pub max_run_time: Duration,
+}
+
+impl MainThreadMetrics {
+    fn record(&mut self, scheduling_delay: Duration, run_time: Duration) {
+        self.callbacks += 1;
+        self.total_scheduling_delay += scheduling_delay;
+        self.max_scheduling_delay = self.max_scheduling_delay.max(scheduling_delay);
+        self.total_run_time += run_time;
+        self.max_run_time = self.max_run_time.max(run_time);
+    }
+}
+
+static MAIN_THREAD_METRICS: Mutex<MainThreadMetrics> = Mutex::new(MainThreadMetrics {
+    callbacks: 0,
+    total_scheduling_delay: Duration::ZERO,
+    max_scheduling_delay: Duration::ZERO,
+    total_run_time: Duration::ZERO,
+    max_run_time: Duration::ZERO,
+});
+
+/// The timing of the callbacks run on the Rust thread since it was started
+pub fn main_thread_metrics() -> MainThreadMetrics {
+    *MAIN_THREAD_METRICS.lock().unwrap()
+}
+
 impl GlobalModuleRegistry {
     /// Handles bringup of all Rust modules. This occurs after GD C++ modules
     /// have started, but before the legacy stack has initialized.
@@ -80,6 +122,7 @@ impl GlobalModuleRegistry {
         let local = LocalSet::new();
 
         let (tx, mut rx) = mpsc::unbounded_channel();
+        *MAIN_THREAD_METRICS.lock().unwrap() = MainThreadMetrics::default();
         let prev_registry = GLOBAL_MODULE_REGISTRY.lock().unwrap().replace(Self { task_tx: tx });
 
         // initialization should only happen once
@@ -116,7 +159,14 @@ impl GlobalModuleRegistry {
             info!("starting Tokio event loop");
             while let Some(message) = rx.recv().await {
                 match message {
-                    MainThreadTxMessage::Callback(f) => f(&mut modules),
+                    MainThreadTxMessage::Callback(f, posted) => {
+                        let started = Instant::now();
+                        f(&mut modules);
+                        MAIN_THREAD_METRICS
+                            .lock()
+                            .unwrap()
+                            .record(started - posted, started.elapsed());
+                    }
                     MainThreadTxMessage::Stop => {
                         break;
                     }
@@ -131,7 +181,7 @@ impl GlobalModuleRegistry {
 
 type BoxedMainThreadCallback = Box<dyn for<'a> FnOnce(&'a mut ModuleViews) + Send + 'static>;
 enum MainThreadTxMessage {
-    Callback(BoxedMainThreadCallback),
+    Callback(BoxedMainThreadCallback, Instant),
     Stop,
 }
 type MainThreadTx = mpsc::UnboundedSender<MainThreadTxMessage>;
@@ -164,8 +214,33 @@ where
         warn!("ignoring do_in_rust_thread() invocation since Rust loop is inactive");
         return;
     }
-    let ret = MAIN_THREAD_TX.with(|tx| tx.send(MainThreadTxMessage::Callback(Box::new(f))));
+    let ret = MAIN_THREAD_TX
+        .with(|tx| tx.send(MainThreadTxMessage::Callback(Box::new(f), Instant::now())));
     if ret.is_err() {
         panic!("Rust call failed");
     }
 }
+
+#[cfg(test)]
+mod test {
+    use super::*;
+
+    #[test]
+    fn test_main_thread_metrics_record() {
+        let mut metrics = MainThreadMetrics::default();
+
+        metrics.record(Duration::from_millis(3), Duration::from_millis(1));
+        metrics.record(Duration::from_millis(1), Duration::from_millis(5));
+
+        assert_eq!(
+            metrics,
+            MainThreadMetrics {
+                callbacks: 2,
+                total_scheduling_delay: Duration::from_millis(4),
+                max_scheduling_delay: Duration::from_millis(3),
+                total_run_time: Duration::from_millis(6),
+                max_run_time: Duration::from_millis(5),
+            }
+        );
+    }
+}
@@ -1,5 +1,6 @@
 //! Utilities that are not specific to a particular module
 
+pub mod join;
 pub mod owned_handle;
 pub mod packet;
 
@@ -0,0 +1,81 @@
+//! This module provides a way to await several futures at once without
+//! spawning them, so that they may borrow from the caller.
+
+use std::{
+    future::{poll_fn, Future},
+    pin::Pin,
+    task::Poll,
+};
+
+/// Poll all of the supplied futures concurrently on the current task, and
+/// return their outputs in the order in which the futures were supplied.
+pub async fn join_all<F: Future>(futures: impl IntoIterator<Item = F>) -> Vec<F::Output> {
+    let mut futures = futures.into_iter().map(Box::pin).collect::<Vec<Pin<Box<F>>>>();
+    let mut outputs = futures.iter().map(|_| None).collect::<Vec<Option<F::Output>>>();
+
+    poll_fn(|cx| {
+        let mut pending = false;
+        for (future, output) in futures.iter_mut().zip(outputs.iter_mut()) {
+            if output.is_none() {
+                match future.as_mut().poll(cx) {
+                    Poll::Ready(value) => *output = Some(value),
+                    Poll::Pending => pending = true,
+                }
+            }
+        }
+        if pending {
+            Poll::Pending
+        } else {
+            Poll::Ready(())
+        }
+    })
+    .await;
+
+    outputs.into_iter().map(|output| output.unwrap()).collect()
+}
+
+#[cfg(test)]
+mod test {
+    use std::{cell::RefCell, rc::Rc};
+
+    use tokio::sync::oneshot;
+
+    use crate::utils::task::block_on_locally;
+
+    use super::*;
+
+    #[test]
+    fn test_empty() {
+        let outputs = block_on_locally(join_all(Vec::<std::future::Ready<()>>::new()));
+
+        assert!(outputs.is_empty());
+    }
+
+    #[test]
+    fn test_outputs_in_order_when_completed_out_of_order() {
+        block_on_locally(async {
+            let (tx1, rx1) = oneshot::channel();
+            let (tx2, rx2) = oneshot::channel();
+            let completed = Rc::new(RefCell::new(vec![]));
+
+            let wait = |rx: oneshot::Receiver<u8>| {
+                let completed = completed.clone();
+                async move {
+                    let value = rx.await.unwrap();
+                    completed.borrow_mut().push(value);
+                    value
+                }
+            };
+
+            let (outputs, _) = tokio::join!(join_all([wait(rx1), wait(rx2)]), async {
+                // both futures are waiting at the same time
+                tx2.send(2).unwrap();
+                tokio::task::yield_now().await;
+                tx1.send(1).unwrap();
+            });
+
+            assert_eq!(outputs, vec![1, 2]);
+            assert_eq!(*completed.borrow(), vec![2, 1]);
+        });
+    }
+}
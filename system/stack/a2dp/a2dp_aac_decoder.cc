@@ -106,3 +106,28 @@ bool a2dp_aac_decoder_decode_packet(BT_HDR* p_buf) {
 
   return true;
 }
+
+bool a2dp_aac_decoder_conceal(void) {
+  if (!a2dp_aac_decoder_cb.has_aac_handle) return false;
+
+  CStreamInfo* info = aacDecoder_GetStreamInfo(a2dp_aac_decoder_cb.aac_handle);
+  if (!info || info->sampleRate <= 0 || info->frameSize <= 0) {
+    // Nothing was decoded yet
+    return false;
+  }
+
+  AAC_DECODER_ERROR err = aacDecoder_DecodeFrame(
+      a2dp_aac_decoder_cb.aac_handle, a2dp_aac_decoder_cb.decode_buf,
+      DECODE_BUF_LEN, AACDEC_CONCEAL);
+  if (err != AAC_DEC_OK) {
+    log::error("aacDecoder_DecodeFrame concealment failed: 0x{:x}",
+               static_cast<int>(err));
+    return false;
+  }
+
+  size_t frame_len = info->frameSize * info->numChannels *
+                     sizeof(a2dp_aac_decoder_cb.decode_buf[0]);
+  a2dp_aac_decoder_cb.decode_callback(
+      reinterpret_cast<uint8_t*>(a2dp_aac_decoder_cb.decode_buf), frame_len);
+  return true;
+}
@@ -36,3 +36,5 @@ bool a2dp_aac_decoder_init(decoded_data_callback_t decode_callback) {
 void a2dp_aac_decoder_cleanup(void) {}
 
 bool a2dp_aac_decoder_decode_packet(BT_HDR* p_buf) { return false; }
+
+bool a2dp_aac_decoder_conceal(void) { return false; }
@@ -25,6 +25,8 @@
 #include <string.h>
 
 #include "a2dp_aac.h"
+#include "a2dp_media_buffer.h"
+#include "a2dp_bitrate_controller.h"
 #include "common/time_util.h"
 #include "include/check.h"
 #include "internal_include/bt_target.h"
@@ -40,7 +42,7 @@
 #define A2DP_AAC_ENCODER_INTERVAL_MS 20
 
 // offset
-#define A2DP_AAC_OFFSET AVDT_MEDIA_OFFSET
+#define A2DP_AAC_OFFSET A2DP_MEDIA_BUFFER_HEADROOM
 
 using namespace bluetooth;
 
@@ -87,6 +89,7 @@ typedef struct {
 
   HANDLE_AACENCODER aac_handle;
   bool has_aac_handle;  // True if aac_handle is valid
+  int configured_bit_rate;  // Bit rate of the bitrate controller level 0
 
   tA2DP_FEEDING_PARAMS feeding_params;
   tA2DP_AAC_ENCODER_PARAMS aac_encoder_params;
@@ -296,6 +299,7 @@ static void a2dp_aac_encoder_update(A2dpCodecConfig* a2dp_codec_config,
         aac_param_value, aac_error);
     return;  // TODO: Return an error?
   }
+  a2dp_aac_encoder_cb.configured_bit_rate = aac_param_value;
 
   // Set the encoder's parameters: PEAK Bit Rate
   aac_error = aacEncoder_SetParam(a2dp_aac_encoder_cb.aac_handle,
@@ -383,6 +387,13 @@ static void a2dp_aac_encoder_update(A2dpCodecConfig* a2dp_codec_config,
     return;  // TODO: Return an error?
   }
 
+  // The bitrate controller only adjusts a constant bit rate
+  a2dp_bitrate_controller_reset(
+      a2dp_source_bitrate_controller(),
+      aac_param_value == A2DP_AAC_VARIABLE_BIT_RATE_DISABLED
+          ? A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS
+          : 1);
+
   // Mark the end of setting the encoder's parameters
   aac_error =
       aacEncEncode(a2dp_aac_encoder_cb.aac_handle, NULL, NULL, NULL, NULL);
@@ -480,6 +491,27 @@ void a2dp_aac_send_frames(uint64_t timestamp_us) {
   }
 }
 
+void a2dp_aac_set_transmit_queue_length(size_t transmit_queue_length) {
+  tA2DP_BITRATE_CONTROLLER* p_controller = a2dp_source_bitrate_controller();
+  if (!a2dp_bitrate_controller_update(p_controller, transmit_queue_length) ||
+      !a2dp_aac_encoder_cb.has_aac_handle) {
+    return;
+  }
+
+  // The new bit rate applies from the next encoded frame on
+  int bit_rate = a2dp_bitrate_controller_scale_bitrate(
+      p_controller, a2dp_aac_encoder_cb.configured_bit_rate);
+  AACENC_ERROR aac_error = aacEncoder_SetParam(a2dp_aac_encoder_cb.aac_handle,
+                                               AACENC_BITRATE, bit_rate);
+  if (aac_error != AACENC_OK) {
+    log::error(
+        "Cannot set AAC parameter AACENC_BITRATE to {}: AAC error 0x{:x}",
+        bit_rate, aac_error);
+    return;
+  }
+  log::info("bit rate {}", bit_rate);
+}
+
 // Obtains the number of frames to send and number of iterations
 // to be used. |num_of_iterations| and |num_of_frames| parameters
 // are used as output param for returning the respective values.
@@ -568,10 +600,7 @@ static void a2dp_aac_encode_frames(uint8_t nb_frame) {
   int written = 0;
 
   while (nb_frame) {
-    BT_HDR* p_buf = (BT_HDR*)osi_malloc(BT_DEFAULT_BUFFER_SIZE);
-    p_buf->offset = A2DP_AAC_OFFSET;
-    p_buf->len = 0;
-    p_buf->layer_specific = 0;
+    BT_HDR* p_buf = a2dp_media_buffer_alloc(A2DP_AAC_OFFSET);
     a2dp_aac_encoder_cb.stats.media_read_total_expected_packets++;
 
     count = 0;
@@ -671,7 +700,7 @@ static bool a2dp_aac_read_feeding(uint8_t* read_buffer, uint32_t* bytes_read) {
 
 static uint16_t adjust_effective_mtu(
     const tA2DP_ENCODER_INIT_PEER_PARAMS& peer_params) {
-  uint16_t mtu_size = BT_DEFAULT_BUFFER_SIZE - A2DP_AAC_OFFSET - sizeof(BT_HDR);
+  uint16_t mtu_size = A2DP_MEDIA_BUFFER_MAX_PAYLOAD(A2DP_AAC_OFFSET);
   if (mtu_size > peer_params.peer_mtu) {
     mtu_size = peer_params.peer_mtu;
   }
@@ -703,6 +732,12 @@ void A2dpCodecConfigAacSource::debug_codec_dump(int fd) {
       ((codec_specific_1 & ~A2DP_AAC_VARIABLE_BIT_RATE_MASK) == 0 ? "Constant"
                                                                   : "Variable"),
       codec_specific_1);
+  tA2DP_BITRATE_CONTROLLER* p_controller = a2dp_source_bitrate_controller();
+  dprintf(fd,
+          "  Bitrate controller (level/levels/adjustments)           : %d / "
+          "%d / %zu\n",
+          p_controller->level, p_controller->num_levels,
+          p_controller->adjustments);
   dprintf(fd, "  Encoder interval (ms): %" PRIu64 "\n",
           a2dp_aac_get_encoder_interval_ms());
   dprintf(fd, "  Effective MTU: %d\n", a2dp_aac_get_effective_frame_size());
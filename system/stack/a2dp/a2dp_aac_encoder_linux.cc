@@ -43,14 +43,15 @@ class FFmpegInterface {
  public:
   // Updates the context and configures codec parameters.
   //
+  // The MMC session is kept when the parameters are unchanged, so that a
+  // stream restarted with the same configuration does not wait for the
+  // codec to be set up again through the MMC daemon.
+  //
   // Returns:
   //   The (fixed) input pcm frame size that the encoder accepts.
   //   Otherwise a negative errno on error.
   int prepare_context(int sample_rate, int channel_count, int bit_rate,
                       int bit_depth, int effective_frame_size) {
-    clear_context();
-    client = new mmc::CodecClient;
-
     mmc::AacEncoderParam param;
     param.set_sample_rate(sample_rate);
     param.set_channel_count(channel_count);
@@ -58,13 +59,30 @@ class FFmpegInterface {
     param.set_bit_depth(bit_depth);
     param.set_effective_frame_size(effective_frame_size);
 
+    std::string serialized_param = param.SerializeAsString();
+    if (client && frame_size > 0 && serialized_param == current_param) {
+      log::info("Reusing the encoder context");
+      reused_count++;
+      return frame_size;
+    }
+
+    // The DBus connection of the client is kept, only the session is reset
+    if (!client) {
+      client = new mmc::CodecClient;
+    }
+    frame_size = -1;
+    current_param.clear();
+
     mmc::ConfigParam config;
     *config.mutable_a2dp_aac_encoder_param() = param;
 
     int rc = client->init(config);
     if (rc < 0) {
       log::error("Init failed with error message, {}", strerror(-rc));
+      return rc;
     }
+    frame_size = rc;
+    current_param = std::move(serialized_param);
     return rc;
   }
 
@@ -74,8 +92,13 @@ class FFmpegInterface {
       delete client;
       client = nullptr;
     }
+    frame_size = -1;
+    current_param.clear();
   }
 
+  // Number of times a context was reused instead of set up again
+  size_t get_reused_count() const { return reused_count; }
+
   // Returns a negative errno if the encoded frame was not produced.
   // Otherwise returns the length of the encoded frame stored in `o_buf`.
   int encode_pcm(uint8_t* i_buf, int i_len, uint8_t* o_buf, int o_len) {
@@ -93,12 +116,18 @@ class FFmpegInterface {
 
     if (rc < 0) {
       log::error("Encode failed with error message, {}", strerror(-rc));
+      // Set the session up again on the next stream
+      frame_size = -1;
     }
     return rc;
   }
 
  private:
   mmc::CodecClient* client = nullptr;
+  // Input frame size and serialized parameters of the live MMC session
+  int frame_size = -1;
+  std::string current_param;
+  size_t reused_count = 0;
 };
 
 typedef struct {
@@ -211,8 +240,9 @@ void a2dp_aac_encoder_init(const tA2DP_ENCODER_INIT_PEER_PARAMS* p_peer_params,
   };
 }
 
+// The MMC session is kept for the next stream, it is released when the
+// encoder is unloaded or set up with a different configuration.
 void a2dp_aac_encoder_cleanup() {
-  codec_intf.clear_context();
   a2dp_aac_encoder_cb = tA2DP_AAC_ENCODER_CB{};
 }
 
@@ -251,6 +281,9 @@ int a2dp_aac_get_effective_frame_size() {
   return a2dp_aac_encoder_cb.TxAaMtuSize;
 }
 
+// The MMC encoder keeps the bit rate configured for the session.
+void a2dp_aac_set_transmit_queue_length(size_t /* transmit_queue_length */) {}
+
 void a2dp_aac_send_frames(uint64_t timestamp_us) {
   uint8_t nb_frame = 0;
   uint8_t nb_iterations = 0;
@@ -421,6 +454,7 @@ void A2dpCodecConfigAacSource::debug_codec_dump(int fd) {
   dprintf(fd, "  Encoder interval (ms): %" PRIu64 "\n",
           a2dp_aac_get_encoder_interval_ms());
   dprintf(fd, "  Effective MTU: %d\n", a2dp_aac_get_effective_frame_size());
+  dprintf(fd, "  Encoder context reuses: %zu\n", codec_intf.get_reused_count());
   dprintf(fd,
           "  Packet counts (expected/dropped)                        : %zu / "
           "%zu\n",
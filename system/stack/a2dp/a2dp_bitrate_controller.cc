@@ -0,0 +1,134 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define LOG_TAG "a2dp_bitrate_controller"
+
+#include "a2dp_bitrate_controller.h"
+
+#include <bluetooth/log.h>
+#include <string.h>
+
+using namespace bluetooth;
+
+// The typical runlevel of the TX queue is ~1 packet. The TX queue is
+// congested from this length on...
+#define A2DP_BITRATE_CONTROLLER_CONGESTED_QUEUE_LENGTH 3
+// ...and the level steps down if it stays congested for this many ticks.
+#define A2DP_BITRATE_CONTROLLER_CONGESTED_TICKS 4
+
+// The level steps down right away from this TX queue length on.
+#define A2DP_BITRATE_CONTROLLER_CRITICAL_QUEUE_LENGTH 6
+
+// Ticks to give the TX queue to drain after the level stepped down, before
+// another step down.
+#define A2DP_BITRATE_CONTROLLER_HOLDOFF_TICKS 10
+
+// The level steps up once the TX queue kept its typical runlevel for this
+// many ticks (5 seconds with a 20 ms encoder interval).
+#define A2DP_BITRATE_CONTROLLER_RECOVERY_TICKS 250
+
+static tA2DP_BITRATE_CONTROLLER a2dp_source_bitrate_controller_cb;
+
+void a2dp_bitrate_controller_reset(tA2DP_BITRATE_CONTROLLER* p_controller,
+                                   uint8_t num_levels) {
+  memset(p_controller, 0, sizeof(*p_controller));
+  p_controller->num_levels = num_levels;
+}
+
+bool a2dp_bitrate_controller_update(tA2DP_BITRATE_CONTROLLER* p_controller,
+                                    size_t transmit_queue_length) {
+  if (p_controller->num_levels <= 1) return false;
+
+  if (p_controller->holdoff_ticks > 0) p_controller->holdoff_ticks--;
+
+  bool failed_contacts = p_controller->failed_contacts;
+  p_controller->failed_contacts = false;
+
+  bool step_down = false;
+  if (p_controller->packets_dropped) {
+    // Packets were already lost, do not wait for the TX queue
+    p_controller->packets_dropped = false;
+    step_down = true;
+  } else if (failed_contacts ||
+             transmit_queue_length >=
+                 A2DP_BITRATE_CONTROLLER_CRITICAL_QUEUE_LENGTH) {
+    step_down = (p_controller->holdoff_ticks == 0);
+  } else if (transmit_queue_length >=
+             A2DP_BITRATE_CONTROLLER_CONGESTED_QUEUE_LENGTH) {
+    p_controller->congested_ticks++;
+    step_down = (p_controller->holdoff_ticks == 0 &&
+                 p_controller->congested_ticks >=
+                     A2DP_BITRATE_CONTROLLER_CONGESTED_TICKS);
+  } else {
+    p_controller->congested_ticks = 0;
+  }
+
+  if (step_down) {
+    p_controller->congested_ticks = 0;
+    p_controller->clear_ticks = 0;
+    p_controller->holdoff_ticks = A2DP_BITRATE_CONTROLLER_HOLDOFF_TICKS;
+    if (p_controller->level + 1 >= p_controller->num_levels) return false;
+    p_controller->level++;
+    p_controller->adjustments++;
+    log::info("stepping down to level {} of {}, TX queue length {}",
+              p_controller->level, p_controller->num_levels,
+              transmit_queue_length);
+    return true;
+  }
+
+  if (failed_contacts || transmit_queue_length > 1) {
+    p_controller->clear_ticks = 0;
+    return false;
+  }
+  if (++p_controller->clear_ticks < A2DP_BITRATE_CONTROLLER_RECOVERY_TICKS) {
+    return false;
+  }
+  p_controller->clear_ticks = 0;
+  if (p_controller->level == 0) return false;
+  p_controller->level--;
+  p_controller->adjustments++;
+  log::info("stepping up to level {} of {}", p_controller->level,
+            p_controller->num_levels);
+  return true;
+}
+
+void a2dp_bitrate_controller_report_dropped_packets(
+    tA2DP_BITRATE_CONTROLLER* p_controller, size_t num_dropped) {
+  if (num_dropped > 0) p_controller->packets_dropped = true;
+}
+
+void a2dp_bitrate_controller_report_failed_contact_counter(
+    tA2DP_BITRATE_CONTROLLER* p_controller, uint16_t failed_contact_counter) {
+  if (p_controller->has_failed_contact_counter &&
+      failed_contact_counter > p_controller->failed_contact_counter) {
+    p_controller->failed_contacts = true;
+  }
+  p_controller->has_failed_contact_counter = true;
+  p_controller->failed_contact_counter = failed_contact_counter;
+}
+
+uint32_t a2dp_bitrate_controller_scale_bitrate(
+    const tA2DP_BITRATE_CONTROLLER* p_controller, uint32_t full_bitrate) {
+  // Each level removes 1/8 of the bitrate, down to 5/8 of it
+  const uint32_t steps = 2 * A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS;
+  return (uint64_t)full_bitrate * (steps - p_controller->level) / steps;
+}
+
+tA2DP_BITRATE_CONTROLLER* a2dp_source_bitrate_controller(void) {
+  return &a2dp_source_bitrate_controller_cb;
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define LOG_TAG "a2dp_encoder_load_controller"
+
+#include "a2dp_encoder_load_controller.h"
+
+#include <bluetooth/log.h>
+#include <string.h>
+
+using namespace bluetooth;
+
+// A tick is overloaded when encoding takes more than this percentage of the
+// media interval...
+#define A2DP_ENCODER_LOAD_CONTROLLER_OVERLOADED_PERCENT 50
+// ...and the level steps down if this many consecutive ticks are overloaded.
+#define A2DP_ENCODER_LOAD_CONTROLLER_OVERLOADED_TICKS 4
+
+// Ticks to give the lower complexity a chance to show, after the level
+// stepped down, before another step down.
+#define A2DP_ENCODER_LOAD_CONTROLLER_HOLDOFF_TICKS 10
+
+// The level steps up once encoding took less than this percentage of the
+// media interval for this many ticks (5 seconds with a 20 ms interval).
+#define A2DP_ENCODER_LOAD_CONTROLLER_IDLE_PERCENT 25
+#define A2DP_ENCODER_LOAD_CONTROLLER_RECOVERY_TICKS 250
+
+static tA2DP_ENCODER_LOAD_CONTROLLER a2dp_source_encoder_load_controller_cb;
+
+void a2dp_encoder_load_controller_reset(
+    tA2DP_ENCODER_LOAD_CONTROLLER* p_controller, uint8_t num_levels,
+    uint32_t interval_us) {
+  memset(p_controller, 0, sizeof(*p_controller));
+  p_controller->num_levels = num_levels;
+  p_controller->interval_us = interval_us;
+}
+
+bool a2dp_encoder_load_controller_update(
+    tA2DP_ENCODER_LOAD_CONTROLLER* p_controller, uint32_t encode_us) {
+  if (p_controller->interval_us == 0) return false;
+
+  p_controller->last_encode_us = encode_us;
+  if (encode_us > p_controller->max_encode_us) {
+    p_controller->max_encode_us = encode_us;
+  }
+
+  bool deadline_missed = encode_us >= p_controller->interval_us;
+  if (deadline_missed) {
+    p_controller->deadline_misses++;
+    log::warn("encoding took {} us, more than the {} us interval", encode_us,
+              p_controller->interval_us);
+  }
+
+  if (p_controller->num_levels <= 1) return false;
+
+  if (p_controller->holdoff_ticks > 0) p_controller->holdoff_ticks--;
+
+  uint64_t load_percent = (uint64_t)encode_us * 100 / p_controller->interval_us;
+
+  bool step_down = false;
+  if (deadline_missed) {
+    step_down = (p_controller->holdoff_ticks == 0);
+  } else if (load_percent > A2DP_ENCODER_LOAD_CONTROLLER_OVERLOADED_PERCENT) {
+    p_controller->overloaded_ticks++;
+    step_down = (p_controller->holdoff_ticks == 0 &&
+                 p_controller->overloaded_ticks >=
+                     A2DP_ENCODER_LOAD_CONTROLLER_OVERLOADED_TICKS);
+  } else {
+    p_controller->overloaded_ticks = 0;
+  }
+
+  if (step_down) {
+    p_controller->overloaded_ticks = 0;
+    p_controller->idle_ticks = 0;
+    p_controller->holdoff_ticks = A2DP_ENCODER_LOAD_CONTROLLER_HOLDOFF_TICKS;
+    if (p_controller->level + 1 >= p_controller->num_levels) return false;
+    p_controller->level++;
+    p_controller->adjustments++;
+    log::info("stepping down to level {} of {}, encoding took {} us",
+              p_controller->level, p_controller->num_levels, encode_us);
+    return true;
+  }
+
+  if (load_percent >= A2DP_ENCODER_LOAD_CONTROLLER_IDLE_PERCENT) {
+    p_controller->idle_ticks = 0;
+    return false;
+  }
+  if (++p_controller->idle_ticks <
+      A2DP_ENCODER_LOAD_CONTROLLER_RECOVERY_TICKS) {
+    return false;
+  }
+  p_controller->idle_ticks = 0;
+  if (p_controller->level == 0) return false;
+  p_controller->level--;
+  p_controller->adjustments++;
+  log::info("stepping up to level {} of {}", p_controller->level,
+            p_controller->num_levels);
+  return true;
+}
+
+tA2DP_ENCODER_LOAD_CONTROLLER* a2dp_source_encoder_load_controller(void) {
+  return &a2dp_source_encoder_load_controller_cb;
+}
@@ -0,0 +1,192 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define LOG_TAG "a2dp_jitter_buffer"
+
+#include "a2dp_jitter_buffer.h"
+
+#include <bluetooth/log.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+using namespace bluetooth;
+
+// The jitter is sized from this many arrival intervals on.
+#define A2DP_JITTER_BUFFER_MIN_INTERVALS 16
+
+// The arrival estimates move by 1/16 of each new measure, as the RTP
+// interarrival jitter (RFC 3550).
+#define A2DP_JITTER_BUFFER_ESTIMATE_SHIFT 4
+
+// Longer arrival intervals are gaps in the stream, not a measure of the
+// jitter.
+#define A2DP_JITTER_BUFFER_MAX_INTERVAL_US 1000000
+
+// The buffering restarts once this much audio was missing in a row.
+#define A2DP_JITTER_BUFFER_MAX_UNDERRUN_US 60000
+
+// The queue depth is checked against the target over windows of this many
+// ticks (1 second with a 20 ms tick). Packets are dropped when the queue held
+// more packets than needed during the whole window.
+#define A2DP_JITTER_BUFFER_WINDOW_TICKS 50
+
+void a2dp_jitter_buffer_reset(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                              uint32_t tick_us, size_t max_depth) {
+  memset(p_jitter_buffer, 0, sizeof(*p_jitter_buffer));
+  p_jitter_buffer->tick_us = tick_us;
+  p_jitter_buffer->max_depth = max_depth;
+  p_jitter_buffer->window_min_depth = SIZE_MAX;
+}
+
+void a2dp_jitter_buffer_flush(tA2DP_JITTER_BUFFER* p_jitter_buffer) {
+  p_jitter_buffer->has_last_arrival = false;
+  p_jitter_buffer->playing = false;
+  p_jitter_buffer->budget_us = 0;
+  p_jitter_buffer->in_underrun = false;
+  p_jitter_buffer->underrun_us = 0;
+  p_jitter_buffer->window_ticks = 0;
+  p_jitter_buffer->window_min_depth = SIZE_MAX;
+}
+
+void a2dp_jitter_buffer_on_arrival(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                   uint64_t arrival_us, size_t queue_depth) {
+  p_jitter_buffer->packets_received++;
+  p_jitter_buffer->max_queue_depth =
+      std::max(p_jitter_buffer->max_queue_depth, queue_depth);
+
+  if (p_jitter_buffer->has_last_arrival &&
+      arrival_us >= p_jitter_buffer->last_arrival_us &&
+      arrival_us - p_jitter_buffer->last_arrival_us <=
+          A2DP_JITTER_BUFFER_MAX_INTERVAL_US) {
+    int64_t interval = arrival_us - p_jitter_buffer->last_arrival_us;
+    if (p_jitter_buffer->num_intervals == 0) {
+      p_jitter_buffer->mean_interval_us = interval;
+    } else {
+      int64_t mean = p_jitter_buffer->mean_interval_us;
+      int64_t jitter = p_jitter_buffer->jitter_us;
+      int64_t deviation = std::abs(interval - mean);
+      p_jitter_buffer->mean_interval_us =
+          mean + ((interval - mean) >> A2DP_JITTER_BUFFER_ESTIMATE_SHIFT);
+      p_jitter_buffer->jitter_us =
+          jitter + ((deviation - jitter) >> A2DP_JITTER_BUFFER_ESTIMATE_SHIFT);
+    }
+    p_jitter_buffer->num_intervals++;
+  }
+  p_jitter_buffer->has_last_arrival = true;
+  p_jitter_buffer->last_arrival_us = arrival_us;
+}
+
+size_t a2dp_jitter_buffer_target_depth(
+    const tA2DP_JITTER_BUFFER* p_jitter_buffer) {
+  // Keep room in the queue for the bursts above the target
+  size_t max_depth = std::max<size_t>(p_jitter_buffer->max_depth / 2,
+                                      A2DP_JITTER_BUFFER_MIN_DEPTH);
+  if (p_jitter_buffer->num_intervals < A2DP_JITTER_BUFFER_MIN_INTERVALS ||
+      p_jitter_buffer->mean_interval_us == 0) {
+    return std::min<size_t>(A2DP_JITTER_BUFFER_DEFAULT_DEPTH, max_depth);
+  }
+
+  uint64_t target_us = (uint64_t)p_jitter_buffer->tick_us +
+                       4 * (uint64_t)p_jitter_buffer->jitter_us;
+  size_t depth = (target_us + p_jitter_buffer->mean_interval_us - 1) /
+                 p_jitter_buffer->mean_interval_us;
+  return std::clamp<size_t>(depth, A2DP_JITTER_BUFFER_MIN_DEPTH, max_depth);
+}
+
+size_t a2dp_jitter_buffer_on_tick(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                  size_t queue_depth, bool* p_play) {
+  size_t target_depth = a2dp_jitter_buffer_target_depth(p_jitter_buffer);
+
+  *p_play = false;
+  if (!p_jitter_buffer->playing) {
+    if (queue_depth < target_depth) return 0;
+    log::verbose("start playout with {} packets", queue_depth);
+    p_jitter_buffer->playing = true;
+    p_jitter_buffer->budget_us = 0;
+    p_jitter_buffer->window_ticks = 0;
+    p_jitter_buffer->window_min_depth = SIZE_MAX;
+  }
+  *p_play = true;
+
+  // The budget does not make up for more than a late tick
+  p_jitter_buffer->budget_us =
+      std::min<int64_t>(p_jitter_buffer->budget_us + p_jitter_buffer->tick_us,
+                        2 * (int64_t)p_jitter_buffer->tick_us);
+
+  p_jitter_buffer->window_min_depth =
+      std::min(p_jitter_buffer->window_min_depth, queue_depth);
+  if (++p_jitter_buffer->window_ticks < A2DP_JITTER_BUFFER_WINDOW_TICKS) {
+    return 0;
+  }
+  size_t num_dropped = 0;
+  if (p_jitter_buffer->window_min_depth > target_depth + 1) {
+    num_dropped = p_jitter_buffer->window_min_depth - target_depth;
+    p_jitter_buffer->dropped_packets += num_dropped;
+    log::verbose("dropping {} packets, target depth {}", num_dropped,
+                 target_depth);
+  }
+  p_jitter_buffer->window_ticks = 0;
+  p_jitter_buffer->window_min_depth = SIZE_MAX;
+  return num_dropped;
+}
+
+bool a2dp_jitter_buffer_needs_audio(
+    const tA2DP_JITTER_BUFFER* p_jitter_buffer) {
+  return p_jitter_buffer->playing && p_jitter_buffer->budget_us > 0;
+}
+
+void a2dp_jitter_buffer_on_decoded(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                   uint32_t duration_us) {
+  p_jitter_buffer->budget_us -= duration_us;
+  p_jitter_buffer->in_underrun = false;
+  p_jitter_buffer->underrun_us = 0;
+}
+
+bool a2dp_jitter_buffer_on_underrun(tA2DP_JITTER_BUFFER* p_jitter_buffer) {
+  if (p_jitter_buffer->underrun_us >= A2DP_JITTER_BUFFER_MAX_UNDERRUN_US) {
+    log::verbose("restart buffering after {} us of underrun",
+                 p_jitter_buffer->underrun_us);
+    p_jitter_buffer->playing = false;
+    p_jitter_buffer->budget_us = 0;
+    p_jitter_buffer->in_underrun = false;
+    p_jitter_buffer->underrun_us = 0;
+    return false;
+  }
+  if (!p_jitter_buffer->in_underrun) {
+    p_jitter_buffer->in_underrun = true;
+    p_jitter_buffer->underruns++;
+  }
+  return true;
+}
+
+void a2dp_jitter_buffer_on_concealed(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                     uint32_t duration_us) {
+  if (duration_us == 0) {
+    // Nothing could be concealed, the rest of the tick is missing
+    p_jitter_buffer->underrun_us +=
+        std::max<int64_t>(p_jitter_buffer->budget_us, 0);
+    p_jitter_buffer->budget_us = 0;
+    return;
+  }
+  p_jitter_buffer->budget_us -= duration_us;
+  p_jitter_buffer->underrun_us += duration_us;
+  p_jitter_buffer->concealed_frames++;
+  p_jitter_buffer->concealed_us += duration_us;
+}
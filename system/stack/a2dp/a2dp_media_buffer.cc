@@ -0,0 +1,47 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "a2dp_media_buffer.h"
+
+#include "include/check.h"
+#include "osi/include/allocator.h"
+#include "stack/include/hcidefs.h"
+#include "stack/include/l2cdefs.h"
+
+// AVDTP prepends the RTP header, L2CAP its basic mode header and the HCI ACL
+// preamble, all in place. The content protection header comes first, and is
+// also used by the codecs that do not use an RTP header otherwise.
+static_assert(A2DP_MEDIA_BUFFER_HEADROOM >=
+                  A2DP_MEDIA_BUFFER_CP_HDR_LEN + AVDT_MEDIA_HDR_SIZE +
+                      L2CAP_PKT_OVERHEAD + HCI_DATA_PREAMBLE_SIZE,
+              "The media packet headroom does not fit the protocol headers");
+
+// The timestamp of the packet is kept in the first 4 bytes of the headroom
+// until the packet is sent, see bta_av_data_path().
+static_assert(A2DP_MEDIA_BUFFER_HEADROOM >= sizeof(uint32_t),
+              "The media packet headroom does not fit the timestamp");
+
+BT_HDR* a2dp_media_buffer_alloc(uint16_t payload_offset) {
+  CHECK(payload_offset >= A2DP_MEDIA_BUFFER_HEADROOM);
+
+  BT_HDR* p_buf = (BT_HDR*)osi_malloc(A2DP_MEDIA_BUFFER_SIZE);
+  p_buf->offset = payload_offset;
+  p_buf->len = 0;
+  p_buf->layer_specific = 0;
+  return p_buf;
+}
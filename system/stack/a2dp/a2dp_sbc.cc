@@ -101,8 +101,7 @@ static const tA2DP_ENCODER_INTERFACE a2dp_encoder_interface_sbc = {
     a2dp_sbc_get_encoder_interval_ms,
     a2dp_sbc_get_effective_frame_size,
     a2dp_sbc_send_frames,
-    nullptr  // set_transmit_queue_length
-};
+    a2dp_sbc_set_transmit_queue_length};
 
 static const tA2DP_DECODER_INTERFACE a2dp_decoder_interface_sbc = {
     a2dp_sbc_decoder_init,
@@ -111,6 +110,7 @@ static const tA2DP_DECODER_INTERFACE a2dp_decoder_interface_sbc = {
     nullptr,  // decoder_start
     nullptr,  // decoder_suspend
     nullptr,  // decoder_configure
+    a2dp_sbc_decoder_conceal,
 };
 
 static tA2DP_STATUS A2DP_CodecInfoMatchesCapabilitySbc(
@@ -35,6 +35,7 @@ typedef struct {
   OI_CODEC_SBC_DECODER_CONTEXT decoder_context;
   uint32_t context_data[CODEC_DATA_WORDS(2, SBC_CODEC_FAST_FILTER_BUFFERS)];
   int16_t decode_buf[15 * SBC_MAX_SAMPLES_PER_FRAME * SBC_MAX_CHANNELS];
+  size_t decode_buf_used;  // The audio of the last packet in |decode_buf|
   decoded_data_callback_t decode_callback;
 } tA2DP_SBC_DECODER_CB;
 
@@ -56,6 +57,7 @@ bool a2dp_sbc_decoder_init(decoded_data_callback_t decode_callback) {
     return false;
   }
 
+  a2dp_sbc_decoder_cb.decode_buf_used = 0;
   a2dp_sbc_decoder_cb.decode_callback = decode_callback;
   return true;
 }
@@ -96,7 +98,24 @@ bool a2dp_sbc_decoder_decode_packet(BT_HDR* p_buf) {
 
   size_t out_used =
       (out_ptr - a2dp_sbc_decoder_cb.decode_buf) * sizeof(*out_ptr);
+  a2dp_sbc_decoder_cb.decode_buf_used = out_used;
   a2dp_sbc_decoder_cb.decode_callback(
       reinterpret_cast<uint8_t*>(a2dp_sbc_decoder_cb.decode_buf), out_used);
   return true;
 }
+
+bool a2dp_sbc_decoder_conceal(void) {
+  // SBC has no concealment of its own: the audio of the last packet is
+  // repeated, fading out by 6 dB at each repetition.
+  size_t num_samples = a2dp_sbc_decoder_cb.decode_buf_used /
+                       sizeof(a2dp_sbc_decoder_cb.decode_buf[0]);
+  if (num_samples == 0) return false;
+
+  for (size_t i = 0; i < num_samples; i++) {
+    a2dp_sbc_decoder_cb.decode_buf[i] /= 2;
+  }
+  a2dp_sbc_decoder_cb.decode_callback(
+      reinterpret_cast<uint8_t*>(a2dp_sbc_decoder_cb.decode_buf),
+      a2dp_sbc_decoder_cb.decode_buf_used);
+  return true;
+}
@@ -26,6 +26,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include "a2dp_bitrate_controller.h"
+#include "a2dp_media_buffer.h"
 #include "a2dp_sbc.h"
 #include "a2dp_sbc_up_sample.h"
 #include "common/time_util.h"
@@ -34,9 +38,6 @@
 #include "osi/include/allocator.h"
 #include "stack/include/bt_hdr.h"
 
-/* Buffer pool */
-#define A2DP_SBC_BUFFER_SIZE BT_DEFAULT_BUFFER_SIZE
-
 // A2DP SBC encoder interval in milliseconds.
 #define A2DP_SBC_ENCODER_INTERVAL_MS 20
 
@@ -53,13 +54,16 @@
 /* Define the bitrate step when trying to match bitpool value */
 #define A2DP_SBC_BITRATE_STEP 5
 
+/* The bitpool step between two levels of the bitrate controller */
+#define A2DP_SBC_CONTROLLER_BITPOOL_STEP 6
+
 /* Readability constants */
 #define A2DP_SBC_FRAME_HEADER_SIZE_BYTES 4  // A2DP Spec v1.3, 12.4, Table 12.12
 #define A2DP_SBC_SCALE_FACTOR_BITS 4        // A2DP Spec v1.3, 12.4, Table 12.13
 
 /* offset */
 #define A2DP_HDR_SIZE 1
-#define A2DP_SBC_OFFSET (AVDT_MEDIA_OFFSET + A2DP_SBC_MPL_HDR_LEN)
+#define A2DP_SBC_OFFSET (A2DP_MEDIA_BUFFER_HEADROOM + A2DP_SBC_MPL_HDR_LEN)
 
 using namespace bluetooth;
 
@@ -92,6 +96,8 @@ typedef struct {
   a2dp_source_enqueue_callback_t enqueue_callback;
   uint16_t TxAaMtuSize;
   uint8_t tx_sbc_frames;
+  int16_t configured_bitpool; /* Bitpool of the controller level 0 */
+  int16_t lowest_bitpool;     /* Bitpool of the lowest controller level */
   tA2DP_ENCODER_INIT_PEER_PARAMS peer_params;
   uint32_t timestamp;       /* Timestamp for the A2DP frames */
   SBC_ENC_PARAMS sbc_encoder_params;
@@ -331,6 +337,21 @@ static void a2dp_sbc_encoder_update(A2dpCodecConfig* a2dp_codec_config,
   /* Reset the SBC encoder */
   SBC_Encoder_Init(&a2dp_sbc_encoder_cb.sbc_encoder_params);
   a2dp_sbc_encoder_cb.tx_sbc_frames = calculate_max_frames_per_packet();
+
+  /* The bitrate controller lowers the bitpool down to 2/3 of the configured
+   * one, e.g. from the high quality bitpool 53 to the middle quality 35 */
+  a2dp_sbc_encoder_cb.configured_bitpool = p_encoder_params->s16BitPool;
+  a2dp_sbc_encoder_cb.lowest_bitpool = std::max<int16_t>(
+      min_bitpool, p_encoder_params->s16BitPool * 2 / 3);
+  int num_levels = 1;
+  if (a2dp_sbc_encoder_cb.lowest_bitpool <
+      a2dp_sbc_encoder_cb.configured_bitpool) {
+    num_levels += (a2dp_sbc_encoder_cb.configured_bitpool -
+                   a2dp_sbc_encoder_cb.lowest_bitpool) /
+                  A2DP_SBC_CONTROLLER_BITPOOL_STEP;
+  }
+  a2dp_bitrate_controller_reset(a2dp_source_bitrate_controller(),
+                                std::min(num_levels, UINT8_MAX));
 }
 
 void a2dp_sbc_encoder_cleanup(void) {
@@ -381,6 +402,24 @@ void a2dp_sbc_send_frames(uint64_t timestamp_us) {
   }
 }
 
+void a2dp_sbc_set_transmit_queue_length(size_t transmit_queue_length) {
+  tA2DP_BITRATE_CONTROLLER* p_controller = a2dp_source_bitrate_controller();
+  if (!a2dp_bitrate_controller_update(p_controller, transmit_queue_length)) {
+    return;
+  }
+
+  /* SBC frames carry their bitpool: it can change from one frame to the
+   * next, as long as it stays within the negotiated range */
+  SBC_ENC_PARAMS* p_encoder_params = &a2dp_sbc_encoder_cb.sbc_encoder_params;
+  p_encoder_params->s16BitPool = std::max<int16_t>(
+      a2dp_sbc_encoder_cb.lowest_bitpool,
+      a2dp_sbc_encoder_cb.configured_bitpool -
+          p_controller->level * A2DP_SBC_CONTROLLER_BITPOOL_STEP);
+  a2dp_sbc_encoder_cb.tx_sbc_frames = calculate_max_frames_per_packet();
+  log::info("bitpool {}, {} frames per packet", p_encoder_params->s16BitPool,
+            a2dp_sbc_encoder_cb.tx_sbc_frames);
+}
+
 // Obtains the number of frames to send and number of iterations
 // to be used. |num_of_iterations| and |num_of_frames| parameters
 // are used as output param for returning the respective values.
@@ -489,12 +528,9 @@ static void a2dp_sbc_encode_frames(uint8_t nb_frame) {
   uint8_t last_frame_len = 0;
 
   while (nb_frame) {
-    BT_HDR* p_buf = (BT_HDR*)osi_malloc(A2DP_SBC_BUFFER_SIZE);
+    BT_HDR* p_buf = a2dp_media_buffer_alloc(A2DP_SBC_OFFSET);
     uint32_t bytes_read = 0;
 
-    p_buf->offset = A2DP_SBC_OFFSET;
-    p_buf->len = 0;
-    p_buf->layer_specific = 0;
     a2dp_sbc_encoder_cb.stats.media_read_total_expected_packets++;
 
     do {
@@ -716,7 +752,7 @@ static bool a2dp_sbc_read_feeding(uint32_t* bytes_read) {
 
 static uint16_t adjust_effective_mtu(
     const tA2DP_ENCODER_INIT_PEER_PARAMS& peer_params) {
-  uint16_t mtu_size = A2DP_SBC_BUFFER_SIZE - A2DP_SBC_OFFSET - sizeof(BT_HDR);
+  uint16_t mtu_size = A2DP_MEDIA_BUFFER_MAX_PAYLOAD(A2DP_SBC_OFFSET);
   if (mtu_size > peer_params.peer_mtu) {
     mtu_size = peer_params.peer_mtu;
   }
@@ -886,6 +922,18 @@ void A2dpCodecConfigSbcSource::debug_codec_dump(int fd) {
         A2DP_GetMinBitpoolSbc(codec_info), A2DP_GetMaxBitpoolSbc(codec_info));
   }
 
+  tA2DP_BITRATE_CONTROLLER* p_controller = a2dp_source_bitrate_controller();
+  dprintf(fd,
+          "  SBC Bitpool (configured/current)                        : %d / "
+          "%d\n",
+          a2dp_sbc_encoder_cb.configured_bitpool,
+          a2dp_sbc_encoder_cb.sbc_encoder_params.s16BitPool);
+  dprintf(fd,
+          "  Bitrate controller (level/levels/adjustments)           : %d / "
+          "%d / %zu\n",
+          p_controller->level, p_controller->num_levels,
+          p_controller->adjustments);
+
   dprintf(fd, "  Encoder interval (ms): %" PRIu64 "\n",
           a2dp_sbc_get_encoder_interval_ms());
   dprintf(fd, "  Effective MTU: %d\n", a2dp_sbc_get_effective_frame_size());
@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "a2dp_media_buffer.h"
 #include "a2dp_vendor.h"
 #include "a2dp_vendor_aptx.h"
 #include "aptXbtenc.h"
@@ -46,8 +47,9 @@ static const tAPTX_API aptx_api = {
 };
 
 // offset
-// no RTP header for aptX classic
-#define A2DP_APTX_OFFSET (AVDT_MEDIA_OFFSET - AVDT_MEDIA_HDR_SIZE)
+// aptX classic has no RTP header, except with content protection, so the
+// whole headroom is reserved as for the other codecs.
+#define A2DP_APTX_OFFSET A2DP_MEDIA_BUFFER_HEADROOM
 
 #define A2DP_APTX_MAX_PCM_BYTES_PER_READ 4096
 
@@ -301,10 +303,7 @@ void a2dp_vendor_aptx_send_frames(uint64_t timestamp_us) {
   tAPTX_FRAMING_PARAMS* framing_params = &a2dp_aptx_encoder_cb.framing_params;
 
   // Prepare the packet to send
-  BT_HDR* p_buf = (BT_HDR*)osi_malloc(BT_DEFAULT_BUFFER_SIZE);
-  p_buf->offset = A2DP_APTX_OFFSET;
-  p_buf->len = 0;
-  p_buf->layer_specific = 0;
+  BT_HDR* p_buf = a2dp_media_buffer_alloc(A2DP_APTX_OFFSET);
 
   uint8_t* encoded_ptr = (uint8_t*)(p_buf + 1);
   encoded_ptr += p_buf->offset;
@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "a2dp_media_buffer.h"
 #include "a2dp_vendor.h"
 #include "a2dp_vendor_aptx_hd.h"
 #include "aptXHDbtenc.h"
@@ -46,7 +47,7 @@ static const tAPTX_HD_API aptx_hd_api = {
 };
 
 // offset
-#define A2DP_APTX_HD_OFFSET AVDT_MEDIA_OFFSET
+#define A2DP_APTX_HD_OFFSET A2DP_MEDIA_BUFFER_HEADROOM
 
 #define A2DP_APTX_HD_MAX_PCM_BYTES_PER_READ 4096
 
@@ -285,10 +286,7 @@ void a2dp_vendor_aptx_hd_send_frames(uint64_t timestamp_us) {
       &a2dp_aptx_hd_encoder_cb.framing_params;
 
   // Prepare the packet to send
-  BT_HDR* p_buf = (BT_HDR*)osi_malloc(BT_DEFAULT_BUFFER_SIZE);
-  p_buf->offset = A2DP_APTX_HD_OFFSET;
-  p_buf->len = 0;
-  p_buf->layer_specific = 0;
+  BT_HDR* p_buf = a2dp_media_buffer_alloc(A2DP_APTX_HD_OFFSET);
 
   uint8_t* encoded_ptr = (uint8_t*)(p_buf + 1);
   encoded_ptr += p_buf->offset;
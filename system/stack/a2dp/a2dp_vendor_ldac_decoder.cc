@@ -89,6 +89,9 @@ typedef struct {
   LDACBT_SMPL_FMT_T pcm_fmt;
 } tA2DP_LDAC_DECODER_PARAMS;
 
+// The size of the copy of the last decoded audio, used for the concealment
+#define A2DP_LDAC_CONCEAL_BUFFER_SIZE (16 * 1024)
+
 typedef struct {
   pthread_mutex_t mutex;
   bool use_SCMS_T;
@@ -101,6 +104,11 @@ typedef struct {
   bool has_ldac_handle;  // True if ldac_handle is valid
   unsigned char* decode_buf;
   decoded_data_callback_t decode_callback;
+
+  // The last decoded audio, repeated to conceal the lost audio
+  uint8_t conceal_buf[A2DP_LDAC_CONCEAL_BUFFER_SIZE];
+  uint32_t conceal_buf_used;
+  int32_t bits_per_sample;
 } tA2DP_LDAC_DECODER_CB;
 
 static tA2DP_LDAC_DECODER_CB a2dp_ldac_decoder_cb;
@@ -176,13 +184,27 @@ void A2DP_VendorUnloadDecoderLdac(void) {
   }
 }
 
+// Keeps a copy of the decoded audio for the concealment, and passes it on.
+static void a2dp_vendor_ldac_decoder_on_decoded(uint8_t* buf, uint32_t len) {
+  if (len <= sizeof(a2dp_ldac_decoder_cb.conceal_buf)) {
+    memcpy(a2dp_ldac_decoder_cb.conceal_buf, buf, len);
+    a2dp_ldac_decoder_cb.conceal_buf_used = len;
+  } else {
+    a2dp_ldac_decoder_cb.conceal_buf_used = 0;
+  }
+  a2dp_ldac_decoder_cb.decode_callback(buf, len);
+}
+
 bool a2dp_vendor_ldac_decoder_init(decoded_data_callback_t decode_callback) {
   pthread_mutex_lock(&(a2dp_ldac_decoder_cb.mutex));
 
   if (a2dp_ldac_decoder_cb.has_ldac_handle)
     ldac_BCO_cleanup_func(a2dp_ldac_decoder_cb.ldac_handle_bco);
 
-  a2dp_ldac_decoder_cb.ldac_handle_bco = ldac_BCO_init_func(decode_callback);
+  a2dp_ldac_decoder_cb.decode_callback = decode_callback;
+  a2dp_ldac_decoder_cb.conceal_buf_used = 0;
+  a2dp_ldac_decoder_cb.ldac_handle_bco =
+      ldac_BCO_init_func(a2dp_vendor_ldac_decoder_on_decoded);
   a2dp_ldac_decoder_cb.has_ldac_handle =
       (a2dp_ldac_decoder_cb.ldac_handle_bco != NULL);
 
@@ -229,6 +251,56 @@ bool a2dp_vendor_ldac_decoder_decode_packet(BT_HDR* p_buf) {
   return true;
 }
 
+bool a2dp_vendor_ldac_decoder_conceal(void) {
+  pthread_mutex_lock(&(a2dp_ldac_decoder_cb.mutex));
+  uint8_t* p = a2dp_ldac_decoder_cb.conceal_buf;
+  uint32_t len = a2dp_ldac_decoder_cb.conceal_buf_used;
+  if (!a2dp_ldac_decoder_cb.has_ldac_handle || len == 0) {
+    pthread_mutex_unlock(&(a2dp_ldac_decoder_cb.mutex));
+    return false;
+  }
+
+  // The LDAC library has no concealment: the last decoded audio is repeated,
+  // fading out by 6 dB at each repetition.
+  switch (a2dp_ldac_decoder_cb.bits_per_sample) {
+    case 16:
+      for (uint32_t i = 0; i + 2 <= len; i += 2) {
+        int16_t sample;
+        memcpy(&sample, p + i, sizeof(sample));
+        sample /= 2;
+        memcpy(p + i, &sample, sizeof(sample));
+      }
+      break;
+    case 24:
+      for (uint32_t i = 0; i + 3 <= len; i += 3) {
+        int32_t sample = (int32_t)((uint32_t)p[i] << 8 |
+                                   (uint32_t)p[i + 1] << 16 |
+                                   (uint32_t)p[i + 2] << 24) >>
+                         8;
+        sample /= 2;
+        p[i] = sample & 0xff;
+        p[i + 1] = (sample >> 8) & 0xff;
+        p[i + 2] = (sample >> 16) & 0xff;
+      }
+      break;
+    case 32:
+      for (uint32_t i = 0; i + 4 <= len; i += 4) {
+        int32_t sample;
+        memcpy(&sample, p + i, sizeof(sample));
+        sample /= 2;
+        memcpy(p + i, &sample, sizeof(sample));
+      }
+      break;
+    default:
+      memset(p, 0, len);
+      break;
+  }
+  a2dp_ldac_decoder_cb.decode_callback(p, len);
+
+  pthread_mutex_unlock(&(a2dp_ldac_decoder_cb.mutex));
+  return true;
+}
+
 void a2dp_vendor_ldac_decoder_start(void) {
   pthread_mutex_lock(&(a2dp_ldac_decoder_cb.mutex));
   log::info("");
@@ -263,6 +335,8 @@ void a2dp_vendor_ldac_decoder_configure(const uint8_t* p_codec_info) {
   log::info(", sample_rate={}, bits_per_sample={}, channel_mode={}",
             sample_rate, bits_per_sample, channel_mode);
 
+  a2dp_ldac_decoder_cb.bits_per_sample = bits_per_sample;
+
   if (a2dp_ldac_decoder_cb.has_ldac_handle)
     ldac_BCO_configure_func(a2dp_ldac_decoder_cb.ldac_handle_bco, sample_rate,
                             bits_per_sample, channel_mode);
@@ -29,6 +29,8 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "a2dp_encoder_load_controller.h"
+#include "a2dp_media_buffer.h"
 #include "a2dp_vendor_ldac.h"
 #include "common/time_util.h"
 #include "include/check.h"
@@ -49,7 +51,7 @@
 #define A2DP_LDAC_MEDIA_BYTES_PER_FRAME 128
 
 // offset
-#define A2DP_LDAC_OFFSET (AVDT_MEDIA_OFFSET + A2DP_LDAC_MPL_HDR_LEN)
+#define A2DP_LDAC_OFFSET (A2DP_MEDIA_BUFFER_HEADROOM + A2DP_LDAC_MPL_HDR_LEN)
 
 using namespace bluetooth;
 
@@ -102,6 +104,7 @@ typedef struct {
   bool has_ldac_abr_handle;
   int last_ldac_abr_eqmid;
   size_t ldac_abr_adjustments;
+  int ldac_eqmid;  // The EQMID configured outside of ABR mode
 
   tA2DP_FEEDING_PARAMS feeding_params;
   tA2DP_LDAC_ENCODER_PARAMS ldac_encoder_params;
@@ -280,6 +283,19 @@ static void a2dp_vendor_ldac_encoder_update(A2dpCodecConfig* a2dp_codec_config,
   if (p_encoder_params->quality_mode_index != old_quality_mode_index)
     *p_config_updated = true;
 
+  // Outside of ABR mode, the encode quality may drop from the configured
+  // EQMID down to the lowest one when encoding nears the deadline. In ABR
+  // mode, the EQMID is left to ABR and only the deadline misses are counted.
+  a2dp_ldac_encoder_cb.ldac_eqmid = ldac_eqmid;
+  uint8_t load_levels = 1;
+  if (!a2dp_ldac_encoder_cb.has_ldac_abr_handle &&
+      ldac_eqmid < A2DP_LDAC_QUALITY_LOW) {
+    load_levels = A2DP_LDAC_QUALITY_LOW - ldac_eqmid + 1;
+  }
+  a2dp_encoder_load_controller_reset(a2dp_source_encoder_load_controller(),
+                                     load_levels,
+                                     A2DP_LDAC_ENCODER_INTERVAL_MS * 1000);
+
   p_encoder_params->pcm_wlength =
       a2dp_ldac_encoder_cb.feeding_params.bits_per_sample >> 3;
   // Set the Audio format from pcm_wlength
@@ -367,6 +383,7 @@ void a2dp_vendor_ldac_send_frames(uint64_t timestamp_us) {
                nb_iterations);
   if (nb_frame == 0) return;
 
+  uint64_t encode_start_us = bluetooth::common::time_get_os_boottime_us();
   for (uint8_t counter = 0; counter < nb_iterations; counter++) {
     if (a2dp_ldac_encoder_cb.has_ldac_abr_handle) {
       int flag_enable = 1;
@@ -384,6 +401,23 @@ void a2dp_vendor_ldac_send_frames(uint64_t timestamp_us) {
     // Transcode frame and enqueue
     a2dp_ldac_encode_frames(nb_frame);
   }
+  uint64_t encode_us =
+      bluetooth::common::time_get_os_boottime_us() - encode_start_us;
+
+  tA2DP_ENCODER_LOAD_CONTROLLER* p_controller =
+      a2dp_source_encoder_load_controller();
+  if (!a2dp_encoder_load_controller_update(p_controller, encode_us) ||
+      !a2dp_ldac_encoder_cb.has_ldac_handle) {
+    return;
+  }
+  int eqmid = a2dp_ldac_encoder_cb.ldac_eqmid + p_controller->level;
+  if (ldacBT_set_eqmid(a2dp_ldac_encoder_cb.ldac_handle, eqmid) != 0) {
+    log::error("failed to set encode quality mode to {}",
+               quality_mode_index_to_name(eqmid).c_str());
+    return;
+  }
+  log::info("encode quality mode {}",
+            quality_mode_index_to_name(eqmid).c_str());
 }
 
 // Obtains the number of frames to send and number of iterations
@@ -455,10 +489,7 @@ static void a2dp_ldac_encode_frames(uint8_t nb_frame) {
 
   uint32_t bytes_read = 0;
   while (nb_frame) {
-    BT_HDR* p_buf = (BT_HDR*)osi_malloc(BT_DEFAULT_BUFFER_SIZE);
-    p_buf->offset = A2DP_LDAC_OFFSET;
-    p_buf->len = 0;
-    p_buf->layer_specific = 0;
+    BT_HDR* p_buf = a2dp_media_buffer_alloc(A2DP_LDAC_OFFSET);
     a2dp_ldac_encoder_cb.stats.media_read_total_expected_packets++;
 
     count = 0;
@@ -560,8 +591,7 @@ static bool a2dp_ldac_read_feeding(uint8_t* read_buffer, uint32_t* bytes_read) {
 
 static uint16_t adjust_effective_mtu(
     const tA2DP_ENCODER_INIT_PEER_PARAMS& peer_params) {
-  uint16_t mtu_size =
-      BT_DEFAULT_BUFFER_SIZE - A2DP_LDAC_OFFSET - sizeof(BT_HDR);
+  uint16_t mtu_size = A2DP_MEDIA_BUFFER_MAX_PAYLOAD(A2DP_LDAC_OFFSET);
   if (mtu_size > peer_params.peer_mtu) {
     mtu_size = peer_params.peer_mtu;
   }
@@ -614,6 +644,20 @@ void A2dpCodecConfigLdacSource::debug_codec_dump(int fd) {
             "  LDAC adaptive bit rate adjustments                      : %zu\n",
             a2dp_ldac_encoder_cb.ldac_abr_adjustments);
   }
+  tA2DP_ENCODER_LOAD_CONTROLLER* p_controller =
+      a2dp_source_encoder_load_controller();
+  if (!a2dp_ldac_encoder_cb.has_ldac_abr_handle) {
+    dprintf(
+        fd, "  LDAC encode quality mode                                : %s\n",
+        quality_mode_index_to_name(a2dp_ldac_encoder_cb.ldac_eqmid +
+                                   p_controller->level)
+            .c_str());
+  }
+  dprintf(fd,
+          "  Encode time (last/max us), deadline misses              : %u / "
+          "%u, %zu\n",
+          p_controller->last_encode_us, p_controller->max_encode_us,
+          p_controller->deadline_misses);
   dprintf(fd, "  Encoder interval (ms): %" PRIu64 "\n",
           a2dp_vendor_ldac_get_encoder_interval_ms());
   dprintf(fd, "  Effective MTU: %d\n",
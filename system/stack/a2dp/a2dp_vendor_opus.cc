@@ -117,6 +117,7 @@ static const tA2DP_DECODER_INTERFACE a2dp_decoder_interface_opus = {
     a2dp_vendor_opus_decoder_init,          a2dp_vendor_opus_decoder_cleanup,
     a2dp_vendor_opus_decoder_decode_packet, a2dp_vendor_opus_decoder_start,
     a2dp_vendor_opus_decoder_suspend,       a2dp_vendor_opus_decoder_configure,
+    a2dp_vendor_opus_decoder_conceal,
 };
 
 UNUSED_ATTR static tA2DP_STATUS A2DP_CodecInfoMatchesCapabilityOpus(
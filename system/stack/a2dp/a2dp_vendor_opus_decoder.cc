@@ -32,6 +32,7 @@ typedef struct {
   OpusDecoder* opus_handle = nullptr;
   bool has_opus_handle;
   int16_t* decode_buf = nullptr;
+  int32_t last_frame_samples;  // The duration of the last decoded frame
   decoded_data_callback_t decode_callback;
 } tA2DP_OPUS_DECODER_CB;
 
@@ -77,6 +78,7 @@ bool a2dp_vendor_opus_decoder_init(decoded_data_callback_t decode_callback) {
 
     memset(a2dp_opus_decoder_cb.decode_buf, 0, A2DP_OPUS_DECODE_BUFFER_LENGTH);
 
+    a2dp_opus_decoder_cb.last_frame_samples = 0;
     a2dp_opus_decoder_cb.decode_callback = decode_callback;
     log::info("decoder init success");
     return true;
@@ -147,6 +149,7 @@ bool a2dp_vendor_opus_decoder_decode_packet(BT_HDR* p_buf) {
         return false;
       }
 
+      a2dp_opus_decoder_cb.last_frame_samples = ret_val;
       size_t frame_len =
           ret_val * numChannels * sizeof(a2dp_opus_decoder_cb.decode_buf[0]);
       a2dp_opus_decoder_cb.decode_callback(
@@ -157,6 +160,30 @@ bool a2dp_vendor_opus_decoder_decode_packet(BT_HDR* p_buf) {
   return true;
 }
 
+bool a2dp_vendor_opus_decoder_conceal(void) {
+  if (!a2dp_opus_decoder_cb.has_opus_handle ||
+      a2dp_opus_decoder_cb.last_frame_samples <= 0) {
+    return false;
+  }
+
+  // The Opus packet loss concealment extrapolates a frame as long as the last
+  // decoded one.
+  int32_t ret_val = opus_decode(a2dp_opus_decoder_cb.opus_handle, NULL, 0,
+                                a2dp_opus_decoder_cb.decode_buf,
+                                a2dp_opus_decoder_cb.last_frame_samples,
+                                0 /* flags */);
+  if (ret_val < OPUS_OK) {
+    log::error("Opus concealment failed with {}", ret_val);
+    return false;
+  }
+
+  size_t frame_len = ret_val * A2DP_OPUS_CODEC_OUTPUT_CHS *
+                     sizeof(a2dp_opus_decoder_cb.decode_buf[0]);
+  a2dp_opus_decoder_cb.decode_callback(
+      reinterpret_cast<uint8_t*>(a2dp_opus_decoder_cb.decode_buf), frame_len);
+  return true;
+}
+
 void a2dp_vendor_opus_decoder_start(void) { return; }
 
 void a2dp_vendor_opus_decoder_suspend(void) {
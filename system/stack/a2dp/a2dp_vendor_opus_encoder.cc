@@ -24,6 +24,9 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "a2dp_bitrate_controller.h"
+#include "a2dp_encoder_load_controller.h"
+#include "a2dp_media_buffer.h"
 #include "a2dp_vendor.h"
 #include "a2dp_vendor_opus.h"
 #include "common/time_util.h"
@@ -88,6 +91,11 @@ typedef struct {
 
 static tA2DP_OPUS_ENCODER_CB a2dp_opus_encoder_cb;
 
+// The number of encoder load levels, each next level lowering the Opus
+// complexity by A2DP_OPUS_ENCODER_LOAD_COMPLEXITY_STEP.
+#define A2DP_OPUS_ENCODER_LOAD_LEVELS 4
+#define A2DP_OPUS_ENCODER_LOAD_COMPLEXITY_STEP 2
+
 static bool a2dp_vendor_opus_encoder_update(uint16_t peer_mtu,
                                             A2dpCodecConfig* a2dp_codec_config,
                                             bool* p_restart_input,
@@ -97,6 +105,8 @@ static void a2dp_opus_get_num_frame_iteration(uint8_t* num_of_iterations,
                                               uint8_t* num_of_frames,
                                               uint64_t timestamp_us);
 static void a2dp_opus_encode_frames(uint8_t nb_frame);
+static uint8_t a2dp_opus_scale_complexity(uint8_t quality_mode_index,
+                                          uint8_t level);
 static bool a2dp_opus_read_feeding(uint8_t* read_buffer, uint32_t* bytes_read);
 
 void a2dp_vendor_opus_encoder_cleanup(void) {
@@ -233,8 +243,7 @@ static bool a2dp_vendor_opus_encoder_update(uint16_t peer_mtu,
 
   a2dp_vendor_opus_feeding_reset();
 
-  uint16_t mtu_size =
-      BT_DEFAULT_BUFFER_SIZE - A2DP_OPUS_OFFSET - sizeof(BT_HDR);
+  uint16_t mtu_size = A2DP_MEDIA_BUFFER_MAX_PAYLOAD(A2DP_OPUS_OFFSET);
   if (mtu_size < peer_mtu) {
     a2dp_opus_encoder_cb.TxAaMtuSize = mtu_size;
   } else {
@@ -272,6 +281,12 @@ static bool a2dp_vendor_opus_encoder_update(uint16_t peer_mtu,
     log::error("failed to set encoder bitrate");
     return false;
   }
+  a2dp_bitrate_controller_reset(a2dp_source_bitrate_controller(),
+                                A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS);
+  a2dp_encoder_load_controller_reset(
+      a2dp_source_encoder_load_controller(),
+      A2DP_OPUS_ENCODER_LOAD_LEVELS,
+      a2dp_vendor_opus_get_encoder_interval_ms() * 1000);
 
   // Set the Audio format from pcm_wlength
   if (p_encoder_params->pcm_wlength == 2)
@@ -316,12 +331,38 @@ void a2dp_vendor_opus_send_frames(uint64_t timestamp_us) {
   a2dp_opus_get_num_frame_iteration(&nb_iterations, &nb_frame, timestamp_us);
   if (nb_frame == 0) return;
 
+  uint64_t encode_start_us = bluetooth::common::time_get_os_boottime_us();
   for (uint8_t counter = 0; counter < nb_iterations; counter++) {
     // Transcode frame and enqueue
     a2dp_opus_encode_frames(nb_frame);
   }
+  uint64_t encode_us =
+      bluetooth::common::time_get_os_boottime_us() - encode_start_us;
+
+  // Trade encoder complexity for headroom when encoding nears the deadline
+  tA2DP_ENCODER_LOAD_CONTROLLER* p_controller =
+      a2dp_source_encoder_load_controller();
+  if (!a2dp_encoder_load_controller_update(p_controller, encode_us) ||
+      !a2dp_opus_encoder_cb.has_opus_handle) {
+    return;
+  }
+  uint8_t complexity = a2dp_opus_scale_complexity(
+      a2dp_opus_encoder_cb.opus_encoder_params.quality_mode_index,
+      p_controller->level);
+  int error = opus_encoder_ctl(a2dp_opus_encoder_cb.opus_handle,
+                               OPUS_SET_COMPLEXITY(complexity));
+  if (error != OPUS_OK) {
+    log::error("failed to set encoder complexity to {}", complexity);
+    return;
+  }
+  log::info("complexity {}", complexity);
+}
 
-  return;
+static uint8_t a2dp_opus_scale_complexity(uint8_t quality_mode_index,
+                                          uint8_t level) {
+  int complexity =
+      quality_mode_index - level * A2DP_OPUS_ENCODER_LOAD_COMPLEXITY_STEP;
+  return complexity > 0 ? complexity : 0;
 }
 
 // Obtains the number of frames to send and number of iterations
@@ -375,10 +416,7 @@ static void a2dp_opus_encode_frames(uint8_t nb_frame) {
 
   uint32_t bytes_read = 0;
   while (nb_frame) {
-    BT_HDR* p_buf = (BT_HDR*)osi_malloc(BT_DEFAULT_BUFFER_SIZE);
-    p_buf->offset = A2DP_OPUS_OFFSET;
-    p_buf->len = 0;
-    p_buf->layer_specific = 0;
+    BT_HDR* p_buf = a2dp_media_buffer_alloc(A2DP_OPUS_OFFSET);
     a2dp_opus_encoder_cb.stats.media_read_total_expected_packets++;
 
     do {
@@ -400,7 +438,7 @@ static void a2dp_opus_encode_frames(uint8_t nb_frame) {
         written =
             opus_encode(a2dp_opus_encoder_cb.opus_handle,
                         (const opus_int16*)&read_buffer[0], opus_frame_size,
-                        packet, (BT_DEFAULT_BUFFER_SIZE - p_buf->offset));
+                        packet, A2DP_MEDIA_BUFFER_MAX_PAYLOAD(p_buf->offset));
 
         if (written <= 0) {
           log::error("OPUS encoding error");
@@ -476,7 +514,22 @@ static bool a2dp_opus_read_feeding(uint8_t* read_buffer, uint32_t* bytes_read) {
 void a2dp_vendor_opus_set_transmit_queue_length(size_t transmit_queue_length) {
   a2dp_opus_encoder_cb.TxQueueLength = transmit_queue_length;
 
-  return;
+  tA2DP_BITRATE_CONTROLLER* p_controller = a2dp_source_bitrate_controller();
+  if (!a2dp_bitrate_controller_update(p_controller, transmit_queue_length) ||
+      !a2dp_opus_encoder_cb.has_opus_handle) {
+    return;
+  }
+
+  // The new bitrate applies from the next encoded frame on
+  uint32_t bitrate = a2dp_bitrate_controller_scale_bitrate(
+      p_controller, a2dp_opus_encoder_cb.opus_encoder_params.bitrate);
+  int error = opus_encoder_ctl(a2dp_opus_encoder_cb.opus_handle,
+                               OPUS_SET_BITRATE(bitrate));
+  if (error != OPUS_OK) {
+    log::error("failed to set encoder bitrate to {}", bitrate);
+    return;
+  }
+  log::info("bitrate {}", bitrate);
 }
 
 uint64_t A2dpCodecConfigOpusSource::encoderIntervalMs() const {
@@ -520,5 +573,26 @@ void A2dpCodecConfigOpusSource::debug_codec_dump(int fd) {
           "  OPUS saved transmit queue length                        : %zu\n",
           a2dp_opus_encoder_cb.TxQueueLength);
 
+  tA2DP_BITRATE_CONTROLLER* p_controller = a2dp_source_bitrate_controller();
+  dprintf(fd,
+          "  Bitrate controller (level/levels/adjustments)           : %d / "
+          "%d / %zu\n",
+          p_controller->level, p_controller->num_levels,
+          p_controller->adjustments);
+
+  tA2DP_ENCODER_LOAD_CONTROLLER* p_load_controller =
+      a2dp_source_encoder_load_controller();
+  dprintf(fd,
+          "  Encoder complexity (configured/current)                 : %d / "
+          "%d\n",
+          p_encoder_params->quality_mode_index,
+          a2dp_opus_scale_complexity(p_encoder_params->quality_mode_index,
+                                     p_load_controller->level));
+  dprintf(fd,
+          "  Encode time (last/max us), deadline misses              : %u / "
+          "%u, %zu\n",
+          p_load_controller->last_encode_us, p_load_controller->max_encode_us,
+          p_load_controller->deadline_misses);
+
   return;
 }
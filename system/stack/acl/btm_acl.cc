@@ -2522,6 +2522,14 @@ void btm_acl_disconnected(tHCI_STATUS status, uint16_t handle,
 void acl_create_classic_connection(const RawAddress& bd_addr,
                                    bool there_are_high_priority_channels,
                                    bool is_bonding) {
+  /* Page with the clock offset learned by the last inquiry, if any */
+  const tBTM_INQ_INFO* p_inq_info = BTM_InqDbRead(bd_addr);
+  if (p_inq_info != nullptr &&
+      (p_inq_info->results.clock_offset & BTM_CLOCK_OFFSET_VALID)) {
+    bluetooth::shim::ACL_SetClassicPageParameters(
+        bd_addr, p_inq_info->results.page_scan_rep_mode,
+        p_inq_info->results.clock_offset);
+  }
   return bluetooth::shim::ACL_CreateClassicConnection(bd_addr);
 }
 
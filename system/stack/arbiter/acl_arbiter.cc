@@ -19,8 +19,14 @@
 #include <base/functional/bind.h>
 #include <bluetooth/log.h>
 
+#include <array>
 #include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
 
+#include "internal_include/bt_target.h"
+#include "metrics/counter_registry.h"
 #include "osi/include/allocator.h"
 #include "stack/gatt/gatt_int.h"
 #include "stack/include/l2c_api.h"
@@ -75,30 +81,80 @@ struct RustArbiterCallbacks {
 };
 
 RustArbiterCallbacks callbacks_{};
+
+/// Whether Rust may want to handle a packet with this opcode, if its
+/// connection is isolated. Everything else, such as responses, notifications
+/// and the MTU exchange, always goes to the legacy stack.
+bool IsServerBoundOpcode(uint8_t opcode) {
+  switch (opcode) {
+    case GATT_REQ_FIND_INFO:
+    case GATT_REQ_FIND_TYPE_VALUE:
+    case GATT_REQ_READ_BY_TYPE:
+    case GATT_REQ_READ:
+    case GATT_REQ_READ_BLOB:
+    case GATT_REQ_READ_MULTI:
+    case GATT_REQ_READ_BY_GRP_TYPE:
+    case GATT_REQ_WRITE:
+    case GATT_REQ_PREPARE_WRITE:
+    case GATT_REQ_EXEC_WRITE:
+    case GATT_REQ_READ_MULTI_VAR:
+    case GATT_CMD_WRITE:
+    case GATT_SIGN_CMD_WRITE:
+    case GATT_HANDLE_VALUE_CONF:
+      return true;
+    default:
+      return false;
+  }
+}
 }  // namespace
 
 class RustGattAclArbiter : public AclArbiter {
  public:
   virtual void OnLeConnect(uint8_t tcb_idx, uint16_t advertiser_id) override {
     log::info("Notifying Rust of LE connection");
+    // Only connections made to an advertising set can be isolated
+    if (tcb_idx < announced_connections_.size()) {
+      announced_connections_[tcb_idx] = true;
+    }
     callbacks_.on_le_connect(tcb_idx, advertiser_id);
   }
 
   virtual void OnLeDisconnect(uint8_t tcb_idx) override {
     log::info("Notifying Rust of LE disconnection");
+    if (tcb_idx < announced_connections_.size()) {
+      announced_connections_[tcb_idx] = false;
+    }
     callbacks_.on_le_disconnect(tcb_idx);
   }
 
   virtual InterceptAction InterceptAttPacket(uint8_t tcb_idx,
                                              const BT_HDR* packet) override {
-    log::debug("Intercepting ATT packet and forwarding to Rust");
-
     uint8_t* packet_start = (uint8_t*)(packet + 1) + packet->offset;
     uint8_t* packet_end = packet_start + packet->len;
 
+    // Packets Rust would pass through anyway are classified here, without
+    // copying them across the FFI
+    if (tcb_idx >= announced_connections_.size() ||
+        !announced_connections_[tcb_idx] || packet->len == 0 ||
+        !IsServerBoundOpcode(*packet_start)) {
+      locally_classified_pdus_->Increment();
+      passed_through_pdus_->Increment();
+      return InterceptAction::FORWARD;
+    }
+
+    log::debug("Intercepting ATT packet and forwarding to Rust");
+
     auto vec = ::rust::Vec<uint8_t>();
+    vec.reserve(packet->len);
     std::copy(packet_start, packet_end, std::back_inserter(vec));
-    return callbacks_.intercept_packet(tcb_idx, std::move(vec));
+    InterceptAction action =
+        callbacks_.intercept_packet(tcb_idx, std::move(vec));
+    if (action == InterceptAction::DROP) {
+      intercepted_pdus_->Increment();
+    } else {
+      passed_through_pdus_->Increment();
+    }
+    return action;
   }
 
   virtual void OnOutgoingMtuReq(uint8_t tcb_idx) override {
@@ -116,6 +172,35 @@ class RustGattAclArbiter : public AclArbiter {
     callbacks_.on_incoming_mtu_req(tcb_idx, mtu);
   }
 
+  /// Queue a packet from Rust, only the first packet queued since the last
+  /// flush posts to the main thread, so a burst of responses is sent with a
+  /// single hop
+  void QueuePacketToPeer(uint8_t tcb_idx, ::rust::Vec<uint8_t> buffer) {
+    bool post_flush;
+    {
+      std::lock_guard<std::mutex> lock(outgoing_mutex_);
+      post_flush = outgoing_packets_.empty();
+      outgoing_packets_.emplace_back(tcb_idx, std::move(buffer));
+    }
+    if (post_flush) {
+      do_in_main_thread(FROM_HERE,
+                        base::BindOnce(&RustGattAclArbiter::FlushPacketsToPeer,
+                                       base::Unretained(this)));
+    }
+  }
+
+  void FlushPacketsToPeer() {
+    std::vector<std::pair<uint8_t, ::rust::Vec<uint8_t>>> packets;
+    {
+      std::lock_guard<std::mutex> lock(outgoing_mutex_);
+      packets.swap(outgoing_packets_);
+    }
+    outgoing_batch_size_->Record(packets.size());
+    for (auto& [tcb_idx, buffer] : packets) {
+      SendPacketToPeer(tcb_idx, std::move(buffer));
+    }
+  }
+
   void SendPacketToPeer(uint8_t tcb_idx, ::rust::Vec<uint8_t> buffer) {
     tGATT_TCB* p_tcb = gatt_get_tcb_by_idx(tcb_idx);
     if (p_tcb != nullptr) {
@@ -138,6 +223,27 @@ class RustGattAclArbiter : public AclArbiter {
     static auto singleton = RustGattAclArbiter();
     return singleton;
   }
+
+ private:
+  /// Connections announced to Rust through OnLeConnect(), by tcb_idx. Only
+  /// accessed from the main thread.
+  std::array<bool, GATT_MAX_PHY_CHANNEL> announced_connections_{};
+
+  std::mutex outgoing_mutex_;
+  std::vector<std::pair<uint8_t, ::rust::Vec<uint8_t>>> outgoing_packets_;
+
+  bluetooth::metrics::Counter* intercepted_pdus_ =
+      bluetooth::metrics::CounterRegistry::Get().GetCounter(
+          "gatt.arbiter.intercepted_pdus");
+  bluetooth::metrics::Counter* passed_through_pdus_ =
+      bluetooth::metrics::CounterRegistry::Get().GetCounter(
+          "gatt.arbiter.passed_through_pdus");
+  bluetooth::metrics::Counter* locally_classified_pdus_ =
+      bluetooth::metrics::CounterRegistry::Get().GetCounter(
+          "gatt.arbiter.locally_classified_pdus");
+  bluetooth::metrics::Histogram* outgoing_batch_size_ =
+      bluetooth::metrics::CounterRegistry::Get().GetHistogram(
+          "gatt.arbiter.outgoing_batch_size");
 };
 
 void StoreCallbacksFromRust(
@@ -154,10 +260,7 @@ void StoreCallbacksFromRust(
 }
 
 void SendPacketToPeer(uint8_t tcb_idx, ::rust::Vec<uint8_t> buffer) {
-  do_in_main_thread(FROM_HERE,
-                    base::BindOnce(&RustGattAclArbiter::SendPacketToPeer,
-                                   base::Unretained(&RustGattAclArbiter::Get()),
-                                   tcb_idx, std::move(buffer)));
+  RustGattAclArbiter::Get().QueuePacketToPeer(tcb_idx, std::move(buffer));
 }
 
 AclArbiter& GetArbiter() {
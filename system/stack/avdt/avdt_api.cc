@@ -26,6 +26,7 @@
 #include "avdt_api.h"
 
 #include <bluetooth/log.h>
+#include <inttypes.h>
 #include <string.h>
 
 #include "avdt_int.h"
@@ -868,6 +869,9 @@ uint16_t AVDT_WriteReqOpt(uint8_t handle, BT_HDR* p_pkt, uint32_t time_stamp,
   p_scb = avdt_scb_by_hdl(handle);
   if (p_scb == NULL) {
     result = AVDT_BAD_HANDLE;
+  } else if (p_scb->state == AVDT_SCB_STREAM_ST) {
+    /* media is only sent in the streaming state, skip the state machine */
+    avdt_scb_write_media(p_scb, p_pkt, time_stamp, m_pt, opt);
   } else {
     evt.apiwrite.p_buf = p_pkt;
     evt.apiwrite.time_stamp = time_stamp;
@@ -1050,6 +1054,14 @@ void stack_debug_avdtp_api_dump(int fd) {
       dprintf(fd, "      Current event: %d\n", scb.curr_evt);
       dprintf(fd, "      Congested: %s\n", scb.cong ? "true" : "false");
       dprintf(fd, "      Close response code: %d\n", scb.close_code);
+      dprintf(fd, "      Current stream: %s\n",
+              scb.curr_stream ? "true" : "false");
+      dprintf(fd, "      Media packets sent: %" PRIu64 "\n",
+              scb.media_pkts_sent);
+      dprintf(fd, "      Media bytes sent: %" PRIu64 "\n",
+              scb.media_bytes_sent);
+      dprintf(fd, "      Media packets dropped: %" PRIu64 "\n",
+              scb.media_pkts_dropped);
     }
   }
 }
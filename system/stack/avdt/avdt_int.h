@@ -425,6 +425,12 @@ class AvdtpScb {
         curr_evt(0),
         cong(false),
         close_code(0),
+        curr_stream(false),
+        media_rtp_hdr(false),
+        media_ssrc(0),
+        media_pkts_sent(0),
+        media_bytes_sent(0),
+        media_pkts_dropped(0),
         scb_handle_(0) {}
 
   /**
@@ -474,6 +480,12 @@ class AvdtpScb {
     curr_evt = 0;
     cong = false;
     close_code = 0;
+    curr_stream = false;
+    media_rtp_hdr = false;
+    media_ssrc = 0;
+    media_pkts_sent = 0;
+    media_bytes_sent = 0;
+    media_pkts_dropped = 0;
     scb_handle_ = scb_handle;
   }
 
@@ -500,6 +512,13 @@ class AvdtpScb {
   uint8_t close_code;  // Error code received in close response
   bool curr_stream;    // True if the SCB is the current stream, False otherwise
 
+  // Media fast path, see avdt_scb_write_media()
+  bool media_rtp_hdr;           // True if media packets need an RTP header
+  uint32_t media_ssrc;          // SSRC of the RTP header
+  uint64_t media_pkts_sent;     // Media packets passed to L2CAP
+  uint64_t media_bytes_sent;    // Media bytes passed to L2CAP
+  uint64_t media_pkts_dropped;  // Media packets dropped before L2CAP
+
  private:
   uint8_t scb_handle_;  // Unique handle for this AvdtpScb entry
 };
@@ -844,6 +863,9 @@ uint8_t avdt_scb_verify(AvdtpCcb* p_ccb, uint8_t state, uint8_t* p_seid,
                         uint16_t num_seid, uint8_t* p_err_code);
 void avdt_scb_peer_seid_list(tAVDT_MULTI* p_multi);
 uint32_t avdt_scb_gen_ssrc(AvdtpScb* p_scb);
+uint8_t avdt_scb_update_curr_stream(void);
+void avdt_scb_write_media(AvdtpScb* p_scb, BT_HDR* p_buf, uint32_t time_stamp,
+                          uint8_t m_pt, tAVDT_DATA_OPT_MASK opt);
 
 /* SCB action functions */
 void avdt_scb_hdl_abort_cmd(AvdtpScb* p_scb, tAVDT_SCB_EVT* p_data);
@@ -26,6 +26,7 @@
 #include <bluetooth/log.h>
 #include <string.h>
 
+#include "a2dp_codec_api.h"
 #include "avdt_api.h"
 #include "avdt_int.h"
 #include "avdtc_api.h"
@@ -770,28 +771,10 @@ void avdt_scb_event(AvdtpScb* p_scb, uint8_t event, tAVDT_SCB_EVT* p_data) {
 
   /* Check that we only send AVDT_SCB_API_WRITE_REQ_EVT to the active stream
    * device */
-  uint8_t num_st_streams = 0;
-  int ccb_index = -1;
-  int scb_index = -1;
-
-  for (int i = 0; i < AVDT_NUM_LINKS; i++) {
-    for (int j = 0; j < AVDT_NUM_SEPS; j++) {
-      AvdtpScb* p_avdt_scb = &avdtp_cb.ccb[i].scb[j];
-      if (p_avdt_scb->allocated &&
-          avdt_scb_st_tbl[p_avdt_scb->state] == avdt_scb_st_stream) {
-        num_st_streams++;
-        ccb_index = i;
-        scb_index = j;
-      } else {
-        p_avdt_scb->curr_stream = false;
-      }
-    }
-  }
+  uint8_t num_st_streams = avdt_scb_update_curr_stream();
 
-  if (num_st_streams == 1) {
-    avdtp_cb.ccb[ccb_index].scb[scb_index].curr_stream = true;
-  } else if (num_st_streams > 1 && !p_scb->curr_stream &&
-             event == AVDT_SCB_API_WRITE_REQ_EVT) {
+  if (num_st_streams > 1 && !p_scb->curr_stream &&
+      event == AVDT_SCB_API_WRITE_REQ_EVT) {
     log::error("ignore AVDT_SCB_API_WRITE_REQ_EVT");
     avdt_scb_free_pkt(p_scb, p_data);
     return;
@@ -806,6 +789,13 @@ void avdt_scb_event(AvdtpScb* p_scb, uint8_t event, tAVDT_SCB_EVT* p_data) {
   /* set next state */
   if (p_scb->state != state_table[event][AVDT_SCB_NEXT_STATE]) {
     p_scb->state = state_table[event][AVDT_SCB_NEXT_STATE];
+
+    /* media written from now on takes the fast path, which relies on these */
+    if (p_scb->state == AVDT_SCB_STREAM_ST) {
+      p_scb->media_rtp_hdr = A2DP_UsesRtpHeader(
+          p_scb->curr_cfg.num_protect > 0, p_scb->curr_cfg.codec_info);
+      p_scb->media_ssrc = avdt_scb_gen_ssrc(p_scb);
+    }
   }
 
   /* execute action functions */
@@ -817,6 +807,47 @@ void avdt_scb_event(AvdtpScb* p_scb, uint8_t event, tAVDT_SCB_EVT* p_data) {
       break;
     }
   }
+
+  /* the fast path does not go through here, keep the current stream up to
+   * date for it */
+  avdt_scb_update_curr_stream();
+}
+
+/*******************************************************************************
+ *
+ * Function         avdt_scb_update_curr_stream
+ *
+ * Description      Mark the stream allowed to send media.  If a single stream
+ *                  is in the streaming state it becomes the current stream,
+ *                  otherwise the current stream is left unchanged.
+ *
+ *
+ * Returns          Number of streams in the streaming state.
+ *
+ ******************************************************************************/
+uint8_t avdt_scb_update_curr_stream(void) {
+  uint8_t num_st_streams = 0;
+  int ccb_index = -1;
+  int scb_index = -1;
+
+  for (int i = 0; i < AVDT_NUM_LINKS; i++) {
+    for (int j = 0; j < AVDT_NUM_SEPS; j++) {
+      AvdtpScb* p_avdt_scb = &avdtp_cb.ccb[i].scb[j];
+      if (p_avdt_scb->allocated &&
+          avdt_scb_st_tbl[p_avdt_scb->state] == avdt_scb_st_stream) {
+        num_st_streams++;
+        ccb_index = i;
+        scb_index = j;
+      } else {
+        p_avdt_scb->curr_stream = false;
+      }
+    }
+  }
+
+  if (num_st_streams == 1) {
+    avdtp_cb.ccb[ccb_index].scb[scb_index].curr_stream = true;
+  }
+  return num_st_streams;
 }
 
 /*******************************************************************************
@@ -1030,6 +1030,60 @@ void avdt_scb_hdl_write_req(AvdtpScb* p_scb, tAVDT_SCB_EVT* p_data) {
   p_scb->p_pkt = p_data->apiwrite.p_buf;
 }
 
+/*******************************************************************************
+ *
+ * Function         avdt_scb_write_media
+ *
+ * Description      This function sends a media packet on a stream in the
+ *                  streaming state without going through the state machine.
+ *                  The RTP header uses the values cached when the stream
+ *                  entered the streaming state.  Like with the state machine,
+ *                  the packet is held while the media channel is congested.
+ *
+ * Returns          Nothing.
+ *
+ ******************************************************************************/
+void avdt_scb_write_media(AvdtpScb* p_scb, BT_HDR* p_buf, uint32_t time_stamp,
+                          uint8_t m_pt, tAVDT_DATA_OPT_MASK opt) {
+  uint8_t* p;
+
+  if (!p_scb->curr_stream) {
+    log::error("ignore media packet for stream that is not current");
+    p_scb->media_pkts_dropped++;
+    osi_free(p_buf);
+    return;
+  }
+
+  if (p_scb->p_pkt != NULL) {
+    log::warn("Dropped media packet; congested");
+    p_scb->media_pkts_dropped++;
+    osi_free_and_reset((void**)&p_scb->p_pkt);
+  }
+
+  if (p_scb->media_rtp_hdr && !(opt & AVDT_DATA_OPT_NO_RTP)) {
+    if (p_buf->offset < AVDT_MEDIA_HDR_SIZE) {
+      log::error("no room for the RTP header, offset={}", p_buf->offset);
+      p_scb->media_pkts_dropped++;
+      osi_free(p_buf);
+      return;
+    }
+
+    p_buf->len += AVDT_MEDIA_HDR_SIZE;
+    p_buf->offset -= AVDT_MEDIA_HDR_SIZE;
+    p_scb->media_seq++;
+    p = (uint8_t*)(p_buf + 1) + p_buf->offset;
+
+    UINT8_TO_BE_STREAM(p, AVDT_MEDIA_OCTET1);
+    UINT8_TO_BE_STREAM(p, m_pt);
+    UINT16_TO_BE_STREAM(p, p_scb->media_seq);
+    UINT32_TO_BE_STREAM(p, time_stamp);
+    UINT32_TO_BE_STREAM(p, p_scb->media_ssrc);
+  }
+
+  p_scb->p_pkt = p_buf;
+  avdt_scb_chk_snd_pkt(p_scb, NULL);
+}
+
 /*******************************************************************************
  *
  * Function         avdt_scb_snd_abort_req
@@ -1565,6 +1619,8 @@ void avdt_scb_chk_snd_pkt(AvdtpScb* p_scb, UNUSED_ATTR tAVDT_SCB_EVT* p_data) {
     if (p_scb->p_pkt != NULL) {
       p_pkt = p_scb->p_pkt;
       p_scb->p_pkt = NULL;
+      p_scb->media_pkts_sent++;
+      p_scb->media_bytes_sent += p_pkt->len;
       avdt_ad_write_req(AVDT_CHAN_MEDIA, p_scb->p_ccb, p_scb, p_pkt);
 
       (*p_scb->stream_config.p_avdt_ctrl_cback)(
@@ -83,6 +83,9 @@
 
 #define BNEP_MAX_RETRANSMITS 3
 
+/* Size of the received protocol filter bitmap, one bit per protocol type */
+#define BNEP_PROT_FILTER_MAP_SIZE ((UINT16_MAX + 1) / 8)
+
 /* Define the BNEP Connection Control Block
 */
 typedef struct {
@@ -120,12 +123,12 @@ typedef struct {
   RawAddress sent_mcast_filter_end[BNEP_MAX_MULTI_FILTERS];
 
   uint16_t rcvd_num_filters;
-  uint16_t rcvd_prot_filter_start[BNEP_MAX_PROT_FILTERS];
-  uint16_t rcvd_prot_filter_end[BNEP_MAX_PROT_FILTERS];
+  uint8_t* rcvd_prot_filter_map; /* Bitmap of allowed protocols, one bit per */
+  /* protocol type, rebuilt from the ranges on each filter set */
 
   uint16_t rcvd_mcast_filters;
-  RawAddress rcvd_mcast_filter_start[BNEP_MAX_MULTI_FILTERS];
-  RawAddress rcvd_mcast_filter_end[BNEP_MAX_MULTI_FILTERS];
+  uint64_t rcvd_mcast_filter_start[BNEP_MAX_MULTI_FILTERS]; /* 48 bit address */
+  uint64_t rcvd_mcast_filter_end[BNEP_MAX_MULTI_FILTERS];   /* keys, MSB first */
 
   uint16_t bad_pkts_rcvd;
   uint8_t re_transmits;
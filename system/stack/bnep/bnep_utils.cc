@@ -50,6 +50,13 @@ void bnepu_process_peer_multicast_filter_set(tBNEP_CONN* p_bcb,
 void bnepu_send_peer_multicast_filter_rsp(tBNEP_CONN* p_bcb,
                                           uint16_t response_code);
 
+/* Pack a BD address into an integer that orders like memcmp on the bytes */
+static uint64_t bnepu_addr_to_key(const uint8_t* addr) {
+  uint64_t key = 0;
+  for (int i = 0; i < BD_ADDR_LEN; i++) key = (key << 8) | addr[i];
+  return key;
+}
+
 /*******************************************************************************
  *
  * Function         bnepu_find_bcb_by_cid
@@ -116,6 +123,7 @@ tBNEP_CONN* bnepu_allocate_bcb(const RawAddress& p_rem_bda) {
   for (xx = 0, p_bcb = bnep_cb.bcb; xx < BNEP_MAX_CONNECTIONS; xx++, p_bcb++) {
     if (p_bcb->con_state == BNEP_STATE_IDLE) {
       alarm_free(p_bcb->conn_timer);
+      osi_free(p_bcb->rcvd_prot_filter_map);
       memset((uint8_t*)p_bcb, 0, sizeof(tBNEP_CONN));
       p_bcb->conn_timer = alarm_new("bnep.conn_timer");
 
@@ -155,6 +163,10 @@ void bnepu_release_bcb(tBNEP_CONN* p_bcb) {
   }
   fixed_queue_free(p_bcb->xmit_q, NULL);
   p_bcb->xmit_q = NULL;
+
+  /* Drop the protocol filter table of the peer */
+  p_bcb->rcvd_num_filters = 0;
+  osi_free_and_reset((void**)&p_bcb->rcvd_prot_filter_map);
 }
 
 /*******************************************************************************
@@ -912,13 +924,22 @@ void bnepu_process_peer_filter_set(tBNEP_CONN* p_bcb, uint8_t* p_filters,
   if (bnep_cb.p_filter_ind_cb)
     (*bnep_cb.p_filter_ind_cb)(p_bcb->handle, true, 0, len, p_filters);
 
+  /* Rebuild the protocol bitmap so that the per packet check is a lookup */
   p_bcb->rcvd_num_filters = num_filters;
+  if (num_filters == 0) {
+    osi_free_and_reset((void**)&p_bcb->rcvd_prot_filter_map);
+  } else {
+    if (p_bcb->rcvd_prot_filter_map == NULL)
+      p_bcb->rcvd_prot_filter_map =
+          (uint8_t*)osi_malloc(BNEP_PROT_FILTER_MAP_SIZE);
+    memset(p_bcb->rcvd_prot_filter_map, 0, BNEP_PROT_FILTER_MAP_SIZE);
+  }
   for (xx = 0; xx < num_filters; xx++) {
     BE_STREAM_TO_UINT16(start, p_filters);
     BE_STREAM_TO_UINT16(end, p_filters);
 
-    p_bcb->rcvd_prot_filter_start[xx] = start;
-    p_bcb->rcvd_prot_filter_end[xx] = end;
+    for (uint32_t proto = start; proto <= end; proto++)
+      p_bcb->rcvd_prot_filter_map[proto >> 3] |= (uint8_t)(1 << (proto & 7));
   }
 
   bnepu_send_peer_filter_rsp(p_bcb, resp_code);
@@ -1066,20 +1087,20 @@ void bnepu_process_peer_multicast_filter_set(tBNEP_CONN* p_bcb,
   p_bcb->rcvd_mcast_filters = num_filters;
   p_temp_filters = p_filters;
   for (xx = 0; xx < num_filters; xx++) {
-    memcpy(p_bcb->rcvd_mcast_filter_start[xx].address, p_temp_filters, BD_ADDR_LEN);
-    memcpy(p_bcb->rcvd_mcast_filter_end[xx].address, p_temp_filters + BD_ADDR_LEN,
-           BD_ADDR_LEN);
-    p_temp_filters += (BD_ADDR_LEN * 2);
-
     /* Check if any of the ranges have all zeros as both starting and ending
      * addresses */
-    if ((memcmp(null_bda, p_bcb->rcvd_mcast_filter_start[xx].address,
-                BD_ADDR_LEN) == 0) &&
-        (memcmp(null_bda, p_bcb->rcvd_mcast_filter_end[xx].address,
-                BD_ADDR_LEN) == 0)) {
+    if ((memcmp(null_bda, p_temp_filters, BD_ADDR_LEN) == 0) &&
+        (memcmp(null_bda, p_temp_filters + BD_ADDR_LEN, BD_ADDR_LEN) == 0)) {
       p_bcb->rcvd_mcast_filters = 0xFFFF;
       break;
     }
+
+    /* Keep the ranges as integers so that the per packet check does not have
+     * to compare the addresses byte by byte */
+    p_bcb->rcvd_mcast_filter_start[xx] = bnepu_addr_to_key(p_temp_filters);
+    p_bcb->rcvd_mcast_filter_end[xx] =
+        bnepu_addr_to_key(p_temp_filters + BD_ADDR_LEN);
+    p_temp_filters += (BD_ADDR_LEN * 2);
   }
 
   log::verbose("BNEP multicast filters {}", p_bcb->rcvd_mcast_filters);
@@ -1188,7 +1209,7 @@ tBNEP_RESULT bnep_is_packet_allowed(tBNEP_CONN* p_bcb,
                                     uint16_t protocol, bool fw_ext_present,
                                     uint8_t* p_data, uint16_t org_len) {
   if (p_bcb->rcvd_num_filters) {
-    uint16_t i, proto;
+    uint16_t proto;
 
     /* Findout the actual protocol to check for the filtering */
     proto = protocol;
@@ -1217,13 +1238,7 @@ tBNEP_RESULT bnep_is_packet_allowed(tBNEP_CONN* p_bcb,
       BE_STREAM_TO_UINT16(proto, p_data);
     }
 
-    for (i = 0; i < p_bcb->rcvd_num_filters; i++) {
-      if ((p_bcb->rcvd_prot_filter_start[i] <= proto) &&
-          (proto <= p_bcb->rcvd_prot_filter_end[i]))
-        break;
-    }
-
-    if (i == p_bcb->rcvd_num_filters) {
+    if (!(p_bcb->rcvd_prot_filter_map[proto >> 3] & (1 << (proto & 7)))) {
       log::verbose("Ignoring protocol 0x{:x} in BNEP data write", proto);
       return BNEP_IGNORE_CMD;
     }
@@ -1235,12 +1250,12 @@ tBNEP_RESULT bnep_is_packet_allowed(tBNEP_CONN* p_bcb,
 
     /* Check if every multicast should be filtered */
     if (p_bcb->rcvd_mcast_filters != 0xFFFF) {
+      uint64_t dest_key = bnepu_addr_to_key(dest_addr.address);
+
       /* Check if the address is mentioned in the filter range */
       for (i = 0; i < p_bcb->rcvd_mcast_filters; i++) {
-        if ((memcmp(p_bcb->rcvd_mcast_filter_start[i].address,
-                    dest_addr.address, BD_ADDR_LEN) <= 0) &&
-            (memcmp(p_bcb->rcvd_mcast_filter_end[i].address, dest_addr.address,
-                    BD_ADDR_LEN) >= 0))
+        if ((p_bcb->rcvd_mcast_filter_start[i] <= dest_key) &&
+            (dest_key <= p_bcb->rcvd_mcast_filter_end[i]))
           break;
       }
     }
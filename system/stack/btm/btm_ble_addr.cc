@@ -28,11 +28,16 @@
 
 #include <base/functional/bind.h>
 #include <bluetooth/log.h>
+#include <inttypes.h>
 #include <string.h>
 
+#include <array>
+#include <mutex>
+
 #include "btm_ble_int.h"
 #include "btm_dev.h"
 #include "btm_sec_cb.h"
+#include "common/time_util.h"
 #include "crypto_toolbox/crypto_toolbox.h"
 #include "device/include/controller.h"
 #include "os/log.h"
@@ -118,6 +123,109 @@ bool btm_ble_init_pseudo_addr(tBTM_SEC_DEV_REC* p_dev_rec,
   return false;
 }
 
+namespace {
+
+/* Remembers which record, if any, a resolvable private address resolved to,
+ * so that the RPA of a peer seen in every scan report is not resolved again
+ * against the IRK of every bonded device. Unresolvable RPAs of unknown devices
+ * are remembered as well, until an IRK is added. Peers refresh their RPA every
+ * 15 minutes by default, entries are not used for longer than that.
+ */
+class RpaResolutionCache {
+ public:
+  static constexpr size_t kSize = 64;
+  static constexpr uint64_t kExpiryMs = 15 * 60 * 1000;
+
+  /* Returns true if |rpa| was resolved recently, |*pp_dev_rec| is the record
+   * it resolved to or nullptr if it did not resolve */
+  bool Find(const RawAddress& rpa, tBTM_SEC_DEV_REC** pp_dev_rec) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+    for (Entry& entry : entries_) {
+      if (!entry.valid || entry.rpa != rpa) continue;
+      if (now_ms - entry.resolved_ms > kExpiryMs ||
+          !IsStillResolvedTo(entry)) {
+        entry.valid = false;
+        break;
+      }
+      stats_.hits++;
+      *pp_dev_rec = entry.p_dev_rec;
+      return true;
+    }
+    stats_.misses++;
+    return false;
+  }
+
+  void Remember(const RawAddress& rpa, tBTM_SEC_DEV_REC* p_dev_rec) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[next_];
+    entry.rpa = rpa;
+    entry.p_dev_rec = p_dev_rec;
+    if (p_dev_rec != nullptr) entry.irk = p_dev_rec->sec_rec.ble_keys.irk;
+    entry.resolved_ms = bluetooth::common::time_get_os_boottime_ms();
+    entry.valid = true;
+    next_ = (next_ + 1) % kSize;
+  }
+
+  /* Called when an IRK is added, unresolved RPAs may now resolve */
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Entry& entry : entries_) entry.valid = false;
+  }
+
+  void CountAesOperations(uint64_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.aes_operations += count;
+  }
+
+  void Dump(int fd) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dprintf(fd,
+            "RPA resolution cache (size: %zu)\n"
+            "  hits: %" PRIu64 " misses: %" PRIu64 " aes operations: %" PRIu64
+            "\n",
+            kSize, stats_.hits, stats_.misses, stats_.aes_operations);
+  }
+
+ private:
+  struct Entry {
+    RawAddress rpa;
+    tBTM_SEC_DEV_REC* p_dev_rec;
+    Octet16 irk;
+    uint64_t resolved_ms;
+    bool valid;
+  };
+
+  /* The record may have been removed, or its memory reused for another
+   * device, or its keys wiped since */
+  static bool IsStillResolvedTo(const Entry& entry) {
+    const tBTM_SEC_DEV_REC* p_dev_rec = entry.p_dev_rec;
+    if (p_dev_rec == nullptr) return true;
+    if (btm_sec_cb.sec_dev_rec == nullptr ||
+        !list_contains(btm_sec_cb.sec_dev_rec, p_dev_rec))
+      return false;
+    return (p_dev_rec->sec_rec.ble_keys.key_type & BTM_LE_KEY_PID) &&
+           p_dev_rec->sec_rec.ble_keys.irk == entry.irk;
+  }
+
+  std::mutex mutex_;
+  std::array<Entry, kSize> entries_{};
+  size_t next_{0};
+  struct {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t aes_operations{0};
+  } stats_;
+};
+
+RpaResolutionCache rpa_resolution_cache;
+
+}  // namespace
+
+void btm_ble_rpa_cache_clear(void) { rpa_resolution_cache.Clear(); }
+
+void btm_ble_rpa_cache_dump(int fd) { rpa_resolution_cache.Dump(fd); }
+
 /* Return true if given Resolvable Privae Address |rpa| matches Identity
  * Resolving Key |irk| */
 static bool rpa_matches_irk(const RawAddress& rpa, const Octet16& irk) {
@@ -151,7 +259,16 @@ bool btm_ble_addr_resolvable(const RawAddress& rpa,
 
   if ((p_dev_rec->device_type & BT_DEVICE_TYPE_BLE) &&
       (p_dev_rec->sec_rec.ble_keys.key_type & BTM_LE_KEY_PID)) {
-    if (rpa_matches_irk(rpa, p_dev_rec->sec_rec.ble_keys.irk)) {
+    tBTM_SEC_DEV_REC* p_resolved_rec;
+    bool match;
+    if (rpa_resolution_cache.Find(rpa, &p_resolved_rec)) {
+      match = (p_resolved_rec == p_dev_rec);
+    } else {
+      rpa_resolution_cache.CountAesOperations(1);
+      match = rpa_matches_irk(rpa, p_dev_rec->sec_rec.ble_keys.irk);
+      if (match) rpa_resolution_cache.Remember(rpa, p_dev_rec);
+    }
+    if (match) {
       btm_ble_init_pseudo_addr(p_dev_rec, rpa);
       return true;
     }
@@ -171,6 +288,7 @@ static bool btm_ble_match_random_bda(void* data, void* context) {
     // Match fails preconditions
     return true;
 
+  rpa_resolution_cache.CountAesOperations(1);
   if (rpa_matches_irk(*random_bda, p_dev_rec->sec_rec.ble_keys.irk)) {
     // Matched
     return false;
@@ -186,10 +304,16 @@ static bool btm_ble_match_random_bda(void* data, void* context) {
  */
 tBTM_SEC_DEV_REC* btm_ble_resolve_random_addr(const RawAddress& random_bda) {
   if (btm_sec_cb.sec_dev_rec == nullptr) return nullptr;
+
+  tBTM_SEC_DEV_REC* p_dev_rec;
+  if (rpa_resolution_cache.Find(random_bda, &p_dev_rec)) return p_dev_rec;
+
   list_node_t* n = list_foreach(btm_sec_cb.sec_dev_rec,
                                 btm_ble_match_random_bda, (void*)&random_bda);
-  return (n == nullptr) ? (nullptr)
-                        : (static_cast<tBTM_SEC_DEV_REC*>(list_node(n)));
+  p_dev_rec = (n == nullptr) ? (nullptr)
+                             : (static_cast<tBTM_SEC_DEV_REC*>(list_node(n)));
+  rpa_resolution_cache.Remember(random_bda, p_dev_rec);
+  return p_dev_rec;
 }
 
 /*******************************************************************************
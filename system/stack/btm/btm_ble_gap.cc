@@ -65,11 +65,13 @@
 #include "stack/include/bt_uuid16.h"
 #include "stack/include/btm_api_types.h"
 #include "stack/include/btm_ble_addr.h"
+#include "stack/include/btm_ble_api.h"
 #include "stack/include/btm_ble_privacy.h"
 #include "stack/include/btm_log_history.h"
 #include "stack/include/gap_api.h"
 #include "stack/include/hci_error_code.h"
 #include "stack/include/inq_hci_link_interface.h"
+#include "stack/include/l2cap_acl_interface.h"
 #include "types/ble_address_with_type.h"
 #include "types/raw_address.h"
 
@@ -97,6 +99,15 @@ static const char kPropertyInquiryScanInterval[] =
     "bluetooth.core.le.inquiry_scan_interval";
 static const char kPropertyInquiryScanWindow[] =
     "bluetooth.core.le.inquiry_scan_window";
+/* Used instead while a link has high priority traffic, e.g. an A2DP stream */
+static const char kPropertyInquiryScanIntervalStreaming[] =
+    "bluetooth.core.le.inquiry_scan_interval_streaming";
+static const char kPropertyInquiryScanWindowStreaming[] =
+    "bluetooth.core.le.inquiry_scan_window_streaming";
+
+/* 20 ms every 100 ms, leaving most of the air time to the stream */
+#define BTM_BLE_STREAMING_INQUIRY_SCAN_INT 160
+#define BTM_BLE_STREAMING_INQUIRY_SCAN_WIN 32
 
 static void btm_ble_start_scan();
 static void btm_ble_stop_scan();
@@ -508,6 +519,22 @@ get_low_latency_scan_params() {
   return std::make_pair(scan_interval, scan_window);
 }
 
+/* Scan parameters of the LE part of an inquiry, low latency unless a link has
+ * high priority traffic that the scan would take air time from */
+static std::pair<uint16_t /* interval */, uint16_t /* window */>
+get_inquiry_scan_params() {
+  if (l2cu_get_num_hi_priority() == 0) {
+    return get_low_latency_scan_params();
+  }
+  uint16_t scan_interval =
+      osi_property_get_int32(kPropertyInquiryScanIntervalStreaming,
+                             BTM_BLE_STREAMING_INQUIRY_SCAN_INT);
+  uint16_t scan_window = osi_property_get_int32(
+      kPropertyInquiryScanWindowStreaming, BTM_BLE_STREAMING_INQUIRY_SCAN_WIN);
+
+  return std::make_pair(scan_interval, scan_window);
+}
+
 /*******************************************************************************
  *
  * Function         BTM_BleObserve
@@ -1946,7 +1973,7 @@ tBTM_STATUS btm_ble_start_inquiry(uint8_t duration) {
                  std::move(adv_filt_param), base::Bind(btm_ble_scan_filt_param_cfg_evt));
 
   uint16_t scan_interval, scan_window;
-  std::tie(scan_interval, scan_window) = get_low_latency_scan_params();
+  std::tie(scan_interval, scan_window) = get_inquiry_scan_params();
 
   if (!btm_cb.ble_ctr_cb.is_ble_scan_active()) {
     cache.ClearAll();
@@ -2610,9 +2637,24 @@ void btm_ble_process_adv_pkt_cont_for_inquiry(
     uint16_t evt_type, tBLE_ADDR_TYPE addr_type, const RawAddress& bda,
     uint8_t primary_phy, uint8_t secondary_phy, uint8_t advertising_sid,
     int8_t tx_power, int8_t rssi, uint16_t periodic_adv_int,
-    std::vector<uint8_t> advertising_data) {
+    const std::vector<uint8_t>& advertising_data) {
   bool update = true;
 
+  /* Outside of discovery, with no observer of the results, the inquiry database
+   * only needs to know the device, for connections to find its address type.
+   * Skip the parsing of the results already recorded. */
+  if (!btm_cb.ble_ctr_cb.is_ble_inquiry_active() &&
+      btm_cb.ble_ctr_cb.p_opportunistic_obs_results_cb == nullptr &&
+      btm_cb.ble_ctr_cb.p_target_announcement_obs_results_cb == nullptr &&
+      btm_cb.btm_inq_vars.p_inq_results_cb == nullptr) {
+    const tINQ_DB_ENT* p_known = btm_inq_db_find(bda);
+    if (p_known != nullptr &&
+        (p_known->inq_info.results.device_type & BT_DEVICE_TYPE_BLE) &&
+        p_known->inq_info.results.ble_addr_type == addr_type) {
+      return;
+    }
+  }
+
   bool include_rsi = false;
   uint8_t len;
   if (AdvertiseDataParser::GetFieldByType(advertising_data, BTM_BLE_AD_TYPE_RSI,
@@ -2969,6 +3011,42 @@ static void btm_ble_observer_timer_timeout(UNUSED_ATTR void* data) {
   btm_ble_stop_observe();
 }
 
+/*******************************************************************************
+ *
+ * Function         btm_ble_optimize_link_throughput
+ *
+ * Description      Once the remote LE features are known, ask for the largest
+ *                  data length and for the 2M PHY when both sides support
+ *                  them, instead of waiting for a profile to request it.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+static void btm_ble_optimize_link_throughput(uint16_t handle) {
+  static const bool enabled = osi_property_get_bool(
+      "bluetooth.core.le.link_throughput_optimizer_enabled", false);
+  if (!enabled) return;
+
+  const RawAddress bd_addr = acl_address_from_handle(handle);
+  if (bd_addr == RawAddress::kEmpty) return;
+
+  const bool data_length = acl_peer_supports_ble_packet_extension(handle) &&
+                           controller_get_interface()
+                               ->SupportsBleDataPacketLengthExtension();
+  const bool phy_2m = acl_peer_supports_ble_2m_phy(handle) &&
+                      controller_get_interface()->SupportsBle2mPhy();
+
+  log::info("{} handle:0x{:04x} data_length:{} 2m_phy:{}",
+            ADDRESS_TO_LOGGABLE_CSTR(bd_addr), handle, data_length, phy_2m);
+
+  if (data_length) {
+    BTM_SetBleDataLength(bd_addr, BTM_BLE_DATA_SIZE_MAX);
+  }
+  if (phy_2m) {
+    BTM_BleSetPhy(bd_addr, PHY_LE_2M, PHY_LE_2M, 0);
+  }
+}
+
 /*******************************************************************************
  *
  * Function         btm_ble_read_remote_features_complete
@@ -3013,6 +3091,7 @@ void btm_ble_read_remote_features_complete(uint8_t* p, uint8_t length) {
           "Unable to find existing connection after read remote features");
       return;
     }
+    btm_ble_optimize_link_throughput(handle);
   }
 
   btsnd_hcic_rmt_ver_req(handle);
@@ -3190,6 +3269,8 @@ void btm_ble_init(void) {
 
   btm_cb.ble_ctr_cb.addr_mgnt_cb.refresh_raddr_timer =
       alarm_new("btm_ble_addr.refresh_raddr_timer");
+  alarm_set_class(btm_cb.ble_ctr_cb.addr_mgnt_cb.refresh_raddr_timer,
+                  ALARM_CLASS_LAZY);
   btm_ble_pa_sync_cb = {};
   sync_timeout_alarm = alarm_new("btm.sync_start_task");
   if (!ble_vnd_is_included()) {
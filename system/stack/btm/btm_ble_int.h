@@ -55,6 +55,8 @@ void btm_gen_resolvable_private_addr(
     base::Callback<void(const RawAddress& rpa)> cb);
 
 tBTM_SEC_DEV_REC* btm_ble_resolve_random_addr(const RawAddress& random_bda);
+void btm_ble_rpa_cache_clear(void);
+void btm_ble_rpa_cache_dump(int fd);
 void btm_gen_resolve_paddr_low(const RawAddress& address);
 
 void btm_ble_batchscan_init(void);
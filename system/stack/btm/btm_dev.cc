@@ -30,6 +30,8 @@
 #include <bluetooth/log.h>
 
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "btm_api.h"
 #include "btm_int_types.h"
@@ -60,11 +62,123 @@ namespace {
 
 constexpr char kBtmLogTag[] = "BOND";
 
+/* Remembers which record the lookups in the device list returned, so that the
+ * record of a peer is found again without going through every record and
+ * resolving its private address against each of them. A remembered record is
+ * only returned while it is still in the list and still matches, otherwise the
+ * list is searched again. Records are only added to and removed from the list
+ * in this file, a list that changed behind our back is detected by its length.
+ */
+class DevRecIndex {
+ public:
+  tBTM_SEC_DEV_REC* FindByAddress(const RawAddress& bd_addr);
+  tBTM_SEC_DEV_REC* FindByHandle(uint16_t handle);
+  void RememberAddress(const RawAddress& bd_addr, tBTM_SEC_DEV_REC* p_dev_rec);
+  void RememberHandle(uint16_t handle, tBTM_SEC_DEV_REC* p_dev_rec);
+
+  // Must be called before the record is appended to the list
+  void Add(tBTM_SEC_DEV_REC* p_dev_rec);
+  // Must be called before the record is removed from the list
+  void Remove(tBTM_SEC_DEV_REC* p_dev_rec);
+  // An earlier record in the list may now match an address
+  void ForgetAddresses() { by_address_.clear(); }
+
+ private:
+  void Sync();
+
+  const list_t* list_{nullptr};
+  std::unordered_set<const tBTM_SEC_DEV_REC*> records_;
+  std::unordered_map<RawAddress, tBTM_SEC_DEV_REC*> by_address_;
+  std::unordered_map<uint16_t, tBTM_SEC_DEV_REC*> by_handle_;
+};
+
+DevRecIndex dev_rec_index;
+
+}  // namespace
+
+static bool is_handle_equal(void* data, void* context);
+static bool is_address_equal(void* data, void* context);
+
+void DevRecIndex::Sync() {
+  const list_t* list = btm_sec_cb.sec_dev_rec;
+  if (list == list_ && (list == nullptr || records_.size() == list_length(list)))
+    return;
+
+  list_ = list;
+  records_.clear();
+  by_address_.clear();
+  by_handle_.clear();
+  if (list == nullptr) return;
+  for (const list_node_t* node = list_begin(list); node != list_end(list);
+       node = list_next(node)) {
+    records_.insert(static_cast<tBTM_SEC_DEV_REC*>(list_node(node)));
+  }
+}
+
+tBTM_SEC_DEV_REC* DevRecIndex::FindByAddress(const RawAddress& bd_addr) {
+  Sync();
+  auto it = by_address_.find(bd_addr);
+  if (it == by_address_.end()) return nullptr;
+  tBTM_SEC_DEV_REC* p_dev_rec = it->second;
+  if (records_.count(p_dev_rec) == 0 ||
+      is_address_equal(p_dev_rec, (void*)&bd_addr)) {
+    by_address_.erase(bd_addr);
+    return nullptr;
+  }
+  return p_dev_rec;
+}
+
+tBTM_SEC_DEV_REC* DevRecIndex::FindByHandle(uint16_t handle) {
+  Sync();
+  auto it = by_handle_.find(handle);
+  if (it == by_handle_.end()) return nullptr;
+  tBTM_SEC_DEV_REC* p_dev_rec = it->second;
+  if (records_.count(p_dev_rec) == 0 ||
+      is_handle_equal(p_dev_rec, &handle)) {
+    by_handle_.erase(it);
+    return nullptr;
+  }
+  return p_dev_rec;
+}
+
+void DevRecIndex::RememberAddress(const RawAddress& bd_addr,
+                                  tBTM_SEC_DEV_REC* p_dev_rec) {
+  // Every record without a pseudo address matches the empty address
+  if (bd_addr.IsEmpty()) return;
+  Sync();
+  by_address_[bd_addr] = p_dev_rec;
+}
+
+void DevRecIndex::RememberHandle(uint16_t handle,
+                                 tBTM_SEC_DEV_REC* p_dev_rec) {
+  // Every disconnected record matches the invalid handle
+  if (handle == HCI_INVALID_HANDLE) return;
+  Sync();
+  by_handle_[handle] = p_dev_rec;
+}
+
+void DevRecIndex::Add(tBTM_SEC_DEV_REC* p_dev_rec) {
+  Sync();
+  // Appended records come after the remembered ones, which still match first
+  records_.insert(p_dev_rec);
+}
+
+void DevRecIndex::Remove(tBTM_SEC_DEV_REC* p_dev_rec) {
+  Sync();
+  records_.erase(p_dev_rec);
+  // A later record may match what the removed one matched
+  for (auto it = by_address_.begin(); it != by_address_.end();) {
+    it = it->second == p_dev_rec ? by_address_.erase(it) : std::next(it);
+  }
+  for (auto it = by_handle_.begin(); it != by_handle_.end();) {
+    it = it->second == p_dev_rec ? by_handle_.erase(it) : std::next(it);
+  }
 }
 
 static void wipe_secrets_and_remove(tBTM_SEC_DEV_REC* p_dev_rec) {
   p_dev_rec->sec_rec.link_key.fill(0);
   memset(&p_dev_rec->sec_rec.ble_keys, 0, sizeof(tBTM_SEC_BLE_KEYS));
+  dev_rec_index.Remove(p_dev_rec);
   list_remove(btm_sec_cb.sec_dev_rec, p_dev_rec);
 }
 
@@ -375,9 +489,16 @@ static bool is_handle_equal(void* data, void* context) {
 tBTM_SEC_DEV_REC* btm_find_dev_by_handle(uint16_t handle) {
   if (btm_sec_cb.sec_dev_rec == nullptr) return nullptr;
 
+  tBTM_SEC_DEV_REC* p_dev_rec = dev_rec_index.FindByHandle(handle);
+  if (p_dev_rec) return p_dev_rec;
+
   list_node_t* n =
       list_foreach(btm_sec_cb.sec_dev_rec, is_handle_equal, &handle);
-  if (n) return static_cast<tBTM_SEC_DEV_REC*>(list_node(n));
+  if (n) {
+    p_dev_rec = static_cast<tBTM_SEC_DEV_REC*>(list_node(n));
+    dev_rec_index.RememberHandle(handle, p_dev_rec);
+    return p_dev_rec;
+  }
 
   return NULL;
 }
@@ -407,13 +528,22 @@ static bool is_address_equal(void* data, void* context) {
 tBTM_SEC_DEV_REC* btm_find_dev(const RawAddress& bd_addr) {
   if (btm_sec_cb.sec_dev_rec == nullptr) return nullptr;
 
+  tBTM_SEC_DEV_REC* p_dev_rec = dev_rec_index.FindByAddress(bd_addr);
+  if (p_dev_rec) return p_dev_rec;
+
   list_node_t* n =
       list_foreach(btm_sec_cb.sec_dev_rec, is_address_equal, (void*)&bd_addr);
-  if (n) return static_cast<tBTM_SEC_DEV_REC*>(list_node(n));
+  if (n) {
+    p_dev_rec = static_cast<tBTM_SEC_DEV_REC*>(list_node(n));
+    dev_rec_index.RememberAddress(bd_addr, p_dev_rec);
+    return p_dev_rec;
+  }
 
   return NULL;
 }
 
+void btm_dev_addresses_changed(void) { dev_rec_index.ForgetAddresses(); }
+
 static bool has_lenc_and_address_is_equal(void* data, void* context) {
   tBTM_SEC_DEV_REC* p_dev_rec = static_cast<tBTM_SEC_DEV_REC*>(data);
   if (!(p_dev_rec->sec_rec.ble_keys.key_type & BTM_LE_KEY_LENC)) return true;
@@ -663,6 +793,7 @@ tBTM_SEC_DEV_REC* btm_sec_allocate_dev_rec(void) {
 
   p_dev_rec =
       static_cast<tBTM_SEC_DEV_REC*>(osi_calloc(sizeof(tBTM_SEC_DEV_REC)));
+  dev_rec_index.Add(p_dev_rec);
   list_append(btm_sec_cb.sec_dev_rec, p_dev_rec);
 
   // Initialize defaults
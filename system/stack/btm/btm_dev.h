@@ -106,6 +106,19 @@ tBTM_SEC_DEV_REC* btm_find_dev_by_handle(uint16_t handle);
  ******************************************************************************/
 tBTM_SEC_DEV_REC* btm_find_dev(const RawAddress& bd_addr);
 
+/*******************************************************************************
+ *
+ * Function         btm_dev_addresses_changed
+ *
+ * Description      Called when the address or pseudo address of a record in
+ *                  the device database changed, so that the next lookups by
+ *                  address search the device database again
+ *
+ * Returns          none
+ *
+ ******************************************************************************/
+void btm_dev_addresses_changed(void);
+
 /*******************************************************************************
  *
  * Function         btm_find_dev_with_lenc
@@ -34,7 +34,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <cinttypes>
 #include <mutex>
+#include <unordered_map>
 
 #include "advertise_data_parser.h"
 #include "btif/include/btif_acl.h"
@@ -49,6 +52,7 @@
 #include "main/shim/entry.h"
 #include "main/shim/helpers.h"
 #include "main/shim/shim.h"
+#include "metrics/counter_registry.h"
 #include "neighbor_inquiry.h"
 #include "os/log.h"
 #include "osi/include/allocator.h"
@@ -70,6 +74,7 @@
 #include "stack/include/hcidefs.h"
 #include "stack/include/hcimsgs.h"
 #include "stack/include/inq_hci_link_interface.h"
+#include "stack/include/l2cap_acl_interface.h"
 #include "stack/include/main_thread.h"
 #include "types/bluetooth/uuid.h"
 #include "types/raw_address.h"
@@ -113,6 +118,25 @@ void btm_log_history_scan_mode(uint8_t scan_mode) {
 std::mutex inq_db_lock_;
 // Inquiry database
 tINQ_DB_ENT inq_db_[BTM_INQ_DB_SIZE];
+// In use entries of the inquiry database by address, guarded by inq_db_lock_
+std::unordered_map<RawAddress, tINQ_DB_ENT*> inq_db_index_;
+// Inquiry database statistics, guarded by inq_db_lock_
+tBTM_INQ_DB_STATS inq_db_stats_;
+
+void inq_db_index_remove(tINQ_DB_ENT* p_ent) {
+  auto it = inq_db_index_.find(p_ent->inq_info.results.remote_bd_addr);
+  if (it != inq_db_index_.end() && it->second == p_ent) inq_db_index_.erase(it);
+}
+
+void inq_db_index_rebuild() {
+  inq_db_index_.clear();
+  for (tINQ_DB_ENT& ent : inq_db_) {
+    if (ent.in_use) {
+      // The first entry of an address is the one that is found
+      inq_db_index_.emplace(ent.inq_info.results.remote_bd_addr, &ent);
+    }
+  }
+}
 
 // Inquiry bluetooth device database lock
 std::mutex bd_db_lock_;
@@ -179,6 +203,20 @@ using bluetooth::Uuid;
 #define PROPERTY_INQ_LENGTH "bluetooth.core.classic.inq_length"
 #endif
 
+/* Inquiry length used instead while a link has high priority traffic, e.g. an
+ * A2DP stream, to limit the time the controller takes from the stream */
+#define BTIF_DM_DEFAULT_INQ_STREAMING_DURATION 4
+
+#ifndef PROPERTY_INQ_LENGTH_STREAMING
+#define PROPERTY_INQ_LENGTH_STREAMING \
+  "bluetooth.core.classic.inq_length_streaming"
+#endif
+
+/* The inquiry ends once this many devices responded, 0 for no limit */
+#ifndef PROPERTY_INQ_MAX_RESPONSES
+#define PROPERTY_INQ_MAX_RESPONSES "bluetooth.core.classic.inq_max_responses"
+#endif
+
 /******************************************************************************/
 /*               L O C A L    D A T A    D E F I N I T I O N S                */
 /******************************************************************************/
@@ -596,6 +634,18 @@ void BTM_CancelInquiry(void) {
   }
 }
 
+/* Records how many devices an inquiry found per minute, to tune its length */
+static void btm_record_inquiry_yield(long long duration_ms,
+                                     unsigned long results) {
+  static auto* yield = bluetooth::metrics::CounterRegistry::Get().GetHistogram(
+      "btm.inquiry.results_per_minute");
+  if (duration_ms <= 0) {
+    return;
+  }
+  yield->Record(static_cast<uint64_t>(results) * 60000 /
+                static_cast<uint64_t>(duration_ms));
+}
+
 static void btm_classic_inquiry_timeout(UNUSED_ATTR void* data) {
   // When the Inquiry Complete event is received, the classic inquiry
   // will be marked as completed. Therefore, we only need to mark
@@ -720,14 +770,25 @@ tBTM_STATUS BTM_StartInquiry(tBTM_INQ_RESULTS_CB* p_results_cb,
     return BTM_WRONG_MODE;
   }
 
+  uint8_t inq_length = osi_property_get_int32(
+      PROPERTY_INQ_LENGTH, BTIF_DM_DEFAULT_INQ_MAX_DURATION);
+  const bool is_streaming = l2cu_get_num_hi_priority() > 0;
+  if (is_streaming) {
+    inq_length = std::min<uint8_t>(
+        inq_length,
+        osi_property_get_int32(PROPERTY_INQ_LENGTH_STREAMING,
+                               BTIF_DM_DEFAULT_INQ_STREAMING_DURATION));
+  }
+  const uint8_t max_responses =
+      osi_property_get_int32(PROPERTY_INQ_MAX_RESPONSES, 0);
+
   BTM_LogHistory(kBtmLogTag, RawAddress::kEmpty, "Classic inquiry started",
                  base::StringPrintf(
-                     "%s", (btm_cb.neighbor.classic_inquiry.start_time_ms == 0)
-                               ? ""
-                               : "ERROR Already in progress"));
-
-  const uint8_t inq_length = osi_property_get_int32(
-      PROPERTY_INQ_LENGTH, BTIF_DM_DEFAULT_INQ_MAX_DURATION);
+                     "length:%u max_responses:%u streaming:%c %s", inq_length,
+                     max_responses, is_streaming ? 'T' : 'F',
+                     (btm_cb.neighbor.classic_inquiry.start_time_ms == 0)
+                         ? ""
+                         : "ERROR Already in progress"));
 
   /* Save the inquiry parameters to be used upon the completion of
    * setting/clearing the inquiry filter */
@@ -777,7 +838,7 @@ tBTM_STATUS BTM_StartInquiry(tBTM_INQ_RESULTS_CB* p_results_cb,
   // TODO: Register for the inquiry interface and use that
   bluetooth::shim::GetHciLayer()->EnqueueCommand(
       bluetooth::hci::InquiryBuilder::Create(
-          lap, btm_cb.btm_inq_vars.inqparms.duration, 0),
+          lap, btm_cb.btm_inq_vars.inqparms.duration, max_responses),
       get_main_thread()->BindOnce(
           [](bluetooth::hci::CommandStatusView status_view) {
             ASSERT(status_view.IsValid());
@@ -993,8 +1054,10 @@ void btm_clear_all_pending_le_entry(void) {
      * response outstanding */
     if ((p_ent->in_use) &&
         (p_ent->inq_info.results.device_type == BT_DEVICE_TYPE_BLE) &&
-        !p_ent->scan_rsp)
+        !p_ent->scan_rsp) {
       p_ent->in_use = false;
+      inq_db_index_remove(p_ent);
+    }
   }
 }
 
@@ -1096,6 +1159,21 @@ void btm_inq_db_set_inq_by_rssi(void) {
   internal_.inq_by_rssi = osi_property_get_bool(PROPERTY_INQ_BY_RSSI, false);
 }
 
+tBTM_INQ_DB_STATS btm_inq_db_get_stats(void) {
+  std::lock_guard<std::mutex> lock(inq_db_lock_);
+  return inq_db_stats_;
+}
+
+void btm_inq_db_dump(int fd) {
+  std::lock_guard<std::mutex> lock(inq_db_lock_);
+  dprintf(fd,
+          "Inquiry database (BTM_INQ_DB_SIZE: %d) in_use: %zu evict_by: %s\n"
+          "  hits: %" PRIu64 " misses: %" PRIu64 " evictions: %" PRIu64 "\n",
+          BTM_INQ_DB_SIZE, inq_db_index_.size(),
+          internal_.inq_by_rssi ? "rssi" : "age", inq_db_stats_.hits,
+          inq_db_stats_.misses, inq_db_stats_.evictions);
+}
+
 /*******************************************************************************
  *
  * Function         btm_inq_stop_on_ssp
@@ -1176,6 +1254,11 @@ void btm_clr_inq_db(const RawAddress* p_bda) {
       }
     }
   }
+  if (p_bda == NULL) {
+    inq_db_index_.clear();
+  } else {
+    inq_db_index_.erase(*p_bda);
+  }
 #if (BTM_INQ_DEBUG == TRUE)
   log::verbose("inq_active:0x{:x} state:{}", btm_cb.btm_inq_vars.inq_active,
                btm_cb.btm_inq_vars.state);
@@ -1260,16 +1343,15 @@ bool btm_inq_find_bdaddr(const RawAddress& p_bda) {
  *
  ******************************************************************************/
 tINQ_DB_ENT* btm_inq_db_find(const RawAddress& p_bda) {
-  uint16_t xx;
   std::lock_guard<std::mutex> lock(inq_db_lock_);
-  tINQ_DB_ENT* p_ent = inq_db_;
-
-  for (xx = 0; xx < BTM_INQ_DB_SIZE; xx++, p_ent++) {
-    if (p_ent->in_use && p_ent->inq_info.results.remote_bd_addr == p_bda)
-      return (p_ent);
+  auto it = inq_db_index_.find(p_bda);
+  if (it != inq_db_index_.end()) {
+    inq_db_stats_.hits++;
+    return it->second;
   }
 
   /* If here, not found */
+  inq_db_stats_.misses++;
   return (NULL);
 }
 
@@ -1301,6 +1383,7 @@ tINQ_DB_ENT* btm_inq_db_new(const RawAddress& p_bda, bool is_ble) {
       memset(p_ent, 0, sizeof(tINQ_DB_ENT));
       p_ent->inq_info.results.remote_bd_addr = p_bda;
       p_ent->in_use = true;
+      inq_db_index_.emplace(p_bda, p_ent);
 
       return (p_ent);
     }
@@ -1319,10 +1402,13 @@ tINQ_DB_ENT* btm_inq_db_new(const RawAddress& p_bda, bool is_ble) {
   }
 
   /* If here, no free entry found. Return the oldest. */
+  inq_db_index_remove(p_old);
+  inq_db_stats_.evictions++;
 
   memset(p_old, 0, sizeof(tINQ_DB_ENT));
   p_old->inq_info.results.remote_bd_addr = p_bda;
   p_old->in_use = true;
+  inq_db_index_.emplace(p_bda, p_old);
 
   return (p_old);
 }
@@ -1791,6 +1877,8 @@ void btm_sort_inq_result(void) {
       }
     }
   }
+  // Entries moved
+  inq_db_index_rebuild();
 
   osi_free(p_tmp);
 }
@@ -1864,6 +1952,9 @@ void btm_process_inq_complete(tHCI_STATUS status, uint8_t mode) {
           .start_time_ms = btm_cb.neighbor.classic_inquiry.start_time_ms,
       });
       const auto end_time_ms = timestamper_in_milliseconds.GetTimestamp();
+      btm_record_inquiry_yield(
+          end_time_ms - btm_cb.neighbor.classic_inquiry.start_time_ms,
+          btm_cb.neighbor.classic_inquiry.results);
       BTM_LogHistory(
           kBtmLogTag, RawAddress::kEmpty, "Classic inquiry complete",
           base::StringPrintf(
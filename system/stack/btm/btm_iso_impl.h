@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <memory>
@@ -34,6 +35,7 @@
 #include "internal_include/stack_config.h"
 #include "main/shim/hci_layer.h"
 #include "os/log.h"
+#include "os/trace.h"
 #include "osi/include/allocator.h"
 #include "stack/include/bt_hdr.h"
 #include "stack/include/bt_types.h"
@@ -54,6 +56,10 @@ static constexpr uint8_t kStateFlagIsConnected = 0x02;
 static constexpr uint8_t kStateFlagHasDataPathSet = 0x04;
 static constexpr uint8_t kStateFlagIsBroadcast = 0x10;
 
+/* SDUs further apart than this many SDU intervals are a pause of the stream,
+ * not jitter */
+static constexpr uint32_t kSduGapIntervals = 4;
+
 constexpr char kBtmLogTag[] = "ISO";
 
 struct iso_sync_info {
@@ -83,8 +89,18 @@ struct iso_base {
     uint64_t evt_last_lost_us = 0;
   };
 
+  struct sdu_stats {
+    size_t sdu_count = 0;
+    size_t sdu_gap_count = 0;
+    uint64_t sdu_last_us = 0;
+    /* Deviation of the time between two SDUs from the SDU interval */
+    uint64_t sdu_jitter_total_us = 0;
+    uint64_t sdu_jitter_max_us = 0;
+  };
+
   credits_stats cr_stats;
   event_stats evt_stats;
+  sdu_stats tx_stats;
 };
 
 typedef iso_base iso_cis;
@@ -507,6 +523,24 @@ struct iso_impl {
                                    weak_factory_.GetWeakPtr()));
   }
 
+  static void update_sdu_stats(iso_base::sdu_stats& stats, uint32_t sdu_itv) {
+    uint64_t now_us = bluetooth::common::time_get_os_boottime_us();
+
+    if (stats.sdu_last_us > 0 && sdu_itv > 0) {
+      uint64_t delta_us = now_us - stats.sdu_last_us;
+      if (delta_us > static_cast<uint64_t>(sdu_itv) * kSduGapIntervals) {
+        stats.sdu_gap_count++;
+      } else {
+        uint64_t jitter_us =
+            (delta_us > sdu_itv) ? delta_us - sdu_itv : sdu_itv - delta_us;
+        stats.sdu_jitter_total_us += jitter_us;
+        stats.sdu_jitter_max_us = std::max(stats.sdu_jitter_max_us, jitter_us);
+      }
+    }
+    stats.sdu_last_us = now_us;
+    stats.sdu_count++;
+  }
+
   BT_HDR* prepare_hci_packet(uint16_t iso_handle, uint16_t seq_nb,
                              uint16_t data_len) {
     /* Add 2 for packet seq., 2 for length */
@@ -532,6 +566,7 @@ struct iso_impl {
 
   void send_iso_data(uint16_t iso_handle, const uint8_t* data,
                      uint16_t data_len) {
+    BT_TRACE_SCOPED_ID("ISO SDU TX", iso_handle);
     iso_base* iso = GetIsoIfKnown(iso_handle);
     LOG_ASSERT(iso != nullptr)
         << "No such iso connection handle: " << loghex(iso_handle);
@@ -554,6 +589,8 @@ struct iso_impl {
     uint16_t seq_nb = iso->sync_info.seq_nb;
     iso->sync_info.seq_nb = (seq_nb + 1) & 0xffff;
 
+    update_sdu_stats(iso->tx_stats, iso->sdu_itv);
+
     if (iso_credits_ == 0 || data_len > iso_buffer_size_) {
       iso->cr_stats.credits_underflow_bytes += data_len;
       iso->cr_stats.credits_underflow_count++;
@@ -569,6 +606,7 @@ struct iso_impl {
 
     iso_credits_--;
     iso->used_credits++;
+    BT_TRACE_COUNTER("ISO credits", iso_credits_.load());
 
     BT_HDR* packet = prepare_hci_packet(iso_handle, seq_nb, data_len);
     memcpy(packet->data + kIsoHeaderWithoutTsLen, data, data_len);
@@ -664,6 +702,8 @@ struct iso_impl {
 
     LOG_ASSERT(evt_len == num_handles * 4 + 1);
 
+    /* Credits of all the handles are returned at once */
+    uint32_t total_credits = 0;
     for (int i = 0; i < num_handles; i++) {
       uint16_t handle, num_sent;
 
@@ -673,17 +713,18 @@ struct iso_impl {
       auto iter = conn_hdl_to_cis_map_.find(handle);
       if (iter != conn_hdl_to_cis_map_.end()) {
         iter->second->used_credits -= num_sent;
-        iso_credits_ += num_sent;
+        total_credits += num_sent;
         continue;
       }
 
       iter = conn_hdl_to_bis_map_.find(handle);
       if (iter != conn_hdl_to_bis_map_.end()) {
         iter->second->used_credits -= num_sent;
-        iso_credits_ += num_sent;
+        total_credits += num_sent;
         continue;
       }
     }
+    iso_credits_ += total_credits;
   }
 
   void handle_gd_num_completed_pkts(uint16_t handle, uint16_t credits) {
@@ -948,6 +989,27 @@ struct iso_impl {
                  : 0llu));
   }
 
+  static void dump_sdu_stats(int fd, const iso_base::sdu_stats& stats) {
+    size_t jitter_samples = stats.sdu_count > stats.sdu_gap_count
+                                ? stats.sdu_count - stats.sdu_gap_count - 1
+                                : 0;
+
+    dprintf(fd, "        SDU Tx Stats:
+");
+    dprintf(fd, "          SDUs (count): %zu
+", stats.sdu_count);
+    dprintf(fd, "          Stream pauses (count): %zu
+", stats.sdu_gap_count);
+    dprintf(fd, "          Average jitter (us): %llu
+",
+            (jitter_samples > 0 ? (unsigned long long)stats.sdu_jitter_total_us /
+                                      jitter_samples
+                                : 0llu));
+    dprintf(fd, "          Max jitter (us): %llu
+",
+            (unsigned long long)stats.sdu_jitter_max_us);
+  }
+
   void dump(int fd) const {
     dprintf(fd, "  ----------------\n ");
     dprintf(fd, "  ISO Manager:\n");
@@ -967,6 +1029,7 @@ struct iso_impl {
               cis_pair.second->state_flags.load());
       dump_credits_stats(fd, cis_pair.second->cr_stats);
       dump_event_stats(fd, cis_pair.second->evt_stats);
+      dump_sdu_stats(fd, cis_pair.second->tx_stats);
     }
     dprintf(fd, "    BISes:\n");
     for (auto const& cis_pair : conn_hdl_to_bis_map_) {
@@ -979,6 +1042,7 @@ struct iso_impl {
               cis_pair.second->state_flags.load());
       dump_credits_stats(fd, cis_pair.second->cr_stats);
       dump_event_stats(fd, cis_pair.second->evt_stats);
+      dump_sdu_stats(fd, cis_pair.second->tx_stats);
     }
     dprintf(fd, "  ----------------\n ");
   }
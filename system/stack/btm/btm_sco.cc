@@ -339,6 +339,16 @@ static void btm_route_sco_data(bluetooth::hci::ScoView valid_packet) {
   const auto codec_type = active_sco->get_codec_type();
   const std::string codec = sco_codec_type_text(codec_type);
 
+  const bool is_lc3 = codec_type == BTM_SCO_CODEC_LC3;
+  auto enqueue_packet = is_lc3 ? &bluetooth::audio::sco::swb::enqueue_packet
+                               : &bluetooth::audio::sco::wbs::enqueue_packet;
+  auto decode = is_lc3 ? &bluetooth::audio::sco::swb::decode
+                       : &bluetooth::audio::sco::wbs::decode;
+  auto encode = is_lc3 ? &bluetooth::audio::sco::swb::encode
+                       : &bluetooth::audio::sco::wbs::encode;
+  auto dequeue_packet = is_lc3 ? &bluetooth::audio::sco::swb::dequeue_packet
+                               : &bluetooth::audio::sco::wbs::dequeue_packet;
+
   auto data = valid_packet.GetData();
   auto rx_data = data.data();
   const uint8_t* decoded = nullptr;
@@ -350,17 +360,11 @@ static void btm_route_sco_data(bluetooth::hci::ScoView valid_packet) {
       log::debug("{} packet corrupted with status({})", codec.c_str(),
                  PacketStatusFlagText(status).c_str());
     }
-    auto enqueue_packet = codec_type == BTM_SCO_CODEC_LC3
-                              ? &bluetooth::audio::sco::swb::enqueue_packet
-                              : &bluetooth::audio::sco::wbs::enqueue_packet;
     rc = enqueue_packet(
         data, status != bluetooth::hci::PacketStatusFlag::CORRECTLY_RECEIVED);
     if (!rc) log::debug("Failed to enqueue {} packet", codec.c_str());
 
     while (rc) {
-      auto decode = codec_type == BTM_SCO_CODEC_LC3
-                        ? &bluetooth::audio::sco::swb::decode
-                        : &bluetooth::audio::sco::wbs::decode;
       rc = decode(&decoded);
       if (rc == 0) break;
 
@@ -418,13 +422,22 @@ static void btm_route_sco_data(bluetooth::hci::ScoView valid_packet) {
 
       btm_pcm_buf_write_offset += read;
 
-      auto encode = codec_type == BTM_SCO_CODEC_LC3
-                        ? &bluetooth::audio::sco::swb::encode
-                        : &bluetooth::audio::sco::wbs::encode;
-      rc = encode(&btm_pcm_buf[btm_pcm_buf_read_offset / sizeof(*btm_pcm_buf)],
-                  btm_pcm_buf_write_offset - btm_pcm_buf_read_offset);
+      /* Encode all of the complete frames buffered after this read at once,
+       * and send the SCO packets as soon as they are queued so that the
+       * encode buffer can take the next frame of the batch. */
+      size_t num_encoded = 0;
+      while ((rc = encode(
+                  &btm_pcm_buf[btm_pcm_buf_read_offset / sizeof(*btm_pcm_buf)],
+                  btm_pcm_buf_write_offset - btm_pcm_buf_read_offset)) != 0) {
+        btm_pcm_buf_read_offset += rc;
+        num_encoded++;
+
+        while ((rc = dequeue_packet(&encoded)) != 0) {
+          btm_send_sco_packet(std::vector<uint8_t>(encoded, encoded + rc));
+        }
+      }
 
-      if (!rc)
+      if (!num_encoded)
         log::debug(
             "Failed to encode {} data starting at ReadOffset:{} to "
             "WriteOffset:{}",
@@ -434,23 +447,10 @@ static void btm_route_sco_data(bluetooth::hci::ScoView valid_packet) {
       /* The offsets should reset some time as the buffer length should always
        * divisible by 480 and `encode` only returns 480(LC3), 240(MSBC), or 0.
        */
-      btm_pcm_buf_read_offset += rc;
       if (btm_pcm_buf_write_offset == btm_pcm_buf_read_offset) {
         btm_pcm_buf_write_offset = 0;
         btm_pcm_buf_read_offset = 0;
       }
-
-      /* Send all of the available SCO packets buffered in the queue */
-      while (1) {
-        auto dequeue_packet = codec_type == BTM_SCO_CODEC_LC3
-                                  ? &bluetooth::audio::sco::swb::dequeue_packet
-                                  : &bluetooth::audio::sco::wbs::dequeue_packet;
-        rc = dequeue_packet(&encoded);
-        if (!rc) break;
-
-        auto data = std::vector<uint8_t>(encoded, encoded + rc);
-        btm_send_sco_packet(std::move(data));
-      }
     }
   } else {
     while (written) {
@@ -958,10 +958,21 @@ struct tBTM_LC3_INFO {
   }
 
   size_t write(const std::vector<uint8_t>& input) {
-    if (input.size() > buf_size - decode_buf_wo) {
+    if (input.size() > buf_size - decodable()) {
       return 0;
     }
 
+    /* Skipped bytes ahead of a frame head leave the offsets unaligned with the
+     * packet size, so they never meet again to be reset. Move the remaining
+     * data to the front of the buffer instead of rejecting all the following
+     * packets. */
+    if (input.size() > buf_size - decode_buf_wo) {
+      std::copy(lc3_decode_buf + decode_buf_ro, lc3_decode_buf + decode_buf_wo,
+                lc3_decode_buf);
+      decode_buf_wo -= decode_buf_ro;
+      decode_buf_ro = 0;
+    }
+
     std::copy(input.begin(), input.end(), lc3_decode_buf + decode_buf_wo);
     decode_buf_wo += input.size();
     return input.size();
@@ -31,6 +31,7 @@
 #include <base/strings/stringprintf.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
@@ -161,6 +162,15 @@ static void NotifyBondingChange(tBTM_SEC_DEV_REC& p_dev_rec,
   }
 }
 
+/* Number of outgoing bond requests that may wait for the current pairing to
+ * finish, instead of being rejected with BTM_WRONG_MODE */
+static size_t btm_sec_max_pending_bonds() {
+  static const size_t sMaxPendingBonds = std::max(
+      0, osi_property_get_int32("bluetooth.btm.sec.max_pending_bonds.value",
+                                0));
+  return sMaxPendingBonds;
+}
+
 static bool concurrentPeerAuthIsEnabled() {
   // Was previously named BTM_DISABLE_CONCURRENT_PEER_AUTH.
   // Renamed to ENABLED for homogeneity with system properties
@@ -714,6 +724,22 @@ tBTM_STATUS btm_sec_bond_by_transport(const RawAddress& bd_addr,
 
   /* Other security process is in progress */
   if (btm_sec_cb.pairing_state != BTM_PAIR_STATE_IDLE) {
+    if (btm_sec_cb.pairing_bda != bd_addr &&
+        btm_sec_cb.pending_bonds.size() < btm_sec_max_pending_bonds() &&
+        btm_find_or_alloc_dev(bd_addr) != nullptr) {
+      for (const auto& pending : btm_sec_cb.pending_bonds) {
+        if (pending.bd_addr == bd_addr) {
+          log::warn("BTM_SecBond: bond already pending");
+          return (BTM_CMD_STARTED);
+        }
+      }
+      log::info("BTM_SecBond: busy in state: {}, queueing bond request",
+                tBTM_SEC_CB::btm_pair_state_descr(btm_sec_cb.pairing_state));
+      btm_sec_cb.pending_bonds.push_back({bd_addr, addr_type, transport});
+      BTM_LogHistory(kBtmLogTag, bd_addr, "Bonding queued",
+                     bt_transport_text(transport));
+      return (BTM_CMD_STARTED);
+    }
     log::error("BTM_SecBond: already busy in state: {}",
                tBTM_SEC_CB::btm_pair_state_descr(btm_sec_cb.pairing_state));
     return (BTM_WRONG_MODE);
@@ -849,6 +875,38 @@ tBTM_STATUS btm_sec_bond_by_transport(const RawAddress& bd_addr,
   return status;
 }
 
+/*******************************************************************************
+ *
+ * Function         btm_sec_start_pending_bond
+ *
+ * Description      Start the oldest bond request queued while another device
+ *                  was pairing, once the pairing state is back to idle.
+ *                  A request that cannot be started is reported to the
+ *                  application as a failed bond.
+ *
+ ******************************************************************************/
+static void btm_sec_start_pending_bond() {
+  while (!btm_sec_cb.pending_bonds.empty() &&
+         btm_sec_cb.pairing_state == BTM_PAIR_STATE_IDLE) {
+    tBTM_SEC_CB::tBTM_PENDING_BOND pending =
+        btm_sec_cb.pending_bonds.front();
+    btm_sec_cb.pending_bonds.pop_front();
+
+    log::info("Starting queued bond bd_addr={}",
+              ADDRESS_TO_LOGGABLE_CSTR(pending.bd_addr));
+    tBTM_STATUS status = btm_sec_bond_by_transport(
+        pending.bd_addr, pending.addr_type, pending.transport);
+    if (status == BTM_CMD_STARTED) return;
+
+    tBTM_SEC_DEV_REC* p_dev_rec = btm_find_dev(pending.bd_addr);
+    if (p_dev_rec != nullptr) {
+      NotifyBondingChange(*p_dev_rec, (status == BTM_SUCCESS)
+                                          ? HCI_SUCCESS
+                                          : HCI_ERR_UNSPECIFIED);
+    }
+  }
+}
+
 /*******************************************************************************
  *
  * Function         BTM_SecBond
@@ -906,6 +964,18 @@ tBTM_STATUS BTM_SecBondCancel(const RawAddress& bd_addr) {
                tBTM_SEC_CB::btm_pair_state_descr(btm_sec_cb.pairing_state),
                btm_sec_cb.pairing_flags);
   p_dev_rec = btm_find_dev(bd_addr);
+  if (p_dev_rec != nullptr) {
+    for (auto it = btm_sec_cb.pending_bonds.begin();
+         it != btm_sec_cb.pending_bonds.end(); it++) {
+      if (it->bd_addr == bd_addr) {
+        log::verbose("Cancel queued bond");
+        btm_sec_cb.pending_bonds.erase(it);
+        NotifyBondingChange(*p_dev_rec, HCI_ERR_UNSPECIFIED);
+        return BTM_SUCCESS;
+      }
+    }
+  }
+
   if (!p_dev_rec || btm_sec_cb.pairing_bda != bd_addr) {
     return BTM_UNKNOWN_ADDR;
   }
@@ -4901,6 +4971,12 @@ void tBTM_SEC_CB::change_pairing_state(tBTM_PAIRING_STATE new_state) {
     btm_inq_clear_ssp();
 
     pairing_bda = RawAddress::kAny;
+
+    /* Started from the main loop, as the caller is still tearing down the
+     * previous pairing */
+    if (!pending_bonds.empty()) {
+      do_in_main_thread(FROM_HERE, base::BindOnce(btm_sec_start_pending_bond));
+    }
   } else {
     /* If transitioning out of idle, mark the lcb as bonding */
     if (old_state == BTM_PAIR_STATE_IDLE)
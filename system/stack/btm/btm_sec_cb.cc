@@ -64,6 +64,7 @@ void tBTM_SEC_CB::Init(uint8_t initial_security_mode) {
 void tBTM_SEC_CB::Free() {
   fixed_queue_free(sec_pending_q, nullptr);
   sec_pending_q = nullptr;
+  pending_bonds.clear();
 
   list_free(sec_dev_rec);
   sec_dev_rec = nullptr;
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <deque>
 
 #include "internal_include/bt_target.h"
 #include "osi/include/alarm.h"
@@ -27,6 +28,8 @@
 #include "stack/btm/security_device_record.h"
 #include "stack/include/bt_octets.h"
 #include "stack/include/security_client_callbacks.h"
+#include "types/ble_address_with_type.h"
+#include "types/bt_transport.h"
 #include "types/raw_address.h"
 
 class tBTM_SEC_CB {
@@ -76,6 +79,15 @@ class tBTM_SEC_CB {
   fixed_queue_t* sec_pending_q{nullptr}; /* pending sequrity requests in
                                             tBTM_SEC_QUEUE_ENTRY format */
 
+  /* Outgoing bond requests made while another device was pairing, started in
+   * order each time the pairing state returns to idle */
+  struct tBTM_PENDING_BOND {
+    RawAddress bd_addr;
+    tBLE_ADDR_TYPE addr_type;
+    tBT_TRANSPORT transport;
+  };
+  std::deque<tBTM_PENDING_BOND> pending_bonds;
+
   tBTM_SEC_SERV_REC sec_serv_rec[BTM_SEC_MAX_SERVICE_RECORDS];
 
   DEV_CLASS connecting_dc;
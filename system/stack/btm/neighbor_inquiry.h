@@ -309,8 +309,17 @@ struct tBTM_INQUIRY_VAR_ST {
   }
 };
 
+/* Lookups and evictions of the inquiry database since startup */
+typedef struct {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+} tBTM_INQ_DB_STATS;
+
 bool btm_inq_find_bdaddr(const RawAddress& p_bda);
 tINQ_DB_ENT* btm_inq_db_find(const RawAddress& p_bda);
+tBTM_INQ_DB_STATS btm_inq_db_get_stats(void);
+void btm_inq_db_dump(int fd);
 
 namespace fmt {
 template <>
@@ -26,17 +26,115 @@
 #include <base/threading/thread.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "common/message_loop_thread.h"
 #include "include/hardware/bluetooth.h"
+#include "os/alarm.h"
+#include "os/handler.h"
 #include "os/log.h"
+#include "os/thread.h"
+#include "osi/include/allocator.h"
+#include "osi/include/properties.h"
 
 using bluetooth::common::MessageLoopThread;
 using namespace bluetooth;
 
+static constexpr char kPropertyAllocatorPoolEnabled[] =
+    "bluetooth.osi.allocator_pool.enabled";
+static constexpr char kPropertyAllocatorTaggingEnabled[] =
+    "bluetooth.osi.allocator_tagging.enabled";
+static constexpr char kPropertyMergedMainThreadEnabled[] =
+    "bluetooth.core.merged_main_thread.enabled";
+
+namespace {
+
+// Reactor thread that hosts the main thread message loop when the main thread
+// is merged with the gd stack thread. Delayed tasks are held here until they
+// are due, as os::Handler has no delayed post.
+class MergedMainThread {
+ public:
+  MergedMainThread()
+      : thread_("bt_main_thread", os::Thread::Priority::REAL_TIME),
+        handler_(&thread_),
+        alarm_(&handler_, os::AlarmClass::CRITICAL) {}
+
+  ~MergedMainThread() {
+    alarm_.Cancel();
+    handler_.Clear();
+    thread_.Stop();
+  }
+
+  os::Thread* GetThread() { return &thread_; }
+
+  void Post(base::OnceClosure task, std::chrono::microseconds delay) {
+    if (delay.count() <= 0) {
+      handler_.Post(std::move(task));
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto deadline = std::chrono::steady_clock::now() + delay;
+    bool earliest = delayed_tasks_.empty() ||
+                    deadline < delayed_tasks_.begin()->first;
+    delayed_tasks_.emplace(deadline, std::move(task));
+    if (earliest) {
+      ScheduleAlarmLocked();
+    }
+  }
+
+ private:
+  void ScheduleAlarmLocked() {
+    auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+        delayed_tasks_.begin()->first - std::chrono::steady_clock::now());
+    // A zero delay would disarm the alarm
+    alarm_.Schedule(base::BindOnce(&MergedMainThread::OnAlarm,
+                                   base::Unretained(this)),
+                    std::max(delay, std::chrono::milliseconds(1)));
+  }
+
+  void OnAlarm() {
+    std::vector<base::OnceClosure> ready_tasks;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto now = std::chrono::steady_clock::now();
+      while (!delayed_tasks_.empty() &&
+             delayed_tasks_.begin()->first <= now) {
+        ready_tasks.push_back(std::move(delayed_tasks_.begin()->second));
+        delayed_tasks_.erase(delayed_tasks_.begin());
+      }
+      if (!delayed_tasks_.empty()) {
+        ScheduleAlarmLocked();
+      }
+    }
+    for (auto& task : ready_tasks) {
+      std::move(task).Run();
+    }
+  }
+
+  os::Thread thread_;
+  os::Handler handler_;
+  os::Alarm alarm_;
+  std::mutex mutex_;
+  std::multimap<std::chrono::steady_clock::time_point, base::OnceClosure>
+      delayed_tasks_;
+};
+
+}  // namespace
+
 static MessageLoopThread main_thread("bt_main_thread");
+static MergedMainThread* merged_main_thread = nullptr;
 
 bluetooth::common::MessageLoopThread* get_main_thread() { return &main_thread; }
 
+bluetooth::os::Thread* get_merged_main_thread() {
+  return merged_main_thread != nullptr ? merged_main_thread->GetThread()
+                                       : nullptr;
+}
+
 bt_status_t do_in_main_thread(const base::Location& from_here,
                               base::OnceClosure task) {
   if (!main_thread.DoInThread(from_here, std::move(task))) {
@@ -65,11 +163,31 @@ void post_on_bt_main(BtMainClosure closure) {
 }
 
 void main_thread_start_up() {
-  main_thread.StartUp();
+  if (osi_property_get_bool(kPropertyAllocatorPoolEnabled, false)) {
+    osi_allocator_pool_enable();
+  }
+  if (osi_property_get_bool(kPropertyAllocatorTaggingEnabled, false)) {
+    osi_allocator_tagging_enable();
+  }
+  if (osi_property_get_bool(kPropertyMergedMainThreadEnabled, false)) {
+    // The gd stack runs its modules on this thread too, see
+    // get_merged_main_thread()
+    merged_main_thread = new MergedMainThread();
+    main_thread.StartUpOn(
+        [](base::OnceClosure task, std::chrono::microseconds delay) {
+          merged_main_thread->Post(std::move(task), delay);
+        });
+  } else {
+    main_thread.StartUp();
+  }
   if (!main_thread.IsRunning()) {
     log::fatal("unable to start btu message loop thread.");
   }
-  if (!main_thread.EnableRealTimeScheduling()) {
+  main_thread.DoInThread(FROM_HERE,
+                         base::BindOnce(&osi_allocator_thread_cache_enable));
+  // The reactor thread of a merged main thread is already real time
+  if (merged_main_thread == nullptr &&
+      !main_thread.EnableRealTimeScheduling()) {
 #if defined(__ANDROID__)
     log::fatal("unable to enable real time scheduling");
 #else
@@ -78,4 +196,8 @@ void main_thread_start_up() {
   }
 }
 
-void main_thread_shut_down() { main_thread.ShutDown(); }
+void main_thread_shut_down() {
+  main_thread.ShutDown();
+  delete merged_main_thread;
+  merged_main_thread = nullptr;
+}
@@ -207,6 +207,10 @@ void EattExtension::StopAppIndicationTimer(const RawAddress& bd_addr,
   pimpl_->eatt_impl_->stop_app_indication_timer(bd_addr, cid);
 }
 
+void EattExtension::Dump(int fd) {
+  if (pimpl_->IsRunning()) pimpl_->eatt_impl_->dump(fd);
+}
+
 void EattExtension::Start() { pimpl_->Start(); }
 
 void EattExtension::Stop() { pimpl_->Stop(); }
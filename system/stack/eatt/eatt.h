@@ -58,6 +58,12 @@ class EattChannel {
   alarm_t* ind_confirmation_timer_;
   /* GATT client command queue */
   std::deque<tGATT_CMD_Q> cl_cmd_q_;
+  /* Number of GATT client requests routed to this channel */
+  uint64_t client_request_count_;
+  /* Number of ATT PDUs received on this channel */
+  uint64_t rx_pdu_count_;
+  /* Value of client_request_count_ + rx_pdu_count_ at the last idle check */
+  uint64_t activity_at_last_check_;
 
   EattChannel(RawAddress& bda, uint16_t cid, uint16_t tx_mtu, uint16_t rx_mtu)
       : bda_(bda),
@@ -66,7 +72,10 @@ class EattChannel {
         state_(EattChannelState::EATT_CHANNEL_PENDING),
         indicate_handle_(0),
         ind_ack_timer_(NULL),
-        ind_confirmation_timer_(NULL) {
+        ind_confirmation_timer_(NULL),
+        client_request_count_(0),
+        rx_pdu_count_(0),
+        activity_at_last_check_(0) {
     cl_cmd_q_ = std::deque<tGATT_CMD_Q>();
     EattChannelSetTxMTU(tx_mtu);
   }
@@ -278,6 +287,14 @@ class EattExtension {
    */
   virtual void StopAppIndicationTimer(const RawAddress& bd_addr, uint16_t cid);
 
+  /**
+   * Print the EATT channels of every device and their utilization into
+   * dumpsys.
+   *
+   * @param fd file descriptor to write to
+   */
+  virtual void Dump(int fd);
+
   /**
    * Starts the EattExtension module
    */
@@ -18,6 +18,8 @@
 #include <base/logging.h>
 #include <bluetooth/log.h>
 
+#include <inttypes.h>
+
 #include <map>
 #include <vector>
 
@@ -30,6 +32,7 @@
 #include "os/log.h"
 #include "osi/include/alarm.h"
 #include "osi/include/allocator.h"
+#include "osi/include/properties.h"
 #include "stack/btm/btm_sec.h"
 #include "stack/gatt/gatt_int.h"
 #include "stack/include/bt_hdr.h"
@@ -42,6 +45,12 @@ namespace eatt {
 
 #define BLE_GATT_SVR_SUP_FEAT_EATT_BITMASK 0x01
 
+/* With adaptive bearers, channels opened on connection. More are opened while
+ * every channel is busy, up to L2CAP_CREDIT_BASED_MAX_CIDS */
+#define EATT_ADAPTIVE_INITIAL_CHANNELS 1
+/* Period after which a channel without any traffic is closed again */
+#define EATT_IDLE_BEARER_TIMEOUT_MS (10 * 1000)
+
 class eatt_device {
  public:
   RawAddress bda_;
@@ -52,8 +61,19 @@ class eatt_device {
 
   std::map<uint16_t, std::shared_ptr<EattChannel>> eatt_channels;
   bool collision;
+  /* Channels opened because all others were busy, and closed when idle */
+  uint32_t bearers_opened_on_demand_;
+  uint32_t bearers_closed_idle_;
+  /* Client requests sent on the unenhanced bearer for lack of free channel */
+  uint64_t requests_on_att_bearer_;
   eatt_device(const RawAddress& bd_addr, uint16_t mtu, uint16_t mps)
-      : rx_mtu_(mtu), rx_mps_(mps), eatt_tcb_(nullptr), collision(false) {
+      : rx_mtu_(mtu),
+        rx_mps_(mps),
+        eatt_tcb_(nullptr),
+        collision(false),
+        bearers_opened_on_demand_(0),
+        bearers_closed_idle_(0),
+        requests_on_att_bearer_(0) {
     bda_ = bd_addr;
   }
 };
@@ -64,6 +84,8 @@ struct eatt_impl {
   uint16_t default_mtu_;
   uint16_t max_mps_;
   tL2CAP_APPL_INFO reg_info_;
+  /* Closes idle channels opened on demand, see EATT_IDLE_BEARER_TIMEOUT_MS */
+  alarm_t* idle_bearer_timer_;
 
   base::WeakPtrFactory<eatt_impl> weak_factory_{this};
 
@@ -71,9 +93,16 @@ struct eatt_impl {
     default_mtu_ = EATT_DEFAULT_MTU;
     max_mps_ = EATT_MIN_MTU_MPS;
     psm_ = BT_PSM_EATT;
+    idle_bearer_timer_ = alarm_new("eatt_idle_bearer_timer");
   };
 
-  ~eatt_impl() = default;
+  ~eatt_impl() { alarm_free(idle_bearer_timer_); }
+
+  static bool is_adaptive_bearers_enabled() {
+    static const bool enabled = osi_property_get_bool(
+        "bluetooth.core.gatt.eatt.adaptive_bearers_enabled", false);
+    return enabled;
+  }
 
   eatt_device* find_device_by_cid(uint16_t lcid) {
     /* This works only because Android CIDs are unique across the ACL
@@ -524,6 +553,7 @@ struct eatt_impl {
       return;
     }
 
+    channel->rx_pdu_count_++;
     gatt_data_process(*eatt_dev->eatt_tcb_, channel->cid_, data_p);
     osi_free(data_p);
   }
@@ -557,6 +587,11 @@ struct eatt_impl {
       return;
     }
 
+    if (is_adaptive_bearers_enabled()) {
+      connect_eatt(eatt_dev, EATT_ADAPTIVE_INITIAL_CHANNELS);
+      return;
+    }
+
     connect_eatt(eatt_dev);
   }
 
@@ -668,15 +703,100 @@ struct eatt_impl {
     eatt_device* eatt_dev = find_device_by_address(bd_addr);
     if (!eatt_dev) return nullptr;
 
-    auto iter = find_if(
-        eatt_dev->eatt_channels.begin(), eatt_dev->eatt_channels.end(),
-        [](const std::pair<uint16_t, std::shared_ptr<EattChannel>>& el) {
-          return el.second->state_ == EattChannelState::EATT_CHANNEL_OPENED &&
-                 el.second->cl_cmd_q_.empty();
-        });
+    /* Among the channels without an outstanding request, prefer the one with
+     * the largest ATT MTU, so long reads and writes need fewer round trips */
+    EattChannel* best = nullptr;
+    for (const std::pair<uint16_t, std::shared_ptr<EattChannel>>& el :
+         eatt_dev->eatt_channels) {
+      EattChannel* channel = el.second.get();
+      if (channel->state_ != EattChannelState::EATT_CHANNEL_OPENED ||
+          !channel->cl_cmd_q_.empty())
+        continue;
 
-    return (iter == eatt_dev->eatt_channels.end()) ? nullptr
-                                                   : iter->second.get();
+      if (best == nullptr ||
+          std::min(channel->tx_mtu_, channel->rx_mtu_) >
+              std::min(best->tx_mtu_, best->rx_mtu_))
+        best = channel;
+    }
+
+    if (best == nullptr) {
+      eatt_dev->requests_on_att_bearer_++;
+      if (is_adaptive_bearers_enabled()) open_bearer_on_demand(eatt_dev);
+      return nullptr;
+    }
+
+    best->client_request_count_++;
+    return best;
+  }
+
+  /* Every channel is busy, open one more unless one is already on its way */
+  void open_bearer_on_demand(eatt_device* eatt_dev) {
+    if (eatt_dev->eatt_tcb_ == nullptr ||
+        eatt_dev->eatt_channels.size() >= L2CAP_CREDIT_BASED_MAX_CIDS ||
+        is_channel_connection_pending(eatt_dev))
+      return;
+
+    /* Only the central opens EATT channels, see supported_features_cb */
+    if (L2CA_GetBleConnRole(eatt_dev->bda_) != HCI_ROLE_CENTRAL) return;
+
+    log::info("All {} channels busy for {}, opening one more",
+              eatt_dev->eatt_channels.size(),
+              ADDRESS_TO_LOGGABLE_STR(eatt_dev->bda_));
+    connect_eatt(eatt_dev, 1);
+    eatt_dev->bearers_opened_on_demand_++;
+
+    if (!alarm_is_scheduled(idle_bearer_timer_)) {
+      alarm_set_on_mloop(idle_bearer_timer_, EATT_IDLE_BEARER_TIMEOUT_MS,
+                         idle_bearer_timeout, this);
+    }
+  }
+
+  static void idle_bearer_timeout(void* data) {
+    static_cast<eatt_impl*>(data)->close_idle_bearers();
+  }
+
+  /* Close at most one channel without traffic since the last check on each
+   * device that has more than the initial number of channels */
+  void close_idle_bearers() {
+    bool above_initial = false;
+
+    for (eatt_device& eatt_dev : devices_) {
+      EattChannel* idle = nullptr;
+      for (const std::pair<uint16_t, std::shared_ptr<EattChannel>>& el :
+           eatt_dev.eatt_channels) {
+        EattChannel* channel = el.second.get();
+        uint64_t activity =
+            channel->client_request_count_ + channel->rx_pdu_count_;
+        if (idle == nullptr &&
+            channel->state_ == EattChannelState::EATT_CHANNEL_OPENED &&
+            activity == channel->activity_at_last_check_ &&
+            channel->cl_cmd_q_.empty() &&
+            !GATT_HANDLE_IS_VALID(channel->indicate_handle_))
+          idle = channel;
+        channel->activity_at_last_check_ = activity;
+      }
+
+      if (eatt_dev.eatt_channels.size() <= EATT_ADAPTIVE_INITIAL_CHANNELS)
+        continue;
+
+      if (idle != nullptr) {
+        uint16_t cid = idle->cid_;
+        log::info("Closing idle channel {} for {}", loghex(cid),
+                  ADDRESS_TO_LOGGABLE_STR(eatt_dev.bda_));
+        disconnect_channel(cid);
+        eatt_dev.eatt_tcb_->eatt--;
+        remove_channel_by_cid(&eatt_dev, cid);
+        eatt_dev.bearers_closed_idle_++;
+      }
+
+      if (eatt_dev.eatt_channels.size() > EATT_ADAPTIVE_INITIAL_CHANNELS)
+        above_initial = true;
+    }
+
+    if (above_initial) {
+      alarm_set_on_mloop(idle_bearer_timer_, EATT_IDLE_BEARER_TIMEOUT_MS,
+                         idle_bearer_timeout, this);
+    }
   }
 
   void free_gatt_resources(const RawAddress& bd_addr) {
@@ -1031,6 +1151,30 @@ struct eatt_impl {
 
     if (!eatt_dev) add_eatt_device(bd_addr);
   }
+
+  void dump(int fd) {
+    dprintf(fd, "EATT (adaptive bearers: %s) devices: %zu\n",
+            is_adaptive_bearers_enabled() ? "enabled" : "disabled",
+            devices_.size());
+    for (const eatt_device& eatt_dev : devices_) {
+      dprintf(fd,
+              "  %s channels: %zu opened on demand: %u closed idle: %u "
+              "requests on ATT bearer: %" PRIu64 "\n",
+              ADDRESS_TO_LOGGABLE_CSTR(eatt_dev.bda_),
+              eatt_dev.eatt_channels.size(), eatt_dev.bearers_opened_on_demand_,
+              eatt_dev.bearers_closed_idle_, eatt_dev.requests_on_att_bearer_);
+      for (const std::pair<uint16_t, std::shared_ptr<EattChannel>>& el :
+           eatt_dev.eatt_channels) {
+        const EattChannel* channel = el.second.get();
+        dprintf(fd,
+                "    cid: 0x%04x state: %d mtu: %u/%u queued: %zu "
+                "client requests: %" PRIu64 " rx pdus: %" PRIu64 "\n",
+                channel->cid_, static_cast<int>(channel->state_),
+                channel->tx_mtu_, channel->rx_mtu_, channel->cl_cmd_q_.size(),
+                channel->client_request_count_, channel->rx_pdu_count_);
+      }
+    }
+  }
 };
 
 }  // namespace eatt
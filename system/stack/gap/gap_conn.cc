@@ -93,6 +93,8 @@ static void gap_config_cfm(uint16_t l2cap_cid, uint16_t result,
                            tL2CAP_CFG_INFO* p_cfg);
 static void gap_disconnect_ind(uint16_t l2cap_cid, bool ack_needed);
 static void gap_data_ind(uint16_t l2cap_cid, BT_HDR* p_msg);
+static void gap_segmented_data_ind(uint16_t l2cap_cid,
+                                   fixed_queue_t* p_segments);
 static void gap_congestion_ind(uint16_t lcid, bool is_congested);
 static void gap_tx_complete_ind(uint16_t l2cap_cid, uint16_t sdu_sent);
 static void gap_on_l2cap_error(uint16_t l2cap_cid, uint16_t result);
@@ -122,6 +124,7 @@ void gap_conn_init(void) {
   conn.reg_info.pL2CA_ConfigCfm_Cb = gap_config_cfm;
   conn.reg_info.pL2CA_DisconnectInd_Cb = gap_disconnect_ind;
   conn.reg_info.pL2CA_DataInd_Cb = gap_data_ind;
+  conn.reg_info.pL2CA_SegmentedDataInd_Cb = gap_segmented_data_ind;
   conn.reg_info.pL2CA_CongestionStatus_Cb = gap_congestion_ind;
   conn.reg_info.pL2CA_TxComplete_Cb = gap_tx_complete_ind;
   conn.reg_info.pL2CA_Error_Cb = gap_on_l2cap_error;
@@ -835,6 +838,34 @@ static void gap_data_ind(uint16_t l2cap_cid, BT_HDR* p_msg) {
   }
 }
 
+/*******************************************************************************
+ *
+ * Function         gap_segmented_data_ind
+ *
+ * Description      This is a callback function called by L2CAP when
+ *                  an SDU received in segments is complete. The segments are
+ *                  queued as they are, GAP_ConnReadData reads across buffers.
+ *
+ ******************************************************************************/
+static void gap_segmented_data_ind(uint16_t l2cap_cid,
+                                   fixed_queue_t* p_segments) {
+  /* Find CCB based on CID */
+  tGAP_CCB* p_ccb = gap_find_ccb_by_cid(l2cap_cid);
+  if (p_ccb == NULL || p_ccb->con_state != GAP_CCB_STATE_CONNECTED) {
+    /* L2CAP frees the segments left in the queue */
+    return;
+  }
+
+  while (!fixed_queue_is_empty(p_segments)) {
+    BT_HDR* p_msg = static_cast<BT_HDR*>(fixed_queue_try_dequeue(p_segments));
+    fixed_queue_enqueue(p_ccb->rx_queue, p_msg);
+    p_ccb->rx_queue_size += p_msg->len;
+  }
+
+  /* Signal the SDU once, when all of it can be read */
+  p_ccb->p_callback(p_ccb->gap_handle, GAP_EVT_CONN_DATA_AVAIL, nullptr);
+}
+
 /*******************************************************************************
  *
  * Function         gap_congestion_ind
@@ -24,10 +24,15 @@
 #include <base/logging.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
+#include <cinttypes>
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
+#include "common/time_util.h"
+#include "device/include/controller.h"
 #include "internal_include/bt_trace.h"
 #include "main/shim/le_scanning_manager.h"
 #include "os/log.h"
@@ -42,6 +47,15 @@
 
 #define DIRECT_CONNECT_TIMEOUT (30 * 1000) /* 30 seconds */
 
+/* When there are more background connection targets than accept list entries,
+ * targets that did not connect within this time give their entry to targets
+ * waiting for one */
+#define BG_CONN_ROTATION_INTERVAL_MS (30 * 1000) /* 30 seconds */
+
+/* Minimum time a background connection target keeps its accept list entry
+ * before a waiting target that is seen advertising can take it over */
+#define BG_CONN_MIN_DWELL_MS (5 * 1000) /* 5 seconds */
+
 using namespace bluetooth;
 
 constexpr char kBtmLogTag[] = "TA";
@@ -80,6 +94,21 @@ struct tAPPS_CONNECTING {
 
   // Apps trying to do direct connection.
   std::map<tAPP_ID, unique_alarm_ptr> doing_direct_conn;
+
+  // Background connection scheduling, used when there are more targets than
+  // accept list entries. All times are boottime in milliseconds.
+  uint64_t last_seen_ms = 0;         // last advertisement seen from device
+  int8_t last_rssi = INT8_MIN;       // RSSI of that advertisement
+  uint64_t accept_list_since_ms = 0; // when device got its accept list entry
+  uint64_t waiting_since_ms = 0;     // when device started waiting for one
+
+  // Reconnection latency, from the background connection request or the link
+  // going down, until the link comes up again.
+  uint64_t reconnect_start_ms = 0;
+  uint32_t reconnect_count = 0;
+  uint64_t reconnect_last_ms = 0;
+  uint64_t reconnect_max_ms = 0;
+  uint64_t reconnect_total_ms = 0;
 };
 
 namespace {
@@ -110,6 +139,111 @@ bool is_anyone_connecting(
           !it->second.doing_targeted_announcements_conn.empty());
 }
 
+/* Number of accept list entries in the controller, or 0 if unknown */
+size_t accept_list_capacity() {
+  const controller_t* controller = controller_get_interface();
+  if (!controller->SupportsBle()) {
+    return 0;
+  }
+  return controller->get_ble_acceptlist_size();
+}
+
+bool is_accept_list_full() {
+  size_t capacity = accept_list_capacity();
+  if (capacity == 0) {
+    return false;
+  }
+  size_t in_use = std::count_if(
+      bgconn_dev.begin(), bgconn_dev.end(),
+      [](const auto& pair) { return pair.second.is_in_accept_list; });
+  return in_use >= capacity;
+}
+
+/* Device wants a background connection through the accept list, but did not
+ * get an entry in it */
+bool is_waiting_for_accept_list(const tAPPS_CONNECTING& dev) {
+  return !dev.is_in_accept_list && !dev.doing_bg_conn.empty() &&
+         dev.doing_targeted_announcements_conn.empty();
+}
+
+/* Background connection targets seen more recently, then with a stronger
+ * signal, then waiting longer, get accept list entries first */
+bool has_higher_priority(const tAPPS_CONNECTING& a, const tAPPS_CONNECTING& b) {
+  if (a.last_seen_ms != b.last_seen_ms) return a.last_seen_ms > b.last_seen_ms;
+  if (a.last_rssi != b.last_rssi) return a.last_rssi > b.last_rssi;
+  return a.waiting_since_ms < b.waiting_since_ms;
+}
+
+/* Background-only accept list entries that held their entry for at least
+ * |min_dwell_ms| without connecting, lowest priority first */
+std::vector<std::map<RawAddress, tAPPS_CONNECTING>::iterator>
+get_rotation_candidates(uint64_t now_ms, uint64_t min_dwell_ms) {
+  std::vector<std::map<RawAddress, tAPPS_CONNECTING>::iterator> candidates;
+  for (auto it = bgconn_dev.begin(); it != bgconn_dev.end(); it++) {
+    const tAPPS_CONNECTING& dev = it->second;
+    if (!dev.is_in_accept_list || dev.doing_bg_conn.empty() ||
+        !dev.doing_direct_conn.empty() ||
+        !dev.doing_targeted_announcements_conn.empty()) {
+      continue;
+    }
+    if (now_ms - dev.accept_list_since_ms < min_dwell_ms) continue;
+    if (BTM_GetHCIConnHandle(it->first, BT_TRANSPORT_LE) != 0xFFFF) continue;
+    candidates.push_back(it);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& a, const auto& b) {
+              return has_higher_priority(b->second, a->second);
+            });
+  return candidates;
+}
+
+/* Targets waiting for an accept list entry, highest priority first */
+std::vector<std::map<RawAddress, tAPPS_CONNECTING>::iterator>
+get_waiting_targets() {
+  std::vector<std::map<RawAddress, tAPPS_CONNECTING>::iterator> waiting;
+  for (auto it = bgconn_dev.begin(); it != bgconn_dev.end(); it++) {
+    if (is_waiting_for_accept_list(it->second)) waiting.push_back(it);
+  }
+  std::sort(waiting.begin(), waiting.end(), [](const auto& a, const auto& b) {
+    return has_higher_priority(a->second, b->second);
+  });
+  return waiting;
+}
+
+/* Gives the accept list entry of |it| back, and puts it at the end of the
+ * waiting targets */
+void rotate_out_of_accept_list(
+    std::map<RawAddress, tAPPS_CONNECTING>::iterator it, uint64_t now_ms) {
+  log::info("Rotating {} out of accept list",
+            ADDRESS_TO_LOGGABLE_CSTR(it->first));
+  BTM_AcceptlistRemove(it->first);
+  it->second.is_in_accept_list = false;
+  it->second.waiting_since_ms = now_ms;
+}
+
+/* Adds background connection target |it| to the accept list, unless the
+ * accept list is full. Returns true if the device is in the accept list */
+bool background_accept_list_add(
+    std::map<RawAddress, tAPPS_CONNECTING>::iterator it) {
+  if (is_accept_list_full()) {
+    return false;
+  }
+  if (!BTM_AcceptlistAdd(it->first)) {
+    log::warn("Failed to add device {} to accept list",
+              ADDRESS_TO_LOGGABLE_CSTR(it->first));
+    return false;
+  }
+  it->second.is_in_accept_list = true;
+  it->second.accept_list_since_ms = bluetooth::common::time_get_os_boottime_ms();
+  return true;
+}
+
+// Periodic rotation of the accept list, armed while targets are waiting
+alarm_t* accept_list_rotation_timer = nullptr;
+
+// Whether advertisements are observed to find waiting targets
+bool waiting_targets_observed = false;
+
 }  // namespace
 
 /** background connection device from the list. Returns pointer to the device
@@ -155,14 +289,28 @@ bool IsTargetedAnnouncement(const uint8_t* p_eir, uint16_t eir_len) {
 
 static void schedule_direct_connect_add(uint8_t app_id,
                                         const RawAddress& address);
+static void on_waiting_target_seen(const RawAddress& address);
 
 static void target_announcement_observe_results_cb(tBTM_INQ_RESULTS* p_inq,
                                                    const uint8_t* p_eir,
                                                    uint16_t eir_len) {
   auto addr = p_inq->remote_bd_addr;
   auto it = bgconn_dev.find(addr);
-  if (it == bgconn_dev.end() ||
-      it->second.doing_targeted_announcements_conn.empty()) {
+  if (it == bgconn_dev.end()) {
+    return;
+  }
+
+  if (!it->second.doing_bg_conn.empty()) {
+    it->second.last_seen_ms = bluetooth::common::time_get_os_boottime_ms();
+    it->second.last_rssi = p_inq->rssi;
+    if (is_waiting_for_accept_list(it->second)) {
+      do_in_main_thread(FROM_HERE,
+                        base::BindOnce(on_waiting_target_seen, addr));
+      return;
+    }
+  }
+
+  if (it->second.doing_targeted_announcements_conn.empty()) {
     return;
   }
 
@@ -204,10 +352,99 @@ void target_announcements_filtering_set(bool enable) {
   /* Safe to call as if there is no support for filtering, this call will be
    * ignored. */
   bluetooth::shim::set_target_announcements_filter(enable);
-  BTM_BleTargetAnnouncementObserve(enable,
+  BTM_BleTargetAnnouncementObserve(enable || waiting_targets_observed,
                                    target_announcement_observe_results_cb);
 }
 
+static void accept_list_rotation_timeout(void* data);
+
+/* Keeps the rotation timer armed, and advertisements observed, while
+ * background connection targets are waiting for an accept list entry */
+static void update_accept_list_scheduling() {
+  bool any_waiting = std::any_of(
+      bgconn_dev.begin(), bgconn_dev.end(),
+      [](const auto& pair) { return is_waiting_for_accept_list(pair.second); });
+
+  if (any_waiting && accept_list_capacity() != 0) {
+    if (accept_list_rotation_timer == nullptr) {
+      accept_list_rotation_timer = alarm_new("bg_conn_rotation");
+    }
+    if (!alarm_is_scheduled(accept_list_rotation_timer)) {
+      alarm_set_on_mloop(accept_list_rotation_timer,
+                         BG_CONN_ROTATION_INTERVAL_MS,
+                         accept_list_rotation_timeout, nullptr);
+    }
+  } else if (accept_list_rotation_timer != nullptr) {
+    alarm_cancel(accept_list_rotation_timer);
+  }
+
+  if (any_waiting != waiting_targets_observed) {
+    waiting_targets_observed = any_waiting;
+    BTM_BleTargetAnnouncementObserve(
+        any_waiting || num_of_targeted_announcements_users() > 0,
+        target_announcement_observe_results_cb);
+  }
+}
+
+/* Gives free accept list entries to the waiting targets with the highest
+ * priority */
+static void fill_accept_list() {
+  for (auto it : get_waiting_targets()) {
+    if (!background_accept_list_add(it)) break;
+    log::info("Device {} got accept list entry after waiting {}ms",
+              ADDRESS_TO_LOGGABLE_CSTR(it->first),
+              it->second.accept_list_since_ms - it->second.waiting_since_ms);
+  }
+  update_accept_list_scheduling();
+}
+
+/* Multiplexes more background connection targets than there are accept list
+ * entries: targets that held an entry for a full rotation interval without
+ * connecting hand it over to the waiting targets with the highest priority */
+static void accept_list_rotation_timeout(void* data) {
+  fill_accept_list();
+
+  auto waiting = get_waiting_targets();
+  if (waiting.empty()) return;
+
+  uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+  auto candidates =
+      get_rotation_candidates(now_ms, BG_CONN_ROTATION_INTERVAL_MS);
+  size_t count = std::min(waiting.size(), candidates.size());
+  log::debug("rotating {} of {} waiting background connection targets", count,
+             waiting.size());
+  for (size_t i = 0; i < count; i++) {
+    rotate_out_of_accept_list(candidates[i], now_ms);
+    background_accept_list_add(waiting[i]);
+  }
+  update_accept_list_scheduling();
+}
+
+/* A target waiting for an accept list entry is advertising, take over the
+ * entry of the lowest priority target if the accept list is full */
+static void on_waiting_target_seen(const RawAddress& address) {
+  auto it = bgconn_dev.find(address);
+  if (it == bgconn_dev.end() || !is_waiting_for_accept_list(it->second)) {
+    return;
+  }
+
+  if (is_accept_list_full()) {
+    uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+    auto candidates = get_rotation_candidates(now_ms, BG_CONN_MIN_DWELL_MS);
+    if (candidates.empty() ||
+        !has_higher_priority(it->second, candidates.front()->second)) {
+      return;
+    }
+    rotate_out_of_accept_list(candidates.front(), now_ms);
+  }
+
+  if (background_accept_list_add(it)) {
+    log::info("Waiting device {} seen advertising, rssi={}",
+              ADDRESS_TO_LOGGABLE_CSTR(address), it->second.last_rssi);
+  }
+  update_accept_list_scheduling();
+}
+
 /** Add a device to the background connection list for targeted announcements.
  * Returns
  *   true if device added to the list, or already in list,
@@ -264,6 +501,10 @@ bool background_connect_targeted_announcement_add(tAPP_ID app_id,
     target_announcements_filtering_set(true);
   }
 
+  if (disable_accept_list) {
+    fill_accept_list();
+  }
+
   return true;
 }
 
@@ -294,10 +535,20 @@ bool background_connect_add(uint8_t app_id, const RawAddress& address) {
     }
   }
 
+  bool waiting_for_accept_list = false;
   if (!in_acceptlist) {
     // the device is not in the acceptlist
     if (is_targeted_announcement_enabled) {
       log::debug("Targeted announcement enabled, do not add to AcceptList");
+    } else if (it != bgconn_dev.end() && !it->second.doing_bg_conn.empty()) {
+      log::debug("address={} already waiting for accept list entry",
+                 ADDRESS_TO_LOGGABLE_CSTR(address));
+    } else if (is_accept_list_full()) {
+      // keep the device as a target, it gets an entry when one frees up or
+      // when it is seen advertising
+      log::info("Accept list full, device {} waits for an entry",
+                ADDRESS_TO_LOGGABLE_CSTR(address));
+      waiting_for_accept_list = true;
     } else {
       if (!BTM_AcceptlistAdd(address)) {
         log::warn("Failed to add device {} to accept list for app {}",
@@ -305,12 +556,22 @@ bool background_connect_add(uint8_t app_id, const RawAddress& address) {
         return false;
       }
       bgconn_dev[address].is_in_accept_list = true;
+      bgconn_dev[address].accept_list_since_ms =
+          bluetooth::common::time_get_os_boottime_ms();
     }
   }
 
   // create entry for address, and insert app_id.
   // new tAPPS_CONNECTING will be default constructed if not exist
-  bgconn_dev[address].doing_bg_conn.insert(app_id);
+  tAPPS_CONNECTING& dev = bgconn_dev[address];
+  if (dev.doing_bg_conn.empty()) {
+    dev.reconnect_start_ms = bluetooth::common::time_get_os_boottime_ms();
+  }
+  dev.doing_bg_conn.insert(app_id);
+  if (waiting_for_accept_list) {
+    dev.waiting_since_ms = dev.reconnect_start_ms;
+    update_accept_list_scheduling();
+  }
   return true;
 }
 
@@ -324,8 +585,14 @@ bool remove_unconditional(const RawAddress& address) {
     return false;
   }
 
+  bool was_in_accept_list = it->second.is_in_accept_list;
   BTM_AcceptlistRemove(address);
   bgconn_dev.erase(it);
+  if (was_in_accept_list) {
+    fill_accept_list();
+  } else {
+    update_accept_list_scheduling();
+  }
   return true;
 }
 
@@ -369,11 +636,12 @@ bool background_connect_remove(uint8_t app_id, const RawAddress& address) {
         /* Keep using filtering */
         log::debug("Keep using target announcement filtering");
       } else if (!it->second.doing_bg_conn.empty()) {
-        if (!BTM_AcceptlistAdd(address)) {
+        if (!background_accept_list_add(it) && removed_from_ta) {
           log::warn("Could not re add device to accept list");
-        } else {
-          bgconn_dev[address].is_in_accept_list = true;
+          it->second.waiting_since_ms =
+              bluetooth::common::time_get_os_boottime_ms();
         }
+        update_accept_list_scheduling();
       }
     }
     return true;
@@ -384,9 +652,12 @@ bool background_connect_remove(uint8_t app_id, const RawAddress& address) {
   // no more apps interested - remove from accept list and delete record
   if (accept_list_enabled) {
     BTM_AcceptlistRemove(address);
+    fill_accept_list();
     return true;
   }
 
+  update_accept_list_scheduling();
+
   if ((num_of_targeted_announcements_before_remove > 0) &&
       num_of_targeted_announcements_users() == 0) {
     target_announcements_filtering_set(true);
@@ -418,6 +689,8 @@ void on_app_deregistered(uint8_t app_id) {
     BTM_AcceptlistRemove(it->first);
     it = bgconn_dev.erase(it);
   }
+
+  fill_accept_list();
 }
 
 static void remove_all_clients_with_pending_connections(
@@ -435,9 +708,32 @@ void on_connection_complete(const RawAddress& address) {
   log::info("Le connection completed to device:{}",
             ADDRESS_TO_LOGGABLE_CSTR(address));
 
+  auto it = bgconn_dev.find(address);
+  if (it != bgconn_dev.end() && it->second.reconnect_start_ms != 0) {
+    tAPPS_CONNECTING& dev = it->second;
+    uint64_t latency_ms =
+        bluetooth::common::time_get_os_boottime_ms() - dev.reconnect_start_ms;
+    dev.reconnect_start_ms = 0;
+    dev.reconnect_count++;
+    dev.reconnect_last_ms = latency_ms;
+    dev.reconnect_max_ms = std::max(dev.reconnect_max_ms, latency_ms);
+    dev.reconnect_total_ms += latency_ms;
+    log::info("Background connection to {} took {}ms",
+              ADDRESS_TO_LOGGABLE_CSTR(address), latency_ms);
+  }
+
   remove_all_clients_with_pending_connections(address);
 }
 
+void on_disconnected(const RawAddress& address) {
+  auto it = bgconn_dev.find(address);
+  if (it == bgconn_dev.end() || it->second.doing_bg_conn.empty()) {
+    return;
+  }
+
+  it->second.reconnect_start_ms = bluetooth::common::time_get_os_boottime_ms();
+}
+
 void on_connection_timed_out_from_shim(const RawAddress& address) {
   log::info("Connection failed {}", ADDRESS_TO_LOGGABLE_CSTR(address));
   on_connection_timed_out(0x00, address);
@@ -447,6 +743,11 @@ void on_connection_timed_out_from_shim(const RawAddress& address) {
  * to true, as there is no need to wipe controller acceptlist in this case. */
 void reset(bool after_reset) {
   bgconn_dev.clear();
+  if (accept_list_rotation_timer != nullptr) {
+    alarm_free(accept_list_rotation_timer);
+    accept_list_rotation_timer = nullptr;
+  }
+  waiting_targets_observed = false;
   if (!after_reset) {
     target_announcements_filtering_set(false);
     BTM_AcceptlistClear();
@@ -487,12 +788,24 @@ bool direct_connect_add(uint8_t app_id, const RawAddress& address) {
   }
 
   if (!in_acceptlist) {
+    if (is_accept_list_full()) {
+      // direct connection takes the entry of a background connection target
+      uint64_t now_ms = bluetooth::common::time_get_os_boottime_ms();
+      auto candidates = get_rotation_candidates(now_ms, 0);
+      if (!candidates.empty()) {
+        rotate_out_of_accept_list(candidates.front(), now_ms);
+        update_accept_list_scheduling();
+      }
+    }
+
     if (!BTM_AcceptlistAdd(address, true)) {
       // if we can't add to acceptlist, turn parameters back to slow.
       log::warn("Unable to add le device to acceptlist");
       return false;
     }
     bgconn_dev[address].is_in_accept_list = true;
+    bgconn_dev[address].accept_list_since_ms =
+        bluetooth::common::time_get_os_boottime_ms();
   }
 
   // Setup a timer
@@ -562,6 +875,7 @@ bool direct_connect_remove(uint8_t app_id, const RawAddress& address,
     it->second.is_in_accept_list = false;
   }
 
+  fill_accept_list();
   return true;
 }
 
@@ -573,6 +887,12 @@ void dump(int fd) {
   }
 
   dprintf(fd, "\tdevices attempting connection: %d", (int)bgconn_dev.size());
+  dprintf(fd, "\n\taccept list capacity: %zu, waiting for entry: %d",
+          accept_list_capacity(),
+          (int)std::count_if(bgconn_dev.begin(), bgconn_dev.end(),
+                             [](const auto& pair) {
+                               return is_waiting_for_accept_list(pair.second);
+                             }));
   for (const auto& entry : bgconn_dev) {
     // TODO: confirm whether we need to replace this
     dprintf(fd, "\n\t * %s: ", ADDRESS_TO_LOGGABLE_CSTR(entry.first));
@@ -598,6 +918,20 @@ void dump(int fd) {
     }
     dprintf(fd, "\n\t\t is in the allow list: %s",
             entry.second.is_in_accept_list ? "true" : "false");
+    if (entry.second.last_seen_ms != 0) {
+      dprintf(fd, "\n\t\t last seen: %" PRIu64 "ms ago, rssi: %d",
+              bluetooth::common::time_get_os_boottime_ms() -
+                  entry.second.last_seen_ms,
+              entry.second.last_rssi);
+    }
+    if (entry.second.reconnect_count != 0) {
+      dprintf(fd,
+              "\n\t\t reconnections: %u, latency last: %" PRIu64
+              "ms, max: %" PRIu64 "ms, avg: %" PRIu64 "ms",
+              entry.second.reconnect_count, entry.second.reconnect_last_ms,
+              entry.second.reconnect_max_ms,
+              entry.second.reconnect_total_ms / entry.second.reconnect_count);
+    }
   }
   dprintf(fd, "\n");
 }
@@ -47,6 +47,7 @@ void reset(bool after_reset);
 
 void on_app_deregistered(tAPP_ID app_id);
 void on_connection_complete(const RawAddress& address);
+void on_disconnected(const RawAddress& address);
 
 std::set<tAPP_ID> get_apps_connecting_to(const RawAddress& remote_bda);
 
@@ -140,11 +140,14 @@ static void gatt_update_last_srv_info() {
   for (tGATT_SRV_LIST_ELEM& el : *gatt_cb.srv_list_info) {
     gatt_cb.last_service_handle = el.s_hdl;
   }
+
+  gatt_sr_update_srv_range_table();
 }
 
-/** Update database hash and client status */
+/** Invalidate database hash and update client status. The hash is computed
+ * again when it is next needed, once for a burst of service changes. */
 static void gatt_update_for_database_change() {
-  gatt_cb.database_hash = gatts_calculate_database_hash(gatt_cb.srv_list_info);
+  gatt_cb.is_database_hash_stale = true;
 
   uint8_t i = 0;
   for (i = 0; i < GATT_MAX_PHY_CHANNEL; i++) {
@@ -428,6 +431,59 @@ void GATTS_StopService(uint16_t service_handle) {
   gatt_cb.srv_list_info->erase(it);
   gatt_update_last_srv_info();
 }
+
+/*******************************************************************************
+ *
+ * Function         GATTS_SetStaticAttributeValue
+ *
+ * Description      This function sets the value of a characteristic or
+ *                  descriptor that never changes. Read requests for the
+ *                  attribute are then answered by the stack.
+ *
+ * Parameter        attr_handle: handle of the attribute.
+ *                  p_value: new value, or nullptr to let the application
+ *                           answer read requests again.
+ *                  len: length of the value.
+ *
+ * Returns          GATT_SUCCESS if the value was set, GATT_INVALID_HANDLE if
+ *                  the attribute does not exist.
+ *
+ ******************************************************************************/
+tGATT_STATUS GATTS_SetStaticAttributeValue(uint16_t attr_handle,
+                                           const uint8_t* p_value,
+                                           uint16_t len) {
+  auto it = gatt_sr_find_i_rcb_by_handle(attr_handle);
+  if (it == gatt_cb.srv_list_info->end()) {
+    log::error("attr_handle={} is not in use", loghex(attr_handle));
+    return GATT_INVALID_HANDLE;
+  }
+
+  tGATT_ATTR* p_attr = find_attr_by_handle(it->p_db, attr_handle);
+  if (p_attr == nullptr) {
+    log::error("attr_handle={} not found", loghex(attr_handle));
+    return GATT_INVALID_HANDLE;
+  }
+
+  if (p_attr->gatt_type != BTGATT_DB_CHARACTERISTIC &&
+      p_attr->gatt_type != BTGATT_DB_DESCRIPTOR) {
+    log::error("attr_handle={} is not a characteristic value or descriptor",
+               loghex(attr_handle));
+    return GATT_ILLEGAL_PARAMETER;
+  }
+
+  if (len > GATT_MAX_ATTR_LEN) {
+    log::error("attr_handle={} value too long, len={}", loghex(attr_handle),
+               len);
+    return GATT_INVALID_ATTR_LEN;
+  }
+
+  if (p_value == nullptr) {
+    p_attr->static_value.reset();
+  } else {
+    p_attr->static_value.emplace(p_value, p_value + len);
+  }
+  return GATT_SUCCESS;
+}
 /*******************************************************************************
  *
  * Function         GATTs_HandleValueIndication
@@ -617,13 +673,101 @@ tGATT_STATUS GATTS_HandleValueNotification(uint16_t conn_id,
                                     &gatt_sr_msg, payload_size);
 
   if (p_buf != NULL) {
+    uint16_t len = p_buf->len;
     cmd_sent = attp_send_sr_msg(*p_tcb, cid, p_buf);
+    if (cmd_sent == GATT_SUCCESS || cmd_sent == GATT_CONGESTED) {
+      gatt_tcb_count_notification(*p_tcb, len);
+    }
   } else {
     cmd_sent = GATT_NO_RESOURCES;
   }
   return cmd_sent;
 }
 
+/*******************************************************************************
+ *
+ * Function         GATTS_HandleValueNotificationMulti
+ *
+ * Description      This function sends the same handle value notification to
+ *                  several clients.
+ *
+ * Parameter        conn_ids: connection identifiers of the clients.
+ *                  attr_handle: Attribute handle of this handle value
+ *                               notification.
+ *                  val_len: Length of the notified attribute value.
+ *                  p_val: Pointer to the notified attribute value data.
+ *
+ * Returns          One status per connection identifier.
+ *
+ ******************************************************************************/
+std::vector<tGATT_STATUS> GATTS_HandleValueNotificationMulti(
+    const std::vector<uint16_t>& conn_ids, uint16_t attr_handle,
+    uint16_t val_len, uint8_t* p_val) {
+  std::vector<tGATT_STATUS> statuses(conn_ids.size(), GATT_ILLEGAL_PARAMETER);
+
+  log::verbose("{} clients", conn_ids.size());
+
+  if (!GATT_HANDLE_IS_VALID(attr_handle)) {
+    return statuses;
+  }
+
+  tGATT_SR_MSG gatt_sr_msg;
+  memset(&gatt_sr_msg, 0, sizeof(gatt_sr_msg));
+  gatt_sr_msg.attr_value.handle = attr_handle;
+  gatt_sr_msg.attr_value.len = val_len;
+  memcpy(gatt_sr_msg.attr_value.value, p_val, val_len);
+  gatt_sr_msg.attr_value.auth_req = GATT_AUTH_REQ_NONE;
+
+  /* The PDU only depends on the payload size the value is truncated to, keep
+   * one per payload size and hand a copy of it to each link */
+  std::vector<std::pair<uint16_t, BT_HDR*>> pdus;
+
+  for (size_t i = 0; i < conn_ids.size(); i++) {
+    uint16_t conn_id = conn_ids[i];
+    tGATT_REG* p_reg = gatt_get_regcb(GATT_GET_GATT_IF(conn_id));
+    tGATT_TCB* p_tcb = gatt_get_tcb_by_idx(GATT_GET_TCB_IDX(conn_id));
+    if ((p_reg == NULL) || (p_tcb == NULL)) {
+      log::error("Unknown  conn_id: {}", conn_id);
+      statuses[i] = GATT_INVALID_CONN_ID;
+      continue;
+    }
+
+    uint16_t cid = gatt_tcb_get_att_cid(*p_tcb, p_reg->eatt_support);
+    uint16_t payload_size = gatt_tcb_get_payload_size(*p_tcb, cid);
+
+    BT_HDR* p_pdu = NULL;
+    for (const auto& [size, pdu] : pdus) {
+      if (size == payload_size) {
+        p_pdu = pdu;
+        break;
+      }
+    }
+    if (p_pdu == NULL) {
+      p_pdu = attp_build_sr_msg(*p_tcb, GATT_HANDLE_VALUE_NOTIF, &gatt_sr_msg,
+                                payload_size);
+      if (p_pdu == NULL) {
+        statuses[i] = GATT_NO_RESOURCES;
+        continue;
+      }
+      pdus.emplace_back(payload_size, p_pdu);
+    }
+
+    BT_HDR* p_buf = (BT_HDR*)osi_malloc(sizeof(BT_HDR) + L2CAP_MIN_OFFSET +
+                                        payload_size);
+    memcpy(p_buf, p_pdu, sizeof(BT_HDR) + p_pdu->offset + p_pdu->len);
+
+    statuses[i] = attp_send_sr_msg(*p_tcb, cid, p_buf);
+    if (statuses[i] == GATT_SUCCESS || statuses[i] == GATT_CONGESTED) {
+      gatt_tcb_count_notification(*p_tcb, p_pdu->len);
+    }
+  }
+
+  for (const auto& [size, pdu] : pdus) {
+    osi_free(pdu);
+  }
+  return statuses;
+}
+
 /*******************************************************************************
  *
  * Function         GATTS_SendRsp
@@ -28,6 +28,9 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "gatt_int.h"
 #include "l2c_api.h"
 #include "osi/include/osi.h"
@@ -43,6 +46,8 @@ using namespace bluetooth;
  ******************************************************************************/
 static tGATT_ATTR& allocate_attr_in_db(tGATT_SVC_DB& db, const Uuid& uuid,
                                        tGATT_PERM perm);
+static std::vector<tGATT_ATTR>::iterator find_first_attr_from(
+    tGATT_SVC_DB& db, uint16_t handle);
 static tGATT_STATUS gatts_send_app_read_request(
     tGATT_TCB& tcb, uint16_t cid, uint8_t op_code, uint16_t handle,
     uint16_t offset, uint32_t trans_id, bt_gatt_db_attribute_type_t gatt_type);
@@ -183,6 +188,16 @@ static tGATT_STATUS read_attr_value(tGATT_ATTR& attr16, uint16_t offset,
                                                      sec_flag, key_size);
   if (status != GATT_SUCCESS) return status;
 
+  if (attr16.static_value) {
+    const std::vector<uint8_t>& value = *attr16.static_value;
+    if (offset > value.size()) return GATT_INVALID_OFFSET;
+    *p_len = std::min<size_t>(value.size() - offset, mtu);
+    memcpy(p, value.data() + offset, *p_len);
+    *p_data = p + *p_len;
+    gatt_cb.static_value_reads++;
+    return GATT_SUCCESS;
+  }
+
   if (!attr16.uuid.Is16Bit()) {
     /* characteristic description or characteristic value */
     return GATT_PENDING;
@@ -286,8 +301,10 @@ tGATT_STATUS gatts_db_read_attr_value_by_type(
   uint8_t* p = (uint8_t*)(p_rsp + 1) + p_rsp->len + L2CAP_MIN_OFFSET;
 
   if (p_db) {
-    for (tGATT_ATTR& attr : p_db->attr_list) {
-      if (attr.handle >= s_handle && type == attr.uuid) {
+    for (auto it = find_first_attr_from(*p_db, s_handle);
+         it != p_db->attr_list.end(); it++) {
+      tGATT_ATTR& attr = *it;
+      if (type == attr.uuid) {
         if (*p_len <= 2) {
           status = GATT_NO_RESOURCES;
           break;
@@ -444,14 +461,32 @@ uint16_t gatts_add_char_descr(tGATT_SVC_DB& db, tGATT_PERM perm,
 /******************************************************************************/
 /* Service Attribute Database Query Utility Functions */
 /******************************************************************************/
-tGATT_ATTR* find_attr_by_handle(tGATT_SVC_DB* p_db, uint16_t handle) {
-  if (!p_db) return nullptr;
+/** First attribute of the database with a handle equal to or above |handle|.
+ */
+static std::vector<tGATT_ATTR>::iterator find_first_attr_from(
+    tGATT_SVC_DB& db, uint16_t handle) {
+  return std::lower_bound(
+      db.attr_list.begin(), db.attr_list.end(), handle,
+      [](const tGATT_ATTR& attr, uint16_t handle) {
+        return attr.handle < handle;
+      });
+}
 
-  for (auto& attr : p_db->attr_list) {
-    if (attr.handle == handle) return &attr;
-    if (attr.handle > handle) return nullptr;
+tGATT_ATTR* find_attr_by_handle(tGATT_SVC_DB* p_db, uint16_t handle) {
+  if (!p_db || p_db->attr_list.empty()) return nullptr;
+
+  /* handles are allocated consecutively from the service handle */
+  std::vector<tGATT_ATTR>& attr_list = p_db->attr_list;
+  uint16_t first_handle = attr_list.front().handle;
+  if (handle < first_handle) return nullptr;
+  size_t index = handle - first_handle;
+  if (index < attr_list.size() && attr_list[index].handle == handle) {
+    return &attr_list[index];
   }
 
+  auto it = find_first_attr_from(*p_db, handle);
+  if (it != attr_list.end() && it->handle == handle) return &*it;
+
   return nullptr;
 }
 
@@ -684,6 +719,7 @@ static tGATT_ATTR& allocate_attr_in_db(tGATT_SVC_DB& db, const Uuid& uuid,
                db.end_handle, db.next_handle);
   }
 
+  db.hash_info.clear();
   db.attr_list.emplace_back();
   tGATT_ATTR& attr = db.attr_list.back();
   attr.handle = db.next_handle++;
@@ -25,6 +25,7 @@
 
 #include <deque>
 #include <list>
+#include <optional>
 #include <unordered_set>
 #include <vector>
 
@@ -174,6 +175,9 @@ typedef struct {
   uint16_t handle;
   bluetooth::Uuid uuid;
   bt_gatt_db_attribute_type_t gatt_type;
+  /* value served by the stack instead of the application, see
+   * GATTS_SetStaticAttributeValue */
+  std::optional<std::vector<uint8_t>> static_value;
 } tGATT_ATTR;
 
 /* Service Database definition
@@ -182,6 +186,7 @@ typedef struct {
   std::vector<tGATT_ATTR> attr_list; /* pointer to the attributes */
   uint16_t end_handle;       /* Last handle number           */
   uint16_t next_handle;      /* Next usable handle value     */
+  std::vector<uint8_t> hash_info; /* serialized for the database hash */
 } tGATT_SVC_DB;
 
 /* Data Structure used for GATT server */
@@ -342,6 +347,11 @@ typedef struct {
   /* Used to set proper TX DATA LEN on the controller*/
   uint16_t max_user_mtu;
 
+  /* Server notification statistics, reported in dumpsys */
+  uint64_t notif_sent_count;
+  uint64_t notif_sent_bytes;
+  uint64_t notif_first_sent_ms;
+
 } tGATT_TCB;
 
 /* logic channel */
@@ -411,6 +421,10 @@ typedef struct {
   tGATT_IF gatt_if;
   std::list<tGATT_HDL_LIST_ELEM>* hdl_list_info;
   std::list<tGATT_SRV_LIST_ELEM>* srv_list_info;
+  /* started services ordered by start handle, for lookups by handle */
+  std::vector<std::list<tGATT_SRV_LIST_ELEM>::iterator> srv_range_table;
+  /* reads answered from a static attribute value, reported in dumpsys */
+  uint64_t static_value_reads;
 
   fixed_queue_t* srv_chg_clt_q; /* service change clients queue */
   tGATT_REG cl_rcb[GATT_MAX_APPS];
@@ -446,6 +460,8 @@ typedef struct {
 
   uint16_t handle_of_database_hash;
   Octet16 database_hash;
+  /* services changed since database_hash was computed */
+  bool is_database_hash_stale;
 
   tGATT_APPL_INFO cb_info;
 
@@ -565,6 +581,7 @@ bool gatt_auto_connect_dev_remove(tGATT_IF gatt_if, const RawAddress& bd_addr);
 /* server function */
 std::list<tGATT_SRV_LIST_ELEM>::iterator gatt_sr_find_i_rcb_by_handle(
     uint16_t handle);
+void gatt_sr_update_srv_range_table();
 tGATT_STATUS gatt_sr_process_app_rsp(tGATT_TCB& tcb, tGATT_IF gatt_if,
                                      uint32_t trans_id, uint8_t op_code,
                                      tGATT_STATUS status, tGATTS_RSP* p_msg,
@@ -598,6 +615,7 @@ bool gatt_tcb_find_indicate_handle(tGATT_TCB& tcb, uint16_t cid,
                                    uint16_t* indicated_handle_p);
 uint16_t gatt_tcb_get_att_cid(tGATT_TCB& tcb, bool eatt_support);
 uint16_t gatt_tcb_get_payload_size(tGATT_TCB& tcb, uint16_t cid);
+void gatt_tcb_count_notification(tGATT_TCB& tcb, uint16_t len);
 void gatt_clcb_invalidate(tGATT_TCB* p_tcb, const tGATT_CLCB* p_clcb);
 uint16_t gatt_get_mtu(const RawAddress& bda, tBT_TRANSPORT transport);
 bool gatt_is_pending_mtu_exchange(tGATT_TCB* p_tcb);
@@ -621,6 +639,7 @@ uint8_t gatt_num_clcb_by_bd_addr(const RawAddress& bda);
 tGATT_TCB* gatt_find_tcb_by_cid(uint16_t lcid);
 tGATT_TCB* gatt_allocate_tcb_by_bdaddr(const RawAddress& bda,
                                        tBT_TRANSPORT transport);
+void gatt_update_tcb_gauge();
 tGATT_TCB* gatt_get_tcb_by_idx(uint8_t tcb_idx);
 tGATT_TCB* gatt_find_tcb_by_addr(const RawAddress& bda,
                                  tBT_TRANSPORT transport);
@@ -673,6 +692,7 @@ tGATT_STATUS gatts_db_read_attr_value_by_type(
     BT_HDR* p_rsp, uint16_t s_handle, uint16_t e_handle,
     const bluetooth::Uuid& type, uint16_t* p_len, tGATT_SEC_FLAG sec_flag,
     uint8_t key_size, uint32_t trans_id, uint16_t* p_cur_handle);
+tGATT_ATTR* find_attr_by_handle(tGATT_SVC_DB* p_db, uint16_t handle);
 tGATT_STATUS gatts_read_attr_value_by_handle(
     tGATT_TCB& tcb, uint16_t cid, tGATT_SVC_DB* p_db, uint8_t op_code,
     uint16_t handle, uint16_t offset, uint8_t* p_value, uint16_t* p_len,
@@ -690,6 +710,7 @@ bluetooth::Uuid* gatts_get_service_uuid(tGATT_SVC_DB* p_db);
 
 /* gatt_sr_hash.cc */
 Octet16 gatts_calculate_database_hash(std::list<tGATT_SRV_LIST_ELEM>* lst_ptr);
+const Octet16& gatts_get_database_hash();
 
 namespace fmt {
 template <>
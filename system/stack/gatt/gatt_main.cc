@@ -196,6 +196,7 @@ void gatt_free(void) {
   gatt_cb.hdl_list_info->clear();
   delete gatt_cb.hdl_list_info;
   gatt_cb.hdl_list_info = nullptr;
+  gatt_cb.srv_range_table.clear();
   gatt_cb.srv_list_info->clear();
   delete gatt_cb.srv_list_info;
   gatt_cb.srv_list_info = nullptr;
@@ -451,6 +452,7 @@ bool gatt_act_connect(tGATT_REG* p_reg, const RawAddress& bd_addr,
     log::error("gatt_connect failed");
     fixed_queue_free(p_tcb->pending_ind_q, NULL);
     *p_tcb = tGATT_TCB();
+    gatt_update_tcb_gauge();
     return false;
   }
 
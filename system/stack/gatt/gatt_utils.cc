@@ -27,11 +27,15 @@
 #include <base/strings/stringprintf.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <deque>
+#include <iterator>
 
+#include "common/time_util.h"
 #include "hardware/bt_gatt_types.h"
 #include "internal_include/bt_target.h"
+#include "metrics/counter_registry.h"
 #include "os/log.h"
 #include "osi/include/allocator.h"
 #include "rust/src/connection/ffi/connection_shim.h"
@@ -458,12 +462,25 @@ void gatt_tcb_dump(int fd) {
              << "  address: " << ADDRESS_TO_LOGGABLE_STR(p_tcb->peer_bda)
              << "  transport: " << bt_transport_text(p_tcb->transport)
              << "  ch_state: " << gatt_channel_state_text(p_tcb->ch_state);
+      if (p_tcb->notif_sent_count > 0) {
+        uint64_t elapsed_ms = bluetooth::common::time_get_os_boottime_ms() -
+                              p_tcb->notif_first_sent_ms;
+        stream << "  notifications: " << p_tcb->notif_sent_count
+               << "  notification bytes queued: " << p_tcb->notif_sent_bytes;
+        if (elapsed_ms > 0) {
+          stream << "  notifications/s: "
+                 << p_tcb->notif_sent_count * 1000 / elapsed_ms;
+        }
+      }
       stream << "\n";
     }
   }
 
   dprintf(fd, "TCB (GATT_MAX_PHY_CHANNEL: %d) in_use: %d\n%s\n",
           GATT_MAX_PHY_CHANNEL, in_use_cnt, stream.str().c_str());
+  dprintf(fd, "Reads answered from static attribute values: %llu\n",
+          static_cast<unsigned long long>(gatt_cb.static_value_reads));
+  EattExtension::GetInstance()->Dump(fd);
 }
 
 /*******************************************************************************
@@ -475,6 +492,13 @@ void gatt_tcb_dump(int fd) {
  * Returns          GATT_INDEX_INVALID if not found. Otherwise index to the tcb.
  *
  ******************************************************************************/
+void gatt_update_tcb_gauge() {
+  static bluetooth::metrics::Gauge* tcbs =
+      bluetooth::metrics::CounterRegistry::Get().GetGauge("gatt.pool.tcbs");
+  tcbs->Set(std::count_if(std::begin(gatt_cb.tcb), std::end(gatt_cb.tcb),
+                          [](const tGATT_TCB& tcb) { return tcb.in_use; }));
+}
+
 tGATT_TCB* gatt_allocate_tcb_by_bdaddr(const RawAddress& bda,
                                        tBT_TRANSPORT transport) {
   /* search for existing tcb with matching bda    */
@@ -492,6 +516,7 @@ tGATT_TCB* gatt_allocate_tcb_by_bdaddr(const RawAddress& bda,
     p_tcb->conf_timer = alarm_new("gatt.conf_timer");
     p_tcb->ind_ack_timer = alarm_new("gatt.ind_ack_timer");
     p_tcb->in_use = true;
+    gatt_update_tcb_gauge();
     p_tcb->tcb_idx = i;
     p_tcb->transport = transport;
     p_tcb->peer_bda = bda;
@@ -807,25 +832,57 @@ void  gatt_ind_ack_timeout(void* data) {
    */
   attp_send_cl_confirmation_msg(*p_tcb, L2CAP_ATT_CID);
 }
+/*******************************************************************************
+ *
+ * Function         gatt_sr_update_srv_range_table
+ *
+ * Description      Rebuild the table of started services ordered by start
+ *                  handle. Called whenever services are added to or removed
+ *                  from the service list.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+void gatt_sr_update_srv_range_table() {
+  gatt_cb.srv_range_table.clear();
+  if (gatt_cb.srv_list_info == nullptr) return;
+
+  for (auto it = gatt_cb.srv_list_info->begin();
+       it != gatt_cb.srv_list_info->end(); it++) {
+    gatt_cb.srv_range_table.push_back(it);
+  }
+  std::stable_sort(gatt_cb.srv_range_table.begin(),
+                   gatt_cb.srv_range_table.end(),
+                   [](const auto& a, const auto& b) {
+                     return a->s_hdl < b->s_hdl;
+                   });
+}
+
 /*******************************************************************************
  *
  * Description      Search for a service that owns a specific handle.
  *
- * Returns          GATT_MAX_SR_PROFILES if not found. Otherwise the index of
- *                  the service.
+ * Returns          gatt_cb.srv_list_info->end() if not found. Otherwise the
+ *                  service.
  *
  ******************************************************************************/
 std::list<tGATT_SRV_LIST_ELEM>::iterator gatt_sr_find_i_rcb_by_handle(
     uint16_t handle) {
-  auto it = gatt_cb.srv_list_info->begin();
+  /* the list may have been filled without going through GATTS_StartService */
+  if (gatt_cb.srv_range_table.size() != gatt_cb.srv_list_info->size()) {
+    gatt_sr_update_srv_range_table();
+  }
 
-  for (; it != gatt_cb.srv_list_info->end(); it++) {
-    if (it->s_hdl <= handle && it->e_hdl >= handle) {
-      return it;
-    }
+  /* last service starting at or before the handle */
+  const auto& table = gatt_cb.srv_range_table;
+  auto pos = std::upper_bound(
+      table.begin(), table.end(), handle,
+      [](uint16_t handle, const auto& it) { return handle < it->s_hdl; });
+  if (pos != table.begin() && (*std::prev(pos))->e_hdl >= handle) {
+    return *std::prev(pos);
   }
 
-  return it;
+  return gatt_cb.srv_list_info->end();
 }
 
 /*******************************************************************************
@@ -1193,6 +1250,24 @@ uint16_t gatt_tcb_get_payload_size(tGATT_TCB& tcb, uint16_t cid) {
   return std::min<uint16_t>(channel->tx_mtu_, channel->rx_mtu_);
 }
 
+/*******************************************************************************
+ *
+ * Function         gatt_tcb_count_notification
+ *
+ * Description      This function accounts for a notification of len bytes of
+ *                  ATT PDU handed to L2CAP for the link
+ *
+ * Returns          None
+ *
+ ******************************************************************************/
+void gatt_tcb_count_notification(tGATT_TCB& tcb, uint16_t len) {
+  if (tcb.notif_sent_count == 0) {
+    tcb.notif_first_sent_ms = bluetooth::common::time_get_os_boottime_ms();
+  }
+  tcb.notif_sent_count++;
+  tcb.notif_sent_bytes += len;
+}
+
 /*******************************************************************************
  *
  * Function         gatt_clcb_dealloc
@@ -1760,6 +1835,12 @@ void gatt_cleanup_upon_disc(const RawAddress& bda, tGATT_DISCONN_REASON reason,
 
   gatt_set_ch_state(p_tcb, GATT_CH_CLOSE);
 
+  if (transport == BT_TRANSPORT_LE &&
+      !bluetooth::common::init_flags::
+          use_unified_connection_manager_is_enabled()) {
+    connection_manager::on_disconnected(bda);
+  }
+
   /* Notify EATT about disconnection. */
   EattExtension::GetInstance()->Disconnect(p_tcb->peer_bda);
 
@@ -1803,6 +1884,7 @@ void gatt_cleanup_upon_disc(const RawAddress& bda, tGATT_DISCONN_REASON reason,
   }
 
   *p_tcb = tGATT_TCB();
+  gatt_update_tcb_gauge();
   log::verbose("exit");
 }
 /*******************************************************************************
@@ -41,4 +41,8 @@ void a2dp_aac_decoder_cleanup(void);
 // if decoded frames are available.
 bool a2dp_aac_decoder_decode_packet(BT_HDR* p_buf);
 
+// Conceals the loss of the audio following the last decoded audio. Calls
+// |decode_callback| passed into |a2dp_aac_decoder_init| with the concealment audio.
+bool a2dp_aac_decoder_conceal(void);
+
 #endif  // A2DP_AAC_DECODER_H
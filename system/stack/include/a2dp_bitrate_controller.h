@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+//
+// Closed loop quality control of the A2DP Source encoders.
+//
+// The encoder quality is a level: level 0 is the configured quality, and each
+// next level encodes at a lower bitrate. The level is stepped down when the
+// link does not keep up with the encoder (the TX queue grows, queued packets
+// are dropped, or the failed contact counter of the link increases), and is
+// stepped back up once the link has kept up for a while.
+//
+
+#ifndef A2DP_BITRATE_CONTROLLER_H
+#define A2DP_BITRATE_CONTROLLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The number of levels of the encoders adjusting a target bitrate, see
+// a2dp_bitrate_controller_scale_bitrate().
+#define A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS 4
+
+typedef struct {
+  uint8_t num_levels;
+  uint8_t level;            // The current level, 0 being the highest quality
+  uint16_t congested_ticks;  // Consecutive ticks with a congested TX queue
+  uint16_t clear_ticks;      // Consecutive ticks with a runlevel TX queue
+  uint16_t holdoff_ticks;    // Ticks left before the level can step down
+  bool packets_dropped;      // Dropped packets were reported
+  bool failed_contacts;      // The failed contact counter increased
+  bool has_failed_contact_counter;
+  uint16_t failed_contact_counter;  // The last reported counter
+  size_t adjustments;               // The number of level changes
+} tA2DP_BITRATE_CONTROLLER;
+
+// Resets |p_controller| to level 0 of |num_levels| levels. With a single
+// level, the controller never changes the level.
+void a2dp_bitrate_controller_reset(tA2DP_BITRATE_CONTROLLER* p_controller,
+                                   uint8_t num_levels);
+
+// Updates |p_controller| once per encoder tick, |transmit_queue_length| being
+// the number of packets waiting in the TX queue.
+// Returns true if the level changed.
+bool a2dp_bitrate_controller_update(tA2DP_BITRATE_CONTROLLER* p_controller,
+                                    size_t transmit_queue_length);
+
+// Reports that |num_dropped| queued packets were dropped since the link did
+// not keep up. The level steps down on the next update, even if it just
+// stepped down.
+void a2dp_bitrate_controller_report_dropped_packets(
+    tA2DP_BITRATE_CONTROLLER* p_controller, size_t num_dropped);
+
+// Reports the failed contact counter of the link. If the counter increased
+// since the last report, the level steps down on the next update as it does
+// for a critical TX queue length.
+void a2dp_bitrate_controller_report_failed_contact_counter(
+    tA2DP_BITRATE_CONTROLLER* p_controller, uint16_t failed_contact_counter);
+
+// Returns |full_bitrate| scaled down for the current level of |p_controller|,
+// which must have A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS levels.
+uint32_t a2dp_bitrate_controller_scale_bitrate(
+    const tA2DP_BITRATE_CONTROLLER* p_controller, uint32_t full_bitrate);
+
+// Gets the controller shared by the A2DP Source encoders. It is only used
+// from the A2DP Source worker thread.
+tA2DP_BITRATE_CONTROLLER* a2dp_source_bitrate_controller(void);
+
+#endif  // A2DP_BITRATE_CONTROLLER_H
@@ -576,6 +576,11 @@ typedef struct {
 
   // A2DP decoder configuration.
   void (*decoder_configure)(const uint8_t* p_codec_info);
+
+  // Conceals the loss of the audio following the last decoded audio, and
+  // calls |decode_callback| passed into init with the concealment audio.
+  // Returns false if nothing could be concealed.
+  bool (*decoder_conceal)();
 } tA2DP_DECODER_INTERFACE;
 
 // Gets the A2DP codec type.
@@ -0,0 +1,66 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+//
+// Closed loop complexity control of the A2DP Source encoders.
+//
+// The encoder complexity is a level: level 0 is the configured complexity,
+// and each next level is cheaper to encode. The time spent encoding each
+// encoder tick is compared to the media interval of the tick. The level is
+// stepped down when encoding uses most of the interval, or right away when a
+// tick misses its deadline, and is stepped back up once encoding has used
+// little of the interval for a while.
+//
+
+#ifndef A2DP_ENCODER_LOAD_CONTROLLER_H
+#define A2DP_ENCODER_LOAD_CONTROLLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  uint8_t num_levels;
+  uint8_t level;             // The current level, 0 being the most complex
+  uint32_t interval_us;      // The media interval of an encoder tick
+  uint16_t overloaded_ticks;  // Consecutive ticks using most of the interval
+  uint16_t idle_ticks;        // Consecutive ticks using little of it
+  uint16_t holdoff_ticks;     // Ticks left before the level can step down
+  uint32_t last_encode_us;    // Encode time of the last tick
+  uint32_t max_encode_us;     // Longest encode time of a tick
+  size_t deadline_misses;     // Ticks encoded in more than the interval
+  size_t adjustments;         // The number of level changes
+} tA2DP_ENCODER_LOAD_CONTROLLER;
+
+// Resets |p_controller| to level 0 of |num_levels| levels, for encoder ticks
+// of |interval_us|. With a single level, the controller never changes the
+// level but still counts the deadline misses.
+void a2dp_encoder_load_controller_reset(
+    tA2DP_ENCODER_LOAD_CONTROLLER* p_controller, uint8_t num_levels,
+    uint32_t interval_us);
+
+// Updates |p_controller| once per encoder tick, |encode_us| being the time
+// spent encoding the tick.
+// Returns true if the level changed.
+bool a2dp_encoder_load_controller_update(
+    tA2DP_ENCODER_LOAD_CONTROLLER* p_controller, uint32_t encode_us);
+
+// Gets the controller shared by the A2DP Source encoders. It is only used
+// from the A2DP Source worker thread.
+tA2DP_ENCODER_LOAD_CONTROLLER* a2dp_source_encoder_load_controller(void);
+
+#endif  // A2DP_ENCODER_LOAD_CONTROLLER_H
@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+//
+// Adaptive jitter buffer of the A2DP Sink.
+//
+// The jitter buffer tracks the arrival times of the received media packets,
+// and sizes the number of packets to buffer before the playout from the
+// observed arrival jitter. During the playout, the decoder tick is given a
+// budget of audio to produce: the queued packets are decoded until the budget
+// is used, and the missing audio is concealed when the queue runs empty.
+//
+
+#ifndef A2DP_JITTER_BUFFER_H
+#define A2DP_JITTER_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The number of packets buffered before the playout, until enough packets
+// were received to estimate the jitter.
+#define A2DP_JITTER_BUFFER_DEFAULT_DEPTH 5
+
+// The least number of packets buffered before the playout.
+#define A2DP_JITTER_BUFFER_MIN_DEPTH 2
+
+typedef struct {
+  // Configuration
+  uint32_t tick_us;  // The decoder tick period
+  size_t max_depth;  // The capacity of the packet queue
+
+  // Arrival jitter estimation
+  bool has_last_arrival;
+  uint64_t last_arrival_us;
+  size_t num_intervals;       // The number of measured arrival intervals
+  uint32_t mean_interval_us;  // The mean packet arrival interval
+  uint32_t jitter_us;         // The mean deviation from |mean_interval_us|
+
+  // Playout
+  bool playing;             // False while buffering before the playout
+  int64_t budget_us;        // Audio left to produce in this tick
+  bool in_underrun;         // No packet was decoded since the queue ran empty
+  uint32_t underrun_us;     // Audio missing since the queue ran empty
+  size_t window_ticks;      // Ticks in the current latency window
+  size_t window_min_depth;  // The least queue depth of the window
+
+  // Statistics
+  size_t packets_received;
+  size_t max_queue_depth;
+  size_t underruns;
+  size_t concealed_frames;
+  uint64_t concealed_us;
+  size_t dropped_packets;
+} tA2DP_JITTER_BUFFER;
+
+// Resets |p_jitter_buffer| and its statistics. |tick_us| is the period of the
+// decoder tick, and |max_depth| the capacity of the packet queue.
+void a2dp_jitter_buffer_reset(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                              uint32_t tick_us, size_t max_depth);
+
+// Restarts the buffering after the queued packets were flushed. The arrival
+// interval across a flush is not a measure of the jitter, and is skipped.
+void a2dp_jitter_buffer_flush(tA2DP_JITTER_BUFFER* p_jitter_buffer);
+
+// Records the arrival of a packet at |arrival_us|, |queue_depth| being the
+// number of queued packets including this one.
+void a2dp_jitter_buffer_on_arrival(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                   uint64_t arrival_us, size_t queue_depth);
+
+// Gets the number of packets to buffer before the playout: one decoder tick
+// and four times the arrival jitter worth of packets.
+size_t a2dp_jitter_buffer_target_depth(
+    const tA2DP_JITTER_BUFFER* p_jitter_buffer);
+
+// Starts a decoder tick with |queue_depth| queued packets.
+// Returns the number of the oldest packets to drop so the latency does not
+// build up, and sets |*p_play| to true if audio is to be produced during this
+// tick, or false if the packets are still being buffered.
+size_t a2dp_jitter_buffer_on_tick(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                  size_t queue_depth, bool* p_play);
+
+// Returns true if more audio is to be produced during the current tick.
+bool a2dp_jitter_buffer_needs_audio(
+    const tA2DP_JITTER_BUFFER* p_jitter_buffer);
+
+// Records that a packet was decoded into |duration_us| of audio.
+void a2dp_jitter_buffer_on_decoded(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                   uint32_t duration_us);
+
+// Called when audio is needed but the packet queue is empty.
+// Returns true if the missing audio is to be concealed, or false if the
+// buffering restarts since the queue has been empty for too long.
+bool a2dp_jitter_buffer_on_underrun(tA2DP_JITTER_BUFFER* p_jitter_buffer);
+
+// Records that a frame of |duration_us| of audio was concealed. With no
+// concealed audio, the rest of the tick budget is given up.
+void a2dp_jitter_buffer_on_concealed(tA2DP_JITTER_BUFFER* p_jitter_buffer,
+                                     uint32_t duration_us);
+
+#endif  // A2DP_JITTER_BUFFER_H
@@ -0,0 +1,58 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 The Android Open Source Project
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+//
+// Media packet buffers of the A2DP Source encoders.
+//
+// The encoders write the media payload of a packet right behind enough
+// headroom for all the headers that are prepended to it on its way to HCI:
+// the codec media payload header, the content protection header, the RTP
+// header, the L2CAP header and the HCI ACL preamble. Each layer prepends its
+// header in place, so the payload is not copied between the encoder and the
+// HCI layer.
+//
+
+#ifndef A2DP_MEDIA_BUFFER_H
+#define A2DP_MEDIA_BUFFER_H
+
+#include <stdint.h>
+
+#include "internal_include/bt_target.h"
+#include "stack/include/avdt_api.h"
+#include "stack/include/bt_hdr.h"
+
+// The size of the media packet buffers, including the BT_HDR.
+#define A2DP_MEDIA_BUFFER_SIZE BT_DEFAULT_BUFFER_SIZE
+
+// The headroom reserved in front of the codec media payload header.
+#define A2DP_MEDIA_BUFFER_HEADROOM AVDT_MEDIA_OFFSET
+
+// The size of the content protection header (SCMS-T).
+#define A2DP_MEDIA_BUFFER_CP_HDR_LEN 1
+
+// The maximum payload size of a media packet buffer, given the offset of the
+// payload: A2DP_MEDIA_BUFFER_HEADROOM plus the codec media payload header.
+#define A2DP_MEDIA_BUFFER_MAX_PAYLOAD(payload_offset) \
+  (A2DP_MEDIA_BUFFER_SIZE - (payload_offset) - sizeof(BT_HDR))
+
+// Allocates an empty media packet buffer, its payload starting at
+// |payload_offset| that must be at least A2DP_MEDIA_BUFFER_HEADROOM.
+// The buffer is released with osi_free() like every other BT_HDR.
+BT_HDR* a2dp_media_buffer_alloc(uint16_t payload_offset);
+
+#endif  // A2DP_MEDIA_BUFFER_H
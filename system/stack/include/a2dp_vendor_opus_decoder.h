@@ -33,6 +33,11 @@ void a2dp_vendor_opus_decoder_cleanup(void);
 // |a2dp_vendor_opus_decoder_init| if decoded frames are available.
 bool a2dp_vendor_opus_decoder_decode_packet(BT_HDR* p_buf);
 
+// Conceals the loss of the audio following the last decoded audio. Calls
+// |decode_callback| passed into |a2dp_vendor_opus_decoder_init| with the
+// concealment audio.
+bool a2dp_vendor_opus_decoder_conceal(void);
+
 // Start the A2DP Opus decoder.
 void a2dp_vendor_opus_decoder_start(void);
 
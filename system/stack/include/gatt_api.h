@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "btm_ble_api.h"
 #include "gattdefs.h"
@@ -889,6 +890,29 @@ bool GATTS_DeleteService(tGATT_IF gatt_if, bluetooth::Uuid* p_svc_uuid,
  ******************************************************************************/
 void GATTS_StopService(uint16_t service_handle);
 
+/*******************************************************************************
+ *
+ * Function         GATTS_SetStaticAttributeValue
+ *
+ * Description      This function sets the value of a characteristic or
+ *                  descriptor that never changes, such as a device name or a
+ *                  presentation format. Read requests for the attribute are
+ *                  then answered by the stack after the usual permission
+ *                  checks, without a round trip to the application.
+ *
+ * Parameter        attr_handle: handle of the attribute.
+ *                  p_value: new value, or nullptr to let the application
+ *                           answer read requests again.
+ *                  len: length of the value.
+ *
+ * Returns          GATT_SUCCESS if the value was set, GATT_INVALID_HANDLE if
+ *                  the attribute does not exist.
+ *
+ ******************************************************************************/
+tGATT_STATUS GATTS_SetStaticAttributeValue(uint16_t attr_handle,
+                                           const uint8_t* p_value,
+                                           uint16_t len);
+
 /*******************************************************************************
  *
  * Function         GATTs_HandleValueIndication
@@ -927,6 +951,29 @@ tGATT_STATUS GATTS_HandleValueNotification(uint16_t conn_id,
                                            uint16_t attr_handle,
                                            uint16_t val_len, uint8_t* p_val);
 
+/*******************************************************************************
+ *
+ * Function         GATTS_HandleValueNotificationMulti
+ *
+ * Description      This function sends the same handle value notification to
+ *                  several clients. The ATT PDU is built once for every
+ *                  distinct payload size among the links, and copied for each
+ *                  of them.
+ *
+ * Parameter        conn_ids: connection identifiers of the clients.
+ *                  attr_handle: Attribute handle of this handle value
+ *                               notification.
+ *                  val_len: Length of the notified attribute value.
+ *                  p_val: Pointer to the notified attribute value data.
+ *
+ * Returns          One status per connection identifier, as returned by
+ *                  GATTS_HandleValueNotification.
+ *
+ ******************************************************************************/
+std::vector<tGATT_STATUS> GATTS_HandleValueNotificationMulti(
+    const std::vector<uint16_t>& conn_ids, uint16_t attr_handle,
+    uint16_t val_len, uint8_t* p_val);
+
 /*******************************************************************************
  *
  * Function         GATTS_SendRsp
@@ -33,6 +33,7 @@
 #include "hcidefs.h"
 #include "internal_include/bt_target.h"
 #include "l2cdefs.h"
+#include "osi/include/fixed_queue.h"
 #include "stack/include/bt_hdr.h"
 #include "types/bt_transport.h"
 #include "types/hci_role.h"
@@ -255,6 +256,13 @@ typedef void(tL2CA_DISCONNECT_CFM_CB)(uint16_t, uint16_t);
  */
 typedef void(tL2CA_DATA_IND_CB)(uint16_t, BT_HDR*);
 
+/* Segmented data indication callback prototype. Parameters are
+ *              Local CID
+ *              Segments of one received SDU, in order. The callee takes the
+ *              buffers out of the queue and owns them.
+ */
+typedef void(tL2CA_SEGMENTED_DATA_IND_CB)(uint16_t, fixed_queue_t*);
+
 /* Congestion status callback protype. This callback is optional. If
  * an application tries to send data when the transmit queue is full,
  * the data will anyways be dropped. The parameter is:
@@ -343,6 +351,10 @@ typedef struct {
   tL2CA_CREDIT_BASED_RECONFIG_COMPLETED_CB*
       pL2CA_CreditBasedReconfigCompleted_Cb;
   tL2CA_CREDIT_BASED_COLLISION_IND_CB* pL2CA_CreditBasedCollisionInd_Cb;
+  /* Optional. When set, SDUs segmented by ERTM or streaming mode are passed
+   * up as the chain of their segments instead of being copied into a single
+   * buffer for pL2CA_DataInd_Cb. */
+  tL2CA_SEGMENTED_DATA_IND_CB* pL2CA_SegmentedDataInd_Cb;
 } tL2CAP_APPL_INFO;
 
 /* Define the structure that applications use to create or accept
@@ -862,6 +874,13 @@ void L2CA_AdjustConnectionIntervals(uint16_t* min_interval,
  */
 bool L2CA_IsLinkEstablished(const RawAddress& bd_addr, tBT_TRANSPORT transport);
 
+/**
+ * Get the number of bytes sent and received on the open channels of an ACL or
+ * LE link, 0 if there is no link to the remote device
+ */
+uint64_t L2CA_GetLinkTrafficBytes(const RawAddress& bd_addr,
+                                  tBT_TRANSPORT transport);
+
 /*******************************************************************************
  *
  *  Function        L2CA_SetDefaultSubrate
@@ -46,3 +46,6 @@ void l2c_link_segments_xmitted(BT_HDR* p_msg);
 void l2cu_resubmit_pending_sec_req(const RawAddress* p_bda);
 
 void l2c_packets_completed(uint16_t handle, uint16_t num_sent);
+
+// Number of links with high priority traffic, such as an A2DP stream
+uint8_t l2cu_get_num_hi_priority(void);
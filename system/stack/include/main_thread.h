@@ -23,10 +23,17 @@
 #include "common/message_loop_thread.h"
 #include "include/hardware/bluetooth.h"
 
+namespace bluetooth::os {
+class Thread;
+}  // namespace bluetooth::os
+
 using BtMainClosure = std::function<void()>;
 using bluetooth::common::MessageLoopThread;
 
 bluetooth::common::MessageLoopThread* get_main_thread();
+// Returns the gd reactor thread the main thread runs on when it is merged with
+// the gd stack thread, nullptr otherwise.
+bluetooth::os::Thread* get_merged_main_thread();
 bt_status_t do_in_main_thread(const base::Location& from_here,
                               base::OnceClosure task);
 bt_status_t do_in_main_thread_delayed(const base::Location& from_here,
@@ -1643,6 +1643,19 @@ bool L2CA_IsLinkEstablished(const RawAddress& bd_addr,
   return l2cu_find_lcb_by_bd_addr(bd_addr, transport) != nullptr;
 }
 
+uint64_t L2CA_GetLinkTrafficBytes(const RawAddress& bd_addr,
+                                  tBT_TRANSPORT transport) {
+  tL2C_LCB* p_lcb = l2cu_find_lcb_by_bd_addr(bd_addr, transport);
+  if (p_lcb == nullptr) return 0;
+
+  uint64_t bytes = 0;
+  for (tL2C_CCB* p_ccb = p_lcb->ccb_queue.p_first_ccb; p_ccb != nullptr;
+       p_ccb = p_ccb->p_next_ccb) {
+    bytes += p_ccb->metrics.rx.bytes + p_ccb->metrics.tx.bytes;
+  }
+  return bytes;
+}
+
 /*******************************************************************************
 **
 ** Function         L2CA_SetMediaStreamChannel
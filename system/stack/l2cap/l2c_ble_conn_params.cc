@@ -32,6 +32,8 @@
 #include "internal_include/stack_config.h"
 #include "main/shim/acl_api.h"
 #include "os/log.h"
+#include "osi/include/alarm.h"
+#include "osi/include/properties.h"
 #include "stack/btm/btm_dev.h"
 #include "stack/include/acl_api.h"
 #include "stack/include/btm_ble_api_types.h"
@@ -43,6 +45,7 @@ using namespace bluetooth;
 
 void l2cble_start_conn_update(tL2C_LCB* p_lcb);
 static void l2cble_start_subrate_change(tL2C_LCB* p_lcb);
+static void l2cble_traffic_conn_params_forget(tL2C_LCB* p_lcb);
 
 /*******************************************************************************
  *
@@ -80,6 +83,9 @@ bool L2CA_UpdateBleConnParams(const RawAddress& rem_bda, uint16_t min_int,
       ADDRESS_TO_LOGGABLE_STR(rem_bda), min_int, max_int, min_ce_len,
       max_ce_len);
 
+  /* Parameters requested by a profile win over the traffic driven ones */
+  l2cble_traffic_conn_params_forget(p_lcb);
+
   p_lcb->min_interval = min_int;
   p_lcb->max_interval = max_int;
   p_lcb->latency = latency;
@@ -570,3 +576,168 @@ void l2cble_process_subrate_change_evt(uint16_t handle, uint8_t status,
   log::verbose("conn_update_mask={} , subrate_req_mask={}",
                p_lcb->conn_update_mask, p_lcb->subrate_req_mask);
 }
+
+/* Length of the window over which link traffic is measured */
+constexpr uint64_t kTrafficWindowMs = 1000;
+/* Bytes per window above which a link is moved to the fast parameters */
+constexpr uint32_t kTrafficBusyBytes = 4096;
+/* Idle windows after which a fast link is moved back to its parameters */
+constexpr uint8_t kTrafficIdleWindowsToRelax = 5;
+
+static bool l2cble_traffic_conn_params_enabled() {
+  static const bool enabled = osi_property_get_bool(
+      "bluetooth.core.le.traffic_conn_params_enabled", false);
+  return enabled;
+}
+
+static void l2cble_traffic_conn_params_timeout(void* data);
+
+/*******************************************************************************
+ *
+ * Function         l2cble_traffic_conn_params_to_fast
+ *
+ * Description      Save the current connection and subrate parameters of the
+ *                  link and request the fastest interval with no subrating.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+static void l2cble_traffic_conn_params_to_fast(tL2C_LCB* p_lcb) {
+  auto& traffic = p_lcb->traffic_conn_params;
+
+  /* Locked links already run on the fastest parameters */
+  if (p_lcb->conn_update_mask & L2C_BLE_CONN_UPDATE_DISABLE) return;
+
+  uint16_t min_conn_int = BTM_BLE_CONN_INT_MIN;
+  uint16_t max_conn_int = BTM_BLE_CONN_INT_MIN;
+  L2CA_AdjustConnectionIntervals(&min_conn_int, &max_conn_int,
+                                 BTM_BLE_CONN_INT_MIN);
+  if (p_lcb->max_interval <= max_conn_int && p_lcb->latency == 0) return;
+
+  log::info("{} busy, moving to fast connection parameters",
+            ADDRESS_TO_LOGGABLE_CSTR(p_lcb->remote_bd_addr));
+
+  traffic.fast = true;
+  traffic.fast_count++;
+  traffic.saved_min_interval = p_lcb->min_interval;
+  traffic.saved_max_interval = p_lcb->max_interval;
+  traffic.saved_latency = p_lcb->latency;
+  traffic.saved_timeout = p_lcb->timeout;
+  traffic.saved_subrate_min = p_lcb->subrate_min;
+  traffic.saved_subrate_max = p_lcb->subrate_max;
+
+  p_lcb->min_interval = min_conn_int;
+  p_lcb->max_interval = max_conn_int;
+  p_lcb->latency = BTM_BLE_CONN_PERIPHERAL_LATENCY_DEF;
+  p_lcb->timeout = BTM_BLE_CONN_TIMEOUT_DEF;
+  p_lcb->conn_update_mask |= L2C_BLE_NEW_CONN_PARAM;
+  l2cble_start_conn_update(p_lcb);
+
+  if (p_lcb->subrate_max > 1) {
+    p_lcb->subrate_min = p_lcb->subrate_max = 1;
+    p_lcb->subrate_req_mask |= L2C_BLE_NEW_SUBRATE_PARAM;
+    l2cble_start_subrate_change(p_lcb);
+  }
+}
+
+/*******************************************************************************
+ *
+ * Function         l2cble_traffic_conn_params_to_relaxed
+ *
+ * Description      Restore the parameters the link had before it was moved to
+ *                  the fast parameters.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+static void l2cble_traffic_conn_params_to_relaxed(tL2C_LCB* p_lcb) {
+  auto& traffic = p_lcb->traffic_conn_params;
+
+  log::info("{} idle, restoring connection parameters",
+            ADDRESS_TO_LOGGABLE_CSTR(p_lcb->remote_bd_addr));
+
+  traffic.fast = false;
+  traffic.relaxed_count++;
+
+  p_lcb->min_interval = traffic.saved_min_interval;
+  p_lcb->max_interval = traffic.saved_max_interval;
+  p_lcb->latency = traffic.saved_latency;
+  p_lcb->timeout = traffic.saved_timeout;
+  p_lcb->conn_update_mask |= L2C_BLE_NEW_CONN_PARAM;
+  l2cble_start_conn_update(p_lcb);
+
+  if (traffic.saved_subrate_max > 1) {
+    p_lcb->subrate_min = traffic.saved_subrate_min;
+    p_lcb->subrate_max = traffic.saved_subrate_max;
+    p_lcb->subrate_req_mask |= L2C_BLE_NEW_SUBRATE_PARAM;
+    l2cble_start_subrate_change(p_lcb);
+  }
+}
+
+/* Drop the saved parameters, the link keeps whatever it is set to now */
+static void l2cble_traffic_conn_params_forget(tL2C_LCB* p_lcb) {
+  p_lcb->traffic_conn_params.fast = false;
+  p_lcb->traffic_conn_params.idle_windows = 0;
+}
+
+/*******************************************************************************
+ *
+ * Function         l2cble_traffic_conn_params_record
+ *
+ * Description      Account for |bytes| sent or received on an LE link. Links
+ *                  with more than kTrafficBusyBytes in a window, or with data
+ *                  still queued at the end of one, are moved to the fast
+ *                  parameters. They are moved back after
+ *                  kTrafficIdleWindowsToRelax quieter windows in a row.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+void l2cble_traffic_conn_params_record(tL2C_LCB* p_lcb, uint16_t bytes) {
+  if (!l2cble_traffic_conn_params_enabled()) return;
+  if (stack_config_get_interface()->get_pts_conn_updates_disabled()) return;
+
+  auto& traffic = p_lcb->traffic_conn_params;
+  traffic.window_bytes += bytes;
+  if (!alarm_is_scheduled(traffic.timer)) {
+    alarm_set_on_mloop(traffic.timer, kTrafficWindowMs,
+                       l2cble_traffic_conn_params_timeout, p_lcb);
+  }
+
+  /* React to the start of a burst without waiting for the window to end */
+  if (!traffic.fast && traffic.window_bytes >= kTrafficBusyBytes) {
+    l2cble_traffic_conn_params_to_fast(p_lcb);
+  }
+}
+
+static void l2cble_traffic_conn_params_timeout(void* data) {
+  tL2C_LCB* p_lcb = (tL2C_LCB*)data;
+  auto& traffic = p_lcb->traffic_conn_params;
+
+  if (!p_lcb->in_use ||
+      !BTM_IsAclConnectionUp(p_lcb->remote_bd_addr, BT_TRANSPORT_LE)) {
+    return;
+  }
+
+  bool busy = traffic.window_bytes >= kTrafficBusyBytes ||
+              !list_is_empty(p_lcb->link_xmit_data_q);
+  traffic.window_bytes = 0;
+
+  if (busy) {
+    traffic.idle_windows = 0;
+    if (!traffic.fast) l2cble_traffic_conn_params_to_fast(p_lcb);
+  } else if (traffic.idle_windows < kTrafficIdleWindowsToRelax) {
+    traffic.idle_windows++;
+  }
+
+  if (traffic.fast && traffic.idle_windows >= kTrafficIdleWindowsToRelax) {
+    traffic.idle_windows = 0;
+    l2cble_traffic_conn_params_to_relaxed(p_lcb);
+  }
+
+  /* Fast links are watched until they relax, idle links wait for traffic */
+  if (traffic.fast) {
+    alarm_set_on_mloop(traffic.timer, kTrafficWindowMs,
+                       l2cble_traffic_conn_params_timeout, p_lcb);
+  }
+}
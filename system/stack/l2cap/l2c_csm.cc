@@ -30,6 +30,7 @@
 
 #include <string>
 
+#include "common/time_util.h"
 #include "hal/snoop_logger.h"
 #include "internal_include/bt_target.h"
 #include "main/shim/entry.h"
@@ -1473,6 +1474,12 @@ static void l2c_csm_open(tL2C_CCB* p_ccb, tL2CEVT event, void* p_data) {
           l2cble_send_peer_disc_req(p_ccb);
         } else {
           p_ccb->peer_conn_cfg.credits += credit;
+          if (p_ccb->credit_starvation.since_ms != 0) {
+            p_ccb->credit_starvation.total_ms +=
+                bluetooth::common::time_get_os_boottime_ms() -
+                p_ccb->credit_starvation.since_ms;
+            p_ccb->credit_starvation.since_ms = 0;
+          }
           l2c_link_check_send_pkts(p_ccb->p_lcb, 0, NULL);
         }
       }
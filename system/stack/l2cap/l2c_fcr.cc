@@ -31,6 +31,7 @@
 
 #include "include/check.h"
 #include "internal_include/bt_target.h"
+#include "l2cap/fcs.h"
 #include "os/log.h"
 #include "osi/include/allocator.h"
 #include "stack/include/bt_hdr.h"
@@ -52,39 +53,6 @@ static const char* SAR_types[] = {"Unsegmented", "Start", "End",
                                   "Continuation"};
 static const char* SUP_types[] = {"RR", "REJ", "RNR", "SREJ"};
 
-/* Look-up table for the CRC calculation */
-static const unsigned short crctab[256] = {
-    0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241, 0xc601,
-    0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440, 0xcc01, 0x0cc0,
-    0x0d80, 0xcd41, 0x0f00, 0xcfc1, 0xce81, 0x0e40, 0x0a00, 0xcac1, 0xcb81,
-    0x0b40, 0xc901, 0x09c0, 0x0880, 0xc841, 0xd801, 0x18c0, 0x1980, 0xd941,
-    0x1b00, 0xdbc1, 0xda81, 0x1a40, 0x1e00, 0xdec1, 0xdf81, 0x1f40, 0xdd01,
-    0x1dc0, 0x1c80, 0xdc41, 0x1400, 0xd4c1, 0xd581, 0x1540, 0xd701, 0x17c0,
-    0x1680, 0xd641, 0xd201, 0x12c0, 0x1380, 0xd341, 0x1100, 0xd1c1, 0xd081,
-    0x1040, 0xf001, 0x30c0, 0x3180, 0xf141, 0x3300, 0xf3c1, 0xf281, 0x3240,
-    0x3600, 0xf6c1, 0xf781, 0x3740, 0xf501, 0x35c0, 0x3480, 0xf441, 0x3c00,
-    0xfcc1, 0xfd81, 0x3d40, 0xff01, 0x3fc0, 0x3e80, 0xfe41, 0xfa01, 0x3ac0,
-    0x3b80, 0xfb41, 0x3900, 0xf9c1, 0xf881, 0x3840, 0x2800, 0xe8c1, 0xe981,
-    0x2940, 0xeb01, 0x2bc0, 0x2a80, 0xea41, 0xee01, 0x2ec0, 0x2f80, 0xef41,
-    0x2d00, 0xedc1, 0xec81, 0x2c40, 0xe401, 0x24c0, 0x2580, 0xe541, 0x2700,
-    0xe7c1, 0xe681, 0x2640, 0x2200, 0xe2c1, 0xe381, 0x2340, 0xe101, 0x21c0,
-    0x2080, 0xe041, 0xa001, 0x60c0, 0x6180, 0xa141, 0x6300, 0xa3c1, 0xa281,
-    0x6240, 0x6600, 0xa6c1, 0xa781, 0x6740, 0xa501, 0x65c0, 0x6480, 0xa441,
-    0x6c00, 0xacc1, 0xad81, 0x6d40, 0xaf01, 0x6fc0, 0x6e80, 0xae41, 0xaa01,
-    0x6ac0, 0x6b80, 0xab41, 0x6900, 0xa9c1, 0xa881, 0x6840, 0x7800, 0xb8c1,
-    0xb981, 0x7940, 0xbb01, 0x7bc0, 0x7a80, 0xba41, 0xbe01, 0x7ec0, 0x7f80,
-    0xbf41, 0x7d00, 0xbdc1, 0xbc81, 0x7c40, 0xb401, 0x74c0, 0x7580, 0xb541,
-    0x7700, 0xb7c1, 0xb681, 0x7640, 0x7200, 0xb2c1, 0xb381, 0x7340, 0xb101,
-    0x71c0, 0x7080, 0xb041, 0x5000, 0x90c1, 0x9181, 0x5140, 0x9301, 0x53c0,
-    0x5280, 0x9241, 0x9601, 0x56c0, 0x5780, 0x9741, 0x5500, 0x95c1, 0x9481,
-    0x5440, 0x9c01, 0x5cc0, 0x5d80, 0x9d41, 0x5f00, 0x9fc1, 0x9e81, 0x5e40,
-    0x5a00, 0x9ac1, 0x9b81, 0x5b40, 0x9901, 0x59c0, 0x5880, 0x9841, 0x8801,
-    0x48c0, 0x4980, 0x8941, 0x4b00, 0x8bc1, 0x8a81, 0x4a40, 0x4e00, 0x8ec1,
-    0x8f81, 0x4f40, 0x8d01, 0x4dc0, 0x4c80, 0x8c41, 0x4400, 0x84c1, 0x8581,
-    0x4540, 0x8701, 0x47c0, 0x4680, 0x8641, 0x8201, 0x42c0, 0x4380, 0x8341,
-    0x4100, 0x81c1, 0x8081, 0x4040,
-};
-
 /*******************************************************************************
  *  Static local functions
 */
@@ -102,22 +70,15 @@ static bool do_sar_reassembly(tL2C_CCB* p_ccb, BT_HDR* p_buf,
  *
  * Function         l2c_fcr_updcrc
  *
- * Description      This function computes the CRC using the look-up table.
+ * Description      This function computes the CRC using the shared slicing-by-8
+ *                  implementation of the gd stack.
  *
  * Returns          CRC
  *
  ******************************************************************************/
 static unsigned short l2c_fcr_updcrc(unsigned short icrc, unsigned char* icp,
                                      int icnt) {
-  unsigned short crc = icrc;
-  unsigned char* cp = icp;
-  int cnt = icnt;
-
-  while (cnt--) {
-    crc = ((crc >> 8) & 0xff) ^ crctab[(crc & 0xff) ^ *cp++];
-  }
-
-  return (crc);
+  return bluetooth::l2cap::Fcs::Compute(icrc, icp, icnt);
 }
 
 /*******************************************************************************
@@ -216,6 +177,9 @@ void l2c_fcr_cleanup(tL2C_CCB* p_ccb) {
 
   osi_free_and_reset((void**)&p_fcrb->p_rx_sdu);
 
+  fixed_queue_free(p_fcrb->rx_sdu_segments, osi_free);
+  p_fcrb->rx_sdu_segments = NULL;
+
   fixed_queue_free(p_fcrb->waiting_for_ack_q, osi_free);
   p_fcrb->waiting_for_ack_q = NULL;
 
@@ -1149,6 +1113,49 @@ static void process_i_frame(tL2C_CCB* p_ccb, BT_HDR* p_buf, uint16_t ctrl_word,
   }
 }
 
+/*******************************************************************************
+ *
+ * Function         sar_keeps_segments
+ *
+ * Description      Checks if the upper layer of the channel takes the segments
+ *                  of an SDU as they were received, so that they do not have
+ *                  to be copied into a single buffer
+ *
+ * Returns          true if the segments are passed up as a chain
+ *
+ ******************************************************************************/
+static bool sar_keeps_segments(tL2C_CCB* p_ccb) {
+  if (p_ccb->local_cid < L2CAP_BASE_APPL_CID) return false;
+
+  return (p_ccb->p_rcb != NULL) &&
+         (p_ccb->p_rcb->api.pL2CA_SegmentedDataInd_Cb != NULL);
+}
+
+/*******************************************************************************
+ *
+ * Function         deliver_sdu_segments
+ *
+ * Description      Pass the segments of a complete SDU up to the application
+ *
+ * Returns          -
+ *
+ ******************************************************************************/
+static void deliver_sdu_segments(tL2C_CCB* p_ccb) {
+  tL2C_FCRB* p_fcrb = &p_ccb->fcrb;
+
+  if (p_ccb->chnl_state == CST_OPEN) {
+    p_ccb->metrics.rx(p_fcrb->rx_sdu_segments_len);
+    (*p_ccb->p_rcb->api.pL2CA_SegmentedDataInd_Cb)(p_ccb->local_cid,
+                                                   p_fcrb->rx_sdu_segments);
+  }
+
+  /* Drop whatever the application did not take */
+  p_fcrb->rx_sdu_segments_len = 0;
+  while (!fixed_queue_is_empty(p_fcrb->rx_sdu_segments)) {
+    osi_free(fixed_queue_try_dequeue(p_fcrb->rx_sdu_segments));
+  }
+}
+
 /*******************************************************************************
  *
  * Function         do_sar_reassembly
@@ -1168,13 +1175,20 @@ static bool do_sar_reassembly(tL2C_CCB* p_ccb, BT_HDR* p_buf,
   bool packet_ok = true;
   uint8_t* p;
 
+  /* The SDU being received is either copied into p_rx_sdu as its segments
+   * arrive, or kept as a chain of segments in rx_sdu_segments */
+  bool sdu_in_progress = (p_fcrb->p_rx_sdu != NULL) ||
+                         !fixed_queue_is_empty(p_fcrb->rx_sdu_segments);
+  uint16_t rx_len = (p_fcrb->p_rx_sdu != NULL) ? p_fcrb->p_rx_sdu->len
+                                               : p_fcrb->rx_sdu_segments_len;
+
   /* Check if the SAR state is correct */
   if ((sar_type == L2CAP_FCR_UNSEG_SDU) || (sar_type == L2CAP_FCR_START_SDU)) {
-    if (p_fcrb->p_rx_sdu != NULL) {
+    if (sdu_in_progress) {
       log::warn(
           "SAR - got unexpected unsegmented or start SDU  Expected len: {}  "
           "Got so far: {}",
-          p_fcrb->rx_sdu_len, p_fcrb->p_rx_sdu->len);
+          p_fcrb->rx_sdu_len, rx_len);
 
       packet_ok = false;
     }
@@ -1185,7 +1199,7 @@ static bool do_sar_reassembly(tL2C_CCB* p_ccb, BT_HDR* p_buf,
       packet_ok = false;
     }
   } else {
-    if (p_fcrb->p_rx_sdu == NULL) {
+    if (!sdu_in_progress) {
       log::warn("SAR - got unexpected cont or end SDU");
       packet_ok = false;
     }
@@ -1205,6 +1219,11 @@ static bool do_sar_reassembly(tL2C_CCB* p_ccb, BT_HDR* p_buf,
         log::warn("SAR - SDU len: {}  larger than MTU: {}", p_fcrb->rx_sdu_len,
                   p_ccb->max_rx_mtu);
         packet_ok = false;
+      } else if (sar_keeps_segments(p_ccb)) {
+        if (p_fcrb->rx_sdu_segments == NULL) {
+          p_fcrb->rx_sdu_segments = fixed_queue_new(SIZE_MAX);
+        }
+        p_fcrb->rx_sdu_segments_len = 0;
       } else {
         p_fcrb->p_rx_sdu = (BT_HDR*)osi_malloc(
             BT_HDR_SIZE + OBX_BUF_MIN_OFFSET + p_fcrb->rx_sdu_len);
@@ -1214,16 +1233,24 @@ static bool do_sar_reassembly(tL2C_CCB* p_ccb, BT_HDR* p_buf,
     }
 
     if (packet_ok) {
-      if ((p_fcrb->p_rx_sdu->len + p_buf->len) > p_fcrb->rx_sdu_len) {
+      if ((rx_len + p_buf->len) > p_fcrb->rx_sdu_len) {
         log::error("SAR - SDU len exceeded  Type: {}   Lengths: {} {} {}",
-                   sar_type, p_fcrb->p_rx_sdu->len, p_buf->len,
-                   p_fcrb->rx_sdu_len);
+                   sar_type, rx_len, p_buf->len, p_fcrb->rx_sdu_len);
         packet_ok = false;
       } else if ((sar_type == L2CAP_FCR_END_SDU) &&
-                 ((p_fcrb->p_rx_sdu->len + p_buf->len) != p_fcrb->rx_sdu_len)) {
-        log::warn("SAR - SDU end rcvd but SDU incomplete: {} {} {}",
-                  p_fcrb->p_rx_sdu->len, p_buf->len, p_fcrb->rx_sdu_len);
+                 ((rx_len + p_buf->len) != p_fcrb->rx_sdu_len)) {
+        log::warn("SAR - SDU end rcvd but SDU incomplete: {} {} {}", rx_len,
+                  p_buf->len, p_fcrb->rx_sdu_len);
         packet_ok = false;
+      } else if (p_fcrb->p_rx_sdu == NULL) {
+        /* Keep the segment as it is, without copying its payload */
+        p_fcrb->rx_sdu_segments_len += p_buf->len;
+        fixed_queue_enqueue(p_fcrb->rx_sdu_segments, p_buf);
+        p_buf = NULL;
+
+        if (sar_type == L2CAP_FCR_END_SDU) {
+          deliver_sdu_segments(p_ccb);
+        }
       } else {
         memcpy(((uint8_t*)(p_fcrb->p_rx_sdu + 1)) + p_fcrb->p_rx_sdu->offset +
                    p_fcrb->p_rx_sdu->len,
@@ -1530,40 +1557,46 @@ BT_HDR* l2c_lcc_get_next_xmit_sdu_seg(tL2C_CCB* p_ccb,
 
   BT_HDR* p_buf = (BT_HDR*)fixed_queue_try_peek_first(p_ccb->xmit_hold_q);
   bool first_pdu = (p_buf->event == 0) ? true : false;
+  uint16_t sdu_len = p_buf->len;
 
   uint16_t no_of_bytes_to_send = std::min(
       p_buf->len,
       (uint16_t)(first_pdu ? (max_pdu - L2CAP_LCC_SDU_LENGTH) : max_pdu));
   bool last_pdu = (no_of_bytes_to_send == p_buf->len);
+  uint16_t new_offset = first_pdu ? L2CAP_LCC_OFFSET : L2CAP_MIN_OFFSET;
+
+  BT_HDR* p_xmit;
+  if (last_pdu && p_buf->offset >= new_offset) {
+    /* The rest of the SDU fits in this PDU and the headers fit in front of it,
+     * so the SDU buffer is sent as is instead of being copied */
+    p_xmit = (BT_HDR*)fixed_queue_try_dequeue(p_ccb->xmit_hold_q);
+  } else {
+    /* Get a new buffer and copy the data that can be sent in a PDU */
+    p_xmit = l2c_fcr_clone_buf(p_buf, new_offset, no_of_bytes_to_send);
+
+    /* copy PBF setting */
+    p_xmit->layer_specific = p_buf->layer_specific;
 
-  /* Get a new buffer and copy the data that can be sent in a PDU */
-  BT_HDR* p_xmit =
-      l2c_fcr_clone_buf(p_buf, first_pdu ? L2CAP_LCC_OFFSET : L2CAP_MIN_OFFSET,
-                        no_of_bytes_to_send);
+    p_buf->event = p_ccb->local_cid;
+    p_buf->len -= no_of_bytes_to_send;
+    p_buf->offset += no_of_bytes_to_send;
 
-  p_buf->event = p_ccb->local_cid;
+    if (last_pdu) {
+      p_buf = (BT_HDR*)fixed_queue_try_dequeue(p_ccb->xmit_hold_q);
+      osi_free(p_buf);
+    }
+  }
   p_xmit->event = p_ccb->local_cid;
 
   if (first_pdu) {
     p_xmit->offset -= L2CAP_LCC_SDU_LENGTH; /* for writing the SDU length. */
     uint8_t* p = (uint8_t*)(p_xmit + 1) + p_xmit->offset;
-    UINT16_TO_STREAM(p, p_buf->len);
+    UINT16_TO_STREAM(p, sdu_len);
     p_xmit->len += L2CAP_LCC_SDU_LENGTH;
   }
 
-  p_buf->len -= no_of_bytes_to_send;
-  p_buf->offset += no_of_bytes_to_send;
-
-  /* copy PBF setting */
-  p_xmit->layer_specific = p_buf->layer_specific;
-
   if (last_piece_of_sdu) *last_piece_of_sdu = last_pdu;
 
-  if (last_pdu) {
-    p_buf = (BT_HDR*)fixed_queue_try_dequeue(p_ccb->xmit_hold_q);
-    osi_free(p_buf);
-  }
-
   /* Step back to add the L2CAP headers */
   p_xmit->offset -= L2CAP_PKT_OVERHEAD;
   p_xmit->len += L2CAP_PKT_OVERHEAD;
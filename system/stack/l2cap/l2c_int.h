@@ -237,6 +237,9 @@ typedef struct {
 
   uint16_t rx_sdu_len; /* Length of the SDU being received */
   BT_HDR* p_rx_sdu;    /* Buffer holding the SDU being received */
+  fixed_queue_t* rx_sdu_segments; /* Segments of the SDU being received, when
+                                     the upper layer takes them unlinearized */
+  uint16_t rx_sdu_segments_len;   /* Bytes held in rx_sdu_segments */
   fixed_queue_t*
       waiting_for_ack_q;          /* Buffers sent and waiting for peer to ack */
   fixed_queue_t* srej_rcv_hold_q; /* Buffers rcvd but held pending SREJ rsp */
@@ -369,6 +372,13 @@ typedef struct t_l2c_ccb {
     } dropped;
   } metrics;
 
+  /* Time spent by a LE CoC with data queued but no credits from the peer */
+  struct {
+    uint64_t since_ms{0}; /* Start of the current starvation, 0 if none */
+    uint64_t total_ms{0};
+    unsigned count{0};
+  } credit_starvation;
+
 } tL2C_CCB;
 
 /***********************************************************************
@@ -550,6 +560,23 @@ typedef struct t_l2c_linkcb {
 
   uint8_t subrate_req_mask;
 
+  /* Traffic driven connection parameters, moves busy links to a fast interval
+   * and back to the previous parameters once idle */
+  struct {
+    alarm_t* timer;
+    uint32_t window_bytes; /* bytes sent or received in the current window */
+    uint8_t idle_windows;  /* consecutive windows without traffic */
+    bool fast;             /* link is on the fast parameters */
+    uint16_t saved_min_interval;
+    uint16_t saved_max_interval;
+    uint16_t saved_latency;
+    uint16_t saved_timeout;
+    uint16_t saved_subrate_min;
+    uint16_t saved_subrate_max;
+    uint32_t fast_count;    /* times the link was moved to fast parameters */
+    uint32_t relaxed_count; /* times the link was moved back once idle */
+  } traffic_conn_params;
+
   /* each priority group is limited burst transmission */
   /* round robin service for the same priority channels */
   tL2C_RR_SERV rr_serv[L2CAP_NUM_CHNL_PRIORITY];
@@ -880,6 +907,7 @@ void l2cble_update_data_length(tL2C_LCB* p_lcb);
 
 void l2cu_process_fixed_disc_cback(tL2C_LCB* p_lcb);
 
+void l2cble_traffic_conn_params_record(tL2C_LCB* p_lcb, uint16_t bytes);
 void l2cble_process_subrate_change_evt(uint16_t handle, uint8_t status,
                                        uint16_t subrate_factor,
                                        uint16_t peripheral_latency,
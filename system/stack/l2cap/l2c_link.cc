@@ -29,6 +29,7 @@
 
 #include <cstdint>
 
+#include "common/time_util.h"
 #include "device/include/device_iot_config.h"
 #include "internal_include/bt_target.h"
 #include "os/log.h"
@@ -1005,6 +1006,7 @@ static void l2c_link_send_to_lower_ble(tL2C_LCB* p_lcb, BT_HDR* p_buf) {
   p_lcb->sent_not_acked++;
   p_buf->layer_specific = 0;
   l2cb.controller_le_xmit_window--;
+  l2cble_traffic_conn_params_record(p_lcb, p_buf->len);
 
   acl_send_data_packet_ble(p_lcb->remote_bd_addr, p_buf);
   log::debug("TotalWin={},Hndl=0x{:x},Quota={},Unack={},RRQuota={},RRUnack={}",
@@ -1303,6 +1305,11 @@ BT_HDR* l2cu_get_next_buffer_to_send(tL2C_LCB* p_lcb,
     /* Check credits */
     if (p_ccb->peer_conn_cfg.credits == 0) {
       log::debug("No credits to send packets");
+      if (p_ccb->credit_starvation.since_ms == 0) {
+        p_ccb->credit_starvation.since_ms =
+            bluetooth::common::time_get_os_boottime_ms();
+        p_ccb->credit_starvation.count++;
+      }
       return NULL;
     }
 
@@ -113,6 +113,7 @@ void l2c_rcv_acl_data(BT_HDR* p_msg) {
     /* only process fixed channel data as channel open indication when link is
      * not in disconnecting mode */
     l2cble_notify_le_connection(p_lcb->remote_bd_addr);
+    l2cble_traffic_conn_params_record(p_lcb, hci_len);
   }
 
   /* Find the CCB for this CID */
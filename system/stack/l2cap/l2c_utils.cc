@@ -28,11 +28,15 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+#include <iterator>
+
 #include "device/include/controller.h"
 #include "hal/snoop_logger.h"
 #include "hci/controller_interface.h"
 #include "internal_include/bt_target.h"
 #include "main/shim/entry.h"
+#include "metrics/counter_registry.h"
 #include "os/log.h"
 #include "osi/include/allocator.h"
 #include "stack/btm/btm_sec.h"
@@ -53,6 +57,19 @@ using namespace bluetooth;
 
 tL2C_CCB* l2cu_get_next_channel_in_rr(tL2C_LCB* p_lcb); // TODO Move
 
+/* Shows the LCBs and CCBs in use, and the most ever used, in dumpsys so that
+ * MAX_L2CAP_LINKS and MAX_L2CAP_CHANNELS can be sized for the device */
+static void l2cu_update_pool_gauges() {
+  static metrics::Gauge* lcbs =
+      metrics::CounterRegistry::Get().GetGauge("l2cap.pool.lcbs");
+  static metrics::Gauge* ccbs =
+      metrics::CounterRegistry::Get().GetGauge("l2cap.pool.ccbs");
+  lcbs->Set(std::count_if(std::begin(l2cb.lcb_pool), std::end(l2cb.lcb_pool),
+                          [](const tL2C_LCB& lcb) { return lcb.in_use; }));
+  ccbs->Set(std::count_if(std::begin(l2cb.ccb_pool), std::end(l2cb.ccb_pool),
+                          [](const tL2C_CCB& ccb) { return ccb.in_use; }));
+}
+
 /*******************************************************************************
  *
  * Function         l2cu_allocate_lcb
@@ -71,6 +88,7 @@ tL2C_LCB* l2cu_allocate_lcb(const RawAddress& p_bd_addr, bool is_bonding,
     if (!p_lcb->in_use) {
       alarm_free(p_lcb->l2c_lcb_timer);
       alarm_free(p_lcb->info_resp_timer);
+      alarm_free(p_lcb->traffic_conn_params.timer);
       memset(p_lcb, 0, sizeof(tL2C_LCB));
 
       p_lcb->remote_bd_addr = p_bd_addr;
@@ -81,6 +99,8 @@ tL2C_LCB* l2cu_allocate_lcb(const RawAddress& p_bd_addr, bool is_bonding,
       p_lcb->InvalidateHandle();
       p_lcb->l2c_lcb_timer = alarm_new("l2c_lcb.l2c_lcb_timer");
       p_lcb->info_resp_timer = alarm_new("l2c_lcb.info_resp_timer");
+      p_lcb->traffic_conn_params.timer =
+          alarm_new("l2c_lcb.traffic_conn_params.timer");
       p_lcb->idle_timeout = l2cb.idle_timeout;
       p_lcb->signal_id = 1; /* spec does not allow '0' */
       if (is_bonding) {
@@ -101,6 +121,7 @@ tL2C_LCB* l2cu_allocate_lcb(const RawAddress& p_bd_addr, bool is_bonding,
         l2c_link_adjust_allocation();
       }
       p_lcb->link_xmit_data_q = list_new(NULL);
+      l2cu_update_pool_gauges();
       return (p_lcb);
     }
   }
@@ -156,12 +177,15 @@ void l2cu_release_lcb(tL2C_LCB* p_lcb) {
 
   p_lcb->in_use = false;
   p_lcb->ResetBonding();
+  l2cu_update_pool_gauges();
 
   /* Stop and free timers */
   alarm_free(p_lcb->l2c_lcb_timer);
   p_lcb->l2c_lcb_timer = NULL;
   alarm_free(p_lcb->info_resp_timer);
   p_lcb->info_resp_timer = NULL;
+  alarm_free(p_lcb->traffic_conn_params.timer);
+  p_lcb->traffic_conn_params.timer = NULL;
 
   if (p_lcb->transport == BT_TRANSPORT_BR_EDR) /* Release all SCO links */
     BTM_RemoveSco(p_lcb->remote_bd_addr);
@@ -1389,6 +1413,7 @@ tL2C_CCB* l2cu_allocate_ccb(tL2C_LCB* p_lcb, uint16_t cid, bool is_eatt) {
   p_ccb->p_next_ccb = p_ccb->p_prev_ccb = nullptr;
 
   p_ccb->in_use = true;
+  l2cu_update_pool_gauges();
 
   /* Get a CID for the connection */
   p_ccb->local_cid = L2CAP_BASE_APPL_CID + (uint16_t)(p_ccb - l2cb.ccb_pool);
@@ -1460,6 +1485,7 @@ tL2C_CCB* l2cu_allocate_ccb(tL2C_LCB* p_lcb, uint16_t cid, bool is_eatt) {
 
   p_ccb->is_flushable = false;
   p_ccb->ecoc = false;
+  p_ccb->credit_starvation = {};
 
   alarm_free(p_ccb->l2c_ccb_timer);
   p_ccb->l2c_ccb_timer = alarm_new("l2c.l2c_ccb_timer");
@@ -1602,6 +1628,7 @@ void l2cu_release_ccb(tL2C_CCB* p_ccb) {
 
   /* Flag as not in use */
   p_ccb->in_use = false;
+  l2cu_update_pool_gauges();
   // Clear Remote CID and Local Id
   p_ccb->remote_cid = 0;
   p_ccb->local_id = 0;
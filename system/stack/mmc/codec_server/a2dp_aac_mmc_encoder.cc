@@ -45,7 +45,8 @@ constexpr uint8_t A2DP_AAC_HEADER_48000[A2DP_AAC_HEADER_LEN] = {
 };
 }  // namespace
 
-A2dpAacEncoder::A2dpAacEncoder() : avctx_(nullptr) {}
+A2dpAacEncoder::A2dpAacEncoder()
+    : avctx_(nullptr), frame_(nullptr), pkt_(nullptr) {}
 
 A2dpAacEncoder::~A2dpAacEncoder() { cleanup(); }
 
@@ -101,6 +102,40 @@ int A2dpAacEncoder::init(ConfigParam config) {
     return -EINVAL;
   }
 
+  if (!frame_) {
+    frame_ = av_frame_alloc();
+    if (!frame_) {
+      LOG(ERROR) << "Could not alloc frame";
+      return -ENOMEM;
+    }
+  } else {
+    av_frame_unref(frame_);
+  }
+
+  frame_->nb_samples = avctx_->frame_size;
+  frame_->format = avctx_->sample_fmt;
+  frame_->sample_rate = avctx_->sample_rate;
+
+  rc = av_channel_layout_copy(&frame_->ch_layout, &avctx_->ch_layout);
+  if (rc < 0) {
+    LOG(ERROR) << "Failed to copy channel layout: " << rc;
+    return -EINVAL;
+  }
+
+  rc = av_frame_get_buffer(frame_, 0);
+  if (rc < 0) {
+    LOG(ERROR) << "Failed to get buffer for frame: " << rc;
+    return -EIO;
+  }
+
+  if (!pkt_) {
+    pkt_ = av_packet_alloc();
+    if (!pkt_) {
+      LOG(ERROR) << "Could not alloc packet";
+      return -ENOMEM;
+    }
+  }
+
   return avctx_->frame_size;
 }
 
@@ -109,40 +144,21 @@ void A2dpAacEncoder::cleanup() {
     avcodec_free_context(&avctx_);
     avctx_ = nullptr;
   }
+  av_frame_free(&frame_);
+  av_packet_free(&pkt_);
 }
 
 int A2dpAacEncoder::transcode(uint8_t* i_buf, int i_len, uint8_t* o_buf,
                               int o_len) {
-  int rc;
-
-  AVFrame* frame = av_frame_alloc();
-  if (!frame) {
-    LOG(ERROR) << "Could not alloc frame";
-    return -ENOMEM;
-  }
-
-  frame->nb_samples = avctx_->frame_size;
-  frame->format = avctx_->sample_fmt;
-  frame->sample_rate = avctx_->sample_rate;
-
-  rc = av_channel_layout_copy(&frame->ch_layout, &avctx_->ch_layout);
-  if (rc < 0) {
-    LOG(ERROR) << "Failed to copy channel layout: " << rc;
-    av_frame_free(&frame);
-    return -EINVAL;
-  }
-
-  rc = av_frame_get_buffer(frame, 0);
-  if (rc < 0) {
-    LOG(ERROR) << "Failed to get buffer for frame: " << rc;
-    av_frame_free(&frame);
-    return -EIO;
+  if (!avctx_ || !frame_ || !pkt_) {
+    LOG(ERROR) << "Encoder is not initialized";
+    return -ENOENT;
   }
 
-  rc = av_frame_make_writable(frame);
+  // The encoder may still reference the buffer of the previous frame.
+  int rc = av_frame_make_writable(frame_);
   if (rc < 0) {
     LOG(ERROR) << "Failed to make frame writable: " << rc;
-    av_frame_free(&frame);
     return -EIO;
   }
 
@@ -151,7 +167,7 @@ int A2dpAacEncoder::transcode(uint8_t* i_buf, int i_len, uint8_t* o_buf,
   const float scaling_factor = (float)1 / (1 << (bit_depth - 1));
 
   uint8_t* buff = i_buf;
-  float* data[] = {(float*)frame->data[0], (float*)frame->data[1]};
+  float* data[] = {(float*)frame_->data[0], (float*)frame_->data[1]};
 
   auto read_pcm = [](uint8_t* buff, int nbits) -> int {
     int pcm = 0;
@@ -180,25 +196,15 @@ int A2dpAacEncoder::transcode(uint8_t* i_buf, int i_len, uint8_t* o_buf,
     buff += bytes_per_sample;
   }
 
-  AVPacket* pkt = av_packet_alloc();
-  if (!pkt) {
-    LOG(ERROR) << "Could not alloc packet";
-    return -ENOMEM;
-  }
-
-  rc = avcodec_send_frame(avctx_, frame);
+  rc = avcodec_send_frame(avctx_, frame_);
   if (rc < 0) {
     LOG(ERROR) << "Failed to send frame: " << rc;
-    av_frame_free(&frame);
-    av_packet_free(&pkt);
     return -EIO;
   }
 
-  rc = avcodec_receive_packet(avctx_, pkt);
+  rc = avcodec_receive_packet(avctx_, pkt_);
   if (rc < 0 && rc != -EAGAIN) {
     LOG(ERROR) << "Failed to receive packet: " << rc;
-    av_frame_free(&frame);
-    av_packet_free(&pkt);
     return -EIO;
   }
 
@@ -213,9 +219,9 @@ int A2dpAacEncoder::transcode(uint8_t* i_buf, int i_len, uint8_t* o_buf,
   dst += written;
 
   int cap = param_.effective_frame_size();
-  if (rc == -EAGAIN || cap < pkt->size + A2DP_AAC_MAX_PREFIX_SIZE) {
+  if (rc == -EAGAIN || cap < pkt_->size + A2DP_AAC_MAX_PREFIX_SIZE) {
     if (rc != -EAGAIN) {
-      LOG(WARNING) << "Dropped pkt: size=" << pkt->size << ", cap=" << cap;
+      LOG(WARNING) << "Dropped pkt: size=" << pkt_->size << ", cap=" << cap;
     }
     static uint8_t silent_frame[7] = {
         0x06, 0x21, 0x10, 0x04, 0x60, 0x8c, 0x1c,
@@ -224,7 +230,7 @@ int A2dpAacEncoder::transcode(uint8_t* i_buf, int i_len, uint8_t* o_buf,
     dst += sizeof(silent_frame);
     written += sizeof(silent_frame);
   } else {
-    int fsize = pkt->size;
+    int fsize = pkt_->size;
 
     while (fsize >= 255) {
       *(dst++) = 0xff;
@@ -234,13 +240,11 @@ int A2dpAacEncoder::transcode(uint8_t* i_buf, int i_len, uint8_t* o_buf,
     *(dst++) = fsize;
     ++written;
 
-    std::copy(pkt->data, pkt->data + pkt->size, dst);
-    written += pkt->size;
+    std::copy(pkt_->data, pkt_->data + pkt_->size, dst);
+    written += pkt_->size;
   }
 
-  av_packet_unref(pkt);
-  av_frame_free(&frame);
-  av_packet_free(&pkt);
+  av_packet_unref(pkt_);
 
   return written;
 }
@@ -56,6 +56,9 @@ class A2dpAacEncoder : public MmcInterface {
 
  private:
   AVCodecContext* avctx_;
+  // Allocated once per session and reused for every transcode call.
+  AVFrame* frame_;
+  AVPacket* pkt_;
   AacEncoderParam param_;
 };
 
@@ -38,6 +38,9 @@ constexpr int kMaximumBufferSize = 32768;
 // Thread constants.
 constexpr char kWorkerThreadName[] = "bt_mmc_worker_thread";
 constexpr int kThreadCheckTimeout = 1;
+// The number of idle worker threads kept started for the next sessions, so
+// that a session setup does not wait for a thread start up. One per client.
+constexpr int kWarmThreadPoolSize = kClientMaximum;
 }  // namespace mmc
 
 #endif  // MMC_DAEMON_DBUS_CONSTANTS_H_
@@ -21,6 +21,7 @@
 #include <base/logging.h>
 #include <base/stl_util.h>
 #include <base/task/single_thread_task_runner.h>
+#include <base/timer/elapsed_timer.h>
 #include <base/unguessable_token.h>
 #include <poll.h>
 #include <sys/socket.h>
@@ -28,6 +29,7 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <future>
@@ -56,7 +58,7 @@ void StartSocketListener(int fd, struct sockaddr_un addr,
 
   if (client_fd < 0) {
     LOG(ERROR) << "Failed to accept: " << strerror(errno);
-    codec_server.release();
+    codec_server.reset();
     task_ended.set_value();
     return;
   }
@@ -68,6 +70,11 @@ void StartSocketListener(int fd, struct sockaddr_un addr,
   pfd.fd = client_fd;
   pfd.events = POLLIN;
 
+  // Transcode latency of the session, in microseconds.
+  int64_t num_frames = 0;
+  int64_t transcode_sum = 0;
+  int64_t transcode_max = 0;
+
   while (1) {
     // Blocking poll.
     int poll_ret = poll(&pfd, 1, -1);
@@ -90,23 +97,32 @@ void StartSocketListener(int fd, struct sockaddr_un addr,
     }
 
     // Start transcode.
+    base::ElapsedTimer timer;
     int o_data_len = codec_server->transcode(i_buf.data(), i_data_len,
                                              o_buf.data(), kMaximumBufferSize);
     if (o_data_len < 0) {
       LOG(ERROR) << "Failed to transcode: " << strerror(-o_data_len);
       break;
     }
+    int64_t elapsed = timer.Elapsed().InMicroseconds();
+    num_frames++;
+    transcode_sum += elapsed;
+    transcode_max = std::max(transcode_max, elapsed);
 
     int sent_rc = send(client_fd, o_buf.data(), o_data_len, MSG_NOSIGNAL);
     if (sent_rc <= 0) {
       LOG(ERROR) << "Failed to send data: " << strerror(errno);
       break;
     }
-    o_buf.fill(0);
+  }
+  if (num_frames > 0) {
+    LOG(INFO) << "Transcoded " << num_frames << " frames, mean "
+              << transcode_sum / num_frames << " us, max " << transcode_max
+              << " us";
   }
   close(client_fd);
   unlink(addr.sun_path);
-  codec_server.release();
+  codec_server.reset();
   task_ended.set_value();
   return;
 }
@@ -156,6 +172,12 @@ bool Service::Init() {
     LOG(ERROR) << "Failed to take ownership of " << kMmcServiceName;
     return false;
   }
+
+  // Warm up the thread pool. The sessions fall back to start their own
+  // thread if this fails.
+  for (int i = 0; i < kWarmThreadPoolSize; i++) {
+    if (!AddIdleThread()) break;
+  }
   return true;
 }
 
@@ -168,6 +190,7 @@ void Service::CodecInit(dbus::MethodCall* method_call,
 
   CodecInitRequest request;
   CodecInitResponse response;
+  base::ElapsedTimer timer;
 
   if (!reader.PopArrayOfBytesAsProto(&request)) {
     std::move(sender).Run(dbus::ErrorResponse::FromMethodCall(
@@ -260,6 +283,8 @@ void Service::CodecInit(dbus::MethodCall* method_call,
 
   writer.AppendProtoAsArrayOfBytes(response);
   std::move(sender).Run(std::move(dbus_response));
+  LOG(INFO) << "Codec session set up in " << timer.Elapsed().InMicroseconds()
+            << " us";
   return;
 }
 
@@ -273,41 +298,66 @@ void Service::CodecCleanUp(dbus::MethodCall* method_call,
 
 bool Service::StartWorkerThread(int fd, struct sockaddr_un addr,
                                 std::unique_ptr<MmcInterface> codec_server) {
+  // Reuse an idle thread, whose task is over, before starting a new one.
+  auto thread = std::find_if(
+      thread_pool_.begin(), thread_pool_.end(), [](const auto& thread) {
+        return thread.second->wait_for(std::chrono::milliseconds(0)) ==
+               std::future_status::ready;
+      });
+  if (thread == thread_pool_.end()) {
+    if (!AddIdleThread()) return false;
+    thread = std::prev(thread_pool_.end());
+  }
+
   // Each thread has its associated future to indicate task completion.
   std::promise<void> task_ended;
-  thread_pool_.push_back(std::make_pair(
-      std::make_unique<bluetooth::common::MessageLoopThread>(kWorkerThreadName),
-      std::make_unique<std::future<void>>(task_ended.get_future())));
+  *thread->second = task_ended.get_future();
+
+  if (!thread->first->DoInThread(
+          FROM_HERE,
+          base::BindOnce(&StartSocketListener, fd, std::move(addr),
+                         std::move(task_ended), std::move(codec_server)))) {
+    LOG(ERROR) << "Failed to run task";
+    return false;
+  }
+
+  return true;
+}
 
-  // Start up thread and assign task to it.
-  thread_pool_.back().first->StartUp();
-  if (!thread_pool_.back().first->IsRunning()) {
+bool Service::AddIdleThread() {
+  auto thread =
+      std::make_unique<bluetooth::common::MessageLoopThread>(kWorkerThreadName);
+
+  // Start up thread.
+  thread->StartUp();
+  if (!thread->IsRunning()) {
     LOG(ERROR) << "Failed to start thread";
     return false;
   }
 
   // Real-time scheduling increases thread priority.
   // Without it, the thread still works.
-  if (!thread_pool_.back().first->EnableRealTimeScheduling()) {
+  if (!thread->EnableRealTimeScheduling()) {
     LOG(WARNING) << "Failed to enable real time scheduling";
   }
 
-  if (!thread_pool_.back().first->DoInThread(
-          FROM_HERE,
-          base::BindOnce(&StartSocketListener, fd, std::move(addr),
-                         std::move(task_ended), std::move(codec_server)))) {
-    LOG(ERROR) << "Failed to run task";
-    return false;
-  }
-
+  // The thread has no task yet.
+  std::promise<void> idle;
+  idle.set_value();
+  thread_pool_.push_back(std::make_pair(
+      std::move(thread),
+      std::make_unique<std::future<void>>(idle.get_future())));
   return true;
 }
 
 void Service::RemoveIdleThread() {
+  int num_idle = 0;
   for (auto thread = thread_pool_.begin(); thread != thread_pool_.end();) {
     if (thread->second->wait_for(std::chrono::milliseconds(
-            kThreadCheckTimeout)) == std::future_status::ready) {
-      // The task is over, close the thread and remove it from the thread pool.
+            kThreadCheckTimeout)) == std::future_status::ready &&
+        ++num_idle > kWarmThreadPoolSize) {
+      // The task is over and enough threads are kept warm, close the thread
+      // and remove it from the thread pool.
       thread->first->ShutDown();
       thread = thread_pool_.erase(thread);
     } else {
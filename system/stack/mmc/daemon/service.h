@@ -68,11 +68,16 @@ class Service final {
                     dbus::ExportedObject::ResponseSender sender);
 
   /* Thread Management*/
-  // Adds a thread to the thread pool and makes it listen on the socket fd.
+  // Makes an idle thread of the thread pool listen on the socket fd, or adds
+  // a new thread to the pool when none is idle.
   bool StartWorkerThread(int fd, struct sockaddr_un addr,
                          std::unique_ptr<MmcInterface> codec_server);
 
-  // Removes idle threads from the thread pool.
+  // Starts up a thread and adds it idle to the thread pool.
+  bool AddIdleThread();
+
+  // Removes idle threads from the thread pool, keeping |kWarmThreadPoolSize|
+  // of them started for the next sessions.
   void RemoveIdleThread();
 
   base::OnceClosure shutdown_callback_;
@@ -185,6 +185,8 @@ typedef struct {
   uint16_t
       credit_rx_max; /* Max number of credits we will allow this guy to sent */
   uint16_t credit_rx_low;   /* Number of credits when we send credit update */
+  uint16_t credit_rx_max_base; /* credit_rx_max selected for the MTU, which */
+                               /* the adaptive credits never go below */
   uint16_t rx_buf_critical; /* port receive queue critical watermark level */
   bool keep_port_handle;    /* true if port is not deallocated when closing */
   /* it is set to true for server when allocating port */
@@ -193,6 +195,12 @@ typedef struct {
                      /* see the BTM_SEC_* values in btm_api_types.h */
 } tPORT;
 
+/* Port handles are stored as uint8_t in the per-MCB DLCI index, so the pool
+ * can be sized up to 254 ports through MAX_RFC_PORTS.
+*/
+static_assert(MAX_RFC_PORTS > 0 && MAX_RFC_PORTS < UINT8_MAX,
+              "MAX_RFC_PORTS does not fit the uint8_t port handles");
+
 /* Define the PORT/RFCOMM control structure
 */
 typedef struct {
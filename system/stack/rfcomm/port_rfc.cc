@@ -862,6 +862,31 @@ void PORT_DataInd(tRFC_MCB* p_mcb, uint8_t dlci, BT_HDR* p_buf) {
   if (p_port->p_callback && events) p_port->p_callback(events, p_port->handle);
 }
 
+/*******************************************************************************
+ *
+ * Function         port_flow_ind_notify
+ *
+ * Description      Resume sending on the port after a flow control change and
+ *                  report the resulting events to the user.
+ *
+ ******************************************************************************/
+static void port_flow_ind_notify(tPORT* p_port) {
+  uint32_t events = 0;
+
+  /* Check if flow of data is still enabled */
+  events |= port_flow_control_user(p_port);
+
+  /* Check if data can be sent and send it */
+  events |= port_rfc_send_tx_data(p_port);
+
+  /* Mask out all events that are not of interest to user */
+  events &= p_port->ev_mask;
+
+  /* Send event to the application */
+  if (p_port->p_callback && events)
+    (p_port->p_callback)(events, p_port->handle);
+}
+
 /*******************************************************************************
  *
  * Function         PORT_FlowInd
@@ -871,46 +896,30 @@ void PORT_DataInd(tRFC_MCB* p_mcb, uint8_t dlci, BT_HDR* p_buf) {
  *
  ******************************************************************************/
 void PORT_FlowInd(tRFC_MCB* p_mcb, uint8_t dlci, bool enable_data) {
-  tPORT* p_port = (tPORT*)NULL;
-  uint32_t events = 0;
-  int i;
-
   log::verbose("PORT_FlowInd fc:{}", enable_data);
 
-  if (dlci == 0) {
-    p_mcb->peer_ready = enable_data;
-  } else {
-    p_port = port_find_mcb_dlci_port(p_mcb, dlci);
+  if (dlci != 0) {
+    tPORT* p_port = port_find_mcb_dlci_port(p_mcb, dlci);
     if (p_port == NULL) return;
 
     p_port->tx.peer_fc = !enable_data;
+    port_flow_ind_notify(p_port);
+    return;
   }
 
-  for (i = 0; i < MAX_RFC_PORTS; i++) {
-    /* If DLCI is 0 event applies to all ports */
-    if (dlci == 0) {
-      p_port = &rfc_cb.port.port[i];
-      if (!p_port->in_use || (p_port->rfc.p_mcb != p_mcb) ||
-          (p_port->rfc.state != RFC_STATE_OPENED))
-        continue;
-    }
-    events = 0;
-
-    /* Check if flow of data is still enabled */
-    events |= port_flow_control_user(p_port);
-
-    /* Check if data can be sent and send it */
-    events |= port_rfc_send_tx_data(p_port);
-
-    /* Mask out all events that are not of interest to user */
-    events &= p_port->ev_mask;
+  /* If DLCI is 0 event applies to all ports opened on this multiplexer, */
+  /* walk the DLCI index of the MCB rather than the whole port pool */
+  p_mcb->peer_ready = enable_data;
+  for (int i = 1; i <= RFCOMM_MAX_DLCI; i++) {
+    uint8_t handle = p_mcb->port_handles[i];
+    if (handle == 0) continue;
 
-    /* Send event to the application */
-    if (p_port->p_callback && events)
-      (p_port->p_callback)(events, p_port->handle);
+    tPORT* p_port = &rfc_cb.port.port[handle - 1];
+    if (!p_port->in_use || (p_port->rfc.p_mcb != p_mcb) ||
+        (p_port->rfc.state != RFC_STATE_OPENED))
+      continue;
 
-    /* If DLCI is not 0 event applies to one port only */
-    if (dlci != 0) break;
+    port_flow_ind_notify(p_port);
   }
 }
 
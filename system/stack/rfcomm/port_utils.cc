@@ -27,6 +27,7 @@
 #include <base/logging.h>
 #include <bluetooth/log.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 
@@ -186,6 +187,7 @@ void port_select_mtu(tPORT* p_port) {
   p_port->credit_rx_max = (PORT_RX_HIGH_WM / p_port->mtu);
   if (p_port->credit_rx_max > PORT_RX_BUF_HIGH_WM)
     p_port->credit_rx_max = PORT_RX_BUF_HIGH_WM;
+  p_port->credit_rx_max_base = p_port->credit_rx_max;
   p_port->credit_rx_low = (PORT_RX_LOW_WM / p_port->mtu);
   if (p_port->credit_rx_low > PORT_RX_BUF_LOW_WM)
     p_port->credit_rx_low = PORT_RX_BUF_LOW_WM;
@@ -469,6 +471,15 @@ void port_flow_control_peer(tPORT* p_port, bool enable, uint16_t count) {
         p_port->credit_rx -= count;
       }
 
+      /* A port delivering its data to a socket that kept up with the peer */
+      /* since the last credit update can take one more frame in flight */
+      if (p_port->p_data_co_callback && !p_port->rx.peer_fc &&
+          !p_port->rx.user_fc &&
+          (p_port->credit_rx <= p_port->credit_rx_low) &&
+          (p_port->credit_rx_max < PORT_RX_BUF_CREDIT_MAX_WM)) {
+        p_port->credit_rx_max++;
+      }
+
       /* If credit count is less than low credit watermark, and user */
       /* did not force flow control, send a credit update */
       /* There might be a special case when we just adjusted rx_max */
@@ -486,6 +497,11 @@ void port_flow_control_peer(tPORT* p_port, bool enable, uint16_t count) {
     else {
       /* if client registered data callback, just do what they want */
       if (p_port->p_data_callback || p_port->p_data_co_callback) {
+        /* The socket did not keep up, halve the frames in flight */
+        if (p_port->p_data_co_callback && !p_port->rx.peer_fc) {
+          p_port->credit_rx_max = std::max<uint16_t>(
+              p_port->credit_rx_max / 2, p_port->credit_rx_max_base);
+        }
         p_port->rx.peer_fc = true;
       }
       /* if queue count reached credit rx max, set peer fc */
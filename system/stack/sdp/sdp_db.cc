@@ -47,6 +47,9 @@ using namespace bluetooth;
 static bool find_uuid_in_seq(uint8_t* p, uint32_t seq_len,
                              const uint8_t* p_his_uuid, uint16_t his_len,
                              int nest_level);
+static uint64_t sdp_db_uuid_filter_bits(const uint8_t* p_uuid,
+                                        uint32_t uuid_len);
+static void sdp_db_update_uuid_filter(tSDP_RECORD* p_rec);
 
 bool SDP_AddAttribute(uint32_t handle, uint16_t attr_id, uint8_t attr_type,
                       uint32_t attr_len, uint8_t* p_val);
@@ -67,6 +70,11 @@ const tSDP_RECORD* sdp_db_service_search(const tSDP_RECORD* p_rec,
   uint16_t xx, yy;
   const tSDP_ATTRIBUTE* p_attr;
   tSDP_RECORD* p_end = &sdp_cb.server_db.record[sdp_cb.server_db.num_records];
+  uint64_t uuid_bits[MAX_UUIDS_PER_SEQ];
+
+  for (yy = 0; yy < p_seq->num_uids && yy < MAX_UUIDS_PER_SEQ; yy++)
+    uuid_bits[yy] = sdp_db_uuid_filter_bits(&p_seq->uuid_entry[yy].value[0],
+                                            p_seq->uuid_entry[yy].len);
 
   /* If NULL, start at the beginning, else start at the first specified record
    */
@@ -79,6 +87,9 @@ const tSDP_RECORD* sdp_db_service_search(const tSDP_RECORD* p_rec,
   /* the record contains all the passed UUIDs in it.                */
   for (; p_rec < p_end; p_rec++) {
     for (yy = 0; yy < p_seq->num_uids; yy++) {
+      /* Skip the attribute walk when the record cannot hold this UUID */
+      if ((p_rec->uuid_filter & uuid_bits[yy]) != uuid_bits[yy]) break;
+
       p_attr = &p_rec->attribute[0];
       for (xx = 0; xx < p_rec->num_attributes; xx++, p_attr++) {
         if (p_attr->type == UUID_DESC_TYPE) {
@@ -145,6 +156,100 @@ static bool find_uuid_in_seq(uint8_t* p, uint32_t seq_len,
   return (false);
 }
 
+/*******************************************************************************
+ *
+ * Function         sdp_db_uuid_filter_bits
+ *
+ * Description      This function hashes a UUID, expanded to 128 bits the same
+ *                  way sdpu_compare_uuid_arrays does, to the bits it sets in a
+ *                  record UUID filter.
+ *
+ * Returns          The filter bits, or 0 if the UUID length is invalid
+ *
+ ******************************************************************************/
+static uint64_t sdp_db_uuid_filter_bits(const uint8_t* p_uuid,
+                                        uint32_t uuid_len) {
+  Uuid uuid;
+  if (uuid_len == Uuid::kNumBytes16) {
+    uuid = Uuid::From16Bit((p_uuid[0] << 8) | p_uuid[1]);
+  } else if (uuid_len == Uuid::kNumBytes32) {
+    uuid = Uuid::From32Bit((p_uuid[0] << 24) | (p_uuid[1] << 16) |
+                           (p_uuid[2] << 8) | p_uuid[3]);
+  } else if (uuid_len == Uuid::kNumBytes128) {
+    uuid = Uuid::From128BitBE(p_uuid);
+  } else {
+    return 0;
+  }
+
+  /* FNV-1a, three 6 bit slices of the hash select the filter bits */
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (uint8_t byte : uuid.To128BitBE()) {
+    hash = (hash ^ byte) * 0x100000001b3ULL;
+  }
+  return (1ULL << (hash & 0x3f)) | (1ULL << ((hash >> 6) & 0x3f)) |
+         (1ULL << ((hash >> 12) & 0x3f));
+}
+
+/*******************************************************************************
+ *
+ * Function         sdp_db_seq_uuid_filter
+ *
+ * Description      This function collects the filter bits of the UUIDs in a
+ *                  data element sequence, walking it like find_uuid_in_seq.
+ *
+ * Returns          The filter bits of the sequence
+ *
+ ******************************************************************************/
+static uint64_t sdp_db_seq_uuid_filter(uint8_t* p, uint32_t seq_len,
+                                       int nest_level) {
+  uint8_t* p_end = p + seq_len;
+  uint8_t type;
+  uint32_t len;
+  uint64_t filter = 0;
+
+  if (nest_level > 3) return filter;
+
+  while (p < p_end) {
+    type = *p++;
+    p = sdpu_get_len_from_type(p, p_end, type, &len);
+    if (p == NULL || (p + len) > p_end) break;
+    type = type >> 3;
+    if (type == UUID_DESC_TYPE) {
+      filter |= sdp_db_uuid_filter_bits(p, len);
+    } else if (type == DATA_ELE_SEQ_DESC_TYPE) {
+      filter |= sdp_db_seq_uuid_filter(p, len, nest_level + 1);
+    }
+    p = p + len;
+  }
+
+  return filter;
+}
+
+/*******************************************************************************
+ *
+ * Function         sdp_db_update_uuid_filter
+ *
+ * Description      This function rebuilds the UUID filter of a record from its
+ *                  attributes. It must be called whenever they change.
+ *
+ * Returns          void
+ *
+ ******************************************************************************/
+static void sdp_db_update_uuid_filter(tSDP_RECORD* p_rec) {
+  uint64_t filter = 0;
+
+  for (uint16_t xx = 0; xx < p_rec->num_attributes; xx++) {
+    const tSDP_ATTRIBUTE* p_attr = &p_rec->attribute[xx];
+    if (p_attr->type == UUID_DESC_TYPE) {
+      filter |= sdp_db_uuid_filter_bits(p_attr->value_ptr, p_attr->len);
+    } else if (p_attr->type == DATA_ELE_SEQ_DESC_TYPE) {
+      filter |= sdp_db_seq_uuid_filter(p_attr->value_ptr, p_attr->len, 0);
+    }
+  }
+
+  p_rec->uuid_filter = filter;
+}
+
 /*******************************************************************************
  *
  * Function         sdp_db_find_record
@@ -520,6 +625,7 @@ bool SDP_AddAttributeToRecord(tSDP_RECORD* p_rec, uint16_t attr_id,
     return (false);
   }
   p_rec->num_attributes++;
+  sdp_db_update_uuid_filter(p_rec);
   return (true);
 }
 
@@ -905,6 +1011,7 @@ bool SDP_DeleteAttributeFromRecord(tSDP_RECORD* p_rec, uint16_t attr_id) {
         }
         p_rec->free_pad_ptr -= len;
       }
+      sdp_db_update_uuid_filter(p_rec);
       return (true);
     }
   }
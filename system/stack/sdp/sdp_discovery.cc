@@ -846,18 +846,25 @@ static uint8_t* add_attr(uint8_t* p, uint8_t* p_end, tSDP_DISCOVERY_DB* p_db,
   attr_len &= SDP_DISC_ATTR_LEN_MASK;
   attr_type = (type >> 3) & 0x0f;
 
-  /* See if there is enough space in the database */
-  if (attr_len > 4)
-    total_len = attr_len - 4 + (uint16_t)sizeof(tSDP_DISC_ATTR);
-  else
-    total_len = sizeof(tSDP_DISC_ATTR);
-
   p_attr_end = p + attr_len;
   if (p_attr_end > p_end) {
     log::warn("SDP - Attribute length beyond p_end");
     return NULL;
   }
 
+  /* Values are stored in the attribute itself up to the size of the value
+   * union, only longer values take extra space from the DB. 128-bit UUIDs
+   * based on the Bluetooth base UUID are shortened to 16 or 32 bits below. */
+  uint32_t value_len = attr_len;
+  if (attr_type == UUID_DESC_TYPE && attr_len == Uuid::kNumBytes128 &&
+      sdpu_is_base_uuid(p)) {
+    value_len = Uuid::kNumBytes32;
+  }
+  if (value_len > sizeof(tSDP_DISC_ATVAL))
+    total_len = value_len - sizeof(tSDP_DISC_ATVAL) + sizeof(tSDP_DISC_ATTR);
+  else
+    total_len = sizeof(tSDP_DISC_ATTR);
+
   /* Ensure it is a multiple of 4 */
   total_len = (total_len + 3) & ~3;
 
@@ -102,6 +102,8 @@ typedef struct {
   uint32_t record_handle;
   uint32_t free_pad_ptr;
   uint16_t num_attributes;
+  uint64_t uuid_filter; /* Bloom filter of the UUIDs in the attributes, */
+  /* checked before the attributes are walked on a service search       */
   tSDP_ATTRIBUTE attribute[SDP_MAX_REC_ATTR];
   uint8_t attr_pad[SDP_MAX_PAD_LEN];
 } tSDP_RECORD;
@@ -38,6 +38,20 @@ static void p_256_copy_point(Point* q, Point* p) {
   memcpy(q, p, sizeof(Point));
 }
 
+// Convert q from Jacobian to affine coordinates
+static void p_256_to_affine(Point* q) {
+  uint32_t z_inv[KEY_LENGTH_DWORDS_P256];
+
+  multiprecision_inv_mod(z_inv, q->z);
+  multiprecision_mersenns_squa_mod(q->z, z_inv);
+  multiprecision_mersenns_mult_mod(q->x, q->x, q->z);
+  multiprecision_mersenns_mult_mod(q->z, q->z, z_inv);
+  multiprecision_mersenns_mult_mod(q->y, q->y, q->z);
+
+  multiprecision_init(q->z);
+  q->z[0] = 1;
+}
+
 // q=2q
 static void ECC_Double(Point* q, Point* p) {
   uint32_t t1[KEY_LENGTH_DWORDS_P256];
@@ -234,11 +248,101 @@ void ECC_PointMult_Bin_NAF(Point* q, Point* p, uint32_t* n) {
     }
   }
 
-  multiprecision_inv_mod(minus_p.x, q->z);
-  multiprecision_mersenns_squa_mod(q->z, minus_p.x);
-  multiprecision_mersenns_mult_mod(q->x, q->x, q->z);
-  multiprecision_mersenns_mult_mod(q->z, q->z, minus_p.x);
-  multiprecision_mersenns_mult_mod(q->y, q->y, q->z);
+  p_256_to_affine(q);
+}
+
+// Fixed base comb for the base point G: comb_table[i] is the sum of
+// 2^(ECC_COMB_SPACING * j) * G over the bits j set in i, in affine coordinates
+#define ECC_COMB_TEETH 4
+#define ECC_COMB_SPACING (KEY_LENGTH_DWORDS_P256 * 32 / ECC_COMB_TEETH)
+#define ECC_COMB_SIZE (1 << ECC_COMB_TEETH)
+
+static Point comb_table[ECC_COMB_SIZE];
+
+static void ECC_BuildCombTable() {
+  Point teeth[ECC_COMB_TEETH];
+  Point r;
+
+  p_256_init_curve();
+
+  p_256_copy_point(&teeth[0], &curve_p256.G);
+  multiprecision_init(teeth[0].z);
+  teeth[0].z[0] = 1;
+  for (int j = 1; j < ECC_COMB_TEETH; j++) {
+    p_256_copy_point(&teeth[j], &teeth[j - 1]);
+    for (int i = 0; i < ECC_COMB_SPACING; i++) {
+      p_256_copy_point(&r, &teeth[j]);
+      ECC_Double(&teeth[j], &r);
+    }
+    p_256_to_affine(&teeth[j]);
+  }
+
+  // comb_table[0] is the point at infinity
+  p_256_init_point(&comb_table[0]);
+  for (int i = 1; i < ECC_COMB_SIZE; i++) {
+    int j = __builtin_ctz(i);
+    if (i == (1 << j)) {
+      p_256_copy_point(&comb_table[i], &teeth[j]);
+      continue;
+    }
+    p_256_copy_point(&r, &comb_table[i & (i - 1)]);
+    ECC_Add(&comb_table[i], &r, &teeth[j]);
+    p_256_to_affine(&comb_table[i]);
+  }
+}
+
+// q=p when mask is all ones, q is left unchanged when mask is zero
+static void ECC_CondCopy(Point* q, const Point* p, uint32_t mask) {
+  for (int i = 0; i < KEY_LENGTH_DWORDS_P256; i++) {
+    q->x[i] = (q->x[i] & ~mask) | (p->x[i] & mask);
+    q->y[i] = (q->y[i] & ~mask) | (p->y[i] & mask);
+    q->z[i] = (q->z[i] & ~mask) | (p->z[i] & mask);
+  }
+}
+
+// q=comb_table[index], reading every entry of the table so that the memory
+// accesses do not depend on index
+static void ECC_CombLookup(Point* q, uint32_t index) {
+  p_256_init_point(q);
+  for (uint32_t i = 0; i < ECC_COMB_SIZE; i++) {
+    uint32_t diff = i ^ index;
+    // all ones when diff is zero
+    uint32_t mask = ((diff | (0 - diff)) >> 31) - 1;
+    ECC_CondCopy(q, &comb_table[i], mask);
+  }
+}
+
+// Fixed base comb for point multiplication of the base point G
+void ECC_PointMult_FixedBase(Point* q, const uint32_t* n) {
+  static const bool comb_table_ready = (ECC_BuildCombTable(), true);
+  (void)comb_table_ready;
+
+  Point r;
+  Point sum;
+  Point entry;
+
+  p_256_init_point(q);
+
+  for (int i = ECC_COMB_SPACING - 1; i >= 0; i--) {
+    p_256_copy_point(&r, q);
+    ECC_Double(q, &r);
+
+    uint32_t index = 0;
+    for (int j = 0; j < ECC_COMB_TEETH; j++) {
+      int bit = i + j * ECC_COMB_SPACING;
+      index |= ((n[bit / 32] >> (bit % 32)) & 1) << j;
+    }
+
+    // A column without any bit set still adds an entry, and drops the sum,
+    // so that every column costs the same
+    uint32_t nonzero = (index | (0 - index)) >> 31;
+    ECC_CombLookup(&entry, index | (nonzero ^ 1));
+    p_256_copy_point(&r, q);
+    ECC_Add(&sum, &r, &entry);
+    ECC_CondCopy(q, &sum, 0 - nonzero);
+  }
+
+  p_256_to_affine(q);
 }
 
 bool ECC_ValidatePoint(const Point& pt) {
@@ -60,6 +60,10 @@ bool ECC_ValidatePoint(const Point& p);
 
 void ECC_PointMult_Bin_NAF(Point* q, Point* p, uint32_t* n);
 
+// q=n*G for the base point G of curve_p256, using a table precomputed on
+// first use. Unlike ECC_PointMult, n is left unchanged.
+void ECC_PointMult_FixedBase(Point* q, const uint32_t* n);
+
 #define ECC_PointMult(q, p, n) ECC_PointMult_Bin_NAF(q, p, n)
 
 void p_256_init_curve();
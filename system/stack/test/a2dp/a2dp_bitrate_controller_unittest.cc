@@ -0,0 +1,128 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stack/include/a2dp_bitrate_controller.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+constexpr int kRecoveryTicks = 250;
+
+class A2dpBitrateControllerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    a2dp_bitrate_controller_reset(&controller_,
+                                  A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS);
+  }
+
+  // Updates the controller |ticks| times, returns the number of level changes
+  int Update(size_t transmit_queue_length, int ticks) {
+    int changes = 0;
+    for (int i = 0; i < ticks; i++) {
+      if (a2dp_bitrate_controller_update(&controller_, transmit_queue_length)) {
+        changes++;
+      }
+    }
+    return changes;
+  }
+
+  tA2DP_BITRATE_CONTROLLER controller_;
+};
+}  // namespace
+
+TEST_F(A2dpBitrateControllerTest, runlevel_queue_keeps_level) {
+  EXPECT_EQ(Update(1, 2 * kRecoveryTicks), 0);
+  EXPECT_EQ(controller_.level, 0);
+}
+
+TEST_F(A2dpBitrateControllerTest, congested_queue_steps_down) {
+  EXPECT_EQ(Update(3, 3), 0);
+  EXPECT_EQ(Update(3, 1), 1);
+  EXPECT_EQ(controller_.level, 1);
+
+  // The queue is given time to drain before the next step down
+  EXPECT_EQ(Update(3, 9), 0);
+  EXPECT_EQ(Update(3, 1), 1);
+  EXPECT_EQ(controller_.level, 2);
+}
+
+TEST_F(A2dpBitrateControllerTest, critical_queue_steps_down_right_away) {
+  EXPECT_TRUE(a2dp_bitrate_controller_update(&controller_, 6));
+  EXPECT_EQ(controller_.level, 1);
+}
+
+TEST_F(A2dpBitrateControllerTest, level_stays_in_range) {
+  EXPECT_EQ(Update(10, 100), A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS - 1);
+  EXPECT_EQ(controller_.level, A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS - 1);
+
+  EXPECT_EQ(Update(0, 100 * kRecoveryTicks),
+            A2DP_BITRATE_CONTROLLER_BITRATE_LEVELS - 1);
+  EXPECT_EQ(controller_.level, 0);
+}
+
+TEST_F(A2dpBitrateControllerTest, steps_up_once_the_link_keeps_up) {
+  Update(6, 1);
+  ASSERT_EQ(controller_.level, 1);
+
+  EXPECT_EQ(Update(1, kRecoveryTicks - 1), 0);
+  // A busier tick restarts the recovery
+  EXPECT_EQ(Update(2, 1), 0);
+  EXPECT_EQ(Update(1, kRecoveryTicks - 1), 0);
+  EXPECT_EQ(Update(1, 1), 1);
+  EXPECT_EQ(controller_.level, 0);
+  EXPECT_EQ(controller_.adjustments, 2u);
+}
+
+TEST_F(A2dpBitrateControllerTest, dropped_packets_step_down) {
+  Update(6, 1);
+  ASSERT_EQ(controller_.level, 1);
+
+  a2dp_bitrate_controller_report_dropped_packets(&controller_, 0);
+  EXPECT_EQ(Update(0, 1), 0);
+
+  // Even while the queue is given time to drain
+  a2dp_bitrate_controller_report_dropped_packets(&controller_, 4);
+  EXPECT_EQ(Update(0, 1), 1);
+  EXPECT_EQ(controller_.level, 2);
+}
+
+TEST_F(A2dpBitrateControllerTest, failed_contacts_step_down) {
+  // The first report is the reference
+  a2dp_bitrate_controller_report_failed_contact_counter(&controller_, 10);
+  EXPECT_EQ(Update(0, 1), 0);
+
+  a2dp_bitrate_controller_report_failed_contact_counter(&controller_, 10);
+  EXPECT_EQ(Update(0, 1), 0);
+
+  a2dp_bitrate_controller_report_failed_contact_counter(&controller_, 12);
+  EXPECT_EQ(Update(0, 1), 1);
+  EXPECT_EQ(controller_.level, 1);
+}
+
+TEST_F(A2dpBitrateControllerTest, single_level_never_changes) {
+  a2dp_bitrate_controller_reset(&controller_, 1);
+  a2dp_bitrate_controller_report_dropped_packets(&controller_, 4);
+  EXPECT_EQ(Update(10, 100), 0);
+  EXPECT_EQ(controller_.level, 0);
+}
+
+TEST_F(A2dpBitrateControllerTest, scale_bitrate) {
+  EXPECT_EQ(a2dp_bitrate_controller_scale_bitrate(&controller_, 320000),
+            320000u);
+  Update(10, 100);
+  EXPECT_EQ(a2dp_bitrate_controller_scale_bitrate(&controller_, 320000),
+            200000u);
+}
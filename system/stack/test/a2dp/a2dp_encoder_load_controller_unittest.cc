@@ -0,0 +1,97 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stack/include/a2dp_encoder_load_controller.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+constexpr int kLevels = 4;
+constexpr uint32_t kIntervalUs = 20000;
+constexpr int kRecoveryTicks = 250;
+
+class A2dpEncoderLoadControllerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    a2dp_encoder_load_controller_reset(&controller_, kLevels, kIntervalUs);
+  }
+
+  // Updates the controller |ticks| times, returns the number of level changes
+  int Update(uint32_t encode_us, int ticks) {
+    int changes = 0;
+    for (int i = 0; i < ticks; i++) {
+      if (a2dp_encoder_load_controller_update(&controller_, encode_us)) {
+        changes++;
+      }
+    }
+    return changes;
+  }
+
+  tA2DP_ENCODER_LOAD_CONTROLLER controller_;
+};
+}  // namespace
+
+TEST_F(A2dpEncoderLoadControllerTest, moderate_load_keeps_level) {
+  EXPECT_EQ(Update(8000, 2 * kRecoveryTicks), 0);
+  EXPECT_EQ(controller_.level, 0);
+  EXPECT_EQ(controller_.deadline_misses, 0u);
+}
+
+TEST_F(A2dpEncoderLoadControllerTest, high_load_steps_down) {
+  EXPECT_EQ(Update(12000, 3), 0);
+  EXPECT_EQ(Update(12000, 1), 1);
+  EXPECT_EQ(controller_.level, 1);
+
+  // The lower complexity is given time to show before the next step down
+  EXPECT_EQ(Update(12000, 9), 0);
+  EXPECT_EQ(Update(12000, 1), 1);
+  EXPECT_EQ(controller_.level, 2);
+}
+
+TEST_F(A2dpEncoderLoadControllerTest, deadline_miss_steps_down_right_away) {
+  EXPECT_TRUE(a2dp_encoder_load_controller_update(&controller_, kIntervalUs));
+  EXPECT_EQ(controller_.level, 1);
+  EXPECT_EQ(controller_.deadline_misses, 1u);
+  EXPECT_EQ(controller_.max_encode_us, kIntervalUs);
+}
+
+TEST_F(A2dpEncoderLoadControllerTest, level_stays_in_range) {
+  EXPECT_EQ(Update(30000, 100), kLevels - 1);
+  EXPECT_EQ(controller_.level, kLevels - 1);
+
+  EXPECT_EQ(Update(1000, 100 * kRecoveryTicks), kLevels - 1);
+  EXPECT_EQ(controller_.level, 0);
+}
+
+TEST_F(A2dpEncoderLoadControllerTest, steps_up_once_encoding_is_cheap) {
+  Update(kIntervalUs, 1);
+  ASSERT_EQ(controller_.level, 1);
+
+  EXPECT_EQ(Update(1000, kRecoveryTicks - 1), 0);
+  // A busier tick restarts the recovery
+  EXPECT_EQ(Update(6000, 1), 0);
+  EXPECT_EQ(Update(1000, kRecoveryTicks - 1), 0);
+  EXPECT_EQ(Update(1000, 1), 1);
+  EXPECT_EQ(controller_.level, 0);
+  EXPECT_EQ(controller_.adjustments, 2u);
+}
+
+TEST_F(A2dpEncoderLoadControllerTest, single_level_counts_deadline_misses) {
+  a2dp_encoder_load_controller_reset(&controller_, 1, kIntervalUs);
+  EXPECT_EQ(Update(30000, 10), 0);
+  EXPECT_EQ(controller_.level, 0);
+  EXPECT_EQ(controller_.deadline_misses, 10u);
+}
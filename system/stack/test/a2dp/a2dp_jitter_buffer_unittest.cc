@@ -0,0 +1,141 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stack/include/a2dp_jitter_buffer.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+constexpr uint32_t kTickUs = 20000;
+constexpr size_t kMaxDepth = 27;
+constexpr uint32_t kPacketUs = 10000;
+
+class A2dpJitterBufferTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    a2dp_jitter_buffer_reset(&jitter_buffer_, kTickUs, kMaxDepth);
+  }
+
+  // Receives |count| packets, every other one |jitter_us| late
+  void Receive(int count, uint32_t jitter_us) {
+    for (int i = 0; i < count; i++) {
+      now_us_ += kPacketUs;
+      a2dp_jitter_buffer_on_arrival(&jitter_buffer_,
+                                    now_us_ + ((i % 2) ? jitter_us : 0), 1);
+    }
+  }
+
+  tA2DP_JITTER_BUFFER jitter_buffer_;
+  uint64_t now_us_ = 0;
+};
+}  // namespace
+
+TEST_F(A2dpJitterBufferTest, default_depth_until_the_jitter_is_known) {
+  EXPECT_EQ(a2dp_jitter_buffer_target_depth(&jitter_buffer_),
+            (size_t)A2DP_JITTER_BUFFER_DEFAULT_DEPTH);
+  Receive(8, 0);
+  EXPECT_EQ(a2dp_jitter_buffer_target_depth(&jitter_buffer_),
+            (size_t)A2DP_JITTER_BUFFER_DEFAULT_DEPTH);
+}
+
+TEST_F(A2dpJitterBufferTest, depth_follows_the_jitter) {
+  Receive(100, 0);
+  EXPECT_EQ(jitter_buffer_.mean_interval_us, kPacketUs);
+  EXPECT_EQ(jitter_buffer_.jitter_us, 0u);
+  // One tick of packets
+  EXPECT_EQ(a2dp_jitter_buffer_target_depth(&jitter_buffer_), 2u);
+
+  Receive(200, 8000);
+  EXPECT_GT(jitter_buffer_.jitter_us, 6000u);
+  EXPECT_GT(a2dp_jitter_buffer_target_depth(&jitter_buffer_), 4u);
+  EXPECT_LE(a2dp_jitter_buffer_target_depth(&jitter_buffer_), kMaxDepth / 2);
+}
+
+TEST_F(A2dpJitterBufferTest, stream_gaps_are_not_jitter) {
+  Receive(100, 0);
+  now_us_ += 5000000;
+  Receive(1, 0);
+  a2dp_jitter_buffer_flush(&jitter_buffer_);
+  now_us_ += 300000;
+  Receive(1, 0);
+  EXPECT_EQ(jitter_buffer_.jitter_us, 0u);
+  EXPECT_EQ(jitter_buffer_.packets_received, 102u);
+}
+
+TEST_F(A2dpJitterBufferTest, buffers_before_the_playout) {
+  bool play = true;
+  EXPECT_EQ(a2dp_jitter_buffer_on_tick(&jitter_buffer_, 4, &play), 0u);
+  EXPECT_FALSE(play);
+  EXPECT_FALSE(a2dp_jitter_buffer_needs_audio(&jitter_buffer_));
+
+  EXPECT_EQ(a2dp_jitter_buffer_on_tick(&jitter_buffer_, 5, &play), 0u);
+  EXPECT_TRUE(play);
+  EXPECT_TRUE(a2dp_jitter_buffer_needs_audio(&jitter_buffer_));
+  a2dp_jitter_buffer_on_decoded(&jitter_buffer_, kPacketUs);
+  EXPECT_TRUE(a2dp_jitter_buffer_needs_audio(&jitter_buffer_));
+  a2dp_jitter_buffer_on_decoded(&jitter_buffer_, kPacketUs);
+  EXPECT_FALSE(a2dp_jitter_buffer_needs_audio(&jitter_buffer_));
+}
+
+TEST_F(A2dpJitterBufferTest, underrun_is_concealed_then_rebuffers) {
+  bool play = false;
+  a2dp_jitter_buffer_on_tick(&jitter_buffer_, 5, &play);
+  ASSERT_TRUE(play);
+
+  for (int tick = 0; tick < 3; tick++) {
+    if (tick > 0) a2dp_jitter_buffer_on_tick(&jitter_buffer_, 0, &play);
+    while (a2dp_jitter_buffer_needs_audio(&jitter_buffer_)) {
+      ASSERT_TRUE(a2dp_jitter_buffer_on_underrun(&jitter_buffer_));
+      a2dp_jitter_buffer_on_concealed(&jitter_buffer_, kPacketUs);
+    }
+  }
+  EXPECT_EQ(jitter_buffer_.underruns, 1u);
+  EXPECT_EQ(jitter_buffer_.concealed_frames, 6u);
+  EXPECT_EQ(jitter_buffer_.concealed_us, 6u * kPacketUs);
+
+  a2dp_jitter_buffer_on_tick(&jitter_buffer_, 0, &play);
+  EXPECT_FALSE(a2dp_jitter_buffer_on_underrun(&jitter_buffer_));
+  EXPECT_FALSE(a2dp_jitter_buffer_needs_audio(&jitter_buffer_));
+  a2dp_jitter_buffer_on_tick(&jitter_buffer_, 1, &play);
+  EXPECT_FALSE(play);
+}
+
+TEST_F(A2dpJitterBufferTest, nothing_to_conceal_gives_up_the_tick) {
+  bool play = false;
+  a2dp_jitter_buffer_on_tick(&jitter_buffer_, 5, &play);
+  ASSERT_TRUE(a2dp_jitter_buffer_on_underrun(&jitter_buffer_));
+  a2dp_jitter_buffer_on_concealed(&jitter_buffer_, 0);
+  EXPECT_FALSE(a2dp_jitter_buffer_needs_audio(&jitter_buffer_));
+  EXPECT_EQ(jitter_buffer_.concealed_frames, 0u);
+  EXPECT_EQ(jitter_buffer_.underrun_us, kTickUs);
+}
+
+TEST_F(A2dpJitterBufferTest, excess_latency_is_dropped) {
+  bool play = false;
+  size_t num_dropped = 0;
+  // Short bursts above the target are kept
+  for (int tick = 0; tick < 100; tick++) {
+    num_dropped += a2dp_jitter_buffer_on_tick(
+        &jitter_buffer_, (tick % 10) ? 12 : 5, &play);
+  }
+  EXPECT_EQ(num_dropped, 0u);
+
+  for (int tick = 0; tick < 50; tick++) {
+    num_dropped += a2dp_jitter_buffer_on_tick(&jitter_buffer_, 12, &play);
+  }
+  EXPECT_EQ(num_dropped, 12u - A2DP_JITTER_BUFFER_DEFAULT_DEPTH);
+  EXPECT_EQ(jitter_buffer_.dropped_packets, num_dropped);
+}
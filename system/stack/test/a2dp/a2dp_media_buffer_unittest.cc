@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stack/include/a2dp_media_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include "osi/include/allocator.h"
+
+TEST(A2dpMediaBufferTest, alloc_reserves_headroom) {
+  BT_HDR* p_buf = a2dp_media_buffer_alloc(A2DP_MEDIA_BUFFER_HEADROOM + 1);
+  ASSERT_NE(p_buf, nullptr);
+  EXPECT_EQ(p_buf->offset, A2DP_MEDIA_BUFFER_HEADROOM + 1);
+  EXPECT_EQ(p_buf->len, 0);
+  EXPECT_EQ(p_buf->layer_specific, 0);
+  osi_free(p_buf);
+}
+
+TEST(A2dpMediaBufferTest, headers_are_prepended_in_place) {
+  const uint16_t payload_offset = A2DP_MEDIA_BUFFER_HEADROOM + 1;
+  const uint16_t payload_len = A2DP_MEDIA_BUFFER_MAX_PAYLOAD(payload_offset);
+  BT_HDR* p_buf = a2dp_media_buffer_alloc(payload_offset);
+  uint8_t* p_payload = (uint8_t*)(p_buf + 1) + p_buf->offset;
+  // The last byte of the largest payload is still in the buffer
+  p_payload[payload_len - 1] = 0xaa;
+  p_buf->len = payload_len;
+
+  // Codec media payload header, content protection header, RTP header,
+  // L2CAP basic mode header and HCI ACL preamble
+  const uint16_t headers[] = {1, A2DP_MEDIA_BUFFER_CP_HDR_LEN,
+                              AVDT_MEDIA_HDR_SIZE, 4, 4};
+  for (uint16_t header_len : headers) {
+    ASSERT_GE(p_buf->offset, header_len);
+    p_buf->offset -= header_len;
+    p_buf->len += header_len;
+  }
+  EXPECT_EQ((uint8_t*)(p_buf + 1) + p_buf->offset + p_buf->len,
+            p_payload + payload_len);
+  osi_free(p_buf);
+}
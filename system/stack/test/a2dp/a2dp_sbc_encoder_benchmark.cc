@@ -0,0 +1,98 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "embdrv/sbc/encoder/include/sbc_encoder.h"
+#include "test_util.h"
+#include "wav_reader.h"
+
+using ::benchmark::State;
+using bluetooth::testing::GetWavFilePath;
+using bluetooth::testing::WavReader;
+
+namespace {
+
+// 16 bit stereo PCM at 44.1 kHz
+constexpr char kWavFile[] = "test/a2dp/raw_data/pcm1644s.wav";
+
+// Encode the whole reference PCM file, with the number of subbands and the
+// bit pool given by the ranges of |state|
+void EncodeCorpus(State& state, int16_t channel_mode) {
+  static WavReader wav_reader(GetWavFilePath(kWavFile).c_str());
+  const int16_t* pcm =
+      reinterpret_cast<const int16_t*>(wav_reader.GetSamples());
+  size_t num_pcm_samples = wav_reader.GetSampleCount() / sizeof(int16_t);
+
+  SBC_ENC_PARAMS params{};
+  params.s16SamplingFreq = SBC_sf44100;
+  params.s16ChannelMode = channel_mode;
+  params.s16NumOfSubBands = state.range(0);
+  params.s16NumOfChannels = channel_mode == SBC_MONO ? 1 : 2;
+  params.s16NumOfBlocks = SBC_MAX_NUM_OF_BLOCKS;
+  params.s16AllocationMethod = SBC_LOUDNESS;
+  params.s16BitPool = state.range(1);
+  params.Format = SBC_FORMAT_GENERAL;
+
+  size_t frame_samples = params.s16NumOfSubBands * params.s16NumOfBlocks;
+  std::vector<int16_t> input(frame_samples * params.s16NumOfChannels);
+  uint8_t output[1024];
+  size_t num_frames = 0;
+  for (auto _ : state) {
+    SBC_Encoder_Init(&params);
+    // Stereo PCM samples are interleaved, mono takes the left channel
+    for (size_t offset = 0; offset + 2 * frame_samples <= num_pcm_samples;
+         offset += 2 * frame_samples) {
+      if (params.s16NumOfChannels == 2) {
+        memcpy(input.data(), pcm + offset, 2 * frame_samples * sizeof(int16_t));
+      } else {
+        for (size_t i = 0; i < frame_samples; i++) {
+          input[i] = pcm[offset + 2 * i];
+        }
+      }
+      benchmark::DoNotOptimize(SBC_Encode(&params, input.data(), output));
+      num_frames++;
+    }
+  }
+  state.SetItemsProcessed(num_frames);
+}
+
+}  // namespace
+
+static void BM_SbcEncodeJointStereo(State& state) {
+  EncodeCorpus(state, SBC_JOINT_STEREO);
+}
+// Bit pools of the high and middle quality A2DP source settings, then with
+// 4 subbands
+BENCHMARK(BM_SbcEncodeJointStereo)
+    ->Args({8, 53})
+    ->Args({8, 35})
+    ->Args({4, 31});
+
+static void BM_SbcEncodeMono(State& state) { EncodeCorpus(state, SBC_MONO); }
+BENCHMARK(BM_SbcEncodeMono)->Args({8, 31});
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+}
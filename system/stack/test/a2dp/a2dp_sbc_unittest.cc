@@ -241,6 +241,52 @@ TEST_F(A2dpSbcTest, decoded_data_cb_invoked) {
   osi_free(packet);
 }
 
+TEST_F(A2dpSbcTest, decoder_conceal_repeats_the_last_packet) {
+  promise = {};
+  static uint32_t decoded_len = 0;
+  auto data_cb = +[](uint8_t* p_buf, uint32_t len) { decoded_len = len; };
+  InitializeDecoder(data_cb);
+  // Nothing to repeat yet
+  ASSERT_FALSE(decoder_iface_->decoder_conceal());
+
+  auto read_cb = +[](uint8_t* p_buf, uint32_t len) -> uint32_t {
+    static uint32_t counter = 0;
+    memcpy(p_buf, wav_reader.GetSamples() + counter, len);
+    counter += len;
+    return len;
+  };
+  auto enqueue_cb = +[](BT_HDR* p_buf, size_t frames_n, uint32_t len) -> bool {
+    static bool first_invocation = true;
+    if (first_invocation) {
+      packet = reinterpret_cast<BT_HDR*>(
+          osi_malloc(sizeof(*p_buf) + p_buf->len + 1));
+      memcpy(packet, p_buf, sizeof(*p_buf));
+      packet->offset = 0;
+      memcpy(packet->data + 1, p_buf->data + p_buf->offset, p_buf->len);
+      packet->data[0] = frames_n;
+      packet->len += 1;
+      promise.set_value();
+    }
+    first_invocation = false;
+    osi_free(p_buf);
+    return false;
+  };
+  InitializeEncoder(true, read_cb, enqueue_cb);
+
+  uint64_t timestamp_us = bluetooth::common::time_gettimeofday_us();
+  encoder_iface_->send_frames(timestamp_us);
+
+  promise.get_future().wait();
+  ASSERT_TRUE(decoder_iface_->decode_packet(packet));
+  osi_free(packet);
+  uint32_t packet_decoded_len = decoded_len;
+  ASSERT_GT(packet_decoded_len, 0u);
+
+  decoded_len = 0;
+  ASSERT_TRUE(decoder_iface_->decoder_conceal());
+  ASSERT_EQ(decoded_len, packet_decoded_len);
+}
+
 TEST_F(A2dpSbcTest, set_source_codec_config_works) {
   uint8_t codec_info_result[AVDT_CODEC_SIZE];
   ASSERT_TRUE(a2dp_codecs_->setCodecConfig(kCodecInfoSbcCapability, true, codec_info_result, true));
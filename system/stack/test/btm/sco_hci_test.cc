@@ -267,6 +267,30 @@ TEST_F(ScoHciSwbWithInitCleanTest, SwbEnqueuePacket) {
   ASSERT_EQ(bluetooth::audio::sco::swb::enqueue_packet(payload, false), false);
 }
 
+TEST_F(ScoHciSwbTest, SwbEnqueueUnalignedPackets) {
+  ASSERT_EQ(bluetooth::audio::sco::swb::init(72), size_t(72));
+
+  // A stream of LC3 frames preceded by a few bytes of garbage, so that the
+  // frame heads never align with the 72 bytes SCO packets
+  std::vector<uint8_t> stream(5, 0);
+  for (size_t i = 0; i < 12; i++)
+    stream.insert(stream.end(), lc3_zero_packet.begin(), lc3_zero_packet.end());
+
+  const uint8_t* decoded = nullptr;
+  size_t num_decoded = 0;
+  for (size_t offset = 0; offset + 72 <= stream.size(); offset += 72) {
+    std::vector<uint8_t> payload(stream.begin() + offset,
+                                 stream.begin() + offset + 72);
+    ASSERT_EQ(bluetooth::audio::sco::swb::enqueue_packet(payload, false),
+              true);
+    while (bluetooth::audio::sco::swb::decode(&decoded)) num_decoded++;
+  }
+  // All of the 11 complete frames are decoded, none is dropped for the lack
+  // of buffer space
+  ASSERT_EQ(num_decoded, size_t(11));
+  bluetooth::audio::sco::swb::cleanup();
+}
+
 TEST_F(ScoHciWbsTest, WbsDecodeWithoutInit) {
   const uint8_t* decoded = nullptr;
   // Return 0 if buffer is uninitialized
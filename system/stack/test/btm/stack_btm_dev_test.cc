@@ -23,6 +23,27 @@
 #include "test/common/mock_functions.h"
 #include "test/mock/mock_main_shim_entry.h"
 
+namespace bluetooth {
+namespace testing {
+namespace legacy {
+
+void wipe_secrets_and_remove(tBTM_SEC_DEV_REC* p_dev_rec);
+
+}  // namespace legacy
+}  // namespace testing
+}  // namespace bluetooth
+
+using bluetooth::testing::legacy::wipe_secrets_and_remove;
+
+namespace {
+
+const RawAddress kRawAddress1 = RawAddress({0x00, 0x11, 0x22, 0x33, 0x44, 0x55});
+const RawAddress kRawAddress2 = RawAddress({0x00, 0x11, 0x22, 0x33, 0x44, 0x66});
+const RawAddress kRawAddress3 = RawAddress({0x00, 0x11, 0x22, 0x33, 0x44, 0x77});
+constexpr uint16_t kHandle = 0x0040;
+
+}  // namespace
+
 class StackBtmTest : public testing::Test {
  public:
  protected:
@@ -48,3 +69,80 @@ TEST_F(StackBtmDevTest, btm_sec_allocate_dev_rec__with_list) {
   ASSERT_NE(nullptr, btm_sec_allocate_dev_rec());
   ::btm_sec_cb.Free();
 }
+
+class StackBtmDevWithInitFreeTest : public StackBtmDevTest {
+ protected:
+  void SetUp() override {
+    StackBtmDevTest::SetUp();
+    ::btm_sec_cb.Init(BTM_SEC_MODE_SC);
+  }
+  void TearDown() override {
+    ::btm_sec_cb.Free();
+    StackBtmDevTest::TearDown();
+  }
+
+  tBTM_SEC_DEV_REC* AllocateRecord(const RawAddress& bd_addr) {
+    tBTM_SEC_DEV_REC* p_dev_rec = btm_sec_allocate_dev_rec();
+    p_dev_rec->bd_addr = bd_addr;
+    p_dev_rec->hci_handle = HCI_INVALID_HANDLE;
+    p_dev_rec->ble_hci_handle = HCI_INVALID_HANDLE;
+    return p_dev_rec;
+  }
+};
+
+TEST_F(StackBtmDevWithInitFreeTest, btm_find_dev__follows_address_changes) {
+  tBTM_SEC_DEV_REC* p_dev_rec1 = AllocateRecord(kRawAddress1);
+  tBTM_SEC_DEV_REC* p_dev_rec2 = AllocateRecord(kRawAddress2);
+
+  ASSERT_EQ(p_dev_rec1, btm_find_dev(kRawAddress1));
+  ASSERT_EQ(p_dev_rec2, btm_find_dev(kRawAddress2));
+  ASSERT_EQ(p_dev_rec1, btm_find_dev(kRawAddress1));
+  ASSERT_EQ(nullptr, btm_find_dev(kRawAddress3));
+
+  // A record that no longer matches is not returned
+  p_dev_rec2->bd_addr = kRawAddress3;
+  ASSERT_EQ(nullptr, btm_find_dev(kRawAddress2));
+  ASSERT_EQ(p_dev_rec2, btm_find_dev(kRawAddress3));
+
+  // The first record matching in the list is returned
+  p_dev_rec1->ble.pseudo_addr = kRawAddress3;
+  btm_dev_addresses_changed();
+  ASSERT_EQ(p_dev_rec1, btm_find_dev(kRawAddress3));
+}
+
+TEST_F(StackBtmDevWithInitFreeTest, btm_find_dev__removed_record) {
+  tBTM_SEC_DEV_REC* p_dev_rec1 = AllocateRecord(kRawAddress1);
+  tBTM_SEC_DEV_REC* p_dev_rec2 = AllocateRecord(kRawAddress2);
+  p_dev_rec2->ble.pseudo_addr = kRawAddress1;
+
+  ASSERT_EQ(p_dev_rec1, btm_find_dev(kRawAddress1));
+  wipe_secrets_and_remove(p_dev_rec1);
+  ASSERT_EQ(p_dev_rec2, btm_find_dev(kRawAddress1));
+  ASSERT_EQ(1u, list_length(::btm_sec_cb.sec_dev_rec));
+}
+
+TEST_F(StackBtmDevWithInitFreeTest, btm_find_dev_by_handle) {
+  tBTM_SEC_DEV_REC* p_dev_rec1 = AllocateRecord(kRawAddress1);
+  tBTM_SEC_DEV_REC* p_dev_rec2 = AllocateRecord(kRawAddress2);
+
+  ASSERT_EQ(nullptr, btm_find_dev_by_handle(kHandle));
+  p_dev_rec2->ble_hci_handle = kHandle;
+  ASSERT_EQ(p_dev_rec2, btm_find_dev_by_handle(kHandle));
+  ASSERT_EQ(p_dev_rec2, btm_find_dev_by_handle(kHandle));
+
+  // Handle reused by another connection after a disconnection
+  p_dev_rec2->ble_hci_handle = HCI_INVALID_HANDLE;
+  p_dev_rec1->hci_handle = kHandle;
+  ASSERT_EQ(p_dev_rec1, btm_find_dev_by_handle(kHandle));
+}
+
+TEST_F(StackBtmDevWithInitFreeTest, btm_find_dev__list_replaced) {
+  tBTM_SEC_DEV_REC* p_dev_rec1 = AllocateRecord(kRawAddress1);
+  ASSERT_EQ(p_dev_rec1, btm_find_dev(kRawAddress1));
+
+  ::btm_sec_cb.Free();
+  ::btm_sec_cb.Init(BTM_SEC_MODE_SC);
+  ASSERT_EQ(nullptr, btm_find_dev(kRawAddress1));
+  tBTM_SEC_DEV_REC* p_dev_rec2 = AllocateRecord(kRawAddress1);
+  ASSERT_EQ(p_dev_rec2, btm_find_dev(kRawAddress1));
+}
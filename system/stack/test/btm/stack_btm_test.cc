@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "common/init_flags.h"
 #include "hci/controller_interface_mock.h"
@@ -31,9 +32,11 @@
 #include "stack/btm/btm_sco.h"
 #include "stack/btm/btm_sec.h"
 #include "stack/btm/btm_sec_cb.h"
+#include "stack/btm/neighbor_inquiry.h"
 #include "stack/include/acl_api.h"
 #include "stack/include/acl_hci_link_interface.h"
 #include "stack/include/btm_client_interface.h"
+#include "stack/include/inq_hci_link_interface.h"
 #include "stack/l2cap/l2c_int.h"
 #include "test/common/mock_functions.h"
 #include "test/mock/mock_legacy_hci_interface.h"
@@ -47,6 +50,14 @@ extern tBTM_CB btm_cb;
 
 tL2C_CB l2cb;
 
+namespace bluetooth {
+namespace legacy {
+namespace testing {
+void btm_clr_inq_db(const RawAddress* p_bda);
+}  // namespace testing
+}  // namespace legacy
+}  // namespace bluetooth
+
 const std::string kSmpOptions("mock smp options");
 const std::string kBroadcastAudioConfigOptions(
     "mock broadcast audio config options");
@@ -307,3 +318,48 @@ TEST_F(StackBtmWithInitFreeTest, is_disconnect_reason_valid) {
 TEST_F(StackBtmWithInitFreeTest, Init) {
   ASSERT_FALSE(btm_cb.btm_inq_vars.remname_active);
 }
+
+TEST_F(StackBtmTest, btm_inq_db_find) {
+  bluetooth::legacy::testing::btm_clr_inq_db(nullptr);
+  const tBTM_INQ_DB_STATS stats = btm_inq_db_get_stats();
+  const RawAddress bda1({0x11, 0x22, 0x33, 0x44, 0x55, 0x66});
+  const RawAddress bda2({0x11, 0x22, 0x33, 0x44, 0x55, 0x77});
+
+  ASSERT_EQ(nullptr, btm_inq_db_find(bda1));
+  tINQ_DB_ENT* p_ent1 = btm_inq_db_new(bda1, false);
+  tINQ_DB_ENT* p_ent2 = btm_inq_db_new(bda2, true);
+  ASSERT_EQ(p_ent1, btm_inq_db_find(bda1));
+  ASSERT_EQ(p_ent2, btm_inq_db_find(bda2));
+
+  bluetooth::legacy::testing::btm_clr_inq_db(&bda1);
+  ASSERT_EQ(nullptr, btm_inq_db_find(bda1));
+  ASSERT_EQ(p_ent2, btm_inq_db_find(bda2));
+
+  ASSERT_EQ(stats.hits + 3, btm_inq_db_get_stats().hits);
+  ASSERT_EQ(stats.misses + 2, btm_inq_db_get_stats().misses);
+  bluetooth::legacy::testing::btm_clr_inq_db(nullptr);
+  ASSERT_EQ(nullptr, btm_inq_db_find(bda2));
+}
+
+TEST_F(StackBtmTest, btm_inq_db_new__evicts_oldest) {
+  bluetooth::legacy::testing::btm_clr_inq_db(nullptr);
+  const tBTM_INQ_DB_STATS stats = btm_inq_db_get_stats();
+
+  // Classic devices use half of the database
+  std::vector<RawAddress> addresses;
+  for (int i = 0; i <= BTM_INQ_DB_SIZE / 2; i++) {
+    RawAddress bda({0x11, 0x22, 0x33, 0x44, 0x00, static_cast<uint8_t>(i)});
+    tINQ_DB_ENT* p_ent = btm_inq_db_new(bda, false);
+    p_ent->time_of_resp = i + 1;
+    addresses.push_back(bda);
+  }
+
+  ASSERT_EQ(stats.evictions + 1, btm_inq_db_get_stats().evictions);
+  ASSERT_EQ(nullptr, btm_inq_db_find(addresses.front()));
+  for (size_t i = 1; i < addresses.size(); i++) {
+    tINQ_DB_ENT* p_ent = btm_inq_db_find(addresses[i]);
+    ASSERT_NE(nullptr, p_ent);
+    ASSERT_EQ(addresses[i], p_ent->inq_info.results.remote_bd_addr);
+  }
+  bluetooth::legacy::testing::btm_clr_inq_db(nullptr);
+}
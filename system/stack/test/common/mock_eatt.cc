@@ -118,6 +118,10 @@ void EattExtension::StopAppIndicationTimer(const RawAddress& bd_addr,
   pimpl_->StopAppIndicationTimer(bd_addr, cid);
 }
 
+void EattExtension::Dump(int fd) {
+  if (pimpl_) pimpl_->Dump(fd);
+}
+
 void EattExtension::Start() {
   // It is needed here as IsoManager which is a singleton creates it, but in
   // this mock we want to destroy and recreate the mock on each test case.
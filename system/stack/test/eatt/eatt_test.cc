@@ -672,4 +672,19 @@ TEST_F(EattTest, ChannelUnavailableWhileReconfiguring) {
   ASSERT_EQ(available_channel_for_indication, nullptr);
 }
 
+TEST_F(EattTest, ClientRequestPrefersLargestMtu) {
+  ConnectDeviceEattSupported(3);
+
+  EattChannel* large_mtu_channel =
+      eatt_instance_->FindEattChannelByCid(test_address, connected_cids_[1]);
+  large_mtu_channel->EattChannelSetTxMTU(200);
+
+  auto available_channel_for_request =
+      eatt_instance_->GetChannelAvailableForClientRequest(test_address);
+  ASSERT_EQ(available_channel_for_request, large_mtu_channel);
+  ASSERT_EQ(large_mtu_channel->client_request_count_, 1u);
+
+  DisconnectEattDevice(connected_cids_);
+}
+
 }  // namespace
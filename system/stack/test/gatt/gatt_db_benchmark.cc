@@ -0,0 +1,135 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include "osi/include/allocator.h"
+#include "stack/gatt/gatt_int.h"
+#include "stack/include/bt_hdr.h"
+#include "stack/include/l2cdefs.h"
+#include "types/bluetooth/uuid.h"
+
+using ::benchmark::State;
+using bluetooth::Uuid;
+
+tGATT_CB gatt_cb;
+
+namespace {
+
+constexpr uint16_t kNumCharacteristics = 7;
+// Service declaration, then a declaration and a value per characteristic
+constexpr uint16_t kNumHandlesPerService = 1 + 2 * kNumCharacteristics;
+constexpr uint16_t kPayloadSize = 512;
+
+// A server exposing |num_services| services with 15 attributes each, as
+// started by GATTS_StartService.
+class GattDatabase {
+ public:
+  explicit GattDatabase(uint16_t num_services) : dbs_(num_services) {
+    uint16_t s_hdl = 1;
+    for (uint16_t i = 0; i < num_services; i++) {
+      gatts_init_service_db(dbs_[i], Uuid::From16Bit(0x1800 + i), true, s_hdl,
+                            kNumHandlesPerService);
+      for (uint16_t j = 0; j < kNumCharacteristics; j++) {
+        gatts_add_characteristic(dbs_[i], GATT_PERM_READ,
+                                 GATT_CHAR_PROP_BIT_READ,
+                                 Uuid::From16Bit(0x2a00 + j));
+      }
+      tGATT_SRV_LIST_ELEM& el = srv_list_info_.emplace_back();
+      el.s_hdl = s_hdl;
+      el.e_hdl = s_hdl + kNumHandlesPerService - 1;
+      el.p_db = &dbs_[i];
+      el.is_primary = true;
+      s_hdl += kNumHandlesPerService;
+    }
+    last_handle_ = s_hdl - 1;
+    gatt_cb.srv_list_info = &srv_list_info_;
+    gatt_sr_update_srv_range_table();
+  }
+
+  ~GattDatabase() {
+    gatt_cb.srv_range_table.clear();
+    gatt_cb.srv_list_info = nullptr;
+  }
+
+  uint16_t last_handle() const { return last_handle_; }
+
+ private:
+  std::vector<tGATT_SVC_DB> dbs_;
+  std::list<tGATT_SRV_LIST_ELEM> srv_list_info_;
+  uint16_t last_handle_;
+};
+
+}  // namespace
+
+// Read Multiple resolves the service and checks permissions of each handle
+static void BM_GattReadMultipleLookup(State& state) {
+  GattDatabase database(state.range(0));
+  tGATT_SEC_FLAG sec_flag{};
+  uint16_t handle = 1;
+  for (auto _ : state) {
+    auto it = gatt_sr_find_i_rcb_by_handle(handle);
+    benchmark::DoNotOptimize(
+        gatts_read_attr_perm_check(it->p_db, false, handle, sec_flag, 0));
+    handle = handle == database.last_handle() ? 1 : handle + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GattReadMultipleLookup)->Arg(4)->Arg(40)->Arg(200);
+
+// Read By Type of the characteristic declarations, one response PDU from the
+// start of each service as a client discovering the last services would do
+static void BM_GattReadByTypeCharacteristics(State& state) {
+  GattDatabase database(state.range(0));
+  tGATT_TCB tcb{};
+  tGATT_SEC_FLAG sec_flag{};
+  Uuid type = Uuid::From16Bit(GATT_UUID_CHAR_DECLARE);
+  BT_HDR* p_rsp = (BT_HDR*)osi_calloc(sizeof(BT_HDR) + kPayloadSize +
+                                      L2CAP_MIN_OFFSET);
+  uint16_t s_hdl = 1;
+  for (auto _ : state) {
+    p_rsp->len = 2;
+    p_rsp->offset = 0;
+    uint16_t len = kPayloadSize - 2;
+    uint16_t err_hdl = 0;
+    for (auto it = gatt_sr_find_i_rcb_by_handle(s_hdl);
+         it != gatt_cb.srv_list_info->end(); it++) {
+      if (gatts_db_read_attr_value_by_type(
+              tcb, L2CAP_ATT_CID, it->p_db, GATT_REQ_READ_BY_TYPE, p_rsp,
+              s_hdl, database.last_handle(), type, &len, sec_flag, 0, 0,
+              &err_hdl) == GATT_NO_RESOURCES) {
+        break;
+      }
+    }
+    s_hdl += kNumHandlesPerService;
+    if (s_hdl > database.last_handle()) s_hdl = 1;
+  }
+  osi_free(p_rsp);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GattReadByTypeCharacteristics)->Arg(4)->Arg(40)->Arg(200);
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+}
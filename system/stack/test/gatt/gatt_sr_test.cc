@@ -118,6 +118,9 @@ tGATT_STATUS gatts_write_attr_perm_check(tGATT_SVC_DB* p_db, uint8_t op_code,
   test_state_.gatts_write_attr_perm_check.access_count_++;
   return test_state_.gatts_write_attr_perm_check.return_status_;
 }
+tGATT_ATTR* find_attr_by_handle(tGATT_SVC_DB* p_db, uint16_t handle) {
+  return nullptr;
+}
 void gatt_update_app_use_link_flag(tGATT_IF gatt_if, tGATT_TCB* p_tcb,
                                    bool is_add, bool check_acl_link) {}
 bluetooth::common::MessageLoopThread* get_main_thread() { return nullptr; }
@@ -563,3 +566,31 @@ TEST_F(GattSrRobustCachingTest,
 
   ASSERT_FALSE(should_ignore);
 }
+
+TEST(GattSrServiceLookupTest, gatt_sr_find_i_rcb_by_handle) {
+  std::list<tGATT_SRV_LIST_ELEM> srv_list_info;
+  gatt_cb.srv_list_info = &srv_list_info;
+  for (uint16_t s_hdl : {0x0020, 0x0001, 0x0010}) {
+    tGATT_SRV_LIST_ELEM& el = srv_list_info.emplace_back();
+    el.s_hdl = s_hdl;
+    el.e_hdl = s_hdl + 0x000a;
+  }
+  gatt_sr_update_srv_range_table();
+
+  ASSERT_EQ(0x0001, gatt_sr_find_i_rcb_by_handle(0x0001)->s_hdl);
+  ASSERT_EQ(0x0001, gatt_sr_find_i_rcb_by_handle(0x000b)->s_hdl);
+  ASSERT_EQ(srv_list_info.end(), gatt_sr_find_i_rcb_by_handle(0x000c));
+  ASSERT_EQ(0x0010, gatt_sr_find_i_rcb_by_handle(0x0015)->s_hdl);
+  ASSERT_EQ(0x0020, gatt_sr_find_i_rcb_by_handle(0x002a)->s_hdl);
+  ASSERT_EQ(srv_list_info.end(), gatt_sr_find_i_rcb_by_handle(0x002b));
+  ASSERT_EQ(srv_list_info.end(), gatt_sr_find_i_rcb_by_handle(0x0000));
+
+  // Stopping a service rebuilds the table
+  srv_list_info.erase(gatt_sr_find_i_rcb_by_handle(0x0010));
+  gatt_sr_update_srv_range_table();
+  ASSERT_EQ(srv_list_info.end(), gatt_sr_find_i_rcb_by_handle(0x0015));
+  ASSERT_EQ(0x0020, gatt_sr_find_i_rcb_by_handle(0x0020)->s_hdl);
+
+  gatt_cb.srv_range_table.clear();
+  gatt_cb.srv_list_info = nullptr;
+}
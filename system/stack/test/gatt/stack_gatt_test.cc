@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/strings.h"
 #include "osi/include/allocator.h"
@@ -31,6 +32,7 @@
 #include "stack/include/gatt_api.h"
 #include "stack/include/l2c_api.h"
 #include "stack/sdp/internal/sdp_api.h"
+#include "test/mock/mock_stack_l2cap_api.h"
 #include "test/mock/mock_stack_sdp_legacy_api.h"
 #include "types/bluetooth/uuid.h"
 #include "types/raw_address.h"
@@ -385,3 +387,61 @@ TEST_F(StackGattTest, attp_build_value_cmd_read_by_type_test_long_data) {
       payload_size, op_code, handle, offset_0, data_size, data);
   ASSERT_EQ(ret, nullptr);
 }
+
+TEST_F(StackGattTest, GATTS_HandleValueNotificationMulti) {
+  gatt_init();
+  tGATT_IF gatt_if = GATT_Register(bluetooth::Uuid::GetRandom(), "multi",
+                                   &gatt_callbacks, false);
+
+  const std::vector<std::pair<RawAddress, uint16_t>> links = {
+      {RawAddress({0x11, 0x22, 0x33, 0x44, 0x55, 0x66}), 23},
+      {RawAddress({0x11, 0x22, 0x33, 0x44, 0x55, 0x67}), 23},
+      {RawAddress({0x11, 0x22, 0x33, 0x44, 0x55, 0x68}), 8},
+  };
+  std::vector<uint16_t> conn_ids;
+  for (const auto& [bda, payload_size] : links) {
+    tGATT_TCB* p_tcb = gatt_allocate_tcb_by_bdaddr(bda, BT_TRANSPORT_LE);
+    ASSERT_NE(p_tcb, nullptr);
+    p_tcb->att_lcid = L2CAP_ATT_CID;
+    p_tcb->payload_size = payload_size;
+    conn_ids.push_back(GATT_CREATE_CONN_ID(p_tcb->tcb_idx, gatt_if));
+  }
+  // Not connected
+  conn_ids.push_back(GATT_CREATE_CONN_ID(GATT_MAX_PHY_CHANNEL - 1, gatt_if));
+
+  std::vector<std::pair<RawAddress, std::vector<uint8_t>>> sent;
+  test::mock::stack_l2cap_api::L2CA_SendFixedChnlData.body =
+      [&](uint16_t /* fixed_cid */, const RawAddress& bda, BT_HDR* p_buf) {
+        const uint8_t* p = (const uint8_t*)(p_buf + 1) + p_buf->offset;
+        sent.emplace_back(bda, std::vector<uint8_t>(p, p + p_buf->len));
+        osi_free(p_buf);
+        return L2CAP_DW_SUCCESS;
+      };
+
+  uint8_t value[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto statuses = GATTS_HandleValueNotificationMulti(conn_ids, 0x0010,
+                                                     sizeof(value), value);
+  test::mock::stack_l2cap_api::L2CA_SendFixedChnlData = {};
+
+  ASSERT_EQ(statuses, std::vector<tGATT_STATUS>({GATT_SUCCESS, GATT_SUCCESS,
+                                                 GATT_SUCCESS,
+                                                 GATT_INVALID_CONN_ID}));
+  ASSERT_EQ(sent.size(), 3u);
+  const std::vector<uint8_t> pdu = {GATT_HANDLE_VALUE_NOTIF, 0x10, 0x00, 0, 1,
+                                    2, 3, 4, 5, 6, 7, 8, 9};
+  for (size_t i = 0; i < 2; i++) {
+    ASSERT_EQ(sent[i].first, links[i].first);
+    ASSERT_EQ(sent[i].second, pdu);
+  }
+  // Truncated to the ATT MTU of the link
+  ASSERT_EQ(sent[2].second, std::vector<uint8_t>(pdu.begin(), pdu.begin() + 8));
+
+  for (size_t i = 0; i < links.size(); i++) {
+    tGATT_TCB* p_tcb = gatt_find_tcb_by_addr(links[i].first, BT_TRANSPORT_LE);
+    ASSERT_EQ(p_tcb->notif_sent_count, 1u);
+    ASSERT_EQ(p_tcb->notif_sent_bytes, sent[i].second.size());
+  }
+
+  GATT_Deregister(gatt_if);
+  gatt_free();
+}
@@ -12,6 +12,7 @@
 #include "osi/test/alarm_mock.h"
 #include "stack/btm/neighbor_inquiry.h"
 #include "stack/gatt/connection_manager.h"
+#include "test/mock/mock_device_controller.h"
 
 using testing::_;
 using testing::DoAll;
@@ -47,6 +48,7 @@ std::unique_ptr<AcceptlistMock> localAcceptlistMock;
 
 RawAddress address1{{0x01, 0x01, 0x01, 0x01, 0x01, 0x01}};
 RawAddress address2{{0x22, 0x22, 0x02, 0x22, 0x33, 0x22}};
+RawAddress address3{{0x33, 0x33, 0x03, 0x33, 0x44, 0x33}};
 
 constexpr tAPP_ID CLIENT1 = 1;
 constexpr tAPP_ID CLIENT2 = 2;
@@ -98,6 +100,8 @@ class BleConnectionManager : public testing::Test {
 
   void TearDown() override {
     connection_manager::reset(true);
+    test::mock::device_controller::ble_acceptlist_size = 0;
+    test::mock::device_controller::ble_supported = false;
     AlarmMock::Reset();
     localAcceptlistMock.reset();
   }
@@ -390,4 +394,37 @@ TEST_F(BleConnectionManager,
   Mock::VerifyAndClearExpectations(localAcceptlistMock.get());
 }
 
+/** Verify that background connection targets that do not fit in the accept
+ * list wait for an entry, and get one once it is freed. */
+TEST_F(BleConnectionManager, test_background_connection_accept_list_full) {
+  test::mock::device_controller::ble_supported = true;
+  test::mock::device_controller::ble_acceptlist_size = 2;
+
+  EXPECT_CALL(*localAcceptlistMock, AcceptlistAdd(address1))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*localAcceptlistMock, AcceptlistAdd(address2))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*localAcceptlistMock, AcceptlistAdd(address3)).Times(0);
+  EXPECT_CALL(*localAcceptlistMock, EnableTargetedAnnouncements(true, _))
+      .Times(1);
+
+  EXPECT_TRUE(background_connect_add(CLIENT1, address1));
+  EXPECT_TRUE(background_connect_add(CLIENT1, address2));
+  EXPECT_TRUE(background_connect_add(CLIENT1, address3));
+  EXPECT_TRUE(is_background_connection(address3));
+
+  Mock::VerifyAndClearExpectations(localAcceptlistMock.get());
+
+  // Removing a target frees its entry for the waiting one
+  EXPECT_CALL(*localAcceptlistMock, AcceptlistRemove(address1)).Times(1);
+  EXPECT_CALL(*localAcceptlistMock, AcceptlistAdd(address3))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*localAcceptlistMock, EnableTargetedAnnouncements(false, _))
+      .Times(1);
+
+  EXPECT_TRUE(background_connect_remove(CLIENT1, address1));
+
+  Mock::VerifyAndClearExpectations(localAcceptlistMock.get());
+}
+
 }  // namespace connection_manager
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "stack/smp/p_256_ecc_pp.h"
+
+using ::benchmark::State;
+
+namespace {
+
+// Private key A of Sample 1, Bluetooth Core Specification
+// Version 5.0 | Vol 2, Part G | 7.1.2
+const uint32_t kPrivateKey[KEY_LENGTH_DWORDS_P256] = {
+    0xcd3c1abd, 0x5899b8a6, 0xeb40b799, 0x4aff607b,
+    0xd2103f50, 0x74c9b3e3, 0xa3c55f38, 0x3f49f6d4};
+
+}  // namespace
+
+// Public key generation with the generic point multiplication
+static void BM_EccPointMultBasePoint(State& state) {
+  p_256_init_curve();
+  for (auto _ : state) {
+    uint32_t private_key[KEY_LENGTH_DWORDS_P256];
+    memcpy(private_key, kPrivateKey, sizeof(private_key));
+    Point base_point = curve_p256.G;
+    Point public_key;
+    ECC_PointMult(&public_key, &base_point, private_key);
+    benchmark::DoNotOptimize(public_key);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EccPointMultBasePoint);
+
+// Public key generation with the precomputed base point table
+static void BM_EccPointMultFixedBase(State& state) {
+  for (auto _ : state) {
+    Point public_key;
+    ECC_PointMult_FixedBase(&public_key, kPrivateKey);
+    benchmark::DoNotOptimize(public_key);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EccPointMultFixedBase);
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -24,8 +24,10 @@
 #include "osi/include/allocator.h"
 #include "stack/avdt/avdt_int.h"
 #include "stack/include/avdt_api.h"
+#include "stack/include/l2c_api.h"
 #include "stack/test/common/mock_stack_avdt_msg.h"
 #include "test/common/mock_functions.h"
+#include "test/mock/mock_stack_l2cap_api.h"
 #include "types/raw_address.h"
 
 #ifndef UNUSED_ATTR
@@ -453,3 +455,58 @@ TEST_F(StackAvdtpTest, avdt_scb_hdl_pkt_no_frag_regression_test3) {
   // thus vt_data.p_pkt will be set to nullptr
   ASSERT_EQ(evt_data.p_pkt, nullptr);
 }
+
+TEST_F(StackAvdtpTest, test_write_media_in_streaming_state) {
+  auto pscb = avdt_scb_by_hdl(scb_handle_);
+  pscb->state = AVDT_SCB_STREAM_ST;
+  pscb->curr_evt = 0;
+  pscb->media_rtp_hdr = true;
+  pscb->media_ssrc = 0x11223344;
+  pscb->media_seq = 0;
+  ASSERT_EQ(avdt_scb_update_curr_stream(), 1);
+
+  static uint8_t rtp_hdr[AVDT_MEDIA_HDR_SIZE];
+  test::mock::stack_l2cap_api::L2CA_DataWrite.body = [](uint16_t /* cid */,
+                                                       BT_HDR* p_buf) {
+    memcpy(rtp_hdr, (uint8_t*)(p_buf + 1) + p_buf->offset, sizeof(rtp_hdr));
+    osi_free(p_buf);
+    return (uint8_t)L2CAP_DW_SUCCESS;
+  };
+
+  auto alloc_media = []() {
+    BT_HDR* p_buf = (BT_HDR*)osi_calloc(sizeof(BT_HDR) + AVDT_MEDIA_HDR_SIZE + 4);
+    p_buf->offset = AVDT_MEDIA_HDR_SIZE;
+    p_buf->len = 4;
+    return p_buf;
+  };
+
+  // Sent right away with the RTP header, without a state machine event
+  ASSERT_EQ(AVDT_WriteReqOpt(scb_handle_, alloc_media(), 0x01020304, 0x60, AVDT_DATA_OPT_NONE),
+            AVDT_SUCCESS);
+  ASSERT_EQ(get_func_call_count("L2CA_DataWrite"), 1);
+  ASSERT_EQ(callback_event_, AVDT_WRITE_CFM_EVT);
+  ASSERT_EQ(pscb->curr_evt, 0);
+  const uint8_t expected_hdr[AVDT_MEDIA_HDR_SIZE] = {0x80, 0x60, 0x00, 0x01, 0x01, 0x02,
+                                                     0x03, 0x04, 0x11, 0x22, 0x33, 0x44};
+  ASSERT_EQ(memcmp(rtp_hdr, expected_hdr, sizeof(expected_hdr)), 0);
+  ASSERT_EQ(pscb->media_pkts_sent, 1u);
+  ASSERT_EQ(pscb->media_bytes_sent, 4u + AVDT_MEDIA_HDR_SIZE);
+
+  // Held while congested, a newer packet replaces the held one
+  pscb->cong = true;
+  AVDT_WriteReqOpt(scb_handle_, alloc_media(), 0, 0x60, AVDT_DATA_OPT_NONE);
+  AVDT_WriteReqOpt(scb_handle_, alloc_media(), 0, 0x60, AVDT_DATA_OPT_NONE);
+  ASSERT_EQ(get_func_call_count("L2CA_DataWrite"), 1);
+  ASSERT_NE(pscb->p_pkt, nullptr);
+  ASSERT_EQ(pscb->media_pkts_dropped, 1u);
+
+  pscb->cong = false;
+  avdt_scb_chk_snd_pkt(pscb, nullptr);
+  ASSERT_EQ(get_func_call_count("L2CA_DataWrite"), 2);
+  ASSERT_EQ(pscb->p_pkt, nullptr);
+  ASSERT_EQ(pscb->media_pkts_sent, 2u);
+
+  test::mock::stack_l2cap_api::L2CA_DataWrite = {};
+  pscb->state = AVDT_SCB_IDLE_ST;
+  avdt_scb_update_curr_stream();
+}
@@ -83,3 +83,35 @@ TEST(GattDatabaseTest, matchExampleInBtSpecV52) {
 
   ASSERT_EQ(result_hash, expected_hash);
 }
+
+TEST(GattDatabaseTest, hashComputedOnceWhenNeeded) {
+  tGATT_SVC_DB local_db[2];
+  std::list<tGATT_SRV_LIST_ELEM> srv_list_info;
+  gatt_cb.srv_list_info = &srv_list_info;
+
+  add_item_to_list(srv_list_info, &local_db[0], true);
+  gatts_init_service_db(local_db[0], Uuid::From16Bit(0x1800), true, 0x0001, 3);
+  gatts_add_characteristic(local_db[0], GATT_PERM_READ, GATT_CHAR_PROP_BIT_READ,
+    Uuid::From16Bit(0x2A00));
+  gatt_cb.is_database_hash_stale = true;
+  Octet16 first_hash = gatts_get_database_hash();
+  ASSERT_FALSE(gatt_cb.is_database_hash_stale);
+  ASSERT_EQ(first_hash, gatts_calculate_database_hash(&srv_list_info));
+
+  // Services added after the hash was computed
+  add_item_to_list(srv_list_info, &local_db[1], false);
+  gatts_init_service_db(local_db[1], Uuid::From16Bit(0x180F), false, 0x0004, 3);
+  gatts_add_characteristic(local_db[1], GATT_PERM_READ, GATT_CHAR_PROP_BIT_READ,
+    Uuid::From16Bit(0x2A19));
+  ASSERT_EQ(first_hash, gatts_get_database_hash());
+  gatt_cb.is_database_hash_stale = true;
+  Octet16 second_hash = gatts_get_database_hash();
+  ASSERT_NE(first_hash, second_hash);
+
+  // Removing the service gives back the first hash
+  srv_list_info.pop_back();
+  gatt_cb.is_database_hash_stale = true;
+  ASSERT_EQ(first_hash, gatts_get_database_hash());
+
+  gatt_cb.srv_list_info = nullptr;
+}
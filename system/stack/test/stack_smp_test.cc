@@ -402,6 +402,33 @@ TEST(SmpEccValidationTest, test_invalid_points) {
   EXPECT_FALSE(ECC_ValidatePoint(p));
 }
 
+// Test public key generation with the fixed base point multiplication
+TEST(SmpEccValidationTest, test_fixed_base_point_mult) {
+  // Private key A of Sample 1, Bluetooth Core Specification
+  // Version 5.0 | Vol 2, Part G | 7.1.2
+  uint32_t private_key[KEY_LENGTH_DWORDS_P256] = {
+      0xcd3c1abd, 0x5899b8a6, 0xeb40b799, 0x4aff607b,
+      0xd2103f50, 0x74c9b3e3, 0xa3c55f38, 0x3f49f6d4};
+  uint32_t expected_x[KEY_LENGTH_DWORDS_P256] = {
+      0x0e359de6, 0xcc030148, 0xacf4fddb, 0xeff49111,
+      0xe9f9a5b9, 0x5e2c83a7, 0xf297be2c, 0x20b003d2};
+  uint32_t expected_y[KEY_LENGTH_DWORDS_P256] = {
+      0x1589d28b, 0x741c8ed0, 0x8fed3024, 0x766345c2,
+      0x5a52155c, 0x63329abf, 0x652aeb6d, 0xdc809c49};
+
+  Point p;
+  ECC_PointMult_FixedBase(&p, private_key);
+  EXPECT_EQ(0, memcmp(p.x, expected_x, sizeof(expected_x)));
+  EXPECT_EQ(0, memcmp(p.y, expected_y, sizeof(expected_y)));
+
+  // Same result as the generic point multiplication, which consumes the key
+  Point g = curve_p256.G;
+  Point q;
+  ECC_PointMult(&q, &g, private_key);
+  EXPECT_EQ(0, memcmp(q.x, expected_x, sizeof(expected_x)));
+  EXPECT_EQ(0, memcmp(q.y, expected_y, sizeof(expected_y)));
+}
+
 TEST(SmpStatusText, smp_status_text) {
   std::vector<std::pair<tSMP_STATUS, std::string>> status = {
       std::make_pair(SMP_SUCCESS, "SMP_SUCCESS"),
@@ -26,6 +26,7 @@
 #include "common/message_loop_thread.h"
 #include "include/hardware/bluetooth.h"
 #include "os/log.h"
+#include "stack/include/main_thread.h"
 
 using bluetooth::common::MessageLoopThread;
 using BtMainClosure = std::function<void()>;
@@ -68,3 +69,5 @@ void main_thread_shut_down() { main_thread.ShutDown(); }
 
 // osi_alarm
 bluetooth::common::MessageLoopThread* get_main_thread() { return &main_thread; }
+
+bluetooth::os::Thread* get_merged_main_thread() { return nullptr; }
@@ -69,6 +69,7 @@ void bta_av_dup_audio_buf(tBTA_AV_SCB* p_scb, BT_HDR* p_buf) {
   inc_func_call_count(__func__);
 }
 void bta_av_free_scb(tBTA_AV_SCB* p_scb) { inc_func_call_count(__func__); }
+void bta_av_update_audio_hold(void) { inc_func_call_count(__func__); }
 void bta_av_restore_switch(void) { inc_func_call_count(__func__); }
 void bta_av_sm_execute(tBTA_AV_CB* p_cb, uint16_t event, tBTA_AV_DATA* p_data) {
   inc_func_call_count(__func__);
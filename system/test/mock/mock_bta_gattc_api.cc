@@ -55,6 +55,10 @@ const std::list<gatt::Service>* BTA_GATTC_GetServices(uint16_t /* conn_id */) {
   inc_func_call_count(__func__);
   return nullptr;
 }
+bool BTA_GATTC_GetDatabaseHash(uint16_t /* conn_id */, Octet16* /* p_hash */) {
+  inc_func_call_count(__func__);
+  return false;
+}
 tGATT_STATUS BTA_GATTC_DeregisterForNotifications(tGATT_IF /* client_if */,
                                                   const RawAddress& /* bda */,
                                                   uint16_t /* handle */) {
@@ -70,6 +70,15 @@ void bta_hh_le_co_reset_rpt_cache(const tAclLinkSpec& /* link_spec */,
                                   uint8_t /* app_id */) {
   inc_func_call_count(__func__);
 }
+void bta_hh_le_co_save_db_hash(const tAclLinkSpec& /* link_spec */,
+                               const Octet16& /* db_hash */) {
+  inc_func_call_count(__func__);
+}
+bool bta_hh_le_co_load_db_hash(const tAclLinkSpec& /* link_spec */,
+                               Octet16* /* p_db_hash */) {
+  inc_func_call_count(__func__);
+  return false;
+}
 void bta_hh_le_co_rpt_info(const tAclLinkSpec& /* link_spec */,
                            tBTA_HH_RPT_CACHE_ENTRY* /* p_entry */,
                            uint8_t /* app_id */) {
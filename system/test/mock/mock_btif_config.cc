@@ -51,6 +51,8 @@ struct btif_config_get_bin btif_config_get_bin;
 struct btif_config_get_bin_length btif_config_get_bin_length;
 struct btif_config_set_bin btif_config_set_bin;
 struct btif_config_get_paired_devices btif_config_get_paired_devices;
+struct btif_config_get_paired_devices_with_key
+    btif_config_get_paired_devices_with_key;
 struct btif_config_remove btif_config_remove;
 struct btif_config_remove_device btif_config_remove_device;
 struct btif_config_clear btif_config_clear;
@@ -125,6 +127,11 @@ std::vector<RawAddress> btif_config_get_paired_devices() {
   inc_func_call_count(__func__);
   return test::mock::btif_config::btif_config_get_paired_devices();
 }
+std::vector<RawAddress> btif_config_get_paired_devices_with_key(
+    const std::string& key) {
+  inc_func_call_count(__func__);
+  return test::mock::btif_config::btif_config_get_paired_devices_with_key(key);
+}
 bool btif_config_remove(const std::string& section, const std::string& key) {
   inc_func_call_count(__func__);
   return test::mock::btif_config::btif_config_remove(section, key);
@@ -210,6 +210,19 @@ struct btif_config_get_paired_devices {
   std::vector<RawAddress> operator()() { return body(); };
 };
 extern struct btif_config_get_paired_devices btif_config_get_paired_devices;
+// Name: btif_config_get_paired_devices_with_key
+// Params: const std::string& key
+// Returns: std::vector<RawAddress>
+struct btif_config_get_paired_devices_with_key {
+  std::vector<RawAddress> raw_addresses;
+  std::function<std::vector<RawAddress>(const std::string& key)> body{
+      [this](const std::string& /* key */) { return raw_addresses; }};
+  std::vector<RawAddress> operator()(const std::string& key) {
+    return body(key);
+  };
+};
+extern struct btif_config_get_paired_devices_with_key
+    btif_config_get_paired_devices_with_key;
 // Name: btif_config_remove
 // Params: const std::string& section, const std::string& key
 // Returns: bool
@@ -38,6 +38,7 @@ namespace btif_storage {
 
 // Function state capture and return values, if needed
 struct btif_debug_linkkey_type_dump btif_debug_linkkey_type_dump;
+struct btif_debug_bonded_devices_load_dump btif_debug_bonded_devices_load_dump;
 struct btif_has_ble_keys btif_has_ble_keys;
 struct btif_in_fetch_bonded_ble_device btif_in_fetch_bonded_ble_device;
 struct btif_in_fetch_bonded_device btif_in_fetch_bonded_device;
@@ -137,6 +138,10 @@ void btif_debug_linkkey_type_dump(int fd) {
   inc_func_call_count(__func__);
   test::mock::btif_storage::btif_debug_linkkey_type_dump(fd);
 }
+void btif_debug_bonded_devices_load_dump(int fd) {
+  inc_func_call_count(__func__);
+  test::mock::btif_storage::btif_debug_bonded_devices_load_dump(fd);
+}
 bool btif_has_ble_keys(const std::string& bdstr) {
   inc_func_call_count(__func__);
   return test::mock::btif_storage::btif_has_ble_keys(bdstr);
@@ -55,6 +55,16 @@ struct btif_debug_linkkey_type_dump {
 };
 extern struct btif_debug_linkkey_type_dump btif_debug_linkkey_type_dump;
 
+// Name: btif_debug_bonded_devices_load_dump
+// Params: int fd
+// Return: void
+struct btif_debug_bonded_devices_load_dump {
+  std::function<void(int fd)> body{[](int /* fd */) {}};
+  void operator()(int fd) { body(fd); };
+};
+extern struct btif_debug_bonded_devices_load_dump
+    btif_debug_bonded_devices_load_dump;
+
 // Name: btif_has_ble_keys
 // Params: const std::string& bdstr
 // Return: bool
@@ -423,6 +423,19 @@ struct interop_get_allowlisted_media_players_list {
 extern struct interop_get_allowlisted_media_players_list
     interop_get_allowlisted_media_players_list;
 
+// Name: interop_get_check_count
+// Params: const interop_feature_t feature
+// Return: uint64_t
+struct interop_get_check_count {
+  static uint64_t return_value;
+  std::function<uint64_t(const interop_feature_t feature)> body{
+      [](const interop_feature_t /* feature */) { return return_value; }};
+  uint64_t operator()(const interop_feature_t feature) {
+    return body(feature);
+  };
+};
+extern struct interop_get_check_count interop_get_check_count;
+
 // Name: interop_match_addr
 // Params: const interop_feature_t feature, const RawAddress* addr
 // Return: bool
@@ -22,6 +22,7 @@
 #include <base/functional/bind.h>
 
 #include <cstdint>
+#include <string>
 
 #include "btif/include/btif_common.h"
 #include "include/hardware/bluetooth.h"
@@ -50,3 +51,16 @@ bt_status_t do_in_jni_thread(const base::Location& /* from_here */,
   do_in_jni_thread_task_queue.push(std::move(task));
   return BT_STATUS_SUCCESS;
 }
+bt_status_t do_in_jni_thread_coalesced(const base::Location& /* from_here */,
+                                       std::string /* key */,
+                                       base::OnceClosure task) {
+  inc_func_call_count(__func__);
+  do_in_jni_thread_task_queue.push(std::move(task));
+  return BT_STATUS_SUCCESS;
+}
+bt_status_t do_in_jni_thread_urgent(const base::Location& /* from_here */,
+                                    base::OnceClosure task) {
+  inc_func_call_count(__func__);
+  do_in_jni_thread_task_queue.push(std::move(task));
+  return BT_STATUS_SUCCESS;
+}
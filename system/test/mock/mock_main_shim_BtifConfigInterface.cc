@@ -84,6 +84,11 @@ std::vector<std::string>
 bluetooth::shim::BtifConfigInterface::GetPersistentDevices() {
   return std::vector<std::string>();
 }
+std::vector<std::string>
+bluetooth::shim::BtifConfigInterface::GetPersistentDevicesWithProperty(
+    const std::string& /* property */) {
+  return std::vector<std::string>();
+}
 void bluetooth::shim::BtifConfigInterface::
     ConvertEncryptOrDecryptKeyIfNeeded(){};
 void bluetooth::shim::BtifConfigInterface::Clear(){};
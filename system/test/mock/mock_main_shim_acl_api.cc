@@ -33,6 +33,11 @@ void bluetooth::shim::ACL_CreateClassicConnection(
     const RawAddress& /* raw_address */) {
   inc_func_call_count(__func__);
 }
+void bluetooth::shim::ACL_SetClassicPageParameters(
+    const RawAddress& /* raw_address */, uint8_t /* page_scan_rep_mode */,
+    uint16_t /* clock_offset */) {
+  inc_func_call_count(__func__);
+}
 void bluetooth::shim::ACL_CancelClassicConnection(
     const RawAddress& /* raw_address */) {
   inc_func_call_count(__func__);
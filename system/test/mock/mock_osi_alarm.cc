@@ -43,6 +43,7 @@ struct alarm_is_scheduled alarm_is_scheduled;
 struct alarm_new alarm_new;
 struct alarm_new_periodic alarm_new_periodic;
 struct alarm_set alarm_set;
+struct alarm_set_class alarm_set_class;
 struct alarm_set_on_mloop alarm_set_on_mloop;
 
 }  // namespace osi_alarm
@@ -87,6 +88,10 @@ void alarm_set(alarm_t* alarm, uint64_t interval_ms, alarm_callback_t cb,
   inc_func_call_count(__func__);
   test::mock::osi_alarm::alarm_set(alarm, interval_ms, cb, data);
 }
+void alarm_set_class(alarm_t* alarm, alarm_class_t alarm_class) {
+  inc_func_call_count(__func__);
+  test::mock::osi_alarm::alarm_set_class(alarm, alarm_class);
+}
 void alarm_set_on_mloop(alarm_t* alarm, uint64_t interval_ms,
                         alarm_callback_t cb, void* data) {
   inc_func_call_count(__func__);
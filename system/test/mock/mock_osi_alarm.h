@@ -131,6 +131,18 @@ struct alarm_set {
 };
 extern struct alarm_set alarm_set;
 
+// Name: alarm_set_class
+// Params: alarm_t* alarm, alarm_class_t alarm_class
+// Return: void
+struct alarm_set_class {
+  std::function<void(alarm_t* alarm, alarm_class_t alarm_class)> body{
+      [](alarm_t* /* alarm */, alarm_class_t /* alarm_class */) {}};
+  void operator()(alarm_t* alarm, alarm_class_t alarm_class) {
+    body(alarm, alarm_class);
+  };
+};
+extern struct alarm_set_class alarm_set_class;
+
 // Name: alarm_set_on_mloop
 // Params: alarm_t* alarm, uint64_t interval_ms, alarm_callback_t cb, void* data
 // Return: void
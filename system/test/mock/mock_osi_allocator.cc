@@ -84,5 +84,24 @@ char* osi_strndup(const char* str, size_t len) {
   inc_func_call_count(__func__);
   return test::mock::osi_allocator::osi_strndup(str, len);
 }
+void osi_allocator_pool_enable(void) { inc_func_call_count(__func__); }
+bool osi_allocator_pool_is_enabled(void) {
+  inc_func_call_count(__func__);
+  return false;
+}
+void osi_allocator_thread_cache_enable(void) { inc_func_call_count(__func__); }
+void osi_allocator_tagging_enable(void) { inc_func_call_count(__func__); }
+bool osi_allocator_tagging_is_enabled(void) {
+  inc_func_call_count(__func__);
+  return false;
+}
+void osi_allocator_set_thread_tag(const char* /* tag */) {
+  inc_func_call_count(__func__);
+}
+int64_t osi_allocator_get_tag_live_bytes(const char* /* tag */) {
+  inc_func_call_count(__func__);
+  return 0;
+}
+void osi_allocator_debug_dump(int /* fd */) { inc_func_call_count(__func__); }
 // Mocked functions complete
 // END mockcify generation
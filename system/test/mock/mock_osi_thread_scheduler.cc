@@ -34,6 +34,8 @@ namespace osi_thread_scheduler {
 // Function state capture and return values, if needed
 struct thread_scheduler_enable_real_time thread_scheduler_enable_real_time;
 struct thread_scheduler_get_priority_range thread_scheduler_get_priority_range;
+struct thread_scheduler_apply_policy thread_scheduler_apply_policy;
+struct thread_scheduler_debug_dump thread_scheduler_debug_dump;
 
 }  // namespace osi_thread_scheduler
 }  // namespace mock
@@ -50,5 +52,14 @@ bool thread_scheduler_get_priority_range(int& min, int& max) {
   return test::mock::osi_thread_scheduler::thread_scheduler_get_priority_range(
       min, max);
 }
+bool thread_scheduler_apply_policy(const char* thread_name) {
+  inc_func_call_count(__func__);
+  return test::mock::osi_thread_scheduler::thread_scheduler_apply_policy(
+      thread_name);
+}
+void thread_scheduler_debug_dump(int fd) {
+  inc_func_call_count(__func__);
+  test::mock::osi_thread_scheduler::thread_scheduler_debug_dump(fd);
+}
 // Mocked functions complete
 // END mockcify generation
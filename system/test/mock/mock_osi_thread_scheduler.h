@@ -58,6 +58,26 @@ struct thread_scheduler_get_priority_range {
 extern struct thread_scheduler_get_priority_range
     thread_scheduler_get_priority_range;
 
+// Name: thread_scheduler_apply_policy
+// Params: const char* thread_name
+// Return: bool
+struct thread_scheduler_apply_policy {
+  bool return_value{true};
+  std::function<bool(const char* thread_name)> body{
+      [this](const char* /* thread_name */) { return return_value; }};
+  bool operator()(const char* thread_name) { return body(thread_name); };
+};
+extern struct thread_scheduler_apply_policy thread_scheduler_apply_policy;
+
+// Name: thread_scheduler_debug_dump
+// Params: int fd
+// Return: void
+struct thread_scheduler_debug_dump {
+  std::function<void(int fd)> body{[](int /* fd */) {}};
+  void operator()(int fd) { body(fd); };
+};
+extern struct thread_scheduler_debug_dump thread_scheduler_debug_dump;
+
 }  // namespace osi_thread_scheduler
 }  // namespace mock
 }  // namespace test
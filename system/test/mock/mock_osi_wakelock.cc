@@ -16,7 +16,7 @@
 
 /*
  * Generated mock file from original source file
- *   Functions generated:6
+ *   Functions generated:8
  *
  *  mockcify.pl ver 0.3.0
  */
@@ -33,9 +33,11 @@ namespace osi_wakelock {
 
 // Function state capture and return values, if needed
 struct wakelock_acquire wakelock_acquire;
+struct wakelock_acquire_for wakelock_acquire_for;
 struct wakelock_cleanup wakelock_cleanup;
 struct wakelock_debug_dump wakelock_debug_dump;
 struct wakelock_release wakelock_release;
+struct wakelock_release_for wakelock_release_for;
 struct wakelock_set_os_callouts wakelock_set_os_callouts;
 struct wakelock_set_paths wakelock_set_paths;
 
@@ -48,6 +50,10 @@ bool wakelock_acquire(void) {
   inc_func_call_count(__func__);
   return test::mock::osi_wakelock::wakelock_acquire();
 }
+bool wakelock_acquire_for(const char* source) {
+  inc_func_call_count(__func__);
+  return test::mock::osi_wakelock::wakelock_acquire_for(source);
+}
 void wakelock_cleanup(void) {
   inc_func_call_count(__func__);
   test::mock::osi_wakelock::wakelock_cleanup();
@@ -60,6 +66,10 @@ bool wakelock_release(void) {
   inc_func_call_count(__func__);
   return test::mock::osi_wakelock::wakelock_release();
 }
+bool wakelock_release_for(const char* source) {
+  inc_func_call_count(__func__);
+  return test::mock::osi_wakelock::wakelock_release_for(source);
+}
 void wakelock_set_os_callouts(bt_os_callouts_t* callouts) {
   inc_func_call_count(__func__);
   test::mock::osi_wakelock::wakelock_set_os_callouts(callouts);
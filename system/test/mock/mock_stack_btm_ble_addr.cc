@@ -107,5 +107,7 @@ void btm_ble_refresh_peer_resolvable_private_addr(
   test::mock::stack_btm_ble_addr::btm_ble_refresh_peer_resolvable_private_addr(
       pseudo_bda, rpa, rra_type);
 }
+void btm_ble_rpa_cache_clear(void) { inc_func_call_count(__func__); }
+void btm_ble_rpa_cache_dump(int /* fd */) { inc_func_call_count(__func__); }
 
 // END mockcify generation
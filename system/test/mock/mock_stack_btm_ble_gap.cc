@@ -161,7 +161,7 @@ void btm_ble_process_adv_pkt_cont_for_inquiry(
     const RawAddress& /* bda */, uint8_t /* primary_phy */,
     uint8_t /* secondary_phy */, uint8_t /* advertising_sid */,
     int8_t /* tx_power */, int8_t /* rssi */, uint16_t /* periodic_adv_int */,
-    std::vector<uint8_t> /* advertising_data */) {
+    const std::vector<uint8_t>& /* advertising_data */) {
   inc_func_call_count(__func__);
 }
 void btm_ble_read_remote_features_complete(uint8_t* /* p */,
@@ -222,6 +222,11 @@ tINQ_DB_ENT* btm_inq_db_find(const RawAddress& p_bda) {
   inc_func_call_count(__func__);
   return test::mock::stack_btm_inq::btm_inq_db_find(p_bda);
 }
+tBTM_INQ_DB_STATS btm_inq_db_get_stats(void) {
+  inc_func_call_count(__func__);
+  return {};
+}
+void btm_inq_db_dump(int /* fd */) { inc_func_call_count(__func__); }
 void btm_inq_db_free(void) {
   inc_func_call_count(__func__);
   test::mock::stack_btm_inq::btm_inq_db_free();
@@ -51,9 +51,11 @@ struct GATTS_AddService GATTS_AddService;
 struct GATTS_DeleteService GATTS_DeleteService;
 struct GATTS_HandleValueIndication GATTS_HandleValueIndication;
 struct GATTS_HandleValueNotification GATTS_HandleValueNotification;
+struct GATTS_HandleValueNotificationMulti GATTS_HandleValueNotificationMulti;
 struct GATTS_NVRegister GATTS_NVRegister;
 struct GATTS_SendRsp GATTS_SendRsp;
 struct GATTS_StopService GATTS_StopService;
+struct GATTS_SetStaticAttributeValue GATTS_SetStaticAttributeValue;
 struct GATT_CancelConnect GATT_CancelConnect;
 struct GATT_Connect GATT_Connect;
 struct GATT_Deregister GATT_Deregister;
@@ -92,6 +94,7 @@ tGATT_STATUS GATTS_HandleValueIndication::return_value = GATT_SUCCESS;
 tGATT_STATUS GATTS_HandleValueNotification::return_value = GATT_SUCCESS;
 bool GATTS_NVRegister::return_value = false;
 tGATT_STATUS GATTS_SendRsp::return_value = GATT_SUCCESS;
+tGATT_STATUS GATTS_SetStaticAttributeValue::return_value = GATT_SUCCESS;
 bool GATT_CancelConnect::return_value = false;
 bool GATT_Connect::return_value = false;
 tGATT_STATUS GATT_Disconnect::return_value = GATT_SUCCESS;
@@ -180,6 +183,13 @@ tGATT_STATUS GATTS_HandleValueNotification(uint16_t conn_id,
   return test::mock::stack_gatt_api::GATTS_HandleValueNotification(
       conn_id, attr_handle, val_len, p_val);
 }
+std::vector<tGATT_STATUS> GATTS_HandleValueNotificationMulti(
+    const std::vector<uint16_t>& conn_ids, uint16_t attr_handle,
+    uint16_t val_len, uint8_t* p_val) {
+  inc_func_call_count(__func__);
+  return test::mock::stack_gatt_api::GATTS_HandleValueNotificationMulti(
+      conn_ids, attr_handle, val_len, p_val);
+}
 bool GATTS_NVRegister(tGATT_APPL_INFO* p_cb_info) {
   inc_func_call_count(__func__);
   return test::mock::stack_gatt_api::GATTS_NVRegister(p_cb_info);
@@ -194,6 +204,13 @@ void GATTS_StopService(uint16_t service_handle) {
   inc_func_call_count(__func__);
   test::mock::stack_gatt_api::GATTS_StopService(service_handle);
 }
+tGATT_STATUS GATTS_SetStaticAttributeValue(uint16_t attr_handle,
+                                           const uint8_t* p_value,
+                                           uint16_t len) {
+  inc_func_call_count(__func__);
+  return test::mock::stack_gatt_api::GATTS_SetStaticAttributeValue(
+      attr_handle, p_value, len);
+}
 bool GATT_CancelConnect(tGATT_IF gatt_if, const RawAddress& bd_addr,
                         bool is_direct) {
   inc_func_call_count(__func__);
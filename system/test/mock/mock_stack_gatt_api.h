@@ -256,6 +256,27 @@ struct GATTS_HandleValueNotification {
 };
 extern struct GATTS_HandleValueNotification GATTS_HandleValueNotification;
 
+// Name: GATTS_HandleValueNotificationMulti
+// Params: const std::vector<uint16_t>& conn_ids, uint16_t attr_handle,
+// uint16_t val_len, uint8_t* p_val Return: std::vector<tGATT_STATUS>
+struct GATTS_HandleValueNotificationMulti {
+  std::function<std::vector<tGATT_STATUS>(const std::vector<uint16_t>& conn_ids,
+                                          uint16_t attr_handle,
+                                          uint16_t val_len, uint8_t* p_val)>
+      body{[](const std::vector<uint16_t>& conn_ids,
+              uint16_t /* attr_handle */, uint16_t /* val_len */,
+              uint8_t* /* p_val */) {
+        return std::vector<tGATT_STATUS>(conn_ids.size(), GATT_SUCCESS);
+      }};
+  std::vector<tGATT_STATUS> operator()(const std::vector<uint16_t>& conn_ids,
+                                       uint16_t attr_handle, uint16_t val_len,
+                                       uint8_t* p_val) {
+    return body(conn_ids, attr_handle, val_len, p_val);
+  };
+};
+extern struct GATTS_HandleValueNotificationMulti
+    GATTS_HandleValueNotificationMulti;
+
 // Name: GATTS_NVRegister
 // Params: tGATT_APPL_INFO* p_cb_info
 // Return: bool
@@ -294,6 +315,22 @@ struct GATTS_StopService {
 };
 extern struct GATTS_StopService GATTS_StopService;
 
+// Name: GATTS_SetStaticAttributeValue
+// Params: uint16_t attr_handle, const uint8_t* p_value, uint16_t len
+// Return: tGATT_STATUS
+struct GATTS_SetStaticAttributeValue {
+  static tGATT_STATUS return_value;
+  std::function<tGATT_STATUS(uint16_t attr_handle, const uint8_t* p_value,
+                             uint16_t len)>
+      body{[](uint16_t /* attr_handle */, const uint8_t* /* p_value */,
+              uint16_t /* len */) { return return_value; }};
+  tGATT_STATUS operator()(uint16_t attr_handle, const uint8_t* p_value,
+                          uint16_t len) {
+    return body(attr_handle, p_value, len);
+  };
+};
+extern struct GATTS_SetStaticAttributeValue GATTS_SetStaticAttributeValue;
+
 // Name: GATT_CancelConnect
 // Params: tGATT_IF gatt_if, const RawAddress& bd_addr, bool is_direct
 // Return: bool
@@ -66,6 +66,9 @@ void connection_manager::on_connection_complete(
     const RawAddress& /* address */) {
   inc_func_call_count(__func__);
 }
+void connection_manager::on_disconnected(const RawAddress& /* address */) {
+  inc_func_call_count(__func__);
+}
 
 void connection_manager::on_connection_timed_out_from_shim(
     const RawAddress& /* address */) {
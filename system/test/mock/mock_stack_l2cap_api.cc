@@ -69,6 +69,7 @@ struct L2CA_LECocDataWrite L2CA_LECocDataWrite;
 struct L2CA_SetChnlFlushability L2CA_SetChnlFlushability;
 struct L2CA_FlushChannel L2CA_FlushChannel;
 struct L2CA_IsLinkEstablished L2CA_IsLinkEstablished;
+struct L2CA_GetLinkTrafficBytes L2CA_GetLinkTrafficBytes;
 struct L2CA_SetMediaStreamChannel L2CA_SetMediaStreamChannel;
 struct L2CA_isMediaChannel L2CA_isMediaChannel;
 struct L2CA_LeCreditDefault L2CA_LeCreditDefault;
@@ -257,6 +258,12 @@ bool L2CA_IsLinkEstablished(const RawAddress& bd_addr,
   return test::mock::stack_l2cap_api::L2CA_IsLinkEstablished(bd_addr,
                                                              transport);
 }
+uint64_t L2CA_GetLinkTrafficBytes(const RawAddress& bd_addr,
+                                  tBT_TRANSPORT transport) {
+  inc_func_call_count(__func__);
+  return test::mock::stack_l2cap_api::L2CA_GetLinkTrafficBytes(bd_addr,
+                                                                transport);
+}
 void L2CA_SetMediaStreamChannel(uint16_t local_media_cid, bool status) {
   inc_func_call_count(__func__);
   return test::mock::stack_l2cap_api::L2CA_SetMediaStreamChannel(
@@ -479,6 +479,19 @@ struct L2CA_IsLinkEstablished {
   };
 };
 extern struct L2CA_IsLinkEstablished L2CA_IsLinkEstablished;
+// Name: L2CA_GetLinkTrafficBytes
+// Params: const RawAddress& bd_addr, tBT_TRANSPORT transport
+// Returns: uint64_t
+struct L2CA_GetLinkTrafficBytes {
+  std::function<uint64_t(const RawAddress& bd_addr, tBT_TRANSPORT transport)>
+      body{[](const RawAddress& /* bd_addr */, tBT_TRANSPORT /* transport */) {
+        return 0;
+      }};
+  uint64_t operator()(const RawAddress& bd_addr, tBT_TRANSPORT transport) {
+    return body(bd_addr, transport);
+  };
+};
+extern struct L2CA_GetLinkTrafficBytes L2CA_GetLinkTrafficBytes;
 // Name: L2CA_SetMediaStreamChannel
 // Params: uint16_t handle, uint16_t channel_id, bool is_local_cid
 // Returns: void
@@ -64,6 +64,7 @@ struct L2CA_AdjustConnectionIntervals L2CA_AdjustConnectionIntervals;
 struct l2cble_use_preferred_conn_params l2cble_use_preferred_conn_params;
 struct L2CA_SubrateRequest L2CA_SubrateRequest;
 struct l2cble_process_subrate_change_evt l2cble_process_subrate_change_evt;
+struct l2cble_traffic_conn_params_record l2cble_traffic_conn_params_record;
 
 }  // namespace stack_l2cap_ble
 }  // namespace mock
@@ -207,5 +208,9 @@ void l2cble_process_subrate_change_evt(uint16_t handle, uint8_t status,
   test::mock::stack_l2cap_ble::l2cble_process_subrate_change_evt(
       handle, status, subrate_factor, peripheral_latency, cont_num, timeout);
 }
+void l2cble_traffic_conn_params_record(tL2C_LCB* p_lcb, uint16_t bytes) {
+  inc_func_call_count(__func__);
+  test::mock::stack_l2cap_ble::l2cble_traffic_conn_params_record(p_lcb, bytes);
+}
 
 // END mockcify generation
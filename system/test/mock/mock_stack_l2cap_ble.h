@@ -346,6 +346,17 @@ struct l2cble_process_subrate_change_evt {
 extern struct l2cble_process_subrate_change_evt
     l2cble_process_subrate_change_evt;
 
+// Name: l2cble_traffic_conn_params_record
+// Params: tL2C_LCB* p_lcb, uint16_t bytes
+// Returns: void
+struct l2cble_traffic_conn_params_record {
+  std::function<void(tL2C_LCB* p_lcb, uint16_t bytes)> body{
+      [](tL2C_LCB* /* p_lcb */, uint16_t /* bytes */) {}};
+  void operator()(tL2C_LCB* p_lcb, uint16_t bytes) { body(p_lcb, bytes); };
+};
+extern struct l2cble_traffic_conn_params_record
+    l2cble_traffic_conn_params_record;
+
 }  // namespace stack_l2cap_ble
 }  // namespace mock
 }  // namespace test
@@ -38,6 +38,7 @@
 #include "osi/include/ringbuffer.h"
 #include "osi/include/socket.h"
 #include "osi/include/thread.h"
+#include "osi/include/thread_scheduler.h"
 #include "osi/include/wakelock.h"
 #include "osi/src/compat.cc"  // For strlcpy
 #include "test/common/fake_osi.h"
@@ -258,6 +259,11 @@ thread_t* thread_new_sized(const char* name, size_t work_queue_capacity) {
 void thread_free(thread_t* thread) { inc_func_call_count(__func__); }
 void thread_join(thread_t* thread) { inc_func_call_count(__func__); }
 void thread_stop(thread_t* thread) { inc_func_call_count(__func__); }
+bool thread_scheduler_apply_policy(const char* thread_name) {
+  inc_func_call_count(__func__);
+  return true;
+}
+void thread_scheduler_debug_dump(int fd) { inc_func_call_count(__func__); }
 
 char* osi_strdup(const char* str) {
   inc_func_call_count(__func__);
@@ -382,6 +388,10 @@ void alarm_set(alarm_t* alarm, uint64_t interval_ms, alarm_callback_t cb,
   inc_func_call_count(__func__);
 }
 
+void alarm_set_class(alarm_t* alarm, alarm_class_t alarm_class) {
+  inc_func_call_count(__func__);
+}
+
 void alarm_set_on_mloop(alarm_t* alarm, uint64_t interval_ms,
                         alarm_callback_t cb, void* data) {
   inc_func_call_count(__func__);
@@ -586,6 +596,14 @@ bool wakelock_release(void) {
   inc_func_call_count(__func__);
   return false;
 }
+bool wakelock_acquire_for(const char* source) {
+  inc_func_call_count(__func__);
+  return false;
+}
+bool wakelock_release_for(const char* source) {
+  inc_func_call_count(__func__);
+  return false;
+}
 void wakelock_cleanup(void) { inc_func_call_count(__func__); }
 void wakelock_debug_dump(int fd) { inc_func_call_count(__func__); }
 void wakelock_set_os_callouts(bt_os_callouts_t* callouts) {
@@ -620,6 +620,26 @@ uint32_t UIPC_Read(tUIPC_STATE& uipc, tUIPC_CH_ID ch_id, uint8_t* p_buf,
   }
 
   while (n_read < (int)len) {
+    ssize_t n;
+
+    /* The audio server usually has the data ready when asked for the next
+       frame, try a read first to save the poll syscall per read */
+    OSI_NO_INTR(n = recv(fd, p_buf + n_read, len - n_read, MSG_DONTWAIT));
+    if (n > 0) {
+      n_read += n;
+      continue;
+    }
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+      LOG_WARN("UIPC_Read : read failed (%s)", strerror(errno));
+      return 0;
+    }
+    if (n == 0) {
+      LOG_WARN("UIPC_Read : channel detached remotely");
+      std::lock_guard<std::recursive_mutex> lock(uipc.mutex);
+      uipc_close_locked(uipc, ch_id);
+      return 0;
+    }
+
     pfd.fd = fd;
     pfd.events = POLLIN | POLLHUP;
 
@@ -645,7 +665,6 @@ uint32_t UIPC_Read(tUIPC_STATE& uipc, tUIPC_CH_ID ch_id, uint8_t* p_buf,
       return 0;
     }
 
-    ssize_t n;
     OSI_NO_INTR(n = recv(fd, p_buf + n_read, len - n_read, 0));
 
     if (n == 0) {
@@ -48,6 +48,8 @@ DEFINE_bool(enable_log_color, false, "enable log colors");
 DEFINE_bool(enable_hci_sniffer, false, "enable hci sniffer");
 DEFINE_bool(enable_baseband_sniffer, false, "enable baseband sniffer");
 DEFINE_bool(enable_pcap_filter, false, "enable PCAP filter");
+DEFINE_bool(enable_hci_timing, false,
+            "record host HCI timing and write it to a JSON report");
 DEFINE_bool(disable_address_reuse, false,
             "prevent rootcanal from reusing device addresses");
 DEFINE_uint32(test_port, 6401, "test tcp port");
@@ -140,7 +142,7 @@ int main(int argc, char** argv) {
       static_cast<int>(FLAGS_link_port), static_cast<int>(FLAGS_link_ble_port),
       configuration_str, FLAGS_enable_hci_sniffer,
       FLAGS_enable_baseband_sniffer, FLAGS_enable_pcap_filter,
-      FLAGS_disable_address_reuse);
+      FLAGS_disable_address_reuse, FLAGS_enable_hci_timing);
 
   std::promise<void> barrier;
   std::future<void> barrier_future = barrier.get_future();
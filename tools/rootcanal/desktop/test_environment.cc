@@ -38,6 +38,7 @@
 #include "model/devices/link_layer_socket_device.h"
 #include "model/hci/hci_sniffer.h"
 #include "model/hci/hci_socket_transport.h"
+#include "model/hci/hci_timing_recorder.h"
 #include "model/setup/async_manager.h"
 #include "model/setup/test_channel_transport.h"
 #include "net/async_data_channel.h"
@@ -52,6 +53,7 @@ using rootcanal::BaseBandSniffer;
 using rootcanal::HciDevice;
 using rootcanal::HciSniffer;
 using rootcanal::HciSocketTransport;
+using rootcanal::HciTimingRecorder;
 using rootcanal::LinkLayerSocketDevice;
 using rootcanal::TaskCallback;
 
@@ -63,10 +65,12 @@ TestEnvironment::TestEnvironment(
     int test_port, int hci_port, int link_port, int link_ble_port,
     const std::string& config_str,
     bool enable_hci_sniffer, bool enable_baseband_sniffer,
-    bool enable_pcap_filter, bool disable_address_reuse)
+    bool enable_pcap_filter, bool disable_address_reuse,
+    bool enable_hci_timing)
     : enable_hci_sniffer_(enable_hci_sniffer),
       enable_baseband_sniffer_(enable_baseband_sniffer),
-      enable_pcap_filter_(enable_pcap_filter) {
+      enable_pcap_filter_(enable_pcap_filter),
+      enable_hci_timing_(enable_hci_timing) {
   test_socket_server_ = open_server(&async_manager_, test_port);
   link_socket_server_ = open_server(&async_manager_, link_port);
   link_ble_socket_server_ = open_server(&async_manager_, link_ble_port);
@@ -117,6 +121,10 @@ void TestEnvironment::SetUpHciServer(
       if (enable_hci_sniffer_) {
         transport = HciSniffer::Create(transport);
       }
+      auto sniffer_transport = transport;
+      if (enable_hci_timing_) {
+        transport = HciTimingRecorder::Create(transport);
+      }
       auto device = HciDevice::Create(transport, properties);
       test_model_.AddHciConnection(device);
 
@@ -127,7 +135,7 @@ void TestEnvironment::SetUpHciServer(
               device->GetAddress().ToString() + "_" + std::to_string(i) + ".pcap";
         }
         auto file = std::make_shared<std::ofstream>(filename, std::ios::binary);
-        auto sniffer = std::static_pointer_cast<HciSniffer>(transport);
+        auto sniffer = std::static_pointer_cast<HciSniffer>(sniffer_transport);
 
         // Add PCAP output stream.
         sniffer->SetOutputStream(file);
@@ -139,6 +147,19 @@ void TestEnvironment::SetUpHciServer(
           sniffer->SetPcapFilter(std::make_shared<rootcanal::PcapFilter>());
         }
       }
+
+      if (enable_hci_timing_) {
+        auto filename = device->GetAddress().ToString() + "_hci_timing.json";
+        for (auto i = 0; std::filesystem::exists(filename); i++) {
+          filename = device->GetAddress().ToString() + "_hci_timing_" +
+                     std::to_string(i) + ".json";
+        }
+        auto file = std::make_shared<std::ofstream>(filename);
+        auto recorder = std::static_pointer_cast<HciTimingRecorder>(transport);
+
+        // The report is written when the HCI connection is closed.
+        recorder->SetOutputStream(file);
+      }
     });
 
     server->StartListening();
@@ -56,7 +56,8 @@ class TestEnvironment {
       int test_port, int hci_port, int link_port, int link_ble_port,
       std::string const& config_str,
       bool enable_hci_sniffer = false, bool enable_baseband_sniffer = false,
-      bool enable_pcap_filter = false, bool disable_address_reuse = false);
+      bool enable_pcap_filter = false, bool disable_address_reuse = false,
+      bool enable_hci_timing = false);
 
   void initialize(std::promise<void> barrier);
   void close();
@@ -72,6 +73,7 @@ class TestEnvironment {
   bool enable_hci_sniffer_;
   bool enable_baseband_sniffer_;
   bool enable_pcap_filter_;
+  bool enable_hci_timing_;
   bool test_channel_open_{false};
   std::promise<void> barrier_;
   rootcanal::AsyncUserId socket_user_id_{};
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace rootcanal {
+
+// The clock read by the simulated devices. It follows the steady clock,
+// unless the simulation runs in virtual time: the clock then only moves when
+// advanced by the test model, so that long scenarios can run as fast as the
+// devices can be ticked.
+class SimulationClock {
+ public:
+  using duration = std::chrono::steady_clock::duration;
+  using time_point = std::chrono::steady_clock::time_point;
+
+  static time_point now() {
+    if (!virtual_time_enabled_.load(std::memory_order_acquire)) {
+      return std::chrono::steady_clock::now();
+    }
+    return time_point(duration(virtual_now_.load(std::memory_order_acquire)));
+  }
+
+  // Switch to virtual time, starting from the current steady clock time so
+  // that the deadlines already computed remain valid.
+  static void EnableVirtualTime() {
+    virtual_now_.store(
+        std::chrono::steady_clock::now().time_since_epoch().count(),
+        std::memory_order_release);
+    virtual_time_enabled_.store(true, std::memory_order_release);
+  }
+
+  static void DisableVirtualTime() {
+    virtual_time_enabled_.store(false, std::memory_order_release);
+  }
+
+  static bool IsVirtualTimeEnabled() {
+    return virtual_time_enabled_.load(std::memory_order_acquire);
+  }
+
+  // Move the virtual time forward, no-op in real time.
+  static void Advance(duration delta) {
+    virtual_now_.fetch_add(delta.count(), std::memory_order_acq_rel);
+  }
+
+ private:
+  static inline std::atomic<bool> virtual_time_enabled_{false};
+  static inline std::atomic<duration::rep> virtual_now_{0};
+};
+
+}  // namespace rootcanal
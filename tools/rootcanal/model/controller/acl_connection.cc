@@ -21,6 +21,7 @@
 
 #include "packets/hci_packets.h"
 #include "phy.h"
+#include "simulation_clock.h"
 
 namespace rootcanal {
 AclConnection::AclConnection(AddressWithType address,
@@ -32,7 +33,7 @@ AclConnection::AclConnection(AddressWithType address,
       resolved_address_(resolved_address),
       type_(phy_type),
       role_(role),
-      last_packet_timestamp_(std::chrono::steady_clock::now()),
+      last_packet_timestamp_(SimulationClock::now()),
       timeout_(std::chrono::seconds(3)) {}
 
 void AclConnection::Encrypt() { encrypted_ = true; }
@@ -52,13 +53,13 @@ int8_t AclConnection::GetRssi() const { return rssi_; }
 void AclConnection::SetRssi(int8_t rssi) { rssi_ = rssi; }
 
 void AclConnection::ResetLinkTimer() {
-  last_packet_timestamp_ = std::chrono::steady_clock::now();
+  last_packet_timestamp_ = SimulationClock::now();
 }
 
 std::chrono::steady_clock::duration AclConnection::TimeUntilNearExpiring()
     const {
   return (last_packet_timestamp_ + timeout_ / 2) -
-         std::chrono::steady_clock::now();
+         SimulationClock::now();
 }
 
 bool AclConnection::IsNearExpiring() const {
@@ -66,7 +67,7 @@ bool AclConnection::IsNearExpiring() const {
 }
 
 std::chrono::steady_clock::duration AclConnection::TimeUntilExpired() const {
-  return (last_packet_timestamp_ + timeout_) - std::chrono::steady_clock::now();
+  return (last_packet_timestamp_ + timeout_) - SimulationClock::now();
 }
 
 bool AclConnection::HasExpired() const {
@@ -68,8 +68,9 @@ __attribute__((visibility("default"))) void* ffi_controller_new(
         send_hci(hci::Idc::ISO, data->data(), data->size());
       });
   controller->RegisterLinkLayerChannel(
-      [=](std::vector<uint8_t> const& data, Phy::Type phy, int8_t tx_power) {
-        send_ll(data.data(), data.size(), static_cast<int>(phy), tx_power);
+      [=](std::shared_ptr<std::vector<uint8_t>> data, Phy::Type phy,
+          int8_t tx_power) {
+        send_ll(data->data(), data->size(), static_cast<int>(phy), tx_power);
       });
 
   return controller;
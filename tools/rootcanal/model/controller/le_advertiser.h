@@ -25,6 +25,7 @@
 #include "hci/address.h"
 #include "hci/address_with_type.h"
 #include "packets/hci_packets.h"
+#include "simulation_clock.h"
 
 namespace rootcanal {
 
@@ -113,13 +114,13 @@ class ExtendedAdvertiser : public Advertiser {
   void Enable() {
     advertising_enable = true;
     periodic_advertising_enable_latch = periodic_advertising_enable;
-    next_event = std::chrono::steady_clock::now();
+    next_event = SimulationClock::now();
   }
 
   void EnablePeriodic() {
     periodic_advertising_enable = true;
     periodic_advertising_enable_latch = advertising_enable;
-    next_periodic_event = std::chrono::steady_clock::now();
+    next_periodic_event = SimulationClock::now();
   }
 
   void DisablePeriodic() {
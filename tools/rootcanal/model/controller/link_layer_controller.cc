@@ -43,6 +43,7 @@
 #include "packets/link_layer_packets.h"
 #include "phy.h"
 #include "rust/include/rootcanal_rs.h"
+#include "simulation_clock.h"
 
 using namespace std::chrono;
 using bluetooth::hci::Address;
@@ -1500,7 +1501,7 @@ ErrorCode LinkLayerController::LeSetExtendedScanEnable(
   scanner_.duration = duration_ms;
   scanner_.period = period_ms;
 
-  auto now = std::chrono::steady_clock::now();
+  auto now = SimulationClock::now();
 
   // At the end of a single scan (Duration non-zero but Period zero), an
   // HCI_LE_Scan_Timeout event shall be generated.
@@ -3168,7 +3169,7 @@ void LinkLayerController::ScanIncomingLeLegacyAdvertisingPdu(
     scanner_.extended_scan_response = false;
     scanner_.pending_scan_request = advertising_address;
     scanner_.pending_scan_request_timeout =
-        std::chrono::steady_clock::now() + kScanRequestTimeout;
+        SimulationClock::now() + kScanRequestTimeout;
 
     INFO(id_,
          "Sending LE Scan request to advertising address {} with scanning "
@@ -3872,7 +3873,7 @@ void LinkLayerController::IncomingLePeriodicAdvertisingPdu(
              .advertising_sid = advertising_sid,
              .sync_handle = sync_handle,
              .sync_timeout = synchronizing_->sync_timeout,
-             .timeout = std::chrono::steady_clock::now() +
+             .timeout = SimulationClock::now() +
                         synchronizing_->sync_timeout,
          }});
 
@@ -3924,7 +3925,7 @@ void LinkLayerController::IncomingLePeriodicAdvertisingPdu(
     }
 
     // Refresh the timeout for the sync disconnection.
-    sync.timeout = std::chrono::steady_clock::now() + sync.sync_timeout;
+    sync.timeout = SimulationClock::now() + sync.sync_timeout;
   }
 }
 
@@ -5003,7 +5004,7 @@ void LinkLayerController::LeScanning() {
     return;
   }
 
-  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point now = SimulationClock::now();
 
   // Extended Scanning Timeout
 
@@ -5055,7 +5056,7 @@ void LinkLayerController::LeScanning() {
 void LinkLayerController::LeSynchronization() {
   std::vector<uint16_t> removed_sync_handles;
   for (auto& [_, sync] : synchronized_) {
-    if (sync.timeout > std::chrono::steady_clock::now()) {
+    if (sync.timeout > SimulationClock::now()) {
       INFO(id_, "Periodic advertising sync with handle 0x{:x} lost",
            sync.sync_handle);
       removed_sync_handles.push_back(sync.sync_handle);
@@ -5416,7 +5417,7 @@ ErrorCode LinkLayerController::CreateConnection(const Address& bd_addr,
     return ErrorCode::CONNECTION_ALREADY_EXISTS;
   }
 
-  auto now = std::chrono::steady_clock::now();
+  auto now = SimulationClock::now();
   page_ = Page{
       .bd_addr = bd_addr,
       .allow_role_switch = allow_role_switch,
@@ -6074,7 +6075,7 @@ void LinkLayerController::Reset() {
   initiator_ = Initiator{};
   synchronizing_ = {};
   synchronized_ = {};
-  last_inquiry_ = steady_clock::now();
+  last_inquiry_ = SimulationClock::now();
   inquiry_mode_ = InquiryType::STANDARD;
   inquiry_lap_ = 0;
   inquiry_max_responses_ = 0;
@@ -6099,7 +6100,7 @@ void LinkLayerController::Reset() {
 
 /// Drive the logic for the Page controller substate.
 void LinkLayerController::Paging() {
-  auto now = std::chrono::steady_clock::now();
+  auto now = SimulationClock::now();
 
   if (page_.has_value() && now >= page_->page_timeout) {
     INFO("page timeout triggered for connection with {}",
@@ -6158,7 +6159,7 @@ void LinkLayerController::SetInquiryMaxResponses(uint8_t max) {
 }
 
 void LinkLayerController::Inquiry() {
-  steady_clock::time_point now = steady_clock::now();
+  steady_clock::time_point now = SimulationClock::now();
   if (duration_cast<milliseconds>(now - last_inquiry_) < milliseconds(2000)) {
     return;
   }
@@ -6404,7 +6405,7 @@ TaskId LinkLayerController::NextTaskId() {
 TaskId LinkLayerController::ScheduleTask(std::chrono::milliseconds delay,
                                          TaskCallback task_callback) {
   TaskId task_id = NextTaskId();
-  task_queue_.emplace(std::chrono::steady_clock::now() + delay,
+  task_queue_.emplace(SimulationClock::now() + delay,
                       std::move(task_callback), task_id);
   return task_id;
 }
@@ -6413,7 +6414,7 @@ TaskId LinkLayerController::SchedulePeriodicTask(
     std::chrono::milliseconds delay, std::chrono::milliseconds period,
     TaskCallback task_callback) {
   TaskId task_id = NextTaskId();
-  task_queue_.emplace(std::chrono::steady_clock::now() + delay, period,
+  task_queue_.emplace(SimulationClock::now() + delay, period,
                       std::move(task_callback), task_id);
   return task_id;
 }
@@ -6429,7 +6430,7 @@ void LinkLayerController::CancelScheduledTask(TaskId task_id) {
 }
 
 void LinkLayerController::RunPendingTasks() {
-  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point now = SimulationClock::now();
   while (!task_queue_.empty()) {
     auto it = task_queue_.begin();
     if (it->time > now) {
@@ -26,6 +26,7 @@
 #include "model/setup/device_boutique.h"
 #include "packets/link_layer_packets.h"
 #include "phy.h"
+#include "simulation_clock.h"
 
 namespace rootcanal {
 using namespace model::packets;
@@ -56,7 +57,7 @@ Beacon::Beacon(const std::vector<std::string>& args) : Beacon() {
 }
 
 void Beacon::Tick() {
-  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point now = SimulationClock::now();
   if ((now - advertising_last_) >= advertising_interval_) {
     advertising_last_ = now;
     SendLinkLayerPacket(
@@ -50,13 +50,16 @@ void Device::Close() {
 void Device::SendLinkLayerPacket(
     std::shared_ptr<model::packets::LinkLayerPacketBuilder> packet,
     Phy::Type type, int8_t tx_power) {
-  SendLinkLayerPacket(packet->SerializeToBytes(), type, tx_power);
+  if (send_ll_ != nullptr) {
+    send_ll_(std::make_shared<std::vector<uint8_t>>(packet->SerializeToBytes()),
+             type, tx_power);
+  }
 }
 
 void Device::SendLinkLayerPacket(std::vector<uint8_t> const& packet,
                                  Phy::Type type, int8_t tx_power) {
   if (send_ll_ != nullptr) {
-    send_ll_(packet, type, tx_power);
+    send_ll_(std::make_shared<std::vector<uint8_t>>(packet), type, tx_power);
   }
 }
 
@@ -65,7 +68,8 @@ void Device::RegisterCloseCallback(std::function<void()> close_callback) {
 }
 
 void Device::RegisterLinkLayerChannel(
-    std::function<void(std::vector<uint8_t> const&, Phy::Type, int8_t)>
+    std::function<void(std::shared_ptr<std::vector<uint8_t>>, Phy::Type,
+                       int8_t)>
         send_ll) {
   send_ll_ = send_ll;
 }
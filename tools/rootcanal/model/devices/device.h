@@ -67,7 +67,8 @@ class Device {
                            int8_t tx_power = 0);
 
   void RegisterLinkLayerChannel(
-      std::function<void(std::vector<uint8_t> const&, Phy::Type, int8_t)>
+      std::function<void(std::shared_ptr<std::vector<uint8_t>>, Phy::Type,
+                         int8_t)>
           send_ll);
 
   void RegisterCloseCallback(std::function<void()> close_callback);
@@ -81,7 +82,9 @@ class Device {
   std::function<void()> close_callback_;
 
   // Callback function to send link layer packets.
-  std::function<void(std::vector<uint8_t> const&, Phy::Type, uint8_t)> send_ll_;
+  // Serialized packets are shared by all the receivers of a transmission.
+  std::function<void(std::shared_ptr<std::vector<uint8_t>>, Phy::Type, int8_t)>
+      send_ll_;
 };
 
 }  // namespace rootcanal
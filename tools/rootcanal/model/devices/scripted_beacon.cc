@@ -16,6 +16,8 @@
 
 #include "model/devices/scripted_beacon.h"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <unistd.h>
 
 #include <cstdint>
@@ -24,12 +26,16 @@
 #include "log.h"
 #include "model/devices/scripted_beacon_ble_payload.pb.h"
 #include "model/setup/device_boutique.h"
+#include "simulation_clock.h"
 
 #ifdef _WIN32
 #define F_OK 00
 #define R_OK 04
 #endif
 
+using android::bluetooth::rootcanal::model::devices::ScriptedBeaconBleAdProto::
+    BleAdvertisement;
+using google::protobuf::internal::WireFormatLite;
 using std::vector;
 using std::chrono::steady_clock;
 using std::chrono::system_clock;
@@ -83,6 +89,14 @@ ScriptedBeacon::ScriptedBeacon(const vector<std::string>& args) : Beacon(args) {
   if (args.size() >= 4) {
     config_file_ = args[2];
     events_file_ = args[3];
+    if (args.size() >= 5) {
+      double playback_speed = std::stod(args[4]);
+      if (playback_speed > 0) {
+        playback_speed_ = playback_speed;
+      } else {
+        WARNING("Ignoring invalid playback speed {}", args[4]);
+      }
+    }
     set_state(PlaybackEvent::INITIALIZED);
   } else {
     ERROR(
@@ -92,7 +106,7 @@ ScriptedBeacon::ScriptedBeacon(const vector<std::string>& args) : Beacon(args) {
 }
 
 bool has_time_elapsed(steady_clock::time_point time_point) {
-  return steady_clock::now() > time_point;
+  return SimulationClock::now() > time_point;
 }
 
 static void populate_event(PlaybackEvent* event,
@@ -127,16 +141,16 @@ void ScriptedBeacon::Tick() {
       Beacon::Tick();
       break;
     case PlaybackEvent::SCANNED_ONCE:
-      next_check_time_ =
-          steady_clock::now() + steady_clock::duration(std::chrono::seconds(1));
+      next_check_time_ = SimulationClock::now() +
+                         steady_clock::duration(std::chrono::seconds(1));
       set_state(PlaybackEvent::WAITING_FOR_FILE);
       break;
     case PlaybackEvent::WAITING_FOR_FILE:
       if (!has_time_elapsed(next_check_time_)) {
         return;
       }
-      next_check_time_ =
-          steady_clock::now() + steady_clock::duration(std::chrono::seconds(1));
+      next_check_time_ = SimulationClock::now() +
+                         steady_clock::duration(std::chrono::seconds(1));
       if (access(config_file_.c_str(), F_OK) == -1) {
         return;
       }
@@ -152,17 +166,20 @@ void ScriptedBeacon::Tick() {
       if (!has_time_elapsed(next_check_time_)) {
         return;
       }
-      std::fstream input(config_file_, std::ios::in | std::ios::binary);
-      if (!ble_ad_list_.ParseFromIstream(&input)) {
+      playback_istream_.open(config_file_, std::ios::in | std::ios::binary);
+      playback_input_ =
+          std::make_unique<google::protobuf::io::IstreamInputStream>(
+              &playback_istream_);
+      next_ad_.ad_time = SimulationClock::now();
+      if (!get_next_advertisement()) {
         ERROR("Cannot parse playback file {}", config_file_);
         set_state(PlaybackEvent::FILE_PARSING_FAILED);
+        playback_input_.reset();
+        playback_istream_.close();
         return;
       }
       set_state(PlaybackEvent::PLAYBACK_STARTED);
       INFO("Starting Ble advertisement playback from file: {}", config_file_);
-      next_ad_.ad_time = steady_clock::now();
-      get_next_advertisement();
-      input.close();
       break;
     }
     case PlaybackEvent::PLAYBACK_STARTED: {
@@ -172,13 +189,13 @@ void ScriptedBeacon::Tick() {
             AddressType::RANDOM, AddressType::PUBLIC,
             LegacyAdvertisingType::ADV_NONCONN_IND, next_ad_.ad);
         SendLinkLayerPacket(std::move(ad), Phy::Type::LOW_ENERGY);
-        if (packet_num_ < ble_ad_list_.advertisements().size()) {
-          get_next_advertisement();
-        } else {
+        if (!get_next_advertisement()) {
           set_state(PlaybackEvent::PLAYBACK_ENDED);
           if (events_ostream_.is_open()) {
             events_ostream_.close();
           }
+          playback_input_.reset();
+          playback_istream_.close();
           INFO(
               "Completed Ble advertisement playback from file: {} with {} "
               "packets",
@@ -211,12 +228,44 @@ void ScriptedBeacon::ReceiveLinkLayerPacket(
   }
 }
 
-void ScriptedBeacon::get_next_advertisement() {
-  std::string payload = ble_ad_list_.advertisements(packet_num_).payload();
-  std::string mac_address =
-      ble_ad_list_.advertisements(packet_num_).mac_address();
-  uint32_t delay_before_send_ms =
-      ble_ad_list_.advertisements(packet_num_).delay_before_send_ms();
+bool ScriptedBeacon::get_next_advertisement() {
+  // BleAdvertisementList is a single repeated field; walk its entries
+  // directly instead of parsing the whole list. The coded stream hands any
+  // bytes it buffered but did not consume back to playback_input_ when it
+  // goes out of scope.
+  const uint32_t kAdvertisementsTag = WireFormatLite::MakeTag(
+      1, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+  google::protobuf::io::CodedInputStream input(playback_input_.get());
+  BleAdvertisement advertisement;
+  while (true) {
+    uint32_t tag = input.ReadTag();
+    if (tag == 0) {
+      return false;
+    }
+    if (tag != kAdvertisementsTag) {
+      if (!WireFormatLite::SkipField(&input, tag)) {
+        return false;
+      }
+      continue;
+    }
+    uint32_t length;
+    if (!input.ReadVarint32(&length)) {
+      return false;
+    }
+    auto limit = input.PushLimit(length);
+    bool parsed = advertisement.ParseFromCodedStream(&input) &&
+                  input.BytesUntilLimit() == 0;
+    input.PopLimit(limit);
+    if (!parsed) {
+      ERROR("Cannot parse advertisement {} from playback file {}",
+            packet_num_, config_file_);
+      return false;
+    }
+    break;
+  }
+
+  const std::string& payload = advertisement.payload();
+  const std::string& mac_address = advertisement.mac_address();
   next_ad_.ad.assign(payload.begin(), payload.end());
   if (Address::IsValidAddress(mac_address)) {
     // formatted string with colons like "12:34:56:78:9a:bc"
@@ -228,8 +277,10 @@ void ScriptedBeacon::get_next_advertisement() {
   } else {
     Address::FromString("BA:D0:AD:BA:D0:AD", next_ad_.address);
   }
-  next_ad_.ad_time +=
-      steady_clock::duration(std::chrono::milliseconds(delay_before_send_ms));
+  next_ad_.ad_time += std::chrono::duration_cast<steady_clock::duration>(
+      std::chrono::duration<double, std::milli>(
+          advertisement.delay_before_send_ms() / playback_speed_));
   packet_num_++;
+  return true;
 }
 }  // namespace rootcanal
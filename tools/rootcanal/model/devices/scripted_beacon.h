@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+
 #include <cstdint>
 #include <fstream>
+#include <memory>
 #include <vector>
 
 #include "model/devices/beacon.h"
@@ -61,7 +64,10 @@ class ScriptedBeacon : public Beacon {
     std::chrono::steady_clock::time_point ad_time;
   };
 
-  void get_next_advertisement();
+  // Reads the next advertisement from the playback file and schedules it.
+  // Returns false when the end of the file is reached or the next
+  // advertisement cannot be parsed.
+  bool get_next_advertisement();
 
   void set_state(PlaybackEvent::PlaybackEventType state);
 
@@ -69,7 +75,11 @@ class ScriptedBeacon : public Beacon {
   int packet_num_{0};
   PlaybackEvent::PlaybackEventType current_state_{PlaybackEvent::UNKNOWN};
   std::chrono::steady_clock::time_point next_check_time_{};
-  android::bluetooth::rootcanal::model::devices::ScriptedBeaconBleAdProto::
-      BleAdvertisementList ble_ad_list_;
+  // Delays between advertisements are divided by this factor.
+  double playback_speed_{1.0};
+  // The playback file is read one advertisement at a time so that long
+  // captures are never held in memory as a whole.
+  std::ifstream playback_istream_;
+  std::unique_ptr<google::protobuf::io::IstreamInputStream> playback_input_;
 };
 }  // namespace rootcanal
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hci_timing_recorder.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace rootcanal {
+
+// HCI event codes and LE subevent codes of the events that are recorded.
+static constexpr uint8_t kCommandCompleteEvent = 0x0e;
+static constexpr uint8_t kCommandStatusEvent = 0x0f;
+static constexpr uint8_t kNumberOfCompletedPacketsEvent = 0x13;
+static constexpr uint8_t kLeMetaEvent = 0x3e;
+static constexpr uint8_t kLeConnectionCompleteSubevent = 0x01;
+static constexpr uint8_t kLeEnhancedConnectionCompleteV1Subevent = 0x0a;
+static constexpr uint8_t kLeEnhancedConnectionCompleteV2Subevent = 0x29;
+
+static constexpr uint16_t kHandleMask = 0x0fff;
+
+static uint16_t GetUint16(const std::vector<uint8_t>& packet, size_t offset) {
+  return packet[offset] | (packet[offset + 1] << 8);
+}
+
+void HciTimingRecorder::Stats::Add(Clock::duration interval) {
+  count++;
+  total += interval;
+  min = std::min(min, interval);
+  max = std::max(max, interval);
+}
+
+static std::string FormatStats(HciTimingRecorder::Stats const& stats) {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  if (stats.count == 0) {
+    return "{\"count\": 0}";
+  }
+  return fmt::format(
+      "{{\"count\": {}, \"mean_us\": {}, \"min_us\": {}, \"max_us\": {}}}",
+      stats.count,
+      duration_cast<microseconds>(stats.total).count() / stats.count,
+      duration_cast<microseconds>(stats.min).count(),
+      duration_cast<microseconds>(stats.max).count());
+}
+
+HciTimingRecorder::HciTimingRecorder(
+    std::shared_ptr<HciTransport> transport,
+    std::shared_ptr<std::ostream> output_stream)
+    : transport_(transport), output_(output_stream) {}
+
+void HciTimingRecorder::SetOutputStream(
+    std::shared_ptr<std::ostream> output_stream) {
+  output_ = output_stream;
+}
+
+void HciTimingRecorder::RecordCommandResponse(uint16_t op_code,
+                                              Clock::time_point now) {
+  auto command = pending_commands_.find(op_code);
+  if (command != pending_commands_.end()) {
+    command_round_trip_.Add(now - command->second);
+    pending_commands_.erase(command);
+  }
+  last_command_response_ = now;
+}
+
+void HciTimingRecorder::RecordHostReaction(std::optional<uint16_t> acl_handle,
+                                           Clock::time_point now) {
+  // A command may be the reaction to any new connection, an ACL packet only
+  // to its own connection.
+  for (auto it = pending_connections_.begin();
+       it != pending_connections_.end();) {
+    if (!acl_handle.has_value() || *acl_handle == it->first) {
+      connections_[it->first].le_connection_complete_reaction.Add(now -
+                                                                  it->second);
+      it = pending_connections_.erase(it);
+    } else {
+      it++;
+    }
+  }
+
+  if (acl_handle.has_value()) {
+    auto nocp = pending_nocp_.find(*acl_handle);
+    if (nocp != pending_nocp_.end()) {
+      connections_[*acl_handle].nocp_to_acl.Add(now - nocp->second);
+      pending_nocp_.erase(nocp);
+    }
+  }
+}
+
+void HciTimingRecorder::RecordHostPacket(PacketType packet_type,
+                                         const std::vector<uint8_t>& packet) {
+  Clock::time_point now = Clock::now();
+  switch (packet_type) {
+    case PacketType::COMMAND:
+      if (packet.size() < 3) {
+        return;
+      }
+      pending_commands_[GetUint16(packet, 0)] = now;
+      if (last_command_response_.has_value()) {
+        host_command_turnaround_.Add(now - *last_command_response_);
+        last_command_response_.reset();
+      }
+      RecordHostReaction({}, now);
+      break;
+    case PacketType::ACL:
+      if (packet.size() < 4) {
+        return;
+      }
+      RecordHostReaction(GetUint16(packet, 0) & kHandleMask, now);
+      break;
+    default:
+      break;
+  }
+}
+
+void HciTimingRecorder::RecordControllerPacket(
+    PacketType packet_type, const std::vector<uint8_t>& packet) {
+  if (packet_type != PacketType::EVENT || packet.size() < 2) {
+    return;
+  }
+
+  Clock::time_point now = Clock::now();
+  switch (packet[0]) {
+    case kCommandCompleteEvent:
+      if (packet.size() >= 5) {
+        RecordCommandResponse(GetUint16(packet, 3), now);
+      }
+      break;
+    case kCommandStatusEvent:
+      if (packet.size() >= 6) {
+        RecordCommandResponse(GetUint16(packet, 4), now);
+      }
+      break;
+    case kNumberOfCompletedPacketsEvent: {
+      size_t num_handles = packet.size() >= 3 ? packet[2] : 0;
+      for (size_t i = 0; i < num_handles && 3 + 4 * i + 4 <= packet.size();
+           i++) {
+        uint16_t handle = GetUint16(packet, 3 + 4 * i) & kHandleMask;
+        uint16_t completed_packets = GetUint16(packet, 3 + 4 * i + 2);
+        // Only the first event that has not been followed by an ACL packet
+        // is kept, the host may be waiting for more credits.
+        if (completed_packets > 0) {
+          pending_nocp_.try_emplace(handle, now);
+        }
+      }
+      break;
+    }
+    case kLeMetaEvent:
+      if (packet.size() >= 6 &&
+          (packet[2] == kLeConnectionCompleteSubevent ||
+           packet[2] == kLeEnhancedConnectionCompleteV1Subevent ||
+           packet[2] == kLeEnhancedConnectionCompleteV2Subevent) &&
+          packet[3] == 0 /* SUCCESS */) {
+        uint16_t handle = GetUint16(packet, 4) & kHandleMask;
+        pending_connections_[handle] = now;
+        pending_nocp_.erase(handle);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+std::string HciTimingRecorder::GetReport() const {
+  std::string connections;
+  for (auto const& [handle, stats] : connections_) {
+    if (!connections.empty()) {
+      connections += ", ";
+    }
+    connections += fmt::format(
+        "{{\"handle\": {}, \"le_connection_complete_reaction\": {}, "
+        "\"nocp_to_acl\": {}}}",
+        handle, FormatStats(stats.le_connection_complete_reaction),
+        FormatStats(stats.nocp_to_acl));
+  }
+  return fmt::format(
+      "{{\"command_round_trip\": {}, \"host_command_turnaround\": {}, "
+      "\"connections\": [{}]}}",
+      FormatStats(command_round_trip_), FormatStats(host_command_turnaround_),
+      connections);
+}
+
+void HciTimingRecorder::RegisterCallbacks(PacketCallback packet_callback,
+                                          CloseCallback close_callback) {
+  transport_->RegisterCallbacks(
+      [this, packet_callback](
+          PacketType packet_type,
+          const std::shared_ptr<std::vector<uint8_t>> packet) {
+        RecordHostPacket(packet_type, *packet);
+        packet_callback(packet_type, packet);
+      },
+      close_callback);
+}
+
+void HciTimingRecorder::Tick() { transport_->Tick(); }
+
+void HciTimingRecorder::Close() {
+  transport_->Close();
+  if (output_ != nullptr && !report_written_) {
+    *output_ << GetReport() << std::endl;
+    report_written_ = true;
+  }
+}
+
+void HciTimingRecorder::Send(PacketType packet_type,
+                             const std::vector<uint8_t>& packet) {
+  RecordControllerPacket(packet_type, packet);
+  transport_->Send(packet_type, packet);
+}
+
+}  // namespace rootcanal
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "model/hci/h4.h"
+#include "model/hci/hci_transport.h"
+
+namespace rootcanal {
+
+// A Hci Transport that measures how fast the host reacts to the controller,
+// and writes a JSON report of the measurements to a stream when closed.
+// The following intervals are recorded:
+//  - command_round_trip: from an HCI command to its Command Complete or
+//    Command Status event.
+//  - host_command_turnaround: from a Command Complete or Command Status
+//    event to the next HCI command sent by the host.
+//  - le_connection_complete_reaction (per connection): from an LE
+//    Connection Complete event to the next command, or ACL packet for the
+//    connection, sent by the host.
+//  - nocp_to_acl (per connection): from a Number Of Completed Packets event
+//    to the next ACL packet sent by the host for the connection.
+class HciTimingRecorder : public HciTransport {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Stats {
+    uint64_t count{0};
+    Clock::duration total{};
+    Clock::duration min{Clock::duration::max()};
+    Clock::duration max{};
+
+    void Add(Clock::duration interval);
+  };
+
+  struct ConnectionStats {
+    Stats le_connection_complete_reaction;
+    Stats nocp_to_acl;
+  };
+
+  HciTimingRecorder(std::shared_ptr<HciTransport> transport,
+                    std::shared_ptr<std::ostream> output_stream = nullptr);
+  ~HciTimingRecorder() = default;
+
+  static std::shared_ptr<HciTransport> Create(
+      std::shared_ptr<HciTransport> transport,
+      std::shared_ptr<std::ostream> output_stream = nullptr) {
+    return std::make_shared<HciTimingRecorder>(transport, output_stream);
+  }
+
+  void SetOutputStream(std::shared_ptr<std::ostream> output_stream);
+
+  void Send(PacketType packet_type,
+            const std::vector<uint8_t>& packet) override;
+
+  void RegisterCallbacks(PacketCallback packet_callback,
+                         CloseCallback close_callback) override;
+
+  void Tick() override;
+  void Close() override;
+
+  Stats const& GetCommandRoundTrip() const { return command_round_trip_; }
+  Stats const& GetHostCommandTurnaround() const {
+    return host_command_turnaround_;
+  }
+  std::map<uint16_t, ConnectionStats> const& GetConnectionStats() const {
+    return connections_;
+  }
+
+  // Return the measurements formatted as a JSON object.
+  std::string GetReport() const;
+
+ private:
+  void RecordHostPacket(PacketType packet_type,
+                        const std::vector<uint8_t>& packet);
+  void RecordControllerPacket(PacketType packet_type,
+                              const std::vector<uint8_t>& packet);
+  void RecordCommandResponse(uint16_t op_code, Clock::time_point now);
+  void RecordHostReaction(std::optional<uint16_t> acl_handle,
+                          Clock::time_point now);
+
+  std::shared_ptr<HciTransport> transport_;
+  std::shared_ptr<std::ostream> output_;
+  bool report_written_{false};
+
+  Stats command_round_trip_;
+  Stats host_command_turnaround_;
+  std::map<uint16_t, ConnectionStats> connections_;
+
+  // Commands waiting for their Command Complete or Command Status event,
+  // keyed by opcode.
+  std::unordered_map<uint16_t, Clock::time_point> pending_commands_;
+  std::optional<Clock::time_point> last_command_response_;
+  std::unordered_map<uint16_t, Clock::time_point> pending_connections_;
+  std::unordered_map<uint16_t, Clock::time_point> pending_nocp_;
+};
+
+}  // namespace rootcanal
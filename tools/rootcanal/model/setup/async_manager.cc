@@ -23,6 +23,9 @@
 #include <mutex>
 #include <sys/select.h>
 #include <thread>
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
 #include <unistd.h>
 #include <vector>
 
@@ -49,7 +52,10 @@ namespace rootcanal {
 // After construction of this objects nothing happens beyond some very simple
 // member initialization. When the first FD is set up for watching the object
 // starts a new thread which watches the given (and later provided) FDs using
-// select() inside a loop. A special FD (a pipe) is also watched which is
+// epoll (select() where epoll is not available) inside a loop. Unlike select()
+// the epoll set is kept up to date as FDs are added and removed, so neither
+// the number of FDs nor their values are limited by FD_SETSIZE and a wakeup
+// does not rebuild the set. A special FD (a pipe) is also watched which is
 // used to notify the thread of internal changes on the object state (like
 // the addition of new FDs to watch on). Every access to internal state is
 // synchronized using a single internal mutex. The thread is only stopped on
@@ -101,6 +107,12 @@ static inline AsyncTaskId NextAsyncTaskId(const AsyncTaskId id) {
 // no need to treat that case.
 static const int kNotificationBufferSize = 10;
 
+#ifdef __linux__
+// Maximum number of ready FDs handled per epoll_wait() call. FDs that are
+// still ready are reported again by the next call.
+static const int kMaxEpollEvents = 64;
+#endif
+
 // Async File Descriptor Watcher Implementation:
 class AsyncManager::AsyncFdWatcher {
  public:
@@ -110,6 +122,12 @@ class AsyncManager::AsyncFdWatcher {
     {
       std::unique_lock<std::recursive_mutex> guard(internal_mutex_);
       watched_shared_fds_[file_descriptor] = on_read_fd_ready_callback;
+#ifdef __linux__
+      if (addToEpollSet(file_descriptor) != 0) {
+        watched_shared_fds_.erase(file_descriptor);
+        return -1;
+      }
+#endif
     }
 
     // start the thread if not started yet
@@ -127,14 +145,37 @@ class AsyncManager::AsyncFdWatcher {
 
   void StopWatchingFileDescriptor(int file_descriptor) {
     std::unique_lock<std::recursive_mutex> guard(internal_mutex_);
-    watched_shared_fds_.erase(file_descriptor);
+    if (watched_shared_fds_.erase(file_descriptor) == 0) {
+      return;
+    }
+#ifdef __linux__
+    // The FD may already have been closed, which removes it from the set.
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, file_descriptor, nullptr);
+#endif
   }
 
+#ifdef __linux__
+  AsyncFdWatcher() : epoll_fd_(epoll_create1(EPOLL_CLOEXEC)) {
+    if (epoll_fd_ < 0) {
+      ERROR("{}: Unable to create the epoll instance: {}", __func__,
+            strerror(errno));
+    }
+  }
+#else
   AsyncFdWatcher() = default;
+#endif
   AsyncFdWatcher(const AsyncFdWatcher&) = delete;
   AsyncFdWatcher& operator=(const AsyncFdWatcher&) = delete;
 
+#ifdef __linux__
+  ~AsyncFdWatcher() {
+    if (epoll_fd_ >= 0) {
+      close(epoll_fd_);
+    }
+  }
+#else
   ~AsyncFdWatcher() = default;
+#endif
 
   int stopThread() {
     if (!std::atomic_exchange(&running_, false)) {
@@ -152,6 +193,11 @@ class AsyncManager::AsyncFdWatcher {
 
     {
       std::unique_lock<std::recursive_mutex> guard(internal_mutex_);
+#ifdef __linux__
+      for (auto& fdp : watched_shared_fds_) {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fdp.first, nullptr);
+      }
+#endif
       watched_shared_fds_.clear();
     }
 
@@ -186,6 +232,15 @@ class AsyncManager::AsyncFdWatcher {
 
     notification_listen_fd_ = pipe_fds[0];
     notification_write_fd_ = pipe_fds[1];
+#ifdef __linux__
+    if (addToEpollSet(notification_listen_fd_) != 0) {
+      ERROR(
+          "{}: Unable to watch the communication channel to the reading "
+          "thread",
+          __func__);
+      return -1;
+    }
+#endif
 
     thread_ = std::thread([this]() { ThreadRoutine(); });
     if (!thread_.joinable()) {
@@ -204,6 +259,80 @@ class AsyncManager::AsyncFdWatcher {
     return 0;
   }
 
+#ifdef __linux__
+  int addToEpollSet(int file_descriptor) {
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = file_descriptor;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, file_descriptor, &event) == 0) {
+      return 0;
+    }
+    // The FD is already in the set when it is watched again with a new
+    // callback.
+    if (errno == EEXIST &&
+        epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, file_descriptor, &event) == 0) {
+      return 0;
+    }
+    ERROR("{}: Unable to watch file descriptor {}: {}", __func__,
+          file_descriptor, strerror(errno));
+    return -1;
+  }
+
+  // read everything there is on the comm channel
+  void consumeThreadNotifications() const {
+    char buffer[kNotificationBufferSize];
+    while (TEMP_FAILURE_RETRY(read(notification_listen_fd_, buffer,
+                                   kNotificationBufferSize)) ==
+           kNotificationBufferSize) {
+    }
+  }
+
+  // call the callbacks of the ready file descriptors that are still watched
+  void runAppropriateCallbacks(const struct epoll_event* events,
+                               int num_events) {
+    std::vector<decltype(watched_shared_fds_)::value_type> fds;
+    std::unique_lock<std::recursive_mutex> guard(internal_mutex_);
+    for (int i = 0; i < num_events; i++) {
+      auto it = watched_shared_fds_.find(events[i].data.fd);
+      if (it != watched_shared_fds_.end()) {
+        fds.push_back(*it);
+      }
+    }
+    for (auto& p : fds) {
+      p.second(p.first);
+    }
+  }
+
+  void ThreadRoutine() {
+    struct epoll_event events[kMaxEpollEvents];
+    while (running_) {
+      // wait until there is data available to read on some FD
+      int retval = epoll_wait(epoll_fd_, events, kMaxEpollEvents, -1);
+      if (retval <= 0) {  // there was some error or a timeout
+        if (errno != EINTR) {
+          ERROR(
+              "{}: There was an error while waiting for data on the file "
+              "descriptors: {}",
+              __func__, strerror(errno));
+        }
+        continue;
+      }
+
+      for (int i = 0; i < retval; i++) {
+        if (events[i].data.fd == notification_listen_fd_) {
+          consumeThreadNotifications();
+        }
+      }
+
+      // Do not read if there was a call to stop running
+      if (!running_) {
+        break;
+      }
+
+      runAppropriateCallbacks(events, retval);
+    }
+  }
+#else
   int setUpFileDescriptorSet(fd_set& read_fds) {
     // add comm channel to the set
     FD_SET(notification_listen_fd_, &read_fds);
@@ -273,6 +402,7 @@ class AsyncManager::AsyncFdWatcher {
       runAppropriateCallbacks(read_fds);
     }
   }
+#endif
 
   std::atomic_bool running_{false};
   std::thread thread_;
@@ -283,6 +413,11 @@ class AsyncManager::AsyncFdWatcher {
   // A pair of FD to send information to the reading thread
   int notification_listen_fd_{};
   int notification_write_fd_{};
+
+#ifdef __linux__
+  // The set of watched FDs, including the notification channel
+  int epoll_fd_{-1};
+#endif
 };
 
 // Async task manager implementation
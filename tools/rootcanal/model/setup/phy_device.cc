@@ -48,13 +48,10 @@ void PhyDevice::SetAddress(bluetooth::hci::Address address) {
   device_->SetAddress(std::move(address));
 }
 
-void PhyDevice::Receive(std::vector<uint8_t> const& packet, Phy::Type type,
-                        int8_t rssi) {
-  std::shared_ptr<std::vector<uint8_t>> packet_copy =
-      std::make_shared<std::vector<uint8_t>>(packet);
+void PhyDevice::Receive(std::shared_ptr<std::vector<uint8_t>> const& packet,
+                        Phy::Type type, int8_t rssi) {
   model::packets::LinkLayerPacketView packet_view =
-      model::packets::LinkLayerPacketView::Create(
-          pdl::packet::slice(packet_copy));
+      model::packets::LinkLayerPacketView::Create(pdl::packet::slice(packet));
   if (packet_view.IsValid()) {
     device_->ReceiveLinkLayerPacket(std::move(packet_view), type, rssi);
   } else {
@@ -62,8 +59,8 @@ void PhyDevice::Receive(std::vector<uint8_t> const& packet, Phy::Type type,
   }
 }
 
-void PhyDevice::Send(std::vector<uint8_t> const& packet, Phy::Type type,
-                     int8_t tx_power) {
+void PhyDevice::Send(std::shared_ptr<std::vector<uint8_t>> const& packet,
+                     Phy::Type type, int8_t tx_power) {
   for (auto const& phy : phy_layers_) {
     if (phy->type == type) {
       phy->Send(packet, tx_power, id);
@@ -71,6 +68,13 @@ void PhyDevice::Send(std::vector<uint8_t> const& packet, Phy::Type type,
   }
 }
 
+void PhyDevice::SetPosition(Position position) {
+  position_ = position;
+  for (auto const& phy : phy_layers_) {
+    phy->InvalidateRangeIndex();
+  }
+}
+
 std::string PhyDevice::ToString() { return device_->ToString(); }
 
 }  // namespace rootcanal
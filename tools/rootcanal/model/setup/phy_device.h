@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <unordered_set>
 
 #include "model/devices/device.h"
@@ -31,6 +32,12 @@ class PhyDevice {
  public:
   using Identifier = uint32_t;
 
+  // Position of a device in meters.
+  struct Position {
+    double x;
+    double y;
+  };
+
   PhyDevice(std::string type, std::shared_ptr<Device> device);
   PhyDevice(PhyDevice &&) = delete;
   ~PhyDevice() = default;
@@ -39,15 +46,23 @@ class PhyDevice {
   void Unregister(PhyLayer* phy);
 
   void Tick();
-  void Receive(std::vector<uint8_t> const& packet, Phy::Type type, int8_t rssi);
-  void Send(std::vector<uint8_t> const& packet, Phy::Type type,
-            int8_t tx_power);
+  // The packet is shared with the other receivers and must not be modified.
+  void Receive(std::shared_ptr<std::vector<uint8_t>> const& packet,
+               Phy::Type type, int8_t rssi);
+  void Send(std::shared_ptr<std::vector<uint8_t>> const& packet,
+            Phy::Type type, int8_t tx_power);
 
   bluetooth::hci::Address GetAddress() const;
   std::shared_ptr<Device> GetDevice() const;
   void SetAddress(bluetooth::hci::Address address);
   std::string ToString();
 
+  // The position is used by range limited phy layers to select the devices
+  // in radio range and compute the RSSI. Devices without a position are in
+  // range of all devices.
+  std::optional<Position> GetPosition() const { return position_; }
+  void SetPosition(Position position);
+
   // Id and type are public but immutable.
   const Identifier id;
   const std::string type;
@@ -55,6 +70,7 @@ class PhyDevice {
  private:
   const std::shared_ptr<Device> device_;
   std::unordered_set<PhyLayer*> phy_layers_;
+  std::optional<Position> position_;
 };
 
 }  // namespace rootcanal
@@ -16,15 +16,23 @@
 
 #include "phy_layer.h"
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 namespace rootcanal {
 
+// Path loss at the reference distance of 1 meter for 2.4 GHz, and the path
+// loss exponent of free space.
+static constexpr double kReferencePathLoss = 40.0;
+static constexpr double kPathLossExponent = 2.0;
+
 PhyLayer::PhyLayer(Identifier id, Phy::Type type) : id(id), type(type) {}
 
 void PhyLayer::Register(std::shared_ptr<PhyDevice> device) {
   device->Register(this);
   phy_devices_.push_back(device);
+  InvalidateRangeIndex();
 }
 
 void PhyLayer::Unregister(PhyDevice::Identifier id) {
@@ -32,6 +40,7 @@ void PhyLayer::Unregister(PhyDevice::Identifier id) {
     if (device->id == id) {
       device->Unregister(this);
       phy_devices_.remove(device);
+      InvalidateRangeIndex();
       return;
     }
   }
@@ -42,6 +51,33 @@ void PhyLayer::UnregisterAll() {
     device->Unregister(this);
   }
   phy_devices_.clear();
+  InvalidateRangeIndex();
+}
+
+void PhyLayer::SetRange(double range) {
+  range_ = std::max(range, 0.0);
+  InvalidateRangeIndex();
+}
+
+PhyLayer::GridCell PhyLayer::GetGridCell(PhyDevice::Position position) const {
+  return {static_cast<int64_t>(std::floor(position.x / range_)),
+          static_cast<int64_t>(std::floor(position.y / range_))};
+}
+
+void PhyLayer::BuildRangeIndex() {
+  range_index_.clear();
+  device_positions_.clear();
+  unpositioned_devices_.clear();
+  for (auto const& device : phy_devices_) {
+    auto position = device->GetPosition();
+    if (position.has_value()) {
+      range_index_[GetGridCell(*position)].push_back(device);
+      device_positions_[device->id] = *position;
+    } else {
+      unpositioned_devices_.push_back(device);
+    }
+  }
+  range_index_valid_ = true;
 }
 
 int8_t PhyLayer::ComputeRssi(PhyDevice::Identifier /*sender_id*/,
@@ -55,8 +91,19 @@ int8_t PhyLayer::ComputeRssi(PhyDevice::Identifier /*sender_id*/,
   return static_cast<int8_t>(-rssi);
 }
 
-void PhyLayer::Send(std::vector<uint8_t> const& packet, int8_t tx_power,
-                    PhyDevice::Identifier sender_id) {
+void PhyLayer::Send(std::shared_ptr<std::vector<uint8_t>> const& packet,
+                    int8_t tx_power, PhyDevice::Identifier sender_id) {
+  if (range_ > 0) {
+    if (!range_index_valid_) {
+      BuildRangeIndex();
+    }
+    auto sender = device_positions_.find(sender_id);
+    if (sender != device_positions_.end()) {
+      SendInRange(packet, tx_power, sender_id, sender->second);
+      return;
+    }
+  }
+
   for (const auto& device : phy_devices_) {
     // Do not send the packet back to the sender.
     if (sender_id != device->id) {
@@ -66,6 +113,52 @@ void PhyLayer::Send(std::vector<uint8_t> const& packet, int8_t tx_power,
   }
 }
 
+void PhyLayer::SendInRange(std::shared_ptr<std::vector<uint8_t>> const& packet,
+                           int8_t tx_power, PhyDevice::Identifier sender_id,
+                           PhyDevice::Position sender_position) {
+  // Collect the receivers first, receiving a packet may cause devices to
+  // send, register or move, which invalidates the index.
+  std::vector<std::pair<std::shared_ptr<PhyDevice>, int8_t>> receivers;
+  auto [cell_x, cell_y] = GetGridCell(sender_position);
+  for (int64_t x = cell_x - 1; x <= cell_x + 1; x++) {
+    for (int64_t y = cell_y - 1; y <= cell_y + 1; y++) {
+      auto cell = range_index_.find({x, y});
+      if (cell == range_index_.end()) {
+        continue;
+      }
+      for (auto const& device : cell->second) {
+        if (device->id == sender_id) {
+          continue;
+        }
+        auto position = *device->GetPosition();
+        double distance = std::hypot(position.x - sender_position.x,
+                                     position.y - sender_position.y);
+        if (distance > range_) {
+          continue;
+        }
+        // Log-distance path loss model, closer than the reference distance
+        // the path loss is that of the reference distance.
+        double path_loss =
+            kReferencePathLoss +
+            10.0 * kPathLossExponent * std::log10(std::max(distance, 1.0));
+        receivers.emplace_back(
+            device, static_cast<int8_t>(std::clamp(tx_power - path_loss,
+                                                   -127.0, 20.0)));
+      }
+    }
+  }
+  for (auto const& device : unpositioned_devices_) {
+    if (device->id != sender_id) {
+      receivers.emplace_back(device,
+                             ComputeRssi(sender_id, device->id, tx_power));
+    }
+  }
+
+  for (auto const& [device, rssi] : receivers) {
+    device->Receive(packet, type, rssi);
+  }
+}
+
 void PhyLayer::Tick() {
   for (auto& device : phy_devices_) {
     device->Tick();
@@ -18,6 +18,7 @@
 
 #include <list>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "phy.h"
@@ -35,8 +36,9 @@ class PhyLayer {
   virtual ~PhyLayer() {}
 
   void Tick();
-  virtual void Send(std::vector<uint8_t> const& packet, int8_t tx_power,
-                    PhyDevice::Identifier sender_id);
+  // The packet is not copied, all the receivers share the same buffer.
+  virtual void Send(std::shared_ptr<std::vector<uint8_t>> const& packet,
+                    int8_t tx_power, PhyDevice::Identifier sender_id);
 
   // Compute the RSSI for a packet sent from one device to the other
   // with the specified TX power.
@@ -48,6 +50,15 @@ class PhyLayer {
   void Unregister(PhyDevice::Identifier device_id);
   void UnregisterAll();
 
+  // Only deliver packets to the devices within the given distance (in
+  // meters) of the sender, with an RSSI derived from the distance. The range
+  // only applies between devices that have a position. A range of 0 delivers
+  // all packets to all devices.
+  void SetRange(double range);
+
+  // Must be called when the position of a registered device changes.
+  void InvalidateRangeIndex() { range_index_valid_ = false; }
+
   std::string ToString() const;
 
   // Id and type are public but immutable.
@@ -57,6 +68,34 @@ class PhyLayer {
  protected:
   // List of devices currently connected to the phy.
   std::list<std::shared_ptr<rootcanal::PhyDevice>> phy_devices_;
+
+ private:
+  using GridCell = std::pair<int64_t, int64_t>;
+
+  struct GridCellHash {
+    size_t operator()(GridCell const& cell) const {
+      return std::hash<int64_t>()(cell.first * 31 + cell.second);
+    }
+  };
+
+  GridCell GetGridCell(PhyDevice::Position position) const;
+  void BuildRangeIndex();
+  void SendInRange(std::shared_ptr<std::vector<uint8_t>> const& packet,
+                   int8_t tx_power, PhyDevice::Identifier sender_id,
+                   PhyDevice::Position sender_position);
+
+  // Radio range in meters, 0 when packets are delivered to all devices.
+  double range_{0};
+
+  // Devices with a position, bucketed in square cells as large as the range
+  // so that the devices in range of a sender are in the 3x3 cells around it.
+  bool range_index_valid_{false};
+  std::unordered_map<GridCell, std::vector<std::shared_ptr<PhyDevice>>,
+                     GridCellHash>
+      range_index_;
+  std::unordered_map<PhyDevice::Identifier, PhyDevice::Position>
+      device_positions_;
+  std::vector<std::shared_ptr<PhyDevice>> unpositioned_devices_;
 };
 
 }  // namespace rootcanal
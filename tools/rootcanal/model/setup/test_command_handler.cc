@@ -35,6 +35,10 @@ static size_t ParseIntParam(std::string const& in) {
   return static_cast<size_t>(std::strtoul(in.c_str(), nullptr, 0));
 }
 
+static double ParseDoubleParam(std::string const& in) {
+  return std::strtod(in.c_str(), nullptr);
+}
+
 TestCommandHandler::TestCommandHandler(TestModel& test_model)
     : model_(test_model) {
 #define SET_HANDLER(command_name, method)                                     \
@@ -51,9 +55,12 @@ TestCommandHandler::TestCommandHandler(TestModel& test_model)
   SET_HANDLER("list", List);
   SET_HANDLER("set_device_address", SetDeviceAddress);
   SET_HANDLER("set_device_configuration", SetDeviceConfiguration);
+  SET_HANDLER("set_device_position", SetDevicePosition);
+  SET_HANDLER("set_phy_range", SetPhyRange);
   SET_HANDLER("set_timer_period", SetTimerPeriod);
   SET_HANDLER("start_timer", StartTimer);
   SET_HANDLER("stop_timer", StopTimer);
+  SET_HANDLER("set_virtual_time", SetVirtualTime);
   SET_HANDLER("reset", Reset);
 #undef SET_HANDLER
   send_response_ = [](std::string const&) {};
@@ -275,6 +282,38 @@ void TestCommandHandler::SetDeviceConfiguration(const vector<std::string>& args)
   send_response_(response_string_);
 }
 
+void TestCommandHandler::SetDevicePosition(const vector<std::string>& args) {
+  if (args.size() != 3) {
+    response_string_ =
+        "TestCommandHandler 'set_device_position' takes three arguments";
+    send_response_(response_string_);
+    return;
+  }
+  size_t device_id = ParseIntParam(args[0]);
+  model_.SetDevicePosition(
+      device_id, {ParseDoubleParam(args[1]), ParseDoubleParam(args[2])});
+  response_string_ = "set_device_position " + args[0];
+  response_string_ += " ";
+  response_string_ += args[1];
+  response_string_ += " ";
+  response_string_ += args[2];
+  send_response_(response_string_);
+}
+
+void TestCommandHandler::SetPhyRange(const vector<std::string>& args) {
+  if (args.size() != 2) {
+    response_string_ = "TestCommandHandler 'set_phy_range' takes two arguments";
+    send_response_(response_string_);
+    return;
+  }
+  size_t phy_id = ParseIntParam(args[0]);
+  model_.SetPhyRange(phy_id, ParseDoubleParam(args[1]));
+  response_string_ = "set_phy_range " + args[0];
+  response_string_ += " ";
+  response_string_ += args[1];
+  send_response_(response_string_);
+}
+
 void TestCommandHandler::SetTimerPeriod(const vector<std::string>& args) {
   if (args.size() != 1) {
     INFO("SetTimerPeriod takes 1 argument");
@@ -309,6 +348,19 @@ void TestCommandHandler::StopTimer(const vector<std::string>& args) {
   send_response_(response_string_);
 }
 
+void TestCommandHandler::SetVirtualTime(const vector<std::string>& args) {
+  if (args.size() != 1) {
+    response_string_ =
+        "TestCommandHandler 'set_virtual_time' takes one argument";
+    send_response_(response_string_);
+    return;
+  }
+  bool enabled = ParseIntParam(args[0]) != 0;
+  model_.SetVirtualTime(enabled);
+  response_string_ = enabled ? "virtual time enabled" : "virtual time disabled";
+  send_response_(response_string_);
+}
+
 void TestCommandHandler::Reset(const std::vector<std::string>& args) {
   if (!args.empty()) {
     INFO("Unused args: arg[0] = {}", args[0]);
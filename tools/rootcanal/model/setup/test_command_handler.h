@@ -75,6 +75,12 @@ class TestCommandHandler {
   // Change the device's configuration
   void SetDeviceConfiguration(const std::vector<std::string>& args);
 
+  // Change the device's position, in meters
+  void SetDevicePosition(const std::vector<std::string>& args);
+
+  // Limit the radio range of a phy, in meters
+  void SetPhyRange(const std::vector<std::string>& args);
+
   // Timer management functions
   void SetTimerPeriod(const std::vector<std::string>& args);
 
@@ -82,6 +88,9 @@ class TestCommandHandler {
 
   void StopTimer(const std::vector<std::string>& args);
 
+  // Run the timer in virtual time (1) or real time (0)
+  void SetVirtualTime(const std::vector<std::string>& args);
+
   void Reset(const std::vector<std::string>& args);
 
   // For manual testing
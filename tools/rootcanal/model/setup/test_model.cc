@@ -28,10 +28,16 @@
 
 #include "include/phy.h"  // for Phy, Phy::Type
 #include "log.h"
+#include "simulation_clock.h"
 #include "phy_layer.h"
 
 namespace rootcanal {
 
+// In virtual time, the number of ticks run at each expiration of the timer,
+// and the real time period of the timer.
+static constexpr int kVirtualTicksPerTimerExpiration = 100;
+static constexpr std::chrono::milliseconds kVirtualTimeTimerPeriod{1};
+
 TestModel::TestModel(
     std::function<AsyncUserId()> get_user_id,
     std::function<AsyncTaskId(AsyncUserId, std::chrono::milliseconds,
@@ -59,6 +65,9 @@ TestModel::TestModel(
 
 TestModel::~TestModel() {
   StopTimer();
+  if (virtual_time_) {
+    SimulationClock::DisableVirtualTime();
+  }
 }
 
 void TestModel::SetTimerPeriod(std::chrono::milliseconds new_period) {
@@ -73,8 +82,36 @@ void TestModel::SetTimerPeriod(std::chrono::milliseconds new_period) {
   StartTimer();
 }
 
+void TestModel::SetVirtualTime(bool enabled) {
+  virtual_time_ = enabled;
+  if (enabled) {
+    SimulationClock::EnableVirtualTime();
+  } else {
+    SimulationClock::DisableVirtualTime();
+  }
+
+  if (timer_tick_task_ == kInvalidTaskId) {
+    return;
+  }
+
+  // Restart the timer in the new mode
+  StopTimer();
+  StartTimer();
+}
+
 void TestModel::StartTimer() {
   INFO("StartTimer()");
+  if (virtual_time_) {
+    timer_tick_task_ = schedule_periodic_task_(
+        model_user_id_, std::chrono::milliseconds(0), kVirtualTimeTimerPeriod,
+        [this]() {
+          for (int i = 0; i < kVirtualTicksPerTimerExpiration; i++) {
+            SimulationClock::Advance(timer_period_);
+            TestModel::Tick();
+          }
+        });
+    return;
+  }
   timer_tick_task_ =
       schedule_periodic_task_(model_user_id_, std::chrono::milliseconds(0),
                               timer_period_, [this]() { TestModel::Tick(); });
@@ -241,6 +278,19 @@ void TestModel::SetDeviceAddress(PhyDevice::Identifier device_id,
   }
 }
 
+void TestModel::SetDevicePosition(PhyDevice::Identifier device_id,
+                                  PhyDevice::Position position) {
+  if (phy_devices_.find(device_id) != phy_devices_.end()) {
+    phy_devices_[device_id]->SetPosition(position);
+  }
+}
+
+void TestModel::SetPhyRange(PhyLayer::Identifier phy_id, double range) {
+  if (phy_layers_.find(phy_id) != phy_layers_.end()) {
+    phy_layers_[phy_id]->SetRange(range);
+  }
+}
+
 void TestModel::SetDeviceConfiguration(PhyDevice::Identifier device_id,
                                        rootcanal::configuration::Controller const& configuration) {
   if (phy_devices_.find(device_id) != phy_devices_.end()) {
@@ -101,12 +101,25 @@ class TestModel {
   void SetDeviceConfiguration(PhyDevice::Identifier device_id,
                               rootcanal::configuration::Controller const& configuration);
 
+  // Set the device's position, used by range limited phys
+  void SetDevicePosition(PhyDevice::Identifier device_id,
+                         PhyDevice::Position position);
+
+  // Limit the phy's radio range, 0 to deliver packets to all devices
+  void SetPhyRange(PhyLayer::Identifier phy_id, double range);
+
   // Let devices know about the passage of time
   void Tick();
   void StartTimer();
   void StopTimer();
   void SetTimerPeriod(std::chrono::milliseconds new_period);
 
+  // In virtual time the timer runs a batch of ticks at each expiration,
+  // advancing the simulation clock by the timer period before each tick
+  // instead of waiting for it to elapse. Devices that exchange packets with
+  // real time hosts should not be simulated in virtual time.
+  void SetVirtualTime(bool enabled);
+
   // List the devices that the test knows about
   const std::string& List();
 
@@ -143,6 +156,7 @@ class TestModel {
   AsyncUserId model_user_id_;
   AsyncTaskId timer_tick_task_{kInvalidTaskId};
   std::chrono::milliseconds timer_period_{};
+  bool virtual_time_{false};
 };
 
 }  // namespace rootcanal
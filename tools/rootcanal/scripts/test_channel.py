@@ -220,6 +220,18 @@ class TestChannelShell(cmd.Cmd):
     """
         self._test_channel.send_command('set_device_configuration', args.split())
 
+    def do_set_device_position(self, args):
+        """Arguments: dev_num x y Set the position of device dev_num, in meters.
+
+    """
+        self._test_channel.send_command('set_device_position', args.split())
+
+    def do_set_phy_range(self, args):
+        """Arguments: phy_num range Only deliver packets on phy phy_num to devices within range meters.
+
+    """
+        self._test_channel.send_command('set_phy_range', args.split())
+
     def do_list(self, args):
         """Arguments: [dev_num [attr]] List the devices from the controller, optionally filtered by device and attr.
 
@@ -241,6 +253,11 @@ class TestChannelShell(cmd.Cmd):
     """
         self._test_channel.send_command('stop_timer', args.split())
 
+    def do_set_virtual_time(self, args):
+        """Arguments: enabled Run the timer in virtual time (1) or real time (0).
+    """
+        self._test_channel.send_command('set_virtual_time', args.split())
+
     def do_wait(self, args):
         """Arguments: time in seconds (float).
     """
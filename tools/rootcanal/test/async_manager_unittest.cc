@@ -414,6 +414,70 @@ class AsyncManagerTest : public ::testing::Test {
 
 TEST_F(AsyncManagerTest, TestSetupTeardown) {}
 
+TEST_F(AsyncManagerTest, TestManyWatchedFds) {
+  using namespace std::chrono_literals;
+  static const int num_pipes = 200;
+  int pipe_fds[num_pipes][2];
+  std::mutex m;
+  std::condition_variable cv;
+  int num_read = 0;
+
+  for (int i = 0; i < num_pipes; i++) {
+    ASSERT_EQ(pipe(pipe_fds[i]), 0) << strerror(errno);
+    ASSERT_EQ(async_manager_.WatchFdForNonBlockingReads(
+                  pipe_fds[i][0],
+                  [&](int fd) {
+                    char buf;
+                    ASSERT_EQ(read(fd, &buf, 1), 1);
+                    std::unique_lock<std::mutex> lk(m);
+                    num_read++;
+                    cv.notify_all();
+                  }),
+              0);
+  }
+  for (int i = 0; i < num_pipes; i++) {
+    ASSERT_EQ(write(pipe_fds[i][1], "1", 1), 1);
+  }
+
+  {
+    std::unique_lock<std::mutex> lk(m);
+    EXPECT_TRUE(cv.wait_for(lk, 1s, [&] { return num_read == num_pipes; }));
+  }
+
+  for (int i = 0; i < num_pipes; i++) {
+    async_manager_.StopWatchingFileDescriptor(pipe_fds[i][0]);
+    close(pipe_fds[i][0]);
+    close(pipe_fds[i][1]);
+  }
+}
+
+TEST_F(AsyncManagerTest, TestRewatchFdWithNewCallback) {
+  using namespace std::chrono_literals;
+  int pipe_fds[2];
+  ASSERT_EQ(pipe(pipe_fds), 0) << strerror(errno);
+  Event first_called;
+  Event second_called;
+
+  ASSERT_EQ(async_manager_.WatchFdForNonBlockingReads(
+                pipe_fds[0], [&](int) { first_called.set(); }),
+            0);
+  ASSERT_EQ(async_manager_.WatchFdForNonBlockingReads(pipe_fds[0],
+                                                      [&](int fd) {
+                                                        char buf;
+                                                        read(fd, &buf, 1);
+                                                        second_called.set();
+                                                      }),
+            0);
+  ASSERT_EQ(write(pipe_fds[1], "1", 1), 1);
+
+  EXPECT_TRUE(second_called.wait_for(100ms));
+  EXPECT_FALSE(*first_called);
+
+  async_manager_.StopWatchingFileDescriptor(pipe_fds[0]);
+  close(pipe_fds[0]);
+  close(pipe_fds[1]);
+}
+
 TEST_F(AsyncManagerTest, TestCancelTask) {
   AsyncUserId user1 = async_manager_.GetNextUserId();
   bool task1_ran = false;
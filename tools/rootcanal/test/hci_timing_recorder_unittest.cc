@@ -0,0 +1,139 @@
+/*
+ * Copyright 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "model/hci/hci_timing_recorder.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace rootcanal {
+
+// Transport that records the packets sent to the host and lets the test
+// inject packets from the host.
+class FakeTransport : public HciTransport {
+ public:
+  void Send(PacketType /*packet_type*/,
+            std::vector<uint8_t> const& /*packet*/) override {
+    sent_packets++;
+  }
+
+  void RegisterCallbacks(PacketCallback packet_callback,
+                         CloseCallback /*close_callback*/) override {
+    packet_callback_ = packet_callback;
+  }
+
+  void Tick() override {}
+  void Close() override { closed = true; }
+
+  void Receive(PacketType packet_type, std::vector<uint8_t> packet) {
+    packet_callback_(packet_type,
+                     std::make_shared<std::vector<uint8_t>>(std::move(packet)));
+  }
+
+  int sent_packets{0};
+  int received_packets{0};
+  bool closed{false};
+
+ private:
+  PacketCallback packet_callback_;
+};
+
+class HciTimingRecorderTest : public ::testing::Test {
+ public:
+  HciTimingRecorderTest() = default;
+  ~HciTimingRecorderTest() override = default;
+
+ protected:
+  void SetUp() override {
+    transport_ = std::make_shared<FakeTransport>();
+    output_ = std::make_shared<std::ostringstream>();
+    recorder_ = std::make_shared<HciTimingRecorder>(transport_, output_);
+    recorder_->RegisterCallbacks(
+        [this](PacketType, const std::shared_ptr<std::vector<uint8_t>>) {
+          transport_->received_packets++;
+        },
+        []() {});
+  }
+
+  std::shared_ptr<FakeTransport> transport_;
+  std::shared_ptr<std::ostringstream> output_;
+  std::shared_ptr<HciTimingRecorder> recorder_;
+};
+
+// HCI Reset command and its Command Complete event.
+static const std::vector<uint8_t> kResetCommand{0x03, 0x0c, 0x00};
+static const std::vector<uint8_t> kResetComplete{0x0e, 0x04, 0x01,
+                                                 0x03, 0x0c, 0x00};
+
+TEST_F(HciTimingRecorderTest, CommandRoundTrip) {
+  transport_->Receive(PacketType::COMMAND, kResetCommand);
+  recorder_->Send(PacketType::EVENT, kResetComplete);
+  transport_->Receive(PacketType::COMMAND, kResetCommand);
+  recorder_->Send(PacketType::EVENT, kResetComplete);
+
+  EXPECT_EQ(transport_->received_packets, 2);
+  EXPECT_EQ(transport_->sent_packets, 2);
+  EXPECT_EQ(recorder_->GetCommandRoundTrip().count, 2u);
+  EXPECT_EQ(recorder_->GetHostCommandTurnaround().count, 1u);
+}
+
+TEST_F(HciTimingRecorderTest, CommandStatus) {
+  // LE Create Connection, answered with a Command Status event.
+  transport_->Receive(PacketType::COMMAND, {0x0d, 0x20, 0x00});
+  recorder_->Send(PacketType::EVENT, {0x0f, 0x04, 0x00, 0x01, 0x0d, 0x20});
+  EXPECT_EQ(recorder_->GetCommandRoundTrip().count, 1u);
+}
+
+TEST_F(HciTimingRecorderTest, ConnectionMetrics) {
+  // LE Connection Complete for handle 0x0040.
+  recorder_->Send(PacketType::EVENT,
+                  {0x3e, 0x13, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+                   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                   0x00});
+  // ACL packets for another connection are not a reaction.
+  transport_->Receive(PacketType::ACL, {0x41, 0x00, 0x00, 0x00});
+  EXPECT_TRUE(recorder_->GetConnectionStats().empty());
+
+  transport_->Receive(PacketType::ACL, {0x40, 0x20, 0x00, 0x00});
+  ASSERT_EQ(recorder_->GetConnectionStats().count(0x40), 1u);
+  auto const& stats = recorder_->GetConnectionStats().at(0x40);
+  EXPECT_EQ(stats.le_connection_complete_reaction.count, 1u);
+  EXPECT_EQ(stats.nocp_to_acl.count, 0u);
+
+  // Two Number Of Completed Packets events before the next ACL packet only
+  // count once.
+  std::vector<uint8_t> nocp{0x13, 0x05, 0x01, 0x40, 0x00, 0x01, 0x00};
+  recorder_->Send(PacketType::EVENT, nocp);
+  recorder_->Send(PacketType::EVENT, nocp);
+  transport_->Receive(PacketType::ACL, {0x40, 0x20, 0x00, 0x00});
+  transport_->Receive(PacketType::ACL, {0x40, 0x20, 0x00, 0x00});
+  EXPECT_EQ(stats.nocp_to_acl.count, 1u);
+}
+
+TEST_F(HciTimingRecorderTest, ReportWrittenOnClose) {
+  transport_->Receive(PacketType::COMMAND, kResetCommand);
+  recorder_->Send(PacketType::EVENT, kResetComplete);
+  recorder_->Close();
+  recorder_->Close();
+
+  EXPECT_TRUE(transport_->closed);
+  EXPECT_EQ(output_->str(), recorder_->GetReport() + "\n");
+  EXPECT_NE(output_->str().find("\"command_round_trip\": {\"count\": 1"),
+            std::string::npos);
+}
+
+}  // namespace rootcanal